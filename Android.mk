@@ -186,6 +186,12 @@ ifeq ($(shell test $(PLATFORM_SDK_VERSION) -gt 28 -o $(IS_AT_LEAST_QPR1) = true
     include $(GOLDFISH_OPENGL_PATH)/system/codecs/omx/vpxdec/Android.mk
 endif
 
+ifneq (true,$(GOLDFISH_OPENGL_BUILD_FOR_HOST)) # Guest benchmarks
+    include $(GOLDFISH_OPENGL_PATH)/shared/OpenglCodecCommon_benchmarks/Android.mk
+    include $(GOLDFISH_OPENGL_PATH)/system/encoder_benchmarks/Android.mk
+    include $(GOLDFISH_OPENGL_PATH)/system/transport_benchmarks/Android.mk
+endif
+
 endif
 
 ifeq (true,$(GFXSTREAM)) # Vulkan lib tests
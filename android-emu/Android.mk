@@ -13,6 +13,7 @@ LOCAL_CFLAGS += \
 
 LOCAL_SRC_FILES := \
     aemu/base/AlignedBuf.cpp \
+    aemu/base/FlightRecorder.cpp \
     aemu/base/files/MemStream.cpp \
     aemu/base/files/Stream.cpp \
     aemu/base/files/StreamSerializing.cpp \
@@ -20,13 +21,17 @@ LOCAL_SRC_FILES := \
     aemu/base/StringFormat.cpp \
     aemu/base/Process.cpp \
     aemu/base/AndroidSubAllocator.cpp \
+    aemu/base/synchronization/AndroidLockFreeMessageChannel.cpp \
     aemu/base/synchronization/AndroidMessageChannel.cpp \
     aemu/base/threads/AndroidFunctorThread.cpp \
+    aemu/base/threads/AndroidThreadPolicy.cpp \
     aemu/base/threads/AndroidThreadStore.cpp \
     aemu/base/threads/AndroidThread_pthread.cpp \
     aemu/base/threads/AndroidWorkPool.cpp \
+    aemu/base/threads/AndroidWorkStealingPool.cpp \
     aemu/base/AndroidHealthMonitor.cpp \
     aemu/base/AndroidHealthMonitorConsumerBasic.cpp \
+    aemu/base/MemoryAccounting.cpp \
     aemu/base/Tracing.cpp \
     android/utils/debug.c \
 
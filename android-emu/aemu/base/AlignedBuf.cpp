@@ -14,8 +14,86 @@
 
 #include "AlignedBuf.h"
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(__ANDROID__)
+#include <cutils/properties.h>
+#endif
+
 namespace android {
 
+namespace {
+
+bool largeBufHugePagesEnabled() {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    static const bool sEnabled = [] {
+#if defined(__ANDROID__)
+        char value[PROPERTY_VALUE_MAX] = "";
+        property_get("debug.gfxstream.huge_pages", value, "");
+        return value[0] != '0';
+#else
+        return true;
+#endif
+    }();
+    return sEnabled;
+#else
+    return false;
+#endif
+}
+
+}  // namespace
+
+size_t large_buf_alignment(size_t size) {
+    if (size < kLargeBufHugePageSize || !largeBufHugePagesEnabled()) {
+        return 1;
+    }
+    return kLargeBufHugePageSize;
+}
+
+void large_buf_advise(void* ptr, size_t size, bool prefault) {
+    if (!ptr || size < kLargeBufHugePageSize || !largeBufHugePagesEnabled()) {
+        return;
+    }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    const uintptr_t start = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t hugeBegin =
+        (start + kLargeBufHugePageSize - 1) & ~(uintptr_t)(kLargeBufHugePageSize - 1);
+    const uintptr_t hugeEnd = (start + size) & ~(uintptr_t)(kLargeBufHugePageSize - 1);
+    if (hugeBegin < hugeEnd) {
+        // Only advice: without THP in the kernel this fails and nothing
+        // changes.
+        madvise(reinterpret_cast<void*>(hugeBegin), hugeEnd - hugeBegin, MADV_HUGEPAGE);
+    }
+    if (prefault) {
+        // One write per small page; where the advice took, the first one of
+        // each huge page faults it in whole.
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        volatile char* bytes = static_cast<volatile char*>(ptr);
+        for (size_t offset = 0; offset < size; offset += pageSize) {
+            bytes[offset] = 0;
+        }
+    }
+#else
+    (void)prefault;
+#endif
+}
+
+void* large_buf_alloc(size_t size, bool prefault) {
+    const size_t align = large_buf_alignment(size);
+    if (align == 1) {
+        return malloc(size);
+    }
+    void* res;
+    if (posix_memalign(&res, align, size)) {
+        return nullptr;
+    }
+    large_buf_advise(res, size, prefault);
+    return res;
+}
+
 // Convenience function for aligned malloc across platforms
 void* aligned_buf_alloc(size_t align, size_t size) {
     size_t actualAlign = std::max(align, sizeof(void*));
@@ -32,6 +32,22 @@
 
 namespace android {
 
+// Buffers of at least this many bytes are backed by transparent huge pages
+// where the kernel has them, unless debug.gfxstream.huge_pages is 0.
+constexpr size_t kLargeBufHugePageSize = 2 * 1024 * 1024;
+
+// The alignment a buffer of |size| bytes needs to start on a huge page.
+size_t large_buf_alignment(size_t size);
+
+// Asks for huge pages over the part of [ptr, ptr + size) that whole huge
+// pages cover. With |prefault|, also faults every page in up front, which
+// zeroes them, so only for memory with nothing in it yet.
+void large_buf_advise(void* ptr, size_t size, bool prefault);
+
+// malloc() for large buffers that are streamed through: free() and
+// realloc() take the result.
+void* large_buf_alloc(size_t size, bool prefault);
+
 template <class T, size_t align>
 class AlignedBuf {
 public:
@@ -124,10 +140,12 @@ private:
         return _aligned_malloc(sizeBytes, actualAlign);
 #else
         void* res;
+        actualAlign = std::max(actualAlign, large_buf_alignment(sizeBytes));
         if (posix_memalign(&res, actualAlign, sizeBytes)) {
             fprintf(stderr, "%s: failed to alloc aligned memory\n", __func__);
             abort();
         }
+        large_buf_advise(res, sizeBytes, false);
         return res;
 #endif
     }
@@ -33,8 +33,12 @@ template <class... Ts>
 MonitoredEventVisitor(Ts...) -> MonitoredEventVisitor<Ts...>;
 
 template <class Clock>
-HealthMonitor<Clock>::HealthMonitor(HealthMonitorConsumer& consumer, uint64_t heartbeatInterval)
-    : mInterval(Duration(std::chrono::milliseconds(heartbeatInterval))), mConsumer(consumer) {
+HealthMonitor<Clock>::HealthMonitor(HealthMonitorConsumer& consumer, uint64_t heartbeatInterval,
+                                    uint64_t latencySloMs)
+    : mInterval(Duration(std::chrono::milliseconds(heartbeatInterval))),
+      mLatencySlo(Duration(std::chrono::milliseconds(latencySloMs))),
+      mConsumer(consumer),
+      mLastLatencyReport(Clock::now()) {
     start();
 }
 
@@ -153,6 +157,7 @@ intptr_t HealthMonitor<Clock>::main() {
                                         .emplace(event.id,
                                                  std::move(MonitoredTask{
                                                      .id = event.id,
+                                                     .startTimestamp = event.timeOccurred,
                                                      .timeoutTimestamp = event.timeOccurred +
                                                                          event.timeoutThreshold,
                                                      .timeoutThreshold = event.timeoutThreshold,
@@ -187,6 +192,7 @@ intptr_t HealthMonitor<Clock>::main() {
 
                                auto& task = it->second;
                                task.timeoutTimestamp = event.timeOccurred + task.timeoutThreshold;
+                               task.latency = event.timeOccurred - task.startTimestamp;
                                updateTaskParent(events, task, event.timeOccurred);
 
                                // Mark it for deletion, but retain it until the end of
@@ -235,10 +241,13 @@ intptr_t HealthMonitor<Clock>::main() {
                 }
             }
             if (tasksToRemove.find(task_id) != tasksToRemove.end()) {
+                recordLatency(task);
                 mMonitoredTasks.erase(task_id);
             }
         }
 
+        reportLatencies(now);
+
         if (mHungTasks != newHungTasks) {
             ALOGE("HealthMonitor: Number of unresponsive tasks %s: %d -> %d",
                 mHungTasks < newHungTasks ? "increased" : "decreaased", mHungTasks, newHungTasks);
@@ -253,6 +262,66 @@ intptr_t HealthMonitor<Clock>::main() {
     return 0;
 }
 
+template <class Clock>
+void HealthMonitor<Clock>::recordLatency(MonitoredTask& task) {
+    if (!task.latency || !task.metadata) {
+        return;
+    }
+    const Duration latency = task.latency.value();
+    auto& latencies = mTaskLatencies[LatencySite(task.metadata->file, task.metadata->line)];
+
+    const uint64_t us = duration_cast<std::chrono::microseconds>(latency).count();
+    size_t bucket = 0;
+    while (bucket + 1 < kLatencyBuckets && (us >> (bucket + 1))) {
+        ++bucket;
+    }
+    ++latencies.buckets[bucket];
+    ++latencies.count;
+    if (!latencies.slowest || latency > latencies.max) {
+        latencies.max = latency;
+        latencies.slowest = std::move(task.metadata);
+    }
+}
+
+template <class Clock>
+void HealthMonitor<Clock>::reportLatencies(Timestamp now) {
+    if (now - mLastLatencyReport < Duration(std::chrono::milliseconds(kLatencyReportIntervalMs))) {
+        return;
+    }
+    mLastLatencyReport = now;
+
+    const uint64_t sloUs = duration_cast<std::chrono::microseconds>(mLatencySlo).count();
+    for (auto& [_, latencies] : mTaskLatencies) {
+        const uint64_t maxUs = duration_cast<std::chrono::microseconds>(latencies.max).count();
+        // Upper bound of the bucket holding the given fraction of tasks, capped at the slowest.
+        auto percentileUs = [&latencies, maxUs](uint64_t percent) {
+            const uint64_t rank = (latencies.count * percent + 99) / 100;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < kLatencyBuckets; ++i) {
+                seen += latencies.buckets[i];
+                if (seen >= rank) {
+                    const uint64_t upperUs = uint64_t(2) << i;
+                    return upperUs < maxUs ? upperUs : maxUs;
+                }
+            }
+            return maxUs;
+        };
+
+        EventLatencyReport report = {
+            .slowest = latencies.slowest.get(),
+            .count = latencies.count,
+            .p50Us = percentileUs(50),
+            .p99Us = percentileUs(99),
+            .maxUs = maxUs,
+            .sloUs = sloUs,
+        };
+        if (report.p99Us > sloUs) {
+            mConsumer.consumeLatencyEvent(report);
+        }
+    }
+    mTaskLatencies.clear();
+}
+
 template <class Clock>
 void HealthMonitor<Clock>::updateTaskParent(std::queue<std::unique_ptr<MonitoredEvent>>& events,
                                             const MonitoredTask& task, Timestamp eventTime) {
@@ -265,10 +334,11 @@ void HealthMonitor<Clock>::updateTaskParent(std::queue<std::unique_ptr<Monitored
 }
 
 std::unique_ptr<HealthMonitor<>> CreateHealthMonitor(HealthMonitorConsumer& consumer,
-                                                     uint64_t heartbeatInterval) {
+                                                     uint64_t heartbeatInterval,
+                                                     uint64_t latencySloMs) {
 #ifdef ENABLE_ANDROID_HEALTH_MONITOR
     ALOGI("HealthMonitor enabled. Returning monitor.");
-    return std::make_unique<HealthMonitor<>>(consumer, heartbeatInterval);
+    return std::make_unique<HealthMonitor<>>(consumer, heartbeatInterval, latencySloMs);
 #else
     ALOGI("HealthMonitor disabled. Returning nullptr");
     return nullptr;
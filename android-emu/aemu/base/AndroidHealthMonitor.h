@@ -15,9 +15,11 @@
  */
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <functional>
 #include <future>
+#include <map>
 #include <optional>
 #include <queue>
 #include <stack>
@@ -54,12 +56,16 @@ using HangAnnotations = EventHangMetadata::HangAnnotations;
 
 static uint64_t kDefaultIntervalMs = 1'000;
 static uint64_t kDefaultTimeoutMs = 5'000;
+static uint64_t kDefaultLatencySloMs = 16;
+static uint64_t kLatencyReportIntervalMs = 10'000;
 static std::chrono::nanoseconds kTimeEpsilon(1);
 
 // HealthMonitor provides the ability to register arbitrary start/touch/stop events associated
 // with client defined tasks. At some pre-defined interval, it will periodically consume
 // all logged events to assess whether the system is hanging on any task. Via the
 // HealthMonitorConsumer, it will log hang and unhang events when it detects tasks hanging/resuming.
+// It also keeps a latency histogram per watchdog site, and reports sites whose p99 went over the
+// latency SLO in the last report interval, which tells slow tasks apart from hung ones.
 // Design doc: http://go/gfxstream-health-monitor
 template <class Clock = steady_clock>
 class HealthMonitor : public android::base::guest::Thread {
@@ -70,7 +76,10 @@ class HealthMonitor : public android::base::guest::Thread {
     // Constructor
     // `heatbeatIntervalMs` is the interval, in milleseconds, that the thread will sleep for
     // in between health checks.
-    HealthMonitor(HealthMonitorConsumer& consumer, uint64_t heartbeatInterval = kDefaultIntervalMs);
+    // `latencySloMs` is the p99 duration, in milliseconds, above which a watchdog site is
+    // reported as slow.
+    HealthMonitor(HealthMonitorConsumer& consumer, uint64_t heartbeatInterval = kDefaultIntervalMs,
+                  uint64_t latencySloMs = kDefaultLatencySloMs);
 
     // Destructor
     // Enqueues an event to end monitoring and waits on thread to process remaining queued events.
@@ -137,17 +146,38 @@ class HealthMonitor : public android::base::guest::Thread {
 
     struct MonitoredTask {
         Id id;
+        Timestamp startTimestamp;
         Timestamp timeoutTimestamp;
         Duration timeoutThreshold;
         std::optional<Timestamp> hungTimestamp;
         std::unique_ptr<EventHangMetadata> metadata;
         std::optional<std::function<std::unique_ptr<HangAnnotations>()>> onHangAnnotationsCallback;
         std::optional<Id> parentId;
+        // Set once the task stopped.
+        std::optional<Duration> latency;
     };
 
+    // Durations of the tasks started at one watchdog site. Bucket i counts tasks that took
+    // less than 2^(i + 1) microseconds, and the last bucket everything longer.
+    static constexpr size_t kLatencyBuckets = 24;
+    struct TaskLatencies {
+        std::array<uint64_t, kLatencyBuckets> buckets = {};
+        uint64_t count = 0;
+        Duration max = Duration::zero();
+        // The slowest task, for context when the site gets reported.
+        std::unique_ptr<EventHangMetadata> slowest;
+    };
+    using LatencySite = std::pair<const char*, int>;
+
     // Thread's main loop
     intptr_t main() override;
 
+    // Adds a stopped task to the latencies of its site.
+    void recordLatency(MonitoredTask& task);
+
+    // Reports the sites over the latency SLO once per report interval and clears the histograms.
+    void reportLatencies(Timestamp now);
+
     // Update the parent task
     void updateTaskParent(std::queue<std::unique_ptr<MonitoredEvent>>& events,
                           const MonitoredTask& task, Timestamp eventTime);
@@ -158,11 +188,14 @@ class HealthMonitor : public android::base::guest::Thread {
 
     // Immutable. Multi-thread access is safe.
     const Duration mInterval;
+    const Duration mLatencySlo;
 
     // Members accessed only on the worker thread. Not protected by mutex.
     int mHungTasks = 0;
     HealthMonitorConsumer& mConsumer;
     std::unordered_map<Id, MonitoredTask> mMonitoredTasks;
+    std::map<LatencySite, TaskLatencies> mTaskLatencies;
+    Timestamp mLastLatencyReport;
 
     // Lock and cv control access to queue and id counter
     ConditionVariable mCv;
@@ -276,7 +309,8 @@ class HealthWatchdogBuilder {
 };
 
 std::unique_ptr<HealthMonitor<>> CreateHealthMonitor(
-    HealthMonitorConsumer& consumer, uint64_t heartbeatInterval = kDefaultIntervalMs);
+    HealthMonitorConsumer& consumer, uint64_t heartbeatInterval = kDefaultIntervalMs,
+    uint64_t latencySloMs = kDefaultLatencySloMs);
 
 }  // namespace guest
 }  // namespace base
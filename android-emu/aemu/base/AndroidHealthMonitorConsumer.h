@@ -69,12 +69,25 @@ struct EventHangMetadata {
     }
 };
 
+// Latencies of one watchdog site over a report interval.
+struct EventLatencyReport {
+    // The slowest task of the interval.
+    const EventHangMetadata* slowest;
+    uint64_t count;
+    uint64_t p50Us;
+    uint64_t p99Us;
+    uint64_t maxUs;
+    uint64_t sloUs;
+};
+
 class HealthMonitorConsumer {
 public:
     virtual void consumeHangEvent(uint64_t taskId, const EventHangMetadata* metadata,
                                   int64_t otherHungTasks) = 0;
     virtual void consumeUnHangEvent(uint64_t taskId, const EventHangMetadata* metadata,
                                     int64_t hungMs) = 0;
+    // Called for sites whose p99 latency went over the SLO.
+    virtual void consumeLatencyEvent(const EventLatencyReport& report) {}
     virtual ~HealthMonitorConsumer() {}
 };
 
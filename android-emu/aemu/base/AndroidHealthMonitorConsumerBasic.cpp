@@ -54,6 +54,15 @@ void HealthMonitorConsumerBasic::consumeUnHangEvent(uint64_t taskId,
     logEventHangMetadata(metadata);
 }
 
+void HealthMonitorConsumerBasic::consumeLatencyEvent(const EventLatencyReport& report) {
+    ALOGE("Logging latency event. p99 %llu us over SLO of %llu us (calls: %llu, p50: %llu us, "
+          "max: %llu us). Slowest call:",
+          (unsigned long long)report.p99Us, (unsigned long long)report.sloUs,
+          (unsigned long long)report.count, (unsigned long long)report.p50Us,
+          (unsigned long long)report.maxUs);
+    logEventHangMetadata(report.slowest);
+}
+
 }  // namespace guest
 }  // namespace base
 }  // namespace android
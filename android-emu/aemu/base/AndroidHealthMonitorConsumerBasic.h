@@ -25,6 +25,7 @@ public:
                           int64_t otherHungTasks) override;
     void consumeUnHangEvent(uint64_t taskId, const EventHangMetadata* metadata,
                             int64_t hungMs) override;
+    void consumeLatencyEvent(const EventLatencyReport& report) override;
 
 };
 }  // namespace guest
@@ -16,9 +16,13 @@
 #include "aemu/base/address_space.h"
 #include "aemu/base/files/Stream.h"
 
+#include <algorithm>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <log/log.h>
 
@@ -26,12 +30,346 @@ namespace android {
 namespace base {
 namespace guest {
 
+namespace {
+
+// A two level segregated fit heap over [0, totalPages) pages. Block records
+// live outside the managed memory, since that is shared with the host. Free
+// blocks are kept in lists binned first by the power of two and then by one
+// of kSlCount linear steps below the next power of two, with bitmaps of
+// which lists are non empty, so finding a fit is two bit scans.
+class TlsfHeap {
+public:
+    static constexpr uint64_t kBadOffset = ~uint64_t(0);
+
+    explicit TlsfHeap(uint64_t totalPages) : mTotalPages(totalPages) { reset(); }
+
+    void reset() {
+        mBlocks.clear();
+        mUnusedBlocks.clear();
+        mUsedBlocks.clear();
+        mFlBitmap = 0;
+        for (uint32_t fl = 0; fl < kFlCount; ++fl) {
+            mSlBitmaps[fl] = 0;
+            for (uint32_t sl = 0; sl < kSlCount; ++sl) {
+                mFreeLists[fl][sl] = kNone;
+            }
+        }
+        mUsedPages = 0;
+        mFreeBlockCount = 0;
+        mHead = kNone;
+        if (mTotalPages) {
+            mHead = newBlock(0, mTotalPages);
+            insertFree(mHead);
+        }
+    }
+
+    // Returns the page offset of a block of |pages| pages, or kBadOffset.
+    uint64_t allocate(uint64_t pages) {
+        if (!pages || pages > mTotalPages) return kBadOffset;
+
+        uint32_t index = findFitInList(pages);
+        if (index == kNone) {
+            uint32_t fl, sl;
+            mapping(roundUpToList(pages), &fl, &sl);
+            index = findFree(fl, sl);
+        }
+        if (index == kNone) return kBadOffset;
+
+        removeFree(index);
+        split(index, pages);
+        mBlocks[index].free = false;
+        mUsedBlocks[mBlocks[index].offset] = index;
+        mUsedPages += mBlocks[index].size;
+        return mBlocks[index].offset;
+    }
+
+    // Marks the block at |offset| pages, which has to be in use, as free.
+    bool deallocate(uint64_t offset) {
+        auto it = mUsedBlocks.find(offset);
+        if (it == mUsedBlocks.end()) return false;
+
+        uint32_t index = it->second;
+        mUsedBlocks.erase(it);
+        mUsedPages -= mBlocks[index].size;
+        mBlocks[index].free = true;
+        index = mergeNeighbors(index);
+        insertFree(index);
+        return true;
+    }
+
+    // Marks [offset, offset + pages) as in use, which has to lie in one
+    // free block. Restores allocations from a snapshot.
+    bool allocateAt(uint64_t offset, uint64_t pages) {
+        for (uint32_t index = mHead; index != kNone; index = mBlocks[index].nextPhys) {
+            Block& block = mBlocks[index];
+            if (offset >= block.offset + block.size) continue;
+            if (!block.free || offset + pages > block.offset + block.size) return false;
+
+            removeFree(index);
+            if (offset > block.offset) {
+                // Leave the pages below as a free block of their own.
+                split(index, offset - mBlocks[index].offset);
+                insertFree(index);
+                index = mBlocks[index].nextPhys;
+                removeFree(index);
+            }
+            split(index, pages);
+            mBlocks[index].free = false;
+            mUsedBlocks[offset] = index;
+            mUsedPages += pages;
+            return true;
+        }
+        return false;
+    }
+
+    template <typename F>
+    void forEachUsed(F&& func) const {
+        for (uint32_t index = mHead; index != kNone; index = mBlocks[index].nextPhys) {
+            if (!mBlocks[index].free) func(mBlocks[index].offset, mBlocks[index].size);
+        }
+    }
+
+    uint64_t usedPages() const { return mUsedPages; }
+    uint32_t usedBlockCount() const { return (uint32_t)mUsedBlocks.size(); }
+    uint32_t freeBlockCount() const { return mFreeBlockCount; }
+
+    uint64_t largestFreePages() const {
+        if (!mFlBitmap) return 0;
+        const uint32_t fl = 63 - __builtin_clzll(mFlBitmap);
+        const uint32_t sl = 31 - __builtin_clz(mSlBitmaps[fl]);
+        // Sizes in one list differ by less than a step, so look at all.
+        uint64_t largest = 0;
+        for (uint32_t index = mFreeLists[fl][sl]; index != kNone;
+             index = mBlocks[index].nextFree) {
+            largest = std::max(largest, mBlocks[index].size);
+        }
+        return largest;
+    }
+
+    // Slides every used block down over the free space before it. |relocate|
+    // gets page offsets and sizes. Returns the pages moved.
+    template <typename F>
+    uint64_t compact(F&& relocate) {
+        uint64_t movedPages = 0;
+        uint32_t index = mHead;
+        while (index != kNone) {
+            const uint32_t gap = index;
+            const uint32_t used = mBlocks[gap].nextPhys;
+            if (!mBlocks[gap].free || used == kNone) {
+                index = mBlocks[index].nextPhys;
+                continue;
+            }
+            // Free blocks are always merged, so |used| is in use.
+            Block& gapBlock = mBlocks[gap];
+            Block& usedBlock = mBlocks[used];
+            if (!relocate(usedBlock.offset, gapBlock.offset, usedBlock.size)) {
+                break;
+            }
+            movedPages += usedBlock.size;
+
+            // Swap the two blocks in physical order.
+            removeFree(gap);
+            mUsedBlocks.erase(usedBlock.offset);
+            usedBlock.offset = gapBlock.offset;
+            gapBlock.offset = usedBlock.offset + usedBlock.size;
+            mUsedBlocks[usedBlock.offset] = used;
+
+            const uint32_t before = gapBlock.prevPhys;
+            const uint32_t after = usedBlock.nextPhys;
+            usedBlock.prevPhys = before;
+            usedBlock.nextPhys = gap;
+            gapBlock.prevPhys = used;
+            gapBlock.nextPhys = after;
+            if (before != kNone) {
+                mBlocks[before].nextPhys = used;
+            } else {
+                mHead = used;
+            }
+            if (after != kNone) mBlocks[after].prevPhys = gap;
+
+            index = mergeNeighbors(gap);
+            insertFree(index);
+        }
+        return movedPages;
+    }
+
+private:
+    static constexpr uint32_t kNone = ~uint32_t(0);
+    static constexpr uint32_t kSlLog2 = 4;
+    static constexpr uint32_t kSlCount = 1 << kSlLog2;
+    static constexpr uint32_t kFlCount = 64 - kSlLog2 + 1;
+
+    struct Block {
+        uint64_t offset;
+        uint64_t size;
+        uint32_t prevPhys = kNone;
+        uint32_t nextPhys = kNone;
+        uint32_t prevFree = kNone;
+        uint32_t nextFree = kNone;
+        bool free = true;
+    };
+
+    static uint32_t fls(uint64_t x) { return 63 - __builtin_clzll(x); }
+
+    // Sizes below kSlCount get a list each; above, each power of two range
+    // is split into kSlCount lists.
+    static void mapping(uint64_t size, uint32_t* fl, uint32_t* sl) {
+        if (size < kSlCount) {
+            *fl = 0;
+            *sl = (uint32_t)size;
+            return;
+        }
+        const uint32_t top = fls(size);
+        *sl = (uint32_t)(size >> (top - kSlLog2)) ^ kSlCount;
+        *fl = top - kSlLog2 + 1;
+    }
+
+    // Rounds |size| up to the smallest size of the next list, so that every
+    // block of the list mapping() gives for it is large enough.
+    static uint64_t roundUpToList(uint64_t size) {
+        if (size < kSlCount) return size;
+        const uint64_t step = (uint64_t(1) << (fls(size) - kSlLog2)) - 1;
+        return size + step;
+    }
+
+    // The list |pages| maps to holds blocks both smaller and larger than
+    // it, which the search from the next list up never looks at; without
+    // this an exactly fitting block, such as the whole heap, is missed.
+    uint32_t findFitInList(uint64_t pages) const {
+        uint32_t fl, sl;
+        mapping(pages, &fl, &sl);
+        for (uint32_t index = mFreeLists[fl][sl]; index != kNone;
+             index = mBlocks[index].nextFree) {
+            if (mBlocks[index].size >= pages) return index;
+        }
+        return kNone;
+    }
+
+    uint32_t findFree(uint32_t fl, uint32_t sl) const {
+        if (fl >= kFlCount) return kNone;
+        uint32_t slMap = mSlBitmaps[fl] & (~0u << sl);
+        if (!slMap) {
+            const uint64_t flMap = fl + 1 < kFlCount ? mFlBitmap & (~uint64_t(0) << (fl + 1)) : 0;
+            if (!flMap) return kNone;
+            fl = __builtin_ctzll(flMap);
+            slMap = mSlBitmaps[fl];
+        }
+        return mFreeLists[fl][__builtin_ctz(slMap)];
+    }
+
+    uint32_t newBlock(uint64_t offset, uint64_t size) {
+        uint32_t index;
+        if (!mUnusedBlocks.empty()) {
+            index = mUnusedBlocks.back();
+            mUnusedBlocks.pop_back();
+            mBlocks[index] = Block();
+        } else {
+            index = (uint32_t)mBlocks.size();
+            mBlocks.emplace_back();
+        }
+        mBlocks[index].offset = offset;
+        mBlocks[index].size = size;
+        return index;
+    }
+
+    void insertFree(uint32_t index) {
+        Block& block = mBlocks[index];
+        uint32_t fl, sl;
+        mapping(block.size, &fl, &sl);
+        block.free = true;
+        block.prevFree = kNone;
+        block.nextFree = mFreeLists[fl][sl];
+        if (block.nextFree != kNone) mBlocks[block.nextFree].prevFree = index;
+        mFreeLists[fl][sl] = index;
+        mFlBitmap |= uint64_t(1) << fl;
+        mSlBitmaps[fl] |= 1u << sl;
+        ++mFreeBlockCount;
+    }
+
+    void removeFree(uint32_t index) {
+        Block& block = mBlocks[index];
+        uint32_t fl, sl;
+        mapping(block.size, &fl, &sl);
+        if (block.prevFree != kNone) {
+            mBlocks[block.prevFree].nextFree = block.nextFree;
+        } else {
+            mFreeLists[fl][sl] = block.nextFree;
+            if (block.nextFree == kNone) {
+                mSlBitmaps[fl] &= ~(1u << sl);
+                if (!mSlBitmaps[fl]) mFlBitmap &= ~(uint64_t(1) << fl);
+            }
+        }
+        if (block.nextFree != kNone) mBlocks[block.nextFree].prevFree = block.prevFree;
+        block.prevFree = block.nextFree = kNone;
+        --mFreeBlockCount;
+    }
+
+    // Cuts |index|, which is in no free list, down to |pages| and frees the
+    // remainder.
+    void split(uint32_t index, uint64_t pages) {
+        if (mBlocks[index].size == pages) return;
+        const uint32_t rest =
+            newBlock(mBlocks[index].offset + pages, mBlocks[index].size - pages);
+        Block& block = mBlocks[index];
+        Block& restBlock = mBlocks[rest];
+        block.size = pages;
+        restBlock.prevPhys = index;
+        restBlock.nextPhys = block.nextPhys;
+        if (block.nextPhys != kNone) mBlocks[block.nextPhys].prevPhys = rest;
+        block.nextPhys = rest;
+        insertFree(rest);
+    }
+
+    // Absorbs |next| into |index| and recycles its record.
+    void absorbNext(uint32_t index, uint32_t next) {
+        Block& block = mBlocks[index];
+        const Block& nextBlock = mBlocks[next];
+        block.size += nextBlock.size;
+        block.nextPhys = nextBlock.nextPhys;
+        if (block.nextPhys != kNone) mBlocks[block.nextPhys].prevPhys = index;
+        mUnusedBlocks.push_back(next);
+    }
+
+    // Merges free block |index|, which is in no free list, with free
+    // neighbors. Returns the merged block.
+    uint32_t mergeNeighbors(uint32_t index) {
+        const uint32_t next = mBlocks[index].nextPhys;
+        if (next != kNone && mBlocks[next].free) {
+            removeFree(next);
+            absorbNext(index, next);
+        }
+        const uint32_t prev = mBlocks[index].prevPhys;
+        if (prev != kNone && mBlocks[prev].free) {
+            removeFree(prev);
+            absorbNext(prev, index);
+            index = prev;
+        }
+        return index;
+    }
+
+    const uint64_t mTotalPages;
+    std::vector<Block> mBlocks;
+    std::vector<uint32_t> mUnusedBlocks;
+    // Used blocks by offset, for free().
+    std::unordered_map<uint64_t, uint32_t> mUsedBlocks;
+    uint64_t mFlBitmap = 0;
+    uint32_t mSlBitmaps[kFlCount];
+    uint32_t mFreeLists[kFlCount][kSlCount];
+    uint64_t mUsedPages = 0;
+    uint32_t mFreeBlockCount = 0;
+    // The block at offset 0.
+    uint32_t mHead = kNone;
+};
+
+}  // namespace
+
 class SubAllocator::Impl {
 public:
     Impl(
         void* _buffer,
         uint64_t _totalSize,
-        uint64_t _pageSize) :
+        uint64_t _pageSize,
+        Strategy _strategy) :
         buffer(_buffer),
         totalSize(_totalSize),
         pageSize(_pageSize),
@@ -42,6 +380,9 @@ public:
             &addr_alloc,
             totalSize,
             32);
+        if (_strategy == Strategy::Tlsf) {
+            tlsf.reset(new TlsfHeap(totalSize / pageSize));
+        }
     }
 
     ~Impl() {
@@ -49,6 +390,10 @@ public:
     }
 
     void clear() {
+        if (tlsf) {
+            tlsf->reset();
+            return;
+        }
         address_space_allocator_destroy_nocleanup(&addr_alloc);
         address_space_allocator_init(
             &addr_alloc,
@@ -57,6 +402,18 @@ public:
     }
 
     bool save(Stream* stream) {
+        if (tlsf) {
+            // Live allocations, which load() carves out again.
+            stream->putBe64(pageSize);
+            stream->putBe64(totalSize);
+            stream->putBe32(allocCount);
+            tlsf->forEachUsed([stream](uint64_t offset, uint64_t pages) {
+                stream->putBe64(offset);
+                stream->putBe64(pages);
+            });
+            return true;
+        }
+
         address_space_allocator_iter_func_t allocatorSaver =
             [](void* context, struct address_space_allocator* allocator) {
                 Stream* stream = reinterpret_cast<Stream*>(context);
@@ -85,6 +442,22 @@ public:
 
     bool load(Stream* stream) {
         clear();
+        if (tlsf) {
+            pageSize = stream->getBe64();
+            totalSize = stream->getBe64();
+            allocCount = stream->getBe32();
+            for (uint32_t i = 0; i < allocCount; ++i) {
+                const uint64_t offset = stream->getBe64();
+                const uint64_t pages = stream->getBe64();
+                if (!tlsf->allocateAt(offset, pages)) {
+                    ALOGE("%s: allocation at page %" PRIu64 " does not fit\n", __func__,
+                          offset);
+                    return false;
+                }
+            }
+            return true;
+        }
+
         address_space_allocator_iter_func_t allocatorLoader =
             [](void* context, struct address_space_allocator* allocator) {
                 Stream* stream = reinterpret_cast<Stream*>(context);
@@ -142,6 +515,14 @@ public:
         if (!ptr) return false;
 
         rangeCheck("free", ptr);
+        if (tlsf) {
+            const uint64_t offset = getOffset(ptr);
+            if (offset % pageSize || !tlsf->deallocate(offset / pageSize)) {
+                return false;
+            }
+            --allocCount;
+            return true;
+        }
         if (EINVAL == address_space_allocator_deallocate(
             &addr_alloc, getOffset(ptr))) {
             return false;
@@ -152,7 +533,11 @@ public:
     }
 
     void freeAll() {
-        address_space_allocator_reset(&addr_alloc);
+        if (tlsf) {
+            tlsf->reset();
+        } else {
+            address_space_allocator_reset(&addr_alloc);
+        }
         allocCount = 0;
     }
 
@@ -166,12 +551,21 @@ public:
             pageSize *
             ((wantedSize + pageSize - 1) / pageSize);
 
-        uint64_t offset =
-            address_space_allocator_allocate(
-                &addr_alloc, toPageSize);
-
-        if (offset == ANDROID_EMU_ADDRESS_SPACE_BAD_OFFSET) {
-            return nullptr;
+        uint64_t offset;
+        if (tlsf) {
+            offset = tlsf->allocate(toPageSize / pageSize);
+            if (offset == TlsfHeap::kBadOffset) {
+                return nullptr;
+            }
+            offset *= pageSize;
+        } else {
+            offset =
+                address_space_allocator_allocate(
+                    &addr_alloc, toPageSize);
+
+            if (offset == ANDROID_EMU_ADDRESS_SPACE_BAD_OFFSET) {
+                return nullptr;
+            }
         }
 
         ++allocCount;
@@ -182,21 +576,58 @@ public:
         return allocCount == 0;
     }
 
+    Stats getStats() const {
+        Stats stats;
+        stats.totalBytes = totalSize;
+        stats.allocCount = allocCount;
+        if (tlsf) {
+            stats.usedBytes = tlsf->usedPages() * pageSize;
+            stats.freeBytes = (totalSize / pageSize) * pageSize - stats.usedBytes;
+            stats.largestFreeBlock = tlsf->largestFreePages() * pageSize;
+            stats.freeBlockCount = tlsf->freeBlockCount();
+            return stats;
+        }
+        for (int i = 0; i < addr_alloc.size; ++i) {
+            const struct address_block& block = addr_alloc.blocks[i];
+            if (block.available) {
+                stats.freeBytes += block.size;
+                stats.largestFreeBlock = std::max<uint64_t>(stats.largestFreeBlock, block.size);
+                ++stats.freeBlockCount;
+            } else {
+                stats.usedBytes += block.size;
+            }
+        }
+        return stats;
+    }
+
+    uint64_t defragment(const RelocateFunc& relocate) {
+        if (!tlsf) return 0;
+        const uint64_t movedPages =
+            tlsf->compact([this, &relocate](uint64_t src, uint64_t dst, uint64_t pages) {
+                return relocate(src * pageSize, dst * pageSize, pages * pageSize);
+            });
+        return movedPages * pageSize;
+    }
+
     void* buffer;
     uint64_t totalSize;
     uint64_t pageSize;
     uint64_t startAddr;
     uint64_t endAddr;
     struct address_space_allocator addr_alloc;
+    // Set for Strategy::Tlsf, which then manages the buffer instead of
+    // |addr_alloc|.
+    std::unique_ptr<TlsfHeap> tlsf;
     uint32_t allocCount = 0;
 };
 
 SubAllocator::SubAllocator(
     void* buffer,
     uint64_t totalSize,
-    uint64_t pageSize) :
+    uint64_t pageSize,
+    Strategy strategy) :
     mImpl(
-        new SubAllocator::Impl(buffer, totalSize, pageSize)) { }
+        new SubAllocator::Impl(buffer, totalSize, pageSize, strategy)) { }
 
 SubAllocator::~SubAllocator() {
     delete mImpl;
@@ -235,6 +666,14 @@ bool SubAllocator::empty() const {
     return mImpl->empty();
 }
 
+SubAllocator::Stats SubAllocator::getStats() const {
+    return mImpl->getStats();
+}
+
+uint64_t SubAllocator::defragment(const RelocateFunc& relocate) {
+    return mImpl->defragment(relocate);
+}
+
 } // namespace guest
 } // namespace base
 } // namespace android
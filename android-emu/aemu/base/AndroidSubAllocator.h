@@ -17,6 +17,8 @@
 #include <stddef.h>
 #include <string.h>
 
+#include <functional>
+
 namespace android {
 namespace base {
 
@@ -35,12 +37,44 @@ namespace guest {
 // same-size heaps in Pool with a preallocated buffer.
 class SubAllocator {
 public:
+    enum class Strategy {
+        // Best fit over a sorted array of blocks. Alloc and free are linear
+        // in the number of blocks.
+        FirstFit,
+        // Two level segregated fit: free blocks are binned by size, so alloc
+        // and free take constant time and a fit is never much larger than
+        // what was asked for.
+        Tlsf,
+    };
+
+    struct Stats {
+        uint64_t totalBytes = 0;
+        uint64_t usedBytes = 0;
+        uint64_t freeBytes = 0;
+        uint64_t largestFreeBlock = 0;
+        uint32_t freeBlockCount = 0;
+        uint32_t allocCount = 0;
+
+        // 0 when all free space is one block, approaching 1 as it is split
+        // into ever smaller pieces.
+        double fragmentation() const {
+            return freeBytes ? 1.0 - double(largestFreeBlock) / double(freeBytes) : 0.0;
+        }
+    };
+
+    // Moves |size| bytes of a live allocation from |srcOffset| to
+    // |dstOffset|, which may overlap, and points whatever referred to it at
+    // the new offset. Returns false if the allocation can not be moved.
+    using RelocateFunc =
+        std::function<bool(uint64_t srcOffset, uint64_t dstOffset, uint64_t size)>;
+
     // |pageSize| determines both the alignment of pointers returned
     // and the multiples of space occupied.
     SubAllocator(
         void* buffer,
         uint64_t totalSize,
-        uint64_t pageSize);
+        uint64_t pageSize,
+        Strategy strategy = Strategy::FirstFit);
 
     // Memory is freed from the perspective of the user of
     // SubAllocator, but the prealloced buffer is not freed.
@@ -60,6 +94,15 @@ public:
 
     bool empty() const;
 
+    Stats getStats() const;
+
+    // Compacts live allocations towards the start of the buffer, calling
+    // |relocate| for each one that moves, so that the free space ends up in
+    // one block. Stops at the first allocation that can not be moved.
+    // Returns the number of bytes moved. Only Strategy::Tlsf supports this;
+    // other strategies move nothing.
+    uint64_t defragment(const RelocateFunc& relocate);
+
     // Convenience function to allocate an array
     // of objects of type T.
     template <class T>
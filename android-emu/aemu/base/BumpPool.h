@@ -16,8 +16,9 @@
 #include "aemu/base/AlignedBuf.h"
 #include "aemu/base/Allocator.h"
 
+#include <algorithm>
+#include <memory>
 #include <vector>
-#include <unordered_set>
 
 #include <inttypes.h>
 
@@ -42,13 +43,12 @@ public:
             sizeof(uint64_t) * ((wantedSize + sizeof(uint64_t) - 1) / (sizeof(uint64_t)));
 
         mTotalWantedThisGeneration += wantedSizeRoundedUp;
+        mPeakWantedThisGeneration =
+            std::max(mPeakWantedThisGeneration, mTotalWantedThisGeneration);
         if (mAllocPos + wantedSizeRoundedUp > mStorage.size() * sizeof(uint64_t)) {
             mNeedRealloc = true;
-            void* fallbackPtr = malloc(wantedSizeRoundedUp);
-            mFallbackPtrs.insert(fallbackPtr);
-            return fallbackPtr;
+            return allocOverflow(wantedSizeRoundedUp);
         }
-        size_t avail = mStorage.size() * sizeof(uint64_t) - mAllocPos;
         void* allocPtr = (void*)(((unsigned char*)mStorage.data()) + mAllocPos);
         mAllocPos += wantedSizeRoundedUp;
         return allocPtr;
@@ -57,20 +57,113 @@ public:
     void freeAll() {
         mAllocPos = 0;
         if (mNeedRealloc) {
-            mStorage.resize((mTotalWantedThisGeneration * 2) / sizeof(uint64_t));
+            mStorage.resize((mPeakWantedThisGeneration * 2) / sizeof(uint64_t));
             mNeedRealloc = false;
-            for (auto ptr : mFallbackPtrs) {
-                free(ptr);
-            }
-            mFallbackPtrs.clear();
+            mOverflowChunks.clear();
+            mOverflowBytes = 0;
         }
+        mOverflowInUse = 0;
+        mOverflowPos = 0;
         mTotalWantedThisGeneration = 0;
+        mPeakWantedThisGeneration = 0;
+    }
+
+    // Like freeAll(), but keeps the overflow chunks warm for the next
+    // generation instead of growing the storage to fit. A later freeAll()
+    // still grows it.
+    void reset() { rewind(Checkpoint()); }
+
+    // Frees overflow chunks that are kept warm but not in use.
+    void trim() {
+        for (size_t i = mOverflowInUse; i < mOverflowChunks.size(); ++i) {
+            mOverflowBytes -= mOverflowChunks[i].bytes;
+        }
+        mOverflowChunks.resize(mOverflowInUse);
+    }
+
+    // Everything allocated after mark() is released by rewind() with its
+    // result, while earlier allocations stay valid. Marks nest: rewinding to
+    // one invalidates the marks taken after it.
+    struct Checkpoint {
+        size_t allocPos = 0;
+        size_t overflowInUse = 0;
+        size_t overflowPos = 0;
+        size_t totalWanted = 0;
+    };
+
+    Checkpoint mark() const {
+        return {mAllocPos, mOverflowInUse, mOverflowPos, mTotalWantedThisGeneration};
+    }
+
+    void rewind(const Checkpoint& checkpoint) {
+        mAllocPos = checkpoint.allocPos;
+        mOverflowInUse = checkpoint.overflowInUse;
+        mOverflowPos = checkpoint.overflowPos;
+        mTotalWantedThisGeneration = checkpoint.totalWanted;
     }
+
+    // Rewinds the pool to where it was when the scope was entered, for
+    // scratch memory of a nested operation.
+    class Scope {
+    public:
+        explicit Scope(BumpPool* pool) : mPool(pool), mCheckpoint(pool->mark()) { }
+        ~Scope() { mPool->rewind(mCheckpoint); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        BumpPool* mPool;
+        Checkpoint mCheckpoint;
+    };
+
+    // Memory held by the pool, used or not.
+    size_t bytesHeld() const { return mStorage.size() * sizeof(uint64_t) + mOverflowBytes; }
+
 private:
+    static constexpr size_t kMinOverflowChunkBytes = 4096;
+
+    // Allocations past the end of mStorage until the next freeAll() come from
+    // chunks that double in size, so a generation that outgrows the storage
+    // costs a few mallocs rather than one per allocation. Chunks past
+    // mOverflowInUse are left over from before a rewind and get reused.
+    void* allocOverflow(size_t bytes) {
+        if (mOverflowInUse == 0 ||
+            mOverflowPos + bytes > mOverflowChunks[mOverflowInUse - 1].bytes) {
+            if (mOverflowInUse == mOverflowChunks.size()) {
+                mOverflowChunks.emplace_back();
+            }
+            OverflowChunk& chunk = mOverflowChunks[mOverflowInUse];
+            if (chunk.bytes < bytes) {
+                size_t chunkBytes =
+                    std::max(std::max(bytes, kMinOverflowChunkBytes), mOverflowBytes);
+                mOverflowBytes += chunkBytes - chunk.bytes;
+                chunk.data.reset(new uint64_t[chunkBytes / sizeof(uint64_t)]);
+                chunk.bytes = chunkBytes;
+            }
+            ++mOverflowInUse;
+            mOverflowPos = 0;
+        }
+        void* allocPtr =
+            (void*)(((unsigned char*)mOverflowChunks[mOverflowInUse - 1].data.get()) +
+                    mOverflowPos);
+        mOverflowPos += bytes;
+        return allocPtr;
+    }
+
+    struct OverflowChunk {
+        std::unique_ptr<uint64_t[]> data;
+        size_t bytes = 0;
+    };
+
     AlignedBuf<uint64_t, 8> mStorage;
-    std::unordered_set<void*> mFallbackPtrs;
+    std::vector<OverflowChunk> mOverflowChunks;
+    size_t mOverflowInUse = 0;
+    size_t mOverflowBytes = 0;
+    size_t mOverflowPos = 0;
     size_t mAllocPos = 0;
     size_t mTotalWantedThisGeneration = 0;
+    size_t mPeakWantedThisGeneration = 0;
     bool mNeedRealloc = false;
 };
 
@@ -0,0 +1,207 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "aemu/base/FlightRecorder.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#if defined(__ANDROID__)
+#include <cutils/properties.h>
+#include <log/log.h>
+#endif
+
+#ifndef ALOGW
+#define ALOGW(fmt, ...) fprintf(stderr, fmt "\n", ##__VA_ARGS__)
+#endif
+
+namespace android {
+namespace base {
+
+namespace {
+
+// A power of two, so that wrapping around is a mask.
+constexpr uint32_t kRingSize = 4096;
+
+// Logcat only gets the most recent events; files get the whole ring.
+constexpr uint32_t kLogcatEvents = 256;
+
+constexpr uint64_t kMinDumpIntervalNs = 10ULL * 1000 * 1000 * 1000;
+
+struct Entry {
+    uint64_t timeNs;
+    const char* name;
+    uint32_t bytes;
+    // Saturates at about 71 minutes.
+    uint32_t durationUs;
+    FlightEvent event;
+};
+
+struct Ring {
+    Entry entries[kRingSize];
+    uint64_t count = 0;
+    // When the first event after the last frame end was recorded, or 0.
+    uint64_t frameStartNs = 0;
+};
+
+struct Config {
+    bool enabled = true;
+    uint64_t jankNs = 50ULL * 1000 * 1000;
+    std::string path;
+};
+
+const Config& getConfig() {
+    static const Config sConfig = [] {
+        Config config;
+#if defined(__ANDROID__)
+        char value[PROPERTY_VALUE_MAX] = "";
+        property_get("debug.gfxstream.flight_recorder", value, "");
+        config.enabled = value[0] != '0';
+        if (property_get("debug.gfxstream.flight_recorder.jank_ms", value, "") > 0) {
+            config.jankNs = strtoull(value, nullptr, 10) * 1000 * 1000;
+        }
+        if (property_get("debug.gfxstream.flight_recorder.path", value, "") > 0) {
+            config.path = value;
+        }
+#endif
+        return config;
+    }();
+    return sConfig;
+}
+
+uint64_t nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000ULL + uint64_t(ts.tv_nsec);
+}
+
+Ring* getRing() {
+    static thread_local std::unique_ptr<Ring> tRing;
+    if (!tRing) {
+        tRing.reset(new Ring);
+    }
+    return tRing.get();
+}
+
+const char* eventName(FlightEvent event) {
+    switch (event) {
+        case FlightEvent::Call:
+            return "call";
+        case FlightEvent::Flush:
+            return "flush";
+        case FlightEvent::Write:
+            return "write";
+        case FlightEvent::Readback:
+            return "readback";
+        case FlightEvent::FrameEnd:
+            return "frame";
+    }
+    return "?";
+}
+
+void record(Ring* ring, FlightEvent event, const char* name, uint32_t bytes, uint64_t timeNs,
+            uint64_t durationNs) {
+    Entry& entry = ring->entries[ring->count & (kRingSize - 1)];
+    entry.timeNs = timeNs;
+    entry.name = name;
+    entry.bytes = bytes;
+    entry.durationUs =
+        durationNs / 1000 > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(durationNs / 1000);
+    entry.event = event;
+    ++ring->count;
+}
+
+void dumpRing(const Ring& ring, const char* reason) {
+    const Config& config = getConfig();
+    const uint64_t now = nowNs();
+    FILE* file = config.path.empty() ? nullptr : fopen(config.path.c_str(), "a");
+    const uint64_t available = ring.count < kRingSize ? ring.count : kRingSize;
+    const uint64_t events = file || available < kLogcatEvents ? available : kLogcatEvents;
+
+    if (file) {
+        fprintf(file, "gfxstream flight recorder: %s, last %" PRIu64 " events\n", reason, events);
+    } else {
+        ALOGW("gfxstream flight recorder: %s, last %" PRIu64 " events", reason, events);
+    }
+    // Times are relative to the dump. Frame ends carry the frame number and
+    // how long the frame took.
+    for (uint64_t i = ring.count - events; i < ring.count; ++i) {
+        const Entry& entry = ring.entries[i & (kRingSize - 1)];
+        const int64_t ageUs = static_cast<int64_t>((now - entry.timeNs) / 1000);
+        const char* name = entry.name ? entry.name : "";
+        char line[256];
+        if (entry.event == FlightEvent::FrameEnd) {
+            snprintf(line, sizeof(line), "  -%" PRId64 "us frame %u took:%uus", ageUs,
+                     entry.bytes, entry.durationUs);
+        } else {
+            snprintf(line, sizeof(line), "  -%" PRId64 "us %s %s bytes:%u waited:%uus", ageUs,
+                     eventName(entry.event), name, entry.bytes, entry.durationUs);
+        }
+        if (file) {
+            fprintf(file, "%s\n", line);
+        } else {
+            ALOGW("%s", line);
+        }
+    }
+    if (file) {
+        fclose(file);
+    }
+}
+
+}  // namespace
+
+void flightRecord(FlightEvent event, const char* name, uint32_t bytes, uint64_t durationNs) {
+    if (!getConfig().enabled) return;
+    Ring* ring = getRing();
+    const uint64_t now = nowNs();
+    if (!ring->frameStartNs) {
+        ring->frameStartNs = now;
+    }
+    record(ring, event, name, bytes, now, durationNs);
+}
+
+void flightRecordFrameEnd(uint32_t frameNumber) {
+    const Config& config = getConfig();
+    if (!config.enabled) return;
+    Ring* ring = getRing();
+    const uint64_t now = nowNs();
+    const uint64_t frameNs = ring->frameStartNs ? now - ring->frameStartNs : 0;
+    record(ring, FlightEvent::FrameEnd, nullptr, frameNumber, now, frameNs);
+    ring->frameStartNs = 0;
+
+    if (frameNs <= config.jankNs) return;
+
+    // Janky frames tend to come in bursts; one dump per burst is enough.
+    static std::atomic<uint64_t> sLastDumpNs{0};
+    uint64_t lastDumpNs = sLastDumpNs.load(std::memory_order_relaxed);
+    if (lastDumpNs && now - lastDumpNs < kMinDumpIntervalNs) return;
+    if (!sLastDumpNs.compare_exchange_strong(lastDumpNs, now, std::memory_order_relaxed)) return;
+
+    const std::string reason = "frame " + std::to_string(frameNumber) + " took " +
+                               std::to_string(frameNs / 1000000) + "ms";
+    dumpRing(*ring, reason.c_str());
+}
+
+void flightRecorderDump(const char* reason) {
+    if (!getConfig().enabled) return;
+    dumpRing(*getRing(), reason);
+}
+
+}  // namespace base
+}  // namespace android
@@ -0,0 +1,58 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <stdint.h>
+
+// A flight recorder for the encoders: each thread keeps its last few
+// thousand encoder calls and stream events, always, so that a frame that
+// took too long can be looked at after the fact, without tracing having
+// been on when it happened. Recording an event costs a clock read and a
+// store into a thread local ring.
+//
+// debug.gfxstream.flight_recorder=0 turns it off. Frames that take longer
+// than debug.gfxstream.flight_recorder.jank_ms, 50 by default, from their
+// first event to their end get the ring of their thread dumped, at most
+// once every 10 seconds. Dumps are appended to the file named by
+// debug.gfxstream.flight_recorder.path, or go to logcat without it.
+
+namespace android {
+namespace base {
+
+enum class FlightEvent : uint8_t {
+    // An encoder entry point was called.
+    Call,
+    // |bytes| went from the stream buffer to the transport.
+    Flush,
+    // |bytes| went to the transport straight from the caller's memory.
+    Write,
+    // Waited |durationNs| for |bytes| from the host.
+    Readback,
+    // The thread handed a frame off.
+    FrameEnd,
+};
+
+// Appends an event to the ring of the calling thread. |name| is kept as is,
+// so it has to be a literal or __func__.
+void flightRecord(FlightEvent event, const char* name, uint32_t bytes, uint64_t durationNs = 0);
+
+// Ends the frame of the calling thread, dumping its ring if the frame took
+// too long.
+void flightRecordFrameEnd(uint32_t frameNumber);
+
+// Dumps the ring of the calling thread.
+void flightRecorderDump(const char* reason);
+
+}  // namespace base
+}  // namespace android
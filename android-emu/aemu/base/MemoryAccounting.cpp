@@ -0,0 +1,124 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "aemu/base/MemoryAccounting.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <mutex>
+
+#if defined(__ANDROID__)
+#include <cutils/properties.h>
+#include <cutils/trace.h>
+#include <log/log.h>
+#endif
+
+namespace android {
+namespace base {
+namespace guest {
+namespace {
+
+constexpr size_t kKinds = size_t(GraphicsMemory::kCount);
+
+const char* const kNames[kKinds] = {
+    "stream_buffers",
+    "staging_streams",
+    "coherent_memory",
+    "buffer_shadows",
+    "vulkan_stream_pools",
+    "gralloc_mappings",
+};
+
+// Trace counter names, the names above with a common prefix.
+const char* const kCounterNames[kKinds] = {
+    "gfxstreamMem.stream_buffers",
+    "gfxstreamMem.staging_streams",
+    "gfxstreamMem.coherent_memory",
+    "gfxstreamMem.buffer_shadows",
+    "gfxstreamMem.vulkan_stream_pools",
+    "gfxstreamMem.gralloc_mappings",
+};
+
+std::atomic<int64_t> sBytes[kKinds];
+std::atomic<int64_t> sPeakBytes[kKinds];
+
+}  // namespace
+
+void graphicsMemoryAdd(GraphicsMemory kind, int64_t bytes) {
+    const size_t i = size_t(kind);
+    const int64_t now = sBytes[i].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    int64_t peak = sPeakBytes[i].load(std::memory_order_relaxed);
+    while (now > peak &&
+           !sPeakBytes[i].compare_exchange_weak(peak, now, std::memory_order_relaxed)) {
+    }
+}
+
+int64_t graphicsMemoryBytes(GraphicsMemory kind) {
+    return sBytes[size_t(kind)].load(std::memory_order_relaxed);
+}
+
+int64_t graphicsMemoryPeakBytes(GraphicsMemory kind) {
+    return sPeakBytes[size_t(kind)].load(std::memory_order_relaxed);
+}
+
+const char* graphicsMemoryName(GraphicsMemory kind) {
+    return kNames[size_t(kind)];
+}
+
+std::string dumpGraphicsMemory() {
+    std::string out;
+    int64_t total = 0;
+    char line[128];
+    for (size_t i = 0; i < kKinds; ++i) {
+        const int64_t bytes = sBytes[i].load(std::memory_order_relaxed);
+        total += bytes;
+        snprintf(line, sizeof(line), "%-20s %12" PRId64 " bytes (peak %" PRId64 ")\n", kNames[i],
+                 bytes, sPeakBytes[i].load(std::memory_order_relaxed));
+        out += line;
+    }
+    snprintf(line, sizeof(line), "%-20s %12" PRId64 " bytes\n", "total", total);
+    out += line;
+    return out;
+}
+
+void reportGraphicsMemory() {
+#if defined(__ANDROID__)
+    if (atrace_is_tag_enabled(ATRACE_TAG_GRAPHICS)) {
+        for (size_t i = 0; i < kKinds; ++i) {
+            atrace_int64(ATRACE_TAG_GRAPHICS, kCounterNames[i],
+                         sBytes[i].load(std::memory_order_relaxed));
+        }
+    }
+
+    static std::mutex sLastRequestLock;
+    static char sLastRequest[PROPERTY_VALUE_MAX] = "";
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("debug.gfxstream.memory.dump", value, "");
+    {
+        std::lock_guard<std::mutex> guard(sLastRequestLock);
+        if (!strcmp(value, sLastRequest)) {
+            return;
+        }
+        snprintf(sLastRequest, sizeof(sLastRequest), "%s", value);
+    }
+    const std::string dump = dumpGraphicsMemory();
+    ALOGI("Graphics memory:\n%s", dump.c_str());
+#endif
+}
+
+}  // namespace guest
+}  // namespace base
+}  // namespace android
@@ -0,0 +1,87 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+// Process wide accounting of the guest memory held by the graphics stack,
+// for sizing memory limits on dense hosts.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+namespace android {
+namespace base {
+namespace guest {
+
+enum class GraphicsMemory : uint32_t {
+    // Buffers of the transports behind HostConnection.
+    kStreamBuffers = 0,
+    // CommandBufferStagingStream buffers and arena chunks.
+    kStagingStreams,
+    // Host visible blocks mapped through CoherentMemory.
+    kCoherentMemory,
+    // Guest copies of GL buffer contents.
+    kBufferShadows,
+    // BumpPool and Pool allocations of VulkanStreamGuest.
+    kVulkanStreamPools,
+    // Gralloc buffers mapped into the process.
+    kGrallocMappings,
+    kCount,
+};
+
+// Adds |bytes|, which may be negative, to |kind|.
+void graphicsMemoryAdd(GraphicsMemory kind, int64_t bytes);
+
+// Bytes currently held, and the most ever held at once.
+int64_t graphicsMemoryBytes(GraphicsMemory kind);
+int64_t graphicsMemoryPeakBytes(GraphicsMemory kind);
+
+const char* graphicsMemoryName(GraphicsMemory kind);
+
+// One line per kind with the current and peak bytes, for dumpsys style
+// output.
+std::string dumpGraphicsMemory();
+
+// Emits every kind as a trace counter while tracing is on, and logs
+// dumpGraphicsMemory() whenever debug.gfxstream.memory.dump changes.
+// Cheap enough to call once per frame.
+void reportGraphicsMemory();
+
+// The bytes an object holds of one kind, kept in the totals for as long as
+// the object lives.
+class AccountedMemory {
+public:
+    explicit AccountedMemory(GraphicsMemory kind) : mKind(kind) {}
+    ~AccountedMemory() { set(0); }
+
+    AccountedMemory(const AccountedMemory&) = delete;
+    AccountedMemory& operator=(const AccountedMemory&) = delete;
+
+    void set(size_t bytes) {
+        if (bytes == mBytes) return;
+        graphicsMemoryAdd(mKind, int64_t(bytes) - int64_t(mBytes));
+        mBytes = bytes;
+    }
+
+    size_t bytes() const { return mBytes; }
+
+private:
+    const GraphicsMemory mKind;
+    size_t mBytes = 0;
+};
+
+}  // namespace guest
+}  // namespace base
+}  // namespace android
@@ -27,9 +27,28 @@
 #else
 #endif
 
+#if defined(__ANDROID__)
+#include <cutils/properties.h>
+#include <stdlib.h>
+#endif
+
 namespace android {
 namespace base {
 
+std::atomic<uint32_t> gTraceCategories{kTraceCategoriesUnread};
+
+uint32_t readTraceCategories() {
+    uint32_t categories = ~kTraceCategoriesUnread;
+#if defined(__ANDROID__)
+    char value[PROPERTY_VALUE_MAX] = "";
+    if (property_get("debug.gfxstream.trace.categories", value, "") > 0) {
+        categories = strtoul(value, nullptr, 0) & ~kTraceCategoriesUnread;
+    }
+#endif
+    gTraceCategories.store(categories, std::memory_order_relaxed);
+    return categories;
+}
+
 bool isTracingEnabled() {
 #if defined(__ANDROID__) || defined(HOST_BUILD)
     return atrace_is_tag_enabled(TRACE_TAG);
@@ -39,13 +58,18 @@ bool isTracingEnabled() {
 #endif
 }
 
-void ScopedTraceGuest::beginTraceImpl(const char* name) {
+bool ScopedTraceGuest::beginTraceImpl(const char* name) {
 #if defined(__ANDROID__) || defined(HOST_BUILD)
+    if (!atrace_is_tag_enabled(TRACE_TAG)) return false;
     atrace_begin(TRACE_TAG, name);
+    return true;
 #elif defined(__Fuchsia__) && !defined(FUCHSIA_NO_TRACE)
     TRACE_DURATION_BEGIN(TRACE_TAG, name);
+    return true;
 #else
     // No-op
+    (void)name;
+    return false;
 #endif
 }
 
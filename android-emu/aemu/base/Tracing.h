@@ -17,6 +17,25 @@
 // Library to perform tracing. Talks to platform-specific
 // tracing libraries.
 
+#include <stdint.h>
+
+#include <atomic>
+#include <type_traits>
+
+// Categories that guest traces are filtered by.
+#define AEMU_TRACE_CATEGORY_DEFAULT (1u << 0)
+// Transports, e.g. AddressSpaceStream.
+#define AEMU_TRACE_CATEGORY_STREAM (1u << 1)
+// Vulkan guest state tracking in ResourceTracker.
+#define AEMU_TRACE_CATEGORY_VULKAN (1u << 2)
+// Gralloc and mapper HALs.
+#define AEMU_TRACE_CATEGORY_GRALLOC (1u << 3)
+
+// Categories compiled in. Traces of other categories compile to nothing.
+#ifndef AEMU_TRACE_CATEGORIES
+#define AEMU_TRACE_CATEGORIES (~0u)
+#endif
+
 namespace android {
 namespace base {
 
@@ -44,20 +63,47 @@ public:
 
 bool isTracingEnabled();
 
+// Categories enabled at runtime by the debug.gfxstream.trace.categories
+// property, a mask of AEMU_TRACE_CATEGORY_* defaulting to all of them.
+// Read once per process.
+extern std::atomic<uint32_t> gTraceCategories;
+constexpr uint32_t kTraceCategoriesUnread = 1u << 31;
+uint32_t readTraceCategories();
+
+inline bool isTraceCategoryEnabled(uint32_t category) {
+    uint32_t categories = gTraceCategories.load(std::memory_order_relaxed);
+    if (categories & kTraceCategoriesUnread) {
+        categories = readTraceCategories();
+    }
+    return categories & category;
+}
+
 class ScopedTraceGuest {
 public:
-    ScopedTraceGuest(const char* name) : name_(name) {
-        beginTraceImpl(name_);
-    }
+    // |name| must outlive the trace; the tracing macros only take string
+    // literals.
+    ScopedTraceGuest(const char* name, uint32_t category = AEMU_TRACE_CATEGORY_DEFAULT)
+        : name_(name),
+          begun_(isTraceCategoryEnabled(category) && beginTraceImpl(name)) {}
 
     ~ScopedTraceGuest() {
-        endTraceImpl(name_);
+        if (begun_) {
+            endTraceImpl(name_);
+        }
     }
 private:
-    void beginTraceImpl(const char* name);
+    // Returns false without tracing if the platform is not recording.
+    bool beginTraceImpl(const char* name);
     void endTraceImpl(const char* name);
 
     const char* const name_;
+    const bool begun_;
+};
+
+// Stands in for traces of categories that are not compiled in.
+class ScopedTraceNone {
+public:
+    ScopedTraceNone(const char*, uint32_t) {}
 };
 
 } // namespace base
@@ -69,6 +115,12 @@ private:
 
 #ifdef HOST_BUILD
 #define AEMU_SCOPED_TRACE(tag) __attribute__ ((unused)) android::base::ScopedTrace AEMU_GENSYM(aemuScopedTrace_)(tag)
+#define AEMU_SCOPED_TRACE_CATEGORY(category, tag) AEMU_SCOPED_TRACE(tag)
 #else
-#define AEMU_SCOPED_TRACE(tag) __attribute__ ((unused)) android::base::ScopedTraceGuest AEMU_GENSYM(aemuScopedTrace_)(tag)
+#define AEMU_SCOPED_TRACE_CATEGORY(category, tag)                                     \
+    __attribute__((unused)) std::conditional_t<(AEMU_TRACE_CATEGORIES & (category)) != 0, \
+                                               android::base::ScopedTraceGuest,           \
+                                               android::base::ScopedTraceNone>            \
+        AEMU_GENSYM(aemuScopedTrace_)("" tag, category)
+#define AEMU_SCOPED_TRACE(tag) AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_DEFAULT, tag)
 #endif
@@ -17,6 +17,7 @@
 #include "aemu/base/Optional.h"
 
 #include <functional>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -401,6 +402,110 @@ private:
     uint64_t mLiveEntries;
 };
 
+// EntityManager, but with handles, generations and items in separate arrays
+// and the free list as a dense stack of indices. Lookups and liveness scans
+// touch only the arrays they need, and iteration takes any callable so that
+// visitors inline instead of going through std::function.
+template<size_t indexBits,
+         size_t generationBits,
+         size_t typeBits,
+         class Item>
+class SoaEntityManager {
+public:
+    using Handles = EntityManager<indexBits, generationBits, typeBits, int>;
+    using EntityHandle = uint64_t;
+    using Generation =
+        typename std::conditional<(generationBits <= 32), uint32_t, uint64_t>::type;
+
+    SoaEntityManager() = default;
+
+    void clear() {
+        for (size_t i = 0; i < mGenerations.size(); ++i) {
+            if (isLiveIndex(i)) retire(i);
+        }
+        mFreeIndices.clear();
+        for (size_t i = mGenerations.size(); i > 0; --i) {
+            mFreeIndices.push_back(i - 1);
+        }
+    }
+
+    size_t size() const { return mGenerations.size() - mFreeIndices.size(); }
+
+    EntityHandle add(const Item& item, size_t type) {
+        if (!type) return INVALID_ENTITY_HANDLE;
+
+        size_t index;
+        if (!mFreeIndices.empty()) {
+            index = mFreeIndices.back();
+            mFreeIndices.pop_back();
+        } else {
+            index = mGenerations.size();
+            if (index > Handles::indexMask) return INVALID_ENTITY_HANDLE;
+            mHandles.push_back(0);
+            mGenerations.push_back(1);
+            mItems.emplace_back();
+        }
+
+        mHandles[index] = Handles::makeHandle(index, mGenerations[index], type);
+        mItems[index] = item;
+        return mHandles[index];
+    }
+
+    void remove(EntityHandle h) {
+        if (!isLive(h)) return;
+        size_t index = Handles::getHandleIndex(h);
+        retire(index);
+        mFreeIndices.push_back(index);
+    }
+
+    Item* get(EntityHandle h) {
+        return isLive(h) ? &mItems[Handles::getHandleIndex(h)] : nullptr;
+    }
+
+    const Item* get_const(EntityHandle h) const {
+        return isLive(h) ? &mItems[Handles::getHandleIndex(h)] : nullptr;
+    }
+
+    bool isLive(EntityHandle h) const {
+        size_t index = Handles::getHandleIndex(h);
+        return index < mGenerations.size() && mHandles[index] == h &&
+               mGenerations[index] == Handles::getHandleGeneration(h);
+    }
+
+    // |func| is called as func(EntityHandle, Item&) for each live entry.
+    template <class Func>
+    void forEachLiveEntry(Func&& func) {
+        for (size_t i = 0; i < mGenerations.size(); ++i) {
+            if (isLiveIndex(i)) func(mHandles[i], mItems[i]);
+        }
+    }
+
+    template <class Func>
+    void forEachLiveEntry_const(Func&& func) const {
+        for (size_t i = 0; i < mGenerations.size(); ++i) {
+            if (isLiveIndex(i)) func(mHandles[i], static_cast<const Item&>(mItems[i]));
+        }
+    }
+
+private:
+    bool isLiveIndex(size_t index) const {
+        return mGenerations[index] == Handles::getHandleGeneration(mHandles[index]);
+    }
+
+    // Bumps the generation so that outstanding handles to |index| go stale.
+    void retire(size_t index) {
+        Generation next = mGenerations[index] + 1;
+        if (next == 0 || next > Handles::generationMaskBase) next = 1;
+        mGenerations[index] = next;
+        mItems[index] = Item();
+    }
+
+    std::vector<EntityHandle> mHandles;
+    std::vector<Generation> mGenerations;
+    std::vector<Item> mItems;
+    std::vector<size_t> mFreeIndices;
+};
+
 // Tracks components over a given space of entities.
 // Looking up by entity index is slower, but takes less space overall versus
 // a flat array that parallels the entities.
@@ -22,6 +22,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <assert.h>
 #include <stddef.h>
 #include <stdlib.h>
 
@@ -284,17 +285,13 @@ public:
         // Make sure that the small array starts exactly where base class
         // expects it: right after the |mCapacity|.
 
-        // We can't use a static_assert with offsetof() because in msvc, it uses
-        // reinterpret_cast.
-        // TODO: Add runtime assertion instead?
-        // https://developercommunity.visualstudio.com/content/problem/22196/static-assert-cannot-compile-constexprs-method-tha.html
-#ifndef _MSC_VER
-        static_assert(offsetof(base, mCapacity) + sizeof(base::mCapacity) ==
-                                      offsetof(SmallFixedVector, mData) &&
-                              offsetof(Data, array) == 0,
-                      "SmallFixedVector<> class layout is wrong, "
-                      "|mData| needs to follow |mCapacity|");
-#endif
+        // This can't be a static_assert with offsetof(): a class with members
+        // both in itself and in its base is not standard-layout, so offsetof()
+        // is only conditionally supported for it (-Winvalid-offsetof), and in
+        // msvc it uses reinterpret_cast.
+        assert(this->smallBufferStart() == (const void*)mData.array &&
+               "SmallFixedVector<> class layout is wrong, "
+               "|mData| needs to follow |mCapacity|");
 
         init_inplace();
     }
@@ -38,6 +38,12 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
 #define RING_BUFFER_MASK (RING_BUFFER_SIZE - 1)
 
 #define RING_BUFFER_VERSION 1
@@ -405,19 +411,171 @@ long ring_buffer_view_read(
     return (long)steps;
 }
 
+uint32_t ring_buffer_available_write(
+    const struct ring_buffer* r,
+    const struct ring_buffer_view* v) {
+    uint32_t read_view;
+    __atomic_load(&r->read_pos, &read_view, __ATOMIC_ACQUIRE);
+    if (v) {
+        return ring_buffer_view_get_ring_pos(
+                v, read_view - r->write_pos - 1);
+    } else {
+        return get_ring_pos(read_view - r->write_pos - 1);
+    }
+}
+
+static void get_span(
+    const struct ring_buffer* r,
+    const struct ring_buffer_view* v,
+    uint32_t index,
+    uint32_t bytes,
+    struct ring_buffer_span* span) {
+
+    uint8_t* buf = v ? v->buf : (uint8_t*)r->buf;
+    uint32_t size = v ? v->size : RING_BUFFER_SIZE;
+    uint32_t pos = index & (size - 1);
+    uint32_t available_at_end = size - pos;
+
+    span->first = &buf[pos];
+    if (bytes > available_at_end) {
+        span->first_bytes = available_at_end;
+        span->second = buf;
+        span->second_bytes = bytes - available_at_end;
+    } else {
+        span->first_bytes = bytes;
+        span->second = 0;
+        span->second_bytes = 0;
+    }
+}
+
+uint32_t ring_buffer_reserve_write(
+    const struct ring_buffer* r,
+    const struct ring_buffer_view* v,
+    uint32_t offset,
+    uint32_t bytes,
+    struct ring_buffer_span* span) {
+
+    uint32_t available = ring_buffer_available_write(r, v);
+    available = available > offset ? available - offset : 0;
+    if (bytes > available) {
+        bytes = available;
+    }
+
+    get_span(r, v, r->write_pos + offset, bytes, span);
+    return bytes;
+}
+
+void ring_buffer_commit_write(
+    struct ring_buffer* r,
+    uint32_t bytes) {
+    // Only the producer moves write_pos, so this needs no read-modify-write.
+    __atomic_store_n(&r->write_pos, r->write_pos + bytes, __ATOMIC_RELEASE);
+}
+
+uint32_t ring_buffer_reserve_read(
+    const struct ring_buffer* r,
+    const struct ring_buffer_view* v,
+    uint32_t offset,
+    uint32_t bytes,
+    struct ring_buffer_span* span) {
+
+    uint32_t write_view;
+    __atomic_load(&r->write_pos, &write_view, __ATOMIC_ACQUIRE);
+    uint32_t available = v ?
+        ring_buffer_view_get_ring_pos(v, write_view - r->read_pos) :
+        get_ring_pos(write_view - r->read_pos);
+    available = available > offset ? available - offset : 0;
+    if (bytes > available) {
+        bytes = available;
+    }
+
+    get_span(r, v, r->read_pos + offset, bytes, span);
+    return bytes;
+}
+
+void ring_buffer_commit_read(
+    struct ring_buffer* r,
+    uint32_t bytes) {
+    // Only the consumer moves read_pos.
+    __atomic_store_n(&r->read_pos, r->read_pos + bytes, __ATOMIC_RELEASE);
+}
+
 void ring_buffer_yield(void) { }
 
+#define RING_BUFFER_MIN_SLEEP_US 8
+#define RING_BUFFER_MAX_SLEEP_US 1000
+
+static uint32_t s_spin_budget = RING_BUFFER_DEFAULT_SPIN_BUDGET;
+
+void ring_buffer_set_spin_budget(uint32_t spins) {
+    __atomic_store_n(&s_spin_budget, spins, __ATOMIC_RELAXED);
+}
+
+struct ring_buffer_waiter {
+    uint32_t spins;
+    uint32_t sleep_us;
+    bool no_futex;
+};
+
+// Called each time a wait finds |*word| still at |seen|. Spins for the spin
+// budget, then sleeps on the word with a timeout that doubles up to
+// RING_BUFFER_MAX_SLEEP_US. The other side of the ring is usually the host,
+// which can not wake a guest futex, so the timeout is what bounds latency;
+// the futex still returns right away if the word has already moved. Some
+// host mappings can not back a shared futex (EFAULT); the waiter then keeps
+// the same backoff with plain sleeps instead of spinning on the error.
+static void ring_buffer_wait_change(
+    struct ring_buffer_waiter* w,
+    const uint32_t* word,
+    uint32_t seen) {
+
+    if (w->spins < __atomic_load_n(&s_spin_budget, __ATOMIC_RELAXED)) {
+        ++w->spins;
+        ring_buffer_pause();
+        return;
+    }
+
+    w->sleep_us = w->sleep_us ? w->sleep_us << 1 : RING_BUFFER_MIN_SLEEP_US;
+    if (w->sleep_us > RING_BUFFER_MAX_SLEEP_US) {
+        w->sleep_us = RING_BUFFER_MAX_SLEEP_US;
+    }
+
+#if defined(__linux__)
+    struct timespec timeout = { 0, (long)w->sleep_us * 1000 };
+    if (!w->no_futex) {
+        // Not FUTEX_PRIVATE_FLAG, the ring may be mapped into several processes.
+        if (syscall(SYS_futex, word, FUTEX_WAIT, seen, &timeout, NULL, 0) == 0 ||
+            (errno != EFAULT && errno != ENOSYS && errno != EINVAL)) {
+            return;
+        }
+        w->no_futex = true;
+    }
+    while (nanosleep(&timeout, &timeout) != 0 && errno == EINTR) { }
+#elif defined(_WIN32)
+    (void)word;
+    (void)seen;
+    Sleep(w->sleep_us >= 1000 ? 1 : 0);
+#else
+    (void)word;
+    (void)seen;
+    usleep(w->sleep_us);
+#endif
+}
+
 bool ring_buffer_wait_write(
     const struct ring_buffer* r,
     const struct ring_buffer_view* v,
     uint32_t bytes) {
 
+    struct ring_buffer_waiter waiter = { 0, 0, false };
+    uint32_t read_view = __atomic_load_n(&r->read_pos, __ATOMIC_ACQUIRE);
     bool can_write =
         v ? ring_buffer_view_can_write(r, v, bytes) :
             ring_buffer_can_write(r, bytes);
 
     while (!can_write) {
-        ring_buffer_yield();
+        ring_buffer_wait_change(&waiter, &r->read_pos, read_view);
+        read_view = __atomic_load_n(&r->read_pos, __ATOMIC_ACQUIRE);
         can_write =
             v ? ring_buffer_view_can_write(r, v, bytes) :
                 ring_buffer_can_write(r, bytes);
@@ -431,12 +589,15 @@ bool ring_buffer_wait_read(
     const struct ring_buffer_view* v,
     uint32_t bytes) {
 
+    struct ring_buffer_waiter waiter = { 0, 0, false };
+    uint32_t write_view = __atomic_load_n(&r->write_pos, __ATOMIC_ACQUIRE);
     bool can_read =
         v ? ring_buffer_view_can_read(r, v, bytes) :
             ring_buffer_can_read(r, bytes);
 
     while (!can_read) {
-        ring_buffer_yield();
+        ring_buffer_wait_change(&waiter, &r->write_pos, write_view);
+        write_view = __atomic_load_n(&r->write_pos, __ATOMIC_ACQUIRE);
         can_read =
             v ? ring_buffer_view_can_read(r, v, bytes) :
                 ring_buffer_can_read(r, bytes);
@@ -576,9 +737,11 @@ bool ring_buffer_producer_acquire_from_hangup(struct ring_buffer* r) {
 }
 
 void ring_buffer_producer_wait_hangup(struct ring_buffer* r) {
-    while (__atomic_load_n(&r->state, __ATOMIC_SEQ_CST) !=
+    struct ring_buffer_waiter waiter = { 0, 0, false };
+    uint32_t state;
+    while ((state = __atomic_load_n(&r->state, __ATOMIC_SEQ_CST)) !=
            RING_BUFFER_SYNC_CONSUMER_HUNG_UP) {
-        ring_buffer_yield();
+        ring_buffer_wait_change(&waiter, &r->state, state);
     }
 }
 
@@ -599,9 +762,11 @@ bool ring_buffer_consumer_hangup(struct ring_buffer* r) {
 }
 
 void ring_buffer_consumer_wait_producer_idle(struct ring_buffer* r) {
-    while (__atomic_load_n(&r->state, __ATOMIC_SEQ_CST) !=
+    struct ring_buffer_waiter waiter = { 0, 0, false };
+    uint32_t state;
+    while ((state = __atomic_load_n(&r->state, __ATOMIC_SEQ_CST)) !=
            RING_BUFFER_SYNC_PRODUCER_IDLE) {
-        ring_buffer_yield();
+        ring_buffer_wait_change(&waiter, &r->state, state);
     }
 }
 
@@ -107,12 +107,19 @@ long ring_buffer_view_read(
     void* data, uint32_t step_size, uint32_t steps);
 
 // Usage of ring_buffer as a waitable object.
-// These functions will back off if spinning too long.
+// These functions spin for the spin budget, then sleep on the ring's
+// position or state word with a timeout that grows up to a millisecond. The
+// sync state waits below back off the same way.
 //
 // if |v| is null, it is assumed that the statically allocated ring buffer is
 // used.
 //
 // Returns true if ring buffer became available, false if timed out.
+#define RING_BUFFER_DEFAULT_SPIN_BUDGET 1024
+
+// Sets how many times, process wide, a wait checks the ring before sleeping.
+void ring_buffer_set_spin_budget(uint32_t spins);
+
 bool ring_buffer_wait_write(
     const struct ring_buffer* r,
     const struct ring_buffer_view* v,
@@ -183,6 +190,52 @@ int ring_buffer_copy_contents(
     uint32_t wanted_bytes,
     uint8_t* res);
 
+// Zero copy access to the ring. A reservation is up to two spans of the ring
+// itself, the second one only when it wraps around, that the caller fills in
+// or consumes in place. Nothing is visible to the other side until the
+// matching commit, which publishes any number of bytes reserved since the
+// last commit with a single release store; several messages can be
+// serialized into one reservation and committed as a batch.
+//
+// These are for the single producer and the single consumer of the ring.
+// As with the wait functions, a null |v| means the statically allocated
+// ring buffer.
+struct ring_buffer_span {
+    uint8_t* first;
+    uint32_t first_bytes;
+    uint8_t* second;
+    uint32_t second_bytes;
+};
+
+uint32_t ring_buffer_available_write(
+    const struct ring_buffer* r,
+    const struct ring_buffer_view* v);
+
+// Reserves up to |bytes| of free space past the uncommitted |offset| bytes
+// already reserved since the last commit. Returns the number of bytes
+// reserved, 0 if the ring is full.
+uint32_t ring_buffer_reserve_write(
+    const struct ring_buffer* r,
+    const struct ring_buffer_view* v,
+    uint32_t offset,
+    uint32_t bytes,
+    struct ring_buffer_span* span);
+void ring_buffer_commit_write(
+    struct ring_buffer* r,
+    uint32_t bytes);
+
+// Same for the consumer: reserves up to |bytes| of what can be read past
+// |offset|, and gives back |bytes| of ring space once they are consumed.
+uint32_t ring_buffer_reserve_read(
+    const struct ring_buffer* r,
+    const struct ring_buffer_view* v,
+    uint32_t offset,
+    uint32_t bytes,
+    struct ring_buffer_span* span);
+void ring_buffer_commit_read(
+    struct ring_buffer* r,
+    uint32_t bytes);
+
 // Lockless synchronization where the consumer is allowed to hang up and go to
 // sleep. This can be considered a sort of asymmetric lock for two threads,
 // where the consumer can be more sleepy. It captures the pattern we usually use
@@ -24,6 +24,10 @@
 #endif
 
 #include <assert.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
 
 #define AEMU_DEBUG 0
 
@@ -40,6 +44,34 @@ namespace guest {
 template <class Lockable>
 class AutoLock;
 
+// Acquisitions of a lock and the time spent waiting for and holding it,
+// counted while the lock has been handed these with setStats(), e.g. by a
+// benchmark. Locks without stats only pay a branch. Condition variable
+// waits count as held.
+struct LockStats {
+    std::atomic<uint64_t> acquisitions{0};
+    std::atomic<uint64_t> waitNs{0};
+    std::atomic<uint64_t> holdNs{0};
+
+    void onAcquired(uint64_t waitStartNs) {
+        acquiredNs = nowNs();
+        acquisitions.fetch_add(1, std::memory_order_relaxed);
+        waitNs.fetch_add(acquiredNs - waitStartNs, std::memory_order_relaxed);
+    }
+
+    void onReleased() { holdNs.fetch_add(nowNs() - acquiredNs, std::memory_order_relaxed); }
+
+    static uint64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+private:
+    // Only touched by the holder.
+    uint64_t acquiredNs = 0;
+};
+
 class AutoWriteLock;
 class AutoReadLock;
 
@@ -58,15 +90,18 @@ public:
 
     // Acquire the lock.
     void lock() {
+        const uint64_t start = mStats ? LockStats::nowNs() : 0;
 #ifdef _WIN32
         ::AcquireSRWLockExclusive(&mLock);
 #else
         ::pthread_mutex_lock(&mLock);
 #endif
         AEMU_IF_DEBUG(mIsLocked = true;)
+        if (mStats) mStats->onAcquired(start);
     }
 
     bool tryLock() {
+        const uint64_t start = mStats ? LockStats::nowNs() : 0;
         bool ret = false;
 #ifdef _WIN32
         ret = ::TryAcquireSRWLockExclusive(&mLock);
@@ -74,6 +109,7 @@ public:
         ret = ::pthread_mutex_trylock(&mLock) == 0;
 #endif
         AEMU_IF_DEBUG(mIsLocked = ret;)
+        if (ret && mStats) mStats->onAcquired(start);
         return ret;
     }
 
@@ -81,6 +117,7 @@ public:
 
     // Release the lock.
     void unlock() {
+        if (mStats) mStats->onReleased();
         AEMU_IF_DEBUG(mIsLocked = false;)
 #ifdef _WIN32
         ::ReleaseSRWLockExclusive(&mLock);
@@ -89,6 +126,10 @@ public:
 #endif
     }
 
+    // Starts or, with nullptr, stops counting into |stats|. Only while the
+    // lock is not held.
+    void setStats(LockStats* stats) { mStats = stats; }
+
 protected:
     friend class ConditionVariable;
 
@@ -104,6 +145,7 @@ protected:
     DISALLOW_COPY_ASSIGN_AND_MOVE(StaticLock);
 
     AEMU_IF_DEBUG(bool mIsLocked = false;)
+    LockStats* mStats = nullptr;
 };
 
 template <>
@@ -124,15 +166,18 @@ public:
 
     // Acquire the lock.
     void lock() {
+        const uint64_t start = mStats ? LockStats::nowNs() : 0;
 #ifdef _WIN32
         ::EnterCriticalSection(&mLock);
 #else
         ::pthread_mutex_lock(&mLock);
 #endif
         AEMU_IF_DEBUG(mIsLocked = true;)
+        if (mStats && mStatsDepth++ == 0) mStats->onAcquired(start);
     }
 
     bool tryLock() {
+        const uint64_t start = mStats ? LockStats::nowNs() : 0;
         bool ret = false;
 #ifdef _WIN32
         ret = ::TryEnterCriticalSection(&mLock);
@@ -140,6 +185,7 @@ public:
         ret = ::pthread_mutex_trylock(&mLock) == 0;
 #endif
         AEMU_IF_DEBUG(mIsLocked = ret;)
+        if (ret && mStats && mStatsDepth++ == 0) mStats->onAcquired(start);
         return ret;
     }
 
@@ -147,6 +193,7 @@ public:
 
     // Release the lock.
     void unlock() {
+        if (mStats && --mStatsDepth == 0) mStats->onReleased();
         AEMU_IF_DEBUG(mIsLocked = false;)
 #ifdef _WIN32
         ::LeaveCriticalSection(&mLock);
@@ -155,6 +202,11 @@ public:
 #endif
     }
 
+    // Starts or, with nullptr, stops counting into |stats|, from the
+    // outermost lock() to the matching unlock(). Only while the lock is not
+    // held.
+    void setStats(LockStats* stats) { mStats = stats; }
+
 protected:
     friend class ConditionVariable;
 
@@ -168,6 +220,9 @@ protected:
     DISALLOW_COPY_ASSIGN_AND_MOVE(StaticLock);
 
     AEMU_IF_DEBUG(bool mIsLocked = false;)
+    LockStats* mStats = nullptr;
+    // Recursion depth of the holder, kept while counting.
+    uint32_t mStatsDepth = 0;
 };
 
 // Simple wrapper class for mutexes used in non-static context.
@@ -0,0 +1,70 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "aemu/base/synchronization/AndroidLockFreeMessageChannel.h"
+
+#include <limits.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace android {
+namespace base {
+namespace guest {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "futex words must be plain 32 bit integers");
+
+void LockFreeMessageChannelBase::stop() {
+    mStopped.store(true, std::memory_order_release);
+    notify(&mReadable, UINT32_MAX);
+    notify(&mWritable, UINT32_MAX);
+}
+
+// static
+void LockFreeMessageChannelBase::wait(std::atomic<uint32_t>* word, uint32_t seen) {
+#ifdef __linux__
+    // Returns right away if |word| already moved on; spurious returns are
+    // fine since callers retry.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE, seen, nullptr,
+            nullptr, 0);
+#else
+    // No futex: poll, giving up the core in between.
+    while (word->load(std::memory_order_acquire) == seen) {
+        sched_yield();
+        usleep(50);
+    }
+#endif
+}
+
+// static
+void LockFreeMessageChannelBase::wake(std::atomic<uint32_t>* word, uint32_t count) {
+#ifdef __linux__
+    const int toWake = count > INT_MAX ? INT_MAX : (int)count;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE, toWake, nullptr,
+            nullptr, 0);
+#else
+    (void)word;
+    (void)count;
+#endif
+}
+
+}  // namespace guest
+}  // namespace base
+}  // namespace android
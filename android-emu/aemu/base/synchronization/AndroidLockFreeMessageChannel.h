@@ -0,0 +1,246 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <utility>
+
+namespace android {
+namespace base {
+namespace guest {
+
+// Blocking and stopping shared by every LockFreeMessageChannel. Each side
+// parks on a futex word that the other side bumps, and only makes the wake
+// up syscall when someone is parked.
+class LockFreeMessageChannelBase {
+public:
+    // Wakes all blocked senders and receivers and fails every later
+    // blocking call. Non blocking calls keep working, so that the receiver
+    // can drain what was sent before.
+    void stop();
+
+    bool isStopped() const { return mStopped.load(std::memory_order_acquire); }
+
+protected:
+    LockFreeMessageChannelBase() = default;
+    ~LockFreeMessageChannelBase() = default;
+
+    struct Waitable {
+        std::atomic<uint32_t> word = {0};
+        std::atomic<uint32_t> waiters = {0};
+    };
+
+    // Calls |tryOnce| until it returns true, parking on |waitable| in
+    // between. Returns false if the channel stops first.
+    template <typename F>
+    bool blockUntil(Waitable* waitable, F&& tryOnce) {
+        while (!isStopped()) {
+            if (tryOnce()) return true;
+
+            // Registered before the word is read, so that a notify() which
+            // misses the waiter bumped the word before it was read.
+            waitable->waiters.fetch_add(1, std::memory_order_seq_cst);
+            const uint32_t seen = waitable->word.load(std::memory_order_seq_cst);
+            const bool done = !isStopped() && tryOnce();
+            if (!done && !isStopped()) {
+                wait(&waitable->word, seen);
+            }
+            waitable->waiters.fetch_sub(1, std::memory_order_relaxed);
+            if (done) return true;
+        }
+        return false;
+    }
+
+    // Tells threads parked on |waitable| that |count| items or slots became
+    // available.
+    static void notify(Waitable* waitable, uint32_t count) {
+        waitable->word.fetch_add(1, std::memory_order_seq_cst);
+        if (waitable->waiters.load(std::memory_order_seq_cst) > 0) {
+            wake(&waitable->word, count);
+        }
+    }
+
+    // Where receivers wait for items, and senders for slots.
+    Waitable mReadable;
+    Waitable mWritable;
+
+private:
+    // Returns once |word| may no longer hold |seen|.
+    static void wait(std::atomic<uint32_t>* word, uint32_t seen);
+    static void wake(std::atomic<uint32_t>* word, uint32_t count);
+
+    std::atomic<bool> mStopped = {false};
+};
+
+// A bounded multi producer, multi consumer channel of |CAPACITY| messages of
+// type |T| that sends and receives without taking a lock. Slots carry a
+// sequence number that says whose turn it is, as described by Dmitry Vyukov,
+// so producers and consumers only contend on their own position counter.
+// The batched calls claim a run of slots with a single update of it.
+//
+// As with MessageChannel, |T| has to be default constructible and movable.
+// Blocking calls park on a futex; non blocking ones never make syscalls
+// unless the other side is parked.
+template <typename T, size_t CAPACITY>
+class LockFreeMessageChannel : public LockFreeMessageChannelBase {
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0,
+                  "CAPACITY must be a power of two");
+
+public:
+    LockFreeMessageChannel() {
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            mSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeMessageChannel(const LockFreeMessageChannel&) = delete;
+    LockFreeMessageChannel& operator=(const LockFreeMessageChannel&) = delete;
+
+    bool trySend(const T& msg) { return trySend(&msg, 1) == 1; }
+
+    bool trySend(T&& msg) {
+        size_t pos;
+        if (!claim(&mSendPos, 0, 1, &pos)) return false;
+        publishSent(pos, 1, [&msg](T& slot, size_t) { slot = std::move(msg); });
+        return true;
+    }
+
+    // Sends as many of |msgs| as there is room for, in order. Returns how
+    // many were sent.
+    size_t trySend(const T* msgs, size_t count) {
+        size_t pos;
+        const size_t claimed = claim(&mSendPos, 0, count, &pos);
+        if (claimed) {
+            publishSent(pos, claimed, [msgs](T& slot, size_t i) { slot = msgs[i]; });
+        }
+        return claimed;
+    }
+
+    // Blocks while the channel is full. Returns false if it was stopped.
+    bool send(const T& msg) {
+        return blockUntil(&mWritable, [this, &msg] { return trySend(msg); });
+    }
+
+    bool send(T&& msg) {
+        return blockUntil(&mWritable, [this, &msg] { return trySend(std::move(msg)); });
+    }
+
+    bool tryReceive(T* msg) { return tryReceive(msg, 1) == 1; }
+
+    // Receives up to |maxCount| messages into |msgs|, oldest first. Returns
+    // how many were received.
+    size_t tryReceive(T* msgs, size_t maxCount) {
+        size_t pos;
+        const size_t claimed = claim(&mReceivePos, 1, maxCount, &pos);
+        for (size_t i = 0; i < claimed; ++i) {
+            Slot& slot = mSlots[(pos + i) & kMask];
+            msgs[i] = std::move(slot.item);
+            // Free for the send |CAPACITY| positions on.
+            slot.sequence.store(pos + i + CAPACITY, std::memory_order_release);
+        }
+        if (claimed) {
+            notify(&mWritable, (uint32_t)claimed);
+        }
+        return claimed;
+    }
+
+    // Blocks while the channel is empty. Returns false if it was stopped.
+    bool receive(T* msg) {
+        return blockUntil(&mReadable, [this, msg] { return tryReceive(msg); });
+    }
+
+    // Blocks until at least one message arrives, then receives up to
+    // |maxCount| of them. Returns 0 if the channel was stopped.
+    size_t receive(T* msgs, size_t maxCount) {
+        size_t received = 0;
+        blockUntil(&mReadable, [this, msgs, maxCount, &received] {
+            received = tryReceive(msgs, maxCount);
+            return received > 0;
+        });
+        return received;
+    }
+
+    // Messages sent and not yet received; only a hint while other threads
+    // are sending or receiving.
+    size_t size() const {
+        const size_t sent = mSendPos.load(std::memory_order_acquire);
+        const size_t received = mReceivePos.load(std::memory_order_acquire);
+        return sent > received ? sent - received : 0;
+    }
+
+    constexpr size_t capacity() const { return CAPACITY; }
+
+private:
+    static constexpr size_t kMask = CAPACITY - 1;
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct alignas(kCacheLineSize) Slot {
+        // Position this slot waits to be sent at, or that plus one once the
+        // message is there to be received.
+        std::atomic<size_t> sequence;
+        T item;
+    };
+
+    // Claims up to |maxCount| consecutive positions from |counter| whose
+    // slots have sequence |position + lag|, i.e. are ready for this side.
+    // Returns how many were claimed, the first of them in |*first|.
+    size_t claim(std::atomic<size_t>* counter, size_t lag, size_t maxCount, size_t* first) {
+        size_t pos = counter->load(std::memory_order_relaxed);
+        while (maxCount) {
+            size_t ready = 0;
+            while (ready < maxCount && ready < CAPACITY &&
+                   mSlots[(pos + ready) & kMask].sequence.load(std::memory_order_acquire) ==
+                       pos + ready + lag) {
+                ++ready;
+            }
+            if (!ready) {
+                const size_t seq = mSlots[pos & kMask].sequence.load(std::memory_order_acquire);
+                // Behind |pos|: the slot is still in use from the other
+                // side, so the channel is full or empty from this side's
+                // view. Ahead: another thread claimed it, so reload.
+                if ((intptr_t)(seq - (pos + lag)) < 0) return 0;
+                pos = counter->load(std::memory_order_relaxed);
+                continue;
+            }
+            // Slots this side saw ready stay ready until the position that
+            // owns them is claimed, so claiming all of them at once is safe.
+            if (counter->compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+                *first = pos;
+                return ready;
+            }
+        }
+        return 0;
+    }
+
+    template <typename F>
+    void publishSent(size_t pos, size_t count, F&& fill) {
+        for (size_t i = 0; i < count; ++i) {
+            Slot& slot = mSlots[(pos + i) & kMask];
+            fill(slot.item, i);
+            slot.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        notify(&mReadable, (uint32_t)count);
+    }
+
+    alignas(kCacheLineSize) std::atomic<size_t> mSendPos = {0};
+    alignas(kCacheLineSize) std::atomic<size_t> mReceivePos = {0};
+    Slot mSlots[CAPACITY];
+};
+
+}  // namespace guest
+}  // namespace base
+}  // namespace android
@@ -0,0 +1,263 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "aemu/base/threads/AndroidThreadPolicy.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__ANDROID__)
+#include <cutils/properties.h>
+#include <log/log.h>
+#endif
+
+#ifndef ALOGW
+#define ALOGW(fmt, ...) fprintf(stderr, fmt "\n", ##__VA_ARGS__)
+#endif
+
+namespace android {
+namespace base {
+namespace guest {
+
+namespace {
+
+constexpr int kNumRoles = static_cast<int>(ThreadRole::Worker) + 1;
+constexpr long kMaxCpu = 1023;
+
+const char* roleName(ThreadRole role) {
+    switch (role) {
+        case ThreadRole::Vsync:
+            return "vsync";
+        case ThreadRole::Composer:
+            return "composer";
+        case ThreadRole::DrmEvents:
+            return "drm_events";
+        case ThreadRole::Codec:
+            return "codec";
+        case ThreadRole::VulkanSubmit:
+            return "vulkan_submit";
+        case ThreadRole::Worker:
+            return "worker";
+    }
+    return "unknown";
+}
+
+// What the threads got before there were policies: the composer runs at
+// the priority of the SurfaceFlinger main thread, DRM events at display
+// priority and codec loopers at video priority. Vsync asked for real-time
+// before too, but with a nice value as its priority, which the kernel
+// refused.
+ThreadPolicy defaultPolicy(ThreadRole role) {
+    ThreadPolicy policy;
+    switch (role) {
+        case ThreadRole::Vsync:
+        case ThreadRole::Composer:
+            policy.fifoPriority = 2;
+            break;
+        case ThreadRole::DrmEvents:
+            policy.nice = -4;
+            break;
+        case ThreadRole::Codec:
+            policy.nice = -10;
+            break;
+        case ThreadRole::VulkanSubmit:
+        case ThreadRole::Worker:
+            break;
+    }
+    return policy;
+}
+
+bool parseInt(const char* str, long min, long max, long* out) {
+    char* end = nullptr;
+    errno = 0;
+    const long value = strtol(str, &end, 10);
+    if (errno || end == str || *end != '\0' || value < min || value > max) {
+        return false;
+    }
+    *out = value;
+    return true;
+}
+
+// Parses "0-1,3" into {0, 1, 3}.
+bool parseCpus(const std::string& str, std::vector<int>* out) {
+    std::vector<int> cpus;
+    size_t start = 0;
+    while (start < str.size()) {
+        size_t end = str.find(',', start);
+        if (end == std::string::npos) end = str.size();
+        const std::string range = str.substr(start, end - start);
+        const size_t dash = range.find('-');
+        long first;
+        long last;
+        if (dash == std::string::npos) {
+            if (!parseInt(range.c_str(), 0, kMaxCpu, &first)) return false;
+            last = first;
+        } else if (!parseInt(range.substr(0, dash).c_str(), 0, kMaxCpu, &first) ||
+                   !parseInt(range.substr(dash + 1).c_str(), first, kMaxCpu, &last)) {
+            return false;
+        }
+        for (long cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+        start = end + 1;
+    }
+    *out = std::move(cpus);
+    return true;
+}
+
+#if defined(__ANDROID__)
+std::string getRoleProperty(ThreadRole role, const char* key) {
+    const std::string name = std::string("ro.vendor.gfx.thread.") + roleName(role) + "." + key;
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get(name.c_str(), value, "");
+    return value;
+}
+#else
+std::string getRoleProperty(ThreadRole, const char*) { return ""; }
+#endif
+
+ThreadPolicy readPolicy(ThreadRole role) {
+    ThreadPolicy policy = defaultPolicy(role);
+    long value;
+
+    const std::string priority = getRoleProperty(role, "priority");
+    if (priority == "default") {
+        policy.fifoPriority.reset();
+        policy.nice.reset();
+    } else if (priority.rfind("fifo:", 0) == 0 && parseInt(priority.c_str() + 5, 1, 99, &value)) {
+        policy.fifoPriority = static_cast<int>(value);
+        policy.nice.reset();
+    } else if (priority.rfind("nice:", 0) == 0 && parseInt(priority.c_str() + 5, -20, 19, &value)) {
+        policy.fifoPriority.reset();
+        policy.nice = static_cast<int>(value);
+    } else if (!priority.empty()) {
+        ALOGW("%s: ignoring %s priority \"%s\"", __func__, roleName(role), priority.c_str());
+    }
+
+    const std::string cpus = getRoleProperty(role, "cpus");
+    if (!cpus.empty() && !parseCpus(cpus, &policy.cpus)) {
+        ALOGW("%s: ignoring %s cpus \"%s\"", __func__, roleName(role), cpus.c_str());
+    }
+
+    const std::string uclampMin = getRoleProperty(role, "uclamp_min");
+    if (!uclampMin.empty() && parseInt(uclampMin.c_str(), 0, 1024, &value)) {
+        policy.uclampMin = static_cast<uint32_t>(value);
+    }
+    const std::string uclampMax = getRoleProperty(role, "uclamp_max");
+    if (!uclampMax.empty() && parseInt(uclampMax.c_str(), 0, 1024, &value)) {
+        policy.uclampMax = static_cast<uint32_t>(value);
+    }
+    return policy;
+}
+
+#if defined(__linux__)
+// From linux/sched/types.h, which not every libc ships.
+struct SchedAttr {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+    uint32_t sched_util_min;
+    uint32_t sched_util_max;
+};
+
+constexpr uint64_t kSchedFlagKeepPolicy = 0x08;
+constexpr uint64_t kSchedFlagKeepParams = 0x10;
+constexpr uint64_t kSchedFlagUtilClampMin = 0x20;
+constexpr uint64_t kSchedFlagUtilClampMax = 0x40;
+#endif
+
+}  // namespace
+
+const ThreadPolicy& getThreadPolicy(ThreadRole role) {
+    static const std::vector<ThreadPolicy> sPolicies = [] {
+        std::vector<ThreadPolicy> policies;
+        for (int i = 0; i < kNumRoles; ++i) {
+            policies.push_back(readPolicy(static_cast<ThreadRole>(i)));
+        }
+        return policies;
+    }();
+    return sPolicies[static_cast<int>(role)];
+}
+
+void applyThreadPolicy(ThreadRole role) {
+#if defined(__linux__)
+    const ThreadPolicy& policy = getThreadPolicy(role);
+    const char* name = roleName(role);
+
+    // With a pid of 0 these all apply to the calling thread alone.
+    if (policy.fifoPriority) {
+        struct sched_param param = {};
+        param.sched_priority = *policy.fifoPriority;
+        if (sched_setscheduler(0, SCHED_FIFO | SCHED_RESET_ON_FORK, &param) != 0) {
+            ALOGW("%s: failed to make %s thread real-time: %s", __func__, name, strerror(errno));
+        }
+    } else if (policy.nice) {
+        if (setpriority(PRIO_PROCESS, 0, *policy.nice) != 0) {
+            ALOGW("%s: failed to set %s thread nice: %s", __func__, name, strerror(errno));
+        }
+    }
+
+    if (!policy.cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : policy.cpus) {
+            if (cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+        }
+        if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+            ALOGW("%s: failed to set %s thread cpus: %s", __func__, name, strerror(errno));
+        }
+    }
+
+#if defined(SYS_sched_setattr)
+    if (policy.uclampMin || policy.uclampMax) {
+        SchedAttr attr = {};
+        attr.size = sizeof(attr);
+        attr.sched_flags = kSchedFlagKeepPolicy | kSchedFlagKeepParams;
+        if (policy.uclampMin) {
+            attr.sched_flags |= kSchedFlagUtilClampMin;
+            attr.sched_util_min = *policy.uclampMin;
+        }
+        if (policy.uclampMax) {
+            attr.sched_flags |= kSchedFlagUtilClampMax;
+            attr.sched_util_max = *policy.uclampMax;
+        }
+        if (syscall(SYS_sched_setattr, 0, &attr, 0) != 0) {
+            ALOGW("%s: failed to set %s thread uclamp: %s", __func__, name, strerror(errno));
+        }
+    }
+#endif
+#else
+    (void)role;
+#endif
+}
+
+}  // namespace guest
+}  // namespace base
+}  // namespace android
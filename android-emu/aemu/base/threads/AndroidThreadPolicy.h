@@ -0,0 +1,75 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <stdint.h>
+
+#include <optional>
+#include <vector>
+
+namespace android {
+namespace base {
+namespace guest {
+
+// What a graphics thread is for, which decides how it is scheduled.
+enum class ThreadRole {
+    // Wakes up for each vsync of a display.
+    Vsync,
+    // Composes and presents frames.
+    Composer,
+    // Reads DRM events such as hotplug.
+    DrmEvents,
+    // Decodes or converts frames for a codec.
+    Codec,
+    // Encodes and flushes Vulkan queue submits.
+    VulkanSubmit,
+    // Runs pool tasks: fence waits, composition bands and the like.
+    Worker,
+};
+
+// How a thread of a given role is scheduled. Unset fields leave the thread
+// as it was created.
+struct ThreadPolicy {
+    // SCHED_FIFO priority, 1 to 99. Threads created by a real-time thread
+    // start out with the default policy again.
+    std::optional<int> fifoPriority;
+    // Nice value, -20 to 19, for threads that are not real-time.
+    std::optional<int> nice;
+    // CPUs the thread may run on.
+    std::vector<int> cpus;
+    // Utilization clamps, 0 to 1024, for kernels with uclamp.
+    std::optional<uint32_t> uclampMin;
+    std::optional<uint32_t> uclampMax;
+};
+
+// The policy of |role|: the built-in default, overridden by the properties
+//
+//   ro.vendor.gfx.thread.<role>.priority    "fifo:<1-99>", "nice:<-20-19>"
+//                                           or "default"
+//   ro.vendor.gfx.thread.<role>.cpus        CPU list such as "0-1,3"
+//   ro.vendor.gfx.thread.<role>.uclamp_min  0-1024
+//   ro.vendor.gfx.thread.<role>.uclamp_max  0-1024
+//
+// where <role> is vsync, composer, drm_events, codec, vulkan_submit or
+// worker. Read once per process.
+const ThreadPolicy& getThreadPolicy(ThreadRole role);
+
+// Applies the policy of |role| to the calling thread. Failures, such as a
+// missing permission for real-time priorities, are logged and otherwise
+// ignored.
+void applyThreadPolicy(ThreadRole role);
+
+}  // namespace guest
+}  // namespace base
+}  // namespace android
@@ -15,6 +15,7 @@
 #include "aemu/base/threads/AndroidWorkPool.h"
 
 #include "aemu/base/threads/AndroidFunctorThread.h"
+#include "aemu/base/threads/AndroidThreadPolicy.h"
 #include "aemu/base/synchronization/AndroidLock.h"
 #include "aemu/base/synchronization/AndroidConditionVariable.h"
 #include "aemu/base/synchronization/AndroidMessageChannel.h"
@@ -276,6 +277,8 @@ private:
     }
 
     void threadFunc() {
+        android::base::guest::applyThreadPolicy(android::base::guest::ThreadRole::Worker);
+
         TaskInfo taskInfo;
         bool done = false;
 
@@ -0,0 +1,182 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "aemu/base/threads/AndroidWorkStealingPool.h"
+
+#include <pthread.h>
+
+#include <deque>
+#include <string>
+
+#include "aemu/base/threads/AndroidThreadPolicy.h"
+
+namespace android {
+namespace base {
+namespace guest {
+
+namespace {
+
+// The pool and deque of the calling thread, if it is a worker.
+thread_local const WorkStealingPool* tPool = nullptr;
+thread_local size_t tWorkerIndex = 0;
+
+}  // namespace
+
+struct WorkStealingPool::Worker {
+    std::mutex lock;
+    std::deque<QueuedTask> tasks;
+    std::thread thread;
+};
+
+WorkStealingPool::WorkStealingPool(size_t numThreads) {
+    for (size_t i = 0; i < numThreads; ++i) {
+        mWorkers.emplace_back(new Worker);
+    }
+    // Threads start once every deque exists, since they steal from all.
+    for (size_t i = 0; i < numThreads; ++i) {
+        mWorkers[i]->thread = std::thread([this, i] { threadLoop(i); });
+        const std::string name = "gfx_worker_" + std::to_string(i);
+        pthread_setname_np(mWorkers[i]->thread.native_handle(), name.c_str());
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mSleepLock);
+        mShuttingDown = true;
+    }
+    mWorkAvailable.notify_all();
+    for (auto& worker : mWorkers) {
+        worker->thread.join();
+    }
+}
+
+// static
+WorkStealingPool& WorkStealingPool::get() {
+    static WorkStealingPool* sPool = [] {
+        const unsigned cores = std::max(std::thread::hardware_concurrency(), 1u);
+        return new WorkStealingPool(cores - 1);
+    }();
+    return *sPool;
+}
+
+void WorkStealingPool::submit(TaskGroup* group, Task task) {
+    if (mWorkers.empty()) {
+        task();
+        return;
+    }
+
+    group->mPending.fetch_add(1, std::memory_order_relaxed);
+
+    const size_t index = tPool == this
+        ? tWorkerIndex
+        : mNextWorker.fetch_add(1, std::memory_order_relaxed) % mWorkers.size();
+    {
+        // Counted before it is queued so that taking it never underflows, and
+        // under the lock so that a worker about to sleep sees it.
+        std::lock_guard<std::mutex> lock(mSleepLock);
+        mQueued.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        Worker& worker = *mWorkers[index];
+        std::lock_guard<std::mutex> lock(worker.lock);
+        worker.tasks.push_back({group, std::move(task)});
+    }
+    mWorkAvailable.notify_one();
+}
+
+void WorkStealingPool::wait(TaskGroup* group) {
+    while (group->mPending.load(std::memory_order_acquire) > 0) {
+        QueuedTask queued;
+        if (takeTask(&queued)) {
+            runTask(queued);
+            continue;
+        }
+        // What is left is running on other threads.
+        std::unique_lock<std::mutex> lock(group->mLock);
+        group->mDone.wait(lock, [group] {
+            return group->mPending.load(std::memory_order_acquire) == 0;
+        });
+    }
+    std::lock_guard<std::mutex> lock(group->mLock);
+}
+
+bool WorkStealingPool::takeTask(QueuedTask* out) {
+    if (mQueued.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    const bool isWorker = tPool == this;
+    const size_t self = isWorker ? tWorkerIndex : 0;
+    if (isWorker) {
+        Worker& worker = *mWorkers[self];
+        std::lock_guard<std::mutex> lock(worker.lock);
+        if (!worker.tasks.empty()) {
+            *out = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+            mQueued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    for (size_t i = 0; i < mWorkers.size(); ++i) {
+        const size_t victim = (self + i + (isWorker ? 1 : 0)) % mWorkers.size();
+        if (isWorker && victim == self) continue;
+        Worker& worker = *mWorkers[victim];
+        std::lock_guard<std::mutex> lock(worker.lock);
+        if (!worker.tasks.empty()) {
+            *out = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+            mQueued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::runTask(QueuedTask& queued) {
+    queued.task();
+    queued.task = Task();
+
+    // Counted down under the lock, which the waiter takes before it returns,
+    // so that the group outlives this.
+    TaskGroup* group = queued.group;
+    std::lock_guard<std::mutex> lock(group->mLock);
+    if (group->mPending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        group->mDone.notify_all();
+    }
+}
+
+void WorkStealingPool::threadLoop(size_t index) {
+    tPool = this;
+    tWorkerIndex = index;
+    applyThreadPolicy(ThreadRole::Worker);
+
+    while (true) {
+        QueuedTask queued;
+        if (takeTask(&queued)) {
+            runTask(queued);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mSleepLock);
+        mWorkAvailable.wait(lock, [this] {
+            return mShuttingDown || mQueued.load(std::memory_order_relaxed) > 0;
+        });
+        if (mShuttingDown) {
+            return;
+        }
+    }
+}
+
+}  // namespace guest
+}  // namespace base
+}  // namespace android
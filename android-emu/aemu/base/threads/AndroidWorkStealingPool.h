@@ -0,0 +1,223 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace android {
+namespace base {
+namespace guest {
+
+// A move only void() callable. Captures of up to kInlineSize bytes are stored
+// in place, so that short lived tasks do not allocate.
+class InlineTask {
+public:
+    static constexpr size_t kInlineSize = 64;
+
+    InlineTask() = default;
+
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineTask>>>
+    InlineTask(F&& f) {
+        using Fn = std::decay_t<F>;
+        if constexpr (fitsInline<Fn>()) {
+            new (mStorage) Fn(std::forward<F>(f));
+            mOps = &kInlineOps<Fn>;
+        } else {
+            *reinterpret_cast<Fn**>(mStorage) = new Fn(std::forward<F>(f));
+            mOps = &kHeapOps<Fn>;
+        }
+    }
+
+    InlineTask(InlineTask&& other) noexcept { moveFrom(other); }
+
+    InlineTask& operator=(InlineTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineTask(const InlineTask&) = delete;
+    InlineTask& operator=(const InlineTask&) = delete;
+
+    ~InlineTask() { reset(); }
+
+    explicit operator bool() const { return mOps != nullptr; }
+
+    void operator()() { mOps->invoke(mStorage); }
+
+private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        // Move constructs into |dst| and destroys |src|.
+        void (*relocate)(void* dst, void* src);
+        void (*destroy)(void* storage);
+    };
+
+    template <typename Fn>
+    static constexpr bool fitsInline() {
+        return sizeof(Fn) <= kInlineSize && alignof(Fn) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<Fn>;
+    }
+
+    template <typename Fn>
+    static constexpr Ops kInlineOps = {
+        [](void* storage) { (*static_cast<Fn*>(storage))(); },
+        [](void* dst, void* src) {
+            new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        },
+        [](void* storage) { static_cast<Fn*>(storage)->~Fn(); },
+    };
+
+    template <typename Fn>
+    static constexpr Ops kHeapOps = {
+        [](void* storage) { (**static_cast<Fn**>(storage))(); },
+        [](void* dst, void* src) { *static_cast<Fn**>(dst) = *static_cast<Fn**>(src); },
+        [](void* storage) { delete *static_cast<Fn**>(storage); },
+    };
+
+    void moveFrom(InlineTask& other) {
+        if (other.mOps) {
+            other.mOps->relocate(mStorage, other.mStorage);
+            mOps = other.mOps;
+            other.mOps = nullptr;
+        }
+    }
+
+    void reset() {
+        if (mOps) {
+            mOps->destroy(mStorage);
+            mOps = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char mStorage[kInlineSize];
+    const Ops* mOps = nullptr;
+};
+
+// A fixed set of threads for short, non blocking, compute tasks such as
+// composition bands or pixel conversion. Each thread has its own deque: it
+// runs its newest task first and, once out of work, steals the oldest task of
+// another thread. Threads waiting on a TaskGroup run queued tasks meanwhile,
+// so tasks can submit and wait on more tasks.
+//
+// Tasks that block on other tasks or on the host belong on WorkPool, which
+// gives each of them a thread.
+class WorkStealingPool {
+public:
+    using Task = InlineTask;
+
+    // Tasks that can be waited on together.
+    class TaskGroup {
+    public:
+        TaskGroup() = default;
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+    private:
+        friend class WorkStealingPool;
+
+        std::atomic<size_t> mPending = {0};
+        std::mutex mLock;
+        std::condition_variable mDone;
+    };
+
+    explicit WorkStealingPool(size_t numThreads);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // A pool with one thread per core besides the caller's, shared across the
+    // process.
+    static WorkStealingPool& get();
+
+    // Threads that can run tasks, counting the one that waits.
+    size_t getConcurrency() const { return mWorkers.size() + 1; }
+
+    // Queues |task| as part of |group|. Without threads it runs right away.
+    void submit(TaskGroup* group, Task task);
+
+    // Returns once every task of |group| is done, running queued tasks of any
+    // group while waiting.
+    void wait(TaskGroup* group);
+
+    // Calls body(begin, end) over [0, count) split into ranges of at least
+    // |grainSize|, at most one per thread, and returns once all are done.
+    template <typename F>
+    void parallelFor(size_t count, size_t grainSize, F&& body) {
+        if (count == 0) return;
+        const size_t grain = std::max<size_t>(grainSize, 1);
+        const size_t numRanges = std::min((count + grain - 1) / grain, getConcurrency());
+        if (numRanges <= 1) {
+            body(size_t(0), count);
+            return;
+        }
+        const size_t rangeSize = (count + numRanges - 1) / numRanges;
+
+        TaskGroup group;
+        auto* fn = &body;
+        for (size_t begin = rangeSize; begin < count; begin += rangeSize) {
+            const size_t end = std::min(begin + rangeSize, count);
+            submit(&group, [fn, begin, end] { (*fn)(begin, end); });
+        }
+        body(size_t(0), std::min(rangeSize, count));
+        wait(&group);
+    }
+
+private:
+    struct QueuedTask {
+        TaskGroup* group;
+        Task task;
+    };
+
+    struct Worker;
+
+    void threadLoop(size_t index);
+
+    // Takes the newest task of the calling worker's own deque or, failing
+    // that, the oldest of another one.
+    bool takeTask(QueuedTask* out);
+
+    void runTask(QueuedTask& queued);
+
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    // Where submissions from threads outside the pool go next.
+    std::atomic<size_t> mNextWorker = {0};
+
+    // Counts tasks in any deque; workers sleep while it is zero.
+    std::atomic<size_t> mQueued = {0};
+    std::mutex mSleepLock;
+    std::condition_variable mWorkAvailable;
+    bool mShuttingDown = false;
+};
+
+}  // namespace guest
+}  // namespace base
+}  // namespace android
@@ -16,10 +16,15 @@
 #ifndef __IO_STREAM_H__
 #define __IO_STREAM_H__
 
+#include <initializer_list>
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <time.h>
 
+#include "EncoderDebug.h"
 #include "ErrorLog.h"
 
 class IOStream {
@@ -31,6 +36,11 @@ public:
         m_bufsize = bufSize;
         m_free = 0;
         m_refcount = 1;
+        m_readbackCount = 0;
+        m_lastReadbackNs = 0;
+        m_totalReadbackNs = 0;
+        m_committedBytes = 0;
+        m_flushCount = 0;
     }
 
     void incRef() {
@@ -58,6 +68,22 @@ public:
     virtual int writeFullyAsync(const void* buf, size_t len) {
         return writeFully(buf, len);
     }
+    // Writes |size| bytes of the buffer from allocBuffer followed by |iov|.
+    // Transports with vectored writes override this so that large payloads
+    // go to the transport straight from the caller's memory in one call.
+    virtual int commitBufferAndWritevFully(size_t size, const struct iovec* iov, int iovcnt) {
+        int stat = size ? commitBuffer(size) : 0;
+        for (int i = 0; i < iovcnt && stat >= 0; ++i) {
+            if (iov[i].iov_len) {
+                stat = writeFully(iov[i].iov_base, iov[i].iov_len);
+            }
+        }
+        return stat;
+    }
+
+    // Called once the commands of a frame have been flushed. Transports
+    // that hold back partial writes push them out here.
+    virtual void onFrameBoundary() { }
 
     virtual ~IOStream() {
 
@@ -87,6 +113,7 @@ public:
 
         ptr = m_iostreamBuf + (m_bufsize - m_free);
         m_free -= len;
+        profileWrite(len);
 
         return ptr;
     }
@@ -95,6 +122,10 @@ public:
 
         if (!m_iostreamBuf || m_free == m_bufsize) return 0;
 
+        m_committedBytes += m_bufsize - m_free;
+        ++m_flushCount;
+        ::android::base::flightRecord(::android::base::FlightEvent::Flush, nullptr,
+                                      m_bufsize - m_free);
         int stat = commitBuffer(m_bufsize - m_free);
         m_iostreamBuf = NULL;
         m_free = 0;
@@ -102,15 +133,137 @@ public:
     }
 
     const unsigned char *readback(void *buf, size_t len) {
+        const uint64_t start = monotonicNs();
+        const unsigned char* res;
         if (m_iostreamBuf && m_free != m_bufsize) {
             size_t size = m_bufsize - m_free;
             m_iostreamBuf = NULL;
             m_free = 0;
-            return commitBufferAndReadFully(size, buf, len);
+            m_committedBytes += size;
+            ++m_flushCount;
+            res = commitBufferAndReadFully(size, buf, len);
+        } else {
+            res = readFully(buf, len);
         }
-        return readFully(buf, len);
+        m_lastReadbackNs = monotonicNs() - start;
+        m_totalReadbackNs += m_lastReadbackNs;
+        ++m_readbackCount;
+        profileReadback(m_lastReadbackNs);
+        ::android::base::flightRecord(::android::base::FlightEvent::Readback, nullptr, len,
+                                      m_lastReadbackNs);
+        return res;
+    }
+
+    // Consumes the next |len| bytes of the response being read back and
+    // returns them in place in the transport's read buffer, valid until the
+    // next read. Returns nullptr, consuming nothing, while commands are
+    // pending or if the transport can not hand the bytes out without a
+    // copy; callers then use readback().
+    const unsigned char* readbackView(size_t len) {
+        if (pendingBytes()) return nullptr;
+        return readView(len);
+    }
+
+    // Writes everything pending in the stream buffer, then |iov| in order.
+    int writevFully(const struct iovec* iov, int iovcnt) {
+        size_t size = 0;
+        if (m_iostreamBuf && m_free != m_bufsize) {
+            size = m_bufsize - m_free;
+            m_iostreamBuf = NULL;
+            m_free = 0;
+        }
+        m_committedBytes += size;
+        size_t total = size;
+        for (int i = 0; i < iovcnt; ++i) {
+            total += iov[i].iov_len;
+            profileWrite(iov[i].iov_len);
+        }
+        m_committedBytes += total - size;
+        ++m_flushCount;
+        ::android::base::flightRecord(::android::base::FlightEvent::Write, nullptr, total);
+        return commitBufferAndWritevFully(size, iov, iovcnt);
+    }
+
+    // For hand-written encoders of commands with one large parameter.
+    // Encodes the opcode, the total size, the 4-byte |params| that come
+    // before the large parameter and its size, as the generated encoders
+    // do. Those flush here and write the size on its own; this leaves it
+    // all in the stream buffer, and writeLargeParam() then sends it with
+    // the payload in one write. |tailSize| is what the caller encodes
+    // after the payload. Only for streams without checksums.
+    template <typename... Params>
+    void allocLargeParamHeader(uint32_t opcode, uint32_t largeParamSize, size_t tailSize,
+                               const Params&... params) {
+        const size_t headSize = 8 + 4 * sizeof...(params) + 4;
+        const uint32_t totalSize = headSize + largeParamSize + tailSize;
+        unsigned char* ptr = alloc(headSize);
+        if (!ptr) return;
+        memcpy(ptr, &opcode, 4); ptr += 4;
+        memcpy(ptr, &totalSize, 4); ptr += 4;
+        for (const void* param : { static_cast<const void*>(&params)... }) {
+            memcpy(ptr, param, 4); ptr += 4;
+        }
+        memcpy(ptr, &largeParamSize, 4);
+    }
+
+    int writeLargeParam(const void* data, size_t len) {
+        if (!data || !len) return 0;
+        const struct iovec iov = { const_cast<void*>(data), len };
+        return writevFully(&iov, 1);
     }
 
+    // Flushes what is pending and gives back the transfer memory, which may
+    // have grown for large commands. The next alloc() starts over at the
+    // original buffer size. For streams that sit idle.
+    int trim() {
+        int stat = flush();
+        rewind();
+        releaseBuffers();
+        return stat;
+    }
+
+    // Bytes encoded but not yet committed to the transport.
+    size_t pendingBytes() const {
+        return m_iostreamBuf ? m_bufsize - m_free : 0;
+    }
+
+    // Where the next alloc() continues and how much it can take without
+    // flushing, so that the command just encoded can still be grown in
+    // place. Only meaningful while flushCount() has not changed.
+    const unsigned char* pendingEnd() const {
+        return m_iostreamBuf ? m_iostreamBuf + (m_bufsize - m_free) : nullptr;
+    }
+    size_t availableBytes() const {
+        return m_iostreamBuf ? m_free : 0;
+    }
+
+    // Round trip time of the most recent readback, which includes the host
+    // draining everything that was queued ahead of it.
+    uint64_t readbackCount() const { return m_readbackCount; }
+    uint64_t lastReadbackNs() const { return m_lastReadbackNs; }
+    uint64_t totalReadbackNs() const { return m_totalReadbackNs; }
+
+    // Totals since the stream was created, for profiling.
+    uint64_t committedBytes() const { return m_committedBytes; }
+    uint64_t flushCount() const { return m_flushCount; }
+
+    // Bytes committed that the host has not read yet, for transports that
+    // can tell.
+    virtual size_t hostQueuedBytes() { return 0; }
+
+    // Backs readbackView() for transports that buffer what they read.
+    virtual const unsigned char* readView(size_t) { return nullptr; }
+
+    // Feed the per entry point encoder profile. Callers that write around
+    // alloc() and writevFully() report their bytes themselves.
+#if defined(ENABLE_ENCODER_PROFILING)
+    static void profileWrite(size_t len) { encoderProfileThreadTotals()->bytes += len; }
+    static void profileReadback(uint64_t ns) { encoderProfileReadback(ns); }
+#else
+    static void profileWrite(size_t) { }
+    static void profileReadback(uint64_t) { }
+#endif
+
     // These two methods are defined and used in GLESv2_enc. Any reference
     // outside of GLESv2_enc will produce a link error. This is intentional
     // (technical debt).
@@ -125,12 +278,30 @@ protected:
         m_free = 0;
     }
 
+    size_t initialBufferSize() const { return m_bufsizeOrig; }
+
+    // Frees the memory behind allocBuffer(), called by trim() once nothing
+    // is pending. Transports whose buffers can not be given back keep them.
+    virtual void releaseBuffers() { }
+
+    static uint64_t monotonicNs() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    }
+
 private:
+
     unsigned char *m_iostreamBuf;
     size_t m_bufsizeOrig;
     size_t m_bufsize;
     size_t m_free;
     uint32_t m_refcount;
+    uint64_t m_readbackCount;
+    uint64_t m_lastReadbackNs;
+    uint64_t m_totalReadbackNs;
+    uint64_t m_committedBytes;
+    uint64_t m_flushCount;
 };
 
 //
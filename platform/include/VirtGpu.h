@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include "virtgpu_gfxstream_protocol.h"
 
@@ -119,6 +120,8 @@ class VirtGpuBlob : public std::enable_shared_from_this<VirtGpuBlob> {
     uint32_t getBlobHandle(void);
     int wait(void);
 
+    // Returns the blob's live mapping if it has one, so that mapping a
+    // blob again costs no ioctl or mmap.
     VirtGpuBlobMappingPtr createMapping(void);
     int exportBlob(struct VirtGpuExternalHandle& handle);
 
@@ -130,6 +133,12 @@ class VirtGpuBlob : public std::enable_shared_from_this<VirtGpuBlob> {
     uint32_t mBlobHandle;
     uint32_t mResourceHandle;
     uint64_t mSize;
+
+    std::mutex mMappingLock;
+    std::weak_ptr<VirtGpuBlobMapping> mMapping;
+    // The fake offset DRM_IOCTL_VIRTGPU_MAP gave, which stays valid for as
+    // long as the handle does; 0 until the first mapping.
+    uint64_t mMapOffset = 0;
 };
 
 class VirtGpuBlobMapping {
@@ -157,6 +166,12 @@ class VirtGpuDevice {
     VirtGpuBlobPtr importBlob(const struct VirtGpuExternalHandle& handle);
 
     int execBuffer(struct VirtGpuExecBuffer& execbuffer, VirtGpuBlobPtr blob);
+    // Submits |count| commands in order, sharing one execbuffer between
+    // neighbours on the same ring when the host decodes more than one
+    // command per submission. kFenceIn is not taken. A command asking for
+    // kFenceOut gets a fence of its own that signals once the submission
+    // it went in is done, which may be after the commands that follow it.
+    int execBuffers(struct VirtGpuExecBuffer* execbuffers, uint32_t count);
 
   private:
     VirtGpuDevice(enum VirtGpuCapset capset);
@@ -84,6 +84,9 @@ struct gfxstreamCapset {
     uint32_t colorBufferMemoryIndex;
     uint32_t padding[16];
     uint32_t deferredMapping;
+    // Whether the host decodes every command in an execbuffer rather than
+    // only the first, so that several can share one submission.
+    uint32_t multiCommandSubmit;
 };
 
 #endif
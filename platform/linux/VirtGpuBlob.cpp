@@ -54,26 +54,36 @@ uint32_t VirtGpuBlob::getResourceHandle(void) {
 }
 
 VirtGpuBlobMappingPtr VirtGpuBlob::createMapping(void) {
-    int ret;
-    struct drm_virtgpu_map map {
-        .handle = mBlobHandle, .pad = 0,
-    };
+    std::lock_guard<std::mutex> lock(mMappingLock);
+    VirtGpuBlobMappingPtr mapping = mMapping.lock();
+    if (mapping) {
+        return mapping;
+    }
 
-    ret = drmIoctl(mDeviceHandle, DRM_IOCTL_VIRTGPU_MAP, &map);
-    if (ret) {
-        ALOGE("DRM_IOCTL_VIRTGPU_MAP failed with %s", strerror(errno));
-        return nullptr;
+    if (!mMapOffset) {
+        struct drm_virtgpu_map map {
+            .handle = mBlobHandle, .pad = 0,
+        };
+
+        int ret = drmIoctl(mDeviceHandle, DRM_IOCTL_VIRTGPU_MAP, &map);
+        if (ret) {
+            ALOGE("DRM_IOCTL_VIRTGPU_MAP failed with %s", strerror(errno));
+            return nullptr;
+        }
+        mMapOffset = map.offset;
     }
 
     uint8_t* ptr = static_cast<uint8_t*>(
-            mmap64(nullptr, mSize, PROT_WRITE | PROT_READ, MAP_SHARED, mDeviceHandle, map.offset));
+            mmap64(nullptr, mSize, PROT_WRITE | PROT_READ, MAP_SHARED, mDeviceHandle, mMapOffset));
 
     if (ptr == MAP_FAILED) {
         ALOGE("mmap64 failed with (%s)", strerror(errno));
         return nullptr;
     }
 
-    return std::make_shared<VirtGpuBlobMapping>(shared_from_this(), ptr, mSize);
+    mapping = std::make_shared<VirtGpuBlobMapping>(shared_from_this(), ptr, mSize);
+    mMapping = mapping;
+    return mapping;
 }
 
 int VirtGpuBlob::exportBlob(struct VirtGpuExternalHandle& handle) {
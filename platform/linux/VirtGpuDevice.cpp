@@ -20,6 +20,7 @@
 #include <xf86drm.h>
 #include <cerrno>
 #include <cstring>
+#include <vector>
 
 #include <cutils/log.h>
 
@@ -209,6 +210,79 @@ int VirtGpuDevice::execBuffer(struct VirtGpuExecBuffer& execbuffer, VirtGpuBlobP
     return 0;
 }
 
+int VirtGpuDevice::execBuffers(struct VirtGpuExecBuffer* execbuffers, uint32_t count) {
+    // Commands are all whole uint32_t's, which keeps the headers of the
+    // ones after the first aligned.
+    constexpr uint32_t kMaxSubmitSize = 4096;
+    const bool merge = mCaps.gfxstreamCapset.multiCommandSubmit != 0;
+    std::vector<uint8_t> commands;
+
+    uint32_t first = 0;
+    while (first < count) {
+        if (execbuffers[first].flags & kFenceIn) {
+            ALOGE("%s: kFenceIn is not supported", __func__);
+            return -EINVAL;
+        }
+
+        const uint32_t ringFlags = execbuffers[first].flags & kRingIdx;
+        uint32_t flags = execbuffers[first].flags;
+        uint32_t size = execbuffers[first].command_size;
+        uint32_t last = first + 1;
+        while (merge && last < count) {
+            const struct VirtGpuExecBuffer& next = execbuffers[last];
+            if ((next.flags & (kFenceIn | kRingIdx)) != ringFlags ||
+                next.ring_idx != execbuffers[first].ring_idx ||
+                size + next.command_size > kMaxSubmitSize) {
+                break;
+            }
+            flags |= next.flags;
+            size += next.command_size;
+            ++last;
+        }
+
+        struct drm_virtgpu_execbuffer exec = {0};
+        exec.flags = flags;
+        exec.ring_idx = execbuffers[first].ring_idx;
+        exec.fence_fd = -1;
+        if (last - first == 1) {
+            exec.size = execbuffers[first].command_size;
+            exec.command = (uint64_t)(uintptr_t)(execbuffers[first].command);
+        } else {
+            commands.resize(size);
+            uint8_t* dst = commands.data();
+            for (uint32_t i = first; i < last; ++i) {
+                memcpy(dst, execbuffers[i].command, execbuffers[i].command_size);
+                dst += execbuffers[i].command_size;
+            }
+            exec.size = size;
+            exec.command = (uint64_t)(uintptr_t)(commands.data());
+        }
+
+        int ret = drmIoctl(mDeviceHandle, DRM_IOCTL_VIRTGPU_EXECBUFFER, &exec);
+        if (ret) {
+            ALOGE("DRM_IOCTL_VIRTGPU_EXECBUFFER failed: %s", strerror(errno));
+            return ret;
+        }
+
+        if (flags & kFenceOut) {
+            // The last command to ask keeps the fence, the others get
+            // duplicates of it.
+            uint32_t owner = last;
+            while (!(execbuffers[--owner].flags & kFenceOut)) {
+            }
+            for (uint32_t i = first; i < last; ++i) {
+                if (!(execbuffers[i].flags & kFenceOut)) continue;
+                execbuffers[i].handle.osHandle = i == owner ? exec.fence_fd : dup(exec.fence_fd);
+                execbuffers[i].handle.type = kFenceHandleSyncFd;
+            }
+        }
+
+        first = last;
+    }
+
+    return 0;
+}
+
 VirtGpuDevice::~VirtGpuDevice() {
     close(mDeviceHandle);
 }
@@ -47,6 +47,10 @@ int VirtGpuDevice::execBuffer(struct VirtGpuExecBuffer& execbuffer, VirtGpuBlobP
     return -1;
 }
 
+int VirtGpuDevice::execBuffers(struct VirtGpuExecBuffer* execbuffers, uint32_t count) {
+    return -1;
+}
+
 VirtGpuDevice::~VirtGpuDevice() {
     // Unimplemented stub
 }
@@ -4,7 +4,9 @@ LOCAL_PATH := $(call my-dir)
 
 $(call emugl-begin-static-library,libGoldfishAddressSpace$(GOLDFISH_OPENGL_LIB_SUFFIX))
 
-LOCAL_SRC_FILES := goldfish_address_space.cpp
+LOCAL_SRC_FILES := \
+    goldfish_address_space.cpp \
+    goldfish_address_space_heap.cpp
 
 LOCAL_CFLAGS += -DLOG_TAG=\"goldfish-address-space\"
 
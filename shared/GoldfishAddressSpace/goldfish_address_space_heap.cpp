@@ -0,0 +1,206 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "goldfish_address_space_heap.h"
+
+#include <algorithm>
+
+namespace {
+
+constexpr uint64_t kChunkSize = 8 * 1024 * 1024;
+// Larger allocations get a block of their own, so that they neither
+// fragment the shared blocks nor keep one alive.
+constexpr uint64_t kMaxSharedAllocation = kChunkSize / 4;
+constexpr uint64_t kAlignment = 256;
+constexpr uint64_t kPageSize = 4096;
+
+uint64_t alignUp(uint64_t v, uint64_t a) { return (v + a - 1) & ~(a - 1); }
+
+size_t clientIndex(GoldfishAddressSpaceHeapClient client) {
+    return static_cast<size_t>(client);
+}
+
+}  // namespace
+
+struct GoldfishAddressSpaceHeap::Chunk {
+    GoldfishAddressSpaceBlock block;
+    // Free ranges by offset, with their sizes. Neighbours are always merged.
+    std::map<uint64_t, uint64_t> freeRanges;
+    uint64_t usedBytes = 0;
+    bool dedicated = false;
+
+    bool take(uint64_t size, uint64_t* offset) {
+        for (auto i = freeRanges.begin(); i != freeRanges.end(); ++i) {
+            if (i->second < size) continue;
+            *offset = i->first;
+            const uint64_t rest = i->second - size;
+            freeRanges.erase(i);
+            if (rest) {
+                freeRanges[*offset + size] = rest;
+            }
+            usedBytes += size;
+            return true;
+        }
+        return false;
+    }
+
+    void give(uint64_t offset, uint64_t size) {
+        usedBytes -= size;
+        auto next = freeRanges.lower_bound(offset);
+        if (next != freeRanges.begin()) {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == offset) {
+                offset = prev->first;
+                size += prev->second;
+                freeRanges.erase(prev);
+            }
+        }
+        if (next != freeRanges.end() && offset + size == next->first) {
+            size += next->second;
+            freeRanges.erase(next);
+        }
+        freeRanges[offset] = size;
+    }
+};
+
+// static
+GoldfishAddressSpaceHeap& GoldfishAddressSpaceHeap::get(bool useSharedSlots) {
+    static GoldfishAddressSpaceHeap* sHeap = new GoldfishAddressSpaceHeap(useSharedSlots);
+    return *sHeap;
+}
+
+GoldfishAddressSpaceHeap::GoldfishAddressSpaceHeap(bool useSharedSlots)
+    : m_allocator(useSharedSlots) {}
+
+bool GoldfishAddressSpaceHeap::allocate(GoldfishAddressSpaceHeapClient client, uint64_t size,
+                                        GoldfishAddressSpaceHeapAllocation* out) {
+    if (!size) {
+        return false;
+    }
+    size = alignUp(size, kAlignment);
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    GoldfishAddressSpaceHeapStats& stats = m_stats[clientIndex(client)];
+    const uint64_t quota = m_quotas[clientIndex(client)];
+    if (quota && stats.bytesInUse + size > quota) {
+        ++stats.quotaFailures;
+        return false;
+    }
+
+    Chunk* chunk = nullptr;
+    uint64_t offset = 0;
+    if (size > kMaxSharedAllocation) {
+        chunk = newChunkLocked(alignUp(size, kPageSize));
+        if (!chunk) {
+            return false;
+        }
+        chunk->dedicated = true;
+        chunk->take(size, &offset);
+    } else {
+        for (const auto& c : m_chunks) {
+            if (!c->dedicated && c->take(size, &offset)) {
+                chunk = c.get();
+                break;
+            }
+        }
+        if (!chunk) {
+            chunk = newChunkLocked(kChunkSize);
+            if (!chunk) {
+                return false;
+            }
+            chunk->take(size, &offset);
+        }
+    }
+
+    out->ptr = static_cast<char*>(chunk->block.guestPtr()) + offset;
+    out->physAddr = chunk->block.physAddr() + offset;
+    out->size = size;
+    out->chunk = chunk;
+    out->chunkOffset = offset;
+    out->client = client;
+
+    stats.bytesInUse += size;
+    stats.peakBytesInUse = std::max(stats.peakBytesInUse, stats.bytesInUse);
+    ++stats.allocations;
+    return true;
+}
+
+void GoldfishAddressSpaceHeap::free(GoldfishAddressSpaceHeapAllocation* allocation) {
+    if (!allocation->chunk) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    Chunk* chunk = static_cast<Chunk*>(allocation->chunk);
+    chunk->give(allocation->chunkOffset, allocation->size);
+    m_stats[clientIndex(allocation->client)].bytesInUse -= allocation->size;
+
+    if (!chunk->usedBytes) {
+        // One empty shared block is kept, so that an allocation going back
+        // and forth over a block boundary does not reserve and release it
+        // each time.
+        const bool keep = !chunk->dedicated &&
+            std::none_of(m_chunks.begin(), m_chunks.end(), [chunk](const std::unique_ptr<Chunk>& c) {
+                return c.get() != chunk && !c->dedicated && !c->usedBytes;
+            });
+        if (!keep) {
+            releaseChunkLocked(chunk);
+        }
+    }
+
+    *allocation = GoldfishAddressSpaceHeapAllocation();
+}
+
+void GoldfishAddressSpaceHeap::setQuota(GoldfishAddressSpaceHeapClient client, uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_quotas[clientIndex(client)] = bytes;
+}
+
+GoldfishAddressSpaceHeapStats GoldfishAddressSpaceHeap::stats(
+        GoldfishAddressSpaceHeapClient client) const {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_stats[clientIndex(client)];
+}
+
+uint64_t GoldfishAddressSpaceHeap::reservedBytes() const {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_reservedBytes;
+}
+
+GoldfishAddressSpaceHeap::Chunk* GoldfishAddressSpaceHeap::newChunkLocked(uint64_t size) {
+    if (!m_allocator.is_opened()) {
+        return nullptr;
+    }
+
+    std::unique_ptr<Chunk> chunk(new Chunk);
+    if (m_allocator.hostMalloc(&chunk->block, size) || !chunk->block.guestPtr()) {
+        return nullptr;
+    }
+    chunk->freeRanges[0] = size;
+    m_reservedBytes += chunk->block.size();
+    m_chunks.push_back(std::move(chunk));
+    return m_chunks.back().get();
+}
+
+void GoldfishAddressSpaceHeap::releaseChunkLocked(Chunk* chunk) {
+    auto i = std::find_if(m_chunks.begin(), m_chunks.end(), [chunk](const std::unique_ptr<Chunk>& c) {
+        return c.get() == chunk;
+    });
+    if (i == m_chunks.end()) {
+        return;
+    }
+    m_reservedBytes -= chunk->block.size();
+    m_allocator.hostFree(&chunk->block);
+    m_chunks.erase(i);
+}
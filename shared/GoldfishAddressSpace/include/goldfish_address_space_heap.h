@@ -0,0 +1,92 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ANDROID_INCLUDE_HARDWARE_GOLDFISH_ADDRESS_SPACE_HEAP_H
+#define ANDROID_INCLUDE_HARDWARE_GOLDFISH_ADDRESS_SPACE_HEAP_H
+
+#include "goldfish_address_space.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// The parts of a process that take memory from the heap, each with its own
+// quota and counters.
+enum class GoldfishAddressSpaceHeapClient {
+    GrallocUploads = 0,
+    Other,
+    Count,
+};
+
+struct GoldfishAddressSpaceHeapAllocation {
+    void* ptr = nullptr;
+    uint64_t physAddr = 0;
+    uint64_t size = 0;
+
+    // Where it came from, for free().
+    void* chunk = nullptr;
+    uint64_t chunkOffset = 0;
+    GoldfishAddressSpaceHeapClient client = GoldfishAddressSpaceHeapClient::Other;
+};
+
+struct GoldfishAddressSpaceHeapStats {
+    uint64_t bytesInUse = 0;
+    uint64_t peakBytesInUse = 0;
+    uint64_t allocations = 0;
+    // Allocations refused because they would have gone over the quota.
+    uint64_t quotaFailures = 0;
+};
+
+// Host memory for process-local use, suballocated out of large blocks from
+// GoldfishAddressSpaceHostMemoryAllocator. Each block costs the allocate,
+// ping and mmap round trips once instead of per allocation, and one VMA.
+// Memory that is shared with other processes by fd and offset cannot come
+// from here, as nothing would tell this process when they are done with it.
+class GoldfishAddressSpaceHeap {
+public:
+    // The first call decides whether the blocks come from shared slots.
+    static GoldfishAddressSpaceHeap& get(bool useSharedSlots);
+
+    // Allocations use a guest physical address the host can read, for
+    // bindDmaDirectly and the like. Returns false if the memory is not
+    // there or would take |client| over its quota.
+    bool allocate(GoldfishAddressSpaceHeapClient client, uint64_t size,
+                  GoldfishAddressSpaceHeapAllocation* out);
+    void free(GoldfishAddressSpaceHeapAllocation* allocation);
+
+    // 0, the default, is no limit.
+    void setQuota(GoldfishAddressSpaceHeapClient client, uint64_t bytes);
+
+    GoldfishAddressSpaceHeapStats stats(GoldfishAddressSpaceHeapClient client) const;
+    // Bytes reserved from the host in blocks, used or not.
+    uint64_t reservedBytes() const;
+
+private:
+    struct Chunk;
+
+    explicit GoldfishAddressSpaceHeap(bool useSharedSlots);
+
+    Chunk* newChunkLocked(uint64_t size);
+    void releaseChunkLocked(Chunk* chunk);
+
+    mutable std::mutex m_lock;
+    GoldfishAddressSpaceHostMemoryAllocator m_allocator;
+    std::vector<std::unique_ptr<Chunk>> m_chunks;
+    uint64_t m_reservedBytes = 0;
+    uint64_t m_quotas[static_cast<size_t>(GoldfishAddressSpaceHeapClient::Count)] = {};
+    GoldfishAddressSpaceHeapStats m_stats[static_cast<size_t>(GoldfishAddressSpaceHeapClient::Count)];
+};
+
+#endif
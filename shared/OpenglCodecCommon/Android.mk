@@ -9,8 +9,16 @@ commonSources := \
         GLESTextureUtils.cpp \
         ChecksumCalculator.cpp \
         GLSharedGroup.cpp \
+        FlushPolicy.cpp \
+        GLStateShadow.cpp \
+        ProgramLinkCache.cpp \
+        TextureContentCache.cpp \
         glUtils.cpp \
+        glUtilsMinMax.cpp \
+        IndexBlockSummary.cpp \
         IndexRangeCache.cpp \
+        CaptureStream.cpp \
+        CompressedStream.cpp \
         SocketStream.cpp \
         TcpStream.cpp \
         auto_goldfish_dma_context.cpp \
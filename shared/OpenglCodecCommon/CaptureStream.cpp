@@ -0,0 +1,198 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "CaptureStream.h"
+
+#include <string.h>
+#include <time.h>
+
+CaptureStream::CaptureStream(IOStream* stream, const char* path, size_t bufSize) :
+    IOStream(bufSize),
+    m_stream(stream),
+    m_file(fopen(path, "wb")),
+    m_startNs(monotonicNs()),
+    m_bufsize(bufSize),
+    m_buf(NULL)
+{
+    if (!m_file) {
+        ERR("%s: can not open %s, not capturing\n", __FUNCTION__, path);
+        return;
+    }
+    const FileHeader header = { kMagic, kVersion };
+    fwrite(&header, sizeof(header), 1, m_file);
+}
+
+CaptureStream::~CaptureStream()
+{
+    if (m_file) {
+        fclose(m_file);
+    }
+    free(m_buf);
+    m_stream->decRef();
+}
+
+void *CaptureStream::allocBuffer(size_t minSize)
+{
+    size_t allocSize = (m_bufsize < minSize ? minSize : m_bufsize);
+    if (!m_buf) {
+        m_buf = (unsigned char *)malloc(allocSize);
+        m_bufsize = allocSize;
+    } else if (m_bufsize < allocSize) {
+        unsigned char *p = (unsigned char *)realloc(m_buf, allocSize);
+        if (p != NULL) {
+            m_buf = p;
+            m_bufsize = allocSize;
+        } else {
+            ERR("%s: realloc (%zu) failed\n", __FUNCTION__, allocSize);
+            free(m_buf);
+            m_buf = NULL;
+            m_bufsize = 0;
+        }
+    }
+
+    m_bufMemory.set(m_buf ? allocSize : 0);
+    return m_buf;
+}
+
+int CaptureStream::commitBuffer(size_t size)
+{
+    return writeFully(m_buf, size);
+}
+
+const unsigned char *CaptureStream::readFully(void *buf, size_t len)
+{
+    const unsigned char* ret = m_stream->readFully(buf, len);
+    if (ret) {
+        record(RECORD_READ, buf, len);
+    }
+    return ret;
+}
+
+const unsigned char *CaptureStream::commitBufferAndReadFully(size_t size, void *buf, size_t len)
+{
+    if (writeFully(m_buf, size) < 0) {
+        return NULL;
+    }
+    return readFully(buf, len);
+}
+
+const unsigned char *CaptureStream::read(void *buf, size_t *inout_len)
+{
+    const unsigned char* ret = m_stream->read(buf, inout_len);
+    if (ret) {
+        record(RECORD_READ, buf, *inout_len);
+    }
+    return ret;
+}
+
+int CaptureStream::writeFully(const void *buf, size_t len)
+{
+    if (!len) return 0;
+    record(RECORD_WRITE, buf, len);
+    return m_stream->writeFully(buf, len);
+}
+
+void CaptureStream::onFrameBoundary()
+{
+    // Keeps what was captured so far if the process gets killed.
+    if (m_file) {
+        fflush(m_file);
+    }
+    m_stream->onFrameBoundary();
+}
+
+void CaptureStream::releaseBuffers()
+{
+    free(m_buf);
+    m_buf = NULL;
+    m_bufsize = initialBufferSize();
+    m_bufMemory.set(0);
+    m_stream->trim();
+}
+
+void CaptureStream::record(RecordType type, const void* buf, size_t len)
+{
+    if (!m_file) return;
+
+    const RecordHeader header = { type, (uint32_t)len, monotonicNs() - m_startNs };
+    if (fwrite(&header, sizeof(header), 1, m_file) != 1 ||
+        fwrite(buf, 1, len, m_file) != len) {
+        ERR("%s: write failed, capture stopped\n", __FUNCTION__);
+        fclose(m_file);
+        m_file = NULL;
+    }
+}
+
+// static
+int CaptureStream::replay(const char* path, IOStream* stream, bool realTime)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        ERR("%s: can not open %s\n", __FUNCTION__, path);
+        return -1;
+    }
+
+    FileHeader fileHeader;
+    if (fread(&fileHeader, sizeof(fileHeader), 1, file) != 1 ||
+        fileHeader.magic != kMagic || fileHeader.version != kVersion) {
+        ERR("%s: %s is not a capture\n", __FUNCTION__, path);
+        fclose(file);
+        return -1;
+    }
+
+    std::vector<unsigned char> payload;
+    std::vector<unsigned char> answer;
+    const uint64_t startNs = monotonicNs();
+    int mismatches = 0;
+
+    RecordHeader header;
+    while (fread(&header, sizeof(header), 1, file) == 1) {
+        payload.resize(header.size);
+        if (fread(payload.data(), 1, header.size, file) != header.size) {
+            ERR("%s: %s is truncated\n", __FUNCTION__, path);
+            mismatches = -1;
+            break;
+        }
+
+        if (realTime) {
+            const uint64_t elapsedNs = monotonicNs() - startNs;
+            if (elapsedNs < header.timestampNs) {
+                const uint64_t waitNs = header.timestampNs - elapsedNs;
+                struct timespec ts = { (time_t)(waitNs / 1000000000ULL),
+                                       (long)(waitNs % 1000000000ULL) };
+                nanosleep(&ts, NULL);
+            }
+        }
+
+        if (header.type == RECORD_WRITE) {
+            if (stream->writeFully(payload.data(), header.size) < 0) {
+                mismatches = -1;
+                break;
+            }
+        } else if (header.type == RECORD_READ) {
+            answer.resize(header.size);
+            if (!stream->readFully(answer.data(), header.size)) {
+                mismatches = -1;
+                break;
+            }
+            if (memcmp(answer.data(), payload.data(), header.size)) {
+                ++mismatches;
+            }
+        }
+    }
+
+    fclose(file);
+    return mismatches;
+}
@@ -0,0 +1,99 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef __CAPTURE_STREAM_H
+#define __CAPTURE_STREAM_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "IOStream.h"
+#include "aemu/base/MemoryAccounting.h"
+
+// Passes everything through to another stream and records it to a file,
+// so that a real workload can be replayed later without the app. The file
+// starts with a FileHeader and holds one record per transport call:
+//
+//   RecordHeader header;
+//   uint8_t      payload[header.size];
+//
+// Writes are recorded as they leave for the transport, one record per
+// commit, and reads with the bytes the host answered. All fields are in
+// host byte order.
+class CaptureStream : public IOStream {
+public:
+    static constexpr uint32_t kMagic = 0x50414347;  // "GCAP"
+    static constexpr uint32_t kVersion = 1;
+
+    enum RecordType : uint32_t {
+        RECORD_WRITE = 1,
+        RECORD_READ = 2,
+    };
+
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+    };
+
+    struct RecordHeader {
+        uint32_t type;
+        uint32_t size;
+        // Since the stream was created.
+        uint64_t timestampNs;
+    };
+
+    // Takes over the caller's reference to |stream|. Records nothing if
+    // |path| can not be opened.
+    CaptureStream(IOStream* stream, const char* path, size_t bufSize = 10000);
+    virtual ~CaptureStream();
+
+    virtual void *allocBuffer(size_t minSize);
+    virtual int commitBuffer(size_t size);
+    virtual const unsigned char *readFully(void *buf, size_t len);
+    virtual const unsigned char *commitBufferAndReadFully(size_t size, void *buf, size_t len);
+    virtual const unsigned char *read(void *buf, size_t *inout_len);
+    virtual int writeFully(const void *buf, size_t len);
+    virtual void onFrameBoundary();
+    virtual size_t hostQueuedBytes() { return m_stream->hostQueuedBytes(); }
+
+    bool isCapturing() const { return m_file != NULL; }
+
+    // Sends the writes of the capture at |path| to |stream| and reads back
+    // as many bytes as the host answered when it was recorded. With
+    // |realTime| the original spacing between records is kept, otherwise
+    // records go out as fast as |stream| takes them. Returns the number of
+    // reads whose answer differs from the recorded one, or -1 if the
+    // capture can not be read or the transport fails.
+    static int replay(const char* path, IOStream* stream, bool realTime);
+
+protected:
+    virtual void releaseBuffers() override;
+
+private:
+    void record(RecordType type, const void* buf, size_t len);
+
+    IOStream* m_stream;
+    FILE* m_file;
+    const uint64_t m_startNs;
+    size_t m_bufsize;
+    unsigned char* m_buf;
+    android::base::guest::AccountedMemory m_bufMemory{
+        android::base::guest::GraphicsMemory::kStreamBuffers};
+};
+
+#endif /* __CAPTURE_STREAM_H */
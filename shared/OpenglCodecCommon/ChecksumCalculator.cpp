@@ -18,6 +18,16 @@
 
 #include <string.h>
 
+#if defined(__i386__) || defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__linux__)
+#include <arm_acle.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
 // Checklist when implementing new protocol:
 // 1. update CHECKSUMHELPER_MAX_VERSION
 // 2. update ChecksumCalculator::Sizes enum
@@ -25,7 +35,7 @@
 // 4. update addBuffer, writeChecksum, resetChecksum, validate
 
 // change CHECKSUMHELPER_MAX_VERSION when you want to update the protocol version
-#define CHECKSUMHELPER_MAX_VERSION 1
+#define CHECKSUMHELPER_MAX_VERSION 2
 
 // utility macros to create checksum string at compilation time
 #define CHECKSUMHELPER_VERSION_STR_PREFIX "ANDROID_EMU_CHECKSUM_HELPER_v"
@@ -41,6 +51,90 @@ static const char* kMaxVersionStr = CHECKSUMHELPER_VERSION_STR_PREFIX CHECKSUMHE
 #undef CHECKSUMHELPER_MACRO_TO_STR
 #undef CHECKSUMHELPER_MACRO_VAL_TO_STR
 
+namespace {
+
+// CRC32C (Castagnoli), the polynomial implemented by the SSE4.2 and ARMv8
+// CRC32C instructions.
+constexpr uint32_t kCrc32cPoly = 0x82f63b78;
+
+using Crc32cFn = uint32_t (*)(uint32_t crc, const uint8_t* data, size_t len);
+
+uint32_t crc32cPortable(uint32_t crc, const uint8_t* data, size_t len) {
+    static const struct Table {
+        Table() {
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k) {
+                    c = (c >> 1) ^ (kCrc32cPoly & (0 - (c & 1)));
+                }
+                entries[i] = c;
+            }
+        }
+        uint32_t entries[256];
+    } sTable;
+
+    while (len--) {
+        crc = sTable.entries[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if defined(__i386__) || defined(__x86_64__)
+__attribute__((target("sse4.2")))
+uint32_t crc32cSse42(uint32_t crc, const uint8_t* data, size_t len) {
+#if defined(__x86_64__)
+    uint64_t crc64 = crc;
+    for (; len >= 8; data += 8, len -= 8) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = static_cast<uint32_t>(crc64);
+#endif
+    for (; len >= 4; data += 4, len -= 4) {
+        uint32_t word;
+        memcpy(&word, data, sizeof(word));
+        crc = _mm_crc32_u32(crc, word);
+    }
+    while (len--) {
+        crc = _mm_crc32_u8(crc, *data++);
+    }
+    return crc;
+}
+#endif
+
+#if defined(__aarch64__) && defined(__linux__)
+__attribute__((target("crc")))
+uint32_t crc32cArmv8(uint32_t crc, const uint8_t* data, size_t len) {
+    for (; len >= 8; data += 8, len -= 8) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+    }
+    while (len--) {
+        crc = __crc32cb(crc, *data++);
+    }
+    return crc;
+}
+#endif
+
+Crc32cFn bestCrc32c() {
+#if defined(__i386__) || defined(__x86_64__)
+    if (__builtin_cpu_supports("sse4.2")) return crc32cSse42;
+#endif
+#if defined(__aarch64__) && defined(__linux__)
+    if (getauxval(AT_HWCAP) & HWCAP_CRC32) return crc32cArmv8;
+#endif
+    return crc32cPortable;
+}
+
+uint32_t crc32c(uint32_t crc, const void* data, size_t len) {
+    static const Crc32cFn sCrc32c = bestCrc32c();
+    return sCrc32c(crc, static_cast<const uint8_t*>(data), len);
+}
+
+}  // namespace
+
 uint32_t ChecksumCalculator::getMaxVersion() {return kMaxVersion;}
 const char* ChecksumCalculator::getMaxVersionStr() {return kMaxVersionStr;}
 const char* ChecksumCalculator::getMaxVersionStrPrefix() {return kMaxVersionStrPrefix;}
@@ -67,6 +161,7 @@ size_t ChecksumCalculator::checksumByteSize() const {
         case 0:
             return 0;
         case 1:
+        case 2:
             return sizeof(uint32_t) + sizeof(m_numWrite);
         default:
             return 0;
@@ -79,15 +174,19 @@ ChecksumCalculator::ChecksumCalculator()
                 , m_numWrite(0)
                 , m_isEncodingChecksum(false)
                 , m_v1BufferTotalLength(0)
+                , m_v2Crc(~0u)
 {
 }
 
-void ChecksumCalculator::addBuffer(const void*, size_t packetLen) {
+void ChecksumCalculator::addBuffer(const void* buf, size_t packetLen) {
     m_isEncodingChecksum = true;
     switch (m_version) {
         case 1:
             m_v1BufferTotalLength += packetLen;
             break;
+        case 2:
+            m_v2Crc = crc32c(m_v2Crc, buf, packetLen);
+            break;
     }
 }
 
@@ -101,6 +200,12 @@ bool ChecksumCalculator::writeChecksum(void* outputChecksum, size_t outputChecks
             memcpy(checksumPtr+sizeof(val), &m_numWrite, sizeof(m_numWrite));
             break;
         }
+        case 2: { // protocol v2 is the CRC32C of the packet followed by the counter
+            uint32_t val = ~m_v2Crc;
+            memcpy(checksumPtr, &val, sizeof(val));
+            memcpy(checksumPtr+sizeof(val), &m_numWrite, sizeof(m_numWrite));
+            break;
+        }
     }
     resetChecksum();
     m_numWrite++;
@@ -112,6 +217,9 @@ void ChecksumCalculator::resetChecksum() {
         case 1:
             m_v1BufferTotalLength = 0;
             break;
+        case 2:
+            m_v2Crc = ~0u;
+            break;
     }
     m_isEncodingChecksum = false;
 }
@@ -125,8 +233,9 @@ bool ChecksumCalculator::validate(const void* expectedChecksum, size_t expectedC
     }
     bool isValid;
     switch (m_version) {
-        case 1: {
-            const uint32_t val = computeV1Checksum();
+        case 1:
+        case 2: {
+            const uint32_t val = m_version == 1 ? computeV1Checksum() : ~m_v2Crc;
             isValid = 0 == memcmp(&val, expectedChecksum, sizeof(val)) &&
                       0 == memcmp(&m_numRead,
                                   static_cast<const char*>(expectedChecksum) +
@@ -125,6 +125,7 @@ class ChecksumCalculator {
 public:
     enum Sizes {
         kVersion1ChecksumSize = 8,
+        kVersion2ChecksumSize = 8,
         kMaxChecksumSize = kVersion1ChecksumSize
     };
 
@@ -184,4 +185,8 @@ private:
     uint32_t computeV1Checksum();
     // The buffer used in protocol version 1 to compute checksum.
     uint32_t m_v1BufferTotalLength;
+    // Running CRC32C of the buffers added since the last checksum, used in
+    // protocol v2. Computed with the SSE4.2 or ARMv8 CRC32 instructions when
+    // the CPU has them.
+    uint32_t m_v2Crc;
 };
@@ -0,0 +1,254 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "CompressedStream.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr size_t kFrameHeaderSize = 8;
+// Below this a frame is not worth compressing.
+constexpr size_t kMinCompressSize = 64;
+
+// LZ4 block format limits: a block ends with at least 5 literals and the
+// last match starts no later than 12 bytes before the end.
+constexpr size_t kMinMatch = 4;
+constexpr size_t kLastLiterals = 5;
+constexpr size_t kMatchFindLimit = 12;
+constexpr size_t kMaxOffset = 65535;
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t hash32(uint32_t v) {
+    return (v * 2654435761u) >> (32 - CompressedStream::kLz4HashLog);
+}
+
+inline uint8_t* writeLength(uint8_t* op, size_t len) {
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = (uint8_t)len;
+    return op;
+}
+
+inline uint8_t* writeLiterals(uint8_t* op, uint8_t* token,
+                              const uint8_t* literals, size_t len) {
+    if (len >= 15) {
+        *token = 15 << 4;
+        op = writeLength(op, len - 15);
+    } else {
+        *token = (uint8_t)(len << 4);
+    }
+    memcpy(op, literals, len);
+    return op + len;
+}
+
+inline void writeLE32(uint8_t* p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+}  // namespace
+
+// static
+size_t CompressedStream::lz4Compress(const uint8_t* src, size_t size, uint8_t* dst,
+                                     uint32_t* hashTable) {
+    const uint8_t* const end = src + size;
+    const uint8_t* anchor = src;
+    uint8_t* op = dst;
+
+    if (size > kMatchFindLimit) {
+        const uint8_t* const matchLimit = end - kLastLiterals;
+        const uint8_t* const findLimit = end - kMatchFindLimit;
+        const uint8_t* ip = src;
+        // Stride through incompressible data faster the longer it lasts.
+        uint32_t misses = 0;
+
+        while (ip < findLimit) {
+            const uint32_t seq = read32(ip);
+            const uint32_t h = hash32(seq);
+            // Entries left over from earlier blocks are harmless: they are
+            // only used if they point backwards and the bytes match.
+            const uint8_t* ref = src + hashTable[h];
+            hashTable[h] = (uint32_t)(ip - src);
+
+            if (ref >= ip || (size_t)(ip - ref) > kMaxOffset || read32(ref) != seq) {
+                ip += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+                --ip;
+                --ref;
+            }
+            size_t matchLen = kMinMatch;
+            while (ip + matchLen < matchLimit && ip[matchLen] == ref[matchLen]) {
+                ++matchLen;
+            }
+
+            uint8_t* token = op++;
+            op = writeLiterals(op, token, anchor, ip - anchor);
+            const size_t offset = ip - ref;
+            *op++ = (uint8_t)offset;
+            *op++ = (uint8_t)(offset >> 8);
+            if (matchLen - kMinMatch >= 15) {
+                *token |= 15;
+                op = writeLength(op, matchLen - kMinMatch - 15);
+            } else {
+                *token |= (uint8_t)(matchLen - kMinMatch);
+            }
+
+            ip += matchLen;
+            anchor = ip;
+        }
+    }
+
+    uint8_t* token = op++;
+    op = writeLiterals(op, token, anchor, end - anchor);
+    return op - dst;
+}
+
+CompressedStream::CompressedStream(IOStream* stream, Codec codec, size_t bufSize) :
+    IOStream(bufSize),
+    m_stream(stream),
+    m_codec(codec),
+    m_bufsize(bufSize),
+    m_buf(NULL),
+    m_hashTable(kLz4HashSize, 0),
+    m_rawBytes(0),
+    m_sentBytes(0)
+{
+}
+
+CompressedStream::~CompressedStream()
+{
+    free(m_buf);
+    m_stream->decRef();
+}
+
+void *CompressedStream::allocBuffer(size_t minSize)
+{
+    size_t allocSize = (m_bufsize < minSize ? minSize : m_bufsize);
+    if (!m_buf) {
+        m_buf = (unsigned char *)malloc(allocSize);
+        m_bufsize = allocSize;
+    } else if (m_bufsize < allocSize) {
+        unsigned char *p = (unsigned char *)realloc(m_buf, allocSize);
+        if (p != NULL) {
+            m_buf = p;
+            m_bufsize = allocSize;
+        } else {
+            ERR("%s: realloc (%zu) failed\n", __FUNCTION__, allocSize);
+            free(m_buf);
+            m_buf = NULL;
+            m_bufsize = 0;
+        }
+    }
+
+    m_bufMemory.set(m_buf ? allocSize : 0);
+    return m_buf;
+}
+
+int CompressedStream::commitBuffer(size_t size)
+{
+    return writeFrame(m_buf, size);
+}
+
+const unsigned char *CompressedStream::readFully(void *buf, size_t len)
+{
+    return m_stream->readFully(buf, len);
+}
+
+const unsigned char *CompressedStream::commitBufferAndReadFully(size_t size, void *buf, size_t len)
+{
+    if (writeFrame(m_buf, size) < 0) {
+        return NULL;
+    }
+    return m_stream->readFully(buf, len);
+}
+
+const unsigned char *CompressedStream::read(void *buf, size_t *inout_len)
+{
+    return m_stream->read(buf, inout_len);
+}
+
+int CompressedStream::writeFully(const void *buf, size_t len)
+{
+    return writeFrame(buf, len);
+}
+
+void CompressedStream::releaseBuffers()
+{
+    free(m_buf);
+    m_buf = NULL;
+    m_bufsize = initialBufferSize();
+    m_bufMemory.set(0);
+    std::vector<uint8_t>().swap(m_frame);
+    m_frameMemory.set(0);
+    m_stream->trim();
+}
+
+void CompressedStream::onFrameBoundary()
+{
+    m_stream->onFrameBoundary();
+}
+
+int CompressedStream::writeFrame(const void* buf, size_t len)
+{
+    if (!len) return 0;
+
+    // The frame buffer and hash table are kept from one frame to the
+    // next, so steady state commits do not allocate.
+    const size_t bound = kFrameHeaderSize + lz4Bound(len);
+    if (m_frame.size() < bound) {
+        m_frame.resize(bound);
+        m_frameMemory.set(m_frame.size());
+    }
+    uint8_t* frame = m_frame.data();
+
+    size_t compressedSize = 0;
+    if (m_codec == CODEC_LZ4 && len >= kMinCompressSize) {
+        compressedSize = lz4Compress((const uint8_t*)buf, len,
+                                     frame + kFrameHeaderSize, m_hashTable.data());
+        if (compressedSize >= len) {
+            compressedSize = 0;
+        }
+    }
+
+    writeLE32(frame, (uint32_t)compressedSize);
+    writeLE32(frame + 4, (uint32_t)len);
+    m_rawBytes += len;
+
+    if (compressedSize) {
+        m_sentBytes += kFrameHeaderSize + compressedSize;
+        return m_stream->writeFully(frame, kFrameHeaderSize + compressedSize);
+    }
+
+    m_sentBytes += kFrameHeaderSize + len;
+    struct iovec iov[2] = {
+        { frame, kFrameHeaderSize },
+        { const_cast<void*>(buf), len },
+    };
+    return m_stream->commitBufferAndWritevFully(0, iov, 2);
+}
@@ -0,0 +1,88 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef __COMPRESSED_STREAM_H
+#define __COMPRESSED_STREAM_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "IOStream.h"
+#include "aemu/base/MemoryAccounting.h"
+
+// Compresses everything written to another stream; reads pass through
+// untouched. Each commit goes out as one frame:
+//
+//   uint32_t compressedSize;  // 0 if the payload is stored as is
+//   uint32_t rawSize;
+//   uint8_t  payload[compressedSize ? compressedSize : rawSize];
+//
+// where a compressed payload is a single LZ4 block. The host has to be
+// told to expect frames (rcSelectStreamCompression) before the first one.
+class CompressedStream : public IOStream {
+public:
+    enum Codec {
+        CODEC_NONE = 0,
+        CODEC_LZ4 = 1,
+    };
+
+    // Takes over the caller's reference to |stream|.
+    CompressedStream(IOStream* stream, Codec codec, size_t bufSize = 10000);
+    virtual ~CompressedStream();
+
+    virtual void *allocBuffer(size_t minSize);
+    virtual int commitBuffer(size_t size);
+    virtual const unsigned char *readFully(void *buf, size_t len);
+    virtual const unsigned char *commitBufferAndReadFully(size_t size, void *buf, size_t len);
+    virtual const unsigned char *read(void *buf, size_t *inout_len);
+    virtual int writeFully(const void *buf, size_t len);
+    virtual void onFrameBoundary();
+
+    uint64_t rawBytes() const { return m_rawBytes; }
+    uint64_t sentBytes() const { return m_sentBytes; }
+
+    // Compresses |size| bytes of |src| into |dst|, which must hold at
+    // least lz4Bound(size) bytes, and returns the compressed size.
+    // |hashTable| holds kLz4HashSize entries and may be reused across
+    // calls without being cleared.
+    static constexpr int kLz4HashLog = 12;
+    static constexpr size_t kLz4HashSize = 1 << kLz4HashLog;
+    static size_t lz4Bound(size_t size) { return size + size / 255 + 16; }
+    static size_t lz4Compress(const uint8_t* src, size_t size, uint8_t* dst,
+                              uint32_t* hashTable);
+
+protected:
+    virtual void releaseBuffers() override;
+
+private:
+    int writeFrame(const void* buf, size_t len);
+
+    IOStream* m_stream;
+    const Codec m_codec;
+    size_t m_bufsize;
+    unsigned char* m_buf;
+    android::base::guest::AccountedMemory m_bufMemory{
+        android::base::guest::GraphicsMemory::kStreamBuffers};
+    android::base::guest::AccountedMemory m_frameMemory{
+        android::base::guest::GraphicsMemory::kStreamBuffers};
+    std::vector<uint8_t> m_frame;
+    std::vector<uint32_t> m_hashTable;
+    uint64_t m_rawBytes;
+    uint64_t m_sentBytes;
+};
+
+#endif /* __COMPRESSED_STREAM_H */
@@ -69,4 +69,337 @@ void encoderLog(const char* format, ...) {
 #else
     (void)format;
 #endif
-}
\ No newline at end of file
+}
+#if defined(ENABLE_ENCODER_PROFILING)
+
+#include <cutils/properties.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Enough for every entry point of the GLES, renderControl and Vulkan
+// encoders together.
+constexpr int kMaxSites = 2048;
+
+// Check for a dump request once every this many calls on a thread.
+constexpr uint32_t kDumpCheckInterval = 4096;
+
+constexpr char kDumpProperty[] = "debug.gfxstream.encoder.profile_dump";
+
+// Readbacks outside of any encoder call, e.g. from ResourceTracker, are
+// charged to this site.
+constexpr int kNoSite = 0;
+
+// Readback latencies are kept in half octave buckets: bucket 2n holds
+// [2^n, 1.5 * 2^n) ns and bucket 2n + 1 holds [1.5 * 2^n, 2^(n + 1)) ns.
+// The last bucket takes everything from about 4 seconds up.
+constexpr int kLatencyBuckets = 64;
+
+uint64_t encoderProfileNowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000ULL + uint64_t(ts.tv_nsec);
+}
+
+// Only the owning thread writes these, so relaxed atomics are enough to let
+// the dumping thread read them without locking the encoder.
+struct SiteStats {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> waitingCalls{0};
+    std::atomic<uint64_t> waitingNs{0};
+};
+
+struct SiteTotals {
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+    uint64_t waitingCalls = 0;
+    uint64_t waitingNs = 0;
+};
+
+int latencyBucket(uint64_t ns) {
+    if (ns < 2) return 0;
+    int log2 = 63 - __builtin_clzll(ns);
+    int bucket = 2 * log2 + int((ns >> (log2 - 1)) & 1);
+    return bucket < kLatencyBuckets ? bucket : kLatencyBuckets - 1;
+}
+
+uint64_t latencyBucketUpperNs(int bucket) {
+    uint64_t base = 1ULL << (bucket / 2);
+    return bucket % 2 ? 2 * base : base + base / 2;
+}
+
+// Written by the owning thread only, like SiteStats. Allocated on the first
+// readback of a site so that sites that never wait cost nothing.
+struct ReadbackHistogram {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalNs{0};
+    std::atomic<uint64_t> buckets[kLatencyBuckets] = {};
+};
+
+struct ReadbackTotals {
+    uint64_t count = 0;
+    uint64_t totalNs = 0;
+    uint64_t buckets[kLatencyBuckets] = {};
+
+    // Upper bound of the bucket holding the |percent|th percentile.
+    uint64_t percentileNs(int percent) const {
+        uint64_t rank = (count * percent + 99) / 100;
+        uint64_t seen = 0;
+        for (int i = 0; i < kLatencyBuckets; ++i) {
+            seen += buckets[i];
+            if (seen >= rank) return latencyBucketUpperNs(i);
+        }
+        return latencyBucketUpperNs(kLatencyBuckets - 1);
+    }
+};
+
+void addReadbacks(ReadbackTotals* totals, const ReadbackHistogram& histogram) {
+    totals->count += histogram.count.load(std::memory_order_relaxed);
+    totals->totalNs += histogram.totalNs.load(std::memory_order_relaxed);
+    for (int i = 0; i < kLatencyBuckets; ++i) {
+        totals->buckets[i] += histogram.buckets[i].load(std::memory_order_relaxed);
+    }
+}
+
+void increment(std::atomic<uint64_t>& counter, uint64_t delta) {
+    counter.store(counter.load(std::memory_order_relaxed) + delta,
+                  std::memory_order_relaxed);
+}
+
+struct ThreadStats;
+
+struct Registry {
+    Registry() { siteNames.push_back("(outside encoder calls)"); }
+
+    std::mutex lock;
+    std::vector<const char*> siteNames;
+    std::vector<ThreadStats*> threads;
+    // Counts of threads that have exited.
+    SiteTotals exited[kMaxSites];
+    std::unordered_map<int, ReadbackTotals> exitedReadbacks;
+};
+
+Registry& registry() {
+    // Leaked so that threads exiting during process teardown can still fold
+    // their counts in.
+    static Registry* sRegistry = []() {
+        atexit(encoderProfileDumpReadbacks);
+        return new Registry();
+    }();
+    return *sRegistry;
+}
+
+void addSite(SiteTotals* totals, const SiteStats& site) {
+    totals->calls += site.calls.load(std::memory_order_relaxed);
+    totals->bytes += site.bytes.load(std::memory_order_relaxed);
+    totals->waitingCalls += site.waitingCalls.load(std::memory_order_relaxed);
+    totals->waitingNs += site.waitingNs.load(std::memory_order_relaxed);
+}
+
+struct ThreadStats {
+    ThreadStats() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        r.threads.push_back(this);
+    }
+
+    ~ThreadStats() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> guard(r.lock);
+        for (int i = 0; i < kMaxSites; ++i) {
+            addSite(&r.exited[i], sites[i]);
+            if (ReadbackHistogram* histogram = readbacks[i].load(std::memory_order_relaxed)) {
+                addReadbacks(&r.exitedReadbacks[i], *histogram);
+                delete histogram;
+            }
+        }
+        r.threads.erase(std::remove(r.threads.begin(), r.threads.end(), this),
+                        r.threads.end());
+    }
+
+    void record(int site, uint64_t bytes, uint64_t waitingNs, bool waited) {
+        SiteStats& s = sites[site];
+        increment(s.calls, 1);
+        increment(s.bytes, bytes);
+        if (waited) {
+            increment(s.waitingCalls, 1);
+            increment(s.waitingNs, waitingNs);
+        }
+    }
+
+    void recordReadback(uint64_t ns) {
+        ReadbackHistogram* histogram = readbacks[currentSite].load(std::memory_order_relaxed);
+        if (!histogram) {
+            histogram = new ReadbackHistogram();
+            readbacks[currentSite].store(histogram, std::memory_order_release);
+        }
+        increment(histogram->count, 1);
+        increment(histogram->totalNs, ns);
+        increment(histogram->buckets[latencyBucket(ns)], 1);
+    }
+
+    SiteStats sites[kMaxSites];
+    std::atomic<ReadbackHistogram*> readbacks[kMaxSites] = {};
+    // The outermost encoder call on this thread.
+    int currentSite = kNoSite;
+    uint32_t depth = 0;
+    uint32_t callsUntilDumpCheck = kDumpCheckInterval;
+};
+
+ThreadStats& threadStats() {
+    static thread_local ThreadStats sStats;
+    return sStats;
+}
+
+void checkForDumpRequest() {
+    static std::mutex sLastRequestLock;
+    static char sLastRequest[PROPERTY_VALUE_MAX] = "";
+
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get(kDumpProperty, value, "");
+    {
+        std::lock_guard<std::mutex> guard(sLastRequestLock);
+        if (!strcmp(value, sLastRequest)) {
+            return;
+        }
+        snprintf(sLastRequest, sizeof(sLastRequest), "%s", value);
+    }
+    encoderProfileDump();
+    encoderProfileDumpReadbacks();
+}
+
+}  // namespace
+
+EncoderProfileThreadTotals* encoderProfileThreadTotals() {
+    static thread_local EncoderProfileThreadTotals sTotals;
+    return &sTotals;
+}
+
+void encoderProfileReadback(uint64_t ns) {
+    ++encoderProfileThreadTotals()->readbacks;
+    threadStats().recordReadback(ns);
+}
+
+int encoderProfileRegisterSite(const char* name) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> guard(r.lock);
+    if (r.siteNames.size() == kMaxSites) {
+        __android_log_print(ANDROID_LOG_WARN, "gfxstream",
+                            "Too many encoder entry points, not profiling %s", name);
+        return kMaxSites - 1;
+    }
+    r.siteNames.push_back(name);
+    return int(r.siteNames.size()) - 1;
+}
+
+EncoderProfileScope::EncoderProfileScope(int site)
+    : mSite(site) {
+    ThreadStats& stats = threadStats();
+    mOutermost = stats.depth++ == 0;
+    if (!mOutermost) return;
+    stats.currentSite = site;
+
+    EncoderProfileThreadTotals* totals = encoderProfileThreadTotals();
+    mStartNs = encoderProfileNowNs();
+    mStartBytes = totals->bytes;
+    mStartReadbacks = totals->readbacks;
+}
+
+EncoderProfileScope::~EncoderProfileScope() {
+    ThreadStats& stats = threadStats();
+    --stats.depth;
+    if (!mOutermost) return;
+    stats.currentSite = kNoSite;
+
+    EncoderProfileThreadTotals* totals = encoderProfileThreadTotals();
+    bool waited = totals->readbacks != mStartReadbacks;
+    stats.record(mSite, totals->bytes - mStartBytes,
+                 waited ? encoderProfileNowNs() - mStartNs : 0, waited);
+
+    if (--stats.callsUntilDumpCheck == 0) {
+        stats.callsUntilDumpCheck = kDumpCheckInterval;
+        checkForDumpRequest();
+    }
+}
+
+void encoderProfileDump() {
+    Registry& r = registry();
+    std::vector<std::pair<const char*, SiteTotals>> sites;
+    {
+        std::lock_guard<std::mutex> guard(r.lock);
+        for (size_t i = 0; i < r.siteNames.size(); ++i) {
+            SiteTotals totals = r.exited[i];
+            for (ThreadStats* thread : r.threads) {
+                addSite(&totals, thread->sites[i]);
+            }
+            if (totals.calls) {
+                sites.emplace_back(r.siteNames[i], totals);
+            }
+        }
+    }
+
+    std::sort(sites.begin(), sites.end(), [](const auto& a, const auto& b) {
+        return a.second.bytes > b.second.bytes;
+    });
+
+    __android_log_print(ANDROID_LOG_INFO, "gfxstream",
+                        "Encoder profile: name calls bytes waiting_calls waiting_ms");
+    for (const auto& site : sites) {
+        __android_log_print(ANDROID_LOG_INFO, "gfxstream",
+                            "%s %" PRIu64 " %" PRIu64 " %" PRIu64 " %.3f", site.first,
+                            site.second.calls, site.second.bytes, site.second.waitingCalls,
+                            site.second.waitingNs / 1e6);
+    }
+}
+
+void encoderProfileDumpReadbacks() {
+    Registry& r = registry();
+    std::vector<std::pair<const char*, ReadbackTotals>> sites;
+    {
+        std::lock_guard<std::mutex> guard(r.lock);
+        for (size_t i = 0; i < r.siteNames.size(); ++i) {
+            ReadbackTotals totals;
+            auto exited = r.exitedReadbacks.find(int(i));
+            if (exited != r.exitedReadbacks.end()) {
+                totals = exited->second;
+            }
+            for (ThreadStats* thread : r.threads) {
+                ReadbackHistogram* histogram =
+                    thread->readbacks[i].load(std::memory_order_acquire);
+                if (histogram) {
+                    addReadbacks(&totals, *histogram);
+                }
+            }
+            if (totals.count) {
+                sites.emplace_back(r.siteNames[i], totals);
+            }
+        }
+    }
+    if (sites.empty()) return;
+
+    std::sort(sites.begin(), sites.end(), [](const auto& a, const auto& b) {
+        return a.second.totalNs > b.second.totalNs;
+    });
+
+    __android_log_print(ANDROID_LOG_INFO, "gfxstream",
+                        "Encoder readbacks: name count total_ms p50_us p99_us");
+    for (const auto& site : sites) {
+        __android_log_print(ANDROID_LOG_INFO, "gfxstream",
+                            "%s %" PRIu64 " %.3f %.1f %.1f", site.first,
+                            site.second.count, site.second.totalNs / 1e6,
+                            site.second.percentileNs(50) / 1e3,
+                            site.second.percentileNs(99) / 1e3);
+    }
+}
+
+#endif  // ENABLE_ENCODER_PROFILING
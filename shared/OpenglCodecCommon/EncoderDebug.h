@@ -16,15 +16,85 @@
 
 #pragma once
 
+#include "aemu/base/FlightRecorder.h"
+
 void encoderLog(const char* format, ...);
 
 // Uncomment to log function calls with arguments:
 // #define ENABLE_ENCODER_DEBUG_LOGGING_FOR_ALL_APPS 1
 // #define ENABLE_ENCODER_DEBUG_LOGGING_FOR_APP "com.android.systemui"
 
+// Every entry point goes into the flight recorder of its thread, see
+// aemu/base/FlightRecorder.h.
+#define ENCODER_FLIGHT_RECORD() \
+    ::android::base::flightRecord(::android::base::FlightEvent::Call, __func__, 0)
+
 #if defined(ENABLE_ENCODER_DEBUG_LOGGING_FOR_ALL_APPS) || \
     defined(ENABLE_ENCODER_DEBUG_LOGGING_FOR_APP)
-#define ENCODER_DEBUG_LOG(...) encoderLog(__VA_ARGS__)
+#define ENCODER_DEBUG_LOG_CALL(...) encoderLog(__VA_ARGS__)
+#else
+#define ENCODER_DEBUG_LOG_CALL(...) ((void)0)
+#endif
+
+// Uncomment to count calls, encoded bytes and host wait time per encoder
+// entry point, and the latency of each blocking read. Counts are dumped to logcat whenever the value of
+// debug.gfxstream.encoder.profile_dump changes, e.g. with
+//   adb shell setprop debug.gfxstream.encoder.profile_dump $RANDOM
+// #define ENABLE_ENCODER_PROFILING 1
+
+#if defined(ENABLE_ENCODER_PROFILING)
+
+#include <stdint.h>
+
+// Running totals of the stream traffic of the calling thread, kept by
+// IOStream.
+struct EncoderProfileThreadTotals {
+    uint64_t bytes = 0;
+    uint64_t readbacks = 0;
+};
+
+EncoderProfileThreadTotals* encoderProfileThreadTotals();
+
+// Charges a blocking read from the host that took |ns| to the encoder call
+// the calling thread is in.
+void encoderProfileReadback(uint64_t ns);
+
+// Returns a stable index for the entry point |name|.
+int encoderProfileRegisterSite(const char* name);
+
+// Records one call of an entry point, from construction to destruction.
+// Calls made from inside another instrumented call are left to the
+// outermost one.
+class EncoderProfileScope {
+public:
+    explicit EncoderProfileScope(int site);
+    ~EncoderProfileScope();
+
+private:
+    int mSite;
+    bool mOutermost;
+    uint64_t mStartNs;
+    uint64_t mStartBytes;
+    uint64_t mStartReadbacks;
+};
+
+// Writes the counts of all threads to logcat.
+void encoderProfileDump();
+
+// Writes readback counts and latencies to logcat, ranked by total time
+// spent waiting. Also runs at process exit.
+void encoderProfileDumpReadbacks();
+
+#define ENCODER_PROFILE_SCOPE()                                                 \
+    static const int encoderProfileSite = encoderProfileRegisterSite(__func__); \
+    EncoderProfileScope encoderProfileScope(encoderProfileSite)
+
+#define ENCODER_DEBUG_LOG(...) \
+    ENCODER_PROFILE_SCOPE();   \
+    ENCODER_FLIGHT_RECORD();   \
+    ENCODER_DEBUG_LOG_CALL(__VA_ARGS__)
 #else
-#define ENCODER_DEBUG_LOG(...) ((void)0)
+#define ENCODER_DEBUG_LOG(...) \
+    ENCODER_FLIGHT_RECORD();   \
+    ENCODER_DEBUG_LOG_CALL(__VA_ARGS__)
 #endif
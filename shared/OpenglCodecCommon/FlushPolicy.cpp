@@ -0,0 +1,159 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "FlushPolicy.h"
+
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+
+namespace {
+
+constexpr uint64_t kUs = 1000ULL;
+constexpr uint64_t kMs = 1000ULL * kUs;
+
+class FixedIntervalFlushPolicy : public FlushPolicy {
+public:
+    explicit FixedIntervalFlushPolicy(uint32_t interval)
+        : FlushPolicy(Kind::FixedInterval), m_interval(interval ? interval : 1) { }
+
+    bool usesTiming() const override { return false; }
+
+protected:
+    // Matches the original counter: the first draw flushes, then every
+    // |m_interval|-th one after it.
+    bool decide(const Sample&) override {
+        return m_drawCount++ % m_interval == 0;
+    }
+
+private:
+    const uint32_t m_interval;
+    uint32_t m_drawCount = 0;
+};
+
+class LatencyFirstFlushPolicy : public FlushPolicy {
+public:
+    LatencyFirstFlushPolicy() : FlushPolicy(Kind::LatencyFirst) { }
+
+protected:
+    // Hand work to the host roughly as often as it can turn a request
+    // around, so it never sits idle while draws queue up in the guest.
+    bool decide(const Sample& sample) override {
+        static constexpr size_t kMaxPendingBytes = 64 * 1024;
+        static constexpr uint32_t kMaxDraws = 16;
+        const uint64_t maxWaitNs =
+            std::min(std::max(hostLatencyNs(), 100 * kUs), 1 * kMs);
+        return sample.pendingBytes >= kMaxPendingBytes ||
+               drawsSinceFlush() >= kMaxDraws ||
+               nsSinceFlush(sample.nowNs) >= maxWaitNs;
+    }
+};
+
+class ThroughputFirstFlushPolicy : public FlushPolicy {
+public:
+    explicit ThroughputFirstFlushPolicy(uint32_t interval)
+        : FlushPolicy(Kind::ThroughputFirst), m_maxDraws(std::max(interval, 1u)) { }
+
+protected:
+    // Batch until a flush is worth several host round trips.
+    bool decide(const Sample& sample) override {
+        static constexpr size_t kMaxPendingBytes = 512 * 1024;
+        const uint64_t maxWaitNs = std::max(4 * hostLatencyNs(), 4 * kMs);
+        return sample.pendingBytes >= kMaxPendingBytes ||
+               drawsSinceFlush() >= m_maxDraws ||
+               nsSinceFlush(sample.nowNs) >= maxWaitNs;
+    }
+
+private:
+    const uint32_t m_maxDraws;
+};
+
+class FrameBoundaryFlushPolicy : public FlushPolicy {
+public:
+    explicit FrameBoundaryFlushPolicy(uint32_t interval)
+        : FlushPolicy(Kind::FrameBoundary), m_maxDraws(std::max(interval, 1u)) { }
+
+protected:
+    // eglSwapBuffers flushes; only step in for apps that render a lot
+    // without presenting, such as offscreen test renderers.
+    bool decide(const Sample& sample) override {
+        static constexpr size_t kMaxPendingBytes = 1024 * 1024;
+        static constexpr uint64_t kMaxWaitNs = 16 * kMs;
+        return sample.pendingBytes >= kMaxPendingBytes ||
+               drawsSinceFlush() >= m_maxDraws ||
+               nsSinceFlush(sample.nowNs) >= kMaxWaitNs;
+    }
+
+private:
+    const uint32_t m_maxDraws;
+};
+
+}  // namespace
+
+FlushPolicy::FlushPolicy(Kind kind) : m_kind(kind), m_lastFlushNs(nowNs()) { }
+
+// static
+std::unique_ptr<FlushPolicy> FlushPolicy::create(Kind kind, uint32_t drawCallInterval) {
+    switch (kind) {
+        case Kind::LatencyFirst:
+            return std::unique_ptr<FlushPolicy>(new LatencyFirstFlushPolicy());
+        case Kind::ThroughputFirst:
+            return std::unique_ptr<FlushPolicy>(new ThroughputFirstFlushPolicy(drawCallInterval));
+        case Kind::FrameBoundary:
+            return std::unique_ptr<FlushPolicy>(new FrameBoundaryFlushPolicy(drawCallInterval));
+        case Kind::FixedInterval:
+        default:
+            return std::unique_ptr<FlushPolicy>(new FixedIntervalFlushPolicy(drawCallInterval));
+    }
+}
+
+// static
+FlushPolicy::Kind FlushPolicy::kindFromString(const char* name, Kind fallback) {
+    if (!name || !name[0]) return fallback;
+    if (!strcmp(name, "fixed")) return Kind::FixedInterval;
+    if (!strcmp(name, "latency")) return Kind::LatencyFirst;
+    if (!strcmp(name, "throughput")) return Kind::ThroughputFirst;
+    if (!strcmp(name, "frame")) return Kind::FrameBoundary;
+    return fallback;
+}
+
+// static
+uint64_t FlushPolicy::nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+bool FlushPolicy::shouldFlushAfterDraw(const Sample& sample) {
+    ++m_drawsSinceFlush;
+    return decide(sample);
+}
+
+void FlushPolicy::onFlushed(uint64_t nowNs) {
+    m_drawsSinceFlush = 0;
+    m_lastFlushNs = nowNs;
+}
+
+void FlushPolicy::onHostRoundTrip(uint64_t latencyNs) {
+    // Weight new samples by 1/8 so a single slow call does not swing it.
+    m_hostLatencyNs = m_hostLatencyNs
+        ? m_hostLatencyNs - m_hostLatencyNs / 8 + latencyNs / 8
+        : latencyNs;
+}
+
+void FlushPolicy::onFrameBoundary(uint64_t nowNs) {
+    onFlushed(nowNs);
+}
@@ -0,0 +1,84 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef _FLUSH_POLICY_H_
+#define _FLUSH_POLICY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+// Decides when an encoder should flush its stream after a draw call.
+// Encoders report draws, flushes, host round trips and frame boundaries;
+// each policy weighs bytes waiting in the stream, time since the last
+// flush and how quickly the host has been answering.
+class FlushPolicy {
+public:
+    enum class Kind {
+        // Every |drawCallInterval| draws, as ro.boot.qemu.gltransport.drawFlushInterval.
+        FixedInterval,
+        // Keep the host busy; flush small batches early.
+        LatencyFirst,
+        // Let large batches build up before waking the host.
+        ThroughputFirst,
+        // Rely on the flush at each eglSwapBuffers, with a safety cap.
+        FrameBoundary,
+    };
+
+    struct Sample {
+        size_t pendingBytes;
+        uint64_t nowNs;
+    };
+
+    static std::unique_ptr<FlushPolicy> create(Kind kind, uint32_t drawCallInterval);
+    // Accepts "fixed", "latency", "throughput" and "frame".
+    static Kind kindFromString(const char* name, Kind fallback);
+    static uint64_t nowNs();
+
+    virtual ~FlushPolicy() = default;
+
+    Kind kind() const { return m_kind; }
+    // Whether the policy looks at clocks or host latency. When it does not,
+    // encoders skip reading the clock for each draw.
+    virtual bool usesTiming() const { return true; }
+
+    // Called after each draw call is encoded.
+    bool shouldFlushAfterDraw(const Sample& sample);
+
+    void onFlushed(uint64_t nowNs);
+    void onHostRoundTrip(uint64_t latencyNs);
+    void onFrameBoundary(uint64_t nowNs);
+
+protected:
+    explicit FlushPolicy(Kind kind);
+
+    virtual bool decide(const Sample& sample) = 0;
+
+    uint32_t drawsSinceFlush() const { return m_drawsSinceFlush; }
+    uint64_t nsSinceFlush(uint64_t nowNs) const {
+        return nowNs > m_lastFlushNs ? nowNs - m_lastFlushNs : 0;
+    }
+    // Moving average of recent host round trips, 0 until one is seen.
+    uint64_t hostLatencyNs() const { return m_hostLatencyNs; }
+
+private:
+    const Kind m_kind;
+    uint32_t m_drawsSinceFlush = 0;
+    uint64_t m_lastFlushNs = 0;
+    uint64_t m_hostLatencyNs = 0;
+};
+
+#endif
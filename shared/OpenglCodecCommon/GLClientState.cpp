@@ -21,6 +21,8 @@
 #include <string.h>
 #include "glUtils.h"
 
+#include <unordered_map>
+
 #if PLATFORM_SDK_VERSION < 26
 #include <cutils/log.h>
 #else
@@ -41,6 +43,7 @@ using android::base::guest::AutoWriteLock;
 
 void GLClientState::init() {
     m_initialized = false;
+    m_fenceTimeline = newFenceTimeline();
 
     state_GL_STENCIL_TEST = false;
     state_GL_STENCIL_FUNC = GL_ALWAYS;
@@ -62,6 +65,9 @@ void GLClientState::init() {
 
     m_arrayBuffer = 0;
     m_arrayBuffer_lastEncode = 0;
+    m_pixelUnpackStagingBuffer = 0;
+    m_clientArrayRingBuffer = 0;
+    m_clientArrayRingHead = 0;
 
     m_attribEnableCache = 0;
     m_vaoAttribBindingCacheInvalid = 0xffff;
@@ -162,6 +168,7 @@ GLClientState::GLClientState(int majorVersion, int minorVersion) :
 
 GLClientState::~GLClientState()
 {
+    onFenceTimelineDestroyed(m_fenceTimeline);
 }
 
 void GLClientState::enable(int location, int state)
@@ -246,19 +253,15 @@ void GLClientState::removeVertexArrayObjects(GLsizei n, const GLuint* arrays) {
 }
 
 void GLClientState::addVertexArrayObject(GLuint name) {
-    if (m_vaoMap.find(name) !=
-        m_vaoMap.end()) {
+    if (m_vaoMap.contains(name)) {
         ALOGE("%s: ERROR: %u already part of current VAO state!",
               __FUNCTION__, name);
         return;
     }
 
-    m_vaoMap.insert(
-            VAOStateMap::value_type(
-                name,
-                VAOState(0, CODEC_MAX_VERTEX_ATTRIBUTES, CODEC_MAX_VERTEX_ATTRIBUTES)));
-    VertexAttribStateVector& attribState =
-        m_vaoMap.find(name)->second.attribState;
+    VAOState& vaoState = m_vaoMap.emplace(
+            name, 0, CODEC_MAX_VERTEX_ATTRIBUTES, CODEC_MAX_VERTEX_ATTRIBUTES);
+    VertexAttribStateVector& attribState = vaoState.attribState;
     for (int i = 0; i < CODEC_MAX_VERTEX_ATTRIBUTES; i++) {
         attribState[i].enabled = 0;
         attribState[i].enableDirty = false;
@@ -270,8 +273,7 @@ void GLClientState::addVertexArrayObject(GLuint name) {
         attribState[i].type = GL_FLOAT; // GL_FLOAT is the default type
     }
 
-    VertexAttribBindingVector& bindingState =
-        m_vaoMap.find(name)->second.bindingState;
+    VertexAttribBindingVector& bindingState = vaoState.bindingState;
     for (int i = 0; i < bindingState.size(); i++) {
         bindingState[i].effectiveStride = 16;
     }
@@ -283,8 +285,7 @@ void GLClientState::removeVertexArrayObject(GLuint name) {
               __FUNCTION__);
         return;
     }
-    if (m_vaoMap.find(name) ==
-        m_vaoMap.end()) {
+    if (!m_vaoMap.contains(name)) {
         ALOGE("%s: ERROR: %u not found in VAO state!",
               __FUNCTION__, name);
         return;
@@ -293,25 +294,25 @@ void GLClientState::removeVertexArrayObject(GLuint name) {
 }
 
 void GLClientState::setVertexArrayObject(GLuint name) {
-    if (m_vaoMap.find(name) ==
-        m_vaoMap.end()) {
-        ALOGE("%s: ERROR: %u not found in VAO state!",
+    if (name && m_currVaoState.vaoId() == name &&
+        m_currVaoState.generation == m_vaoMap.generation(name)) {
+        ALOGV("%s: set vao to self, no-op (%u)",
               __FUNCTION__, name);
         return;
     }
 
-    if (name && m_currVaoState.vaoId() == name) {
-        ALOGV("%s: set vao to self, no-op (%u)",
+    VAOState* vaoState = m_vaoMap.get(name);
+    if (!vaoState) {
+        ALOGE("%s: ERROR: %u not found in VAO state!",
               __FUNCTION__, name);
         return;
     }
 
-    m_currVaoState =
-        VAOStateRef(m_vaoMap.find(name));
+    m_currVaoState = VAOStateRef(name, vaoState, m_vaoMap.generation(name));
 }
 
 bool GLClientState::isVertexArrayObject(GLuint vao) const {
-    return m_vaoMap.find(vao) != m_vaoMap.end();
+    return m_vaoMap.contains(vao);
 }
 
 void GLClientState::getVBOUsage(bool* hasClientArrays, bool* hasVBOs) {
@@ -471,6 +472,7 @@ bool GLClientState::bufferIdExists(GLuint id) const {
 
 void GLClientState::setBufferHostMapDirty(GLuint id, bool dirty) {
     mHostMappedBufferDirty.set(id, dirty);
+    if (dirty && m_bufferHostWrites) ++*m_bufferHostWrites;
 }
 
 bool GLClientState::isBufferHostMapDirty(GLuint id) const {
@@ -1335,38 +1337,23 @@ void GLClientState::getUnpackingOffsets3D(GLsizei width, GLsizei height, GLsizei
 }
 
 void GLClientState::setNumActiveUniformsInUniformBlock(GLuint program, GLuint uniformBlockIndex, GLint numActiveUniforms) {
-    UniformBlockInfoKey key;
-    key.program = program;
-    key.uniformBlockIndex = uniformBlockIndex;
-
-    UniformBlockUniformInfo info;
-    info.numActiveUniforms = (size_t)numActiveUniforms;
-
-    m_uniformBlockInfoMap[key] = info;
+    std::vector<size_t>& counts = m_uniformBlockInfoMap[program];
+    if (counts.size() <= uniformBlockIndex) {
+        counts.resize(uniformBlockIndex + 1, 0);
+    }
+    counts[uniformBlockIndex] = (size_t)numActiveUniforms;
 }
 
 size_t GLClientState::numActiveUniformsInUniformBlock(GLuint program, GLuint uniformBlockIndex) const {
-    UniformBlockInfoKey key;
-    key.program = program;
-    key.uniformBlockIndex = uniformBlockIndex;
-    UniformBlockInfoMap::const_iterator it =
-        m_uniformBlockInfoMap.find(key);
-    if (it == m_uniformBlockInfoMap.end()) return 0;
-    return it->second.numActiveUniforms;
+    const std::vector<size_t>* counts = m_uniformBlockInfoMap.get(program);
+    if (!counts || counts->size() <= uniformBlockIndex) return 0;
+    return (*counts)[uniformBlockIndex];
 }
 
 void GLClientState::associateProgramWithPipeline(GLuint program, GLuint pipeline) {
     m_programPipelines[program] = pipeline;
 }
 
-GLClientState::ProgramPipelineIterator GLClientState::programPipelineBegin() {
-    return m_programPipelines.begin();
-}
-
-GLClientState::ProgramPipelineIterator GLClientState::programPipelineEnd() {
-    return m_programPipelines.end();
-}
-
 GLenum GLClientState::setActiveTextureUnit(GLenum texture)
 {
     GLuint unit = texture - GL_TEXTURE0;
@@ -2068,6 +2055,8 @@ GLenum GLClientState::copyTexImageLuminanceCubeMapAMDWorkaround
 
 void GLClientState::deleteTextures(GLsizei n, const GLuint* textures)
 {
+    ++m_tex.textureRecs->deletions;
+
     for (const GLuint* texture = textures; texture != textures + n; texture++) {
         setFboCompletenessDirtyForTexture(*texture);
     }
@@ -2454,7 +2443,7 @@ void GLClientState::removeFramebuffers(GLsizei n, const GLuint* framebuffers) {
 }
 
 bool GLClientState::usedFramebufferName(GLuint name) const {
-    return mFboState.fboData.find(name) != mFboState.fboData.end();
+    return mFboState.fboData.contains(name);
 }
 
 FboProps& GLClientState::boundFboProps(GLenum target) {
@@ -2472,13 +2461,13 @@ FboProps& GLClientState::boundFboProps(GLenum target) {
 const FboProps& GLClientState::boundFboProps_const(GLenum target) const {
     switch (target) {
     case GL_DRAW_FRAMEBUFFER:
-        return mFboState.fboData.find(mFboState.boundDrawFramebuffer)->second;
+        return *mFboState.fboData.get(mFboState.boundDrawFramebuffer);
     case GL_READ_FRAMEBUFFER:
-        return mFboState.fboData.find(mFboState.boundReadFramebuffer)->second;
+        return *mFboState.fboData.get(mFboState.boundReadFramebuffer);
     case GL_FRAMEBUFFER:
-        return mFboState.fboData.find(mFboState.boundDrawFramebuffer)->second;
+        return *mFboState.fboData.get(mFboState.boundDrawFramebuffer);
     }
-    return mFboState.fboData.find(mFboState.boundDrawFramebuffer)->second;
+    return *mFboState.fboData.get(mFboState.boundDrawFramebuffer);
 }
 
 void GLClientState::bindFramebuffer(GLenum target, GLuint name) {
@@ -2746,14 +2735,12 @@ std::shared_ptr<RboProps> GLClientState::getFboAttachmentRbo(GLenum target, GLen
 
 void GLClientState::setFboCompletenessDirtyForTexture(GLuint texture) {
     std::shared_ptr<TextureRec> texrec = getTextureRec(texture);
-    std::map<GLuint, FboProps>::iterator it = mFboState.fboData.begin();
-    while (it != mFboState.fboData.end()) {
-        FboProps& props = it->second;
+    mFboState.fboData.forEach([&](GLuint, FboProps& props) {
         for (int i = 0; i < m_hostDriverCaps.max_color_attachments; ++i) {
             if (props.colorAttachmenti_hasTex[i]) {
                 if (texrec == props.colorAttachmenti_textures[i]) {
                     props.completenessDirty = true;
-                    return;
+                    return false;
                 }
             }
         }
@@ -2761,36 +2748,34 @@ void GLClientState::setFboCompletenessDirtyForTexture(GLuint texture) {
         if (props.depthAttachment_hasTexObj) {
             if (texrec == props.depthAttachment_texture) {
                     props.completenessDirty = true;
-                    return;
+                    return false;
             }
         }
 
         if (props.stencilAttachment_hasTexObj) {
             if (texrec == props.stencilAttachment_texture) {
                 props.completenessDirty = true;
-                return;
+                return false;
             }
         }
 
         if (props.depthstencilAttachment_hasTexObj) {
             if (texrec == props.depthstencilAttachment_texture) {
                 props.completenessDirty = true;
-                return;
+                return false;
             }
         }
-        ++it;
-    }
+        return true;
+    });
 }
 
 void GLClientState::setFboCompletenessDirtyForRbo(std::shared_ptr<RboProps> rbo) {
-    std::map<GLuint, FboProps>::iterator it = mFboState.fboData.begin();
-    while (it != mFboState.fboData.end()) {
-        FboProps& props = it->second;
+    mFboState.fboData.forEach([&](GLuint, FboProps& props) {
         for (int i = 0; i < m_hostDriverCaps.max_color_attachments; ++i) {
             if (props.colorAttachmenti_hasRbo[i]) {
                 if (rbo == props.colorAttachmenti_rbos[i]) {
                     props.completenessDirty = true;
-                    return;
+                    return false;
                 }
             }
         }
@@ -2798,25 +2783,25 @@ void GLClientState::setFboCompletenessDirtyForRbo(std::shared_ptr<RboProps> rbo)
         if (props.depthAttachment_hasRbo) {
             if (rbo == props.depthAttachment_rbo) {
                     props.completenessDirty = true;
-                    return;
+                    return false;
             }
         }
 
         if (props.stencilAttachment_hasRbo) {
             if (rbo == props.stencilAttachment_rbo) {
                 props.completenessDirty = true;
-                return;
+                return false;
             }
         }
 
         if (props.depthstencilAttachment_hasRbo) {
             if (rbo == props.depthstencilAttachment_rbo) {
                 props.completenessDirty = true;
-                return;
+                return false;
             }
         }
-        ++it;
-    }
+        return true;
+    });
 }
 
 bool GLClientState::attachmentHasObject(GLenum target, GLenum attachment) const {
@@ -2955,7 +2940,7 @@ bool GLClientState::compressedTexImageSizeCompatible(GLenum internalformat, GLsi
 }
 
 void GLClientState::fromMakeCurrent() {
-    if (mFboState.fboData.find(0) == mFboState.fboData.end()) {
+    if (!mFboState.fboData.contains(0)) {
         addFreshFramebuffer(0);
         FboProps& default_fb_props = mFboState.fboData[0];
         default_fb_props.colorAttachmenti_hasRbo[0] = true;
@@ -3050,20 +3035,42 @@ using android::base::guest::Lock;
 
 // A process-wide fence registry (because we can use fence sync objects across multiple contexts)
 struct FenceRegistry {
+    struct Fence {
+        uint64_t timeline;
+        uint64_t seqno;
+    };
+
     Lock lock;
     PredicateMap<uint64_t, false> existence;
+    std::unordered_map<uint64_t, Fence> fences;
+    // The latest seqno known to have signaled, per timeline.
+    std::unordered_map<uint64_t, uint64_t> signaledSeqnos;
+    uint64_t nextTimeline = 1;
+    uint64_t nextSeqno = 1;
 
-    void onFenceCreated(GLsync sync) {
+    uint64_t newTimeline() {
+        AutoLock<Lock> scopedLock(lock);
+        return nextTimeline++;
+    }
+
+    void onTimelineDestroyed(uint64_t timeline) {
+        AutoLock<Lock> scopedLock(lock);
+        signaledSeqnos.erase(timeline);
+    }
+
+    void onFenceCreated(GLsync sync, uint64_t timeline) {
         AutoLock<Lock> scopedLock(lock);
         uint64_t asUint64 = (uint64_t)(uintptr_t)(sync);
         existence.add(asUint64);
         existence.set(asUint64, true);
+        fences[asUint64] = { timeline, nextSeqno++ };
     }
 
     void onFenceDestroyed(GLsync sync) {
         AutoLock<Lock> scopedLock(lock);
         uint64_t asUint64 = (uint64_t)(uintptr_t)(sync);
         existence.remove(asUint64);
+        fences.erase(asUint64);
     }
 
     bool exists(GLsync sync) {
@@ -3071,12 +3078,39 @@ struct FenceRegistry {
         uint64_t asUint64 = (uint64_t)(uintptr_t)(sync);
         return existence.get(asUint64);
     }
+
+    void onFenceSignaled(GLsync sync) {
+        AutoLock<Lock> scopedLock(lock);
+        auto it = fences.find((uint64_t)(uintptr_t)(sync));
+        if (it == fences.end()) return;
+        uint64_t& signaled = signaledSeqnos[it->second.timeline];
+        if (it->second.seqno > signaled) {
+            signaled = it->second.seqno;
+        }
+    }
+
+    bool signaled(GLsync sync) {
+        AutoLock<Lock> scopedLock(lock);
+        auto it = fences.find((uint64_t)(uintptr_t)(sync));
+        if (it == fences.end()) return false;
+        auto signaledIt = signaledSeqnos.find(it->second.timeline);
+        return signaledIt != signaledSeqnos.end() &&
+               it->second.seqno <= signaledIt->second;
+    }
 };
 
 static FenceRegistry sFenceRegistry;
 
-void GLClientState::onFenceCreated(GLsync sync) {
-    sFenceRegistry.onFenceCreated(sync);
+uint64_t GLClientState::newFenceTimeline() {
+    return sFenceRegistry.newTimeline();
+}
+
+void GLClientState::onFenceTimelineDestroyed(uint64_t timeline) {
+    sFenceRegistry.onTimelineDestroyed(timeline);
+}
+
+void GLClientState::onFenceCreated(GLsync sync, uint64_t timeline) {
+    sFenceRegistry.onFenceCreated(sync, timeline);
 }
 
 void GLClientState::onFenceDestroyed(GLsync sync) {
@@ -3087,3 +3121,11 @@ bool GLClientState::fenceExists(GLsync sync) {
     return sFenceRegistry.exists(sync);
 }
 
+void GLClientState::onFenceSignaled(GLsync sync) {
+    sFenceRegistry.onFenceSignaled(sync);
+}
+
+bool GLClientState::fenceSignaled(GLsync sync) {
+    return sFenceRegistry.signaled(sync);
+}
+
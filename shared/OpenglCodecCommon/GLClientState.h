@@ -26,6 +26,7 @@
 #include "StateTrackingSupport.h"
 #endif
 
+#include "GLStateShadow.h"
 #include "TextureSharedData.h"
 
 #include <GLES/gl.h>
@@ -38,6 +39,7 @@
 #include "ErrorLog.h"
 #include "codec_defs.h"
 
+#include <atomic>
 #include <vector>
 #include <map>
 #include <memory>
@@ -210,20 +212,23 @@ public:
         int numAttributesNeedingUpdateForDraw;
     };
 
-    typedef std::map<GLuint, VAOState> VAOStateMap;
+    typedef DenseNameTable<VAOState> VAOStateMap;
+    // The bound VAO, cached so that the draw path does no lookups.
     struct VAOStateRef {
         VAOStateRef() { }
-        VAOStateRef(
-                VAOStateMap::iterator iter) : it(iter) { }
-        VAOState& vaoState() { return it->second; }
-        VertexAttribState& operator[](size_t k) { return it->second.attribState[k]; }
-        BufferBinding& bufferBinding(size_t k) { return it->second.bindingState[k]; }
-        VertexAttribBindingVector& bufferBindings() { return it->second.bindingState; }
-        const VertexAttribBindingVector& bufferBindings_const() const { return it->second.bindingState; }
-        GLuint vaoId() const { return it->first; }
-        GLuint& iboId() { return it->second.element_array_buffer_binding; }
-        GLuint& iboIdLastEncode() { return it->second.element_array_buffer_binding_lastEncode; }
-        VAOStateMap::iterator it;
+        VAOStateRef(GLuint name, VAOState* state, uint32_t generation) :
+            name(name), state(state), generation(generation) { }
+        VAOState& vaoState() { return *state; }
+        VertexAttribState& operator[](size_t k) { return state->attribState[k]; }
+        BufferBinding& bufferBinding(size_t k) { return state->bindingState[k]; }
+        VertexAttribBindingVector& bufferBindings() { return state->bindingState; }
+        const VertexAttribBindingVector& bufferBindings_const() const { return state->bindingState; }
+        GLuint vaoId() const { return name; }
+        GLuint& iboId() { return state->element_array_buffer_binding; }
+        GLuint& iboIdLastEncode() { return state->element_array_buffer_binding_lastEncode; }
+        GLuint name = 0;
+        VAOState* state = nullptr;
+        uint32_t generation = 0;
     };
 
     typedef struct {
@@ -300,9 +305,17 @@ public:
     void setLastQueryTarget(GLenum target, GLuint id);
     GLenum getLastQueryTarget(GLuint id);
 
-    static void onFenceCreated(GLsync sync);
+    // Fences are created on a timeline, one per context, and signal in the
+    // order they were created on it. Once one fence is known to have
+    // signaled, so have the ones created before it on the same timeline.
+    uint64_t fenceTimeline() const { return m_fenceTimeline; }
+    static uint64_t newFenceTimeline();
+    static void onFenceTimelineDestroyed(uint64_t timeline);
+    static void onFenceCreated(GLsync sync, uint64_t timeline);
     static void onFenceDestroyed(GLsync sync);
     static bool fenceExists(GLsync sync);
+    static void onFenceSignaled(GLsync sync);
+    static bool fenceSignaled(GLsync sync);
 
     void setBoundPixelPackBufferDirtyForHostMap();
     void setBoundTransformFeedbackBuffersDirtyForHostMap();
@@ -331,6 +344,21 @@ public:
     GLuint getLastEncodedBufferBind(GLenum target);
     void setLastEncodedBufferBind(GLenum target, GLuint id);
 
+    GLStateShadow& stateShadow() { return m_stateShadow; }
+
+    // Host buffer object the encoder stages client pixel uploads through.
+    // The app never sees it; 0 until the first staged upload.
+    GLuint pixelUnpackStagingBuffer() const { return m_pixelUnpackStagingBuffer; }
+    void setPixelUnpackStagingBuffer(GLuint buffer) { m_pixelUnpackStagingBuffer = buffer; }
+
+    // Host buffer object the encoder streams client arrays through, and
+    // the next free offset in it. Buffer names belong to the context, so
+    // each context gets its own ring; 0 until the first streamed draw.
+    GLuint clientArrayRingBuffer() const { return m_clientArrayRingBuffer; }
+    void setClientArrayRingBuffer(GLuint buffer) { m_clientArrayRingBuffer = buffer; }
+    size_t clientArrayRingHead() const { return m_clientArrayRingHead; }
+    void setClientArrayRingHead(size_t head) { m_clientArrayRingHead = head; }
+
     size_t pixelDataSize(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, int pack) const;
     size_t pboNeededDataSize(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, int pack, int ignoreTrailing = 0) const;
     size_t clearBufferNumElts(GLenum buffer) const;
@@ -343,33 +371,27 @@ public:
     GLint currentProgram() const { return m_currentProgram; }
     GLint currentShaderProgram() const { return m_currentShaderProgram; }
 
-    struct UniformBlockInfoKey {
-        GLuint program;
-        GLuint uniformBlockIndex;
-    };
-    struct UniformBlockInfoKeyCompare {
-        bool operator() (const UniformBlockInfoKey& a,
-                         const UniformBlockInfoKey& b) const {
-            if (a.program != b.program) return a.program < b.program;
-            if (a.uniformBlockIndex != b.uniformBlockIndex) return a.uniformBlockIndex < b.uniformBlockIndex;
-            return false;
-        }
-    };
-    struct UniformBlockUniformInfo {
-        size_t numActiveUniforms;
-    };
-
-    typedef std::map<UniformBlockInfoKey, UniformBlockUniformInfo, UniformBlockInfoKeyCompare> UniformBlockInfoMap;
+    // Active uniform counts of each program, by uniform block index.
+    typedef DenseNameTable<std::vector<size_t>> UniformBlockInfoMap;
     UniformBlockInfoMap m_uniformBlockInfoMap;
 
     void setNumActiveUniformsInUniformBlock(GLuint program, GLuint uniformBlockIndex, GLint numActiveUniforms);
     size_t numActiveUniformsInUniformBlock(GLuint program, GLuint uniformBlockIndex) const;
 
-    typedef std::map<GLuint, GLuint> ProgramPipelineMap;
-    typedef ProgramPipelineMap::iterator ProgramPipelineIterator;
+    typedef DenseNameTable<GLuint> ProgramPipelineMap;
     void associateProgramWithPipeline(GLuint program, GLuint pipeline);
-    ProgramPipelineIterator programPipelineBegin();
-    ProgramPipelineIterator programPipelineEnd();
+    // Calls f(program) on every program associated with |pipeline|.
+    template <class F>
+    void forEachProgramInPipeline(GLuint pipeline, F&& f) {
+        m_programPipelines.forEach([pipeline, &f](GLuint program, GLuint programPipeline) {
+            if (programPipeline == pipeline) f(program);
+            return true;
+        });
+    }
+    bool isProgramInPipeline(GLuint program) const {
+        const GLuint* pipeline = m_programPipelines.get(program);
+        return pipeline && *pipeline;
+    }
 
     /* OES_EGL_image_external
      *
@@ -466,6 +488,8 @@ public:
     // glDeleteTextures(...)
     // Remove references to the to-be-deleted textures.
     void deleteTextures(GLsizei n, const GLuint* textures);
+    // Number of glDeleteTextures calls in the share group so far.
+    uint64_t textureDeletions() const { return m_tex.textureRecs->deletions; }
 
     // Render buffer objects
     void addRenderbuffers(GLsizei n, GLuint* renderbuffers);
@@ -523,6 +547,9 @@ public:
     void setTextureData(SharedTextureDataMap* sharedTexData);
     void setRenderbufferInfo(RenderbufferInfo* rbInfo);
     void setSamplerInfo(SamplerInfo* samplerInfo);
+    // Share group count of buffers marked written on the host, which every
+    // context's setBufferHostMapDirty() bumps.
+    void setBufferHostWrites(std::atomic<uint64_t>* hostWrites) { m_bufferHostWrites = hostWrites; }
 
     bool compressedTexImageSizeCompatible(GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei imageSize);
     // set eglsurface property on default framebuffer
@@ -610,6 +637,7 @@ private:
 
     // Dirty maps
     DirtyMap mHostMappedBufferDirty;
+    std::atomic<uint64_t>* m_bufferHostWrites = nullptr;
 #else
     std::set<GLuint> mBufferIds;
 #endif
@@ -617,6 +645,10 @@ private:
     // GL_ARRAY_BUFFER_BINDING is separate from VAO state
     GLuint m_arrayBuffer;
     GLuint m_arrayBuffer_lastEncode;
+    GLStateShadow m_stateShadow;
+    GLuint m_pixelUnpackStagingBuffer;
+    GLuint m_clientArrayRingBuffer;
+    size_t m_clientArrayRingHead;
     VAOStateMap m_vaoMap;
     VAOStateRef m_currVaoState;
 
@@ -659,6 +691,7 @@ private:
 
     int m_glesMajorVersion;
     int m_glesMinorVersion;
+    uint64_t m_fenceTimeline;
     int m_activeTexture;
     GLint m_currentProgram;
     GLint m_currentShaderProgram;
@@ -727,7 +760,7 @@ private:
         GLuint boundDrawFramebuffer;
         GLuint boundReadFramebuffer;
         size_t boundFramebufferIndex;
-        std::map<GLuint, FboProps> fboData;
+        DenseNameTable<FboProps> fboData;
         GLenum drawFboCheckStatus;
         GLenum readFboCheckStatus;
     };
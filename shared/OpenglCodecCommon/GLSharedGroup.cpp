@@ -19,12 +19,26 @@
 #include "KeyedVectorUtils.h"
 #include "glUtils.h"
 
+#include <algorithm>
+
+#include <string.h>
+
 /**** BufferData ****/
 
-BufferData::BufferData() : m_size(0), m_usage(0), m_mapped(false) {};
+BufferData::BufferData() : m_size(0), m_usage(0),
+    m_immutable(false), m_storageFlags(0), m_mapped(false), m_shadowed(true),
+    m_mappedFromShadow(false), m_readbackStream(nullptr), m_readbackSerial(0),
+    m_readbackHostWrites(0) {};
+
+BufferData::BufferData(GLsizeiptr size, const void* data, bool shadowed) :
+    m_size(size), m_usage(0),
+    m_immutable(false), m_storageFlags(0), m_mapped(false), m_shadowed(shadowed),
+    m_mappedFromShadow(false), m_readbackStream(nullptr), m_readbackSerial(0),
+    m_readbackHostWrites(0) {
 
-BufferData::BufferData(GLsizeiptr size, const void* data) :
-    m_size(size), m_usage(0), m_mapped(false) {
+    if (!shadowed) {
+        return;
+    }
 
     if (size > 0) {
         m_fixedBuffer.resize(size);
@@ -33,6 +47,17 @@ BufferData::BufferData(GLsizeiptr size, const void* data) :
     if (data) {
         memcpy(m_fixedBuffer.data(), data, size);
     }
+    m_shadowMemory.set(m_fixedBuffer.size());
+}
+
+void BufferData::orphan() {
+    m_mappedFromShadow = false;
+    m_indexRangeCache.clear();
+    m_indexBlockSummary.clear();
+    m_persistentSent.clear();
+    // Readbacks still in flight land in m_readbackDma, which is kept, and
+    // m_readbackStream and m_readbackSerial still say when.
+    m_readbackRanges.clear();
 }
 
 /**** ProgramData ****/
@@ -45,6 +70,8 @@ ProgramData::ProgramData() : m_numIndexes(0),
     m_linkStatus = 0;
     m_activeUniformBlockCount = 0;
     m_transformFeedbackVaryingsCount = 0;
+    m_linkPending = false;
+    m_pendingLinkIssuer = nullptr;
 }
 
 void ProgramData::initProgramData(GLuint numIndexes, GLuint numAttributes) {
@@ -57,6 +84,9 @@ void ProgramData::initProgramData(GLuint numIndexes, GLuint numAttributes) {
 
     m_Indexes = new IndexInfo[numIndexes];
     m_attribIndexes = new AttribInfo[m_numAttributes];
+
+    // Linking resets every uniform to its default value.
+    m_uniformValues.clear();
 }
 
 bool ProgramData::isInitialized() {
@@ -185,6 +215,45 @@ bool ProgramData::setSamplerUniform(GLint appLoc, GLint val, GLenum* target) {
     return false;
 }
 
+bool ProgramData::updateUniformValues(GLint location, GLsizei count,
+                                      size_t bytesPerLocation, const void* data,
+                                      bool transpose) {
+    if (bytesPerLocation > sizeof(UniformValue::words)) return false;
+
+    // GLES ignores the elements of |count| past the end of the array, and
+    // the locations after it may belong to other uniforms.
+    GLuint index = getIndexForLocation(location);
+    if (index >= m_numIndexes) return false;
+    GLint remaining = m_Indexes[index].base + m_Indexes[index].size - location;
+    if (remaining <= 0) return false;
+    if (count > remaining) count = remaining;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    bool unchanged = true;
+    for (GLsizei i = 0; i < count; ++i) {
+        const unsigned char* value = bytes + i * bytesPerLocation;
+        auto it = m_uniformValues.find(location + i);
+        if (it != m_uniformValues.end() &&
+            it->second.size == bytesPerLocation &&
+            it->second.transpose == transpose &&
+            !memcmp(it->second.words, value, bytesPerLocation)) {
+            continue;
+        }
+        unchanged = false;
+        UniformValue& stored = m_uniformValues[location + i];
+        stored.size = bytesPerLocation;
+        stored.transpose = transpose;
+        memcpy(stored.words, value, bytesPerLocation);
+    }
+    return unchanged;
+}
+
+void ProgramData::forgetUniformValues(GLint location, GLsizei count) {
+    for (GLsizei i = 0; i < count; ++i) {
+        m_uniformValues.erase(location + i);
+    }
+}
+
 bool ProgramData::attachShader(GLuint shader, GLenum shaderType) {
     size_t n = m_shaders.size();
 
@@ -263,8 +332,69 @@ AttribValidationInfo ProgramData::compileAttribValidationInfo(bool* error) const
 
     return res;
 }
+void ProgramData::getUniformView(ProgramView::Uniforms* out) const {
+    out->present = true;
+    out->initialized = m_initialized;
+    out->list.resize(m_numIndexes);
+    for (GLuint i = 0; i < m_numIndexes; ++i) {
+        out->list[i].base = m_Indexes[i].base;
+        out->list[i].size = m_Indexes[i].size;
+        out->list[i].type = m_Indexes[i].type;
+    }
+}
+
+/**** ProgramView ****/
+
+// Same as ProgramData::getTypeForLocation.
+GLenum ProgramView::Uniforms::getTypeForLocation(GLint location) const {
+    const Uniform* closest = nullptr;
+    GLint minDist = -1;
+
+    for (const Uniform& uniform : list) {
+        GLint dist = location - uniform.base;
+        if (dist >= 0 && (minDist < 0 || dist < minDist)) {
+            closest = &uniform;
+            minDist = dist;
+        }
+    }
+
+    return closest ? closest->type : 0;
+}
+
+bool ProgramView::Uniforms::isValidUniformLocation(GLint location) const {
+    for (const Uniform& uniform : list) {
+        if (location >= uniform.base &&
+            location < uniform.base + uniform.size)
+            return true;
+    }
+
+    return false;
+}
+
 /***** GLSharedGroup ****/
 
+namespace {
+
+// Published in place of a view that has to be rebuilt under the lock.
+const ProgramView kStaleProgramView;
+
+}  // namespace
+
+class GLSharedGroup::LockFreeRead {
+public:
+    explicit LockFreeRead(const GLSharedGroup* group) : m_group(group) {
+        // Ordered before the loads of the read, so that a writer either
+        // sees this reader or the reader sees what the writer published.
+        const_cast<GLSharedGroup*>(m_group)->m_lockFreeReaders.fetch_add(1);
+    }
+    ~LockFreeRead() {
+        const_cast<GLSharedGroup*>(m_group)->m_lockFreeReaders.fetch_sub(1);
+    }
+
+private:
+    const GLSharedGroup* m_group;
+};
+
 GLSharedGroup::GLSharedGroup() { }
 
 GLSharedGroup::~GLSharedGroup() {
@@ -274,9 +404,74 @@ GLSharedGroup::~GLSharedGroup() {
     clearObjectMap(m_programs);
     clearObjectMap(m_shaders);
     clearObjectMap(m_shaderPrograms);
+    m_programViews.forEach([](GLuint, const ProgramView* view) {
+        if (view != &kStaleProgramView) delete view;
+    });
+    for (const ProgramView* view : m_retiredViews) {
+        delete view;
+    }
+    for (RetiredReadbackDma& retired : m_retiredReadbackDma) {
+        AutoGoldfishDmaContext region(&retired.region);
+    }
+}
+
+bool GLSharedGroup::findProgramView(GLuint program, const ProgramView** view) const {
+    if (!AtomicNameTable<const ProgramView>::covers(program)) return false;
+    *view = m_programViews.load(program);
+    return *view != &kStaleProgramView;
+}
+
+void GLSharedGroup::invalidateProgramViewLocked(GLuint program) {
+    retireProgramViewLocked(m_programViews.exchange(program, &kStaleProgramView));
+}
+
+void GLSharedGroup::publishProgramViewLocked(GLuint program) {
+    if (m_programViews.load(program) != &kStaleProgramView) return;
+
+    ProgramView* view = nullptr;
+    ProgramData* pData = findObjectOrDefault(m_programs, program);
+    auto id = m_shaderProgramIdMap.find(program);
+    ShaderProgramData* spData = id == m_shaderProgramIdMap.end()
+        ? nullptr : findObjectOrDefault(m_shaderPrograms, id->second);
+    if (pData || spData) {
+        view = new ProgramView;
+        if (pData) pData->getUniformView(&view->program);
+        if (spData) spData->programData.getUniformView(&view->separable);
+    }
+    retireProgramViewLocked(m_programViews.exchange(program, view));
+}
+
+void GLSharedGroup::retireProgramViewLocked(const ProgramView* view) {
+    if (view && view != &kStaleProgramView) {
+        m_retiredViews.push_back(view);
+    }
+    // Readers counted from here on can only see what is published now.
+    if (m_retiredViews.empty() || m_lockFreeReaders.load() != 0) return;
+    for (const ProgramView* retired : m_retiredViews) {
+        delete retired;
+    }
+    m_retiredViews.clear();
+}
+
+BufferData* GLSharedGroup::findBufferData(GLuint bufferId) {
+    if (AtomicNameTable<BufferData>::covers(bufferId)) {
+        return m_bufferNames.load(bufferId);
+    }
+
+    AutoLock<Lock> _lock(m_lock);
+
+    return findObjectOrDefault(m_buffers, bufferId);
 }
 
 bool GLSharedGroup::isShaderOrProgramObject(GLuint obj) {
+    {
+        LockFreeRead read(this);
+        const ProgramView* view;
+        if (m_shaderNames.load(obj)) return true;
+        if (AtomicNameTable<ShaderData>::covers(obj) && findProgramView(obj, &view)) {
+            return view != nullptr;
+        }
+    }
 
     AutoLock<Lock> _lock(m_lock);
 
@@ -286,10 +481,7 @@ bool GLSharedGroup::isShaderOrProgramObject(GLuint obj) {
 }
 
 BufferData* GLSharedGroup::getBufferData(GLuint bufferId) {
-
-    AutoLock<Lock> _lock(m_lock);
-
-    return findObjectOrDefault(m_buffers, bufferId);
+    return findBufferData(bufferId);
 }
 
 SharedTextureDataMap* GLSharedGroup::getTextureData() {
@@ -304,22 +496,38 @@ SamplerInfo* GLSharedGroup::getSamplerInfo() {
     return &m_samplerInfo;
 }
 
-void GLSharedGroup::addBufferData(GLuint bufferId, GLsizeiptr size, const void* data) {
+void GLSharedGroup::addBufferData(GLuint bufferId, GLsizeiptr size, const void* data, bool shadow) {
 
     AutoLock<Lock> _lock(m_lock);
 
-    m_buffers[bufferId] = new BufferData(size, data);
+    m_buffers[bufferId] = new BufferData(size, data, shadow);
+    m_bufferNames.exchange(bufferId, m_buffers[bufferId]);
 }
 
-void GLSharedGroup::updateBufferData(GLuint bufferId, GLsizeiptr size, const void* data) {
+void GLSharedGroup::updateBufferData(GLuint bufferId, GLsizeiptr size, const void* data, bool shadow) {
 
     AutoLock<Lock> _lock(m_lock);
 
     BufferData* currentBuffer = findObjectOrDefault(m_buffers, bufferId);
 
-    if (currentBuffer) delete currentBuffer;
+    // Streaming orphans the buffer at the same size every frame. The old
+    // contents are undefined, so the storage is reused without clearing.
+    if (currentBuffer && !data && currentBuffer->m_size == size &&
+        currentBuffer->m_shadowed == shadow && !currentBuffer->m_mapped &&
+        !currentBuffer->m_immutable) {
+        currentBuffer->orphan();
+        return;
+    }
+
+    m_buffers[bufferId] = new BufferData(size, data, shadow);
+    m_bufferNames.exchange(bufferId, m_buffers[bufferId]);
 
-    m_buffers[bufferId] = new BufferData(size, data);
+    if (currentBuffer) {
+        // New storage is never mapped.
+        removePersistentMappingLocked(bufferId);
+        retireReadbackDmaLocked(currentBuffer);
+        delete currentBuffer;
+    }
 }
 
 void GLSharedGroup::setBufferUsage(GLuint bufferId, GLenum usage) {
@@ -332,7 +540,7 @@ void GLSharedGroup::setBufferUsage(GLuint bufferId, GLenum usage) {
 }
 
 void GLSharedGroup::setBufferMapped(GLuint bufferId, bool mapped) {
-    BufferData* buf = findObjectOrDefault(m_buffers, bufferId);
+    BufferData* buf = findBufferData(bufferId);
 
     if (!buf) return;
 
@@ -340,7 +548,7 @@ void GLSharedGroup::setBufferMapped(GLuint bufferId, bool mapped) {
 }
 
 GLenum GLSharedGroup::getBufferUsage(GLuint bufferId) {
-    BufferData* buf = findObjectOrDefault(m_buffers, bufferId);
+    BufferData* buf = findBufferData(bufferId);
 
     if (!buf) return 0;
 
@@ -348,7 +556,7 @@ GLenum GLSharedGroup::getBufferUsage(GLuint bufferId) {
 }
 
 bool GLSharedGroup::isBufferMapped(GLuint bufferId) {
-    BufferData* buf = findObjectOrDefault(m_buffers, bufferId);
+    BufferData* buf = findBufferData(bufferId);
 
     if (!buf) return false;
 
@@ -365,9 +573,12 @@ GLenum GLSharedGroup::subUpdateBufferData(GLuint bufferId, GLintptr offset, GLsi
         return GL_INVALID_VALUE;
     }
 
-    memcpy(&buf->m_fixedBuffer[offset], data, size);
+    if (buf->m_shadowed) {
+        memcpy(&buf->m_fixedBuffer[offset], data, size);
+    }
 
     buf->m_indexRangeCache.invalidateRange((size_t)offset, (size_t)size);
+    buf->m_indexBlockSummary.invalidateRange((size_t)offset, (size_t)size);
     return GL_NO_ERROR;
 }
 
@@ -377,11 +588,51 @@ void GLSharedGroup::deleteBufferData(GLuint bufferId) {
 
     BufferData* buf = findObjectOrDefault(m_buffers, bufferId);
     if (buf) {
+        m_bufferNames.exchange(bufferId, nullptr);
+        removePersistentMappingLocked(bufferId);
+        retireReadbackDmaLocked(buf);
         delete buf;
         m_buffers.erase(bufferId);
     }
 }
 
+void GLSharedGroup::addPersistentMapping(GLuint bufferId) {
+    AutoLock<Lock> _lock(m_lock);
+    m_persistentMappings.push_back(bufferId);
+    m_persistentMappingCount.store(m_persistentMappings.size(), std::memory_order_release);
+}
+
+void GLSharedGroup::removePersistentMapping(GLuint bufferId) {
+    AutoLock<Lock> _lock(m_lock);
+    removePersistentMappingLocked(bufferId);
+}
+
+void GLSharedGroup::removePersistentMappingLocked(GLuint bufferId) {
+    auto it = std::find(m_persistentMappings.begin(), m_persistentMappings.end(), bufferId);
+    if (it == m_persistentMappings.end()) return;
+    m_persistentMappings.erase(it);
+    m_persistentMappingCount.store(m_persistentMappings.size(), std::memory_order_release);
+}
+
+void GLSharedGroup::retireReadbackDmaLocked(BufferData* buf) {
+    if (!buf->m_readbackStream || !buf->m_readbackDma.get().mapped_addr) return;
+    m_retiredReadbackDma.push_back(
+        {buf->m_readbackStream, buf->m_readbackSerial, buf->m_readbackDma.release()});
+}
+
+void GLSharedGroup::freeRetiredReadbackDma(const void* stream, uint64_t readbackCount) {
+    AutoLock<Lock> _lock(m_lock);
+
+    for (auto it = m_retiredReadbackDma.begin(); it != m_retiredReadbackDma.end();) {
+        if (it->stream == stream && it->serial != readbackCount) {
+            AutoGoldfishDmaContext region(&it->region);
+            it = m_retiredReadbackDma.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 void GLSharedGroup::addProgramData(GLuint program) {
 
     AutoLock<Lock> _lock(m_lock);
@@ -392,6 +643,7 @@ void GLSharedGroup::addProgramData(GLuint program) {
     }
 
     m_programs[program] = new ProgramData();
+    invalidateProgramViewLocked(program);
 }
 
 void GLSharedGroup::initProgramData(GLuint program, GLuint numIndexes, GLuint numAttributes) {
@@ -401,6 +653,7 @@ void GLSharedGroup::initProgramData(GLuint program, GLuint numIndexes, GLuint nu
     ProgramData* pData = findObjectOrDefault(m_programs, program);
     if (pData) {
         pData->initProgramData(numIndexes, numAttributes);
+        invalidateProgramViewLocked(program);
     }
 }
 
@@ -426,9 +679,20 @@ void GLSharedGroup::onUseProgram(GLuint previous, GLuint next) {
 }
 
 bool GLSharedGroup::isProgramInitialized(GLuint program) {
+    {
+        LockFreeRead read(this);
+        const ProgramView* view;
+        if (findProgramView(program, &view)) {
+            if (!view) return false;
+            return view->program.present ? view->program.initialized
+                                         : view->separable.initialized;
+        }
+    }
 
     AutoLock<Lock> _lock(m_lock);
 
+    publishProgramViewLocked(program);
+
     ProgramData* pData = findObjectOrDefault(m_programs, program);
 
     if (pData) {
@@ -466,11 +730,14 @@ void GLSharedGroup::deleteProgramDataLocked(GLuint program) {
         }
         delete pData;
         m_programs.erase(program);
+        invalidateProgramViewLocked(program);
     }
 
     if (m_shaderProgramIdMap.find(program) ==
         m_shaderProgramIdMap.end()) return;
 
+    invalidateProgramViewLocked(program);
+
     ShaderProgramData* spData =
         findObjectOrDefault(
             m_shaderPrograms, m_shaderProgramIdMap[program]);
@@ -532,6 +799,7 @@ void GLSharedGroup::setProgramIndexInfo(
 
     if (pData) {
         pData->setIndexInfo(index,base,size,type);
+        invalidateProgramViewLocked(program);
         if (type == GL_SAMPLER_2D) {
             size_t n = pData->getNumShaders();
             for (size_t i = 0; i < n; i++) {
@@ -570,9 +838,21 @@ void GLSharedGroup::setProgramAttribInfo(
 }
 
 GLenum GLSharedGroup::getProgramUniformType(GLuint program, GLint location) {
+    {
+        LockFreeRead read(this);
+        const ProgramView* view;
+        if (findProgramView(program, &view)) {
+            if (!view) return 0;
+            return view->separable.present
+                ? view->separable.getTypeForLocation(location)
+                : view->program.getTypeForLocation(location);
+        }
+    }
 
     AutoLock<Lock> _lock(m_lock);
 
+    publishProgramViewLocked(program);
+
     ProgramData* pData = findObjectOrDefault(m_programs, program);
     GLenum type = 0;
 
@@ -595,9 +875,16 @@ GLenum GLSharedGroup::getProgramUniformType(GLuint program, GLint location) {
 }
 
 bool GLSharedGroup::isProgram(GLuint program) {
+    {
+        LockFreeRead read(this);
+        const ProgramView* view;
+        if (findProgramView(program, &view)) return view != nullptr;
+    }
 
     AutoLock<Lock> _lock(m_lock);
 
+    publishProgramViewLocked(program);
+
     ProgramData* pData = findObjectOrDefault(m_programs, program);
 
     if (pData) return true;
@@ -656,11 +943,59 @@ bool GLSharedGroup::setSamplerUniform(
     return false;
 }
 
+ProgramData* GLSharedGroup::getProgramOrShaderProgramDataLocked(GLuint program) {
+    ProgramData* pData = findObjectOrDefault(m_programs, program);
+    if (pData) return pData;
+
+    auto id = m_shaderProgramIdMap.find(program);
+    if (id == m_shaderProgramIdMap.end()) return NULL;
+
+    ShaderProgramData* spData = findObjectOrDefault(m_shaderPrograms, id->second);
+    return spData ? &spData->programData : NULL;
+}
+
+bool GLSharedGroup::updateUniformValues(
+    GLuint program, GLint location, GLsizei count,
+    size_t bytesPerLocation, const void* data, bool transpose) {
+
+    AutoLock<Lock> _lock(m_lock);
+
+    ProgramData* pData = getProgramOrShaderProgramDataLocked(program);
+    if (!pData) return false;
+
+    return pData->updateUniformValues(location, count, bytesPerLocation, data, transpose);
+}
+
+void GLSharedGroup::forgetUniformValues(GLuint program, GLint location, GLsizei count) {
+    AutoLock<Lock> _lock(m_lock);
+
+    ProgramData* pData = getProgramOrShaderProgramDataLocked(program);
+    if (pData) pData->forgetUniformValues(location, count);
+}
+
+void GLSharedGroup::clearUniformValues(GLuint program) {
+    AutoLock<Lock> _lock(m_lock);
+
+    ProgramData* pData = getProgramOrShaderProgramDataLocked(program);
+    if (pData) pData->clearUniformValues();
+}
+
 bool GLSharedGroup::isProgramUniformLocationValid(GLuint program, GLint location) {
     if (location < 0) return false;
 
+    {
+        LockFreeRead read(this);
+        const ProgramView* view;
+        if (findProgramView(program, &view)) {
+            return view && view->program.present &&
+                   view->program.isValidUniformLocation(location);
+        }
+    }
+
     AutoLock<Lock> _lock(m_lock);
 
+    publishProgramViewLocked(program);
+
     ProgramData* pData =
         findObjectOrDefault(m_programs, program);
 
@@ -670,6 +1005,9 @@ bool GLSharedGroup::isProgramUniformLocationValid(GLuint program, GLint location
 }
 
 bool GLSharedGroup::isShader(GLuint shader) {
+    if (AtomicNameTable<ShaderData>::covers(shader)) {
+        return m_shaderNames.load(shader) != nullptr;
+    }
 
     AutoLock<Lock> _lock(m_lock);
 
@@ -688,6 +1026,7 @@ bool GLSharedGroup::addShaderData(GLuint shader, GLenum shaderType) {
         m_shaders[shader] = data;
         data->refcount = 1;
         data->shaderType = shaderType;
+        m_shaderNames.exchange(shader, data);
     }
 
     return data != NULL;
@@ -717,6 +1056,8 @@ void GLSharedGroup::unrefShaderDataLocked(GLuint shaderId) {
 
     if (data && --data->refcount == 0) {
 
+        m_shaderNames.exchange(shaderId, nullptr);
+
         delete data;
 
         m_shaders.erase(shaderId);
@@ -756,6 +1097,7 @@ void GLSharedGroup::associateGLShaderProgram(
     AutoLock<Lock> _lock(m_lock);
 
     m_shaderProgramIdMap[shaderProgramName] = shaderProgramId;
+    invalidateProgramViewLocked(shaderProgramName);
 }
 
 ShaderProgramData* GLSharedGroup::getShaderProgramDataById(uint32_t id) {
@@ -786,6 +1128,10 @@ void GLSharedGroup::deleteShaderProgramDataById(uint32_t id) {
     delete data;
 
     m_shaderPrograms.erase(id);
+
+    for (const auto& it : m_shaderProgramIdMap) {
+        if (it.second == id) invalidateProgramViewLocked(it.first);
+    }
 }
 
 
@@ -800,11 +1146,15 @@ void GLSharedGroup::deleteShaderProgramData(GLuint shaderProgramName) {
 
     m_shaderPrograms.erase(id);
     m_shaderProgramIdMap.erase(shaderProgramName);
+    invalidateProgramViewLocked(shaderProgramName);
 }
 
 void GLSharedGroup::initShaderProgramData(GLuint shaderProgram, GLuint numIndices, GLuint numAttributes) {
     ShaderProgramData* spData = getShaderProgramData(shaderProgram);
     spData->programData.initProgramData(numIndices, numAttributes);
+
+    AutoLock<Lock> _lock(m_lock);
+    invalidateProgramViewLocked(shaderProgram);
 }
 
 void GLSharedGroup::setShaderProgramIndexInfo(
@@ -817,6 +1167,11 @@ void GLSharedGroup::setShaderProgramIndexInfo(
 
     pData.setIndexInfo(index, base, size, type);
 
+    {
+        AutoLock<Lock> _lock(m_lock);
+        invalidateProgramViewLocked(shaderProgram);
+    }
+
     if (type == GL_SAMPLER_2D) {
 
         ShaderData::StringList::iterator nameIter =
@@ -878,6 +1233,47 @@ GLint GLSharedGroup::getProgramLinkStatus(GLuint program) {
     return pData->getLinkStatus();
 }
 
+void GLSharedGroup::addProgramLinkInput(GLuint program, const std::string& input) {
+    AutoLock<Lock> _lock(m_lock);
+    ProgramData* pData = getProgramDataLocked(program);
+    if (!pData) return;
+    pData->addLinkInput(input);
+}
+
+void GLSharedGroup::setProgramLinkPending(GLuint program, const std::string& cacheKey,
+                                          const void* issuer) {
+    AutoLock<Lock> _lock(m_lock);
+    ProgramData* pData = getProgramDataLocked(program);
+    if (!pData) return;
+    pData->setLinkPending(cacheKey, issuer);
+}
+
+bool GLSharedGroup::takeProgramLinkPending(GLuint program, const void* issuer,
+                                           std::string* cacheKey) {
+    AutoLock<Lock> _lock(m_lock);
+    ProgramData* pData = getProgramDataLocked(program);
+    if (!pData) return false;
+    return pData->takeLinkPending(issuer, cacheKey);
+}
+
+bool GLSharedGroup::getProgramLinkInputs(GLuint program, std::string* out) {
+    AutoLock<Lock> _lock(m_lock);
+    ProgramData* pData = getProgramDataLocked(program);
+    if (!pData) return false;
+
+    out->clear();
+    for (size_t i = 0; i < pData->getNumShaders(); ++i) {
+        auto it = m_shaders.find(pData->getShader(i));
+        if (it == m_shaders.end() || it->second->compiledDigest.empty()) {
+            return false;
+        }
+        *out += std::to_string(it->second->shaderType);
+        *out += it->second->compiledDigest;
+    }
+    *out += pData->getLinkInputs();
+    return true;
+}
+
 void GLSharedGroup::setActiveUniformBlockCountForProgram(GLuint program, GLint count) {
     AutoLock<Lock> _lock(m_lock);
     ProgramData* pData =
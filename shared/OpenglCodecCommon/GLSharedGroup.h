@@ -29,28 +29,41 @@
 #include <GLES2/gl2.h>
 #include <GLES2/gl2ext.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <stdio.h>
 #include <stdlib.h>
 #include "ErrorLog.h"
 #include "auto_goldfish_dma_context.h"
+#include "IndexBlockSummary.h"
 #include "IndexRangeCache.h"
 #include "StateTrackingSupport.h"
+#include "aemu/base/MemoryAccounting.h"
 
 using android::base::guest::AutoLock;
 using android::base::guest::Lock;
 
 struct BufferData {
     BufferData();
-    BufferData(GLsizeiptr size, const void* data);
+    BufferData(GLsizeiptr size, const void* data, bool shadowed);
+
+    // Drops what is known about the contents but keeps the shadow and DMA
+    // storage, for glBufferData without data at the same size.
+    void orphan();
 
     // General buffer state
     GLsizeiptr m_size;
     GLenum m_usage;
+    // Set by glBufferStorageEXT. The host buffer itself is mutable, so
+    // the storage flags are only enforced in the guest.
+    bool m_immutable;
+    GLbitfield m_storageFlags;
 
     // Mapped buffer state
     bool m_mapped;
@@ -61,10 +74,116 @@ struct BufferData {
 
     // Internal bookkeeping
     std::vector<char> m_fixedBuffer; // actual buffer is shadowed here
+    // Whether m_fixedBuffer holds the contents. Once it does, it stays so.
+    bool m_shadowed;
+    android::base::guest::AccountedMemory m_shadowMemory{
+        android::base::guest::GraphicsMemory::kBufferShadows};
     IndexRangeCache m_indexRangeCache;
+    IndexBlockSummary m_indexBlockSummary;
 
     // DMA support
     AutoGoldfishDmaContext dma_buffer;
+    // The mapping points at m_fixedBuffer rather than at dma_buffer.
+    bool m_mappedFromShadow;
+    // What the host last received of a persistent write mapping that is
+    // not flushed explicitly, starting at m_mappedOffset.
+    std::vector<char> m_persistentSent;
+
+    // Host-to-guest copies queued by asynchronous glReadPixels, by buffer
+    // offset, into a region that mirrors the whole buffer. They are only
+    // known to have landed once |m_readbackStream| has read anything back
+    // after |m_readbackSerial|.
+    AutoGoldfishDmaContext m_readbackDma;
+    std::vector<std::pair<GLintptr, GLsizeiptr>> m_readbackRanges;
+    const void* m_readbackStream;
+    uint64_t m_readbackSerial;
+    // GLSharedGroup::getBufferHostWrites() when the ranges were queued. Any
+    // host write to a buffer since, from any context, may have changed them.
+    uint64_t m_readbackHostWrites;
+};
+
+// What uniform validation needs of a program, published so that it can be
+// read without the group lock. Never modified once published.
+struct ProgramView {
+    struct Uniform {
+        GLint base;
+        GLint size;
+        GLenum type;
+    };
+
+    struct Uniforms {
+        bool present = false;
+        bool initialized = false;
+        std::vector<Uniform> list;
+
+        GLenum getTypeForLocation(GLint location) const;
+        bool isValidUniformLocation(GLint location) const;
+    };
+
+    // The program and the separable shader program of the name, if any.
+    Uniforms program;
+    Uniforms separable;
+};
+
+// Object pointers by name that can be loaded without the group lock. Names
+// index chunks of slots that are allocated on the first store and only freed
+// with the table, so that a load never races with a free. Callers serialize
+// stores.
+template <class T>
+class AtomicNameTable {
+public:
+    static constexpr GLuint kChunkBits = 10;
+    static constexpr GLuint kChunkSize = 1 << kChunkBits;
+    static constexpr GLuint kMaxChunks = 64;
+
+    AtomicNameTable() {
+        for (auto& chunk : mChunks) chunk.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~AtomicNameTable() {
+        for (auto& chunk : mChunks) delete [] chunk.load(std::memory_order_relaxed);
+    }
+
+    AtomicNameTable(const AtomicNameTable&) = delete;
+    AtomicNameTable& operator=(const AtomicNameTable&) = delete;
+
+    static bool covers(GLuint name) { return (name >> kChunkBits) < kMaxChunks; }
+
+    T* load(GLuint name) const {
+        if (!covers(name)) return nullptr;
+        const std::atomic<T*>* chunk = mChunks[name >> kChunkBits].load(std::memory_order_acquire);
+        if (!chunk) return nullptr;
+        return chunk[name & (kChunkSize - 1)].load();
+    }
+
+    // Returns what |name| held before.
+    T* exchange(GLuint name, T* value) {
+        if (!covers(name)) return nullptr;
+        std::atomic<std::atomic<T*>*>& chunkSlot = mChunks[name >> kChunkBits];
+        std::atomic<T*>* chunk = chunkSlot.load(std::memory_order_relaxed);
+        if (!chunk) {
+            if (!value) return nullptr;
+            chunk = new std::atomic<T*>[kChunkSize];
+            for (GLuint i = 0; i < kChunkSize; ++i) chunk[i].store(nullptr, std::memory_order_relaxed);
+            chunkSlot.store(chunk, std::memory_order_release);
+        }
+        return chunk[name & (kChunkSize - 1)].exchange(value);
+    }
+
+    template <class F>
+    void forEach(F&& f) const {
+        for (GLuint c = 0; c < kMaxChunks; ++c) {
+            const std::atomic<T*>* chunk = mChunks[c].load(std::memory_order_acquire);
+            if (!chunk) continue;
+            for (GLuint i = 0; i < kChunkSize; ++i) {
+                T* value = chunk[i].load(std::memory_order_relaxed);
+                if (value) f((c << kChunkBits) | i, value);
+            }
+        }
+    }
+
+private:
+    std::atomic<std::atomic<T*>*> mChunks[kMaxChunks];
 };
 
 class ProgramData {
@@ -99,6 +218,26 @@ private:
     uint32_t m_activeUniformBlockCount;
     uint32_t m_transformFeedbackVaryingsCount;;
 
+    // Calls besides attached shaders that change what glLinkProgram does,
+    // in the order made, for keying the program link cache.
+    std::string m_linkInputs;
+
+    // Set from a glLinkProgram whose result has not been read back yet,
+    // along with the program link cache key to store that result under
+    // and the encoder whose stream the link went out on.
+    bool m_linkPending;
+    std::string m_pendingLinkCacheKey;
+    const void* m_pendingLinkIssuer;
+
+    // Raw bytes of the last value written to each uniform location through
+    // glUniform*, used to drop writes that would not change it.
+    struct UniformValue {
+        uint32_t size;
+        bool transpose;
+        uint32_t words[16];
+    };
+    std::unordered_map<GLint, UniformValue> m_uniformValues;
+
 public:
     enum {
         INDEX_FLAG_SAMPLER_EXTERNAL = 0x00000001,
@@ -118,6 +257,15 @@ public:
     GLint getNextSamplerUniform(GLint index, GLint* val, GLenum* target);
     bool setSamplerUniform(GLint appLoc, GLint val, GLenum* target);
 
+    // Records |count| consecutive locations of |bytesPerLocation| each,
+    // clamped to the end of the uniform's array, returning true if all of
+    // them already held exactly this value.
+    bool updateUniformValues(GLint location, GLsizei count,
+                             size_t bytesPerLocation, const void* data,
+                             bool transpose);
+    void forgetUniformValues(GLint location, GLsizei count);
+    void clearUniformValues() { m_uniformValues.clear(); }
+
     bool attachShader(GLuint shader, GLenum shaderType);
     bool detachShader(GLuint shader);
     size_t getNumShaders() const { return m_shaders.size(); }
@@ -150,6 +298,29 @@ public:
         return m_transformFeedbackVaryingsCount;
     }
 
+    void getUniformView(ProgramView::Uniforms* out) const;
+
+    void addLinkInput(const std::string& input) { m_linkInputs += input; }
+    const std::string& getLinkInputs() const { return m_linkInputs; }
+
+    void setLinkPending(const std::string& cacheKey, const void* issuer) {
+        m_linkPending = true;
+        m_pendingLinkCacheKey = cacheKey;
+        m_pendingLinkIssuer = issuer;
+    }
+    bool takeLinkPending(const void* issuer, std::string* cacheKey) {
+        if (!m_linkPending) return false;
+        if (issuer && issuer != m_pendingLinkIssuer) {
+            cacheKey->clear();
+            return true;
+        }
+        m_linkPending = false;
+        cacheKey->swap(m_pendingLinkCacheKey);
+        m_pendingLinkCacheKey.clear();
+        m_pendingLinkIssuer = nullptr;
+        return true;
+    }
+
     GLuint getActiveUniformsCount() const {
         return m_numIndexes;
     }
@@ -165,6 +336,9 @@ struct ShaderData {
     int refcount;
     std::vector<std::string> sources;
     GLenum shaderType;
+    // ProgramLinkCache digest of |sources| as of the last glCompileShader,
+    // if the cache was on then.
+    std::string compiledDigest;
 };
 
 class ShaderProgramData {
@@ -192,22 +366,84 @@ private:
     uint32_t m_shaderProgramId;
 
     ProgramData* getProgramDataLocked(GLuint program);
+    ProgramData* getProgramOrShaderProgramDataLocked(GLuint program);
+
+    // Validation reads the programs, shaders and buffers through these
+    // without taking m_lock, which is still taken to change them. Readers
+    // count themselves in m_lockFreeReaders, and views replaced while any
+    // is counted are only freed once none is. A program whose view is
+    // stale is looked up under the lock, which publishes a new view.
+    class LockFreeRead;
+    AtomicNameTable<const ProgramView> m_programViews;
+    AtomicNameTable<ShaderData> m_shaderNames;
+    AtomicNameTable<BufferData> m_bufferNames;
+    std::atomic<uint32_t> m_lockFreeReaders{0};
+    std::vector<const ProgramView*> m_retiredViews;
+
+    std::atomic<uint64_t> m_bufferHostWrites{0};
+    // Readback regions of buffers that were deleted or given new storage
+    // while a copy into them may still be in flight, kept until the stream
+    // that queued it has read anything back since.
+    struct RetiredReadbackDma {
+        const void* stream;
+        uint64_t serial;
+        goldfish_dma_context region;
+    };
+    std::vector<RetiredReadbackDma> m_retiredReadbackDma;
+    void retireReadbackDmaLocked(BufferData* buf);
+
+    // Buffers with a GL_EXT_buffer_storage persistent mapping. The app may
+    // draw from them in any context of the group, so every context sends
+    // their writes, not only the one that mapped them.
+    std::vector<GLuint> m_persistentMappings;
+    std::atomic<uint32_t> m_persistentMappingCount{0};
+    void removePersistentMappingLocked(GLuint bufferId);
+
+    // Returns false if |program| has to be looked up under the lock.
+    bool findProgramView(GLuint program, const ProgramView** view) const;
+    void invalidateProgramViewLocked(GLuint program);
+    void publishProgramViewLocked(GLuint program);
+    void retireProgramViewLocked(const ProgramView* view);
+    BufferData* findBufferData(GLuint bufferId);
 public:
     GLSharedGroup();
     ~GLSharedGroup();
+    // Counts the acquisitions and hold times of the group's lock into
+    // |stats|, or stops with nullptr. For benchmarks.
+    void setLockStats(android::base::guest::LockStats* stats) { m_lock.setStats(stats); }
     bool isShaderOrProgramObject(GLuint obj);
     BufferData * getBufferData(GLuint bufferId);
     SharedTextureDataMap* getTextureData();
     RenderbufferInfo* getRenderbufferInfo();
     SamplerInfo* getSamplerInfo();
-    void    addBufferData(GLuint bufferId, GLsizeiptr size, const void* data);
-    void    updateBufferData(GLuint bufferId, GLsizeiptr size, const void* data);
+    std::atomic<uint64_t>* getBufferHostWrites() { return &m_bufferHostWrites; }
+    // Frees the retired readback regions queued on |stream| before it read
+    // back |readbackCount| times.
+    void freeRetiredReadbackDma(const void* stream, uint64_t readbackCount);
+    void    addBufferData(GLuint bufferId, GLsizeiptr size, const void* data, bool shadow = true);
+    void    updateBufferData(GLuint bufferId, GLsizeiptr size, const void* data, bool shadow = true);
     void    setBufferUsage(GLuint bufferId, GLenum usage);
     void    setBufferMapped(GLuint bufferId, bool mapped);
     GLenum    getBufferUsage(GLuint bufferId);
     bool    isBufferMapped(GLuint bufferId);
     GLenum  subUpdateBufferData(GLuint bufferId, GLintptr offset, GLsizeiptr size, const void* data);
     void    deleteBufferData(GLuint);
+    void    addPersistentMapping(GLuint bufferId);
+    void    removePersistentMapping(GLuint bufferId);
+    bool    hasPersistentMappings() const {
+        return m_persistentMappingCount.load(std::memory_order_acquire) != 0;
+    }
+    // Calls |fn| with the id and data of each persistently mapped buffer,
+    // under the group lock so that contexts on other threads do not send
+    // the same writes at once.
+    template <class Fn>
+    void forEachPersistentMapping(Fn fn) {
+        AutoLock<Lock> _lock(m_lock);
+        for (GLuint bufferId : m_persistentMappings) {
+            auto it = m_buffers.find(bufferId);
+            if (it != m_buffers.end()) fn(bufferId, it->second);
+        }
+    }
 
     bool    isProgram(GLuint program);
     bool    isProgramInitialized(GLuint program);
@@ -225,6 +461,9 @@ public:
     GLenum  getProgramUniformType(GLuint program, GLint location);
     GLint   getNextSamplerUniform(GLuint program, GLint index, GLint* val, GLenum* target);
     bool    setSamplerUniform(GLuint program, GLint appLoc, GLint val, GLenum* target);
+    bool    updateUniformValues(GLuint program, GLint location, GLsizei count, size_t bytesPerLocation, const void* data, bool transpose);
+    void    forgetUniformValues(GLuint program, GLint location, GLsizei count);
+    void    clearUniformValues(GLuint program);
     bool    isProgramUniformLocationValid(GLuint program, GLint location);
 
     bool    isShader(GLuint shader);
@@ -250,6 +489,22 @@ public:
     void setProgramLinkStatus(GLuint program, GLint linkStatus);
     GLint getProgramLinkStatus(GLuint program);
 
+    void addProgramLinkInput(GLuint program, const std::string& input);
+    // Everything that decides the result of linking |program| as it is now,
+    // or false if an attached shader was compiled without a digest.
+    bool getProgramLinkInputs(GLuint program, std::string* out);
+
+    // Marks a link whose status and reflection are read back on first use,
+    // issued on the stream of the encoder |issuer|.
+    void setProgramLinkPending(GLuint program, const std::string& cacheKey,
+                               const void* issuer);
+    // Returns true if |program| has such a link, for the caller to read
+    // back. Only a readback on the issuing stream is ordered after the link
+    // on the host, so when another encoder reads it the link stays pending
+    // for its issuer and no cache key is given for storing what was read.
+    // A null |issuer| takes it whoever issued it.
+    bool takeProgramLinkPending(GLuint program, const void* issuer, std::string* cacheKey);
+
     void setActiveUniformBlockCountForProgram(GLuint program, GLint numBlocks);
     GLint getActiveUniformBlockCount(GLuint program);
 
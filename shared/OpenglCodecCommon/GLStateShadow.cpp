@@ -0,0 +1,382 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "GLStateShadow.h"
+
+#include <GLES/glext.h>
+#include <GLES3/gl3.h>
+
+#include <string.h>
+
+GLStateShadow::GLStateShadow() : m_enabled(false), m_textureDeletions(0) {
+    memset(m_dropped, 0, sizeof(m_dropped));
+    setEnabled(true);
+    // A new context starts on texture unit 0.
+    m_activeTextureKnown = true;
+    m_activeTexture = GL_TEXTURE0;
+}
+
+void GLStateShadow::setEnabled(bool enabled) {
+    if (enabled && !m_enabled) {
+        // Nothing was recorded while disabled, so start from scratch.
+        m_programKnown = false;
+        m_program = 0;
+        m_activeTextureKnown = false;
+        m_activeTexture = GL_TEXTURE0;
+        m_textureBindings.clear();
+        memset(m_capKnown, 0, sizeof(m_capKnown));
+        memset(m_capEnabled, 0, sizeof(m_capEnabled));
+        m_blendEquationKnown = false;
+        m_blendFuncKnown = false;
+        m_depthFuncKnown = false;
+        m_cullFaceKnown = false;
+        m_frontFaceKnown = false;
+        m_lineWidthKnown = false;
+        m_viewportKnown = false;
+        m_scissorKnown = false;
+        m_colorKnown = false;
+        m_matrixModeKnown = false;
+        m_matrices.clear();
+        m_texEnv.clear();
+        m_shadeModelKnown = false;
+    }
+    m_enabled = enabled;
+}
+
+bool GLStateShadow::drop(Entry entry) {
+    ++m_dropped[entry];
+    return true;
+}
+
+// static
+int GLStateShadow::capSlot(GLenum cap) {
+    switch (cap) {
+        case GL_BLEND: return 0;
+        case GL_CULL_FACE: return 1;
+        case GL_DEPTH_TEST: return 2;
+        case GL_DITHER: return 3;
+        case GL_POLYGON_OFFSET_FILL: return 4;
+        case GL_SAMPLE_ALPHA_TO_COVERAGE: return 5;
+        case GL_SAMPLE_COVERAGE: return 6;
+        case GL_SCISSOR_TEST: return 7;
+        case GL_STENCIL_TEST: return 8;
+        case GL_PRIMITIVE_RESTART_FIXED_INDEX: return 9;
+        case GL_RASTERIZER_DISCARD: return 10;
+        default: return -1;
+    }
+}
+
+bool GLStateShadow::skipUseProgram(GLuint program) {
+    if (!m_enabled) return false;
+    if (m_programKnown && m_program == program) return drop(UseProgram);
+    m_programKnown = true;
+    m_program = program;
+    return false;
+}
+
+bool GLStateShadow::skipActiveTexture(GLenum unit) {
+    if (!m_enabled) return false;
+    if (m_activeTextureKnown && m_activeTexture == unit) return drop(ActiveTexture);
+    m_activeTextureKnown = true;
+    m_activeTexture = unit;
+    return false;
+}
+
+static uint64_t textureBindingKey(GLenum unit, GLenum target) {
+    return ((uint64_t)unit << 32) | target;
+}
+
+bool GLStateShadow::skipBindTexture(GLenum target, GLuint texture, uint64_t textureDeletions) {
+    if (!m_enabled) return false;
+    if (textureDeletions != m_textureDeletions) {
+        m_textureBindings.clear();
+        m_textureDeletions = textureDeletions;
+    }
+    if (!m_activeTextureKnown) return false;
+    auto it = m_textureBindings.emplace(
+        textureBindingKey(m_activeTexture, target), texture);
+    if (!it.second) {
+        if (it.first->second == texture) return drop(BindTexture);
+        it.first->second = texture;
+    }
+    return false;
+}
+
+bool GLStateShadow::skipEnable(GLenum cap, bool enable) {
+    if (!m_enabled) return false;
+    int slot = capSlot(cap);
+    if (slot < 0) return false;
+    if (m_capKnown[slot] && m_capEnabled[slot] == enable) {
+        return drop(enable ? Enable : Disable);
+    }
+    m_capKnown[slot] = true;
+    m_capEnabled[slot] = enable;
+    return false;
+}
+
+bool GLStateShadow::skipBlendEquation(GLenum modeRGB, GLenum modeAlpha) {
+    if (!m_enabled) return false;
+    if (m_blendEquationKnown &&
+        m_blendEquation[0] == modeRGB &&
+        m_blendEquation[1] == modeAlpha) {
+        return drop(BlendEquation);
+    }
+    m_blendEquationKnown = true;
+    m_blendEquation[0] = modeRGB;
+    m_blendEquation[1] = modeAlpha;
+    return false;
+}
+
+bool GLStateShadow::skipBlendFunc(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    if (!m_enabled) return false;
+    if (m_blendFuncKnown &&
+        m_blendFunc[0] == srcRGB &&
+        m_blendFunc[1] == dstRGB &&
+        m_blendFunc[2] == srcAlpha &&
+        m_blendFunc[3] == dstAlpha) {
+        return drop(BlendFunc);
+    }
+    m_blendFuncKnown = true;
+    m_blendFunc[0] = srcRGB;
+    m_blendFunc[1] = dstRGB;
+    m_blendFunc[2] = srcAlpha;
+    m_blendFunc[3] = dstAlpha;
+    return false;
+}
+
+bool GLStateShadow::skipDepthFunc(GLenum func) {
+    if (!m_enabled) return false;
+    if (m_depthFuncKnown && m_depthFunc == func) return drop(DepthFunc);
+    m_depthFuncKnown = true;
+    m_depthFunc = func;
+    return false;
+}
+
+bool GLStateShadow::skipCullFace(GLenum mode) {
+    if (!m_enabled) return false;
+    if (m_cullFaceKnown && m_cullFace == mode) return drop(CullFace);
+    m_cullFaceKnown = true;
+    m_cullFace = mode;
+    return false;
+}
+
+bool GLStateShadow::skipFrontFace(GLenum mode) {
+    if (!m_enabled) return false;
+    if (m_frontFaceKnown && m_frontFace == mode) return drop(FrontFace);
+    m_frontFaceKnown = true;
+    m_frontFace = mode;
+    return false;
+}
+
+bool GLStateShadow::skipLineWidth(GLfloat width) {
+    if (!m_enabled) return false;
+    if (m_lineWidthKnown && m_lineWidth == width) return drop(LineWidth);
+    m_lineWidthKnown = true;
+    m_lineWidth = width;
+    return false;
+}
+
+bool GLStateShadow::skipViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!m_enabled) return false;
+    if (m_viewportKnown &&
+        m_viewport[0] == x && m_viewport[1] == y &&
+        m_viewport[2] == width && m_viewport[3] == height) {
+        return drop(Viewport);
+    }
+    m_viewportKnown = true;
+    m_viewport[0] = x;
+    m_viewport[1] = y;
+    m_viewport[2] = width;
+    m_viewport[3] = height;
+    return false;
+}
+
+bool GLStateShadow::skipScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (!m_enabled) return false;
+    if (m_scissorKnown &&
+        m_scissor[0] == x && m_scissor[1] == y &&
+        m_scissor[2] == width && m_scissor[3] == height) {
+        return drop(Scissor);
+    }
+    m_scissorKnown = true;
+    m_scissor[0] = x;
+    m_scissor[1] = y;
+    m_scissor[2] = width;
+    m_scissor[3] = height;
+    return false;
+}
+
+bool GLStateShadow::textureUnitKey(uint32_t low, uint64_t* key) const {
+    if (!m_activeTextureKnown) return false;
+    *key = ((uint64_t)(m_activeTexture - GL_TEXTURE0) << 32) | low;
+    return true;
+}
+
+bool GLStateShadow::skipColor(GLenum type, const uint32_t rgba[4]) {
+    if (!m_enabled) return false;
+    if (m_colorKnown && m_color.type == type &&
+        !memcmp(m_color.words, rgba, 4 * sizeof(uint32_t))) {
+        return drop(Color);
+    }
+    m_colorKnown = true;
+    m_color.type = type;
+    memcpy(m_color.words, rgba, 4 * sizeof(uint32_t));
+    return false;
+}
+
+bool GLStateShadow::skipMatrixMode(GLenum mode) {
+    if (!m_enabled) return false;
+    if (m_matrixModeKnown && m_matrixMode == mode) return drop(MatrixMode);
+    switch (mode) {
+        case GL_MODELVIEW:
+        case GL_PROJECTION:
+        case GL_TEXTURE:
+        case GL_MATRIX_PALETTE_OES:
+            m_matrixModeKnown = true;
+            m_matrixMode = mode;
+            break;
+        default:
+            // The host keeps its mode on error, which is then not known.
+            m_matrixModeKnown = false;
+            break;
+    }
+    return false;
+}
+
+bool GLStateShadow::skipLoadMatrix(GLenum type, const uint32_t* m) {
+    // Palette matrices are picked by glCurrentPaletteMatrixOES, which is
+    // not followed.
+    if (!m_enabled || !m_matrixModeKnown || m_matrixMode == GL_MATRIX_PALETTE_OES) {
+        return false;
+    }
+    uint64_t key = (uint64_t)m_matrixMode << 32;
+    if (m_matrixMode == GL_TEXTURE) {
+        if (!m_activeTextureKnown) return false;
+        key |= m_activeTexture - GL_TEXTURE0;
+    }
+
+    const GLenum valueType = m ? type : GL_NONE;
+    auto it = m_matrices.emplace(key, TypedValue());
+    TypedValue& value = it.first->second;
+    if (!it.second && value.type == valueType &&
+        (!m || !memcmp(value.words, m, sizeof(value.words)))) {
+        return drop(LoadMatrix);
+    }
+    value.type = valueType;
+    if (m) memcpy(value.words, m, sizeof(value.words));
+    return false;
+}
+
+bool GLStateShadow::skipTexEnv(GLenum target, GLenum pname, GLenum type, uint32_t param) {
+    uint64_t key;
+    if (!m_enabled || !textureUnitKey(((target & 0xffff) << 16) | (pname & 0xffff), &key)) {
+        return false;
+    }
+    auto it = m_texEnv.emplace(key, std::make_pair(type, param));
+    if (!it.second) {
+        if (it.first->second.first == type && it.first->second.second == param) {
+            return drop(TexEnv);
+        }
+        it.first->second = std::make_pair(type, param);
+    }
+    return false;
+}
+
+bool GLStateShadow::skipShadeModel(GLenum mode) {
+    if (!m_enabled) return false;
+    if (m_shadeModelKnown && m_shadeModel == mode) return drop(ShadeModel);
+    m_shadeModelKnown = true;
+    m_shadeModel = mode;
+    return false;
+}
+
+void GLStateShadow::onActiveTextureEncoded(GLenum unit) {
+    if (!m_enabled) return;
+    m_activeTextureKnown = true;
+    m_activeTexture = unit;
+}
+
+void GLStateShadow::onBindTextureEncoded(GLenum target, GLuint texture) {
+    if (!m_enabled || !m_activeTextureKnown) return;
+    m_textureBindings[textureBindingKey(m_activeTexture, target)] = texture;
+}
+
+void GLStateShadow::invalidateCap(GLenum cap) {
+    int slot = capSlot(cap);
+    if (slot >= 0) m_capKnown[slot] = false;
+}
+
+void GLStateShadow::invalidateBlendEquation() {
+    m_blendEquationKnown = false;
+}
+
+void GLStateShadow::invalidateBlendFunc() {
+    m_blendFuncKnown = false;
+}
+
+void GLStateShadow::invalidateColor() {
+    m_colorKnown = false;
+}
+
+void GLStateShadow::invalidateMatrix() {
+    if (!m_matrixModeKnown) {
+        m_matrices.clear();
+        return;
+    }
+    uint64_t key = (uint64_t)m_matrixMode << 32;
+    if (m_matrixMode == GL_TEXTURE) {
+        if (!m_activeTextureKnown) {
+            m_matrices.clear();
+            return;
+        }
+        key |= m_activeTexture - GL_TEXTURE0;
+    }
+    m_matrices.erase(key);
+}
+
+void GLStateShadow::invalidateTexEnv(GLenum target, GLenum pname) {
+    uint64_t key;
+    if (!textureUnitKey(((target & 0xffff) << 16) | (pname & 0xffff), &key)) {
+        m_texEnv.clear();
+        return;
+    }
+    m_texEnv.erase(key);
+}
+
+// static
+const char* GLStateShadow::entryName(Entry entry) {
+    switch (entry) {
+        case UseProgram: return "glUseProgram";
+        case ActiveTexture: return "glActiveTexture";
+        case BindTexture: return "glBindTexture";
+        case Enable: return "glEnable";
+        case Disable: return "glDisable";
+        case BlendEquation: return "glBlendEquation";
+        case BlendFunc: return "glBlendFunc";
+        case DepthFunc: return "glDepthFunc";
+        case CullFace: return "glCullFace";
+        case FrontFace: return "glFrontFace";
+        case LineWidth: return "glLineWidth";
+        case Viewport: return "glViewport";
+        case Scissor: return "glScissor";
+        case Uniform: return "glUniform";
+        case Color: return "glColor4";
+        case MatrixMode: return "glMatrixMode";
+        case LoadMatrix: return "glLoadMatrix";
+        case TexEnv: return "glTexEnv";
+        case ShadeModel: return "glShadeModel";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,171 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef _GL_STATE_SHADOW_H_
+#define _GL_STATE_SHADOW_H_
+
+#include <GLES/gl.h>
+#include <GLES2/gl2.h>
+
+#include <stdint.h>
+
+#include <unordered_map>
+
+// Last values encoded to the host for plain state setters, so that the
+// encoder can drop calls that would not change host state. Everything
+// starts out unknown except what the GL spec defines for a new context,
+// and a value only becomes known once it has been encoded, so the shadow
+// never claims more than the host has actually been told.
+class GLStateShadow {
+public:
+    enum Entry {
+        UseProgram,
+        ActiveTexture,
+        BindTexture,
+        Enable,
+        Disable,
+        BlendEquation,
+        BlendFunc,
+        DepthFunc,
+        CullFace,
+        FrontFace,
+        LineWidth,
+        Viewport,
+        Scissor,
+        Uniform,
+        // GLES 1 fixed function state.
+        Color,
+        MatrixMode,
+        LoadMatrix,
+        TexEnv,
+        ShadeModel,
+        EntryCount,
+    };
+
+    GLStateShadow();
+
+    void setEnabled(bool enabled);
+    bool enabled() const { return m_enabled; }
+
+    // Each check returns true if the call is redundant and should be
+    // dropped, counting it; otherwise it records the new value and
+    // returns false.
+    bool skipUseProgram(GLuint program);
+    bool skipActiveTexture(GLenum unit);
+    // |textureDeletions| is the share group's GLClientState::textureDeletions():
+    // once another context may have deleted a name and had it reused, the
+    // remembered bindings no longer say which object is bound.
+    bool skipBindTexture(GLenum target, GLuint texture, uint64_t textureDeletions);
+    bool skipEnable(GLenum cap, bool enable);
+    bool skipBlendEquation(GLenum modeRGB, GLenum modeAlpha);
+    bool skipBlendFunc(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+    bool skipDepthFunc(GLenum func);
+    bool skipCullFace(GLenum mode);
+    bool skipFrontFace(GLenum mode);
+    bool skipLineWidth(GLfloat width);
+    bool skipViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+    bool skipScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+    // GLES 1 calls. |type| is the GL type the value was passed as, since
+    // the same value passed as another type is not compared.
+    bool skipColor(GLenum type, const uint32_t rgba[4]);
+    bool skipMatrixMode(GLenum mode);
+    // glLoadMatrix* on the current matrix, or glLoadIdentity if |m| is null.
+    bool skipLoadMatrix(GLenum type, const uint32_t* m);
+    // Scalar glTexEnv* on the active texture unit.
+    bool skipTexEnv(GLenum target, GLenum pname, GLenum type, uint32_t param);
+    bool skipShadeModel(GLenum mode);
+
+    // Records state that reached the host through a path that does not
+    // go through the checks above.
+    void onActiveTextureEncoded(GLenum unit);
+    void onBindTextureEncoded(GLenum target, GLuint texture);
+    void invalidateCap(GLenum cap);
+    void invalidateBlendEquation();
+    void invalidateBlendFunc();
+    // After a draw with a color array, which leaves the current color
+    // undefined.
+    void invalidateColor();
+    // After any other change to the current matrix.
+    void invalidateMatrix();
+    void invalidateTexEnv(GLenum target, GLenum pname);
+
+    // Counts a call dropped by a filter kept outside this class.
+    void onDropped(Entry entry) { drop(entry); }
+
+    uint64_t droppedCalls(Entry entry) const { return m_dropped[entry]; }
+    static const char* entryName(Entry entry);
+
+private:
+    bool drop(Entry entry);
+    static int capSlot(GLenum cap);
+
+    // Enable caps tracked by the shadow; others are always encoded.
+    static constexpr int kCapCount = 11;
+
+    bool m_enabled;
+    uint64_t m_dropped[EntryCount];
+
+    bool m_programKnown;
+    GLuint m_program;
+
+    bool m_activeTextureKnown;
+    GLenum m_activeTexture;
+    // (unit << 32 | target) -> texture
+    std::unordered_map<uint64_t, GLuint> m_textureBindings;
+    // Share group texture deletions m_textureBindings is up to date with.
+    uint64_t m_textureDeletions;
+
+    bool m_capKnown[kCapCount];
+    bool m_capEnabled[kCapCount];
+
+    bool m_blendEquationKnown;
+    GLenum m_blendEquation[2];
+    bool m_blendFuncKnown;
+    GLenum m_blendFunc[4];
+    bool m_depthFuncKnown;
+    GLenum m_depthFunc;
+    bool m_cullFaceKnown;
+    GLenum m_cullFace;
+    bool m_frontFaceKnown;
+    GLenum m_frontFace;
+    bool m_lineWidthKnown;
+    GLfloat m_lineWidth;
+    bool m_viewportKnown;
+    GLint m_viewport[4];
+    bool m_scissorKnown;
+    GLint m_scissor[4];
+
+    // Key for per texture unit state, or false if the unit is unknown.
+    bool textureUnitKey(uint32_t low, uint64_t* key) const;
+
+    struct TypedValue {
+        GLenum type;
+        uint32_t words[16];
+    };
+    bool m_colorKnown;
+    TypedValue m_color;
+    bool m_matrixModeKnown;
+    GLenum m_matrixMode;
+    // (mode << 32 | unit for GL_TEXTURE) -> last loaded matrix;
+    // GL_NONE type for the identity.
+    std::unordered_map<uint64_t, TypedValue> m_matrices;
+    // (unit << 32 | target << 16 | pname) -> (type, value)
+    std::unordered_map<uint64_t, std::pair<GLenum, uint32_t>> m_texEnv;
+    bool m_shadeModelKnown;
+    GLenum m_shadeModel;
+};
+
+#endif
@@ -0,0 +1,156 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "IndexBlockSummary.h"
+
+#include "glUtils.h"
+
+namespace {
+
+void scanIndices(const unsigned char* p, GLenum type, size_t count,
+                 bool primitiveRestartEnabled, int* min_out, int* max_out) {
+    switch (type) {
+        case GL_UNSIGNED_BYTE:
+            GLUtils::minmaxExcept(
+                (const unsigned char*)p, count, min_out, max_out,
+                primitiveRestartEnabled, GLUtils::primitiveRestartIndex<unsigned char>());
+            break;
+        case GL_UNSIGNED_SHORT:
+            GLUtils::minmaxExcept(
+                (const unsigned short*)p, count, min_out, max_out,
+                primitiveRestartEnabled, GLUtils::primitiveRestartIndex<unsigned short>());
+            break;
+        case GL_UNSIGNED_INT:
+            GLUtils::minmaxExcept(
+                (const unsigned int*)p, count, min_out, max_out,
+                primitiveRestartEnabled, GLUtils::primitiveRestartIndex<unsigned int>());
+            break;
+        default:
+            *min_out = -1;
+            *max_out = -1;
+            break;
+    }
+}
+
+// -1 marks "no index seen", as in GLUtils::minmaxExcept. Values are
+// compared unsigned so u32 indices above INT_MAX still order correctly.
+void combineRange(int min, int max, int* min_out, int* max_out) {
+    if (min == -1) return;
+    if (*min_out == -1 || (unsigned)min < (unsigned)*min_out) *min_out = min;
+    if (*max_out == -1 || (unsigned)max > (unsigned)*max_out) *max_out = max;
+}
+
+}  // namespace
+
+bool IndexBlockSummary::findRange(const void* data,
+                                  size_t dataSize,
+                                  GLenum type,
+                                  size_t offset,
+                                  size_t count,
+                                  bool primitiveRestartEnabled,
+                                  int* min_out,
+                                  int* max_out) {
+    const size_t indexSize = glSizeof(type);
+    if (type != GL_UNSIGNED_BYTE &&
+        type != GL_UNSIGNED_SHORT &&
+        type != GL_UNSIGNED_INT) {
+        return false;
+    }
+
+    // Indices must not straddle chunk boundaries.
+    if (offset % indexSize) return false;
+
+    const size_t end = offset + count * indexSize;
+    if (end > dataSize || end < offset) return false;
+
+    const size_t firstBlock = (offset + kBlockBytes - 1) / kBlockBytes;
+    const size_t lastBlock = end / kBlockBytes;
+    if (lastBlock < firstBlock + kMinQueryBlocks) return false;
+
+    Table* table = getTable(type, primitiveRestartEnabled, dataSize);
+    const unsigned char* bytes = (const unsigned char*)data;
+
+    int min = -1;
+    int max = -1;
+    int partMin;
+    int partMax;
+
+    const size_t headEnd = firstBlock * kBlockBytes;
+    if (headEnd > offset) {
+        scanIndices(bytes + offset, type, (headEnd - offset) / indexSize,
+                    primitiveRestartEnabled, &partMin, &partMax);
+        combineRange(partMin, partMax, &min, &max);
+    }
+
+    for (size_t i = firstBlock; i < lastBlock; i++) {
+        Block& block = table->blocks[i];
+        if (!block.valid) {
+            scanIndices(bytes + i * kBlockBytes, type, kBlockBytes / indexSize,
+                        primitiveRestartEnabled, &block.min, &block.max);
+            block.valid = true;
+        }
+        combineRange(block.min, block.max, &min, &max);
+    }
+
+    const size_t tailStart = lastBlock * kBlockBytes;
+    if (end > tailStart) {
+        scanIndices(bytes + tailStart, type, (end - tailStart) / indexSize,
+                    primitiveRestartEnabled, &partMin, &partMax);
+        combineRange(partMin, partMax, &min, &max);
+    }
+
+    *min_out = min;
+    *max_out = max;
+    return true;
+}
+
+void IndexBlockSummary::invalidateRange(size_t offset, size_t size) {
+    if (!size) return;
+
+    const size_t firstBlock = offset / kBlockBytes;
+    const size_t lastBlock = (offset + size - 1) / kBlockBytes;
+
+    for (Table& table : mTables) {
+        const size_t end = lastBlock + 1 < table.blocks.size() ? lastBlock + 1 : table.blocks.size();
+        for (size_t i = firstBlock; i < end; i++) {
+            table.blocks[i].valid = false;
+        }
+    }
+}
+
+void IndexBlockSummary::clear() {
+    mTables.clear();
+}
+
+IndexBlockSummary::Table* IndexBlockSummary::getTable(GLenum type,
+                                                      bool primitiveRestartEnabled,
+                                                      size_t dataSize) {
+    const size_t numBlocks = dataSize / kBlockBytes;
+
+    for (Table& table : mTables) {
+        if (table.type == type &&
+            table.primitiveRestartEnabled == primitiveRestartEnabled) {
+            if (table.blocks.size() < numBlocks) {
+                table.blocks.resize(numBlocks, Block{-1, -1, false});
+            }
+            return &table;
+        }
+    }
+
+    mTables.push_back(Table{type, primitiveRestartEnabled,
+                            std::vector<Block>(numBlocks, Block{-1, -1, false})});
+    return &mTables.back();
+}
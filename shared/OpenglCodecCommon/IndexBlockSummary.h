@@ -0,0 +1,77 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef _GL_INDEX_BLOCK_SUMMARY_H_
+#define _GL_INDEX_BLOCK_SUMMARY_H_
+
+#include <GLES/gl.h>
+#include <GLES2/gl2.h>
+
+#include <stddef.h>
+
+#include <vector>
+
+// Per-buffer table of index min/max values for each kBlockBytes chunk of
+// an element buffer's shadow copy. IndexRangeCache only helps for an exact
+// (offset, count) pair seen before; this answers arbitrary subranges by
+// combining the summaries of the chunks fully covered by the range and
+// scanning only the partial chunks at either edge. Chunk summaries are
+// built lazily on first use and dropped when the buffer contents change.
+class IndexBlockSummary {
+public:
+    static constexpr size_t kBlockBytes = 4096;
+
+    // Ranges that cover fewer full chunks than this are cheaper to scan
+    // directly, and findRange declines them.
+    static constexpr size_t kMinQueryBlocks = 2;
+
+    // Computes the inclusive min/max index of |count| indices of |type| at
+    // byte |offset| of |data|, a buffer of |dataSize| bytes, with the same
+    // results as GLUtils::minmaxExcept. Returns false without touching the
+    // outputs if the query is not worth or not possible to answer from
+    // summaries (small, misaligned or out of bounds).
+    bool findRange(const void* data,
+                   size_t dataSize,
+                   GLenum type,
+                   size_t offset,
+                   size_t count,
+                   bool primitiveRestartEnabled,
+                   int* min_out,
+                   int* max_out);
+
+    // Drops the summaries of every chunk touched by [offset, offset + size).
+    void invalidateRange(size_t offset, size_t size);
+    void clear();
+
+private:
+    struct Block {
+        int min;
+        int max;
+        bool valid;
+    };
+
+    // One table per index interpretation of the buffer contents.
+    struct Table {
+        GLenum type;
+        bool primitiveRestartEnabled;
+        std::vector<Block> blocks;
+    };
+
+    Table* getTable(GLenum type, bool primitiveRestartEnabled, size_t dataSize);
+
+    std::vector<Table> mTables;
+};
+
+#endif
@@ -25,10 +25,31 @@ void IndexRangeCache::addRange(GLenum type,
                                bool primitiveRestartEnabled,
                                int start,
                                int end) {
+    IndexRangeKey key(type, offset, count, primitiveRestartEnabled);
     IndexRange r;
     r.start = start;
     r.end = end;
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = r;
+
+    IndexRangeMap::iterator it = mIndexRangeCache.find(key);
+    if (it != mIndexRangeCache.end()) {
+        it->second->range = r;
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        return;
+    }
+
+    mEntries.emplace_front();
+    Entry& e = mEntries.front();
+    e.key = key;
+    e.range = r;
+    e.byteStart = offset;
+    e.byteEnd = offset + count * glSizeof(type);
+    e.priority = nextPriority();
+    mTreeRoot = insertTree(mTreeRoot, &e);
+    mIndexRangeCache[key] = mEntries.begin();
+
+    if (mEntries.size() > kMaxEntries) {
+        eraseEntry(std::prev(mEntries.end()));
+    }
 }
 
 bool IndexRangeCache::findRange(GLenum type,
@@ -36,14 +57,15 @@ bool IndexRangeCache::findRange(GLenum type,
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 int* start_out,
-                                int* end_out) const {
+                                int* end_out) {
     IndexRangeMap::const_iterator it =
         mIndexRangeCache.find(
                 IndexRangeKey(type, offset, count, primitiveRestartEnabled));
 
     if (it != mIndexRangeCache.end()) {
-        if (start_out) *start_out = it->second.start;
-        if (end_out) *end_out = it->second.end;
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        if (start_out) *start_out = it->second->range.start;
+        if (end_out) *end_out = it->second->range.end;
         return true;
     } else {
         if (start_out) *start_out = 0;
@@ -52,28 +74,131 @@ bool IndexRangeCache::findRange(GLenum type,
     }
 }
 
-
 void IndexRangeCache::invalidateRange(size_t offset, size_t size) {
     size_t invalidateStart = offset;
     size_t invalidateEnd = offset + size;
 
-    IndexRangeMap::iterator it = mIndexRangeCache.begin();
-
-    while (it != mIndexRangeCache.end()) {
-        size_t rangeStart = it->first.offset;
-        size_t rangeEnd =
-            it->first.offset +
-            it->first.count * glSizeof(it->first.type);
+    std::vector<Entry*> overlapping;
+    collectOverlapping(mTreeRoot, invalidateStart, invalidateEnd, &overlapping);
 
-        if (invalidateEnd < rangeStart ||
-            invalidateStart > rangeEnd) {
-            ++it;
-        } else {
-            mIndexRangeCache.erase(it++);
-        }
+    for (Entry* e : overlapping) {
+        eraseEntry(mIndexRangeCache.find(e->key)->second);
     }
 }
 
 void IndexRangeCache::clear() {
+    mTreeRoot = nullptr;
     mIndexRangeCache.clear();
+    mEntries.clear();
+}
+
+void IndexRangeCache::eraseEntry(EntryList::iterator it) {
+    mTreeRoot = eraseTree(mTreeRoot, &*it);
+    mIndexRangeCache.erase(it->key);
+    mEntries.erase(it);
+}
+
+uint32_t IndexRangeCache::nextPriority() {
+    // xorshift32; only needs to be cheap and well spread.
+    uint32_t x = mPriorityState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    mPriorityState = x;
+    return x;
+}
+
+// static
+bool IndexRangeCache::entryLess(const Entry* a, const Entry* b) {
+    if (a->byteStart != b->byteStart) return a->byteStart < b->byteStart;
+    return std::less<const Entry*>()(a, b);
+}
+
+// static
+void IndexRangeCache::updateEntry(Entry* e) {
+    size_t maxEnd = e->byteEnd;
+    if (e->left && e->left->subtreeMaxEnd > maxEnd) maxEnd = e->left->subtreeMaxEnd;
+    if (e->right && e->right->subtreeMaxEnd > maxEnd) maxEnd = e->right->subtreeMaxEnd;
+    e->subtreeMaxEnd = maxEnd;
+}
+
+// static
+void IndexRangeCache::splitTree(Entry* t, const Entry* pivot, Entry** l, Entry** r) {
+    if (!t) {
+        *l = nullptr;
+        *r = nullptr;
+        return;
+    }
+    if (entryLess(t, pivot)) {
+        splitTree(t->right, pivot, &t->right, r);
+        *l = t;
+    } else {
+        splitTree(t->left, pivot, l, &t->left);
+        *r = t;
+    }
+    updateEntry(t);
+}
+
+// static
+IndexRangeCache::Entry* IndexRangeCache::mergeTree(Entry* l, Entry* r) {
+    if (!l) return r;
+    if (!r) return l;
+    if (l->priority > r->priority) {
+        l->right = mergeTree(l->right, r);
+        updateEntry(l);
+        return l;
+    }
+    r->left = mergeTree(l, r->left);
+    updateEntry(r);
+    return r;
+}
+
+// static
+IndexRangeCache::Entry* IndexRangeCache::insertTree(Entry* t, Entry* e) {
+    if (!t) {
+        e->left = nullptr;
+        e->right = nullptr;
+        updateEntry(e);
+        return e;
+    }
+    if (e->priority > t->priority) {
+        splitTree(t, e, &e->left, &e->right);
+        updateEntry(e);
+        return e;
+    }
+    if (entryLess(e, t)) {
+        t->left = insertTree(t->left, e);
+    } else {
+        t->right = insertTree(t->right, e);
+    }
+    updateEntry(t);
+    return t;
+}
+
+// static
+IndexRangeCache::Entry* IndexRangeCache::eraseTree(Entry* t, const Entry* e) {
+    if (!t) return nullptr;
+    if (t == e) {
+        return mergeTree(t->left, t->right);
+    }
+    if (entryLess(e, t)) {
+        t->left = eraseTree(t->left, e);
+    } else {
+        t->right = eraseTree(t->right, e);
+    }
+    updateEntry(t);
+    return t;
+}
+
+// Collects every entry whose byte interval touches [start, end]. Subtrees
+// whose maximum end lies before |start| are skipped entirely, and so is
+// everything right of an entry that begins after |end|.
+// static
+void IndexRangeCache::collectOverlapping(Entry* t, size_t start, size_t end,
+                                         std::vector<Entry*>* out) {
+    if (!t || t->subtreeMaxEnd < start) return;
+    collectOverlapping(t->left, start, end, out);
+    if (t->byteStart > end) return;
+    if (t->byteEnd >= start) out->push_back(t);
+    collectOverlapping(t->right, start, end, out);
 }
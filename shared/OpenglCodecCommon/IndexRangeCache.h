@@ -31,7 +31,9 @@
 
 #include "glUtils.h"
 
+#include <list>
 #include <map>
+#include <vector>
 
 struct IndexRange {
     // Inclusive range of indices that are not primitive restart
@@ -42,8 +44,19 @@ struct IndexRange {
     size_t vertexIndexCount; // TODO; not being accounted yet (GLES3 feature)
 };
 
+// Cached ranges are additionally kept in an interval treap ordered by
+// starting byte offset and augmented with the maximum end offset of each
+// subtree, so invalidateRange only visits the O(log n + k) entries that can
+// overlap the written bytes. The cache holds at most kMaxEntries ranges;
+// past that the least recently used range is evicted.
 class IndexRangeCache {
 public:
+    static constexpr size_t kMaxEntries = 512;
+
+    IndexRangeCache() = default;
+    IndexRangeCache(const IndexRangeCache&) = delete;
+    IndexRangeCache& operator=(const IndexRangeCache&) = delete;
+
     void addRange(GLenum type,
                   size_t offset,
                   size_t count,
@@ -55,9 +68,10 @@ public:
                    size_t count,
                    bool primitiveRestartEnabled,
                    int* start_out,
-                   int* end_out) const;
+                   int* end_out);
     void invalidateRange(size_t offset, size_t size);
     void clear();
+    size_t size() const { return mIndexRangeCache.size(); }
 private:
     struct IndexRangeKey {
         IndexRangeKey() :
@@ -92,8 +106,42 @@ private:
         bool primitiveRestartEnabled;
     };
 
-    typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
+    struct Entry {
+        IndexRangeKey key;
+        IndexRange range;
+
+        // Inclusive byte interval covered by the key, as used for
+        // invalidation.
+        size_t byteStart;
+        size_t byteEnd;
+
+        // Interval treap links.
+        Entry* left = nullptr;
+        Entry* right = nullptr;
+        uint32_t priority = 0;
+        size_t subtreeMaxEnd = 0;
+    };
+
+    typedef std::list<Entry> EntryList;
+    typedef std::map<IndexRangeKey, EntryList::iterator> IndexRangeMap;
+
+    static bool entryLess(const Entry* a, const Entry* b);
+    static void updateEntry(Entry* e);
+    static void splitTree(Entry* t, const Entry* pivot, Entry** l, Entry** r);
+    static Entry* mergeTree(Entry* l, Entry* r);
+    static Entry* insertTree(Entry* t, Entry* e);
+    static Entry* eraseTree(Entry* t, const Entry* e);
+    static void collectOverlapping(Entry* t, size_t start, size_t end,
+                                   std::vector<Entry*>* out);
+
+    void eraseEntry(EntryList::iterator it);
+    uint32_t nextPriority();
+
+    // Most recently used entries first.
+    EntryList mEntries;
     IndexRangeMap mIndexRangeCache;
+    Entry* mTreeRoot = nullptr;
+    uint32_t mPriorityState = 0x9e3779b9;
 };
 
 #endif
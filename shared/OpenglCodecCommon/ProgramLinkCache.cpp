@@ -0,0 +1,209 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "ProgramLinkCache.h"
+
+#include <string.h>
+
+namespace {
+
+// Bumped whenever the layout below changes, so that old entries miss.
+const char kKeyPrefix[] = "gl2link1";
+
+// The platform blob cache drops larger values.
+const size_t kMaxValueSize = 64 * 1024;
+
+const uint32_t kMaxVariables = 1u << 16;
+
+void putU32(std::vector<uint8_t>* out, uint32_t value) {
+    const size_t pos = out->size();
+    out->resize(pos + sizeof(value));
+    memcpy(out->data() + pos, &value, sizeof(value));
+}
+
+void putBytes(std::vector<uint8_t>* out, const void* data, size_t size) {
+    putU32(out, (uint32_t)size);
+    const uint8_t* bytes = (const uint8_t*)data;
+    out->insert(out->end(), bytes, bytes + size);
+}
+
+void putVariables(std::vector<uint8_t>* out,
+                  const std::vector<ProgramLinkCache::Variable>& vars) {
+    putU32(out, (uint32_t)vars.size());
+    for (const auto& var : vars) {
+        putU32(out, (uint32_t)var.location);
+        putU32(out, (uint32_t)var.size);
+        putU32(out, var.type);
+        putBytes(out, var.name.data(), var.name.size());
+    }
+}
+
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+    bool getU32(uint32_t* value) {
+        if (m_size - m_pos < sizeof(*value)) return false;
+        memcpy(value, m_data + m_pos, sizeof(*value));
+        m_pos += sizeof(*value);
+        return true;
+    }
+
+    bool getBytes(const uint8_t** data, size_t* size) {
+        uint32_t len;
+        if (!getU32(&len) || m_size - m_pos < len) return false;
+        *data = m_data + m_pos;
+        *size = len;
+        m_pos += len;
+        return true;
+    }
+
+    bool getVariables(std::vector<ProgramLinkCache::Variable>* vars) {
+        uint32_t count;
+        if (!getU32(&count) || count > kMaxVariables) return false;
+        vars->resize(count);
+        for (auto& var : *vars) {
+            uint32_t location, size, type;
+            const uint8_t* name;
+            size_t nameLen;
+            if (!getU32(&location) || !getU32(&size) || !getU32(&type) ||
+                !getBytes(&name, &nameLen)) {
+                return false;
+            }
+            var.location = (GLint)location;
+            var.size = (GLint)size;
+            var.type = type;
+            var.name.assign((const char*)name, nameLen);
+        }
+        return true;
+    }
+
+    bool atEnd() const { return m_pos == m_size; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+std::vector<uint8_t> serialize(const ProgramLinkCache::Entry& entry, bool withBinary) {
+    std::vector<uint8_t> out;
+    putVariables(&out, entry.uniforms);
+    putVariables(&out, entry.attribs);
+    putU32(&out, (uint32_t)entry.activeUniformBlocks);
+    putU32(&out, (uint32_t)entry.transformFeedbackVaryings);
+    putU32(&out, withBinary ? entry.binaryFormat : 0);
+    if (withBinary) {
+        putBytes(&out, entry.binary.data(), entry.binary.size());
+    } else {
+        putBytes(&out, nullptr, 0);
+    }
+    return out;
+}
+
+}  // namespace
+
+// static
+ProgramLinkCache& ProgramLinkCache::get() {
+    static ProgramLinkCache* sCache = new ProgramLinkCache;
+    return *sCache;
+}
+
+void ProgramLinkCache::setBlobFuncs(SetBlobFunc set, GetBlobFunc get) {
+    m_set.store(set, std::memory_order_release);
+    m_get.store(set ? get : nullptr, std::memory_order_release);
+}
+
+// static
+std::string ProgramLinkCache::digest(const std::string& data) {
+    // Two independent 64-bit hashes, as for Vulkan shader modules.
+    uint64_t hash[2] = { 14695981039346656037ULL, 0x9e3779b97f4a7c15ULL ^ data.size() };
+    for (unsigned char c : data) {
+        hash[0] = (hash[0] ^ c) * 1099511628211ULL;
+        hash[1] ^= c + 0x9e3779b97f4a7c15ULL + (hash[1] << 6) + (hash[1] >> 2);
+    }
+    return std::string((const char*)hash, sizeof(hash));
+}
+
+// static
+bool ProgramLinkCache::parseReflection(const void* data, size_t size, GLint* linkStatus,
+                                       Entry* out) {
+    Reader reader((const uint8_t*)data, size);
+    uint32_t status, blocks, varyings;
+    if (!reader.getU32(&status) ||
+        !reader.getVariables(&out->uniforms) ||
+        !reader.getVariables(&out->attribs) ||
+        !reader.getU32(&blocks) || !reader.getU32(&varyings) ||
+        !reader.atEnd()) {
+        return false;
+    }
+    *linkStatus = (GLint)status;
+    out->activeUniformBlocks = (GLint)blocks;
+    out->transformFeedbackVaryings = (GLint)varyings;
+    out->binaryFormat = 0;
+    out->binary.clear();
+    return true;
+}
+
+bool ProgramLinkCache::load(const std::string& key, Entry* out) const {
+    GetBlobFunc get = m_get.load(std::memory_order_acquire);
+    if (!get) return false;
+
+    const std::string fullKey = kKeyPrefix + key;
+    const khronos_ssize_t size = get(fullKey.data(), fullKey.size(), nullptr, 0);
+    if (size <= 0 || (size_t)size > kMaxValueSize) return false;
+
+    std::vector<uint8_t> value(size);
+    if (get(fullKey.data(), fullKey.size(), value.data(), size) != size) return false;
+
+    Reader reader(value.data(), value.size());
+    uint32_t blocks, varyings, format;
+    const uint8_t* binary;
+    size_t binarySize;
+    if (!reader.getVariables(&out->uniforms) ||
+        !reader.getVariables(&out->attribs) ||
+        !reader.getU32(&blocks) || !reader.getU32(&varyings) ||
+        !reader.getU32(&format) || !reader.getBytes(&binary, &binarySize) ||
+        !reader.atEnd()) {
+        return false;
+    }
+    out->activeUniformBlocks = (GLint)blocks;
+    out->transformFeedbackVaryings = (GLint)varyings;
+    out->binaryFormat = format;
+    out->binary.assign(binary, binary + binarySize);
+    return true;
+}
+
+void ProgramLinkCache::store(const std::string& key, const Entry& entry) const {
+    SetBlobFunc set = m_set.load(std::memory_order_acquire);
+    if (!set) return;
+
+    std::vector<uint8_t> value = serialize(entry, !entry.binary.empty());
+    if (value.size() > kMaxValueSize && !entry.binary.empty()) {
+        value = serialize(entry, false);
+    }
+    if (value.size() > kMaxValueSize) return;
+
+    const std::string fullKey = kKeyPrefix + key;
+    set(fullKey.data(), fullKey.size(), value.data(), value.size());
+
+    std::lock_guard<std::mutex> lock(m_verifiedMutex);
+    m_verified.insert(key);
+}
+
+bool ProgramLinkCache::isVerified(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(m_verifiedMutex);
+    return m_verified.count(key) != 0;
+}
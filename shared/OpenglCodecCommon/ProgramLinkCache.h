@@ -0,0 +1,97 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef _PROGRAM_LINK_CACHE_H_
+#define _PROGRAM_LINK_CACHE_H_
+
+#include <GLES2/gl2.h>
+#include <KHR/khrplatform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// What a successful glLinkProgram told the encoder about a program, kept in
+// the EGL_ANDROID_blob_cache storage that the platform gives each app, so
+// that relinking the same shaders on a later launch can skip the host
+// round trips for link status and reflection. Keys are digests of
+// everything that decides the link result, so nothing is cached until the
+// platform has handed over its blob functions.
+class ProgramLinkCache {
+public:
+    // Same as EGLSetBlobFuncANDROID and EGLGetBlobFuncANDROID.
+    typedef void (*SetBlobFunc)(const void* key, khronos_ssize_t keySize,
+                                const void* value, khronos_ssize_t valueSize);
+    typedef khronos_ssize_t (*GetBlobFunc)(const void* key, khronos_ssize_t keySize,
+                                           void* value, khronos_ssize_t valueSize);
+
+    struct Variable {
+        GLint location;
+        GLint size;
+        GLenum type;
+        std::string name;
+    };
+
+    struct Entry {
+        std::vector<Variable> uniforms;
+        std::vector<Variable> attribs;
+        GLint activeUniformBlocks = 0;
+        GLint transformFeedbackVaryings = 0;
+        // A host program binary, if the host gave one; empty otherwise.
+        GLenum binaryFormat = 0;
+        std::vector<uint8_t> binary;
+    };
+
+    static ProgramLinkCache& get();
+
+    void setBlobFuncs(SetBlobFunc set, GetBlobFunc get);
+    bool isEnabled() const { return m_get.load(std::memory_order_acquire) != nullptr; }
+
+    // A fixed size digest of |data|, for building keys out of shader
+    // sources that are too long to be keys themselves.
+    static std::string digest(const std::string& data);
+
+    // Reads a glGetProgramReflectionAEMU response, which is the link status
+    // followed by the same uniform, attribute and count fields as an entry.
+    static bool parseReflection(const void* data, size_t size, GLint* linkStatus,
+                                Entry* out);
+
+    bool load(const std::string& key, Entry* out) const;
+    // Drops the binary if the entry would not fit the platform's value size
+    // limit with it.
+    void store(const std::string& key, const Entry& entry) const;
+
+    // Whether this process has stored the entry for |key| from what the
+    // host answered. An entry left by an earlier launch may come from
+    // another host build than the one the key names, so it is only trusted
+    // once a link of its own has checked it.
+    bool isVerified(const std::string& key) const;
+
+private:
+    ProgramLinkCache() = default;
+
+    std::atomic<SetBlobFunc> m_set = { nullptr };
+    std::atomic<GetBlobFunc> m_get = { nullptr };
+
+    mutable std::mutex m_verifiedMutex;
+    mutable std::unordered_set<std::string> m_verified;
+};
+
+#endif
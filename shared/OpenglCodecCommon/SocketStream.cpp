@@ -24,6 +24,7 @@
 #ifndef _WIN32
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <sys/socket.h>
 #include <sys/un.h>
 #else
 #include <ws2tcpip.h>
@@ -80,9 +81,18 @@ void *SocketStream::allocBuffer(size_t minSize)
         }
     }
 
+    m_bufMemory.set(m_buf ? allocSize : 0);
     return m_buf;
 };
 
+void SocketStream::releaseBuffers()
+{
+    free(m_buf);
+    m_buf = NULL;
+    m_bufsize = initialBufferSize();
+    m_bufMemory.set(0);
+}
+
 int SocketStream::commitBuffer(size_t size)
 {
     return writeFully(m_buf, size);
@@ -110,6 +120,73 @@ int SocketStream::writeFully(const void* buffer, size_t size)
     return retval;
 }
 
+#ifndef _WIN32
+int SocketStream::commitBufferAndWritevFully(size_t size, const struct iovec* iov, int iovcnt)
+{
+    static constexpr int kMaxIov = 16;
+    if (iovcnt + 1 > kMaxIov) {
+        return IOStream::commitBufferAndWritevFully(size, iov, iovcnt);
+    }
+
+    // The stream buffer and the payloads go out in a single sendmsg.
+    struct iovec vec[kMaxIov];
+    int n = 0;
+    if (size) {
+        vec[n].iov_base = m_buf;
+        vec[n].iov_len = size;
+        ++n;
+    }
+    for (int i = 0; i < iovcnt; ++i) {
+        if (iov[i].iov_len) vec[n++] = iov[i];
+    }
+    return n ? sendv(vec, n) : 0;
+}
+
+int SocketStream::sendv(struct iovec* iov, int iovcnt)
+{
+    return sendvFully(iov, iovcnt, 0);
+}
+
+int SocketStream::sendvFully(struct iovec* iov, int iovcnt, int flags, uint32_t* sendCalls)
+{
+    if (!valid()) return -1;
+
+    const int requestedFlags = flags;
+    while (iovcnt > 0) {
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iovcnt;
+
+        ssize_t stat = ::sendmsg(m_sock, &msg, flags);
+        if (stat < 0) {
+            if (errno == EINTR) continue;
+#ifdef MSG_ZEROCOPY
+            // Out of memory to pin pages with; copy this send instead.
+            if (errno == ENOBUFS && (flags & MSG_ZEROCOPY)) {
+                flags &= ~MSG_ZEROCOPY;
+                continue;
+            }
+#endif
+            ERR("%s: failed: %s\n", __FUNCTION__, strerror(errno));
+            return stat;
+        }
+        if (sendCalls && flags == requestedFlags) ++*sendCalls;
+
+        while (iovcnt > 0 && size_t(stat) >= iov->iov_len) {
+            stat -= iov->iov_len;
+            ++iov;
+            --iovcnt;
+        }
+        if (iovcnt > 0) {
+            iov->iov_base = (char *)iov->iov_base + stat;
+            iov->iov_len -= stat;
+        }
+    }
+    return 0;
+}
+#endif
+
 const unsigned char *SocketStream::readFully(void *buf, size_t len)
 {
     if (!valid()) return NULL;
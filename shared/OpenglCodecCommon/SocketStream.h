@@ -16,8 +16,10 @@
 #ifndef __SOCKET_STREAM_H
 #define __SOCKET_STREAM_H
 
+#include <stdint.h>
 #include <stdlib.h>
 #include "IOStream.h"
+#include "aemu/base/MemoryAccounting.h"
 
 class SocketStream : public IOStream {
 public:
@@ -39,13 +41,30 @@ public:
     bool valid() { return m_sock >= 0; }
     virtual int recv(void *buf, size_t len);
     virtual int writeFully(const void *buf, size_t len);
+#ifndef _WIN32
+    virtual int commitBufferAndWritevFully(size_t size, const struct iovec* iov, int iovcnt);
+#endif
 
 protected:
+    virtual void releaseBuffers() override;
+
     int            m_sock;
     size_t         m_bufsize;
     unsigned char *m_buf;
+    android::base::guest::AccountedMemory m_bufMemory{
+        android::base::guest::GraphicsMemory::kStreamBuffers};
 
     SocketStream(int sock, size_t bufSize);
+
+#ifndef _WIN32
+    // Sends the whole of |iov|, which is consumed in the process, with as
+    // few sendmsg calls as the socket allows. The default just calls
+    // sendvFully without flags.
+    virtual int sendv(struct iovec* iov, int iovcnt);
+    // Returns 0 on success. |sendCalls|, if set, receives the number of
+    // sendmsg calls that went out with |flags|.
+    int sendvFully(struct iovec* iov, int iovcnt, int flags, uint32_t* sendCalls = NULL);
+#endif
 };
 
 #endif /* __SOCKET_STREAM_H */
@@ -21,6 +21,9 @@
 
 #include <GLES2/gl2.h>
 #include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 template <class IndexType, bool initialIsTrue>
 class PredicateMap {
@@ -99,6 +102,85 @@ using LastQueryTargetInfo = android::base::HybridComponentManager<1000, uint32_t
 
 using ExistenceMap = PredicateMap<uint32_t, false>;
 
+// Per-context state of GL objects by name. Names are handed out densely from
+// 1, so names below |maxDenseName| index a table directly and only larger
+// ones are hashed. Entries are allocated separately so that pointers to them
+// stay valid as others come and go. Each dense slot counts the objects it
+// has held, so that a cached pointer can be checked against the name with
+// generation().
+template <class T, GLuint maxDenseName = 4096>
+class DenseNameTable {
+public:
+    T* get(GLuint name) {
+        if (name < maxDenseName) {
+            return name < mDense.size() ? mDense[name].value.get() : nullptr;
+        }
+        auto it = mSparse.find(name);
+        return it == mSparse.end() ? nullptr : it->second.get();
+    }
+
+    const T* get(GLuint name) const {
+        return const_cast<DenseNameTable*>(this)->get(name);
+    }
+
+    bool contains(GLuint name) const { return get(name) != nullptr; }
+
+    // Changes whenever |name| is deleted. Always 0 for names above the table.
+    uint32_t generation(GLuint name) const {
+        return name < mDense.size() ? mDense[name].generation : 0;
+    }
+
+    // Replaces whatever |name| held.
+    template <class... Args>
+    T& emplace(GLuint name, Args&&... args) {
+        std::unique_ptr<T> value(new T(std::forward<Args>(args)...));
+        T& res = *value;
+        if (name < maxDenseName) {
+            if (name >= mDense.size()) mDense.resize(name + 1);
+            mDense[name].value = std::move(value);
+        } else {
+            mSparse[name] = std::move(value);
+        }
+        return res;
+    }
+
+    T& operator[](GLuint name) {
+        T* res = get(name);
+        return res ? *res : emplace(name);
+    }
+
+    void erase(GLuint name) {
+        if (name < maxDenseName) {
+            if (name >= mDense.size() || !mDense[name].value) return;
+            mDense[name].value.reset();
+            ++mDense[name].generation;
+        } else {
+            mSparse.erase(name);
+        }
+    }
+
+    // Calls f(name, value) on every entry, in no particular order, for as
+    // long as it returns true.
+    template <class F>
+    void forEach(F&& f) {
+        for (GLuint name = 0; name < mDense.size(); ++name) {
+            if (mDense[name].value && !f(name, *mDense[name].value)) return;
+        }
+        for (auto& it : mSparse) {
+            if (!f(it.first, *it.second)) return;
+        }
+    }
+
+private:
+    struct Slot {
+        uint32_t generation = 0;
+        std::unique_ptr<T> value;
+    };
+
+    std::vector<Slot> mDense;
+    std::unordered_map<GLuint, std::unique_ptr<T>> mSparse;
+};
+
 struct RboProps {
     GLenum format;
     GLsizei multisamples;
@@ -24,10 +24,21 @@
 #ifndef _WIN32
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
 #else
 #include <ws2tcpip.h>
 #endif
 
+#if defined(__linux__) && defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+#include <linux/errqueue.h>
+#define TCPSTREAM_HAS_ZEROCOPY 1
+#endif
+
+#if defined(__linux__) && defined(TCP_CORK)
+#define TCPSTREAM_HAS_CORK 1
+#endif
+
 static int _socket_loopback_server(int port, int type)
 {
     struct sockaddr_in addr;
@@ -65,18 +76,23 @@ TcpStream::TcpStream(size_t bufSize) :
 {
 }
 
-TcpStream::TcpStream(int sock, size_t bufSize) :
-    SocketStream(sock, bufSize)
+static void _set_socket_option(int sock, int level, int name, int value)
 {
-    // disable Nagle algorithm to improve bandwidth of small
-    // packets which are quite common in our implementation.
 #ifdef _WIN32
     DWORD  flag;
 #else
     int    flag;
 #endif
-    flag = 1;
-    setsockopt( sock, IPPROTO_TCP, TCP_NODELAY, (const char*)&flag, sizeof(flag) );
+    flag = value;
+    setsockopt( sock, level, name, (const char*)&flag, sizeof(flag) );
+}
+
+TcpStream::TcpStream(int sock, size_t bufSize) :
+    SocketStream(sock, bufSize)
+{
+    // disable Nagle algorithm to improve bandwidth of small
+    // packets which are quite common in our implementation.
+    _set_socket_option(sock, IPPROTO_TCP, TCP_NODELAY, 1);
 }
 
 int TcpStream::listen(unsigned short port)
@@ -119,5 +135,148 @@ int TcpStream::connect(const char* hostname, unsigned short port)
 {
     m_sock = socket_network_client(hostname, port, SOCK_STREAM);
     if (!valid()) return -1;
+    // Same as for accepted sockets; the guest end sends most of the
+    // small packets.
+    _set_socket_option(m_sock, IPPROTO_TCP, TCP_NODELAY, 1);
     return 0;
 }
+
+void TcpStream::setOptions(const Options& options)
+{
+    if (!valid()) return;
+    m_options = options;
+
+    if (m_options.sendBufferSize > 0) {
+        _set_socket_option(m_sock, SOL_SOCKET, SO_SNDBUF, m_options.sendBufferSize);
+    }
+#ifdef TCPSTREAM_HAS_CORK
+    _set_socket_option(m_sock, IPPROTO_TCP, TCP_CORK, m_options.cork ? 1 : 0);
+#else
+    m_options.cork = false;
+#endif
+#ifdef TCPSTREAM_HAS_ZEROCOPY
+    int one = 1;
+    if (m_options.zeroCopyThreshold &&
+        setsockopt(m_sock, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) < 0) {
+        ERR("%s: SO_ZEROCOPY not supported: %s\n", __FUNCTION__, strerror(errno));
+        m_options.zeroCopyThreshold = 0;
+    }
+#else
+    m_options.zeroCopyThreshold = 0;
+#endif
+}
+
+void TcpStream::uncork()
+{
+#ifdef TCPSTREAM_HAS_CORK
+    if (!m_corkedData) return;
+    // Clearing TCP_CORK sends any partial segment right away.
+    _set_socket_option(m_sock, IPPROTO_TCP, TCP_CORK, 0);
+    _set_socket_option(m_sock, IPPROTO_TCP, TCP_CORK, 1);
+    m_corkedData = false;
+#endif
+}
+
+int TcpStream::commitBuffer(size_t size)
+{
+    // A flush has to reach the host even if nothing is read back after it.
+    int stat = SocketStream::commitBuffer(size);
+    uncork();
+    return stat;
+}
+
+int TcpStream::writeFully(const void *buf, size_t len)
+{
+    if (m_options.cork) m_corkedData = true;
+    return SocketStream::writeFully(buf, len);
+}
+
+const unsigned char *TcpStream::readFully(void *buf, size_t len)
+{
+    // The host cannot answer a request it has not received yet.
+    uncork();
+    return SocketStream::readFully(buf, len);
+}
+
+const unsigned char *TcpStream::read(void *buf, size_t *inout_len)
+{
+    uncork();
+    return SocketStream::read(buf, inout_len);
+}
+
+void TcpStream::onFrameBoundary()
+{
+    uncork();
+}
+
+#ifndef _WIN32
+int TcpStream::sendv(struct iovec* iov, int iovcnt)
+{
+    if (m_options.cork) m_corkedData = true;
+
+#ifdef TCPSTREAM_HAS_ZEROCOPY
+    if (m_options.zeroCopyThreshold) {
+        size_t total = 0;
+        for (int i = 0; i < iovcnt; ++i) total += iov[i].iov_len;
+        if (total >= m_options.zeroCopyThreshold) {
+            int stat = sendvFully(iov, iovcnt, MSG_ZEROCOPY, &m_zeroCopySent);
+            waitForZeroCopy();
+            return stat;
+        }
+    }
+#endif
+    return sendvFully(iov, iovcnt, 0);
+}
+#endif
+
+void TcpStream::waitForZeroCopy()
+{
+#ifdef TCPSTREAM_HAS_ZEROCOPY
+    // Each zerocopy sendmsg gets the next 32-bit sequence number, and the
+    // kernel reports finished ones as inclusive ranges on the error queue.
+    // Completion needs the data to be acknowledged, so data still held by
+    // TCP_CORK has to go out first.
+    uncork();
+    bool copied = false;
+    while (m_zeroCopyDone != m_zeroCopySent) {
+        struct pollfd pfd;
+        pfd.fd = m_sock;
+        pfd.events = 0;
+        pfd.revents = 0;
+        if (::poll(&pfd, 1, -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (!(pfd.revents & POLLERR)) break;  // hung up; nothing will complete
+
+        char control[128];
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if (::recvmsg(m_sock, &msg, MSG_ERRQUEUE) < 0) {
+            if (errno == EINTR || errno == EAGAIN) continue;
+            break;
+        }
+        for (struct cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm)) {
+            if (!(cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) &&
+                !(cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR)) {
+                continue;
+            }
+            const struct sock_extended_err* err =
+                reinterpret_cast<const struct sock_extended_err*>(CMSG_DATA(cm));
+            if (err->ee_errno != 0 || err->ee_origin != SO_EE_ORIGIN_ZEROCOPY) continue;
+            m_zeroCopyDone += err->ee_data - err->ee_info + 1;
+            if (err->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) copied = true;
+        }
+    }
+    m_zeroCopyDone = m_zeroCopySent;
+
+    // The kernel fell back to copying, as it does over loopback or on
+    // devices without scatter-gather; waiting for acks only adds latency.
+    if (copied) {
+        ERR("%s: kernel copied zerocopy sends, disabling MSG_ZEROCOPY\n", __FUNCTION__);
+        m_options.zeroCopyThreshold = 0;
+    }
+#endif
+}
@@ -20,13 +20,51 @@
 
 class TcpStream : public SocketStream {
 public:
+    // Tuning for high bandwidth links; everything is off by default.
+    struct Options {
+        // Hold partial segments back with TCP_CORK until the next flush,
+        // read or frame boundary (Linux only).
+        bool cork = false;
+        // Send vectored writes of at least this many bytes with
+        // MSG_ZEROCOPY (Linux only); 0 never does.
+        size_t zeroCopyThreshold = 0;
+        // SO_SNDBUF in bytes; 0 keeps the system default.
+        int sendBufferSize = 0;
+    };
+
     explicit TcpStream(size_t bufsize = 10000);
     virtual int listen(unsigned short port);
     virtual SocketStream *accept();
     virtual int connect(unsigned short port);
     int connect(const char* hostname, unsigned short port);
+
+    // Call once connected.
+    void setOptions(const Options& options);
+
+    virtual int commitBuffer(size_t size);
+    virtual int writeFully(const void *buf, size_t len);
+    virtual const unsigned char *readFully(void *buf, size_t len);
+    virtual const unsigned char *read(void *buf, size_t *inout_len);
+    virtual void onFrameBoundary();
+
+protected:
+#ifndef _WIN32
+    virtual int sendv(struct iovec* iov, int iovcnt);
+#endif
+
 private:
     TcpStream(int sock, size_t bufSize);
+
+    // Sends out everything held back by TCP_CORK.
+    void uncork();
+    // Blocks until the kernel is done with all MSG_ZEROCOPY sends, so the
+    // caller can reuse the memory they came from.
+    void waitForZeroCopy();
+
+    Options m_options;
+    bool m_corkedData = false;
+    uint32_t m_zeroCopySent = 0;
+    uint32_t m_zeroCopyDone = 0;
 };
 
 #endif
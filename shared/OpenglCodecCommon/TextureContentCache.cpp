@@ -0,0 +1,242 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "TextureContentCache.h"
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#define TEXTURE_CONTENT_HASH_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define TEXTURE_CONTENT_HASH_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+// The hash follows XXH3: eight 64-bit lanes each add a 32x32 bit product of
+// the input mixed with a secret, plus the input of the neighbouring lane.
+// That is two vector multiplies per 64 byte stripe on SSE2 and NEON, and all
+// implementations give the same result.
+
+constexpr size_t kLanes = 8;
+constexpr size_t kStripeSize = kLanes * sizeof(uint64_t);
+// Stripes between scrambles of the accumulators.
+constexpr size_t kStripesPerBlock = 16;
+
+alignas(16) constexpr uint64_t kSecret[kLanes] = {
+    0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL,
+    0xdb979083e96dd4deULL, 0x1f67b3b7a4a44072ULL,
+    0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL,
+    0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL,
+};
+
+constexpr uint64_t kMergeSecret[2][kLanes] = {
+    { 0xcb00c391bb52283cULL, 0xa32e531b8b65d088ULL,
+      0x4ef90da297486471ULL, 0xd8acdea946ef1938ULL,
+      0x3f349ce33f76faa8ULL, 0x1d4f0bc7c7bbdcf9ULL,
+      0x3159b4cd4be0518aULL, 0x647378d9c97e9fc8ULL },
+    { 0xc3ebd33483acc5eaULL, 0xeb6313faffa081c5ULL,
+      0x49daf0b751dd0d17ULL, 0x9e68d429265516d3ULL,
+      0xfca1477d58be162bULL, 0xce31d07ad1b8f88fULL,
+      0x280416958f3acb45ULL, 0x7e404bbbcafbd7afULL },
+};
+
+constexpr uint64_t kPrime32 = 0x9e3779b1ULL;
+constexpr uint64_t kPrime64 = 0x9e3779b185ebca87ULL;
+
+inline void accumulateScalar(uint64_t* acc, const uint8_t* stripe) {
+    for (size_t i = 0; i < kLanes; ++i) {
+        uint64_t data;
+        memcpy(&data, stripe + i * sizeof(data), sizeof(data));
+        const uint64_t keyed = data ^ kSecret[i];
+        acc[i ^ 1] += data;
+        acc[i] += (keyed & 0xffffffffULL) * (keyed >> 32);
+    }
+}
+
+#if defined(TEXTURE_CONTENT_HASH_SSE2)
+
+void accumulate(uint64_t* acc, const uint8_t* stripes, size_t count) {
+    __m128i v[kLanes / 2];
+    for (size_t j = 0; j < kLanes / 2; ++j) {
+        v[j] = _mm_loadu_si128((const __m128i*)(acc + 2 * j));
+    }
+    for (size_t n = 0; n < count; ++n) {
+        const uint8_t* stripe = stripes + n * kStripeSize;
+        for (size_t j = 0; j < kLanes / 2; ++j) {
+            const __m128i data = _mm_loadu_si128((const __m128i*)(stripe + 16 * j));
+            const __m128i keyed = _mm_xor_si128(data, _mm_load_si128((const __m128i*)(kSecret + 2 * j)));
+            const __m128i product = _mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32));
+            const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            v[j] = _mm_add_epi64(v[j], _mm_add_epi64(product, swapped));
+        }
+    }
+    for (size_t j = 0; j < kLanes / 2; ++j) {
+        _mm_storeu_si128((__m128i*)(acc + 2 * j), v[j]);
+    }
+}
+
+#elif defined(TEXTURE_CONTENT_HASH_NEON)
+
+void accumulate(uint64_t* acc, const uint8_t* stripes, size_t count) {
+    uint64x2_t v[kLanes / 2];
+    for (size_t j = 0; j < kLanes / 2; ++j) {
+        v[j] = vld1q_u64(acc + 2 * j);
+    }
+    for (size_t n = 0; n < count; ++n) {
+        const uint8_t* stripe = stripes + n * kStripeSize;
+        for (size_t j = 0; j < kLanes / 2; ++j) {
+            const uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(stripe + 16 * j));
+            const uint64x2_t keyed = veorq_u64(data, vld1q_u64(kSecret + 2 * j));
+            const uint64x2_t product = vmull_u32(vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+            const uint64x2_t swapped = vextq_u64(data, data, 1);
+            v[j] = vaddq_u64(v[j], vaddq_u64(product, swapped));
+        }
+    }
+    for (size_t j = 0; j < kLanes / 2; ++j) {
+        vst1q_u64(acc + 2 * j, v[j]);
+    }
+}
+
+#else
+
+void accumulate(uint64_t* acc, const uint8_t* stripes, size_t count) {
+    for (size_t n = 0; n < count; ++n) {
+        accumulateScalar(acc, stripes + n * kStripeSize);
+    }
+}
+
+#endif
+
+void scramble(uint64_t* acc) {
+    for (size_t i = 0; i < kLanes; ++i) {
+        acc[i] = ((acc[i] ^ (acc[i] >> 47)) ^ kSecret[i]) * kPrime32;
+    }
+}
+
+// The high and low halves of a 64x64 bit product, xored together.
+uint64_t mulFold64(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t product = (__uint128_t)a * b;
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+#else
+    const uint64_t aLo = a & 0xffffffffULL, aHi = a >> 32;
+    const uint64_t bLo = b & 0xffffffffULL, bHi = b >> 32;
+    const uint64_t loLo = aLo * bLo;
+    const uint64_t hiLo = aHi * bLo;
+    const uint64_t loHi = aLo * bHi;
+    const uint64_t hiHi = aHi * bHi;
+    const uint64_t cross = (loLo >> 32) + (hiLo & 0xffffffffULL) + loHi;
+    const uint64_t hi = hiHi + (hiLo >> 32) + (cross >> 32);
+    const uint64_t lo = (cross << 32) | (loLo & 0xffffffffULL);
+    return lo ^ hi;
+#endif
+}
+
+uint64_t avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= 0x165667919e3779f9ULL;
+    return h ^ (h >> 32);
+}
+
+uint64_t merge(const uint64_t* acc, const uint64_t* secret, uint64_t start) {
+    uint64_t h = start;
+    for (size_t i = 0; i < kLanes; i += 2) {
+        h += mulFold64(acc[i] ^ secret[i], acc[i + 1] ^ secret[i + 1]);
+    }
+    return avalanche(h);
+}
+
+// Payloads seen but not stored cost nothing on the host, so this only
+// bounds the guest's memory.
+constexpr size_t kMaxEntries = 4096;
+
+}  // namespace
+
+TextureContentCache::TextureContentCache(size_t budget) : m_budget(budget) {}
+
+// static
+TextureContentCache::Key TextureContentCache::makeKey(const void* data, size_t size) {
+    uint64_t acc[kLanes] = {
+        kPrime32, kPrime64, 0xc2b2ae3d27d4eb4fULL, 0x165667b19e3779f9ULL,
+        0x85ebca77c2b2ae63ULL, 0x85ebca77ULL, 0x27d4eb2f165667c5ULL, kPrime32 ^ size,
+    };
+
+    const uint8_t* bytes = (const uint8_t*)data;
+    size_t stripes = size / kStripeSize;
+    while (stripes > 0) {
+        const size_t count = stripes < kStripesPerBlock ? stripes : kStripesPerBlock;
+        accumulate(acc, bytes, count);
+        bytes += count * kStripeSize;
+        stripes -= count;
+        scramble(acc);
+    }
+
+    const size_t rest = size % kStripeSize;
+    if (rest) {
+        uint8_t last[kStripeSize] = {};
+        memcpy(last, bytes, rest);
+        accumulateScalar(acc, last);
+    }
+
+    Key key;
+    key.hash[0] = merge(acc, kMergeSecret[0], size * kPrime64);
+    key.hash[1] = merge(acc, kMergeSecret[1], ~size * kPrime32);
+    key.size = size;
+    return key;
+}
+
+TextureContentCache::Action TextureContentCache::lookup(const Key& key, GLuint* content,
+                                                        std::vector<GLuint>* released) {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        m_lru.push_front(key);
+        m_entries[key].lru = m_lru.begin();
+        evict(released);
+        return Action::Upload;
+    }
+
+    Entry& entry = it->second;
+    m_lru.splice(m_lru.begin(), m_lru, entry.lru);
+    if (entry.content) {
+        *content = entry.content;
+        return Action::Reuse;
+    }
+    if (key.size > m_budget) {
+        return Action::Upload;
+    }
+
+    entry.content = m_nextContent++;
+    if (!m_nextContent) m_nextContent = 1;
+    m_stored += key.size;
+    *content = entry.content;
+    // The payload just stored is the most recent, so it fits and stays.
+    evict(released);
+    return Action::Store;
+}
+
+void TextureContentCache::evict(std::vector<GLuint>* released) {
+    while (m_stored > m_budget || m_entries.size() > kMaxEntries) {
+        auto it = m_entries.find(m_lru.back());
+        if (it->second.content) {
+            released->push_back(it->second.content);
+            m_stored -= it->first.size;
+        }
+        m_entries.erase(it);
+        m_lru.pop_back();
+    }
+}
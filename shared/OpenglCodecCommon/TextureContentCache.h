@@ -0,0 +1,88 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef _TEXTURE_CONTENT_CACHE_H_
+#define _TEXTURE_CONTENT_CACHE_H_
+
+#include <GLES2/gl2.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// Remembers the texture image payloads that an encoder uploaded, by content
+// hash, so that uploading the same bytes again can refer to a copy that the
+// host keeps instead of resending them. Payloads are only stored on the
+// host the second time they are seen, so one-off uploads cost a hash and
+// nothing on the host. The host copies belong to one encoder's stream,
+// which keeps them ordered with the uploads that use them.
+class TextureContentCache {
+public:
+    struct Key {
+        uint64_t hash[2];
+        size_t size;
+
+        bool operator==(const Key& other) const {
+            return hash[0] == other.hash[0] && hash[1] == other.hash[1] &&
+                   size == other.size;
+        }
+    };
+
+    enum class Action {
+        // Send the bytes as usual.
+        Upload,
+        // Store the bytes on the host under the content, then upload from it.
+        Store,
+        // The host has the bytes; upload from the content.
+        Reuse,
+    };
+
+    // |budget| bounds the bytes kept on the host.
+    explicit TextureContentCache(size_t budget);
+
+    // 128 bits of a fast non-cryptographic hash of |data|, with its size.
+    static Key makeKey(const void* data, size_t size);
+
+    // Decides how to send an upload of the payload |key| was made from.
+    // For Store and Reuse, |content| is set to the host content to upload
+    // from. Host contents evicted to make room are added to |released|,
+    // for the caller to release on the host before storing.
+    Action lookup(const Key& key, GLuint* content, std::vector<GLuint>* released);
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const { return (size_t)key.hash[0]; }
+    };
+
+    struct Entry {
+        // Zero while the payload was only seen.
+        GLuint content = 0;
+        std::list<Key>::iterator lru;
+    };
+
+    void evict(std::vector<GLuint>* released);
+
+    const size_t m_budget;
+    size_t m_stored = 0;
+    GLuint m_nextContent = 1;
+    std::unordered_map<Key, Entry, KeyHash> m_entries;
+    // Most recently used first.
+    std::list<Key> m_lru;
+};
+
+#endif
@@ -17,6 +17,8 @@
 #define _GL_TEXTURE_SHARED_DATA_H_
 
 #include <GLES/gl.h>
+#include <stdint.h>
+#include <atomic>
 #include <map>
 #include <memory>
 
@@ -57,6 +59,9 @@ struct SharedTextureDataMap {
 
   MapType map;
   ReadWriteLock lock;
+  // Bumped by every glDeleteTextures in the share group, after which any
+  // texture name a context remembers may have been reused.
+  std::atomic<uint64_t> deletions{0};
 };
 
 #endif
@@ -437,6 +437,31 @@ void etc2_decode_rgb_block(const etc1_byte* pIn, bool isPunchthroughAlpha,
                     isPunchthroughAlpha, opaque);
 }
 
+// R11 texels as floats, indexed by the clamped 11 bit value. Dividing per
+// texel costs more than the rest of the decode.
+static const float* unsignedR11ToFloat() {
+    static const float* sTable = []() {
+        static float table[2048];
+        for (int i = 0; i < 2048; i++) {
+            table[i] = (float)i / 2047.0;
+        }
+        return table;
+    }();
+    return sTable;
+}
+
+// Signed R11 texels as floats, indexed by the clamped value plus 1023.
+static const float* signedR11ToFloat() {
+    static const float* sTable = []() {
+        static float table[2047];
+        for (int i = 0; i < 2047; i++) {
+            table[i] = (float)(i - 1023) / 1023.0;
+        }
+        return table;
+    }();
+    return sTable;
+}
+
 void eac_decode_single_channel_block(const etc1_byte* pIn,
                                      int decodedElementBytes, bool isSigned,
                                      etc1_byte* pOut) {
@@ -447,29 +472,21 @@ void eac_decode_single_channel_block(const etc1_byte* pIn,
     int multiplier = pIn[1] >> 4;
     int tblIdx = pIn[1] & 15;
     const int* table = kAlphaModifierTable + tblIdx * 8;
-    const etc1_byte* p = pIn + 2;
-    // position in a byte of the next 3-bit index:
-    // | a a a | b b b | c c c | d d d ...
-    // | byte               | byte...
-    int bitOffset = 5;
+    // The 16 3-bit indices, most significant first.
+    uint64_t indices = 0;
+    for (int i = 2; i < 8; i++) {
+        indices = (indices << 8) | pIn[i];
+    }
+    const float* toFloat = nullptr;
+    if (decodedElementBytes == 4) {
+        toFloat = isSigned ? signedR11ToFloat() : unsignedR11ToFloat();
+    }
     for (int i = 0; i < 16; i ++) {
         // flip x, y in output
         int outIdx = (i % 4) * 4 + i / 4;
         etc1_byte* q = pOut + outIdx * decodedElementBytes;
 
-        int modifier = 0;
-        if (bitOffset < 0) { // (Part of) the index is in the next byte.
-            modifier += p[0] << (-bitOffset);
-            p ++;
-            bitOffset += 8;
-        }
-        modifier += p[0] >> bitOffset;
-        modifier &= 7;
-        bitOffset -= 3; // move to the next index
-        if (bitOffset == -3) {
-            bitOffset = 5;
-            p++;
-        }
+        int modifier = (indices >> (45 - 3 * i)) & 7;
         int modifierValue = table[modifier];
         int decoded = base_codeword + modifierValue * multiplier;
         if (decodedElementBytes == 1) {
@@ -481,11 +498,11 @@ void eac_decode_single_channel_block(const etc1_byte* pIn,
             }
             if (isSigned) {
                 decoded = clampSigned1023(decoded);
-                reinterpret_cast<float*>(q)[0] = (float)decoded / 1023.0;
+                reinterpret_cast<float*>(q)[0] = toFloat[decoded + 1023];
             } else {
                 decoded += 4;
                 decoded = clamp2047(decoded);
-                reinterpret_cast<float*>(q)[0] = (float)decoded / 2047.0;
+                reinterpret_cast<float*>(q)[0] = toFloat[decoded];
             }
         }
     }
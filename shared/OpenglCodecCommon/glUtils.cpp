@@ -14,12 +14,18 @@
 * limitations under the License.
 */
 #include "glUtils.h"
+#include <stdint.h>
 #include <string.h>
 #include "ErrorLog.h"
 #include <IOStream.h>
 
 #include <GLES3/gl31.h>
 
+#if defined(__i386__) || defined(__x86_64__)
+#define GLUTILS_GATHER_X86 1
+#include <immintrin.h>
+#endif
+
 bool isSamplerType(GLenum type) {
     switch (type) {
         case GL_SAMPLER_2D:
@@ -869,6 +875,80 @@ size_t glUtilsParamSize(GLenum param)
     return s;
 }
 
+// Strided gather with the element size known at compile time, so each
+// copy becomes a single load/store pair instead of a memcpy call.
+template <unsigned int N>
+static void gatherFixed(unsigned char *dst, const unsigned char *src,
+                        unsigned int stride, unsigned int datalen)
+{
+    for (unsigned int i = 0; i + N <= datalen; i += N) {
+        memcpy(dst, src, N);
+        dst += N;
+        src += stride;
+    }
+}
+
+#ifdef GLUTILS_GATHER_X86
+
+// AVX2 gathers of 4 and 8 byte elements, e.g. GL_FIXED or half float
+// pairs and quads, eight and four vertices per instruction. Each lane reads
+// exactly one element, so nothing past the array is touched; what does not
+// fill a vector is left to gatherFixed.
+__attribute__((target("avx2")))
+static unsigned int gather4Avx2(unsigned char *dst, const unsigned char *src,
+                                unsigned int stride, unsigned int datalen)
+{
+    const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                               _mm256_set1_epi32((int)stride));
+    unsigned int done = 0;
+    for (; done + 32 <= datalen; done += 32) {
+        _mm256_storeu_si256((__m256i*)(dst + done),
+                            _mm256_i32gather_epi32((const int*)src, offsets, 1));
+        src += 8 * (size_t)stride;
+    }
+    return done;
+}
+
+__attribute__((target("avx2")))
+static unsigned int gather8Avx2(unsigned char *dst, const unsigned char *src,
+                                unsigned int stride, unsigned int datalen)
+{
+    const __m128i offsets = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3),
+                                            _mm_set1_epi32((int)stride));
+    unsigned int done = 0;
+    for (; done + 32 <= datalen; done += 32) {
+        _mm256_storeu_si256((__m256i*)(dst + done),
+                            _mm256_i32gather_epi64((const long long*)src, offsets, 1));
+        src += 4 * (size_t)stride;
+    }
+    return done;
+}
+
+static bool hasAvx2Gather()
+{
+    static const bool sHasAvx2 = __builtin_cpu_supports("avx2");
+    return sHasAvx2;
+}
+
+#endif  // GLUTILS_GATHER_X86
+
+// Gathers with vector instructions where the CPU has them, then finishes
+// what is left with the scalar copy. Vector offsets are 32 bit, so absurd
+// strides stay scalar.
+template <unsigned int N>
+static void gatherVector(unsigned char *dst, const unsigned char *src,
+                         unsigned int stride, unsigned int datalen)
+{
+    unsigned int done = 0;
+#ifdef GLUTILS_GATHER_X86
+    if (stride <= 0x0fffffff && hasAvx2Gather()) {
+        done = N == 4 ? gather4Avx2(dst, src, stride, datalen)
+                      : gather8Avx2(dst, src, stride, datalen);
+    }
+#endif
+    gatherFixed<N>(dst + done, src + (size_t)(done / N) * stride, stride, datalen - done);
+}
+
 void glUtilsPackPointerData(unsigned char *dst, unsigned char *src,
                      int size, GLenum type, unsigned int stride,
                      unsigned int datalen)
@@ -887,13 +967,30 @@ void glUtilsPackPointerData(unsigned char *dst, unsigned char *src,
 
     if (stride == vsize) {
         memcpy(dst, src, datalen);
-    } else {
-        for (unsigned int i = 0; i < datalen; i += vsize) {
-            memcpy(dst, src, vsize);
-            dst += vsize;
-            src += stride;
+        return;
+    }
+
+    // Client arrays are almost always interleaved float, GL_FIXED or half
+    // float attributes of 1-4 components; gather those without a per-vertex
+    // memcpy call.
+    if (datalen % vsize == 0) {
+        switch (vsize) {
+        case 2: gatherFixed<2>(dst, src, stride, datalen); return;
+        case 3: gatherFixed<3>(dst, src, stride, datalen); return;
+        case 4: gatherVector<4>(dst, src, stride, datalen); return;
+        case 6: gatherFixed<6>(dst, src, stride, datalen); return;
+        case 8: gatherVector<8>(dst, src, stride, datalen); return;
+        case 12: gatherFixed<12>(dst, src, stride, datalen); return;
+        case 16: gatherFixed<16>(dst, src, stride, datalen); return;
+        default: break;
         }
     }
+
+    for (unsigned int i = 0; i < datalen; i += vsize) {
+        memcpy(dst, src, vsize);
+        dst += vsize;
+        src += stride;
+    }
 }
 
 void glUtilsWritePackPointerData(void* _stream, unsigned char *src,
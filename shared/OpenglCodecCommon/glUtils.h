@@ -120,6 +120,39 @@ namespace GLUtils {
         }
     }
 
+    // Vectorized index range scanning for the index types accepted by
+    // glDrawElements. The templates above remain the scalar reference;
+    // these overloads are preferred for exact matches and dispatch to the
+    // widest implementation the CPU supports, picked once at runtime.
+    enum class IndexScanImpl {
+        Scalar,
+        SSE41,
+        AVX2,
+        NEON,
+    };
+
+    bool isIndexScanImplSupported(IndexScanImpl impl);
+    IndexScanImpl bestIndexScanImpl();
+
+    void minmaxExcept(const unsigned char *indices, int count, int *min, int *max,
+                      bool shouldExclude, unsigned char whatExclude);
+    void minmaxExcept(const unsigned short *indices, int count, int *min, int *max,
+                      bool shouldExclude, unsigned short whatExclude);
+    void minmaxExcept(const unsigned int *indices, int count, int *min, int *max,
+                      bool shouldExclude, unsigned int whatExclude);
+
+    // Same as above with an explicit implementation, for benchmarks.
+    // |impl| must be supported on the running CPU.
+    void minmaxExcept(IndexScanImpl impl,
+                      const unsigned char *indices, int count, int *min, int *max,
+                      bool shouldExclude, unsigned char whatExclude);
+    void minmaxExcept(IndexScanImpl impl,
+                      const unsigned short *indices, int count, int *min, int *max,
+                      bool shouldExclude, unsigned short whatExclude);
+    void minmaxExcept(IndexScanImpl impl,
+                      const unsigned int *indices, int count, int *min, int *max,
+                      bool shouldExclude, unsigned int whatExclude);
+
     template <class T> void shiftIndices(T *indices, int count,  int offset) {
         T *ptr = indices;
         for (int i = 0; i < count; i++) {
@@ -170,6 +203,15 @@ namespace GLUtils {
         }
     }
 
+    // Vectorized overloads of the copying shiftIndicesExcept above, used to
+    // write recentered client indices straight into the command stream.
+    void shiftIndicesExcept(const unsigned char *src, unsigned char *dst, int count, int offset,
+                            bool shouldExclude, unsigned char whatExclude);
+    void shiftIndicesExcept(const unsigned short *src, unsigned short *dst, int count, int offset,
+                            bool shouldExclude, unsigned short whatExclude);
+    void shiftIndicesExcept(const unsigned int *src, unsigned int *dst, int count, int offset,
+                            bool shouldExclude, unsigned int whatExclude);
+
     template<class T> T primitiveRestartIndex() {
         return -1;
     }
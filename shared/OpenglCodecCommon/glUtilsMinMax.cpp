@@ -0,0 +1,380 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+// SIMD implementations of GLUtils::minmaxExcept and the copying
+// GLUtils::shiftIndicesExcept for u8/u16/u32 indices.
+//
+// Every kernel tracks unsigned running minimum and maximum vectors. When
+// primitive restart is enabled, lanes equal to the restart index are forced
+// to all-ones before the min and to zero before the max, so they never win.
+// If every index was excluded (or count is 0) the minimum ends up above the
+// maximum, which is reported as the same (-1, -1) the scalar path returns.
+//
+// The shift kernels add the offset with wrapping lane arithmetic and blend
+// the untouched restart indices back in, matching the scalar templates.
+
+#include "glUtils.h"
+
+#include <stdint.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#define GLUTILS_INDEX_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#define GLUTILS_INDEX_SCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace GLUtils {
+namespace {
+
+template <class T>
+using ScanFn = void (*)(const T* indices, int count,
+                        bool shouldExclude, T whatExclude,
+                        T* lo_out, T* hi_out);
+
+template <class T>
+using ShiftFn = void (*)(const T* src, T* dst, int count, int offset,
+                         bool shouldExclude, T whatExclude);
+
+template <class T>
+void scanScalar(const T* indices, int count,
+                bool shouldExclude, T whatExclude,
+                T* lo_out, T* hi_out) {
+    T lo = *lo_out;
+    T hi = *hi_out;
+    for (int i = 0; i < count; i++) {
+        T v = indices[i];
+        if (shouldExclude && v == whatExclude) continue;
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    *lo_out = lo;
+    *hi_out = hi;
+}
+
+// The loop is shared by all instruction sets; it has to be stamped out once
+// per target attribute so the intrinsics in |Ops| can be inlined into it.
+#define GLUTILS_DEFINE_SCAN_KERNEL(name, target_attr)                         \
+template <class Ops, class T>                                                 \
+target_attr void name(const T* indices, int count,                            \
+                      bool shouldExclude, T whatExclude,                      \
+                      T* lo_out, T* hi_out) {                                 \
+    constexpr int kLanes = sizeof(typename Ops::Vec) / sizeof(T);             \
+    typename Ops::Vec vlo = Ops::splat(static_cast<T>(~T(0)));                \
+    typename Ops::Vec vhi = Ops::splat(0);                                    \
+    int i = 0;                                                                \
+    if (shouldExclude) {                                                      \
+        const typename Ops::Vec vexclude = Ops::splat(whatExclude);           \
+        for (; i + kLanes <= count; i += kLanes) {                            \
+            typename Ops::Vec v = Ops::load(indices + i);                     \
+            typename Ops::Vec m = Ops::equal(v, vexclude);                    \
+            vlo = Ops::min(vlo, Ops::bitOr(v, m));                            \
+            vhi = Ops::max(vhi, Ops::andNot(m, v));                           \
+        }                                                                     \
+    } else {                                                                  \
+        for (; i + kLanes <= count; i += kLanes) {                            \
+            typename Ops::Vec v = Ops::load(indices + i);                     \
+            vlo = Ops::min(vlo, v);                                           \
+            vhi = Ops::max(vhi, v);                                           \
+        }                                                                     \
+    }                                                                         \
+    T los[kLanes];                                                            \
+    T his[kLanes];                                                            \
+    Ops::store(los, vlo);                                                     \
+    Ops::store(his, vhi);                                                     \
+    T lo = *lo_out;                                                           \
+    T hi = *hi_out;                                                           \
+    for (int lane = 0; lane < kLanes; lane++) {                               \
+        if (los[lane] < lo) lo = los[lane];                                   \
+        if (his[lane] > hi) hi = his[lane];                                   \
+    }                                                                         \
+    *lo_out = lo;                                                             \
+    *hi_out = hi;                                                             \
+    scanScalar(indices + i, count - i, shouldExclude, whatExclude,            \
+               lo_out, hi_out);                                               \
+}
+
+#define GLUTILS_DEFINE_SHIFT_KERNEL(name, target_attr)                        \
+template <class Ops, class T>                                                 \
+target_attr void name(const T* src, T* dst, int count, int offset,            \
+                      bool shouldExclude, T whatExclude) {                    \
+    constexpr int kLanes = sizeof(typename Ops::Vec) / sizeof(T);             \
+    const typename Ops::Vec voffset = Ops::splat(static_cast<T>(offset));     \
+    int i = 0;                                                                \
+    if (shouldExclude) {                                                      \
+        const typename Ops::Vec vexclude = Ops::splat(whatExclude);           \
+        for (; i + kLanes <= count; i += kLanes) {                            \
+            typename Ops::Vec v = Ops::load(src + i);                         \
+            typename Ops::Vec m = Ops::equal(v, vexclude);                    \
+            Ops::store(dst + i, Ops::bitOr(Ops::bitAnd(m, v),                 \
+                                           Ops::andNot(m, Ops::add(v, voffset)))); \
+        }                                                                     \
+    } else {                                                                  \
+        for (; i + kLanes <= count; i += kLanes) {                            \
+            Ops::store(dst + i, Ops::add(Ops::load(src + i), voffset));       \
+        }                                                                     \
+    }                                                                         \
+    shiftIndicesExcept<T>(src + i, dst + i, count - i, offset,                \
+                          shouldExclude, whatExclude);                        \
+}
+
+#ifdef GLUTILS_INDEX_SCAN_X86
+
+#define GLUTILS_SSE41 __attribute__((target("sse4.1")))
+#define GLUTILS_AVX2 __attribute__((target("avx2")))
+
+#define GLUTILS_DEFINE_X86_OPS(name, attr, T, vec, pfx, bits)                 \
+struct name {                                                                 \
+    using Vec = vec;                                                          \
+    static attr inline Vec load(const T* p) {                                 \
+        return pfx##_loadu_si##bits((const Vec*)p);                           \
+    }                                                                         \
+    static attr inline void store(T* p, Vec v) {                              \
+        pfx##_storeu_si##bits((Vec*)p, v);                                    \
+    }                                                                         \
+    static attr inline Vec bitAnd(Vec a, Vec b) { return pfx##_and_si##bits(a, b); } \
+    static attr inline Vec bitOr(Vec a, Vec b) { return pfx##_or_si##bits(a, b); } \
+    static attr inline Vec andNot(Vec m, Vec v) { return pfx##_andnot_si##bits(m, v); } \
+};
+
+GLUTILS_DEFINE_X86_OPS(Sse41Common, GLUTILS_SSE41, void, __m128i, _mm, 128)
+GLUTILS_DEFINE_X86_OPS(Avx2Common, GLUTILS_AVX2, void, __m256i, _mm256, 256)
+
+#define GLUTILS_DEFINE_X86_LANE_OPS(name, base, attr, T, pfx, epi, epu)       \
+struct name : base {                                                          \
+    static attr inline Vec splat(T v) { return pfx##_set1_##epi(v); }         \
+    static attr inline Vec equal(Vec a, Vec b) { return pfx##_cmpeq_##epi(a, b); } \
+    static attr inline Vec min(Vec a, Vec b) { return pfx##_min_##epu(a, b); } \
+    static attr inline Vec max(Vec a, Vec b) { return pfx##_max_##epu(a, b); } \
+    static attr inline Vec add(Vec a, Vec b) { return pfx##_add_##epi(a, b); } \
+};
+
+template <class T> struct Sse41Ops;
+template <class T> struct Avx2Ops;
+
+GLUTILS_DEFINE_X86_LANE_OPS(Sse41U8, Sse41Common, GLUTILS_SSE41, uint8_t, _mm, epi8, epu8)
+GLUTILS_DEFINE_X86_LANE_OPS(Sse41U16, Sse41Common, GLUTILS_SSE41, uint16_t, _mm, epi16, epu16)
+GLUTILS_DEFINE_X86_LANE_OPS(Sse41U32, Sse41Common, GLUTILS_SSE41, uint32_t, _mm, epi32, epu32)
+GLUTILS_DEFINE_X86_LANE_OPS(Avx2U8, Avx2Common, GLUTILS_AVX2, uint8_t, _mm256, epi8, epu8)
+GLUTILS_DEFINE_X86_LANE_OPS(Avx2U16, Avx2Common, GLUTILS_AVX2, uint16_t, _mm256, epi16, epu16)
+GLUTILS_DEFINE_X86_LANE_OPS(Avx2U32, Avx2Common, GLUTILS_AVX2, uint32_t, _mm256, epi32, epu32)
+
+template <> struct Sse41Ops<uint8_t> : Sse41U8 {};
+template <> struct Sse41Ops<uint16_t> : Sse41U16 {};
+template <> struct Sse41Ops<uint32_t> : Sse41U32 {};
+template <> struct Avx2Ops<uint8_t> : Avx2U8 {};
+template <> struct Avx2Ops<uint16_t> : Avx2U16 {};
+template <> struct Avx2Ops<uint32_t> : Avx2U32 {};
+
+GLUTILS_DEFINE_SCAN_KERNEL(scanSse41, GLUTILS_SSE41)
+GLUTILS_DEFINE_SCAN_KERNEL(scanAvx2, GLUTILS_AVX2)
+GLUTILS_DEFINE_SHIFT_KERNEL(shiftSse41, GLUTILS_SSE41)
+GLUTILS_DEFINE_SHIFT_KERNEL(shiftAvx2, GLUTILS_AVX2)
+
+#endif  // GLUTILS_INDEX_SCAN_X86
+
+#ifdef GLUTILS_INDEX_SCAN_NEON
+
+#define GLUTILS_DEFINE_NEON_OPS(T, vec, sfx)                                  \
+template <> struct NeonOps<T> {                                               \
+    using Vec = vec;                                                          \
+    static inline Vec load(const T* p) { return vld1q_##sfx(p); }             \
+    static inline void store(T* p, Vec v) { vst1q_##sfx(p, v); }              \
+    static inline Vec splat(T v) { return vdupq_n_##sfx(v); }                 \
+    static inline Vec equal(Vec a, Vec b) { return vceqq_##sfx(a, b); }       \
+    static inline Vec min(Vec a, Vec b) { return vminq_##sfx(a, b); }         \
+    static inline Vec max(Vec a, Vec b) { return vmaxq_##sfx(a, b); }         \
+    static inline Vec add(Vec a, Vec b) { return vaddq_##sfx(a, b); }         \
+    static inline Vec bitAnd(Vec a, Vec b) { return vandq_##sfx(a, b); }      \
+    static inline Vec bitOr(Vec a, Vec b) { return vorrq_##sfx(a, b); }       \
+    static inline Vec andNot(Vec m, Vec v) { return vbicq_##sfx(v, m); }      \
+};
+
+template <class T> struct NeonOps;
+
+GLUTILS_DEFINE_NEON_OPS(uint8_t, uint8x16_t, u8)
+GLUTILS_DEFINE_NEON_OPS(uint16_t, uint16x8_t, u16)
+GLUTILS_DEFINE_NEON_OPS(uint32_t, uint32x4_t, u32)
+
+GLUTILS_DEFINE_SCAN_KERNEL(scanNeon, )
+GLUTILS_DEFINE_SHIFT_KERNEL(shiftNeon, )
+
+#endif  // GLUTILS_INDEX_SCAN_NEON
+
+template <class T>
+ScanFn<T> scanFnFor(IndexScanImpl impl) {
+    switch (impl) {
+#ifdef GLUTILS_INDEX_SCAN_X86
+        case IndexScanImpl::SSE41:
+            return &scanSse41<Sse41Ops<T>, T>;
+        case IndexScanImpl::AVX2:
+            return &scanAvx2<Avx2Ops<T>, T>;
+#endif
+#ifdef GLUTILS_INDEX_SCAN_NEON
+        case IndexScanImpl::NEON:
+            return &scanNeon<NeonOps<T>, T>;
+#endif
+        default:
+            return &scanScalar<T>;
+    }
+}
+
+template <class T>
+void shiftScalar(const T* src, T* dst, int count, int offset,
+                 bool shouldExclude, T whatExclude) {
+    shiftIndicesExcept<T>(src, dst, count, offset, shouldExclude, whatExclude);
+}
+
+template <class T>
+ShiftFn<T> shiftFnFor(IndexScanImpl impl) {
+    switch (impl) {
+#ifdef GLUTILS_INDEX_SCAN_X86
+        case IndexScanImpl::SSE41:
+            return &shiftSse41<Sse41Ops<T>, T>;
+        case IndexScanImpl::AVX2:
+            return &shiftAvx2<Avx2Ops<T>, T>;
+#endif
+#ifdef GLUTILS_INDEX_SCAN_NEON
+        case IndexScanImpl::NEON:
+            return &shiftNeon<NeonOps<T>, T>;
+#endif
+        default:
+            return &shiftScalar<T>;
+    }
+}
+
+template <class T>
+void runScan(ScanFn<T> fn, const T* indices, int count, int* min, int* max,
+             bool shouldExclude, T whatExclude) {
+    T lo = static_cast<T>(~T(0));
+    T hi = 0;
+    fn(indices, count, shouldExclude, whatExclude, &lo, &hi);
+    if (lo > hi) {
+        *min = -1;
+        *max = -1;
+        return;
+    }
+    *min = static_cast<int>(lo);
+    *max = static_cast<int>(hi);
+}
+
+template <class T>
+void dispatchScan(const T* indices, int count, int* min, int* max,
+                  bool shouldExclude, T whatExclude) {
+    static const ScanFn<T> sBestFn = scanFnFor<T>(bestIndexScanImpl());
+    runScan(sBestFn, indices, count, min, max, shouldExclude, whatExclude);
+}
+
+template <class T>
+void dispatchScan(IndexScanImpl impl, const T* indices, int count,
+                  int* min, int* max, bool shouldExclude, T whatExclude) {
+    if (impl == IndexScanImpl::Scalar) {
+        minmaxExcept<T>(indices, count, min, max, shouldExclude, whatExclude);
+        return;
+    }
+    runScan(scanFnFor<T>(impl), indices, count, min, max, shouldExclude, whatExclude);
+}
+
+template <class T>
+void dispatchShift(const T* src, T* dst, int count, int offset,
+                   bool shouldExclude, T whatExclude) {
+    static const ShiftFn<T> sBestFn = shiftFnFor<T>(bestIndexScanImpl());
+    sBestFn(src, dst, count, offset, shouldExclude, whatExclude);
+}
+
+}  // namespace
+
+bool isIndexScanImplSupported(IndexScanImpl impl) {
+    switch (impl) {
+        case IndexScanImpl::Scalar:
+            return true;
+#ifdef GLUTILS_INDEX_SCAN_X86
+        case IndexScanImpl::SSE41:
+            return __builtin_cpu_supports("sse4.1");
+        case IndexScanImpl::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+#ifdef GLUTILS_INDEX_SCAN_NEON
+        case IndexScanImpl::NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+IndexScanImpl bestIndexScanImpl() {
+    static const IndexScanImpl sBest = []() {
+        if (isIndexScanImplSupported(IndexScanImpl::AVX2)) return IndexScanImpl::AVX2;
+        if (isIndexScanImplSupported(IndexScanImpl::SSE41)) return IndexScanImpl::SSE41;
+        if (isIndexScanImplSupported(IndexScanImpl::NEON)) return IndexScanImpl::NEON;
+        return IndexScanImpl::Scalar;
+    }();
+    return sBest;
+}
+
+void minmaxExcept(const unsigned char *indices, int count, int *min, int *max,
+                  bool shouldExclude, unsigned char whatExclude) {
+    dispatchScan(indices, count, min, max, shouldExclude, whatExclude);
+}
+
+void minmaxExcept(const unsigned short *indices, int count, int *min, int *max,
+                  bool shouldExclude, unsigned short whatExclude) {
+    dispatchScan(indices, count, min, max, shouldExclude, whatExclude);
+}
+
+void minmaxExcept(const unsigned int *indices, int count, int *min, int *max,
+                  bool shouldExclude, unsigned int whatExclude) {
+    dispatchScan(indices, count, min, max, shouldExclude, whatExclude);
+}
+
+void minmaxExcept(IndexScanImpl impl,
+                  const unsigned char *indices, int count, int *min, int *max,
+                  bool shouldExclude, unsigned char whatExclude) {
+    dispatchScan(impl, indices, count, min, max, shouldExclude, whatExclude);
+}
+
+void minmaxExcept(IndexScanImpl impl,
+                  const unsigned short *indices, int count, int *min, int *max,
+                  bool shouldExclude, unsigned short whatExclude) {
+    dispatchScan(impl, indices, count, min, max, shouldExclude, whatExclude);
+}
+
+void minmaxExcept(IndexScanImpl impl,
+                  const unsigned int *indices, int count, int *min, int *max,
+                  bool shouldExclude, unsigned int whatExclude) {
+    dispatchScan(impl, indices, count, min, max, shouldExclude, whatExclude);
+}
+
+void shiftIndicesExcept(const unsigned char *src, unsigned char *dst, int count, int offset,
+                        bool shouldExclude, unsigned char whatExclude) {
+    dispatchShift(src, dst, count, offset, shouldExclude, whatExclude);
+}
+
+void shiftIndicesExcept(const unsigned short *src, unsigned short *dst, int count, int offset,
+                        bool shouldExclude, unsigned short whatExclude) {
+    dispatchShift(src, dst, count, offset, shouldExclude, whatExclude);
+}
+
+void shiftIndicesExcept(const unsigned int *src, unsigned int *dst, int count, int offset,
+                        bool shouldExclude, unsigned int whatExclude) {
+    dispatchShift(src, dst, count, offset, shouldExclude, whatExclude);
+}
+
+}  // namespace GLUtils
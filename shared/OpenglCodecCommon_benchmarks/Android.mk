@@ -0,0 +1,18 @@
+LOCAL_PATH:= $(call my-dir)
+include $(CLEAR_VARS)
+LOCAL_MODULE := OpenglCodecCommonBenchmarks
+
+$(call emugl-import,libOpenglCodecCommon$(GOLDFISH_OPENGL_LIB_SUFFIX))
+
+LOCAL_C_INCLUDES += $(EMUGL_COMMON_INCLUDES)
+
+LOCAL_SRC_FILES:= \
+    glUtils_benchmark.cpp \
+
+LOCAL_VENDOR_MODULE := true
+LOCAL_MODULE_TAGS := tests
+
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/../../LICENSE
+include $(BUILD_NATIVE_BENCHMARK)
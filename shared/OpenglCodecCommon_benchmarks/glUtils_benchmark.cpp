@@ -0,0 +1,94 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <benchmark/benchmark.h>
+
+#include "glUtils.h"
+
+#include <random>
+#include <vector>
+
+using GLUtils::IndexScanImpl;
+
+namespace {
+
+// Every 64th index is a primitive restart so the excluding kernels have
+// something to mask out.
+template <class T>
+std::vector<T> makeIndices(size_t count) {
+    std::mt19937 rng(count);
+    std::uniform_int_distribution<uint32_t> dist(0, 0xfffe);
+    std::vector<T> indices(count);
+    for (size_t i = 0; i < count; i++) {
+        indices[i] = (i % 64 == 63) ? GLUtils::primitiveRestartIndex<T>()
+                                    : static_cast<T>(dist(rng));
+    }
+    return indices;
+}
+
+template <class T>
+void runMinMaxExcept(benchmark::State& state, IndexScanImpl impl) {
+    if (!GLUtils::isIndexScanImplSupported(impl)) {
+        state.SkipWithError("implementation not supported on this CPU");
+        return;
+    }
+
+    const size_t count = state.range(0);
+    const bool primitiveRestart = state.range(1);
+    const std::vector<T> indices = makeIndices<T>(count);
+
+    for (auto _ : state) {
+        int minIndex;
+        int maxIndex;
+        GLUtils::minmaxExcept(impl, indices.data(), count, &minIndex, &maxIndex,
+                              primitiveRestart, GLUtils::primitiveRestartIndex<T>());
+        benchmark::DoNotOptimize(minIndex);
+        benchmark::DoNotOptimize(maxIndex);
+    }
+
+    state.SetBytesProcessed(state.iterations() * count * sizeof(T));
+}
+
+void indexScanArgs(benchmark::internal::Benchmark* b) {
+    for (int count : {64, 1024, 65536}) {
+        for (int primitiveRestart : {0, 1}) {
+            b->Args({count, primitiveRestart});
+        }
+    }
+}
+
+void BM_MinMaxExceptU8(benchmark::State& state, IndexScanImpl impl) {
+    runMinMaxExcept<uint8_t>(state, impl);
+}
+
+void BM_MinMaxExceptU16(benchmark::State& state, IndexScanImpl impl) {
+    runMinMaxExcept<uint16_t>(state, impl);
+}
+
+void BM_MinMaxExceptU32(benchmark::State& state, IndexScanImpl impl) {
+    runMinMaxExcept<uint32_t>(state, impl);
+}
+
+#define REGISTER_MINMAX_BENCHMARKS(fn)                                          \
+    BENCHMARK_CAPTURE(fn, Scalar, IndexScanImpl::Scalar)->Apply(indexScanArgs); \
+    BENCHMARK_CAPTURE(fn, SSE41, IndexScanImpl::SSE41)->Apply(indexScanArgs);   \
+    BENCHMARK_CAPTURE(fn, AVX2, IndexScanImpl::AVX2)->Apply(indexScanArgs);     \
+    BENCHMARK_CAPTURE(fn, NEON, IndexScanImpl::NEON)->Apply(indexScanArgs);
+
+REGISTER_MINMAX_BENCHMARKS(BM_MinMaxExceptU8)
+REGISTER_MINMAX_BENCHMARKS(BM_MinMaxExceptU16)
+REGISTER_MINMAX_BENCHMARKS(BM_MinMaxExceptU32)
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -17,6 +17,8 @@
 #pragma once
 #include <qemu_pipe_types_bp.h>
 
+struct iovec;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -29,6 +31,8 @@ int qemu_pipe_read_fully(QEMU_PIPE_HANDLE pipe, void* buffer, int size);
 int qemu_pipe_write_fully(QEMU_PIPE_HANDLE pipe, const void* buffer, int size);
 int qemu_pipe_read(QEMU_PIPE_HANDLE pipe, void* buffer, int size);
 int qemu_pipe_write(QEMU_PIPE_HANDLE pipe, const void* buffer, int size);
+int qemu_pipe_writev(QEMU_PIPE_HANDLE pipe, const struct iovec* iov, int iovcnt);
+int qemu_pipe_writev_fully(QEMU_PIPE_HANDLE pipe, const struct iovec* iov, int iovcnt);
 
 int qemu_pipe_try_again(int ret);
 void qemu_pipe_print_error(QEMU_PIPE_HANDLE pipe);
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <qemu_pipe_bp.h>
+#include <sys/uio.h>
+
+#include <vector>
 
 int qemu_pipe_read_fully(QEMU_PIPE_HANDLE pipe, void* buffer, int size) {
     char* p = (char*)buffer;
@@ -41,3 +44,32 @@ int qemu_pipe_write_fully(QEMU_PIPE_HANDLE pipe, const void* buffer, int size) {
 
     return 0;
 }
+
+int qemu_pipe_writev_fully(QEMU_PIPE_HANDLE pipe, const struct iovec* iov, int iovcnt) {
+    std::vector<struct iovec> left(iov, iov + iovcnt);
+    struct iovec* p = left.data();
+
+    while (iovcnt > 0) {
+      if (!p->iov_len) {
+        ++p;
+        --iovcnt;
+        continue;
+      }
+
+      int n = QEMU_PIPE_RETRY(qemu_pipe_writev(pipe, p, iovcnt));
+      if (n < 0) return n;
+
+      size_t written = n;
+      while (iovcnt > 0 && written >= p->iov_len) {
+        written -= p->iov_len;
+        ++p;
+        --iovcnt;
+      }
+      if (iovcnt > 0) {
+        p->iov_base = (char*)p->iov_base + written;
+        p->iov_len -= written;
+      }
+    }
+
+    return 0;
+}
@@ -19,6 +19,7 @@
 #include <log/log.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -35,6 +36,10 @@ enum class VsockPort {
 
 std::atomic<bool> gVsockAvailable{false};
 
+// The default of 256 KiB has the sender wait for credit from the host
+// several times per large transfer.
+constexpr unsigned long long kVsockBufferSize = 2 * 1024 * 1024;
+
 bool is_graphics_pipe(const char* name) {
     if (!strcmp(name, "opengles")) { return true; }
     if (!strcmp(name, "GLProcessPipe")) { return true; }
@@ -83,6 +88,13 @@ int open_verbose_vsock(const VsockPort port, const int flags) {
         return -checkErr(errno, EINVAL);
     }
 
+    if (port == VsockPort::Data) {
+        // Best effort, older kernels cap or ignore these.
+        const unsigned long long size = kVsockBufferSize;
+        setsockopt(fd, AF_VSOCK, SO_VM_SOCKETS_BUFFER_MAX_SIZE, &size, sizeof(size));
+        setsockopt(fd, AF_VSOCK, SO_VM_SOCKETS_BUFFER_SIZE, &size, sizeof(size));
+    }
+
     if (flags) {
         const int oldFlags = QEMU_PIPE_RETRY(fcntl(fd, F_GETFL, 0));
         if (oldFlags < 0) {
@@ -189,6 +201,11 @@ int qemu_pipe_write(int pipe, const void* buffer, int size) {
     return (r >= 0) ? r : -checkErr(errno, EIO);
 }
 
+int qemu_pipe_writev(int pipe, const struct iovec* iov, int iovcnt) {
+    const ssize_t r = writev(pipe, iov, iovcnt);
+    return (r >= 0) ? r : -checkErr(errno, EIO);
+}
+
 int qemu_pipe_try_again(int ret) {
     if (ret >= 0) {
         return 0;
@@ -23,6 +23,7 @@
 #endif
 
 #include <errno.h>
+#include <sys/uio.h>
 
 using android::HostGoldfishPipeDevice;
 
@@ -42,6 +43,12 @@ int qemu_pipe_write(QEMU_PIPE_HANDLE pipe, const void* buffer, int len) {
     return HostGoldfishPipeDevice::get()->write(pipe, buffer, len);
 }
 
+int qemu_pipe_writev(QEMU_PIPE_HANDLE pipe, const struct iovec* iov, int iovcnt) {
+    // The host pipe device has no vectored write; qemu_pipe_writev_fully
+    // comes back for the remaining buffers.
+    return iovcnt > 0 ? qemu_pipe_write(pipe, iov[0].iov_base, iov[0].iov_len) : 0;
+}
+
 int qemu_pipe_try_again(int ret) {
     if (ret < 0) {
         int err = HostGoldfishPipeDevice::get()->getErrno();
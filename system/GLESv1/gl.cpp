@@ -78,7 +78,7 @@ void glEGLImageTargetTexture2DOES(void * self, GLenum target, GLeglImageOES img)
 
         ctx->override2DTextureTarget(target);
         rcEnc->rcBindTexture(rcEnc,
-                grallocHelper->getHostHandle(native_buffer->handle));
+                image->host_color_buffer);
         ctx->restore2DTextureTarget();
     }
     else if (image->target == EGL_GL_TEXTURE_2D_KHR) {
@@ -112,7 +112,7 @@ void glEGLImageTargetRenderbufferStorageOES(void *self, GLenum target, GLeglImag
 
         DEFINE_AND_VALIDATE_HOST_CONNECTION();
         rcEnc->rcBindRenderbuffer(rcEnc,
-                grallocHelper->getHostHandle(native_buffer->handle));
+                image->host_color_buffer);
     } else {
         //TODO
     }
@@ -123,10 +123,12 @@ void glEGLImageTargetRenderbufferStorageOES(void *self, GLenum target, GLeglImag
 void * getProcAddress(const char * procname)
 {
     // search in GL function table
+    const char* name = gl_funcs_names;
     for (int i=0; i<gl_num_funcs; i++) {
-        if (!strcmp(gl_funcs_by_name[i].name, procname)) {
-            return gl_funcs_by_name[i].proc;
+        if (!strcmp(name, procname)) {
+            return gl_funcs_by_proc[i];
         }
+        name += strlen(name) + 1;
     }
     return NULL;
 }
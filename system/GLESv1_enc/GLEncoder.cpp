@@ -14,9 +14,12 @@
 * limitations under the License.
 */
 #include "GLEncoder.h"
+#include "GLEncoderUtils.h"
 #include "glUtils.h"
+#include "gl_opcodes.h"
 #include <log/log.h>
 #include <assert.h>
+#include <string.h>
 #include <vector>
 
 #ifndef MIN
@@ -398,6 +401,8 @@ void GLEncoder::sendVertexData(unsigned int first, unsigned int count)
 {
     assert(m_state != NULL);
     GLenum prevActiveTexUnit = m_state->getActiveTextureUnit();
+    // Arrays in the same buffer, or in client memory, share one binding.
+    GLuint lastBoundVbo = m_state->currentArrayVbo();
     for (int i = 0; i < GLClientState::LAST_LOCATION; i++) {
         bool enableDirty;
         const GLClientState::VertexAttribState& state = m_state->getStateAndEnableDirty(i, &enableDirty);
@@ -407,7 +412,11 @@ void GLEncoder::sendVertexData(unsigned int first, unsigned int count)
 
         if ( i >= GLClientState::TEXCOORD0_LOCATION &&
             i <= GLClientState::TEXCOORD7_LOCATION ) {
-            m_glClientActiveTexture_enc(this, GL_TEXTURE0 + i - GLClientState::TEXCOORD0_LOCATION);
+            const GLenum unit = GL_TEXTURE0 + i - GLClientState::TEXCOORD0_LOCATION;
+            if (m_hostClientActiveTexture != unit) {
+                m_glClientActiveTexture_enc(this, unit);
+                m_hostClientActiveTexture = unit;
+            }
         }
 
         if (state.enabled) {
@@ -419,7 +428,10 @@ void GLEncoder::sendVertexData(unsigned int first, unsigned int count)
             if (stride == 0) stride = state.elementSize;
             int firstIndex = stride * first;
 
-            this->m_glBindBuffer_enc(this, GL_ARRAY_BUFFER, state.bufferObject);
+            if (lastBoundVbo != state.bufferObject) {
+                this->m_glBindBuffer_enc(this, GL_ARRAY_BUFFER, state.bufferObject);
+                lastBoundVbo = state.bufferObject;
+            }
             if (state.bufferObject == 0) {
 
                 switch(i) {
@@ -434,6 +446,7 @@ void GLEncoder::sendVertexData(unsigned int first, unsigned int count)
                 case GLClientState::COLOR_LOCATION:
                     this->glColorPointerData(this, state.size, state.type, state.stride,
                                              (unsigned char *)state.data + firstIndex, datalen);
+                    m_state->stateShadow().invalidateColor();
                     break;
                 case GLClientState::TEXCOORD0_LOCATION:
                 case GLClientState::TEXCOORD1_LOCATION:
@@ -480,6 +493,7 @@ void GLEncoder::sendVertexData(unsigned int first, unsigned int count)
                 case GLClientState::COLOR_LOCATION:
                     this->glColorPointerOffset(this, state.size, state.type, state.stride,
                                                (uintptr_t)state.data + firstIndex);
+                    m_state->stateShadow().invalidateColor();
                     break;
                 case GLClientState::TEXCOORD0_LOCATION:
                 case GLClientState::TEXCOORD1_LOCATION:
@@ -502,11 +516,13 @@ void GLEncoder::sendVertexData(unsigned int first, unsigned int count)
                     break;
                 }
             }
-            this->m_glBindBuffer_enc(this, GL_ARRAY_BUFFER, m_state->currentArrayVbo());
         } else {
             this->m_glDisableClientState_enc(this, state.glConst);
         }
     }
+    if (lastBoundVbo != m_state->currentArrayVbo()) {
+        this->m_glBindBuffer_enc(this, GL_ARRAY_BUFFER, m_state->currentArrayVbo());
+    }
     m_state->setActiveTextureUnit(prevActiveTexUnit);
 }
 
@@ -652,6 +668,7 @@ void GLEncoder::s_glActiveTexture(void* self, GLenum texture)
     }
 
     ctx->m_glActiveTexture_enc(ctx, texture);
+    state->stateShadow().onActiveTextureEncoded(texture);
 }
 
 void GLEncoder::s_glBindTexture(void* self, GLenum target, GLuint texture)
@@ -1020,6 +1037,396 @@ void GLEncoder::s_glGetFramebufferAttachmentParameterivOES(void* self,
     ctx->m_glGetFramebufferAttachmentParameterivOES_enc(self, target, attachment, pname, params);
 }
 
+// GLES 1 fixed function state, dropped when it would not change host state.
+void GLEncoder::s_glColor4f(void* self, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    const GLfloat rgba[4] = { red, green, blue, alpha };
+    uint32_t words[4];
+    memcpy(words, rgba, sizeof(words));
+    if (ctx->m_state->stateShadow().skipColor(GL_FLOAT, words)) return;
+    ctx->m_glColor4f_enc(ctx, red, green, blue, alpha);
+}
+
+void GLEncoder::s_glColor4ub(void* self, GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    const uint32_t words[4] = { (uint32_t)red, (uint32_t)green, (uint32_t)blue, (uint32_t)alpha };
+    if (ctx->m_state->stateShadow().skipColor(GL_UNSIGNED_BYTE, words)) return;
+    ctx->m_glColor4ub_enc(ctx, red, green, blue, alpha);
+}
+
+void GLEncoder::s_glColor4x(void* self, GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    const uint32_t words[4] = { (uint32_t)red, (uint32_t)green, (uint32_t)blue, (uint32_t)alpha };
+    if (ctx->m_state->stateShadow().skipColor(GL_FIXED, words)) return;
+    ctx->m_glColor4x_enc(ctx, red, green, blue, alpha);
+}
+
+void GLEncoder::s_glColor4xOES(void* self, GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    const uint32_t words[4] = { (uint32_t)red, (uint32_t)green, (uint32_t)blue, (uint32_t)alpha };
+    if (ctx->m_state->stateShadow().skipColor(GL_FIXED, words)) return;
+    ctx->m_glColor4xOES_enc(ctx, red, green, blue, alpha);
+}
+
+void GLEncoder::s_glMatrixMode(void* self, GLenum mode)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_state->stateShadow().skipMatrixMode(mode)) return;
+    ctx->m_glMatrixMode_enc(ctx, mode);
+}
+
+void GLEncoder::s_glLoadIdentity(void* self)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_state->stateShadow().skipLoadMatrix(GL_NONE, NULL)) return;
+    ctx->m_glLoadIdentity_enc(ctx);
+}
+
+void GLEncoder::s_glLoadMatrixf(void* self, const GLfloat* m)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (m) {
+        uint32_t words[16];
+        memcpy(words, m, sizeof(words));
+        if (ctx->m_state->stateShadow().skipLoadMatrix(GL_FLOAT, words)) return;
+    }
+    ctx->m_glLoadMatrixf_enc(ctx, m);
+}
+
+void GLEncoder::s_glLoadMatrixx(void* self, const GLfixed* m)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (m) {
+        uint32_t words[16];
+        memcpy(words, m, sizeof(words));
+        if (ctx->m_state->stateShadow().skipLoadMatrix(GL_FIXED, words)) return;
+    }
+    ctx->m_glLoadMatrixx_enc(ctx, m);
+}
+
+void GLEncoder::s_glLoadMatrixxOES(void* self, const GLfixed* m)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (m) {
+        uint32_t words[16];
+        memcpy(words, m, sizeof(words));
+        if (ctx->m_state->stateShadow().skipLoadMatrix(GL_FIXED, words)) return;
+    }
+    ctx->m_glLoadMatrixxOES_enc(ctx, m);
+}
+
+void GLEncoder::s_glMultMatrixf(void* self, const GLfloat* m)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glMultMatrixf_enc(ctx, m);
+}
+
+void GLEncoder::s_glMultMatrixx(void* self, const GLfixed* m)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glMultMatrixx_enc(ctx, m);
+}
+
+void GLEncoder::s_glMultMatrixxOES(void* self, const GLfixed* m)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glMultMatrixxOES_enc(ctx, m);
+}
+
+void GLEncoder::s_glRotatef(void* self, GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glRotatef_enc(ctx, angle, x, y, z);
+}
+
+void GLEncoder::s_glRotatex(void* self, GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glRotatex_enc(ctx, angle, x, y, z);
+}
+
+void GLEncoder::s_glRotatexOES(void* self, GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glRotatexOES_enc(ctx, angle, x, y, z);
+}
+
+void GLEncoder::s_glScalef(void* self, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glScalef_enc(ctx, x, y, z);
+}
+
+void GLEncoder::s_glScalex(void* self, GLfixed x, GLfixed y, GLfixed z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glScalex_enc(ctx, x, y, z);
+}
+
+void GLEncoder::s_glScalexOES(void* self, GLfixed x, GLfixed y, GLfixed z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glScalexOES_enc(ctx, x, y, z);
+}
+
+void GLEncoder::s_glTranslatef(void* self, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glTranslatef_enc(ctx, x, y, z);
+}
+
+void GLEncoder::s_glTranslatex(void* self, GLfixed x, GLfixed y, GLfixed z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glTranslatex_enc(ctx, x, y, z);
+}
+
+void GLEncoder::s_glTranslatexOES(void* self, GLfixed x, GLfixed y, GLfixed z)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glTranslatexOES_enc(ctx, x, y, z);
+}
+
+void GLEncoder::s_glOrthof(void* self, GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glOrthof_enc(ctx, left, right, bottom, top, zNear, zFar);
+}
+
+void GLEncoder::s_glOrthofOES(void* self, GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glOrthofOES_enc(ctx, left, right, bottom, top, zNear, zFar);
+}
+
+void GLEncoder::s_glOrthox(void* self, GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glOrthox_enc(ctx, left, right, bottom, top, zNear, zFar);
+}
+
+void GLEncoder::s_glOrthoxOES(void* self, GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glOrthoxOES_enc(ctx, left, right, bottom, top, zNear, zFar);
+}
+
+void GLEncoder::s_glFrustumf(void* self, GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glFrustumf_enc(ctx, left, right, bottom, top, zNear, zFar);
+}
+
+void GLEncoder::s_glFrustumfOES(void* self, GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glFrustumfOES_enc(ctx, left, right, bottom, top, zNear, zFar);
+}
+
+void GLEncoder::s_glFrustumx(void* self, GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glFrustumx_enc(ctx, left, right, bottom, top, zNear, zFar);
+}
+
+void GLEncoder::s_glFrustumxOES(void* self, GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glFrustumxOES_enc(ctx, left, right, bottom, top, zNear, zFar);
+}
+
+void GLEncoder::s_glPopMatrix(void* self)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateMatrix();
+    ctx->m_glPopMatrix_enc(ctx);
+}
+
+void GLEncoder::s_glTexEnvf(void* self, GLenum target, GLenum pname, GLfloat param)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    uint32_t word;
+    memcpy(&word, &param, sizeof(word));
+    if (ctx->m_state->stateShadow().skipTexEnv(target, pname, GL_FLOAT, word)) return;
+    ctx->m_glTexEnvf_enc(ctx, target, pname, param);
+}
+
+void GLEncoder::s_glTexEnvi(void* self, GLenum target, GLenum pname, GLint param)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    const uint32_t word = (uint32_t)param;
+    if (ctx->m_state->stateShadow().skipTexEnv(target, pname, GL_INT, word)) return;
+    ctx->m_glTexEnvi_enc(ctx, target, pname, param);
+}
+
+void GLEncoder::s_glTexEnvx(void* self, GLenum target, GLenum pname, GLfixed param)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    const uint32_t word = (uint32_t)param;
+    if (ctx->m_state->stateShadow().skipTexEnv(target, pname, GL_FIXED, word)) return;
+    ctx->m_glTexEnvx_enc(ctx, target, pname, param);
+}
+
+void GLEncoder::s_glTexEnvxOES(void* self, GLenum target, GLenum pname, GLfixed param)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    const uint32_t word = (uint32_t)param;
+    if (ctx->m_state->stateShadow().skipTexEnv(target, pname, GL_FIXED, word)) return;
+    ctx->m_glTexEnvxOES_enc(ctx, target, pname, param);
+}
+
+void GLEncoder::s_glTexEnvfv(void* self, GLenum target, GLenum pname, const GLfloat* params)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateTexEnv(target, pname);
+    ctx->m_glTexEnvfv_enc(ctx, target, pname, params);
+}
+
+void GLEncoder::s_glTexEnviv(void* self, GLenum target, GLenum pname, const GLint* params)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateTexEnv(target, pname);
+    ctx->m_glTexEnviv_enc(ctx, target, pname, params);
+}
+
+void GLEncoder::s_glTexEnvxv(void* self, GLenum target, GLenum pname, const GLfixed* params)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateTexEnv(target, pname);
+    ctx->m_glTexEnvxv_enc(ctx, target, pname, params);
+}
+
+void GLEncoder::s_glTexEnvxvOES(void* self, GLenum target, GLenum pname, const GLfixed* params)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    ctx->m_state->stateShadow().invalidateTexEnv(target, pname);
+    ctx->m_glTexEnvxvOES_enc(ctx, target, pname, params);
+}
+
+void GLEncoder::s_glShadeModel(void* self, GLenum mode)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_state->stateShadow().skipShadeModel(mode)) return;
+    ctx->m_glShadeModel_enc(ctx, mode);
+}
+
+void GLEncoder::s_glBlendFunc(void* self, GLenum sfactor, GLenum dfactor)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_state->stateShadow().skipBlendFunc(sfactor, dfactor, sfactor, dfactor)) return;
+    ctx->m_glBlendFunc_enc(ctx, sfactor, dfactor);
+}
+
+void GLEncoder::s_glBlendFuncSeparateOES(void* self, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_state->stateShadow().skipBlendFunc(srcRGB, dstRGB, srcAlpha, dstAlpha)) return;
+    ctx->m_glBlendFuncSeparateOES_enc(ctx, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+void GLEncoder::s_glDepthFunc(void* self, GLenum func)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_state->stateShadow().skipDepthFunc(func)) return;
+    ctx->m_glDepthFunc_enc(ctx, func);
+}
+
+void GLEncoder::s_glCullFace(void* self, GLenum mode)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_state->stateShadow().skipCullFace(mode)) return;
+    ctx->m_glCullFace_enc(ctx, mode);
+}
+
+void GLEncoder::s_glFrontFace(void* self, GLenum mode)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_state->stateShadow().skipFrontFace(mode)) return;
+    ctx->m_glFrontFace_enc(ctx, mode);
+}
+
+void GLEncoder::s_glViewport(void* self, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    // Negative sizes go to the host, which reports the error.
+    if (width >= 0 && height >= 0 &&
+        ctx->m_state->stateShadow().skipViewport(x, y, width, height)) {
+        return;
+    }
+    ctx->m_glViewport_enc(ctx, x, y, width, height);
+}
+
+void GLEncoder::s_glScissor(void* self, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    // Negative sizes go to the host, which reports the error.
+    if (width >= 0 && height >= 0 &&
+        ctx->m_state->stateShadow().skipScissor(x, y, width, height)) {
+        return;
+    }
+    ctx->m_glScissor_enc(ctx, x, y, width, height);
+}
+
+// The generated encoders flush the command header before the pixels and
+// write them separately; checksummed streams still go through them.
+void GLEncoder::s_glTexImage2D(void* self, GLenum target, GLint level, GLint internalformat,
+        GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type,
+        const GLvoid* pixels)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_checksumCalculator->getVersion() > 0) {
+        ctx->m_glTexImage2D_enc(ctx, target, level, internalformat, width, height, border,
+                                format, type, pixels);
+        return;
+    }
+    const uint32_t pixelsSize = pixels ?
+        glesv1_enc::pixelDataSize(ctx, width, height, format, type, 0) : 0;
+    ctx->m_stream->allocLargeParamHeader(OP_glTexImage2D, pixelsSize, 0, target, level,
+                                         internalformat, width, height, border, format, type);
+    ctx->m_stream->writeLargeParam(pixels, pixelsSize);
+}
+
+void GLEncoder::s_glTexSubImage2D(void* self, GLenum target, GLint level, GLint xoffset,
+        GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type,
+        const GLvoid* pixels)
+{
+    GLEncoder* ctx = (GLEncoder*)self;
+    if (ctx->m_checksumCalculator->getVersion() > 0) {
+        ctx->m_glTexSubImage2D_enc(ctx, target, level, xoffset, yoffset, width, height,
+                                   format, type, pixels);
+        return;
+    }
+    const uint32_t pixelsSize = pixels ?
+        glesv1_enc::pixelDataSize(ctx, width, height, format, type, 0) : 0;
+    ctx->m_stream->allocLargeParamHeader(OP_glTexSubImage2D, pixelsSize, 0, target, level,
+                                         xoffset, yoffset, width, height, format, type);
+    ctx->m_stream->writeLargeParam(pixels, pixelsSize);
+}
+
 GLEncoder::GLEncoder(IOStream *stream, ChecksumCalculator *protocol)
         : gl_encoder_context_t(stream, protocol)
 {
@@ -1028,6 +1435,7 @@ GLEncoder::GLEncoder(IOStream *stream, ChecksumCalculator *protocol)
     m_error = GL_NO_ERROR;
     m_num_compressedTextureFormats = 0;
     m_compressedTextureFormats = NULL;
+    m_hostClientActiveTexture = GL_TEXTURE0;
 
     // overrides;
 #define OVERRIDE(name)  m_##name##_enc = this-> name ; this-> name = &s_##name
@@ -1079,6 +1487,8 @@ GLEncoder::GLEncoder(IOStream *stream, ChecksumCalculator *protocol)
     OVERRIDE(glTexParameterx);
     OVERRIDE(glTexParameteriv);
     OVERRIDE(glTexParameterxv);
+    OVERRIDE(glTexImage2D);
+    OVERRIDE(glTexSubImage2D);
 
     OVERRIDE(glGenFramebuffersOES);
     OVERRIDE(glDeleteFramebuffersOES);
@@ -1087,6 +1497,53 @@ GLEncoder::GLEncoder(IOStream *stream, ChecksumCalculator *protocol)
     OVERRIDE(glFramebufferTexture2DMultisampleIMG);
     OVERRIDE(glGetFramebufferAttachmentParameterivOES);
 
+    OVERRIDE(glColor4f);
+    OVERRIDE(glColor4ub);
+    OVERRIDE(glColor4x);
+    OVERRIDE(glColor4xOES);
+    OVERRIDE(glMatrixMode);
+    OVERRIDE(glLoadIdentity);
+    OVERRIDE(glLoadMatrixf);
+    OVERRIDE(glLoadMatrixx);
+    OVERRIDE(glLoadMatrixxOES);
+    OVERRIDE(glMultMatrixf);
+    OVERRIDE(glMultMatrixx);
+    OVERRIDE(glMultMatrixxOES);
+    OVERRIDE(glRotatef);
+    OVERRIDE(glRotatex);
+    OVERRIDE(glRotatexOES);
+    OVERRIDE(glScalef);
+    OVERRIDE(glScalex);
+    OVERRIDE(glScalexOES);
+    OVERRIDE(glTranslatef);
+    OVERRIDE(glTranslatex);
+    OVERRIDE(glTranslatexOES);
+    OVERRIDE(glOrthof);
+    OVERRIDE(glOrthofOES);
+    OVERRIDE(glOrthox);
+    OVERRIDE(glOrthoxOES);
+    OVERRIDE(glFrustumf);
+    OVERRIDE(glFrustumfOES);
+    OVERRIDE(glFrustumx);
+    OVERRIDE(glFrustumxOES);
+    OVERRIDE(glPopMatrix);
+    OVERRIDE(glTexEnvf);
+    OVERRIDE(glTexEnvi);
+    OVERRIDE(glTexEnvx);
+    OVERRIDE(glTexEnvxOES);
+    OVERRIDE(glTexEnvfv);
+    OVERRIDE(glTexEnviv);
+    OVERRIDE(glTexEnvxv);
+    OVERRIDE(glTexEnvxvOES);
+    OVERRIDE(glShadeModel);
+    OVERRIDE(glBlendFunc);
+    OVERRIDE(glBlendFuncSeparateOES);
+    OVERRIDE(glDepthFunc);
+    OVERRIDE(glCullFace);
+    OVERRIDE(glFrontFace);
+    OVERRIDE(glViewport);
+    OVERRIDE(glScissor);
+
     this->glReadnPixelsEXT = s_glReadnPixelsEXT;
 }
 
@@ -30,6 +30,8 @@ public:
     virtual ~GLEncoder();
     void setClientState(GLClientState *state) {
         m_state = state;
+        // Not known for the context being switched to.
+        m_hostClientActiveTexture = GL_NONE;
     }
     void setSharedGroup(GLSharedGroupPtr shared) {
         m_shared = shared;
@@ -48,6 +50,9 @@ public:
     void override2DTextureTarget(GLenum target);
     void restore2DTextureTarget();
 
+    // Frees scratch storage that grew for large draws.
+    void trimScratchBuffers() { std::vector<char>().swap(m_fixedBuffer); }
+
 private:
 
     bool    m_initialized;
@@ -55,6 +60,8 @@ private:
     GLSharedGroupPtr m_shared;
     GLenum  m_error;
     std::vector<char> m_fixedBuffer;
+    // Last glClientActiveTexture sent; only sendVertexData sends it.
+    GLenum m_hostClientActiveTexture;
     GLint *m_compressedTextureFormats;
     GLint m_num_compressedTextureFormats;
 
@@ -103,6 +110,8 @@ private:
     glTexParameterx_client_proc_t m_glTexParameterx_enc;
     glTexParameteriv_client_proc_t m_glTexParameteriv_enc;
     glTexParameterxv_client_proc_t m_glTexParameterxv_enc;
+    glTexImage2D_client_proc_t m_glTexImage2D_enc;
+    glTexSubImage2D_client_proc_t m_glTexSubImage2D_enc;
 
     glGenFramebuffersOES_client_proc_t m_glGenFramebuffersOES_enc;
     glDeleteFramebuffersOES_client_proc_t m_glDeleteFramebuffersOES_enc;
@@ -111,6 +120,53 @@ private:
     glFramebufferTexture2DMultisampleIMG_client_proc_t m_glFramebufferTexture2DMultisampleIMG_enc;
     glGetFramebufferAttachmentParameterivOES_client_proc_t m_glGetFramebufferAttachmentParameterivOES_enc;
 
+    glColor4f_client_proc_t m_glColor4f_enc;
+    glColor4ub_client_proc_t m_glColor4ub_enc;
+    glColor4x_client_proc_t m_glColor4x_enc;
+    glColor4xOES_client_proc_t m_glColor4xOES_enc;
+    glMatrixMode_client_proc_t m_glMatrixMode_enc;
+    glLoadIdentity_client_proc_t m_glLoadIdentity_enc;
+    glLoadMatrixf_client_proc_t m_glLoadMatrixf_enc;
+    glLoadMatrixx_client_proc_t m_glLoadMatrixx_enc;
+    glLoadMatrixxOES_client_proc_t m_glLoadMatrixxOES_enc;
+    glMultMatrixf_client_proc_t m_glMultMatrixf_enc;
+    glMultMatrixx_client_proc_t m_glMultMatrixx_enc;
+    glMultMatrixxOES_client_proc_t m_glMultMatrixxOES_enc;
+    glRotatef_client_proc_t m_glRotatef_enc;
+    glRotatex_client_proc_t m_glRotatex_enc;
+    glRotatexOES_client_proc_t m_glRotatexOES_enc;
+    glScalef_client_proc_t m_glScalef_enc;
+    glScalex_client_proc_t m_glScalex_enc;
+    glScalexOES_client_proc_t m_glScalexOES_enc;
+    glTranslatef_client_proc_t m_glTranslatef_enc;
+    glTranslatex_client_proc_t m_glTranslatex_enc;
+    glTranslatexOES_client_proc_t m_glTranslatexOES_enc;
+    glOrthof_client_proc_t m_glOrthof_enc;
+    glOrthofOES_client_proc_t m_glOrthofOES_enc;
+    glOrthox_client_proc_t m_glOrthox_enc;
+    glOrthoxOES_client_proc_t m_glOrthoxOES_enc;
+    glFrustumf_client_proc_t m_glFrustumf_enc;
+    glFrustumfOES_client_proc_t m_glFrustumfOES_enc;
+    glFrustumx_client_proc_t m_glFrustumx_enc;
+    glFrustumxOES_client_proc_t m_glFrustumxOES_enc;
+    glPopMatrix_client_proc_t m_glPopMatrix_enc;
+    glTexEnvf_client_proc_t m_glTexEnvf_enc;
+    glTexEnvi_client_proc_t m_glTexEnvi_enc;
+    glTexEnvx_client_proc_t m_glTexEnvx_enc;
+    glTexEnvxOES_client_proc_t m_glTexEnvxOES_enc;
+    glTexEnvfv_client_proc_t m_glTexEnvfv_enc;
+    glTexEnviv_client_proc_t m_glTexEnviv_enc;
+    glTexEnvxv_client_proc_t m_glTexEnvxv_enc;
+    glTexEnvxvOES_client_proc_t m_glTexEnvxvOES_enc;
+    glShadeModel_client_proc_t m_glShadeModel_enc;
+    glBlendFunc_client_proc_t m_glBlendFunc_enc;
+    glBlendFuncSeparateOES_client_proc_t m_glBlendFuncSeparateOES_enc;
+    glDepthFunc_client_proc_t m_glDepthFunc_enc;
+    glCullFace_client_proc_t m_glCullFace_enc;
+    glFrontFace_client_proc_t m_glFrontFace_enc;
+    glViewport_client_proc_t m_glViewport_enc;
+    glScissor_client_proc_t m_glScissor_enc;
+
     // statics
     static GLenum s_glGetError(void * self);
     static void s_glGetIntegerv(void *self, GLenum pname, GLint *ptr);
@@ -158,6 +214,13 @@ private:
     static void s_glTexParameterx(void* self, GLenum target, GLenum pname, GLfixed param);
     static void s_glTexParameteriv(void* self, GLenum target, GLenum pname, const GLint* params);
     static void s_glTexParameterxv(void* self, GLenum target, GLenum pname, const GLfixed* params);
+    // Send the pixels with the command header in one write.
+    static void s_glTexImage2D(void* self, GLenum target, GLint level, GLint internalformat,
+            GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type,
+            const GLvoid* pixels);
+    static void s_glTexSubImage2D(void* self, GLenum target, GLint level, GLint xoffset,
+            GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type,
+            const GLvoid* pixels);
 
     static void s_glGenFramebuffersOES(void* self, GLsizei n, GLuint* framebuffers);
     static void s_glDeleteFramebuffersOES(void* self, GLsizei n, const GLuint* framebuffers);
@@ -165,6 +228,55 @@ private:
     static void s_glFramebufferTexture2DOES(void* self, GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
     static void s_glFramebufferTexture2DMultisampleIMG(void* self, GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLsizei samples);
     static void s_glGetFramebufferAttachmentParameterivOES(void* self, GLenum target, GLenum attachment, GLenum pname, GLint* params);
+
+    // Fixed function state filtered through the client state's shadow.
+    static void s_glColor4f(void* self, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+    static void s_glColor4ub(void* self, GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha);
+    static void s_glColor4x(void* self, GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha);
+    static void s_glColor4xOES(void* self, GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha);
+    static void s_glMatrixMode(void* self, GLenum mode);
+    static void s_glLoadIdentity(void* self);
+    static void s_glLoadMatrixf(void* self, const GLfloat* m);
+    static void s_glLoadMatrixx(void* self, const GLfixed* m);
+    static void s_glLoadMatrixxOES(void* self, const GLfixed* m);
+    static void s_glMultMatrixf(void* self, const GLfloat* m);
+    static void s_glMultMatrixx(void* self, const GLfixed* m);
+    static void s_glMultMatrixxOES(void* self, const GLfixed* m);
+    static void s_glRotatef(void* self, GLfloat angle, GLfloat x, GLfloat y, GLfloat z);
+    static void s_glRotatex(void* self, GLfixed angle, GLfixed x, GLfixed y, GLfixed z);
+    static void s_glRotatexOES(void* self, GLfixed angle, GLfixed x, GLfixed y, GLfixed z);
+    static void s_glScalef(void* self, GLfloat x, GLfloat y, GLfloat z);
+    static void s_glScalex(void* self, GLfixed x, GLfixed y, GLfixed z);
+    static void s_glScalexOES(void* self, GLfixed x, GLfixed y, GLfixed z);
+    static void s_glTranslatef(void* self, GLfloat x, GLfloat y, GLfloat z);
+    static void s_glTranslatex(void* self, GLfixed x, GLfixed y, GLfixed z);
+    static void s_glTranslatexOES(void* self, GLfixed x, GLfixed y, GLfixed z);
+    static void s_glOrthof(void* self, GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
+    static void s_glOrthofOES(void* self, GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
+    static void s_glOrthox(void* self, GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
+    static void s_glOrthoxOES(void* self, GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
+    static void s_glFrustumf(void* self, GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
+    static void s_glFrustumfOES(void* self, GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar);
+    static void s_glFrustumx(void* self, GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
+    static void s_glFrustumxOES(void* self, GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar);
+    static void s_glPopMatrix(void* self);
+    static void s_glTexEnvf(void* self, GLenum target, GLenum pname, GLfloat param);
+    static void s_glTexEnvi(void* self, GLenum target, GLenum pname, GLint param);
+    static void s_glTexEnvx(void* self, GLenum target, GLenum pname, GLfixed param);
+    static void s_glTexEnvxOES(void* self, GLenum target, GLenum pname, GLfixed param);
+    static void s_glTexEnvfv(void* self, GLenum target, GLenum pname, const GLfloat* params);
+    static void s_glTexEnviv(void* self, GLenum target, GLenum pname, const GLint* params);
+    static void s_glTexEnvxv(void* self, GLenum target, GLenum pname, const GLfixed* params);
+    static void s_glTexEnvxvOES(void* self, GLenum target, GLenum pname, const GLfixed* params);
+    static void s_glShadeModel(void* self, GLenum mode);
+    static void s_glBlendFunc(void* self, GLenum sfactor, GLenum dfactor);
+    static void s_glBlendFuncSeparateOES(void* self, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+    static void s_glDepthFunc(void* self, GLenum func);
+    static void s_glCullFace(void* self, GLenum mode);
+    static void s_glFrontFace(void* self, GLenum mode);
+    static void s_glViewport(void* self, GLint x, GLint y, GLsizei width, GLsizei height);
+    static void s_glScissor(void* self, GLint x, GLint y, GLsizei width, GLsizei height);
+
     static void s_glReadnPixelsEXT(void* self, GLint x, GLint y, GLsizei width,
             GLsizei height, GLenum format, GLenum type, GLsizei bufSize,
             GLvoid* pixels);
@@ -4,287 +4,564 @@
 #define __gl_client_ftable_t_h
 
 
-static const struct _gl_funcs_by_name {
-	const char *name;
-	void *proc;
-} gl_funcs_by_name[] = {
-	{"glAlphaFunc", (void*)glAlphaFunc},
-	{"glClearColor", (void*)glClearColor},
-	{"glClearDepthf", (void*)glClearDepthf},
-	{"glClipPlanef", (void*)glClipPlanef},
-	{"glColor4f", (void*)glColor4f},
-	{"glDepthRangef", (void*)glDepthRangef},
-	{"glFogf", (void*)glFogf},
-	{"glFogfv", (void*)glFogfv},
-	{"glFrustumf", (void*)glFrustumf},
-	{"glGetClipPlanef", (void*)glGetClipPlanef},
-	{"glGetFloatv", (void*)glGetFloatv},
-	{"glGetLightfv", (void*)glGetLightfv},
-	{"glGetMaterialfv", (void*)glGetMaterialfv},
-	{"glGetTexEnvfv", (void*)glGetTexEnvfv},
-	{"glGetTexParameterfv", (void*)glGetTexParameterfv},
-	{"glLightModelf", (void*)glLightModelf},
-	{"glLightModelfv", (void*)glLightModelfv},
-	{"glLightf", (void*)glLightf},
-	{"glLightfv", (void*)glLightfv},
-	{"glLineWidth", (void*)glLineWidth},
-	{"glLoadMatrixf", (void*)glLoadMatrixf},
-	{"glMaterialf", (void*)glMaterialf},
-	{"glMaterialfv", (void*)glMaterialfv},
-	{"glMultMatrixf", (void*)glMultMatrixf},
-	{"glMultiTexCoord4f", (void*)glMultiTexCoord4f},
-	{"glNormal3f", (void*)glNormal3f},
-	{"glOrthof", (void*)glOrthof},
-	{"glPointParameterf", (void*)glPointParameterf},
-	{"glPointParameterfv", (void*)glPointParameterfv},
-	{"glPointSize", (void*)glPointSize},
-	{"glPolygonOffset", (void*)glPolygonOffset},
-	{"glRotatef", (void*)glRotatef},
-	{"glScalef", (void*)glScalef},
-	{"glTexEnvf", (void*)glTexEnvf},
-	{"glTexEnvfv", (void*)glTexEnvfv},
-	{"glTexParameterf", (void*)glTexParameterf},
-	{"glTexParameterfv", (void*)glTexParameterfv},
-	{"glTranslatef", (void*)glTranslatef},
-	{"glActiveTexture", (void*)glActiveTexture},
-	{"glAlphaFuncx", (void*)glAlphaFuncx},
-	{"glBindBuffer", (void*)glBindBuffer},
-	{"glBindTexture", (void*)glBindTexture},
-	{"glBlendFunc", (void*)glBlendFunc},
-	{"glBufferData", (void*)glBufferData},
-	{"glBufferSubData", (void*)glBufferSubData},
-	{"glClear", (void*)glClear},
-	{"glClearColorx", (void*)glClearColorx},
-	{"glClearDepthx", (void*)glClearDepthx},
-	{"glClearStencil", (void*)glClearStencil},
-	{"glClientActiveTexture", (void*)glClientActiveTexture},
-	{"glColor4ub", (void*)glColor4ub},
-	{"glColor4x", (void*)glColor4x},
-	{"glColorMask", (void*)glColorMask},
-	{"glColorPointer", (void*)glColorPointer},
-	{"glCompressedTexImage2D", (void*)glCompressedTexImage2D},
-	{"glCompressedTexSubImage2D", (void*)glCompressedTexSubImage2D},
-	{"glCopyTexImage2D", (void*)glCopyTexImage2D},
-	{"glCopyTexSubImage2D", (void*)glCopyTexSubImage2D},
-	{"glCullFace", (void*)glCullFace},
-	{"glDeleteBuffers", (void*)glDeleteBuffers},
-	{"glDeleteTextures", (void*)glDeleteTextures},
-	{"glDepthFunc", (void*)glDepthFunc},
-	{"glDepthMask", (void*)glDepthMask},
-	{"glDepthRangex", (void*)glDepthRangex},
-	{"glDisable", (void*)glDisable},
-	{"glDisableClientState", (void*)glDisableClientState},
-	{"glDrawArrays", (void*)glDrawArrays},
-	{"glDrawElements", (void*)glDrawElements},
-	{"glEnable", (void*)glEnable},
-	{"glEnableClientState", (void*)glEnableClientState},
-	{"glFinish", (void*)glFinish},
-	{"glFlush", (void*)glFlush},
-	{"glFogx", (void*)glFogx},
-	{"glFogxv", (void*)glFogxv},
-	{"glFrontFace", (void*)glFrontFace},
-	{"glFrustumx", (void*)glFrustumx},
-	{"glGetBooleanv", (void*)glGetBooleanv},
-	{"glGetBufferParameteriv", (void*)glGetBufferParameteriv},
-	{"glClipPlanex", (void*)glClipPlanex},
-	{"glGenBuffers", (void*)glGenBuffers},
-	{"glGenTextures", (void*)glGenTextures},
-	{"glGetError", (void*)glGetError},
-	{"glGetFixedv", (void*)glGetFixedv},
-	{"glGetIntegerv", (void*)glGetIntegerv},
-	{"glGetLightxv", (void*)glGetLightxv},
-	{"glGetMaterialxv", (void*)glGetMaterialxv},
-	{"glGetPointerv", (void*)glGetPointerv},
-	{"glGetString", (void*)glGetString},
-	{"glGetTexEnviv", (void*)glGetTexEnviv},
-	{"glGetTexEnvxv", (void*)glGetTexEnvxv},
-	{"glGetTexParameteriv", (void*)glGetTexParameteriv},
-	{"glGetTexParameterxv", (void*)glGetTexParameterxv},
-	{"glHint", (void*)glHint},
-	{"glIsBuffer", (void*)glIsBuffer},
-	{"glIsEnabled", (void*)glIsEnabled},
-	{"glIsTexture", (void*)glIsTexture},
-	{"glLightModelx", (void*)glLightModelx},
-	{"glLightModelxv", (void*)glLightModelxv},
-	{"glLightx", (void*)glLightx},
-	{"glLightxv", (void*)glLightxv},
-	{"glLineWidthx", (void*)glLineWidthx},
-	{"glLoadIdentity", (void*)glLoadIdentity},
-	{"glLoadMatrixx", (void*)glLoadMatrixx},
-	{"glLogicOp", (void*)glLogicOp},
-	{"glMaterialx", (void*)glMaterialx},
-	{"glMaterialxv", (void*)glMaterialxv},
-	{"glMatrixMode", (void*)glMatrixMode},
-	{"glMultMatrixx", (void*)glMultMatrixx},
-	{"glMultiTexCoord4x", (void*)glMultiTexCoord4x},
-	{"glNormal3x", (void*)glNormal3x},
-	{"glNormalPointer", (void*)glNormalPointer},
-	{"glOrthox", (void*)glOrthox},
-	{"glPixelStorei", (void*)glPixelStorei},
-	{"glPointParameterx", (void*)glPointParameterx},
-	{"glPointParameterxv", (void*)glPointParameterxv},
-	{"glPointSizex", (void*)glPointSizex},
-	{"glPolygonOffsetx", (void*)glPolygonOffsetx},
-	{"glPopMatrix", (void*)glPopMatrix},
-	{"glPushMatrix", (void*)glPushMatrix},
-	{"glReadPixels", (void*)glReadPixels},
-	{"glRotatex", (void*)glRotatex},
-	{"glSampleCoverage", (void*)glSampleCoverage},
-	{"glSampleCoveragex", (void*)glSampleCoveragex},
-	{"glScalex", (void*)glScalex},
-	{"glScissor", (void*)glScissor},
-	{"glShadeModel", (void*)glShadeModel},
-	{"glStencilFunc", (void*)glStencilFunc},
-	{"glStencilMask", (void*)glStencilMask},
-	{"glStencilOp", (void*)glStencilOp},
-	{"glTexCoordPointer", (void*)glTexCoordPointer},
-	{"glTexEnvi", (void*)glTexEnvi},
-	{"glTexEnvx", (void*)glTexEnvx},
-	{"glTexEnviv", (void*)glTexEnviv},
-	{"glTexEnvxv", (void*)glTexEnvxv},
-	{"glTexImage2D", (void*)glTexImage2D},
-	{"glTexParameteri", (void*)glTexParameteri},
-	{"glTexParameterx", (void*)glTexParameterx},
-	{"glTexParameteriv", (void*)glTexParameteriv},
-	{"glTexParameterxv", (void*)glTexParameterxv},
-	{"glTexSubImage2D", (void*)glTexSubImage2D},
-	{"glTranslatex", (void*)glTranslatex},
-	{"glVertexPointer", (void*)glVertexPointer},
-	{"glViewport", (void*)glViewport},
-	{"glPointSizePointerOES", (void*)glPointSizePointerOES},
-	{"glBlendEquationSeparateOES", (void*)glBlendEquationSeparateOES},
-	{"glBlendFuncSeparateOES", (void*)glBlendFuncSeparateOES},
-	{"glBlendEquationOES", (void*)glBlendEquationOES},
-	{"glDrawTexsOES", (void*)glDrawTexsOES},
-	{"glDrawTexiOES", (void*)glDrawTexiOES},
-	{"glDrawTexxOES", (void*)glDrawTexxOES},
-	{"glDrawTexsvOES", (void*)glDrawTexsvOES},
-	{"glDrawTexivOES", (void*)glDrawTexivOES},
-	{"glDrawTexxvOES", (void*)glDrawTexxvOES},
-	{"glDrawTexfOES", (void*)glDrawTexfOES},
-	{"glDrawTexfvOES", (void*)glDrawTexfvOES},
-	{"glEGLImageTargetTexture2DOES", (void*)glEGLImageTargetTexture2DOES},
-	{"glEGLImageTargetRenderbufferStorageOES", (void*)glEGLImageTargetRenderbufferStorageOES},
-	{"glAlphaFuncxOES", (void*)glAlphaFuncxOES},
-	{"glClearColorxOES", (void*)glClearColorxOES},
-	{"glClearDepthxOES", (void*)glClearDepthxOES},
-	{"glClipPlanexOES", (void*)glClipPlanexOES},
-	{"glClipPlanexIMG", (void*)glClipPlanexIMG},
-	{"glColor4xOES", (void*)glColor4xOES},
-	{"glDepthRangexOES", (void*)glDepthRangexOES},
-	{"glFogxOES", (void*)glFogxOES},
-	{"glFogxvOES", (void*)glFogxvOES},
-	{"glFrustumxOES", (void*)glFrustumxOES},
-	{"glGetClipPlanexOES", (void*)glGetClipPlanexOES},
-	{"glGetClipPlanex", (void*)glGetClipPlanex},
-	{"glGetFixedvOES", (void*)glGetFixedvOES},
-	{"glGetLightxvOES", (void*)glGetLightxvOES},
-	{"glGetMaterialxvOES", (void*)glGetMaterialxvOES},
-	{"glGetTexEnvxvOES", (void*)glGetTexEnvxvOES},
-	{"glGetTexParameterxvOES", (void*)glGetTexParameterxvOES},
-	{"glLightModelxOES", (void*)glLightModelxOES},
-	{"glLightModelxvOES", (void*)glLightModelxvOES},
-	{"glLightxOES", (void*)glLightxOES},
-	{"glLightxvOES", (void*)glLightxvOES},
-	{"glLineWidthxOES", (void*)glLineWidthxOES},
-	{"glLoadMatrixxOES", (void*)glLoadMatrixxOES},
-	{"glMaterialxOES", (void*)glMaterialxOES},
-	{"glMaterialxvOES", (void*)glMaterialxvOES},
-	{"glMultMatrixxOES", (void*)glMultMatrixxOES},
-	{"glMultiTexCoord4xOES", (void*)glMultiTexCoord4xOES},
-	{"glNormal3xOES", (void*)glNormal3xOES},
-	{"glOrthoxOES", (void*)glOrthoxOES},
-	{"glPointParameterxOES", (void*)glPointParameterxOES},
-	{"glPointParameterxvOES", (void*)glPointParameterxvOES},
-	{"glPointSizexOES", (void*)glPointSizexOES},
-	{"glPolygonOffsetxOES", (void*)glPolygonOffsetxOES},
-	{"glRotatexOES", (void*)glRotatexOES},
-	{"glSampleCoveragexOES", (void*)glSampleCoveragexOES},
-	{"glScalexOES", (void*)glScalexOES},
-	{"glTexEnvxOES", (void*)glTexEnvxOES},
-	{"glTexEnvxvOES", (void*)glTexEnvxvOES},
-	{"glTexParameterxOES", (void*)glTexParameterxOES},
-	{"glTexParameterxvOES", (void*)glTexParameterxvOES},
-	{"glTranslatexOES", (void*)glTranslatexOES},
-	{"glIsRenderbufferOES", (void*)glIsRenderbufferOES},
-	{"glBindRenderbufferOES", (void*)glBindRenderbufferOES},
-	{"glDeleteRenderbuffersOES", (void*)glDeleteRenderbuffersOES},
-	{"glGenRenderbuffersOES", (void*)glGenRenderbuffersOES},
-	{"glRenderbufferStorageOES", (void*)glRenderbufferStorageOES},
-	{"glGetRenderbufferParameterivOES", (void*)glGetRenderbufferParameterivOES},
-	{"glIsFramebufferOES", (void*)glIsFramebufferOES},
-	{"glBindFramebufferOES", (void*)glBindFramebufferOES},
-	{"glDeleteFramebuffersOES", (void*)glDeleteFramebuffersOES},
-	{"glGenFramebuffersOES", (void*)glGenFramebuffersOES},
-	{"glCheckFramebufferStatusOES", (void*)glCheckFramebufferStatusOES},
-	{"glFramebufferRenderbufferOES", (void*)glFramebufferRenderbufferOES},
-	{"glFramebufferTexture2DOES", (void*)glFramebufferTexture2DOES},
-	{"glGetFramebufferAttachmentParameterivOES", (void*)glGetFramebufferAttachmentParameterivOES},
-	{"glGenerateMipmapOES", (void*)glGenerateMipmapOES},
-	{"glMapBufferOES", (void*)glMapBufferOES},
-	{"glUnmapBufferOES", (void*)glUnmapBufferOES},
-	{"glGetBufferPointervOES", (void*)glGetBufferPointervOES},
-	{"glCurrentPaletteMatrixOES", (void*)glCurrentPaletteMatrixOES},
-	{"glLoadPaletteFromModelViewMatrixOES", (void*)glLoadPaletteFromModelViewMatrixOES},
-	{"glMatrixIndexPointerOES", (void*)glMatrixIndexPointerOES},
-	{"glWeightPointerOES", (void*)glWeightPointerOES},
-	{"glQueryMatrixxOES", (void*)glQueryMatrixxOES},
-	{"glDepthRangefOES", (void*)glDepthRangefOES},
-	{"glFrustumfOES", (void*)glFrustumfOES},
-	{"glOrthofOES", (void*)glOrthofOES},
-	{"glClipPlanefOES", (void*)glClipPlanefOES},
-	{"glClipPlanefIMG", (void*)glClipPlanefIMG},
-	{"glGetClipPlanefOES", (void*)glGetClipPlanefOES},
-	{"glClearDepthfOES", (void*)glClearDepthfOES},
-	{"glTexGenfOES", (void*)glTexGenfOES},
-	{"glTexGenfvOES", (void*)glTexGenfvOES},
-	{"glTexGeniOES", (void*)glTexGeniOES},
-	{"glTexGenivOES", (void*)glTexGenivOES},
-	{"glTexGenxOES", (void*)glTexGenxOES},
-	{"glTexGenxvOES", (void*)glTexGenxvOES},
-	{"glGetTexGenfvOES", (void*)glGetTexGenfvOES},
-	{"glGetTexGenivOES", (void*)glGetTexGenivOES},
-	{"glGetTexGenxvOES", (void*)glGetTexGenxvOES},
-	{"glBindVertexArrayOES", (void*)glBindVertexArrayOES},
-	{"glDeleteVertexArraysOES", (void*)glDeleteVertexArraysOES},
-	{"glGenVertexArraysOES", (void*)glGenVertexArraysOES},
-	{"glIsVertexArrayOES", (void*)glIsVertexArrayOES},
-	{"glDiscardFramebufferEXT", (void*)glDiscardFramebufferEXT},
-	{"glMultiDrawArraysEXT", (void*)glMultiDrawArraysEXT},
-	{"glMultiDrawElementsEXT", (void*)glMultiDrawElementsEXT},
-	{"glMultiDrawArraysSUN", (void*)glMultiDrawArraysSUN},
-	{"glMultiDrawElementsSUN", (void*)glMultiDrawElementsSUN},
-	{"glRenderbufferStorageMultisampleIMG", (void*)glRenderbufferStorageMultisampleIMG},
-	{"glFramebufferTexture2DMultisampleIMG", (void*)glFramebufferTexture2DMultisampleIMG},
-	{"glDeleteFencesNV", (void*)glDeleteFencesNV},
-	{"glGenFencesNV", (void*)glGenFencesNV},
-	{"glIsFenceNV", (void*)glIsFenceNV},
-	{"glTestFenceNV", (void*)glTestFenceNV},
-	{"glGetFenceivNV", (void*)glGetFenceivNV},
-	{"glFinishFenceNV", (void*)glFinishFenceNV},
-	{"glSetFenceNV", (void*)glSetFenceNV},
-	{"glGetDriverControlsQCOM", (void*)glGetDriverControlsQCOM},
-	{"glGetDriverControlStringQCOM", (void*)glGetDriverControlStringQCOM},
-	{"glEnableDriverControlQCOM", (void*)glEnableDriverControlQCOM},
-	{"glDisableDriverControlQCOM", (void*)glDisableDriverControlQCOM},
-	{"glExtGetTexturesQCOM", (void*)glExtGetTexturesQCOM},
-	{"glExtGetBuffersQCOM", (void*)glExtGetBuffersQCOM},
-	{"glExtGetRenderbuffersQCOM", (void*)glExtGetRenderbuffersQCOM},
-	{"glExtGetFramebuffersQCOM", (void*)glExtGetFramebuffersQCOM},
-	{"glExtGetTexLevelParameterivQCOM", (void*)glExtGetTexLevelParameterivQCOM},
-	{"glExtTexObjectStateOverrideiQCOM", (void*)glExtTexObjectStateOverrideiQCOM},
-	{"glExtGetTexSubImageQCOM", (void*)glExtGetTexSubImageQCOM},
-	{"glExtGetBufferPointervQCOM", (void*)glExtGetBufferPointervQCOM},
-	{"glExtGetShadersQCOM", (void*)glExtGetShadersQCOM},
-	{"glExtGetProgramsQCOM", (void*)glExtGetProgramsQCOM},
-	{"glExtIsProgramBinaryQCOM", (void*)glExtIsProgramBinaryQCOM},
-	{"glExtGetProgramBinarySourceQCOM", (void*)glExtGetProgramBinarySourceQCOM},
-	{"glStartTilingQCOM", (void*)glStartTilingQCOM},
-	{"glEndTilingQCOM", (void*)glEndTilingQCOM},
-	{"glGetGraphicsResetStatusEXT", (void*)glGetGraphicsResetStatusEXT},
-	{"glReadnPixelsEXT", (void*)glReadnPixelsEXT},
+// Names one after another, each with its terminating NUL, in the order of
+// gl_funcs_by_proc. Keeping them out of pointer tables spares the
+// library a relocation per entry point at load time.
+static const char gl_funcs_names[] =
+	"glAlphaFunc\0"
+	"glClearColor\0"
+	"glClearDepthf\0"
+	"glClipPlanef\0"
+	"glColor4f\0"
+	"glDepthRangef\0"
+	"glFogf\0"
+	"glFogfv\0"
+	"glFrustumf\0"
+	"glGetClipPlanef\0"
+	"glGetFloatv\0"
+	"glGetLightfv\0"
+	"glGetMaterialfv\0"
+	"glGetTexEnvfv\0"
+	"glGetTexParameterfv\0"
+	"glLightModelf\0"
+	"glLightModelfv\0"
+	"glLightf\0"
+	"glLightfv\0"
+	"glLineWidth\0"
+	"glLoadMatrixf\0"
+	"glMaterialf\0"
+	"glMaterialfv\0"
+	"glMultMatrixf\0"
+	"glMultiTexCoord4f\0"
+	"glNormal3f\0"
+	"glOrthof\0"
+	"glPointParameterf\0"
+	"glPointParameterfv\0"
+	"glPointSize\0"
+	"glPolygonOffset\0"
+	"glRotatef\0"
+	"glScalef\0"
+	"glTexEnvf\0"
+	"glTexEnvfv\0"
+	"glTexParameterf\0"
+	"glTexParameterfv\0"
+	"glTranslatef\0"
+	"glActiveTexture\0"
+	"glAlphaFuncx\0"
+	"glBindBuffer\0"
+	"glBindTexture\0"
+	"glBlendFunc\0"
+	"glBufferData\0"
+	"glBufferSubData\0"
+	"glClear\0"
+	"glClearColorx\0"
+	"glClearDepthx\0"
+	"glClearStencil\0"
+	"glClientActiveTexture\0"
+	"glColor4ub\0"
+	"glColor4x\0"
+	"glColorMask\0"
+	"glColorPointer\0"
+	"glCompressedTexImage2D\0"
+	"glCompressedTexSubImage2D\0"
+	"glCopyTexImage2D\0"
+	"glCopyTexSubImage2D\0"
+	"glCullFace\0"
+	"glDeleteBuffers\0"
+	"glDeleteTextures\0"
+	"glDepthFunc\0"
+	"glDepthMask\0"
+	"glDepthRangex\0"
+	"glDisable\0"
+	"glDisableClientState\0"
+	"glDrawArrays\0"
+	"glDrawElements\0"
+	"glEnable\0"
+	"glEnableClientState\0"
+	"glFinish\0"
+	"glFlush\0"
+	"glFogx\0"
+	"glFogxv\0"
+	"glFrontFace\0"
+	"glFrustumx\0"
+	"glGetBooleanv\0"
+	"glGetBufferParameteriv\0"
+	"glClipPlanex\0"
+	"glGenBuffers\0"
+	"glGenTextures\0"
+	"glGetError\0"
+	"glGetFixedv\0"
+	"glGetIntegerv\0"
+	"glGetLightxv\0"
+	"glGetMaterialxv\0"
+	"glGetPointerv\0"
+	"glGetString\0"
+	"glGetTexEnviv\0"
+	"glGetTexEnvxv\0"
+	"glGetTexParameteriv\0"
+	"glGetTexParameterxv\0"
+	"glHint\0"
+	"glIsBuffer\0"
+	"glIsEnabled\0"
+	"glIsTexture\0"
+	"glLightModelx\0"
+	"glLightModelxv\0"
+	"glLightx\0"
+	"glLightxv\0"
+	"glLineWidthx\0"
+	"glLoadIdentity\0"
+	"glLoadMatrixx\0"
+	"glLogicOp\0"
+	"glMaterialx\0"
+	"glMaterialxv\0"
+	"glMatrixMode\0"
+	"glMultMatrixx\0"
+	"glMultiTexCoord4x\0"
+	"glNormal3x\0"
+	"glNormalPointer\0"
+	"glOrthox\0"
+	"glPixelStorei\0"
+	"glPointParameterx\0"
+	"glPointParameterxv\0"
+	"glPointSizex\0"
+	"glPolygonOffsetx\0"
+	"glPopMatrix\0"
+	"glPushMatrix\0"
+	"glReadPixels\0"
+	"glRotatex\0"
+	"glSampleCoverage\0"
+	"glSampleCoveragex\0"
+	"glScalex\0"
+	"glScissor\0"
+	"glShadeModel\0"
+	"glStencilFunc\0"
+	"glStencilMask\0"
+	"glStencilOp\0"
+	"glTexCoordPointer\0"
+	"glTexEnvi\0"
+	"glTexEnvx\0"
+	"glTexEnviv\0"
+	"glTexEnvxv\0"
+	"glTexImage2D\0"
+	"glTexParameteri\0"
+	"glTexParameterx\0"
+	"glTexParameteriv\0"
+	"glTexParameterxv\0"
+	"glTexSubImage2D\0"
+	"glTranslatex\0"
+	"glVertexPointer\0"
+	"glViewport\0"
+	"glPointSizePointerOES\0"
+	"glBlendEquationSeparateOES\0"
+	"glBlendFuncSeparateOES\0"
+	"glBlendEquationOES\0"
+	"glDrawTexsOES\0"
+	"glDrawTexiOES\0"
+	"glDrawTexxOES\0"
+	"glDrawTexsvOES\0"
+	"glDrawTexivOES\0"
+	"glDrawTexxvOES\0"
+	"glDrawTexfOES\0"
+	"glDrawTexfvOES\0"
+	"glEGLImageTargetTexture2DOES\0"
+	"glEGLImageTargetRenderbufferStorageOES\0"
+	"glAlphaFuncxOES\0"
+	"glClearColorxOES\0"
+	"glClearDepthxOES\0"
+	"glClipPlanexOES\0"
+	"glClipPlanexIMG\0"
+	"glColor4xOES\0"
+	"glDepthRangexOES\0"
+	"glFogxOES\0"
+	"glFogxvOES\0"
+	"glFrustumxOES\0"
+	"glGetClipPlanexOES\0"
+	"glGetClipPlanex\0"
+	"glGetFixedvOES\0"
+	"glGetLightxvOES\0"
+	"glGetMaterialxvOES\0"
+	"glGetTexEnvxvOES\0"
+	"glGetTexParameterxvOES\0"
+	"glLightModelxOES\0"
+	"glLightModelxvOES\0"
+	"glLightxOES\0"
+	"glLightxvOES\0"
+	"glLineWidthxOES\0"
+	"glLoadMatrixxOES\0"
+	"glMaterialxOES\0"
+	"glMaterialxvOES\0"
+	"glMultMatrixxOES\0"
+	"glMultiTexCoord4xOES\0"
+	"glNormal3xOES\0"
+	"glOrthoxOES\0"
+	"glPointParameterxOES\0"
+	"glPointParameterxvOES\0"
+	"glPointSizexOES\0"
+	"glPolygonOffsetxOES\0"
+	"glRotatexOES\0"
+	"glSampleCoveragexOES\0"
+	"glScalexOES\0"
+	"glTexEnvxOES\0"
+	"glTexEnvxvOES\0"
+	"glTexParameterxOES\0"
+	"glTexParameterxvOES\0"
+	"glTranslatexOES\0"
+	"glIsRenderbufferOES\0"
+	"glBindRenderbufferOES\0"
+	"glDeleteRenderbuffersOES\0"
+	"glGenRenderbuffersOES\0"
+	"glRenderbufferStorageOES\0"
+	"glGetRenderbufferParameterivOES\0"
+	"glIsFramebufferOES\0"
+	"glBindFramebufferOES\0"
+	"glDeleteFramebuffersOES\0"
+	"glGenFramebuffersOES\0"
+	"glCheckFramebufferStatusOES\0"
+	"glFramebufferRenderbufferOES\0"
+	"glFramebufferTexture2DOES\0"
+	"glGetFramebufferAttachmentParameterivOES\0"
+	"glGenerateMipmapOES\0"
+	"glMapBufferOES\0"
+	"glUnmapBufferOES\0"
+	"glGetBufferPointervOES\0"
+	"glCurrentPaletteMatrixOES\0"
+	"glLoadPaletteFromModelViewMatrixOES\0"
+	"glMatrixIndexPointerOES\0"
+	"glWeightPointerOES\0"
+	"glQueryMatrixxOES\0"
+	"glDepthRangefOES\0"
+	"glFrustumfOES\0"
+	"glOrthofOES\0"
+	"glClipPlanefOES\0"
+	"glClipPlanefIMG\0"
+	"glGetClipPlanefOES\0"
+	"glClearDepthfOES\0"
+	"glTexGenfOES\0"
+	"glTexGenfvOES\0"
+	"glTexGeniOES\0"
+	"glTexGenivOES\0"
+	"glTexGenxOES\0"
+	"glTexGenxvOES\0"
+	"glGetTexGenfvOES\0"
+	"glGetTexGenivOES\0"
+	"glGetTexGenxvOES\0"
+	"glBindVertexArrayOES\0"
+	"glDeleteVertexArraysOES\0"
+	"glGenVertexArraysOES\0"
+	"glIsVertexArrayOES\0"
+	"glDiscardFramebufferEXT\0"
+	"glMultiDrawArraysEXT\0"
+	"glMultiDrawElementsEXT\0"
+	"glMultiDrawArraysSUN\0"
+	"glMultiDrawElementsSUN\0"
+	"glRenderbufferStorageMultisampleIMG\0"
+	"glFramebufferTexture2DMultisampleIMG\0"
+	"glDeleteFencesNV\0"
+	"glGenFencesNV\0"
+	"glIsFenceNV\0"
+	"glTestFenceNV\0"
+	"glGetFenceivNV\0"
+	"glFinishFenceNV\0"
+	"glSetFenceNV\0"
+	"glGetDriverControlsQCOM\0"
+	"glGetDriverControlStringQCOM\0"
+	"glEnableDriverControlQCOM\0"
+	"glDisableDriverControlQCOM\0"
+	"glExtGetTexturesQCOM\0"
+	"glExtGetBuffersQCOM\0"
+	"glExtGetRenderbuffersQCOM\0"
+	"glExtGetFramebuffersQCOM\0"
+	"glExtGetTexLevelParameterivQCOM\0"
+	"glExtTexObjectStateOverrideiQCOM\0"
+	"glExtGetTexSubImageQCOM\0"
+	"glExtGetBufferPointervQCOM\0"
+	"glExtGetShadersQCOM\0"
+	"glExtGetProgramsQCOM\0"
+	"glExtIsProgramBinaryQCOM\0"
+	"glExtGetProgramBinarySourceQCOM\0"
+	"glStartTilingQCOM\0"
+	"glEndTilingQCOM\0"
+	"glGetGraphicsResetStatusEXT\0"
+	"glReadnPixelsEXT";
+
+static void* const gl_funcs_by_proc[] = {
+	(void*)glAlphaFunc,
+	(void*)glClearColor,
+	(void*)glClearDepthf,
+	(void*)glClipPlanef,
+	(void*)glColor4f,
+	(void*)glDepthRangef,
+	(void*)glFogf,
+	(void*)glFogfv,
+	(void*)glFrustumf,
+	(void*)glGetClipPlanef,
+	(void*)glGetFloatv,
+	(void*)glGetLightfv,
+	(void*)glGetMaterialfv,
+	(void*)glGetTexEnvfv,
+	(void*)glGetTexParameterfv,
+	(void*)glLightModelf,
+	(void*)glLightModelfv,
+	(void*)glLightf,
+	(void*)glLightfv,
+	(void*)glLineWidth,
+	(void*)glLoadMatrixf,
+	(void*)glMaterialf,
+	(void*)glMaterialfv,
+	(void*)glMultMatrixf,
+	(void*)glMultiTexCoord4f,
+	(void*)glNormal3f,
+	(void*)glOrthof,
+	(void*)glPointParameterf,
+	(void*)glPointParameterfv,
+	(void*)glPointSize,
+	(void*)glPolygonOffset,
+	(void*)glRotatef,
+	(void*)glScalef,
+	(void*)glTexEnvf,
+	(void*)glTexEnvfv,
+	(void*)glTexParameterf,
+	(void*)glTexParameterfv,
+	(void*)glTranslatef,
+	(void*)glActiveTexture,
+	(void*)glAlphaFuncx,
+	(void*)glBindBuffer,
+	(void*)glBindTexture,
+	(void*)glBlendFunc,
+	(void*)glBufferData,
+	(void*)glBufferSubData,
+	(void*)glClear,
+	(void*)glClearColorx,
+	(void*)glClearDepthx,
+	(void*)glClearStencil,
+	(void*)glClientActiveTexture,
+	(void*)glColor4ub,
+	(void*)glColor4x,
+	(void*)glColorMask,
+	(void*)glColorPointer,
+	(void*)glCompressedTexImage2D,
+	(void*)glCompressedTexSubImage2D,
+	(void*)glCopyTexImage2D,
+	(void*)glCopyTexSubImage2D,
+	(void*)glCullFace,
+	(void*)glDeleteBuffers,
+	(void*)glDeleteTextures,
+	(void*)glDepthFunc,
+	(void*)glDepthMask,
+	(void*)glDepthRangex,
+	(void*)glDisable,
+	(void*)glDisableClientState,
+	(void*)glDrawArrays,
+	(void*)glDrawElements,
+	(void*)glEnable,
+	(void*)glEnableClientState,
+	(void*)glFinish,
+	(void*)glFlush,
+	(void*)glFogx,
+	(void*)glFogxv,
+	(void*)glFrontFace,
+	(void*)glFrustumx,
+	(void*)glGetBooleanv,
+	(void*)glGetBufferParameteriv,
+	(void*)glClipPlanex,
+	(void*)glGenBuffers,
+	(void*)glGenTextures,
+	(void*)glGetError,
+	(void*)glGetFixedv,
+	(void*)glGetIntegerv,
+	(void*)glGetLightxv,
+	(void*)glGetMaterialxv,
+	(void*)glGetPointerv,
+	(void*)glGetString,
+	(void*)glGetTexEnviv,
+	(void*)glGetTexEnvxv,
+	(void*)glGetTexParameteriv,
+	(void*)glGetTexParameterxv,
+	(void*)glHint,
+	(void*)glIsBuffer,
+	(void*)glIsEnabled,
+	(void*)glIsTexture,
+	(void*)glLightModelx,
+	(void*)glLightModelxv,
+	(void*)glLightx,
+	(void*)glLightxv,
+	(void*)glLineWidthx,
+	(void*)glLoadIdentity,
+	(void*)glLoadMatrixx,
+	(void*)glLogicOp,
+	(void*)glMaterialx,
+	(void*)glMaterialxv,
+	(void*)glMatrixMode,
+	(void*)glMultMatrixx,
+	(void*)glMultiTexCoord4x,
+	(void*)glNormal3x,
+	(void*)glNormalPointer,
+	(void*)glOrthox,
+	(void*)glPixelStorei,
+	(void*)glPointParameterx,
+	(void*)glPointParameterxv,
+	(void*)glPointSizex,
+	(void*)glPolygonOffsetx,
+	(void*)glPopMatrix,
+	(void*)glPushMatrix,
+	(void*)glReadPixels,
+	(void*)glRotatex,
+	(void*)glSampleCoverage,
+	(void*)glSampleCoveragex,
+	(void*)glScalex,
+	(void*)glScissor,
+	(void*)glShadeModel,
+	(void*)glStencilFunc,
+	(void*)glStencilMask,
+	(void*)glStencilOp,
+	(void*)glTexCoordPointer,
+	(void*)glTexEnvi,
+	(void*)glTexEnvx,
+	(void*)glTexEnviv,
+	(void*)glTexEnvxv,
+	(void*)glTexImage2D,
+	(void*)glTexParameteri,
+	(void*)glTexParameterx,
+	(void*)glTexParameteriv,
+	(void*)glTexParameterxv,
+	(void*)glTexSubImage2D,
+	(void*)glTranslatex,
+	(void*)glVertexPointer,
+	(void*)glViewport,
+	(void*)glPointSizePointerOES,
+	(void*)glBlendEquationSeparateOES,
+	(void*)glBlendFuncSeparateOES,
+	(void*)glBlendEquationOES,
+	(void*)glDrawTexsOES,
+	(void*)glDrawTexiOES,
+	(void*)glDrawTexxOES,
+	(void*)glDrawTexsvOES,
+	(void*)glDrawTexivOES,
+	(void*)glDrawTexxvOES,
+	(void*)glDrawTexfOES,
+	(void*)glDrawTexfvOES,
+	(void*)glEGLImageTargetTexture2DOES,
+	(void*)glEGLImageTargetRenderbufferStorageOES,
+	(void*)glAlphaFuncxOES,
+	(void*)glClearColorxOES,
+	(void*)glClearDepthxOES,
+	(void*)glClipPlanexOES,
+	(void*)glClipPlanexIMG,
+	(void*)glColor4xOES,
+	(void*)glDepthRangexOES,
+	(void*)glFogxOES,
+	(void*)glFogxvOES,
+	(void*)glFrustumxOES,
+	(void*)glGetClipPlanexOES,
+	(void*)glGetClipPlanex,
+	(void*)glGetFixedvOES,
+	(void*)glGetLightxvOES,
+	(void*)glGetMaterialxvOES,
+	(void*)glGetTexEnvxvOES,
+	(void*)glGetTexParameterxvOES,
+	(void*)glLightModelxOES,
+	(void*)glLightModelxvOES,
+	(void*)glLightxOES,
+	(void*)glLightxvOES,
+	(void*)glLineWidthxOES,
+	(void*)glLoadMatrixxOES,
+	(void*)glMaterialxOES,
+	(void*)glMaterialxvOES,
+	(void*)glMultMatrixxOES,
+	(void*)glMultiTexCoord4xOES,
+	(void*)glNormal3xOES,
+	(void*)glOrthoxOES,
+	(void*)glPointParameterxOES,
+	(void*)glPointParameterxvOES,
+	(void*)glPointSizexOES,
+	(void*)glPolygonOffsetxOES,
+	(void*)glRotatexOES,
+	(void*)glSampleCoveragexOES,
+	(void*)glScalexOES,
+	(void*)glTexEnvxOES,
+	(void*)glTexEnvxvOES,
+	(void*)glTexParameterxOES,
+	(void*)glTexParameterxvOES,
+	(void*)glTranslatexOES,
+	(void*)glIsRenderbufferOES,
+	(void*)glBindRenderbufferOES,
+	(void*)glDeleteRenderbuffersOES,
+	(void*)glGenRenderbuffersOES,
+	(void*)glRenderbufferStorageOES,
+	(void*)glGetRenderbufferParameterivOES,
+	(void*)glIsFramebufferOES,
+	(void*)glBindFramebufferOES,
+	(void*)glDeleteFramebuffersOES,
+	(void*)glGenFramebuffersOES,
+	(void*)glCheckFramebufferStatusOES,
+	(void*)glFramebufferRenderbufferOES,
+	(void*)glFramebufferTexture2DOES,
+	(void*)glGetFramebufferAttachmentParameterivOES,
+	(void*)glGenerateMipmapOES,
+	(void*)glMapBufferOES,
+	(void*)glUnmapBufferOES,
+	(void*)glGetBufferPointervOES,
+	(void*)glCurrentPaletteMatrixOES,
+	(void*)glLoadPaletteFromModelViewMatrixOES,
+	(void*)glMatrixIndexPointerOES,
+	(void*)glWeightPointerOES,
+	(void*)glQueryMatrixxOES,
+	(void*)glDepthRangefOES,
+	(void*)glFrustumfOES,
+	(void*)glOrthofOES,
+	(void*)glClipPlanefOES,
+	(void*)glClipPlanefIMG,
+	(void*)glGetClipPlanefOES,
+	(void*)glClearDepthfOES,
+	(void*)glTexGenfOES,
+	(void*)glTexGenfvOES,
+	(void*)glTexGeniOES,
+	(void*)glTexGenivOES,
+	(void*)glTexGenxOES,
+	(void*)glTexGenxvOES,
+	(void*)glGetTexGenfvOES,
+	(void*)glGetTexGenivOES,
+	(void*)glGetTexGenxvOES,
+	(void*)glBindVertexArrayOES,
+	(void*)glDeleteVertexArraysOES,
+	(void*)glGenVertexArraysOES,
+	(void*)glIsVertexArrayOES,
+	(void*)glDiscardFramebufferEXT,
+	(void*)glMultiDrawArraysEXT,
+	(void*)glMultiDrawElementsEXT,
+	(void*)glMultiDrawArraysSUN,
+	(void*)glMultiDrawElementsSUN,
+	(void*)glRenderbufferStorageMultisampleIMG,
+	(void*)glFramebufferTexture2DMultisampleIMG,
+	(void*)glDeleteFencesNV,
+	(void*)glGenFencesNV,
+	(void*)glIsFenceNV,
+	(void*)glTestFenceNV,
+	(void*)glGetFenceivNV,
+	(void*)glFinishFenceNV,
+	(void*)glSetFenceNV,
+	(void*)glGetDriverControlsQCOM,
+	(void*)glGetDriverControlStringQCOM,
+	(void*)glEnableDriverControlQCOM,
+	(void*)glDisableDriverControlQCOM,
+	(void*)glExtGetTexturesQCOM,
+	(void*)glExtGetBuffersQCOM,
+	(void*)glExtGetRenderbuffersQCOM,
+	(void*)glExtGetFramebuffersQCOM,
+	(void*)glExtGetTexLevelParameterivQCOM,
+	(void*)glExtTexObjectStateOverrideiQCOM,
+	(void*)glExtGetTexSubImageQCOM,
+	(void*)glExtGetBufferPointervQCOM,
+	(void*)glExtGetShadersQCOM,
+	(void*)glExtGetProgramsQCOM,
+	(void*)glExtIsProgramBinaryQCOM,
+	(void*)glExtGetProgramBinarySourceQCOM,
+	(void*)glStartTilingQCOM,
+	(void*)glEndTilingQCOM,
+	(void*)glGetGraphicsResetStatusEXT,
+	(void*)glReadnPixelsEXT,
 };
-static const int gl_num_funcs = sizeof(gl_funcs_by_name) / sizeof(struct _gl_funcs_by_name);
+static const int gl_num_funcs = sizeof(gl_funcs_by_proc) / sizeof(gl_funcs_by_proc[0]);
 
 
 #endif
@@ -81,7 +81,7 @@ void glEGLImageTargetTexture2DOES(void * self, GLenum target, GLeglImageOES img)
         ctx->override2DTextureTarget(target);
         ctx->associateEGLImage(target, hostImage, image->width, image->height);
         rcEnc->rcBindTexture(rcEnc,
-                grallocHelper->getHostHandle(native_buffer->handle));
+                image->host_color_buffer);
         ctx->restore2DTextureTarget(target);
     }
     else if (image->target == EGL_GL_TEXTURE_2D_KHR) {
@@ -118,7 +118,7 @@ void glEGLImageTargetRenderbufferStorageOES(void *self, GLenum target, GLeglImag
         GET_CONTEXT;
         ctx->associateEGLImage(target, hostImage, image->width, image->height);
         rcEnc->rcBindRenderbuffer(rcEnc,
-                grallocHelper->getHostHandle(native_buffer->handle));
+                image->host_color_buffer);
     } else {
         //TODO
     }
@@ -129,10 +129,12 @@ void glEGLImageTargetRenderbufferStorageOES(void *self, GLenum target, GLeglImag
 void * getProcAddress(const char * procname)
 {
     // search in GL function table
+    const char* name = gl2_funcs_names;
     for (int i=0; i<gl2_num_funcs; i++) {
-        if (!strcmp(gl2_funcs_by_name[i].name, procname)) {
-            return gl2_funcs_by_name[i].proc;
+        if (!strcmp(name, procname)) {
+            return gl2_funcs_by_proc[i];
         }
+        name += strlen(name) + 1;
     }
     return NULL;
 }
@@ -16,8 +16,11 @@
 
 #include "GL2Encoder.h"
 #include "GLESv2Validation.h"
+#include "gl2_opcodes.h"
 #include "GLESTextureUtils.h"
+#include "aemu/base/containers/SmallVector.h"
 
+#include <algorithm>
 #include <string>
 #include <map>
 
@@ -31,6 +34,10 @@
 #include <GLES3/gl3.h>
 #include <GLES3/gl31.h>
 
+#include "GL2EncoderUtils.h"
+
+using android::base::SmallFixedVector;
+
 #ifndef MIN
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif
@@ -60,6 +67,15 @@ static GLubyte *gExtensionsString= (GLubyte *) "GL_OES_EGL_image_external ";
         return ret; \
     } \
 
+// For enum checks that the host repeats and that nothing on the guest
+// relies on. They are left to the host when it reports errors and host
+// validation is on.
+#define HOST_VALIDATED_ERROR_IF(condition, err) \
+    if (!ctx->m_hostValidation) SET_ERROR_IF(condition, err)
+
+#define HOST_VALIDATED_RET_AND_SET_ERROR_IF(condition, err, ret) \
+    if (!ctx->m_hostValidation) RET_AND_SET_ERROR_IF(condition, err, ret)
+
 #define RET_AND_SET_ERROR_WITH_MESSAGE_IF(condition, err, ret, generator, genargs) if((condition)) { \
         std::string msg = generator genargs; \
         ALOGE("%s:%s:%d GL error 0x%x\n" \
@@ -75,8 +91,16 @@ GL2Encoder::GL2Encoder(IOStream *stream, ChecksumCalculator *protocol)
     m_currMinorVersion = 0;
     m_hasAsyncUnmapBuffer = false;
     m_hasSyncBufferData = false;
+    m_hasProgramReflection = false;
+    m_hasDrawLists = false;
+    m_deferProgramLinks = false;
     m_initialized = false;
     m_noHostError = false;
+    m_hostValidation = false;
+    m_deferredHostError = false;
+    m_hostErrorReadAt = 0;
+    m_deferredHostErrorPolls = 0;
+    m_hostErrorDue = false;
     m_state = NULL;
     m_error = GL_NO_ERROR;
 
@@ -107,10 +131,18 @@ GL2Encoder::GL2Encoder(IOStream *stream, ChecksumCalculator *protocol)
     m_ssbo_offset_align = 0;
     m_ubo_offset_align = 0;
 
-    m_drawCallFlushInterval = 800;
-    m_drawCallFlushCount = 0;
+    m_flushPolicy = FlushPolicy::create(FlushPolicy::Kind::FixedInterval, 800);
+    m_lastReadbackCount = 0;
     m_primitiveRestartEnabled = false;
     m_primitiveRestartIndex = 0;
+    m_streamClientArrays = false;
+    m_clientArrayRingMapped = false;
+    m_stagePixelUploads = false;
+    m_pixelUnpackRingMapped = false;
+    m_pixelUnpackRingHead = 0;
+    m_textureContentThreshold = 0;
+    m_asyncReadPixels = false;
+    m_lazyBufferShadows = false;
 
     // overrides
 #define OVERRIDE(name)  m_##name##_enc = this-> name ; this-> name = &s_##name
@@ -238,6 +270,8 @@ GL2Encoder::GL2Encoder(IOStream *stream, ChecksumCalculator *protocol)
     OVERRIDE_CUSTOM(glMapBufferRange);
     OVERRIDE_CUSTOM(glUnmapBuffer);
     OVERRIDE_CUSTOM(glFlushMappedBufferRange);
+    OVERRIDE_CUSTOM(glBufferStorageEXT);
+    OVERRIDE_CUSTOM(glMaxShaderCompilerThreadsKHR);
 
     OVERRIDE(glCompressedTexImage2D);
     OVERRIDE(glCompressedTexSubImage2D);
@@ -398,6 +432,7 @@ GL2Encoder::GL2Encoder(IOStream *stream, ChecksumCalculator *protocol)
 
     OVERRIDE(glDispatchCompute);
     OVERRIDE(glDispatchComputeIndirect);
+    OVERRIDE(glMemoryBarrier);
 
     OVERRIDE(glGenTransformFeedbacks);
     OVERRIDE(glDeleteTransformFeedbacks);
@@ -478,6 +513,40 @@ GL2Encoder::GL2Encoder(IOStream *stream, ChecksumCalculator *protocol)
 GL2Encoder::~GL2Encoder()
 {
     delete m_compressedTextureFormats;
+
+    for (const auto& it : m_hostIntegerQueries) {
+        ALOGV("%s: glGetIntegerv(0x%x) went to the host %u times\n",
+              __func__, it.first, it.second);
+    }
+}
+
+namespace {
+
+// glGetError calls a deferred query answers from the guest before it asks
+// the host again.
+constexpr uint32_t kDeferredHostErrorPolls = 32;
+
+}  // namespace
+
+uint64_t GL2Encoder::encodedBytes() const {
+    return m_stream->committedBytes() + m_stream->pendingBytes();
+}
+
+GLenum GL2Encoder::readHostError() {
+    const GLenum err = m_glGetError_enc(this);
+    m_hostErrorReadAt = encodedBytes();
+    m_deferredHostErrorPolls = 0;
+    m_hostErrorDue = false;
+    return err;
+}
+
+// Whether a deferred glGetError should ask the host. Reading the flag
+// clears it, so with nothing encoded since, the host has nothing to say.
+bool GL2Encoder::hostErrorDue() {
+    if (encodedBytes() == m_hostErrorReadAt) {
+        return false;
+    }
+    return m_hostErrorDue || ++m_deferredHostErrorPolls >= kDeferredHostErrorPolls;
 }
 
 GLenum GL2Encoder::s_glGetError(void * self)
@@ -485,8 +554,8 @@ GLenum GL2Encoder::s_glGetError(void * self)
     GL2Encoder *ctx = (GL2Encoder *)self;
     GLenum err = ctx->getError();
     if(err != GL_NO_ERROR) {
-        if (!ctx->m_noHostError) {
-            ctx->m_glGetError_enc(ctx); // also clear host error
+        if (!ctx->m_noHostError && !ctx->m_deferredHostError) {
+            ctx->readHostError(); // also clear host error
         }
         ctx->setError(GL_NO_ERROR);
         return err;
@@ -494,8 +563,10 @@ GLenum GL2Encoder::s_glGetError(void * self)
 
     if (ctx->m_noHostError) {
         return GL_NO_ERROR;
+    } else if (ctx->m_deferredHostError && !ctx->hostErrorDue()) {
+        return GL_NO_ERROR;
     } else {
-        return ctx->m_glGetError_enc(self);
+        return ctx->readHostError();
     }
 }
 
@@ -504,7 +575,7 @@ public:
     ErrorUpdater(GL2Encoder* ctx) :
         mCtx(ctx),
         guest_error(ctx->getError()),
-        host_error(ctx->m_glGetError_enc(ctx)) {
+        host_error(ctx->readHostError()) {
             if (ctx->m_noHostError) {
                 host_error = GL_NO_ERROR;
             }
@@ -524,7 +595,7 @@ public:
         }
 
     GLenum getHostErrorAndUpdate() {
-        host_error = mCtx->m_glGetError_enc(mCtx);
+        host_error = mCtx->readHostError();
         if (guest_error == GL_NO_ERROR) {
             guest_error = host_error;
         }
@@ -605,6 +676,8 @@ void GL2Encoder::safe_glGetBooleani_v(GLenum param, GLuint index, GLboolean* val
 void GL2Encoder::s_glFlush(void *self)
 {
     GL2Encoder *ctx = (GL2Encoder *) self;
+    ctx->resolvePendingProgramLinks();
+    ctx->flushPersistentMappings();
     ctx->m_glFlush_enc(self);
     ctx->m_stream->flush();
 }
@@ -681,13 +754,16 @@ void GL2Encoder::s_glBufferData(void * self, GLenum target, GLsizeiptr size, con
     SET_ERROR_IF(bufferId==0, GL_INVALID_OPERATION);
     SET_ERROR_IF(size<0, GL_INVALID_VALUE);
     SET_ERROR_IF(!GLESv2Validation::bufferUsage(ctx, usage), GL_INVALID_ENUM);
+    BufferData* buf = ctx->m_shared->getBufferData(bufferId);
+    SET_ERROR_IF(buf && buf->m_immutable, GL_INVALID_OPERATION);
 
-    ctx->m_shared->updateBufferData(bufferId, size, data);
+    ctx->m_shared->updateBufferData(bufferId, size, data,
+                                    ctx->shouldShadowBuffer(target, buf));
     ctx->m_shared->setBufferUsage(bufferId, usage);
     if (ctx->m_hasSyncBufferData) {
         ctx->glBufferDataSyncAEMU(self, target, size, data, usage);
     } else {
-        ctx->m_glBufferData_enc(self, target, size, data, usage);
+        ctx->encodeBufferData(target, size, data, usage);
     }
 }
 
@@ -698,11 +774,15 @@ void GL2Encoder::s_glBufferSubData(void * self, GLenum target, GLintptr offset,
     GLuint bufferId = ctx->m_state->getBuffer(target);
     SET_ERROR_IF(bufferId==0, GL_INVALID_OPERATION);
     SET_ERROR_IF(ctx->isBufferTargetMapped(target), GL_INVALID_OPERATION);
+    BufferData* buf = ctx->m_shared->getBufferData(bufferId);
+    SET_ERROR_IF(buf && buf->m_immutable &&
+                 !(buf->m_storageFlags & GL_DYNAMIC_STORAGE_BIT_EXT), GL_INVALID_OPERATION);
 
     GLenum res = ctx->m_shared->subUpdateBufferData(bufferId, offset, size, data);
     SET_ERROR_IF(res, res);
 
-    ctx->m_glBufferSubData_enc(self, target, offset, size, data);
+    ctx->encodeBufferSubData(target, offset, size, data);
+    ctx->forgetBufferReadback(bufferId, ctx->m_shared->getBufferData(bufferId));
 }
 
 void GL2Encoder::s_glGenBuffers(void* self, GLsizei n, GLuint* buffers) {
@@ -1004,8 +1084,9 @@ void GL2Encoder::s_glGetIntegerv(void *self, GLenum param, GLint *ptr)
         break;
     default:
         if (!state) return;
-        if (!state->getClientStateParameter<GLint>(param, ptr)) {
-            ctx->safe_glGetIntegerv(param, ptr);
+        if (!state->getClientStateParameter<GLint>(param, ptr) &&
+            !ctx->getGuestIntegerv(param, ptr)) {
+            ctx->hostGetIntegerv(param, ptr);
         }
         break;
     }
@@ -1066,13 +1147,20 @@ void GL2Encoder::s_glGetFloatv(void *self, GLenum param, GLfloat *ptr)
         break;
     }
 
-    default:
+    default: {
         if (!state) return;
-        if (!state->getClientStateParameter<GLfloat>(param, ptr)) {
+        if (state->getClientStateParameter<GLfloat>(param, ptr)) break;
+        GLint res[2];
+        if (ctx->getGuestIntegerv(param, res)) {
+            for (size_t i = 0; i < glUtilsParamSize(param); i++) {
+                ptr[i] = (GLfloat)res[i];
+            }
+        } else {
             ctx->safe_glGetFloatv(param, ptr);
         }
         break;
     }
+    }
 }
 
 
@@ -1133,11 +1221,15 @@ void GL2Encoder::s_glGetBooleanv(void *self, GLenum param, GLboolean *ptr)
     default:
         if (!state) return;
         {
-            GLint intVal;
-            if (!state->getClientStateParameter<GLint>(param, &intVal)) {
-                ctx->safe_glGetBooleanv(param, ptr);
+            GLint intVal[2];
+            if (state->getClientStateParameter<GLint>(param, intVal)) {
+                *ptr = (intVal[0] != 0) ? GL_TRUE : GL_FALSE;
+            } else if (ctx->getGuestIntegerv(param, intVal)) {
+                for (size_t i = 0; i < glUtilsParamSize(param); i++) {
+                    ptr[i] = (intVal[i] != 0) ? GL_TRUE : GL_FALSE;
+                }
             } else {
-                *ptr = (intVal != 0) ? GL_TRUE : GL_FALSE;
+                ctx->safe_glGetBooleanv(param, ptr);
             }
         }
         break;
@@ -1229,50 +1321,88 @@ void GL2Encoder::calcIndexRange(const void* indices,
     }
 }
 
-void* GL2Encoder::recenterIndices(const void* src,
-                                  GLenum type,
-                                  GLsizei count,
-                                  int minIndex) {
-
-    void* adjustedIndices = (void*)src;
+void GL2Encoder::writeRecenteredIndices(unsigned char* dst,
+                                        const void* src,
+                                        GLenum type,
+                                        GLsizei count,
+                                        int minIndex) {
+    if (minIndex == 0) {
+        memcpy(dst, src, glSizeof(type) * count);
+        return;
+    }
 
-    if (minIndex != 0) {
-        m_fixedBuffer.resize(glSizeof(type) * count);
-        adjustedIndices = m_fixedBuffer.data();
-        switch(type) {
-        case GL_BYTE:
-        case GL_UNSIGNED_BYTE:
-            GLUtils::shiftIndicesExcept(
-                    (unsigned char *)src,
-                    (unsigned char *)adjustedIndices,
-                    count, -minIndex,
-                    m_primitiveRestartEnabled,
-                    (unsigned char)m_primitiveRestartIndex);
-            break;
-        case GL_SHORT:
-        case GL_UNSIGNED_SHORT:
-            GLUtils::shiftIndicesExcept(
-                    (unsigned short *)src,
-                    (unsigned short *)adjustedIndices,
-                    count, -minIndex,
-                    m_primitiveRestartEnabled,
-                    (unsigned short)m_primitiveRestartIndex);
-            break;
-        case GL_INT:
-        case GL_UNSIGNED_INT:
-            GLUtils::shiftIndicesExcept(
-                    (unsigned int *)src,
-                    (unsigned int *)adjustedIndices,
-                    count, -minIndex,
-                    m_primitiveRestartEnabled,
-                    (unsigned int)m_primitiveRestartIndex);
-            break;
-        default:
-            ALOGE("unsupported index buffer type %d\n", type);
-        }
+    switch(type) {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        GLUtils::shiftIndicesExcept(
+                (const unsigned char *)src,
+                (unsigned char *)dst,
+                count, -minIndex,
+                m_primitiveRestartEnabled,
+                (unsigned char)m_primitiveRestartIndex);
+        break;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+        GLUtils::shiftIndicesExcept(
+                (const unsigned short *)src,
+                (unsigned short *)dst,
+                count, -minIndex,
+                m_primitiveRestartEnabled,
+                (unsigned short)m_primitiveRestartIndex);
+        break;
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+        GLUtils::shiftIndicesExcept(
+                (const unsigned int *)src,
+                (unsigned int *)dst,
+                count, -minIndex,
+                m_primitiveRestartEnabled,
+                (unsigned int)m_primitiveRestartIndex);
+        break;
+    default:
+        ALOGE("unsupported index buffer type %d\n", type);
     }
+}
 
-    return adjustedIndices;
+// Hand-encoded equivalent of the generated glDrawElementsData,
+// glDrawElementsDataNullAEMU and glDrawElementsInstancedDataAEMU
+// encoders (the latter when |primcount| is non-null). The indices are
+// recentered while being copied into the stream buffer, so client index
+// arrays are read once after calcIndexRange instead of being staged in a
+// scratch vector and copied a second time by the generated encoder.
+void GL2Encoder::encodeDrawElementsData(uint32_t opcode,
+                                        GLenum mode,
+                                        GLsizei count,
+                                        GLenum type,
+                                        const void* indices,
+                                        int minIndex,
+                                        const GLsizei* primcount) {
+    const bool useChecksum = m_checksumCalculator->getVersion() > 0;
+
+    const uint32_t datalen = count * glSizeof(type);
+    const size_t sizeWithoutChecksum =
+        8 + 4 + 4 + 4 + 4 + datalen + (primcount ? 4 : 0) + 4;
+    const size_t checksumSize = m_checksumCalculator->checksumByteSize();
+    const uint32_t totalSize = sizeWithoutChecksum + checksumSize;
+
+    unsigned char* buf = m_stream->alloc(totalSize);
+    unsigned char* ptr = buf;
+    memcpy(ptr, &opcode, 4); ptr += 4;
+    memcpy(ptr, &totalSize, 4); ptr += 4;
+    memcpy(ptr, &mode, 4); ptr += 4;
+    memcpy(ptr, &count, 4); ptr += 4;
+    memcpy(ptr, &type, 4); ptr += 4;
+    memcpy(ptr, &datalen, 4); ptr += 4;
+    writeRecenteredIndices(ptr, indices, type, count, minIndex); ptr += datalen;
+    if (primcount) {
+        memcpy(ptr, primcount, 4); ptr += 4;
+    }
+    memcpy(ptr, &datalen, 4); ptr += 4;
+
+    if (useChecksum) {
+        m_checksumCalculator->addBuffer(buf, ptr - buf);
+        m_checksumCalculator->writeChecksum(ptr, checksumSize);
+    }
 }
 
 void GL2Encoder::getBufferIndexRange(BufferData* buf,
@@ -1291,7 +1421,15 @@ void GL2Encoder::getBufferIndexRange(BufferData* buf,
         return;
     }
 
-    calcIndexRange(dataWithOffset, type, count, minIndex_out, maxIndex_out);
+    // A new (offset, count) pair on a large range can usually be answered
+    // from per-chunk summaries without rescanning the whole range.
+    if (!buf->m_indexBlockSummary.findRange(
+                buf->m_fixedBuffer.data(), buf->m_fixedBuffer.size(),
+                type, offset, count,
+                m_primitiveRestartEnabled,
+                minIndex_out, maxIndex_out)) {
+        calcIndexRange(dataWithOffset, type, count, minIndex_out, maxIndex_out);
+    }
 
     buf->m_indexRangeCache.addRange(
             type, offset, count, m_primitiveRestartEnabled,
@@ -1308,6 +1446,259 @@ void GL2Encoder::getVBOUsage(bool* hasClientArrays, bool* hasVBOs) const {
     m_state->getVBOUsage(hasClientArrays, hasVBOs);
 }
 
+static size_t alignClientAttribOffset(size_t offset) {
+    return (offset + 15) & ~size_t(15);
+}
+
+bool GL2Encoder::initClientArrayRing() {
+    if (m_state->clientArrayRingBuffer()) return true;
+    if (!hasExtension("ANDROID_EMU_dma_v2")) return false;
+
+    if (!m_clientArrayRingMapped) {
+        goldfish_dma_context region;
+        if (goldfish_dma_create_region(kClientArrayRingSize, &region)) {
+            ALOGE("%s: could not create client array ring, using the command stream", __func__);
+            m_streamClientArrays = false;
+            return false;
+        }
+        if (!goldfish_dma_map(&region)) {
+            ALOGE("%s: could not map client array ring, using the command stream", __func__);
+            goldfish_dma_free(&region);
+            m_streamClientArrays = false;
+            return false;
+        }
+        m_clientArrayRingDma.reset(&region);
+        m_clientArrayRingMapped = true;
+    }
+
+    // The ring is never bound by the app, so it only exists on the host
+    // side and in the last encoded GL_ARRAY_BUFFER binding.
+    GLuint buffer = 0;
+    m_glGenBuffers_enc(this, 1, &buffer);
+    doBindBufferEncodeCached(GL_ARRAY_BUFFER, buffer);
+    encodeBufferData(GL_ARRAY_BUFFER, kClientArrayRingSize, NULL, GL_STREAM_DRAW);
+    m_state->setClientArrayRingBuffer(buffer);
+    m_state->setClientArrayRingHead(0);
+    return true;
+}
+
+// Sub-allocates the pending client array attributes in the ring and
+// writes them through its DMA mapping, then points the attributes at the
+// ring with glVertexAttrib*PointerOffset. glUnmapBufferDMA returns after
+// the host has copied the range, so the guest side of a slot is free as
+// soon as it returns; consecutive draws still land in distinct ranges so
+// the host driver does not have to wait on a draw that is in flight.
+bool GL2Encoder::streamClientAttribData(GLuint* lastBoundVbo) {
+    if (!initClientArrayRing()) return false;
+
+    size_t batchSize = 0;
+    for (const auto& attrib : m_pendingClientAttribs) {
+        batchSize = alignClientAttribOffset(batchSize) + attrib.datalen;
+    }
+    if (batchSize > kClientArrayRingSize) return false;
+
+    size_t base = m_state->clientArrayRingHead();
+    if (base + batchSize > kClientArrayRingSize) {
+        base = 0;
+    }
+    m_state->setClientArrayRingHead(alignClientAttribOffset(base + batchSize));
+
+    const goldfish_dma_context& dma = m_clientArrayRingDma.get();
+    unsigned char* mapped = reinterpret_cast<unsigned char*>(dma.mapped_addr);
+    const uint64_t paddr = goldfish_dma_guest_paddr(&dma) + base;
+
+    const GLuint ringBuffer = m_state->clientArrayRingBuffer();
+    doBindBufferEncodeCached(GL_ARRAY_BUFFER, ringBuffer);
+    *lastBoundVbo = ringBuffer;
+
+    const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+    glMapBufferRangeDMA(this, GL_ARRAY_BUFFER, base, batchSize, access, paddr);
+
+    size_t offset = 0;
+    for (const auto& attrib : m_pendingClientAttribs) {
+        offset = alignClientAttribOffset(offset);
+        glUtilsPackPointerData(mapped + base + offset, attrib.data,
+                               attrib.size, attrib.type, attrib.stride,
+                               attrib.datalen);
+        offset += attrib.datalen;
+    }
+
+    GLboolean host_res = GL_TRUE;
+    glUnmapBufferDMA(this, GL_ARRAY_BUFFER, base, batchSize, access, paddr, &host_res);
+
+    // Data in the ring is tightly packed, so the attributes use stride 0.
+    offset = 0;
+    for (const auto& attrib : m_pendingClientAttribs) {
+        offset = alignClientAttribOffset(offset);
+        const GLuint ringOffset = base + offset;
+        offset += attrib.datalen;
+        if (attrib.isInt) {
+            glVertexAttribIPointerOffsetAEMU(this, attrib.index, attrib.size,
+                                             attrib.type, 0, ringOffset);
+        } else {
+            glVertexAttribPointerOffset(this, attrib.index, attrib.size,
+                                        attrib.type, attrib.normalized, 0,
+                                        ringOffset);
+        }
+    }
+
+    m_pendingClientAttribs.clear();
+    return true;
+}
+
+// Copies a client-memory texture upload of |size| bytes, laid out
+// exactly as the command stream would carry it, into the unpack ring and
+// leaves the context's staging buffer bound to GL_PIXEL_UNPACK_BUFFER on
+// the host with the data at |*offset|. The host applies the same unpack
+// state to the buffer as it would to inline data. glUnmapBufferDMA only
+// returns once the host has copied the range, so the app is free to reuse
+// |pixels| afterwards as GLES requires, and the ring slot is free too.
+// Returns false if the upload should go through the command stream.
+bool GL2Encoder::stagePixelUpload(const void* pixels, size_t size, GLuint* offset) {
+    if (!m_stagePixelUploads || !pixels) return false;
+    if (size < kMinStagedPixelUploadSize || size > kPixelUnpackRingSize) return false;
+    // Unpack buffers need a GLES 3 host context.
+    if (m_currMajorVersion < 3) return false;
+    if (!hasExtension("ANDROID_EMU_dma_v2")) return false;
+
+    if (!m_pixelUnpackRingMapped) {
+        goldfish_dma_context region;
+        if (goldfish_dma_create_region(kPixelUnpackRingSize, &region)) {
+            ALOGE("%s: could not set up the unpack ring, using the command stream", __func__);
+            m_stagePixelUploads = false;
+            return false;
+        }
+        if (!goldfish_dma_map(&region)) {
+            ALOGE("%s: could not map the unpack ring, using the command stream", __func__);
+            goldfish_dma_free(&region);
+            m_stagePixelUploads = false;
+            return false;
+        }
+        m_pixelUnpackRingDma.reset(&region);
+        m_pixelUnpackRingMapped = true;
+    }
+
+    GLuint buffer = m_state->pixelUnpackStagingBuffer();
+    if (!buffer) {
+        m_glGenBuffers_enc(this, 1, &buffer);
+        m_glBindBuffer_enc(this, GL_PIXEL_UNPACK_BUFFER, buffer);
+        encodeBufferData(GL_PIXEL_UNPACK_BUFFER, kPixelUnpackRingSize, NULL, GL_STREAM_DRAW);
+        m_state->setPixelUnpackStagingBuffer(buffer);
+    } else {
+        m_glBindBuffer_enc(this, GL_PIXEL_UNPACK_BUFFER, buffer);
+    }
+
+    // Advance through the ring so that consecutive uploads do not make
+    // the host driver wait for the previous one to finish reading.
+    if (m_pixelUnpackRingHead + size > kPixelUnpackRingSize) {
+        m_pixelUnpackRingHead = 0;
+    }
+    const size_t base = m_pixelUnpackRingHead;
+    m_pixelUnpackRingHead = alignClientAttribOffset(base + size);
+
+    const goldfish_dma_context& dma = m_pixelUnpackRingDma.get();
+    const uint64_t paddr = goldfish_dma_guest_paddr(&dma) + base;
+    const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+
+    glMapBufferRangeDMA(this, GL_PIXEL_UNPACK_BUFFER, base, size, access, paddr);
+    memcpy(reinterpret_cast<unsigned char*>(dma.mapped_addr) + base, pixels, size);
+    GLboolean host_res = GL_TRUE;
+    glUnmapBufferDMA(this, GL_PIXEL_UNPACK_BUFFER, base, size, access, paddr, &host_res);
+
+    *offset = base;
+    return true;
+}
+
+// Restores the app's GL_PIXEL_UNPACK_BUFFER binding, which is always 0
+// when an upload was staged.
+void GL2Encoder::endStagedPixelUpload() {
+    m_glBindBuffer_enc(this, GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+// Returns the host content to upload the |size| bytes at |pixels| from, or
+// 0 if they should be sent as usual. The first repeat of a payload stores
+// it on the host, so it is sent once either way; later repeats only send
+// the reference. The host applies the current unpack state to a content
+// as it would to inline data.
+GLuint GL2Encoder::textureContentFor(const void* pixels, size_t size) {
+    if (!m_textureContentThreshold || !pixels || size < m_textureContentThreshold) return 0;
+
+    if (!m_textureContentCache) {
+        m_textureContentCache.reset(new TextureContentCache(kTextureContentBudget));
+    }
+
+    GLuint content = 0;
+    std::vector<GLuint> released;
+    const TextureContentCache::Action action = m_textureContentCache->lookup(
+            TextureContentCache::makeKey(pixels, size), &content, &released);
+    for (GLuint old : released) {
+        glReleaseTextureContentAEMU(this, old);
+    }
+
+    switch (action) {
+    case TextureContentCache::Action::Store:
+        encodeStoreTextureContent(content, (GLsizei)size, pixels);
+        return content;
+    case TextureContentCache::Action::Reuse:
+        return content;
+    case TextureContentCache::Action::Upload:
+        break;
+    }
+    return 0;
+}
+
+// Encodes the pending client array attributes as back-to-back
+// glVertexAttribPointerData / glVertexAttribIPointerDataAEMU commands in
+// one stream allocation. Each attribute is packed straight from the
+// client pointer into the stream buffer, so tightly packed arrays cost a
+// single memcpy and there is one alloc per draw rather than per attribute.
+void GL2Encoder::encodeClientAttribData(GLuint* lastBoundVbo) {
+    if (m_pendingClientAttribs.empty()) return;
+
+    if (m_streamClientArrays && streamClientAttribData(lastBoundVbo)) return;
+
+    const bool useChecksum = m_checksumCalculator->getVersion() > 0;
+    const size_t checksumSize = m_checksumCalculator->checksumByteSize();
+
+    size_t batchSize = 0;
+    for (const auto& attrib : m_pendingClientAttribs) {
+        const size_t argsSize = attrib.isInt ? (4 + 4 + 4 + 4) : (4 + 4 + 4 + 1 + 4);
+        batchSize += 8 + argsSize + 4 + attrib.datalen + 4 + checksumSize;
+    }
+
+    unsigned char* ptr = m_stream->alloc(batchSize);
+    for (const auto& attrib : m_pendingClientAttribs) {
+        unsigned char* buf = ptr;
+        const size_t argsSize = attrib.isInt ? (4 + 4 + 4 + 4) : (4 + 4 + 4 + 1 + 4);
+        const uint32_t totalSize = 8 + argsSize + 4 + attrib.datalen + 4 + checksumSize;
+        const uint32_t opcode = attrib.isInt ? OP_glVertexAttribIPointerDataAEMU
+                                             : OP_glVertexAttribPointerData;
+
+        memcpy(ptr, &opcode, 4); ptr += 4;
+        memcpy(ptr, &totalSize, 4); ptr += 4;
+        memcpy(ptr, &attrib.index, 4); ptr += 4;
+        memcpy(ptr, &attrib.size, 4); ptr += 4;
+        memcpy(ptr, &attrib.type, 4); ptr += 4;
+        if (!attrib.isInt) {
+            memcpy(ptr, &attrib.normalized, 1); ptr += 1;
+        }
+        memcpy(ptr, &attrib.stride, 4); ptr += 4;
+        memcpy(ptr, &attrib.datalen, 4); ptr += 4;
+        glUtilsPackPointerData(ptr, attrib.data, attrib.size, attrib.type,
+                               attrib.stride, attrib.datalen);
+        ptr += attrib.datalen;
+        memcpy(ptr, &attrib.datalen, 4); ptr += 4;
+
+        if (useChecksum) {
+            m_checksumCalculator->addBuffer(buf, ptr - buf);
+            m_checksumCalculator->writeChecksum(ptr, checksumSize);
+        }
+        ptr += checksumSize;
+    }
+
+    m_pendingClientAttribs.clear();
+}
+
 void GL2Encoder::sendVertexAttributes(GLint first, GLsizei count, bool hasClientArrays, GLsizei primcount)
 {
     assert(m_state);
@@ -1326,8 +1717,12 @@ void GL2Encoder::sendVertexAttributes(GLint first, GLsizei count, bool hasClient
             const GLClientState::BufferBinding& curr_binding = m_state->getCurrAttributeBindingInfo(i);
             GLuint bufferObject = curr_binding.buffer;
             if (hasClientArrays && lastBoundVbo != bufferObject) {
-                doBindBufferEncodeCached(GL_ARRAY_BUFFER, bufferObject);
-                lastBoundVbo = bufferObject;
+                // Client array data is bound against buffer 0 on the host.
+                encodeClientAttribData(&lastBoundVbo);
+                if (lastBoundVbo != bufferObject) {
+                    doBindBufferEncodeCached(GL_ARRAY_BUFFER, bufferObject);
+                    lastBoundVbo = bufferObject;
+                }
             }
 
             int divisor = curr_binding.divisor;
@@ -1368,11 +1763,10 @@ void GL2Encoder::sendVertexAttributes(GLint first, GLsizei count, bool hasClient
                     continue;
                 }
 
-                if (state.isInt) {
-                    this->glVertexAttribIPointerDataAEMU(this, i, state.size, state.type, stride, data, datalen);
-                } else {
-                    this->glVertexAttribPointerData(this, i, state.size, state.type, state.normalized, stride, data, datalen);
-                }
+                m_pendingClientAttribs.push_back({
+                    (GLuint)i, state.size, state.type, state.normalized,
+                    stride, data, datalen, state.isInt,
+                });
             } else {
                 const BufferData* buf = m_shared->getBufferData(bufferObject);
                 // The following expression actually means bufLen = stride*count;
@@ -1413,16 +1807,320 @@ void GL2Encoder::sendVertexAttributes(GLint first, GLsizei count, bool hasClient
         }
     }
 
+    encodeClientAttribData(&lastBoundVbo);
+
     if (hasClientArrays && lastBoundVbo != m_state->currentArrayVbo()) {
         doBindBufferEncodeCached(GL_ARRAY_BUFFER, m_state->currentArrayVbo());
     }
 }
 
 void GL2Encoder::flushDrawCall() {
-    if (m_drawCallFlushCount % m_drawCallFlushInterval == 0) {
+    // The fixed interval policy only counts draws; leave the clock alone.
+    const bool timed = m_flushPolicy->usesTiming();
+    if (timed && m_stream->readbackCount() != m_lastReadbackCount) {
+        m_lastReadbackCount = m_stream->readbackCount();
+        m_flushPolicy->onHostRoundTrip(m_stream->lastReadbackNs());
+    }
+
+    const FlushPolicy::Sample sample = {
+        m_stream->pendingBytes(),
+        timed ? FlushPolicy::nowNs() : 0,
+    };
+    if (m_flushPolicy->shouldFlushAfterDraw(sample)) {
         m_stream->flush();
+        m_flushPolicy->onFlushed(sample.nowNs);
     }
-    m_drawCallFlushCount++;
+}
+
+void GL2Encoder::onFrameBoundary() {
+    m_flushPolicy->onFrameBoundary(m_flushPolicy->usesTiming() ? FlushPolicy::nowNs() : 0);
+    m_hostErrorDue = true;
+}
+
+namespace {
+
+// Sizes of glDrawArrays and glDrawElementsOffset without checksums, and the
+// headers of glDrawArraysListAEMU and glDrawElementsListAEMU up to their
+// draws. Draws cover 8 bytes either way.
+constexpr size_t kDrawArraysSize = 8 + 4 + 4 + 4;
+constexpr size_t kDrawElementsOffsetSize = 8 + 4 + 4 + 4 + 4;
+constexpr size_t kDrawArraysListHeaderSize = 8 + 4 + 4 + 4;
+constexpr size_t kDrawElementsListHeaderSize = 8 + 4 + 4 + 4 + 4;
+constexpr size_t kDrawListEntrySize = 2 * sizeof(GLuint);
+
+}  // namespace
+
+void GL2Encoder::encodeBufferDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    if (appendToDrawList(false, mode, 0, (GLuint)first, (GLuint)count)) {
+        return;
+    }
+    m_glDrawArrays_enc(this, mode, first, count);
+    startDrawList(false, mode, 0, (GLuint)first, (GLuint)count, kDrawArraysSize);
+}
+
+void GL2Encoder::encodeBufferDrawElements(GLenum mode, GLsizei count, GLenum type, GLuint offset) {
+    if (appendToDrawList(true, mode, type, (GLuint)count, offset)) {
+        return;
+    }
+    glDrawElementsOffset(this, mode, count, type, offset);
+    startDrawList(true, mode, type, (GLuint)count, offset, kDrawElementsOffsetSize);
+}
+
+void GL2Encoder::startDrawList(bool elements, GLenum mode, GLenum type, GLuint a, GLuint b,
+                               size_t size) {
+    // Checksums cover whole commands and can not be rewritten.
+    if (!m_hasDrawLists || m_checksumCalculator->getVersion() > 0 ||
+        m_stream->pendingBytes() < size) {
+        m_drawList.packet = nullptr;
+        return;
+    }
+    m_drawList.end = m_stream->pendingEnd();
+    m_drawList.packet = m_drawList.end - size;
+    m_drawList.flushCount = m_stream->flushCount();
+    m_drawList.elements = elements;
+    m_drawList.mode = mode;
+    m_drawList.type = type;
+    m_drawList.draws = 1;
+    m_drawList.firstDraw[0] = a;
+    m_drawList.firstDraw[1] = b;
+}
+
+bool GL2Encoder::appendToDrawList(bool elements, GLenum mode, GLenum type, GLuint a, GLuint b) {
+    DrawList& list = m_drawList;
+    if (!list.packet || list.elements != elements || list.mode != mode ||
+        list.type != type || list.draws >= kMaxDrawsPerList) {
+        return false;
+    }
+    // Anything encoded since, state changes included, ends the run.
+    if (m_stream->flushCount() != list.flushCount || m_stream->pendingEnd() != list.end) {
+        return false;
+    }
+
+    const size_t headerSize = elements ? kDrawElementsListHeaderSize : kDrawArraysListHeaderSize;
+    const size_t plainSize = elements ? kDrawElementsOffsetSize : kDrawArraysSize;
+    const size_t growth = list.draws == 1 ?
+        headerSize + 2 * kDrawListEntrySize - plainSize : kDrawListEntrySize;
+    if (m_stream->availableBytes() < growth) {
+        return false;
+    }
+    unsigned char* packet = m_stream->alloc(growth) - (list.end - list.packet);
+
+    if (list.draws == 1) {
+        const int op = elements ? OP_glDrawElementsListAEMU : OP_glDrawArraysListAEMU;
+        memcpy(packet, &op, 4);
+        memcpy(packet + 8, &mode, 4);
+        if (elements) {
+            memcpy(packet + 12, &type, 4);
+        }
+        memcpy(packet + headerSize, list.firstDraw, kDrawListEntrySize);
+    }
+    const GLuint draw[2] = { a, b };
+    memcpy(packet + headerSize + list.draws * kDrawListEntrySize, draw, kDrawListEntrySize);
+    ++list.draws;
+
+    const uint32_t drawsSize = list.draws * kDrawListEntrySize;
+    const uint32_t totalSize = headerSize + drawsSize;
+    memcpy(packet + 4, &totalSize, 4);
+    memcpy(packet + headerSize - 8, &list.draws, 4);
+    memcpy(packet + headerSize - 4, &drawsSize, 4);
+
+    list.packet = packet;
+    list.end = m_stream->pendingEnd();
+    return true;
+}
+
+// The generated encoders flush the command header before a large
+// parameter and write the parameter's size and payload on their own. These
+// keep the header and size in the stream buffer and send them with the
+// payload in one vectored write. Checksums are computed by the generated
+// encoders only, so checksummed streams go through them.
+bool GL2Encoder::usesGeneratedLargeParams() const {
+    return m_checksumCalculator->getVersion() > 0;
+}
+
+void GL2Encoder::encodeBufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage) {
+    if (usesGeneratedLargeParams()) {
+        m_glBufferData_enc(this, target, size, data, usage);
+        return;
+    }
+    const uint32_t dataSize = data ? size : 0;
+    m_stream->allocLargeParamHeader(OP_glBufferData, dataSize, 4, target, size);
+    m_stream->writeLargeParam(data, dataSize);
+    memcpy(m_stream->alloc(4), &usage, 4);
+}
+
+void GL2Encoder::encodeBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
+                                     const GLvoid* data) {
+    if (usesGeneratedLargeParams()) {
+        m_glBufferSubData_enc(this, target, offset, size, data);
+        return;
+    }
+    const uint32_t dataSize = data ? size : 0;
+    m_stream->allocLargeParamHeader(OP_glBufferSubData, dataSize, 0, target, offset, size);
+    m_stream->writeLargeParam(data, dataSize);
+}
+
+void GL2Encoder::encodeTexImage2D(GLenum target, GLint level, GLint internalformat,
+                                  GLsizei width, GLsizei height, GLint border,
+                                  GLenum format, GLenum type, const GLvoid* pixels) {
+    if (usesGeneratedLargeParams()) {
+        m_glTexImage2D_enc(this, target, level, internalformat, width, height, border,
+                           format, type, pixels);
+        return;
+    }
+    const uint32_t pixelsSize = pixels ?
+        glesv2_enc::pixelDataSize(this, width, height, format, type, 0) : 0;
+    m_stream->allocLargeParamHeader(OP_glTexImage2D, pixelsSize, 0, target, level,
+                                    internalformat, width, height, border, format, type);
+    // uploadPixels() writes through writevFully(), taking the header along.
+    if (pixels) m_stream->uploadPixels(this, width, height, 1, format, type, pixels);
+}
+
+void GL2Encoder::encodeTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+                                     GLsizei width, GLsizei height,
+                                     GLenum format, GLenum type, const GLvoid* pixels) {
+    if (usesGeneratedLargeParams()) {
+        m_glTexSubImage2D_enc(this, target, level, xoffset, yoffset, width, height,
+                              format, type, pixels);
+        return;
+    }
+    const uint32_t pixelsSize = pixels ?
+        glesv2_enc::pixelDataSize(this, width, height, format, type, 0) : 0;
+    m_stream->allocLargeParamHeader(OP_glTexSubImage2D, pixelsSize, 0, target, level,
+                                    xoffset, yoffset, width, height, format, type);
+    if (pixels) m_stream->uploadPixels(this, width, height, 1, format, type, pixels);
+}
+
+void GL2Encoder::encodeTexImage3D(GLenum target, GLint level, GLint internalFormat,
+                                  GLsizei width, GLsizei height, GLsizei depth, GLint border,
+                                  GLenum format, GLenum type, const GLvoid* data) {
+    if (usesGeneratedLargeParams()) {
+        m_glTexImage3D_enc(this, target, level, internalFormat, width, height, depth, border,
+                           format, type, data);
+        return;
+    }
+    const uint32_t dataSize = data ?
+        glesv2_enc::pixelDataSize3D(this, width, height, depth, format, type, 0) : 0;
+    m_stream->allocLargeParamHeader(OP_glTexImage3D, dataSize, 0, target, level,
+                                    internalFormat, width, height, depth, border, format, type);
+    if (data) m_stream->uploadPixels(this, width, height, depth, format, type, data);
+}
+
+void GL2Encoder::encodeTexSubImage3D(GLenum target, GLint level,
+                                     GLint xoffset, GLint yoffset, GLint zoffset,
+                                     GLsizei width, GLsizei height, GLsizei depth,
+                                     GLenum format, GLenum type, const GLvoid* data) {
+    if (usesGeneratedLargeParams()) {
+        m_glTexSubImage3D_enc(this, target, level, xoffset, yoffset, zoffset,
+                              width, height, depth, format, type, data);
+        return;
+    }
+    const uint32_t dataSize = data ?
+        glesv2_enc::pixelDataSize3D(this, width, height, depth, format, type, 0) : 0;
+    m_stream->allocLargeParamHeader(OP_glTexSubImage3D, dataSize, 0, target, level,
+                                    xoffset, yoffset, zoffset, width, height, depth,
+                                    format, type);
+    if (data) m_stream->uploadPixels(this, width, height, depth, format, type, data);
+}
+
+void GL2Encoder::encodeCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat,
+                                            GLsizei width, GLsizei height, GLint border,
+                                            GLsizei imageSize, const GLvoid* data) {
+    if (usesGeneratedLargeParams()) {
+        m_glCompressedTexImage2D_enc(this, target, level, internalformat, width, height,
+                                     border, imageSize, data);
+        return;
+    }
+    const uint32_t dataSize = data ? imageSize : 0;
+    m_stream->allocLargeParamHeader(OP_glCompressedTexImage2D, dataSize, 0, target, level,
+                                    internalformat, width, height, border, imageSize);
+    m_stream->writeLargeParam(data, dataSize);
+}
+
+void GL2Encoder::encodeCompressedTexSubImage2D(GLenum target, GLint level,
+                                               GLint xoffset, GLint yoffset,
+                                               GLsizei width, GLsizei height, GLenum format,
+                                               GLsizei imageSize, const GLvoid* data) {
+    if (usesGeneratedLargeParams()) {
+        m_glCompressedTexSubImage2D_enc(this, target, level, xoffset, yoffset, width, height,
+                                        format, imageSize, data);
+        return;
+    }
+    const uint32_t dataSize = data ? imageSize : 0;
+    m_stream->allocLargeParamHeader(OP_glCompressedTexSubImage2D, dataSize, 0, target, level,
+                                    xoffset, yoffset, width, height, format, imageSize);
+    m_stream->writeLargeParam(data, dataSize);
+}
+
+void GL2Encoder::encodeCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat,
+                                            GLsizei width, GLsizei height, GLsizei depth,
+                                            GLint border, GLsizei imageSize,
+                                            const GLvoid* data) {
+    if (usesGeneratedLargeParams()) {
+        m_glCompressedTexImage3D_enc(this, target, level, internalformat, width, height, depth,
+                                     border, imageSize, data);
+        return;
+    }
+    const uint32_t dataSize = data ? imageSize : 0;
+    m_stream->allocLargeParamHeader(OP_glCompressedTexImage3D, dataSize, 0, target, level,
+                                    internalformat, width, height, depth, border, imageSize);
+    m_stream->writeLargeParam(data, dataSize);
+}
+
+void GL2Encoder::encodeCompressedTexSubImage3D(GLenum target, GLint level,
+                                               GLint xoffset, GLint yoffset, GLint zoffset,
+                                               GLsizei width, GLsizei height, GLsizei depth,
+                                               GLenum format, GLsizei imageSize,
+                                               const GLvoid* data) {
+    if (usesGeneratedLargeParams()) {
+        m_glCompressedTexSubImage3D_enc(this, target, level, xoffset, yoffset, zoffset,
+                                        width, height, depth, format, imageSize, data);
+        return;
+    }
+    const uint32_t dataSize = data ? imageSize : 0;
+    m_stream->allocLargeParamHeader(OP_glCompressedTexSubImage3D, dataSize, 0, target, level,
+                                    xoffset, yoffset, zoffset, width, height, depth,
+                                    format, imageSize);
+    m_stream->writeLargeParam(data, dataSize);
+}
+
+void GL2Encoder::encodeUnmapBufferAsync(GLenum target, GLintptr offset, GLsizeiptr length,
+                                        GLbitfield access, void* guestBuffer,
+                                        GLboolean* outRes) {
+    if (usesGeneratedLargeParams()) {
+        glUnmapBufferAsyncAEMU(this, target, offset, length, access, guestBuffer, outRes);
+        return;
+    }
+    const uint32_t bufferSize = guestBuffer ? length : 0;
+    const uint32_t outResSize = sizeof(GLboolean);
+    m_stream->allocLargeParamHeader(OP_glUnmapBufferAsyncAEMU, bufferSize, 4 + outResSize,
+                                    target, offset, length, access);
+    m_stream->writeLargeParam(guestBuffer, bufferSize);
+    unsigned char* ptr = m_stream->alloc(4 + outResSize);
+    memcpy(ptr, &outResSize, 4);
+    memcpy(ptr + 4, outRes, outResSize);
+}
+
+void GL2Encoder::encodeFlushMappedBufferRange2(GLenum target, GLintptr offset, GLsizeiptr length,
+                                               GLbitfield access, void* guestBuffer) {
+    if (usesGeneratedLargeParams()) {
+        glFlushMappedBufferRangeAEMU2(this, target, offset, length, access, guestBuffer);
+        return;
+    }
+    const uint32_t bufferSize = guestBuffer ? length : 0;
+    m_stream->allocLargeParamHeader(OP_glFlushMappedBufferRangeAEMU2, bufferSize, 0,
+                                    target, offset, length, access);
+    m_stream->writeLargeParam(guestBuffer, bufferSize);
+}
+
+void GL2Encoder::encodeStoreTextureContent(GLuint content, GLsizei size, const void* data) {
+    if (usesGeneratedLargeParams()) {
+        glStoreTextureContentAEMU(this, content, size, data);
+        return;
+    }
+    const uint32_t dataSize = data ? size : 0;
+    m_stream->allocLargeParamHeader(OP_glStoreTextureContentAEMU, dataSize, 0, content, size);
+    m_stream->writeLargeParam(data, dataSize);
 }
 
 static bool isValidDrawMode(GLenum mode)
@@ -1444,6 +2142,7 @@ static bool isValidDrawMode(GLenum mode)
 void GL2Encoder::s_glDrawArrays(void *self, GLenum mode, GLint first, GLsizei count)
 {
     GL2Encoder *ctx = (GL2Encoder *)self;
+    ctx->syncPersistentMappings();
     assert(ctx->m_state != NULL);
     SET_ERROR_IF(!isValidDrawMode(mode), GL_INVALID_ENUM);
     SET_ERROR_IF(count < 0, GL_INVALID_VALUE);
@@ -1460,7 +2159,7 @@ void GL2Encoder::s_glDrawArrays(void *self, GLenum mode, GLint first, GLsizei co
         ctx->sendVertexAttributes(first, count, true);
         ctx->m_glDrawArrays_enc(ctx, mode, 0, count);
     } else {
-        ctx->m_glDrawArrays_enc(ctx, mode, first, count);
+        ctx->encodeBufferDrawArrays(mode, first, count);
     }
 
     ctx->m_state->postDraw();
@@ -1471,6 +2170,7 @@ void GL2Encoder::s_glDrawElements(void *self, GLenum mode, GLsizei count, GLenum
 {
 
     GL2Encoder *ctx = (GL2Encoder *)self;
+    ctx->syncPersistentMappings();
     assert(ctx->m_state != NULL);
     SET_ERROR_IF(!isValidDrawMode(mode), GL_INVALID_ENUM);
     SET_ERROR_IF(count < 0, GL_INVALID_VALUE);
@@ -1501,6 +2201,7 @@ void GL2Encoder::s_glDrawElements(void *self, GLenum mode, GLsizei count, GLenum
     // caching previous results.
     if (ctx->m_state->currentIndexVbo() != 0) {
         buf = ctx->m_shared->getBufferData(ctx->m_state->currentIndexVbo());
+        ctx->ensureBufferShadow(GL_ELEMENT_ARRAY_BUFFER, buf);
         offset = (GLintptr)indices;
         indices = &buf->m_fixedBuffer[offset];
         ctx->getBufferIndexRange(buf,
@@ -1527,7 +2228,7 @@ void GL2Encoder::s_glDrawElements(void *self, GLenum mode, GLsizei count, GLenum
     if (ctx->m_state->currentIndexVbo() != 0) {
         if (!has_client_vertex_arrays) {
             ctx->doBindBufferEncodeCached(GL_ELEMENT_ARRAY_BUFFER, ctx->m_state->currentIndexVbo());
-            ctx->glDrawElementsOffset(ctx, mode, count, type, offset);
+            ctx->encodeBufferDrawElements(mode, count, type, offset);
             ctx->flushDrawCall();
             adjustIndices = false;
         } else {
@@ -1535,16 +2236,10 @@ void GL2Encoder::s_glDrawElements(void *self, GLenum mode, GLsizei count, GLenum
         }
     }
     if (adjustIndices) {
-        void *adjustedIndices =
-            ctx->recenterIndices(indices,
-                                 type,
-                                 count,
-                                 minIndex);
-
         if (has_indirect_arrays || 1) {
             ctx->sendVertexAttributes(minIndex, maxIndex - minIndex + 1, true);
-            ctx->glDrawElementsData(ctx, mode, count, type, adjustedIndices,
-                                    count * glSizeof(type));
+            ctx->encodeDrawElementsData(OP_glDrawElementsData, mode, count, type,
+                                        indices, minIndex);
             // XXX - OPTIMIZATION (see the other else branch) should be implemented
             if(!has_indirect_arrays) {
                 //ALOGD("unoptimized drawelements !!!\n");
@@ -1621,6 +2316,7 @@ void GL2Encoder::s_glDrawElementsNullAEMU(void *self, GLenum mode, GLsizei count
             // Don't do anything
         } else {
             buf = ctx->m_shared->getBufferData(ctx->m_state->currentIndexVbo());
+            ctx->ensureBufferShadow(GL_ELEMENT_ARRAY_BUFFER, buf);
             offset = (GLintptr)indices;
             indices = &buf->m_fixedBuffer[offset];
             ctx->getBufferIndexRange(buf,
@@ -1656,16 +2352,10 @@ void GL2Encoder::s_glDrawElementsNullAEMU(void *self, GLenum mode, GLsizei count
         }
     }
     if (adjustIndices) {
-        void *adjustedIndices =
-            ctx->recenterIndices(indices,
-                                 type,
-                                 count,
-                                 minIndex);
-
         if (has_indirect_arrays || 1) {
             ctx->sendVertexAttributes(minIndex, maxIndex - minIndex + 1, true);
-            ctx->glDrawElementsDataNullAEMU(ctx, mode, count, type, adjustedIndices,
-                                    count * glSizeof(type));
+            ctx->encodeDrawElementsData(OP_glDrawElementsDataNullAEMU, mode, count, type,
+                                        indices, minIndex);
             // XXX - OPTIMIZATION (see the other else branch) should be implemented
             if(!has_indirect_arrays) {
                 //ALOGD("unoptimized drawelements !!!\n");
@@ -1693,6 +2383,222 @@ GLint * GL2Encoder::getCompressedTextureFormats()
     return m_compressedTextureFormats;
 }
 
+// Returns the first ES version, as major * 10 + minor, with |param| as an
+// implementation-dependent limit, or 0 if it is not one. Limits whose value
+// does not fit a GLint are left to glGetInteger64v.
+static int sConstantLimitMinVersion(GLenum param) {
+    switch (param) {
+    case GL_MAX_VERTEX_UNIFORM_VECTORS:
+    case GL_MAX_VARYING_VECTORS:
+    case GL_MAX_FRAGMENT_UNIFORM_VECTORS:
+    case GL_MAX_VIEWPORT_DIMS:
+    case GL_SUBPIXEL_BITS:
+    case GL_NUM_COMPRESSED_TEXTURE_FORMATS:
+        return 20;
+    case GL_MAX_ELEMENTS_VERTICES:
+    case GL_MAX_ELEMENTS_INDICES:
+    case GL_MAX_VERTEX_UNIFORM_COMPONENTS:
+    case GL_MAX_VERTEX_UNIFORM_BLOCKS:
+    case GL_MAX_VERTEX_OUTPUT_COMPONENTS:
+    case GL_MAX_FRAGMENT_UNIFORM_COMPONENTS:
+    case GL_MAX_FRAGMENT_UNIFORM_BLOCKS:
+    case GL_MAX_FRAGMENT_INPUT_COMPONENTS:
+    case GL_MIN_PROGRAM_TEXEL_OFFSET:
+    case GL_MAX_PROGRAM_TEXEL_OFFSET:
+    case GL_MAX_COMBINED_UNIFORM_BLOCKS:
+    case GL_MAX_VARYING_COMPONENTS:
+    case GL_MAX_TRANSFORM_FEEDBACK_INTERLEAVED_COMPONENTS:
+    case GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_COMPONENTS:
+    case GL_NUM_PROGRAM_BINARY_FORMATS:
+        return 30;
+    case GL_MAX_COMPUTE_UNIFORM_BLOCKS:
+    case GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS:
+    case GL_MAX_COMPUTE_IMAGE_UNIFORMS:
+    case GL_MAX_COMPUTE_SHARED_MEMORY_SIZE:
+    case GL_MAX_COMPUTE_UNIFORM_COMPONENTS:
+    case GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS:
+    case GL_MAX_COMPUTE_ATOMIC_COUNTERS:
+    case GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS:
+    case GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS:
+    case GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS:
+    case GL_MAX_UNIFORM_LOCATIONS:
+    case GL_MAX_FRAMEBUFFER_WIDTH:
+    case GL_MAX_FRAMEBUFFER_HEIGHT:
+    case GL_MAX_FRAMEBUFFER_SAMPLES:
+    case GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET:
+    case GL_MAX_VERTEX_ATOMIC_COUNTER_BUFFERS:
+    case GL_MAX_FRAGMENT_ATOMIC_COUNTER_BUFFERS:
+    case GL_MAX_COMBINED_ATOMIC_COUNTER_BUFFERS:
+    case GL_MAX_VERTEX_ATOMIC_COUNTERS:
+    case GL_MAX_FRAGMENT_ATOMIC_COUNTERS:
+    case GL_MAX_COMBINED_ATOMIC_COUNTERS:
+    case GL_MAX_ATOMIC_COUNTER_BUFFER_SIZE:
+    case GL_MAX_IMAGE_UNITS:
+    case GL_MAX_VERTEX_IMAGE_UNIFORMS:
+    case GL_MAX_FRAGMENT_IMAGE_UNIFORMS:
+    case GL_MAX_COMBINED_IMAGE_UNIFORMS:
+    case GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS:
+    case GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS:
+    case GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS:
+    case GL_MAX_COMBINED_SHADER_OUTPUT_RESOURCES:
+    case GL_MAX_SAMPLE_MASK_WORDS:
+    case GL_MIN_PROGRAM_TEXTURE_GATHER_OFFSET:
+    case GL_MAX_PROGRAM_TEXTURE_GATHER_OFFSET:
+        return 31;
+    default:
+        return 0;
+    }
+}
+
+bool GL2Encoder::getConstantLimit(GLenum param, GLint* ptr) {
+    const int minVersion = sConstantLimitMinVersion(param);
+    if (!minVersion || majorVersion() * 10 + minorVersion() < minVersion) {
+        return false;
+    }
+
+    auto it = m_constantLimits.find(param);
+    if (it == m_constantLimits.end()) {
+        std::array<GLint, 2> values = {};
+        safe_glGetIntegerv(param, values.data());
+        it = m_constantLimits.emplace(param, values).first;
+    }
+    memcpy(ptr, it->second.data(), glUtilsParamSize(param) * sizeof(GLint));
+    return true;
+}
+
+bool GL2Encoder::getTrackedStateParameter(GLenum param, GLint* ptr) const {
+    const bool es3 = majorVersion() >= 3;
+    const bool es31 = es3 && (majorVersion() > 3 || minorVersion() >= 1);
+
+    switch (param) {
+    case GL_ACTIVE_TEXTURE:
+        *ptr = m_state->getActiveTextureUnit();
+        return true;
+    case GL_TEXTURE_BINDING_CUBE_MAP:
+        *ptr = m_state->getBoundTexture(GL_TEXTURE_CUBE_MAP);
+        return true;
+    case GL_TEXTURE_BINDING_2D_ARRAY:
+        if (!es3) return false;
+        *ptr = m_state->getBoundTexture(GL_TEXTURE_2D_ARRAY);
+        return true;
+    case GL_TEXTURE_BINDING_3D:
+        if (!es3) return false;
+        *ptr = m_state->getBoundTexture(GL_TEXTURE_3D);
+        return true;
+    case GL_TEXTURE_BINDING_2D_MULTISAMPLE:
+        if (!es31) return false;
+        *ptr = m_state->getBoundTexture(GL_TEXTURE_2D_MULTISAMPLE);
+        return true;
+    case GL_TEXTURE_BINDING_BUFFER_OES:
+        if (!es32Plus() && !m_extensions.textureBufferAny()) return false;
+        *ptr = m_state->getBoundTexture(GL_TEXTURE_BUFFER_OES);
+        return true;
+    case GL_RENDERBUFFER_BINDING:
+        *ptr = m_state->boundRenderbuffer();
+        return true;
+    case GL_CURRENT_PROGRAM:
+        *ptr = m_state->currentProgram();
+        return true;
+    case GL_VERTEX_ARRAY_BINDING:
+        if (!es3) return false;
+        *ptr = m_state->currentVertexArrayObject();
+        return true;
+    case GL_COPY_READ_BUFFER_BINDING:
+        if (!es3) return false;
+        *ptr = m_state->getBuffer(GL_COPY_READ_BUFFER);
+        return true;
+    case GL_COPY_WRITE_BUFFER_BINDING:
+        if (!es3) return false;
+        *ptr = m_state->getBuffer(GL_COPY_WRITE_BUFFER);
+        return true;
+    case GL_PIXEL_PACK_BUFFER_BINDING:
+        if (!es3) return false;
+        *ptr = m_state->getBuffer(GL_PIXEL_PACK_BUFFER);
+        return true;
+    case GL_PIXEL_UNPACK_BUFFER_BINDING:
+        if (!es3) return false;
+        *ptr = m_state->getBuffer(GL_PIXEL_UNPACK_BUFFER);
+        return true;
+    case GL_UNIFORM_BUFFER_BINDING:
+        if (!es3) return false;
+        *ptr = m_state->getBuffer(GL_UNIFORM_BUFFER);
+        return true;
+    case GL_ATOMIC_COUNTER_BUFFER_BINDING:
+        if (!es31) return false;
+        *ptr = m_state->getBuffer(GL_ATOMIC_COUNTER_BUFFER);
+        return true;
+    case GL_SHADER_STORAGE_BUFFER_BINDING:
+        if (!es31) return false;
+        *ptr = m_state->getBuffer(GL_SHADER_STORAGE_BUFFER);
+        return true;
+    case GL_DRAW_INDIRECT_BUFFER_BINDING:
+        if (!es31) return false;
+        *ptr = m_state->getBuffer(GL_DRAW_INDIRECT_BUFFER);
+        return true;
+    case GL_DISPATCH_INDIRECT_BUFFER_BINDING:
+        if (!es31) return false;
+        *ptr = m_state->getBuffer(GL_DISPATCH_INDIRECT_BUFFER);
+        return true;
+    default:
+        break;
+    }
+
+    const GLClientState::PixelStoreState* pixelStore = m_state->pixelStoreState();
+    switch (param) {
+    case GL_UNPACK_ALIGNMENT:
+        *ptr = pixelStore->unpack_alignment;
+        return true;
+    case GL_PACK_ALIGNMENT:
+        *ptr = pixelStore->pack_alignment;
+        return true;
+    case GL_UNPACK_ROW_LENGTH:
+        if (!es3) return false;
+        *ptr = pixelStore->unpack_row_length;
+        return true;
+    case GL_UNPACK_IMAGE_HEIGHT:
+        if (!es3) return false;
+        *ptr = pixelStore->unpack_image_height;
+        return true;
+    case GL_UNPACK_SKIP_PIXELS:
+        if (!es3) return false;
+        *ptr = pixelStore->unpack_skip_pixels;
+        return true;
+    case GL_UNPACK_SKIP_ROWS:
+        if (!es3) return false;
+        *ptr = pixelStore->unpack_skip_rows;
+        return true;
+    case GL_UNPACK_SKIP_IMAGES:
+        if (!es3) return false;
+        *ptr = pixelStore->unpack_skip_images;
+        return true;
+    case GL_PACK_ROW_LENGTH:
+        if (!es3) return false;
+        *ptr = pixelStore->pack_row_length;
+        return true;
+    case GL_PACK_SKIP_PIXELS:
+        if (!es3) return false;
+        *ptr = pixelStore->pack_skip_pixels;
+        return true;
+    case GL_PACK_SKIP_ROWS:
+        if (!es3) return false;
+        *ptr = pixelStore->pack_skip_rows;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool GL2Encoder::getGuestIntegerv(GLenum param, GLint* ptr) {
+    return getTrackedStateParameter(param, ptr) || getConstantLimit(param, ptr);
+}
+
+void GL2Encoder::hostGetIntegerv(GLenum param, GLint* ptr) {
+    if (m_hostIntegerQueries[param]++ == 0) {
+        ALOGV("%s: glGetIntegerv(0x%x) needs the host\n", __func__, param);
+    }
+    safe_glGetIntegerv(param, ptr);
+}
+
 // Replace uses of samplerExternalOES with sampler2D, recording the names of
 // modified shaders in data. Also remove
 //   #extension GL_OES_EGL_image_external : require
@@ -1925,7 +2831,12 @@ void GL2Encoder::s_glShaderSource(void *self, GLuint shader, GLsizei count, cons
 void GL2Encoder::s_glFinish(void *self)
 {
     GL2Encoder *ctx = (GL2Encoder *)self;
+    ctx->resolvePendingProgramLinks();
+    ctx->flushPersistentMappings();
     ctx->glFinishRoundTrip(self);
+    if (ctx->m_shared->hasPersistentMappings()) {
+        ctx->refreshPersistentReads();
+    }
 }
 
 void GL2Encoder::s_glLinkProgram(void * self, GLuint program)
@@ -1941,9 +2852,79 @@ void GL2Encoder::s_glLinkProgram(void * self, GLuint program)
         SET_ERROR_IF(ctx->m_state->getTransformFeedbackActive(), GL_INVALID_OPERATION);
     }
 
+    ctx->m_shared->clearUniformValues(program);
+    if (ctx->m_deferProgramLinks) {
+        // This link replaces whatever an earlier one left to read back.
+        std::string previousKey;
+        ctx->m_shared->takeProgramLinkPending(program, nullptr, &previousKey);
+    }
+
+    std::string cacheKey;
+    const bool cacheable = ctx->getProgramLinkCacheKey(program, &cacheKey);
+    ProgramLinkCache::Entry cached;
+    if (cacheable && ProgramLinkCache::get().load(cacheKey, &cached) &&
+        ctx->linkProgramFromCache(program, cacheKey, cached)) {
+        return;
+    }
+
     ctx->m_glLinkProgram_enc(self, program);
+    if (!cacheable) cacheKey.clear();
+
+    // The status and reflection of a program in use are read on every
+    // draw, so only links of programs not in use are left for later.
+    if (ctx->m_deferProgramLinks &&
+        program != ctx->m_state->currentProgram() &&
+        program != ctx->m_state->currentShaderProgram() &&
+        !ctx->m_state->isProgramInPipeline(program)) {
+        ctx->m_shared->setProgramLinkPending(program, cacheKey, ctx);
+        ctx->m_pendingProgramLinks.push_back(program);
+        return;
+    }
+    ctx->finishProgramLink(program, cacheKey);
+}
+
+void GL2Encoder::resolveProgramLink(GLuint program) {
+    if (!m_deferProgramLinks) return;
+    std::string cacheKey;
+    if (m_shared->takeProgramLinkPending(program, this, &cacheKey)) {
+        finishProgramLink(program, cacheKey);
+    }
+}
+
+void GL2Encoder::resolvePendingProgramLinks() {
+    if (m_pendingProgramLinks.empty()) return;
+    std::vector<GLuint> programs;
+    programs.swap(m_pendingProgramLinks);
+    if (!m_shared) return;
+    for (GLuint program : programs) {
+        std::string cacheKey;
+        if (m_shared->takeProgramLinkPending(program, this, &cacheKey)) {
+            finishProgramLink(program, cacheKey);
+        }
+    }
+}
+
+void GL2Encoder::finishProgramLink(GLuint program, const std::string& cacheKey) {
+    GL2Encoder* ctx = this;
+    void* self = this;
+    const bool cacheable = !cacheKey.empty();
+    ProgramLinkCache::Entry cached;
+
+    GLint linkStatus = 0;
+    if (ctx->m_hasProgramReflection &&
+        ctx->getProgramReflection(program, &linkStatus, &cached)) {
+        ctx->m_shared->setProgramLinkStatus(program, linkStatus);
+        if (!linkStatus) {
+            return;
+        }
+        ctx->applyProgramReflection(program, cached);
+        if (cacheable) {
+            ctx->getProgramBinaryForCache(program, &cached);
+            ProgramLinkCache::get().store(cacheKey, cached);
+        }
+        return;
+    }
 
-    GLint linkStatus = 0;
     ctx->m_glGetProgramiv_enc(self, program, GL_LINK_STATUS, &linkStatus);
     ctx->m_shared->setProgramLinkStatus(program, linkStatus);
     if (!linkStatus) {
@@ -1974,12 +2955,14 @@ void GL2Encoder::s_glLinkProgram(void * self, GLuint program)
         ctx->m_glGetActiveUniform_enc(self, program, i, maxLength, NULL, &size, &type, name);
         location = ctx->m_glGetUniformLocation_enc(self, program, name);
         ctx->m_shared->setProgramIndexInfo(program, i, location, size, type, name);
+        if (cacheable) cached.uniforms.push_back({location, size, type, name});
     }
 
     for (GLint i = 0; i < numAttributes; ++i) {
         ctx->m_glGetActiveAttrib_enc(self, program, i, maxAttribLength,  NULL, &size, &type, name);
         location = ctx->m_glGetAttribLocation_enc(self, program, name);
         ctx->m_shared->setProgramAttribInfo(program, i, location, size, type, name);
+        if (cacheable) cached.attribs.push_back({location, size, type, name});
     }
 
     if (ctx->majorVersion() > 2) {
@@ -1990,9 +2973,119 @@ void GL2Encoder::s_glLinkProgram(void * self, GLuint program)
         GLint tfVaryingsCount;
         ctx->m_glGetProgramiv_enc(ctx, program, GL_TRANSFORM_FEEDBACK_VARYINGS, &tfVaryingsCount);
         ctx->m_shared->setTransformFeedbackVaryingsCountForProgram(program, tfVaryingsCount);
+
+        cached.activeUniformBlocks = numBlocks;
+        cached.transformFeedbackVaryings = tfVaryingsCount;
     }
 
     delete[] name;
+
+    if (cacheable) {
+        ctx->getProgramBinaryForCache(program, &cached);
+        ProgramLinkCache::get().store(cacheKey, cached);
+    }
+}
+
+bool GL2Encoder::getProgramLinkCacheKey(GLuint program, std::string* key) {
+    if (!ProgramLinkCache::get().isEnabled() || m_hostRendererId.empty()) {
+        return false;
+    }
+
+    std::string inputs;
+    if (!m_shared->getProgramLinkInputs(program, &inputs)) {
+        return false;
+    }
+    *key = ProgramLinkCache::digest(
+        m_hostRendererId + '\n' + std::to_string(majorVersion()) + '.' +
+        std::to_string(minorVersion()) + '\n' + inputs);
+    return true;
+}
+
+bool GL2Encoder::linkProgramFromCache(GLuint program, const std::string& cacheKey,
+                                      const ProgramLinkCache::Entry& entry) {
+    if (!entry.binary.empty()) {
+        // The host may no longer take the binary, in which case the caller
+        // links from the shaders as usual.
+        m_glProgramBinary_enc(this, program, entry.binaryFormat,
+                              entry.binary.data(), entry.binary.size());
+        GLint linkStatus = 0;
+        m_glGetProgramiv_enc(this, program, GL_LINK_STATUS, &linkStatus);
+        if (!linkStatus) return false;
+    } else {
+        // Nothing but the key says the host would link these shaders the
+        // same way, so an entry from an earlier launch is first replaced by
+        // what an ordinary link reads back. After that the link is not
+        // waited on; the host still answers glGetProgramiv.
+        if (!ProgramLinkCache::get().isVerified(cacheKey)) return false;
+        m_glLinkProgram_enc(this, program);
+    }
+
+    m_shared->setProgramLinkStatus(program, GL_TRUE);
+    applyProgramReflection(program, entry);
+    return true;
+}
+
+bool GL2Encoder::getProgramReflection(GLuint program, GLint* linkStatus,
+                                      ProgramLinkCache::Entry* entry) {
+    if (m_programReflection.empty()) {
+        m_programReflection.resize(kInitialProgramReflectionSize);
+    }
+
+    GLsizei length = 0;
+    glGetProgramReflectionAEMU(this, program, m_programReflection.size(), &length,
+                               m_programReflection.data());
+    if (length > (GLsizei)m_programReflection.size()) {
+        // Too small for this program; the buffer keeps the new size for
+        // the programs that come after it.
+        m_programReflection.resize(length);
+        glGetProgramReflectionAEMU(this, program, m_programReflection.size(), &length,
+                                   m_programReflection.data());
+    }
+    if (length <= 0 || length > (GLsizei)m_programReflection.size()) {
+        return false;
+    }
+
+    entry->uniforms.clear();
+    entry->attribs.clear();
+    return ProgramLinkCache::parseReflection(m_programReflection.data(), length,
+                                             linkStatus, entry);
+}
+
+void GL2Encoder::applyProgramReflection(GLuint program, const ProgramLinkCache::Entry& entry) {
+    m_shared->initProgramData(program, entry.uniforms.size(), entry.attribs.size());
+    for (size_t i = 0; i < entry.uniforms.size(); ++i) {
+        const ProgramLinkCache::Variable& var = entry.uniforms[i];
+        m_shared->setProgramIndexInfo(program, i, var.location, var.size, var.type,
+                                      var.name.c_str());
+    }
+    for (size_t i = 0; i < entry.attribs.size(); ++i) {
+        const ProgramLinkCache::Variable& var = entry.attribs[i];
+        m_shared->setProgramAttribInfo(program, i, var.location, var.size, var.type,
+                                       var.name.c_str());
+    }
+    if (majorVersion() > 2) {
+        m_shared->setActiveUniformBlockCountForProgram(program, entry.activeUniformBlocks);
+        m_shared->setTransformFeedbackVaryingsCountForProgram(program,
+                                                             entry.transformFeedbackVaryings);
+    }
+}
+
+void GL2Encoder::getProgramBinaryForCache(GLuint program, ProgramLinkCache::Entry* entry) {
+    GLint numFormats = 0;
+    if (majorVersion() < 3 ||
+        !getConstantLimit(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats) || !numFormats) {
+        return;
+    }
+
+    GLint length = 0;
+    m_glGetProgramiv_enc(this, program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0 || length > kMaxCachedProgramBinarySize) return;
+
+    entry->binary.resize(length);
+    GLsizei written = 0;
+    m_glGetProgramBinary_enc(this, program, length, &written, &entry->binaryFormat,
+                             entry->binary.data());
+    entry->binary.resize(written > 0 ? std::min<GLsizei>(written, length) : 0);
 }
 
 #define VALIDATE_PROGRAM_NAME(program) \
@@ -2002,6 +3095,7 @@ void GL2Encoder::s_glLinkProgram(void * self, GLuint program)
         ctx->m_shared->isProgram(program); \
     SET_ERROR_IF(!isShaderOrProgramObject, GL_INVALID_VALUE); \
     SET_ERROR_IF(!isProgram, GL_INVALID_OPERATION); \
+    ctx->resolveProgramLink(program); \
 
 #define VALIDATE_PROGRAM_NAME_RET(program, ret) \
     bool isShaderOrProgramObject = \
@@ -2010,6 +3104,7 @@ void GL2Encoder::s_glLinkProgram(void * self, GLuint program)
         ctx->m_shared->isProgram(program); \
     RET_AND_SET_ERROR_IF(!isShaderOrProgramObject, GL_INVALID_VALUE, ret); \
     RET_AND_SET_ERROR_IF(!isProgram, GL_INVALID_OPERATION, ret); \
+    ctx->resolveProgramLink(program); \
 
 #define VALIDATE_SHADER_NAME(shader) \
     bool isShaderOrProgramObject = \
@@ -2035,6 +3130,7 @@ void GL2Encoder::s_glGetUniformiv(void *self, GLuint program, GLint location, GL
     GL2Encoder *ctx = (GL2Encoder*)self;
     SET_ERROR_IF(!ctx->m_shared->isShaderOrProgramObject(program), GL_INVALID_VALUE);
     SET_ERROR_IF(!ctx->m_shared->isProgram(program), GL_INVALID_OPERATION);
+    ctx->resolveProgramLink(program);
     SET_ERROR_IF(!ctx->m_shared->isProgramInitialized(program), GL_INVALID_OPERATION);
     SET_ERROR_IF(ctx->m_shared->getProgramUniformType(program,location)==0, GL_INVALID_OPERATION);
     SET_ERROR_IF(!ctx->m_shared->isProgramUniformLocationValid(program,location), GL_INVALID_OPERATION);
@@ -2045,6 +3141,7 @@ void GL2Encoder::s_glGetUniformfv(void *self, GLuint program, GLint location, GL
     GL2Encoder *ctx = (GL2Encoder*)self;
     SET_ERROR_IF(!ctx->m_shared->isShaderOrProgramObject(program), GL_INVALID_VALUE);
     SET_ERROR_IF(!ctx->m_shared->isProgram(program), GL_INVALID_OPERATION);
+    ctx->resolveProgramLink(program);
     SET_ERROR_IF(!ctx->m_shared->isProgramInitialized(program), GL_INVALID_OPERATION);
     SET_ERROR_IF(ctx->m_shared->getProgramUniformType(program,location)==0, GL_INVALID_OPERATION);
     SET_ERROR_IF(!ctx->m_shared->isProgramUniformLocationValid(program,location), GL_INVALID_OPERATION);
@@ -2203,6 +3300,7 @@ int GL2Encoder::s_glGetUniformLocation(void *self, GLuint program, const GLchar
 
     RET_AND_SET_ERROR_IF(!isShaderOrProgramObject, GL_INVALID_VALUE, -1);
     RET_AND_SET_ERROR_IF(!isProgram, GL_INVALID_OPERATION, -1);
+    ctx->resolveProgramLink(program);
     RET_AND_SET_ERROR_IF(!ctx->m_shared->getProgramLinkStatus(program), GL_INVALID_OPERATION, -1);
 
     return ctx->m_glGetUniformLocation_enc(self, program, name);
@@ -2224,8 +3322,8 @@ bool GL2Encoder::updateHostTexture2DBinding(GLenum texUnit, GLenum newTarget)
             m_state->disableTextureTarget(GL_TEXTURE_EXTERNAL_OES);
             m_state->enableTextureTarget(GL_TEXTURE_2D);
         }
-        m_glActiveTexture_enc(this, texUnit);
-        m_glBindTexture_enc(this, GL_TEXTURE_2D,
+        encodeActiveTexture(texUnit);
+        encodeBindTexture(GL_TEXTURE_2D,
                 m_state->getBoundTexture(newTarget));
         return true;
     }
@@ -2233,6 +3331,16 @@ bool GL2Encoder::updateHostTexture2DBinding(GLenum texUnit, GLenum newTarget)
     return false;
 }
 
+void GL2Encoder::encodeActiveTexture(GLenum texture) {
+    m_glActiveTexture_enc(this, texture);
+    m_state->stateShadow().onActiveTextureEncoded(texture);
+}
+
+void GL2Encoder::encodeBindTexture(GLenum target, GLuint texture) {
+    m_glBindTexture_enc(this, target, texture);
+    m_state->stateShadow().onBindTextureEncoded(target, texture);
+}
+
 void GL2Encoder::updateHostTexture2DBindingsFromProgramData(GLuint program) {
     GL2Encoder *ctx = this;
     GLClientState* state = ctx->m_state;
@@ -2254,7 +3362,7 @@ void GL2Encoder::updateHostTexture2DBindingsFromProgramData(GLuint program) {
     }
     state->setActiveTextureUnit(origActiveTexture);
     if (hostActiveTexture != origActiveTexture) {
-        ctx->m_glActiveTexture_enc(ctx, origActiveTexture);
+        ctx->encodeActiveTexture(origActiveTexture);
     }
 }
 
@@ -2266,8 +3374,11 @@ void GL2Encoder::s_glUseProgram(void *self, GLuint program)
     SET_ERROR_IF(program && !shared->isShaderOrProgramObject(program), GL_INVALID_VALUE);
     SET_ERROR_IF(program && !shared->isProgram(program), GL_INVALID_OPERATION);
     SET_ERROR_IF(ctx->m_state->getTransformFeedbackActiveUnpaused(), GL_INVALID_OPERATION);
+    if (program) ctx->resolveProgramLink(program);
 
-    ctx->m_glUseProgram_enc(self, program);
+    if (!ctx->m_state->stateShadow().skipUseProgram(program)) {
+        ctx->m_glUseProgram_enc(self, program);
+    }
 
     GLuint currProgram = ctx->m_state->currentProgram();
     ctx->m_shared->onUseProgram(currProgram, program);
@@ -2282,18 +3393,48 @@ void GL2Encoder::s_glUseProgram(void *self, GLuint program)
     }
 }
 
+bool GL2Encoder::isRedundantUniform(bool isFloat, bool isUnsigned,
+                                    GLint columns, GLint rows,
+                                    GLint location, GLsizei count,
+                                    const void* data, GLboolean transpose) {
+    GLenum err = GL_NO_ERROR;
+    m_state->validateUniform(isFloat, isUnsigned, columns, rows, location, count, &err);
+    if (err != GL_NO_ERROR) {
+        *getErrorPtr() = err;
+        return false;
+    }
+
+    // Uniforms set through a program pipeline's active program are not
+    // tracked; its binding is not followed closely enough on the guest.
+    GLStateShadow& shadow = m_state->stateShadow();
+    if (!shadow.enabled() || !m_state->currentProgram() ||
+        location < 0 || count <= 0) {
+        return false;
+    }
+
+    if (m_shared->updateUniformValues(m_state->currentProgram(),
+                                      location, count, columns * rows * 4,
+                                      data, transpose)) {
+        shadow.onDropped(GLStateShadow::Uniform);
+        return true;
+    }
+    return false;
+}
+
 void GL2Encoder::s_glUniform1f(void *self , GLint location, GLfloat x)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform1f_enc(self, location, x);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, 1 /* count */, &x)) {
+        ctx->m_glUniform1f_enc(self, location, x);
+    }
 }
 
 void GL2Encoder::s_glUniform1fv(void *self , GLint location, GLsizei count, const GLfloat* v)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform1fv_enc(self, location, count, v);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, count /* count */, v)) {
+        ctx->m_glUniform1fv_enc(self, location, count, v);
+    }
 }
 
 void GL2Encoder::s_glUniform1i(void *self , GLint location, GLint x)
@@ -2302,15 +3443,15 @@ void GL2Encoder::s_glUniform1i(void *self , GLint location, GLint x)
     GLClientState* state = ctx->m_state;
     GLSharedGroupPtr shared = ctx->m_shared;
 
-    ctx->m_state->validateUniform(false /* is float? */, false /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-
-    ctx->m_glUniform1i_enc(self, location, x);
+    if (!ctx->isRedundantUniform(false /* is float? */, false /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, 1 /* count */, &x)) {
+        ctx->m_glUniform1i_enc(self, location, x);
+    }
 
     GLenum target;
     if (shared->setSamplerUniform(state->currentShaderProgram(), location, x, &target)) {
         GLenum origActiveTexture = state->getActiveTextureUnit();
         if (ctx->updateHostTexture2DBinding(GL_TEXTURE0 + x, target)) {
-            ctx->m_glActiveTexture_enc(self, origActiveTexture);
+            ctx->encodeActiveTexture(origActiveTexture);
         }
         state->setActiveTextureUnit(origActiveTexture);
     }
@@ -2319,113 +3460,135 @@ void GL2Encoder::s_glUniform1i(void *self , GLint location, GLint x)
 void GL2Encoder::s_glUniform1iv(void *self , GLint location, GLsizei count, const GLint* v)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, false /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform1iv_enc(self, location, count, v);
+    if (!ctx->isRedundantUniform(false /* is float? */, false /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, count /* count */, v)) {
+        ctx->m_glUniform1iv_enc(self, location, count, v);
+    }
 }
 
 void GL2Encoder::s_glUniform2f(void *self , GLint location, GLfloat x, GLfloat y)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform2f_enc(self, location, x, y);
+    const GLfloat values[] = { x, y };
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform2f_enc(self, location, x, y);
+    }
 }
 
 void GL2Encoder::s_glUniform2fv(void *self , GLint location, GLsizei count, const GLfloat* v)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform2fv_enc(self, location, count, v);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, count /* count */, v)) {
+        ctx->m_glUniform2fv_enc(self, location, count, v);
+    }
 }
 
 void GL2Encoder::s_glUniform2i(void *self , GLint location, GLint x, GLint y)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, false /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform2i_enc(self, location, x, y);
+    const GLint values[] = { x, y };
+    if (!ctx->isRedundantUniform(false /* is float? */, false /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform2i_enc(self, location, x, y);
+    }
 }
 
 void GL2Encoder::s_glUniform2iv(void *self , GLint location, GLsizei count, const GLint* v)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, false /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform2iv_enc(self, location, count, v);
+    if (!ctx->isRedundantUniform(false /* is float? */, false /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, count /* count */, v)) {
+        ctx->m_glUniform2iv_enc(self, location, count, v);
+    }
 }
 
 void GL2Encoder::s_glUniform3f(void *self , GLint location, GLfloat x, GLfloat y, GLfloat z)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform3f_enc(self, location, x, y, z);
+    const GLfloat values[] = { x, y, z };
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform3f_enc(self, location, x, y, z);
+    }
 }
 
 void GL2Encoder::s_glUniform3fv(void *self , GLint location, GLsizei count, const GLfloat* v)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform3fv_enc(self, location, count, v);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, count /* count */, v)) {
+        ctx->m_glUniform3fv_enc(self, location, count, v);
+    }
 }
 
 void GL2Encoder::s_glUniform3i(void *self , GLint location, GLint x, GLint y, GLint z)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, false /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform3i_enc(self, location, x, y, z);
+    const GLint values[] = { x, y, z };
+    if (!ctx->isRedundantUniform(false /* is float? */, false /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform3i_enc(self, location, x, y, z);
+    }
 }
 
 void GL2Encoder::s_glUniform3iv(void *self , GLint location, GLsizei count, const GLint* v)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, false /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform3iv_enc(self, location, count, v);
+    if (!ctx->isRedundantUniform(false /* is float? */, false /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, count /* count */, v)) {
+        ctx->m_glUniform3iv_enc(self, location, count, v);
+    }
 }
 
 void GL2Encoder::s_glUniform4f(void *self , GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform4f_enc(self, location, x, y, z, w);
+    const GLfloat values[] = { x, y, z, w };
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform4f_enc(self, location, x, y, z, w);
+    }
 }
 
 void GL2Encoder::s_glUniform4fv(void *self , GLint location, GLsizei count, const GLfloat* v)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform4fv_enc(self, location, count, v);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, count /* count */, v)) {
+        ctx->m_glUniform4fv_enc(self, location, count, v);
+    }
 }
 
 void GL2Encoder::s_glUniform4i(void *self , GLint location, GLint x, GLint y, GLint z, GLint w)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, false /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform4i_enc(self, location, x, y, z, w);
+    const GLint values[] = { x, y, z, w };
+    if (!ctx->isRedundantUniform(false /* is float? */, false /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform4i_enc(self, location, x, y, z, w);
+    }
 }
 
 void GL2Encoder::s_glUniform4iv(void *self , GLint location, GLsizei count, const GLint* v)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, false /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform4iv_enc(self, location, count, v);
+    if (!ctx->isRedundantUniform(false /* is float? */, false /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, count /* count */, v)) {
+        ctx->m_glUniform4iv_enc(self, location, count, v);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix2fv(void *self , GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 2 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix2fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 2 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix2fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix3fv(void *self , GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 3 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix3fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 3 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix3fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix4fv(void *self , GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 4 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix4fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 4 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix4fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glActiveTexture(void* self, GLenum texture)
@@ -2440,6 +3603,7 @@ void GL2Encoder::s_glActiveTexture(void* self, GLenum texture)
     SET_ERROR_IF(texture - GL_TEXTURE0 > maxCombinedUnits - 1, GL_INVALID_ENUM);
     SET_ERROR_IF((err = state->setActiveTextureUnit(texture)) != GL_NO_ERROR, err);
 
+    if (state->stateShadow().skipActiveTexture(texture)) return;
     ctx->m_glActiveTexture_enc(ctx, texture);
 }
 
@@ -2454,6 +3618,10 @@ void GL2Encoder::s_glBindTexture(void* self, GLenum target, GLuint texture)
     SET_ERROR_IF((err = state->bindTexture(target, texture, &firstUse)) != GL_NO_ERROR, err);
 
     if (target != GL_TEXTURE_2D && target != GL_TEXTURE_EXTERNAL_OES) {
+        if (state->stateShadow().skipBindTexture(target, texture,
+                                                 state->textureDeletions())) {
+            return;
+        }
         ctx->m_glBindTexture_enc(ctx, target, texture);
         return;
     }
@@ -2461,7 +3629,7 @@ void GL2Encoder::s_glBindTexture(void* self, GLenum target, GLuint texture)
     GLenum priorityTarget = state->getPriorityEnabledTarget(GL_TEXTURE_2D);
 
     if (target == GL_TEXTURE_EXTERNAL_OES && firstUse) {
-        ctx->m_glBindTexture_enc(ctx, GL_TEXTURE_2D, texture);
+        ctx->encodeBindTexture(GL_TEXTURE_2D, texture);
         ctx->m_glTexParameteri_enc(ctx, GL_TEXTURE_2D,
                 GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         ctx->m_glTexParameteri_enc(ctx, GL_TEXTURE_2D,
@@ -2470,12 +3638,14 @@ void GL2Encoder::s_glBindTexture(void* self, GLenum target, GLuint texture)
                 GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
         if (target != priorityTarget) {
-            ctx->m_glBindTexture_enc(ctx, GL_TEXTURE_2D,
+            ctx->encodeBindTexture(GL_TEXTURE_2D,
                     state->getBoundTexture(GL_TEXTURE_2D));
         }
     }
 
-    if (target == priorityTarget) {
+    if (target == priorityTarget &&
+        !state->stateShadow().skipBindTexture(GL_TEXTURE_2D, texture,
+                                              state->textureDeletions())) {
         ctx->m_glBindTexture_enc(ctx, GL_TEXTURE_2D, texture);
     }
 }
@@ -2684,6 +3854,7 @@ void GL2Encoder::s_glTexBufferRangeEXT(void* self,
 
 bool GL2Encoder::validateAllowedEnablei(void* self, GLenum cap, GLuint index) {
      GL2Encoder* ctx = (GL2Encoder*)self;
+     if (ctx->m_hostValidation) return true;
      switch(cap)
      {
      case GL_BLEND:
@@ -2700,6 +3871,7 @@ void GL2Encoder::s_glEnableiEXT(void * self, GLenum cap, GLuint index)
      GL2Encoder* ctx = (GL2Encoder*)self;
      SET_ERROR_IF(!ctx->getExtensions().drawBuffersIndexedEXT, GL_INVALID_OPERATION);
      if(!validateAllowedEnablei(ctx, cap, index)) return;
+     ctx->m_state->stateShadow().invalidateCap(cap);
      ctx->m_glEnableiEXT_enc(ctx, cap, index);
 }
 
@@ -2708,6 +3880,7 @@ void GL2Encoder::s_glDisableiEXT(void* self, GLenum cap, GLuint index)
      GL2Encoder* ctx = (GL2Encoder*)self;
      SET_ERROR_IF(!ctx->getExtensions().drawBuffersIndexedEXT, GL_INVALID_OPERATION);
      if(!validateAllowedEnablei(ctx, cap, index)) return;
+     ctx->m_state->stateShadow().invalidateCap(cap);
      ctx->m_glDisableiEXT_enc(ctx, cap, index);
 }
 
@@ -2719,6 +3892,7 @@ void GL2Encoder::s_glBlendEquationiEXT(void* self, GLuint buf, GLenum mode)
      SET_ERROR_IF(
         !GLESv2Validation::allowedBlendEquation(mode),
         GL_INVALID_ENUM);
+     ctx->m_state->stateShadow().invalidateBlendEquation();
      ctx->m_glBlendEquationiEXT_enc(ctx, buf, mode);
 }
 
@@ -2731,6 +3905,7 @@ void GL2Encoder::s_glBlendEquationSeparateiEXT(void* self, GLuint buf, GLenum mo
         !GLESv2Validation::allowedBlendEquation(modeRGB) ||
         !GLESv2Validation::allowedBlendEquation(modeAlpha),
         GL_INVALID_ENUM);
+     ctx->m_state->stateShadow().invalidateBlendEquation();
      ctx->m_glBlendEquationSeparateiEXT_enc(ctx, buf, modeRGB, modeAlpha);
 }
 
@@ -2743,6 +3918,7 @@ void GL2Encoder::s_glBlendFunciEXT(void* self, GLuint buf, GLenum sfactor, GLenu
         !GLESv2Validation::allowedBlendFunc(sfactor) ||
         !GLESv2Validation::allowedBlendFunc(dfactor),
         GL_INVALID_ENUM);
+     ctx->m_state->stateShadow().invalidateBlendFunc();
      ctx->m_glBlendFunciEXT_enc(ctx, buf, sfactor, dfactor);
 }
 
@@ -2757,6 +3933,7 @@ void GL2Encoder::s_glBlendFuncSeparateiEXT(void* self, GLuint buf, GLenum srcRGB
         !GLESv2Validation::allowedBlendFunc(srcAlpha) ||
         !GLESv2Validation::allowedBlendFunc(dstAlpha),
         GL_INVALID_ENUM);
+     ctx->m_state->stateShadow().invalidateBlendFunc();
      ctx->m_glBlendFuncSeparateiEXT_enc(ctx, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
@@ -2788,6 +3965,7 @@ void GL2Encoder::s_glTexImage2D(void* self, GLenum target, GLint level,
         GLenum format, GLenum type, const GLvoid* pixels)
 {
     GL2Encoder* ctx = (GL2Encoder*)self;
+    ctx->syncPersistentMappings();
     GLClientState* state = ctx->m_state;
 
     SET_ERROR_IF(!GLESv2Validation::textureTarget(ctx, target), GL_INVALID_ENUM);
@@ -2850,15 +4028,34 @@ void GL2Encoder::s_glTexImage2D(void* self, GLenum target, GLint level,
         ctx->override2DTextureTarget(target);
     }
 
+    GLuint stagedOffset;
+    GLuint content = 0;
+    size_t pixelsSize = 0;
+    if (!ctx->boundBuffer(GL_PIXEL_UNPACK_BUFFER)) {
+        pixelsSize = glesv2_enc::pixelDataSize(ctx, width, height, format, type, 0);
+        content = ctx->textureContentFor(pixels, pixelsSize);
+    }
+
     if (ctx->boundBuffer(GL_PIXEL_UNPACK_BUFFER)) {
         ctx->glTexImage2DOffsetAEMU(
                 ctx, target, level, internalformat,
                 width, height, border,
                 format, type, (uintptr_t)pixels);
-    } else {
-        ctx->m_glTexImage2D_enc(
+    } else if (content) {
+        ctx->glTexImage2DContentAEMU(
+                ctx, target, level, internalformat,
+                width, height, border,
+                format, type, content);
+    } else if (ctx->stagePixelUpload(pixels, pixelsSize, &stagedOffset)) {
+        ctx->glTexImage2DOffsetAEMU(
                 ctx, target, level, internalformat,
                 width, height, border,
+                format, type, stagedOffset);
+        ctx->endStagedPixelUpload();
+    } else {
+        ctx->encodeTexImage2D(
+                target, level, internalformat,
+                width, height, border,
                 format, type, pixels);
     }
 
@@ -2872,6 +4069,7 @@ void GL2Encoder::s_glTexSubImage2D(void* self, GLenum target, GLint level,
         GLenum type, const GLvoid* pixels)
 {
     GL2Encoder* ctx = (GL2Encoder*)self;
+    ctx->syncPersistentMappings();
     GLClientState* state = ctx->m_state;
 
     SET_ERROR_IF(!GLESv2Validation::textureTarget(ctx, target), GL_INVALID_ENUM);
@@ -2921,13 +4119,22 @@ void GL2Encoder::s_glTexSubImage2D(void* self, GLenum target, GLint level,
         ctx->override2DTextureTarget(target);
     }
 
+    GLuint stagedOffset;
     if (ctx->boundBuffer(GL_PIXEL_UNPACK_BUFFER)) {
         ctx->glTexSubImage2DOffsetAEMU(
                 ctx, target, level,
                 xoffset, yoffset, width, height,
                 format, type, (uintptr_t)pixels);
+    } else if (ctx->stagePixelUpload(pixels,
+                   glesv2_enc::pixelDataSize(ctx, width, height, format, type, 0),
+                   &stagedOffset)) {
+        ctx->glTexSubImage2DOffsetAEMU(
+                ctx, target, level,
+                xoffset, yoffset, width, height,
+                format, type, stagedOffset);
+        ctx->endStagedPixelUpload();
     } else {
-        ctx->m_glTexSubImage2D_enc(ctx, target, level, xoffset, yoffset, width,
+        ctx->encodeTexSubImage2D(target, level, xoffset, yoffset, width,
                 height, format, type, pixels);
     }
 
@@ -3026,7 +4233,7 @@ bool GL2Encoder::texture2DNeedsOverride(GLenum target) const {
 void GL2Encoder::override2DTextureTarget(GLenum target)
 {
     if (texture2DNeedsOverride(target)) {
-        m_glBindTexture_enc(this, GL_TEXTURE_2D,
+        encodeBindTexture(GL_TEXTURE_2D,
                 m_state->getBoundTexture(target));
     }
 }
@@ -3040,9 +4247,9 @@ void GL2Encoder::restore2DTextureTarget(GLenum target)
         GLuint texture2DBoundTexture =
                 m_state->getBoundTexture(GL_TEXTURE_2D);
         if (!priorityEnabledBoundTexture) {
-            m_glBindTexture_enc(this, GL_TEXTURE_2D, texture2DBoundTexture);
+            encodeBindTexture(GL_TEXTURE_2D, texture2DBoundTexture);
         } else {
-            m_glBindTexture_enc(this, GL_TEXTURE_2D, priorityEnabledBoundTexture);
+            encodeBindTexture(GL_TEXTURE_2D, priorityEnabledBoundTexture);
         }
     }
 }
@@ -3062,6 +4269,14 @@ BufferData* GL2Encoder::getBufferData(GLenum target) const {
     return m_shared->getBufferData(bufferId);
 }
 
+// Indirect commands are sent by offset and read on the host, where they
+// may have been written by the GPU. Only the size of the buffer is looked
+// at here, never its shadow, so each costs the same whatever is in it.
+bool GL2Encoder::indirectCommandInBuffer(GLenum target, uintptr_t offset, size_t size) const {
+    const BufferData* buf = getBufferData(target);
+    return buf && offset + size <= buf->m_size;
+}
+
 BufferData* GL2Encoder::getBufferDataById(GLuint bufferId) const {
     if (!bufferId) return NULL;
     return m_shared->getBufferData(bufferId);
@@ -3074,7 +4289,8 @@ bool GL2Encoder::isBufferMapped(GLuint buffer) const {
 bool GL2Encoder::isBufferTargetMapped(GLenum target) const {
     BufferData* buf = getBufferData(target);
     if (!buf) return false;
-    return buf->m_mapped;
+    // Persistently mapped buffers may be used while mapped.
+    return buf->m_mapped && !(buf->m_mappedAccess & GL_MAP_PERSISTENT_BIT_EXT);
 }
 
 void GL2Encoder::s_glGenRenderbuffers(void* self,
@@ -3405,15 +4621,40 @@ void* GL2Encoder::s_glMapBufferRange(void* self, GLenum target, GLintptr offset,
               (access & GL_MAP_INVALIDATE_BUFFER_BIT) ||
               (access & GL_MAP_UNSYNCHRONIZED_BIT) ||
               (access & GL_MAP_FLUSH_EXPLICIT_BIT)), GL_INVALID_OPERATION, NULL);
+    RET_AND_SET_ERROR_IF(
+        (access & (GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT)) &
+            ~buf->m_storageFlags, GL_INVALID_OPERATION, NULL);
+    RET_AND_SET_ERROR_IF(
+        buf->m_immutable &&
+            ((access & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT)) & ~buf->m_storageFlags),
+        GL_INVALID_OPERATION, NULL);
 
     // end validation; actually do stuff now
 
+    ctx->ensureBufferShadow(target, buf);
+
+    if (!buf->m_readbackRanges.empty()) {
+        ctx->completeBufferReadback(boundBuffer, buf);
+    }
+
     buf->m_mapped = true;
     buf->m_mappedAccess = access;
     buf->m_mappedOffset = offset;
     buf->m_mappedLength = length;
 
+    if (access & GL_MAP_PERSISTENT_BIT_EXT) {
+        return ctx->mapBufferPersistent(target, boundBuffer, buf);
+    }
+
     if (ctx->hasExtension("ANDROID_EMU_dma_v2")) {
+        if (!(access & GL_MAP_WRITE_BIT) &&
+            ctx->m_state->shouldSkipHostMapBuffer(target)) {
+            // Nothing has written the buffer on the host since the guest
+            // shadow was last brought up to date.
+            buf->m_mappedFromShadow = true;
+            return &buf->m_fixedBuffer[offset];
+        }
+
         if (buf->dma_buffer.get().size < length) {
             goldfish_dma_context region;
 
@@ -3440,6 +4681,11 @@ void* GL2Encoder::s_glMapBufferRange(void* self, GLenum target, GLintptr offset,
                 access,
                 buf->m_guest_paddr);
 
+        if (access & GL_MAP_READ_BIT) {
+            // The host fills the region when it decodes the call.
+            ctx->syncWithHost();
+        }
+
         return reinterpret_cast<void*>(buf->dma_buffer.get().mapped_addr);
     } else {
         return s_glMapBufferRangeAEMUImpl(ctx, target, offset, length, access, buf);
@@ -3463,14 +4709,26 @@ GLboolean GL2Encoder::s_glUnmapBuffer(void* self, GLenum target) {
         // invalide index range cache here
         if (buf->m_mappedAccess & GL_MAP_INVALIDATE_BUFFER_BIT) {
             buf->m_indexRangeCache.invalidateRange(0, buf->m_size);
+            buf->m_indexBlockSummary.invalidateRange(0, buf->m_size);
         } else {
             buf->m_indexRangeCache.invalidateRange(buf->m_mappedOffset, buf->m_mappedLength);
+            buf->m_indexBlockSummary.invalidateRange(buf->m_mappedOffset, buf->m_mappedLength);
         }
     }
 
     GLboolean host_res = GL_TRUE;
 
-    if (buf->dma_buffer.get().mapped_addr) {
+    if (buf->m_mappedAccess & GL_MAP_PERSISTENT_BIT_EXT) {
+        // Explicit flushes have already gone out; anything else is sent
+        // as a diff. Once the mapping is removed no other context diffs it.
+        ctx->m_shared->removePersistentMapping(boundBuffer);
+        if (!buf->m_persistentSent.empty()) {
+            ctx->sendPersistentWrites(boundBuffer, buf);
+            buf->m_persistentSent.clear();
+        }
+    } else if (buf->m_mappedFromShadow) {
+        // Read-only and never mapped on the host.
+    } else if (buf->dma_buffer.get().mapped_addr) {
         memcpy(&buf->m_fixedBuffer[buf->m_mappedOffset],
                reinterpret_cast<void*>(buf->dma_buffer.get().mapped_addr),
                buf->m_mappedLength);
@@ -3484,8 +4742,8 @@ GLboolean GL2Encoder::s_glUnmapBuffer(void* self, GLenum target) {
             &host_res);
     } else {
         if (ctx->m_hasAsyncUnmapBuffer) {
-            ctx->glUnmapBufferAsyncAEMU(
-                    ctx, target,
+            ctx->encodeUnmapBufferAsync(
+                    target,
                     buf->m_mappedOffset,
                     buf->m_mappedLength,
                     buf->m_mappedAccess,
@@ -3508,6 +4766,7 @@ GLboolean GL2Encoder::s_glUnmapBuffer(void* self, GLenum target) {
     buf->m_mappedAccess = 0;
     buf->m_mappedOffset = 0;
     buf->m_mappedLength = 0;
+    buf->m_mappedFromShadow = false;
 
     return host_res;
 }
@@ -3532,24 +4791,85 @@ void GL2Encoder::s_glFlushMappedBufferRange(void* self, GLenum target, GLintptr
     GLintptr totalOffset = buf->m_mappedOffset + offset;
 
     buf->m_indexRangeCache.invalidateRange(totalOffset, length);
+    buf->m_indexBlockSummary.invalidateRange(totalOffset, length);
+
+    // The host buffer does not have persistent storage, so it is mapped
+    // the ordinary way just long enough to take the range.
+    const GLbitfield hostAccess =
+        buf->m_mappedAccess & ~(GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT);
 
     if (ctx->m_hasAsyncUnmapBuffer) {
-        ctx->glFlushMappedBufferRangeAEMU2(
-                ctx, target,
+        ctx->encodeFlushMappedBufferRange2(
+                target,
                 totalOffset,
                 length,
-                buf->m_mappedAccess,
+                hostAccess,
                 &buf->m_fixedBuffer[totalOffset]);
     } else {
         ctx->glFlushMappedBufferRangeAEMU(
                 ctx, target,
                 totalOffset,
                 length,
-                buf->m_mappedAccess,
+                hostAccess,
                 &buf->m_fixedBuffer[totalOffset]);
     }
 }
 
+void GL2Encoder::s_glBufferStorageEXT(void* self, GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) {
+    GL2Encoder* ctx = (GL2Encoder*)self;
+
+    SET_ERROR_IF(!GLESv2Validation::bufferTarget(ctx, target), GL_INVALID_ENUM);
+    GLuint bufferId = ctx->m_state->getBuffer(target);
+    SET_ERROR_IF(bufferId == 0, GL_INVALID_OPERATION);
+    SET_ERROR_IF(size <= 0, GL_INVALID_VALUE);
+    SET_ERROR_IF(flags & ~GLESv2Validation::allBufferStorageFlags, GL_INVALID_VALUE);
+    SET_ERROR_IF((flags & GL_MAP_PERSISTENT_BIT_EXT) &&
+                 !(flags & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT)), GL_INVALID_VALUE);
+    SET_ERROR_IF((flags & GL_MAP_COHERENT_BIT_EXT) &&
+                 !(flags & GL_MAP_PERSISTENT_BIT_EXT), GL_INVALID_VALUE);
+    BufferData* buf = ctx->m_shared->getBufferData(bufferId);
+    SET_ERROR_IF(buf && buf->m_immutable, GL_INVALID_OPERATION);
+
+    // Backed by an ordinary buffer on the host; data a persistent mapping
+    // writes only ever reaches it through sendBufferRange.
+    ctx->m_shared->updateBufferData(
+            bufferId, size, data,
+            (flags & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT)) ||
+                ctx->shouldShadowBuffer(target, buf));
+    ctx->m_shared->setBufferUsage(bufferId, GL_DYNAMIC_DRAW);
+    buf = ctx->m_shared->getBufferData(bufferId);
+    buf->m_immutable = true;
+    buf->m_storageFlags = flags;
+
+    if (ctx->m_hasSyncBufferData) {
+        ctx->glBufferDataSyncAEMU(self, target, size, data, GL_DYNAMIC_DRAW);
+    } else {
+        ctx->encodeBufferData(target, size, data, GL_DYNAMIC_DRAW);
+    }
+}
+
+void* GL2Encoder::mapBufferPersistent(GLenum target, GLuint bufferId, BufferData* buf) {
+    const GLbitfield access = buf->m_mappedAccess;
+    char* bits = &buf->m_fixedBuffer[buf->m_mappedOffset];
+
+    // Bring the shadow up to date once; after that it is refreshed at
+    // glFinish and glClientWaitSync.
+    if ((access & GL_MAP_READ_BIT) && !m_state->shouldSkipHostMapBuffer(target)) {
+        glMapBufferRangeAEMU(this, target, buf->m_mappedOffset, buf->m_mappedLength,
+                             GL_MAP_READ_BIT, bits);
+        m_state->onHostMappedBuffer(target);
+    }
+
+    // Write-only mappings do not need the host contents: only bytes the
+    // app changes are ever sent back.
+    if ((access & GL_MAP_WRITE_BIT) && !(access & GL_MAP_FLUSH_EXPLICIT_BIT)) {
+        buf->m_persistentSent.assign(bits, bits + buf->m_mappedLength);
+    }
+
+    m_shared->addPersistentMapping(bufferId);
+    return bits;
+}
+
 void GL2Encoder::s_glCompressedTexImage2D(void* self, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid* data) {
     GL2Encoder* ctx = (GL2Encoder*)self;
     GLClientState* state = ctx->m_state;
@@ -3596,15 +4916,25 @@ void GL2Encoder::s_glCompressedTexImage2D(void* self, GLenum target, GLint level
         ctx->override2DTextureTarget(target);
     }
 
+    GLuint content = 0;
+    if (!ctx->boundBuffer(GL_PIXEL_UNPACK_BUFFER)) {
+        content = ctx->textureContentFor(data, imageSize);
+    }
+
     if (ctx->boundBuffer(GL_PIXEL_UNPACK_BUFFER)) {
         ctx->glCompressedTexImage2DOffsetAEMU(
                 ctx, target, level, internalformat,
                 width, height, border,
                 imageSize, (uintptr_t)data);
-    } else {
-        ctx->m_glCompressedTexImage2D_enc(
+    } else if (content) {
+        ctx->glCompressedTexImage2DContentAEMU(
                 ctx, target, level, internalformat,
                 width, height, border,
+                imageSize, content);
+    } else {
+        ctx->encodeCompressedTexImage2D(
+                target, level, internalformat,
+                width, height, border,
                 imageSize, data);
     }
 
@@ -3674,8 +5004,8 @@ void GL2Encoder::s_glCompressedTexSubImage2D(void* self, GLenum target, GLint le
                 width, height, format,
                 imageSize, (uintptr_t)data);
     } else {
-        ctx->m_glCompressedTexSubImage2D_enc(
-                ctx, target, level,
+        ctx->encodeCompressedTexSubImage2D(
+                target, level,
                 xoffset, yoffset,
                 width, height, format,
                 imageSize, data);
@@ -3784,6 +5114,7 @@ void GL2Encoder::doIndexedBufferBindEncodeCached(IndexedBufferBindOp op, GLenum
 
 void GL2Encoder::s_glCopyBufferSubData(void *self , GLenum readtarget, GLenum writetarget, GLintptr readoffset, GLintptr writeoffset, GLsizeiptr size) {
     GL2Encoder* ctx = (GL2Encoder*)self;
+    ctx->syncPersistentMappings();
 
     SET_ERROR_IF(!GLESv2Validation::bufferTarget(ctx, readtarget), GL_INVALID_ENUM);
     SET_ERROR_IF(!GLESv2Validation::bufferTarget(ctx, writetarget), GL_INVALID_ENUM);
@@ -3827,6 +5158,10 @@ void GL2Encoder::s_glCopyBufferSubData(void *self , GLenum readtarget, GLenum wr
                  GL_INVALID_VALUE);
 
     ctx->m_glCopyBufferSubData_enc(self, readtarget, writetarget, readoffset, writeoffset, size);
+
+    // The copy happens on the host, so the guest shadow is now stale.
+    ctx->m_state->setBufferHostMapDirty(writeBufferId, true /* dirty */);
+    ctx->forgetBufferReadback(writeBufferId, writeBufferData);
 }
 
 void GL2Encoder::s_glGetBufferParameteriv(void* self, GLenum target, GLenum pname, GLint* params) {
@@ -3850,7 +5185,9 @@ void GL2Encoder::s_glGetBufferParameteriv(void* self, GLenum target, GLenum pnam
                  pname != GL_BUFFER_SIZE &&
                  pname != GL_BUFFER_USAGE &&
                  pname != GL_BUFFER_MAP_LENGTH &&
-                 pname != GL_BUFFER_MAP_OFFSET,
+                 pname != GL_BUFFER_MAP_OFFSET &&
+                 pname != GL_BUFFER_IMMUTABLE_STORAGE_EXT &&
+                 pname != GL_BUFFER_STORAGE_FLAGS_EXT,
                  GL_INVALID_ENUM);
 
     if (!params) return;
@@ -3876,6 +5213,12 @@ void GL2Encoder::s_glGetBufferParameteriv(void* self, GLenum target, GLenum pnam
         case GL_BUFFER_MAP_OFFSET:
             *params = buf ? buf->m_mappedOffset : 0;
             break;
+        case GL_BUFFER_IMMUTABLE_STORAGE_EXT:
+            *params = buf ? (buf->m_immutable ? GL_TRUE : GL_FALSE) : GL_FALSE;
+            break;
+        case GL_BUFFER_STORAGE_FLAGS_EXT:
+            *params = buf ? buf->m_storageFlags : 0;
+            break;
         default:
             break;
     }
@@ -3902,7 +5245,9 @@ void GL2Encoder::s_glGetBufferParameteri64v(void* self, GLenum target, GLenum pn
                  pname != GL_BUFFER_SIZE &&
                  pname != GL_BUFFER_USAGE &&
                  pname != GL_BUFFER_MAP_LENGTH &&
-                 pname != GL_BUFFER_MAP_OFFSET,
+                 pname != GL_BUFFER_MAP_OFFSET &&
+                 pname != GL_BUFFER_IMMUTABLE_STORAGE_EXT &&
+                 pname != GL_BUFFER_STORAGE_FLAGS_EXT,
                  GL_INVALID_ENUM);
 
     if (!params) return;
@@ -3928,6 +5273,12 @@ void GL2Encoder::s_glGetBufferParameteri64v(void* self, GLenum target, GLenum pn
         case GL_BUFFER_MAP_OFFSET:
             *params = buf ? buf->m_mappedOffset : 0;
             break;
+        case GL_BUFFER_IMMUTABLE_STORAGE_EXT:
+            *params = buf ? (buf->m_immutable ? GL_TRUE : GL_FALSE) : GL_FALSE;
+            break;
+        case GL_BUFFER_STORAGE_FLAGS_EXT:
+            *params = buf ? buf->m_storageFlags : 0;
+            break;
         default:
             break;
     }
@@ -4009,14 +5360,15 @@ void GL2Encoder::s_glUniform1ui(void* self, GLint location, GLuint v0) {
     GLClientState* state = ctx->m_state;
     GLSharedGroupPtr shared = ctx->m_shared;
 
-    ctx->m_state->validateUniform(false /* is float? */, true /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform1ui_enc(self, location, v0);
+    if (!ctx->isRedundantUniform(false /* is float? */, true /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, 1 /* count */, &v0)) {
+        ctx->m_glUniform1ui_enc(self, location, v0);
+    }
 
     GLenum target;
     if (shared->setSamplerUniform(state->currentShaderProgram(), location, v0, &target)) {
         GLenum origActiveTexture = state->getActiveTextureUnit();
         if (ctx->updateHostTexture2DBinding(GL_TEXTURE0 + v0, target)) {
-            ctx->m_glActiveTexture_enc(self, origActiveTexture);
+            ctx->encodeActiveTexture(origActiveTexture);
         }
         state->setActiveTextureUnit(origActiveTexture);
     }
@@ -4024,86 +5376,103 @@ void GL2Encoder::s_glUniform1ui(void* self, GLint location, GLuint v0) {
 
 void GL2Encoder::s_glUniform2ui(void* self, GLint location, GLuint v0, GLuint v1) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, true /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform2ui_enc(self, location, v0, v1);
+    const GLuint values[] = { v0, v1 };
+    if (!ctx->isRedundantUniform(false /* is float? */, true /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform2ui_enc(self, location, v0, v1);
+    }
 }
 
 void GL2Encoder::s_glUniform3ui(void* self, GLint location, GLuint v0, GLuint v1, GLuint v2) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, true /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform3ui_enc(self, location, v0, v1, v2);
+    const GLuint values[] = { v0, v1, v2 };
+    if (!ctx->isRedundantUniform(false /* is float? */, true /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform3ui_enc(self, location, v0, v1, v2);
+    }
 }
 
 void GL2Encoder::s_glUniform4ui(void* self, GLint location, GLint v0, GLuint v1, GLuint v2, GLuint v3) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, true /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, 1 /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform4ui_enc(self, location, v0, v1, v2, v3);
+    const GLuint values[] = { (GLuint)v0, v1, v2, v3 };
+    if (!ctx->isRedundantUniform(false /* is float? */, true /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, 1 /* count */, values)) {
+        ctx->m_glUniform4ui_enc(self, location, v0, v1, v2, v3);
+    }
 }
 
 void GL2Encoder::s_glUniform1uiv(void* self, GLint location, GLsizei count, const GLuint *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, true /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform1uiv_enc(self, location, count, value);
+    if (!ctx->isRedundantUniform(false /* is float? */, true /* is unsigned? */, 1 /* columns */, 1 /* rows */, location, count /* count */, value)) {
+        ctx->m_glUniform1uiv_enc(self, location, count, value);
+    }
 }
 
 void GL2Encoder::s_glUniform2uiv(void* self, GLint location, GLsizei count, const GLuint *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, true /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform2uiv_enc(self, location, count, value);
+    if (!ctx->isRedundantUniform(false /* is float? */, true /* is unsigned? */, 2 /* columns */, 1 /* rows */, location, count /* count */, value)) {
+        ctx->m_glUniform2uiv_enc(self, location, count, value);
+    }
 }
 
 void GL2Encoder::s_glUniform3uiv(void* self, GLint location, GLsizei count, const GLuint *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, true /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform3uiv_enc(self, location, count, value);
+    if (!ctx->isRedundantUniform(false /* is float? */, true /* is unsigned? */, 3 /* columns */, 1 /* rows */, location, count /* count */, value)) {
+        ctx->m_glUniform3uiv_enc(self, location, count, value);
+    }
 }
 
 void GL2Encoder::s_glUniform4uiv(void* self, GLint location, GLsizei count, const GLuint *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(false /* is float? */, true /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniform4uiv_enc(self, location, count, value);
+    if (!ctx->isRedundantUniform(false /* is float? */, true /* is unsigned? */, 4 /* columns */, 1 /* rows */, location, count /* count */, value)) {
+        ctx->m_glUniform4uiv_enc(self, location, count, value);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix2x3fv(void* self, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 3 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix2x3fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 3 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix2x3fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix3x2fv(void* self, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 2 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix3x2fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 2 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix3x2fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix2x4fv(void* self, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 4 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix2x4fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 2 /* columns */, 4 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix2x4fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix4x2fv(void* self, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 2 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix4x2fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 2 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix4x2fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix3x4fv(void* self, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 4 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix3x4fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 3 /* columns */, 4 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix3x4fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glUniformMatrix4x3fv(void* self, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
     GL2Encoder *ctx = (GL2Encoder*)self;
-    ctx->m_state->validateUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 3 /* rows */, location, count /* count */, ctx->getErrorPtr());
-    ctx->m_glUniformMatrix4x3fv_enc(self, location, count, transpose, value);
+    if (!ctx->isRedundantUniform(true /* is float? */, false /* is unsigned? */, 4 /* columns */, 3 /* rows */, location, count /* count */, value, transpose)) {
+        ctx->m_glUniformMatrix4x3fv_enc(self, location, count, transpose, value);
+    }
 }
 
 void GL2Encoder::s_glGetUniformuiv(void* self, GLuint program, GLint location, GLuint* params) {
     GL2Encoder *ctx = (GL2Encoder*)self;
     SET_ERROR_IF(!ctx->m_shared->isShaderOrProgramObject(program), GL_INVALID_VALUE);
     SET_ERROR_IF(!ctx->m_shared->isProgram(program), GL_INVALID_OPERATION);
+    ctx->resolveProgramLink(program);
     SET_ERROR_IF(!ctx->m_shared->isProgramInitialized(program), GL_INVALID_OPERATION);
     SET_ERROR_IF(ctx->m_shared->getProgramUniformType(program,location)==0, GL_INVALID_OPERATION);
     SET_ERROR_IF(!ctx->m_shared->isProgramUniformLocationValid(program,location), GL_INVALID_OPERATION);
@@ -4366,6 +5735,11 @@ void GL2Encoder::s_glTransformFeedbackVaryings(void* self, GLuint program, GLsiz
     SET_ERROR_IF(err != GL_NO_ERROR, GL_INVALID_OPERATION);
 
     ctx->glTransformFeedbackVaryingsAEMU(ctx, program, count, (const char*)&packed[0], packed.size() + 1, bufferMode);
+
+    if (ProgramLinkCache::get().isEnabled()) {
+        ctx->m_shared->addProgramLinkInput(
+            program, "t" + std::to_string(bufferMode) + ':' + packed + '\n');
+    }
 }
 
 void GL2Encoder::s_glBeginTransformFeedback(void* self, GLenum primitiveMode) {
@@ -4422,6 +5796,7 @@ void GL2Encoder::s_glTexImage3D(void* self, GLenum target, GLint level, GLint in
                                GLsizei width, GLsizei height, GLsizei depth,
                                GLint border, GLenum format, GLenum type, const GLvoid* data) {
     GL2Encoder* ctx = (GL2Encoder*)self;
+    ctx->syncPersistentMappings();
     GLClientState* state = ctx->m_state;
 
     SET_ERROR_IF(target != GL_TEXTURE_3D &&
@@ -4478,13 +5853,22 @@ void GL2Encoder::s_glTexImage3D(void* self, GLenum target, GLint level, GLint in
     state->setBoundTextureType(target, type);
     state->setBoundTextureDims(target, target, level, width, height, depth);
 
+    GLuint stagedOffset;
     if (ctx->boundBuffer(GL_PIXEL_UNPACK_BUFFER)) {
         ctx->glTexImage3DOffsetAEMU(
                 ctx, target, level, internalFormat,
                 width, height, depth,
                 border, format, type, (uintptr_t)data);
+    } else if (ctx->stagePixelUpload(data,
+                   glesv2_enc::pixelDataSize3D(ctx, width, height, depth, format, type, 0),
+                   &stagedOffset)) {
+        ctx->glTexImage3DOffsetAEMU(
+                ctx, target, level, internalFormat,
+                width, height, depth,
+                border, format, type, stagedOffset);
+        ctx->endStagedPixelUpload();
     } else {
-        ctx->m_glTexImage3D_enc(ctx,
+        ctx->encodeTexImage3D(
                 target, level, internalFormat,
                 width, height, depth,
                 border, format, type, data);
@@ -4493,6 +5877,7 @@ void GL2Encoder::s_glTexImage3D(void* self, GLenum target, GLint level, GLint in
 
 void GL2Encoder::s_glTexSubImage3D(void* self, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid* data) {
     GL2Encoder* ctx = (GL2Encoder*)self;
+    ctx->syncPersistentMappings();
     GLClientState* state = ctx->m_state;
 
     SET_ERROR_IF(target != GL_TEXTURE_3D &&
@@ -4534,14 +5919,24 @@ void GL2Encoder::s_glTexSubImage3D(void* self, GLenum target, GLint level, GLint
     SET_ERROR_IF(!ctx->boundBuffer(GL_PIXEL_UNPACK_BUFFER) && !data, GL_INVALID_OPERATION);
     SET_ERROR_IF(xoffset < 0 || yoffset < 0 || zoffset < 0, GL_INVALID_VALUE);
 
+    GLuint stagedOffset;
     if (ctx->boundBuffer(GL_PIXEL_UNPACK_BUFFER)) {
         ctx->glTexSubImage3DOffsetAEMU(ctx,
                 target, level,
                 xoffset, yoffset, zoffset,
                 width, height, depth,
                 format, type, (uintptr_t)data);
+    } else if (ctx->stagePixelUpload(data,
+                   glesv2_enc::pixelDataSize3D(ctx, width, height, depth, format, type, 0),
+                   &stagedOffset)) {
+        ctx->glTexSubImage3DOffsetAEMU(ctx,
+                target, level,
+                xoffset, yoffset, zoffset,
+                width, height, depth,
+                format, type, stagedOffset);
+        ctx->endStagedPixelUpload();
     } else {
-        ctx->m_glTexSubImage3D_enc(ctx,
+        ctx->encodeTexSubImage3D(
                 target, level,
                 xoffset, yoffset, zoffset,
                 width, height, depth,
@@ -4602,8 +5997,8 @@ void GL2Encoder::s_glCompressedTexImage3D(void* self, GLenum target, GLint level
                 width, height, depth, border,
                 imageSize, (uintptr_t)data);
     } else {
-        ctx->m_glCompressedTexImage3D_enc(
-                ctx, target, level, internalformat,
+        ctx->encodeCompressedTexImage3D(
+                target, level, internalformat,
                 width, height, depth, border,
                 imageSize, data);
     }
@@ -4677,8 +6072,8 @@ void GL2Encoder::s_glCompressedTexSubImage3D(void* self, GLenum target, GLint le
                 width, height, depth,
                 format, imageSize, (uintptr_t)data);
     } else {
-        ctx->m_glCompressedTexSubImage3D_enc(
-                ctx, target, level,
+        ctx->encodeCompressedTexSubImage3D(
+                target, level,
                 xoffset, yoffset, zoffset,
                 width, height, depth,
                 format, imageSize, data);
@@ -4730,6 +6125,7 @@ void GL2Encoder::s_glTexStorage3D(void* self, GLenum target, GLsizei levels, GLe
 
 void GL2Encoder::s_glDrawArraysInstanced(void* self, GLenum mode, GLint first, GLsizei count, GLsizei primcount) {
     GL2Encoder *ctx = (GL2Encoder *)self;
+    ctx->syncPersistentMappings();
     assert(ctx->m_state != NULL);
     SET_ERROR_IF(!isValidDrawMode(mode), GL_INVALID_ENUM);
     SET_ERROR_IF(count < 0, GL_INVALID_VALUE);
@@ -4758,6 +6154,7 @@ void GL2Encoder::s_glDrawElementsInstanced(void* self, GLenum mode, GLsizei coun
 {
 
     GL2Encoder *ctx = (GL2Encoder *)self;
+    ctx->syncPersistentMappings();
     assert(ctx->m_state != NULL);
     SET_ERROR_IF(!isValidDrawMode(mode), GL_INVALID_ENUM);
     SET_ERROR_IF(count < 0, GL_INVALID_VALUE);
@@ -4789,6 +6186,7 @@ void GL2Encoder::s_glDrawElementsInstanced(void* self, GLenum mode, GLsizei coun
     // caching previous results.
     if (ctx->m_state->currentIndexVbo() != 0) {
         buf = ctx->m_shared->getBufferData(ctx->m_state->currentIndexVbo());
+        ctx->ensureBufferShadow(GL_ELEMENT_ARRAY_BUFFER, buf);
         offset = (GLintptr)indices;
         indices = &buf->m_fixedBuffer[offset];
         ctx->getBufferIndexRange(buf,
@@ -4824,15 +6222,10 @@ void GL2Encoder::s_glDrawElementsInstanced(void* self, GLenum mode, GLsizei coun
         }
     }
     if (adjustIndices) {
-        void *adjustedIndices =
-            ctx->recenterIndices(indices,
-                                 type,
-                                 count,
-                                 minIndex);
-
         if (has_indirect_arrays || 1) {
             ctx->sendVertexAttributes(minIndex, maxIndex - minIndex + 1, true, primcount);
-            ctx->glDrawElementsInstancedDataAEMU(ctx, mode, count, type, adjustedIndices, primcount, count * glSizeof(type));
+            ctx->encodeDrawElementsData(OP_glDrawElementsInstancedDataAEMU, mode, count, type,
+                                        indices, minIndex, &primcount);
             ctx->m_stream->flush();
             // XXX - OPTIMIZATION (see the other else branch) should be implemented
             if(!has_indirect_arrays) {
@@ -4851,6 +6244,7 @@ void GL2Encoder::s_glDrawRangeElements(void* self, GLenum mode, GLuint start, GL
 {
 
     GL2Encoder *ctx = (GL2Encoder *)self;
+    ctx->syncPersistentMappings();
     assert(ctx->m_state != NULL);
     SET_ERROR_IF(!isValidDrawMode(mode), GL_INVALID_ENUM);
     SET_ERROR_IF(end < start, GL_INVALID_VALUE);
@@ -4882,6 +6276,7 @@ void GL2Encoder::s_glDrawRangeElements(void* self, GLenum mode, GLuint start, GL
     // caching previous results.
     if (ctx->m_state->currentIndexVbo() != 0) {
         buf = ctx->m_shared->getBufferData(ctx->m_state->currentIndexVbo());
+        ctx->ensureBufferShadow(GL_ELEMENT_ARRAY_BUFFER, buf);
         ALOGV("%s: current index vbo: %p len %zu count %zu\n", __func__, buf, buf->m_fixedBuffer.size(), (size_t)count);
         offset = (GLintptr)indices;
         void* oldIndices = (void*)indices;
@@ -4915,7 +6310,7 @@ void GL2Encoder::s_glDrawRangeElements(void* self, GLenum mode, GLuint start, GL
         if (!has_client_vertex_arrays) {
             ctx->sendVertexAttributes(0, maxIndex + 1, false);
             ctx->doBindBufferEncodeCached(GL_ELEMENT_ARRAY_BUFFER, ctx->m_state->currentIndexVbo());
-            ctx->glDrawElementsOffset(ctx, mode, count, type, offset);
+            ctx->encodeBufferDrawElements(mode, count, type, offset);
             ctx->flushDrawCall();
             adjustIndices = false;
         } else {
@@ -4923,15 +6318,10 @@ void GL2Encoder::s_glDrawRangeElements(void* self, GLenum mode, GLuint start, GL
         }
     }
     if (adjustIndices) {
-        void *adjustedIndices =
-            ctx->recenterIndices(indices,
-                                 type,
-                                 count,
-                                 minIndex);
-
         if (has_indirect_arrays || 1) {
             ctx->sendVertexAttributes(minIndex, maxIndex - minIndex + 1, true);
-            ctx->glDrawElementsData(ctx, mode, count, type, adjustedIndices, count * glSizeof(type));
+            ctx->encodeDrawElementsData(OP_glDrawElementsData, mode, count, type,
+                                        indices, minIndex);
             ctx->m_stream->flush();
             // XXX - OPTIMIZATION (see the other else branch) should be implemented
             if(!has_indirect_arrays) {
@@ -5056,16 +6446,230 @@ GL_INVALID_OPERATION is generated if the readbuffer of the currently bound frame
             format, type, fbo_format_info.tex_type),
         GL_INVALID_OPERATION);
 
-    if (ctx->boundBuffer(GL_PIXEL_PACK_BUFFER)) {
+    const GLuint packBuffer = ctx->boundBuffer(GL_PIXEL_PACK_BUFFER);
+    if (packBuffer) {
+        const bool wasDirty = ctx->m_state->isBufferHostMapDirty(packBuffer);
         ctx->glReadPixelsOffsetAEMU(
                 ctx, x, y, width, height,
                 format, type, (uintptr_t)pixels);
+        ctx->m_state->postReadPixels();
+        if (ctx->m_asyncReadPixels) {
+            ctx->prefetchPixelPackBuffer(
+                packBuffer, wasDirty, (uintptr_t)pixels,
+                ctx->m_state->pboNeededDataSize(width, height, 1, format, type, 1));
+        }
     } else {
         ctx->m_glReadPixels_enc(
                 ctx, x, y, width, height,
                 format, type, pixels);
+        ctx->m_state->postReadPixels();
+    }
+}
+
+// Queues a host-to-guest copy of what glReadPixels just wrote to the pack
+// buffer and kicks the stream, then returns without waiting. The copy is
+// finished at the next map of the buffer, usually for free because a
+// fence wait or another reply has come back in the meantime. The guest
+// shadow is only trusted while nothing else writes the buffer on the
+// host, which the client state's host map dirty bit tracks.
+bool GL2Encoder::shouldShadowBuffer(GLenum target, const BufferData* buf) const {
+    return !m_lazyBufferShadows ||
+           target == GL_ELEMENT_ARRAY_BUFFER ||
+           (buf && buf->m_shadowed);
+}
+
+void GL2Encoder::ensureBufferShadow(GLenum target, BufferData* buf) {
+    if (!buf || buf->m_shadowed) return;
+
+    // Whatever the guest uploaded is only on the host, so read it back once.
+    buf->m_fixedBuffer.resize(buf->m_size);
+    buf->m_shadowMemory.set(buf->m_fixedBuffer.size());
+    if (buf->m_size > 0) {
+        glMapBufferRangeAEMU(this, target, 0, buf->m_size, GL_MAP_READ_BIT,
+                             buf->m_fixedBuffer.data());
+    }
+    m_state->onHostMappedBuffer(target);
+    buf->m_indexRangeCache.clear();
+    buf->m_indexBlockSummary.clear();
+    buf->m_shadowed = true;
+}
+
+void GL2Encoder::prefetchPixelPackBuffer(GLuint bufferId, bool wasDirty,
+                                         GLintptr offset, GLsizeiptr size) {
+    BufferData* buf = m_shared->getBufferData(bufferId);
+    if (!buf || !buf->m_shadowed || buf->m_mapped || offset >= buf->m_size) return;
+    if (!hasExtension("ANDROID_EMU_dma_v2")) return;
+
+    m_shared->freeRetiredReadbackDma(m_stream, m_stream->readbackCount());
+
+    if (!buf->m_readbackDma.get().mapped_addr) {
+        const int PAGE_BITS = 12;
+        const GLsizeiptr alignedSize =
+            (buf->m_size + (1 << PAGE_BITS) - 1) & ~((1 << PAGE_BITS) - 1);
+        goldfish_dma_context region;
+        if (goldfish_dma_create_region(alignedSize, &region)) return;
+        if (!goldfish_dma_map(&region)) {
+            goldfish_dma_free(&region);
+            return;
+        }
+        buf->m_readbackDma.reset(&region);
+    }
+
+    const uint64_t hostWrites = *m_shared->getBufferHostWrites();
+    if (wasDirty || buf->m_readbackRanges.size() >= kMaxReadbackRanges ||
+        (!buf->m_readbackRanges.empty() && buf->m_readbackHostWrites != hostWrites)) {
+        // The shadow is stale outside this read too, or the ranges queued
+        // before may be, so fetch everything.
+        buf->m_readbackRanges.clear();
+        offset = 0;
+        size = buf->m_size;
+    } else {
+        size = std::min(size, buf->m_size - offset);
+    }
+
+    glMapBufferRangeDMA(this, GL_PIXEL_PACK_BUFFER, offset, size, GL_MAP_READ_BIT,
+                        goldfish_dma_guest_paddr(&buf->m_readbackDma.get()) + offset);
+    buf->m_readbackRanges.emplace_back(offset, size);
+    buf->m_readbackStream = m_stream;
+    buf->m_readbackSerial = m_stream->readbackCount();
+    buf->m_readbackHostWrites = hostWrites;
+
+    m_state->setBufferHostMapDirty(bufferId, false /* not dirty */);
+    if (m_state->isBufferHostMapDirty(bufferId)) {
+        // This build does not track host writes to buffers.
+        buf->m_readbackRanges.clear();
+    }
+
+    m_stream->flush();
+}
+
+// Copies the prefetched ranges into the guest shadow once the host is
+// known to have written them.
+void GL2Encoder::completeBufferReadback(GLuint bufferId, BufferData* buf) {
+    if (buf->m_readbackStream != m_stream ||
+        buf->m_readbackHostWrites != *m_shared->getBufferHostWrites() ||
+        m_state->isBufferHostMapDirty(bufferId)) {
+        // Queued on another thread's stream, which this one cannot wait
+        // for, or a buffer may have been written on the host since, by
+        // this context or another one in the share group.
+        forgetBufferReadback(bufferId, buf);
+        return;
+    }
+
+    if (m_stream->readbackCount() == buf->m_readbackSerial) {
+        syncWithHost();
+    }
+
+    const char* src = reinterpret_cast<const char*>(buf->m_readbackDma.get().mapped_addr);
+    for (const auto& range : buf->m_readbackRanges) {
+        memcpy(&buf->m_fixedBuffer[range.first], src + range.first, range.second);
+    }
+    buf->m_readbackRanges.clear();
+}
+
+void GL2Encoder::forgetBufferReadback(GLuint bufferId, BufferData* buf) {
+    if (!buf || buf->m_readbackRanges.empty()) return;
+    buf->m_readbackRanges.clear();
+    m_state->setBufferHostMapDirty(bufferId, true /* dirty */);
+}
+
+void GL2Encoder::sendPersistentWrites(bool coherentOnly) {
+    m_shared->forEachPersistentMapping([this, coherentOnly](GLuint bufferId, BufferData* buf) {
+        if (buf->m_persistentSent.empty()) return;
+        if (coherentOnly && !(buf->m_mappedAccess & GL_MAP_COHERENT_BIT_EXT)) return;
+        sendPersistentWrites(bufferId, buf);
+    });
+}
+
+// Compares the mapped range against what was last sent, 64 bytes at a
+// time, and sends each run of changed blocks trimmed to the bytes that
+// actually differ, so that host writes next to them are left alone.
+void GL2Encoder::sendPersistentWrites(GLuint bufferId, BufferData* buf) {
+    static constexpr size_t kBlockSize = 64;
+    const char* mapped = &buf->m_fixedBuffer[buf->m_mappedOffset];
+    char* sent = buf->m_persistentSent.data();
+    const size_t size = buf->m_persistentSent.size();
+
+    bool rebound = false;
+    size_t pos = 0;
+    while (pos < size) {
+        size_t n = MIN(kBlockSize, size - pos);
+        if (!memcmp(mapped + pos, sent + pos, n)) {
+            pos += n;
+            continue;
+        }
+
+        size_t begin = pos;
+        size_t end = pos + n;
+        while (end < size) {
+            n = MIN(kBlockSize, size - end);
+            if (!memcmp(mapped + end, sent + end, n)) break;
+            end += n;
+        }
+        while (mapped[begin] == sent[begin]) ++begin;
+        while (mapped[end - 1] == sent[end - 1]) --end;
+
+        sendBufferRange(bufferId, buf, buf->m_mappedOffset + begin, end - begin);
+        memcpy(sent + begin, mapped + begin, end - begin);
+        rebound = true;
+        pos = end;
+    }
+    if (rebound) {
+        doBindBufferEncodeCached(GL_ARRAY_BUFFER, m_state->currentArrayVbo());
+    }
+}
+
+// Reads persistent read mappings back from the host, after the app has
+// waited for the commands that write them.
+void GL2Encoder::refreshPersistentReads() {
+    bool rebound = false;
+    m_shared->forEachPersistentMapping([this, &rebound](GLuint bufferId, BufferData* buf) {
+        if (!(buf->m_mappedAccess & GL_MAP_READ_BIT)) return;
+
+        char* bits = &buf->m_fixedBuffer[buf->m_mappedOffset];
+        doBindBufferEncodeCached(GL_ARRAY_BUFFER, bufferId);
+        rebound = true;
+        glMapBufferRangeAEMU(this, GL_ARRAY_BUFFER, buf->m_mappedOffset, buf->m_mappedLength,
+                             GL_MAP_READ_BIT, bits);
+        if (!buf->m_persistentSent.empty()) {
+            memcpy(buf->m_persistentSent.data(), bits, buf->m_mappedLength);
+        }
+    });
+    if (rebound) {
+        doBindBufferEncodeCached(GL_ARRAY_BUFFER, m_state->currentArrayVbo());
+    }
+}
+
+// Writes a range of the guest shadow to the host, going through the
+// GL_ARRAY_BUFFER binding because the app may not have the buffer bound.
+// The caller restores the binding.
+void GL2Encoder::sendBufferRange(GLuint bufferId, BufferData* buf,
+                                 GLintptr offset, GLsizeiptr length) {
+    // Persistent writes are never synchronized by the implementation.
+    const GLbitfield access =
+        GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+    doBindBufferEncodeCached(GL_ARRAY_BUFFER, bufferId);
+    if (m_hasAsyncUnmapBuffer) {
+        encodeFlushMappedBufferRange2(GL_ARRAY_BUFFER, offset, length, access,
+                                      &buf->m_fixedBuffer[offset]);
+    } else {
+        glFlushMappedBufferRangeAEMU(this, GL_ARRAY_BUFFER, offset, length, access,
+                                     &buf->m_fixedBuffer[offset]);
+    }
+
+    buf->m_indexRangeCache.invalidateRange(offset, length);
+    buf->m_indexBlockSummary.invalidateRange(offset, length);
+}
+
+// Waits for the host to decode everything encoded so far. glGetError is
+// the cheapest call with a reply; an error it returns is kept for the
+// app's next glGetError.
+void GL2Encoder::syncWithHost() {
+    const GLenum hostError = readHostError();
+    if (!m_noHostError && hostError != GL_NO_ERROR && getError() == GL_NO_ERROR) {
+        setError(hostError);
     }
-    ctx->m_state->postReadPixels();
 }
 
 // Track enabled state for some things like:
@@ -5073,7 +6677,7 @@ GL_INVALID_OPERATION is generated if the readbuffer of the currently bound frame
 void GL2Encoder::s_glEnable(void* self, GLenum what) {
     GL2Encoder *ctx = (GL2Encoder *)self;
 
-	SET_ERROR_IF(!GLESv2Validation::allowedEnable(ctx->majorVersion(), ctx->minorVersion(), what), GL_INVALID_ENUM);
+	HOST_VALIDATED_ERROR_IF(!GLESv2Validation::allowedEnable(ctx->majorVersion(), ctx->minorVersion(), what), GL_INVALID_ENUM);
     if (!ctx->m_state) return;
 
     switch (what) {
@@ -5085,13 +6689,14 @@ void GL2Encoder::s_glEnable(void* self, GLenum what) {
         break;
     }
 
+    if (ctx->m_state->stateShadow().skipEnable(what, true)) return;
     ctx->m_glEnable_enc(ctx, what);
 }
 
 void GL2Encoder::s_glDisable(void* self, GLenum what) {
     GL2Encoder *ctx = (GL2Encoder *)self;
 
-	SET_ERROR_IF(!GLESv2Validation::allowedEnable(ctx->majorVersion(), ctx->minorVersion(), what), GL_INVALID_ENUM);
+	HOST_VALIDATED_ERROR_IF(!GLESv2Validation::allowedEnable(ctx->majorVersion(), ctx->minorVersion(), what), GL_INVALID_ENUM);
     if (!ctx->m_state) return;
 
     switch (what) {
@@ -5103,6 +6708,7 @@ void GL2Encoder::s_glDisable(void* self, GLenum what) {
         break;
     }
 
+    if (ctx->m_state->stateShadow().skipEnable(what, false)) return;
     ctx->m_glDisable_enc(ctx, what);
 }
 
@@ -5365,12 +6971,14 @@ void GL2Encoder::s_glDeleteSamplers(void* self, GLsizei n, const GLuint* sampler
 
 GLsync GL2Encoder::s_glFenceSync(void* self, GLenum condition, GLbitfield flags) {
     GL2Encoder *ctx = (GL2Encoder *)self;
+    ctx->resolvePendingProgramLinks();
+    ctx->flushPersistentMappings();
     RET_AND_SET_ERROR_IF(condition != GL_SYNC_GPU_COMMANDS_COMPLETE, GL_INVALID_ENUM, 0);
     RET_AND_SET_ERROR_IF(flags != 0, GL_INVALID_VALUE, 0);
     uint64_t syncHandle = ctx->glFenceSyncAEMU(ctx, condition, flags);
 
     GLsync res = (GLsync)(uintptr_t)syncHandle;
-    GLClientState::onFenceCreated(res);
+    GLClientState::onFenceCreated(res, ctx->m_state->fenceTimeline());
     return res;
 }
 
@@ -5378,7 +6986,22 @@ GLenum GL2Encoder::s_glClientWaitSync(void* self, GLsync wait_on, GLbitfield fla
     GL2Encoder *ctx = (GL2Encoder *)self;
     RET_AND_SET_ERROR_IF(!GLClientState::fenceExists(wait_on), GL_INVALID_VALUE, GL_WAIT_FAILED);
     RET_AND_SET_ERROR_IF(flags && !(flags & GL_SYNC_FLUSH_COMMANDS_BIT), GL_INVALID_VALUE, GL_WAIT_FAILED);
-    return ctx->glClientWaitSyncAEMU(ctx, (uint64_t)(uintptr_t)wait_on, flags, timeout);
+    ctx->flushPersistentMappings();
+    GLenum res;
+    if (GLClientState::fenceSignaled(wait_on)) {
+        // Known from an earlier wait or query, not observed by this call.
+        res = GL_CONDITION_SATISFIED;
+    } else {
+        res = ctx->glClientWaitSyncAEMU(ctx, (uint64_t)(uintptr_t)wait_on, flags, timeout);
+        if (res == GL_ALREADY_SIGNALED || res == GL_CONDITION_SATISFIED) {
+            GLClientState::onFenceSignaled(wait_on);
+        }
+    }
+    if (ctx->m_shared->hasPersistentMappings() &&
+        (res == GL_ALREADY_SIGNALED || res == GL_CONDITION_SATISFIED)) {
+        ctx->refreshPersistentReads();
+    }
+    return res;
 }
 
 void GL2Encoder::s_glWaitSync(void* self, GLsync wait_on, GLbitfield flags, GLuint64 timeout) {
@@ -5411,7 +7034,20 @@ void GL2Encoder::s_glGetSynciv(void* self, GLsync sync, GLenum pname, GLsizei bu
     SET_ERROR_IF(bufSize < 0, GL_INVALID_VALUE);
     SET_ERROR_IF(!GLClientState::fenceExists(sync), GL_INVALID_VALUE);
 
-    return ctx->glGetSyncivAEMU(ctx, (uint64_t)(uintptr_t)sync, pname, bufSize, length, values);
+    if (pname == GL_SYNC_STATUS && GLClientState::fenceSignaled(sync)) {
+        if (bufSize > 0) {
+            values[0] = GL_SIGNALED;
+        }
+        if (length) {
+            *length = bufSize > 0 ? 1 : 0;
+        }
+        return;
+    }
+
+    ctx->glGetSyncivAEMU(ctx, (uint64_t)(uintptr_t)sync, pname, bufSize, length, values);
+    if (pname == GL_SYNC_STATUS && bufSize > 0 && values[0] == GL_SIGNALED) {
+        GLClientState::onFenceSignaled(sync);
+    }
 }
 
 #define LIMIT_CASE(target, lim) \
@@ -5530,6 +7166,13 @@ void GL2Encoder::s_glGetBooleani_v(void* self, GLenum param, GLuint index, GLboo
 
 void GL2Encoder::s_glGetShaderiv(void* self, GLuint shader, GLenum pname, GLint* params) {
     GL2Encoder *ctx = (GL2Encoder *)self;
+    if (pname == GL_COMPLETION_STATUS_KHR && ctx->m_extensions.parallelShaderCompileKHR) {
+        VALIDATE_SHADER_NAME(shader);
+        // Commands after the compile wait for it on the host, so asking
+        // never stalls for longer than the query itself.
+        *params = GL_TRUE;
+        return;
+    }
     ctx->m_glGetShaderiv_enc(self, shader, pname, params);
 
     SET_ERROR_IF(!GLESv2Validation::allowedGetShader(pname), GL_INVALID_ENUM);
@@ -5641,18 +7284,22 @@ GLuint GL2Encoder::s_glCreateShaderProgramv(void* self, GLenum shaderType, GLsiz
 void GL2Encoder::s_glProgramUniform1f(void* self, GLuint program, GLint location, GLfloat v0)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform1f_enc(self, program, location, v0);
 }
 
 void GL2Encoder::s_glProgramUniform1fv(void* self, GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform1fv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform1i(void* self, GLuint program, GLint location, GLint v0)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->resolveProgramLink(program);
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform1i_enc(self, program, location, v0);
 
     GLClientState* state = ctx->m_state;
@@ -5662,7 +7309,7 @@ void GL2Encoder::s_glProgramUniform1i(void* self, GLuint program, GLint location
     if (shared->setSamplerUniform(program, location, v0, &target)) {
         GLenum origActiveTexture = state->getActiveTextureUnit();
         if (ctx->updateHostTexture2DBinding(GL_TEXTURE0 + v0, target)) {
-            ctx->m_glActiveTexture_enc(self, origActiveTexture);
+            ctx->encodeActiveTexture(origActiveTexture);
         }
         state->setActiveTextureUnit(origActiveTexture);
     }
@@ -5671,12 +7318,15 @@ void GL2Encoder::s_glProgramUniform1i(void* self, GLuint program, GLint location
 void GL2Encoder::s_glProgramUniform1iv(void* self, GLuint program, GLint location, GLsizei count, const GLint *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform1iv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform1ui(void* self, GLuint program, GLint location, GLuint v0)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->resolveProgramLink(program);
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform1ui_enc(self, program, location, v0);
 
     GLClientState* state = ctx->m_state;
@@ -5686,7 +7336,7 @@ void GL2Encoder::s_glProgramUniform1ui(void* self, GLuint program, GLint locatio
     if (shared->setSamplerUniform(program, location, v0, &target)) {
         GLenum origActiveTexture = state->getActiveTextureUnit();
         if (ctx->updateHostTexture2DBinding(GL_TEXTURE0 + v0, target)) {
-            ctx->m_glActiveTexture_enc(self, origActiveTexture);
+            ctx->encodeActiveTexture(origActiveTexture);
         }
         state->setActiveTextureUnit(origActiveTexture);
     }
@@ -5695,168 +7345,196 @@ void GL2Encoder::s_glProgramUniform1ui(void* self, GLuint program, GLint locatio
 void GL2Encoder::s_glProgramUniform1uiv(void* self, GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform1uiv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform2f(void* self, GLuint program, GLint location, GLfloat v0, GLfloat v1)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform2f_enc(self, program, location, v0, v1);
 }
 
 void GL2Encoder::s_glProgramUniform2fv(void* self, GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform2fv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform2i(void* self, GLuint program, GLint location, GLint v0, GLint v1)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform2i_enc(self, program, location, v0, v1);
 }
 
 void GL2Encoder::s_glProgramUniform2iv(void* self, GLuint program, GLint location, GLsizei count, const GLint *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform2iv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform2ui(void* self, GLuint program, GLint location, GLint v0, GLuint v1)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform2ui_enc(self, program, location, v0, v1);
 }
 
 void GL2Encoder::s_glProgramUniform2uiv(void* self, GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform2uiv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform3f(void* self, GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform3f_enc(self, program, location, v0, v1, v2);
 }
 
 void GL2Encoder::s_glProgramUniform3fv(void* self, GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform3fv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform3i(void* self, GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform3i_enc(self, program, location, v0, v1, v2);
 }
 
 void GL2Encoder::s_glProgramUniform3iv(void* self, GLuint program, GLint location, GLsizei count, const GLint *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform3iv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform3ui(void* self, GLuint program, GLint location, GLint v0, GLint v1, GLuint v2)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform3ui_enc(self, program, location, v0, v1, v2);
 }
 
 void GL2Encoder::s_glProgramUniform3uiv(void* self, GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform3uiv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform4f(void* self, GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform4f_enc(self, program, location, v0, v1, v2, v3);
 }
 
 void GL2Encoder::s_glProgramUniform4fv(void* self, GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform4fv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform4i(void* self, GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform4i_enc(self, program, location, v0, v1, v2, v3);
 }
 
 void GL2Encoder::s_glProgramUniform4iv(void* self, GLuint program, GLint location, GLsizei count, const GLint *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform4iv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniform4ui(void* self, GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLuint v3)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, 1);
     ctx->m_glProgramUniform4ui_enc(self, program, location, v0, v1, v2, v3);
 }
 
 void GL2Encoder::s_glProgramUniform4uiv(void* self, GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniform4uiv_enc(self, program, location, count, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix2fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix2fv_enc(self, program, location, count, transpose, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix2x3fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix2x3fv_enc(self, program, location, count, transpose, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix2x4fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix2x4fv_enc(self, program, location, count, transpose, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix3fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix3fv_enc(self, program, location, count, transpose, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix3x2fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix3x2fv_enc(self, program, location, count, transpose, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix3x4fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix3x4fv_enc(self, program, location, count, transpose, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix4fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix4fv_enc(self, program, location, count, transpose, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix4x2fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix4x2fv_enc(self, program, location, count, transpose, value);
 }
 
 void GL2Encoder::s_glProgramUniformMatrix4x3fv(void* self, GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->m_shared->forgetUniformValues(program, location, count);
     ctx->m_glProgramUniformMatrix4x3fv_enc(self, program, location, count, transpose, value);
 }
 
@@ -5866,6 +7544,11 @@ void GL2Encoder::s_glProgramParameteri(void* self, GLuint program, GLenum pname,
     SET_ERROR_IF(pname != GL_PROGRAM_BINARY_RETRIEVABLE_HINT && pname != GL_PROGRAM_SEPARABLE, GL_INVALID_ENUM);
     SET_ERROR_IF(value != GL_FALSE && value != GL_TRUE, GL_INVALID_VALUE);
     ctx->m_glProgramParameteri_enc(self, program, pname, value);
+
+    if (ProgramLinkCache::get().isEnabled()) {
+        ctx->m_shared->addProgramLinkInput(
+            program, "p" + std::to_string(pname) + ':' + std::to_string(value) + '\n');
+    }
 }
 
 void GL2Encoder::s_glUseProgramStages(void *self, GLuint pipeline, GLbitfield stages, GLuint program)
@@ -5877,6 +7560,7 @@ void GL2Encoder::s_glUseProgramStages(void *self, GLuint pipeline, GLbitfield st
     SET_ERROR_IF(!pipeline, GL_INVALID_OPERATION);
     SET_ERROR_IF(program && !shared->isShaderOrProgramObject(program), GL_INVALID_VALUE);
     SET_ERROR_IF(program && !shared->isProgram(program), GL_INVALID_OPERATION);
+    if (program) ctx->resolveProgramLink(program);
 
     ctx->m_glUseProgramStages_enc(self, pipeline, stages, program);
     state->associateProgramWithPipeline(program, pipeline);
@@ -5907,12 +7591,10 @@ void GL2Encoder::s_glBindProgramPipeline(void* self, GLuint pipeline)
         return;
     }
 
-    GLClientState::ProgramPipelineIterator it = state->programPipelineBegin();
-    for (; it != state->programPipelineEnd(); ++it) {
-        if (it->second == pipeline) {
-            ctx->updateHostTexture2DBindingsFromProgramData(it->first);
-        }
-    }
+    state->forEachProgramInPipeline(pipeline, [ctx](GLuint program) {
+        ctx->resolveProgramLink(program);
+        ctx->updateHostTexture2DBindingsFromProgramData(program);
+    });
 }
 
 void GL2Encoder::s_glGetProgramResourceiv(void* self, GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei bufSize, GLsizei * length, GLint * params) {
@@ -5924,17 +7606,14 @@ void GL2Encoder::s_glGetProgramResourceiv(void* self, GLuint program, GLenum pro
     }
 
     // Avoid modifying |name| if |*length| < bufSize.
-    GLint* intermediate = new GLint[bufSize];
-    GLsizei* myLength = length ? length : new GLsizei;
-    bool needFreeLength = length == NULL;
+    SmallFixedVector<GLint, 256> intermediate;
+    intermediate.resize_noinit(bufSize);
+    GLsizei localLength = 0;
+    GLsizei* myLength = length ? length : &localLength;
 
-    ctx->m_glGetProgramResourceiv_enc(self, program, programInterface, index, propCount, props, bufSize, myLength, intermediate);
+    ctx->m_glGetProgramResourceiv_enc(self, program, programInterface, index, propCount, props, bufSize, myLength, intermediate.data());
     GLsizei writtenInts = *myLength;
-    memcpy(params, intermediate, writtenInts * sizeof(GLint));
-
-    delete [] intermediate;
-    if (needFreeLength)
-        delete myLength;
+    memcpy(params, intermediate.data(), writtenInts * sizeof(GLint));
 }
 
 GLuint GL2Encoder::s_glGetProgramResourceIndex(void* self, GLuint program, GLenum programInterface, const char* name) {
@@ -5956,17 +7635,14 @@ void GL2Encoder::s_glGetProgramResourceName(void* self, GLuint program, GLenum p
     }
 
     // Avoid modifying |name| if |*length| < bufSize.
-    char* intermediate = new char[bufSize];
-    GLsizei* myLength = length ? length : new GLsizei;
-    bool needFreeLength = length == NULL;
+    SmallFixedVector<char, 256> intermediate;
+    intermediate.resize_noinit(bufSize);
+    GLsizei localLength = 0;
+    GLsizei* myLength = length ? length : &localLength;
 
-    ctx->m_glGetProgramResourceName_enc(self, program, programInterface, index, bufSize, myLength, intermediate);
+    ctx->m_glGetProgramResourceName_enc(self, program, programInterface, index, bufSize, myLength, intermediate.data());
     GLsizei writtenStrLen = *myLength;
-    memcpy(name, intermediate, writtenStrLen + 1);
-
-    delete [] intermediate;
-    if (needFreeLength)
-        delete myLength;
+    memcpy(name, intermediate.data(), writtenStrLen + 1);
 }
 
 void GL2Encoder::s_glGetProgramPipelineInfoLog(void* self, GLuint pipeline, GLsizei bufSize, GLsizei* length, GLchar* infoLog) {
@@ -5978,17 +7654,14 @@ void GL2Encoder::s_glGetProgramPipelineInfoLog(void* self, GLuint pipeline, GLsi
     }
 
     // Avoid modifying |infoLog| if |*length| < bufSize.
-    GLchar* intermediate = new GLchar[bufSize];
-    GLsizei* myLength = length ? length : new GLsizei;
-    bool needFreeLength = length == NULL;
+    SmallFixedVector<GLchar, 256> intermediate;
+    intermediate.resize_noinit(bufSize);
+    GLsizei localLength = 0;
+    GLsizei* myLength = length ? length : &localLength;
 
-    ctx->m_glGetProgramPipelineInfoLog_enc(self, pipeline, bufSize, myLength, intermediate);
+    ctx->m_glGetProgramPipelineInfoLog_enc(self, pipeline, bufSize, myLength, intermediate.data());
     GLsizei writtenStrLen = *myLength;
-    memcpy(infoLog, intermediate, writtenStrLen + 1);
-
-    delete [] intermediate;
-    if (needFreeLength)
-        delete myLength;
+    memcpy(infoLog, intermediate.data(), writtenStrLen + 1);
 }
 
 void GL2Encoder::s_glVertexAttribFormat(void* self, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
@@ -6051,6 +7724,7 @@ void GL2Encoder::s_glBindVertexBuffer(void* self, GLuint bindingindex, GLuint bu
 
 void GL2Encoder::s_glDrawArraysIndirect(void* self, GLenum mode, const void* indirect) {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->syncPersistentMappings();
     GLClientState* state = ctx->m_state;
 
     bool hasClientArrays = false;
@@ -6062,23 +7736,18 @@ void GL2Encoder::s_glDrawArraysIndirect(void* self, GLenum mode, const void* ind
     SET_ERROR_IF(!ctx->boundBuffer(GL_DRAW_INDIRECT_BUFFER), GL_INVALID_OPERATION);
     SET_ERROR_IF(ctx->m_state->checkFramebufferCompleteness(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE, GL_INVALID_FRAMEBUFFER_OPERATION);
 
-    GLuint indirectStructSize = glUtilsIndirectStructSize(INDIRECT_COMMAND_DRAWARRAYS);
-    if (ctx->boundBuffer(GL_DRAW_INDIRECT_BUFFER)) {
-        // BufferData* buf = ctx->getBufferData(target);
-        // if (buf) {
-        //     SET_ERROR_IF((GLuint)(uintptr_t)indirect + indirectStructSize > buf->m_size, GL_INVALID_VALUE);
-        // }
-        ctx->glDrawArraysIndirectOffsetAEMU(ctx, mode, (uintptr_t)indirect);
-    } else {
-        // Client command structs are technically allowed in desktop OpenGL, but not in ES.
-        // This is purely for debug/dev purposes.
-        ctx->glDrawArraysIndirectDataAEMU(ctx, mode, indirect, indirectStructSize);
-    }
+    const uintptr_t offset = (uintptr_t)indirect;
+    SET_ERROR_IF(offset % sizeof(GLuint), GL_INVALID_VALUE);
+    SET_ERROR_IF(!ctx->indirectCommandInBuffer(GL_DRAW_INDIRECT_BUFFER, offset,
+                     glUtilsIndirectStructSize(INDIRECT_COMMAND_DRAWARRAYS)),
+                 GL_INVALID_OPERATION);
+    ctx->glDrawArraysIndirectOffsetAEMU(ctx, mode, offset);
     ctx->m_state->postDraw();
 }
 
 void GL2Encoder::s_glDrawElementsIndirect(void* self, GLenum mode, GLenum type, const void* indirect) {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->syncPersistentMappings();
 
     GLClientState* state = ctx->m_state;
 
@@ -6093,18 +7762,12 @@ void GL2Encoder::s_glDrawElementsIndirect(void* self, GLenum mode, GLenum type,
     SET_ERROR_IF(ctx->m_state->getTransformFeedbackActiveUnpaused(), GL_INVALID_OPERATION);
     SET_ERROR_IF(ctx->m_state->checkFramebufferCompleteness(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE, GL_INVALID_FRAMEBUFFER_OPERATION);
 
-    GLuint indirectStructSize = glUtilsIndirectStructSize(INDIRECT_COMMAND_DRAWELEMENTS);
-    if (ctx->boundBuffer(GL_DRAW_INDIRECT_BUFFER)) {
-        // BufferData* buf = ctx->getBufferData(target);
-        // if (buf) {
-        //     SET_ERROR_IF((GLuint)(uintptr_t)indirect + indirectStructSize > buf->m_size, GL_INVALID_VALUE);
-        // }
-        ctx->glDrawElementsIndirectOffsetAEMU(ctx, mode, type, (uintptr_t)indirect);
-    } else {
-        // Client command structs are technically allowed in desktop OpenGL, but not in ES.
-        // This is purely for debug/dev purposes.
-        ctx->glDrawElementsIndirectDataAEMU(ctx, mode, type, indirect, indirectStructSize);
-    }
+    const uintptr_t offset = (uintptr_t)indirect;
+    SET_ERROR_IF(offset % sizeof(GLuint), GL_INVALID_VALUE);
+    SET_ERROR_IF(!ctx->indirectCommandInBuffer(GL_DRAW_INDIRECT_BUFFER, offset,
+                     glUtilsIndirectStructSize(INDIRECT_COMMAND_DRAWELEMENTS)),
+                 GL_INVALID_OPERATION);
+    ctx->glDrawElementsIndirectOffsetAEMU(ctx, mode, type, offset);
     ctx->m_state->postDraw();
 }
 
@@ -6147,6 +7810,7 @@ void GL2Encoder::s_glReadnPixelsEXT(void* self, GLint x, GLint y, GLsizei width,
 void GL2Encoder::s_glGetnUniformfvEXT(void *self, GLuint program, GLint location,
         GLsizei bufSize, GLfloat* params) {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->resolveProgramLink(program);
     SET_ERROR_IF(bufSize < glSizeof(glesv2_enc::uniformType(self, program,
         location)), GL_INVALID_OPERATION);
     s_glGetUniformfv(self, program, location, params);
@@ -6155,6 +7819,7 @@ void GL2Encoder::s_glGetnUniformfvEXT(void *self, GLuint program, GLint location
 void GL2Encoder::s_glGetnUniformivEXT(void *self, GLuint program, GLint location,
         GLsizei bufSize, GLint* params) {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->resolveProgramLink(program);
     SET_ERROR_IF(bufSize < glSizeof(glesv2_enc::uniformType(self, program,
         location)), GL_INVALID_OPERATION);
     s_glGetUniformiv(self, program, location, params);
@@ -6196,16 +7861,30 @@ void GL2Encoder::s_glInvalidateSubFramebuffer(void* self, GLenum target, GLsizei
 
 void GL2Encoder::s_glDispatchCompute(void* self, GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    ctx->syncPersistentMappings();
     ctx->m_glDispatchCompute_enc(ctx, num_groups_x, num_groups_y, num_groups_z);
     ctx->m_state->postDispatchCompute();
 }
 
 void GL2Encoder::s_glDispatchComputeIndirect(void* self, GLintptr indirect) {
     GL2Encoder *ctx = (GL2Encoder*)self;
+    SET_ERROR_IF(indirect < 0 || indirect % sizeof(GLuint), GL_INVALID_VALUE);
+    SET_ERROR_IF(!ctx->indirectCommandInBuffer(GL_DISPATCH_INDIRECT_BUFFER, indirect,
+                     3 * sizeof(GLuint)),
+                 GL_INVALID_OPERATION);
+    ctx->syncPersistentMappings();
     ctx->m_glDispatchComputeIndirect_enc(ctx, indirect);
     ctx->m_state->postDispatchCompute();
 }
 
+void GL2Encoder::s_glMemoryBarrier(void* self, GLbitfield barriers) {
+    GL2Encoder *ctx = (GL2Encoder*)self;
+    if (barriers & GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT_EXT) {
+        ctx->flushPersistentMappings();
+    }
+    ctx->m_glMemoryBarrier_enc(ctx, barriers);
+}
+
 void GL2Encoder::s_glGenTransformFeedbacks(void* self, GLsizei n, GLuint* ids) {
     GL2Encoder *ctx = (GL2Encoder*)self;
     ctx->m_glGenTransformFeedbacks_enc(ctx, n, ids);
@@ -6370,6 +8049,23 @@ void GL2Encoder::s_glCompileShader(void* self, GLuint shader) {
     SET_ERROR_IF(!isShaderOrProgramObject && !isShader, GL_INVALID_VALUE);
 
     ctx->m_glCompileShader_enc(ctx, shader);
+
+    if (ProgramLinkCache::get().isEnabled()) {
+        ShaderData* shaderData = ctx->m_shared->getShaderData(shader);
+        if (shaderData) {
+            std::string sources;
+            for (const auto& source : shaderData->sources) {
+                sources += std::to_string(source.size()) + ':' + source;
+            }
+            shaderData->compiledDigest = ProgramLinkCache::digest(sources);
+        }
+    }
+}
+
+void GL2Encoder::s_glMaxShaderCompilerThreadsKHR(void* self, GLuint count) {
+    // Only a hint; the host compiles as it sees fit.
+    (void)self;
+    (void)count;
 }
 
 void GL2Encoder::s_glValidateProgram(void* self, GLuint program ) {
@@ -6387,6 +8083,7 @@ void GL2Encoder::s_glProgramBinary(void *self , GLuint program, GLenum binaryFor
 
     SET_ERROR_IF(~0 == binaryFormat, GL_INVALID_ENUM);
 
+    ctx->m_shared->clearUniformValues(program);
     ctx->m_glProgramBinary_enc(self, program, binaryFormat, binary, length);
 }
 
@@ -6461,6 +8158,7 @@ int GL2Encoder::s_glGetAttribLocation(void *self , GLuint program, const GLchar*
 
     RET_AND_SET_ERROR_IF(!isShaderOrProgramObject, GL_INVALID_VALUE, -1);
     RET_AND_SET_ERROR_IF(!isProgram, GL_INVALID_OPERATION, -1);
+    ctx->resolveProgramLink(program);
     RET_AND_SET_ERROR_IF(!ctx->m_shared->getProgramLinkStatus(program), GL_INVALID_OPERATION, -1);
 
     return ctx->m_glGetAttribLocation_enc(ctx, program, name);
@@ -6479,6 +8177,11 @@ void GL2Encoder::s_glBindAttribLocation(void *self , GLuint program, GLuint inde
 
     fprintf(stderr, "%s: bind attrib %u name %s\n", __func__, index, name);
     ctx->m_glBindAttribLocation_enc(ctx, program, index, name);
+
+    if (ProgramLinkCache::get().isEnabled() && name) {
+        ctx->m_shared->addProgramLinkInput(
+            program, "a" + std::to_string(index) + ':' + name + '\n');
+    }
 }
 
 // TODO-SLOW
@@ -6508,6 +8211,7 @@ void GL2Encoder::s_glGetTransformFeedbackVarying(void *self , GLuint program, GL
 void GL2Encoder::s_glScissor(void *self , GLint x, GLint y, GLsizei width, GLsizei height) {
     GL2Encoder* ctx = (GL2Encoder*)self;
     SET_ERROR_IF(width < 0 || height < 0, GL_INVALID_VALUE);
+    if (ctx->m_state->stateShadow().skipScissor(x, y, width, height)) return;
     ctx->m_glScissor_enc(ctx, x, y, width, height);
 }
 
@@ -6523,12 +8227,14 @@ void GL2Encoder::s_glDepthFunc(void *self , GLenum func) {
         (func != GL_GEQUAL) &&
         (func != GL_NOTEQUAL),
         GL_INVALID_ENUM);
+    if (ctx->m_state->stateShadow().skipDepthFunc(func)) return;
     ctx->m_glDepthFunc_enc(ctx, func);
 }
 
 void GL2Encoder::s_glViewport(void *self , GLint x, GLint y, GLsizei width, GLsizei height) {
     GL2Encoder* ctx = (GL2Encoder*)self;
     SET_ERROR_IF(width < 0 || height < 0, GL_INVALID_VALUE);
+    if (ctx->m_state->stateShadow().skipViewport(x, y, width, height)) return;
     ctx->m_glViewport_enc(ctx, x, y, width, height);
 }
 
@@ -6588,6 +8294,7 @@ void GL2Encoder::s_glBlendEquation(void *self , GLenum mode) {
     SET_ERROR_IF(
         !GLESv2Validation::allowedBlendEquation(mode),
         GL_INVALID_ENUM);
+    if (ctx->m_state->stateShadow().skipBlendEquation(mode, mode)) return;
     ctx->m_glBlendEquation_enc(ctx, mode);
 }
 
@@ -6597,6 +8304,7 @@ void GL2Encoder::s_glBlendEquationSeparate(void *self , GLenum modeRGB, GLenum m
         !GLESv2Validation::allowedBlendEquation(modeRGB) ||
         !GLESv2Validation::allowedBlendEquation(modeAlpha),
         GL_INVALID_ENUM);
+    if (ctx->m_state->stateShadow().skipBlendEquation(modeRGB, modeAlpha)) return;
     ctx->m_glBlendEquationSeparate_enc(ctx, modeRGB, modeAlpha);
 }
 
@@ -6606,6 +8314,7 @@ void GL2Encoder::s_glBlendFunc(void *self , GLenum sfactor, GLenum dfactor) {
         !GLESv2Validation::allowedBlendFunc(sfactor) ||
         !GLESv2Validation::allowedBlendFunc(dfactor),
         GL_INVALID_ENUM);
+    if (ctx->m_state->stateShadow().skipBlendFunc(sfactor, dfactor, sfactor, dfactor)) return;
     ctx->m_glBlendFunc_enc(ctx, sfactor, dfactor);
 }
 
@@ -6617,6 +8326,7 @@ void GL2Encoder::s_glBlendFuncSeparate(void *self , GLenum srcRGB, GLenum dstRGB
         !GLESv2Validation::allowedBlendFunc(srcAlpha) ||
         !GLESv2Validation::allowedBlendFunc(dstAlpha),
         GL_INVALID_ENUM);
+    if (ctx->m_state->stateShadow().skipBlendFunc(srcRGB, dstRGB, srcAlpha, dstAlpha)) return;
     ctx->m_glBlendFuncSeparate_enc(ctx, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
@@ -6625,6 +8335,7 @@ void GL2Encoder::s_glCullFace(void *self , GLenum mode) {
     SET_ERROR_IF(
         !GLESv2Validation::allowedCullFace(mode),
         GL_INVALID_ENUM);
+    if (ctx->m_state->stateShadow().skipCullFace(mode)) return;
     ctx->m_glCullFace_enc(ctx, mode);
 }
 
@@ -6633,12 +8344,14 @@ void GL2Encoder::s_glFrontFace(void *self , GLenum mode) {
     SET_ERROR_IF(
         !GLESv2Validation::allowedFrontFace(mode),
         GL_INVALID_ENUM);
+    if (ctx->m_state->stateShadow().skipFrontFace(mode)) return;
     ctx->m_glFrontFace_enc(ctx, mode);
 }
 
 void GL2Encoder::s_glLineWidth(void *self , GLfloat width) {
     GL2Encoder* ctx = (GL2Encoder*)self;
     SET_ERROR_IF(width <= 0.0f, GL_INVALID_VALUE);
+    if (ctx->m_state->stateShadow().skipLineWidth(width)) return;
     ctx->m_glLineWidth_enc(ctx, width);
 }
 
@@ -6723,6 +8436,15 @@ void GL2Encoder::s_glGetShaderPrecisionFormat(void *self , GLenum shadertype, GL
 
 void GL2Encoder::s_glGetProgramiv(void *self , GLuint program, GLenum pname, GLint* params) {
     GL2Encoder* ctx = (GL2Encoder*)self;
+    if (pname == GL_COMPLETION_STATUS_KHR && ctx->m_extensions.parallelShaderCompileKHR) {
+        bool isShaderOrProgramObject = ctx->m_shared->isShaderOrProgramObject(program);
+        bool isProgram = ctx->m_shared->isProgram(program);
+        SET_ERROR_IF(!isShaderOrProgramObject, GL_INVALID_VALUE);
+        SET_ERROR_IF(!isProgram, GL_INVALID_OPERATION);
+        // Answered without reading back a deferred link, as for shaders.
+        *params = GL_TRUE;
+        return;
+    }
     SET_ERROR_IF(!GLESv2Validation::allowedGetProgram(ctx->majorVersion(), ctx->minorVersion(), pname), GL_INVALID_ENUM);
     VALIDATE_PROGRAM_NAME(program);
     ctx->m_glGetProgramiv_enc(ctx, program, pname, params);
@@ -6792,14 +8514,14 @@ void GL2Encoder::s_glGetQueryObjectuiv(void *self , GLuint query, GLenum pname,
 
 GLboolean GL2Encoder::s_glIsEnabled(void *self , GLenum cap) {
     GL2Encoder* ctx = (GL2Encoder*)self;
-    RET_AND_SET_ERROR_IF(!GLESv2Validation::allowedEnable(ctx->majorVersion(), ctx->minorVersion(), cap), GL_INVALID_ENUM, 0);
+    HOST_VALIDATED_RET_AND_SET_ERROR_IF(!GLESv2Validation::allowedEnable(ctx->majorVersion(), ctx->minorVersion(), cap), GL_INVALID_ENUM, 0);
     return ctx->m_glIsEnabled_enc(ctx, cap);
 }
 
 void GL2Encoder::s_glHint(void *self , GLenum target, GLenum mode) {
     GL2Encoder* ctx = (GL2Encoder*)self;
-    SET_ERROR_IF(!GLESv2Validation::allowedHintTarget(target), GL_INVALID_ENUM);
-    SET_ERROR_IF(!GLESv2Validation::allowedHintMode(mode), GL_INVALID_ENUM);
+    HOST_VALIDATED_ERROR_IF(!GLESv2Validation::allowedHintTarget(target), GL_INVALID_ENUM);
+    HOST_VALIDATED_ERROR_IF(!GLESv2Validation::allowedHintMode(mode), GL_INVALID_ENUM);
     ctx->m_glHint_enc(ctx, target, mode);
 }
 
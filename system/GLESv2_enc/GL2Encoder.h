@@ -19,8 +19,14 @@
 #include "gl2_enc.h"
 #include "GLClientState.h"
 #include "GLSharedGroup.h"
+#include "FlushPolicy.h"
+#include "ProgramLinkCache.h"
+#include "TextureContentCache.h"
 
+#include <array>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct Extensions
@@ -39,6 +45,9 @@ struct Extensions
 
     // GL_EXT_draw_buffers_indexed
     bool drawBuffersIndexedEXT = false;
+
+    // GL_KHR_parallel_shader_compile
+    bool parallelShaderCompileKHR = false;
 };
 
 class GL2Encoder : public gl2_encoder_context_t {
@@ -47,17 +56,71 @@ public:
     virtual ~GL2Encoder();
     const Extensions& getExtensions() const { return m_extensions; }
     void setDrawCallFlushInterval(uint32_t interval) {
-        m_drawCallFlushInterval = interval;
+        setFlushPolicy(FlushPolicy::Kind::FixedInterval, interval);
+    }
+    void setFlushPolicy(FlushPolicy::Kind kind, uint32_t drawCallInterval) {
+        m_flushPolicy = FlushPolicy::create(kind, drawCallInterval);
     }
+    // The stream was flushed for presentation.
+    void onFrameBoundary();
     void setHasAsyncUnmapBuffer(int version) {
         m_hasAsyncUnmapBuffer = version;
     }
     void setHasSyncBufferData(bool value) {
         m_hasSyncBufferData = value;
     }
+    void setHasProgramReflection(bool value) {
+        m_hasProgramReflection = value;
+    }
+    void setHasDrawLists(bool value) {
+        m_hasDrawLists = value;
+    }
+    // Leaves the status and reflection of a linked program to be read
+    // back when first needed, rather than in glLinkProgram.
+    void setDeferProgramLinks(bool value) {
+        m_deferProgramLinks = value;
+    }
+    bool deferProgramLinks() const { return m_deferProgramLinks; }
+    // Reads back the links this encoder left pending, before another
+    // context can be ordered after its stream: at glFlush, glFinish and
+    // glFenceSync, and before the current context changes.
+    void resolvePendingProgramLinks();
+    void setStreamClientArrays(bool value) {
+        m_streamClientArrays = value;
+    }
+    void setStagePixelUploads(bool value) {
+        m_stagePixelUploads = value;
+    }
+    // Texture uploads of at least |threshold| bytes that repeat earlier
+    // ones are sent as references to a copy kept on the host; 0 turns
+    // this off.
+    void setTextureContentThreshold(size_t threshold) {
+        m_textureContentThreshold = threshold;
+    }
+    void setAsyncReadPixels(bool value) {
+        m_asyncReadPixels = value;
+    }
+    void setLazyBufferShadows(bool value) {
+        m_lazyBufferShadows = value;
+    }
+    // Host GL_RENDERER and GL_VERSION, which key the program link cache.
+    void setHostRendererId(const std::string& id) {
+        m_hostRendererId = id;
+    }
     void setNoHostError(bool noHostError) {
         m_noHostError = noHostError;
     }
+    // Reports host errors late, in batches: glGetError asks the host once
+    // every few calls or once a frame, and never when nothing was encoded
+    // since the host was last asked. For builds that check every call.
+    void setDeferredHostError(bool value) {
+        m_deferredHostError = value;
+    }
+    // Leaves enum checks that the host repeats to the host. Only for hosts
+    // that report errors.
+    void setHostValidation(bool value) {
+        m_hostValidation = value;
+    }
     void setClientState(GLClientState *state) {
         m_state = state;
     }
@@ -86,6 +149,7 @@ public:
             m_state->setTextureData(m_shared->getTextureData());
             m_state->setRenderbufferInfo(m_shared->getRenderbufferInfo());
             m_state->setSamplerInfo(m_shared->getSamplerInfo());
+            m_state->setBufferHostWrites(m_shared->getBufferHostWrites());
         }
     }
     bool es32Plus() const { return m_currMajorVersion > 3 || (m_currMajorVersion == 3 && m_currMinorVersion >= 2); }
@@ -100,6 +164,15 @@ public:
         m_extensions.textureBufferEXT = hasExtension("GL_EXT_texture_buffer");
         m_extensions.textureBufferOES = hasExtension("GL_OES_texture_buffer");
         m_extensions.drawBuffersIndexedEXT = hasExtension("GL_EXT_draw_buffers_indexed");
+        m_extensions.parallelShaderCompileKHR = hasExtension("GL_KHR_parallel_shader_compile");
+    }
+    // Points the current client state at the extensions already set, for
+    // a switch to a context that reports the same ones. Returns false if
+    // they differ and setExtensions() is needed.
+    bool reuseExtensions(const char* exts) {
+        if (m_currExtensions != exts) return false;
+        m_state->setExtensions(m_currExtensions);
+        return true;
     }
     bool hasExtension(const char* ext) const {
         return m_currExtensions.find(ext) != std::string::npos;
@@ -124,6 +197,7 @@ public:
     // Convenience functions for buffers
     GLuint boundBuffer(GLenum target) const;
     BufferData* getBufferData(GLenum target) const;
+    bool indirectCommandInBuffer(GLenum target, uintptr_t offset, size_t size) const;
     BufferData* getBufferDataById(GLuint buffer) const;
     bool isBufferMapped(GLuint buffer) const;
     bool isBufferTargetMapped(GLenum target) const;
@@ -141,8 +215,22 @@ private:
 
     bool    m_hasAsyncUnmapBuffer;
     bool    m_hasSyncBufferData;
+    bool    m_hasProgramReflection;
+    bool    m_deferProgramLinks;
+    // Programs linked on this stream whose results are still to be read.
+    std::vector<GLuint> m_pendingProgramLinks;
     bool    m_initialized;
     bool    m_noHostError;
+    bool    m_hostValidation;
+    bool    m_deferredHostError;
+    // Stream position right after the host error flag was last read, and
+    // what decides when a deferred glGetError asks again.
+    uint64_t m_hostErrorReadAt;
+    uint32_t m_deferredHostErrorPolls;
+    bool    m_hostErrorDue;
+    uint64_t encodedBytes() const;
+    GLenum readHostError();
+    bool hostErrorDue();
     GLClientState *m_state;
     GLSharedGroupPtr m_shared;
     GLenum  m_error;
@@ -151,6 +239,41 @@ private:
     GLint m_num_compressedTextureFormats;
     GLint *getCompressedTextureFormats();
 
+    // Implementation-dependent limits that no call can change, kept once the
+    // host has answered them.
+    std::unordered_map<GLenum, std::array<GLint, 2>> m_constantLimits;
+    bool getConstantLimit(GLenum param, GLint* ptr);
+    // Answers state the guest tracks itself, if the current context has it.
+    bool getTrackedStateParameter(GLenum param, GLint* ptr) const;
+    bool getGuestIntegerv(GLenum param, GLint* ptr);
+
+    // glGetIntegerv queries nothing on the guest answers, counted by enum
+    // to find further round trips to avoid.
+    std::unordered_map<GLenum, uint32_t> m_hostIntegerQueries;
+    void hostGetIntegerv(GLenum param, GLint* ptr);
+
+    // Programs whose binary would not fit the platform blob cache anyway
+    // are cached without one.
+    static constexpr GLint kMaxCachedProgramBinarySize = 60 * 1024;
+    bool getProgramLinkCacheKey(GLuint program, std::string* key);
+    bool linkProgramFromCache(GLuint program, const std::string& cacheKey,
+                              const ProgramLinkCache::Entry& entry);
+    void getProgramBinaryForCache(GLuint program, ProgramLinkCache::Entry* entry);
+
+    // Link status and reflection of a program in one round trip, when the
+    // host has glGetProgramReflectionAEMU.
+    static constexpr size_t kInitialProgramReflectionSize = 4096;
+    std::vector<uint8_t> m_programReflection;
+    bool getProgramReflection(GLuint program, GLint* linkStatus,
+                              ProgramLinkCache::Entry* entry);
+    void applyProgramReflection(GLuint program, const ProgramLinkCache::Entry& entry);
+
+    // Reads back the result of a program link; |cacheKey| is empty if the
+    // result is not to be cached.
+    void finishProgramLink(GLuint program, const std::string& cacheKey);
+    // Finishes a link of |program| that was deferred, if any.
+    void resolveProgramLink(GLuint program);
+
     GLint m_max_combinedTextureImageUnits;
     GLint m_max_vertexTextureImageUnits;
     GLint m_max_array_texture_layers;;
@@ -176,10 +299,8 @@ private:
 
     GLint m_log2MaxTextureSize;
 
-    std::vector<char> m_fixedBuffer;
-
-    uint32_t m_drawCallFlushInterval;
-    uint32_t m_drawCallFlushCount;
+    std::unique_ptr<FlushPolicy> m_flushPolicy;
+    uint64_t m_lastReadbackCount;
 
     bool m_primitiveRestartEnabled;
     GLuint m_primitiveRestartIndex;
@@ -187,16 +308,173 @@ private:
     void calcIndexRange(const void* indices,
                         GLenum type, GLsizei count,
                         int* minIndex, int* maxIndex);
-    void* recenterIndices(const void* src,
-                          GLenum type, GLsizei count,
-                          int minIndex);
+    void writeRecenteredIndices(unsigned char* dst, const void* src,
+                                GLenum type, GLsizei count,
+                                int minIndex);
+    void encodeDrawElementsData(uint32_t opcode, GLenum mode, GLsizei count,
+                                GLenum type, const void* indices, int minIndex,
+                                const GLsizei* primcount = nullptr);
     void getBufferIndexRange(BufferData* buf, const void* dataWithOffset,
                              GLenum type, size_t count, size_t offset,
                              int* minIndex_out, int* maxIndex_out);
+    // Texture binds and unit switches made by the encoder itself, kept in
+    // step with the client state's shadow of the host state.
+    void encodeActiveTexture(GLenum texture);
+    void encodeBindTexture(GLenum target, GLuint texture);
+
+    // Runs the client-side validation of a glUniform* call and returns
+    // true if it would not change the current program's value.
+    bool isRedundantUniform(bool isFloat, bool isUnsigned, GLint columns,
+                            GLint rows, GLint location, GLsizei count,
+                            const void* data, GLboolean transpose = GL_FALSE);
     void getVBOUsage(bool* hasClientArrays, bool* hasVBOs) const;
+
+    // Client vertex arrays gathered by sendVertexAttributes, encoded
+    // together with a single stream allocation.
+    struct ClientAttribData {
+        GLuint index;
+        GLint size;
+        GLenum type;
+        GLboolean normalized;
+        GLsizei stride;
+        unsigned char* data;
+        GLuint datalen;
+        bool isInt;
+    };
+    std::vector<ClientAttribData> m_pendingClientAttribs;
+    void encodeClientAttribData(GLuint* lastBoundVbo);
+
+    // Opt-in streaming of client arrays through a per-context ring buffer
+    // object that is filled over goldfish DMA, so the vertex bytes do not
+    // go through the command stream. The DMA region only holds the bytes
+    // until glUnmapBufferDMA returns, so one per encoder serves all of
+    // the thread's contexts.
+    static constexpr size_t kClientArrayRingSize = 4 * 1024 * 1024;
+    bool m_streamClientArrays;
+    AutoGoldfishDmaContext m_clientArrayRingDma;
+    bool m_clientArrayRingMapped;
+    bool initClientArrayRing();
+    bool streamClientAttribData(GLuint* lastBoundVbo);
+
+    // Opt-in staging of large client-memory texture uploads through a
+    // goldfish DMA ring. The host copies them into a per-context unpack
+    // buffer and the upload is encoded as a glTex*ImageOffsetAEMU.
+    static constexpr size_t kPixelUnpackRingSize = 8 * 1024 * 1024;
+    static constexpr size_t kMinStagedPixelUploadSize = 64 * 1024;
+    bool m_stagePixelUploads;
+    AutoGoldfishDmaContext m_pixelUnpackRingDma;
+    bool m_pixelUnpackRingMapped;
+    size_t m_pixelUnpackRingHead;
+    bool stagePixelUpload(const void* pixels, size_t size, GLuint* offset);
+    void endStagedPixelUpload();
+
+    // Opt-in dedup of large glTexImage2D and glCompressedTexImage2D
+    // payloads through copies kept on the host, by content hash.
+    static constexpr size_t kTextureContentBudget = 32 * 1024 * 1024;
+    size_t m_textureContentThreshold;
+    std::unique_ptr<TextureContentCache> m_textureContentCache;
+    GLuint textureContentFor(const void* pixels, size_t size);
+
+    // Opt-in prefetch of pixel pack buffers right after glReadPixels, so
+    // that mapping them for reading does not copy through the stream.
+    static constexpr size_t kMaxReadbackRanges = 8;
+    bool m_asyncReadPixels;
+    void prefetchPixelPackBuffer(GLuint bufferId, bool wasDirty,
+                                 GLintptr offset, GLsizeiptr size);
+    void completeBufferReadback(GLuint bufferId, BufferData* buf);
+    void forgetBufferReadback(GLuint bufferId, BufferData* buf);
+
+    // Opt-in guest shadows of only the buffers that are indexed from or
+    // mapped. Others are shadowed, from the host, once they first are.
+    bool m_lazyBufferShadows;
+    std::string m_hostRendererId;
+    bool shouldShadowBuffer(GLenum target, const BufferData* buf) const;
+    void ensureBufferShadow(GLenum target, BufferData* buf);
+
+    // GL_EXT_buffer_storage persistent mappings point at the guest shadow
+    // and stay mapped while the buffer is in use; the share group keeps
+    // track of them. Writes that are not flushed explicitly are diffed
+    // against what the host last received. Coherent mappings are diffed
+    // before each command that may read them; the others only where GLES
+    // makes their writes visible: glMemoryBarrier with
+    // GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT_EXT, fences, glFlush and glFinish.
+
+    void syncPersistentMappings() {
+        if (m_shared && m_shared->hasPersistentMappings()) sendPersistentWrites(true);
+    }
+    void flushPersistentMappings() {
+        if (m_shared && m_shared->hasPersistentMappings()) sendPersistentWrites(false);
+    }
+    void* mapBufferPersistent(GLenum target, GLuint bufferId, BufferData* buf);
+    void sendPersistentWrites(bool coherentOnly);
+    void sendPersistentWrites(GLuint bufferId, BufferData* buf);
+    void refreshPersistentReads();
+    void sendBufferRange(GLuint bufferId, BufferData* buf, GLintptr offset, GLsizeiptr length);
+    void syncWithHost();
     void sendVertexAttributes(GLint first, GLsizei count, bool hasClientArrays, GLsizei primcount = 0);
     void flushDrawCall();
 
+    // Draws from buffer objects that follow one another in the stream,
+    // with nothing encoded in between, are merged into one
+    // glDraw*ListAEMU. The first is encoded as usual and rewritten in place
+    // once a second one joins it, while it is still in the stream buffer.
+    static constexpr GLsizei kMaxDrawsPerList = 1024;
+    struct DrawList {
+        const unsigned char* packet = nullptr;
+        const unsigned char* end = nullptr;
+        uint64_t flushCount = 0;
+        bool elements = false;
+        GLenum mode = 0;
+        GLenum type = 0;
+        GLsizei draws = 0;
+        // First and count, or count and offset, of the first draw.
+        GLuint firstDraw[2] = {};
+    };
+    bool m_hasDrawLists;
+    DrawList m_drawList;
+    void encodeBufferDrawArrays(GLenum mode, GLint first, GLsizei count);
+    void encodeBufferDrawElements(GLenum mode, GLsizei count, GLenum type, GLuint offset);
+    bool appendToDrawList(bool elements, GLenum mode, GLenum type, GLuint a, GLuint b);
+    void startDrawList(bool elements, GLenum mode, GLenum type, GLuint a, GLuint b, size_t size);
+
+    // Commands with one large parameter, sent with their header in a
+    // single write; see usesGeneratedLargeParams().
+    bool usesGeneratedLargeParams() const;
+    void encodeBufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage);
+    void encodeBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data);
+    void encodeTexImage2D(GLenum target, GLint level, GLint internalformat,
+                          GLsizei width, GLsizei height, GLint border,
+                          GLenum format, GLenum type, const GLvoid* pixels);
+    void encodeTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+                             GLsizei width, GLsizei height,
+                             GLenum format, GLenum type, const GLvoid* pixels);
+    void encodeTexImage3D(GLenum target, GLint level, GLint internalFormat,
+                          GLsizei width, GLsizei height, GLsizei depth, GLint border,
+                          GLenum format, GLenum type, const GLvoid* data);
+    void encodeTexSubImage3D(GLenum target, GLint level,
+                             GLint xoffset, GLint yoffset, GLint zoffset,
+                             GLsizei width, GLsizei height, GLsizei depth,
+                             GLenum format, GLenum type, const GLvoid* data);
+    void encodeCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat,
+                                    GLsizei width, GLsizei height, GLint border,
+                                    GLsizei imageSize, const GLvoid* data);
+    void encodeCompressedTexSubImage2D(GLenum target, GLint level,
+                                       GLint xoffset, GLint yoffset,
+                                       GLsizei width, GLsizei height, GLenum format,
+                                       GLsizei imageSize, const GLvoid* data);
+    void encodeCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat,
+                                    GLsizei width, GLsizei height, GLsizei depth,
+                                    GLint border, GLsizei imageSize, const GLvoid* data);
+    void encodeCompressedTexSubImage3D(GLenum target, GLint level,
+                                       GLint xoffset, GLint yoffset, GLint zoffset,
+                                       GLsizei width, GLsizei height, GLsizei depth,
+                                       GLenum format, GLsizei imageSize, const GLvoid* data);
+    void encodeUnmapBufferAsync(GLenum target, GLintptr offset, GLsizeiptr length,
+                                GLbitfield access, void* guestBuffer, GLboolean* outRes);
+    void encodeFlushMappedBufferRange2(GLenum target, GLintptr offset, GLsizeiptr length,
+                                       GLbitfield access, void* guestBuffer);
+    void encodeStoreTextureContent(GLuint content, GLsizei size, const void* data);
+
     bool updateHostTexture2DBinding(GLenum texUnit, GLenum newTarget);
     void updateHostTexture2DBindingsFromProgramData(GLuint program);
     bool texture2DNeedsOverride(GLenum target) const;
@@ -508,6 +786,8 @@ private:
                                             GLbitfield access, BufferData* buf);
     static GLboolean s_glUnmapBuffer(void* self, GLenum target);
     static void s_glFlushMappedBufferRange(void* self, GLenum target, GLintptr offset, GLsizeiptr length);
+    static void s_glBufferStorageEXT(void* self, GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+    static void s_glMaxShaderCompilerThreadsKHR(void* self, GLuint count);
 
     // Custom encodes for 2D compressed textures b/c we need to account for
     // nonzero GL_PIXEL_UNPACK_BUFFER
@@ -849,6 +1129,9 @@ private:
     glDispatchCompute_client_proc_t m_glDispatchCompute_enc;
     glDispatchComputeIndirect_client_proc_t m_glDispatchComputeIndirect_enc;
 
+    static void s_glMemoryBarrier(void* self, GLbitfield barriers);
+    glMemoryBarrier_client_proc_t m_glMemoryBarrier_enc;
+
     // State tracking for transform feedbacks, samplers, and query objects
     static void s_glGenTransformFeedbacks(void* self, GLsizei n, GLuint* ids);
     static void s_glDeleteTransformFeedbacks(void* self, GLsizei n, const GLuint* ids);
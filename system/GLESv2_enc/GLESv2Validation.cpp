@@ -16,8 +16,189 @@
 
 #include "GLESv2Validation.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <sstream>
 
+namespace {
+
+// Enum checks that run on every draw or state change look their enum up in
+// tables built at compile time rather than going through a switch. Each
+// enum maps to the first GLES version that accepts it, and GLES enums are
+// 16 bits, so a table is a page index on the high byte plus one 256 entry
+// page for every high byte that has any enum in it.
+
+// Versions as (major << 4) | minor, so that they compare in order.
+constexpr uint8_t kAnyVersion = 0x01;
+constexpr uint8_t kES30 = 0x30;
+constexpr uint8_t kES31 = 0x31;
+
+constexpr uint8_t packVersion(int major, int minor) {
+    return (uint8_t)((major << 4) | minor);
+}
+
+struct EnumVersion {
+    GLenum value;
+    uint8_t minVersion;
+};
+
+constexpr size_t kNoPage = 0xff;
+
+template <size_t N>
+constexpr size_t countPages(const EnumVersion (&entries)[N]) {
+    bool used[256] = {};
+    size_t count = 0;
+    for (size_t i = 0; i < N; ++i) {
+        const size_t high = entries[i].value >> 8;
+        if (!used[high]) {
+            used[high] = true;
+            ++count;
+        }
+    }
+    return count;
+}
+
+template <size_t Pages>
+struct EnumTable {
+    static_assert(Pages < kNoPage, "too many pages");
+
+    uint8_t pageOf[256] = {};
+    uint8_t minVersion[Pages][256] = {};
+
+    template <size_t N>
+    constexpr explicit EnumTable(const EnumVersion (&entries)[N]) {
+        for (size_t i = 0; i < 256; ++i) {
+            pageOf[i] = kNoPage;
+        }
+        size_t pages = 0;
+        for (size_t i = 0; i < N; ++i) {
+            const size_t high = entries[i].value >> 8;
+            if (pageOf[high] == kNoPage) {
+                pageOf[high] = (uint8_t)pages++;
+            }
+            minVersion[pageOf[high]][entries[i].value & 0xff] = entries[i].minVersion;
+        }
+    }
+
+    bool allowed(GLenum value, uint8_t version) const {
+        if (value > 0xffff) return false;
+        const uint8_t page = pageOf[value >> 8];
+        if (page == kNoPage) return false;
+        const uint8_t needed = minVersion[page][value & 0xff];
+        return needed && version >= needed;
+    }
+};
+
+#define MAKE_ENUM_TABLE(name, entries) \
+    constexpr EnumTable<countPages(entries)> name(entries)
+
+constexpr EnumVersion kEnableCaps[] = {
+    { GL_CULL_FACE, kAnyVersion },
+    { GL_POLYGON_OFFSET_FILL, kAnyVersion },
+    { GL_SAMPLE_ALPHA_TO_COVERAGE, kAnyVersion },
+    { GL_SAMPLE_COVERAGE, kAnyVersion },
+    { GL_SCISSOR_TEST, kAnyVersion },
+    { GL_STENCIL_TEST, kAnyVersion },
+    { GL_DEPTH_TEST, kAnyVersion },
+    { GL_BLEND, kAnyVersion },
+    { GL_DITHER, kAnyVersion },
+    { GL_PRIMITIVE_RESTART_FIXED_INDEX, kES30 },
+    { GL_RASTERIZER_DISCARD, kES30 },
+    { GL_SAMPLE_MASK, kES31 },
+};
+MAKE_ENUM_TABLE(kEnableCapTable, kEnableCaps);
+
+constexpr EnumVersion kPixelTypes[] = {
+    { GL_UNSIGNED_BYTE, kAnyVersion },
+    { GL_UNSIGNED_SHORT, kAnyVersion },
+    { GL_UNSIGNED_SHORT_5_6_5, kAnyVersion },
+    { GL_UNSIGNED_SHORT_4_4_4_4, kAnyVersion },
+    { GL_UNSIGNED_SHORT_5_5_5_1, kAnyVersion },
+    { GL_UNSIGNED_INT, kAnyVersion },
+    { GL_UNSIGNED_INT_10F_11F_11F_REV, kAnyVersion },
+    { GL_UNSIGNED_INT_24_8, kAnyVersion },
+    { GL_HALF_FLOAT, kAnyVersion },
+    { GL_HALF_FLOAT_OES, kAnyVersion },
+    { GL_FLOAT, kAnyVersion },
+    { GL_BYTE, kES30 },
+    { GL_FLOAT_32_UNSIGNED_INT_24_8_REV, kES30 },
+    { GL_INT, kES30 },
+    { GL_SHORT, kES30 },
+    { GL_UNSIGNED_INT_2_10_10_10_REV, kES30 },
+    { GL_UNSIGNED_INT_5_9_9_9_REV, kES30 },
+};
+MAKE_ENUM_TABLE(kPixelTypeTable, kPixelTypes);
+
+constexpr EnumVersion kPixelFormats[] = {
+    // GLES3 compatible, required in dEQP.
+    { GL_DEPTH_COMPONENT, kAnyVersion },
+    { GL_RED, kAnyVersion },
+    { GL_RG, kAnyVersion },
+    { GL_DEPTH_STENCIL, kAnyVersion },
+    { GL_ALPHA, kAnyVersion },
+    { GL_RGB, kAnyVersion },
+    { GL_RGBA, kAnyVersion },
+    { GL_BGRA_EXT, kAnyVersion },
+    { GL_LUMINANCE, kAnyVersion },
+    { GL_LUMINANCE_ALPHA, kAnyVersion },
+    { GL_RED_INTEGER, kES30 },
+    { GL_RG_INTEGER, kES30 },
+    { GL_RGB_INTEGER, kES30 },
+    { GL_RGBA_INTEGER, kES30 },
+};
+MAKE_ENUM_TABLE(kPixelFormatTable, kPixelFormats);
+
+constexpr EnumVersion kVertexAttribTypes[] = {
+    { GL_BYTE, kAnyVersion },
+    { GL_UNSIGNED_BYTE, kAnyVersion },
+    { GL_SHORT, kAnyVersion },
+    { GL_UNSIGNED_SHORT, kAnyVersion },
+    { GL_FIXED, kAnyVersion },
+    { GL_FLOAT, kAnyVersion },
+    // The following are technically only available if certain GLES2 extensions are.
+    // However, they are supported by desktop GL3, which is a reasonable requirement
+    // for the desktop GL version. Therefore, consider them valid.
+    { GL_INT, kAnyVersion },
+    { GL_UNSIGNED_INT, kAnyVersion },
+    { GL_HALF_FLOAT_OES, kAnyVersion },
+    { GL_HALF_FLOAT, kES30 },
+    { GL_INT_2_10_10_10_REV, kES30 },
+    { GL_UNSIGNED_INT_2_10_10_10_REV, kES30 },
+};
+MAKE_ENUM_TABLE(kVertexAttribTypeTable, kVertexAttribTypes);
+
+constexpr EnumVersion kProgramParams[] = {
+    { GL_DELETE_STATUS, kAnyVersion },
+    { GL_LINK_STATUS, kAnyVersion },
+    { GL_VALIDATE_STATUS, kAnyVersion },
+    { GL_INFO_LOG_LENGTH, kAnyVersion },
+    { GL_ATTACHED_SHADERS, kAnyVersion },
+    { GL_ACTIVE_ATTRIBUTES, kAnyVersion },
+    { GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, kAnyVersion },
+    { GL_ACTIVE_UNIFORMS, kAnyVersion },
+    { GL_ACTIVE_UNIFORM_MAX_LENGTH, kAnyVersion },
+    { GL_TRANSFORM_FEEDBACK_BUFFER_MODE, kES30 },
+    { GL_PROGRAM_BINARY_RETRIEVABLE_HINT, kES30 },
+    { GL_PROGRAM_BINARY_LENGTH, kES30 },
+    { GL_TRANSFORM_FEEDBACK_VARYINGS, kES30 },
+    { GL_TRANSFORM_FEEDBACK_VARYING_MAX_LENGTH, kES30 },
+    { GL_ACTIVE_UNIFORM_BLOCKS, kES30 },
+    { GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, kES30 },
+    { GL_COMPUTE_WORK_GROUP_SIZE, kES31 },
+    { GL_PROGRAM_SEPARABLE, kES31 },
+    { GL_ACTIVE_ATOMIC_COUNTER_BUFFERS, kES31 },
+};
+MAKE_ENUM_TABLE(kProgramParamTable, kProgramParams);
+
+#undef MAKE_ENUM_TABLE
+
+uint8_t contextVersion(GL2Encoder* ctx) {
+    return packVersion(ctx->majorVersion(), ctx->minorVersion());
+}
+
+}  // namespace
+
 #define LIST_VALID_TEX_INTERNALFORMATS(f) \
     f(GL_BGRA8_EXT) \
     f(GL_R8) \
@@ -327,7 +508,16 @@ GLbitfield allBufferMapAccessFlags =
     GL_MAP_INVALIDATE_RANGE_BIT |
     GL_MAP_INVALIDATE_BUFFER_BIT |
     GL_MAP_FLUSH_EXPLICIT_BIT |
-    GL_MAP_UNSYNCHRONIZED_BIT;
+    GL_MAP_UNSYNCHRONIZED_BIT |
+    GL_MAP_PERSISTENT_BIT_EXT |
+    GL_MAP_COHERENT_BIT_EXT;
+
+GLbitfield allBufferStorageFlags =
+    GL_MAP_READ_BIT | GL_MAP_WRITE_BIT |
+    GL_MAP_PERSISTENT_BIT_EXT |
+    GL_MAP_COHERENT_BIT_EXT |
+    GL_DYNAMIC_STORAGE_BIT_EXT |
+    GL_CLIENT_STORAGE_BIT_EXT;
 
 bool bufferTarget(GL2Encoder* ctx, GLenum target) {
     int glesMajorVersion = ctx->majorVersion();
@@ -368,6 +558,9 @@ bool bufferParam(GL2Encoder* ctx, GLenum pname) {
     case GL_BUFFER_MAP_LENGTH:
     case GL_BUFFER_MAP_OFFSET:
         return glesMajorVersion >= 3;
+    case GL_BUFFER_IMMUTABLE_STORAGE_EXT:
+    case GL_BUFFER_STORAGE_FLAGS_EXT:
+        return ctx->hasExtension("GL_EXT_buffer_storage");
     default:
         return false;
     }
@@ -595,30 +788,7 @@ bool pixelOp(GLenum format,GLenum type) {
 
 bool vertexAttribType(GL2Encoder* ctx, GLenum type)
 {
-    int glesMajorVersion = ctx->majorVersion();
-    bool retval = false;
-    switch (type) {
-    case GL_BYTE:
-    case GL_UNSIGNED_BYTE:
-    case GL_SHORT:
-    case GL_UNSIGNED_SHORT:
-    case GL_FIXED:
-    case GL_FLOAT:
-    // The following are technically only available if certain GLES2 extensions are.
-    // However, they are supported by desktop GL3, which is a reasonable requirement
-    // for the desktop GL version. Therefore, consider them valid.
-    case GL_INT:
-    case GL_UNSIGNED_INT:
-    case GL_HALF_FLOAT_OES:
-        retval = true;
-        break;
-    case GL_HALF_FLOAT:
-    case GL_INT_2_10_10_10_REV:
-    case GL_UNSIGNED_INT_2_10_10_10_REV:
-        retval = glesMajorVersion >= 3;
-        break;
-    }
-    return retval;
+    return kVertexAttribTypeTable.allowed(type, contextVersion(ctx));
 }
 
 bool readPixelsFboFormatMatch(GLenum, GLenum type, GLenum fboTexType) {
@@ -1100,105 +1270,12 @@ bool isCubeMapTarget(GLenum target) {
     return false;
 }
 
-#define LIST_VALID_TEXFORMATS(f) \
-    f(GL_DEPTH_COMPONENT) \
-    f(GL_DEPTH_STENCIL) \
-    f(GL_RED) \
-    f(GL_RED_INTEGER) \
-    f(GL_RG) \
-    f(GL_RGB) \
-    f(GL_RGBA) \
-    f(GL_RGBA_INTEGER) \
-    f(GL_RGB_INTEGER) \
-    f(GL_RG_INTEGER) \
-    f(GL_BGRA_EXT) \
-    f(GL_ALPHA) \
-    f(GL_LUMINANCE) \
-    f(GL_LUMINANCE_ALPHA) \
-
-#define LIST_VALID_TEXTYPES(f) \
-    f(GL_BYTE) \
-    f(GL_FLOAT) \
-    f(GL_FLOAT_32_UNSIGNED_INT_24_8_REV) \
-    f(GL_HALF_FLOAT) \
-    f(GL_HALF_FLOAT_OES) \
-    f(GL_INT) \
-    f(GL_SHORT) \
-    f(GL_UNSIGNED_BYTE) \
-    f(GL_UNSIGNED_INT) \
-    f(GL_UNSIGNED_INT_10F_11F_11F_REV) \
-    f(GL_UNSIGNED_INT_2_10_10_10_REV) \
-    f(GL_UNSIGNED_INT_24_8) \
-    f(GL_UNSIGNED_INT_5_9_9_9_REV) \
-    f(GL_UNSIGNED_SHORT) \
-    f(GL_UNSIGNED_SHORT_4_4_4_4) \
-    f(GL_UNSIGNED_SHORT_5_5_5_1) \
-    f(GL_UNSIGNED_SHORT_5_6_5) \
-
 bool pixelType(GL2Encoder* ctx, GLenum type) {
-    int glesMajorVersion = ctx->majorVersion();
-    if (glesMajorVersion < 3) {
-        switch (type) {
-        case GL_UNSIGNED_BYTE:
-        case GL_UNSIGNED_SHORT:
-        case GL_UNSIGNED_SHORT_5_6_5:
-        case GL_UNSIGNED_SHORT_4_4_4_4:
-        case GL_UNSIGNED_SHORT_5_5_5_1:
-        case GL_UNSIGNED_INT:
-        case GL_UNSIGNED_INT_10F_11F_11F_REV:
-        case GL_UNSIGNED_INT_24_8:
-        case GL_HALF_FLOAT:
-        case GL_HALF_FLOAT_OES:
-        case GL_FLOAT:
-            return true;
-        }
-        return false;
-    }
-
-#define GLES3_TYPE_CASE(type) \
-    case type: \
-
-    switch (type) {
-        LIST_VALID_TEXTYPES(GLES3_TYPE_CASE)
-            return glesMajorVersion >= 3;
-        default:
-            break;
-    }
-
-    return false;
+    return kPixelTypeTable.allowed(type, contextVersion(ctx));
 }
 
 bool pixelFormat(GL2Encoder* ctx, GLenum format) {
-    int glesMajorVersion = ctx->majorVersion();
-    if (glesMajorVersion < 3) {
-        switch (format) {
-            case GL_DEPTH_COMPONENT:
-                // GLES3 compatible
-                // Required in dEQP
-            case GL_RED:
-            case GL_RG:
-            case GL_DEPTH_STENCIL_OES:
-            case GL_ALPHA:
-            case GL_RGB:
-            case GL_RGBA:
-            case GL_BGRA_EXT:
-            case GL_LUMINANCE:
-            case GL_LUMINANCE_ALPHA:
-                return true;
-        }
-        return false;
-    }
-
-#define GLES3_FORMAT_CASE(format) \
-    case format:
-
-    switch (format) {
-        LIST_VALID_TEXFORMATS(GLES3_FORMAT_CASE)
-            return glesMajorVersion >= 3;
-        default:
-            break;
-    }
-    return false;
+    return kPixelFormatTable.allowed(format, contextVersion(ctx));
 }
 
 bool pixelInternalFormat(GLenum internalformat) {
@@ -1439,26 +1516,11 @@ bool allowedFrontFace(GLenum mode) {
 }
 
 bool allowedEnable(int majorVersion, int minorVersion, GLenum cap) {
-    switch (cap) {
-        case GL_CULL_FACE:
-        case GL_POLYGON_OFFSET_FILL:
-        case GL_SAMPLE_ALPHA_TO_COVERAGE:
-        case GL_SAMPLE_COVERAGE:
-        case GL_SCISSOR_TEST:
-        case GL_STENCIL_TEST:
-        case GL_DEPTH_TEST:
-        case GL_BLEND:
-        case GL_DITHER:
-            return true;
-        case GL_PRIMITIVE_RESTART_FIXED_INDEX:
-        case GL_RASTERIZER_DISCARD:
-            return majorVersion >= 3;
-        case GL_SAMPLE_MASK:
-            return majorVersion >= 3 && minorVersion >= 1;
-        default:
-            ALOGW("error cap: 0x%x is invalid\n", cap);
-	    return false;
+    if (!kEnableCapTable.allowed(cap, packVersion(majorVersion, minorVersion))) {
+        ALOGW("error cap: 0x%x is invalid\n", cap);
+        return false;
     }
+    return true;
 }
 
 bool allowedGetShader(GLenum pname) {
@@ -1499,32 +1561,7 @@ bool allowedPrecisionType(GLenum precisiontype) {
 }
 
 bool allowedGetProgram(int majorVersion, int minorVersion, GLenum pname) {
-    switch (pname) {
-        case GL_DELETE_STATUS:
-        case GL_LINK_STATUS:
-        case GL_VALIDATE_STATUS:
-        case GL_INFO_LOG_LENGTH:
-        case GL_ATTACHED_SHADERS:
-        case GL_ACTIVE_ATTRIBUTES:
-        case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH:
-        case GL_ACTIVE_UNIFORMS:
-        case GL_ACTIVE_UNIFORM_MAX_LENGTH:
-            return true;
-        case GL_TRANSFORM_FEEDBACK_BUFFER_MODE:
-        case GL_PROGRAM_BINARY_RETRIEVABLE_HINT:
-        case GL_PROGRAM_BINARY_LENGTH:
-        case GL_TRANSFORM_FEEDBACK_VARYINGS:
-        case GL_TRANSFORM_FEEDBACK_VARYING_MAX_LENGTH:
-        case GL_ACTIVE_UNIFORM_BLOCKS:
-        case GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH:
-            return majorVersion > 2;
-        case GL_COMPUTE_WORK_GROUP_SIZE:
-        case GL_PROGRAM_SEPARABLE:
-        case GL_ACTIVE_ATOMIC_COUNTER_BUFFERS:
-            return majorVersion > 2 && minorVersion > 0;
-        default:
-            return false;
-    }
+    return kProgramParamTable.allowed(pname, packVersion(majorVersion, minorVersion));
 }
 
 bool allowedGetActiveUniforms(GLenum pname) {
@@ -31,6 +31,7 @@
 namespace GLESv2Validation {
 
 extern GLbitfield allBufferMapAccessFlags;
+extern GLbitfield allBufferStorageFlags;
 bool bufferTarget(GL2Encoder* ctx, GLenum target);
 bool bufferParam(GL2Encoder* ctx, GLenum param);
 bool bufferUsage(GL2Encoder* ctx, GLenum usage);
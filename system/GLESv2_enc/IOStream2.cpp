@@ -67,6 +67,34 @@ void IOStream::readbackPixels(void* context, int width, int height, unsigned int
     }
 }
 
+// writevFully() sends a command header left in the stream buffer along
+// with the first pixels, and counts the bytes for the encoder profile.
+static int writeCounted(IOStream* stream, const void* buf, size_t len) {
+    const struct iovec iov = { const_cast<void*>(buf), len };
+    return stream->writevFully(&iov, 1);
+}
+
+// The decoder reads whole rows, so the stream carries the client layout
+// from |pixels| through the padded end of the last row. Everything before
+// the last row lies inside the app's buffer and goes out in one write,
+// padding and skipped pixels included, as the host ignores those bytes.
+// Only the last row may be shorter in client memory than on the wire, so
+// its padding is sent as zeros.
+static void writeClientRows(IOStream* stream, const char* pixels,
+                            size_t lastRowOffset, size_t lastRowBytes,
+                            size_t trailingBytes) {
+    if (lastRowOffset) {
+        writeCounted(stream, pixels, lastRowOffset);
+    }
+    if (lastRowBytes) {
+        writeCounted(stream, pixels + lastRowOffset, lastRowBytes);
+    }
+    if (trailingBytes) {
+        std::vector<char> padding(trailingBytes, 0);
+        writeCounted(stream, padding.data(), trailingBytes);
+    }
+}
+
 void IOStream::uploadPixels(void* context, int width, int height, int depth, unsigned int format, unsigned int type, const void* pixels) {
     GL2Encoder *ctx = (GL2Encoder *)context;
     assert (ctx->state() != NULL);
@@ -92,38 +120,20 @@ void IOStream::uploadPixels(void* context, int width, int height, int depth, uns
         if (startOffset == 0 &&
                 pixelRowSize == totalRowSize) {
             // fast path
-            writeFully(pixels, pixelDataSize);
+            writeCounted(this, pixels, pixelDataSize);
         } else if (pixelRowSize == totalRowSize && (pixelRowSize == width * bpp)) {
             // fast path but with skip in the beginning
             std::vector<char> paddingToDiscard(startOffset, 0);
-            writeFully(&paddingToDiscard[0], startOffset);
-            writeFully((char*)pixels + startOffset, pixelDataSize - startOffset);
-        } else {
-
-            if (startOffset > 0) {
-                std::vector<char> paddingToDiscard(startOffset, 0);
-                writeFully(&paddingToDiscard[0], startOffset);
-            }
-            // need to upload row by row
-            size_t paddingSize = totalRowSize - pixelRowSize;
-            std::vector<char> paddingToDiscard(paddingSize, 0);
-
-            char* start = (char*)pixels + startOffset;
-
-            for (int i = 0; i < height; i++) {
-                if (pixelRowSize > width * bpp) {
-                    size_t rowSlack = pixelRowSize - width * bpp;
-                    std::vector<char> rowSlackToDiscard(rowSlack, 0);
-                    writeFully(start, width * bpp);
-                    writeFully(&rowSlackToDiscard[0], rowSlack);
-                    writeFully(&paddingToDiscard[0], paddingSize);
-                    start += totalRowSize;
-                } else {
-                    writeFully(start, pixelRowSize);
-                    writeFully(&paddingToDiscard[0], paddingSize);
-                    start += totalRowSize;
-                }
-            }
+            writeCounted(this, &paddingToDiscard[0], startOffset);
+            writeCounted(this, (char*)pixels + startOffset, pixelDataSize - startOffset);
+        } else if (height > 0) {
+            const size_t lastRowOffset =
+                startOffset + (size_t)(height - 1) * totalRowSize;
+            writeClientRows(this, (const char*)pixels, lastRowOffset,
+                            width * bpp, totalRowSize - width * bpp);
+        } else if (startOffset > 0) {
+            std::vector<char> paddingToDiscard(startOffset, 0);
+            writeCounted(this, &paddingToDiscard[0], startOffset);
         }
     } else {
         int bpp = 0;
@@ -154,49 +164,25 @@ void IOStream::uploadPixels(void* context, int width, int height, int depth, uns
             pixelRowSize == totalRowSize &&
             pixelImageSize == totalImageSize) {
             // fast path
-            writeFully(pixels, pixelDataSize);
+            writeCounted(this, pixels, pixelDataSize);
         } else if (pixelRowSize == totalRowSize &&
                    pixelImageSize == totalImageSize &&
                    pixelRowSize == (width * bpp)) {
             // fast path but with skip in the beginning
             std::vector<char> paddingToDiscard(startOffset, 0);
-            writeFully(&paddingToDiscard[0], startOffset);
-            writeFully((char*)pixels + startOffset, pixelDataSize - startOffset);
-        } else {
-
-            if (startOffset > 0) {
-                std::vector<char> paddingToDiscard(startOffset, 0);
-                writeFully(&paddingToDiscard[0], startOffset);
-            }
-            // need to upload row by row
-            size_t paddingSize = totalRowSize - pixelRowSize;
-            std::vector<char> paddingToDiscard(paddingSize, 0);
-
-            char* start = (char*)pixels + startOffset;
-
-            size_t imageSlack = totalImageSize - pixelImageSize;
-            std::vector<char> imageSlackToDiscard(imageSlack, 0);
-
-            for (int k = 0; k < depth; ++k) {
-                for (int i = 0; i < height; i++) {
-                    if (pixelRowSize > width * bpp) {
-                        size_t rowSlack = pixelRowSize - width * bpp;
-                        std::vector<char> rowSlackToDiscard(rowSlack, 0);
-                        writeFully(start, width * bpp);
-                        writeFully(&rowSlackToDiscard[0], rowSlack);
-                        writeFully(&paddingToDiscard[0], paddingSize);
-                        start += totalRowSize;
-                    } else {
-                        writeFully(start, pixelRowSize);
-                        writeFully(&paddingToDiscard[0], paddingSize);
-                        start += totalRowSize;
-                    }
-                }
-                if (imageSlack > 0) {
-                    writeFully(&imageSlackToDiscard[0], imageSlack);
-                    start += imageSlack;
-                }
-            }
+            writeCounted(this, &paddingToDiscard[0], startOffset);
+            writeCounted(this, (char*)pixels + startOffset, pixelDataSize - startOffset);
+        } else if (height > 0 && depth > 0) {
+            const size_t imageSlack = totalImageSize - pixelImageSize;
+            const size_t lastRowOffset =
+                startOffset +
+                (size_t)(depth - 1) * ((size_t)height * totalRowSize + imageSlack) +
+                (size_t)(height - 1) * totalRowSize;
+            writeClientRows(this, (const char*)pixels, lastRowOffset,
+                            width * bpp, totalRowSize - width * bpp + imageSlack);
+        } else if (startOffset > 0) {
+            std::vector<char> paddingToDiscard(startOffset, 0);
+            writeCounted(this, &paddingToDiscard[0], startOffset);
         }
     }
 }
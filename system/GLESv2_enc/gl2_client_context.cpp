@@ -449,6 +449,15 @@ int gl2_client_context_t::initDispatchByName(void *(*getProc)(const char *, void
 	glBlendFuncSeparateiEXT = (glBlendFuncSeparateiEXT_client_proc_t) getProc("glBlendFuncSeparateiEXT", userData);
 	glColorMaskiEXT = (glColorMaskiEXT_client_proc_t) getProc("glColorMaskiEXT", userData);
 	glIsEnablediEXT = (glIsEnablediEXT_client_proc_t) getProc("glIsEnablediEXT", userData);
+	glBufferStorageEXT = (glBufferStorageEXT_client_proc_t) getProc("glBufferStorageEXT", userData);
+	glGetProgramReflectionAEMU = (glGetProgramReflectionAEMU_client_proc_t) getProc("glGetProgramReflectionAEMU", userData);
+	glMaxShaderCompilerThreadsKHR = (glMaxShaderCompilerThreadsKHR_client_proc_t) getProc("glMaxShaderCompilerThreadsKHR", userData);
+	glStoreTextureContentAEMU = (glStoreTextureContentAEMU_client_proc_t) getProc("glStoreTextureContentAEMU", userData);
+	glReleaseTextureContentAEMU = (glReleaseTextureContentAEMU_client_proc_t) getProc("glReleaseTextureContentAEMU", userData);
+	glTexImage2DContentAEMU = (glTexImage2DContentAEMU_client_proc_t) getProc("glTexImage2DContentAEMU", userData);
+	glCompressedTexImage2DContentAEMU = (glCompressedTexImage2DContentAEMU_client_proc_t) getProc("glCompressedTexImage2DContentAEMU", userData);
+	glDrawArraysListAEMU = (glDrawArraysListAEMU_client_proc_t) getProc("glDrawArraysListAEMU", userData);
+	glDrawElementsListAEMU = (glDrawElementsListAEMU_client_proc_t) getProc("glDrawElementsListAEMU", userData);
 	return 0;
 }
 
@@ -449,6 +449,15 @@ struct gl2_client_context_t {
 	glBlendFuncSeparateiEXT_client_proc_t glBlendFuncSeparateiEXT;
 	glColorMaskiEXT_client_proc_t glColorMaskiEXT;
 	glIsEnablediEXT_client_proc_t glIsEnablediEXT;
+	glBufferStorageEXT_client_proc_t glBufferStorageEXT;
+	glGetProgramReflectionAEMU_client_proc_t glGetProgramReflectionAEMU;
+	glMaxShaderCompilerThreadsKHR_client_proc_t glMaxShaderCompilerThreadsKHR;
+	glStoreTextureContentAEMU_client_proc_t glStoreTextureContentAEMU;
+	glReleaseTextureContentAEMU_client_proc_t glReleaseTextureContentAEMU;
+	glTexImage2DContentAEMU_client_proc_t glTexImage2DContentAEMU;
+	glCompressedTexImage2DContentAEMU_client_proc_t glCompressedTexImage2DContentAEMU;
+	glDrawArraysListAEMU_client_proc_t glDrawArraysListAEMU;
+	glDrawElementsListAEMU_client_proc_t glDrawElementsListAEMU;
 	virtual ~gl2_client_context_t() {}
 
 	typedef gl2_client_context_t *CONTEXT_ACCESSOR_TYPE(void);
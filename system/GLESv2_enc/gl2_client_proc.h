@@ -451,6 +451,15 @@ typedef void (gl2_APIENTRY *glBlendFunciEXT_client_proc_t) (void * ctx, GLuint,
 typedef void (gl2_APIENTRY *glBlendFuncSeparateiEXT_client_proc_t) (void * ctx, GLuint, GLenum, GLenum, GLenum, GLenum);
 typedef void (gl2_APIENTRY *glColorMaskiEXT_client_proc_t) (void * ctx, GLuint, GLboolean, GLboolean, GLboolean, GLboolean);
 typedef GLboolean (gl2_APIENTRY *glIsEnablediEXT_client_proc_t) (void * ctx, GLenum, GLuint);
+typedef void (gl2_APIENTRY *glBufferStorageEXT_client_proc_t) (void * ctx, GLenum, GLsizeiptr, const void*, GLbitfield);
+typedef void (gl2_APIENTRY *glGetProgramReflectionAEMU_client_proc_t) (void * ctx, GLuint, GLsizei, GLsizei*, void*);
+typedef void (gl2_APIENTRY *glMaxShaderCompilerThreadsKHR_client_proc_t) (void * ctx, GLuint);
+typedef void (gl2_APIENTRY *glStoreTextureContentAEMU_client_proc_t) (void * ctx, GLuint, GLsizei, const void*);
+typedef void (gl2_APIENTRY *glReleaseTextureContentAEMU_client_proc_t) (void * ctx, GLuint);
+typedef void (gl2_APIENTRY *glTexImage2DContentAEMU_client_proc_t) (void * ctx, GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, GLuint);
+typedef void (gl2_APIENTRY *glCompressedTexImage2DContentAEMU_client_proc_t) (void * ctx, GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, GLuint);
+typedef void (gl2_APIENTRY *glDrawArraysListAEMU_client_proc_t) (void * ctx, GLenum, GLsizei, const GLint*);
+typedef void (gl2_APIENTRY *glDrawElementsListAEMU_client_proc_t) (void * ctx, GLenum, GLenum, GLsizei, const GLuint*);
 
 
 #endif
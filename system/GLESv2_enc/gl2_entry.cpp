@@ -444,6 +444,15 @@ extern "C" {
 	void glBlendFuncSeparateiEXT(GLuint index, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
 	void glColorMaskiEXT(GLuint index, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
 	GLboolean glIsEnablediEXT(GLenum cap, GLuint index);
+	void glBufferStorageEXT(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+	void glGetProgramReflectionAEMU(GLuint program, GLsizei bufSize, GLsizei* length, void* data);
+	void glMaxShaderCompilerThreadsKHR(GLuint count);
+	void glStoreTextureContentAEMU(GLuint content, GLsizei size, const void* data);
+	void glReleaseTextureContentAEMU(GLuint content);
+	void glTexImage2DContentAEMU(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, GLuint content);
+	void glCompressedTexImage2DContentAEMU(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, GLuint content);
+	void glDrawArraysListAEMU(GLenum mode, GLsizei drawCount, const GLint* firstsAndCounts);
+	void glDrawElementsListAEMU(GLenum mode, GLenum type, GLsizei drawCount, const GLuint* countsAndOffsets);
 };
 
 #ifndef GET_CONTEXT
@@ -3123,3 +3132,57 @@ GLboolean glIsEnablediEXT(GLenum cap, GLuint index)
 	return ctx->glIsEnablediEXT(ctx, cap, index);
 }
 
+void glBufferStorageEXT(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)
+{
+	GET_CONTEXT;
+	ctx->glBufferStorageEXT(ctx, target, size, data, flags);
+}
+
+void glGetProgramReflectionAEMU(GLuint program, GLsizei bufSize, GLsizei* length, void* data)
+{
+	GET_CONTEXT;
+	ctx->glGetProgramReflectionAEMU(ctx, program, bufSize, length, data);
+}
+
+void glMaxShaderCompilerThreadsKHR(GLuint count)
+{
+	GET_CONTEXT;
+	ctx->glMaxShaderCompilerThreadsKHR(ctx, count);
+}
+
+void glStoreTextureContentAEMU(GLuint content, GLsizei size, const void* data)
+{
+	GET_CONTEXT;
+	ctx->glStoreTextureContentAEMU(ctx, content, size, data);
+}
+
+void glReleaseTextureContentAEMU(GLuint content)
+{
+	GET_CONTEXT;
+	ctx->glReleaseTextureContentAEMU(ctx, content);
+}
+
+void glTexImage2DContentAEMU(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, GLuint content)
+{
+	GET_CONTEXT;
+	ctx->glTexImage2DContentAEMU(ctx, target, level, internalformat, width, height, border, format, type, content);
+}
+
+void glCompressedTexImage2DContentAEMU(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, GLuint content)
+{
+	GET_CONTEXT;
+	ctx->glCompressedTexImage2DContentAEMU(ctx, target, level, internalformat, width, height, border, imageSize, content);
+}
+
+void glDrawArraysListAEMU(GLenum mode, GLsizei drawCount, const GLint* firstsAndCounts)
+{
+	GET_CONTEXT;
+	ctx->glDrawArraysListAEMU(ctx, mode, drawCount, firstsAndCounts);
+}
+
+void glDrawElementsListAEMU(GLenum mode, GLenum type, GLsizei drawCount, const GLuint* countsAndOffsets)
+{
+	GET_CONTEXT;
+	ctx->glDrawElementsListAEMU(ctx, mode, type, drawCount, countsAndOffsets);
+}
+
@@ -4,403 +4,800 @@
 #define __gl2_client_ftable_t_h
 
 
-static const struct _gl2_funcs_by_name {
-	const char *name;
-	void *proc;
-} gl2_funcs_by_name[] = {
-	{"glActiveTexture", (void*)glActiveTexture},
-	{"glAttachShader", (void*)glAttachShader},
-	{"glBindAttribLocation", (void*)glBindAttribLocation},
-	{"glBindBuffer", (void*)glBindBuffer},
-	{"glBindFramebuffer", (void*)glBindFramebuffer},
-	{"glBindRenderbuffer", (void*)glBindRenderbuffer},
-	{"glBindTexture", (void*)glBindTexture},
-	{"glBlendColor", (void*)glBlendColor},
-	{"glBlendEquation", (void*)glBlendEquation},
-	{"glBlendEquationSeparate", (void*)glBlendEquationSeparate},
-	{"glBlendFunc", (void*)glBlendFunc},
-	{"glBlendFuncSeparate", (void*)glBlendFuncSeparate},
-	{"glBufferData", (void*)glBufferData},
-	{"glBufferSubData", (void*)glBufferSubData},
-	{"glCheckFramebufferStatus", (void*)glCheckFramebufferStatus},
-	{"glClear", (void*)glClear},
-	{"glClearColor", (void*)glClearColor},
-	{"glClearDepthf", (void*)glClearDepthf},
-	{"glClearStencil", (void*)glClearStencil},
-	{"glColorMask", (void*)glColorMask},
-	{"glCompileShader", (void*)glCompileShader},
-	{"glCompressedTexImage2D", (void*)glCompressedTexImage2D},
-	{"glCompressedTexSubImage2D", (void*)glCompressedTexSubImage2D},
-	{"glCopyTexImage2D", (void*)glCopyTexImage2D},
-	{"glCopyTexSubImage2D", (void*)glCopyTexSubImage2D},
-	{"glCreateProgram", (void*)glCreateProgram},
-	{"glCreateShader", (void*)glCreateShader},
-	{"glCullFace", (void*)glCullFace},
-	{"glDeleteBuffers", (void*)glDeleteBuffers},
-	{"glDeleteFramebuffers", (void*)glDeleteFramebuffers},
-	{"glDeleteProgram", (void*)glDeleteProgram},
-	{"glDeleteRenderbuffers", (void*)glDeleteRenderbuffers},
-	{"glDeleteShader", (void*)glDeleteShader},
-	{"glDeleteTextures", (void*)glDeleteTextures},
-	{"glDepthFunc", (void*)glDepthFunc},
-	{"glDepthMask", (void*)glDepthMask},
-	{"glDepthRangef", (void*)glDepthRangef},
-	{"glDetachShader", (void*)glDetachShader},
-	{"glDisable", (void*)glDisable},
-	{"glDisableVertexAttribArray", (void*)glDisableVertexAttribArray},
-	{"glDrawArrays", (void*)glDrawArrays},
-	{"glDrawElements", (void*)glDrawElements},
-	{"glEnable", (void*)glEnable},
-	{"glEnableVertexAttribArray", (void*)glEnableVertexAttribArray},
-	{"glFinish", (void*)glFinish},
-	{"glFlush", (void*)glFlush},
-	{"glFramebufferRenderbuffer", (void*)glFramebufferRenderbuffer},
-	{"glFramebufferTexture2D", (void*)glFramebufferTexture2D},
-	{"glFrontFace", (void*)glFrontFace},
-	{"glGenBuffers", (void*)glGenBuffers},
-	{"glGenerateMipmap", (void*)glGenerateMipmap},
-	{"glGenFramebuffers", (void*)glGenFramebuffers},
-	{"glGenRenderbuffers", (void*)glGenRenderbuffers},
-	{"glGenTextures", (void*)glGenTextures},
-	{"glGetActiveAttrib", (void*)glGetActiveAttrib},
-	{"glGetActiveUniform", (void*)glGetActiveUniform},
-	{"glGetAttachedShaders", (void*)glGetAttachedShaders},
-	{"glGetAttribLocation", (void*)glGetAttribLocation},
-	{"glGetBooleanv", (void*)glGetBooleanv},
-	{"glGetBufferParameteriv", (void*)glGetBufferParameteriv},
-	{"glGetError", (void*)glGetError},
-	{"glGetFloatv", (void*)glGetFloatv},
-	{"glGetFramebufferAttachmentParameteriv", (void*)glGetFramebufferAttachmentParameteriv},
-	{"glGetIntegerv", (void*)glGetIntegerv},
-	{"glGetProgramiv", (void*)glGetProgramiv},
-	{"glGetProgramInfoLog", (void*)glGetProgramInfoLog},
-	{"glGetRenderbufferParameteriv", (void*)glGetRenderbufferParameteriv},
-	{"glGetShaderiv", (void*)glGetShaderiv},
-	{"glGetShaderInfoLog", (void*)glGetShaderInfoLog},
-	{"glGetShaderPrecisionFormat", (void*)glGetShaderPrecisionFormat},
-	{"glGetShaderSource", (void*)glGetShaderSource},
-	{"glGetString", (void*)glGetString},
-	{"glGetTexParameterfv", (void*)glGetTexParameterfv},
-	{"glGetTexParameteriv", (void*)glGetTexParameteriv},
-	{"glGetUniformfv", (void*)glGetUniformfv},
-	{"glGetUniformiv", (void*)glGetUniformiv},
-	{"glGetUniformLocation", (void*)glGetUniformLocation},
-	{"glGetVertexAttribfv", (void*)glGetVertexAttribfv},
-	{"glGetVertexAttribiv", (void*)glGetVertexAttribiv},
-	{"glGetVertexAttribPointerv", (void*)glGetVertexAttribPointerv},
-	{"glHint", (void*)glHint},
-	{"glIsBuffer", (void*)glIsBuffer},
-	{"glIsEnabled", (void*)glIsEnabled},
-	{"glIsFramebuffer", (void*)glIsFramebuffer},
-	{"glIsProgram", (void*)glIsProgram},
-	{"glIsRenderbuffer", (void*)glIsRenderbuffer},
-	{"glIsShader", (void*)glIsShader},
-	{"glIsTexture", (void*)glIsTexture},
-	{"glLineWidth", (void*)glLineWidth},
-	{"glLinkProgram", (void*)glLinkProgram},
-	{"glPixelStorei", (void*)glPixelStorei},
-	{"glPolygonOffset", (void*)glPolygonOffset},
-	{"glReadPixels", (void*)glReadPixels},
-	{"glReleaseShaderCompiler", (void*)glReleaseShaderCompiler},
-	{"glRenderbufferStorage", (void*)glRenderbufferStorage},
-	{"glSampleCoverage", (void*)glSampleCoverage},
-	{"glScissor", (void*)glScissor},
-	{"glShaderBinary", (void*)glShaderBinary},
-	{"glShaderSource", (void*)glShaderSource},
-	{"glStencilFunc", (void*)glStencilFunc},
-	{"glStencilFuncSeparate", (void*)glStencilFuncSeparate},
-	{"glStencilMask", (void*)glStencilMask},
-	{"glStencilMaskSeparate", (void*)glStencilMaskSeparate},
-	{"glStencilOp", (void*)glStencilOp},
-	{"glStencilOpSeparate", (void*)glStencilOpSeparate},
-	{"glTexImage2D", (void*)glTexImage2D},
-	{"glTexParameterf", (void*)glTexParameterf},
-	{"glTexParameterfv", (void*)glTexParameterfv},
-	{"glTexParameteri", (void*)glTexParameteri},
-	{"glTexParameteriv", (void*)glTexParameteriv},
-	{"glTexSubImage2D", (void*)glTexSubImage2D},
-	{"glUniform1f", (void*)glUniform1f},
-	{"glUniform1fv", (void*)glUniform1fv},
-	{"glUniform1i", (void*)glUniform1i},
-	{"glUniform1iv", (void*)glUniform1iv},
-	{"glUniform2f", (void*)glUniform2f},
-	{"glUniform2fv", (void*)glUniform2fv},
-	{"glUniform2i", (void*)glUniform2i},
-	{"glUniform2iv", (void*)glUniform2iv},
-	{"glUniform3f", (void*)glUniform3f},
-	{"glUniform3fv", (void*)glUniform3fv},
-	{"glUniform3i", (void*)glUniform3i},
-	{"glUniform3iv", (void*)glUniform3iv},
-	{"glUniform4f", (void*)glUniform4f},
-	{"glUniform4fv", (void*)glUniform4fv},
-	{"glUniform4i", (void*)glUniform4i},
-	{"glUniform4iv", (void*)glUniform4iv},
-	{"glUniformMatrix2fv", (void*)glUniformMatrix2fv},
-	{"glUniformMatrix3fv", (void*)glUniformMatrix3fv},
-	{"glUniformMatrix4fv", (void*)glUniformMatrix4fv},
-	{"glUseProgram", (void*)glUseProgram},
-	{"glValidateProgram", (void*)glValidateProgram},
-	{"glVertexAttrib1f", (void*)glVertexAttrib1f},
-	{"glVertexAttrib1fv", (void*)glVertexAttrib1fv},
-	{"glVertexAttrib2f", (void*)glVertexAttrib2f},
-	{"glVertexAttrib2fv", (void*)glVertexAttrib2fv},
-	{"glVertexAttrib3f", (void*)glVertexAttrib3f},
-	{"glVertexAttrib3fv", (void*)glVertexAttrib3fv},
-	{"glVertexAttrib4f", (void*)glVertexAttrib4f},
-	{"glVertexAttrib4fv", (void*)glVertexAttrib4fv},
-	{"glVertexAttribPointer", (void*)glVertexAttribPointer},
-	{"glViewport", (void*)glViewport},
-	{"glEGLImageTargetTexture2DOES", (void*)glEGLImageTargetTexture2DOES},
-	{"glEGLImageTargetRenderbufferStorageOES", (void*)glEGLImageTargetRenderbufferStorageOES},
-	{"glGetProgramBinaryOES", (void*)glGetProgramBinaryOES},
-	{"glProgramBinaryOES", (void*)glProgramBinaryOES},
-	{"glMapBufferOES", (void*)glMapBufferOES},
-	{"glUnmapBufferOES", (void*)glUnmapBufferOES},
-	{"glTexImage3DOES", (void*)glTexImage3DOES},
-	{"glTexSubImage3DOES", (void*)glTexSubImage3DOES},
-	{"glCopyTexSubImage3DOES", (void*)glCopyTexSubImage3DOES},
-	{"glCompressedTexImage3DOES", (void*)glCompressedTexImage3DOES},
-	{"glCompressedTexSubImage3DOES", (void*)glCompressedTexSubImage3DOES},
-	{"glFramebufferTexture3DOES", (void*)glFramebufferTexture3DOES},
-	{"glBindVertexArrayOES", (void*)glBindVertexArrayOES},
-	{"glDeleteVertexArraysOES", (void*)glDeleteVertexArraysOES},
-	{"glGenVertexArraysOES", (void*)glGenVertexArraysOES},
-	{"glIsVertexArrayOES", (void*)glIsVertexArrayOES},
-	{"glDiscardFramebufferEXT", (void*)glDiscardFramebufferEXT},
-	{"glMultiDrawArraysEXT", (void*)glMultiDrawArraysEXT},
-	{"glMultiDrawElementsEXT", (void*)glMultiDrawElementsEXT},
-	{"glGetPerfMonitorGroupsAMD", (void*)glGetPerfMonitorGroupsAMD},
-	{"glGetPerfMonitorCountersAMD", (void*)glGetPerfMonitorCountersAMD},
-	{"glGetPerfMonitorGroupStringAMD", (void*)glGetPerfMonitorGroupStringAMD},
-	{"glGetPerfMonitorCounterStringAMD", (void*)glGetPerfMonitorCounterStringAMD},
-	{"glGetPerfMonitorCounterInfoAMD", (void*)glGetPerfMonitorCounterInfoAMD},
-	{"glGenPerfMonitorsAMD", (void*)glGenPerfMonitorsAMD},
-	{"glDeletePerfMonitorsAMD", (void*)glDeletePerfMonitorsAMD},
-	{"glSelectPerfMonitorCountersAMD", (void*)glSelectPerfMonitorCountersAMD},
-	{"glBeginPerfMonitorAMD", (void*)glBeginPerfMonitorAMD},
-	{"glEndPerfMonitorAMD", (void*)glEndPerfMonitorAMD},
-	{"glGetPerfMonitorCounterDataAMD", (void*)glGetPerfMonitorCounterDataAMD},
-	{"glRenderbufferStorageMultisampleIMG", (void*)glRenderbufferStorageMultisampleIMG},
-	{"glFramebufferTexture2DMultisampleIMG", (void*)glFramebufferTexture2DMultisampleIMG},
-	{"glDeleteFencesNV", (void*)glDeleteFencesNV},
-	{"glGenFencesNV", (void*)glGenFencesNV},
-	{"glIsFenceNV", (void*)glIsFenceNV},
-	{"glTestFenceNV", (void*)glTestFenceNV},
-	{"glGetFenceivNV", (void*)glGetFenceivNV},
-	{"glFinishFenceNV", (void*)glFinishFenceNV},
-	{"glSetFenceNV", (void*)glSetFenceNV},
-	{"glCoverageMaskNV", (void*)glCoverageMaskNV},
-	{"glCoverageOperationNV", (void*)glCoverageOperationNV},
-	{"glGetDriverControlsQCOM", (void*)glGetDriverControlsQCOM},
-	{"glGetDriverControlStringQCOM", (void*)glGetDriverControlStringQCOM},
-	{"glEnableDriverControlQCOM", (void*)glEnableDriverControlQCOM},
-	{"glDisableDriverControlQCOM", (void*)glDisableDriverControlQCOM},
-	{"glExtGetTexturesQCOM", (void*)glExtGetTexturesQCOM},
-	{"glExtGetBuffersQCOM", (void*)glExtGetBuffersQCOM},
-	{"glExtGetRenderbuffersQCOM", (void*)glExtGetRenderbuffersQCOM},
-	{"glExtGetFramebuffersQCOM", (void*)glExtGetFramebuffersQCOM},
-	{"glExtGetTexLevelParameterivQCOM", (void*)glExtGetTexLevelParameterivQCOM},
-	{"glExtTexObjectStateOverrideiQCOM", (void*)glExtTexObjectStateOverrideiQCOM},
-	{"glExtGetTexSubImageQCOM", (void*)glExtGetTexSubImageQCOM},
-	{"glExtGetBufferPointervQCOM", (void*)glExtGetBufferPointervQCOM},
-	{"glExtGetShadersQCOM", (void*)glExtGetShadersQCOM},
-	{"glExtGetProgramsQCOM", (void*)glExtGetProgramsQCOM},
-	{"glExtIsProgramBinaryQCOM", (void*)glExtIsProgramBinaryQCOM},
-	{"glExtGetProgramBinarySourceQCOM", (void*)glExtGetProgramBinarySourceQCOM},
-	{"glStartTilingQCOM", (void*)glStartTilingQCOM},
-	{"glEndTilingQCOM", (void*)glEndTilingQCOM},
-	{"glGenVertexArrays", (void*)glGenVertexArrays},
-	{"glBindVertexArray", (void*)glBindVertexArray},
-	{"glDeleteVertexArrays", (void*)glDeleteVertexArrays},
-	{"glIsVertexArray", (void*)glIsVertexArray},
-	{"glMapBufferRange", (void*)glMapBufferRange},
-	{"glUnmapBuffer", (void*)glUnmapBuffer},
-	{"glFlushMappedBufferRange", (void*)glFlushMappedBufferRange},
-	{"glBindBufferRange", (void*)glBindBufferRange},
-	{"glBindBufferBase", (void*)glBindBufferBase},
-	{"glCopyBufferSubData", (void*)glCopyBufferSubData},
-	{"glClearBufferiv", (void*)glClearBufferiv},
-	{"glClearBufferuiv", (void*)glClearBufferuiv},
-	{"glClearBufferfv", (void*)glClearBufferfv},
-	{"glClearBufferfi", (void*)glClearBufferfi},
-	{"glGetBufferParameteri64v", (void*)glGetBufferParameteri64v},
-	{"glGetBufferPointerv", (void*)glGetBufferPointerv},
-	{"glUniformBlockBinding", (void*)glUniformBlockBinding},
-	{"glGetUniformBlockIndex", (void*)glGetUniformBlockIndex},
-	{"glGetUniformIndices", (void*)glGetUniformIndices},
-	{"glGetActiveUniformBlockiv", (void*)glGetActiveUniformBlockiv},
-	{"glGetActiveUniformBlockName", (void*)glGetActiveUniformBlockName},
-	{"glUniform1ui", (void*)glUniform1ui},
-	{"glUniform2ui", (void*)glUniform2ui},
-	{"glUniform3ui", (void*)glUniform3ui},
-	{"glUniform4ui", (void*)glUniform4ui},
-	{"glUniform1uiv", (void*)glUniform1uiv},
-	{"glUniform2uiv", (void*)glUniform2uiv},
-	{"glUniform3uiv", (void*)glUniform3uiv},
-	{"glUniform4uiv", (void*)glUniform4uiv},
-	{"glUniformMatrix2x3fv", (void*)glUniformMatrix2x3fv},
-	{"glUniformMatrix3x2fv", (void*)glUniformMatrix3x2fv},
-	{"glUniformMatrix2x4fv", (void*)glUniformMatrix2x4fv},
-	{"glUniformMatrix4x2fv", (void*)glUniformMatrix4x2fv},
-	{"glUniformMatrix3x4fv", (void*)glUniformMatrix3x4fv},
-	{"glUniformMatrix4x3fv", (void*)glUniformMatrix4x3fv},
-	{"glGetUniformuiv", (void*)glGetUniformuiv},
-	{"glGetActiveUniformsiv", (void*)glGetActiveUniformsiv},
-	{"glVertexAttribI4i", (void*)glVertexAttribI4i},
-	{"glVertexAttribI4ui", (void*)glVertexAttribI4ui},
-	{"glVertexAttribI4iv", (void*)glVertexAttribI4iv},
-	{"glVertexAttribI4uiv", (void*)glVertexAttribI4uiv},
-	{"glVertexAttribIPointer", (void*)glVertexAttribIPointer},
-	{"glGetVertexAttribIiv", (void*)glGetVertexAttribIiv},
-	{"glGetVertexAttribIuiv", (void*)glGetVertexAttribIuiv},
-	{"glVertexAttribDivisor", (void*)glVertexAttribDivisor},
-	{"glDrawArraysInstanced", (void*)glDrawArraysInstanced},
-	{"glDrawElementsInstanced", (void*)glDrawElementsInstanced},
-	{"glDrawRangeElements", (void*)glDrawRangeElements},
-	{"glFenceSync", (void*)glFenceSync},
-	{"glClientWaitSync", (void*)glClientWaitSync},
-	{"glWaitSync", (void*)glWaitSync},
-	{"glDeleteSync", (void*)glDeleteSync},
-	{"glIsSync", (void*)glIsSync},
-	{"glGetSynciv", (void*)glGetSynciv},
-	{"glDrawBuffers", (void*)glDrawBuffers},
-	{"glReadBuffer", (void*)glReadBuffer},
-	{"glBlitFramebuffer", (void*)glBlitFramebuffer},
-	{"glInvalidateFramebuffer", (void*)glInvalidateFramebuffer},
-	{"glInvalidateSubFramebuffer", (void*)glInvalidateSubFramebuffer},
-	{"glFramebufferTextureLayer", (void*)glFramebufferTextureLayer},
-	{"glRenderbufferStorageMultisample", (void*)glRenderbufferStorageMultisample},
-	{"glTexStorage2D", (void*)glTexStorage2D},
-	{"glGetInternalformativ", (void*)glGetInternalformativ},
-	{"glBeginTransformFeedback", (void*)glBeginTransformFeedback},
-	{"glEndTransformFeedback", (void*)glEndTransformFeedback},
-	{"glGenTransformFeedbacks", (void*)glGenTransformFeedbacks},
-	{"glDeleteTransformFeedbacks", (void*)glDeleteTransformFeedbacks},
-	{"glBindTransformFeedback", (void*)glBindTransformFeedback},
-	{"glPauseTransformFeedback", (void*)glPauseTransformFeedback},
-	{"glResumeTransformFeedback", (void*)glResumeTransformFeedback},
-	{"glIsTransformFeedback", (void*)glIsTransformFeedback},
-	{"glTransformFeedbackVaryings", (void*)glTransformFeedbackVaryings},
-	{"glGetTransformFeedbackVarying", (void*)glGetTransformFeedbackVarying},
-	{"glGenSamplers", (void*)glGenSamplers},
-	{"glDeleteSamplers", (void*)glDeleteSamplers},
-	{"glBindSampler", (void*)glBindSampler},
-	{"glSamplerParameterf", (void*)glSamplerParameterf},
-	{"glSamplerParameteri", (void*)glSamplerParameteri},
-	{"glSamplerParameterfv", (void*)glSamplerParameterfv},
-	{"glSamplerParameteriv", (void*)glSamplerParameteriv},
-	{"glGetSamplerParameterfv", (void*)glGetSamplerParameterfv},
-	{"glGetSamplerParameteriv", (void*)glGetSamplerParameteriv},
-	{"glIsSampler", (void*)glIsSampler},
-	{"glGenQueries", (void*)glGenQueries},
-	{"glDeleteQueries", (void*)glDeleteQueries},
-	{"glBeginQuery", (void*)glBeginQuery},
-	{"glEndQuery", (void*)glEndQuery},
-	{"glGetQueryiv", (void*)glGetQueryiv},
-	{"glGetQueryObjectuiv", (void*)glGetQueryObjectuiv},
-	{"glIsQuery", (void*)glIsQuery},
-	{"glProgramParameteri", (void*)glProgramParameteri},
-	{"glProgramBinary", (void*)glProgramBinary},
-	{"glGetProgramBinary", (void*)glGetProgramBinary},
-	{"glGetFragDataLocation", (void*)glGetFragDataLocation},
-	{"glGetInteger64v", (void*)glGetInteger64v},
-	{"glGetIntegeri_v", (void*)glGetIntegeri_v},
-	{"glGetInteger64i_v", (void*)glGetInteger64i_v},
-	{"glTexImage3D", (void*)glTexImage3D},
-	{"glTexStorage3D", (void*)glTexStorage3D},
-	{"glTexSubImage3D", (void*)glTexSubImage3D},
-	{"glCompressedTexImage3D", (void*)glCompressedTexImage3D},
-	{"glCompressedTexSubImage3D", (void*)glCompressedTexSubImage3D},
-	{"glCopyTexSubImage3D", (void*)glCopyTexSubImage3D},
-	{"glGetStringi", (void*)glGetStringi},
-	{"glGetBooleani_v", (void*)glGetBooleani_v},
-	{"glMemoryBarrier", (void*)glMemoryBarrier},
-	{"glMemoryBarrierByRegion", (void*)glMemoryBarrierByRegion},
-	{"glGenProgramPipelines", (void*)glGenProgramPipelines},
-	{"glDeleteProgramPipelines", (void*)glDeleteProgramPipelines},
-	{"glBindProgramPipeline", (void*)glBindProgramPipeline},
-	{"glGetProgramPipelineiv", (void*)glGetProgramPipelineiv},
-	{"glGetProgramPipelineInfoLog", (void*)glGetProgramPipelineInfoLog},
-	{"glValidateProgramPipeline", (void*)glValidateProgramPipeline},
-	{"glIsProgramPipeline", (void*)glIsProgramPipeline},
-	{"glUseProgramStages", (void*)glUseProgramStages},
-	{"glActiveShaderProgram", (void*)glActiveShaderProgram},
-	{"glCreateShaderProgramv", (void*)glCreateShaderProgramv},
-	{"glProgramUniform1f", (void*)glProgramUniform1f},
-	{"glProgramUniform2f", (void*)glProgramUniform2f},
-	{"glProgramUniform3f", (void*)glProgramUniform3f},
-	{"glProgramUniform4f", (void*)glProgramUniform4f},
-	{"glProgramUniform1i", (void*)glProgramUniform1i},
-	{"glProgramUniform2i", (void*)glProgramUniform2i},
-	{"glProgramUniform3i", (void*)glProgramUniform3i},
-	{"glProgramUniform4i", (void*)glProgramUniform4i},
-	{"glProgramUniform1ui", (void*)glProgramUniform1ui},
-	{"glProgramUniform2ui", (void*)glProgramUniform2ui},
-	{"glProgramUniform3ui", (void*)glProgramUniform3ui},
-	{"glProgramUniform4ui", (void*)glProgramUniform4ui},
-	{"glProgramUniform1fv", (void*)glProgramUniform1fv},
-	{"glProgramUniform2fv", (void*)glProgramUniform2fv},
-	{"glProgramUniform3fv", (void*)glProgramUniform3fv},
-	{"glProgramUniform4fv", (void*)glProgramUniform4fv},
-	{"glProgramUniform1iv", (void*)glProgramUniform1iv},
-	{"glProgramUniform2iv", (void*)glProgramUniform2iv},
-	{"glProgramUniform3iv", (void*)glProgramUniform3iv},
-	{"glProgramUniform4iv", (void*)glProgramUniform4iv},
-	{"glProgramUniform1uiv", (void*)glProgramUniform1uiv},
-	{"glProgramUniform2uiv", (void*)glProgramUniform2uiv},
-	{"glProgramUniform3uiv", (void*)glProgramUniform3uiv},
-	{"glProgramUniform4uiv", (void*)glProgramUniform4uiv},
-	{"glProgramUniformMatrix2fv", (void*)glProgramUniformMatrix2fv},
-	{"glProgramUniformMatrix3fv", (void*)glProgramUniformMatrix3fv},
-	{"glProgramUniformMatrix4fv", (void*)glProgramUniformMatrix4fv},
-	{"glProgramUniformMatrix2x3fv", (void*)glProgramUniformMatrix2x3fv},
-	{"glProgramUniformMatrix3x2fv", (void*)glProgramUniformMatrix3x2fv},
-	{"glProgramUniformMatrix2x4fv", (void*)glProgramUniformMatrix2x4fv},
-	{"glProgramUniformMatrix4x2fv", (void*)glProgramUniformMatrix4x2fv},
-	{"glProgramUniformMatrix3x4fv", (void*)glProgramUniformMatrix3x4fv},
-	{"glProgramUniformMatrix4x3fv", (void*)glProgramUniformMatrix4x3fv},
-	{"glGetProgramInterfaceiv", (void*)glGetProgramInterfaceiv},
-	{"glGetProgramResourceiv", (void*)glGetProgramResourceiv},
-	{"glGetProgramResourceIndex", (void*)glGetProgramResourceIndex},
-	{"glGetProgramResourceLocation", (void*)glGetProgramResourceLocation},
-	{"glGetProgramResourceName", (void*)glGetProgramResourceName},
-	{"glBindImageTexture", (void*)glBindImageTexture},
-	{"glDispatchCompute", (void*)glDispatchCompute},
-	{"glDispatchComputeIndirect", (void*)glDispatchComputeIndirect},
-	{"glBindVertexBuffer", (void*)glBindVertexBuffer},
-	{"glVertexAttribBinding", (void*)glVertexAttribBinding},
-	{"glVertexAttribFormat", (void*)glVertexAttribFormat},
-	{"glVertexAttribIFormat", (void*)glVertexAttribIFormat},
-	{"glVertexBindingDivisor", (void*)glVertexBindingDivisor},
-	{"glDrawArraysIndirect", (void*)glDrawArraysIndirect},
-	{"glDrawElementsIndirect", (void*)glDrawElementsIndirect},
-	{"glTexStorage2DMultisample", (void*)glTexStorage2DMultisample},
-	{"glSampleMaski", (void*)glSampleMaski},
-	{"glGetMultisamplefv", (void*)glGetMultisamplefv},
-	{"glFramebufferParameteri", (void*)glFramebufferParameteri},
-	{"glGetFramebufferParameteriv", (void*)glGetFramebufferParameteriv},
-	{"glGetTexLevelParameterfv", (void*)glGetTexLevelParameterfv},
-	{"glGetTexLevelParameteriv", (void*)glGetTexLevelParameteriv},
-	{"glGetGraphicsResetStatusEXT", (void*)glGetGraphicsResetStatusEXT},
-	{"glReadnPixelsEXT", (void*)glReadnPixelsEXT},
-	{"glGetnUniformfvEXT", (void*)glGetnUniformfvEXT},
-	{"glGetnUniformivEXT", (void*)glGetnUniformivEXT},
-	{"glDrawArraysNullAEMU", (void*)glDrawArraysNullAEMU},
-	{"glDrawElementsNullAEMU", (void*)glDrawElementsNullAEMU},
-	{"glTexBufferOES", (void*)glTexBufferOES},
-	{"glTexBufferRangeOES", (void*)glTexBufferRangeOES},
-	{"glTexBufferEXT", (void*)glTexBufferEXT},
-	{"glTexBufferRangeEXT", (void*)glTexBufferRangeEXT},
-	{"glEnableiEXT", (void*)glEnableiEXT},
-	{"glDisableiEXT", (void*)glDisableiEXT},
-	{"glBlendEquationiEXT", (void*)glBlendEquationiEXT},
-	{"glBlendEquationSeparateiEXT", (void*)glBlendEquationSeparateiEXT},
-	{"glBlendFunciEXT", (void*)glBlendFunciEXT},
-	{"glBlendFuncSeparateiEXT", (void*)glBlendFuncSeparateiEXT},
-	{"glColorMaskiEXT", (void*)glColorMaskiEXT},
-	{"glIsEnablediEXT", (void*)glIsEnablediEXT},
+// Names one after another, each with its terminating NUL, in the order of
+// gl2_funcs_by_proc. Keeping them out of pointer tables spares the
+// library a relocation per entry point at load time.
+static const char gl2_funcs_names[] =
+	"glActiveTexture\0"
+	"glAttachShader\0"
+	"glBindAttribLocation\0"
+	"glBindBuffer\0"
+	"glBindFramebuffer\0"
+	"glBindRenderbuffer\0"
+	"glBindTexture\0"
+	"glBlendColor\0"
+	"glBlendEquation\0"
+	"glBlendEquationSeparate\0"
+	"glBlendFunc\0"
+	"glBlendFuncSeparate\0"
+	"glBufferData\0"
+	"glBufferSubData\0"
+	"glCheckFramebufferStatus\0"
+	"glClear\0"
+	"glClearColor\0"
+	"glClearDepthf\0"
+	"glClearStencil\0"
+	"glColorMask\0"
+	"glCompileShader\0"
+	"glCompressedTexImage2D\0"
+	"glCompressedTexSubImage2D\0"
+	"glCopyTexImage2D\0"
+	"glCopyTexSubImage2D\0"
+	"glCreateProgram\0"
+	"glCreateShader\0"
+	"glCullFace\0"
+	"glDeleteBuffers\0"
+	"glDeleteFramebuffers\0"
+	"glDeleteProgram\0"
+	"glDeleteRenderbuffers\0"
+	"glDeleteShader\0"
+	"glDeleteTextures\0"
+	"glDepthFunc\0"
+	"glDepthMask\0"
+	"glDepthRangef\0"
+	"glDetachShader\0"
+	"glDisable\0"
+	"glDisableVertexAttribArray\0"
+	"glDrawArrays\0"
+	"glDrawElements\0"
+	"glEnable\0"
+	"glEnableVertexAttribArray\0"
+	"glFinish\0"
+	"glFlush\0"
+	"glFramebufferRenderbuffer\0"
+	"glFramebufferTexture2D\0"
+	"glFrontFace\0"
+	"glGenBuffers\0"
+	"glGenerateMipmap\0"
+	"glGenFramebuffers\0"
+	"glGenRenderbuffers\0"
+	"glGenTextures\0"
+	"glGetActiveAttrib\0"
+	"glGetActiveUniform\0"
+	"glGetAttachedShaders\0"
+	"glGetAttribLocation\0"
+	"glGetBooleanv\0"
+	"glGetBufferParameteriv\0"
+	"glGetError\0"
+	"glGetFloatv\0"
+	"glGetFramebufferAttachmentParameteriv\0"
+	"glGetIntegerv\0"
+	"glGetProgramiv\0"
+	"glGetProgramInfoLog\0"
+	"glGetRenderbufferParameteriv\0"
+	"glGetShaderiv\0"
+	"glGetShaderInfoLog\0"
+	"glGetShaderPrecisionFormat\0"
+	"glGetShaderSource\0"
+	"glGetString\0"
+	"glGetTexParameterfv\0"
+	"glGetTexParameteriv\0"
+	"glGetUniformfv\0"
+	"glGetUniformiv\0"
+	"glGetUniformLocation\0"
+	"glGetVertexAttribfv\0"
+	"glGetVertexAttribiv\0"
+	"glGetVertexAttribPointerv\0"
+	"glHint\0"
+	"glIsBuffer\0"
+	"glIsEnabled\0"
+	"glIsFramebuffer\0"
+	"glIsProgram\0"
+	"glIsRenderbuffer\0"
+	"glIsShader\0"
+	"glIsTexture\0"
+	"glLineWidth\0"
+	"glLinkProgram\0"
+	"glPixelStorei\0"
+	"glPolygonOffset\0"
+	"glReadPixels\0"
+	"glReleaseShaderCompiler\0"
+	"glRenderbufferStorage\0"
+	"glSampleCoverage\0"
+	"glScissor\0"
+	"glShaderBinary\0"
+	"glShaderSource\0"
+	"glStencilFunc\0"
+	"glStencilFuncSeparate\0"
+	"glStencilMask\0"
+	"glStencilMaskSeparate\0"
+	"glStencilOp\0"
+	"glStencilOpSeparate\0"
+	"glTexImage2D\0"
+	"glTexParameterf\0"
+	"glTexParameterfv\0"
+	"glTexParameteri\0"
+	"glTexParameteriv\0"
+	"glTexSubImage2D\0"
+	"glUniform1f\0"
+	"glUniform1fv\0"
+	"glUniform1i\0"
+	"glUniform1iv\0"
+	"glUniform2f\0"
+	"glUniform2fv\0"
+	"glUniform2i\0"
+	"glUniform2iv\0"
+	"glUniform3f\0"
+	"glUniform3fv\0"
+	"glUniform3i\0"
+	"glUniform3iv\0"
+	"glUniform4f\0"
+	"glUniform4fv\0"
+	"glUniform4i\0"
+	"glUniform4iv\0"
+	"glUniformMatrix2fv\0"
+	"glUniformMatrix3fv\0"
+	"glUniformMatrix4fv\0"
+	"glUseProgram\0"
+	"glValidateProgram\0"
+	"glVertexAttrib1f\0"
+	"glVertexAttrib1fv\0"
+	"glVertexAttrib2f\0"
+	"glVertexAttrib2fv\0"
+	"glVertexAttrib3f\0"
+	"glVertexAttrib3fv\0"
+	"glVertexAttrib4f\0"
+	"glVertexAttrib4fv\0"
+	"glVertexAttribPointer\0"
+	"glViewport\0"
+	"glEGLImageTargetTexture2DOES\0"
+	"glEGLImageTargetRenderbufferStorageOES\0"
+	"glGetProgramBinaryOES\0"
+	"glProgramBinaryOES\0"
+	"glMapBufferOES\0"
+	"glUnmapBufferOES\0"
+	"glTexImage3DOES\0"
+	"glTexSubImage3DOES\0"
+	"glCopyTexSubImage3DOES\0"
+	"glCompressedTexImage3DOES\0"
+	"glCompressedTexSubImage3DOES\0"
+	"glFramebufferTexture3DOES\0"
+	"glBindVertexArrayOES\0"
+	"glDeleteVertexArraysOES\0"
+	"glGenVertexArraysOES\0"
+	"glIsVertexArrayOES\0"
+	"glDiscardFramebufferEXT\0"
+	"glMultiDrawArraysEXT\0"
+	"glMultiDrawElementsEXT\0"
+	"glGetPerfMonitorGroupsAMD\0"
+	"glGetPerfMonitorCountersAMD\0"
+	"glGetPerfMonitorGroupStringAMD\0"
+	"glGetPerfMonitorCounterStringAMD\0"
+	"glGetPerfMonitorCounterInfoAMD\0"
+	"glGenPerfMonitorsAMD\0"
+	"glDeletePerfMonitorsAMD\0"
+	"glSelectPerfMonitorCountersAMD\0"
+	"glBeginPerfMonitorAMD\0"
+	"glEndPerfMonitorAMD\0"
+	"glGetPerfMonitorCounterDataAMD\0"
+	"glRenderbufferStorageMultisampleIMG\0"
+	"glFramebufferTexture2DMultisampleIMG\0"
+	"glDeleteFencesNV\0"
+	"glGenFencesNV\0"
+	"glIsFenceNV\0"
+	"glTestFenceNV\0"
+	"glGetFenceivNV\0"
+	"glFinishFenceNV\0"
+	"glSetFenceNV\0"
+	"glCoverageMaskNV\0"
+	"glCoverageOperationNV\0"
+	"glGetDriverControlsQCOM\0"
+	"glGetDriverControlStringQCOM\0"
+	"glEnableDriverControlQCOM\0"
+	"glDisableDriverControlQCOM\0"
+	"glExtGetTexturesQCOM\0"
+	"glExtGetBuffersQCOM\0"
+	"glExtGetRenderbuffersQCOM\0"
+	"glExtGetFramebuffersQCOM\0"
+	"glExtGetTexLevelParameterivQCOM\0"
+	"glExtTexObjectStateOverrideiQCOM\0"
+	"glExtGetTexSubImageQCOM\0"
+	"glExtGetBufferPointervQCOM\0"
+	"glExtGetShadersQCOM\0"
+	"glExtGetProgramsQCOM\0"
+	"glExtIsProgramBinaryQCOM\0"
+	"glExtGetProgramBinarySourceQCOM\0"
+	"glStartTilingQCOM\0"
+	"glEndTilingQCOM\0"
+	"glGenVertexArrays\0"
+	"glBindVertexArray\0"
+	"glDeleteVertexArrays\0"
+	"glIsVertexArray\0"
+	"glMapBufferRange\0"
+	"glUnmapBuffer\0"
+	"glFlushMappedBufferRange\0"
+	"glBindBufferRange\0"
+	"glBindBufferBase\0"
+	"glCopyBufferSubData\0"
+	"glClearBufferiv\0"
+	"glClearBufferuiv\0"
+	"glClearBufferfv\0"
+	"glClearBufferfi\0"
+	"glGetBufferParameteri64v\0"
+	"glGetBufferPointerv\0"
+	"glUniformBlockBinding\0"
+	"glGetUniformBlockIndex\0"
+	"glGetUniformIndices\0"
+	"glGetActiveUniformBlockiv\0"
+	"glGetActiveUniformBlockName\0"
+	"glUniform1ui\0"
+	"glUniform2ui\0"
+	"glUniform3ui\0"
+	"glUniform4ui\0"
+	"glUniform1uiv\0"
+	"glUniform2uiv\0"
+	"glUniform3uiv\0"
+	"glUniform4uiv\0"
+	"glUniformMatrix2x3fv\0"
+	"glUniformMatrix3x2fv\0"
+	"glUniformMatrix2x4fv\0"
+	"glUniformMatrix4x2fv\0"
+	"glUniformMatrix3x4fv\0"
+	"glUniformMatrix4x3fv\0"
+	"glGetUniformuiv\0"
+	"glGetActiveUniformsiv\0"
+	"glVertexAttribI4i\0"
+	"glVertexAttribI4ui\0"
+	"glVertexAttribI4iv\0"
+	"glVertexAttribI4uiv\0"
+	"glVertexAttribIPointer\0"
+	"glGetVertexAttribIiv\0"
+	"glGetVertexAttribIuiv\0"
+	"glVertexAttribDivisor\0"
+	"glDrawArraysInstanced\0"
+	"glDrawElementsInstanced\0"
+	"glDrawRangeElements\0"
+	"glFenceSync\0"
+	"glClientWaitSync\0"
+	"glWaitSync\0"
+	"glDeleteSync\0"
+	"glIsSync\0"
+	"glGetSynciv\0"
+	"glDrawBuffers\0"
+	"glReadBuffer\0"
+	"glBlitFramebuffer\0"
+	"glInvalidateFramebuffer\0"
+	"glInvalidateSubFramebuffer\0"
+	"glFramebufferTextureLayer\0"
+	"glRenderbufferStorageMultisample\0"
+	"glTexStorage2D\0"
+	"glGetInternalformativ\0"
+	"glBeginTransformFeedback\0"
+	"glEndTransformFeedback\0"
+	"glGenTransformFeedbacks\0"
+	"glDeleteTransformFeedbacks\0"
+	"glBindTransformFeedback\0"
+	"glPauseTransformFeedback\0"
+	"glResumeTransformFeedback\0"
+	"glIsTransformFeedback\0"
+	"glTransformFeedbackVaryings\0"
+	"glGetTransformFeedbackVarying\0"
+	"glGenSamplers\0"
+	"glDeleteSamplers\0"
+	"glBindSampler\0"
+	"glSamplerParameterf\0"
+	"glSamplerParameteri\0"
+	"glSamplerParameterfv\0"
+	"glSamplerParameteriv\0"
+	"glGetSamplerParameterfv\0"
+	"glGetSamplerParameteriv\0"
+	"glIsSampler\0"
+	"glGenQueries\0"
+	"glDeleteQueries\0"
+	"glBeginQuery\0"
+	"glEndQuery\0"
+	"glGetQueryiv\0"
+	"glGetQueryObjectuiv\0"
+	"glIsQuery\0"
+	"glProgramParameteri\0"
+	"glProgramBinary\0"
+	"glGetProgramBinary\0"
+	"glGetFragDataLocation\0"
+	"glGetInteger64v\0"
+	"glGetIntegeri_v\0"
+	"glGetInteger64i_v\0"
+	"glTexImage3D\0"
+	"glTexStorage3D\0"
+	"glTexSubImage3D\0"
+	"glCompressedTexImage3D\0"
+	"glCompressedTexSubImage3D\0"
+	"glCopyTexSubImage3D\0"
+	"glGetStringi\0"
+	"glGetBooleani_v\0"
+	"glMemoryBarrier\0"
+	"glMemoryBarrierByRegion\0"
+	"glGenProgramPipelines\0"
+	"glDeleteProgramPipelines\0"
+	"glBindProgramPipeline\0"
+	"glGetProgramPipelineiv\0"
+	"glGetProgramPipelineInfoLog\0"
+	"glValidateProgramPipeline\0"
+	"glIsProgramPipeline\0"
+	"glUseProgramStages\0"
+	"glActiveShaderProgram\0"
+	"glCreateShaderProgramv\0"
+	"glProgramUniform1f\0"
+	"glProgramUniform2f\0"
+	"glProgramUniform3f\0"
+	"glProgramUniform4f\0"
+	"glProgramUniform1i\0"
+	"glProgramUniform2i\0"
+	"glProgramUniform3i\0"
+	"glProgramUniform4i\0"
+	"glProgramUniform1ui\0"
+	"glProgramUniform2ui\0"
+	"glProgramUniform3ui\0"
+	"glProgramUniform4ui\0"
+	"glProgramUniform1fv\0"
+	"glProgramUniform2fv\0"
+	"glProgramUniform3fv\0"
+	"glProgramUniform4fv\0"
+	"glProgramUniform1iv\0"
+	"glProgramUniform2iv\0"
+	"glProgramUniform3iv\0"
+	"glProgramUniform4iv\0"
+	"glProgramUniform1uiv\0"
+	"glProgramUniform2uiv\0"
+	"glProgramUniform3uiv\0"
+	"glProgramUniform4uiv\0"
+	"glProgramUniformMatrix2fv\0"
+	"glProgramUniformMatrix3fv\0"
+	"glProgramUniformMatrix4fv\0"
+	"glProgramUniformMatrix2x3fv\0"
+	"glProgramUniformMatrix3x2fv\0"
+	"glProgramUniformMatrix2x4fv\0"
+	"glProgramUniformMatrix4x2fv\0"
+	"glProgramUniformMatrix3x4fv\0"
+	"glProgramUniformMatrix4x3fv\0"
+	"glGetProgramInterfaceiv\0"
+	"glGetProgramResourceiv\0"
+	"glGetProgramResourceIndex\0"
+	"glGetProgramResourceLocation\0"
+	"glGetProgramResourceName\0"
+	"glBindImageTexture\0"
+	"glDispatchCompute\0"
+	"glDispatchComputeIndirect\0"
+	"glBindVertexBuffer\0"
+	"glVertexAttribBinding\0"
+	"glVertexAttribFormat\0"
+	"glVertexAttribIFormat\0"
+	"glVertexBindingDivisor\0"
+	"glDrawArraysIndirect\0"
+	"glDrawElementsIndirect\0"
+	"glTexStorage2DMultisample\0"
+	"glSampleMaski\0"
+	"glGetMultisamplefv\0"
+	"glFramebufferParameteri\0"
+	"glGetFramebufferParameteriv\0"
+	"glGetTexLevelParameterfv\0"
+	"glGetTexLevelParameteriv\0"
+	"glGetGraphicsResetStatusEXT\0"
+	"glReadnPixelsEXT\0"
+	"glGetnUniformfvEXT\0"
+	"glGetnUniformivEXT\0"
+	"glDrawArraysNullAEMU\0"
+	"glDrawElementsNullAEMU\0"
+	"glTexBufferOES\0"
+	"glTexBufferRangeOES\0"
+	"glTexBufferEXT\0"
+	"glTexBufferRangeEXT\0"
+	"glEnableiEXT\0"
+	"glDisableiEXT\0"
+	"glBlendEquationiEXT\0"
+	"glBlendEquationSeparateiEXT\0"
+	"glBlendFunciEXT\0"
+	"glBlendFuncSeparateiEXT\0"
+	"glColorMaskiEXT\0"
+	"glIsEnablediEXT\0"
+	"glBufferStorageEXT\0"
+	"glMaxShaderCompilerThreadsKHR";
+
+static void* const gl2_funcs_by_proc[] = {
+	(void*)glActiveTexture,
+	(void*)glAttachShader,
+	(void*)glBindAttribLocation,
+	(void*)glBindBuffer,
+	(void*)glBindFramebuffer,
+	(void*)glBindRenderbuffer,
+	(void*)glBindTexture,
+	(void*)glBlendColor,
+	(void*)glBlendEquation,
+	(void*)glBlendEquationSeparate,
+	(void*)glBlendFunc,
+	(void*)glBlendFuncSeparate,
+	(void*)glBufferData,
+	(void*)glBufferSubData,
+	(void*)glCheckFramebufferStatus,
+	(void*)glClear,
+	(void*)glClearColor,
+	(void*)glClearDepthf,
+	(void*)glClearStencil,
+	(void*)glColorMask,
+	(void*)glCompileShader,
+	(void*)glCompressedTexImage2D,
+	(void*)glCompressedTexSubImage2D,
+	(void*)glCopyTexImage2D,
+	(void*)glCopyTexSubImage2D,
+	(void*)glCreateProgram,
+	(void*)glCreateShader,
+	(void*)glCullFace,
+	(void*)glDeleteBuffers,
+	(void*)glDeleteFramebuffers,
+	(void*)glDeleteProgram,
+	(void*)glDeleteRenderbuffers,
+	(void*)glDeleteShader,
+	(void*)glDeleteTextures,
+	(void*)glDepthFunc,
+	(void*)glDepthMask,
+	(void*)glDepthRangef,
+	(void*)glDetachShader,
+	(void*)glDisable,
+	(void*)glDisableVertexAttribArray,
+	(void*)glDrawArrays,
+	(void*)glDrawElements,
+	(void*)glEnable,
+	(void*)glEnableVertexAttribArray,
+	(void*)glFinish,
+	(void*)glFlush,
+	(void*)glFramebufferRenderbuffer,
+	(void*)glFramebufferTexture2D,
+	(void*)glFrontFace,
+	(void*)glGenBuffers,
+	(void*)glGenerateMipmap,
+	(void*)glGenFramebuffers,
+	(void*)glGenRenderbuffers,
+	(void*)glGenTextures,
+	(void*)glGetActiveAttrib,
+	(void*)glGetActiveUniform,
+	(void*)glGetAttachedShaders,
+	(void*)glGetAttribLocation,
+	(void*)glGetBooleanv,
+	(void*)glGetBufferParameteriv,
+	(void*)glGetError,
+	(void*)glGetFloatv,
+	(void*)glGetFramebufferAttachmentParameteriv,
+	(void*)glGetIntegerv,
+	(void*)glGetProgramiv,
+	(void*)glGetProgramInfoLog,
+	(void*)glGetRenderbufferParameteriv,
+	(void*)glGetShaderiv,
+	(void*)glGetShaderInfoLog,
+	(void*)glGetShaderPrecisionFormat,
+	(void*)glGetShaderSource,
+	(void*)glGetString,
+	(void*)glGetTexParameterfv,
+	(void*)glGetTexParameteriv,
+	(void*)glGetUniformfv,
+	(void*)glGetUniformiv,
+	(void*)glGetUniformLocation,
+	(void*)glGetVertexAttribfv,
+	(void*)glGetVertexAttribiv,
+	(void*)glGetVertexAttribPointerv,
+	(void*)glHint,
+	(void*)glIsBuffer,
+	(void*)glIsEnabled,
+	(void*)glIsFramebuffer,
+	(void*)glIsProgram,
+	(void*)glIsRenderbuffer,
+	(void*)glIsShader,
+	(void*)glIsTexture,
+	(void*)glLineWidth,
+	(void*)glLinkProgram,
+	(void*)glPixelStorei,
+	(void*)glPolygonOffset,
+	(void*)glReadPixels,
+	(void*)glReleaseShaderCompiler,
+	(void*)glRenderbufferStorage,
+	(void*)glSampleCoverage,
+	(void*)glScissor,
+	(void*)glShaderBinary,
+	(void*)glShaderSource,
+	(void*)glStencilFunc,
+	(void*)glStencilFuncSeparate,
+	(void*)glStencilMask,
+	(void*)glStencilMaskSeparate,
+	(void*)glStencilOp,
+	(void*)glStencilOpSeparate,
+	(void*)glTexImage2D,
+	(void*)glTexParameterf,
+	(void*)glTexParameterfv,
+	(void*)glTexParameteri,
+	(void*)glTexParameteriv,
+	(void*)glTexSubImage2D,
+	(void*)glUniform1f,
+	(void*)glUniform1fv,
+	(void*)glUniform1i,
+	(void*)glUniform1iv,
+	(void*)glUniform2f,
+	(void*)glUniform2fv,
+	(void*)glUniform2i,
+	(void*)glUniform2iv,
+	(void*)glUniform3f,
+	(void*)glUniform3fv,
+	(void*)glUniform3i,
+	(void*)glUniform3iv,
+	(void*)glUniform4f,
+	(void*)glUniform4fv,
+	(void*)glUniform4i,
+	(void*)glUniform4iv,
+	(void*)glUniformMatrix2fv,
+	(void*)glUniformMatrix3fv,
+	(void*)glUniformMatrix4fv,
+	(void*)glUseProgram,
+	(void*)glValidateProgram,
+	(void*)glVertexAttrib1f,
+	(void*)glVertexAttrib1fv,
+	(void*)glVertexAttrib2f,
+	(void*)glVertexAttrib2fv,
+	(void*)glVertexAttrib3f,
+	(void*)glVertexAttrib3fv,
+	(void*)glVertexAttrib4f,
+	(void*)glVertexAttrib4fv,
+	(void*)glVertexAttribPointer,
+	(void*)glViewport,
+	(void*)glEGLImageTargetTexture2DOES,
+	(void*)glEGLImageTargetRenderbufferStorageOES,
+	(void*)glGetProgramBinaryOES,
+	(void*)glProgramBinaryOES,
+	(void*)glMapBufferOES,
+	(void*)glUnmapBufferOES,
+	(void*)glTexImage3DOES,
+	(void*)glTexSubImage3DOES,
+	(void*)glCopyTexSubImage3DOES,
+	(void*)glCompressedTexImage3DOES,
+	(void*)glCompressedTexSubImage3DOES,
+	(void*)glFramebufferTexture3DOES,
+	(void*)glBindVertexArrayOES,
+	(void*)glDeleteVertexArraysOES,
+	(void*)glGenVertexArraysOES,
+	(void*)glIsVertexArrayOES,
+	(void*)glDiscardFramebufferEXT,
+	(void*)glMultiDrawArraysEXT,
+	(void*)glMultiDrawElementsEXT,
+	(void*)glGetPerfMonitorGroupsAMD,
+	(void*)glGetPerfMonitorCountersAMD,
+	(void*)glGetPerfMonitorGroupStringAMD,
+	(void*)glGetPerfMonitorCounterStringAMD,
+	(void*)glGetPerfMonitorCounterInfoAMD,
+	(void*)glGenPerfMonitorsAMD,
+	(void*)glDeletePerfMonitorsAMD,
+	(void*)glSelectPerfMonitorCountersAMD,
+	(void*)glBeginPerfMonitorAMD,
+	(void*)glEndPerfMonitorAMD,
+	(void*)glGetPerfMonitorCounterDataAMD,
+	(void*)glRenderbufferStorageMultisampleIMG,
+	(void*)glFramebufferTexture2DMultisampleIMG,
+	(void*)glDeleteFencesNV,
+	(void*)glGenFencesNV,
+	(void*)glIsFenceNV,
+	(void*)glTestFenceNV,
+	(void*)glGetFenceivNV,
+	(void*)glFinishFenceNV,
+	(void*)glSetFenceNV,
+	(void*)glCoverageMaskNV,
+	(void*)glCoverageOperationNV,
+	(void*)glGetDriverControlsQCOM,
+	(void*)glGetDriverControlStringQCOM,
+	(void*)glEnableDriverControlQCOM,
+	(void*)glDisableDriverControlQCOM,
+	(void*)glExtGetTexturesQCOM,
+	(void*)glExtGetBuffersQCOM,
+	(void*)glExtGetRenderbuffersQCOM,
+	(void*)glExtGetFramebuffersQCOM,
+	(void*)glExtGetTexLevelParameterivQCOM,
+	(void*)glExtTexObjectStateOverrideiQCOM,
+	(void*)glExtGetTexSubImageQCOM,
+	(void*)glExtGetBufferPointervQCOM,
+	(void*)glExtGetShadersQCOM,
+	(void*)glExtGetProgramsQCOM,
+	(void*)glExtIsProgramBinaryQCOM,
+	(void*)glExtGetProgramBinarySourceQCOM,
+	(void*)glStartTilingQCOM,
+	(void*)glEndTilingQCOM,
+	(void*)glGenVertexArrays,
+	(void*)glBindVertexArray,
+	(void*)glDeleteVertexArrays,
+	(void*)glIsVertexArray,
+	(void*)glMapBufferRange,
+	(void*)glUnmapBuffer,
+	(void*)glFlushMappedBufferRange,
+	(void*)glBindBufferRange,
+	(void*)glBindBufferBase,
+	(void*)glCopyBufferSubData,
+	(void*)glClearBufferiv,
+	(void*)glClearBufferuiv,
+	(void*)glClearBufferfv,
+	(void*)glClearBufferfi,
+	(void*)glGetBufferParameteri64v,
+	(void*)glGetBufferPointerv,
+	(void*)glUniformBlockBinding,
+	(void*)glGetUniformBlockIndex,
+	(void*)glGetUniformIndices,
+	(void*)glGetActiveUniformBlockiv,
+	(void*)glGetActiveUniformBlockName,
+	(void*)glUniform1ui,
+	(void*)glUniform2ui,
+	(void*)glUniform3ui,
+	(void*)glUniform4ui,
+	(void*)glUniform1uiv,
+	(void*)glUniform2uiv,
+	(void*)glUniform3uiv,
+	(void*)glUniform4uiv,
+	(void*)glUniformMatrix2x3fv,
+	(void*)glUniformMatrix3x2fv,
+	(void*)glUniformMatrix2x4fv,
+	(void*)glUniformMatrix4x2fv,
+	(void*)glUniformMatrix3x4fv,
+	(void*)glUniformMatrix4x3fv,
+	(void*)glGetUniformuiv,
+	(void*)glGetActiveUniformsiv,
+	(void*)glVertexAttribI4i,
+	(void*)glVertexAttribI4ui,
+	(void*)glVertexAttribI4iv,
+	(void*)glVertexAttribI4uiv,
+	(void*)glVertexAttribIPointer,
+	(void*)glGetVertexAttribIiv,
+	(void*)glGetVertexAttribIuiv,
+	(void*)glVertexAttribDivisor,
+	(void*)glDrawArraysInstanced,
+	(void*)glDrawElementsInstanced,
+	(void*)glDrawRangeElements,
+	(void*)glFenceSync,
+	(void*)glClientWaitSync,
+	(void*)glWaitSync,
+	(void*)glDeleteSync,
+	(void*)glIsSync,
+	(void*)glGetSynciv,
+	(void*)glDrawBuffers,
+	(void*)glReadBuffer,
+	(void*)glBlitFramebuffer,
+	(void*)glInvalidateFramebuffer,
+	(void*)glInvalidateSubFramebuffer,
+	(void*)glFramebufferTextureLayer,
+	(void*)glRenderbufferStorageMultisample,
+	(void*)glTexStorage2D,
+	(void*)glGetInternalformativ,
+	(void*)glBeginTransformFeedback,
+	(void*)glEndTransformFeedback,
+	(void*)glGenTransformFeedbacks,
+	(void*)glDeleteTransformFeedbacks,
+	(void*)glBindTransformFeedback,
+	(void*)glPauseTransformFeedback,
+	(void*)glResumeTransformFeedback,
+	(void*)glIsTransformFeedback,
+	(void*)glTransformFeedbackVaryings,
+	(void*)glGetTransformFeedbackVarying,
+	(void*)glGenSamplers,
+	(void*)glDeleteSamplers,
+	(void*)glBindSampler,
+	(void*)glSamplerParameterf,
+	(void*)glSamplerParameteri,
+	(void*)glSamplerParameterfv,
+	(void*)glSamplerParameteriv,
+	(void*)glGetSamplerParameterfv,
+	(void*)glGetSamplerParameteriv,
+	(void*)glIsSampler,
+	(void*)glGenQueries,
+	(void*)glDeleteQueries,
+	(void*)glBeginQuery,
+	(void*)glEndQuery,
+	(void*)glGetQueryiv,
+	(void*)glGetQueryObjectuiv,
+	(void*)glIsQuery,
+	(void*)glProgramParameteri,
+	(void*)glProgramBinary,
+	(void*)glGetProgramBinary,
+	(void*)glGetFragDataLocation,
+	(void*)glGetInteger64v,
+	(void*)glGetIntegeri_v,
+	(void*)glGetInteger64i_v,
+	(void*)glTexImage3D,
+	(void*)glTexStorage3D,
+	(void*)glTexSubImage3D,
+	(void*)glCompressedTexImage3D,
+	(void*)glCompressedTexSubImage3D,
+	(void*)glCopyTexSubImage3D,
+	(void*)glGetStringi,
+	(void*)glGetBooleani_v,
+	(void*)glMemoryBarrier,
+	(void*)glMemoryBarrierByRegion,
+	(void*)glGenProgramPipelines,
+	(void*)glDeleteProgramPipelines,
+	(void*)glBindProgramPipeline,
+	(void*)glGetProgramPipelineiv,
+	(void*)glGetProgramPipelineInfoLog,
+	(void*)glValidateProgramPipeline,
+	(void*)glIsProgramPipeline,
+	(void*)glUseProgramStages,
+	(void*)glActiveShaderProgram,
+	(void*)glCreateShaderProgramv,
+	(void*)glProgramUniform1f,
+	(void*)glProgramUniform2f,
+	(void*)glProgramUniform3f,
+	(void*)glProgramUniform4f,
+	(void*)glProgramUniform1i,
+	(void*)glProgramUniform2i,
+	(void*)glProgramUniform3i,
+	(void*)glProgramUniform4i,
+	(void*)glProgramUniform1ui,
+	(void*)glProgramUniform2ui,
+	(void*)glProgramUniform3ui,
+	(void*)glProgramUniform4ui,
+	(void*)glProgramUniform1fv,
+	(void*)glProgramUniform2fv,
+	(void*)glProgramUniform3fv,
+	(void*)glProgramUniform4fv,
+	(void*)glProgramUniform1iv,
+	(void*)glProgramUniform2iv,
+	(void*)glProgramUniform3iv,
+	(void*)glProgramUniform4iv,
+	(void*)glProgramUniform1uiv,
+	(void*)glProgramUniform2uiv,
+	(void*)glProgramUniform3uiv,
+	(void*)glProgramUniform4uiv,
+	(void*)glProgramUniformMatrix2fv,
+	(void*)glProgramUniformMatrix3fv,
+	(void*)glProgramUniformMatrix4fv,
+	(void*)glProgramUniformMatrix2x3fv,
+	(void*)glProgramUniformMatrix3x2fv,
+	(void*)glProgramUniformMatrix2x4fv,
+	(void*)glProgramUniformMatrix4x2fv,
+	(void*)glProgramUniformMatrix3x4fv,
+	(void*)glProgramUniformMatrix4x3fv,
+	(void*)glGetProgramInterfaceiv,
+	(void*)glGetProgramResourceiv,
+	(void*)glGetProgramResourceIndex,
+	(void*)glGetProgramResourceLocation,
+	(void*)glGetProgramResourceName,
+	(void*)glBindImageTexture,
+	(void*)glDispatchCompute,
+	(void*)glDispatchComputeIndirect,
+	(void*)glBindVertexBuffer,
+	(void*)glVertexAttribBinding,
+	(void*)glVertexAttribFormat,
+	(void*)glVertexAttribIFormat,
+	(void*)glVertexBindingDivisor,
+	(void*)glDrawArraysIndirect,
+	(void*)glDrawElementsIndirect,
+	(void*)glTexStorage2DMultisample,
+	(void*)glSampleMaski,
+	(void*)glGetMultisamplefv,
+	(void*)glFramebufferParameteri,
+	(void*)glGetFramebufferParameteriv,
+	(void*)glGetTexLevelParameterfv,
+	(void*)glGetTexLevelParameteriv,
+	(void*)glGetGraphicsResetStatusEXT,
+	(void*)glReadnPixelsEXT,
+	(void*)glGetnUniformfvEXT,
+	(void*)glGetnUniformivEXT,
+	(void*)glDrawArraysNullAEMU,
+	(void*)glDrawElementsNullAEMU,
+	(void*)glTexBufferOES,
+	(void*)glTexBufferRangeOES,
+	(void*)glTexBufferEXT,
+	(void*)glTexBufferRangeEXT,
+	(void*)glEnableiEXT,
+	(void*)glDisableiEXT,
+	(void*)glBlendEquationiEXT,
+	(void*)glBlendEquationSeparateiEXT,
+	(void*)glBlendFunciEXT,
+	(void*)glBlendFuncSeparateiEXT,
+	(void*)glColorMaskiEXT,
+	(void*)glIsEnablediEXT,
+	(void*)glBufferStorageEXT,
+	(void*)glMaxShaderCompilerThreadsKHR,
 };
-static const int gl2_num_funcs = sizeof(gl2_funcs_by_name) / sizeof(struct _gl2_funcs_by_name);
+static const int gl2_num_funcs = sizeof(gl2_funcs_by_proc) / sizeof(gl2_funcs_by_proc[0]);
 
 
 #endif
@@ -442,7 +442,14 @@
 #define OP_glBlendFuncSeparateiEXT 					2484
 #define OP_glColorMaskiEXT 					2485
 #define OP_glIsEnablediEXT 					2486
-#define OP_last 					2487
+#define OP_glGetProgramReflectionAEMU 					2487
+#define OP_glStoreTextureContentAEMU 					2488
+#define OP_glReleaseTextureContentAEMU 					2489
+#define OP_glTexImage2DContentAEMU 					2490
+#define OP_glCompressedTexImage2DContentAEMU 					2491
+#define OP_glDrawArraysListAEMU 					2492
+#define OP_glDrawElementsListAEMU 					2493
+#define OP_last 					2494
 
 
 #endif
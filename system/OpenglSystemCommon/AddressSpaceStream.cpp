@@ -26,6 +26,7 @@
 #endif
 #include <cutils/properties.h>
 #include <errno.h>
+#include <sched.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -34,6 +35,20 @@
 static const size_t kReadSize = 512 * 1024;
 static const size_t kWriteOffset = kReadSize;
 
+// Copies as much of |data| as fits straight into the ring and publishes it.
+// Returns the number of bytes sent, 0 if the ring is full.
+static size_t writeToRingInPlace(struct ring_buffer_with_view* ring,
+                                 const uint8_t* data, size_t size) {
+    struct ring_buffer_span span;
+    uint32_t reserved = ring_buffer_reserve_write(ring->ring, &ring->view, 0, size, &span);
+    memcpy(span.first, data, span.first_bytes);
+    if (span.second_bytes) {
+        memcpy(span.second, data + span.first_bytes, span.second_bytes);
+    }
+    ring_buffer_commit_write(ring->ring, reserved);
+    return reserved;
+}
+
 AddressSpaceStream* createAddressSpaceStream(size_t ignored_bufSize,
                                              HealthMonitor<>* healthMonitor) {
     // Ignore incoming ignored_bufSize
@@ -185,12 +200,16 @@ AddressSpaceStream* createVirtioGpuAddressSpaceStream(HealthMonitor<>* healthMon
     char* blobAddr, *bufferPtr;
     int ret;
 
-    // HACK: constants that are currently used.
-    // Ideal solution would use virtio-gpu capabilities to report both ringSize and bufferSize
+    // The sizes the host uses when its capset does not report any.
     uint32_t ringSize = 12288;
     uint32_t bufferSize = 1048576;
 
     VirtGpuDevice& instance = VirtGpuDevice::getInstance();
+    const struct gfxstreamCapset& capset = instance.getCaps().gfxstreamCapset;
+    if (capset.ringSize && capset.bufferSize) {
+        ringSize = capset.ringSize;
+        bufferSize = capset.bufferSize;
+    }
 
     blobCreate.blobId = 0;
     blobCreate.blobMem = kBlobMemHost3d;
@@ -307,11 +326,12 @@ size_t AddressSpaceStream::idealAllocSize(size_t len) {
 
 void *AddressSpaceStream::allocBuffer(size_t minSize) {
     auto watchdog = WATCHDOG_BUILDER(m_healthMonitor, "ASG watchdog").build();
-    AEMU_SCOPED_TRACE("allocBuffer");
+    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_STREAM, "allocBuffer");
     ensureType3Finished();
 
     if (!m_readBuf) {
         m_readBuf = (unsigned char*)malloc(kReadSize);
+        m_readBufMemory.set(m_readBuf ? kReadSize : 0);
     }
 
     size_t allocSize =
@@ -327,6 +347,7 @@ void *AddressSpaceStream::allocBuffer(size_t minSize) {
             m_tmpBufSize = allocSize * 2;
             m_tmpBuf = (unsigned char*)realloc(m_tmpBuf, m_tmpBufSize);
         }
+        m_tmpBufMemory.set(m_tmpBuf ? m_tmpBufSize : 0);
 
         if (!m_usingTmpBuf) {
             flush();
@@ -438,6 +459,31 @@ const unsigned char *AddressSpaceStream::readFully(void *ptr, size_t totalReadSi
     return userReadBuf;
 }
 
+const unsigned char* AddressSpaceStream::readView(size_t len) {
+    if (!m_readBuf || len > kReadSize) return nullptr;
+
+    if (m_readLeft < len) {
+        // Move what is left to the front so that the view is contiguous,
+        // then read ahead into the rest of the buffer as readFully() does.
+        memmove(m_readBuf, m_readBuf + (m_read - m_readLeft), m_readLeft);
+        m_read = m_readLeft;
+        while (m_readLeft < len) {
+            ssize_t actual = speculativeRead(m_readBuf + m_read, kReadSize - m_read);
+            if (actual <= 0) {
+                ALOGD("%s: Failed reading from pipe: %d", __FUNCTION__, errno);
+                return nullptr;
+            }
+            m_read += actual;
+            m_readLeft += actual;
+        }
+        resetBackoff();
+    }
+
+    const unsigned char* view = m_readBuf + (m_read - m_readLeft);
+    m_readLeft -= len;
+    return view;
+}
+
 const unsigned char *AddressSpaceStream::read(void *buf, size_t *inout_len) {
     unsigned char* dst = (unsigned char*)buf;
     size_t wanted = *inout_len;
@@ -455,7 +501,7 @@ const unsigned char *AddressSpaceStream::read(void *buf, size_t *inout_len) {
 int AddressSpaceStream::writeFully(const void *buf, size_t size)
 {
     auto watchdog = WATCHDOG_BUILDER(m_healthMonitor, "ASG watchdog").build();
-    AEMU_SCOPED_TRACE("writeFully");
+    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_STREAM, "writeFully");
     ensureType3Finished();
     ensureType1Finished();
 
@@ -472,11 +518,8 @@ int AddressSpaceStream::writeFully(const void *buf, size_t size)
         size_t remaining = size - sent;
         size_t sendThisTime = remaining < chunkSize ? remaining : chunkSize;
 
-        long sentChunks =
-            ring_buffer_view_write(
-                m_context.to_host_large_xfer.ring,
-                &m_context.to_host_large_xfer.view,
-                bufferBytes + sent, sendThisTime, 1);
+        size_t sentBytes =
+            writeToRingInPlace(&m_context.to_host_large_xfer, bufferBytes + sent, sendThisTime);
 
         if (!hostPinged && *(m_context.host_state) != ASG_HOST_STATE_CAN_CONSUME &&
             *(m_context.host_state) != ASG_HOST_STATE_RENDERING) {
@@ -484,12 +527,12 @@ int AddressSpaceStream::writeFully(const void *buf, size_t size)
             hostPinged = true;
         }
 
-        if (sentChunks == 0) {
+        if (sentBytes == 0) {
             ring_buffer_yield();
             backoff();
         }
 
-        sent += sentChunks * sendThisTime;
+        sent += sentBytes;
 
         if (isInError()) {
             return -1;
@@ -521,7 +564,7 @@ int AddressSpaceStream::writeFully(const void *buf, size_t size)
 int AddressSpaceStream::writeFullyAsync(const void *buf, size_t size)
 {
     auto watchdog = WATCHDOG_BUILDER(m_healthMonitor, "ASG watchdog").build();
-    AEMU_SCOPED_TRACE("writeFullyAsync");
+    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_STREAM, "writeFullyAsync");
     ensureType3Finished();
     ensureType1Finished();
 
@@ -539,11 +582,8 @@ int AddressSpaceStream::writeFullyAsync(const void *buf, size_t size)
         size_t remaining = size - sent;
         size_t sendThisTime = remaining < chunkSize ? remaining : chunkSize;
 
-        long sentChunks =
-            ring_buffer_view_write(
-                m_context.to_host_large_xfer.ring,
-                &m_context.to_host_large_xfer.view,
-                bufferBytes + sent, sendThisTime, 1);
+        size_t sentBytes =
+            writeToRingInPlace(&m_context.to_host_large_xfer, bufferBytes + sent, sendThisTime);
 
         uint32_t hostState = __atomic_load_n(m_context.host_state, __ATOMIC_ACQUIRE);
 
@@ -554,12 +594,12 @@ int AddressSpaceStream::writeFullyAsync(const void *buf, size_t size)
             notifyAvailable();
         }
 
-        if (sentChunks == 0) {
+        if (sentBytes == 0) {
             ring_buffer_yield();
             backoff();
         }
 
-        sent += sentChunks * sendThisTime;
+        sent += sentBytes;
 
         if (isInError()) {
             return -1;
@@ -601,6 +641,10 @@ const unsigned char *AddressSpaceStream::commitBufferAndReadFully(
     }
 }
 
+size_t AddressSpaceStream::hostQueuedBytes() {
+    return ring_buffer_available_read(m_context.to_host, 0);
+}
+
 bool AddressSpaceStream::isInError() const {
     return 1 == m_context.ring_config->in_error;
 }
@@ -643,7 +687,7 @@ ssize_t AddressSpaceStream::speculativeRead(unsigned char* readBuffer, size_t tr
 
 void AddressSpaceStream::notifyAvailable() {
     auto watchdog = WATCHDOG_BUILDER(m_healthMonitor, "ASG watchdog").build();
-    AEMU_SCOPED_TRACE("PING");
+    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_STREAM, "PING");
     struct address_space_ping request;
     request.metadata = ASG_NOTIFY_AVAILABLE;
     request.resourceId = m_resourceId;
@@ -686,7 +730,7 @@ void AddressSpaceStream::ensureConsumerFinishing() {
 
 void AddressSpaceStream::ensureType1Finished() {
     auto watchdog = WATCHDOG_BUILDER(m_healthMonitor, "ASG watchdog").build();
-    AEMU_SCOPED_TRACE("ensureType1Finished");
+    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_STREAM, "ensureType1Finished");
 
     uint32_t currAvailRead =
         ring_buffer_available_read(m_context.to_host, 0);
@@ -703,7 +747,7 @@ void AddressSpaceStream::ensureType1Finished() {
 
 void AddressSpaceStream::ensureType3Finished() {
     auto watchdog = WATCHDOG_BUILDER(m_healthMonitor, "ASG watchdog").build();
-    AEMU_SCOPED_TRACE("ensureType3Finished");
+    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_STREAM, "ensureType3Finished");
     uint32_t availReadLarge =
         ring_buffer_available_read(
             m_context.to_host_large_xfer.ring,
@@ -728,7 +772,7 @@ void AddressSpaceStream::ensureType3Finished() {
 int AddressSpaceStream::type1Write(uint32_t bufferOffset, size_t size) {
 
     auto watchdog = WATCHDOG_BUILDER(m_healthMonitor, "ASG watchdog").build();
-    AEMU_SCOPED_TRACE("type1Write");
+    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_STREAM, "type1Write");
 
     ensureType3Finished();
 
@@ -742,16 +786,8 @@ int AddressSpaceStream::type1Write(uint32_t bufferOffset, size_t size) {
 
     uint8_t* writeBufferBytes = (uint8_t*)(&xfer);
 
-    uint32_t maxOutstanding = 1;
-    uint32_t maxSteps = m_context.ring_config->buffer_size /
-            m_context.ring_config->flush_interval;
-
-    if (maxSteps > 1) maxOutstanding = maxSteps - 1;
-
-    uint32_t ringAvailReadNow = ring_buffer_available_read(m_context.to_host, 0);
-
-    while (ringAvailReadNow >= maxOutstanding * sizeForRing) {
-        ringAvailReadNow = ring_buffer_available_read(m_context.to_host, 0);
+    if (waitForType1Slot() < 0) {
+        return -1;
     }
 
     bool hostPinged = false;
@@ -801,17 +837,70 @@ int AddressSpaceStream::type1Write(uint32_t bufferOffset, size_t size) {
     return 0;
 }
 
+// Every transfer slot but one may be in flight at once; the producer only
+// waits here when all of them are still queued for the host.
+int AddressSpaceStream::waitForType1Slot() {
+    const uint32_t sizeForRing = sizeof(struct asg_type1_xfer);
+
+    uint32_t maxOutstanding = 1;
+    uint32_t maxSteps = m_context.ring_config->buffer_size /
+            m_context.ring_config->flush_interval;
+
+    if (maxSteps > 1) maxOutstanding = maxSteps - 1;
+
+    bool hostPinged = false;
+    while (ring_buffer_available_read(m_context.to_host, 0) >=
+           maxOutstanding * sizeForRing) {
+        // A host consumer that went to sleep will not drain the ring on
+        // its own; wake it instead of waiting for it.
+        uint32_t hostState = __atomic_load_n(m_context.host_state, __ATOMIC_ACQUIRE);
+        if (!hostPinged &&
+            hostState != ASG_HOST_STATE_CAN_CONSUME &&
+            hostState != ASG_HOST_STATE_RENDERING) {
+            notifyAvailable();
+            hostPinged = true;
+        }
+
+        if (isInError()) {
+            return -1;
+        }
+
+        backoff();
+    }
+
+    return 0;
+}
+
+static inline void cpuRelax() {
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// Waiting on the host goes through three phases: a short busy spin for
+// the common case of a host that is actively consuming, then yielding
+// the vCPU, then sleeping with an exponentially growing interval so a
+// stalled or oversubscribed host does not cost a guest core.
 void AddressSpaceStream::backoff() {
-#if defined(HOST_BUILD) || defined(__APPLE__) || defined(__MACOSX) || defined(__Fuchsia__) || defined(__linux__)
-    static const uint32_t kBackoffItersThreshold = 50000000;
-    static const uint32_t kBackoffFactorDoublingIncrement = 50000000;
+    // Android defines __linux__ too, so test for it first: the property
+    // overrides only exist there.
+#if defined(__ANDROID__) && !defined(HOST_BUILD)
+    static const uint32_t kBackoffItersThreshold = property_get_int32("ro.boot.asg.backoffiters", 4096);
+    static const uint32_t kBackoffFactorDoublingIncrement = property_get_int32("ro.boot.asg.backoffincrement", 64);
 #else
-    static const uint32_t kBackoffItersThreshold = property_get_int32("ro.boot.asg.backoffiters", 50000000);
-    static const uint32_t kBackoffFactorDoublingIncrement = property_get_int32("ro.boot.asg.backoffincrement", 50000000);
+    static const uint32_t kBackoffItersThreshold = 4096;
+    static const uint32_t kBackoffFactorDoublingIncrement = 64;
 #endif
+    static const uint32_t kSpinIters = kBackoffItersThreshold / 2;
     ++m_backoffIters;
 
-    if (m_backoffIters > kBackoffItersThreshold) {
+    if (m_backoffIters <= kSpinIters) {
+        cpuRelax();
+    } else if (m_backoffIters <= kBackoffItersThreshold) {
+        sched_yield();
+    } else {
         usleep(m_backoffFactor);
         uint32_t itersSoFarAfterThreshold = m_backoffIters - kBackoffItersThreshold;
         if (itersSoFarAfterThreshold > kBackoffFactorDoublingIncrement) {
@@ -20,6 +20,7 @@
 #include "VirtGpu.h"
 #include "address_space_graphics_types.h"
 #include "aemu/base/AndroidHealthMonitor.h"
+#include "aemu/base/MemoryAccounting.h"
 #include "goldfish_address_space.h"
 
 using android::base::guest::HealthMonitor;
@@ -49,6 +50,8 @@ public:
     virtual int writeFully(const void *buf, size_t len);
     virtual int writeFullyAsync(const void *buf, size_t len);
     virtual const unsigned char *commitBufferAndReadFully(size_t size, void *buf, size_t len);
+    virtual size_t hostQueuedBytes();
+    virtual const unsigned char* readView(size_t len);
 
     void setMapping(VirtGpuBlobMappingPtr mapping) {
         m_mapping = mapping;
@@ -68,6 +71,7 @@ private:
     void ensureType1Finished();
     void ensureType3Finished();
     int type1Write(uint32_t offset, size_t size);
+    int waitForType1Slot();
 
     void backoff();
     void resetBackoff();
@@ -81,6 +85,10 @@ private:
     bool m_usingTmpBuf;
 
     unsigned char* m_readBuf;
+    android::base::guest::AccountedMemory m_tmpBufMemory{
+        android::base::guest::GraphicsMemory::kStreamBuffers};
+    android::base::guest::AccountedMemory m_readBufMemory{
+        android::base::guest::GraphicsMemory::kStreamBuffers};
     size_t m_read;
     size_t m_readLeft;
 
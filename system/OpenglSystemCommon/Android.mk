@@ -17,6 +17,7 @@ endif
 LOCAL_SRC_FILES := \
     FormatConversions.cpp \
     HostConnection.cpp \
+    NullHostStream.cpp \
     QemuPipeStream.cpp \
     ProcessPipe.cpp    \
     ThreadInfo.cpp \
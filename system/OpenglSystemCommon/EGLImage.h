@@ -38,6 +38,11 @@ struct EGLImage_t
         android_native_buffer_t *native_buffer;
         uint32_t host_egl_image;
     };
+
+    // For EGL_NATIVE_BUFFER_ANDROID: the color buffer to bind, resolved
+    // once, and the eglCreateImageKHR calls not yet matched by a destroy.
+    uint32_t host_color_buffer;
+    int refcount;
 };
 
 #endif
@@ -138,12 +138,40 @@ static const char kVulkanAsyncQsri[] = "ANDROID_EMU_vulkan_async_qsri";
 // DMA for readback
 static const char kReadColorBufferDma[] = "ANDROID_EMU_read_color_buffer_dma";
 
+// DMA for YUV readback, straight into the guest buffer
+static const char kReadColorBufferYUVDma[] = "ANDROID_EMU_read_color_buffer_yuv_dma";
+
 // HWC multiple display configs
 static const char kHWCMultiConfigs[] = "ANDROID_EMU_hwc_multi_configs";
 
 // Vulkan auxiliary command memory
 static const char kVulkanAuxCommandMemory[] = "ANDROID_EMU_vulkan_aux_command_memory";
 
+// LZ4 compressed guest to host command stream, see CompressedStream
+static const char kStreamCompressionLz4[] = "ANDROID_EMU_stream_compression_lz4";
+
+// Vulkan shader modules created from SPIR-V the host already holds, by hash
+static const char kVulkanShaderModuleCache[] = "ANDROID_EMU_vulkan_shader_module_cache";
+
+// Link status and uniform/attribute reflection of a GLES program in one reply
+static const char kGLESProgramReflection[] = "ANDROID_EMU_gles_program_reflection";
+
+// Texture image payloads kept on the host and uploaded again by reference
+static const char kGLESTextureContent[] = "ANDROID_EMU_gles_texture_content";
+
+// Several color buffers created with one rcCreateColorBuffersDMA call, or
+// closed with one rcCloseColorBuffers call
+static const char kColorBuffersBatch[] = "ANDROID_EMU_color_buffers_batch";
+
+// Color buffer commands whose results are rarely needed, sent without a readback
+static const char kAsyncColorBufferCommands[] = "ANDROID_EMU_async_color_buffer_commands";
+
+// Vulkan objects created without a readback, under handles reserved in advance
+static const char kVulkanGuestHandles[] = "ANDROID_EMU_vulkan_guest_handles";
+
+// Runs of GLES draws from buffer objects sent as one glDraw*ListAEMU
+static const char kGLESDrawLists[] = "ANDROID_EMU_gles_draw_lists";
+
 // Struct describing available emulator features
 struct EmulatorFeatureInfo {
 
@@ -173,8 +201,16 @@ struct EmulatorFeatureInfo {
         hasSyncBufferData(false),
         hasVulkanAsyncQsri(false),
         hasReadColorBufferDma(false),
+        hasReadColorBufferYUVDma(false),
         hasHWCMultiConfigs(false),
-        hasVulkanAuxCommandMemory(false)
+        hasVulkanAuxCommandMemory(false),
+        hasVulkanShaderModuleCache(false),
+        hasGLESProgramReflection(false),
+        hasGLESTextureContent(false),
+        hasColorBuffersBatch(false),
+        hasAsyncColorBufferCommands(false),
+        hasVulkanGuestHandles(false),
+        hasGLESDrawLists(false)
     { }
 
     SyncImpl syncImpl;
@@ -202,8 +238,16 @@ struct EmulatorFeatureInfo {
     bool hasSyncBufferData;
     bool hasVulkanAsyncQsri;
     bool hasReadColorBufferDma;
+    bool hasReadColorBufferYUVDma;
     bool hasHWCMultiConfigs;
     bool hasVulkanAuxCommandMemory; // This feature tracks if vulkan command buffers should be stored in an auxiliary shared memory
+    bool hasVulkanShaderModuleCache;
+    bool hasGLESProgramReflection;
+    bool hasGLESTextureContent;
+    bool hasColorBuffersBatch;
+    bool hasAsyncColorBufferCommands;
+    bool hasVulkanGuestHandles;
+    bool hasGLESDrawLists;
 };
 
 enum HostConnectionType {
@@ -212,6 +256,8 @@ enum HostConnectionType {
     HOST_CONNECTION_ADDRESS_SPACE = 2,
     HOST_CONNECTION_VIRTIO_GPU_PIPE = 3,
     HOST_CONNECTION_VIRTIO_GPU_ADDRESS_SPACE = 4,
+    // No host; see NullHostStream.
+    HOST_CONNECTION_NULL = 5,
 };
 
 enum GrallocType {
@@ -23,6 +23,14 @@
 #include <string.h>
 #include <stdio.h>
 
+#if defined(__i386__) || defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #define DEBUG 0
 
 #if DEBUG
@@ -89,6 +97,377 @@ signed clamp_rgb(signed value) {
     return value;
 }
 
+// Row kernels shared by the RGB888 <-> planar YUV conversions below. Each
+// conversion is expressed in fixed point so that it can be evaluated in
+// 32-bit vector lanes; the SSE4.1 and NEON kernels convert 8 pixels at a
+// time and produce exactly what the scalar loop produces for the same row.
+namespace {
+
+//   R = (y * (Y - 16) + rv * (V - 128)) >> shift
+//   G = (y * (Y - 16) - gu * (U - 128) - gv * (V - 128)) >> shift
+//   B = (y * (Y - 16) + bu * (U - 128)) >> shift
+struct YuvToRgbCoeffs {
+    int32_t y, rv, gu, gv, bu;
+    int shift;
+};
+
+//   Y = (yr * R + yg * G + yb * B + yBias) >> shift, and likewise U and V.
+struct RgbToYuvCoeffs {
+    int32_t yr, yg, yb, yBias;
+    int32_t ur, ug, ub, uBias;
+    int32_t vr, vg, vb, vBias;
+    int shift;
+};
+
+// frameworks/av/media/libstagefright/colorconversion/ColorConverter.cpp
+constexpr YuvToRgbCoeffs kColorConverterYuvToRgb = {298, 409, 100, 208, 517, 8};
+
+// https://en.wikipedia.org/wiki/YCbCr#ITU-R_BT.601_conversion
+// but scale down U by 0.97 to mitigate rgb over/under flow. In 16.16 fixed
+// point; at most one step away from the double precision formula.
+constexpr YuvToRgbCoeffs kBt601YuvToRgb = {76309, 104597, 24904, 53279, 128235, 16};
+
+// frameworks/base/core/jni/android_hardware_camera2_legacy_LegacyCameraDevice.cpp
+constexpr RgbToYuvCoeffs kCameraRgbToYuv = {
+    77, 150, 29, 0,
+    -43, -85, 128, 128 << 8,
+    128, -107, -21, 128 << 8,
+    8,
+};
+
+// https://en.wikipedia.org/wiki/YCbCr#ITU-R_BT.601_conversion
+// but scale up U by 1/0.96. In 16.16 fixed point; at most one step away
+// from the double precision formula.
+constexpr RgbToYuvCoeffs kBt601RgbToYuv = {
+    16829, 33039, 6416, 16 << 16,
+    -10119, -19865, 29984, 128 << 16,
+    28784, -24103, -4681, 128 << 16,
+    16,
+};
+
+inline void yuv_to_rgb888_pixel(int y, int u, int v, uint8_t* rgb,
+                                const YuvToRgbCoeffs& k) {
+    const int32_t luma = k.y * (y - 16);
+    u -= 128;
+    v -= 128;
+    rgb[0] = clamp_rgb((luma + k.rv * v) >> k.shift);
+    rgb[1] = clamp_rgb((luma - k.gu * u - k.gv * v) >> k.shift);
+    rgb[2] = clamp_rgb((luma + k.bu * u) >> k.shift);
+}
+
+inline uint8_t rgb_to_yuv_channel(int r, int g, int b,
+                                  int32_t kr, int32_t kg, int32_t kb,
+                                  int32_t bias, int shift) {
+    return clamp_rgb((kr * r + kg * g + kb * b + bias) >> shift);
+}
+
+// Convert |count| pixels starting at an even column; pixel i takes its
+// chroma from u[i / 2] and v[i / 2]. Return the number of pixels done,
+// a multiple of 8; the caller finishes the rest.
+using YuvToRgbRowFn = int (*)(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                              uint8_t* rgb, int count, const YuvToRgbCoeffs& k);
+
+// Convert |count| pixels starting at an even column. If |u| and |v| are
+// set, the chroma of each even pixel i is written to u[i / 2] and v[i / 2].
+using RgbToYuvRowFn = int (*)(const uint8_t* rgb, uint8_t* y, uint8_t* u, uint8_t* v,
+                              int count, const RgbToYuvCoeffs& k);
+
+int yuv_to_rgb888_row_none(const uint8_t*, const uint8_t*, const uint8_t*,
+                           uint8_t*, int, const YuvToRgbCoeffs&) {
+    return 0;
+}
+
+int rgb888_to_yuv_row_none(const uint8_t*, uint8_t*, uint8_t*, uint8_t*,
+                           int, const RgbToYuvCoeffs&) {
+    return 0;
+}
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#define FORMAT_CONVERSIONS_SSE41 __attribute__((target("sse4.1")))
+
+// Four pixels of 32-bit Y, U and V, before the 16 and 128 offsets.
+FORMAT_CONVERSIONS_SSE41
+inline void yuv_to_rgb_sse41(__m128i y, __m128i u, __m128i v,
+                             const YuvToRgbCoeffs& k, __m128i shift,
+                             __m128i* r, __m128i* g, __m128i* b) {
+    y = _mm_sub_epi32(y, _mm_set1_epi32(16));
+    u = _mm_sub_epi32(u, _mm_set1_epi32(128));
+    v = _mm_sub_epi32(v, _mm_set1_epi32(128));
+    const __m128i luma = _mm_mullo_epi32(_mm_set1_epi32(k.y), y);
+    *r = _mm_sra_epi32(_mm_add_epi32(luma, _mm_mullo_epi32(_mm_set1_epi32(k.rv), v)), shift);
+    *g = _mm_sra_epi32(_mm_sub_epi32(_mm_sub_epi32(luma, _mm_mullo_epi32(_mm_set1_epi32(k.gu), u)),
+                                     _mm_mullo_epi32(_mm_set1_epi32(k.gv), v)), shift);
+    *b = _mm_sra_epi32(_mm_add_epi32(luma, _mm_mullo_epi32(_mm_set1_epi32(k.bu), u)), shift);
+}
+
+FORMAT_CONVERSIONS_SSE41
+int yuv_to_rgb888_row_sse41(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                            uint8_t* rgb, int count, const YuvToRgbCoeffs& k) {
+    const __m128i shift = _mm_cvtsi32_si128(k.shift);
+    // Interleave R0..R7 G0..G7 and B0..B7 into 24 bytes of RGB.
+    const __m128i rgMask0 = _mm_setr_epi8(0, 8, -1, 1, 9, -1, 2, 10, -1, 3, 11, -1, 4, 12, -1, 5);
+    const __m128i bMask0 = _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1);
+    const __m128i rgMask1 = _mm_setr_epi8(13, -1, 6, 14, -1, 7, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i bMask1 = _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1);
+
+    int done = 0;
+    for (; done + 8 <= count; done += 8) {
+        const __m128i y8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(y + done));
+        uint32_t u4, v4;
+        memcpy(&u4, u + done / 2, sizeof(u4));
+        memcpy(&v4, v + done / 2, sizeof(v4));
+        __m128i u8 = _mm_cvtsi32_si128(u4);
+        __m128i v8 = _mm_cvtsi32_si128(v4);
+        u8 = _mm_unpacklo_epi8(u8, u8);
+        v8 = _mm_unpacklo_epi8(v8, v8);
+
+        __m128i r16[2], g16[2], b16[2];
+        yuv_to_rgb_sse41(_mm_cvtepu8_epi32(y8), _mm_cvtepu8_epi32(u8), _mm_cvtepu8_epi32(v8),
+                         k, shift, &r16[0], &g16[0], &b16[0]);
+        yuv_to_rgb_sse41(_mm_cvtepu8_epi32(_mm_srli_si128(y8, 4)),
+                         _mm_cvtepu8_epi32(_mm_srli_si128(u8, 4)),
+                         _mm_cvtepu8_epi32(_mm_srli_si128(v8, 4)),
+                         k, shift, &r16[1], &g16[1], &b16[1]);
+        // The saturating packs clamp to [0, 255] like clamp_rgb.
+        const __m128i rg = _mm_packus_epi16(_mm_packs_epi32(r16[0], r16[1]),
+                                            _mm_packs_epi32(g16[0], g16[1]));
+        const __m128i bb = _mm_packus_epi16(_mm_packs_epi32(b16[0], b16[1]),
+                                            _mm_packs_epi32(b16[0], b16[1]));
+        const __m128i out0 = _mm_or_si128(_mm_shuffle_epi8(rg, rgMask0),
+                                          _mm_shuffle_epi8(bb, bMask0));
+        const __m128i out1 = _mm_or_si128(_mm_shuffle_epi8(rg, rgMask1),
+                                          _mm_shuffle_epi8(bb, bMask1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(rgb + done * 3), out0);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(rgb + done * 3 + 16), out1);
+    }
+    return done;
+}
+
+FORMAT_CONVERSIONS_SSE41
+inline __m128i rgb_to_yuv_channel_sse41(__m128i r, __m128i g, __m128i b,
+                                        int32_t kr, int32_t kg, int32_t kb,
+                                        int32_t bias, __m128i shift) {
+    __m128i sum = _mm_add_epi32(_mm_mullo_epi32(_mm_set1_epi32(kr), r),
+                                _mm_mullo_epi32(_mm_set1_epi32(kg), g));
+    sum = _mm_add_epi32(sum, _mm_mullo_epi32(_mm_set1_epi32(kb), b));
+    return _mm_sra_epi32(_mm_add_epi32(sum, _mm_set1_epi32(bias)), shift);
+}
+
+FORMAT_CONVERSIONS_SSE41
+int rgb888_to_yuv_row_sse41(const uint8_t* rgb, uint8_t* y, uint8_t* u, uint8_t* v,
+                            int count, const RgbToYuvCoeffs& k) {
+    const __m128i shift = _mm_cvtsi32_si128(k.shift);
+    // Gather R0..R7, G0..G7 and B0..B7 out of 24 bytes of RGB.
+    const __m128i rMaskLo = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i rMaskHi = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i gMaskLo = _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i gMaskHi = _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i bMaskLo = _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i bMaskHi = _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i evenMask = _mm_setr_epi8(0, 2, 4, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+
+    int done = 0;
+    for (; done + 8 <= count; done += 8) {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + done * 3));
+        const __m128i hi = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rgb + done * 3 + 16));
+        const __m128i r8 = _mm_or_si128(_mm_shuffle_epi8(lo, rMaskLo), _mm_shuffle_epi8(hi, rMaskHi));
+        const __m128i g8 = _mm_or_si128(_mm_shuffle_epi8(lo, gMaskLo), _mm_shuffle_epi8(hi, gMaskHi));
+        const __m128i b8 = _mm_or_si128(_mm_shuffle_epi8(lo, bMaskLo), _mm_shuffle_epi8(hi, bMaskHi));
+
+        const __m128i y32lo = rgb_to_yuv_channel_sse41(
+            _mm_cvtepu8_epi32(r8), _mm_cvtepu8_epi32(g8), _mm_cvtepu8_epi32(b8),
+            k.yr, k.yg, k.yb, k.yBias, shift);
+        const __m128i y32hi = rgb_to_yuv_channel_sse41(
+            _mm_cvtepu8_epi32(_mm_srli_si128(r8, 4)), _mm_cvtepu8_epi32(_mm_srli_si128(g8, 4)),
+            _mm_cvtepu8_epi32(_mm_srli_si128(b8, 4)), k.yr, k.yg, k.yb, k.yBias, shift);
+        const __m128i y16 = _mm_packs_epi32(y32lo, y32hi);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(y + done), _mm_packus_epi16(y16, y16));
+
+        if (u && v) {
+            const __m128i r = _mm_cvtepu8_epi32(_mm_shuffle_epi8(r8, evenMask));
+            const __m128i g = _mm_cvtepu8_epi32(_mm_shuffle_epi8(g8, evenMask));
+            const __m128i b = _mm_cvtepu8_epi32(_mm_shuffle_epi8(b8, evenMask));
+            const __m128i u32 = rgb_to_yuv_channel_sse41(r, g, b, k.ur, k.ug, k.ub, k.uBias, shift);
+            const __m128i v32 = rgb_to_yuv_channel_sse41(r, g, b, k.vr, k.vg, k.vb, k.vBias, shift);
+            const __m128i uv16 = _mm_packs_epi32(u32, v32);
+            const __m128i uv8 = _mm_packus_epi16(uv16, uv16);
+            const uint32_t u4 = _mm_cvtsi128_si32(uv8);
+            const uint32_t v4 = _mm_cvtsi128_si32(_mm_srli_si128(uv8, 4));
+            memcpy(u + done / 2, &u4, sizeof(u4));
+            memcpy(v + done / 2, &v4, sizeof(v4));
+        }
+    }
+    return done;
+}
+
+#endif  // defined(__i386__) || defined(__x86_64__)
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+
+inline int16x8_t yuv_to_rgb_channel_neon(int32x4_t lo, int32x4_t hi, int32x4_t shift) {
+    return vcombine_s16(vqmovn_s32(vshlq_s32(lo, shift)), vqmovn_s32(vshlq_s32(hi, shift)));
+}
+
+int yuv_to_rgb888_row_neon(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                           uint8_t* rgb, int count, const YuvToRgbCoeffs& k) {
+    // vshlq_s32 by a negative amount is an arithmetic right shift.
+    const int32x4_t shift = vdupq_n_s32(-k.shift);
+
+    int done = 0;
+    for (; done + 8 <= count; done += 8) {
+        uint32_t u4, v4;
+        memcpy(&u4, u + done / 2, sizeof(u4));
+        memcpy(&v4, v + done / 2, sizeof(v4));
+        const uint8x8_t u8 = vcreate_u8(u4);
+        const uint8x8_t v8 = vcreate_u8(v4);
+        const int16x8_t yw = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(y + done))),
+                                       vdupq_n_s16(16));
+        const int16x8_t uw = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vzip_u8(u8, u8).val[0])),
+                                       vdupq_n_s16(128));
+        const int16x8_t vw = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vzip_u8(v8, v8).val[0])),
+                                       vdupq_n_s16(128));
+
+        int32x4_t r[2], g[2], b[2];
+        for (int half = 0; half < 2; ++half) {
+            const int16x4_t ys = half ? vget_high_s16(yw) : vget_low_s16(yw);
+            const int32x4_t us = vmovl_s16(half ? vget_high_s16(uw) : vget_low_s16(uw));
+            const int32x4_t vs = vmovl_s16(half ? vget_high_s16(vw) : vget_low_s16(vw));
+            const int32x4_t luma = vmulq_n_s32(vmovl_s16(ys), k.y);
+            r[half] = vmlaq_n_s32(luma, vs, k.rv);
+            g[half] = vmlsq_n_s32(vmlsq_n_s32(luma, us, k.gu), vs, k.gv);
+            b[half] = vmlaq_n_s32(luma, us, k.bu);
+        }
+        // The saturating narrows clamp to [0, 255] like clamp_rgb.
+        uint8x8x3_t out;
+        out.val[0] = vqmovun_s16(yuv_to_rgb_channel_neon(r[0], r[1], shift));
+        out.val[1] = vqmovun_s16(yuv_to_rgb_channel_neon(g[0], g[1], shift));
+        out.val[2] = vqmovun_s16(yuv_to_rgb_channel_neon(b[0], b[1], shift));
+        vst3_u8(rgb + done * 3, out);
+    }
+    return done;
+}
+
+inline int32x4_t rgb_to_yuv_channel_neon(int32x4_t r, int32x4_t g, int32x4_t b,
+                                         int32_t kr, int32_t kg, int32_t kb,
+                                         int32_t bias, int32x4_t shift) {
+    int32x4_t sum = vmlaq_n_s32(vdupq_n_s32(bias), r, kr);
+    sum = vmlaq_n_s32(sum, g, kg);
+    sum = vmlaq_n_s32(sum, b, kb);
+    return vshlq_s32(sum, shift);
+}
+
+inline int32x4_t widen_neon(uint8x8_t v, int half) {
+    const uint16x8_t w = vmovl_u8(v);
+    return vreinterpretq_s32_u32(vmovl_u16(half ? vget_high_u16(w) : vget_low_u16(w)));
+}
+
+int rgb888_to_yuv_row_neon(const uint8_t* rgb, uint8_t* y, uint8_t* u, uint8_t* v,
+                           int count, const RgbToYuvCoeffs& k) {
+    const int32x4_t shift = vdupq_n_s32(-k.shift);
+
+    int done = 0;
+    for (; done + 8 <= count; done += 8) {
+        const uint8x8x3_t in = vld3_u8(rgb + done * 3);
+
+        int32x4_t y32[2];
+        for (int half = 0; half < 2; ++half) {
+            y32[half] = rgb_to_yuv_channel_neon(
+                widen_neon(in.val[0], half), widen_neon(in.val[1], half),
+                widen_neon(in.val[2], half), k.yr, k.yg, k.yb, k.yBias, shift);
+        }
+        vst1_u8(y + done, vqmovun_s16(vcombine_s16(vqmovn_s32(y32[0]), vqmovn_s32(y32[1]))));
+
+        if (u && v) {
+            const int32x4_t r = widen_neon(vuzp_u8(in.val[0], in.val[0]).val[0], 0);
+            const int32x4_t g = widen_neon(vuzp_u8(in.val[1], in.val[1]).val[0], 0);
+            const int32x4_t b = widen_neon(vuzp_u8(in.val[2], in.val[2]).val[0], 0);
+            const int32x4_t u32 = rgb_to_yuv_channel_neon(r, g, b, k.ur, k.ug, k.ub, k.uBias, shift);
+            const int32x4_t v32 = rgb_to_yuv_channel_neon(r, g, b, k.vr, k.vg, k.vb, k.vBias, shift);
+            const uint8x8_t uv8 = vqmovun_s16(vcombine_s16(vqmovn_s32(u32), vqmovn_s32(v32)));
+            const uint32_t u4 = vget_lane_u32(vreinterpret_u32_u8(uv8), 0);
+            const uint32_t v4 = vget_lane_u32(vreinterpret_u32_u8(uv8), 1);
+            memcpy(u + done / 2, &u4, sizeof(u4));
+            memcpy(v + done / 2, &v4, sizeof(v4));
+        }
+    }
+    return done;
+}
+
+#endif  // defined(__ARM_NEON) || defined(__aarch64__)
+
+struct RowKernels {
+    YuvToRgbRowFn yuvToRgb;
+    RgbToYuvRowFn rgbToYuv;
+};
+
+// Picked once, the first time a conversion runs.
+const RowKernels& row_kernels() {
+    static const RowKernels sKernels = []() {
+        RowKernels kernels = {yuv_to_rgb888_row_none, rgb888_to_yuv_row_none};
+#if defined(__ARM_NEON) || defined(__aarch64__)
+        kernels = {yuv_to_rgb888_row_neon, rgb888_to_yuv_row_neon};
+#elif defined(__i386__) || defined(__x86_64__)
+        if (__builtin_cpu_supports("sse4.1")) {
+            kernels = {yuv_to_rgb888_row_sse41, rgb888_to_yuv_row_sse41};
+        }
+#endif
+        return kernels;
+    }();
+    return sKernels;
+}
+
+// Convert columns [left, right] of one row into packed RGB888 at |rgb|.
+// |y|, |u| and |v| point at the start of their rows.
+void yuv_row_to_rgb888(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                       uint8_t* rgb, int left, int right, const YuvToRgbCoeffs& k) {
+    int i = left;
+    if (i & 1 && i <= right) {
+        yuv_to_rgb888_pixel(y[i], u[i / 2], v[i / 2], rgb, k);
+        rgb += 3;
+        ++i;
+    }
+    if (i <= right) {
+        const int done = row_kernels().yuvToRgb(y + i, u + i / 2, v + i / 2,
+                                                rgb, right - i + 1, k);
+        i += done;
+        rgb += done * 3;
+    }
+    for (; i <= right; ++i, rgb += 3) {
+        yuv_to_rgb888_pixel(y[i], u[i / 2], v[i / 2], rgb, k);
+    }
+}
+
+// Convert columns [left, right] of one row of RGB888, which starts at
+// |rgb|. Chroma is taken from even columns, and only if |u| and |v| are
+// set; each output pointer points at the start of its row.
+void rgb888_row_to_yuv(const uint8_t* rgb, uint8_t* y, uint8_t* u, uint8_t* v,
+                       int left, int right, const RgbToYuvCoeffs& k) {
+    const bool chroma = u && v;
+    int i = left;
+    if (i & 1 && i <= right) {
+        const uint8_t* p = rgb + i * 3;
+        y[i] = rgb_to_yuv_channel(p[0], p[1], p[2], k.yr, k.yg, k.yb, k.yBias, k.shift);
+        ++i;
+    }
+    if (i <= right) {
+        i += row_kernels().rgbToYuv(rgb + i * 3, y + i,
+                                    chroma ? u + i / 2 : nullptr,
+                                    chroma ? v + i / 2 : nullptr,
+                                    right - i + 1, k);
+    }
+    for (; i <= right; ++i) {
+        const uint8_t* p = rgb + i * 3;
+        y[i] = rgb_to_yuv_channel(p[0], p[1], p[2], k.yr, k.yg, k.yb, k.yBias, k.shift);
+        if (chroma && (i & 1) == 0) {
+            u[i / 2] = rgb_to_yuv_channel(p[0], p[1], p[2], k.ur, k.ug, k.ub, k.uBias, k.shift);
+            v[i / 2] = rgb_to_yuv_channel(p[0], p[1], p[2], k.vr, k.vg, k.vb, k.vBias, k.shift);
+        }
+    }
+}
+
+}  // namespace
+
 void rgb565_to_yv12(char* dest, char* src, int width, int height,
         int left, int top, int right, int bottom) {
     const int rgb_stride = 2;
@@ -159,31 +538,14 @@ void rgb888_to_yv12(char* dest, char* src, int width, int height,
     }
 #endif
 
-    int uvcount = 0;
     for (int j = top; j <= bottom; ++j) {
         uint8_t *yv12_y = yv12_y0 + j * yStride;
         uint8_t *rgb_ptr = rgb_ptr0 + get_rgb_offset(j, width, rgb_stride);
         bool jeven = (j & 1) == 0;
-        for (int i = left; i <= right; ++i) {
-            uint8_t R = rgb_ptr[i*rgb_stride];
-            uint8_t G = rgb_ptr[i*rgb_stride+1];
-            uint8_t B = rgb_ptr[i*rgb_stride+2];
-            // convert to YV12
-            // https://en.wikipedia.org/wiki/YCbCr#ITU-R_BT.601_conversion
-            // but scale up U by 1/0.96
-            yv12_y[i] = clamp_rgb(1.0 * ((0.25678823529411765 * R) + (0.5041294117647058 * G) + (0.09790588235294118 * B)) + 16);
-            bool ieven = (i & 1) == 0;
-            if (jeven && ieven) {
-                yv12_u0[uvcount] = clamp_rgb((1/0.96) * (-(0.1482235294117647 * R) - (0.2909921568627451 * G) + (0.4392156862745098 * B)) + 128);
-                yv12_v0[uvcount] = clamp_rgb((1.0)* ((0.4392156862745098 * R) - (0.36778823529411764 * G) - (0.07142745098039215 * B)) + 128);
-                uvcount ++;
-            }
-        }
-        if (jeven) {
-            yv12_u0 += cStride;
-            yv12_v0 += cStride;
-            uvcount = 0;
-        }
+        rgb888_row_to_yuv(rgb_ptr, yv12_y,
+                          jeven ? yv12_u0 + (j/2) * cStride : nullptr,
+                          jeven ? yv12_v0 + (j/2) * cStride : nullptr,
+                          left, right, kBt601RgbToYuv);
     }
 
 #if DEBUG
@@ -216,19 +578,9 @@ void rgb888_to_yuv420p(char* dest, char* src, int width, int height,
         uint8_t *yv12_v = yv12_u + cSize;
         uint8_t *rgb_ptr = rgb_ptr0 + get_rgb_offset(j, width, rgb_stride);
         bool jeven = (j & 1) == 0;
-        for (int i = left; i <= right; ++i) {
-            uint8_t R = rgb_ptr[i*rgb_stride];
-            uint8_t G = rgb_ptr[i*rgb_stride+1];
-            uint8_t B = rgb_ptr[i*rgb_stride+2];
-            // convert to YV12
-            // frameworks/base/core/jni/android_hardware_camera2_legacy_LegacyCameraDevice.cpp
-            yv12_y[i] = clamp_rgb((77 * R + 150 * G +  29 * B) >> 8);
-            bool ieven = (i & 1) == 0;
-            if (jeven && ieven) {
-                yv12_u[i] = clamp_rgb((( -43 * R - 85 * G + 128 * B) >> 8) + 128);
-                yv12_v[i] = clamp_rgb((( 128 * R - 107 * G - 21 * B) >> 8) + 128);
-            }
-        }
+        rgb888_row_to_yuv(rgb_ptr, yv12_y,
+                          jeven ? yv12_u : nullptr, jeven ? yv12_v : nullptr,
+                          left, right, kCameraRgbToYuv);
     }
 }
 
@@ -298,22 +650,7 @@ void yv12_to_rgb888(char* dest, char* src, int width, int height,
         uint8_t *yv12_v = yv12_v0 + (j/2) * cStride;
         uint8_t *yv12_u = yv12_v + cSize;
         uint8_t *rgb_ptr = rgb_ptr0 + get_rgb_offset(j - top, right - left + 1, rgb_stride);
-        for (int i = left; i <= right; ++i) {
-            // convert to rgb
-            // https://en.wikipedia.org/wiki/YCbCr#ITU-R_BT.601_conversion
-            // but scale down U by 0.96 to mitigate rgb over/under flow
-            signed y1 = (signed)yv12_y[i] - 16;
-            signed u = (signed)yv12_u[i / 2] - 128;
-            signed v = (signed)yv12_v[i / 2] - 128;
-
-            signed r1 = clamp_rgb(1 * (1.1643835616438356 * y1 + 1.5960267857142856 * v));
-            signed g1 = clamp_rgb(1 * (1.1643835616438356 * y1 - 0.39176229009491365 * u * 0.97  - 0.8129676472377708 * v));
-            signed b1 = clamp_rgb(1 * (1.1643835616438356 * y1 + 2.017232142857143 * u * 0.97));
-
-            rgb_ptr[(i-left)*rgb_stride] = r1;
-            rgb_ptr[(i-left)*rgb_stride+1] = g1;
-            rgb_ptr[(i-left)*rgb_stride+2] = b1;
-        }
+        yuv_row_to_rgb888(yv12_y, yv12_u, yv12_v, rgb_ptr, left, right, kBt601YuvToRgb);
     }
 }
 
@@ -337,27 +674,7 @@ void yuv420p_to_rgb888(char* dest, char* src, int width, int height,
         uint8_t *yv12_u = yv12_u0 + (j/2) * cStride;
         uint8_t *yv12_v = yv12_u + cSize;
         uint8_t *rgb_ptr = rgb_ptr0 + get_rgb_offset(j - top, right - left + 1, rgb_stride);
-        for (int i = left; i <= right; ++i) {
-            // convert to rgb
-            // frameworks/av/media/libstagefright/colorconversion/ColorConverter.cpp
-            signed y1 = (signed)yv12_y[i] - 16;
-            signed u = (signed)yv12_u[i / 2] - 128;
-            signed v = (signed)yv12_v[i / 2] - 128;
-
-            signed u_b = u * 517;
-            signed u_g = -u * 100;
-            signed v_g = -v * 208;
-            signed v_r = v * 409;
-
-            signed tmp1 = y1 * 298;
-            signed b1 = clamp_rgb((tmp1 + u_b) / 256);
-            signed g1 = clamp_rgb((tmp1 + v_g + u_g) / 256);
-            signed r1 = clamp_rgb((tmp1 + v_r) / 256);
-
-            rgb_ptr[(i-left)*rgb_stride] = r1;
-            rgb_ptr[(i-left)*rgb_stride+1] = g1;
-            rgb_ptr[(i-left)*rgb_stride+2] = b1;
-        }
+        yuv_row_to_rgb888(yv12_y, yv12_u, yv12_v, rgb_ptr, left, right, kColorConverterYuvToRgb);
     }
 }
 
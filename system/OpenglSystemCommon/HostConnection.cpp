@@ -19,6 +19,8 @@
 #include "aemu/base/AndroidHealthMonitor.h"
 #include "aemu/base/AndroidHealthMonitorConsumerBasic.h"
 #include "cutils/properties.h"
+#include "glUtils.h"
+#include "renderControl_opcodes.h"
 #include "renderControl_types.h"
 
 #ifdef HOST_BUILD
@@ -26,6 +28,10 @@
 #endif
 #include "aemu/base/Process.h"
 
+#include <atomic>
+#include <string>
+#include <vector>
+
 #define DEBUG_HOSTCONNECTION 0
 
 #if DEBUG_HOSTCONNECTION
@@ -39,6 +45,10 @@ using android::base::guest::HealthMonitor;
 using android::base::guest::HealthMonitorConsumerBasic;
 
 #ifdef GOLDFISH_NO_GL
+#include "CaptureStream.h"
+#include "CompressedStream.h"
+#include "FlushPolicy.h"
+
 struct gl_client_context_t {
     int placeholder;
 };
@@ -55,9 +65,22 @@ public:
     GL2Encoder(IOStream*, ChecksumCalculator*) { }
     void setContextAccessor(gl2_client_context_t *()) { }
     void setNoHostError(bool) { }
+    void setHostValidation(bool) { }
+    void setDeferredHostError(bool) { }
     void setDrawCallFlushInterval(uint32_t) { }
+    void setFlushPolicy(FlushPolicy::Kind, uint32_t) { }
+    void onFrameBoundary() { }
     void setHasAsyncUnmapBuffer(int) { }
     void setHasSyncBufferData(int) { }
+    void setHasProgramReflection(bool) { }
+    void setHasDrawLists(bool) { }
+    void setTextureContentThreshold(size_t) { }
+    void setDeferProgramLinks(bool) { }
+    bool deferProgramLinks() const { return false; }
+    void setStreamClientArrays(bool) { }
+    void setStagePixelUploads(bool) { }
+    void setAsyncReadPixels(bool) { }
+    void setLazyBufferShadows(bool) { }
 };
 #else
 #include "GLEncoder.h"
@@ -91,6 +114,7 @@ AddressSpaceStream* createVirtioGpuAddressSpaceStream(HealthMonitor<>* healthMon
 
 using gfxstream::vk::VkEncoder;
 
+#include "NullHostStream.h"
 #include "ProcessPipe.h"
 #include "QemuPipeStream.h"
 #include "TcpStream.h"
@@ -159,6 +183,7 @@ static HostConnectionType getConnectionTypeFromProperty() {
     if (!strcmp("asg", transportValue)) return HOST_CONNECTION_ADDRESS_SPACE;
     if (!strcmp("virtio-gpu-pipe", transportValue)) return HOST_CONNECTION_VIRTIO_GPU_PIPE;
     if (!strcmp("virtio-gpu-asg", transportValue)) return HOST_CONNECTION_VIRTIO_GPU_ADDRESS_SPACE;
+    if (!strcmp("null", transportValue)) return HOST_CONNECTION_NULL;
 
     return HOST_CONNECTION_QEMU_PIPE;
 #else
@@ -166,6 +191,26 @@ static HostConnectionType getConnectionTypeFromProperty() {
 #endif
 }
 
+#if defined(VIRTIO_GPU) && !defined(HOST_BUILD)
+// Whether a virtio-gpu pipe connection can instead share a ring with the
+// host in a mapped blob, as HOST_CONNECTION_VIRTIO_GPU_ADDRESS_SPACE does,
+// so that writes need no transfer or wait ioctls and the host is only
+// pinged when it has gone idle. That takes host visible blobs and a
+// gfxstream context whose capset reports the ring sizes.
+static bool virtioGpuRingSupported(uint32_t capset_id) {
+    if (capset_id != kCapsetGfxStream) return false;
+
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.pipeRing", value, "1");
+    if (!strcmp(value, "0")) return false;
+
+    const struct VirtGpuCaps caps =
+        VirtGpuDevice::getInstance((enum VirtGpuCapset)capset_id).getCaps();
+    return caps.params[kParamResourceBlob] && caps.params[kParamHostVisible] &&
+           caps.gfxstreamCapset.ringSize && caps.gfxstreamCapset.bufferSize;
+}
+#endif
+
 static uint32_t getDrawCallFlushIntervalFromProperty() {
     constexpr uint32_t kDefaultValue = 800;
 
@@ -177,6 +222,126 @@ static uint32_t getDrawCallFlushIntervalFromProperty() {
     return (interval > 0) ? uint32_t(interval) : kDefaultValue;
 }
 
+// Connections of exited threads kept for new threads, so that apps whose
+// threads come and go do not open a stream and a host render thread each
+// time. Off unless ro.boot.qemu.gltransport.idleConnections is above 0.
+static size_t getIdleConnectionsFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.idleConnections", value, "");
+    const long count = strtol(value, 0, 10);
+    return (count > 0) ? size_t(count) : 0;
+}
+
+static bool getStagePixelUploadsFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.stagePixelUploads", value, "");
+    return value[0] == '1';
+}
+
+static bool getAsyncReadPixelsFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.asyncReadPixels", value, "");
+    return value[0] == '1';
+}
+
+static bool getDeferProgramLinksFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.deferProgramLinks", value, "");
+    return value[0] == '1';
+}
+
+// Texture uploads of at least this many KiB are deduplicated; 0 turns it off.
+static size_t getTextureContentThresholdFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.textureDedupKiB", value, "");
+    const long kib = strtol(value, 0, 10);
+    return (kib > 0) ? size_t(kib) * 1024 : 0;
+}
+
+static bool getHostValidationFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.hostValidation", value, "");
+    return value[0] == '1';
+}
+
+static bool getDeferredHostErrorFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.deferredHostError", value, "");
+    return value[0] == '1';
+}
+
+static bool getLazyBufferShadowsFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.lazyBufferShadows", value, "");
+    return value[0] == '1';
+}
+
+static FlushPolicy::Kind getFlushPolicyFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.flushPolicy", value, "");
+    return FlushPolicy::kindFromString(value, FlushPolicy::Kind::FixedInterval);
+}
+
+static bool getStreamClientArraysFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.streamClientArrays", value, "");
+    return value[0] == '1';
+}
+
+#ifdef __ANDROID__
+static TcpStream::Options getTcpOptionsFromProperty() {
+    TcpStream::Options options;
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.tcpCork", value, "");
+    options.cork = value[0] == '1';
+    property_get("ro.boot.qemu.gltransport.tcpZeroCopyThreshold", value, "");
+    options.zeroCopyThreshold = strtoul(value, 0, 10);
+    property_get("ro.boot.qemu.gltransport.tcpSendBufferSize", value, "");
+    options.sendBufferSize = atoi(value);
+    return options;
+}
+#endif
+
+// Codec requested for the command stream; only "lz4" is recognized.
+static CompressedStream::Codec getStreamCompressionFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.compression", value, "");
+    return !strcmp(value, "lz4") ? CompressedStream::CODEC_LZ4 : CompressedStream::CODEC_NONE;
+}
+
+// Where to record the command stream of each connection for replay, if
+// anywhere. Files are named after the process and the connection.
+static std::string getStreamCapturePathFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("debug.gfxstream.capture.dir", value, "");
+    if (!value[0]) return "";
+
+    static std::atomic<uint32_t> sConnectionCount(0);
+    char path[PROPERTY_VALUE_MAX + 64];
+    snprintf(path, sizeof(path), "%s/gfxstream-%d-%u.cap", value, getpid(),
+             sConnectionCount++);
+    return path;
+}
+
+static std::string getNullHostScriptPathFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("debug.gfxstream.null_host.script", value, "");
+    return value;
+}
+
+// Highest checksum version the guest will agree to; "0" or "off" keeps
+// checksums disabled even if the host supports them.
+static uint32_t getMaxChecksumVersionFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.checksum", value, "");
+    if (!value[0]) return ChecksumCalculator::getMaxVersion();
+    if (!strcmp(value, "off")) return 0;
+
+    const unsigned long version = strtoul(value, 0, 10);
+    return version < ChecksumCalculator::getMaxVersion()
+        ? uint32_t(version) : ChecksumCalculator::getMaxVersion();
+}
+
 static GrallocType getGrallocTypeFromProperty() {
     char value[PROPERTY_VALUE_MAX] = "";
     property_get("ro.hardware.gralloc", value, "");
@@ -462,11 +627,17 @@ HostConnection::~HostConnection()
 
 
 // static
-std::unique_ptr<HostConnection> HostConnection::connect(uint32_t capset_id) {
-    const enum HostConnectionType connType = getConnectionTypeFromProperty();
-
+std::unique_ptr<HostConnection> HostConnection::connect(enum HostConnectionType connType,
+                                                        uint32_t capset_id) {
     // Use "new" to access a non-public constructor.
     auto con = std::unique_ptr<HostConnection>(new HostConnection);
+    con->m_capsetId = capset_id;
+
+#if defined(VIRTIO_GPU) && !defined(HOST_BUILD)
+    if (connType == HOST_CONNECTION_VIRTIO_GPU_PIPE && virtioGpuRingSupported(capset_id)) {
+        connType = HOST_CONNECTION_VIRTIO_GPU_ADDRESS_SPACE;
+    }
+#endif
 
     switch (connType) {
         case HOST_CONNECTION_ADDRESS_SPACE: {
@@ -515,6 +686,7 @@ std::unique_ptr<HostConnection> HostConnection::connect(uint32_t capset_id) {
                 ALOGE("Failed to connect to host (TcpStream)\n");
                 return nullptr;
             }
+            stream->setOptions(getTcpOptionsFromProperty());
             con->m_connectionType = HOST_CONNECTION_TCP;
             con->m_grallocType = GRALLOC_TYPE_RANCHU;
             con->m_stream = stream;
@@ -525,7 +697,7 @@ std::unique_ptr<HostConnection> HostConnection::connect(uint32_t capset_id) {
         }
 #if defined(VIRTIO_GPU) && !defined(HOST_BUILD)
         case HOST_CONNECTION_VIRTIO_GPU_PIPE: {
-            auto stream = new VirtioGpuPipeStream(STREAM_BUFFER_SIZE);
+            auto stream = new VirtioGpuPipeStream(STREAM_BUFFER_SIZE, getGlobalHealthMonitor());
             if (!stream) {
                 ALOGE("Failed to create VirtioGpu for host connection\n");
                 return nullptr;
@@ -586,10 +758,35 @@ std::unique_ptr<HostConnection> HostConnection::connect(uint32_t capset_id) {
             break;
         }
 #endif // !VIRTIO_GPU && !HOST_BUILD_
+        case HOST_CONNECTION_NULL: {
+            auto stream = new NullHostStream(STREAM_BUFFER_SIZE);
+            const std::string scriptPath = getNullHostScriptPathFromProperty();
+            if (!scriptPath.empty()) {
+                stream->loadScript(scriptPath.c_str());
+            }
+            con->m_connectionType = HOST_CONNECTION_NULL;
+            con->m_grallocType = GRALLOC_TYPE_RANCHU;
+            con->m_stream = stream;
+            con->m_grallocHelper = &m_goldfishGralloc;
+            break;
+        }
         default:
             break;
     }
 
+    if (!con->m_stream) {
+        ALOGE("No transport for host connection type %d\n", connType);
+        return nullptr;
+    }
+
+    // Captures start before the first byte so that a replay sees the same
+    // handshake as the host did.
+    const std::string capturePath = getStreamCapturePathFromProperty();
+    if (!capturePath.empty()) {
+        con->m_stream = new CaptureStream(con->m_stream, capturePath.c_str(),
+                                          STREAM_BUFFER_SIZE);
+    }
+
     // send zero 'clientFlags' to the host.
     unsigned int *pClientFlags =
             (unsigned int *)con->m_stream->allocBuffer(sizeof(unsigned int));
@@ -626,6 +823,9 @@ HostConnection *HostConnection::getWithThreadInfo(EGLThreadInfo* tinfo, uint32_t
         return NULL;
     }
 
+    if (tinfo->hostConn == NULL) {
+        tinfo->hostConn = takeIdleConnection(capset_id);
+    }
     if (tinfo->hostConn == NULL) {
         tinfo->hostConn = HostConnection::createUnique(capset_id);
     }
@@ -633,6 +833,58 @@ HostConnection *HostConnection::getWithThreadInfo(EGLThreadInfo* tinfo, uint32_t
     return tinfo->hostConn.get();
 }
 
+// Never destroyed, so threads that exit during process teardown can still
+// use it.
+static std::mutex* sIdleConnectionsLock = new std::mutex;
+static std::vector<std::unique_ptr<HostConnection>>* sIdleConnections =
+    new std::vector<std::unique_ptr<HostConnection>>;
+
+// static
+std::unique_ptr<HostConnection> HostConnection::takeIdleConnection(uint32_t capset_id) {
+    std::lock_guard<std::mutex> lock(*sIdleConnectionsLock);
+    for (auto it = sIdleConnections->begin(); it != sIdleConnections->end(); ++it) {
+        if ((*it)->m_capsetId == capset_id) {
+            std::unique_ptr<HostConnection> con = std::move(*it);
+            sIdleConnections->erase(it);
+            return con;
+        }
+    }
+    return nullptr;
+}
+
+// static
+void HostConnection::recycle(std::unique_ptr<HostConnection> con) {
+    static const size_t sMaxIdleConnections = getIdleConnectionsFromProperty();
+    if (!con || con->exitUncleanly || sMaxIdleConnections == 0) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(*sIdleConnectionsLock);
+        if (sIdleConnections->size() >= sMaxIdleConnections) {
+            return;
+        }
+    }
+
+    con->clearBeforeNextGLCommand();
+    con->trimMemory();
+    // The GL encoders keep per-thread state, such as the current context
+    // state, fence timelines and DMA rings. The next thread gets new ones
+    // on the same stream.
+    con->m_glEnc.reset();
+    con->m_gl2Enc.reset();
+    // Idle connections are not destroyed at process exit, so make sure the
+    // host is done with what the thread sent, as the destructor would.
+    if (con->m_rcEnc) {
+        (void)con->m_rcEnc->rcGetRendererVersion(con->m_rcEnc.get());
+    }
+
+    std::lock_guard<std::mutex> lock(*sIdleConnectionsLock);
+    if (sIdleConnections->size() < sMaxIdleConnections) {
+        sIdleConnections->push_back(std::move(con));
+    }
+}
+
 void HostConnection::exit() {
     EGLThreadInfo *tinfo = getEGLThreadInfo();
     if (!tinfo) {
@@ -654,11 +906,18 @@ void HostConnection::exitUnclean() {
 
 // static
 std::unique_ptr<HostConnection> HostConnection::createUnique(uint32_t capset_id) {
-    return connect(capset_id);
+    return connect(getConnectionTypeFromProperty(), capset_id);
+}
+
+// static
+std::unique_ptr<HostConnection> HostConnection::createUniqueWithType(
+        enum HostConnectionType connType, uint32_t capset_id) {
+    return connect(connType, capset_id);
 }
 
 GLEncoder *HostConnection::glEncoder()
 {
+    runBeforeNextGLCommand();
     if (!m_glEnc) {
         m_glEnc = std::make_unique<GLEncoder>(m_stream, checksumHelper());
         DBG("HostConnection::glEncoder new encoder %p, tid %lu", m_glEnc, getCurrentThreadId());
@@ -667,18 +926,52 @@ GLEncoder *HostConnection::glEncoder()
     return m_glEnc.get();
 }
 
+void HostConnection::onFrameBoundary()
+{
+    if (m_gl2Enc) {
+        m_gl2Enc->onFrameBoundary();
+    }
+    if (m_stream) {
+        m_stream->onFrameBoundary();
+    }
+}
+
+void HostConnection::trimMemory()
+{
+    if (m_glEnc) {
+        m_glEnc->trimScratchBuffers();
+    }
+    if (m_stream) {
+        m_stream->trim();
+    }
+}
+
 GL2Encoder *HostConnection::gl2Encoder()
 {
+    runBeforeNextGLCommand();
     if (!m_gl2Enc) {
         m_gl2Enc =
             std::make_unique<GL2Encoder>(m_stream, checksumHelper());
         DBG("HostConnection::gl2Encoder new encoder %p, tid %lu", m_gl2Enc, getCurrentThreadId());
         m_gl2Enc->setContextAccessor(s_getGL2Context);
         m_gl2Enc->setNoHostError(m_noHostError);
-        m_gl2Enc->setDrawCallFlushInterval(
+        m_gl2Enc->setHostValidation(!m_noHostError && getHostValidationFromProperty());
+        m_gl2Enc->setDeferredHostError(!m_noHostError && getDeferredHostErrorFromProperty());
+        m_gl2Enc->setFlushPolicy(
+            getFlushPolicyFromProperty(),
             getDrawCallFlushIntervalFromProperty());
         m_gl2Enc->setHasAsyncUnmapBuffer(m_rcEnc->hasAsyncUnmapBuffer());
         m_gl2Enc->setHasSyncBufferData(m_rcEnc->hasSyncBufferData());
+        m_gl2Enc->setHasProgramReflection(m_rcEnc->hasGLESProgramReflection());
+        m_gl2Enc->setHasDrawLists(m_rcEnc->hasGLESDrawLists());
+        if (m_rcEnc->hasGLESTextureContent()) {
+            m_gl2Enc->setTextureContentThreshold(getTextureContentThresholdFromProperty());
+        }
+        m_gl2Enc->setStreamClientArrays(getStreamClientArraysFromProperty());
+        m_gl2Enc->setStagePixelUploads(getStagePixelUploadsFromProperty());
+        m_gl2Enc->setAsyncReadPixels(getAsyncReadPixelsFromProperty());
+        m_gl2Enc->setLazyBufferShadows(getLazyBufferShadowsFromProperty());
+        m_gl2Enc->setDeferProgramLinks(getDeferProgramLinksFromProperty());
     }
     return m_gl2Enc.get();
 }
@@ -692,6 +985,25 @@ VkEncoder *HostConnection::vkEncoder()
     return m_vkEnc;
 }
 
+// The generated encoder flushes the command header before the pixels and
+// writes them separately; checksummed streams still go through it.
+int ExtendedRCEncoderContext::s_rcUpdateColorBuffer(void* self, uint32_t colorbuffer,
+                                                    GLint x, GLint y, GLint width, GLint height,
+                                                    GLenum format, GLenum type, void* pixels) {
+    ExtendedRCEncoderContext* ctx = (ExtendedRCEncoderContext*)self;
+    if (ctx->m_checksumCalculator->getVersion() > 0 || !pixels) {
+        return ctx->m_rcUpdateColorBuffer_enc(self, colorbuffer, x, y, width, height,
+                                              format, type, pixels);
+    }
+    const uint32_t pixelsSize = ((glUtilsPixelBitSize(format, type) * width) >> 3) * height;
+    ctx->m_stream->allocLargeParamHeader(OP_rcUpdateColorBuffer, pixelsSize, 0, colorbuffer,
+                                         x, y, width, height, format, type);
+    ctx->m_stream->writeLargeParam(pixels, pixelsSize);
+    int retval;
+    ctx->m_stream->readback(&retval, 4);
+    return retval;
+}
+
 ExtendedRCEncoderContext *HostConnection::rcEncoder()
 {
     if (!m_rcEnc) {
@@ -726,9 +1038,18 @@ ExtendedRCEncoderContext *HostConnection::rcEncoder()
         queryAndSetSyncBufferData(rcEnc);
         queryAndSetVulkanAsyncQsri(rcEnc);
         queryAndSetReadColorBufferDma(rcEnc);
+        queryAndSetReadColorBufferYUVDma(rcEnc);
         queryAndSetHWCMultiConfigs(rcEnc);
         queryAndSetVulkanAuxCommandBufferMemory(rcEnc);
+        queryAndSetVulkanShaderModuleCache(rcEnc);
+        queryAndSetGLESProgramReflection(rcEnc);
+        queryAndSetGLESTextureContent(rcEnc);
+        queryAndSetColorBuffersBatch(rcEnc);
+        queryAndSetAsyncColorBufferCommands(rcEnc);
+        queryAndSetVulkanGuestHandles(rcEnc);
+        queryAndSetGLESDrawLists(rcEnc);
         queryVersion(rcEnc);
+        queryAndSetStreamCompression(rcEnc);
         if (m_processPipe) {
             auto fd = (m_connectionType == HOST_CONNECTION_VIRTIO_GPU_ADDRESS_SPACE) ? m_rendernodeFd : -1;
             m_processPipe->processPipeInit(fd, m_connectionType, rcEnc);
@@ -755,11 +1076,22 @@ gl2_client_context_t *HostConnection::s_getGL2Context()
     return NULL;
 }
 
+// Every connection of a process talks to the same host, so the extensions
+// are fetched by the first one and shared with the rest.
+static std::mutex sHostExtensionsLock;
+static std::string sHostExtensions;
+
 const std::string& HostConnection::queryHostExtensions(ExtendedRCEncoderContext *rcEnc) {
     if (!m_hostExtensions.empty()) {
         return m_hostExtensions;
     }
 
+    std::lock_guard<std::mutex> lock(sHostExtensionsLock);
+    if (!sHostExtensions.empty()) {
+        m_hostExtensions = sHostExtensions;
+        return m_hostExtensions;
+    }
+
     // Extensions strings are usually quite long, preallocate enough here.
     std::string extensionsBuffer(1023, '\0');
 
@@ -778,6 +1110,7 @@ const std::string& HostConnection::queryHostExtensions(ExtendedRCEncoderContext
     if (extensionSize > 0) {
         extensionsBuffer.resize(extensionSize - 1);
         m_hostExtensions.swap(extensionsBuffer);
+        sHostExtensions = m_hostExtensions;
     }
 
     return m_hostExtensions;
@@ -805,11 +1138,14 @@ void HostConnection::setChecksumHelper(ExtendedRCEncoderContext *rcEnc) {
     const char* checksumPrefix = ChecksumCalculator::getMaxVersionStrPrefix();
     const char* glProtocolStr = strstr(hostExtensions.c_str(), checksumPrefix);
     if (glProtocolStr) {
-        uint32_t maxVersion = ChecksumCalculator::getMaxVersion();
+        uint32_t maxVersion = getMaxChecksumVersionFromProperty();
         sscanf(glProtocolStr+strlen(checksumPrefix), "%d", &checksumVersion);
         if (maxVersion < checksumVersion) {
             checksumVersion = maxVersion;
         }
+        // Both sides start out without checksums, and the generated
+        // encoders skip all checksum work at version 0.
+        if (!checksumVersion) return;
         // The ordering of the following two commands matters!
         // Must tell the host first before setting it in the guest
         rcEnc->rcSelectChecksumHelper(rcEnc, checksumVersion, 0);
@@ -817,6 +1153,26 @@ void HostConnection::setChecksumHelper(ExtendedRCEncoderContext *rcEnc) {
     }
 }
 
+void HostConnection::queryAndSetStreamCompression(ExtendedRCEncoderContext *rcEnc) {
+    // Only worth it where bandwidth is scarce, and the other encoders
+    // must not have picked up the plain stream yet.
+    if (m_connectionType != HOST_CONNECTION_TCP) return;
+    if (m_glEnc || m_gl2Enc || m_vkEnc) return;
+
+    const CompressedStream::Codec codec = getStreamCompressionFromProperty();
+    if (codec == CompressedStream::CODEC_NONE) return;
+
+    const std::string& hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kStreamCompressionLz4) == std::string::npos) return;
+
+    // The host switches to reading frames right after this command, so
+    // it has to go out uncompressed and on its own.
+    rcEnc->rcSelectStreamCompression(rcEnc, codec, 0);
+    m_stream->flush();
+    m_stream = new CompressedStream(m_stream, codec, STREAM_BUFFER_SIZE);
+    rcEnc->m_stream = m_stream;
+}
+
 void HostConnection::queryAndSetSyncImpl(ExtendedRCEncoderContext *rcEnc) {
     const std::string& hostExtensions = queryHostExtensions(rcEnc);
     if (hostExtensions.find(kRCNativeSyncV4) != std::string::npos) {
@@ -1010,6 +1366,13 @@ void HostConnection::queryAndSetReadColorBufferDma(ExtendedRCEncoderContext* rcE
     }
 }
 
+void HostConnection::queryAndSetReadColorBufferYUVDma(ExtendedRCEncoderContext* rcEnc) {
+    std::string hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kReadColorBufferYUVDma) != std::string::npos) {
+        rcEnc->featureInfo()->hasReadColorBufferYUVDma = true;
+    }
+}
+
 void HostConnection::queryAndSetHWCMultiConfigs(ExtendedRCEncoderContext* rcEnc) {
     std::string hostExtensions = queryHostExtensions(rcEnc);
     if (hostExtensions.find(kHWCMultiConfigs) != std::string::npos) {
@@ -1022,6 +1385,55 @@ void HostConnection::queryAndSetVulkanAuxCommandBufferMemory(ExtendedRCEncoderCo
     rcEnc->featureInfo()->hasVulkanAuxCommandMemory = hostExtensions.find(kVulkanAuxCommandMemory) != std::string::npos;
 }
 
+void HostConnection::queryAndSetVulkanShaderModuleCache(ExtendedRCEncoderContext* rcEnc) {
+    std::string hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kVulkanShaderModuleCache) != std::string::npos) {
+        rcEnc->featureInfo()->hasVulkanShaderModuleCache = true;
+    }
+}
+
+void HostConnection::queryAndSetGLESProgramReflection(ExtendedRCEncoderContext* rcEnc) {
+    std::string hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kGLESProgramReflection) != std::string::npos) {
+        rcEnc->featureInfo()->hasGLESProgramReflection = true;
+    }
+}
+
+void HostConnection::queryAndSetGLESTextureContent(ExtendedRCEncoderContext* rcEnc) {
+    std::string hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kGLESTextureContent) != std::string::npos) {
+        rcEnc->featureInfo()->hasGLESTextureContent = true;
+    }
+}
+
+void HostConnection::queryAndSetColorBuffersBatch(ExtendedRCEncoderContext* rcEnc) {
+    std::string hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kColorBuffersBatch) != std::string::npos) {
+        rcEnc->featureInfo()->hasColorBuffersBatch = true;
+    }
+}
+
+void HostConnection::queryAndSetAsyncColorBufferCommands(ExtendedRCEncoderContext* rcEnc) {
+    std::string hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kAsyncColorBufferCommands) != std::string::npos) {
+        rcEnc->featureInfo()->hasAsyncColorBufferCommands = true;
+    }
+}
+
+void HostConnection::queryAndSetVulkanGuestHandles(ExtendedRCEncoderContext* rcEnc) {
+    std::string hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kVulkanGuestHandles) != std::string::npos) {
+        rcEnc->featureInfo()->hasVulkanGuestHandles = true;
+    }
+}
+
+void HostConnection::queryAndSetGLESDrawLists(ExtendedRCEncoderContext* rcEnc) {
+    std::string hostExtensions = queryHostExtensions(rcEnc);
+    if (hostExtensions.find(kGLESDrawLists) != std::string::npos) {
+        rcEnc->featureInfo()->hasGLESDrawLists = true;
+    }
+}
+
 
 GLint HostConnection::queryVersion(ExtendedRCEncoderContext* rcEnc) {
     GLint version = m_rcEnc->rcGetRendererVersion(m_rcEnc.get());
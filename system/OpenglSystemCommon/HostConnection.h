@@ -34,6 +34,7 @@ struct goldfish_dma_context;
 #include <utils/threads.h>
 #endif
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <cstring>
@@ -55,7 +56,10 @@ class ExtendedRCEncoderContext : public renderControl_encoder_context_t {
 public:
     ExtendedRCEncoderContext(IOStream *stream, ChecksumCalculator *checksumCalculator)
         : renderControl_encoder_context_t(stream, checksumCalculator),
-          m_dmaCxt(NULL), m_dmaPtr(NULL), m_dmaPhysAddr(0) { }
+          m_dmaCxt(NULL), m_dmaPtr(NULL), m_dmaPhysAddr(0) {
+        m_rcUpdateColorBuffer_enc = rcUpdateColorBuffer;
+        rcUpdateColorBuffer = &s_rcUpdateColorBuffer;
+    }
     void setSyncImpl(SyncImpl syncImpl) { m_featureInfo.syncImpl = syncImpl; }
     void setDmaImpl(DmaImpl dmaImpl) { m_featureInfo.dmaImpl = dmaImpl; }
     void setHostComposition(HostComposition hostComposition) {
@@ -83,6 +87,21 @@ public:
     bool hasHWCMultiConfigs() const {
         return m_featureInfo.hasHWCMultiConfigs;
     }
+    bool hasGLESProgramReflection() const {
+        return m_featureInfo.hasGLESProgramReflection;
+    }
+    bool hasGLESTextureContent() const {
+        return m_featureInfo.hasGLESTextureContent;
+    }
+    bool hasColorBuffersBatch() const {
+        return m_featureInfo.hasColorBuffersBatch;
+    }
+    bool hasAsyncColorBufferCommands() const {
+        return m_featureInfo.hasAsyncColorBufferCommands;
+    }
+    bool hasGLESDrawLists() const {
+        return m_featureInfo.hasGLESDrawLists;
+    }
     DmaImpl getDmaVersion() const { return m_featureInfo.dmaImpl; }
     void bindDmaContext(struct goldfish_dma_context* cxt) { m_dmaCxt = cxt; }
     void bindDmaDirectly(void* dmaPtr, uint64_t dmaPhysAddr) {
@@ -132,6 +151,12 @@ private:
 #endif
     }
 
+    // Sends the pixels with the command header in one write.
+    static int s_rcUpdateColorBuffer(void* self, uint32_t colorbuffer, GLint x, GLint y,
+                                     GLint width, GLint height, GLenum format, GLenum type,
+                                     void* pixels);
+    rcUpdateColorBuffer_client_proc_t m_rcUpdateColorBuffer_enc;
+
     EmulatorFeatureInfo m_featureInfo;
     struct goldfish_dma_context* m_dmaCxt;
     void* m_dmaPtr;
@@ -181,8 +206,16 @@ public:
                                              uint32_t capset_id = VIRTIO_GPU_CAPSET_NONE);
     static void exit();
     static void exitUnclean(); // for testing purposes
+    // Called with the connection of a thread that is exiting. Keeps it for
+    // the next thread that needs one if the idle pool has room, or destroys
+    // it otherwise.
+    static void recycle(std::unique_ptr<HostConnection> con);
 
     static std::unique_ptr<HostConnection> createUnique(uint32_t capset_id = VIRTIO_GPU_CAPSET_NONE);
+    // Connects over |connType| whatever the gltransport properties say, for
+    // tools that compare transports. Returns nullptr if it is unavailable.
+    static std::unique_ptr<HostConnection> createUniqueWithType(
+        enum HostConnectionType connType, uint32_t capset_id = VIRTIO_GPU_CAPSET_NONE);
     HostConnection(const HostConnection&) = delete;
 
     ~HostConnection();
@@ -193,6 +226,7 @@ public:
     ExtendedRCEncoderContext *rcEncoder();
 
     int getRendernodeFd() { return m_rendernodeFd; }
+    IOStream* stream() { return m_stream; }
 
     ChecksumCalculator *checksumHelper() { return &m_checksumHelper; }
     Gralloc *grallocHelper() { return m_grallocHelper; }
@@ -203,6 +237,29 @@ public:
         }
     }
 
+    // Called after the flush that presents a frame.
+    void onFrameBoundary();
+
+    // Flushes and gives back stream and encoder memory that grew while
+    // the connection was busy. For connections about to sit idle.
+    void trimMemory();
+
+    // Has |work| run before glEncoder() or gl2Encoder() next hand out an
+    // encoder, that is, ahead of the next GL command of this connection.
+    // Replaces work set before and not run yet.
+    void setBeforeNextGLCommand(std::function<void()> work) {
+        m_beforeNextGLCommand = std::move(work);
+    }
+    void clearBeforeNextGLCommand() { m_beforeNextGLCommand = nullptr; }
+    // Runs the work set with setBeforeNextGLCommand() now, if there is any.
+    void runBeforeNextGLCommand() {
+        if (m_beforeNextGLCommand) {
+            std::function<void()> work = std::move(m_beforeNextGLCommand);
+            m_beforeNextGLCommand = nullptr;
+            work();
+        }
+    }
+
     void setGrallocOnly(bool gralloc_only) {
         m_grallocOnly = gralloc_only;
     }
@@ -224,7 +281,9 @@ public:
 private:
     // If the connection failed, |conn| is deleted.
     // Returns NULL if connection failed.
-    static std::unique_ptr<HostConnection> connect(uint32_t capset_id);
+    static std::unique_ptr<HostConnection> connect(enum HostConnectionType connType,
+                                                   uint32_t capset_id);
+    static std::unique_ptr<HostConnection> takeIdleConnection(uint32_t capset_id);
 
     HostConnection();
     static gl_client_context_t  *s_getGLContext();
@@ -260,13 +319,24 @@ private:
     void queryAndSetSyncBufferData(ExtendedRCEncoderContext *rcEnc);
     void queryAndSetVulkanAsyncQsri(ExtendedRCEncoderContext *rcEnc);
     void queryAndSetReadColorBufferDma(ExtendedRCEncoderContext *rcEnc);
+    void queryAndSetReadColorBufferYUVDma(ExtendedRCEncoderContext *rcEnc);
     void queryAndSetHWCMultiConfigs(ExtendedRCEncoderContext* rcEnc);
     void queryAndSetVulkanAuxCommandBufferMemory(ExtendedRCEncoderContext* rcEnc);
+    void queryAndSetVulkanShaderModuleCache(ExtendedRCEncoderContext* rcEnc);
+    void queryAndSetGLESProgramReflection(ExtendedRCEncoderContext* rcEnc);
+    void queryAndSetGLESTextureContent(ExtendedRCEncoderContext* rcEnc);
+    void queryAndSetColorBuffersBatch(ExtendedRCEncoderContext* rcEnc);
+    void queryAndSetAsyncColorBufferCommands(ExtendedRCEncoderContext* rcEnc);
+    void queryAndSetVulkanGuestHandles(ExtendedRCEncoderContext* rcEnc);
+    void queryAndSetGLESDrawLists(ExtendedRCEncoderContext* rcEnc);
+    // Must run last: it swaps m_stream for a compressing wrapper.
+    void queryAndSetStreamCompression(ExtendedRCEncoderContext* rcEnc);
     GLint queryVersion(ExtendedRCEncoderContext* rcEnc);
 
 private:
     HostConnectionType m_connectionType;
     GrallocType m_grallocType;
+    uint32_t m_capsetId = VIRTIO_GPU_CAPSET_NONE;
 
     // intrusively refcounted
     IOStream* m_stream = nullptr;
@@ -284,6 +354,7 @@ private:
     std::string m_hostExtensions;
     bool m_grallocOnly;
     bool m_noHostError;
+    std::function<void()> m_beforeNextGLCommand;
 #ifdef GFXSTREAM
     mutable std::mutex m_lock;
 #else
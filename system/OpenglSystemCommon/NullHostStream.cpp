@@ -0,0 +1,215 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#include "NullHostStream.h"
+
+#include <EGL/egl.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <utility>
+
+#include "ErrorLog.h"
+#include "renderControl_opcodes.h"
+
+NullHostStream::NullHostStream(size_t bufSize) :
+    IOStream(bufSize),
+    m_bufsize(bufSize),
+    m_buf(NULL),
+    m_bytesWritten(0),
+    m_response(NULL),
+    m_responseOffset(0),
+    m_skip(sizeof(uint32_t)),
+    m_headerSize(0),
+    m_packetLeft(0)
+{
+    setDefaultResponses();
+}
+
+NullHostStream::~NullHostStream()
+{
+    free(m_buf);
+}
+
+void NullHostStream::setDefaultResponses()
+{
+    // The attributes eglDisplay and the GLES encoders look at, then the
+    // values of the one config.
+    static const uint32_t kConfigs[] = {
+        EGL_CONFIG_ID, EGL_BUFFER_SIZE, EGL_RED_SIZE, EGL_GREEN_SIZE,
+        EGL_BLUE_SIZE, EGL_ALPHA_SIZE, EGL_DEPTH_SIZE, EGL_STENCIL_SIZE,
+        EGL_SAMPLES, EGL_SURFACE_TYPE, EGL_RENDERABLE_TYPE, EGL_CONFORMANT,
+        EGL_COLOR_BUFFER_TYPE, EGL_NATIVE_VISUAL_ID,
+
+        0, 32, 8, 8,
+        8, 8, 24, 8,
+        0, EGL_WINDOW_BIT | EGL_PBUFFER_BIT, 0x45 /* ES1, ES2 and ES3 */, 0x45,
+        EGL_RGB_BUFFER, 0,
+    };
+    const uint32_t numAttribs = 14;
+
+    setResponse(OP_rcGetRendererVersion, { 1 });
+    setResponse(OP_rcGetEGLVersion, { 1, 4, EGL_TRUE });
+    setResponse(OP_rcGetNumConfigs, { numAttribs, 1 });
+    std::vector<uint32_t> configs(kConfigs, kConfigs + sizeof(kConfigs) / sizeof(kConfigs[0]));
+    configs.push_back(1);
+    setResponse(OP_rcGetConfigs, std::move(configs));
+    setResponse(OP_rcChooseConfig, { 0, 1 });
+    setResponse(OP_rcCreateContext, { 1 });
+    setResponse(OP_rcCreateWindowSurface, { 1 });
+    setResponse(OP_rcCreateColorBuffer, { 1 });
+    setResponse(OP_rcCreateClientImage, { 1 });
+    setResponse(OP_rcMakeCurrent, { EGL_TRUE });
+}
+
+void NullHostStream::setResponse(uint32_t opcode, std::vector<uint32_t> words)
+{
+    m_responses[opcode] = std::move(words);
+    m_response = NULL;
+}
+
+bool NullHostStream::loadScript(const char* path)
+{
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        ERR("%s: can not open %s\n", __FUNCTION__, path);
+        return false;
+    }
+
+    char line[4096];
+    while (fgets(line, sizeof(line), file)) {
+        char* p = line;
+        char* end = NULL;
+        const unsigned long opcode = strtoul(p, &end, 0);
+        if (end == p) continue;  // blank lines and comments
+
+        std::vector<uint32_t> words;
+        for (p = end;; p = end) {
+            const unsigned long word = strtoul(p, &end, 0);
+            if (end == p) break;
+            words.push_back((uint32_t)word);
+        }
+        setResponse((uint32_t)opcode, std::move(words));
+    }
+
+    fclose(file);
+    return true;
+}
+
+void *NullHostStream::allocBuffer(size_t minSize)
+{
+    size_t allocSize = (m_bufsize < minSize ? minSize : m_bufsize);
+    if (!m_buf) {
+        m_buf = (unsigned char *)malloc(allocSize);
+        m_bufsize = allocSize;
+    } else if (m_bufsize < allocSize) {
+        unsigned char *p = (unsigned char *)realloc(m_buf, allocSize);
+        if (p != NULL) {
+            m_buf = p;
+            m_bufsize = allocSize;
+        } else {
+            ERR("%s: realloc (%zu) failed\n", __FUNCTION__, allocSize);
+            free(m_buf);
+            m_buf = NULL;
+            m_bufsize = 0;
+        }
+    }
+    return m_buf;
+}
+
+int NullHostStream::commitBuffer(size_t size)
+{
+    return writeFully(m_buf, size);
+}
+
+const unsigned char *NullHostStream::readFully(void *buf, size_t len)
+{
+    unsigned char* out = (unsigned char*)buf;
+    size_t done = 0;
+    if (m_response) {
+        const size_t responseSize = m_response->size() * sizeof(uint32_t);
+        if (m_responseOffset < responseSize) {
+            done = responseSize - m_responseOffset < len ? responseSize - m_responseOffset : len;
+            memcpy(out, (const unsigned char*)m_response->data() + m_responseOffset, done);
+            m_responseOffset += done;
+        }
+    }
+    memset(out + done, 0, len - done);
+    return out;
+}
+
+const unsigned char *NullHostStream::commitBufferAndReadFully(size_t size, void *buf, size_t len)
+{
+    commitBuffer(size);
+    return readFully(buf, len);
+}
+
+const unsigned char *NullHostStream::read(void *buf, size_t *inout_len)
+{
+    return readFully(buf, *inout_len);
+}
+
+int NullHostStream::writeFully(const void *buf, size_t len)
+{
+    m_bytesWritten += len;
+    consume((const unsigned char*)buf, len);
+    return 0;
+}
+
+void NullHostStream::consume(const unsigned char* data, size_t len)
+{
+    while (len) {
+        if (m_skip) {
+            const size_t n = m_skip < len ? m_skip : len;
+            m_skip -= n;
+            data += n;
+            len -= n;
+            continue;
+        }
+        if (m_packetLeft) {
+            const size_t n = m_packetLeft < len ? (size_t)m_packetLeft : len;
+            m_packetLeft -= n;
+            data += n;
+            len -= n;
+            continue;
+        }
+
+        const size_t n = sizeof(m_header) - m_headerSize < len ?
+                sizeof(m_header) - m_headerSize : len;
+        memcpy(m_header + m_headerSize, data, n);
+        m_headerSize += n;
+        data += n;
+        len -= n;
+        if (m_headerSize < sizeof(m_header)) break;
+
+        uint32_t opcode;
+        uint32_t packetSize;
+        memcpy(&opcode, m_header, sizeof(opcode));
+        memcpy(&packetSize, m_header + sizeof(opcode), sizeof(packetSize));
+        m_headerSize = 0;
+        m_packetLeft = packetSize > sizeof(m_header) ? packetSize - sizeof(m_header) : 0;
+
+        std::map<uint32_t, std::vector<uint32_t>>::const_iterator it = m_responses.find(opcode);
+        m_response = it != m_responses.end() ? &it->second : NULL;
+        m_responseOffset = 0;
+    }
+}
+
+void NullHostStream::releaseBuffers()
+{
+    free(m_buf);
+    m_buf = NULL;
+    m_bufsize = initialBufferSize();
+}
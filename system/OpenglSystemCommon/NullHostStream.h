@@ -0,0 +1,89 @@
+/*
+* Copyright (C) 2026 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#ifndef __NULL_HOST_STREAM_H
+#define __NULL_HOST_STREAM_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <map>
+#include <vector>
+
+#include "IOStream.h"
+
+// A transport with no host behind it, for measuring what the guest stack
+// costs on its own: everything written is dropped, and reads are answered
+// right away. The stream follows the packets going by, each an opcode and
+// a size in bytes including that header, and answers the reads that come
+// after a packet with the words scripted for its opcode, in order, and
+// zeroes past them.
+//
+// Built in are the render control answers that let EGL initialize and
+// contexts, surfaces and color buffers be created: one RGBA8888 config and
+// handles of 1. A script from the file named by
+// debug.gfxstream.null_host.script adds to or replaces them, one opcode a
+// line followed by the 32 bit words of its answer, in decimal or 0x hex:
+//
+//   # rcGetFBParam
+//   10007 1920
+//
+// Selected with the "null" gltransport.
+class NullHostStream : public IOStream {
+public:
+    explicit NullHostStream(size_t bufSize = 10000);
+    virtual ~NullHostStream();
+
+    virtual void *allocBuffer(size_t minSize);
+    virtual int commitBuffer(size_t size);
+    virtual const unsigned char *readFully(void *buf, size_t len);
+    virtual const unsigned char *commitBufferAndReadFully(size_t size, void *buf, size_t len);
+    virtual const unsigned char *read(void *buf, size_t *inout_len);
+    virtual int writeFully(const void *buf, size_t len);
+
+    // Answers reads after packets of |opcode| with |words|.
+    void setResponse(uint32_t opcode, std::vector<uint32_t> words);
+
+    // Reads the script at |path|. Returns false if it can not be opened.
+    bool loadScript(const char* path);
+
+    uint64_t bytesWritten() const { return m_bytesWritten; }
+
+protected:
+    virtual void releaseBuffers() override;
+
+private:
+    void setDefaultResponses();
+    void consume(const unsigned char* data, size_t len);
+
+    size_t m_bufsize;
+    unsigned char *m_buf;
+    uint64_t m_bytesWritten;
+
+    std::map<uint32_t, std::vector<uint32_t>> m_responses;
+    // What the reads after the current packet get.
+    const std::vector<uint32_t>* m_response;
+    size_t m_responseOffset;
+
+    // The clientFlags word HostConnection sends first is not a packet.
+    size_t m_skip;
+    // Header of the next packet, as far as it has been seen.
+    unsigned char m_header[8];
+    size_t m_headerSize;
+    // Bytes of the current packet after its header still to come.
+    uint64_t m_packetLeft;
+};
+
+#endif
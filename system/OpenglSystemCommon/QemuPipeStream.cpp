@@ -27,6 +27,8 @@
 #include <unistd.h>
 #include <string.h>
 
+#include <vector>
+
 static const size_t kReadSize = 512 * 1024;
 static const size_t kWriteOffset = kReadSize;
 
@@ -95,9 +97,22 @@ void *QemuPipeStream::allocBuffer(size_t minSize)
         }
     }
 
+    m_bufMemory.set(m_buf ? allocSize : 0);
     return m_buf + kWriteOffset;
 };
 
+void QemuPipeStream::releaseBuffers()
+{
+    // The front of the buffer may still hold data read ahead from the host.
+    if (m_readLeft) {
+        return;
+    }
+    free(m_buf);
+    m_buf = NULL;
+    m_bufsize = initialBufferSize();
+    m_bufMemory.set(0);
+}
+
 int QemuPipeStream::commitBuffer(size_t size)
 {
     if (size == 0) return 0;
@@ -109,6 +124,17 @@ int QemuPipeStream::writeFully(const void *buf, size_t len)
     return qemu_pipe_write_fully(m_sock, buf, len);
 }
 
+int QemuPipeStream::commitBufferAndWritevFully(size_t size, const struct iovec* iov, int iovcnt)
+{
+    std::vector<struct iovec> all;
+    all.reserve(iovcnt + 1);
+    if (size) {
+        all.push_back({ m_buf + kWriteOffset, size });
+    }
+    all.insert(all.end(), iov, iov + iovcnt);
+    return qemu_pipe_writev_fully(m_sock, all.data(), all.size());
+}
+
 QEMU_PIPE_HANDLE QemuPipeStream::getSocket() const {
     return m_sock;
 }
@@ -156,24 +182,6 @@ const unsigned char *QemuPipeStream::commitBufferAndReadFully(size_t writeSize,
         return userReadBuf;
     }
 
-    // Read up to kReadSize bytes if all buffered read has been consumed.
-    size_t maxRead = m_readLeft ? 0 : kReadSize;
-
-    ssize_t actual = 0;
-
-    if (maxRead) {
-        actual = qemu_pipe_read(m_sock, m_buf, maxRead);
-        // Updated buffered read size.
-        if (actual > 0) {
-            m_read = m_readLeft = actual;
-        }
-
-        if (actual == 0) {
-            ALOGD("%s: end of pipe", __FUNCTION__);
-            return NULL;
-        }
-    }
-
     // Consume buffered read and read more if necessary.
     while (remaining) {
         bufferedReadSize = m_readLeft < remaining ? m_readLeft : remaining;
@@ -186,15 +194,25 @@ const unsigned char *QemuPipeStream::commitBufferAndReadFully(size_t writeSize,
             continue;
         }
 
-        actual = qemu_pipe_read(m_sock, m_buf, kReadSize);
+        // Replies at least as large as the read-ahead buffer, such as
+        // glReadPixels results, go straight to the caller instead of being
+        // copied through it.
+        const bool direct = remaining >= kReadSize;
+        ssize_t actual = direct
+            ? qemu_pipe_read(m_sock, userReadBuf + (totalReadSize - remaining), remaining)
+            : qemu_pipe_read(m_sock, m_buf, kReadSize);
 
         if (actual == 0) {
-            ALOGD("%s: Failed reading from pipe: %d", __FUNCTION__,  errno);
+            ALOGD("%s: end of pipe", __FUNCTION__);
             return NULL;
         }
 
         if (actual > 0) {
-            m_read = m_readLeft = actual;
+            if (direct) {
+                remaining -= actual;
+            } else {
+                m_read = m_readLeft = actual;
+            }
             continue;
         }
 
@@ -216,6 +234,15 @@ const unsigned char *QemuPipeStream::read( void *buf, size_t *inout_len)
       return NULL;  // do not allow NULL buf in that implementation
     }
 
+    // Hand out what was read ahead before asking the host for more.
+    if (m_readLeft) {
+        const size_t n = m_readLeft < *inout_len ? m_readLeft : *inout_len;
+        memcpy(buf, m_buf + (m_read - m_readLeft), n);
+        m_readLeft -= n;
+        *inout_len = n;
+        return (const unsigned char *)buf;
+    }
+
     int n = recv(buf, *inout_len);
 
     if (n > 0) {
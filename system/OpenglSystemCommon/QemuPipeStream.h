@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <memory>
 #include "IOStream.h"
+#include "aemu/base/MemoryAccounting.h"
 
 #include <qemu_pipe_bp.h>
 
@@ -50,12 +51,23 @@ public:
     int recv(void *buf, size_t len);
 
     virtual int writeFully(const void *buf, size_t len);
+#ifndef __Fuchsia__
+    virtual int commitBufferAndWritevFully(size_t size, const struct iovec* iov, int iovcnt);
+#else
+    virtual void onFrameBoundary() override;
+#endif
 
     QEMU_PIPE_HANDLE getSocket() const;
+#ifndef __Fuchsia__
+protected:
+    virtual void releaseBuffers() override;
+#endif
 private:
     QEMU_PIPE_HANDLE m_sock;
     size_t m_bufsize;
     unsigned char *m_buf;
+    android::base::guest::AccountedMemory m_bufMemory{
+        android::base::guest::GraphicsMemory::kStreamBuffers};
     size_t m_read;
     size_t m_readLeft;
 #ifdef __Fuchsia__
@@ -65,6 +77,10 @@ private:
         m_pipe;
     zx::event m_event;
     zx::vmo m_vmo;
+    // Bytes committed at kWriteOffset that have not been sent to the host.
+    size_t m_heldWrites;
+
+    int sendHeldWrites();
 #endif
     QemuPipeStream(QEMU_PIPE_HANDLE sock, size_t bufSize);
 };
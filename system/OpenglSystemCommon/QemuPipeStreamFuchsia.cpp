@@ -33,6 +33,11 @@
 
 constexpr size_t kReadSize = 512 * 1024;
 constexpr size_t kWriteOffset = kReadSize;
+// Each DoCall is a FIDL round trip to the pipe driver, so small commits
+// are left in the buffer until this much has built up, a response is
+// read or a frame ends. The buffer has this much room past the largest
+// command so the next one can go after them.
+constexpr size_t kMaxHeldWrites = 64 * 1024;
 
 QemuPipeStream::QemuPipeStream(size_t bufSize) :
     IOStream(bufSize),
@@ -40,7 +45,8 @@ QemuPipeStream::QemuPipeStream(size_t bufSize) :
     m_bufsize(bufSize),
     m_buf(nullptr),
     m_read(0),
-    m_readLeft(0)
+    m_readLeft(0),
+    m_heldWrites(0)
 {
 }
 
@@ -50,7 +56,8 @@ QemuPipeStream::QemuPipeStream(QEMU_PIPE_HANDLE sock, size_t bufSize) :
     m_bufsize(bufSize),
     m_buf(nullptr),
     m_read(0),
-    m_readLeft(0)
+    m_readLeft(0),
+    m_heldWrites(0)
 {
 }
 
@@ -58,6 +65,7 @@ QemuPipeStream::~QemuPipeStream()
 {
     if (m_device) {
         flush();
+        sendHeldWrites();
     }
     if (m_buf) {
         zx_status_t status = zx_vmar_unmap(zx_vmar_root_self(),
@@ -162,8 +170,11 @@ void *QemuPipeStream::allocBuffer(size_t minSize)
 
     zx_status_t status;
     if (m_buf) {
+        if (m_heldWrites && m_heldWrites + minSize > m_bufsize && sendHeldWrites() < 0) {
+            return nullptr;
+        }
         if (minSize <= m_bufsize) {
-            return m_buf + kWriteOffset;
+            return m_buf + kWriteOffset + m_heldWrites;
         }
         status = zx_vmar_unmap(zx_vmar_root_self(),
                                reinterpret_cast<zx_vaddr_t>(m_buf),
@@ -175,7 +186,7 @@ void *QemuPipeStream::allocBuffer(size_t minSize)
         m_buf = nullptr;
     }
 
-    size_t allocSize = m_bufsize < minSize ? minSize : m_bufsize;
+    size_t allocSize = m_bufsize < minSize + kMaxHeldWrites ? minSize + kMaxHeldWrites : m_bufsize;
 
     {
         auto result = m_pipe->SetBufferSize(allocSize);
@@ -216,7 +227,17 @@ int QemuPipeStream::commitBuffer(size_t size)
 {
     if (size == 0) return 0;
 
-    auto result = m_pipe->DoCall(size, kWriteOffset, 0, 0);
+    m_heldWrites += size;
+    if (m_heldWrites < kMaxHeldWrites) return 0;
+    return sendHeldWrites();
+}
+
+int QemuPipeStream::sendHeldWrites()
+{
+    if (!m_heldWrites) return 0;
+
+    auto result = m_pipe->DoCall(m_heldWrites, kWriteOffset, 0, 0);
+    m_heldWrites = 0;
     if (!result.ok() || result->res != ZX_OK) {
         ALOGD("%s: Pipe call failed: %d:%d", __FUNCTION__, result.status(),
               GET_STATUS_SAFE(result, res));
@@ -226,6 +247,11 @@ int QemuPipeStream::commitBuffer(size_t size)
     return 0;
 }
 
+void QemuPipeStream::onFrameBoundary()
+{
+    sendHeldWrites();
+}
+
 int QemuPipeStream::writeFully(const void *buf, size_t len)
 {
     ALOGE("%s: unsupported", __FUNCTION__);
@@ -247,6 +273,10 @@ const unsigned char *QemuPipeStream::commitBufferAndReadFully(size_t size, void
     if (!m_device)
         return nullptr;
 
+    // Held back commands go out with this call, in front of |size|.
+    size += m_heldWrites;
+    m_heldWrites = 0;
+
     if (!buf) {
         if (len > 0) {
             ALOGE("QemuPipeStream::commitBufferAndReadFully failed, buf=NULL, len %zu, lethal"
@@ -27,7 +27,10 @@ typedef bool (*tlsDtorCallback)(void*);
 struct EGLThreadInfo
 {
     EGLThreadInfo() : currentContext(NULL), eglError(EGL_SUCCESS), dtor(0) {}
-    ~EGLThreadInfo() { if (dtor) dtor(this); }
+    ~EGLThreadInfo() {
+        if (dtor) dtor(this);
+        HostConnection::recycle(std::move(hostConn));
+    }
 
     EGLContext_t *currentContext;
     std::unique_ptr<HostConnection> hostConn;
@@ -39,7 +39,8 @@ static const size_t kTransferBufferSize = (1048576);
 static const size_t kReadSize = 512 * 1024;
 static const size_t kWriteOffset = kReadSize;
 
-VirtioGpuPipeStream::VirtioGpuPipeStream(size_t bufSize) :
+VirtioGpuPipeStream::VirtioGpuPipeStream(size_t bufSize,
+                                         android::base::guest::HealthMonitor<>* healthMonitor) :
     IOStream(bufSize),
     m_fd(-1),
     m_virtio_rh(~0U),
@@ -50,7 +51,8 @@ VirtioGpuPipeStream::VirtioGpuPipeStream(size_t bufSize) :
     m_read(0),
     m_readLeft(0),
     m_writtenPos(0),
-    m_fd_owned(true) { }
+    m_fd_owned(true),
+    m_healthMonitor(healthMonitor) { }
 
 VirtioGpuPipeStream::VirtioGpuPipeStream(size_t bufSize, int stream_handle) :
     IOStream(bufSize),
@@ -63,7 +65,8 @@ VirtioGpuPipeStream::VirtioGpuPipeStream(size_t bufSize, int stream_handle) :
     m_read(0),
     m_readLeft(0),
     m_writtenPos(0),
-    m_fd_owned(false) { }
+    m_fd_owned(false),
+    m_healthMonitor(nullptr) { }
 
 VirtioGpuPipeStream::~VirtioGpuPipeStream()
 {
@@ -204,9 +207,17 @@ void *VirtioGpuPipeStream::allocBuffer(size_t minSize) {
         }
     }
 
+    m_bufMemory.set(m_buf ? allocSize : 0);
     return m_buf;
 }
 
+void VirtioGpuPipeStream::releaseBuffers() {
+    free(m_buf);
+    m_buf = nullptr;
+    m_bufsize = initialBufferSize();
+    m_bufMemory.set(0);
+}
+
 int VirtioGpuPipeStream::commitBuffer(size_t size) {
     if (size == 0) return 0;
     return writeFully(m_buf, size);
@@ -346,6 +357,7 @@ int VirtioGpuPipeStream::recv(void *buf, size_t len)
 }
 
 void VirtioGpuPipeStream::wait() {
+    auto watchdog = WATCHDOG_BUILDER(m_healthMonitor, "virtio-gpu pipe wait").build();
     struct drm_virtgpu_3d_wait waitcmd;
     memset(&waitcmd, 0, sizeof(waitcmd));
     waitcmd.handle = m_virtio_bo;
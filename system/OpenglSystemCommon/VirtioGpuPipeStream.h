@@ -18,6 +18,8 @@
 
 #include "HostConnection.h"
 #include "IOStream.h"
+#include "aemu/base/AndroidHealthMonitor.h"
+#include "aemu/base/MemoryAccounting.h"
 
 #include <stdlib.h>
 
@@ -30,7 +32,8 @@ class VirtioGpuPipeStream : public IOStream {
 public:
     typedef enum { ERR_INVALID_SOCKET = -1000 } QemuPipeStreamError;
 
-    explicit VirtioGpuPipeStream(size_t bufsize = 10000);
+    explicit VirtioGpuPipeStream(size_t bufsize = 10000,
+                                 android::base::guest::HealthMonitor<>* healthMonitor = nullptr);
     explicit VirtioGpuPipeStream(size_t bufsize, int stream_handle);
     ~VirtioGpuPipeStream();
     int connect(const char* serviceName = 0);
@@ -51,6 +54,8 @@ public:
     virtual int writeFully(const void *buf, size_t len);
 
     int getSocket() const;
+protected:
+    virtual void releaseBuffers() override;
 private:
     // sync. Also resets the write position.
     void wait();
@@ -70,8 +75,12 @@ private:
     // intermediate buffer
     size_t m_bufsize;
     unsigned char *m_buf;
+    android::base::guest::AccountedMemory m_bufMemory{
+        android::base::guest::GraphicsMemory::kStreamBuffers};
     size_t m_read;
     size_t m_readLeft;
 
     size_t m_writtenPos;
+
+    android::base::guest::HealthMonitor<>* m_healthMonitor;
 };
@@ -265,11 +265,18 @@ class C2GoldfishAvcDec::IntfImpl : public SimpleInterface<void>::BaseParams {
                             mCodedColorAspects)
                 .build());
 
-        // TODO: support more formats?
-        addParameter(DefineParam(mPixelFormat, C2_PARAMKEY_PIXEL_FORMAT)
-                         .withConstValue(new C2StreamPixelFormatInfo::output(
-                             0u, HAL_PIXEL_FORMAT_YCBCR_420_888))
-                         .build());
+        // RGBA has the host convert as it renders into the color buffers,
+        // see getOutputPixelFormat().
+        addParameter(
+            DefineParam(mPixelFormat, C2_PARAMKEY_PIXEL_FORMAT)
+                .withDefault(new C2StreamPixelFormatInfo::output(
+                    0u, HAL_PIXEL_FORMAT_YCBCR_420_888))
+                .withFields({C2F(mPixelFormat, value)
+                                 .oneOf({HAL_PIXEL_FORMAT_YCBCR_420_888,
+                                         HAL_PIXEL_FORMAT_RGBA_8888})})
+                .withSetter(
+                    Setter<decltype(*mPixelFormat)>::StrictValueWithNoDeps)
+                .build());
     }
     static C2R SizeSetter(bool mayBlock,
                           const C2P<C2StreamPictureSizeInfo::output> &oldMe,
@@ -403,6 +410,8 @@ class C2GoldfishAvcDec::IntfImpl : public SimpleInterface<void>::BaseParams {
 
     int transfer() const { return mColorAspects->transfer; }
 
+    uint32_t pixelFormat() const { return mPixelFormat->value; }
+
    private:
     std::shared_ptr<C2StreamProfileLevelInfo::input> mProfileLevel;
     std::shared_ptr<C2StreamPictureSizeInfo::output> mSize;
@@ -415,21 +424,11 @@ class C2GoldfishAvcDec::IntfImpl : public SimpleInterface<void>::BaseParams {
     std::shared_ptr<C2StreamPixelFormatInfo::output> mPixelFormat;
 };
 
-static void *ivd_aligned_malloc(void *ctxt, uint32_t alignment, uint32_t size) {
-    (void)ctxt;
-    return memalign(alignment, size);
-}
-
-static void ivd_aligned_free(void *ctxt, void *mem) {
-    (void)ctxt;
-    free(mem);
-}
-
 C2GoldfishAvcDec::C2GoldfishAvcDec(const char *name, c2_node_id_t id,
                                    const std::shared_ptr<IntfImpl> &intfImpl)
     : SimpleC2Component(
           std::make_shared<SimpleInterface<IntfImpl>>(name, id, intfImpl)),
-      mIntf(intfImpl), mOutBufferFlush(nullptr), mWidth(1920), mHeight(1080),
+      mIntf(intfImpl), mWidth(1920), mHeight(1080),
       mHeaderDecoded(false), mOutIndex(0u) {
     mWidth = mIntf->width();
     mHeight = mIntf->height();
@@ -462,6 +461,7 @@ void C2GoldfishAvcDec::onRelease() {
       mId = -1;
     }
     deleteContext();
+    mRetiredContext.reset();
     if (mOutBlock) {
         mOutBlock.reset();
     }
@@ -476,38 +476,13 @@ void C2GoldfishAvcDec::decodeHeaderAfterFlush() {
 }
 
 c2_status_t C2GoldfishAvcDec::onFlush_sm() {
-    if (OK != setFlushMode())
-        return C2_CORRUPTED;
-
-    if (!mContext) {
-        // just ignore if context is not even created
-        return C2_OK;
-    }
-
-    uint32_t bufferSize = mStride * mHeight * 3 / 2;
-    mOutBufferFlush = (uint8_t *)ivd_aligned_malloc(nullptr, 128, bufferSize);
-    if (!mOutBufferFlush) {
-        ALOGE("could not allocate tmp output buffer (for flush) of size %u ",
-              bufferSize);
-        return C2_NO_MEMORY;
-    }
-
-    while (true) {
-        mPts = 0;
-        setDecodeArgs(nullptr, nullptr, 0, 0, 0);
-        mImg = mContext->getImage();
-        if (mImg.data == nullptr) {
-            resetPlugin();
-            break;
-        }
-    }
-
-    if (mOutBufferFlush) {
-        ivd_aligned_free(nullptr, mOutBufferFlush);
-        mOutBufferFlush = nullptr;
-    }
-
-    deleteContext();
+    // The frames the host still holds go away with its context, so there is
+    // no need to flush the host decoder and pull them out one by one first.
+    // The host calls to destroy the context are left to the pipeline thread
+    // and only waited for when the next context is created.
+    mHeaderDecoded = false;
+    resetPlugin();
+    deleteContext(true);
     return C2_OK;
 }
 
@@ -538,6 +513,9 @@ void C2GoldfishAvcDec::sendMetadata() {
 status_t C2GoldfishAvcDec::createDecoder() {
 
     DDD("creating avc context now w %d h %d", mWidth, mHeight);
+    // let the host finish with the context destroyed by a flush, so that
+    // this one can get its memory slot
+    mRetiredContext.reset();
     if (mEnableAndroidNativeBuffers) {
         mContext.reset(new MediaH264Decoder(RenderMode::RENDER_BY_HOST_GPU));
     } else {
@@ -545,6 +523,8 @@ status_t C2GoldfishAvcDec::createDecoder() {
     }
     mContext->initH264Context(mWidth, mHeight, mWidth, mHeight,
                               MediaH264Decoder::PixelFormat::YUV420P);
+    // keep the host decoding while we copy out and return decoded frames
+    mContext->startPipeline(mWidth * mHeight * 3 / 2);
     return OK;
 }
 
@@ -622,10 +602,17 @@ void C2GoldfishAvcDec::resetPlugin() {
     }
 }
 
-void C2GoldfishAvcDec::deleteContext() {
+void C2GoldfishAvcDec::deleteContext(bool async) {
     if (mContext) {
-        mContext->destroyH264Context();
-        mContext.reset(nullptr);
+        if (async) {
+            mContext->destroyH264ContextAsync();
+            mRetiredContext = std::move(mContext);
+        } else {
+            mContext->destroyH264Context();
+            mContext.reset(nullptr);
+        }
+        mParameterSets.clear();
+        mPipelinedOutBlocks.clear();
         mPts2Index.clear();
         mOldPts2Index.clear();
         mIndex2Pts.clear();
@@ -713,6 +700,44 @@ void C2GoldfishAvcDec::finishWork(uint64_t index,
     }
 }
 
+// Takes what the host returned for the oldest access unit in flight and
+// finishes the work it belongs to if a picture came out; returns false if
+// nothing was ready.
+bool C2GoldfishAvcDec::reapPipelinedImage(const std::unique_ptr<C2Work> &work,
+                                          bool wait) {
+    h264_image_t img{};
+    if (!mContext->dequeueImage(&img, wait)) {
+        return false;
+    }
+    auto outBlock = std::move(mPipelinedOutBlocks.front());
+    mPipelinedOutBlocks.pop_front();
+    if (img.data == nullptr) {
+        // nothing was written to the block, keep it for the next access unit
+        if (!mOutBlock) {
+            mOutBlock = std::move(outBlock.first);
+            mHostColorBufferId = outBlock.second;
+        }
+        return true;
+    }
+
+    DDD("got pipelined data %" PRIu64 " with pts %" PRIu64,
+        getWorkIndex(img.pts), img.pts);
+    std::shared_ptr<C2GraphicBlock> nextOutBlock = std::move(mOutBlock);
+    mOutBlock = std::move(outBlock.first);
+    mImg = img;
+    mHeaderDecoded = true;
+    copyImageData(mImg);
+    finishWork(getWorkIndex(mImg.pts), work);
+    removePts(mImg.pts);
+    mOutBlock = std::move(nextOutBlock);
+    return true;
+}
+
+void C2GoldfishAvcDec::drainPipeline(const std::unique_ptr<C2Work> &work) {
+    while (mContext && reapPipelinedImage(work, true)) {
+    }
+}
+
 c2_status_t
 C2GoldfishAvcDec::ensureDecoderState(const std::shared_ptr<C2BlockPool> &pool) {
     if (mOutBlock && (mOutBlock->width() != ALIGN2(mWidth) ||
@@ -720,7 +745,7 @@ C2GoldfishAvcDec::ensureDecoderState(const std::shared_ptr<C2BlockPool> &pool) {
         mOutBlock.reset();
     }
     if (!mOutBlock) {
-        const uint32_t format = HAL_PIXEL_FORMAT_YCBCR_420_888;
+        const uint32_t format = mOutputFormat;
         const C2MemoryUsage usage = {(uint64_t)(BufferUsage::VIDEO_DECODER),
                                      C2MemoryUsage::CPU_WRITE | C2MemoryUsage::CPU_READ};
         c2_status_t err = pool->fetchGraphicBlock(ALIGN2(mWidth), mHeight,
@@ -730,10 +755,7 @@ C2GoldfishAvcDec::ensureDecoderState(const std::shared_ptr<C2BlockPool> &pool) {
             return err;
         }
         if (mEnableAndroidNativeBuffers) {
-            auto c2Handle = mOutBlock->handle();
-            native_handle_t *grallocHandle =
-                UnwrapNativeCodec2GrallocHandle(c2Handle);
-            mHostColorBufferId = getColorBufferHandle(grallocHandle);
+            mHostColorBufferId = getColorBufferHandle(mOutBlock);
             DDD("found handle %d", mHostColorBufferId);
         }
         DDD("provided (%dx%d) required (%dx%d)", mOutBlock->width(),
@@ -763,6 +785,8 @@ void C2GoldfishAvcDec::checkMode(const std::shared_ptr<C2BlockPool> &pool) {
         DDD("decoding to guest byte buffer");
         mEnableAndroidNativeBuffers = false;
     }
+    mOutputFormat = getOutputPixelFormat(mIntf->pixelFormat(),
+                                         mEnableAndroidNativeBuffers);
 }
 
 void C2GoldfishAvcDec::getVuiParams(h264_image_t &img) {
@@ -802,30 +826,15 @@ void C2GoldfishAvcDec::copyImageData(h264_image_t &img) {
     if (mEnableAndroidNativeBuffers)
         return;
 
+    CodecPerfStats::ScopedCopyTimer copyTimer(mPerfStats);
     auto writeView = mOutBlock->map().get();
     if (writeView.error()) {
         ALOGE("graphic view map failed %d", writeView.error());
         return;
     }
-    size_t dstYStride = writeView.layout().planes[C2PlanarLayout::PLANE_Y].rowInc;
-    size_t dstUVStride = writeView.layout().planes[C2PlanarLayout::PLANE_U].rowInc;
-
-    uint8_t *pYBuffer = const_cast<uint8_t *>(writeView.data()[C2PlanarLayout::PLANE_Y]);
-    uint8_t *pUBuffer = const_cast<uint8_t *>(writeView.data()[C2PlanarLayout::PLANE_U]);
-    uint8_t *pVBuffer = const_cast<uint8_t *>(writeView.data()[C2PlanarLayout::PLANE_V]);
-
-    for (int i = 0; i < mHeight; ++i) {
-        memcpy(pYBuffer + i * dstYStride, img.data + i * mWidth, mWidth);
-    }
-    for (int i = 0; i < mHeight / 2; ++i) {
-        memcpy(pUBuffer + i * dstUVStride,
-               img.data + mWidth * mHeight + i * mWidth / 2, mWidth / 2);
-    }
-    for (int i = 0; i < mHeight / 2; ++i) {
-        memcpy(pVBuffer + i * dstUVStride,
-               img.data + mWidth * mHeight * 5 / 4 + i * mWidth / 2,
-               mWidth / 2);
-    }
+    copyYuv420PlanarToGraphicView(img.data, img.data + mWidth * mHeight,
+                                  img.data + mWidth * mHeight * 5 / 4, mWidth,
+                                  mHeight, &writeView);
 }
 
 uint64_t C2GoldfishAvcDec::getWorkIndex(uint64_t pts) {
@@ -937,6 +946,7 @@ void C2GoldfishAvcDec::process(const std::unique_ptr<C2Work> &work,
         (int)work->input.ordinal.timestamp.peeku(),
         (int)work->input.ordinal.frameIndex.peeku(), work->input.flags);
     size_t inPos = 0;
+    bool pipelined = false;
     while (inPos < inSize && inSize - inPos >= kMinInputBytes) {
         if (C2_OK != ensureDecoderState(pool)) {
             mSignalledError = true;
@@ -975,7 +985,11 @@ void C2GoldfishAvcDec::process(const std::unique_ptr<C2Work> &work,
             }
 
             bool whChanged = false;
-            if (GoldfishH264Helper::isSpsFrame(mInPBuffer, mInPBufferSize)) {
+            std::vector<uint8_t> parameterSets;
+            if (GoldfishH264Helper::getParameterSets(
+                    mInPBuffer, mInPBufferSize, &parameterSets) &&
+                parameterSets != mParameterSets) {
+                mParameterSets = std::move(parameterSets);
                 mH264Helper.reset(new GoldfishH264Helper(mWidth, mHeight));
                 whChanged = mH264Helper->decodeHeader(mInPBuffer, mInPBufferSize);
                 if (whChanged) {
@@ -1022,16 +1036,37 @@ void C2GoldfishAvcDec::process(const std::unique_ptr<C2Work> &work,
             (void)delay;
             //(void) ivdec_api_function(mDecHandle, &s_decode_ip, &s_decode_op);
             DDD("decoding");
-            h264_result_t h264Res =
-                mContext->decodeFrame(mInPBuffer, mInPBufferSize, mIndex2Pts[mInTsMarker]);
-            mConsumedBytes = h264Res.bytesProcessed;
-            DDD("decoding consumed %d", (int)mConsumedBytes);
-
-            if (mHostColorBufferId > 0) {
-                mImg = mContext->renderOnHostAndReturnImageMetadata(
-                    mHostColorBufferId);
+            pipelined = false;
+            if (mContext->isPipelined()) {
+                while (mContext->getFramesInFlight() >=
+                       MediaH264Decoder::kMaxFramesInFlight) {
+                    reapPipelinedImage(work, true);
+                }
+                pipelined = mContext->queueFrame(mInPBuffer, mInPBufferSize,
+                                                 mIndex2Pts[mInTsMarker],
+                                                 mHostColorBufferId);
+            }
+            if (pipelined) {
+                // the host decoders consume whole access units
+                mPipelinedOutBlocks.emplace_back(std::move(mOutBlock),
+                                                 mHostColorBufferId);
+                mConsumedBytes = mInPBufferSize;
+                while (reapPipelinedImage(work, false)) {
+                }
             } else {
-                mImg = mContext->getImage();
+                // the host has to be done with the frames ahead first
+                drainPipeline(work);
+                h264_result_t h264Res = mContext->decodeFrame(
+                    mInPBuffer, mInPBufferSize, mIndex2Pts[mInTsMarker]);
+                mConsumedBytes = h264Res.bytesProcessed;
+                DDD("decoding consumed %d", (int)mConsumedBytes);
+
+                if (mHostColorBufferId > 0) {
+                    mImg = mContext->renderOnHostAndReturnImageMetadata(
+                        mHostColorBufferId);
+                } else {
+                    mImg = mContext->getImage();
+                }
             }
             uint32_t decodeTime;
             GETTIME(&mTimeEnd, nullptr);
@@ -1039,7 +1074,9 @@ void C2GoldfishAvcDec::process(const std::unique_ptr<C2Work> &work,
             (void)decodeTime;
         }
 
-        if (mImg.data != nullptr) {
+        if (pipelined) {
+            // finished as its picture is reaped
+        } else if (mImg.data != nullptr) {
             DDD("got data %" PRIu64 " with pts %" PRIu64,  getWorkIndex(mImg.pts), mImg.pts);
             mHeaderDecoded = true;
             copyImageData(mImg);
@@ -1076,6 +1113,7 @@ C2GoldfishAvcDec::drainInternal(uint32_t drainMode,
         return C2_OMITTED;
     }
 
+    drainPipeline(work);
     if (OK != setFlushMode())
         return C2_CORRUPTED;
     while (true) {
@@ -25,6 +25,7 @@
 #include "GoldfishH264Helper.h"
 #include <SimpleC2Component.h>
 #include <atomic>
+#include <deque>
 #include <map>
 
 namespace android {
@@ -60,7 +61,11 @@ class C2GoldfishAvcDec : public SimpleC2Component {
 
   private:
     std::unique_ptr<MediaH264Decoder> mContext;
+    // destroyed by a flush, with the host possibly still busy with it
+    std::unique_ptr<MediaH264Decoder> mRetiredContext;
     bool mEnableAndroidNativeBuffers{true};
+    // format of the output blocks, from getOutputPixelFormat()
+    uint32_t mOutputFormat{0};
 
     void checkMode(const std::shared_ptr<C2BlockPool> &pool);
     //    status_t createDecoder();
@@ -71,13 +76,16 @@ class C2GoldfishAvcDec : public SimpleC2Component {
                        size_t inOffset, size_t inSize, uint32_t tsMarker);
     c2_status_t ensureDecoderState(const std::shared_ptr<C2BlockPool> &pool);
     void finishWork(uint64_t index, const std::unique_ptr<C2Work> &work);
+    bool reapPipelinedImage(const std::unique_ptr<C2Work> &work, bool wait);
+    void drainPipeline(const std::unique_ptr<C2Work> &work);
     status_t setFlushMode();
     c2_status_t drainInternal(uint32_t drainMode,
                               const std::shared_ptr<C2BlockPool> &pool,
                               const std::unique_ptr<C2Work> &work);
     status_t resetDecoder();
     void resetPlugin();
-    void deleteContext();
+    // With |async|, the host calls are left to mRetiredContext.
+    void deleteContext(bool async = false);
 
     std::shared_ptr<IntfImpl> mIntf;
 
@@ -102,7 +110,10 @@ class C2GoldfishAvcDec : public SimpleC2Component {
     };
 
     std::shared_ptr<C2GraphicBlock> mOutBlock;
-    uint8_t *mOutBufferFlush;
+    // output blocks, with their host color buffers, of the access units in
+    // flight in the pipeline of mContext, oldest first
+    std::deque<std::pair<std::shared_ptr<C2GraphicBlock>, int>>
+        mPipelinedOutBlocks;
 
     int mHostColorBufferId{-1};
 
@@ -158,6 +169,9 @@ class C2GoldfishAvcDec : public SimpleC2Component {
     void decodeHeaderAfterFlush();
 
     std::unique_ptr<GoldfishH264Helper> mH264Helper;
+    // parameter sets last decoded by the helper; frames that repeat them
+    // need no new helper
+    std::vector<uint8_t> mParameterSets;
 
     int mId = -1;
     C2_DO_NOT_COPY(C2GoldfishAvcDec);
@@ -18,6 +18,7 @@
 
 #define LOG_TAG "GoldfishH264Helper"
 #include <log/log.h>
+#include <nal_unit_utils.h>
 
 #define DEBUG 0
 #if DEBUG
@@ -167,24 +168,62 @@ void GoldfishH264Helper::setParams(size_t stride,
     }
 }
 
-bool GoldfishH264Helper::isSpsFrame(const uint8_t* frame, int inSize) {
-    if (inSize < 5) return false;
-    if (frame[0] == 0 && frame[1] == 0 && frame[2] == 0 && frame[3] == 1) {
-        const bool forbiddenBitIsInvalid = 0x80 & frame[4];
+namespace {
+
+enum class NalKind { ParameterSet, Slice, Other };
+
+NalKind getNalKind(const uint8_t* nal) {
+    // nalu type is the lower 5 bits
+    uint8_t naluType = 0x1f & nal[0];
+    if (naluType >= 1 && naluType <= 5) return NalKind::Slice;
+    return naluType == 7 || naluType == 8 ? NalKind::ParameterSet : NalKind::Other;
+}
+
+// Calls |fn| with each parameter set unit ahead of the first slice of
+// |frame|; they have to come ahead of the slices that use them, so the
+// slice data is never scanned.
+template <typename Fn>
+void forEachParameterSet(const uint8_t* frame, int inSize, Fn fn) {
+    if (inSize < 5) return;
+    NalUnitScanner scanner(frame, inSize);
+    while (scanner.next()) {
+        const bool forbiddenBitIsInvalid = 0x80 & scanner.data()[0];
         if (forbiddenBitIsInvalid) {
-            return false;
+            continue;
+        }
+        NalKind kind = getNalKind(scanner.data());
+        if (kind == NalKind::Slice) {
+            return;
+        }
+        if (kind == NalKind::ParameterSet &&
+            !fn(scanner.data(), scanner.size())) {
+            return;
         }
-        // nalu type is the lower 5 bits
-        uint8_t naluType = 0x1f & frame[4];
-        if (naluType == 7
-            || naluType == 8
-                ) return true;
-        else return false;
-    } else {
-        return false;
     }
 }
 
+} // namespace
+
+bool GoldfishH264Helper::isSpsFrame(const uint8_t* frame, int inSize) {
+    bool found = false;
+    forEachParameterSet(frame, inSize, [&](const uint8_t*, size_t) {
+        found = true;
+        return false;
+    });
+    return found;
+}
+
+bool GoldfishH264Helper::getParameterSets(const uint8_t* frame, int inSize,
+                                          std::vector<uint8_t>* outParameterSets) {
+    outParameterSets->clear();
+    forEachParameterSet(frame, inSize, [&](const uint8_t* nal, size_t size) {
+        outParameterSets->insert(outParameterSets->end(), {0, 0, 1});
+        outParameterSets->insert(outParameterSets->end(), nal, nal + size);
+        return true;
+    });
+    return !outParameterSets->empty();
+}
+
 bool GoldfishH264Helper::decodeHeader(const uint8_t *frame, int inSize) {
     DDD("entering");
     // should we check the header for vps/sps/pps frame ? otherwise
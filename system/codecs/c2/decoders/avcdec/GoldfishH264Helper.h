@@ -18,6 +18,7 @@
 #define GOLDFISH_H264_HELPER_H_
 
 #include <inttypes.h>
+#include <vector>
 #include "ih264_typedefs.h"
 #include "ih264d.h"
 
@@ -31,9 +32,14 @@ class GoldfishH264Helper {
     GoldfishH264Helper(int w, int h);
     ~GoldfishH264Helper();
 
-    // check whether the frame is sps; typical h264 will have
+    // check whether the frame has sps or pps; typical h264 will have
     // a frame that is sps/pps together
     static bool isSpsFrame(const uint8_t* frame, int inSize);
+    // copies the sps and pps units of the frame, so that a frame that
+    // repeats the ones already seen need not be decoded again; returns
+    // false if there are none
+    static bool getParameterSets(const uint8_t* frame, int inSize,
+                                 std::vector<uint8_t>* outParameterSets);
   public:
     // return true if decoding finds out w/h changed;
     // otherwise false
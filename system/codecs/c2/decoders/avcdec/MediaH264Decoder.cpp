@@ -25,6 +25,8 @@
 
 #include "MediaH264Decoder.h"
 #include "goldfish_media_utils.h"
+#include "aemu/base/threads/AndroidThreadPolicy.h"
+#include <inttypes.h>
 #include <string.h>
 
 MediaH264Decoder::MediaH264Decoder(RenderMode renderMode)
@@ -36,6 +38,8 @@ MediaH264Decoder::MediaH264Decoder(RenderMode renderMode)
     }
 }
 
+MediaH264Decoder::~MediaH264Decoder() { stopPipeline(); }
+
 void MediaH264Decoder::initH264Context(unsigned int width, unsigned int height,
                                        unsigned int outWidth,
                                        unsigned int outHeight,
@@ -74,6 +78,7 @@ void MediaH264Decoder::resetH264Context(unsigned int width, unsigned int height,
         ALOGE("%s no address space memory", __func__);
         return;
     }
+    waitForPipelineIdle();
     transport->writeParam((uint64_t)mHostHandle, 0, mAddressOffSet);
     transport->writeParam(width, 1, mAddressOffSet);
     transport->writeParam(height, 2, mAddressOffSet);
@@ -89,6 +94,28 @@ void MediaH264Decoder::destroyH264Context() {
 
     DDD("return memory lot %d addrr %lu", (int)(mAddressOffSet >> 23),
         mAddressOffSet);
+    stopPipeline();
+    destroyOnHost();
+}
+
+void MediaH264Decoder::destroyH264ContextAsync() {
+    if (!mPipelined) {
+        destroyH264Context();
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mPipelineMutex);
+        discardPipelinedFramesLocked();
+        mDestroyOnStop = true;
+        mPipelineStopping = true;
+    }
+    mPipelineCv.notify_all();
+}
+
+void MediaH264Decoder::destroyOnHost() {
+    if (!mHasAddressSpaceMemory) {
+        return;
+    }
     auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam((uint64_t)mHostHandle, 0, mAddressOffSet);
     transport->sendOperation(MediaCodecType::H264Codec,
@@ -105,11 +132,19 @@ h264_result_t MediaH264Decoder::decodeFrame(uint8_t *img, size_t szBytes,
         ALOGE("%s no address space memory", __func__);
         return res;
     }
+    waitForPipelineIdle();
     auto transport = GoldfishMediaTransport::getInstance();
     uint8_t *hostSrc = transport->getInputAddr(mAddressOffSet);
     if (img != nullptr && szBytes > 0) {
         memcpy(hostSrc, img, szBytes);
     }
+    return decodeAt(hostSrc, szBytes, pts);
+}
+
+h264_result_t MediaH264Decoder::decodeAt(uint8_t *hostSrc, size_t szBytes,
+                                         uint64_t pts) {
+    h264_result_t res = {0, 0};
+    auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam((uint64_t)mHostHandle, 0, mAddressOffSet);
     transport->writeParam(transport->offsetOf((uint64_t)(hostSrc)) -
                               mAddressOffSet,
@@ -132,6 +167,7 @@ void MediaH264Decoder::sendMetadata(MetaDataColorAspects *ptr) {
         ALOGE("%s no address space memory", __func__);
         return;
     }
+    waitForPipelineIdle();
     MetaDataColorAspects& meta = *ptr;
     auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam((uint64_t)mHostHandle, 0, mAddressOffSet);
@@ -148,6 +184,7 @@ void MediaH264Decoder::flush() {
         return;
     }
     DDD("flush: use handle to host %lu", mHostHandle);
+    waitForPipelineIdle();
     auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam((uint64_t)mHostHandle, 0, mAddressOffSet);
     transport->sendOperation(MediaCodecType::H264Codec, MediaOperation::Flush,
@@ -161,31 +198,11 @@ h264_image_t MediaH264Decoder::getImage() {
         ALOGE("%s no address space memory", __func__);
         return res;
     }
+    waitForPipelineIdle();
     auto transport = GoldfishMediaTransport::getInstance();
     uint8_t *dst = transport->getInputAddr(
         mAddressOffSet); // Note: reuse the same addr for input and output
-    transport->writeParam((uint64_t)mHostHandle, 0, mAddressOffSet);
-    transport->writeParam(transport->offsetOf((uint64_t)(dst)) - mAddressOffSet,
-                          1, mAddressOffSet);
-    transport->writeParam(-1, 2, mAddressOffSet);
-    transport->sendOperation(MediaCodecType::H264Codec,
-                             MediaOperation::GetImage, mAddressOffSet);
-    auto *retptr = transport->getReturnAddr(mAddressOffSet);
-    res.ret = *(int *)(retptr);
-    if (res.ret >= 0) {
-        res.data = dst;
-        res.width = *(uint32_t *)(retptr + 8);
-        res.height = *(uint32_t *)(retptr + 16);
-        res.pts = *(uint64_t *)(retptr + 24);
-        res.color_primaries = *(uint32_t *)(retptr + 32);
-        res.color_range = *(uint32_t *)(retptr + 40);
-        res.color_trc = *(uint32_t *)(retptr + 48);
-        res.colorspace = *(uint32_t *)(retptr + 56);
-    } else if (res.ret == (int)(Err::DecoderRestarted)) {
-        res.width = *(uint32_t *)(retptr + 8);
-        res.height = *(uint32_t *)(retptr + 16);
-    }
-    return res;
+    return getImageAt(dst, -1);
 }
 
 h264_image_t
@@ -201,9 +218,18 @@ MediaH264Decoder::renderOnHostAndReturnImageMetadata(int hostColorBufferId) {
         ALOGE("%s no address space memory", __func__);
         return res;
     }
+    waitForPipelineIdle();
     auto transport = GoldfishMediaTransport::getInstance();
     uint8_t *dst = transport->getInputAddr(
         mAddressOffSet); // Note: reuse the same addr for input and output
+    return getImageAt(dst, hostColorBufferId);
+}
+
+// |hostColorBufferId| is -1 to have the image data copied to |dst|;
+// otherwise the host renders to the color buffer and |dst| gets junk.
+h264_image_t MediaH264Decoder::getImageAt(uint8_t *dst, int hostColorBufferId) {
+    h264_image_t res{};
+    auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam((uint64_t)mHostHandle, 0, mAddressOffSet);
     transport->writeParam(transport->offsetOf((uint64_t)(dst)) - mAddressOffSet,
                           1, mAddressOffSet);
@@ -213,7 +239,7 @@ MediaH264Decoder::renderOnHostAndReturnImageMetadata(int hostColorBufferId) {
     auto *retptr = transport->getReturnAddr(mAddressOffSet);
     res.ret = *(int *)(retptr);
     if (res.ret >= 0) {
-        res.data = dst; // note: the data could be junk
+        res.data = dst;
         res.width = *(uint32_t *)(retptr + 8);
         res.height = *(uint32_t *)(retptr + 16);
         res.pts = *(uint64_t *)(retptr + 24);
@@ -227,3 +253,236 @@ MediaH264Decoder::renderOnHostAndReturnImageMetadata(int hostColorBufferId) {
     }
     return res;
 }
+
+// The input slots follow one another from the input address of the memory
+// slot, and the output slots follow them:
+// ================================================
+// | input 0 | input 1 | output 0 | ... | output n |
+// ================================================
+// There is one output slot more than there are frames in flight, for the
+// image handed out last.
+bool MediaH264Decoder::startPipeline(size_t outputFrameBytes) {
+    if (!mHasAddressSpaceMemory) {
+        ALOGE("%s no address space memory", __func__);
+        return false;
+    }
+    if (mPipelined) {
+        return true;
+    }
+    constexpr size_t kPageBytes = 4096;
+    mOutputSlotBytes = (outputFrameBytes + kPageBytes - 1) & ~(kPageBytes - 1);
+    const size_t needed = kMaxFramesInFlight * kInputSlotBytes +
+                          (kMaxFramesInFlight + 1) * mOutputSlotBytes;
+    auto transport = GoldfishMediaTransport::getInstance();
+    if (!transport->reserveMemorySlotBytes(mSlot, needed)) {
+        DDD("%s: slot %d can not hold %zu bytes, decoding synchronously",
+            __func__, mSlot, needed);
+        return false;
+    }
+
+    mInputSlotsInUse.assign(kMaxFramesInFlight, false);
+    mOutputSlotsInUse.assign(kMaxFramesInFlight + 1, false);
+    mHeldOutputSlot = -1;
+    mPipelineStopping = false;
+    mPipelineBusy = false;
+    mPipelined = true;
+    mPipelineThread = std::thread([this]() { pipelineLoop(); });
+    return true;
+}
+
+void MediaH264Decoder::stopPipeline() {
+    if (!mPipelined) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mPipelineMutex);
+        waitForPipelineIdleLocked(lock);
+        mPipelineStopping = true;
+    }
+    mPipelineCv.notify_all();
+    mPipelineThread.join();
+
+    mQueuedFrames.clear();
+    mDecodedImages.clear();
+    mPipelined = false;
+}
+
+void MediaH264Decoder::waitForPipelineIdleLocked(
+    std::unique_lock<std::mutex> &lock) {
+    mPipelineCv.wait(lock, [this]() {
+        return mQueuedFrames.empty() && !mPipelineBusy;
+    });
+}
+
+void MediaH264Decoder::waitForPipelineIdle() {
+    if (!mPipelined) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mPipelineMutex);
+    waitForPipelineIdleLocked(lock);
+}
+
+void MediaH264Decoder::releaseHeldOutputSlotLocked() {
+    if (mHeldOutputSlot >= 0) {
+        mOutputSlotsInUse[mHeldOutputSlot] = false;
+        mHeldOutputSlot = -1;
+    }
+}
+
+// Frames the host has not started on are dropped along with their input
+// slots; the one it is busy with still comes out into mDecodedImages.
+void MediaH264Decoder::discardPipelinedFramesLocked() {
+    for (const PipelinedFrame &frame : mQueuedFrames) {
+        for (int i = 0; i < frame.numInputSlots; ++i) {
+            mInputSlotsInUse[frame.firstInputSlot + i] = false;
+        }
+    }
+    mQueuedFrames.clear();
+    for (const PipelinedImage &image : mDecodedImages) {
+        if (image.outputSlot >= 0) {
+            mOutputSlotsInUse[image.outputSlot] = false;
+        }
+    }
+    mDecodedImages.clear();
+    releaseHeldOutputSlotLocked();
+}
+
+uint8_t *MediaH264Decoder::getInputSlotAddr(int slot) const {
+    auto transport = GoldfishMediaTransport::getInstance();
+    return transport->getInputAddr(mAddressOffSet) + slot * kInputSlotBytes;
+}
+
+uint8_t *MediaH264Decoder::getOutputSlotAddr(int slot) const {
+    return getInputSlotAddr(kMaxFramesInFlight) + slot * mOutputSlotBytes;
+}
+
+int MediaH264Decoder::getFramesInFlight() {
+    std::unique_lock<std::mutex> lock(mPipelineMutex);
+    return mQueuedFrames.size() + (mPipelineBusy ? 1 : 0) +
+           mDecodedImages.size();
+}
+
+bool MediaH264Decoder::queueFrame(const uint8_t *img, size_t szBytes,
+                                  uint64_t pts, int hostColorBufferId) {
+    if (!mPipelined || szBytes > kMaxFramesInFlight * kInputSlotBytes) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(mPipelineMutex);
+    releaseHeldOutputSlotLocked();
+    const size_t inFlight = mQueuedFrames.size() + (mPipelineBusy ? 1 : 0) +
+                            mDecodedImages.size();
+    if (inFlight >= kMaxFramesInFlight) {
+        return false;
+    }
+
+    PipelinedFrame frame{};
+    frame.szBytes = szBytes;
+    frame.pts = pts;
+    frame.hostColorBufferId = hostColorBufferId;
+    frame.firstInputSlot = 0;
+    frame.numInputSlots = 1;
+    if (szBytes > kInputSlotBytes) {
+        // too large for one slot: take all of them once the host is done
+        // with the frames ahead
+        waitForPipelineIdleLocked(lock);
+        frame.numInputSlots = kMaxFramesInFlight;
+    } else {
+        // a free slot is there unless a large frame took all of them
+        auto freeSlot = [this]() {
+            for (int i = 0; i < kMaxFramesInFlight; ++i) {
+                if (!mInputSlotsInUse[i]) {
+                    return i;
+                }
+            }
+            return -1;
+        };
+        mPipelineCv.wait(lock, [&]() { return freeSlot() >= 0; });
+        frame.firstInputSlot = freeSlot();
+    }
+    for (int i = 0; i < frame.numInputSlots; ++i) {
+        mInputSlotsInUse[frame.firstInputSlot + i] = true;
+    }
+    frame.input = getInputSlotAddr(frame.firstInputSlot);
+    lock.unlock();
+
+    // the slot is ours, so stage the frame without holding up the host
+    if (img != nullptr && szBytes > 0) {
+        memcpy(frame.input, img, szBytes);
+    }
+
+    lock.lock();
+    mQueuedFrames.push_back(frame);
+    lock.unlock();
+    mPipelineCv.notify_all();
+    return true;
+}
+
+bool MediaH264Decoder::dequeueImage(h264_image_t *outImage, bool wait) {
+    std::unique_lock<std::mutex> lock(mPipelineMutex);
+    releaseHeldOutputSlotLocked();
+    if (wait) {
+        mPipelineCv.wait(lock, [this]() {
+            return !mDecodedImages.empty() ||
+                   (mQueuedFrames.empty() && !mPipelineBusy);
+        });
+    }
+    if (mDecodedImages.empty()) {
+        return false;
+    }
+    *outImage = mDecodedImages.front().image;
+    mHeldOutputSlot = mDecodedImages.front().outputSlot;
+    mDecodedImages.pop_front();
+    return true;
+}
+
+void MediaH264Decoder::pipelineLoop() {
+    android::base::guest::applyThreadPolicy(
+        android::base::guest::ThreadRole::Codec);
+
+    std::unique_lock<std::mutex> lock(mPipelineMutex);
+    while (true) {
+        mPipelineCv.wait(lock, [this]() {
+            return mPipelineStopping || !mQueuedFrames.empty();
+        });
+        if (mQueuedFrames.empty()) {
+            if (mDestroyOnStop) {
+                lock.unlock();
+                destroyOnHost();
+            }
+            return;
+        }
+        PipelinedFrame frame = mQueuedFrames.front();
+        mQueuedFrames.pop_front();
+        mPipelineBusy = true;
+
+        // frames in flight and the held image never take all output slots
+        int outputSlot = 0;
+        while (mOutputSlotsInUse[outputSlot]) {
+            ++outputSlot;
+        }
+        mOutputSlotsInUse[outputSlot] = true;
+        lock.unlock();
+
+        h264_result_t res = decodeAt(frame.input, frame.szBytes, frame.pts);
+        if (res.bytesProcessed < frame.szBytes) {
+            ALOGW("%s: host consumed %" PRIu64 " of %zu bytes", __func__,
+                  res.bytesProcessed, frame.szBytes);
+        }
+        h264_image_t image = getImageAt(getOutputSlotAddr(outputSlot),
+                                        frame.hostColorBufferId > 0
+                                            ? frame.hostColorBufferId
+                                            : -1);
+
+        lock.lock();
+        for (int i = 0; i < frame.numInputSlots; ++i) {
+            mInputSlotsInUse[frame.firstInputSlot + i] = false;
+        }
+        if (image.data == nullptr) {
+            mOutputSlotsInUse[outputSlot] = false;
+            outputSlot = -1;
+        }
+        mDecodedImages.push_back({image, outputSlot});
+        mPipelineBusy = false;
+        mPipelineCv.notify_all();
+    }
+}
@@ -19,6 +19,12 @@
 
 #include "goldfish_media_utils.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 struct h264_init_result_t {
     uint64_t host_handle;
     int ret;
@@ -57,9 +63,61 @@ class MediaH264Decoder {
     uint64_t mAddressOffSet = 0;
     int mSlot = -1;
 
+    // An access unit staged in input slots, waiting for the host.
+    struct PipelinedFrame {
+        uint8_t *input;
+        size_t szBytes;
+        uint64_t pts;
+        int hostColorBufferId;
+        int firstInputSlot;
+        int numInputSlots;
+    };
+
+    // What the host returned for a pipelined frame, and the output slot
+    // holding its data, if any.
+    struct PipelinedImage {
+        h264_image_t image;
+        int outputSlot;
+    };
+
+    bool mPipelined = false;
+    bool mPipelineStopping = false;
+    bool mPipelineBusy = false;
+    // destroy the host context once the pipeline thread is done
+    bool mDestroyOnStop = false;
+    size_t mOutputSlotBytes = 0;
+    std::thread mPipelineThread;
+    std::mutex mPipelineMutex;
+    std::condition_variable mPipelineCv;
+    std::deque<PipelinedFrame> mQueuedFrames;
+    std::deque<PipelinedImage> mDecodedImages;
+    std::vector<bool> mInputSlotsInUse;
+    std::vector<bool> mOutputSlotsInUse;
+    // output slot of the image last handed out by dequeueImage()
+    int mHeldOutputSlot = -1;
+
+    void pipelineLoop();
+    void stopPipeline();
+    void waitForPipelineIdleLocked(std::unique_lock<std::mutex> &lock);
+    void waitForPipelineIdle();
+    void releaseHeldOutputSlotLocked();
+    void discardPipelinedFramesLocked();
+    void destroyOnHost();
+    uint8_t *getInputSlotAddr(int slot) const;
+    uint8_t *getOutputSlotAddr(int slot) const;
+    h264_result_t decodeAt(uint8_t *hostSrc, size_t szBytes, uint64_t pts);
+    h264_image_t getImageAt(uint8_t *dst, int hostColorBufferId);
+
   public:
     MediaH264Decoder(RenderMode renderMode);
-    virtual ~MediaH264Decoder() = default;
+    virtual ~MediaH264Decoder();
+
+    // Access units that can be queued with queueFrame() before one of
+    // their images has to be taken with dequeueImage().
+    static constexpr int kMaxFramesInFlight = 2;
+    // Size of each input slot; an access unit that does not fit in one
+    // waits for the pipeline to empty and takes all of them.
+    static constexpr size_t kInputSlotBytes = 3 << 20;
 
     enum class PixelFormat : uint8_t {
         YUV420P = 0,
@@ -83,6 +141,10 @@ class MediaH264Decoder {
                           unsigned int outWidth, unsigned int outHeight,
                           PixelFormat pixFmt);
     void destroyH264Context();
+    // Like destroyH264Context(), but drops the frames in flight and leaves
+    // the host calls to the pipeline thread, so that it returns without
+    // waiting for the host. Deleting the decoder waits for them.
+    void destroyH264ContextAsync();
     h264_result_t decodeFrame(uint8_t *img, size_t szBytes, uint64_t pts);
     void flush();
     // ask host to copy image data back to guest, with image metadata
@@ -100,5 +162,32 @@ class MediaH264Decoder {
     // it; unrecognized typeid will be discarded by host side.
 
     void sendMetadata(MetaDataColorAspects *ptr);
+
+    // Starts decoding access units given to queueFrame() on a thread that
+    // makes the host calls, so that the caller can stage the next access
+    // unit and consume decoded images while the host is busy. Each image
+    // takes up to |outputFrameBytes|. Returns false, leaving the decoder
+    // synchronous, if the memory slot has no room for the slots.
+    //
+    // The other calls above wait for queued frames to be done with on the
+    // host first; the caller has to have taken their images before it makes
+    // calls that copy data through the shared memory, e.g., getImage().
+    bool startPipeline(size_t outputFrameBytes);
+    bool isPipelined() const { return mPipelined; }
+    // Access units queued and not yet returned by dequeueImage().
+    int getFramesInFlight();
+    // Stages an access unit in free input slots and queues it for decoding,
+    // followed by a getImage() - or a renderOnHostAndReturnImageMetadata()
+    // when |hostColorBufferId| is positive. Returns false if the pipeline is
+    // not running, too many frames are in flight, or the access unit does
+    // not fit in the input slots; nothing is queued then.
+    bool queueFrame(const uint8_t *img, size_t szBytes, uint64_t pts,
+                    int hostColorBufferId);
+    // Returns what the host returned for the oldest frame in flight in
+    // |outImage|, which has no data if no image came out for that access
+    // unit. Waits for the host if |wait| is set, and returns false if nothing
+    // is in flight or, without |wait|, not done yet. The image data stays
+    // valid until the next queueFrame() or dequeueImage().
+    bool dequeueImage(h264_image_t *outImage, bool wait);
 };
 #endif
@@ -27,6 +27,7 @@
 #include <C2Debug.h>
 #include <C2PlatformSupport.h>
 #include <SimpleC2Component.h>
+#include "aemu/base/threads/AndroidThreadPolicy.h"
 
 #define DEBUG 0
 #if DEBUG
@@ -104,6 +105,8 @@ void SimpleC2Component::WorkHandler::onMessageReceived(
         break;
     }
     case kWhatInit: {
+        android::base::guest::applyThreadPolicy(
+            android::base::guest::ThreadRole::Codec);
         int32_t err = thiz->onInit();
         Reply(msg, &err);
         [[fallthrough]];
@@ -114,6 +117,7 @@ void SimpleC2Component::WorkHandler::onMessageReceived(
     }
     case kWhatStop: {
         int32_t err = thiz->onStop();
+        thiz->mPerfStats.logSummary();
         Reply(msg, &err);
         break;
     }
@@ -125,6 +129,7 @@ void SimpleC2Component::WorkHandler::onMessageReceived(
     }
     case kWhatRelease: {
         thiz->onRelease();
+        thiz->mPerfStats.logSummary();
         mRunning = false;
         Reply(msg);
         break;
@@ -196,7 +201,8 @@ struct DummyReadView : public C2ReadView {
 
 SimpleC2Component::SimpleC2Component(
     const std::shared_ptr<C2ComponentInterface> &intf)
-    : mDummyReadView(DummyReadView()), mIntf(intf), mLooper(new ALooper),
+    : mDummyReadView(DummyReadView()), mPerfStats(intf->getName()),
+      mIntf(intf), mLooper(new ALooper),
       mHandler(new WorkHandler) {
     mLooper->setName(intf->getName().c_str());
     (void)mLooper->registerHandler(mHandler);
@@ -240,6 +246,8 @@ SimpleC2Component::queue_nb(std::list<std::unique_ptr<C2Work>> *const items) {
         Mutexed<WorkQueue>::Locked queue(mWorkQueue);
         queueWasEmpty = queue->empty();
         while (!items->empty()) {
+            mPerfStats.onWorkQueued(
+                items->front()->input.ordinal.frameIndex.peeku());
             queue->push_back(std::move(items->front()));
             items->pop_front();
         }
@@ -281,6 +289,7 @@ c2_status_t SimpleC2Component::flush_sm(
             queue->pending().erase(queue->pending().begin());
         }
     }
+    mPerfStats.onFlush();
 
     return C2_OK;
 }
@@ -411,6 +420,7 @@ void SimpleC2Component::finish(
     }
     if (work) {
         fillWork(work);
+        mPerfStats.onWorkDone(frameIndex);
         std::shared_ptr<C2Component::Listener> listener =
             mExecState.lock()->mListener;
         listener->onWorkDone_nb(shared_from_this(), vec(work));
@@ -570,6 +580,7 @@ bool SimpleC2Component::processQueue() {
     }
     if (work->workletsProcessed != 0u) {
         queue.unlock();
+        mPerfStats.onWorkDone(work->input.ordinal.frameIndex.peeku());
         Mutexed<ExecState>::Locked state(mExecState);
         DDD("returning this work");
         std::shared_ptr<C2Component::Listener> listener = state->mListener;
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "codec_perf_stats.h"
+
+#include "goldfish_media_utils.h"
+
+#include <cutils/properties.h>
+#include <log/log.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+
+CodecPerfStats::CodecPerfStats(const std::string &name)
+    : mName(name),
+      mEnabled(property_get_bool("debug.goldfish.codec2.perf", false)) {}
+
+int64_t CodecPerfStats::nowNanos() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void CodecPerfStats::onWorkQueued(uint64_t frameIndex) {
+    if (!mEnabled) {
+        return;
+    }
+    const int64_t now = nowNanos();
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mQueuedAt.empty() && mLatencies.empty()) {
+        mFirstQueuedAt = now;
+        mHostNanosAtStart = GoldfishMediaTransport::getInstance()->getHostNanos();
+    }
+    mQueuedAt[frameIndex] = now;
+    mMaxInFlight = std::max(mMaxInFlight, mQueuedAt.size());
+}
+
+void CodecPerfStats::onWorkDone(uint64_t frameIndex) {
+    if (!mEnabled) {
+        return;
+    }
+    const int64_t now = nowNanos();
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mQueuedAt.find(frameIndex);
+    if (it == mQueuedAt.end()) {
+        // output cloned from a work still in flight
+        return;
+    }
+    mLatencies.push_back(now - it->second);
+    mQueuedAt.erase(it);
+    mLastDoneAt = now;
+}
+
+void CodecPerfStats::onFlush() {
+    if (!mEnabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mMutex);
+    mQueuedAt.clear();
+}
+
+void CodecPerfStats::addCopyNanos(int64_t nanos) {
+    if (!mEnabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCopyNanos += nanos;
+}
+
+void CodecPerfStats::logSummary() {
+    if (!mEnabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mLatencies.empty()) {
+        resetLocked();
+        return;
+    }
+
+    std::sort(mLatencies.begin(), mLatencies.end());
+    auto percentileMs = [this](size_t percent) {
+        const size_t i = (mLatencies.size() - 1) * percent / 100;
+        return mLatencies[i] / 1e6;
+    };
+    const double seconds = (mLastDoneAt - mFirstQueuedAt) / 1e9;
+    const uint64_t hostNanos =
+        GoldfishMediaTransport::getInstance()->getHostNanos() -
+        mHostNanosAtStart;
+    struct rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+
+    ALOGI("%s: %zu frames in %.3f s, %.1f fps; latency p50 %.2f ms p90 "
+          "%.2f ms p99 %.2f ms; copy %.1f ms, host %.1f ms; max in flight "
+          "%zu, max rss %ld KB",
+          mName.c_str(), mLatencies.size(), seconds,
+          seconds > 0 ? mLatencies.size() / seconds : 0.0, percentileMs(50),
+          percentileMs(90), percentileMs(99), mCopyNanos / 1e6,
+          hostNanos / 1e6, mMaxInFlight, usage.ru_maxrss);
+    resetLocked();
+}
+
+void CodecPerfStats::resetLocked() {
+    mQueuedAt.clear();
+    mLatencies.clear();
+    mMaxInFlight = 0;
+    mFirstQueuedAt = 0;
+    mLastDoneAt = 0;
+    mCopyNanos = 0;
+}
+
+CodecPerfStats::ScopedCopyTimer::ScopedCopyTimer(CodecPerfStats &stats)
+    : mStats(stats), mStart(stats.enabled() ? nowNanos() : 0) {}
+
+CodecPerfStats::ScopedCopyTimer::~ScopedCopyTimer() {
+    if (mStats.enabled()) {
+        mStats.addCopyNanos(nowNanos() - mStart);
+    }
+}
@@ -22,6 +22,10 @@
 #include <cb_handle_30.h>
 #include <xf86drm.h>
 
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 #include <C2AllocatorGralloc.h>
 
 #include "cros_gralloc_handle.h"
@@ -55,11 +59,32 @@ public:
 
     uint32_t getColorBufferHandle(native_handle_t const* handle) {
         if (m_isMinigbm) {
+            // Output blocks cycle through the same few buffers, so remember
+            // their resources instead of asking the kernel every frame.
+            const uint32_t bufferId =
+                reinterpret_cast<cros_gralloc_handle const*>(handle)->id;
+            {
+                std::lock_guard<std::mutex> lock(m_resHandlesMutex);
+                auto it = m_resHandles.find(bufferId);
+                if (it != m_resHandles.end()) {
+                    return it->second;
+                }
+            }
+
             struct drm_virtgpu_resource_info info;
             if (!getResInfo(handle, &info)) {
                 ALOGE("%s: Error gtting color buffer handle (minigbm case)", __func__);
                 return -1;
             }
+
+            std::lock_guard<std::mutex> lock(m_resHandlesMutex);
+            if (m_resHandles.size() >= kMaxResHandles) {
+                m_resHandles.erase(m_resHandleOrder.front());
+                m_resHandleOrder.pop_front();
+            }
+            if (m_resHandles.emplace(bufferId, info.res_handle).second) {
+                m_resHandleOrder.push_back(bufferId);
+            }
             return info.res_handle;
         } else {
             return cb_handle_t::from(handle)->hostHandle;
@@ -107,6 +132,13 @@ private:
 
     bool m_isMinigbm;
     int m_rendernodeFd = -1; // to be closed when this process dies
+
+    // virtgpu resources of minigbm buffers, keyed on the buffer id, which
+    // is not reused; the oldest are dropped first
+    static constexpr size_t kMaxResHandles = 64;
+    std::mutex m_resHandlesMutex;
+    std::unordered_map<uint32_t, uint32_t> m_resHandles;
+    std::deque<uint32_t> m_resHandleOrder;
 };
 
 static ColorBufferUtilsGlobalState* getGlobals() {
@@ -118,6 +150,18 @@ uint32_t getColorBufferHandle(native_handle_t const* handle) {
     return getGlobals()->getColorBufferHandle(handle);
 }
 
+uint32_t getColorBufferHandle(const std::shared_ptr<C2GraphicBlock> &block) {
+    native_handle_t *grallocHandle =
+        android::UnwrapNativeCodec2GrallocHandle(block->handle());
+    if (!grallocHandle) {
+        return -1;
+    }
+    uint32_t hostHandle = getColorBufferHandle(grallocHandle);
+    // the unwrapped handle shares the fds of the block
+    native_handle_delete(grallocHandle);
+    return hostHandle;
+}
+
 uint64_t getClientUsage(const std::shared_ptr<C2BlockPool> &pool) {
       std::shared_ptr<C2GraphicBlock> myOutBlock;
       const C2MemoryUsage usage = {0, 0};
@@ -131,3 +175,78 @@ uint64_t getClientUsage(const std::shared_ptr<C2BlockPool> &pool) {
       return mycb->usage;
 }
 
+
+static void copyPlane(uint8_t *dst, const C2PlaneInfo &plane,
+                      const uint8_t *src, size_t srcStride, uint32_t width,
+                      uint32_t height) {
+    if (plane.colInc != 1) {
+        // interleaved chroma
+        for (uint32_t i = 0; i < height; ++i) {
+            uint8_t *d = dst + (ptrdiff_t)i * plane.rowInc;
+            for (uint32_t j = 0; j < width; ++j) {
+                d[(ptrdiff_t)j * plane.colInc] = src[i * srcStride + j];
+            }
+        }
+    } else if (plane.rowInc == (int32_t)srcStride) {
+        memcpy(dst, src, srcStride * height);
+    } else {
+        for (uint32_t i = 0; i < height; ++i) {
+            memcpy(dst + (ptrdiff_t)i * plane.rowInc, src + i * srcStride,
+                   width);
+        }
+    }
+}
+
+uint32_t getOutputPixelFormat(uint32_t requestedFormat,
+                              bool decodingToHostColorBuffer) {
+    if (requestedFormat != HAL_PIXEL_FORMAT_RGBA_8888) {
+        return HAL_PIXEL_FORMAT_YCBCR_420_888;
+    }
+    if (!decodingToHostColorBuffer) {
+        ALOGW("%s: RGBA output needs host color buffers, decoding to YUV",
+              __func__);
+        return HAL_PIXEL_FORMAT_YCBCR_420_888;
+    }
+    return HAL_PIXEL_FORMAT_RGBA_8888;
+}
+
+void copyYuv420PlanarToGraphicView(const uint8_t *srcY, const uint8_t *srcU,
+                                   const uint8_t *srcV, uint32_t width,
+                                   uint32_t height, C2GraphicView *view) {
+    const C2PlanarLayout layout = view->layout();
+    if (layout.type != C2PlanarLayout::TYPE_YUV) {
+        // e.g. an RGBA block whose color buffer the host could not render to
+        ALOGE("%s: cannot copy to a layout of type %d", __func__,
+              (int)layout.type);
+        return;
+    }
+    const C2PlaneInfo &planeY = layout.planes[C2PlanarLayout::PLANE_Y];
+    const C2PlaneInfo &planeU = layout.planes[C2PlanarLayout::PLANE_U];
+    const C2PlaneInfo &planeV = layout.planes[C2PlanarLayout::PLANE_V];
+    uint8_t *dstY = view->data()[C2PlanarLayout::PLANE_Y];
+    uint8_t *dstU = view->data()[C2PlanarLayout::PLANE_U];
+    uint8_t *dstV = view->data()[C2PlanarLayout::PLANE_V];
+
+    // the chroma planes follow the luma plane in either order
+    const size_t ySize = (size_t)width * height;
+    const size_t uvSize = ySize / 4;
+    const ptrdiff_t uOffset = srcU - srcY;
+    const ptrdiff_t vOffset = srcV - srcY;
+    const bool srcPacked =
+        (uOffset == (ptrdiff_t)ySize && vOffset == (ptrdiff_t)(ySize + uvSize)) ||
+        (vOffset == (ptrdiff_t)ySize && uOffset == (ptrdiff_t)(ySize + uvSize));
+    const bool dstPacked =
+        planeY.colInc == 1 && planeU.colInc == 1 && planeV.colInc == 1 &&
+        planeY.rowInc == (int32_t)width &&
+        planeU.rowInc == (int32_t)width / 2 &&
+        planeV.rowInc == (int32_t)width / 2 && dstU - dstY == uOffset &&
+        dstV - dstY == vOffset;
+    if (srcPacked && dstPacked) {
+        memcpy(dstY, srcY, ySize + 2 * uvSize);
+        return;
+    }
+
+    copyPlane(dstY, planeY, srcY, width, width, height);
+    copyPlane(dstU, planeU, srcU, width / 2, width / 2, height / 2);
+    copyPlane(dstV, planeV, srcV, width / 2, width / 2, height / 2);
+}
@@ -25,6 +25,8 @@
 #define DDD(...) ((void)0)
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -48,7 +50,7 @@ class GoldfishMediaTransportImpl : public GoldfishMediaTransport {
     virtual __u64 offsetOf(uint64_t addr) const override;
 
   public:
-    // each lot has 2 M
+    // each lot has 1 M
     virtual int getMemorySlot() override {
         std::lock_guard<std::mutex> g{mMemoryMutex};
         // when there are just 1 decoder, it can pretty
@@ -64,9 +66,10 @@ class GoldfishMediaTransportImpl : public GoldfishMediaTransport {
             1,  3,  5,  7,  9,  11, 13, 15,
             17, 19, 21, 23, 25, 27, 29, 31 // use 1M
         };
+        const int session = pickSessionLocked();
         for (size_t i = 0; i < sizeof(search_order) / sizeof(search_order[0]);
              ++i) {
-            int slot = search_order[i];
+            int slot = session * kLotsPerSession + search_order[i];
             if (mMemoryLotsAvailable[slot]) {
                 mMemoryLotsAvailable[slot] = false;
                 return slot;
@@ -74,27 +77,95 @@ class GoldfishMediaTransportImpl : public GoldfishMediaTransport {
         }
         return -1;
     }
+    virtual bool reserveMemorySlotBytes(int slot, size_t bytes) override {
+        if (slot < 0 || slot >= mMemoryLotsAvailable.size()) {
+            return false;
+        }
+        std::lock_guard<std::mutex> g{mMemoryMutex};
+        // the data of a slot runs up to the parameters of the lot after
+        // its last one
+        const size_t lots = (bytes + kParamSizeBytes + kLotBytes - 1) / kLotBytes;
+        const int lot = slot % kLotsPerSession;
+        if (lot + lots > kLotsPerSession) {
+            return false;
+        }
+        for (size_t i = mSlotLots[slot]; i < lots; ++i) {
+            if (!mMemoryLotsAvailable[slot + i]) {
+                return false;
+            }
+        }
+        for (size_t i = mSlotLots[slot]; i < lots; ++i) {
+            mMemoryLotsAvailable[slot + i] = false;
+        }
+        if (lots > mSlotLots[slot]) {
+            mSlotLots[slot] = lots;
+        }
+        return true;
+    }
     virtual void returnMemorySlot(int lot) override {
         if (lot < 0 || lot >= mMemoryLotsAvailable.size()) {
             return;
         }
         std::lock_guard<std::mutex> g{mMemoryMutex};
         if (mMemoryLotsAvailable[lot] == false) {
-            mMemoryLotsAvailable[lot] = true;
+            for (size_t i = 0; i < mSlotLots[lot]; ++i) {
+                mMemoryLotsAvailable[lot + i] = true;
+            }
+            mSlotLots[lot] = 1;
         } else {
             ALOGE("Error, cannot twice");
         }
     }
+    virtual uint64_t getHostNanos() const override {
+        return mHostNanos.load(std::memory_order_relaxed);
+    }
 
   private:
-    std::mutex mMemoryMutex;
-    std::vector<bool> mMemoryLotsAvailable = std::vector<bool>(32, true);
+    // An address space mapping of its own, laid out as follows:
+    // ========================================================
+    // | kParamSizeBytes | kInputSizeBytes | kOutputSizeBytes |
+    // ========================================================
+    // Every session is a separate media context on the host with a ping
+    // channel of its own, so decoders in different sessions do not wait on
+    // one another's host calls.
+    struct Session {
+        address_space_handle_t handle = -1;
+        uint64_t offset = 0;
+        uint64_t physAddr = 0;
+        uint8_t *startPtr = nullptr;
+        // set once the above are, and never cleared while the transport
+        // lives, so that addresses can be looked up without the lock
+        std::atomic<bool> open{false};
+    };
+
+    bool openSession(Session &session);
+    int pickSessionLocked();
+    bool isSessionIdleLocked(int session) const;
+    // the session an offset from getMemorySlot() falls into, and the offset
+    // within that session
+    const Session &sessionOf(unsigned int offSet) const {
+        return mSessions[offSet / kSessionStride];
+    }
+    static unsigned int offsetInSession(unsigned int offSet) {
+        return offSet % kSessionStride;
+    }
 
-    address_space_handle_t mHandle;
-    uint64_t mOffset;
-    uint64_t mPhysAddr;
+    // Sessions opened as decoders come, one for each of the first few.
+    static constexpr int kMaxSessions = 4;
+    static constexpr int kLotsPerSession = 32;
+    static constexpr size_t kLotBytes = 1 << 20;
+    // Offsets handed out for slots of session i start at i * kSessionStride.
+    static constexpr unsigned int kSessionStride = kLotsPerSession << 20;
+
+    std::mutex mMemoryMutex;
+    std::vector<bool> mMemoryLotsAvailable =
+        std::vector<bool>(kMaxSessions * kLotsPerSession, true);
+    // how many lots each slot handed out spans, counting its own
+    std::vector<size_t> mSlotLots =
+        std::vector<size_t>(kMaxSessions * kLotsPerSession, 1);
+    Session mSessions[kMaxSessions];
     uint64_t mSize;
-    void *mStartPtr = nullptr;
+    std::atomic<uint64_t> mHostNanos{0};
 
     // MediaCodecType will be or'd together with the metadata, so the highest
     // 8-bits will have the type.
@@ -115,47 +186,97 @@ class GoldfishMediaTransportImpl : public GoldfishMediaTransport {
 };
 
 GoldfishMediaTransportImpl::~GoldfishMediaTransportImpl() {
-    if (mHandle >= 0) {
-        goldfish_address_space_close(mHandle);
-        mHandle = -1;
+    for (Session &session : mSessions) {
+        if (session.handle >= 0) {
+            goldfish_address_space_close(session.handle);
+            session.handle = -1;
+        }
     }
 }
 
 GoldfishMediaTransportImpl::GoldfishMediaTransportImpl() {
-    // Allocate host memory; the contiguous memory region will be laid out as
-    // follows:
-    // ========================================================
-    // | kParamSizeBytes | kInputSizeBytes | kOutputSizeBytes |
-    // ========================================================
-    mHandle = goldfish_address_space_open();
-    if (mHandle < 0) {
-        ALOGE("Failed to ping host to allocate memory");
+    mSize = kParamSizeBytes + kInputSizeBytes + kOutputSizeBytes;
+    // the first session is always there; the others are opened on demand
+    if (!openSession(mSessions[0])) {
         abort();
     }
-    mSize = kParamSizeBytes + kInputSizeBytes + kOutputSizeBytes;
-    bool success =
-        goldfish_address_space_allocate(mHandle, mSize, &mPhysAddr, &mOffset);
+}
+
+bool GoldfishMediaTransportImpl::openSession(Session &session) {
+    session.handle = goldfish_address_space_open();
+    if (session.handle < 0) {
+        ALOGE("Failed to ping host to allocate memory");
+        return false;
+    }
+    bool success = goldfish_address_space_allocate(
+        session.handle, mSize, &session.physAddr, &session.offset);
     if (success) {
         ALOGI("successfully allocated %d bytes in goldfish_address_block",
               (int)mSize);
-        mStartPtr = goldfish_address_space_map(mHandle, mOffset, mSize);
-        ALOGI("guest address is %p", mStartPtr);
+        session.startPtr = (uint8_t *)goldfish_address_space_map(
+            session.handle, session.offset, mSize);
+        ALOGI("guest address is %p", session.startPtr);
 
         struct address_space_ping pingInfo;
         pingInfo.metadata = GoldfishAddressSpaceSubdeviceType::Media;
-        pingInfo.offset = mOffset;
-        if (goldfish_address_space_ping(mHandle, &pingInfo) == false) {
+        pingInfo.offset = session.offset;
+        if (goldfish_address_space_ping(session.handle, &pingInfo) == false) {
             ALOGE("Failed to ping host to allocate memory");
-            abort();
-            return;
         } else {
             ALOGI("successfully pinged host to allocate memory");
+            session.open = true;
+            return true;
         }
     } else {
         ALOGE("failed to allocate %d bytes in goldfish_address_block",
               (int)mSize);
-        abort();
     }
+    goldfish_address_space_close(session.handle);
+    session.handle = -1;
+    session.startPtr = nullptr;
+    return false;
+}
+
+bool GoldfishMediaTransportImpl::isSessionIdleLocked(int session) const {
+    for (int i = 0; i < kLotsPerSession; ++i) {
+        if (!mMemoryLotsAvailable[session * kLotsPerSession + i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Gives a new decoder a session to itself while there are sessions to go
+// around, and otherwise shares the least busy one.
+int GoldfishMediaTransportImpl::pickSessionLocked() {
+    for (int i = 0; i < kMaxSessions; ++i) {
+        if (mSessions[i].open && isSessionIdleLocked(i)) {
+            return i;
+        }
+    }
+    for (int i = 0; i < kMaxSessions; ++i) {
+        if (!mSessions[i].open && mSessions[i].handle < 0 &&
+            openSession(mSessions[i])) {
+            return i;
+        }
+    }
+
+    int best = 0;
+    int bestInUse = kLotsPerSession + 1;
+    for (int i = 0; i < kMaxSessions; ++i) {
+        if (!mSessions[i].open) {
+            continue;
+        }
+        int inUse = 0;
+        for (int j = 0; j < kLotsPerSession; ++j) {
+            inUse += mMemoryLotsAvailable[i * kLotsPerSession + j] ? 0 : 1;
+        }
+        if (inUse < bestInUse) {
+            best = i;
+            bestInUse = inUse;
+        }
+    }
+    return best;
 }
 
 // static
@@ -182,7 +303,8 @@ __u64 GoldfishMediaTransportImpl::makeMetadata(MediaCodecType type,
 }
 
 uint8_t *GoldfishMediaTransportImpl::getInputAddr(unsigned int offSet) const {
-    return (uint8_t *)mStartPtr + kParamSizeBytes + offSet;
+    return sessionOf(offSet).startPtr + kParamSizeBytes +
+           offsetInSession(offSet);
 }
 
 uint8_t *GoldfishMediaTransportImpl::getOutputAddr() const {
@@ -190,20 +312,35 @@ uint8_t *GoldfishMediaTransportImpl::getOutputAddr() const {
 }
 
 uint8_t *GoldfishMediaTransportImpl::getBaseAddr() const {
-    return (uint8_t *)mStartPtr;
+    return mSessions[0].startPtr;
 }
 
 uint8_t *GoldfishMediaTransportImpl::getReturnAddr(unsigned int offSet) const {
-    return (uint8_t *)mStartPtr + kReturnOffset + offSet;
+    return sessionOf(offSet).startPtr + kReturnOffset +
+           offsetInSession(offSet);
 }
 
+// Offsets are relative to the start of the session an address is in, plus
+// the first offset of that session, so that subtracting the offset of a slot
+// gives what the host expects.
 __u64 GoldfishMediaTransportImpl::offsetOf(uint64_t addr) const {
-    return addr - (uint64_t)mStartPtr;
+    for (int i = 0; i < kMaxSessions; ++i) {
+        const Session &session = mSessions[i];
+        if (!session.open) {
+            continue;
+        }
+        const uint64_t start = (uint64_t)session.startPtr;
+        if (addr >= start && addr < start + mSize) {
+            return addr - start + (uint64_t)i * kSessionStride;
+        }
+    }
+    return addr - (uint64_t)mSessions[0].startPtr;
 }
 
 void GoldfishMediaTransportImpl::writeParam(__u64 val, unsigned int num,
                                             unsigned int offSetToStartAddr) {
-    uint8_t *p = (uint8_t *)mStartPtr + (offSetToStartAddr);
+    uint8_t *p =
+        sessionOf(offSetToStartAddr).startPtr + offsetInSession(offSetToStartAddr);
     uint64_t *pint = (uint64_t *)(p + 8 * num);
     *pint = val;
 }
@@ -211,10 +348,18 @@ void GoldfishMediaTransportImpl::writeParam(__u64 val, unsigned int num,
 bool GoldfishMediaTransportImpl::sendOperation(MediaCodecType type,
                                                MediaOperation op,
                                                unsigned int offSetToStartAddr) {
+    const Session &session = sessionOf(offSetToStartAddr);
     struct address_space_ping pingInfo;
-    pingInfo.metadata = makeMetadata(type, op, offSetToStartAddr);
-    pingInfo.offset = mOffset; // + (offSetToStartAddr);
-    if (goldfish_address_space_ping(mHandle, &pingInfo) == false) {
+    pingInfo.metadata =
+        makeMetadata(type, op, offsetInSession(offSetToStartAddr));
+    pingInfo.offset = session.offset; // + (offSetToStartAddr);
+    const auto start = std::chrono::steady_clock::now();
+    const bool pinged = goldfish_address_space_ping(session.handle, &pingInfo);
+    mHostNanos.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count(),
+                         std::memory_order_relaxed);
+    if (pinged == false) {
         ALOGE("failed to ping host");
         abort();
         return false;
@@ -22,6 +22,8 @@
 
 #include <C2Component.h>
 
+#include "codec_perf_stats.h"
+
 #include <media/stagefright/foundation/AHandler.h>
 #include <media/stagefright/foundation/ALooper.h>
 #include <media/stagefright/foundation/Mutexed.h>
@@ -160,6 +162,10 @@ class SimpleC2Component
 
     C2ReadView mDummyReadView;
 
+    // Not counting unless enabled, see codec_perf_stats.h. Components add
+    // their copy time.
+    CodecPerfStats mPerfStats;
+
   private:
     const std::shared_ptr<C2ComponentInterface> mIntf;
 
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GOLDFISH_CODEC_PERF_STATS_H_
+#define GOLDFISH_CODEC_PERF_STATS_H_
+
+#include <stdint.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Decoder throughput numbers of one component, for measuring codec changes
+// with any player that can feed it, e.g. screenrecord or a media test app.
+// Counting is off unless the debug.goldfish.codec2.perf property is 1 when
+// the component is created; the summary goes to the log when the component
+// stops:
+//   frames, frames per second, p50/p90/p99 of the time from queueing a
+//   work to returning it, time spent copying decoded images and waiting on
+//   the host, the most works in flight and the peak resident set size.
+class CodecPerfStats {
+  public:
+    explicit CodecPerfStats(const std::string &name);
+
+    bool enabled() const { return mEnabled; }
+
+    void onWorkQueued(uint64_t frameIndex);
+    void onWorkDone(uint64_t frameIndex);
+    // Forgets about the works in flight, which are not coming back.
+    void onFlush();
+
+    // Adds the time spent copying decoded images out of the shared memory.
+    void addCopyNanos(int64_t nanos);
+
+    // Logs the numbers collected since the last summary, and starts over.
+    void logSummary();
+
+    // Adds the time it is in scope to the copy time of |stats|.
+    class ScopedCopyTimer {
+      public:
+        explicit ScopedCopyTimer(CodecPerfStats &stats);
+        ~ScopedCopyTimer();
+
+      private:
+        CodecPerfStats &mStats;
+        int64_t mStart;
+    };
+
+    static int64_t nowNanos();
+
+  private:
+    void resetLocked();
+
+    const std::string mName;
+    const bool mEnabled;
+
+    std::mutex mMutex;
+    std::unordered_map<uint64_t, int64_t> mQueuedAt;
+    std::vector<int64_t> mLatencies;
+    size_t mMaxInFlight = 0;
+    int64_t mFirstQueuedAt = 0;
+    int64_t mLastDoneAt = 0;
+    int64_t mCopyNanos = 0;
+    uint64_t mHostNanosAtStart = 0;
+};
+
+#endif // GOLDFISH_CODEC_PERF_STATS_H_
@@ -17,4 +17,21 @@
 #include <SimpleC2Interface.h>
 
 uint32_t getColorBufferHandle(native_handle_t const* handle);
+// The host color buffer of an output block.
+uint32_t getColorBufferHandle(const std::shared_ptr<C2GraphicBlock> &block);
 uint64_t getClientUsage(const std::shared_ptr<C2BlockPool> &pool);
+
+// The format to allocate output blocks in, given the pixel format the
+// client configured. RGBA is only given when the host renders into the
+// color buffers, which it converts to on its GPU as it does; decoding to
+// guest memory always gives YUV.
+uint32_t getOutputPixelFormat(uint32_t requestedFormat,
+                              bool decodingToHostColorBuffer);
+
+// Copies a YUV 4:2:0 image with packed rows, as the host decoders return
+// it, into the planes of |view|. Planes with the same row layout are
+// copied as a whole, and the whole image in one go if the planes also
+// follow one another in the same order.
+void copyYuv420PlanarToGraphicView(const uint8_t *srcY, const uint8_t *srcU,
+                                   const uint8_t *srcV, uint32_t width,
+                                   uint32_t height, C2GraphicView *view);
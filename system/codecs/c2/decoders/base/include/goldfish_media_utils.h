@@ -14,6 +14,7 @@
 
 #include <linux/types.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #ifndef GOLDFISH_COMMON_GOLDFISH_DEFS_H
 #define GOLDFISH_COMMON_GOLDFISH_DEFS_H
@@ -41,7 +42,9 @@ enum class MediaOperation : __u8 {
     Flush = 4,
     Reset = 5,
     SendMetadata = 6,
-    Max = 7,
+    // DecodeImage immediately followed by GetImage, in one round trip.
+    DecodeAndGetImage = 7,
+    Max = 8,
 };
 
 // This class will abstract away the knowledge required to send media codec data
@@ -88,20 +91,30 @@ class GoldfishMediaTransport {
     // only value of significance.
     virtual __u64 offsetOf(uint64_t addr) const = 0;
 
-    // Get a slot of memory (8 M per slot) for use by a decoder instance.
+    // Get a slot of memory for use by a decoder instance.
     // returns -1 for failure; or a slot >=0 on success.
-    // as of now, there are only 4 slots for use, each has 8 M, it is up
-    // to client on how to use it.
-    // 0th slot: [base, base+8M)
-    // ...
-    // ith slot: [base+8M*i, base+8M*(i+1))
+    // The memory is split into sessions of 32 slots of 1 M each, and every
+    // session pings the host on a channel of its own; a new decoder gets a
+    // session to itself while there are enough of them. Use slot * 1M as
+    // the offset to pass to the calls above.
+    // ith slot: [base+1M*i, ...), with base the start of its session
     virtual int getMemorySlot() = 0;
 
+    // Extend a slot to |bytes| from getInputAddr() of it, taking the slots
+    // that follow it out of the pool until it is returned. Returns false,
+    // reserving nothing more, if one of them is in use or past the end of
+    // the session.
+    virtual bool reserveMemorySlotBytes(int slot, size_t bytes) = 0;
+
     // Return a slot back to pool. the slot should be valid >=0 and less
     // than the total size of slots. If nobody returns slot timely, the
     // new client could get -1 from getMemorySlot()
     virtual void returnMemorySlot(int slot) = 0;
 
+    // Get the total time all calls to sendOperation() in this process have
+    // spent waiting for the host, in nanoseconds.
+    virtual uint64_t getHostNanos() const = 0;
+
     static GoldfishMediaTransport *getInstance();
 };
 
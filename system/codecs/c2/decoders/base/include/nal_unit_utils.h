@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GOLDFISH_NAL_UNIT_UTILS_H_
+#define GOLDFISH_NAL_UNIT_UTILS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Returns the first 0x000001 start code at or after |pos|, or |end| if
+// there is none.
+const uint8_t *findNalStartCode(const uint8_t *pos, const uint8_t *end);
+
+// Walks the NAL units of an H.264 or HEVC Annex B byte stream, which
+// start with a 3 or 4 byte start code. Where a unit ends is only searched
+// for when size() is asked, so that walking past a slice header does not
+// scan the slice data.
+class NalUnitScanner {
+  public:
+    NalUnitScanner(const uint8_t *stream, size_t size);
+
+    // Moves to the next unit; returns false when there are no more.
+    bool next();
+    // The unit, without its start code and trailing zeros; data() has at
+    // least one byte, the unit header.
+    const uint8_t *data() const { return mUnit; }
+    size_t size();
+
+  private:
+    const uint8_t *mPos;
+    const uint8_t *mEnd;
+    const uint8_t *mUnit = nullptr;
+    // start code after mUnit, or nullptr if not searched for yet
+    const uint8_t *mNext = nullptr;
+};
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nal_unit_utils.h"
+
+#include <string.h>
+
+const uint8_t *findNalStartCode(const uint8_t *pos, const uint8_t *end) {
+    if (end - pos < 3) {
+        return end;
+    }
+    // Look for the 0x01 that ends a start code with memchr, which checks
+    // many bytes at a time, and only then for the zeros before it.
+    const uint8_t *p = pos + 2;
+    while (p < end) {
+        p = static_cast<const uint8_t *>(memchr(p, 0x01, end - p));
+        if (p == nullptr) {
+            return end;
+        }
+        if (p[-1] == 0 && p[-2] == 0) {
+            return p - 2;
+        }
+        // the 0x01 can not be one of the zeros of the next start code
+        p += 3;
+    }
+    return end;
+}
+
+NalUnitScanner::NalUnitScanner(const uint8_t *stream, size_t size)
+    : mPos(stream), mEnd(stream + size) {}
+
+bool NalUnitScanner::next() {
+    const uint8_t *startCode =
+        mNext != nullptr ? mNext : findNalStartCode(mPos, mEnd);
+    if (startCode == mEnd || mEnd - startCode < 4) {
+        mPos = mEnd;
+        return false;
+    }
+    mUnit = startCode + 3;
+    mPos = mUnit;
+    mNext = nullptr;
+    return true;
+}
+
+size_t NalUnitScanner::size() {
+    if (mNext == nullptr) {
+        mNext = findNalStartCode(mUnit, mEnd);
+    }
+    // the zero of a 4 byte start code, or trailing zeros, belong to no unit
+    const uint8_t *unitEnd = mNext;
+    while (unitEnd > mUnit && unitEnd[-1] == 0) {
+        --unitEnd;
+    }
+    return unitEnd - mUnit;
+}
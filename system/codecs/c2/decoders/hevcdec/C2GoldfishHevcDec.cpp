@@ -224,11 +224,18 @@ class C2GoldfishHevcDec::IntfImpl : public SimpleInterface<void>::BaseParams {
                             mCodedColorAspects)
                 .build());
 
-        // TODO: support more formats?
-        addParameter(DefineParam(mPixelFormat, C2_PARAMKEY_PIXEL_FORMAT)
-                         .withConstValue(new C2StreamPixelFormatInfo::output(
-                             0u, HAL_PIXEL_FORMAT_YCBCR_420_888))
-                         .build());
+        // RGBA has the host convert as it renders into the color buffers,
+        // see getOutputPixelFormat().
+        addParameter(
+            DefineParam(mPixelFormat, C2_PARAMKEY_PIXEL_FORMAT)
+                .withDefault(new C2StreamPixelFormatInfo::output(
+                    0u, HAL_PIXEL_FORMAT_YCBCR_420_888))
+                .withFields({C2F(mPixelFormat, value)
+                                 .oneOf({HAL_PIXEL_FORMAT_YCBCR_420_888,
+                                         HAL_PIXEL_FORMAT_RGBA_8888})})
+                .withSetter(
+                    Setter<decltype(*mPixelFormat)>::StrictValueWithNoDeps)
+                .build());
     }
     static C2R SizeSetter(bool mayBlock,
                           const C2P<C2StreamPictureSizeInfo::output> &oldMe,
@@ -353,6 +360,8 @@ class C2GoldfishHevcDec::IntfImpl : public SimpleInterface<void>::BaseParams {
 
     int transfer() const { return mColorAspects->transfer; }
 
+    uint32_t pixelFormat() const { return mPixelFormat->value; }
+
 
   private:
     std::shared_ptr<C2StreamProfileLevelInfo::input> mProfileLevel;
@@ -366,21 +375,11 @@ class C2GoldfishHevcDec::IntfImpl : public SimpleInterface<void>::BaseParams {
     std::shared_ptr<C2StreamPixelFormatInfo::output> mPixelFormat;
 };
 
-static void *ivd_aligned_malloc(void *ctxt, uint32_t alignment, uint32_t size) {
-    (void)ctxt;
-    return memalign(alignment, size);
-}
-
-static void ivd_aligned_free(void *ctxt, void *mem) {
-    (void)ctxt;
-    free(mem);
-}
-
 C2GoldfishHevcDec::C2GoldfishHevcDec(const char *name, c2_node_id_t id,
                                    const std::shared_ptr<IntfImpl> &intfImpl)
     : SimpleC2Component(
           std::make_shared<SimpleInterface<IntfImpl>>(name, id, intfImpl)),
-      mIntf(intfImpl), mOutBufferFlush(nullptr), mWidth(1920), mHeight(1080),
+      mIntf(intfImpl), mWidth(1920), mHeight(1080),
       mHeaderDecoded(false), mOutIndex(0u) {
     mWidth = mIntf->width();
     mHeight = mIntf->height();
@@ -420,37 +419,10 @@ void C2GoldfishHevcDec::decodeHeaderAfterFlush() {
 }
 
 c2_status_t C2GoldfishHevcDec::onFlush_sm() {
-    if (OK != setFlushMode())
-        return C2_CORRUPTED;
-
-    if (!mContext) {
-        // just ignore if context is not even created
-        return C2_OK;
-    }
-
-    uint32_t bufferSize = mStride * mHeight * 3 / 2;
-    mOutBufferFlush = (uint8_t *)ivd_aligned_malloc(nullptr, 128, bufferSize);
-    if (!mOutBufferFlush) {
-        ALOGE("could not allocate tmp output buffer (for flush) of size %u ",
-              bufferSize);
-        return C2_NO_MEMORY;
-    }
-
-    while (true) {
-        mPts = 0;
-        setDecodeArgs(nullptr, nullptr, 0, 0, 0);
-        mImg = mContext->getImage();
-        if (mImg.data == nullptr) {
-            resetPlugin();
-            break;
-        }
-    }
-
-    if (mOutBufferFlush) {
-        ivd_aligned_free(nullptr, mOutBufferFlush);
-        mOutBufferFlush = nullptr;
-    }
-
+    // The frames the host still holds go away with its context, so there is
+    // no need to flush the host decoder and pull them out one by one first.
+    mHeaderDecoded = false;
+    resetPlugin();
     deleteContext();
     return C2_OK;
 }
@@ -572,6 +544,7 @@ void C2GoldfishHevcDec::deleteContext() {
     if (mContext) {
         mContext->destroyHevcContext();
         mContext.reset(nullptr);
+        mParameterSets.clear();
         mPts2Index.clear();
         mOldPts2Index.clear();
         mIndex2Pts.clear();
@@ -666,7 +639,7 @@ C2GoldfishHevcDec::ensureDecoderState(const std::shared_ptr<C2BlockPool> &pool)
         mOutBlock.reset();
     }
     if (!mOutBlock) {
-        const uint32_t format = HAL_PIXEL_FORMAT_YCBCR_420_888;
+        const uint32_t format = mOutputFormat;
         const C2MemoryUsage usage = {(uint64_t)(BufferUsage::VIDEO_DECODER),
                                      C2MemoryUsage::CPU_WRITE | C2MemoryUsage::CPU_READ};
         c2_status_t err = pool->fetchGraphicBlock(ALIGN2(mWidth), mHeight,
@@ -676,10 +649,7 @@ C2GoldfishHevcDec::ensureDecoderState(const std::shared_ptr<C2BlockPool> &pool)
             return err;
         }
         if (mEnableAndroidNativeBuffers) {
-            auto c2Handle = mOutBlock->handle();
-            native_handle_t *grallocHandle =
-                UnwrapNativeCodec2GrallocHandle(c2Handle);
-            mHostColorBufferId = getColorBufferHandle(grallocHandle);
+            mHostColorBufferId = getColorBufferHandle(mOutBlock);
             DDD("found handle %d", mHostColorBufferId);
         }
         DDD("provided (%dx%d) required (%dx%d)", mOutBlock->width(),
@@ -709,6 +679,8 @@ void C2GoldfishHevcDec::checkMode(const std::shared_ptr<C2BlockPool> &pool) {
         DDD("decoding to guest byte buffer");
         mEnableAndroidNativeBuffers = false;
     }
+    mOutputFormat = getOutputPixelFormat(mIntf->pixelFormat(),
+                                         mEnableAndroidNativeBuffers);
 }
 
 void C2GoldfishHevcDec::getVuiParams(hevc_image_t &img) {
@@ -749,30 +721,15 @@ void C2GoldfishHevcDec::copyImageData(hevc_image_t &img) {
     if (mEnableAndroidNativeBuffers)
         return;
 
+    CodecPerfStats::ScopedCopyTimer copyTimer(mPerfStats);
     auto writeView = mOutBlock->map().get();
     if (writeView.error()) {
         ALOGE("graphic view map failed %d", writeView.error());
         return;
     }
-    size_t dstYStride = writeView.layout().planes[C2PlanarLayout::PLANE_Y].rowInc;
-    size_t dstUVStride = writeView.layout().planes[C2PlanarLayout::PLANE_U].rowInc;
-
-    uint8_t *pYBuffer = const_cast<uint8_t *>(writeView.data()[C2PlanarLayout::PLANE_Y]);
-    uint8_t *pUBuffer = const_cast<uint8_t *>(writeView.data()[C2PlanarLayout::PLANE_U]);
-    uint8_t *pVBuffer = const_cast<uint8_t *>(writeView.data()[C2PlanarLayout::PLANE_V]);
-
-    for (int i = 0; i < mHeight; ++i) {
-        memcpy(pYBuffer + i * dstYStride, img.data + i * mWidth, mWidth);
-    }
-    for (int i = 0; i < mHeight / 2; ++i) {
-        memcpy(pUBuffer + i * dstUVStride,
-               img.data + mWidth * mHeight + i * mWidth / 2, mWidth / 2);
-    }
-    for (int i = 0; i < mHeight / 2; ++i) {
-        memcpy(pVBuffer + i * dstUVStride,
-               img.data + mWidth * mHeight * 5 / 4 + i * mWidth / 2,
-               mWidth / 2);
-    }
+    copyYuv420PlanarToGraphicView(img.data, img.data + mWidth * mHeight,
+                                  img.data + mWidth * mHeight * 5 / 4, mWidth,
+                                  mHeight, &writeView);
 }
 
 uint64_t C2GoldfishHevcDec::getWorkIndex(uint64_t pts) {
@@ -919,7 +876,11 @@ void C2GoldfishHevcDec::process(const std::unique_ptr<C2Work> &work,
             }
 
             bool whChanged = false;
-            if (GoldfishHevcHelper::isVpsFrame(mInPBuffer, mInPBufferSize)) {
+            std::vector<uint8_t> parameterSets;
+            if (GoldfishHevcHelper::getParameterSets(
+                    mInPBuffer, mInPBufferSize, &parameterSets) &&
+                parameterSets != mParameterSets) {
+                mParameterSets = std::move(parameterSets);
                 mHevcHelper.reset(new GoldfishHevcHelper(mWidth, mHeight));
                 bool headerStatus = true;
                 whChanged = mHevcHelper->decodeHeader(
@@ -61,6 +61,8 @@ class C2GoldfishHevcDec : public SimpleC2Component {
   private:
     std::unique_ptr<MediaHevcDecoder> mContext;
     bool mEnableAndroidNativeBuffers{true};
+    // format of the output blocks, from getOutputPixelFormat()
+    uint32_t mOutputFormat{0};
 
     void checkMode(const std::shared_ptr<C2BlockPool> &pool);
     //    status_t createDecoder();
@@ -102,7 +104,6 @@ class C2GoldfishHevcDec : public SimpleC2Component {
     };
 
     std::shared_ptr<C2GraphicBlock> mOutBlock;
-    uint8_t *mOutBufferFlush;
 
     int mHostColorBufferId{-1};
 
@@ -158,6 +159,9 @@ class C2GoldfishHevcDec : public SimpleC2Component {
     void decodeHeaderAfterFlush();
 
     std::unique_ptr<GoldfishHevcHelper> mHevcHelper;
+    // parameter sets last decoded by the helper; frames that repeat them
+    // need no new helper
+    std::vector<uint8_t> mParameterSets;
 
     C2_DO_NOT_COPY(C2GoldfishHevcDec);
 };
@@ -18,6 +18,7 @@
 
 #define LOG_TAG "GoldfishHevcHelper"
 #include <log/log.h>
+#include <nal_unit_utils.h>
 
 #include "ihevc_typedefs.h"
 #include "ihevcd_cxa.h"
@@ -169,25 +170,62 @@ void GoldfishHevcHelper::setParams(size_t stride,
     }
 }
 
-bool GoldfishHevcHelper::isVpsFrame(const uint8_t* frame, int inSize) {
-    if (inSize < 5) return false;
-    if (frame[0] == 0 && frame[1] == 0 && frame[2] == 0 && frame[3] == 1) {
-        const bool forbiddenBitIsInvalid = 0x80 & frame[4];
+namespace {
+
+enum class NalKind { ParameterSet, Slice, Other };
+
+NalKind getNalKind(const uint8_t* nal) {
+    // nalu type is the lower 6 bits after shiftting to right 1 bit
+    uint8_t naluType = 0x3f & (nal[0] >> 1);
+    if (naluType < 32) return NalKind::Slice;
+    return naluType == 32 || naluType == 33 || naluType == 34 ? NalKind::ParameterSet : NalKind::Other;
+}
+
+// Calls |fn| with each parameter set unit ahead of the first slice of
+// |frame|; they have to come ahead of the slices that use them, so the
+// slice data is never scanned.
+template <typename Fn>
+void forEachParameterSet(const uint8_t* frame, int inSize, Fn fn) {
+    if (inSize < 5) return;
+    NalUnitScanner scanner(frame, inSize);
+    while (scanner.next()) {
+        const bool forbiddenBitIsInvalid = 0x80 & scanner.data()[0];
         if (forbiddenBitIsInvalid) {
-            return false;
+            continue;
+        }
+        NalKind kind = getNalKind(scanner.data());
+        if (kind == NalKind::Slice) {
+            return;
+        }
+        if (kind == NalKind::ParameterSet &&
+            !fn(scanner.data(), scanner.size())) {
+            return;
         }
-        // nalu type is the lower 6 bits after shiftting to right 1 bit
-        uint8_t naluType = 0x3f & (frame[4] >> 1);
-        if (naluType == 32
-            || naluType == 33
-            || naluType == 34
-                ) return true;
-        else return false;
-    } else {
-        return false;
     }
 }
 
+} // namespace
+
+bool GoldfishHevcHelper::isVpsFrame(const uint8_t* frame, int inSize) {
+    bool found = false;
+    forEachParameterSet(frame, inSize, [&](const uint8_t*, size_t) {
+        found = true;
+        return false;
+    });
+    return found;
+}
+
+bool GoldfishHevcHelper::getParameterSets(const uint8_t* frame, int inSize,
+                                          std::vector<uint8_t>* outParameterSets) {
+    outParameterSets->clear();
+    forEachParameterSet(frame, inSize, [&](const uint8_t* nal, size_t size) {
+        outParameterSets->insert(outParameterSets->end(), {0, 0, 1});
+        outParameterSets->insert(outParameterSets->end(), nal, nal + size);
+        return true;
+    });
+    return !outParameterSets->empty();
+}
+
 bool GoldfishHevcHelper::decodeHeader(const uint8_t *frame, int inSize,
                                       bool &helperstatus) {
     helperstatus = true;
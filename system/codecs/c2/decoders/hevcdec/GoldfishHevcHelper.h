@@ -18,6 +18,7 @@
 #define GOLDFISH_HEVC_HELPER_H_
 
 #include <inttypes.h>
+#include <vector>
 #include "ihevc_typedefs.h"
 #include "ihevcd_cxa.h"
 
@@ -31,9 +32,14 @@ class GoldfishHevcHelper {
     GoldfishHevcHelper(int w, int h);
     ~GoldfishHevcHelper();
 
-    // check whether the frame is vps; typical hevc will have
+    // check whether the frame has vps, sps or pps; typical hevc will have
     // a frame that is vps/sps/pps together
     static bool isVpsFrame(const uint8_t* frame, int inSize);
+    // copies the vps, sps and pps units of the frame, so that a frame that
+    // repeats the ones already seen need not be decoded again; returns
+    // false if there are none
+    static bool getParameterSets(const uint8_t* frame, int inSize,
+                                 std::vector<uint8_t>* outParameterSets);
   public:
     // return true if decoding finds out w/h changed;
     // otherwise false
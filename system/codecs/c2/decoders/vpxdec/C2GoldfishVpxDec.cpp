@@ -41,6 +41,7 @@
 #include <color_buffer_utils.h>
 
 #include "C2GoldfishVpxDec.h"
+#include "aemu/base/threads/AndroidThreadPolicy.h"
 
 #define DEBUG 0
 #if DEBUG
@@ -231,11 +232,26 @@ class C2GoldfishVpxDec::IntfImpl : public SimpleInterface<void>::BaseParams {
                 .withSetter(DefaultColorAspectsSetter)
                 .build());
 
-        // TODO: support more formats?
-        addParameter(DefineParam(mPixelFormat, C2_PARAMKEY_PIXEL_FORMAT)
-                         .withConstValue(new C2StreamPixelFormatInfo::output(
-                             0u, HAL_PIXEL_FORMAT_YCBCR_420_888))
-                         .build());
+        // RGBA has the host convert as it renders into the color buffers,
+        // see getOutputPixelFormat().
+        addParameter(
+            DefineParam(mPixelFormat, C2_PARAMKEY_PIXEL_FORMAT)
+                .withDefault(new C2StreamPixelFormatInfo::output(
+                    0u, HAL_PIXEL_FORMAT_YCBCR_420_888))
+                .withFields({C2F(mPixelFormat, value)
+                                 .oneOf({HAL_PIXEL_FORMAT_YCBCR_420_888,
+                                         HAL_PIXEL_FORMAT_RGBA_8888})})
+                .withSetter(
+                    Setter<decltype(*mPixelFormat)>::StrictValueWithNoDeps)
+                .build());
+
+        addParameter(
+            DefineParam(mLowLatencyMode, C2_PARAMKEY_LOW_LATENCY_MODE)
+                .withDefault(new C2GlobalLowLatencyModeTuning(0))
+                .withFields({C2F(mLowLatencyMode, value).oneOf({0, 1})})
+                .withSetter(
+                    Setter<decltype(*mLowLatencyMode)>::StrictValueWithNoDeps)
+                .build());
     }
 
     static C2R SizeSetter(bool mayBlock,
@@ -330,6 +346,10 @@ class C2GoldfishVpxDec::IntfImpl : public SimpleInterface<void>::BaseParams {
 
     int transfer() const { return mDefaultColorAspects->transfer; }
 
+    uint32_t pixelFormat() const { return mPixelFormat->value; }
+
+    bool lowLatencyMode() const { return mLowLatencyMode->value != 0; }
+
     static C2R Hdr10PlusInfoInputSetter(bool mayBlock,
                                         C2P<C2StreamHdr10PlusInfo::input> &me) {
         (void)mayBlock;
@@ -353,6 +373,7 @@ class C2GoldfishVpxDec::IntfImpl : public SimpleInterface<void>::BaseParams {
     std::shared_ptr<C2StreamColorInfo::output> mColorInfo;
     std::shared_ptr<C2StreamPixelFormatInfo::output> mPixelFormat;
     std::shared_ptr<C2StreamColorAspectsTuning::output> mDefaultColorAspects;
+    std::shared_ptr<C2GlobalLowLatencyModeTuning> mLowLatencyMode;
 #ifdef VP9
 #if 0
     std::shared_ptr<C2StreamHdrStaticInfo::output> mHdrStaticInfo;
@@ -366,6 +387,12 @@ C2GoldfishVpxDec::ConverterThread::ConverterThread(
     const std::shared_ptr<Mutexed<ConversionQueue>> &queue)
     : Thread(false), mQueue(queue) {}
 
+status_t C2GoldfishVpxDec::ConverterThread::readyToRun() {
+    android::base::guest::applyThreadPolicy(
+        android::base::guest::ThreadRole::Codec);
+    return OK;
+}
+
 bool C2GoldfishVpxDec::ConverterThread::threadLoop() {
     Mutexed<ConversionQueue>::Locked queue(*mQueue);
     if (queue->entries.empty()) {
@@ -512,6 +539,8 @@ void C2GoldfishVpxDec::checkContext(const std::shared_ptr<C2BlockPool> &pool) {
         DDD("decoding to guest byte buffer");
         mEnableAndroidNativeBuffers = false;
     }
+    mOutputFormat = getOutputPixelFormat(mIntf->pixelFormat(),
+                                         mEnableAndroidNativeBuffers);
 
     mCtx->version = mEnableAndroidNativeBuffers ? 200 : 100;
 
@@ -650,6 +679,11 @@ void C2GoldfishVpxDec::process(const std::unique_ptr<C2Work> &work,
     sendMetadata();
 
     if (inSize) {
+        // In low latency mode the frame is decoded by the vpx_codec_get_frame
+        // in outputBuffer(), which then takes a single host round trip.
+        if (mCtx) {
+            mCtx->lowLatency = mIntf->lowLatencyMode();
+        }
         uint8_t *bitstream = const_cast<uint8_t *>(rView.data() + inOffset);
         vpx_codec_err_t err = vpx_codec_decode(
             mCtx, bitstream, inSize, &work->input.ordinal.frameIndex, 0);
@@ -685,33 +719,6 @@ void C2GoldfishVpxDec::process(const std::unique_ptr<C2Work> &work,
     }
 }
 
-static void copyOutputBufferToYuvPlanarFrame(
-    uint8_t *dst, const uint8_t *srcY, const uint8_t *srcU, const uint8_t *srcV,
-    size_t srcYStride, size_t srcUStride, size_t srcVStride, size_t dstYStride,
-    size_t dstUVStride, uint32_t width, uint32_t height) {
-    uint8_t *dstStart = dst;
-
-    for (size_t i = 0; i < height; ++i) {
-        memcpy(dst, srcY, width);
-        srcY += srcYStride;
-        dst += dstYStride;
-    }
-
-    dst = dstStart + dstYStride * height;
-    for (size_t i = 0; i < height / 2; ++i) {
-        memcpy(dst, srcV, width / 2);
-        srcV += srcVStride;
-        dst += dstUVStride;
-    }
-
-    dst = dstStart + (dstYStride * height) + (dstUVStride * height / 2);
-    for (size_t i = 0; i < height / 2; ++i) {
-        memcpy(dst, srcU, width / 2);
-        srcU += srcUStride;
-        dst += dstUVStride;
-    }
-}
-
 void C2GoldfishVpxDec::setup_ctx_parameters(vpx_codec_ctx_t *ctx,
                                             int hostColorBufferId) {
     ctx->width = mWidth;
@@ -731,7 +738,7 @@ C2GoldfishVpxDec::outputBuffer(const std::shared_ptr<C2BlockPool> &pool,
 
     // now get the block
     std::shared_ptr<C2GraphicBlock> block;
-    uint32_t format = HAL_PIXEL_FORMAT_YCBCR_420_888;
+    uint32_t format = mOutputFormat;
     const C2MemoryUsage usage = {(uint64_t)(BufferUsage::VIDEO_DECODER),
                                  C2MemoryUsage::CPU_WRITE | C2MemoryUsage::CPU_READ};
 
@@ -746,10 +753,7 @@ C2GoldfishVpxDec::outputBuffer(const std::shared_ptr<C2BlockPool> &pool,
     int hostColorBufferId = -1;
     const bool decodingToHostColorBuffer = mEnableAndroidNativeBuffers;
     if(decodingToHostColorBuffer){
-        auto c2Handle = block->handle();
-        native_handle_t *grallocHandle =
-            UnwrapNativeCodec2GrallocHandle(c2Handle);
-        hostColorBufferId = getColorBufferHandle(grallocHandle);
+        hostColorBufferId = getColorBufferHandle(block);
         if (hostColorBufferId > 0) {
             DDD("found handle %d", hostColorBufferId);
         } else {
@@ -833,26 +837,15 @@ C2GoldfishVpxDec::outputBuffer(const std::shared_ptr<C2BlockPool> &pool,
             block->width(), block->height(), mWidth, mHeight,
             ((c2_cntr64_t *)img->user_priv)->peekll());
 
-        uint8_t *dst =
-            const_cast<uint8_t *>(wView.data()[C2PlanarLayout::PLANE_Y]);
-        size_t srcYStride = mWidth;
-        size_t srcUStride = mWidth / 2;
-        size_t srcVStride = mWidth / 2;
-        C2PlanarLayout layout = wView.layout();
-        size_t dstYStride = layout.planes[C2PlanarLayout::PLANE_Y].rowInc;
-        size_t dstUVStride = layout.planes[C2PlanarLayout::PLANE_U].rowInc;
-
         if (img->fmt == VPX_IMG_FMT_I42016) {
             ALOGW("WARNING: not I42016 is not supported !!!");
         } else if (1) {
+            CodecPerfStats::ScopedCopyTimer copyTimer(mPerfStats);
             const uint8_t *srcY = (const uint8_t *)mCtx->dst;
             const uint8_t *srcV = srcY + mWidth * mHeight;
             const uint8_t *srcU = srcV + mWidth * mHeight / 4;
-            // TODO: the following crashes
-            copyOutputBufferToYuvPlanarFrame(dst, srcY, srcU, srcV, srcYStride,
-                                             srcUStride, srcVStride, dstYStride,
-                                             dstUVStride, mWidth, mHeight);
-            // memcpy(dst, srcY, mWidth * mHeight / 2);
+            copyYuv420PlanarToGraphicView(srcY, srcU, srcV, mWidth, mHeight,
+                                          &wView);
         }
     }
     DDD("provided (%dx%d) required (%dx%d), out frameindex %lld",
@@ -53,6 +53,7 @@ struct C2GoldfishVpxDec : public SimpleC2Component {
         explicit ConverterThread(
             const std::shared_ptr<Mutexed<ConversionQueue>> &queue);
         ~ConverterThread() override = default;
+        status_t readyToRun() override;
         bool threadLoop() override;
 
       private:
@@ -65,6 +66,8 @@ struct C2GoldfishVpxDec : public SimpleC2Component {
     // color buffer id
     void checkContext(const std::shared_ptr<C2BlockPool> &pool);
     bool mEnableAndroidNativeBuffers{true};
+    // format of the output blocks, from getOutputPixelFormat()
+    uint32_t mOutputFormat{0};
 
     void setup_ctx_parameters(vpx_codec_ctx_t *ctx, int hostColorBufferId = -1);
 
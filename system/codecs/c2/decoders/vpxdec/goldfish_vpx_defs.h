@@ -52,6 +52,14 @@ struct vpx_codec_ctx_t {
     uint8_t *data;
     uint8_t *dst;
     vpx_image_t myImg;
+    // In low latency mode vpx_codec_decode only stages the frame and the
+    // next vpx_codec_get_frame decodes and returns it in one host call.
+    bool lowLatency = false;
+    bool hasPendingDecode = false;
+    unsigned int pendingDataSize = 0;
+    void *pendingUserPriv = nullptr;
+    // Set once the host turned out not to know DecodeAndGetImage.
+    bool fusedDecodeUnsupported = false;
 };
 
 int vpx_codec_destroy(vpx_codec_ctx_t *);
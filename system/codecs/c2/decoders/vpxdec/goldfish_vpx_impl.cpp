@@ -110,17 +110,20 @@ static void getVpxFrame(uint8_t *ptr, vpx_image_t &myImg) {
         (int)myImg.d_h, myImg.user_priv);
 }
 
-// TODO: we might not need to do the putting all the time
-vpx_image_t *vpx_codec_get_frame(vpx_codec_ctx_t *ctx, int hostColorBufferId) {
-    DDD("%s %d %p", __func__, __LINE__);
-    (void)hostColorBufferId;
-    if (!ctx) {
-        ALOGE("ERROR: Failed %s %d: ctx is nullptr", __func__, __LINE__);
-        return nullptr;
-    }
+static void writeDecodeParams(vpx_codec_ctx_t *ctx, unsigned int data_sz,
+                              void *user_priv, int first_param) {
     auto transport = GoldfishMediaTransport::getInstance();
+    transport->writeParam(transport->offsetOf((uint64_t)(ctx->data)) -
+                              ctx->address_offset,
+                          first_param, ctx->address_offset);
+    transport->writeParam((__u64)data_sz, first_param + 1,
+                          ctx->address_offset);
+    transport->writeParam((__u64)user_priv, first_param + 2,
+                          ctx->address_offset);
+}
 
-    transport->writeParam(ctx->id, 0, ctx->address_offset);
+static void writeGetImageParams(vpx_codec_ctx_t *ctx) {
+    auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam(ctx->outputBufferWidth, 1, ctx->address_offset);
     transport->writeParam(ctx->outputBufferHeight, 2, ctx->address_offset);
     transport->writeParam(ctx->width, 3, ctx->address_offset);
@@ -130,8 +133,63 @@ vpx_image_t *vpx_codec_get_frame(vpx_codec_ctx_t *ctx, int hostColorBufferId) {
     transport->writeParam(transport->offsetOf((uint64_t)(ctx->dst)) -
                               ctx->address_offset,
                           7, ctx->address_offset);
+}
 
-    sendVpxOperation(ctx, MediaOperation::GetImage);
+// Sends a frame staged by vpx_codec_decode in low latency mode as a plain
+// DecodeImage, for when it can not be fused with a GetImage.
+static void sendPendingDecode(vpx_codec_ctx_t *ctx) {
+    if (!ctx->hasPendingDecode) {
+        return;
+    }
+    ctx->hasPendingDecode = false;
+    auto transport = GoldfishMediaTransport::getInstance();
+    transport->writeParam(ctx->id, 0, ctx->address_offset);
+    writeDecodeParams(ctx, ctx->pendingDataSize, ctx->pendingUserPriv, 1);
+    sendVpxOperation(ctx, MediaOperation::DecodeImage);
+}
+
+// Never a return code of the host, so it tells that the host left the
+// return area alone because it does not know the operation.
+static constexpr int kNoReturnCode = 0x7fffffff;
+
+// Decodes the staged frame and gets the next image in one round trip.
+// Returns false if the host does not support that, in which case nothing
+// was decoded.
+static bool sendDecodeAndGetImage(vpx_codec_ctx_t *ctx) {
+    auto transport = GoldfishMediaTransport::getInstance();
+    transport->writeParam(ctx->id, 0, ctx->address_offset);
+    writeGetImageParams(ctx);
+    writeDecodeParams(ctx, ctx->pendingDataSize, ctx->pendingUserPriv, 8);
+
+    auto *retptr = transport->getReturnAddr(ctx->address_offset);
+    *(int *)retptr = kNoReturnCode;
+    sendVpxOperation(ctx, MediaOperation::DecodeAndGetImage);
+    if (getReturnCode(retptr) == kNoReturnCode) {
+        ALOGW("host does not support DecodeAndGetImage, "
+              "using separate DecodeImage and GetImage");
+        ctx->fusedDecodeUnsupported = true;
+        return false;
+    }
+    ctx->hasPendingDecode = false;
+    return true;
+}
+
+// TODO: we might not need to do the putting all the time
+vpx_image_t *vpx_codec_get_frame(vpx_codec_ctx_t *ctx, int hostColorBufferId) {
+    DDD("%s %d %p", __func__, __LINE__);
+    (void)hostColorBufferId;
+    if (!ctx) {
+        ALOGE("ERROR: Failed %s %d: ctx is nullptr", __func__, __LINE__);
+        return nullptr;
+    }
+    auto transport = GoldfishMediaTransport::getInstance();
+
+    if (!ctx->hasPendingDecode || !sendDecodeAndGetImage(ctx)) {
+        sendPendingDecode(ctx);
+        transport->writeParam(ctx->id, 0, ctx->address_offset);
+        writeGetImageParams(ctx);
+        sendVpxOperation(ctx, MediaOperation::GetImage);
+    }
 
     auto *retptr = transport->getReturnAddr(ctx->address_offset);
     int ret = getReturnCode(retptr);
@@ -144,6 +202,7 @@ vpx_image_t *vpx_codec_get_frame(vpx_codec_ctx_t *ctx, int hostColorBufferId) {
 
 void vpx_codec_send_metadata(vpx_codec_ctx_t *ctx, void *ptr) {
     MetaDataColorAspects& meta = *(MetaDataColorAspects*)ptr;
+    sendPendingDecode(ctx);
     auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam(ctx->id, 0, ctx->address_offset);
     transport->writeParam(meta.type, 1, ctx->address_offset);
@@ -159,6 +218,7 @@ int vpx_codec_flush(vpx_codec_ctx_t *ctx) {
         ALOGE("ERROR: Failed %s %d: ctx is nullptr", __func__, __LINE__);
         return -1;
     }
+    ctx->hasPendingDecode = false;
     auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam(ctx->id, 0, ctx->address_offset);
     sendVpxOperation(ctx, MediaOperation::Flush);
@@ -174,15 +234,21 @@ int vpx_codec_decode(vpx_codec_ctx_t *ctx, const uint8_t *data,
     (void)deadline;
     DDD("%s %d data size %d userpriv %p", __func__, __LINE__, (int)data_sz,
         user_priv);
-    auto transport = GoldfishMediaTransport::getInstance();
+    // The staged frame is still in the input area, so send it before
+    // overwriting it.
+    sendPendingDecode(ctx);
     memcpy(ctx->data, data, data_sz);
 
+    if (ctx->lowLatency && !ctx->fusedDecodeUnsupported) {
+        ctx->hasPendingDecode = true;
+        ctx->pendingDataSize = data_sz;
+        ctx->pendingUserPriv = user_priv;
+        return 0;
+    }
+
+    auto transport = GoldfishMediaTransport::getInstance();
     transport->writeParam(ctx->id, 0, ctx->address_offset);
-    transport->writeParam(transport->offsetOf((uint64_t)(ctx->data)) -
-                              ctx->address_offset,
-                          1, ctx->address_offset);
-    transport->writeParam((__u64)data_sz, 2, ctx->address_offset);
-    transport->writeParam((__u64)user_priv, 3, ctx->address_offset);
+    writeDecodeParams(ctx, data_sz, user_priv, 1);
     sendVpxOperation(ctx, MediaOperation::DecodeImage);
     return 0;
 }
@@ -15,9 +15,12 @@
 #
 LOCAL_PATH := $(call my-dir)
 
+# The host decoder is shared with the Codec2 decoder.
+c2AvcdecPath := ../../c2/decoders/avcdec
+
 commonSources := \
         GoldfishAVCDec.cpp  \
-        MediaH264Decoder.cpp
+        $(c2AvcdecPath)/MediaH264Decoder.cpp
 
 $(call emugl-begin-shared-library,libstagefright_goldfish_avcdec$(GOLDFISH_OPENGL_LIB_SUFFIX))
 
@@ -26,6 +29,8 @@ LOCAL_SRC_FILES := $(commonSources)
 LOCAL_CFLAGS += -DLOG_TAG=\"goldfish_avcdec\"
 LOCAL_CFLAGS += -Wno-unused-private-field
 
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/$(c2AvcdecPath)
+
 $(call emugl-export,SHARED_LIBRARIES,libcutils libutils liblog)
 
 LOCAL_HEADER_LIBRARIES := media_plugin_headers \
@@ -47,7 +52,8 @@ LOCAL_SHARED_LIBRARIES :=       \
         android.hardware.media.omx@1.0 \
 	    android.hardware.graphics.allocator@3.0 \
 		android.hardware.graphics.mapper@3.0 \
-        libstagefright_foundation
+        libstagefright_foundation \
+        libandroidemu
 
 LOCAL_HEADER_LIBRARIES += libgralloc_cb.ranchu
 
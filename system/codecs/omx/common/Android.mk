@@ -15,8 +15,11 @@
 #
 LOCAL_PATH := $(call my-dir)
 
+# The transport is shared with the Codec2 decoders.
+c2BasePath := ../../c2/decoders/base
+
 commonSources := \
-        goldfish_media_utils.cpp
+        $(c2BasePath)/goldfish_media_utils.cpp
 
 $(call emugl-begin-shared-library,libgoldfish_codecs_common$(GOLDFISH_OPENGL_LIB_SUFFIX))
 
@@ -27,7 +30,7 @@ LOCAL_CFLAGS += -Wno-unused-private-field
 
 $(call emugl-export,SHARED_LIBRARIES,libcutils libutils liblog)
 
-$(call emugl-export,C_INCLUDES,$(LOCAL_PATH))
+$(call emugl-export,C_INCLUDES,$(LOCAL_PATH)/$(c2BasePath)/include)
 
 ifeq (true,$(GOLDFISH_OPENGL_BUILD_FOR_HOST))
 $(call emugl-import,libGoldfishAddressSpace$(GOLDFISH_OPENGL_LIB_SUFFIX))
@@ -16,6 +16,9 @@
 
 #ifdef GFXSTREAM
 #include <atomic>
+#include <deque>
+#include <map>
+#include <tuple>
 #include <time.h>
 #endif
 
@@ -23,6 +26,8 @@
 
 #include "HostConnection.h"
 #include "ThreadInfo.h"
+#include "aemu/base/FlightRecorder.h"
+#include "aemu/base/MemoryAccounting.h"
 #include "aemu/base/threads/AndroidThread.h"
 #include "eglDisplay.h"
 #include "eglSync.h"
@@ -46,12 +51,15 @@
 
 #include "GLEncoder.h"
 #include "GL2Encoder.h"
+#include "ProgramLinkCache.h"
 
 #include <GLES3/gl31.h>
 
+#include <errno.h>
+#include <poll.h>
+
 #ifdef VIRTIO_GPU
 #include <xf86drm.h>
-#include <poll.h>
 
 #include "virtgpu_drm.h"
 
@@ -207,6 +215,134 @@ static std::set<EGLContext_t*> s_contexts_to_delete;
 
 #define EGL_TIMESTAMPS_ANDROID 0x314D
 
+// Dropping redundant state setters in GL2Encoder is on unless
+// ro.boot.qemu.gltransport.stateShadow is 0.
+static bool getStateShadowEnabledFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.stateShadow", value, "");
+    return value[0] != '0';
+}
+
+// Leaving eglSwapBuffers before the next buffer is dequeued is off unless
+// ro.boot.qemu.gltransport.deferredDequeue is 1.
+static bool getDeferredDequeueEnabledFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.deferredDequeue", value, "");
+    return value[0] == '1';
+}
+
+// The number of frames a window surface can have queued and not yet done on
+// the host, or 0 for no limit beyond what the BufferQueue imposes. Set per
+// process with debug.egl.framesInFlight.<process name>, or for every process
+// with ro.boot.qemu.gltransport.framesInFlight.
+static int getFramesInFlightFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+
+    char processName[PROPERTY_VALUE_MAX] = "";
+    FILE* cmdline = fopen("/proc/self/cmdline", "r");
+    if (cmdline) {
+        size_t len = fread(processName, 1, sizeof(processName) - 1, cmdline);
+        processName[len] = '\0';
+        fclose(cmdline);
+    }
+    if (processName[0]) {
+        char propName[PROPERTY_KEY_MAX + PROPERTY_VALUE_MAX];
+        snprintf(propName, sizeof(propName), "debug.egl.framesInFlight.%s", processName);
+        property_get(propName, value, "");
+    }
+    if (!value[0]) {
+        property_get("ro.boot.qemu.gltransport.framesInFlight", value, "");
+    }
+
+    int frames = atoi(value);
+    return frames > 0 ? frames : 0;
+}
+
+// Blocks until |fd| signals. Does not take ownership of |fd|.
+static void sWaitForFenceFd(int fd) {
+    struct pollfd fds = { .fd = fd, .events = POLLIN };
+    while (poll(&fds, 1, -1) < 0 && (errno == EINTR || errno == EAGAIN)) {
+    }
+}
+
+// Returns true if |fd| has signaled, without blocking.
+static bool sIsFenceFdSignaled(int fd) {
+    struct pollfd fds = { .fd = fd, .events = POLLIN };
+    int ret;
+    do {
+        ret = poll(&fds, 1, 0);
+    } while (ret < 0 && (errno == EINTR || errno == EAGAIN));
+    return ret > 0;
+}
+
+// Feeds the gpu.counters data source with what this thread's stream has
+// sent and waited for since its last frame.
+static void sReportFrameCounters(HostConnection* hostCon) {
+    IOStream* stream = hostCon->stream();
+    if (!stream) return;
+
+    struct StreamSnapshot {
+        IOStream* stream = nullptr;
+        uint64_t committedBytes = 0;
+        uint64_t flushCount = 0;
+        uint64_t readbackCount = 0;
+        uint64_t readbackNs = 0;
+    };
+    static thread_local StreamSnapshot last;
+    if (last.stream != stream) {
+        last = StreamSnapshot();
+        last.stream = stream;
+    }
+
+    uint64_t committedBytes = stream->committedBytes();
+    uint64_t flushCount = stream->flushCount();
+    uint64_t readbackCount = stream->readbackCount();
+    uint64_t readbackNs = stream->totalReadbackNs();
+
+    goldfish_perfetto_counter_add(GOLDFISH_GPU_COUNTER_ENCODED_BYTES,
+                                  committedBytes - last.committedBytes);
+    goldfish_perfetto_counter_add(GOLDFISH_GPU_COUNTER_FLUSHES,
+                                  flushCount - last.flushCount);
+    goldfish_perfetto_counter_add(GOLDFISH_GPU_COUNTER_ROUND_TRIPS,
+                                  readbackCount - last.readbackCount);
+    goldfish_perfetto_counter_add(GOLDFISH_GPU_COUNTER_ROUND_TRIP_NS,
+                                  readbackNs - last.readbackNs);
+    goldfish_perfetto_counter_add(GOLDFISH_GPU_COUNTER_FRAMES, 1);
+    goldfish_perfetto_counter_set(GOLDFISH_GPU_COUNTER_HOST_QUEUED_BYTES,
+                                  stream->hostQueuedBytes());
+
+    last.committedBytes = committedBytes;
+    last.flushCount = flushCount;
+    last.readbackCount = readbackCount;
+    last.readbackNs = readbackNs;
+}
+
+// Loading the GLES client libraries from eglGetDisplay, which the zygote
+// calls to preload the driver, is off unless
+// ro.boot.qemu.gltransport.preloadClientAPIs is 1.
+static bool getPreloadClientAPIsFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.preloadClientAPIs", value, "");
+    return value[0] == '1';
+}
+
+// Giving back transfer memory when a thread releases its context is off
+// unless ro.boot.qemu.gltransport.trimOnRelease is 1.
+static bool getTrimOnReleaseFromProperty() {
+    char value[PROPERTY_VALUE_MAX] = "";
+    property_get("ro.boot.qemu.gltransport.trimOnRelease", value, "");
+    return value[0] == '1';
+}
+
+// Dequeues the buffer a window surface current on this thread left for later
+// in eglSwapBuffers, so that its size and color buffer are up to date.
+static void sResolveDeferredDequeue() {
+    EGLThreadInfo* tInfo = getEGLThreadInfo();
+    if (tInfo && tInfo->hostConn) {
+        tInfo->hostConn->runBeforeNextGLCommand();
+    }
+}
+
 EGLContext_t::EGLContext_t(EGLDisplay dpy, EGLConfig config, EGLContext_t* shareCtx, int maj, int min) :
     dpy(dpy),
     config(config),
@@ -247,6 +383,7 @@ EGLContext_t::EGLContext_t(EGLDisplay dpy, EGLConfig config, EGLContext_t* share
 
     flags = 0;
     clientState = new GLClientState(majorVersion, minorVersion);
+    clientState->stateShadow().setEnabled(getStateShadowEnabledFromProperty());
      if (shareCtx)
         sharedGroup = shareCtx->getSharedGroup();
     else
@@ -285,6 +422,12 @@ EGLContext_t::~EGLContext_t()
     }
     assert(dpy == (EGLDisplay)&s_display);
     s_display.onDestroyContext((EGLContext)this);
+    for (int i = 0; i < GLStateShadow::EntryCount; ++i) {
+        GLStateShadow::Entry entry = static_cast<GLStateShadow::Entry>(i);
+        ALOGV("%s: context %p dropped %llu redundant %s calls", __func__, this,
+              (unsigned long long)clientState->stateShadow().droppedCalls(entry),
+              GLStateShadow::entryName(entry));
+    }
     delete clientState;
     delete [] versionString;
     delete [] vendorString;
@@ -481,10 +624,19 @@ private:
             EGLDisplay dpy, EGLConfig config, EGLint surfType,
             ANativeWindow* window);
     EGLBoolean init();
+    EGLBoolean dequeueNextBuffer(HostConnection* hostCon, bool waitForAcquireFence);
 
     ANativeWindow*              nativeWindow;
     android_native_buffer_t*    buffer;
     bool collectingTimestamps;
+    // Whether swapBuffers() leaves dequeueing the next buffer to the first
+    // GL command after it.
+    bool deferDequeue;
+    // The connection the deferred dequeue is set on, while one is pending.
+    HostConnection* dequeuePendingOn;
+    int maxFramesInFlight;
+    // Present fences of the frames in flight, oldest first.
+    std::deque<int> inFlightFenceFds;
 };
 
 egl_window_surface_t::egl_window_surface_t (
@@ -493,7 +645,10 @@ egl_window_surface_t::egl_window_surface_t (
 :   egl_surface_t(dpy, config, surfType),
     nativeWindow(window),
     buffer(NULL),
-    collectingTimestamps(false)
+    collectingTimestamps(false),
+    deferDequeue(getDeferredDequeueEnabledFromProperty()),
+    dequeuePendingOn(NULL),
+    maxFramesInFlight(getFramesInFlightFromProperty())
 {
     // keep a reference on the window
     nativeWindow->common.incRef(&nativeWindow->common);
@@ -553,6 +708,10 @@ egl_window_surface_t* egl_window_surface_t::create(
 }
 
 egl_window_surface_t::~egl_window_surface_t() {
+    if (dequeuePendingOn) {
+        dequeuePendingOn->clearBeforeNextGLCommand();
+    }
+
     DEFINE_HOST_CONNECTION;
     if (rcSurface && rcEnc) {
         rcEnc->rcDestroyWindowSurface(rcEnc, rcSurface);
@@ -561,6 +720,9 @@ egl_window_surface_t::~egl_window_surface_t() {
     if (buffer) {
         nativeWindow->cancelBuffer_DEPRECATED(nativeWindow, buffer);
     }
+    for (int fd : inFlightFenceFds) {
+        close(fd);
+    }
     nativeWindow->common.decRef(&nativeWindow->common);
 }
 
@@ -722,15 +884,45 @@ static void createGoldfishOpenGLNativeSync(int* fd_out) {
                      fd_out);
 }
 
+#ifdef GFXSTREAM
+// The guest time to hand to the host along with a command that is flushed
+// right after. A round trip first empties the stream, so the host handles
+// the command about half a round trip after the returned time.
+static uint64_t sGuestTimeAtHost(ExtendedRCEncoderContext* rcEnc) {
+    uint64_t start = currGuestTimeNs();
+    rcEnc->rcGetRendererVersion(rcEnc);
+    uint64_t end = currGuestTimeNs();
+    // Also the bound on the error of the host's clock offset.
+    atrace_int64(ATRACE_TAG_GRAPHICS, "gfxstreamClockSyncRttNs", (int64_t)(end - start));
+    return end + (end - start) / 2;
+}
+#endif
+
+// Each frame shows up as two async slices keyed by its frame number, the
+// one the host gets with rcFlushWindowColorBufferAsyncWithFrameNumber:
+// gfxstreamFrameEncode from the end of the previous swap to the start of
+// its own, and gfxstreamFrameSubmit from there until its commands are
+// flushed to the host. Host side traces pick up from the frame number.
 struct FrameTracingState {
     uint32_t frameNumber = 0;
     bool tracingEnabled = false;
+    void onSwapBuffersStart() {
+        atrace_async_end(ATRACE_TAG_GRAPHICS, "gfxstreamFrameEncode", (int32_t)frameNumber);
+        atrace_async_begin(ATRACE_TAG_GRAPHICS, "gfxstreamFrameSubmit", (int32_t)frameNumber);
+    }
+    // |submittedFrameNumber| is the frame that was just flushed.
+    void onSwapBuffersFlushed(uint32_t submittedFrameNumber) {
+        atrace_async_end(ATRACE_TAG_GRAPHICS, "gfxstreamFrameSubmit",
+                         (int32_t)submittedFrameNumber);
+        atrace_async_begin(ATRACE_TAG_GRAPHICS, "gfxstreamFrameEncode", (int32_t)frameNumber);
+    }
     void onSwapBuffersSuccesful(ExtendedRCEncoderContext* rcEnc) {
 #ifdef GFXSTREAM
         // edge trigger
         if (android::base::isTracingEnabled() && !tracingEnabled) {
             if (rcEnc->hasHostSideTracing()) {
-                rcEnc->rcSetTracingForPuid(rcEnc, getPuid(), 1, currGuestTimeNs());
+                rcEnc->rcSetTracingForPuid(rcEnc, getPuid(), 1, sGuestTimeAtHost(rcEnc));
+                rcEnc->m_stream->flush();
             }
         }
         if (!android::base::isTracingEnabled() && tracingEnabled) {
@@ -740,6 +932,7 @@ struct FrameTracingState {
         }
         tracingEnabled = android::base::isTracingEnabled();
 #endif
+        android::base::flightRecordFrameEnd(frameNumber);
         ++frameNumber;
     }
 };
@@ -795,20 +988,68 @@ EGLBoolean egl_window_surface_t::swapBuffers()
 
     int presentFenceFd = -1;
 
+    if (dequeuePendingOn) {
+        hostCon->runBeforeNextGLCommand();
+    }
+
     if (buffer == NULL) {
         ALOGE("egl_window_surface_t::swapBuffers called with NULL buffer");
         setErrorReturn(EGL_BAD_SURFACE, EGL_FALSE);
     }
 
+    // Hold frame N back until frame N - maxFramesInFlight is done on the
+    // host.
+    while (maxFramesInFlight > 0 &&
+           inFlightFenceFds.size() >= (size_t)maxFramesInFlight) {
+        int fd = inFlightFenceFds.front();
+        inFlightFenceFds.pop_front();
+        sWaitForFenceFd(fd);
+        close(fd);
+    }
+
     sFlushBufferAndCreateFence(
         hostCon, rcEnc, rcSurface,
         sFrameTracingState.frameNumber, &presentFenceFd);
 
+    // Without a fence the flush waited for the host already.
+    if (maxFramesInFlight > 0 && presentFenceFd >= 0) {
+        int fd = dup(presentFenceFd);
+        if (fd >= 0) {
+            inFlightFenceFds.push_back(fd);
+        }
+    }
+
     DPRINT("queueBuffer with fence %d", presentFenceFd);
     nativeWindow->queueBuffer(nativeWindow, buffer, presentFenceFd);
 
     appTimeMetric.onQueueBufferReturn();
 
+    if (deferDequeue) {
+        // Dequeueing can block until the consumer releases a buffer. Leave
+        // it to the first GL command of the next frame, which gives the
+        // app the time in between and the acquire fence time to signal.
+        buffer = NULL;
+        dequeuePendingOn = hostCon;
+        hostCon->setBeforeNextGLCommand([this, hostCon]() {
+            dequeuePendingOn = NULL;
+            dequeueNextBuffer(hostCon, true);
+        });
+    } else if (!dequeueNextBuffer(hostCon, false)) {
+        return EGL_FALSE;
+    }
+
+    sFrameTracingState.onSwapBuffersSuccesful(rcEnc);
+    appTimeMetric.onSwapBuffersReturn();
+
+    return EGL_TRUE;
+}
+
+EGLBoolean egl_window_surface_t::dequeueNextBuffer(HostConnection* hostCon,
+                                                   bool waitForAcquireFence)
+{
+    ExtendedRCEncoderContext* rcEnc = hostCon->rcEncoder();
+    auto* grallocHelper = hostCon->grallocHelper();
+
     DPRINT("calling dequeueBuffer...");
 
     int acquireFenceFd = -1;
@@ -820,6 +1061,11 @@ EGLBoolean egl_window_surface_t::swapBuffers()
     DPRINT("dequeueBuffer with fence %d", acquireFenceFd);
 
     if (acquireFenceFd > 0) {
+        // The host renders into the buffer as soon as the next GL command
+        // arrives, so it must not start before the consumer is done.
+        if (waitForAcquireFence) {
+            sWaitForFenceFd(acquireFenceFd);
+        }
         close(acquireFenceFd);
     }
 
@@ -829,9 +1075,6 @@ EGLBoolean egl_window_surface_t::swapBuffers()
     setWidth(buffer->width);
     setHeight(buffer->height);
 
-    sFrameTracingState.onSwapBuffersSuccesful(rcEnc);
-    appTimeMetric.onSwapBuffersReturn();
-
     return EGL_TRUE;
 }
 
@@ -957,6 +1200,12 @@ egl_pbuffer_surface_t* egl_pbuffer_surface_t::create(EGLDisplay dpy,
 // Required for Skia.
 static const char kOESEGLImageExternalEssl3[] = "GL_OES_EGL_image_external_essl3";
 
+// Implemented by GL2Encoder on top of ordinary host buffers.
+static const char kEXTBufferStorage[] = "GL_EXT_buffer_storage";
+
+// Implemented by GL2Encoder when it defers reading back program links.
+static const char kKHRParallelShaderCompile[] = "GL_KHR_parallel_shader_compile";
+
 static bool sWantES30OrAbove(const char* exts) {
     if (strstr(exts, kGLESMaxVersion_3_0) ||
         strstr(exts, kGLESMaxVersion_3_1) ||
@@ -966,6 +1215,43 @@ static bool sWantES30OrAbove(const char* exts) {
     return false;
 }
 
+// The host answers rcGetGLString for the version of the context current on
+// it, so each string is fetched once per process and version instead of
+// once per context.
+static std::mutex s_hostGLStrings_mutex;
+static std::map<std::tuple<int, int, int>, std::string> s_hostGLStrings;
+
+// Returns a copy of the host string for |glEnum| that the caller deletes, or
+// NULL if the host has none.
+static char* sGetHostGLString(ExtendedRCEncoderContext* rcEnc,
+                              const EGLContext_t* context, int glEnum) {
+    const auto key = std::make_tuple(context->majorVersion, context->minorVersion, glEnum);
+
+    std::lock_guard<std::mutex> lock(s_hostGLStrings_mutex);
+    auto it = s_hostGLStrings.find(key);
+    if (it == s_hostGLStrings.end()) {
+        char* hostStr = NULL;
+        int n = rcEnc->rcGetGLString(rcEnc, glEnum, NULL, 0);
+        if (n < 0) {
+            hostStr = new char[-n+1];
+            n = rcEnc->rcGetGLString(rcEnc, glEnum, hostStr, -n);
+            if (n <= 0) {
+                delete [] hostStr;
+                hostStr = NULL;
+            }
+        }
+        if (!hostStr) {
+            return NULL;
+        }
+        it = s_hostGLStrings.emplace(key, std::string(hostStr)).first;
+        delete [] hostStr;
+    }
+
+    char* res = new char[it->second.size() + 1];
+    memcpy(res, it->second.c_str(), it->second.size() + 1);
+    return res;
+}
+
 static std::vector<std::string> getExtStringArray() {
     std::vector<std::string> res;
 
@@ -982,16 +1268,7 @@ static std::vector<std::string> getExtStringArray() {
 
     DEFINE_AND_VALIDATE_HOST_CONNECTION(res);
 
-    char *hostStr = NULL;
-    int n = rcEnc->rcGetGLString(rcEnc, GL_EXTENSIONS, NULL, 0);
-    if (n < 0) {
-        hostStr = new char[-n+1];
-        n = rcEnc->rcGetGLString(rcEnc, GL_EXTENSIONS, hostStr, -n);
-        if (n <= 0) {
-            delete [] hostStr;
-            hostStr = NULL;
-        }
-    }
+    char *hostStr = sGetHostGLString(rcEnc, tInfo->currentContext, GL_EXTENSIONS);
 
     // push guest strings
     res.push_back("GL_EXT_robustness");
@@ -1007,6 +1284,16 @@ static std::vector<std::string> getExtStringArray() {
         res.push_back(kOESEGLImageExternalEssl3);
     }
 
+    if ((strstr(hostStr, kGLESMaxVersion_3_1) || strstr(hostStr, kGLESMaxVersion_3_2)) &&
+        !strstr(hostStr, kEXTBufferStorage)) {
+        res.push_back(kEXTBufferStorage);
+    }
+
+    if (hostCon->gl2Encoder()->deferProgramLinks() &&
+        !strstr(hostStr, kKHRParallelShaderCompile)) {
+        res.push_back(kKHRParallelShaderCompile);
+    }
+
     const int hostStrLen = strlen(hostStr);
     while (extEnd < hostStrLen) {
         if (hostStr[extEnd] == ' ') {
@@ -1092,15 +1379,7 @@ static const char *getGLString(int glEnum)
         // first query of that string - need to query host
         //
         DEFINE_AND_VALIDATE_HOST_CONNECTION(NULL);
-        int n = rcEnc->rcGetGLString(rcEnc, glEnum, NULL, 0);
-        if (n < 0) {
-            hostStr = new char[-n+1];
-            n = rcEnc->rcGetGLString(rcEnc, glEnum, hostStr, -n);
-            if (n <= 0) {
-                delete [] hostStr;
-                hostStr = NULL;
-            }
-        }
+        hostStr = sGetHostGLString(rcEnc, tInfo->currentContext, glEnum);
     }
 
     //
@@ -1128,6 +1407,13 @@ EGLDisplay eglGetDisplay(EGLNativeDisplayType display_id)
         return EGL_NO_DISPLAY;
     }
 
+    // Only work that does not involve the host is done here, so that forked
+    // children inherit it and open their own connections later.
+    static const bool sPreloadClientAPIs = getPreloadClientAPIsFromProperty();
+    if (sPreloadClientAPIs) {
+        s_display.loadClientAPIs(&s_eglIface);
+    }
+
     return (EGLDisplay)&s_display;
 }
 
@@ -1235,27 +1521,40 @@ EGLBoolean eglChooseConfig(EGLDisplay dpy, const EGLint *attrib_list, EGLConfig
         attrib_list = backup_attribs;
     }
 
-    uint32_t* tempConfigs[config_size];
-    DEFINE_AND_VALIDATE_HOST_CONNECTION(EGL_FALSE);
-    *num_config = rcEnc->rcChooseConfig(rcEnc, (EGLint*)attrib_list,
-            attribs_size * sizeof(EGLint), (uint32_t*)tempConfigs, config_size);
-
-    if (*num_config < 0) {
-        EGLint err = -(*num_config);
-        *num_config = 0;
-        switch (err) {
-            case EGL_BAD_ATTRIBUTE:
-                setErrorReturn(EGL_BAD_ATTRIBUTE, EGL_FALSE);
-            default:
-                return EGL_FALSE;
+    // The host is asked once per attribute list, for every config that
+    // matches, so later calls with a smaller config_size, or none, are
+    // answered from the same list.
+    std::vector<EGLint> attribs(attrib_list, attrib_list + attribs_size);
+    std::vector<uint32_t> chosen;
+    if (!s_display.findChosenConfigs(attribs, &chosen)) {
+        chosen.resize(s_display.getNumConfigs());
+        DEFINE_AND_VALIDATE_HOST_CONNECTION(EGL_FALSE);
+        EGLint numChosen = rcEnc->rcChooseConfig(rcEnc, attribs.data(),
+                attribs_size * sizeof(EGLint), chosen.data(), chosen.size());
+
+        if (numChosen < 0) {
+            EGLint err = -numChosen;
+            *num_config = 0;
+            switch (err) {
+                case EGL_BAD_ATTRIBUTE:
+                    setErrorReturn(EGL_BAD_ATTRIBUTE, EGL_FALSE);
+                default:
+                    return EGL_FALSE;
+            }
         }
+        if ((size_t)numChosen < chosen.size()) {
+            chosen.resize(numChosen);
+        }
+        s_display.addChosenConfigs(attribs, chosen);
     }
 
+    *num_config = chosen.size();
     if (configs!=NULL) {
-        EGLint i=0;
-        for (i=0;i<(*num_config);i++) {
-            EGLConfig guestConfig = s_display.getConfigAtIndex(*((uint32_t*)tempConfigs+i));
-            configs[i] = guestConfig;
+        if (*num_config > config_size) {
+            *num_config = config_size < 0 ? 0 : config_size;
+        }
+        for (EGLint i=0;i<(*num_config);i++) {
+            configs[i] = s_display.getConfigAtIndex(chosen[i]);
         }
     }
 
@@ -1429,9 +1728,11 @@ EGLBoolean eglQuerySurface(EGLDisplay dpy, EGLSurface eglSurface, EGLint attribu
             ret = s_display.getConfigAttrib(surface->config, EGL_CONFIG_ID, value);
             break;
         case EGL_WIDTH:
+            sResolveDeferredDequeue();
             *value = surface->getWidth();
             break;
         case EGL_HEIGHT:
+            sResolveDeferredDequeue();
             *value = surface->getHeight();
             break;
         case EGL_TEXTURE_FORMAT:
@@ -1916,6 +2217,9 @@ EGLBoolean eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLC
     // thread can suddenly jump in any eglMakeCurrent
     setTlsDestructor((tlsDtorCallback)s_eglReleaseThreadImpl);
 
+    // The surfaces being unbound may still owe a dequeue from eglSwapBuffers.
+    sResolveDeferredDequeue();
+
     if ((read == EGL_NO_SURFACE && draw == EGL_NO_SURFACE) && (ctx != EGL_NO_CONTEXT))
         setErrorReturn(EGL_BAD_MATCH, EGL_FALSE);
     if ((read != EGL_NO_SURFACE || draw != EGL_NO_SURFACE) && (ctx == EGL_NO_CONTEXT))
@@ -1958,6 +2262,11 @@ EGLBoolean eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLC
     }
 
     DEFINE_AND_VALIDATE_HOST_CONNECTION(EGL_FALSE);
+    // Links left pending on this thread's stream are read back while the
+    // share group they belong to is still the encoder's.
+    if (prevCtx && prevCtx->majorVersion > 1) {
+        hostCon->gl2Encoder()->resolvePendingProgramLinks();
+    }
     if (rcEnc->hasAsyncFrameCommands()) {
         rcEnc->rcMakeCurrentAsync(rcEnc, ctxHandle, drawHandle, readHandle);
     } else {
@@ -1988,7 +2297,6 @@ EGLBoolean eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLC
                   context, context->majorVersion, context->minorVersion, tInfo);
             s_display.gles2_iface()->init();
             hostCon->gl2Encoder()->setInitialized();
-            ClientAPIExts::initClientFuncs(s_display.gles2_iface(), 1);
         }
         if (contextState->needsInitFromCaps()) {
             // Need to set the version first if
@@ -2045,6 +2353,11 @@ EGLBoolean eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLC
             hostCon->glEncoder()->setSharedGroup(GLSharedGroupPtr(NULL));
         }
 
+        // A thread without a context usually stays idle for a while.
+        static const bool sTrimOnRelease = getTrimOnReleaseFromProperty();
+        if (sTrimOnRelease) {
+            hostCon->trimMemory();
+        }
     }
 
     // Delete the previous context here
@@ -2064,12 +2377,21 @@ EGLBoolean eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLC
             if (!hostCon->gl2Encoder()->isInitialized()) {
                 s_display.gles2_iface()->init();
                 hostCon->gl2Encoder()->setInitialized();
-                ClientAPIExts::initClientFuncs(s_display.gles2_iface(), 1);
             }
+            // Switching between contexts of the same version leaves the
+            // encoder's extension lists as they are.
             const char* exts = getGLString(GL_EXTENSIONS);
-            if (exts) {
+            if (exts && !hostCon->gl2Encoder()->reuseExtensions(exts)) {
                 hostCon->gl2Encoder()->setExtensions(exts, getExtStringArray());
             }
+            if (ProgramLinkCache::get().isEnabled()) {
+                const char* renderer = getGLString(GL_RENDERER);
+                const char* version = getGLString(GL_VERSION);
+                if (renderer && version) {
+                    hostCon->gl2Encoder()->setHostRendererId(
+                        std::string(renderer) + '\n' + version);
+                }
+            }
         }
         else {
             if (!hostCon->glEncoder()->isInitialized()) {
@@ -2078,7 +2400,6 @@ EGLBoolean eglMakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLC
                       context, context->majorVersion, context->minorVersion, tInfo);
                 s_display.gles_iface()->init();
                 hostCon->glEncoder()->setInitialized();
-                ClientAPIExts::initClientFuncs(s_display.gles_iface(), 0);
             }
         }
     }
@@ -2186,9 +2507,15 @@ EGLBoolean eglSwapBuffers(EGLDisplay dpy, EGLSurface eglSurface)
         setErrorReturn(EGL_BAD_DISPLAY, EGL_FALSE);
 
     // post the surface
+    uint32_t frameNumber = sFrameTracingState.frameNumber;
+    sFrameTracingState.onSwapBuffersStart();
     EGLBoolean ret = d->swapBuffers();
 
     hostCon->flush();
+    sFrameTracingState.onSwapBuffersFlushed(frameNumber);
+    hostCon->onFrameBoundary();
+    sReportFrameCounters(hostCon);
+    android::base::guest::reportGraphicsMemory();
     return ret;
 }
 
@@ -2243,6 +2570,10 @@ EGLImageKHR eglCreateImageKHR(EGLDisplay dpy, EGLContext ctx, EGLenum target, EG
         if (native_buffer->handle == NULL)
             setErrorReturn(EGL_BAD_PARAMETER, EGL_NO_IMAGE_KHR);
 
+        if (EGLImage_t* cached = s_display.findNativeBufferImage(native_buffer)) {
+            return (EGLImageKHR)cached;
+        }
+
         DEFINE_AND_VALIDATE_HOST_CONNECTION(EGL_FALSE);
         int format = grallocHelper->getFormat(native_buffer->handle);
         switch (format) {
@@ -2280,6 +2611,8 @@ EGLImageKHR eglCreateImageKHR(EGLDisplay dpy, EGLContext ctx, EGLenum target, EG
         image->native_buffer = native_buffer;
         image->width = native_buffer->width;
         image->height = native_buffer->width;
+        image->host_color_buffer = grallocHelper->getHostHandle(native_buffer->handle);
+        s_display.addNativeBufferImage(image);
 
         return (EGLImageKHR)image;
     }
@@ -2323,8 +2656,9 @@ EGLBoolean eglDestroyImageKHR(EGLDisplay dpy, EGLImageKHR img)
         if (native_buffer->common.version != sizeof(android_native_buffer_t))
             setErrorReturn(EGL_BAD_PARAMETER, EGL_FALSE);
 
-        native_buffer->common.decRef(&native_buffer->common);
-        delete image;
+        // The buffer reference goes with the image, once it is evicted.
+        if (!s_display.releaseNativeBufferImage(image))
+            setErrorReturn(EGL_BAD_PARAMETER, EGL_FALSE);
 
         return EGL_TRUE;
     }
@@ -2503,15 +2837,32 @@ EGLint eglClientWaitSyncKHR(EGLDisplay dpy, EGLSyncKHR eglsync, EGLint flags,
     DPRINT("sync=0x%lx (handle=0x%lx) flags=0x%x timeout=0x%llx",
            sync, sync->handle, flags, timeout);
 
+    // A sync that signaled stays signaled, and a native fence fd tells
+    // whether it signaled without asking the host.
+    if (sync->status != EGL_UNSIGNALED_KHR) {
+        return EGL_CONDITION_SATISFIED_KHR;
+    }
+    bool signaledLocally = false;
+    if (sync->android_native_fence_fd > 0) {
+        signaledLocally = sIsFenceFdSignaled(sync->android_native_fence_fd);
+        if (!signaledLocally && timeout == 0) {
+            return EGL_TIMEOUT_EXPIRED_KHR;
+        }
+    }
+
     DEFINE_HOST_CONNECTION;
 
     EGLint retval;
-    if (rcEnc->hasVirtioGpuNativeSync() || rcEnc->hasNativeSync()) {
+    if (!signaledLocally &&
+        (rcEnc->hasVirtioGpuNativeSync() || rcEnc->hasNativeSync())) {
         retval = rcEnc->rcClientWaitSyncKHR
             (rcEnc, sync->handle, flags, timeout);
     } else {
         retval = EGL_CONDITION_SATISFIED_KHR;
     }
+    if (retval != EGL_CONDITION_SATISFIED_KHR) {
+        return retval;
+    }
     EGLint res_status;
     switch (sync->type) {
         case EGL_SYNC_FENCE_KHR:
@@ -2550,6 +2901,12 @@ EGLBoolean eglGetSyncAttribKHR(EGLDisplay dpy, EGLSyncKHR eglsync,
         if (sync->status == EGL_SIGNALED_KHR) {
             *value = sync->status;
             return EGL_TRUE;
+        } else if (sync->android_native_fence_fd > 0) {
+            if (sIsFenceFdSignaled(sync->android_native_fence_fd)) {
+                sync->status = EGL_SIGNALED_KHR;
+            }
+            *value = sync->status;
+            return EGL_TRUE;
         } else {
             // ask the host again
             DEFINE_HOST_CONNECTION;
@@ -2584,6 +2941,23 @@ int eglDupNativeFenceFDANDROID(EGLDisplay dpy, EGLSyncKHR eglsync) {
     }
 }
 
+void eglSetBlobCacheFuncsANDROID(EGLDisplay dpy, EGLSetBlobFuncANDROID set,
+                                 EGLGetBlobFuncANDROID get) {
+    if (dpy != (EGLDisplay)&s_display) {
+        getEGLThreadInfo()->eglError = EGL_BAD_DISPLAY;
+        return;
+    }
+
+    // The platform hands over its storage once per process.
+    static std::atomic<bool> sBlobFuncsSet(false);
+    if (!set || !get || sBlobFuncsSet.exchange(true)) {
+        getEGLThreadInfo()->eglError = EGL_BAD_PARAMETER;
+        return;
+    }
+
+    ProgramLinkCache::get().setBlobFuncs(set, get);
+}
+
 EGLint eglWaitSyncKHR(EGLDisplay dpy, EGLSyncKHR eglsync, EGLint flags) {
     (void)dpy;
 
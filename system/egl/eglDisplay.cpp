@@ -14,6 +14,7 @@
 * limitations under the License.
 */
 #include "eglDisplay.h"
+#include "ClientAPIExts.h"
 #include "HostConnection.h"
 #include "KeyedVectorUtils.h"
 
@@ -35,6 +36,7 @@ static const char systemEGLVendor[] = "Google Android emulator";
 // list of extensions supported by this EGL implementation
 //  NOTE that each extension name should be suffixed with space
 static const char systemStaticEGLExtensions[] =
+            "EGL_ANDROID_blob_cache "
             "EGL_ANDROID_image_native_buffer "
             "EGL_KHR_fence_sync "
             "EGL_KHR_image_base "
@@ -64,6 +66,7 @@ static void __attribute__ ((destructor)) do_on_unload(void)
 
 eglDisplay::eglDisplay() :
     m_initialized(false),
+    m_clientAPIsLoaded(false),
     m_major(0),
     m_minor(0),
     m_hostRendererVersion(0),
@@ -82,6 +85,8 @@ eglDisplay::eglDisplay() :
     pthread_mutex_init(&m_lock, NULL);
     pthread_mutex_init(&m_ctxLock, NULL);
     pthread_mutex_init(&m_surfaceLock, NULL);
+    pthread_mutex_init(&m_imageLock, NULL);
+    pthread_mutex_init(&m_chosenConfigsLock, NULL);
 }
 
 eglDisplay::~eglDisplay()
@@ -90,31 +95,59 @@ eglDisplay::~eglDisplay()
     pthread_mutex_destroy(&m_lock);
     pthread_mutex_destroy(&m_ctxLock);
     pthread_mutex_destroy(&m_surfaceLock);
+    pthread_mutex_destroy(&m_imageLock);
+    pthread_mutex_destroy(&m_chosenConfigsLock);
 }
 
 
 
+bool eglDisplay::loadClientAPIs(EGLClient_eglInterface *eglIface)
+{
+    pthread_mutex_lock(&m_lock);
+    bool loaded = loadClientAPIsLocked(eglIface);
+    pthread_mutex_unlock(&m_lock);
+    return loaded;
+}
+
+bool eglDisplay::loadClientAPIsLocked(EGLClient_eglInterface *eglIface)
+{
+    if (m_clientAPIsLoaded) {
+        return true;
+    }
+
+    //
+    // load GLES client API
+    //
+    m_gles_iface = loadGLESClientAPI("libGLESv1_CM_emulation",
+                                     eglIface,
+                                     &s_gles_lib);
+    if (!m_gles_iface) {
+        ALOGE("Failed to load gles1 iface");
+        return false;
+    }
+    ClientAPIExts::initClientFuncs(m_gles_iface, 0);
+
+    m_gles2_iface = loadGLESClientAPI("libGLESv2_emulation",
+                                      eglIface,
+                                      &s_gles2_lib);
+    if (m_gles2_iface) {
+        ClientAPIExts::initClientFuncs(m_gles2_iface, 1);
+    }
+
+    m_clientAPIsLoaded = true;
+    return true;
+}
+
 bool eglDisplay::initialize(EGLClient_eglInterface *eglIface)
 {
     pthread_mutex_lock(&m_lock);
     if (!m_initialized) {
 
-        //
-        // load GLES client API
-        //
-        m_gles_iface = loadGLESClientAPI("libGLESv1_CM_emulation",
-                                         eglIface,
-                                         &s_gles_lib);
-        if (!m_gles_iface) {
+        if (!loadClientAPIsLocked(eglIface)) {
             pthread_mutex_unlock(&m_lock);
-            ALOGE("Failed to load gles1 iface");
             return false;
         }
 
-        m_gles2_iface = loadGLESClientAPI("libGLESv2_emulation",
-                                          eglIface,
-                                          &s_gles2_lib);
-
         //
         // establish connection with the host
         //
@@ -232,10 +265,26 @@ void eglDisplay::terminate()
             surfaceIte ++;
             eglDestroySurface(static_cast<EGLDisplay>(this), *surfaceToDelete);
         }
+
+        // Images still referenced are the application's to destroy, as
+        // before; only the idle ones go.
+        std::list<EGLImage_t*> idleImages;
+        pthread_mutex_lock(&m_imageLock);
+        idleImages.swap(m_idleNativeBufferImages);
+        for (EGLImage_t* image : idleImages) {
+            m_nativeBufferImages.erase(image->native_buffer);
+        }
+        pthread_mutex_unlock(&m_imageLock);
+        freeNativeBufferImages(idleImages);
+
         m_initialized = false;
         delete [] m_configs;
         m_configs = NULL;
 
+        pthread_mutex_lock(&m_chosenConfigsLock);
+        m_chosenConfigs.clear();
+        pthread_mutex_unlock(&m_chosenConfigsLock);
+
         if (m_versionString) {
             free(m_versionString);
             m_versionString = NULL;
@@ -653,6 +702,88 @@ bool eglDisplay::isSurface(EGLSurface surface) {
     return res;
 }
 
+// Idle images each keep a buffer alive, so only a few are kept.
+static const size_t kMaxIdleNativeBufferImages = 8;
+
+EGLImage_t* eglDisplay::findNativeBufferImage(android_native_buffer_t* buffer) {
+    pthread_mutex_lock(&m_imageLock);
+    EGLImage_t* image = NULL;
+    std::map<android_native_buffer_t*, EGLImage_t*>::iterator it =
+        m_nativeBufferImages.find(buffer);
+    if (it != m_nativeBufferImages.end()) {
+        image = it->second;
+        if (image->refcount++ == 0) {
+            m_idleNativeBufferImages.remove(image);
+        }
+    }
+    pthread_mutex_unlock(&m_imageLock);
+    return image;
+}
+
+void eglDisplay::addNativeBufferImage(EGLImage_t* image) {
+    image->refcount = 1;
+    pthread_mutex_lock(&m_imageLock);
+    m_nativeBufferImages[image->native_buffer] = image;
+    pthread_mutex_unlock(&m_imageLock);
+}
+
+bool eglDisplay::releaseNativeBufferImage(EGLImage_t* image) {
+    std::list<EGLImage_t*> evicted;
+    pthread_mutex_lock(&m_imageLock);
+    if (image->refcount <= 0) {
+        pthread_mutex_unlock(&m_imageLock);
+        return false;
+    }
+    if (--image->refcount == 0) {
+        m_idleNativeBufferImages.push_back(image);
+        if (m_idleNativeBufferImages.size() > kMaxIdleNativeBufferImages) {
+            EGLImage_t* oldest = m_idleNativeBufferImages.front();
+            m_idleNativeBufferImages.pop_front();
+            m_nativeBufferImages.erase(oldest->native_buffer);
+            evicted.push_back(oldest);
+        }
+    }
+    pthread_mutex_unlock(&m_imageLock);
+    // The last reference on a buffer frees it, which is best done unlocked.
+    freeNativeBufferImages(evicted);
+    return true;
+}
+
+void eglDisplay::freeNativeBufferImages(const std::list<EGLImage_t*>& images) {
+    for (EGLImage_t* image : images) {
+        android_native_buffer_t* native_buffer = image->native_buffer;
+        native_buffer->common.decRef(&native_buffer->common);
+        delete image;
+    }
+}
+
+// Applications building attribute lists on the fly could otherwise grow
+// the map without bound.
+static const size_t kMaxChosenConfigLists = 64;
+
+bool eglDisplay::findChosenConfigs(const std::vector<EGLint>& attribs,
+                                   std::vector<uint32_t>* configs) {
+    pthread_mutex_lock(&m_chosenConfigsLock);
+    std::map<std::vector<EGLint>, std::vector<uint32_t> >::const_iterator it =
+        m_chosenConfigs.find(attribs);
+    const bool found = it != m_chosenConfigs.end();
+    if (found) {
+        *configs = it->second;
+    }
+    pthread_mutex_unlock(&m_chosenConfigsLock);
+    return found;
+}
+
+void eglDisplay::addChosenConfigs(const std::vector<EGLint>& attribs,
+                                  const std::vector<uint32_t>& configs) {
+    pthread_mutex_lock(&m_chosenConfigsLock);
+    if (m_chosenConfigs.size() >= kMaxChosenConfigLists) {
+        m_chosenConfigs.clear();
+    }
+    m_chosenConfigs[attribs] = configs;
+    pthread_mutex_unlock(&m_chosenConfigsLock);
+}
+
 HostDriverCaps eglDisplay::getHostDriverCaps(int majorVersion, int minorVersion) {
     pthread_mutex_lock(&m_lock);
     if (majorVersion <= m_hostDriverCaps_knownMajorVersion &&
@@ -23,6 +23,7 @@
 #include <EGL/eglext.h>
 #include "EGLClientIface.h"
 #include "GLClientState.h"
+#include "EGLImage.h"
 
 #if __cplusplus >= 201103L
 #include <unordered_set>
@@ -30,7 +31,9 @@
 #include <hash_set>
 #endif
 
+#include <list>
 #include <map>
+#include <vector>
 
 #define ATTRIBUTE_NONE (-1)
 //FIXME: are we in this namespace?
@@ -45,6 +48,10 @@ public:
     bool initialize(EGLClient_eglInterface *eglIface);
     void terminate();
 
+    // Loads the GLES client libraries and fills the ClientAPIExts tables.
+    // None of it talks to the host, so a zygote can do it before it forks.
+    bool loadClientAPIs(EGLClient_eglInterface *eglIface);
+
     int getVersionMajor() const { return m_major; }
     int getVersionMinor() const { return m_minor; }
     bool initialized() const { return m_initialized; }
@@ -76,20 +83,44 @@ public:
     bool isContext(EGLContext ctx);
     bool isSurface(EGLSurface ctx);
 
+    // Images of native buffers are shared by every eglCreateImageKHR of the
+    // same buffer, and a few are kept after their last destroy, as
+    // compositors and video paths make and drop images of the same buffers
+    // every frame. Returns the image of |buffer| with a reference added, or
+    // NULL if there is none.
+    EGLImage_t* findNativeBufferImage(android_native_buffer_t* buffer);
+    // Takes |image|, with one reference and a reference on its buffer.
+    void addNativeBufferImage(EGLImage_t* image);
+    // Returns false if |image| has no references left to drop.
+    bool releaseNativeBufferImage(EGLImage_t* image);
+
+    // The configs table does not change after initialize(), so neither does
+    // what the host picks for a given attribute list, and toolkits choose
+    // with the same few lists for every surface and context they create.
+    // Returns false if |attribs|, EGL_NONE terminated, was not chosen yet;
+    // otherwise *|configs| gets every config the host matched, best first.
+    bool findChosenConfigs(const std::vector<EGLint>& attribs,
+                           std::vector<uint32_t>* configs);
+    void addChosenConfigs(const std::vector<EGLint>& attribs,
+                          const std::vector<uint32_t>& configs);
+
     // Needs a current context (put this near eglMakeCurrent)
     HostDriverCaps getHostDriverCaps(int majorVersion, int minorVersion);
 
 private:
+    bool loadClientAPIsLocked(EGLClient_eglInterface *eglIface);
     EGLClient_glesInterface *loadGLESClientAPI(const char *libName,
                                                EGLClient_eglInterface *eglIface,
                                                void **libHandle);
     EGLBoolean getAttribValue(EGLConfig config, EGLint attribIdxi, EGLint * value);
     EGLBoolean setAttribValue(EGLConfig config, EGLint attribIdxi, EGLint value);
     void     processConfigs();
+    void     freeNativeBufferImages(const std::list<EGLImage_t*>& images);
 
 private:
     pthread_mutex_t m_lock;
     bool m_initialized;
+    bool m_clientAPIsLoaded;
     int  m_major;
     int  m_minor;
     int  m_hostRendererVersion;
@@ -122,6 +153,14 @@ private:
     pthread_mutex_t m_ctxLock;
     pthread_mutex_t m_surfaceLock;
 
+    std::map<android_native_buffer_t*, EGLImage_t*> m_nativeBufferImages;
+    // Images without references, oldest first.
+    std::list<EGLImage_t*> m_idleNativeBufferImages;
+    pthread_mutex_t m_imageLock;
+
+    std::map<std::vector<EGLint>, std::vector<uint32_t> > m_chosenConfigs;
+    pthread_mutex_t m_chosenConfigsLock;
+
     int m_hostDriverCaps_knownMajorVersion;
     int m_hostDriverCaps_knownMinorVersion;
     HostDriverCaps m_hostDriverCaps;
@@ -0,0 +1,53 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "AllocationCounter.h"
+
+#include <stdlib.h>
+
+#include <new>
+
+namespace {
+
+thread_local uint64_t tAllocationCount = 0;
+
+void* countedAlloc(size_t size) {
+    ++tAllocationCount;
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr) {
+        // Benchmarks build without exceptions.
+        abort();
+    }
+    return ptr;
+}
+
+}  // namespace
+
+uint64_t threadAllocationCount() { return tAllocationCount; }
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    ++tAllocationCount;
+    return malloc(size ? size : 1);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    ++tAllocationCount;
+    return malloc(size ? size : 1);
+}
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
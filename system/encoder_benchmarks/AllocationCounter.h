@@ -0,0 +1,34 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+
+// Heap allocations made through operator new by the calling thread so far.
+// AllocationCounter.cpp replaces the global operator new to count them.
+uint64_t threadAllocationCount();
+
+// Reports allocations per iteration for a benchmark loop, given the count
+// before the loop. With |expectNone| the benchmark fails if the loop
+// allocated, which keeps steady state hot paths allocation free.
+inline void reportAllocationCounters(benchmark::State& state, uint64_t allocationsBefore,
+                                     bool expectNone = false) {
+    const uint64_t allocations = threadAllocationCount() - allocationsBefore;
+    state.counters["allocs/iter"] =
+        benchmark::Counter(double(allocations) / double(state.iterations()));
+    if (expectNone && allocations > 0) {
+        state.SkipWithError("steady state loop allocated from the heap");
+    }
+}
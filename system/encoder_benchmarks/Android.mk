@@ -0,0 +1,29 @@
+LOCAL_PATH:= $(call my-dir)
+include $(CLEAR_VARS)
+LOCAL_MODULE := EncoderBenchmarks
+
+$(call emugl-import,libGLESv1_enc libGLESv2_enc lib_renderControl_enc)
+
+LOCAL_C_INCLUDES += \
+    $(EMUGL_COMMON_INCLUDES) \
+    device/generic/goldfish-opengl/host/include/libOpenglRender \
+
+LOCAL_SRC_FILES:= \
+    AllocationCounter.cpp \
+    GLEncoder_benchmark.cpp \
+    renderControl_benchmark.cpp \
+    main.cpp \
+
+ifeq (true,$(GFXSTREAM))
+$(call emugl-import,libvulkan_enc)
+LOCAL_C_INCLUDES += external/gfxstream-protocols/include/vulkan/include/
+LOCAL_SRC_FILES += VkEncoder_benchmark.cpp
+endif
+
+LOCAL_VENDOR_MODULE := true
+LOCAL_MODULE_TAGS := tests
+
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/../../LICENSE
+include $(BUILD_NATIVE_BENCHMARK)
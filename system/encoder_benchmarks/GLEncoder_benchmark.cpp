@@ -0,0 +1,307 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <GLES3/gl3.h>
+#include <benchmark/benchmark.h>
+
+#include "AllocationCounter.h"
+#include "ChecksumCalculator.h"
+#include "GL2Encoder.h"
+#include "GLClientState.h"
+#include "GLEncoder.h"
+#include "GLSharedGroup.h"
+#include "LockCounters.h"
+#include "NullStream.h"
+
+#include <vector>
+
+namespace {
+
+HostDriverCaps makeCaps() {
+    HostDriverCaps caps = {};
+    caps.max_vertex_attribs = 16;
+    caps.max_combined_texture_image_units = 32;
+    caps.max_color_attachments = 8;
+    caps.max_texture_size = 4096;
+    caps.max_texture_size_cube_map = 4096;
+    caps.max_renderbuffer_size = 4096;
+    caps.max_draw_buffers = 8;
+    caps.ubo_offset_alignment = 256;
+    caps.max_uniform_buffer_bindings = 24;
+    caps.max_transform_feedback_separate_attribs = 4;
+    caps.max_texture_size_3d = 2048;
+    caps.max_array_texture_layers = 256;
+    return caps;
+}
+
+// A GLES 3.0, or |minor|, context made current on a GL2Encoder writing to
+// a NullStream, in |sharedGroup| or a group of its own.
+struct GL2Context {
+    explicit GL2Context(int minor = 0, GLSharedGroupPtr sharedGroup = nullptr)
+        : state(3, minor),
+          shared(sharedGroup ? sharedGroup : GLSharedGroupPtr(new GLSharedGroup())),
+          encoder(&stream, &checksum) {
+        // Queried limits come back as 4096.
+        stream.setReadbackWord(4096);
+        encoder.setVersion(3, minor, 3, minor);
+        encoder.setClientState(&state);
+        state.initFromCaps(makeCaps());
+        encoder.setClientStateMakeCurrent(&state, 3, minor, 3, minor);
+        encoder.setSharedGroup(shared);
+        encoder.setInitialized();
+    }
+
+    NullStream stream;
+    ChecksumCalculator checksum;
+    GLClientState state;
+    GLSharedGroupPtr shared;
+    GL2Encoder encoder;
+};
+
+// A GLES 1.1 context made current on a GLEncoder writing to a NullStream.
+struct GLContext {
+    GLContext() : state(1, 1), shared(new GLSharedGroup()), encoder(&stream, &checksum) {
+        stream.setReadbackWord(4096);
+        state.initFromCaps(makeCaps());
+        encoder.setClientState(&state);
+        encoder.setSharedGroup(shared);
+        encoder.setInitialized();
+    }
+
+    NullStream stream;
+    ChecksumCalculator checksum;
+    GLClientState state;
+    GLSharedGroupPtr shared;
+    GLEncoder encoder;
+};
+
+// Draw calls sourcing a client side vertex array of state.range(0)
+// vertices, which each draw has to stream to the host.
+void BM_GL2DrawArraysClientArray(benchmark::State& state) {
+    GL2Context ctx;
+    GL2Encoder* enc = &ctx.encoder;
+    const GLsizei vertexCount = state.range(0);
+    std::vector<float> vertices(vertexCount * 4, 0.5f);
+
+    enc->glEnableVertexAttribArray(enc, 0);
+    enc->glVertexAttribPointer(enc, 0, 4, GL_FLOAT, GL_FALSE, 0, vertices.data());
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    const uint64_t allocationsBefore = threadAllocationCount();
+    for (auto _ : state) {
+        enc->glDrawArrays(enc, GL_TRIANGLES, 0, vertexCount);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+    reportAllocationCounters(state, allocationsBefore);
+}
+BENCHMARK(BM_GL2DrawArraysClientArray)->Arg(3)->Arg(64)->Arg(1024);
+
+// Draw calls with no vertex arrays enabled, i.e. the fixed cost of a draw
+// including validation and flush policy.
+void BM_GL2DrawArraysNoArrays(benchmark::State& state) {
+    GL2Context ctx;
+    GL2Encoder* enc = &ctx.encoder;
+
+    // The first draw sets up scratch state that later draws reuse.
+    enc->glDrawArrays(enc, GL_TRIANGLES, 0, 3);
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    const uint64_t allocationsBefore = threadAllocationCount();
+    for (auto _ : state) {
+        enc->glDrawArrays(enc, GL_TRIANGLES, 0, 3);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+    reportAllocationCounters(state, allocationsBefore, true /* expectNone */);
+}
+BENCHMARK(BM_GL2DrawArraysNoArrays);
+
+// A state change and uniform update between draws, as a typical sprite or
+// UI renderer issues them.
+void BM_GL2DrawLoop(benchmark::State& state) {
+    GL2Context ctx;
+    GL2Encoder* enc = &ctx.encoder;
+    const float color[4] = {1.0f, 0.5f, 0.25f, 1.0f};
+
+    enc->glDrawArrays(enc, GL_TRIANGLE_STRIP, 0, 4);
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    const uint64_t allocationsBefore = threadAllocationCount();
+    for (auto _ : state) {
+        enc->glBindTexture(enc, GL_TEXTURE_2D, 0);
+        enc->glUniform4fv(enc, 0, 1, color);
+        enc->glDrawArrays(enc, GL_TRIANGLE_STRIP, 0, 4);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore, 3);
+    reportAllocationCounters(state, allocationsBefore, true /* expectNone */);
+}
+BENCHMARK(BM_GL2DrawLoop);
+
+// Indirect draws from a buffer of state.range(0) commands, as GPU-driven
+// renderers issue them. The commands and indices stay on the host, so the
+// cost per draw does not grow with the buffers.
+void BM_GL2DrawElementsIndirect(benchmark::State& state) {
+    GL2Context ctx(1);
+    GL2Encoder* enc = &ctx.encoder;
+    const GLsizei commandCount = state.range(0);
+    const GLsizeiptr commandSize = 5 * sizeof(GLuint);
+
+    GLuint vao;
+    GLuint buffers[2];
+    enc->glGenVertexArrays(enc, 1, &vao);
+    enc->glBindVertexArray(enc, vao);
+    enc->glGenBuffers(enc, 2, buffers);
+    enc->glBindBuffer(enc, GL_ELEMENT_ARRAY_BUFFER, buffers[0]);
+    enc->glBufferData(enc, GL_ELEMENT_ARRAY_BUFFER, commandCount * 6 * sizeof(GLushort),
+                      nullptr, GL_STATIC_DRAW);
+    enc->glBindBuffer(enc, GL_DRAW_INDIRECT_BUFFER, buffers[1]);
+    enc->glBufferData(enc, GL_DRAW_INDIRECT_BUFFER, commandCount * commandSize, nullptr,
+                      GL_STATIC_DRAW);
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    const uint64_t allocationsBefore = threadAllocationCount();
+    GLsizei command = 0;
+    for (auto _ : state) {
+        enc->glDrawElementsIndirect(enc, GL_TRIANGLES, GL_UNSIGNED_SHORT,
+                                    (const void*)(uintptr_t)(command * commandSize));
+        if (++command == commandCount) command = 0;
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+    reportAllocationCounters(state, allocationsBefore, true /* expectNone */);
+}
+BENCHMARK(BM_GL2DrawElementsIndirect)->Arg(1)->Arg(256)->Arg(1 << 16);
+
+// Without a linked program the client state flags the location as invalid,
+// but the call is still encoded, so this covers validation and encoding.
+void BM_GL2Uniform4fv(benchmark::State& state) {
+    GL2Context ctx;
+    GL2Encoder* enc = &ctx.encoder;
+    const GLsizei count = state.range(0);
+    std::vector<float> values(count * 4, 0.25f);
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        enc->glUniform4fv(enc, 0, count, values.data());
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+}
+BENCHMARK(BM_GL2Uniform4fv)->Arg(1)->Arg(16)->Arg(256);
+
+void BM_GL2UniformMatrix4fv(benchmark::State& state) {
+    GL2Context ctx;
+    GL2Encoder* enc = &ctx.encoder;
+    const float matrix[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        enc->glUniformMatrix4fv(enc, 0, 1, GL_FALSE, matrix);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+}
+BENCHMARK(BM_GL2UniformMatrix4fv);
+
+// Uploads of a state.range(0) squared RGBA8 image. A second argument of 1
+// uses a row length wider than the image, so rows are not contiguous.
+void BM_GL2TexSubImage2D(benchmark::State& state) {
+    GL2Context ctx;
+    GL2Encoder* enc = &ctx.encoder;
+    const GLsizei size = state.range(0);
+    const bool padded = state.range(1);
+    const GLsizei rowLength = padded ? size + 16 : size;
+    std::vector<uint8_t> pixels(rowLength * size * 4, 0x7f);
+
+    if (padded) {
+        enc->glPixelStorei(enc, GL_UNPACK_ROW_LENGTH, rowLength);
+    }
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        enc->glTexSubImage2D(enc, GL_TEXTURE_2D, 0, 0, 0, size, size, GL_RGBA,
+                             GL_UNSIGNED_BYTE, pixels.data());
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+    state.SetBytesProcessed(state.iterations() * size * size * 4);
+}
+BENCHMARK(BM_GL2TexSubImage2D)->Args({64, 0})->Args({512, 0})->Args({512, 1});
+
+// Draws from one context per benchmark thread, all in one share group as
+// the contexts of a multi-window app are. Each draw first updates a buffer
+// of its context, which takes the group's lock. Throughput is the sum over
+// threads; thread 0 also reports how the group's lock fared.
+void BM_GL2SharedGroupDraw(benchmark::State& state) {
+    static LockStats sLockStats;
+    static const GLSharedGroupPtr sShared = [] {
+        GLSharedGroupPtr shared(new GLSharedGroup());
+        shared->setLockStats(&sLockStats);
+        return shared;
+    }();
+
+    GL2Context ctx(0, sShared);
+    GL2Encoder* enc = &ctx.encoder;
+    const float vertices[12] = {0.5f};
+    // Buffer names come from the host, which the NullStream makes the same
+    // for every context, so each thread picks its own.
+    const GLuint buffer = 1 + state.thread_index();
+
+    enc->glBindBuffer(enc, GL_ARRAY_BUFFER, buffer);
+    enc->glBufferData(enc, GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
+    enc->glEnableVertexAttribArray(enc, 0);
+    enc->glVertexAttribPointer(enc, 0, 4, GL_FLOAT, GL_FALSE, 0, nullptr);
+    enc->glDrawArrays(enc, GL_TRIANGLES, 0, 3);
+
+    const LockSample lockBefore(sLockStats);
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        enc->glBufferSubData(enc, GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+        enc->glDrawArrays(enc, GL_TRIANGLES, 0, 3);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore, 2);
+    if (state.thread_index() == 0) {
+        reportLockCounters(state, "shared_group", sLockStats, lockBefore);
+    }
+
+    enc->glDeleteBuffers(enc, 1, &buffer);
+}
+BENCHMARK(BM_GL2SharedGroupDraw)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_GLES1DrawArraysClientArray(benchmark::State& state) {
+    GLContext ctx;
+    GLEncoder* enc = &ctx.encoder;
+    const GLsizei vertexCount = state.range(0);
+    std::vector<float> vertices(vertexCount * 3, 0.5f);
+
+    enc->glEnableClientState(enc, GL_VERTEX_ARRAY);
+    enc->glVertexPointer(enc, 3, GL_FLOAT, 0, vertices.data());
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        enc->glDrawArrays(enc, GL_TRIANGLES, 0, vertexCount);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+}
+BENCHMARK(BM_GLES1DrawArraysClientArray)->Arg(3)->Arg(64)->Arg(1024);
+
+void BM_GLES1MatrixAndColor(benchmark::State& state) {
+    GLContext ctx;
+    GLEncoder* enc = &ctx.encoder;
+    const float matrix[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        enc->glLoadMatrixf(enc, matrix);
+        enc->glColor4f(enc, 1.0f, 0.5f, 0.25f, 1.0f);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore, 2);
+}
+BENCHMARK(BM_GLES1MatrixAndColor);
+
+}  // namespace
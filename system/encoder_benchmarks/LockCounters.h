@@ -0,0 +1,56 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "aemu/base/synchronization/AndroidLock.h"
+
+using android::base::guest::LockStats;
+
+// What a lock's LockStats had counted at some point, and how long ago.
+struct LockSample {
+    explicit LockSample(const LockStats& stats)
+        : acquisitions(stats.acquisitions.load()),
+          waitNs(stats.waitNs.load()),
+          holdNs(stats.holdNs.load()),
+          timeNs(LockStats::nowNs()) {}
+
+    uint64_t acquisitions;
+    uint64_t waitNs;
+    uint64_t holdNs;
+    uint64_t timeNs;
+};
+
+// Reports the average wait and hold time per acquisition of a lock since
+// |before|, and the share of the time it was held. A share close to 1 means
+// the threads are serialized on it. Counters are summed over threads, so
+// multi-threaded benchmarks report a shared lock from one thread only, and
+// locks of their own from every thread with kAvgThreads.
+inline void reportLockCounters(benchmark::State& state, const std::string& name,
+                               const LockStats& stats, const LockSample& before,
+                               benchmark::Counter::Flags flags = benchmark::Counter::kDefaults) {
+    const LockSample after(stats);
+    const uint64_t acquisitions = after.acquisitions - before.acquisitions;
+    const double perAcquisition = acquisitions ? 1.0 / double(acquisitions) : 0.0;
+    state.counters[name + "_wait_ns"] =
+        benchmark::Counter(double(after.waitNs - before.waitNs) * perAcquisition, flags);
+    state.counters[name + "_hold_ns"] =
+        benchmark::Counter(double(after.holdNs - before.holdNs) * perAcquisition, flags);
+    state.counters[name + "_held"] = benchmark::Counter(
+        double(after.holdNs - before.holdNs) / double(after.timeNs - before.timeNs), flags);
+}
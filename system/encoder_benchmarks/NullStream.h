@@ -0,0 +1,90 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include "IOStream.h"
+
+// An IOStream that drops everything it is given, so that benchmarks only
+// measure the encoders. Readbacks are answered with |readbackWord| in every
+// 32 bit word, which lets queries such as GL_MAX_TEXTURE_SIZE come back
+// with something usable.
+class NullStream : public IOStream {
+public:
+    explicit NullStream(size_t bufSize = 1 << 20) : IOStream(bufSize) {}
+
+    void setReadbackWord(uint32_t word) { m_readbackWord = word; }
+
+    virtual void* allocBuffer(size_t minSize) override {
+        size_t size = minSize > kBufferSize ? minSize : kBufferSize;
+        if (m_buffer.size() < size) {
+            m_buffer.resize(size);
+        }
+        return m_buffer.data();
+    }
+
+    virtual int commitBuffer(size_t size) override {
+        m_bytes += size;
+        return 0;
+    }
+
+    virtual const unsigned char* readFully(void* buf, size_t len) override {
+        unsigned char* out = static_cast<unsigned char*>(buf);
+        for (size_t i = 0; i < len; i += sizeof(m_readbackWord)) {
+            size_t n = len - i < sizeof(m_readbackWord) ? len - i : sizeof(m_readbackWord);
+            memcpy(out + i, &m_readbackWord, n);
+        }
+        return out;
+    }
+
+    virtual const unsigned char* commitBufferAndReadFully(size_t size, void* buf,
+                                                          size_t len) override {
+        commitBuffer(size);
+        return readFully(buf, len);
+    }
+
+    virtual const unsigned char* read(void* buf, size_t* inout_len) override {
+        return readFully(buf, *inout_len);
+    }
+
+    virtual int writeFully(const void*, size_t len) override {
+        m_bytes += len;
+        return 0;
+    }
+
+    // Bytes handed to the transport so far, pending bytes included.
+    uint64_t bytes() const { return m_bytes + pendingBytes(); }
+
+private:
+    static constexpr size_t kBufferSize = 1 << 20;
+    std::vector<unsigned char> m_buffer;
+    uint64_t m_bytes = 0;
+    uint32_t m_readbackWord = 0;
+};
+
+// Reports calls and bytes per call for a benchmark loop that made |calls|
+// encoder calls per iteration, given the stream byte count before the loop.
+inline void reportEncoderCounters(benchmark::State& state, const NullStream& stream,
+                                  uint64_t bytesBefore, int64_t calls = 1) {
+    const double totalCalls = double(state.iterations()) * calls;
+    state.counters["bytes/call"] =
+        benchmark::Counter(double(stream.bytes() - bytesBefore) / totalCalls);
+    state.counters["calls"] = benchmark::Counter(totalCalls);
+    state.SetItemsProcessed(int64_t(totalCalls));
+}
@@ -0,0 +1,289 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <benchmark/benchmark.h>
+
+#include "AllocationCounter.h"
+#include "LockCounters.h"
+#include "NullStream.h"
+#include "ResourceTracker.h"
+#include "Resources.h"
+#include "VkEncoder.h"
+
+#include <vector>
+
+using gfxstream::vk::ResourceTracker;
+using gfxstream::vk::VkEncoder;
+
+namespace {
+
+// A VkEncoder writing to a NullStream, with guest handles that wrap made up
+// host handles. Readbacks come back as zero, i.e. VK_SUCCESS.
+struct VkContext {
+    VkContext()
+        : encoder(&stream),
+          device(new_from_host_VkDevice((VkDevice)(uintptr_t)1)),
+          commandBuffer(new_from_host_VkCommandBuffer((VkCommandBuffer)(uintptr_t)2)),
+          pipelineLayout(new_from_host_VkPipelineLayout((VkPipelineLayout)3)),
+          renderPass(new_from_host_VkRenderPass((VkRenderPass)4)),
+          shaderModule(new_from_host_VkShaderModule((VkShaderModule)5)) {}
+
+    ~VkContext() {
+        delete_goldfish_VkShaderModule(shaderModule);
+        delete_goldfish_VkRenderPass(renderPass);
+        delete_goldfish_VkPipelineLayout(pipelineLayout);
+        delete_goldfish_VkCommandBuffer(commandBuffer);
+        delete_goldfish_VkDevice(device);
+    }
+
+    NullStream stream;
+    VkEncoder encoder;
+    VkDevice device;
+    VkCommandBuffer commandBuffer;
+    VkPipelineLayout pipelineLayout;
+    VkRenderPass renderPass;
+    VkShaderModule shaderModule;
+};
+
+void BM_VkCmdDraw(benchmark::State& state) {
+    VkContext ctx;
+
+    // The first call sizes the encoder's pool, which later calls reuse.
+    ctx.encoder.vkCmdDraw(ctx.commandBuffer, 3, 1, 0, 0, true /* do lock */);
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    const uint64_t allocationsBefore = threadAllocationCount();
+    for (auto _ : state) {
+        ctx.encoder.vkCmdDraw(ctx.commandBuffer, 3, 1, 0, 0, true /* do lock */);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+    reportAllocationCounters(state, allocationsBefore, true /* expectNone */);
+}
+BENCHMARK(BM_VkCmdDraw);
+
+void BM_VkCmdPushConstants(benchmark::State& state) {
+    VkContext ctx;
+    const uint32_t size = state.range(0);
+    std::vector<uint8_t> values(size, 0x3f);
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        ctx.encoder.vkCmdPushConstants(ctx.commandBuffer, ctx.pipelineLayout,
+                                       VK_SHADER_STAGE_VERTEX_BIT, 0, size, values.data(),
+                                       true /* do lock */);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+}
+BENCHMARK(BM_VkCmdPushConstants)->Arg(16)->Arg(128);
+
+// Updates of state.range(0) uniform buffer descriptors in one call.
+void BM_VkUpdateDescriptorSets(benchmark::State& state) {
+    VkContext ctx;
+    const uint32_t writeCount = state.range(0);
+
+    std::vector<VkDescriptorSet> sets(writeCount);
+    std::vector<VkBuffer> buffers(writeCount);
+    std::vector<VkDescriptorBufferInfo> bufferInfos(writeCount);
+    std::vector<VkWriteDescriptorSet> writes(writeCount);
+    for (uint32_t i = 0; i < writeCount; ++i) {
+        sets[i] = new_from_host_VkDescriptorSet((VkDescriptorSet)(uint64_t)(0x100 + i));
+        buffers[i] = new_from_host_VkBuffer((VkBuffer)(uint64_t)(0x200 + i));
+        bufferInfos[i] = {buffers[i], 0, 256};
+        writes[i] = {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet = sets[i],
+            .dstBinding = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+            .pBufferInfo = &bufferInfos[i],
+        };
+    }
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    const uint64_t allocationsBefore = threadAllocationCount();
+    for (auto _ : state) {
+        ctx.encoder.vkUpdateDescriptorSets(ctx.device, writeCount, writes.data(), 0, nullptr,
+                                           true /* do lock */);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+    reportAllocationCounters(state, allocationsBefore);
+
+    for (uint32_t i = 0; i < writeCount; ++i) {
+        delete_goldfish_VkBuffer(buffers[i]);
+        delete_goldfish_VkDescriptorSet(sets[i]);
+    }
+}
+BENCHMARK(BM_VkUpdateDescriptorSets)->Arg(1)->Arg(16);
+
+// Creation and destruction of a graphics pipeline with a typical amount of
+// fixed function state, which exercises the deep copy and marshaling of
+// large nested create infos.
+void BM_VkCreateGraphicsPipelines(benchmark::State& state) {
+    VkContext ctx;
+
+    const VkPipelineShaderStageCreateInfo stages[2] = {
+        {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .stage = VK_SHADER_STAGE_VERTEX_BIT,
+            .module = ctx.shaderModule,
+            .pName = "main",
+        },
+        {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .stage = VK_SHADER_STAGE_FRAGMENT_BIT,
+            .module = ctx.shaderModule,
+            .pName = "main",
+        },
+    };
+    const VkVertexInputBindingDescription binding = {0, 32, VK_VERTEX_INPUT_RATE_VERTEX};
+    const VkVertexInputAttributeDescription attributes[3] = {
+        {0, 0, VK_FORMAT_R32G32B32_SFLOAT, 0},
+        {1, 0, VK_FORMAT_R32G32_SFLOAT, 12},
+        {2, 0, VK_FORMAT_R8G8B8A8_UNORM, 20},
+    };
+    const VkPipelineVertexInputStateCreateInfo vertexInput = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+        .vertexBindingDescriptionCount = 1,
+        .pVertexBindingDescriptions = &binding,
+        .vertexAttributeDescriptionCount = 3,
+        .pVertexAttributeDescriptions = attributes,
+    };
+    const VkPipelineInputAssemblyStateCreateInfo inputAssembly = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+        .topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+    };
+    const VkPipelineViewportStateCreateInfo viewport = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+        .viewportCount = 1,
+        .scissorCount = 1,
+    };
+    const VkPipelineRasterizationStateCreateInfo rasterization = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+        .polygonMode = VK_POLYGON_MODE_FILL,
+        .cullMode = VK_CULL_MODE_BACK_BIT,
+        .frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE,
+        .lineWidth = 1.0f,
+    };
+    const VkPipelineMultisampleStateCreateInfo multisample = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+        .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT,
+    };
+    const VkPipelineDepthStencilStateCreateInfo depthStencil = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+        .depthTestEnable = VK_TRUE,
+        .depthWriteEnable = VK_TRUE,
+        .depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL,
+    };
+    const VkPipelineColorBlendAttachmentState blendAttachment = {
+        .blendEnable = VK_TRUE,
+        .srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA,
+        .dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+        .colorBlendOp = VK_BLEND_OP_ADD,
+        .srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE,
+        .dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO,
+        .alphaBlendOp = VK_BLEND_OP_ADD,
+        .colorWriteMask = 0xf,
+    };
+    const VkPipelineColorBlendStateCreateInfo colorBlend = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+        .attachmentCount = 1,
+        .pAttachments = &blendAttachment,
+    };
+    const VkDynamicState dynamicStates[2] = {VK_DYNAMIC_STATE_VIEWPORT,
+                                             VK_DYNAMIC_STATE_SCISSOR};
+    const VkPipelineDynamicStateCreateInfo dynamic = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+        .dynamicStateCount = 2,
+        .pDynamicStates = dynamicStates,
+    };
+    const VkGraphicsPipelineCreateInfo createInfo = {
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .stageCount = 2,
+        .pStages = stages,
+        .pVertexInputState = &vertexInput,
+        .pInputAssemblyState = &inputAssembly,
+        .pViewportState = &viewport,
+        .pRasterizationState = &rasterization,
+        .pMultisampleState = &multisample,
+        .pDepthStencilState = &depthStencil,
+        .pColorBlendState = &colorBlend,
+        .pDynamicState = &dynamic,
+        .layout = ctx.pipelineLayout,
+        .renderPass = ctx.renderPass,
+    };
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        ctx.encoder.vkCreateGraphicsPipelines(ctx.device, VK_NULL_HANDLE, 1, &createInfo,
+                                              nullptr, &pipeline, true /* do lock */);
+        ctx.encoder.vkDestroyPipeline(ctx.device, pipeline, nullptr, true /* do lock */);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore, 2);
+}
+BENCHMARK(BM_VkCreateGraphicsPipelines);
+
+// Submits to one queue per benchmark thread, each with an encoder of its
+// own as the threads of a multi-device app have. Each submit is preceded by
+// a fence created and destroyed, as apps that do not recycle fences do,
+// which goes through the ResourceTracker's lock. Throughput is the sum over
+// threads; the encoder lock around each submit is timed here, and thread 0
+// also reports how the tracker's lock fared.
+void BM_VkMultiQueueSubmit(benchmark::State& state) {
+    static LockStats sTrackerLockStats;
+    static const bool sTrackerCounted = [] {
+        ResourceTracker::get()->setLockStats(&sTrackerLockStats);
+        return true;
+    }();
+    (void)sTrackerCounted;
+
+    VkContext ctx;
+    VkQueue queue = new_from_host_VkQueue((VkQueue)(uintptr_t)(0x100 + state.thread_index()));
+    const VkFenceCreateInfo fenceInfo = {
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+    };
+    const VkSubmitInfo submit = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &ctx.commandBuffer,
+    };
+    LockStats encoderLockStats;
+
+    const LockSample trackerBefore(sTrackerLockStats);
+    const LockSample encoderBefore(encoderLockStats);
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        VkFence fence = VK_NULL_HANDLE;
+        ctx.encoder.vkCreateFence(ctx.device, &fenceInfo, nullptr, &fence, true /* do lock */);
+
+        const uint64_t start = LockStats::nowNs();
+        ctx.encoder.lock();
+        encoderLockStats.onAcquired(start);
+        ctx.encoder.vkQueueSubmit(queue, 1, &submit, fence, false /* do lock */);
+        encoderLockStats.onReleased();
+        ctx.encoder.unlock();
+
+        ctx.encoder.vkDestroyFence(ctx.device, fence, nullptr, true /* do lock */);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore, 3);
+    reportLockCounters(state, "encoder", encoderLockStats, encoderBefore,
+                       benchmark::Counter::kAvgThreads);
+    if (state.thread_index() == 0) {
+        reportLockCounters(state, "tracker", sTrackerLockStats, trackerBefore);
+    }
+
+    delete_goldfish_VkQueue(queue);
+}
+BENCHMARK(BM_VkMultiQueueSubmit)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
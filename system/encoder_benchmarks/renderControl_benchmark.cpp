@@ -0,0 +1,75 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <benchmark/benchmark.h>
+
+#include "ChecksumCalculator.h"
+#include "NullStream.h"
+#include "renderControl_enc.h"
+
+#include <vector>
+
+namespace {
+
+struct RCContext {
+    RCContext() : encoder(&stream, &checksum) {}
+
+    NullStream stream;
+    ChecksumCalculator checksum;
+    renderControl_encoder_context_t encoder;
+};
+
+// The per frame calls of eglSwapBuffers.
+void BM_RCFlushWindowColorBufferAsync(benchmark::State& state) {
+    RCContext ctx;
+    renderControl_encoder_context_t* enc = &ctx.encoder;
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        enc->rcFlushWindowColorBufferAsyncWithFrameNumber(enc, 1, 0);
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+}
+BENCHMARK(BM_RCFlushWindowColorBufferAsync);
+
+// A synchronous call, which costs a readback on top of the encoding.
+void BM_RCGetRendererVersion(benchmark::State& state) {
+    RCContext ctx;
+    renderControl_encoder_context_t* enc = &ctx.encoder;
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(enc->rcGetRendererVersion(enc));
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+}
+BENCHMARK(BM_RCGetRendererVersion);
+
+// Gralloc style uploads of a state.range(0) squared RGBA8 buffer.
+void BM_RCUpdateColorBuffer(benchmark::State& state) {
+    RCContext ctx;
+    renderControl_encoder_context_t* enc = &ctx.encoder;
+    const GLint size = state.range(0);
+    std::vector<uint8_t> pixels(size * size * 4, 0x7f);
+
+    const uint64_t bytesBefore = ctx.stream.bytes();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(enc->rcUpdateColorBuffer(enc, 1, 0, 0, size, size, GL_RGBA,
+                                                          GL_UNSIGNED_BYTE, pixels.data()));
+    }
+    reportEncoderCounters(state, ctx.stream, bytesBefore);
+    state.SetBytesProcessed(state.iterations() * size * size * 4);
+}
+BENCHMARK(BM_RCUpdateColorBuffer)->Arg(64)->Arg(512);
+
+}  // namespace
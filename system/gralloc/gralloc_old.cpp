@@ -23,15 +23,18 @@
 #include <qemu_pipe_bp.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "FormatConversions.h"
 #include "HostConnection.h"
 #include "ProcessPipe.h"
 #include "ThreadInfo.h"
+#include "aemu/base/MemoryAccounting.h"
 #include "aemu/base/threads/AndroidThread.h"
 #include "glUtils.h"
 #include "goldfish_address_space.h"
+#include "goldfish_address_space_heap.h"
 #include "goldfish_dma.h"
 #include "gralloc_common.h"
 
@@ -79,7 +82,9 @@ static const bool isHidlGralloc = true;
 static const bool isHidlGralloc = false;
 #endif
 
+using android::base::guest::GraphicsMemory;
 using android::base::guest::getCurrentThreadId;
+using android::base::guest::graphicsMemoryAdd;
 
 const uint32_t CB_HANDLE_MAGIC_OLD = CB_HANDLE_MAGIC_BASE | 0x1;
 const int kBufferFdIndex = 0;
@@ -221,30 +226,39 @@ struct gralloc_memregions_t {
     pthread_mutex_t lock;
 };
 
-#define INITIAL_DMA_REGION_SIZE 4096
+#define MIN_DMA_SLOT_SIZE 4096
+// Uploads from more threads than this wait for a slot.
+#define MAX_DMA_SLOTS 4
+
+// A DMA buffer that one upload at a time copies its pixels through. Its
+// size is a power of two, so that slightly different upload sizes reuse it
+// instead of remapping it.
+struct gralloc_dma_slot_t {
+    gralloc_dma_slot_t() : sz(0), busy(false) {
+        memset(&goldfish_dma, 0, sizeof(goldfish_dma));
+    }
+
+    goldfish_dma_context goldfish_dma;
+    GoldfishAddressSpaceHeapAllocation heap_allocation;
+    uint32_t sz;
+    bool busy;
+};
+
 struct gralloc_dmaregion_t {
     gralloc_dmaregion_t(ExtendedRCEncoderContext *rcEnc)
-      : host_memory_allocator(
-            rcEnc->featureInfo_const()->hasSharedSlotsHostMemoryAllocator),
-        sz(INITIAL_DMA_REGION_SIZE),
+      : heap(GoldfishAddressSpaceHeap::get(
+            rcEnc->featureInfo_const()->hasSharedSlotsHostMemoryAllocator)),
         refcount(0),
         bigbufCount(0) {
-        memset(&goldfish_dma, 0, sizeof(goldfish_dma));
         pthread_mutex_init(&lock, NULL);
-
-        if (rcEnc->hasDirectMem()) {
-            host_memory_allocator.hostMalloc(&address_space_block, sz);
-        } else if (rcEnc->getDmaVersion() > 0) {
-            goldfish_dma_create_region(sz, &goldfish_dma);
-        }
+        pthread_cond_init(&slot_freed, NULL);
     }
 
-    goldfish_dma_context goldfish_dma;
-    GoldfishAddressSpaceHostMemoryAllocator host_memory_allocator;
-    GoldfishAddressSpaceBlock address_space_block;
-    uint32_t sz;
+    GoldfishAddressSpaceHeap& heap;
+    std::vector<gralloc_dma_slot_t*> slots;
     uint32_t refcount;
     pthread_mutex_t lock;
+    pthread_cond_t slot_freed;
     uint32_t bigbufCount;
 };
 
@@ -280,13 +294,114 @@ static void get_gralloc_region(ExtendedRCEncoderContext *rcEnc) {
     pthread_mutex_unlock(&grdma->lock);
 }
 
-static void resize_gralloc_dmaregion_locked(gralloc_dmaregion_t* grdma, uint32_t new_sz) {
-    if (grdma->goldfish_dma.mapped_addr) {
-        goldfish_dma_unmap(&grdma->goldfish_dma);
+static uint32_t dma_slot_size(uint32_t sz) {
+    uint32_t slot_sz = MIN_DMA_SLOT_SIZE;
+    while (slot_sz < sz && slot_sz <= UINT32_MAX / 2) {
+        slot_sz *= 2;
+    }
+    return slot_sz < sz ? sz : slot_sz;
+}
+
+static void free_dma_slot_memory_locked(gralloc_dmaregion_t* grdma, gralloc_dma_slot_t* slot) {
+    grdma->heap.free(&slot->heap_allocation);
+    if (slot->goldfish_dma.mapped_addr) {
+        goldfish_dma_unmap(&slot->goldfish_dma);
+    }
+    if (slot->goldfish_dma.fd > 0) {
+        goldfish_dma_free(&slot->goldfish_dma);
+    }
+    memset(&slot->goldfish_dma, 0, sizeof(slot->goldfish_dma));
+    slot->sz = 0;
+}
+
+static bool alloc_dma_slot_memory_locked(ExtendedRCEncoderContext *rcEnc,
+                                         gralloc_dmaregion_t* grdma,
+                                         gralloc_dma_slot_t* slot,
+                                         uint32_t sz) {
+    if (rcEnc->hasDirectMem()) {
+        if (!grdma->heap.allocate(GoldfishAddressSpaceHeapClient::GrallocUploads,
+                                  sz, &slot->heap_allocation)) {
+            return false;
+        }
+    } else {
+        if (goldfish_dma_create_region(sz, &slot->goldfish_dma)) {
+            return false;
+        }
+        if (!goldfish_dma_map(&slot->goldfish_dma)) {
+            free_dma_slot_memory_locked(grdma, slot);
+            return false;
+        }
+    }
+    slot->sz = sz;
+    return true;
+}
+
+// Takes the smallest idle slot that fits |sz|, making or growing one if
+// none does, so that uploads from different threads do not wait on each
+// other. Returns NULL if no DMA memory could be had.
+static gralloc_dma_slot_t* acquire_dma_slot(ExtendedRCEncoderContext *rcEnc,
+                                            gralloc_dmaregion_t* grdma,
+                                            uint32_t sz) {
+    pthread_mutex_lock(&grdma->lock);
+    gralloc_dma_slot_t* slot = NULL;
+    while (!slot) {
+        gralloc_dma_slot_t* idle = NULL;
+        for (size_t i = 0; i < grdma->slots.size(); ++i) {
+            gralloc_dma_slot_t* s = grdma->slots[i];
+            if (s->busy) continue;
+            if (s->sz >= sz && (!slot || s->sz < slot->sz)) {
+                slot = s;
+            }
+            idle = s;
+        }
+        if (slot) break;
+
+        if (grdma->slots.size() < MAX_DMA_SLOTS) {
+            slot = new gralloc_dma_slot_t;
+            if (!alloc_dma_slot_memory_locked(rcEnc, grdma, slot, dma_slot_size(sz))) {
+                delete slot;
+                slot = NULL;
+                break;
+            }
+            grdma->slots.push_back(slot);
+        } else if (idle) {
+            D("%s: grow slot from %u for sz %u", __func__, idle->sz, sz);
+            free_dma_slot_memory_locked(grdma, idle);
+            if (!alloc_dma_slot_memory_locked(rcEnc, grdma, idle, dma_slot_size(sz))) {
+                break;
+            }
+            slot = idle;
+        } else {
+            pthread_cond_wait(&grdma->slot_freed, &grdma->lock);
+        }
+    }
+    if (slot) {
+        slot->busy = true;
+    }
+    pthread_mutex_unlock(&grdma->lock);
+    return slot;
+}
+
+static void release_dma_slot(gralloc_dmaregion_t* grdma, gralloc_dma_slot_t* slot) {
+    pthread_mutex_lock(&grdma->lock);
+    slot->busy = false;
+    pthread_cond_broadcast(&grdma->slot_freed);
+    pthread_mutex_unlock(&grdma->lock);
+}
+
+// Frees the memory of the slots no upload is using.
+static void free_idle_dma_slots_locked(gralloc_dmaregion_t* grdma) {
+    std::vector<gralloc_dma_slot_t*> busy;
+    for (size_t i = 0; i < grdma->slots.size(); ++i) {
+        gralloc_dma_slot_t* slot = grdma->slots[i];
+        if (slot->busy) {
+            busy.push_back(slot);
+        } else {
+            free_dma_slot_memory_locked(grdma, slot);
+            delete slot;
+        }
     }
-    close(grdma->goldfish_dma.fd);
-    goldfish_dma_create_region(new_sz, &grdma->goldfish_dma);
-    grdma->sz = new_sz;
+    grdma->slots.swap(busy);
 }
 
 // max dma size: 2x 4K rgba8888
@@ -295,7 +410,7 @@ static void resize_gralloc_dmaregion_locked(gralloc_dmaregion_t* grdma, uint32_t
 static bool put_gralloc_region_direct_mem_locked(gralloc_dmaregion_t* grdma, uint32_t /* sz, unused */) {
     const bool shouldDelete = !grdma->refcount;
     if (shouldDelete) {
-        grdma->host_memory_allocator.hostFree(&grdma->address_space_block);
+        free_idle_dma_slots_locked(grdma);
     }
 
     return shouldDelete;
@@ -310,7 +425,7 @@ static bool put_gralloc_region_dma_locked(gralloc_dmaregion_t* grdma, uint32_t s
     bool shouldDelete = !grdma->refcount;
     if (shouldDelete) {
         D("%s: should delete!\n", __func__);
-        resize_gralloc_dmaregion_locked(grdma, INITIAL_DMA_REGION_SIZE);
+        free_idle_dma_slots_locked(grdma);
         D("%s: done\n", __func__);
     }
     D("%s: exit\n", __func__);
@@ -334,43 +449,22 @@ static bool put_gralloc_region(ExtendedRCEncoderContext *rcEnc, uint32_t sz) {
     return shouldDelete;
 }
 
-static void gralloc_dmaregion_register_ashmem_direct_mem_locked(gralloc_dmaregion_t* grdma, uint32_t new_sz) {
-    if (new_sz == grdma->sz) return;
-
-    GoldfishAddressSpaceHostMemoryAllocator* allocator = &grdma->host_memory_allocator;
-    GoldfishAddressSpaceBlock* block = &grdma->address_space_block;
-    allocator->hostFree(block);
-    allocator->hostMalloc(block, new_sz);
-    grdma->sz = new_sz;
-}
-
-static void gralloc_dmaregion_register_ashmem_dma_locked(gralloc_dmaregion_t* grdma, uint32_t new_sz) {
-    if (new_sz != grdma->sz) {
-        if (new_sz > MAX_DMA_SIZE)  {
-            D("%s: requested sz %u too large (limit %u), set to fallback.",
-              __func__, new_sz, MAX_DMA_SIZE);
-            grdma->bigbufCount++;
-        } else {
-            D("%s: change sz from %u to %u", __func__, grdma->sz, new_sz);
-            resize_gralloc_dmaregion_locked(grdma, new_sz);
-        }
-    }
-    if (!grdma->goldfish_dma.mapped_addr) {
-        goldfish_dma_map(&grdma->goldfish_dma);
-    }
-}
-
+// Slots are made on demand by the uploads, so registering only counts the
+// buffers too large to go through DMA.
 static void gralloc_dmaregion_register_ashmem(ExtendedRCEncoderContext *rcEnc, uint32_t sz) {
     gralloc_dmaregion_t* grdma = init_gralloc_dmaregion(rcEnc);
 
     pthread_mutex_lock(&grdma->lock);
     D("%s: for sz %u, refcount %u", __func__, sz, grdma->refcount);
-    const uint32_t new_sz = std::max(grdma->sz, sz);
 
     if (rcEnc->hasDirectMem()) {
-        gralloc_dmaregion_register_ashmem_direct_mem_locked(grdma, new_sz);
+        // Any size goes.
     } else if (rcEnc->getDmaVersion() > 0) {
-        gralloc_dmaregion_register_ashmem_dma_locked(grdma, new_sz);
+        if (sz > MAX_DMA_SIZE) {
+            D("%s: requested sz %u too large (limit %u), set to fallback.",
+              __func__, sz, MAX_DMA_SIZE);
+            grdma->bigbufCount++;
+        }
     } else {
         ALOGE("%s: unexpected DMA type", __func__);
     }
@@ -468,6 +562,7 @@ static int map_buffer(cb_handle_old_t *cb, void **vaddr)
 
     cb->setBufferPtr(addr);
     cb->ashmemBasePid = getpid();
+    graphicsMemoryAdd(GraphicsMemory::kGrallocMappings, cb->bufferSize);
     D("%s: %p mapped ashmem base %p size %d\n", __FUNCTION__,
       cb, addr, cb->bufferSize);
 
@@ -502,6 +597,53 @@ static HostConnection* createOrGetHostConnection() {
     } \
     bool hasVulkan = rcEnc->featureInfo_const()->hasVulkan; (void)hasVulkan;\
 
+// Host color buffer closes go out together, in one rcCloseColorBuffers, once
+// enough of them have been queued or the oldest has waited about a frame.
+// Only closes wait: an open has to reach the host before the buffer's other
+// users can drop their references, and closing late only keeps the host
+// memory a little longer. Whatever is still queued when the process goes
+// away is closed by the host with the rest of its color buffers. Guarded by
+// the host connection lock.
+static const size_t kMaxPendingCloses = 16;
+static const int64_t kMaxPendingCloseAgeNs = 16000000;
+static std::vector<uint32_t> sPendingCloses;
+static int64_t sOldestPendingCloseNs = 0;
+
+static int64_t monotonic_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void flush_pending_closes_locked(ExtendedRCEncoderContext *rcEnc) {
+    if (sPendingCloses.empty()) return;
+    rcEnc->rcCloseColorBuffers(rcEnc, sPendingCloses.size(), sPendingCloses.data());
+    sPendingCloses.clear();
+}
+
+static void flush_old_pending_closes_locked(ExtendedRCEncoderContext *rcEnc) {
+    if (!sPendingCloses.empty() &&
+        monotonic_ns() - sOldestPendingCloseNs >= kMaxPendingCloseAgeNs) {
+        flush_pending_closes_locked(rcEnc);
+    }
+}
+
+static void close_color_buffer_locked(ExtendedRCEncoderContext *rcEnc, uint32_t hostHandle) {
+    if (!rcEnc->hasColorBuffersBatch()) {
+        rcEnc->rcCloseColorBuffer(rcEnc, hostHandle);
+        return;
+    }
+    if (sPendingCloses.empty()) {
+        sOldestPendingCloseNs = monotonic_ns();
+    }
+    sPendingCloses.push_back(hostHandle);
+    if (sPendingCloses.size() >= kMaxPendingCloses) {
+        flush_pending_closes_locked(rcEnc);
+    } else {
+        flush_old_pending_closes_locked(rcEnc);
+    }
+}
+
 #if PLATFORM_SDK_VERSION < 18
 // On older APIs, just define it as a value no one is going to use.
 #define HAL_PIXEL_FORMAT_YCbCr_420_888 0xFFFFFFFF
@@ -545,6 +687,7 @@ static void updateHostColorBuffer(cb_handle_old_t* cb,
           grdma->bigbufCount);
     }
 
+    gralloc_dma_slot_t* slot = NULL;
     if (hasDMA && !grdma->bigbufCount) {
         switch (cb->format) {
         case HAL_PIXEL_FORMAT_YV12:
@@ -556,22 +699,30 @@ static void updateHostColorBuffer(cb_handle_old_t* cb,
             break;
         }
 
-        if (grdma->address_space_block.guestPtr()) {
-            rcEnc->bindDmaDirectly(grdma->address_space_block.guestPtr(),
-                                   grdma->address_space_block.physAddr());
-        } else if (grdma->goldfish_dma.mapped_addr) {
-            rcEnc->bindDmaContext(&grdma->goldfish_dma);
+        slot = acquire_dma_slot(rcEnc, grdma, send_buffer_size);
+        if (!slot) {
+            ALOGE("%s: no DMA memory for sz %u, use fallback", __func__, send_buffer_size);
+        }
+    }
+
+    if (slot) {
+        if (slot->heap_allocation.ptr) {
+            rcEnc->bindDmaDirectly(slot->heap_allocation.ptr,
+                                   slot->heap_allocation.physAddr);
         } else {
-            ALOGE("%s: Unexpected DMA", __func__);
+            rcEnc->bindDmaContext(&slot->goldfish_dma);
         }
 
         D("%s: call. dma update with sz=%u", __func__, send_buffer_size);
-        pthread_mutex_lock(&grdma->lock);
         rcEnc->rcUpdateColorBufferDMA(rcEnc, cb->hostHandle,
                 left, top, width, height,
                 cb->glFormat, cb->glType,
                 to_send, send_buffer_size);
-        pthread_mutex_unlock(&grdma->lock);
+
+        // The call reads back its result, so the host is done with the slot.
+        rcEnc->bindDmaDirectly(NULL, 0);
+        rcEnc->bindDmaContext(NULL);
+        release_dma_slot(grdma, slot);
     } else {
         switch (cb->format) {
         case HAL_PIXEL_FORMAT_YV12:
@@ -983,7 +1134,7 @@ static int gralloc_free(alloc_device_t* dev,
         if (*openCountPtr > 0) {
             D("Closing host ColorBuffer 0x%x\n", cb->hostHandle);
             hostCon->lock();
-            rcEnc->rcCloseColorBuffer(rcEnc, cb->hostHandle);
+            close_color_buffer_locked(rcEnc, cb->hostHandle);
             hostCon->unlock();
         } else {
             D("A rcCloseColorBuffer is owed!!! sdk ver: %d", PLATFORM_SDK_VERSION);
@@ -999,6 +1150,7 @@ static int gralloc_free(alloc_device_t* dev,
         if (cb->bufferSize > 0 && cb->getBufferPtr()) {
             D("%s: unmapped %p", __FUNCTION__, cb->getBufferPtr());
             munmap(cb->getBufferPtr(), cb->bufferSize);
+            graphicsMemoryAdd(GraphicsMemory::kGrallocMappings, -int64_t(cb->bufferSize));
             put_gralloc_region(rcEnc, cb->bufferSize);
         }
         close(bufferFd);
@@ -1071,6 +1223,7 @@ static int gralloc_register_buffer(gralloc_module_t const* module,
     if (cb->hostHandle != 0 && !cb->hasRefcountPipe()) {
         D("Opening host ColorBuffer 0x%x\n", cb->hostHandle);
         hostCon->lock();
+        flush_old_pending_closes_locked(rcEnc);
         rcEnc->rcOpenColorBuffer2(rcEnc, cb->hostHandle);
         hostCon->unlock();
     }
@@ -1125,7 +1278,7 @@ static int gralloc_unregister_buffer(gralloc_module_t const* module,
     if (cb->hostHandle && !cb->hasRefcountPipe()) {
         D("Closing host ColorBuffer 0x%x\n", cb->hostHandle);
         hostCon->lock();
-        rcEnc->rcCloseColorBuffer(rcEnc, cb->hostHandle);
+        close_color_buffer_locked(rcEnc, cb->hostHandle);
 
         if (isHidlGralloc) {
             // Queue up another rcCloseColorBuffer if applicable.
@@ -1134,7 +1287,7 @@ static int gralloc_unregister_buffer(gralloc_module_t const* module,
                 int32_t* openCountPtr = getOpenCountPtr(cb);
                 if (*openCountPtr == -1) {
                     D("%s: revenge of the rcCloseColorBuffer!", __func__);
-                    rcEnc->rcCloseColorBuffer(rcEnc, cb->hostHandle);
+                    close_color_buffer_locked(rcEnc, cb->hostHandle);
                     *openCountPtr = -2;
                 }
             }
@@ -1155,6 +1308,7 @@ static int gralloc_unregister_buffer(gralloc_module_t const* module,
             ERR("gralloc_unregister_buffer(%p): unmap failed", cb);
             return -EINVAL;
         }
+        graphicsMemoryAdd(GraphicsMemory::kGrallocMappings, -int64_t(cb->bufferSize));
         cb->bufferSize = 0;
         cb->mappedPid = 0;
         D("%s: Unregister buffer previous mapped to pid %d", __FUNCTION__, getpid());
@@ -1283,10 +1437,35 @@ static int gralloc_lock(gralloc_module_t const* module,
                        get_yuv420p_offsets(cb->width, cb->height, NULL, NULL,
                                            &buffer_size);
                     }
-                    D("read YUV copy from host");
-                    rcEnc->rcReadColorBufferYUV(rcEnc, cb->hostHandle,
-                                            0, 0, cb->width, cb->height,
-                                            rgb_addr, buffer_size);
+                    // Ashmem has no physical address, so the host writes
+                    // into a DMA slot instead of the stream.
+                    gralloc_dmaregion_t* grdma = NULL;
+                    gralloc_dma_slot_t* slot = NULL;
+                    if (rcEnc->featureInfo()->hasReadColorBufferYUVDma &&
+                        has_DMA_support(rcEnc)) {
+                        grdma = init_gralloc_dmaregion(rcEnc);
+                        slot = acquire_dma_slot(rcEnc, grdma, buffer_size);
+                        if (slot && !slot->heap_allocation.ptr) {
+                            release_dma_slot(grdma, slot);
+                            slot = NULL;
+                        }
+                    }
+                    if (slot) {
+                        D("read YUV from host by DMA");
+                        rcEnc->bindDmaDirectly(slot->heap_allocation.ptr,
+                                               slot->heap_allocation.physAddr);
+                        rcEnc->rcReadColorBufferYUVDMA(rcEnc, cb->hostHandle,
+                                                0, 0, cb->width, cb->height,
+                                                slot->heap_allocation.ptr, buffer_size);
+                        rcEnc->bindDmaDirectly(NULL, 0);
+                        memcpy(rgb_addr, slot->heap_allocation.ptr, buffer_size);
+                        release_dma_slot(grdma, slot);
+                    } else {
+                        D("read YUV copy from host");
+                        rcEnc->rcReadColorBufferYUV(rcEnc, cb->hostHandle,
+                                                0, 0, cb->width, cb->height,
+                                                rgb_addr, buffer_size);
+                    }
                 } else {
                     // We are using RGB888
                     tmpBuf = new char[cb->width * cb->height * 3];
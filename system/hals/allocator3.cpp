@@ -14,6 +14,7 @@
 * limitations under the License.
 */
 
+#include <android-base/properties.h>
 #include <android-base/unique_fd.h>
 #include <android/hardware/graphics/allocator/3.0/IAllocator.h>
 #include <android/hardware/graphics/mapper/3.0/IMapper.h>
@@ -26,6 +27,16 @@
 #include "types.h"
 #include "debug.h"
 
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
 const int kOMX_COLOR_FormatYUV420Planar = 19;
 
 using ::android::hardware::hidl_handle;
@@ -57,7 +68,30 @@ bool needGpuBuffer(const uint32_t usage) {
 
 class GoldfishAllocator : public IAllocator3 {
 public:
-    GoldfishAllocator() : m_hostConn(HostConnection::createUnique()) {}
+    GoldfishAllocator()
+            : m_hostConn(HostConnection::createUnique())
+            , m_maxSpares(::android::base::GetUintProperty<uint32_t>(
+                  "ro.boot.qemu.gralloc.spareBuffers", 0)) {
+        if (m_maxSpares) {
+            m_spareThread = std::thread([this] { spareThreadLoop(); });
+        }
+    }
+
+    ~GoldfishAllocator() {
+        if (m_spareThread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(m_spareLock);
+                m_spareThreadExit = true;
+            }
+            m_spareCv.notify_one();
+            m_spareThread.join();
+        }
+        for (auto& kv : m_spares) {
+            for (cb_handle_30_t* cb : kv.second.cbs) {
+                freeCb(std::unique_ptr<cb_handle_30_t>(cb));
+            }
+        }
+    }
 
     Return<void> dumpDebugInfo(dumpDebugInfo_cb hidl_cb) {
         hidl_cb("GoldfishAllocator::dumpDebugInfo is not implemented");
@@ -87,6 +121,48 @@ public:
     }
 
 private:
+    // Everything allocateCb needs to make a buffer.
+    struct CbParams {
+        uint32_t usage;
+        uint32_t width;
+        uint32_t height;
+        PixelFormat format;
+        EmulatorFrameworkFormat emulatorFrameworkFormat;
+        int glFormat;
+        int glType;
+        size_t bufferSize;
+        uint32_t bytesPerPixel;
+        uint32_t stride;
+    };
+
+    // The rest of CbParams follows from these.
+    struct SpareKey {
+        uint32_t width;
+        uint32_t height;
+        PixelFormat format;
+        uint32_t usage;
+
+        bool operator<(const SpareKey& rhs) const {
+            return std::tie(width, height, format, usage) <
+                   std::tie(rhs.width, rhs.height, rhs.format, rhs.usage);
+        }
+    };
+
+    // Buffers made ahead of time for a recently allocated descriptor, so
+    // that BufferQueue allocating it again, as it does on resize and
+    // rotation, gets memory and a live host color buffer with no round
+    // trips. Handed out buffers belong to their clients and are never
+    // reused, as nothing tells the allocator when clients free them.
+    struct Spares {
+        CbParams params;
+        std::vector<cb_handle_30_t*> cbs;
+        size_t wanted = 0;
+        std::chrono::steady_clock::time_point lastAllocated;
+    };
+
+    // Spares of a descriptor not allocated for this long are freed.
+    static constexpr std::chrono::seconds kSpareLifetime{3};
+
     // this function should be in sync with GoldfishMapper::isSupportedImpl
     Error3 allocateImpl(const hidl_vec<uint32_t>& rawDescriptor,
                         uint32_t count,
@@ -255,15 +331,30 @@ private:
                          const uint32_t stride,
                          const uint32_t count,
                          std::vector<cb_handle_30_t*>* cbs) {
-        for (uint32_t i = 0; i < count; ++i) {
+        const CbParams params = {
+            usage, width, height, format, emulatorFrameworkFormat,
+            glFormat, glType, bufferSize, bytesPerPixel, stride,
+        };
+
+        uint32_t i = 0;
+        for (; i < count; ++i) {
+            cb_handle_30_t* cb = takeSpare(params);
+            if (!cb) {
+                break;
+            }
+            cbs->push_back(cb);
+        }
+
+        if (count - i > 1 && canAllocateCbs(params)) {
+            const Error3 e = allocateCbs(params, count - i, cbs);
+            if (e == Error3::NONE) {
+                i = count;
+            }
+        }
+
+        for (; i < count; ++i) {
             cb_handle_30_t* cb;
-            Error3 e = allocateCb(usage,
-                                  width, height,
-                                  format, emulatorFrameworkFormat,
-                                  glFormat, glType,
-                                  bufferSize,
-                                  bytesPerPixel, stride,
-                                  &cb);
+            Error3 e = allocateCb(params, &cb);
             if (e == Error3::NONE) {
                 cbs->push_back(cb);
             } else {
@@ -271,9 +362,102 @@ private:
             }
         }
 
+        wantSpares(params, count);
         RETURN(Error3::NONE);
     }
 
+    static SpareKey spareKey(const CbParams& params) {
+        return { params.width, params.height, params.format, params.usage };
+    }
+
+    cb_handle_30_t* takeSpare(const CbParams& params) {
+        if (!m_maxSpares) {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(m_spareLock);
+        const auto i = m_spares.find(spareKey(params));
+        if (i == m_spares.end() || i->second.cbs.empty()) {
+            return nullptr;
+        }
+        cb_handle_30_t* cb = i->second.cbs.back();
+        i->second.cbs.pop_back();
+        return cb;
+    }
+
+    // Asks for as many spares of |params| as were just allocated, up to
+    // m_maxSpares, and restarts their lifetime.
+    void wantSpares(const CbParams& params, const uint32_t count) {
+        if (!m_maxSpares) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_spareLock);
+            Spares& spares = m_spares[spareKey(params)];
+            spares.params = params;
+            spares.wanted = std::min<size_t>(count, m_maxSpares);
+            spares.lastAllocated = std::chrono::steady_clock::now();
+        }
+        m_spareCv.notify_one();
+    }
+
+    void spareThreadLoop() {
+        std::unique_lock<std::mutex> lock(m_spareLock);
+        while (!m_spareThreadExit) {
+            const auto now = std::chrono::steady_clock::now();
+            std::vector<cb_handle_30_t*> expired;
+            const CbParams* toMake = nullptr;
+            auto nextExpiry = now + kSpareLifetime;
+
+            for (auto i = m_spares.begin(); i != m_spares.end();) {
+                Spares& spares = i->second;
+                const auto expiry = spares.lastAllocated + kSpareLifetime;
+                if (expiry <= now) {
+                    expired.insert(expired.end(), spares.cbs.begin(), spares.cbs.end());
+                    i = m_spares.erase(i);
+                    continue;
+                }
+                nextExpiry = std::min(nextExpiry, expiry);
+                if (!toMake && spares.cbs.size() < spares.wanted) {
+                    toMake = &spares.params;
+                }
+                ++i;
+            }
+
+            if (!expired.empty() || toMake) {
+                const bool make = toMake != nullptr;
+                const CbParams params = make ? *toMake : CbParams();
+                lock.unlock();
+
+                for (cb_handle_30_t* cb : expired) {
+                    freeCb(std::unique_ptr<cb_handle_30_t>(cb));
+                }
+                cb_handle_30_t* cb = nullptr;
+                const bool made = make && allocateCb(params, &cb) == Error3::NONE;
+
+                lock.lock();
+                if (make) {
+                    // Only this thread erases entries.
+                    Spares& spares = m_spares.find(spareKey(params))->second;
+                    if (made) {
+                        spares.cbs.push_back(cb);
+                    } else {
+                        // Not retried until the descriptor is allocated again.
+                        spares.wanted = 0;
+                    }
+                }
+                continue;
+            }
+
+            if (m_spares.empty()) {
+                m_spareCv.wait(lock);
+            } else {
+                m_spareCv.wait_until(lock, nextExpiry);
+            }
+        }
+    }
+
     // see GoldfishMapper::encodeBufferDescriptorInfo
     static bool decodeBufferDescriptorInfo(const hidl_vec<uint32_t>& raw,
                                            BufferDescriptorInfo* d) {
@@ -308,15 +492,18 @@ private:
         }
     }
 
-    Error3 allocateCb(const uint32_t usage,
-                      const uint32_t width, const uint32_t height,
-                      const PixelFormat format,
-                      const EmulatorFrameworkFormat emulatorFrameworkFormat,
-                      const int glFormat, const int glType,
-                      const size_t bufferSize,
-                      const int32_t bytesPerPixel,
-                      const int32_t stride,
-                      cb_handle_30_t** cb) {
+    Error3 allocateCb(const CbParams& params, cb_handle_30_t** cb) {
+        const uint32_t usage = params.usage;
+        const uint32_t width = params.width;
+        const uint32_t height = params.height;
+        const PixelFormat format = params.format;
+        const EmulatorFrameworkFormat emulatorFrameworkFormat = params.emulatorFrameworkFormat;
+        const int glFormat = params.glFormat;
+        const int glType = params.glType;
+        const size_t bufferSize = params.bufferSize;
+        const int32_t bytesPerPixel = params.bytesPerPixel;
+        const int32_t stride = params.stride;
+
         const HostConnectionSession conn = getHostConnectionSession();
         ExtendedRCEncoderContext *const rcEnc = conn.getRcEncoder();
         CRASH_IF(!rcEnc, "conn.getRcEncoder() failed");
@@ -388,6 +575,111 @@ private:
         RETURN(Error3::NONE);
     }
 
+    bool canAllocateCbs(const CbParams& params) const {
+        if (!needGpuBuffer(params.usage)) {
+            return true;
+        }
+        const HostConnectionSession conn = getHostConnectionSession();
+        ExtendedRCEncoderContext *const rcEnc = conn.getRcEncoder();
+        return rcEnc && rcEnc->hasColorBuffersBatch();
+    }
+
+    // Makes |count| buffers with one host memory allocation, split between
+    // them in page aligned slices, and one rcCreateColorBuffersDMA call.
+    // The slices share the allocation, which the host frees once the last
+    // of the buffers is gone. Either all of the buffers are made or none.
+    Error3 allocateCbs(const CbParams& params, const uint32_t count,
+                       std::vector<cb_handle_30_t*>* cbs) {
+        const HostConnectionSession conn = getHostConnectionSession();
+        ExtendedRCEncoderContext *const rcEnc = conn.getRcEncoder();
+        CRASH_IF(!rcEnc, "conn.getRcEncoder() failed");
+
+        const size_t pageSize = ::sysconf(_SC_PAGESIZE);
+        const size_t sliceSize =
+            (params.bufferSize + pageSize - 1) & ~(pageSize - 1);
+
+        std::vector<android::base::unique_fd> cpuAlocatorFds(count);
+        GoldfishAddressSpaceBlock bufferBits;
+        if (params.bufferSize > 0) {
+            GoldfishAddressSpaceHostMemoryAllocator host_memory_allocator(
+                rcEnc->featureInfo_const()->hasSharedSlotsHostMemoryAllocator);
+            if (!host_memory_allocator.is_opened()) {
+                RETURN_ERROR(Error3::NO_RESOURCES);
+            }
+
+            if (host_memory_allocator.hostMalloc(&bufferBits, sliceSize * count)) {
+                RETURN_ERROR(Error3::NO_RESOURCES);
+            }
+
+            cpuAlocatorFds[0].reset(host_memory_allocator.release());
+            for (uint32_t k = 1; k < count; ++k) {
+                cpuAlocatorFds[k].reset(::dup(cpuAlocatorFds[0].get()));
+                if (!cpuAlocatorFds[k].ok()) {
+                    RETURN_ERROR(Error3::NO_RESOURCES);
+                }
+            }
+        }
+
+        std::vector<uint32_t> hostHandles(count, 0);
+        std::vector<android::base::unique_fd> hostHandleRefCountFds(count);
+        if (needGpuBuffer(params.usage)) {
+            for (auto& fd : hostHandleRefCountFds) {
+                fd.reset(qemu_pipe_open("refcount"));
+                if (!fd.ok()) {
+                    RETURN_ERROR(Error3::NO_RESOURCES);
+                }
+            }
+
+            const GLenum allocFormat =
+                (PixelFormat::RGBX_8888 == params.format) ? GL_RGB : params.glFormat;
+
+            // The host makes all of them or none.
+            if (rcEnc->rcCreateColorBuffersDMA(
+                    rcEnc,
+                    params.width, params.height,
+                    allocFormat, static_cast<int>(params.emulatorFrameworkFormat),
+                    count, hostHandles.data()) != static_cast<int>(count)) {
+                RETURN_ERROR(Error3::NO_RESOURCES);
+            }
+
+            // Color buffers tied to a refcount pipe go away with the pipe.
+            for (uint32_t k = 0; k < count; ++k) {
+                if (qemu_pipe_write(hostHandleRefCountFds[k].get(),
+                                    &hostHandles[k],
+                                    sizeof(hostHandles[k])) != sizeof(hostHandles[k])) {
+                    for (; k < count; ++k) {
+                        rcEnc->rcCloseColorBuffer(rcEnc, hostHandles[k]);
+                    }
+                    RETURN_ERROR(Error3::NO_RESOURCES);
+                }
+            }
+        }
+
+        const size_t mmapedSize = params.bufferSize ? sliceSize : 0;
+        char* const guestPtr = static_cast<char*>(bufferBits.guestPtr());
+        for (uint32_t k = 0; k < count; ++k) {
+            cbs->push_back(new cb_handle_30_t(
+                cpuAlocatorFds[k].release(),
+                hostHandleRefCountFds[k].release(),
+                hostHandles[k],
+                params.usage,
+                params.width,
+                params.height,
+                static_cast<int>(params.format),
+                params.glFormat,
+                params.glType,
+                params.bufferSize,
+                guestPtr + k * mmapedSize,
+                mmapedSize,
+                bufferBits.offset() + k * mmapedSize,
+                params.bytesPerPixel,
+                params.stride));
+        }
+
+        bufferBits.release();
+        RETURN(Error3::NONE);
+    }
+
     void freeCb(std::unique_ptr<cb_handle_30_t> cb) {
         if (cb->hostHandleRefcountFdIndex >= 0) {
             ::close(cb->fds[cb->hostHandleRefcountFdIndex]);
@@ -404,6 +696,14 @@ private:
     }
 
     std::unique_ptr<HostConnection> m_hostConn;
+
+    // Spares kept per descriptor; 0 turns them off.
+    const uint32_t m_maxSpares;
+    std::mutex m_spareLock;
+    std::condition_variable m_spareCv;
+    std::map<SpareKey, Spares> m_spares;
+    bool m_spareThreadExit = false;
+    std::thread m_spareThread;
 };
 
 int main(int, char**) {
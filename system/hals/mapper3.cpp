@@ -23,8 +23,15 @@
 #include "FormatConversions.h"
 #include "debug.h"
 
+#include "aemu/base/MemoryAccounting.h"
 #include "aemu/base/Tracing.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #define ATRACE_TAG ATRACE_TAG_GRAPHICS
 
 const int kOMX_COLOR_FormatYUV420Planar = 19;
@@ -37,6 +44,9 @@ using ::android::hardware::Void;
 using ::android::hardware::graphics::common::V1_2::PixelFormat;
 using ::android::hardware::graphics::common::V1_0::BufferUsage;
 
+using ::android::base::guest::GraphicsMemory;
+using ::android::base::guest::graphicsMemoryAdd;
+
 namespace MapperV3 = ::android::hardware::graphics::mapper::V3_0;
 
 using IMapper3 = MapperV3::IMapper;
@@ -110,6 +120,17 @@ public:
         host_memory_allocator.hostFree(&bufferBits);
     }
 
+    ~GoldfishMapper() {
+        if (m_unmapThread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(m_mappingLock);
+                m_unmapThreadExit = true;
+            }
+            m_mappingCv.notify_one();
+            m_unmapThread.join();
+        }
+    }
+
     Return<void> importBuffer(const hidl_handle& hh,
                               importBuffer_cb hidl_cb) {
         native_handle_t* imported = nullptr;
@@ -131,8 +152,11 @@ public:
             RETURN_ERROR(Error3::BAD_BUFFER);
         }
 
-        if (cb->mmapedSize > 0) {
-            GoldfishAddressSpaceBlock::memoryUnmap(cb->getBufferPtr(), cb->mmapedSize);
+        {
+            std::lock_guard<std::mutex> lock(m_mappingLock);
+            if (m_mappings.erase(cb)) {
+                unmapBuffer(cb);
+            }
         }
 
         native_handle_close(cb);
@@ -237,20 +261,10 @@ private:  // **** impl ****
 
         if (cb->mmapedSize > 0) {
             LOG_ALWAYS_FATAL_IF(cb->bufferFdIndex < 0);
-            void* ptr;
-            const int res = GoldfishAddressSpaceBlock::memoryMap(
-                cb->getBufferPtr(),
-                cb->mmapedSize,
-                cb->fds[cb->bufferFdIndex],
-                cb->getMmapedOffset(),
-                &ptr);
-            if (res) {
-                native_handle_close(imported);
-                native_handle_delete(imported);
-                RETURN_ERROR(Error3::NO_RESOURCES);
-            }
-            cb->setBufferPtr(ptr);
         }
+        // The pointer is the allocator's. Buffers are mapped here on their
+        // first CPU lock, as most importers only hand them to the GPU.
+        cb->setBufferPtr(nullptr);
 
         *phandle = imported;
         RETURN(Error3::NONE);
@@ -294,20 +308,22 @@ private:  // **** impl ****
         if (checkedUsage == 0) {
             RETURN_ERROR(Error3::BAD_VALUE);
         }
-        if (!cb->bufferSize) {
+        if (!cb->bufferSize || !cb->mmapedSize) {
             RETURN_ERROR(Error3::BAD_BUFFER);
         }
-        char* const bufferBits = static_cast<char*>(cb->getBufferPtr());
+        char* const bufferBits = acquireBufferBits(cb);
         if (!bufferBits) {
-            RETURN_ERROR(Error3::BAD_BUFFER);
+            RETURN_ERROR(Error3::NO_RESOURCES);
         }
         if (waitHidlFence(acquireFence, __func__)) {
+            releaseBufferBits(cb);
             RETURN_ERROR(Error3::BAD_VALUE);
         }
 
         if (cb->hostHandle) {
             const Error3 e = lockHostImpl(*cb, checkedUsage, accessRegion, bufferBits);
             if (e != Error3::NONE) {
+                releaseBufferBits(cb);
                 return e;
             }
         }
@@ -340,14 +356,15 @@ private:  // **** impl ****
         if (checkedUsage == 0) {
             RETURN_ERROR(Error3::BAD_VALUE);
         }
-        if (!cb->bufferSize) {
+        if (!cb->bufferSize || !cb->mmapedSize) {
             RETURN_ERROR(Error3::BAD_BUFFER);
         }
-        char* const bufferBits = static_cast<char*>(cb->getBufferPtr());
+        char* const bufferBits = acquireBufferBits(cb);
         if (!bufferBits) {
-            RETURN_ERROR(Error3::BAD_BUFFER);
+            RETURN_ERROR(Error3::NO_RESOURCES);
         }
         if (waitHidlFence(acquireFence, __func__)) {
+            releaseBufferBits(cb);
             RETURN_ERROR(Error3::BAD_VALUE);
         }
 
@@ -392,12 +409,14 @@ private:  // **** impl ****
 
         default:
             ALOGE("%s:%d unexpected format (%d)", __func__, __LINE__, cb->format);
+            releaseBufferBits(cb);
             RETURN_ERROR(Error3::BAD_BUFFER);
         }
 
         if (cb->hostHandle) {
             const Error3 e = lockHostImpl(*cb, checkedUsage, accessRegion, bufferBits);
             if (e != Error3::NONE) {
+                releaseBufferBits(cb);
                 return e;
             }
         }
@@ -414,6 +433,73 @@ private:  // **** impl ****
         RETURN(Error3::NONE);
     }
 
+    // Maps the buffer if it is not mapped and keeps it mapped until
+    // releaseBufferBits.
+    char* acquireBufferBits(cb_handle_30_t* cb) {
+        std::lock_guard<std::mutex> lock(m_mappingLock);
+        if (!cb->getBufferPtr()) {
+            void* ptr;
+            const int res = GoldfishAddressSpaceBlock::memoryMap(
+                nullptr,
+                cb->mmapedSize,
+                cb->fds[cb->bufferFdIndex],
+                cb->getMmapedOffset(),
+                &ptr);
+            if (res) {
+                ALOGE("%s: memoryMap failed with %d", __func__, res);
+                return nullptr;
+            }
+            cb->setBufferPtr(ptr);
+            graphicsMemoryAdd(GraphicsMemory::kGrallocMappings, cb->mmapedSize);
+        }
+
+        const bool wasEmpty = m_mappings.empty();
+        m_mappings[cb].locked = true;
+        if (!m_unmapThread.joinable()) {
+            m_unmapThread = std::thread([this] { unmapThreadLoop(); });
+        } else if (wasEmpty) {
+            m_mappingCv.notify_one();
+        }
+        return static_cast<char*>(cb->getBufferPtr());
+    }
+
+    void releaseBufferBits(cb_handle_30_t* cb) {
+        std::lock_guard<std::mutex> lock(m_mappingLock);
+        const auto i = m_mappings.find(cb);
+        if (i != m_mappings.end()) {
+            i->second.locked = false;
+            i->second.lastUnlocked = std::chrono::steady_clock::now();
+        }
+    }
+
+    // Must be called with m_mappingLock held.
+    static void unmapBuffer(cb_handle_30_t* cb) {
+        GoldfishAddressSpaceBlock::memoryUnmap(cb->getBufferPtr(), cb->mmapedSize);
+        graphicsMemoryAdd(GraphicsMemory::kGrallocMappings, -int64_t(cb->mmapedSize));
+        cb->setBufferPtr(nullptr);
+    }
+
+    void unmapThreadLoop() {
+        std::unique_lock<std::mutex> lock(m_mappingLock);
+        while (!m_unmapThreadExit) {
+            if (m_mappings.empty()) {
+                m_mappingCv.wait(lock);
+                continue;
+            }
+            m_mappingCv.wait_for(lock, kUnmapCheckPeriod);
+
+            const auto now = std::chrono::steady_clock::now();
+            for (auto i = m_mappings.begin(); i != m_mappings.end();) {
+                if (!i->second.locked && now - i->second.lastUnlocked >= kUnmapAfterIdle) {
+                    unmapBuffer(i->first);
+                    i = m_mappings.erase(i);
+                } else {
+                    ++i;
+                }
+            }
+        }
+    }
+
     Error3 lockHostImpl(cb_handle_30_t& cb,
                         const uint8_t checkedUsage,
                         const Rect& accessRegion,
@@ -446,9 +532,23 @@ private:  // **** impl ****
                         break;
                     }
 
-                    rcEnc->rcReadColorBufferYUV(rcEnc, cb.hostHandle,
-                        0, 0, cb.width, cb.height,
-                        bufferBits, bufferSize);
+                    if (rcEnc->featureInfo()->hasReadColorBufferYUVDma) {
+                        // The buffer is an address space block, so the host
+                        // writes the planes into it and nothing is copied
+                        // through the stream.
+                        {
+                            AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_GRALLOC, "bindDmaDirectly");
+                            rcEnc->bindDmaDirectly(bufferBits,
+                                    getMmapedPhysAddr(cb.getMmapedOffset()));
+                        }
+                        rcEnc->rcReadColorBufferYUVDMA(rcEnc, cb.hostHandle,
+                            0, 0, cb.width, cb.height,
+                            bufferBits, bufferSize);
+                    } else {
+                        rcEnc->rcReadColorBufferYUV(rcEnc, cb.hostHandle,
+                            0, 0, cb.width, cb.height,
+                            bufferBits, bufferSize);
+                    }
                 } else {
                     // We are using RGB888
                     std::vector<char> tmpBuf(cb.width * cb.height * 3);
@@ -481,7 +581,7 @@ private:  // **** impl ****
             } else {
                 if (rcEnc->featureInfo()->hasReadColorBufferDma) {
                     {
-                        AEMU_SCOPED_TRACE("bindDmaDirectly");
+                        AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_GRALLOC, "bindDmaDirectly");
                         rcEnc->bindDmaDirectly(bufferBits,
                                 getMmapedPhysAddr(cb.getMmapedOffset()));
                     }
@@ -504,7 +604,7 @@ private:  // **** impl ****
     }
 
     Error3 unlockImpl(void* raw) {
-        AEMU_SCOPED_TRACE("unlockImpl body");
+        AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_GRALLOC, "unlockImpl body");
         if (!raw) {
             RETURN_ERROR(Error3::BAD_BUFFER);
         }
@@ -532,17 +632,19 @@ private:  // **** impl ****
         cb->lockedWidth = 0;
         cb->lockedHeight = 0;
         cb->lockedUsage = 0;
+        releaseBufferBits(cb);
 
         RETURN(Error3::NONE);
     }
 
     void unlockHostImpl(cb_handle_30_t& cb, char* const bufferBits) {
-        AEMU_SCOPED_TRACE("unlockHostImpl body");
+        AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_GRALLOC, "unlockHostImpl body");
         if (cb.lockedUsage & BufferUsage::CPU_WRITE_MASK) {
             const int bpp = glUtilsPixelBitSize(cb.glFormat, cb.glType) >> 3;
-            const uint32_t rgbSize = cb.width * cb.height * bpp;
             const char* bitsToSend;
             uint32_t sizeToSend;
+            uint32_t rowsTop = 0;
+            uint32_t rowsHeight = cb.height;
 
             if (gralloc_is_yuv_format(cb.format)) {
                 bitsToSend = bufferBits;
@@ -558,22 +660,42 @@ private:  // **** impl ****
                         break;
                 }
             } else {
-                bitsToSend = bufferBits;
-                sizeToSend = rgbSize;
+                // A lock of a narrow rect, like a blinking cursor or a
+                // status icon, would otherwise send whole rows. Its pixels
+                // are packed and sent through the stream instead, which is
+                // worth it while they are at most half of those rows.
+                if (cb.lockedWidth && cb.lockedHeight &&
+                    cb.lockedLeft + cb.lockedWidth <= cb.width &&
+                    cb.lockedTop + cb.lockedHeight <= cb.height &&
+                    cb.lockedWidth * 2 <= cb.width) {
+                    unlockHostRectImpl(cb, bufferBits, bpp);
+                    return;
+                }
+
+                // Rows are not padded, so the full-width band of rows the
+                // lock touched is contiguous and can be sent in place.
+                if (cb.lockedHeight &&
+                    cb.lockedTop + cb.lockedHeight <= cb.height) {
+                    rowsTop = cb.lockedTop;
+                    rowsHeight = cb.lockedHeight;
+                }
+                bitsToSend = bufferBits + rowsTop * cb.width * bpp;
+                sizeToSend = rowsHeight * cb.width * bpp;
             }
 
             {
                 const HostConnectionSession conn = getHostConnectionSession();
                 ExtendedRCEncoderContext *const rcEnc = conn.getRcEncoder();
                 {
-                    AEMU_SCOPED_TRACE("bindDmaDirectly");
-                    rcEnc->bindDmaDirectly(bufferBits,
-                            getMmapedPhysAddr(cb.getMmapedOffset()));
+                    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_GRALLOC, "bindDmaDirectly");
+                    rcEnc->bindDmaDirectly(const_cast<char*>(bitsToSend),
+                            getMmapedPhysAddr(cb.getMmapedOffset()) +
+                                (bitsToSend - bufferBits));
                 }
                 {
-                    AEMU_SCOPED_TRACE("updateColorBuffer");
+                    AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_GRALLOC, "updateColorBuffer");
                     rcEnc->rcUpdateColorBufferDMA(rcEnc, cb.hostHandle,
-                            0, 0, cb.width, cb.height,
+                            0, rowsTop, cb.width, rowsHeight,
                             cb.glFormat, cb.glType,
                             const_cast<char*>(bitsToSend),
                             sizeToSend);
@@ -582,6 +704,25 @@ private:  // **** impl ****
         }
     }
 
+    void unlockHostRectImpl(const cb_handle_30_t& cb,
+                            const char* const bufferBits,
+                            const int bpp) {
+        const size_t rowSize = cb.lockedWidth * bpp;
+        std::vector<char> rect(rowSize * cb.lockedHeight);
+        const char* src = bufferBits + (cb.lockedTop * cb.width + cb.lockedLeft) * bpp;
+        for (uint32_t row = 0; row < cb.lockedHeight; ++row) {
+            memcpy(&rect[row * rowSize], src, rowSize);
+            src += cb.width * bpp;
+        }
+
+        const HostConnectionSession conn = getHostConnectionSession();
+        ExtendedRCEncoderContext *const rcEnc = conn.getRcEncoder();
+        AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_GRALLOC, "updateColorBuffer");
+        rcEnc->rcUpdateColorBuffer(rcEnc, cb.hostHandle,
+                cb.lockedLeft, cb.lockedTop, cb.lockedWidth, cb.lockedHeight,
+                cb.glFormat, cb.glType, rect.data());
+    }
+
     /* BufferUsage bits that must be zero */
     static constexpr uint64_t kReservedUsage =
         (one64 << 10)
@@ -659,8 +800,23 @@ private:  // **** impl ****
         return m_physAddrToOffset + offset;
     }
 
+    // The CPU mapping of a buffer that has been locked.
+    struct Mapping {
+        bool locked = false;
+        std::chrono::steady_clock::time_point lastUnlocked;
+    };
+
+    static constexpr std::chrono::seconds kUnmapAfterIdle{5};
+    static constexpr std::chrono::seconds kUnmapCheckPeriod{1};
+
     std::unique_ptr<HostConnection> m_hostConn;
     uint64_t m_physAddrToOffset;
+
+    std::mutex m_mappingLock;
+    std::condition_variable m_mappingCv;
+    std::unordered_map<cb_handle_30_t*, Mapping> m_mappings;
+    bool m_unmapThreadExit = false;
+    std::thread m_unmapThread;
 };
 }  // namespace
 
@@ -52,7 +52,10 @@ LOCAL_SHARED_LIBRARIES := \
     libui \
     libutils \
     libutils \
+    libnativewindow \
+    libvulkan \
     libOpenglSystemCommon \
+    libandroidemu \
     lib_renderControl_enc \
     libui
 
@@ -101,6 +104,7 @@ LOCAL_SRC_FILES := \
     Main.cpp \
     NoOpFrameComposer.cpp \
     VsyncThread.cpp \
+    VulkanFrameComposer.cpp \
 
 LOCAL_VINTF_FRAGMENTS := hwc3.xml
 LOCAL_INIT_RC := hwc3.rc
@@ -95,14 +95,24 @@ HWC3::Error ClientFrameComposer::onDisplayClientTargetSet(Display* display) {
 
   DisplayInfo& displayInfo = it->second;
 
-  auto [drmBufferCreateError, drmBuffer] =
-    mDrmClient.create(display->getClientTarget().getBuffer());
-  if (drmBufferCreateError != HWC3::Error::None) {
-    ALOGE("%s: display:%" PRIu64 " failed to create client target drm buffer",
-          __FUNCTION__, displayId);
-    return HWC3::Error::NoResources;
+  // SurfaceFlinger cycles through a few slots, so after the first frames
+  // each client target is already a framebuffer and is flipped to as is.
+  buffer_handle_t buffer = display->getClientTarget().getBuffer();
+  ClientTargetSlot& slot =
+      displayInfo.clientTargetSlots[display->getClientTargetSlot()];
+  if (display->isClientTargetSlotReplaced() || slot.buffer != buffer ||
+      !slot.drmBuffer) {
+    auto [drmBufferCreateError, drmBuffer] = mDrmClient.create(buffer);
+    if (drmBufferCreateError != HWC3::Error::None) {
+      ALOGE("%s: display:%" PRIu64 " failed to create client target drm buffer",
+            __FUNCTION__, displayId);
+      slot = ClientTargetSlot{};
+      return HWC3::Error::NoResources;
+    }
+    slot.buffer = buffer;
+    slot.drmBuffer = std::move(drmBuffer);
   }
-  displayInfo.clientTargetDrmBuffer = std::move(drmBuffer);
+  displayInfo.clientTargetDrmBuffer = slot.drmBuffer;
 
   return HWC3::Error::None;
 }
@@ -69,8 +69,16 @@ class ClientFrameComposer : public FrameComposer {
   }
 
  private:
+  struct ClientTargetSlot {
+    // The handle |drmBuffer| was made for.
+    buffer_handle_t buffer = nullptr;
+    std::shared_ptr<DrmBuffer> drmBuffer;
+  };
+
   struct DisplayInfo {
     std::shared_ptr<DrmBuffer> clientTargetDrmBuffer;
+    // By BufferQueue slot of the client target.
+    std::unordered_map<int32_t, ClientTargetSlot> clientTargetSlots;
   };
 
   std::unordered_map<int64_t, DisplayInfo> mDisplayInfos;
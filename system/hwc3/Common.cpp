@@ -18,6 +18,8 @@
 
 #include <android-base/properties.h>
 
+#include <algorithm>
+
 namespace aidl::android::hardware::graphics::composer3::impl {
 
 bool IsAutoDevice() {
@@ -49,6 +51,12 @@ bool IsInClientCompositionMode() {
   return mode == "client";
 }
 
+bool IsInVulkanCompositionMode() {
+  const std::string mode = ::android::base::GetProperty("ro.vendor.hwcomposer.mode", "");
+  DEBUG_LOG("%s: sysprop ro.vendor.hwcomposer.mode is %s", __FUNCTION__, mode.c_str());
+  return mode == "vulkan";
+}
+
 bool IsInGem5DisplayFinderMode() {
   const std::string mode =
     ::android::base::GetProperty("ro.vendor.hwcomposer.display_finder_mode", "");
@@ -73,6 +81,19 @@ bool IsInDrmDisplayFinderMode() {
   return mode == "drm";
 }
 
+uint32_t GetSwapchainDepth(int64_t displayId) {
+  constexpr uint32_t kMinDepth = 2;
+  constexpr uint32_t kMaxDepth = 8;
+  const uint32_t depth = ::android::base::GetUintProperty<uint32_t>(
+      "ro.vendor.hwcomposer.swapchain_depth", 3, kMaxDepth);
+  const uint32_t displayDepth = ::android::base::GetUintProperty<uint32_t>(
+      "ro.vendor.hwcomposer.display" + std::to_string(displayId) + ".swapchain_depth", depth,
+      kMaxDepth);
+  DEBUG_LOG("%s: display:%" PRId64 " swapchain depth is %" PRIu32, __FUNCTION__, displayId,
+            displayDepth);
+  return std::max(displayDepth, kMinDepth);
+}
+
 std::string toString(HWC3::Error error) {
   switch (error) {
     case HWC3::Error::None:
@@ -48,11 +48,17 @@ bool IsCuttlefishFoldable();
 
 bool IsInNoOpCompositionMode();
 bool IsInClientCompositionMode();
+bool IsInVulkanCompositionMode();
 
 bool IsInGem5DisplayFinderMode();
 bool IsInNoOpDisplayFinderMode();
 bool IsInDrmDisplayFinderMode();
 
+// Number of images composition cycles through on a display, from
+// ro.vendor.hwcomposer.display<id>.swapchain_depth or, failing that,
+// ro.vendor.hwcomposer.swapchain_depth.
+uint32_t GetSwapchainDepth(int64_t displayId);
+
 namespace HWC3 {
 enum class Error : int32_t {
   None = 0,
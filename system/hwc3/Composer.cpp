@@ -20,6 +20,7 @@
 #include <android/binder_ibinder_platform.h>
 
 #include "Common.h"
+#include "aemu/base/MemoryAccounting.h"
 
 namespace aidl::android::hardware::graphics::composer3::impl {
 
@@ -88,7 +89,8 @@ binder_status_t Composer::dump(int fd, const char** /*args*/,
                                uint32_t /*numArgs*/) {
   DEBUG_LOG("%s", __FUNCTION__);
 
-  std::string output("TODO");
+  std::string output("Graphics memory:\n");
+  output += ::android::base::guest::dumpGraphicsMemory();
 
   write(fd, output.c_str(), output.size());
   return STATUS_OK;
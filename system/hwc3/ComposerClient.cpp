@@ -906,7 +906,9 @@ void ComposerClient::executeDisplayCommandSetClientTarget(
   }
 
   error = display->setClientTarget(importedBuffer, clientTarget.buffer.fence,
-                                   clientTarget.dataspace, clientTarget.damage);
+                                   clientTarget.dataspace, clientTarget.damage,
+                                   clientTarget.buffer.slot,
+                                   clientTarget.buffer.handle.has_value());
   if (error != HWC3::Error::None) {
     LOG_DISPLAY_COMMAND_ERROR(display, error);
     mCommandResults->addError(error);
@@ -978,14 +980,33 @@ void ComposerClient::executeDisplayCommandPresentOrValidateDisplay(
     const std::optional<ClockMonotonicTimestamp> expectedPresentTime) {
   DEBUG_LOG("%s", __FUNCTION__);
 
-  // TODO: Support SKIP_VALIDATE.
-
   auto error = display->setExpectedPresentTime(expectedPresentTime);
   if (error != HWC3::Error::None) {
     LOG_DISPLAY_COMMAND_ERROR(display, error);
     mCommandResults->addError(error);
   }
 
+  // Nothing but buffer contents changed since the last validate, so its
+  // composition types still hold.
+  if (!mResources->mustValidateDisplay(display->getId()) &&
+      display->skipValidate()) {
+    ::android::base::unique_fd displayFence;
+    std::unordered_map<int64_t, ::android::base::unique_fd> layerFences;
+
+    error = display->present(&displayFence, &layerFences);
+    if (error != HWC3::Error::None) {
+      LOG_DISPLAY_COMMAND_ERROR(display, error);
+      mCommandResults->addError(error);
+    } else {
+      const int64_t displayId = display->getId();
+      mCommandResults->addPresentFence(displayId, std::move(displayFence));
+      mCommandResults->addReleaseFences(displayId, std::move(layerFences));
+      mCommandResults->addPresentOrValidateResult(
+          displayId, PresentOrValidate::Result::Presented);
+    }
+    return;
+  }
+
   DisplayChanges changes;
 
   error = display->validate(&changes);
@@ -1055,6 +1076,12 @@ void ComposerClient::executeLayerCommandSetLayerBuffer(Display* display,
     return;
   }
 
+  // A freed buffer's handle can come back for a new buffer imported into
+  // the slot, which has not been validated.
+  if (buffer.handle) {
+    layer->forgetValidatedBuffers();
+  }
+
   error = layer->setBuffer(importedBuffer, buffer.fence);
   if (error != HWC3::Error::None) {
     LOG_LAYER_COMMAND_ERROR(display, layer, error);
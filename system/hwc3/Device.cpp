@@ -25,6 +25,7 @@
 #include "GuestFrameComposer.h"
 #include "HostFrameComposer.h"
 #include "NoOpFrameComposer.h"
+#include "VulkanFrameComposer.h"
 
 ANDROID_SINGLETON_STATIC_INSTANCE(
     aidl::android::hardware::graphics::composer3::impl::Device);
@@ -100,6 +101,9 @@ HWC3::Error Device::getComposer(FrameComposer** outComposer) {
     } else if (IsInClientCompositionMode()) {
       DEBUG_LOG("%s: using ClientFrameComposer", __FUNCTION__);
       mComposer = std::make_unique<ClientFrameComposer>();
+    } else if (IsInVulkanCompositionMode()) {
+      DEBUG_LOG("%s: using VulkanFrameComposer", __FUNCTION__);
+      mComposer = std::make_unique<VulkanFrameComposer>();
     } else if (shouldUseGuestComposer()) {
       DEBUG_LOG("%s: using GuestFrameComposer", __FUNCTION__);
       mComposer = std::make_unique<GuestFrameComposer>();
@@ -113,6 +117,13 @@ HWC3::Error Device::getComposer(FrameComposer** outComposer) {
     }
 
     HWC3::Error error = mComposer->init();
+    if (error != HWC3::Error::None && IsInVulkanCompositionMode()) {
+      // Without a usable Vulkan driver, compose on the CPU instead.
+      ALOGE("%s failed to init VulkanFrameComposer, using GuestFrameComposer",
+            __FUNCTION__);
+      mComposer = std::make_unique<GuestFrameComposer>();
+      error = mComposer->init();
+    }
     if (error != HWC3::Error::None) {
       ALOGE("%s failed to init FrameComposer", __FUNCTION__);
       return error;
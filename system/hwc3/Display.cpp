@@ -153,6 +153,7 @@ HWC3::Error Display::updateParameters(
     mEdid = *edid;
   }
 
+  mValidated = false;
   return HWC3::Error::None;
 }
 
@@ -167,6 +168,7 @@ HWC3::Error Display::createLayer(int64_t* outLayerId) {
   DEBUG_LOG("%s: created layer:%" PRId64, __FUNCTION__, layerId);
 
   mLayers.emplace(layerId, std::move(layer));
+  mValidated = false;
 
   *outLayerId = layerId;
 
@@ -193,6 +195,7 @@ HWC3::Error Display::destroyLayer(int64_t layerId) {
                        mOrderedLayers.end());
 
   mLayers.erase(it);
+  mValidated = false;
 
   DEBUG_LOG("%s: destroyed layer:%" PRId64, __FUNCTION__, layerId);
   return HWC3::Error::None;
@@ -379,14 +382,28 @@ HWC3::Error Display::getReadbackBufferAttributes(
   outAttributes->format = common::PixelFormat::RGBA_8888;
   outAttributes->dataspace = common::Dataspace::UNKNOWN;
 
-  return HWC3::Error::Unsupported;
+  if (mComposer == nullptr || !mComposer->supportsReadback()) {
+    return HWC3::Error::Unsupported;
+  }
+  return HWC3::Error::None;
 }
 
 HWC3::Error Display::getReadbackBufferFence(
-    ndk::ScopedFileDescriptor* /*outAcquireFence*/) {
+    ndk::ScopedFileDescriptor* outAcquireFence) {
   DEBUG_LOG("%s: display:%" PRId64, __FUNCTION__, mId);
 
-  return HWC3::Error::Unsupported;
+  if (mComposer == nullptr || !mComposer->supportsReadback()) {
+    return HWC3::Error::Unsupported;
+  }
+
+  // The copy runs on a worker and has no fence of its own; it is waited for
+  // here, by the client that asked for it, rather than on present.
+  HWC3::Error error = mComposer->waitForReadback(this);
+  if (error != HWC3::Error::None) {
+    return error;
+  }
+  *outAcquireFence = ndk::ScopedFileDescriptor();
+  return HWC3::Error::None;
 }
 
 HWC3::Error Display::getRenderIntents(ColorMode mode,
@@ -493,6 +510,7 @@ HWC3::Error Display::setActiveConfigWithConstraints(
   }
 
   mActiveConfigId = configId;
+  mValidated = false;
 
   if (mComposer == nullptr) {
     ALOGE("%s: display:%" PRId64 " missing composer", __FUNCTION__, mId);
@@ -642,6 +660,7 @@ HWC3::Error Display::setColorMode(ColorMode mode, RenderIntent intent) {
   }
 
   mActiveColorMode = mode;
+  mValidated = false;
   return HWC3::Error::None;
 }
 
@@ -697,6 +716,7 @@ HWC3::Error Display::setPowerMode(PowerMode mode) {
   }
 
   mPowerMode = mode;
+  mValidated = false;
   return HWC3::Error::None;
 }
 
@@ -706,7 +726,10 @@ HWC3::Error Display::setReadbackBuffer(const buffer_handle_t buffer,
 
   mReadbackBuffer.set(buffer, fence);
 
-  return HWC3::Error::Unsupported;
+  if (mComposer == nullptr || !mComposer->supportsReadback()) {
+    return HWC3::Error::Unsupported;
+  }
+  return HWC3::Error::None;
 }
 
 HWC3::Error Display::setVsyncEnabled(bool enabled) {
@@ -739,9 +762,25 @@ HWC3::Error Display::setColorTransform(
 
   std::unique_lock<std::recursive_mutex> lock(mStateMutex);
 
-  auto& colorTransform = mColorTransform.emplace();
-  std::copy_n(transformMatrix.data(), colorTransform.size(),
-              colorTransform.begin());
+  std::optional<std::array<float, 16>> colorTransform;
+  colorTransform.emplace();
+  std::copy_n(transformMatrix.data(), colorTransform->size(),
+              colorTransform->begin());
+  // The identity is kept as no transform, so that the composers neither
+  // spend a pass on it nor fall back to client composition for it.
+  static constexpr std::array<float, 16> kIdentity = {
+      1.0f, 0.0f, 0.0f, 0.0f,  //
+      0.0f, 1.0f, 0.0f, 0.0f,  //
+      0.0f, 0.0f, 1.0f, 0.0f,  //
+      0.0f, 0.0f, 0.0f, 1.0f,  //
+  };
+  if (*colorTransform == kIdentity) {
+    colorTransform.reset();
+  }
+  if (mColorTransform != colorTransform) {
+    mColorTransform = colorTransform;
+    mValidated = false;
+  }
 
   return HWC3::Error::None;
 }
@@ -762,12 +801,15 @@ HWC3::Error Display::setBrightness(float brightness) {
 HWC3::Error Display::setClientTarget(
     buffer_handle_t buffer, const ndk::ScopedFileDescriptor& fence,
     common::Dataspace /*dataspace*/,
-    const std::vector<common::Rect>& /*damage*/) {
+    const std::vector<common::Rect>& /*damage*/, int32_t slot,
+    bool slotReplaced) {
   DEBUG_LOG("%s: display:%" PRId64, __FUNCTION__, mId);
 
   std::unique_lock<std::recursive_mutex> lock(mStateMutex);
 
   mClientTarget.set(buffer, fence);
+  mClientTargetSlot = slot;
+  mClientTargetSlotReplaced = slotReplaced;
 
   mComposer->onDisplayClientTargetSet(this);
   return HWC3::Error::None;
@@ -805,6 +847,7 @@ HWC3::Error Display::validate(DisplayChanges* outChanges) {
   std::unique_lock<std::recursive_mutex> lock(mStateMutex);
 
   mPendingChanges.reset();
+  mValidated = false;
 
   mOrderedLayers.clear();
   mOrderedLayers.reserve(mLayers.size());
@@ -840,6 +883,7 @@ HWC3::Error Display::validate(DisplayChanges* outChanges) {
     mPresentFlowState = PresentFlowState::WAITING_FOR_PRESENT;
     DEBUG_LOG("%s: display:%" PRId64 " now WAITING_FOR_PRESENT", __FUNCTION__,
               mId);
+    onValidated();
   }
 
   *outChanges = mPendingChanges;
@@ -885,10 +929,41 @@ HWC3::Error Display::acceptChanges() {
   mPresentFlowState = PresentFlowState::WAITING_FOR_PRESENT;
   DEBUG_LOG("%s: display:%" PRId64 " now WAITING_FOR_PRESENT", __FUNCTION__,
             mId);
+  onValidated();
 
   return HWC3::Error::None;
 }
 
+bool Display::skipValidate() {
+  DEBUG_LOG("%s: display:%" PRId64, __FUNCTION__, mId);
+
+  std::unique_lock<std::recursive_mutex> lock(mStateMutex);
+
+  if (!mValidated ||
+      mPresentFlowState != PresentFlowState::WAITING_FOR_VALIDATE) {
+    return false;
+  }
+  // Client composed layers need SurfaceFlinger to draw a new client target.
+  for (const Layer* layer : mOrderedLayers) {
+    if (layer->getCompositionType() == Composition::CLIENT ||
+        !layer->isValidated()) {
+      return false;
+    }
+  }
+
+  mPresentFlowState = PresentFlowState::WAITING_FOR_PRESENT;
+  DEBUG_LOG("%s: display:%" PRId64 " now WAITING_FOR_PRESENT", __FUNCTION__,
+            mId);
+  return true;
+}
+
+void Display::onValidated() {
+  mValidated = true;
+  for (Layer* layer : mOrderedLayers) {
+    layer->onValidated();
+  }
+}
+
 HWC3::Error Display::present(
     ::android::base::unique_fd* outDisplayFence,
     std::unordered_map<int64_t, ::android::base::unique_fd>* outLayerFences) {
@@ -924,7 +999,48 @@ HWC3::Error Display::present(
     return HWC3::Error::NoResources;
   }
 
-  return mComposer->presentDisplay(this, outDisplayFence, outLayerFences);
+  // Composition starts as late as still makes the vsync the frame is meant
+  // for, so that the frame does not reach the display before SurfaceFlinger
+  // expects it to. The state lock is not held meanwhile so that other calls,
+  // such as dump, are not held up.
+  const std::optional<TimePoint> expectedPresentTime = mExpectedPresentTime;
+  mExpectedPresentTime.reset();
+  if (expectedPresentTime) {
+    const TimePoint compositionStart =
+        mVsyncThread.getCompositionStartTime(*expectedPresentTime);
+    if (compositionStart > now()) {
+      ATRACE_NAME("waitForCompositionStart");
+      lock.unlock();
+      std::this_thread::sleep_until(compositionStart);
+      lock.lock();
+    }
+  }
+
+  const TimePoint composeStart = now();
+  HWC3::Error error =
+      mComposer->presentDisplay(this, outDisplayFence, outLayerFences);
+  const TimePoint composeEnd = now();
+
+  // A readback buffer is only for the frame presented after it was set.
+  if (error == HWC3::Error::None && mReadbackBuffer.getBuffer() != nullptr &&
+      mComposer->supportsReadback()) {
+    error = mComposer->queueReadback(this, mReadbackBuffer.getBuffer(),
+                                     mReadbackBuffer.getFence());
+    if (error != HWC3::Error::None) {
+      ALOGE("%s: display:%" PRId64 " failed to queue readback", __FUNCTION__,
+            mId);
+    }
+  }
+  mReadbackBuffer.set(nullptr, ndk::ScopedFileDescriptor());
+
+  ::android::base::unique_fd presentFence;
+  if (error == HWC3::Error::None && outDisplayFence->ok()) {
+    presentFence.reset(dup(outDisplayFence->get()));
+  }
+  mVsyncThread.onFramePresented(composeStart, composeEnd, expectedPresentTime,
+                                std::move(presentFence));
+
+  return error;
 }
 
 bool Display::hasConfig(int32_t configId) const {
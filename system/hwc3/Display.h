@@ -126,16 +126,22 @@ class Display {
   HWC3::Error setIdleTimerEnabled(int32_t timeoutMs);
   HWC3::Error setColorTransform(const std::vector<float>& transform);
   HWC3::Error setBrightness(float brightness);
+  // |slotReplaced| is set when |buffer| was just imported into |slot|,
+  // whose earlier buffer is gone.
   HWC3::Error setClientTarget(buffer_handle_t buffer,
                               const ndk::ScopedFileDescriptor& fence,
                               common::Dataspace dataspace,
-                              const std::vector<common::Rect>& damage);
+                              const std::vector<common::Rect>& damage,
+                              int32_t slot, bool slotReplaced);
   HWC3::Error setOutputBuffer(buffer_handle_t buffer,
                               const ndk::ScopedFileDescriptor& fence);
   HWC3::Error setExpectedPresentTime(
       const std::optional<ClockMonotonicTimestamp>& expectedPresentTime);
   HWC3::Error validate(DisplayChanges* outChanges);
   HWC3::Error acceptChanges();
+  // Goes straight to present if the last validate still holds, which is
+  // when only the contents of the layers' buffers have changed since.
+  bool skipValidate();
   HWC3::Error present(
       ::android::base::unique_fd* outDisplayFence,
       std::unordered_map<int64_t, ::android::base::unique_fd>* outLayerFences);
@@ -149,8 +155,12 @@ class Display {
 
   bool hasColorTransform() const { return mColorTransform.has_value(); }
   std::array<float, 16> getColorTransform() const { return *mColorTransform; }
+  // Whether the next present is to be read back.
+  bool hasReadbackBuffer() const { return mReadbackBuffer.getBuffer() != nullptr; }
 
   FencedBuffer& getClientTarget() { return mClientTarget; }
+  int32_t getClientTargetSlot() const { return mClientTargetSlot; }
+  bool isClientTargetSlotReplaced() const { return mClientTargetSlotReplaced; }
   buffer_handle_t waitAndGetClientTargetBuffer();
 
   const std::vector<Layer*>& getOrderedLayers() { return mOrderedLayers; }
@@ -162,6 +172,7 @@ class Display {
   std::optional<int32_t> getBootConfigId();
 
   void setLegacyEdid();
+  void onValidated();
 
   // The state of this display should only be modified from
   // SurfaceFlinger's main loop, with the exception of when dump is
@@ -175,6 +186,8 @@ class Display {
   PowerMode mPowerMode = PowerMode::OFF;
   VsyncThread mVsyncThread;
   FencedBuffer mClientTarget;
+  int32_t mClientTargetSlot = 0;
+  bool mClientTargetSlotReplaced = true;
   FencedBuffer mReadbackBuffer;
   // Will only be non-null after the Display has been validated and
   // before it has been accepted.
@@ -185,6 +198,9 @@ class Display {
   };
   PresentFlowState mPresentFlowState = PresentFlowState::WAITING_FOR_VALIDATE;
   DisplayChanges mPendingChanges;
+  // Whether the last validate, with its changes accepted, still holds for
+  // the display's own state and its set of layers.
+  bool mValidated = false;
   std::optional<TimePoint> mExpectedPresentTime;
   std::unordered_map<int64_t, std::unique_ptr<Layer>> mLayers;
   // Ordered layers available after validate().
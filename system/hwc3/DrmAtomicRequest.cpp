@@ -43,10 +43,20 @@ bool DrmAtomicRequest::Set(uint32_t objectId, const DrmProperty& prop, uint64_t
     return true;
 }
 
-bool DrmAtomicRequest::Commit(::android::base::borrowed_fd drmFd) {
+bool DrmAtomicRequest::Commit(::android::base::borrowed_fd drmFd, bool nonBlocking) {
     constexpr const uint32_t kCommitFlags = DRM_MODE_ATOMIC_ALLOW_MODESET;
 
-    int ret = drmModeAtomicCommit(drmFd.get(), mRequest, kCommitFlags, 0);
+    int ret = -1;
+    if (nonBlocking) {
+        ret = drmModeAtomicCommit(drmFd.get(), mRequest, kCommitFlags | DRM_MODE_ATOMIC_NONBLOCK,
+                                  0);
+        if (ret && errno == EBUSY) {
+            DEBUG_LOG("%s: previous commit still pending, committing blocking", __FUNCTION__);
+            ret = drmModeAtomicCommit(drmFd.get(), mRequest, kCommitFlags, 0);
+        }
+    } else {
+        ret = drmModeAtomicCommit(drmFd.get(), mRequest, kCommitFlags, 0);
+    }
     if (ret) {
         ALOGE("%s:%d: atomic commit failed: %s\n", __FUNCTION__, __LINE__, strerror(errno));
         return false;
@@ -55,4 +65,17 @@ bool DrmAtomicRequest::Commit(::android::base::borrowed_fd drmFd) {
     return true;
 }
 
+bool DrmAtomicRequest::Test(::android::base::borrowed_fd drmFd) {
+    constexpr const uint32_t kTestFlags =
+        DRM_MODE_ATOMIC_TEST_ONLY | DRM_MODE_ATOMIC_ALLOW_MODESET;
+
+    int ret = drmModeAtomicCommit(drmFd.get(), mRequest, kTestFlags, 0);
+    if (ret) {
+        DEBUG_LOG("%s: atomic test failed: %s", __FUNCTION__, strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
 }  // namespace aidl::android::hardware::graphics::composer3::impl
@@ -39,7 +39,13 @@ class DrmAtomicRequest {
 
     bool Set(uint32_t objectId, const DrmProperty& prop, uint64_t value);
 
-    bool Commit(::android::base::borrowed_fd drmFd);
+    // A non-blocking commit returns before the update reaches the display;
+    // the CRTC out-fence signals once it has. It falls back to a blocking
+    // commit while an earlier non-blocking one is still in flight.
+    bool Commit(::android::base::borrowed_fd drmFd, bool nonBlocking = false);
+
+    // Checks whether the kernel would accept the request without applying it.
+    bool Test(::android::base::borrowed_fd drmFd);
 
    private:
     DrmAtomicRequest(drmModeAtomicReqPtr request) : mRequest(request) {}
@@ -18,6 +18,7 @@
 
 #include <cros_gralloc_handle.h>
 #include <android-base/properties.h>
+#include <ui/GraphicBufferMapper.h>
 
 using ::android::base::guest::AutoReadLock;
 using ::android::base::guest::AutoWriteLock;
@@ -26,6 +27,12 @@ using ::android::base::guest::ReadWriteLock;
 namespace aidl::android::hardware::graphics::composer3::impl {
 
 DrmClient::~DrmClient() {
+    // Cached framebuffers are removed through mFd.
+    {
+        std::lock_guard<std::mutex> lock(mBufferCacheMutex);
+        mBufferCache.clear();
+    }
+
     if (mFd > 0) {
         drmDropMaster(mFd.get());
     }
@@ -234,10 +241,43 @@ bool DrmClient::loadDrmDisplays() {
         mDisplays.push_back(std::move(display));
     }
 
+    // Planes left over are handed out to the displays for layers that can be
+    // scanned out directly instead of being composed.
+    for (std::unique_ptr<DrmPlane>& plane : planes) {
+        if (!plane->isOverlay() && !plane->isCursor()) {
+            continue;
+        }
+        for (auto& display : mDisplays) {
+            if (display->addExtraPlane(plane)) {
+                break;
+            }
+        }
+    }
+
     return true;
 }
 
 std::tuple<HWC3::Error, std::shared_ptr<DrmBuffer>> DrmClient::create(
+    const native_handle_t* handle) {
+    uint64_t bufferId = 0;
+    const bool cacheable = handle != nullptr && ::android::GraphicBufferMapper::get().getBufferId(
+                                                    handle, &bufferId) == ::android::OK;
+    if (cacheable) {
+        std::lock_guard<std::mutex> lock(mBufferCacheMutex);
+        if (std::shared_ptr<DrmBuffer>* cached = mBufferCache.get(bufferId)) {
+            return std::make_tuple(HWC3::Error::None, *cached);
+        }
+    }
+
+    auto [error, buffer] = createDrmBuffer(handle);
+    if (error == HWC3::Error::None && cacheable) {
+        std::lock_guard<std::mutex> lock(mBufferCacheMutex);
+        mBufferCache.set(bufferId, std::shared_ptr<DrmBuffer>(buffer));
+    }
+    return std::make_tuple(error, std::move(buffer));
+}
+
+std::tuple<HWC3::Error, std::shared_ptr<DrmBuffer>> DrmClient::createDrmBuffer(
     const native_handle_t* handle) {
     cros_gralloc_handle* crosHandle = (cros_gralloc_handle*)handle;
     if (crosHandle == nullptr) {
@@ -351,7 +391,7 @@ bool DrmClient::handleHotplug() {
 
 std::tuple<HWC3::Error, ::android::base::unique_fd> DrmClient::flushToDisplay(
     int displayId, const std::shared_ptr<DrmBuffer>& buffer,
-    ::android::base::borrowed_fd inSyncFd) {
+    ::android::base::borrowed_fd inSyncFd, const std::vector<DrmPlaneLayer>& planeLayers) {
     ATRACE_CALL();
 
     if (!buffer->mDrmFramebuffer) {
@@ -360,7 +400,19 @@ std::tuple<HWC3::Error, ::android::base::unique_fd> DrmClient::flushToDisplay(
     }
 
     AutoReadLock lock(mDisplaysMutex);
-    return mDisplays[displayId]->flush(mFd, inSyncFd, buffer);
+    return mDisplays[displayId]->flush(mFd, inSyncFd, buffer, planeLayers);
+}
+
+size_t DrmClient::getExtraPlaneCount(int displayId) const {
+    AutoReadLock lock(mDisplaysMutex);
+    return mDisplays[displayId]->getExtraPlaneCount();
+}
+
+bool DrmClient::testPlaneLayers(int displayId, const std::vector<DrmPlaneLayer>& planeLayers) {
+    ATRACE_CALL();
+
+    AutoReadLock lock(mDisplaysMutex);
+    return mDisplays[displayId]->testPlaneLayers(mFd, planeLayers);
 }
 
 std::optional<std::vector<uint8_t>> DrmClient::getEdid(uint32_t displayId) {
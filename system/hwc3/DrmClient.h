@@ -20,6 +20,7 @@
 #include <cutils/native_handle.h>
 
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -75,11 +76,22 @@ class DrmClient {
 
     uint32_t refreshRate() const { return mDisplays[0]->getRefreshRateUint(); }
 
+    // Returns a framebuffer for the given gralloc buffer. Framebuffers are
+    // cached on the gralloc buffer id, so presenting the same buffers again
+    // does not create new ones.
     std::tuple<HWC3::Error, std::shared_ptr<DrmBuffer>> create(const native_handle_t* handle);
 
+    // Presents `buffer` on the display's main plane and each of `planeLayers`
+    // on a plane of its own above it.
     std::tuple<HWC3::Error, ::android::base::unique_fd> flushToDisplay(
         int display, const std::shared_ptr<DrmBuffer>& buffer,
-        ::android::base::borrowed_fd inWaitSyncFd);
+        ::android::base::borrowed_fd inWaitSyncFd,
+        const std::vector<DrmPlaneLayer>& planeLayers = {});
+
+    size_t getExtraPlaneCount(int display) const;
+
+    // Returns true if the next flushToDisplay() can present `planeLayers`.
+    bool testPlaneLayers(int display, const std::vector<DrmPlaneLayer>& planeLayers);
 
     std::optional<std::vector<uint8_t>> getEdid(uint32_t id);
 
@@ -95,6 +107,9 @@ class DrmClient {
 
     bool loadDrmDisplays();
 
+    std::tuple<HWC3::Error, std::shared_ptr<DrmBuffer>> createDrmBuffer(
+        const native_handle_t* handle);
+
     // Drm device.
     ::android::base::unique_fd mFd;
 
@@ -104,6 +119,12 @@ class DrmClient {
     std::optional<HotplugCallback> mHotplugCallback;
 
     std::unique_ptr<DrmEventListener> mDrmEventListener;
+
+    // Enough for the swapchains and client targets of a few displays, plus
+    // layers scanned out on planes of their own.
+    static constexpr const std::size_t kMaxCachedBuffers = 16;
+    std::mutex mBufferCacheMutex;
+    LruCache<uint64_t, std::shared_ptr<DrmBuffer>> mBufferCache{kMaxCachedBuffers};
 };
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
@@ -16,11 +16,15 @@
 
 #include "DrmDisplay.h"
 
+#include <sync/sync.h>
+
 #include "DrmAtomicRequest.h"
 
 namespace aidl::android::hardware::graphics::composer3::impl {
 namespace {
 
+constexpr const int kFlushFenceWaitTimeoutMs = 3000;
+
 template <typename T>
 uint64_t addressAsUint(T* pointer) {
     return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer));
@@ -68,9 +72,92 @@ std::unique_ptr<DrmDisplay> DrmDisplay::create(uint32_t id, std::unique_ptr<DrmC
         new DrmDisplay(id, std::move(connector), std::move(crtc), std::move(plane)));
 }
 
+bool DrmDisplay::addExtraPlane(std::unique_ptr<DrmPlane>& plane) {
+    if (!plane->isCompatibleWith(*mCrtc)) {
+        return false;
+    }
+
+    DEBUG_LOG("%s: display:%" PRIu32 " using extra plane:%" PRIu32, __FUNCTION__, mId,
+              plane->getId());
+    mExtraPlanes.push_back(std::move(plane));
+    mPreviousExtraPlaneBuffers.push_back(nullptr);
+    return true;
+}
+
+bool DrmDisplay::setPlanes(DrmAtomicRequest& request, ::android::base::borrowed_fd inSyncFd,
+                           const DrmBuffer& buffer, const std::vector<DrmPlaneLayer>& planeLayers,
+                           std::vector<std::shared_ptr<DrmBuffer>>* outExtraPlaneBuffers) {
+    bool okay = true;
+    okay &= request.Set(mPlane->getId(), mPlane->getCrtcProperty(), mCrtc->getId());
+    okay &= request.Set(mPlane->getId(), mPlane->getInFenceProperty(), inSyncFd.get());
+    okay &= request.Set(mPlane->getId(), mPlane->getFbProperty(), *buffer.mDrmFramebuffer);
+    okay &= request.Set(mPlane->getId(), mPlane->getCrtcXProperty(), 0);
+    okay &= request.Set(mPlane->getId(), mPlane->getCrtcYProperty(), 0);
+    okay &= request.Set(mPlane->getId(), mPlane->getCrtcWProperty(), buffer.mWidth);
+    okay &= request.Set(mPlane->getId(), mPlane->getCrtcHProperty(), buffer.mHeight);
+    okay &= request.Set(mPlane->getId(), mPlane->getSrcXProperty(), 0);
+    okay &= request.Set(mPlane->getId(), mPlane->getSrcYProperty(), 0);
+    okay &= request.Set(mPlane->getId(), mPlane->getSrcWProperty(), buffer.mWidth << 16);
+    okay &= request.Set(mPlane->getId(), mPlane->getSrcHProperty(), buffer.mHeight << 16);
+
+    outExtraPlaneBuffers->assign(mExtraPlanes.size(), nullptr);
+
+    auto findFreePlane = [&](const DrmPlaneLayer& planeLayer, bool cursorPlane) {
+        for (size_t i = 0; i < mExtraPlanes.size(); i++) {
+            const DrmPlane& plane = *mExtraPlanes[i];
+            if ((*outExtraPlaneBuffers)[i] == nullptr && plane.isCursor() == cursorPlane &&
+                plane.supportsFormat(planeLayer.buffer->mDrmFormat)) {
+                return i;
+            }
+        }
+        return mExtraPlanes.size();
+    };
+
+    for (const DrmPlaneLayer& planeLayer : planeLayers) {
+        if (!planeLayer.buffer || !planeLayer.buffer->mDrmFramebuffer) {
+            return false;
+        }
+
+        size_t planeIndex = findFreePlane(planeLayer, planeLayer.cursor);
+        if (planeIndex == mExtraPlanes.size() && planeLayer.cursor) {
+            planeIndex = findFreePlane(planeLayer, /*cursorPlane=*/false);
+        }
+        if (planeIndex == mExtraPlanes.size()) {
+            DEBUG_LOG("%s: display:%" PRIu32 " has no free plane for a layer", __FUNCTION__,
+                      mId);
+            return false;
+        }
+        (*outExtraPlaneBuffers)[planeIndex] = planeLayer.buffer;
+
+        const DrmPlane& plane = *mExtraPlanes[planeIndex];
+        const DrmBuffer& planeBuffer = *planeLayer.buffer;
+        okay &= request.Set(plane.getId(), plane.getCrtcProperty(), mCrtc->getId());
+        okay &= request.Set(plane.getId(), plane.getInFenceProperty(), planeLayer.inSyncFd);
+        okay &= request.Set(plane.getId(), plane.getFbProperty(), *planeBuffer.mDrmFramebuffer);
+        okay &= request.Set(plane.getId(), plane.getCrtcXProperty(), planeLayer.crtcX);
+        okay &= request.Set(plane.getId(), plane.getCrtcYProperty(), planeLayer.crtcY);
+        okay &= request.Set(plane.getId(), plane.getCrtcWProperty(), planeLayer.crtcW);
+        okay &= request.Set(plane.getId(), plane.getCrtcHProperty(), planeLayer.crtcH);
+        okay &= request.Set(plane.getId(), plane.getSrcXProperty(), planeLayer.srcX);
+        okay &= request.Set(plane.getId(), plane.getSrcYProperty(), planeLayer.srcY);
+        okay &= request.Set(plane.getId(), plane.getSrcWProperty(), planeLayer.srcW);
+        okay &= request.Set(plane.getId(), plane.getSrcHProperty(), planeLayer.srcH);
+    }
+
+    for (size_t i = 0; i < mExtraPlanes.size(); i++) {
+        if ((*outExtraPlaneBuffers)[i] == nullptr && mPreviousExtraPlaneBuffers[i] != nullptr) {
+            const DrmPlane& plane = *mExtraPlanes[i];
+            okay &= request.Set(plane.getId(), plane.getCrtcProperty(), 0);
+            okay &= request.Set(plane.getId(), plane.getFbProperty(), 0);
+        }
+    }
+
+    return okay;
+}
+
 std::tuple<HWC3::Error, ::android::base::unique_fd> DrmDisplay::flush(
     ::android::base::borrowed_fd drmFd, ::android::base::borrowed_fd inSyncFd,
-    const std::shared_ptr<DrmBuffer>& buffer) {
+    const std::shared_ptr<DrmBuffer>& buffer, const std::vector<DrmPlaneLayer>& planeLayers) {
     std::unique_ptr<DrmAtomicRequest> request = DrmAtomicRequest::create();
     if (!request) {
         ALOGE("%s: failed to create atomic request.", __FUNCTION__);
@@ -78,32 +165,71 @@ std::tuple<HWC3::Error, ::android::base::unique_fd> DrmDisplay::flush(
     }
 
     int flushFenceFd = -1;
+    std::vector<std::shared_ptr<DrmBuffer>> extraPlaneBuffers;
 
     bool okay = true;
     okay &=
         request->Set(mCrtc->getId(), mCrtc->getOutFenceProperty(), addressAsUint(&flushFenceFd));
-    okay &= request->Set(mPlane->getId(), mPlane->getCrtcProperty(), mCrtc->getId());
-    okay &= request->Set(mPlane->getId(), mPlane->getInFenceProperty(), inSyncFd.get());
-    okay &= request->Set(mPlane->getId(), mPlane->getFbProperty(), *buffer->mDrmFramebuffer);
-    okay &= request->Set(mPlane->getId(), mPlane->getCrtcXProperty(), 0);
-    okay &= request->Set(mPlane->getId(), mPlane->getCrtcYProperty(), 0);
-    okay &= request->Set(mPlane->getId(), mPlane->getCrtcWProperty(), buffer->mWidth);
-    okay &= request->Set(mPlane->getId(), mPlane->getCrtcHProperty(), buffer->mHeight);
-    okay &= request->Set(mPlane->getId(), mPlane->getSrcXProperty(), 0);
-    okay &= request->Set(mPlane->getId(), mPlane->getSrcYProperty(), 0);
-    okay &= request->Set(mPlane->getId(), mPlane->getSrcWProperty(), buffer->mWidth << 16);
-    okay &= request->Set(mPlane->getId(), mPlane->getSrcHProperty(), buffer->mHeight << 16);
+    okay &= setPlanes(*request, inSyncFd, *buffer, planeLayers, &extraPlaneBuffers);
 
-    okay &= request->Commit(drmFd);
+    // Commits are pipelined one frame deep: only the previous one may still be
+    // in flight when the next is made.
+    if (mPreviousFlushFence.ok()) {
+        ATRACE_NAME("waitForPreviousFlush");
+        if (sync_wait(mPreviousFlushFence.get(), kFlushFenceWaitTimeoutMs) < 0) {
+            ALOGW("%s: display:%" PRIu32 " timed out waiting for the previous flush",
+                  __FUNCTION__, mId);
+        }
+        mPreviousFlushFence.reset();
+    }
+    // The buffers from before the previous commit are off the display now.
+    mReleasingBuffers.clear();
+
+    okay &= request->Commit(drmFd, /*nonBlocking=*/true);
     if (!okay) {
         ALOGE("%s: failed to flush to display.", __FUNCTION__);
         return std::make_tuple(HWC3::Error::NoResources, ::android::base::unique_fd());
     }
 
+    // The buffers of the previous commit stay on the display until this one
+    // lands.
+    if (mPreviousBuffer) {
+        mReleasingBuffers.push_back(std::move(mPreviousBuffer));
+    }
+    for (std::shared_ptr<DrmBuffer>& extraPlaneBuffer : mPreviousExtraPlaneBuffers) {
+        if (extraPlaneBuffer) {
+            mReleasingBuffers.push_back(std::move(extraPlaneBuffer));
+        }
+    }
     mPreviousBuffer = buffer;
+    mPreviousExtraPlaneBuffers = std::move(extraPlaneBuffers);
+
+    ::android::base::unique_fd flushFence(flushFenceFd);
+    if (flushFence.ok()) {
+        mPreviousFlushFence.reset(dup(flushFence.get()));
+    }
 
     DEBUG_LOG("%s: submitted atomic update, flush fence:%d\n", __FUNCTION__, flushFenceFd);
-    return std::make_tuple(HWC3::Error::None, ::android::base::unique_fd(flushFenceFd));
+    return std::make_tuple(HWC3::Error::None, std::move(flushFence));
+}
+
+bool DrmDisplay::testPlaneLayers(::android::base::borrowed_fd drmFd,
+                                 const std::vector<DrmPlaneLayer>& planeLayers) {
+    if (!mPreviousBuffer || planeLayers.size() > mExtraPlanes.size()) {
+        return false;
+    }
+
+    std::unique_ptr<DrmAtomicRequest> request = DrmAtomicRequest::create();
+    if (!request) {
+        ALOGE("%s: failed to create atomic request.", __FUNCTION__);
+        return false;
+    }
+
+    std::vector<std::shared_ptr<DrmBuffer>> extraPlaneBuffers;
+    if (!setPlanes(*request, -1, *mPreviousBuffer, planeLayers, &extraPlaneBuffers)) {
+        return false;
+    }
+    return request->Test(drmFd);
 }
 
 bool DrmDisplay::onConnect(::android::base::borrowed_fd drmFd) {
@@ -142,13 +268,23 @@ bool DrmDisplay::onDisconnect(::android::base::borrowed_fd drmFd) {
     bool okay = true;
     okay &= request->Set(mPlane->getId(), mPlane->getCrtcProperty(), 0);
     okay &= request->Set(mPlane->getId(), mPlane->getFbProperty(), 0);
+    for (size_t i = 0; i < mExtraPlanes.size(); i++) {
+        if (mPreviousExtraPlaneBuffers[i] != nullptr) {
+            okay &= request->Set(mExtraPlanes[i]->getId(), mExtraPlanes[i]->getCrtcProperty(), 0);
+            okay &= request->Set(mExtraPlanes[i]->getId(), mExtraPlanes[i]->getFbProperty(), 0);
+        }
+    }
 
     okay &= request->Commit(drmFd);
     if (!okay) {
         ALOGE("%s: display:%" PRIu32 " failed to set mode", __FUNCTION__, mId);
     }
 
+    // The blocking commit above waited for any earlier one.
+    mPreviousFlushFence.reset();
+    mReleasingBuffers.clear();
     mPreviousBuffer.reset();
+    mPreviousExtraPlaneBuffers.assign(mExtraPlanes.size(), nullptr);
 
     return okay;
 }
@@ -25,8 +25,10 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common.h"
+#include "DrmAtomicRequest.h"
 #include "DrmBuffer.h"
 #include "DrmConnector.h"
 #include "DrmCrtc.h"
@@ -40,6 +42,24 @@ enum class DrmHotplugChange {
     kDisconnected,
 };
 
+// A buffer that is scanned out on a plane of its own, above the buffer on the
+// display's main plane.
+struct DrmPlaneLayer {
+    std::shared_ptr<DrmBuffer> buffer;
+    // Cursor layers prefer cursor planes, everything else needs an overlay plane.
+    bool cursor = false;
+    int32_t crtcX = 0;
+    int32_t crtcY = 0;
+    uint32_t crtcW = 0;
+    uint32_t crtcH = 0;
+    // The part of the buffer to scan out, in 16.16 fixed point.
+    uint32_t srcX = 0;
+    uint32_t srcY = 0;
+    uint32_t srcW = 0;
+    uint32_t srcH = 0;
+    int inSyncFd = -1;
+};
+
 class DrmDisplay {
    public:
     static std::unique_ptr<DrmDisplay> create(uint32_t id, std::unique_ptr<DrmConnector> connector,
@@ -61,9 +81,21 @@ class DrmDisplay {
 
     std::optional<std::vector<uint8_t>> getEdid() const { return mConnector->getEdid(); }
 
+    // Takes ownership of `plane` as a plane for layers besides the main one
+    // if it can be used with this display's CRTC.
+    bool addExtraPlane(std::unique_ptr<DrmPlane>& plane);
+
+    size_t getExtraPlaneCount() const { return mExtraPlanes.size(); }
+
     std::tuple<HWC3::Error, ::android::base::unique_fd> flush(
         ::android::base::borrowed_fd drmFd, ::android::base::borrowed_fd inWaitSyncFd,
-        const std::shared_ptr<DrmBuffer>& buffer);
+        const std::shared_ptr<DrmBuffer>& buffer,
+        const std::vector<DrmPlaneLayer>& planeLayers = {});
+
+    // Checks, without presenting anything, whether the given layers can be
+    // scanned out on the extra planes on top of the last presented buffer.
+    bool testPlaneLayers(::android::base::borrowed_fd drmFd,
+                         const std::vector<DrmPlaneLayer>& planeLayers);
 
     DrmHotplugChange checkAndHandleHotplug(::android::base::borrowed_fd drmFd);
 
@@ -75,6 +107,13 @@ class DrmDisplay {
           mCrtc(std::move(crtc)),
           mPlane(std::move(plane)) {}
 
+    // Sets up the main plane with `buffer` and an extra plane for each of the
+    // `planeLayers`, and turns off extra planes that are no longer used.
+    // Fills `outExtraPlaneBuffers` with the buffer each extra plane then shows.
+    bool setPlanes(DrmAtomicRequest& request, ::android::base::borrowed_fd inSyncFd,
+                   const DrmBuffer& buffer, const std::vector<DrmPlaneLayer>& planeLayers,
+                   std::vector<std::shared_ptr<DrmBuffer>>* outExtraPlaneBuffers);
+
     bool onConnect(::android::base::borrowed_fd drmFd);
 
     bool onDisconnect(::android::base::borrowed_fd drmFd);
@@ -87,6 +126,17 @@ class DrmDisplay {
     // The last presented buffer / DRM framebuffer is cached until
     // the next present to avoid toggling the display on and off.
     std::shared_ptr<DrmBuffer> mPreviousBuffer;
+
+    // Signals once the last non-blocking commit reached the display.
+    ::android::base::unique_fd mPreviousFlushFence;
+    // Buffers replaced by the last commit, kept until it has landed.
+    std::vector<std::shared_ptr<DrmBuffer>> mReleasingBuffers;
+
+    // Overlay and cursor planes that no other display took.
+    std::vector<std::unique_ptr<DrmPlane>> mExtraPlanes;
+    // The buffers last presented on each of mExtraPlanes, or nullptr for the
+    // planes that are off.
+    std::vector<std::shared_ptr<DrmBuffer>> mPreviousExtraPlaneBuffers;
 };
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
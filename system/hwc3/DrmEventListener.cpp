@@ -19,6 +19,8 @@
 #include <linux/netlink.h>
 #include <sys/socket.h>
 
+#include "aemu/base/threads/AndroidThreadPolicy.h"
+
 namespace aidl::android::hardware::graphics::composer3::impl {
 
 std::unique_ptr<DrmEventListener> DrmEventListener::create(::android::base::borrowed_fd drmFd,
@@ -61,6 +63,8 @@ bool DrmEventListener::init(::android::base::borrowed_fd drmFd) {
 }
 
 void DrmEventListener::threadLoop() {
+    ::android::base::guest::applyThreadPolicy(::android::base::guest::ThreadRole::DrmEvents);
+
     int ret;
     do {
         ret = select(mMaxMonitoredFd + 1, &mMonitoredFds, NULL, NULL, NULL);
@@ -16,6 +16,8 @@
 
 #include "DrmPlane.h"
 
+#include <algorithm>
+
 namespace aidl::android::hardware::graphics::composer3::impl {
 
 std::unique_ptr<DrmPlane> DrmPlane::create(::android::base::borrowed_fd drmFd, uint32_t planeId) {
@@ -30,6 +32,7 @@ std::unique_ptr<DrmPlane> DrmPlane::create(::android::base::borrowed_fd drmFd, u
 
     drmModePlanePtr drmPlane = drmModeGetPlane(drmFd.get(), planeId);
     plane->mPossibleCrtcsMask = drmPlane->possible_crtcs;
+    plane->mFormats.assign(drmPlane->formats, drmPlane->formats + drmPlane->count_formats);
     drmModeFreePlane(drmPlane);
 
     return plane;
@@ -39,6 +42,12 @@ bool DrmPlane::isPrimary() const { return mType.getValue() == DRM_PLANE_TYPE_PRI
 
 bool DrmPlane::isOverlay() const { return mType.getValue() == DRM_PLANE_TYPE_OVERLAY; }
 
+bool DrmPlane::isCursor() const { return mType.getValue() == DRM_PLANE_TYPE_CURSOR; }
+
+bool DrmPlane::supportsFormat(uint32_t drmFormat) const {
+    return std::find(mFormats.begin(), mFormats.end(), drmFormat) != mFormats.end();
+}
+
 bool DrmPlane::isCompatibleWith(const DrmCrtc& crtc) {
     return ((0x1 << crtc.mIndexInResourcesArray) & mPossibleCrtcsMask);
 }
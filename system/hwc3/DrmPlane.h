@@ -25,6 +25,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common.h"
 #include "DrmCrtc.h"
@@ -41,6 +42,9 @@ class DrmPlane {
 
     bool isPrimary() const;
     bool isOverlay() const;
+    bool isCursor() const;
+
+    bool supportsFormat(uint32_t drmFormat) const;
 
     bool isCompatibleWith(const DrmCrtc& crtc);
 
@@ -63,6 +67,8 @@ class DrmPlane {
 
     uint32_t mPossibleCrtcsMask = 0;
 
+    std::vector<uint32_t> mFormats;
+
     DrmProperty mCrtc;
     DrmProperty mInFenceFd;
     DrmProperty mFb;
@@ -18,9 +18,21 @@
 
 #include <log/log.h>
 #include <sync/sync.h>
+#include <time.h>
 #include <ui/GraphicBufferAllocator.h>
 
+#include <algorithm>
+
 namespace aidl::android::hardware::graphics::composer3::impl {
+namespace {
+
+uint64_t nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+}  // namespace
 
 DrmSwapchain::Image::Image(const native_handle_t* buffer, std::shared_ptr<DrmBuffer> drmBuffer)
     : mBuffer(buffer), mDrmBuffer(drmBuffer) {}
@@ -28,7 +40,9 @@ DrmSwapchain::Image::Image(const native_handle_t* buffer, std::shared_ptr<DrmBuf
 DrmSwapchain::Image::Image(Image&& other)
     : mBuffer(std::move(other.mBuffer)),
       mDrmBuffer(std::move(other.mDrmBuffer)),
-      mLastUseFenceFd(std::move(other.mLastUseFenceFd)) {
+      mLastUseFenceFd(std::move(other.mLastUseFenceFd)),
+      mLastAcquired(other.mLastAcquired),
+      mStats(other.mStats) {
     other.mBuffer = 0;
 }
 
@@ -38,7 +52,13 @@ int DrmSwapchain::Image::wait() {
     if (!mLastUseFenceFd.ok()) {
         return 0;
     }
+    const uint64_t start = nowNs();
     int err = sync_wait(mLastUseFenceFd.get(), 3000);
+    if (mStats) {
+        const uint64_t waitNs = nowNs() - start;
+        mStats->totalWaitNs += waitNs;
+        mStats->maxWaitNs = std::max(mStats->maxWaitNs, waitNs);
+    }
     mLastUseFenceFd = ::android::base::unique_fd();
     if (err < 0 && errno == ETIME) {
         ALOGE("%s waited on fence %d for 3000 ms", __FUNCTION__, mLastUseFenceFd.get());
@@ -49,6 +69,17 @@ int DrmSwapchain::Image::wait() {
     return 0;
 }
 
+bool DrmSwapchain::Image::isReady() {
+    if (!mLastUseFenceFd.ok()) {
+        return true;
+    }
+    if (sync_wait(mLastUseFenceFd.get(), 0) < 0) {
+        return false;
+    }
+    mLastUseFenceFd = ::android::base::unique_fd();
+    return true;
+}
+
 void DrmSwapchain::Image::markAsInUse(::android::base::unique_fd useCompleteFenceFd) {
     mLastUseFenceFd = std::move(useCompleteFenceFd);
 }
@@ -86,12 +117,43 @@ std::unique_ptr<DrmSwapchain> DrmSwapchain::create(uint32_t width, uint32_t heig
     return std::unique_ptr<DrmSwapchain>(new DrmSwapchain(std::move(images)));
 }
 
-DrmSwapchain::DrmSwapchain(std::vector<Image> images) : mImages(std::move(images)) {}
+DrmSwapchain::DrmSwapchain(std::vector<Image> images) : mImages(std::move(images)) {
+    for (Image& image : mImages) {
+        image.mStats = &mStats;
+    }
+}
+
+DrmSwapchain::~DrmSwapchain() {
+    ALOGI("%s: %zu images, %" PRIu64 " acquisitions, %" PRIu64 " with all images in use, "
+          "%" PRIu64 " ms waited in total, %" PRIu64 " ms at most",
+          __FUNCTION__, mImages.size(), mStats.acquisitions, mStats.stalls,
+          mStats.totalWaitNs / 1000000, mStats.maxWaitNs / 1000000);
+}
 
 DrmSwapchain::Image* DrmSwapchain::getNextImage() {
-    auto index = (mLastUsedIndex + 1) % mImages.size();
-    mLastUsedIndex = index;
-    return &mImages[index];
+    int32_t oldest = -1;
+    int32_t oldestReady = -1;
+    for (uint32_t i = 0; i < mImages.size(); i++) {
+        if (i == mLastUsedIndex && mImages.size() > 1) {
+            continue;
+        }
+        const uint64_t acquired = mImages[i].mLastAcquired;
+        if (oldest < 0 || acquired < mImages[oldest].mLastAcquired) {
+            oldest = i;
+        }
+        if ((oldestReady < 0 || acquired < mImages[oldestReady].mLastAcquired) &&
+            mImages[i].isReady()) {
+            oldestReady = i;
+        }
+    }
+
+    ++mStats.acquisitions;
+    if (oldestReady < 0) {
+        ++mStats.stalls;
+    }
+    mLastUsedIndex = oldestReady >= 0 ? oldestReady : oldest;
+    mImages[mLastUsedIndex].mLastAcquired = mStats.acquisitions;
+    return &mImages[mLastUsedIndex];
 }
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
\ No newline at end of file
@@ -25,6 +25,14 @@ namespace aidl::android::hardware::graphics::composer3::impl {
 
 class DrmSwapchain {
    public:
+    struct Stats {
+        uint64_t acquisitions = 0;
+        // Acquisitions that found every image still in use.
+        uint64_t stalls = 0;
+        uint64_t totalWaitNs = 0;
+        uint64_t maxWaitNs = 0;
+    };
+
     class Image {
        public:
         Image() = delete;
@@ -37,21 +45,35 @@ class DrmSwapchain {
 
        private:
         Image(const native_handle_t*, std::shared_ptr<DrmBuffer>);
+        // Whether the last use is over, without waiting for it.
+        bool isReady();
         const native_handle_t* mBuffer = nullptr;
         std::shared_ptr<DrmBuffer> mDrmBuffer;
         ::android::base::unique_fd mLastUseFenceFd;
+        // When getNextImage() last returned this image, in acquisitions.
+        uint64_t mLastAcquired = 0;
+        Stats* mStats = nullptr;
 
         friend class DrmSwapchain;
     };
 
     static std::unique_ptr<DrmSwapchain> create(uint32_t width, uint32_t height, uint32_t usage,
                                                 DrmClient* client, uint32_t numImages = 3);
+    ~DrmSwapchain();
+
+    // Returns the least recently acquired image whose last use is over,
+    // or the least recently acquired one if none is, to be wait()ed on.
+    // The image acquired just before is never returned, as it may still
+    // be on screen. Every image is returned once before any is repeated.
     Image* getNextImage();
 
+    const Stats& getStats() const { return mStats; }
+
    private:
     DrmSwapchain(std::vector<Image> images);
     std::vector<Image> mImages;
     uint32_t mLastUsedIndex = 0;
+    Stats mStats;
 };
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
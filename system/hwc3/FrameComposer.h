@@ -70,6 +70,23 @@ class FrameComposer {
 
   virtual HWC3::Error onActiveConfigChange(Display* display) = 0;
 
+  // Copies of what presentDisplay() last put on a display, for composers that
+  // can make them. queueReadback() starts copying into `buffer` once
+  // `releaseFence` signals and returns without waiting for it, so that
+  // readback does not add to present latency. waitForReadback() returns once
+  // the copy queued last is done.
+  virtual bool supportsReadback() const { return false; }
+
+  virtual HWC3::Error queueReadback(Display* /*display*/,
+                                    buffer_handle_t /*buffer*/,
+                                    ::android::base::unique_fd /*releaseFence*/) {
+    return HWC3::Error::Unsupported;
+  }
+
+  virtual HWC3::Error waitForReadback(Display* /*display*/) {
+    return HWC3::Error::Unsupported;
+  }
+
   virtual const DrmClient* getDrmPresenter() const {
     return nullptr;
   }
@@ -85,102 +85,68 @@ Error Gralloc::GetMetadata(buffer_handle_t buffer, MetadataType type,
   return error;
 }
 
-std::optional<uint32_t> Gralloc::GetWidth(buffer_handle_t buffer) {
-  if (gralloc4_ == nullptr) {
-    ALOGE("%s Gralloc4 not available.", __FUNCTION__);
-    return std::nullopt;
-  }
-
-  hidl_vec<uint8_t> encoded_width;
-
-  Error error = GetMetadata(buffer, ::android::gralloc4::MetadataType_Width,
-                            &encoded_width);
-  if (error != Error::NONE) {
-    return std::nullopt;
-  }
-
-  uint64_t width = 0;
-  ::android::gralloc4::decodeWidth(encoded_width, &width);
-  return static_cast<uint32_t>(width);
-}
-
-std::optional<uint32_t> Gralloc::GetHeight(buffer_handle_t buffer) {
+std::shared_ptr<const GrallocBufferMetadata> Gralloc::GetBufferMetadata(
+    buffer_handle_t buffer) {
   if (gralloc4_ == nullptr) {
     ALOGE("%s Gralloc4 not available.", __FUNCTION__);
-    return std::nullopt;
-  }
-
-  hidl_vec<uint8_t> encoded_height;
-
-  Error error = GetMetadata(buffer, ::android::gralloc4::MetadataType_Height,
-                            &encoded_height);
-  if (error != Error::NONE) {
-    return std::nullopt;
+    return nullptr;
   }
 
-  uint64_t height = 0;
-  ::android::gralloc4::decodeHeight(encoded_height, &height);
-  return static_cast<uint32_t>(height);
-}
+  hidl_vec<uint8_t> encoded;
 
-std::optional<uint32_t> Gralloc::GetDrmFormat(buffer_handle_t buffer) {
-  if (gralloc4_ == nullptr) {
-    ALOGE("%s Gralloc4 not available.", __FUNCTION__);
-    return std::nullopt;
+  if (GetMetadata(buffer, ::android::gralloc4::MetadataType_BufferId,
+                  &encoded) != Error::NONE) {
+    return nullptr;
   }
+  uint64_t buffer_id = 0;
+  ::android::gralloc4::decodeBufferId(encoded, &buffer_id);
 
-  hidl_vec<uint8_t> encoded_format;
-
-  Error error =
-      GetMetadata(buffer, ::android::gralloc4::MetadataType_PixelFormatFourCC,
-                  &encoded_format);
-  if (error != Error::NONE) {
-    return std::nullopt;
+  {
+    std::lock_guard<std::mutex> lock(metadata_cache_mutex_);
+    auto it = metadata_cache_.find(buffer_id);
+    if (it != metadata_cache_.end()) {
+      return it->second;
+    }
   }
 
-  uint32_t format = 0;
-  ::android::gralloc4::decodePixelFormatFourCC(encoded_format, &format);
-  return static_cast<uint32_t>(format);
-}
+  auto metadata = std::make_shared<BufferMetadata>();
 
-std::optional<std::vector<PlaneLayout>> Gralloc::GetPlaneLayouts(
-    buffer_handle_t buffer) {
-  if (gralloc4_ == nullptr) {
-    ALOGE("%s Gralloc4 not available.", __FUNCTION__);
-    return std::nullopt;
+  if (GetMetadata(buffer, ::android::gralloc4::MetadataType_Width, &encoded) !=
+      Error::NONE) {
+    return nullptr;
   }
+  uint64_t width = 0;
+  ::android::gralloc4::decodeWidth(encoded, &width);
+  metadata->width = static_cast<uint32_t>(width);
 
-  hidl_vec<uint8_t> encoded_layouts;
-
-  Error error = GetMetadata(
-      buffer, ::android::gralloc4::MetadataType_PlaneLayouts, &encoded_layouts);
-  if (error != Error::NONE) {
-    return std::nullopt;
+  if (GetMetadata(buffer, ::android::gralloc4::MetadataType_Height, &encoded) !=
+      Error::NONE) {
+    return nullptr;
   }
+  uint64_t height = 0;
+  ::android::gralloc4::decodeHeight(encoded, &height);
+  metadata->height = static_cast<uint32_t>(height);
 
-  std::vector<PlaneLayout> plane_layouts;
-  ::android::gralloc4::decodePlaneLayouts(encoded_layouts, &plane_layouts);
-  return plane_layouts;
-}
-
-std::optional<uint32_t> Gralloc::GetMonoPlanarStrideBytes(
-    buffer_handle_t buffer) {
-  if (gralloc4_ == nullptr) {
-    ALOGE("%s Gralloc4 not available.", __FUNCTION__);
-    return std::nullopt;
+  if (GetMetadata(buffer, ::android::gralloc4::MetadataType_PixelFormatFourCC,
+                  &encoded) != Error::NONE) {
+    return nullptr;
   }
+  ::android::gralloc4::decodePixelFormatFourCC(encoded, &metadata->drmFormat);
 
-  auto plane_layouts_opt = GetPlaneLayouts(buffer);
-  if (!plane_layouts_opt) {
-    return std::nullopt;
+  if (GetMetadata(buffer, ::android::gralloc4::MetadataType_PlaneLayouts,
+                  &encoded) != Error::NONE) {
+    return nullptr;
   }
+  ::android::gralloc4::decodePlaneLayouts(encoded, &metadata->planeLayouts);
 
-  std::vector<PlaneLayout>& plane_layouts = *plane_layouts_opt;
-  if (plane_layouts.size() != 1) {
-    return std::nullopt;
+  std::lock_guard<std::mutex> lock(metadata_cache_mutex_);
+  // Ids are never reused, but nothing says when a buffer is freed, so the
+  // cache is bounded instead. A composer sees far fewer live buffers.
+  if (metadata_cache_.size() >= kMaxCachedBuffers) {
+    metadata_cache_.clear();
   }
-
-  return static_cast<uint32_t>(plane_layouts[0].strideInBytes);
+  metadata_cache_.emplace(buffer_id, metadata);
+  return metadata;
 }
 
 std::optional<GrallocBuffer> Gralloc::Import(buffer_handle_t buffer) {
@@ -221,7 +187,8 @@ void Gralloc::Release(buffer_handle_t buffer) {
   }
 }
 
-std::optional<void*> Gralloc::Lock(buffer_handle_t buffer) {
+std::optional<void*> Gralloc::Lock(buffer_handle_t buffer,
+                                   const BufferMetadata& metadata) {
   if (gralloc4_ == nullptr) {
     ALOGE("%s Gralloc4 not available.", __FUNCTION__);
     return std::nullopt;
@@ -232,21 +199,11 @@ std::optional<void*> Gralloc::Lock(buffer_handle_t buffer) {
   const auto buffer_usage = static_cast<uint64_t>(BufferUsage::CPU_READ_OFTEN |
                                                   BufferUsage::CPU_WRITE_OFTEN);
 
-  auto width_opt = GetWidth(buffer);
-  if (!width_opt) {
-    return std::nullopt;
-  }
-
-  auto height_opt = GetHeight(buffer);
-  if (!height_opt) {
-    return std::nullopt;
-  }
-
   IMapper::Rect buffer_region;
   buffer_region.left = 0;
   buffer_region.top = 0;
-  buffer_region.width = *width_opt;
-  buffer_region.height = *height_opt;
+  buffer_region.width = metadata.width;
+  buffer_region.height = metadata.height;
 
   // Empty fence, lock immedietly.
   hidl_handle fence;
@@ -275,36 +232,26 @@ std::optional<void*> Gralloc::Lock(buffer_handle_t buffer) {
   return data;
 }
 
-std::optional<android_ycbcr> Gralloc::LockYCbCr(buffer_handle_t buffer) {
+std::optional<android_ycbcr> Gralloc::LockYCbCr(
+    buffer_handle_t buffer, const BufferMetadata& metadata) {
   if (gralloc4_ == nullptr) {
     ALOGE("%s Gralloc4 not available.", __FUNCTION__);
     return std::nullopt;
   }
 
-  auto format_opt = GetDrmFormat(buffer);
-  if (!format_opt) {
-    ALOGE("%s failed to check format of buffer", __FUNCTION__);
-    return std::nullopt;
-  }
-
-  if (*format_opt != DRM_FORMAT_NV12 && *format_opt != DRM_FORMAT_NV21 &&
-      *format_opt != DRM_FORMAT_YVU420) {
+  const uint32_t format = metadata.drmFormat;
+  if (format != DRM_FORMAT_NV12 && format != DRM_FORMAT_NV21 &&
+      format != DRM_FORMAT_YVU420) {
     ALOGE("%s called on non-ycbcr buffer", __FUNCTION__);
     return std::nullopt;
   }
 
-  auto lock_opt = Lock(buffer);
+  auto lock_opt = Lock(buffer, metadata);
   if (!lock_opt) {
     ALOGE("%s failed to lock buffer", __FUNCTION__);
     return std::nullopt;
   }
 
-  auto plane_layouts_opt = GetPlaneLayouts(buffer);
-  if (!plane_layouts_opt) {
-    ALOGE("%s failed to get plane layouts", __FUNCTION__);
-    return std::nullopt;
-  }
-
   android_ycbcr buffer_ycbcr;
   buffer_ycbcr.y = nullptr;
   buffer_ycbcr.cb = nullptr;
@@ -313,7 +260,9 @@ std::optional<android_ycbcr> Gralloc::LockYCbCr(buffer_handle_t buffer) {
   buffer_ycbcr.cstride = 0;
   buffer_ycbcr.chroma_step = 0;
 
-  for (const auto& plane_layout : *plane_layouts_opt) {
+  // Plane layouts are fixed at allocation, so the cached ones describe the
+  // locked memory too.
+  for (const auto& plane_layout : metadata.planeLayouts) {
     for (const auto& plane_layout_component : plane_layout.components) {
       const auto& type = plane_layout_component.type;
 
@@ -381,6 +330,7 @@ GrallocBuffer::GrallocBuffer(GrallocBuffer&& rhs) { *this = std::move(rhs); }
 GrallocBuffer& GrallocBuffer::operator=(GrallocBuffer&& rhs) {
   gralloc_ = rhs.gralloc_;
   buffer_ = rhs.buffer_;
+  metadata_ = std::move(rhs.metadata_);
   rhs.gralloc_ = nullptr;
   rhs.buffer_ = nullptr;
   return *this;
@@ -394,30 +344,35 @@ void GrallocBuffer::Release() {
   }
 }
 
+const GrallocBufferMetadata* GrallocBuffer::GetBufferMetadata() {
+  if (!metadata_ && gralloc_ && buffer_) {
+    metadata_ = gralloc_->GetBufferMetadata(buffer_);
+  }
+  return metadata_.get();
+}
+
 std::optional<GrallocBufferView> GrallocBuffer::Lock() {
-  if (gralloc_ && buffer_) {
-    auto format_opt = GetDrmFormat();
-    if (!format_opt) {
-      ALOGE("%s failed to check format of buffer", __FUNCTION__);
+  const GrallocBufferMetadata* metadata = GetBufferMetadata();
+  if (!metadata) {
+    ALOGE("%s failed to check format of buffer", __FUNCTION__);
+    return std::nullopt;
+  }
+  const uint32_t format = metadata->drmFormat;
+  if (format != DRM_FORMAT_NV12 && format != DRM_FORMAT_NV21 &&
+      format != DRM_FORMAT_YVU420) {
+    auto locked_opt = gralloc_->Lock(buffer_, *metadata);
+    if (!locked_opt) {
       return std::nullopt;
     }
-    if (*format_opt != DRM_FORMAT_NV12 && *format_opt != DRM_FORMAT_NV21 &&
-        *format_opt != DRM_FORMAT_YVU420) {
-      auto locked_opt = gralloc_->Lock(buffer_);
-      if (!locked_opt) {
-        return std::nullopt;
-      }
-      return GrallocBufferView(this, *locked_opt);
-    } else {
-      auto locked_ycbcr_opt = gralloc_->LockYCbCr(buffer_);
-      if (!locked_ycbcr_opt) {
-        ALOGE("%s failed to lock ycbcr buffer", __FUNCTION__);
-        return std::nullopt;
-      }
-      return GrallocBufferView(this, *locked_ycbcr_opt);
+    return GrallocBufferView(this, *locked_opt);
+  } else {
+    auto locked_ycbcr_opt = gralloc_->LockYCbCr(buffer_, *metadata);
+    if (!locked_ycbcr_opt) {
+      ALOGE("%s failed to lock ycbcr buffer", __FUNCTION__);
+      return std::nullopt;
     }
+    return GrallocBufferView(this, *locked_ycbcr_opt);
   }
-  return std::nullopt;
 }
 
 void GrallocBuffer::Unlock() {
@@ -427,38 +382,39 @@ void GrallocBuffer::Unlock() {
 }
 
 std::optional<uint32_t> GrallocBuffer::GetWidth() {
-  if (gralloc_ && buffer_) {
-    return gralloc_->GetWidth(buffer_);
+  if (const GrallocBufferMetadata* metadata = GetBufferMetadata()) {
+    return metadata->width;
   }
   return std::nullopt;
 }
 
 std::optional<uint32_t> GrallocBuffer::GetHeight() {
-  if (gralloc_ && buffer_) {
-    return gralloc_->GetHeight(buffer_);
+  if (const GrallocBufferMetadata* metadata = GetBufferMetadata()) {
+    return metadata->height;
   }
   return std::nullopt;
 }
 
 std::optional<uint32_t> GrallocBuffer::GetDrmFormat() {
-  if (gralloc_ && buffer_) {
-    return gralloc_->GetDrmFormat(buffer_);
+  if (const GrallocBufferMetadata* metadata = GetBufferMetadata()) {
+    return metadata->drmFormat;
   }
   return std::nullopt;
 }
 
 std::optional<std::vector<PlaneLayout>> GrallocBuffer::GetPlaneLayouts() {
-  if (gralloc_ && buffer_) {
-    return gralloc_->GetPlaneLayouts(buffer_);
+  if (const GrallocBufferMetadata* metadata = GetBufferMetadata()) {
+    return metadata->planeLayouts;
   }
   return std::nullopt;
 }
 
 std::optional<uint32_t> GrallocBuffer::GetMonoPlanarStrideBytes() {
-  if (gralloc_ && buffer_) {
-    return gralloc_->GetMonoPlanarStrideBytes(buffer_);
+  const GrallocBufferMetadata* metadata = GetBufferMetadata();
+  if (!metadata || metadata->planeLayouts.size() != 1) {
+    return std::nullopt;
   }
-  return std::nullopt;
+  return static_cast<uint32_t>(metadata->planeLayouts[0].strideInBytes);
 }
 
 GrallocBufferView::GrallocBufferView(GrallocBuffer* buffer, void* raw)
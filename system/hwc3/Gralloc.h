@@ -24,7 +24,9 @@
 #include <utils/StrongPointer.h>
 
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 namespace aidl::android::hardware::graphics::composer3::impl {
@@ -32,6 +34,16 @@ namespace aidl::android::hardware::graphics::composer3::impl {
 class Gralloc;
 class GrallocBuffer;
 
+// What the mapper reports about a buffer that can not change while it
+// exists, fetched once per allocation instead of on every query.
+struct GrallocBufferMetadata {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t drmFormat = 0;
+  std::vector<aidl::android::hardware::graphics::common::PlaneLayout>
+      planeLayouts;
+};
+
 // An RAII object that will Unlock() a GrallocBuffer upon destruction.
 class GrallocBufferView {
  public:
@@ -97,8 +109,12 @@ class GrallocBuffer {
 
   void Release();
 
+  // The metadata of the buffer, fetched on first use, or nullptr.
+  const GrallocBufferMetadata* GetBufferMetadata();
+
   Gralloc* gralloc_ = nullptr;
   buffer_handle_t buffer_ = nullptr;
+  std::shared_ptr<const GrallocBufferMetadata> metadata_;
 };
 
 class Gralloc {
@@ -120,31 +136,20 @@ class Gralloc {
   void Release(buffer_handle_t buffer);
 
   // See GrallocBuffer::Lock.
-  std::optional<void*> Lock(buffer_handle_t buffer);
+  std::optional<void*> Lock(buffer_handle_t buffer,
+                            const GrallocBufferMetadata& metadata);
 
   // See GrallocBuffer::LockYCbCr.
-  std::optional<android_ycbcr> LockYCbCr(buffer_handle_t buffer);
+  std::optional<android_ycbcr> LockYCbCr(buffer_handle_t buffer,
+                                         const GrallocBufferMetadata& metadata);
 
   // See GrallocBuffer::Unlock.
   void Unlock(buffer_handle_t buffer);
 
-  // See GrallocBuffer::GetWidth.
-  std::optional<uint32_t> GetWidth(buffer_handle_t buffer);
-
-  // See GrallocBuffer::GetHeight.
-  std::optional<uint32_t> GetHeight(buffer_handle_t buffer);
-
-  // See GrallocBuffer::GetDrmFormat.
-  std::optional<uint32_t> GetDrmFormat(buffer_handle_t buffer);
-
-  // See GrallocBuffer::GetPlaneLayouts.
-  std::optional<
-      std::vector<aidl::android::hardware::graphics::common::PlaneLayout>>
-  GetPlaneLayouts(buffer_handle_t buffer);
-
-  // Returns the stride of the buffer if it is a single plane buffer or fails
-  // and returns nullopt if the buffer is for a multi plane buffer.
-  std::optional<uint32_t> GetMonoPlanarStrideBytes(buffer_handle_t);
+  // Returns the metadata of |buffer|, from the cache if the allocation has
+  // been seen before, or nullptr if the mapper fails.
+  std::shared_ptr<const GrallocBufferMetadata> GetBufferMetadata(
+      buffer_handle_t buffer);
 
   // See GrallocBuffer::GetMetadata.
   ::android::hardware::graphics::mapper::V4_0::Error GetMetadata(
@@ -153,6 +158,14 @@ class Gralloc {
       ::android::hardware::hidl_vec<uint8_t>* metadata);
 
   ::android::sp<::android::hardware::graphics::mapper::V4_0::IMapper> gralloc4_;
+
+  static constexpr size_t kMaxCachedBuffers = 256;
+
+  // Keyed by the gralloc buffer id, which names an allocation across the
+  // imports of it.
+  std::mutex metadata_cache_mutex_;
+  std::unordered_map<uint64_t, std::shared_ptr<const GrallocBufferMetadata>>
+      metadata_cache_;
 };
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
@@ -28,6 +28,15 @@
 #include <ui/GraphicBufferAllocator.h>
 #include <ui/GraphicBufferMapper.h>
 
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "Display.h"
 #include "DisplayFinder.h"
 #include "Drm.h"
@@ -38,6 +47,11 @@ namespace {
 
 using ::android::hardware::graphics::common::V1_0::ColorTransform;
 
+// Composition is split into horizontal bands of at least this many rows,
+// over at most this many threads.
+constexpr int32_t kMinBandRows = 64;
+constexpr unsigned kMaxCompositionThreads = 4;
+
 uint64_t AlignToPower2(uint64_t val, uint8_t align_log) {
   uint64_t align = 1ULL << align_log;
   return ((val + (align - 1)) / align) * align;
@@ -61,6 +75,62 @@ bool LayerNeedsScaling(const Layer& layer) {
   return needs_rot ? rot_scale : not_rot_scale;
 }
 
+bool LayerNeedsTransform(const Layer& layer) {
+  return static_cast<int32_t>(layer.getTransform()) != 0;
+}
+
+bool IsRectEmpty(const common::Rect& rect) {
+  return rect.right <= rect.left || rect.bottom <= rect.top;
+}
+
+common::Rect IntersectRects(const common::Rect& a, const common::Rect& b) {
+  return common::Rect{
+      .left = std::max(a.left, b.left),
+      .top = std::max(a.top, b.top),
+      .right = std::min(a.right, b.right),
+      .bottom = std::min(a.bottom, b.bottom),
+  };
+}
+
+// Bounding box of both, ignoring empty rects.
+common::Rect UnionRects(const common::Rect& a, const common::Rect& b) {
+  if (IsRectEmpty(a)) return b;
+  if (IsRectEmpty(b)) return a;
+  return common::Rect{
+      .left = std::min(a.left, b.left),
+      .top = std::min(a.top, b.top),
+      .right = std::max(a.right, b.right),
+      .bottom = std::max(a.bottom, b.bottom),
+  };
+}
+
+// The part of the display that a new buffer on an otherwise unchanged layer
+// touches.
+common::Rect GetLayerDamage(const Layer& layer) {
+  const common::Rect frame = layer.getDisplayFrame();
+  const std::vector<common::Rect>& damage = layer.getSurfaceDamage();
+  if (damage.empty() || LayerNeedsScaling(layer) ||
+      LayerNeedsTransform(layer)) {
+    return frame;
+  }
+
+  const common::Rect crop = layer.getSourceCropInt();
+  const int dx = frame.left - crop.left;
+  const int dy = frame.top - crop.top;
+
+  common::Rect result = {0, 0, 0, 0};
+  for (const common::Rect& rect : damage) {
+    const common::Rect moved = {
+        .left = rect.left + dx,
+        .top = rect.top + dy,
+        .right = rect.right + dx,
+        .bottom = rect.bottom + dy,
+    };
+    result = UnionRects(result, IntersectRects(moved, frame));
+  }
+  return result;
+}
+
 bool LayerNeedsBlending(const Layer& layer) {
   return layer.getBlendMode() != common::BlendMode::NONE;
 }
@@ -69,6 +139,46 @@ bool LayerNeedsAttenuation(const Layer& layer) {
   return layer.getBlendMode() == common::BlendMode::COVERAGE;
 }
 
+// Planes neither transform nor fade what they show, and blend it over what is
+// below them as premultiplied pixels.
+bool CanScanOutLayer(const Layer& layer) {
+  const auto compositionType = layer.getCompositionType();
+  if (compositionType != Composition::DEVICE &&
+      compositionType != Composition::CURSOR) {
+    return false;
+  }
+  if (LayerNeedsTransform(layer) || layer.getPlaneAlpha() != 1.0f ||
+      layer.getColorTransform()) {
+    return false;
+  }
+  const common::BlendMode blendMode = layer.getBlendMode();
+  return blendMode == common::BlendMode::NONE ||
+         blendMode == common::BlendMode::PREMULTIPLIED;
+}
+
+// Framebuffers are only made from the first plane of a buffer, so multi
+// planar formats can not be scanned out.
+bool IsScanOutFormat(uint32_t drmFormat, common::BlendMode blendMode) {
+  switch (drmFormat) {
+    case DRM_FORMAT_XBGR8888:
+    case DRM_FORMAT_XRGB8888:
+    case DRM_FORMAT_RGB565:
+      return true;
+    case DRM_FORMAT_ABGR8888:
+    case DRM_FORMAT_ARGB8888:
+      return blendMode == common::BlendMode::PREMULTIPLIED;
+  }
+  return false;
+}
+
+bool OverlapsAny(const common::Rect& rect,
+                 const std::vector<common::Rect>& others) {
+  return std::any_of(others.begin(), others.end(),
+                     [&](const common::Rect& other) {
+                       return !IsRectEmpty(IntersectRects(rect, other));
+                     });
+}
+
 struct BufferSpec;
 typedef int (*ConverterFunction)(const BufferSpec& src, const BufferSpec& dst,
                                  bool v_flip);
@@ -372,62 +482,67 @@ int DoBlending(const BufferSpec& src, const BufferSpec& dst, bool v_flip) {
                            height);
 }
 
-std::optional<BufferSpec> GetBufferSpec(GrallocBuffer& buffer,
-                                        GrallocBufferView& bufferView,
-                                        const common::Rect& bufferCrop) {
-  auto bufferFormatOpt = buffer.GetDrmFormat();
-  if (!bufferFormatOpt) {
-    ALOGE("Failed to get gralloc buffer format.");
-    return std::nullopt;
-  }
-  uint32_t bufferFormat = *bufferFormatOpt;
+// Rows of a layer that fit in about this many bytes are taken through all of
+// the conversion, attenuation and blending steps before the next rows are
+// started, so that the intermediate stays in cache.
+constexpr int kRowBlockBytes = 64 * 1024;
 
-  auto bufferWidthOpt = buffer.GetWidth();
-  if (!bufferWidthOpt) {
-    ALOGE("Failed to get gralloc buffer width.");
-    return std::nullopt;
-  }
-  uint32_t bufferWidth = *bufferWidthOpt;
+int GetRowBlockRows(int width) {
+  // Even, so that chroma rows of YV12 sources stay paired up.
+  return std::max(2, (kRowBlockBytes / std::max(width * 4, 1)) & ~1);
+}
 
-  auto bufferHeightOpt = buffer.GetHeight();
-  if (!bufferHeightOpt) {
-    ALOGE("Failed to get gralloc buffer height.");
-    return std::nullopt;
-  }
-  uint32_t bufferHeight = *bufferHeightOpt;
+// Converts, attenuates and/or blends `src` into `dst` a block of rows at a
+// time through `blockBuffer`, which must hold GetRowBlockRows() rows of
+// `dst`. Scaling, rotations and flips are not supported.
+int DoRowBlocks(const BufferSpec& src, const BufferSpec& dst,
+                bool needsConversion, bool needsAttenuation,
+                bool needsBlending, uint8_t* blockBuffer) {
+  ATRACE_CALL();
 
-  uint8_t* bufferData = nullptr;
-  uint32_t bufferStrideBytes = 0;
-  std::optional<android_ycbcr> bufferYCbCrData;
+  const int width = dst.cropWidth;
+  const int blockRows = GetRowBlockRows(width);
+  const int blockStrideBytes = width * 4;
 
-  if (bufferFormat == DRM_FORMAT_NV12 || bufferFormat == DRM_FORMAT_NV21 ||
-      bufferFormat == DRM_FORMAT_YVU420) {
-    bufferYCbCrData = bufferView.GetYCbCr();
-    if (!bufferYCbCrData) {
-      ALOGE("%s failed to get raw ycbcr from view.", __FUNCTION__);
-      return std::nullopt;
+  for (int row = 0; row < dst.cropHeight; row += blockRows) {
+    const int rows = std::min(blockRows, dst.cropHeight - row);
+
+    BufferSpec srcBlock = src;
+    srcBlock.cropY += row;
+    srcBlock.cropHeight = rows;
+
+    BufferSpec dstBlock = dst;
+    dstBlock.cropY += row;
+    dstBlock.cropHeight = rows;
+
+    const BufferSpec scratchBlock(blockBuffer, width, rows, blockStrideBytes);
+
+    BufferSpec current = srcBlock;
+    if (needsConversion) {
+      const BufferSpec& out =
+          (needsAttenuation || needsBlending) ? scratchBlock : dstBlock;
+      int retval = DoConversion(current, out, /*v_flip=*/false);
+      if (retval) {
+        return retval;
+      }
+      current = out;
     }
-  } else {
-    auto bufferDataOpt = bufferView.Get();
-    if (!bufferDataOpt) {
-      ALOGE("%s failed to lock gralloc buffer.", __FUNCTION__);
-      return std::nullopt;
+    if (needsAttenuation) {
+      const BufferSpec& out = needsBlending ? scratchBlock : dstBlock;
+      int retval = DoAttenuation(current, out, /*v_flip=*/false);
+      if (retval) {
+        return retval;
+      }
+      current = out;
     }
-    bufferData = reinterpret_cast<uint8_t*>(*bufferDataOpt);
-
-    auto bufferStrideBytesOpt = buffer.GetMonoPlanarStrideBytes();
-    if (!bufferStrideBytesOpt) {
-      ALOGE("%s failed to get plane stride.", __FUNCTION__);
-      return std::nullopt;
+    if (needsBlending) {
+      int retval = DoBlending(current, dstBlock, /*v_flip=*/false);
+      if (retval) {
+        return retval;
+      }
     }
-    bufferStrideBytes = *bufferStrideBytesOpt;
   }
-
-  return BufferSpec(bufferData, bufferYCbCrData, bufferWidth, bufferHeight,
-                    bufferCrop.left, bufferCrop.top,
-                    bufferCrop.right - bufferCrop.left,
-                    bufferCrop.bottom - bufferCrop.top, bufferFormat,
-                    bufferStrideBytes, GetDrmFormatBytesPerPixel(bufferFormat));
+  return 0;
 }
 
 }  // namespace
@@ -441,6 +556,11 @@ HWC3::Error GuestFrameComposer::init() {
     return error;
   }
 
+  mWorkerPool = &::android::base::guest::WorkStealingPool::get();
+  mMaxBands = std::min<std::size_t>(mWorkerPool->getConcurrency(),
+                                    kMaxCompositionThreads);
+  mBandScratchBuffers.resize(mMaxBands);
+
   return HWC3::Error::None;
 }
 
@@ -552,6 +672,8 @@ HWC3::Error GuestFrameComposer::onDisplayDestroy(Display* display) {
 
   DisplayInfo& displayInfo = mDisplayInfos[displayId];
 
+  mWorkerPool->wait(displayInfo.readbackTasks.get());
+
   ::android::GraphicBufferAllocator::get().free(
       displayInfo.compositionResultBuffer);
 
@@ -619,12 +741,27 @@ HWC3::Error GuestFrameComposer::validateDisplay(Display* display,
 
   const std::vector<Layer*>& layers = display->getOrderedLayers();
 
+  std::vector<int64_t> planeLayerIds;
+  auto it = mDisplayInfos.find(displayId);
+  if (it != mDisplayInfos.end()) {
+    it->second.planeLayerIds = assignPlaneLayers(display);
+    planeLayerIds = it->second.planeLayerIds;
+  }
+  auto isOnPlane = [&](const Layer* layer) {
+    return std::find(planeLayerIds.begin(), planeLayerIds.end(),
+                     layer->getId()) != planeLayerIds.end();
+  };
+
   bool fallbackToClientComposition = false;
   for (Layer* layer : layers) {
     const auto layerId = layer->getId();
     const auto layerCompositionType = layer->getCompositionType();
     const auto layerCompositionTypeString = toString(layerCompositionType);
 
+    if (isOnPlane(layer)) {
+      continue;
+    }
+
     if (layerCompositionType == Composition::INVALID) {
       ALOGE("%s display:%" PRIu64 " layer:%" PRIu64 " has Invalid composition",
             __FUNCTION__, displayId, layerId);
@@ -661,7 +798,7 @@ HWC3::Error GuestFrameComposer::validateDisplay(Display* display,
       const auto layerId = layer->getId();
       const auto layerCompositionType = layer->getCompositionType();
 
-      if (layerCompositionType == Composition::INVALID) {
+      if (layerCompositionType == Composition::INVALID || isOnPlane(layer)) {
         continue;
       }
 
@@ -677,7 +814,9 @@ HWC3::Error GuestFrameComposer::validateDisplay(Display* display,
   }
 
   // We can not draw below a Client (SurfaceFlinger) composed layer. Change all
-  // layers below a Client composed layer to also be Client composed.
+  // layers below a Client composed layer to also be Client composed. Layers
+  // on planes are shown above the client target and nothing that overlaps
+  // them is above them.
   if (layers.size() > 1) {
     for (std::size_t layerIndex = layers.size() - 1; layerIndex > 0;
          layerIndex--) {
@@ -691,7 +830,8 @@ HWC3::Error GuestFrameComposer::validateDisplay(Display* display,
           auto lowerLayerId = lowerLayer->getId();
           auto lowerLayerCompositionType = lowerLayer->getCompositionType();
 
-          if (lowerLayerCompositionType != Composition::CLIENT) {
+          if (lowerLayerCompositionType != Composition::CLIENT &&
+              !isOnPlane(lowerLayer)) {
             DEBUG_LOG("%s: display:%" PRIu64 " changing layer:%" PRIu64
                       " to Client because"
                       "hwcomposer can not draw below the Client composed "
@@ -711,8 +851,7 @@ HWC3::Error GuestFrameComposer::validateDisplay(Display* display,
 
 HWC3::Error GuestFrameComposer::presentDisplay(
     Display* display, ::android::base::unique_fd* outDisplayFence,
-    std::unordered_map<int64_t,
-                       ::android::base::unique_fd>* /*outLayerFences*/) {
+    std::unordered_map<int64_t, ::android::base::unique_fd>* outLayerFences) {
   const auto displayId = display->getId();
   DEBUG_LOG("%s display:%" PRIu64, __FUNCTION__, displayId);
 
@@ -772,6 +911,20 @@ HWC3::Error GuestFrameComposer::presentDisplay(
     return HWC3::Error::NoResources;
   }
 
+  // Nor does readback, which may still be copying the composition result.
+  mWorkerPool->wait(displayInfo.readbackTasks.get());
+
+  // Flushes do not block, so the last one may still be reading the
+  // composition result.
+  if (displayInfo.previousFlushFence.ok()) {
+    ATRACE_NAME("waitForPreviousFlush");
+    if (sync_wait(displayInfo.previousFlushFence.get(), 3000) < 0) {
+      ALOGW("%s: display:%" PRIu64 " timed out waiting for previous flush",
+            __FUNCTION__, displayId);
+    }
+    displayInfo.previousFlushFence.reset();
+  }
+
   std::optional<GrallocBufferView> compositionResultBufferViewOpt =
       compositionResultBufferOpt->Lock();
   if (!compositionResultBufferViewOpt) {
@@ -794,7 +947,18 @@ HWC3::Error GuestFrameComposer::presentDisplay(
   uint8_t* compositionResultBufferData =
       reinterpret_cast<uint8_t*>(*compositionResultBufferDataOpt);
 
-  const std::vector<Layer*>& layers = display->getOrderedLayers();
+  // Layers on planes of their own are left out of the composition result.
+  std::vector<Layer*> layers;
+  std::vector<Layer*> planeLayers;
+  for (Layer* layer : display->getOrderedLayers()) {
+    if (std::find(displayInfo.planeLayerIds.begin(),
+                  displayInfo.planeLayerIds.end(),
+                  layer->getId()) != displayInfo.planeLayerIds.end()) {
+      planeLayers.push_back(layer);
+    } else {
+      layers.push_back(layer);
+    }
+  }
 
   const bool noOpComposition = layers.empty();
   const bool allLayersClientComposed =
@@ -804,9 +968,21 @@ HWC3::Error GuestFrameComposer::presentDisplay(
                     return layer->getCompositionType() == Composition::CLIENT;
                   });
 
+  const common::Rect fullDisplay = {
+      .left = 0,
+      .top = 0,
+      .right = static_cast<int32_t>(compositionResultBufferWidth),
+      .bottom = static_cast<int32_t>(compositionResultBufferHeight),
+  };
+  common::Rect damage = fullDisplay;
+  bool colorTransformApplied = false;
+
   if (noOpComposition) {
     ALOGW("%s: display:%" PRIu64 " empty composition", __FUNCTION__, displayId);
+    displayInfo.lastLayersValid = false;
   } else if (allLayersClientComposed) {
+    displayInfo.lastLayersValid = false;
+
     auto clientTargetBufferOpt =
         mGralloc.Import(display->waitAndGetClientTargetBuffer());
     if (!clientTargetBufferOpt) {
@@ -844,38 +1020,174 @@ HWC3::Error GuestFrameComposer::presentDisplay(
     }
     auto* clientTargetData = reinterpret_cast<uint8_t*>(*clientTargetDataOpt);
 
-    std::memcpy(compositionResultBufferData, clientTargetData,
-                clientTargetPlaneSize);
+    if (display->hasColorTransform()) {
+      // Transformed on the way, rather than copied and then transformed in
+      // place.
+      HWC3::Error error = applyColorTransformToRGBA(
+          display->getColorTransform(),                          //
+          clientTargetData,                                      //
+          static_cast<std::uint32_t>(                            //
+              clientTargetPlaneLayouts[0].strideInBytes),        //
+          compositionResultBufferData,                           //
+          compositionResultBufferStride,                         //
+          compositionResultBufferWidth,                          //
+          compositionResultBufferHeight);
+      if (error != HWC3::Error::None) {
+        ALOGE("%s: display:%" PRIu64 " failed to apply color transform",
+              __FUNCTION__, displayId);
+        return error;
+      }
+      colorTransformApplied = true;
+    } else {
+      std::memcpy(compositionResultBufferData, clientTargetData,
+                  clientTargetPlaneSize);
+    }
   } else {
-    for (Layer* layer : layers) {
-      const auto layerId = layer->getId();
-      const auto layerCompositionType = layer->getCompositionType();
-      if (layerCompositionType != Composition::DEVICE &&
-          layerCompositionType != Composition::SOLID_COLOR) {
+    damage = updateCompositionDamage(display, displayInfo, layers,
+                                     compositionResultBufferWidth,
+                                     compositionResultBufferHeight);
+    if (damage != fullDisplay && !canComposeClipped(layers, damage)) {
+      damage = fullDisplay;
+    }
+    std::optional<common::Rect> clip;
+    if (damage != fullDisplay) {
+      clip = damage;
+    }
+    DEBUG_LOG("%s: display:%" PRIu64 " composing [%d,%d,%d,%d]", __FUNCTION__,
+              displayId, damage.left, damage.top, damage.right, damage.bottom);
+
+    // Buffers are locked once here rather than by every band.
+    std::vector<LayerSource> sources(layers.size());
+    for (std::size_t i = 0; i < layers.size(); i++) {
+      Layer* layer = layers[i];
+      if (layer->getCompositionType() != Composition::DEVICE) {
         continue;
       }
+      if (clip &&
+          IsRectEmpty(IntersectRects(layer->getDisplayFrame(), *clip))) {
+        continue;
+      }
+      HWC3::Error error = lockLayerSource(layer, &sources[i]);
+      if (error != HWC3::Error::None) {
+        ALOGE("%s: display:%" PRIu64 " failed to lock layer:%" PRIu64,
+              __FUNCTION__, displayId, layer->getId());
+        displayInfo.lastLayersValid = false;
+        return error;
+      }
+    }
 
-      HWC3::Error error = composeLayerInto(layer,                          //
-                                           compositionResultBufferData,    //
-                                           compositionResultBufferWidth,   //
-                                           compositionResultBufferHeight,  //
-                                           compositionResultBufferStride,  //
-                                           4);
+    // Bands can only be composed apart if every layer can be clipped.
+    std::size_t numBands = 1;
+    if (clip || canComposeClipped(layers, fullDisplay)) {
+      const int32_t rows = damage.bottom - damage.top;
+      numBands = std::min<std::size_t>(mMaxBands,
+                                       std::max(rows / kMinBandRows, 1));
+    }
+    const int32_t bandRows = static_cast<int32_t>(AlignToPower2(
+        (damage.bottom - damage.top + numBands - 1) / numBands, 1));
+
+    std::optional<std::array<float, 16>> colorTransform;
+    if (display->hasColorTransform()) {
+      colorTransform = display->getColorTransform();
+    }
+
+    std::vector<HWC3::Error> bandErrors(numBands, HWC3::Error::None);
+    auto composeBand = [&](std::size_t band) {
+      std::optional<common::Rect> bandClip = clip;
+      common::Rect bandRect = damage;
+      if (numBands > 1) {
+        bandRect.top = damage.top + static_cast<int32_t>(band) * bandRows;
+        bandRect.bottom = std::min(damage.bottom, bandRect.top + bandRows);
+        bandClip = bandRect;
+      }
+      if (IsRectEmpty(bandRect)) {
+        return;
+      }
+
+      for (std::size_t i = 0; i < layers.size(); i++) {
+        Layer* layer = layers[i];
+        const auto layerCompositionType = layer->getCompositionType();
+        if (layerCompositionType != Composition::DEVICE &&
+            layerCompositionType != Composition::SOLID_COLOR) {
+          continue;
+        }
+
+        if (bandClip) {
+          if (IsRectEmpty(
+                  IntersectRects(layer->getDisplayFrame(), *bandClip))) {
+            continue;
+          }
+          // Parts of the layer hidden behind opaque layers above it do not
+          // need to be drawn.
+          const std::vector<common::Rect>& visible =
+              layer->getVisibleRegions();
+          if (!visible.empty() &&
+              std::none_of(visible.begin(), visible.end(),
+                           [&](const common::Rect& rect) {
+                             return !IsRectEmpty(
+                                 IntersectRects(rect, *bandClip));
+                           })) {
+            continue;
+          }
+        }
+
+        HWC3::Error error =
+            composeLayerInto(layer, sources[i],                //
+                             compositionResultBufferData,      //
+                             compositionResultBufferWidth,     //
+                             compositionResultBufferHeight,    //
+                             compositionResultBufferStride,    //
+                             4,                                //
+                             bandClip,                         //
+                             mBandScratchBuffers[band],        //
+                             bandClip ? nullptr : &displayInfo.layerCache);
+        if (error != HWC3::Error::None) {
+          ALOGE("%s: display:%" PRIu64 " failed to compose layer:%" PRIu64,
+                __FUNCTION__, displayId, layer->getId());
+          bandErrors[band] = error;
+          return;
+        }
+      }
+
+      // Pixels outside of the damage kept the transform from earlier frames.
+      if (colorTransform) {
+        std::uint8_t* bandData = compositionResultBufferData +
+                                 bandRect.top * compositionResultBufferStride +
+                                 bandRect.left * 4;
+        bandErrors[band] = applyColorTransformToRGBA(
+            *colorTransform,                                      //
+            bandData, compositionResultBufferStride,              //
+            bandData, compositionResultBufferStride,              //
+            bandRect.right - bandRect.left,                       //
+            bandRect.bottom - bandRect.top);
+      }
+    };
+    mWorkerPool->parallelFor(numBands, 1,
+                             [&](std::size_t begin, std::size_t end) {
+                               for (std::size_t band = begin; band < end;
+                                    band++) {
+                                 composeBand(band);
+                               }
+                             });
+
+    for (HWC3::Error error : bandErrors) {
       if (error != HWC3::Error::None) {
-        ALOGE("%s: display:%" PRIu64 " failed to compose layer:%" PRIu64,
-              __FUNCTION__, displayId, layerId);
+        displayInfo.lastLayersValid = false;
         return error;
       }
     }
+    colorTransformApplied = true;
   }
 
-  if (display->hasColorTransform()) {
+  if (display->hasColorTransform() && !colorTransformApplied) {
     HWC3::Error error =
         applyColorTransformToRGBA(display->getColorTransform(),   //
                                   compositionResultBufferData,    //
+                                  compositionResultBufferStride,  //
+                                  compositionResultBufferData,    //
+                                  compositionResultBufferStride,  //
                                   compositionResultBufferWidth,   //
-                                  compositionResultBufferHeight,  //
-                                  compositionResultBufferStride);
+                                  compositionResultBufferHeight);
     if (error != HWC3::Error::None) {
       ALOGE("%s: display:%" PRIu64 " failed to apply color transform",
             __FUNCTION__, displayId);
@@ -886,17 +1198,240 @@ HWC3::Error GuestFrameComposer::presentDisplay(
   DEBUG_LOG("%s display:%" PRIu64 " flushing drm buffer", __FUNCTION__,
             displayId);
 
+  std::vector<DrmPlaneLayer> drmPlaneLayers;
+  std::vector<::android::base::unique_fd> planeLayerFences;
+  planeLayerFences.reserve(planeLayers.size());
+  for (Layer* layer : planeLayers) {
+    DrmPlaneLayer drmPlaneLayer;
+    if (!getDrmPlaneLayer(layer, &drmPlaneLayer)) {
+      ALOGE("%s: display:%" PRIu64 " failed to scan out layer:%" PRIu64,
+            __FUNCTION__, displayId, layer->getId());
+      continue;
+    }
+    planeLayerFences.push_back(layer->getBuffer().getFence());
+    drmPlaneLayer.inSyncFd = planeLayerFences.back().get();
+    drmPlaneLayers.push_back(std::move(drmPlaneLayer));
+  }
+
   auto [error, fence] = mDrmClient.flushToDisplay(
-      displayId, displayInfo.compositionResultDrmBuffer, -1);
+      displayId, displayInfo.compositionResultDrmBuffer, -1, drmPlaneLayers);
   if (error != HWC3::Error::None) {
     ALOGE("%s: display:%" PRIu64 " failed to flush drm buffer" PRIu64,
           __FUNCTION__, displayId);
   }
 
+  // The next composition waits for this frame to show up, which is also when
+  // the buffers that were on the planes before are released.
+  if (fence.ok()) {
+    displayInfo.previousFlushFence.reset(dup(fence.get()));
+    for (Layer* layer : planeLayers) {
+      (*outLayerFences)[layer->getId()] =
+          ::android::base::unique_fd(dup(fence.get()));
+    }
+  }
+
   *outDisplayFence = std::move(fence);
   return error;
 }
 
+HWC3::Error GuestFrameComposer::queueReadback(
+    Display* display, buffer_handle_t buffer,
+    ::android::base::unique_fd releaseFence) {
+  const auto displayId = display->getId();
+  DEBUG_LOG("%s display:%" PRIu64, __FUNCTION__, displayId);
+
+  auto it = mDisplayInfos.find(displayId);
+  if (it == mDisplayInfos.end()) {
+    ALOGE("%s: display:%" PRIu64 " not found", __FUNCTION__, displayId);
+    return HWC3::Error::BadDisplay;
+  }
+
+  DisplayInfo& displayInfo = it->second;
+  if (displayInfo.compositionResultBuffer == nullptr) {
+    ALOGE("%s: display:%" PRIu64 " missing composition result buffer",
+          __FUNCTION__, displayId);
+    return HWC3::Error::NoResources;
+  }
+
+  // Usually done already, as the composition waits for it too.
+  mWorkerPool->wait(displayInfo.readbackTasks.get());
+  displayInfo.readbackError = HWC3::Error::None;
+  buffer_handle_t src = displayInfo.compositionResultBuffer;
+  HWC3::Error* outError = &displayInfo.readbackError;
+  mWorkerPool->submit(
+      displayInfo.readbackTasks.get(),
+      [this, src, buffer, outError,
+       releaseFence = std::move(releaseFence)]() {
+        *outError = copyForReadback(src, buffer, releaseFence.get());
+      });
+  return HWC3::Error::None;
+}
+
+HWC3::Error GuestFrameComposer::waitForReadback(Display* display) {
+  const auto displayId = display->getId();
+
+  auto it = mDisplayInfos.find(displayId);
+  if (it == mDisplayInfos.end()) {
+    ALOGE("%s: display:%" PRIu64 " not found", __FUNCTION__, displayId);
+    return HWC3::Error::BadDisplay;
+  }
+
+  ATRACE_NAME("waitForReadback");
+  mWorkerPool->wait(it->second.readbackTasks.get());
+  return it->second.readbackError;
+}
+
+HWC3::Error GuestFrameComposer::copyForReadback(buffer_handle_t src,
+                                                buffer_handle_t dst,
+                                                int dstReleaseFence) {
+  ATRACE_CALL();
+
+  // Clients hand in readback buffers they are done with, so this rarely
+  // waits.
+  if (dstReleaseFence >= 0 && sync_wait(dstReleaseFence, 3000) < 0) {
+    ALOGE("%s: timed out waiting for readback buffer release", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+
+  std::optional<GrallocBuffer> srcBufferOpt = mGralloc.Import(src);
+  std::optional<GrallocBuffer> dstBufferOpt = mGralloc.Import(dst);
+  if (!srcBufferOpt || !dstBufferOpt) {
+    ALOGE("%s: failed to import buffers", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+
+  std::optional<uint32_t> srcWidthOpt = srcBufferOpt->GetWidth();
+  std::optional<uint32_t> srcHeightOpt = srcBufferOpt->GetHeight();
+  std::optional<uint32_t> srcStrideOpt =
+      srcBufferOpt->GetMonoPlanarStrideBytes();
+  std::optional<uint32_t> dstWidthOpt = dstBufferOpt->GetWidth();
+  std::optional<uint32_t> dstHeightOpt = dstBufferOpt->GetHeight();
+  std::optional<uint32_t> dstStrideOpt =
+      dstBufferOpt->GetMonoPlanarStrideBytes();
+  if (!srcWidthOpt || !srcHeightOpt || !srcStrideOpt || !dstWidthOpt ||
+      !dstHeightOpt || !dstStrideOpt) {
+    ALOGE("%s: failed to query buffers", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+
+  std::optional<GrallocBufferView> srcViewOpt = srcBufferOpt->Lock();
+  std::optional<GrallocBufferView> dstViewOpt = dstBufferOpt->Lock();
+  if (!srcViewOpt || !dstViewOpt) {
+    ALOGE("%s: failed to lock buffers", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+
+  const std::optional<void*> srcDataOpt = srcViewOpt->Get();
+  const std::optional<void*> dstDataOpt = dstViewOpt->Get();
+  if (!srcDataOpt || !dstDataOpt) {
+    ALOGE("%s: failed to get buffer data", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+
+  const uint8_t* srcData = reinterpret_cast<const uint8_t*>(*srcDataOpt);
+  uint8_t* dstData = reinterpret_cast<uint8_t*>(*dstDataOpt);
+  const uint32_t rowBytes = std::min(*srcWidthOpt, *dstWidthOpt) * 4;
+  const uint32_t rows = std::min(*srcHeightOpt, *dstHeightOpt);
+  for (uint32_t row = 0; row < rows; row++) {
+    std::memcpy(dstData + row * *dstStrideOpt, srcData + row * *srcStrideOpt,
+                rowBytes);
+  }
+  return HWC3::Error::None;
+}
+
+std::vector<int64_t> GuestFrameComposer::assignPlaneLayers(Display* display) {
+  std::vector<int64_t> planeLayerIds;
+
+  const auto displayId = display->getId();
+  const std::size_t extraPlaneCount = mDrmClient.getExtraPlaneCount(displayId);
+  // Readback copies the composition result alone.
+  if (mPresentDisabled || extraPlaneCount == 0 ||
+      display->hasColorTransform() || display->hasReadbackBuffer()) {
+    return planeLayerIds;
+  }
+
+  // Planes are stacked above the composition result, so a layer only goes on
+  // one if everything above it that it overlaps is on a plane too. Layers on
+  // planes must not overlap each other, as the order of the planes is not
+  // known. The bottom layer is always composed.
+  const std::vector<Layer*>& layers = display->getOrderedLayers();
+  std::vector<common::Rect> composedAbove;
+  std::vector<common::Rect> planesAbove;
+  std::vector<DrmPlaneLayer> drmPlaneLayers;
+  for (std::size_t i = layers.size(); i-- > 1;) {
+    Layer* layer = layers[i];
+    const common::Rect frame = layer->getDisplayFrame();
+
+    if (planeLayerIds.size() < extraPlaneCount && CanScanOutLayer(*layer) &&
+        !OverlapsAny(frame, composedAbove) &&
+        !OverlapsAny(frame, planesAbove)) {
+      DrmPlaneLayer drmPlaneLayer;
+      if (getDrmPlaneLayer(layer, &drmPlaneLayer)) {
+        drmPlaneLayers.push_back(std::move(drmPlaneLayer));
+        if (mDrmClient.testPlaneLayers(displayId, drmPlaneLayers)) {
+          DEBUG_LOG("%s: display:%" PRIu64 " layer:%" PRIu64 " put on a plane",
+                    __FUNCTION__, displayId, layer->getId());
+          planeLayerIds.push_back(layer->getId());
+          planesAbove.push_back(frame);
+          continue;
+        }
+        drmPlaneLayers.pop_back();
+      }
+    }
+
+    composedAbove.push_back(frame);
+  }
+
+  return planeLayerIds;
+}
+
+bool GuestFrameComposer::getDrmPlaneLayer(Layer* layer,
+                                          DrmPlaneLayer* outPlaneLayer) {
+  buffer_handle_t bufferHandle = layer->getBuffer().getBuffer();
+  if (bufferHandle == nullptr) {
+    return false;
+  }
+
+  const common::Rect frame = layer->getDisplayFrame();
+  const common::Rect crop = layer->getSourceCropInt();
+  if (IsRectEmpty(frame) || IsRectEmpty(crop) || crop.left < 0 ||
+      crop.top < 0) {
+    return false;
+  }
+
+  auto bufferOpt = mGralloc.Import(bufferHandle);
+  if (!bufferOpt) {
+    ALOGE("%s: failed to import layer buffer.", __FUNCTION__);
+    return false;
+  }
+  auto bufferFormatOpt = bufferOpt->GetDrmFormat();
+  if (!bufferFormatOpt ||
+      !IsScanOutFormat(*bufferFormatOpt, layer->getBlendMode())) {
+    return false;
+  }
+
+  auto [error, drmBuffer] = mDrmClient.create(bufferHandle);
+  if (error != HWC3::Error::None) {
+    ALOGE("%s: failed to create drm buffer for layer:%" PRIu64, __FUNCTION__,
+          layer->getId());
+    return false;
+  }
+
+  *outPlaneLayer = DrmPlaneLayer{
+      .buffer = std::move(drmBuffer),
+      .cursor = layer->getCompositionType() == Composition::CURSOR,
+      .crtcX = frame.left,
+      .crtcY = frame.top,
+      .crtcW = static_cast<uint32_t>(frame.right - frame.left),
+      .crtcH = static_cast<uint32_t>(frame.bottom - frame.top),
+      .srcX = static_cast<uint32_t>(crop.left) << 16,
+      .srcY = static_cast<uint32_t>(crop.top) << 16,
+      .srcW = static_cast<uint32_t>(crop.right - crop.left) << 16,
+      .srcH = static_cast<uint32_t>(crop.bottom - crop.top) << 16,
+  };
+  return true;
+}
+
 bool GuestFrameComposer::canComposeLayer(Layer* layer) {
   const auto layerCompositionType = layer->getCompositionType();
   if (layerCompositionType == Composition::SOLID_COLOR) {
@@ -934,13 +1469,202 @@ bool GuestFrameComposer::canComposeLayer(Layer* layer) {
   return true;
 }
 
+common::Rect GuestFrameComposer::updateCompositionDamage(
+    Display* display, DisplayInfo& displayInfo,
+    const std::vector<Layer*>& layers, std::uint32_t width,
+    std::uint32_t height) {
+  const common::Rect fullDisplay = {
+      .left = 0,
+      .top = 0,
+      .right = static_cast<int32_t>(width),
+      .bottom = static_cast<int32_t>(height),
+  };
+
+  std::optional<std::array<float, 16>> colorTransform;
+  if (display->hasColorTransform()) {
+    colorTransform = display->getColorTransform();
+  }
+
+  std::vector<int64_t> layerIds;
+  layerIds.reserve(layers.size());
+  for (const Layer* layer : layers) {
+    layerIds.push_back(layer->getId());
+  }
+
+  // Layers coming, going or changing order, and a new color transform, all
+  // touch everything.
+  bool fullDamage = !displayInfo.lastLayersValid ||
+                    layerIds != displayInfo.lastLayerIds ||
+                    colorTransform != displayInfo.lastColorTransform;
+
+  common::Rect damage = {0, 0, 0, 0};
+  std::unordered_map<int64_t, LayerSnapshot> snapshots;
+  for (Layer* layer : layers) {
+    const LayerSnapshot snapshot = {
+        .compositionType = layer->getCompositionType(),
+        .displayFrame = layer->getDisplayFrame(),
+        .sourceCrop = layer->getSourceCropInt(),
+        .transform = layer->getTransform(),
+        .blendMode = layer->getBlendMode(),
+        .color = layer->getColor(),
+        .buffer = layer->getBuffer().getBuffer(),
+        .bufferGeneration = layer->getBufferGeneration(),
+    };
+
+    auto it = displayInfo.lastLayers.find(layer->getId());
+    if (!fullDamage && it != displayInfo.lastLayers.end()) {
+      const LayerSnapshot& last = it->second;
+      if (last.compositionType != snapshot.compositionType ||
+          last.displayFrame != snapshot.displayFrame ||
+          last.sourceCrop != snapshot.sourceCrop ||
+          last.transform != snapshot.transform ||
+          last.blendMode != snapshot.blendMode ||
+          last.color != snapshot.color) {
+        damage = UnionRects(damage, last.displayFrame);
+        damage = UnionRects(damage, snapshot.displayFrame);
+      } else if (snapshot.compositionType == Composition::DEVICE &&
+                 (last.buffer != snapshot.buffer ||
+                  last.bufferGeneration != snapshot.bufferGeneration)) {
+        damage = UnionRects(damage, GetLayerDamage(*layer));
+      }
+    }
+
+    snapshots.emplace(layer->getId(), snapshot);
+  }
+
+  for (const auto& [layerId, last] : displayInfo.lastLayers) {
+    if (snapshots.find(layerId) == snapshots.end()) {
+      displayInfo.layerCache.remove(layerId);
+    }
+  }
+
+  displayInfo.lastLayersValid = true;
+  displayInfo.lastLayerIds = std::move(layerIds);
+  displayInfo.lastLayers = std::move(snapshots);
+  displayInfo.lastColorTransform = colorTransform;
+
+  if (fullDamage) {
+    return fullDisplay;
+  }
+  damage = IntersectRects(damage, fullDisplay);
+  if (IsRectEmpty(damage)) {
+    return common::Rect{0, 0, 0, 0};
+  }
+  return damage;
+}
+
+bool GuestFrameComposer::canComposeClipped(const std::vector<Layer*>& layers,
+                                           const common::Rect& damage) {
+  for (Layer* layer : layers) {
+    const auto layerCompositionType = layer->getCompositionType();
+    if (layerCompositionType != Composition::DEVICE &&
+        layerCompositionType != Composition::SOLID_COLOR) {
+      continue;
+    }
+    if (IsRectEmpty(IntersectRects(layer->getDisplayFrame(), damage))) {
+      continue;
+    }
+    if (LayerNeedsTransform(*layer)) {
+      return false;
+    }
+    // Solid colors only get filled in, whatever their crop says.
+    if (layerCompositionType == Composition::SOLID_COLOR) {
+      continue;
+    }
+    if (LayerNeedsScaling(*layer)) {
+      return false;
+    }
+
+    // Chroma planes only line up with the crop at even offsets, so leave
+    // converted formats to a full composition.
+    auto bufferOpt = mGralloc.Import(layer->getBuffer().getBuffer());
+    if (!bufferOpt) {
+      return false;
+    }
+    auto bufferFormatOpt = bufferOpt->GetDrmFormat();
+    if (!bufferFormatOpt || (*bufferFormatOpt != DRM_FORMAT_XBGR8888 &&
+                             *bufferFormatOpt != DRM_FORMAT_ABGR8888)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+HWC3::Error GuestFrameComposer::lockLayerSource(Layer* layer,
+                                                LayerSource* source) {
+  source->buffer = mGralloc.Import(layer->waitAndGetBuffer());
+  if (!source->buffer) {
+    ALOGE("%s: failed to import layer buffer.", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+  GrallocBuffer& buffer = *source->buffer;
+
+  source->view = buffer.Lock();
+  if (!source->view) {
+    ALOGE("%s: failed to lock import layer buffer.", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+  GrallocBufferView& bufferView = *source->view;
+
+  auto bufferFormatOpt = buffer.GetDrmFormat();
+  if (!bufferFormatOpt) {
+    ALOGE("Failed to get gralloc buffer format.");
+    return HWC3::Error::NoResources;
+  }
+  source->drmFormat = *bufferFormatOpt;
+
+  auto bufferWidthOpt = buffer.GetWidth();
+  if (!bufferWidthOpt) {
+    ALOGE("Failed to get gralloc buffer width.");
+    return HWC3::Error::NoResources;
+  }
+  source->width = *bufferWidthOpt;
+
+  auto bufferHeightOpt = buffer.GetHeight();
+  if (!bufferHeightOpt) {
+    ALOGE("Failed to get gralloc buffer height.");
+    return HWC3::Error::NoResources;
+  }
+  source->height = *bufferHeightOpt;
+
+  if (source->drmFormat == DRM_FORMAT_NV12 ||
+      source->drmFormat == DRM_FORMAT_NV21 ||
+      source->drmFormat == DRM_FORMAT_YVU420) {
+    source->ycbcr = bufferView.GetYCbCr();
+    if (!source->ycbcr) {
+      ALOGE("%s failed to get raw ycbcr from view.", __FUNCTION__);
+      return HWC3::Error::NoResources;
+    }
+  } else {
+    auto bufferDataOpt = bufferView.Get();
+    if (!bufferDataOpt) {
+      ALOGE("%s failed to lock gralloc buffer.", __FUNCTION__);
+      return HWC3::Error::NoResources;
+    }
+    source->data = reinterpret_cast<uint8_t*>(*bufferDataOpt);
+
+    auto bufferStrideBytesOpt = buffer.GetMonoPlanarStrideBytes();
+    if (!bufferStrideBytesOpt) {
+      ALOGE("%s failed to get plane stride.", __FUNCTION__);
+      return HWC3::Error::NoResources;
+    }
+    source->strideBytes = *bufferStrideBytesOpt;
+  }
+
+  return HWC3::Error::None;
+}
+
 HWC3::Error GuestFrameComposer::composeLayerInto(
     Layer* srcLayer,                     //
+    const LayerSource& source,           //
     std::uint8_t* dstBuffer,             //
     std::uint32_t dstBufferWidth,        //
     std::uint32_t dstBufferHeight,       //
     std::uint32_t dstBufferStrideBytes,  //
-    std::uint32_t dstBufferBytesPerPixel) {
+    std::uint32_t dstBufferBytesPerPixel,
+    const std::optional<common::Rect>& clip,
+    ScratchBuffers& scratch,
+    LruCache<int64_t, CachedLayer>* layerCache) {
   ATRACE_CALL();
 
   libyuv::RotationMode rotation =
@@ -949,33 +1673,31 @@ HWC3::Error GuestFrameComposer::composeLayerInto(
   common::Rect srcLayerCrop = srcLayer->getSourceCropInt();
   common::Rect srcLayerDisplayFrame = srcLayer->getDisplayFrame();
 
-  BufferSpec srcLayerSpec;
+  if (clip) {
+    // Without scaling or transforms, source and destination move together.
+    const common::Rect clipped = IntersectRects(srcLayerDisplayFrame, *clip);
+    srcLayerCrop.left += clipped.left - srcLayerDisplayFrame.left;
+    srcLayerCrop.top += clipped.top - srcLayerDisplayFrame.top;
+    srcLayerCrop.right = srcLayerCrop.left + (clipped.right - clipped.left);
+    srcLayerCrop.bottom = srcLayerCrop.top + (clipped.bottom - clipped.top);
+    srcLayerDisplayFrame = clipped;
+  }
 
-  std::optional<GrallocBuffer> srcBufferOpt;
-  std::optional<GrallocBufferView> srcBufferViewOpt;
+  BufferSpec srcLayerSpec;
 
   const auto srcLayerCompositionType = srcLayer->getCompositionType();
   if (srcLayerCompositionType == Composition::DEVICE) {
-    srcBufferOpt = mGralloc.Import(srcLayer->waitAndGetBuffer());
-    if (!srcBufferOpt) {
-      ALOGE("%s: failed to import layer buffer.", __FUNCTION__);
+    if (!source.view) {
+      ALOGE("%s: layer buffer is not locked.", __FUNCTION__);
       return HWC3::Error::NoResources;
     }
-    GrallocBuffer& srcBuffer = *srcBufferOpt;
 
-    srcBufferViewOpt = srcBuffer.Lock();
-    if (!srcBufferViewOpt) {
-      ALOGE("%s: failed to lock import layer buffer.", __FUNCTION__);
-      return HWC3::Error::NoResources;
-    }
-    GrallocBufferView& srcBufferView = *srcBufferViewOpt;
-
-    auto srcLayerSpecOpt = GetBufferSpec(srcBuffer, srcBufferView, srcLayerCrop);
-    if (!srcLayerSpecOpt) {
-      return HWC3::Error::NoResources;
-    }
-
-    srcLayerSpec = *srcLayerSpecOpt;
+    srcLayerSpec = BufferSpec(
+        source.data, source.ycbcr, source.width, source.height,
+        srcLayerCrop.left, srcLayerCrop.top,
+        srcLayerCrop.right - srcLayerCrop.left,
+        srcLayerCrop.bottom - srcLayerCrop.top, source.drmFormat,
+        source.strideBytes, GetDrmFormatBytesPerPixel(source.drmFormat));
   } else if (srcLayerCompositionType == Composition::SOLID_COLOR) {
     // srcLayerSpec not used by `needsFill` below.
   }
@@ -985,7 +1707,7 @@ HWC3::Error GuestFrameComposer::composeLayerInto(
   bool needsConversion = srcLayerCompositionType == Composition::DEVICE &&
                          srcLayerSpec.drmFormat != DRM_FORMAT_XBGR8888 &&
                          srcLayerSpec.drmFormat != DRM_FORMAT_ABGR8888;
-  bool needsScaling = LayerNeedsScaling(*srcLayer);
+  bool needsScaling = !clip && LayerNeedsScaling(*srcLayer);
   bool needsRotation = rotation != libyuv::kRotate0;
   bool needsTranspose = needsRotation && rotation != libyuv::kRotate180;
   bool needsVFlip = GetVFlipFromTransform(srcLayer->getTransform());
@@ -1002,6 +1724,74 @@ HWC3::Error GuestFrameComposer::composeLayerInto(
       srcLayerDisplayFrame.bottom - srcLayerDisplayFrame.top,
       DRM_FORMAT_XBGR8888, dstBufferStrideBytes, dstBufferBytesPerPixel);
 
+  int mScratchBufferWidth =
+      srcLayerDisplayFrame.right - srcLayerDisplayFrame.left;
+  int mScratchBufferHeight =
+      srcLayerDisplayFrame.bottom - srcLayerDisplayFrame.top;
+  int mScratchBufferStrideBytes =
+      AlignToPower2(mScratchBufferWidth * dstBufferBytesPerPixel, 4);
+  int mScratchBufferSizeBytes =
+      mScratchBufferHeight * mScratchBufferStrideBytes;
+
+  // Unchanged layers reuse what they looked like right before blending last
+  // time, and layers seen unchanged for the first time keep it.
+  CachedLayer* cachedLayer = nullptr;
+  if (layerCache != nullptr && !clip &&
+      srcLayerCompositionType == Composition::DEVICE &&
+      (needsConversion || needsScaling || needsRotation || needsAttenuation)) {
+    const CachedLayerKey key = {
+        .buffer = srcLayer->getBuffer().getBuffer(),
+        .bufferGeneration = srcLayer->getBufferGeneration(),
+        .sourceCrop = srcLayerCrop,
+        .displayFrame = srcLayerDisplayFrame,
+        .transform = srcLayer->getTransform(),
+        .blendMode = srcLayer->getBlendMode(),
+        .planeAlpha = srcLayer->getPlaneAlpha(),
+        .dataspace = srcLayer->getDataspace(),
+    };
+
+    cachedLayer = layerCache->get(srcLayer->getId());
+    if (cachedLayer == nullptr || !(cachedLayer->key == key)) {
+      layerCache->set(srcLayer->getId(), CachedLayer{.key = key});
+      cachedLayer = nullptr;
+    } else if (!cachedLayer->pixels.empty()) {
+      const BufferSpec cachedSpec(cachedLayer->pixels.data(),
+                                  mScratchBufferWidth, mScratchBufferHeight,
+                                  cachedLayer->strideBytes);
+      int retval = needsBlending
+                       ? DoBlending(cachedSpec, dstLayerSpec, /*v_flip=*/false)
+                       : DoCopy(cachedSpec, dstLayerSpec, /*v_flip=*/false);
+      if (retval) {
+        ALOGE("Got error code %d composing cached layer", retval);
+      }
+      return HWC3::Error::None;
+    } else {
+      cachedLayer->pixels.resize(mScratchBufferSizeBytes);
+      cachedLayer->strideBytes = mScratchBufferStrideBytes;
+      // The cached pixels take the place of the last scratch buffer, so
+      // something has to take them to the destination afterwards.
+      needsCopy = !needsBlending;
+    }
+  }
+
+  // Layers that are neither resized nor moved around can go straight from
+  // the source to the destination a few rows at a time, instead of each
+  // step writing out a full frame for the next one to read.
+  const int fusedSteps = (needsConversion ? 1 : 0) +
+                         (needsAttenuation ? 1 : 0) + (needsBlending ? 1 : 0);
+  if (fusedSteps > 1 && !needsFill && !needsScaling && !needsRotation &&
+      !needsVFlip && cachedLayer == nullptr) {
+    const int blockBytes = GetRowBlockRows(dstLayerSpec.cropWidth) *
+                           dstLayerSpec.cropWidth * 4;
+    int retval = DoRowBlocks(srcLayerSpec, dstLayerSpec, needsConversion,
+                             needsAttenuation, needsBlending,
+                             getRotatingScratchBuffer(scratch, blockBytes, 0));
+    if (retval) {
+      ALOGE("Got error code %d from DoRowBlocks function", retval);
+    }
+    return HWC3::Error::None;
+  }
+
   // Add the destination layer to the bottom of the buffer stack
   std::vector<BufferSpec> dstBufferStack(1, dstLayerSpec);
 
@@ -1018,22 +1808,20 @@ HWC3::Error GuestFrameComposer::composeLayerInto(
                              (needsAttenuation ? 1 : 0) +
                              (needsBlending ? 1 : 0) + (needsCopy ? 1 : 0) - 1;
 
-  int mScratchBufferWidth =
-      srcLayerDisplayFrame.right - srcLayerDisplayFrame.left;
-  int mScratchBufferHeight =
-      srcLayerDisplayFrame.bottom - srcLayerDisplayFrame.top;
-  int mScratchBufferStrideBytes =
-      AlignToPower2(mScratchBufferWidth * dstBufferBytesPerPixel, 4);
-  int mScratchBufferSizeBytes =
-      mScratchBufferHeight * mScratchBufferStrideBytes;
-
   for (int i = 0; i < neededScratchBuffers; i++) {
     BufferSpec mScratchBufferspec(
-        getRotatingScratchBuffer(mScratchBufferSizeBytes, i),
+        getRotatingScratchBuffer(scratch, mScratchBufferSizeBytes, i),
         mScratchBufferWidth, mScratchBufferHeight, mScratchBufferStrideBytes);
     dstBufferStack.push_back(mScratchBufferspec);
   }
 
+  // The step right before the final blend or copy writes into the cache.
+  if (cachedLayer != nullptr) {
+    dstBufferStack[1] = BufferSpec(cachedLayer->pixels.data(),
+                                   mScratchBufferWidth, mScratchBufferHeight,
+                                   mScratchBufferStrideBytes);
+  }
+
   // Filling, conversion, and scaling should always be the first operations, so
   // that every other operation works on equally sized frames (guaranteed to fit
   // in the scratch buffers) in a common format.
@@ -1076,7 +1864,7 @@ HWC3::Error GuestFrameComposer::composeLayerInto(
 
       // In case of a scale, the source frame may be bigger than the default tmp
       // buffer size
-      dstBufferSpec.buffer = getSpecialScratchBuffer(needed_size);
+      dstBufferSpec.buffer = getSpecialScratchBuffer(scratch, needed_size);
     }
 
     int retval = DoConversion(srcLayerSpec, dstBufferSpec, needsVFlip);
@@ -1159,65 +1947,182 @@ HWC3::Error GuestFrameComposer::composeLayerInto(
 
 namespace {
 
-// Returns a color matrix that can be used with libyuv by converting values
-// in -1 to 1 into -64 to 64 and transposing.
-std::array<std::int8_t, 16> ToLibyuvColorMatrix(
-    const std::array<float, 16>& in) {
-  std::array<std::int8_t, 16> out;
+// Color matrix coefficients are applied in fixed point with this many
+// fraction bits. That keeps steps of 1/4096, where libyuv's matrices have
+// steps of 1/64, and room for coefficients up to 8 either way.
+constexpr int kColorMatrixShift = 12;
+
+// |m| holds the coefficient of input channel j for output channel c at
+// j * 4 + c. |rg| and |ba| interleave the coefficients of two input
+// channels for each output, for the SSE2 multiply-adds.
+struct ColorMatrix {
+  alignas(16) std::int16_t rg[8];
+  alignas(16) std::int16_t ba[8];
+  std::int16_t m[16];
+};
+
+// The transform multiplies the pixel, as a row vector in memory order,
+// by the matrix.
+ColorMatrix ToColorMatrix(const std::array<float, 16>& in) {
+  ColorMatrix out;
+  for (int i = 0; i < 16; i++) {
+    const float scaled =
+        std::round(in[i] * static_cast<float>(1 << kColorMatrixShift));
+    out.m[i] = static_cast<std::int16_t>(
+        std::max(-32768.0f, std::min(32767.0f, scaled)));
+  }
+  for (int c = 0; c < 4; c++) {
+    out.rg[2 * c] = out.m[0 * 4 + c];
+    out.rg[2 * c + 1] = out.m[1 * 4 + c];
+    out.ba[2 * c] = out.m[2 * 4 + c];
+    out.ba[2 * c + 1] = out.m[3 * 4 + c];
+  }
+  return out;
+}
 
-  for (int r = 0; r < 4; r++) {
+void TransformPixels(const ColorMatrix& matrix, const std::uint8_t* src,
+                     std::uint8_t* dst, std::uint32_t count) {
+  for (std::uint32_t i = 0; i < count; i++, src += 4, dst += 4) {
+    const std::int32_t in[4] = {src[0], src[1], src[2], src[3]};
     for (int c = 0; c < 4; c++) {
-      int indexIn = (4 * r) + c;
-      int indexOut = (4 * c) + r;
+      std::int32_t sum = 1 << (kColorMatrixShift - 1);
+      for (int j = 0; j < 4; j++) {
+        sum += in[j] * matrix.m[j * 4 + c];
+      }
+      dst[c] = static_cast<std::uint8_t>(
+          std::max(0, std::min(255, sum >> kColorMatrixShift)));
+    }
+  }
+}
+
+#if defined(__SSE2__)
+
+// One pixel, from its channels as 16 bit pairs repeated over the vector.
+inline __m128i TransformPixelSse2(__m128i rgPairs, __m128i baPairs,
+                                  __m128i rg, __m128i ba, __m128i round) {
+  const __m128i sum = _mm_add_epi32(_mm_madd_epi16(rgPairs, rg),
+                                    _mm_madd_epi16(baPairs, ba));
+  return _mm_srai_epi32(_mm_add_epi32(sum, round), kColorMatrixShift);
+}
+
+void TransformRow(const ColorMatrix& matrix, const std::uint8_t* src,
+                  std::uint8_t* dst, std::uint32_t width) {
+  const __m128i rg = _mm_load_si128(reinterpret_cast<const __m128i*>(matrix.rg));
+  const __m128i ba = _mm_load_si128(reinterpret_cast<const __m128i*>(matrix.ba));
+  const __m128i round = _mm_set1_epi32(1 << (kColorMatrixShift - 1));
+  const __m128i zero = _mm_setzero_si128();
+
+  std::uint32_t x = 0;
+  for (; x + 4 <= width; x += 4) {
+    const __m128i pixels =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+    const __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+    const __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+    const __m128i p0 = TransformPixelSse2(
+        _mm_shuffle_epi32(lo, _MM_SHUFFLE(0, 0, 0, 0)),
+        _mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 1, 1, 1)), rg, ba, round);
+    const __m128i p1 = TransformPixelSse2(
+        _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 2, 2, 2)),
+        _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 3, 3, 3)), rg, ba, round);
+    const __m128i p2 = TransformPixelSse2(
+        _mm_shuffle_epi32(hi, _MM_SHUFFLE(0, 0, 0, 0)),
+        _mm_shuffle_epi32(hi, _MM_SHUFFLE(1, 1, 1, 1)), rg, ba, round);
+    const __m128i p3 = TransformPixelSse2(
+        _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 2, 2, 2)),
+        _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 3, 3, 3)), rg, ba, round);
+    // Saturating packs clamp to 0 to 255.
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4),
+                     _mm_packus_epi16(_mm_packs_epi32(p0, p1),
+                                      _mm_packs_epi32(p2, p3)));
+  }
+  TransformPixels(matrix, src + x * 4, dst + x * 4, width - x);
+}
+
+#elif defined(__ARM_NEON)
+
+inline uint8x8_t TransformChannelNeon(const ColorMatrix& matrix, int c,
+                                      const int16x8_t in[4]) {
+  int32x4_t lo = vmull_n_s16(vget_low_s16(in[0]), matrix.m[c]);
+  int32x4_t hi = vmull_n_s16(vget_high_s16(in[0]), matrix.m[c]);
+  for (int j = 1; j < 4; j++) {
+    lo = vmlal_n_s16(lo, vget_low_s16(in[j]), matrix.m[j * 4 + c]);
+    hi = vmlal_n_s16(hi, vget_high_s16(in[j]), matrix.m[j * 4 + c]);
+  }
+  return vqmovun_s16(vcombine_s16(vqrshrn_n_s32(lo, kColorMatrixShift),
+                                  vqrshrn_n_s32(hi, kColorMatrixShift)));
+}
 
-      out[indexOut] = std::max(
-          -128, std::min(127, static_cast<int>(in[indexIn] * 64.0f + 0.5f)));
+void TransformRow(const ColorMatrix& matrix, const std::uint8_t* src,
+                  std::uint8_t* dst, std::uint32_t width) {
+  std::uint32_t x = 0;
+  for (; x + 8 <= width; x += 8) {
+    const uint8x8x4_t pixels = vld4_u8(src + x * 4);
+    int16x8_t in[4];
+    for (int j = 0; j < 4; j++) {
+      in[j] = vreinterpretq_s16_u16(vmovl_u8(pixels.val[j]));
     }
+    uint8x8x4_t out;
+    out.val[0] = TransformChannelNeon(matrix, 0, in);
+    out.val[1] = TransformChannelNeon(matrix, 1, in);
+    out.val[2] = TransformChannelNeon(matrix, 2, in);
+    out.val[3] = TransformChannelNeon(matrix, 3, in);
+    vst4_u8(dst + x * 4, out);
   }
+  TransformPixels(matrix, src + x * 4, dst + x * 4, width - x);
+}
 
-  return out;
+#else
+
+void TransformRow(const ColorMatrix& matrix, const std::uint8_t* src,
+                  std::uint8_t* dst, std::uint32_t width) {
+  TransformPixels(matrix, src, dst, width);
 }
 
+#endif
+
 }  // namespace
 
 HWC3::Error GuestFrameComposer::applyColorTransformToRGBA(
     const std::array<float, 16>& transfromMatrix,  //
-    std::uint8_t* buffer,                          //
+    const std::uint8_t* srcBuffer,                 //
+    std::uint32_t srcStrideBytes,                  //
+    std::uint8_t* dstBuffer,                       //
+    std::uint32_t dstStrideBytes,                  //
     std::uint32_t bufferWidth,                     //
-    std::uint32_t bufferHeight,                    //
-    std::uint32_t bufferStrideBytes) {
+    std::uint32_t bufferHeight) {
   ATRACE_CALL();
 
-  const auto transformMatrixLibyuv = ToLibyuvColorMatrix(transfromMatrix);
-  libyuv::ARGBColorMatrix(buffer, bufferStrideBytes,     // in buffer params
-                          buffer, bufferStrideBytes,     // out buffer params
-                          transformMatrixLibyuv.data(),  //
-                          bufferWidth,                   //
-                          bufferHeight);
+  const ColorMatrix matrix = ToColorMatrix(transfromMatrix);
+  for (std::uint32_t y = 0; y < bufferHeight; y++) {
+    TransformRow(matrix, srcBuffer + y * srcStrideBytes,
+                 dstBuffer + y * dstStrideBytes, bufferWidth);
+  }
 
   return HWC3::Error::None;
 }
 
-uint8_t* GuestFrameComposer::getRotatingScratchBuffer(std::size_t neededSize,
+uint8_t* GuestFrameComposer::getRotatingScratchBuffer(ScratchBuffers& scratch,
+                                                      std::size_t neededSize,
                                                       std::uint32_t order) {
   static constexpr const int kNumScratchBufferPieces = 2;
 
   std::size_t totalNeededSize = neededSize * kNumScratchBufferPieces;
-  if (mScratchBuffer.size() < totalNeededSize) {
-    mScratchBuffer.resize(totalNeededSize);
+  if (scratch.rotating.size() < totalNeededSize) {
+    scratch.rotating.resize(totalNeededSize);
   }
 
   std::size_t bufferIndex = order % kNumScratchBufferPieces;
   std::size_t bufferOffset = bufferIndex * neededSize;
-  return &mScratchBuffer[bufferOffset];
+  return &scratch.rotating[bufferOffset];
 }
 
-uint8_t* GuestFrameComposer::getSpecialScratchBuffer(size_t neededSize) {
-  if (mSpecialScratchBuffer.size() < neededSize) {
-    mSpecialScratchBuffer.resize(neededSize);
+uint8_t* GuestFrameComposer::getSpecialScratchBuffer(ScratchBuffers& scratch,
+                                                     size_t neededSize) {
+  if (scratch.special.size() < neededSize) {
+    scratch.special.resize(neededSize);
   }
 
-  return &mSpecialScratchBuffer[0];
+  return &scratch.special[0];
 }
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
@@ -17,12 +17,16 @@
 #ifndef ANDROID_HWC_GUESTFRAMECOMPOSER_H
 #define ANDROID_HWC_GUESTFRAMECOMPOSER_H
 
+#include <memory>
+
 #include "Common.h"
 #include "Display.h"
 #include "DrmClient.h"
 #include "FrameComposer.h"
 #include "Gralloc.h"
 #include "Layer.h"
+#include "LruCache.h"
+#include "aemu/base/threads/AndroidWorkStealingPool.h"
 
 namespace aidl::android::hardware::graphics::composer3::impl {
 
@@ -62,6 +66,13 @@ class GuestFrameComposer : public FrameComposer {
 
   HWC3::Error onActiveConfigChange(Display* /*display*/) override;
 
+  bool supportsReadback() const override { return true; }
+
+  HWC3::Error queueReadback(Display* display, buffer_handle_t buffer,
+                            ::android::base::unique_fd releaseFence) override;
+
+  HWC3::Error waitForReadback(Display* display) override;
+
   const DrmClient* getDrmPresenter() const override {
     return &mDrmClient;
   }
@@ -84,20 +95,140 @@ class GuestFrameComposer : public FrameComposer {
   // Returns true if the given layer's buffer has supported format.
   bool canComposeLayer(Layer* layer);
 
-  // Composes the given layer into the given destination buffer.
-  HWC3::Error composeLayerInto(Layer* layer, std::uint8_t* dstBuffer,
-                               std::uint32_t dstBufferWidth,
-                               std::uint32_t dstBufferHeight,
-                               std::uint32_t dstBufferStrideBytes,
-                               std::uint32_t dstBufferBytesPerPixel);
+  // Intermediate buffers for one thread's composition work.
+  struct ScratchBuffers {
+    std::vector<uint8_t> rotating;
+    std::vector<uint8_t> special;
+  };
+
+  // A layer's buffer, locked for reading while the frame is composed, and
+  // what composing it needs to know about it.
+  struct LayerSource {
+    std::optional<GrallocBuffer> buffer;
+    std::optional<GrallocBufferView> view;
+
+    uint8_t* data = nullptr;
+    std::optional<android_ycbcr> ycbcr;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t drmFormat = 0;
+    uint32_t strideBytes = 0;
+  };
+
+  HWC3::Error lockLayerSource(Layer* layer, LayerSource* source);
+
+  // Everything that goes into a layer's pixels before they are blended or
+  // copied into the composition result.
+  struct CachedLayerKey {
+    buffer_handle_t buffer;
+    uint64_t bufferGeneration;
+    common::Rect sourceCrop;
+    common::Rect displayFrame;
+    common::Transform transform;
+    common::BlendMode blendMode;
+    float planeAlpha;
+    common::Dataspace dataspace;
+
+    bool operator==(const CachedLayerKey& other) const {
+      return buffer == other.buffer &&
+             bufferGeneration == other.bufferGeneration &&
+             sourceCrop == other.sourceCrop &&
+             displayFrame == other.displayFrame &&
+             transform == other.transform && blendMode == other.blendMode &&
+             planeAlpha == other.planeAlpha && dataspace == other.dataspace;
+    }
+  };
+
+  // A layer's converted, scaled, rotated and attenuated pixels. The pixels
+  // are only kept once the layer showed up unchanged in two frames in a row,
+  // so layers with new contents every frame do not pay for the extra copy.
+  struct CachedLayer {
+    CachedLayerKey key;
+    std::vector<uint8_t> pixels;
+    std::uint32_t strideBytes = 0;
+  };
+
+  static constexpr std::size_t kMaxCachedLayers = 4;
+
+  // Composes the given layer into the given destination buffer. If `clip` is
+  // set, only the part of the layer inside it is composed, which requires
+  // that the layer is neither scaled nor transformed. Only touches `source`
+  // and `scratch` besides the destination, so layers can be composed into
+  // disjoint clips from several threads at once. `layerCache`, if given, is
+  // used to skip the work done on unchanged layers before blending and must
+  // not be shared between threads.
+  HWC3::Error composeLayerInto(
+      Layer* layer, const LayerSource& source, std::uint8_t* dstBuffer,
+      std::uint32_t dstBufferWidth, std::uint32_t dstBufferHeight,
+      std::uint32_t dstBufferStrideBytes, std::uint32_t dstBufferBytesPerPixel,
+      const std::optional<common::Rect>& clip, ScratchBuffers& scratch,
+      LruCache<int64_t, CachedLayer>* layerCache);
+
+  // What a layer looked like when it was last composed.
+  struct LayerSnapshot {
+    Composition compositionType;
+    common::Rect displayFrame;
+    common::Rect sourceCrop;
+    common::Transform transform;
+    common::BlendMode blendMode;
+    Color color;
+    buffer_handle_t buffer;
+    uint64_t bufferGeneration;
+  };
 
   struct DisplayInfo {
     // Additional per display buffer for the composition result.
     buffer_handle_t compositionResultBuffer = nullptr;
 
     std::shared_ptr<DrmBuffer> compositionResultDrmBuffer;
+    // Signals once the last flush of the composition result has landed.
+    ::android::base::unique_fd previousFlushFence;
+
+    // The composition result is kept from frame to frame, so only the parts
+    // that changed since these layers were composed have to be redone.
+    // Invalid whenever the result did not come from composing layers.
+    bool lastLayersValid = false;
+    std::vector<int64_t> lastLayerIds;
+    std::unordered_map<int64_t, LayerSnapshot> lastLayers;
+    std::optional<std::array<float, 16>> lastColorTransform;
+    // Pixels of layers that are composed the same way frame after frame.
+    LruCache<int64_t, CachedLayer> layerCache{kMaxCachedLayers};
+    // Layers that validateDisplay() put on planes of their own instead of
+    // composing them.
+    std::vector<int64_t> planeLayerIds;
+    // The copy of the composition result for the readback buffer, which
+    // the next composition waits for, and how it went.
+    std::unique_ptr<::android::base::guest::WorkStealingPool::TaskGroup>
+        readbackTasks = std::make_unique<
+            ::android::base::guest::WorkStealingPool::TaskGroup>();
+    HWC3::Error readbackError = HWC3::Error::None;
   };
 
+  // Copies `src` into `dst` once `dstReleaseFence` signals. Runs on the
+  // worker pool.
+  HWC3::Error copyForReadback(buffer_handle_t src, buffer_handle_t dst,
+                              int dstReleaseFence);
+
+  // Picks the layers, top first, that can be scanned out on DRM planes above
+  // the composition result, and checks with the kernel that they fit.
+  std::vector<int64_t> assignPlaneLayers(Display* display);
+
+  // Describes how the given layer is scanned out on a plane. Returns false if
+  // its buffer can not be scanned out.
+  bool getDrmPlaneLayer(Layer* layer, DrmPlaneLayer* outPlaneLayer);
+
+  // Returns the part of the display that has to be composed again, and
+  // records the current layers for the next frame.
+  common::Rect updateCompositionDamage(Display* display,
+                                       DisplayInfo& displayInfo,
+                                       const std::vector<Layer*>& layers,
+                                       std::uint32_t width,
+                                       std::uint32_t height);
+
+  // Returns true if the given layers can be composed clipped to `damage`.
+  bool canComposeClipped(const std::vector<Layer*>& layers,
+                         const common::Rect& damage);
+
   std::unordered_map<int64_t, DisplayInfo> mDisplayInfos;
 
   Gralloc mGralloc;
@@ -108,19 +239,27 @@ class GuestFrameComposer : public FrameComposer {
   // spamming logcat with DRM commit failures.
   bool mPresentDisabled = false;
 
-  uint8_t* getRotatingScratchBuffer(std::size_t neededSize,
-                                    std::uint32_t order);
-  uint8_t* getSpecialScratchBuffer(std::size_t neededSize);
+  static uint8_t* getRotatingScratchBuffer(ScratchBuffers& scratch,
+                                           std::size_t neededSize,
+                                           std::uint32_t order);
+  static uint8_t* getSpecialScratchBuffer(ScratchBuffers& scratch,
+                                          std::size_t neededSize);
 
+  // |srcBuffer| may be |dstBuffer|.
   HWC3::Error applyColorTransformToRGBA(
       const std::array<float, 16>& colorTransform,  //
-      std::uint8_t* buffer,                         //
+      const std::uint8_t* srcBuffer,                //
+      std::uint32_t srcStrideBytes,                 //
+      std::uint8_t* dstBuffer,                      //
+      std::uint32_t dstStrideBytes,                 //
       std::uint32_t bufferWidth,                    //
-      std::uint32_t bufferHeight,                   //
-      std::uint32_t bufferStrideBytes);
+      std::uint32_t bufferHeight);
 
-  std::vector<uint8_t> mScratchBuffer;
-  std::vector<uint8_t> mSpecialScratchBuffer;
+  // Splits composition into horizontal bands, up to one per thread of the
+  // process wide pool, each with its own scratch buffers.
+  ::android::base::guest::WorkStealingPool* mWorkerPool = nullptr;
+  std::size_t mMaxBands = 1;
+  std::vector<ScratchBuffers> mBandScratchBuffers;
 };
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
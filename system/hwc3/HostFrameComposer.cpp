@@ -251,10 +251,11 @@ HWC3::Error HostFrameComposer::createHostComposerDisplayInfo(
   HostComposerDisplayInfo& displayInfo = mDisplayInfos[displayId];
 
   displayInfo.hostDisplayId = hostDisplayId;
+  displayInfo.displayColorBuffer = 0;
   displayInfo.swapchain = DrmSwapchain::create(
       displayWidth, displayHeight,
       ::android::GraphicBuffer::USAGE_HW_COMPOSER | ::android::GraphicBuffer::USAGE_HW_RENDER,
-      mDrmClient ? &mDrmClient.value() : nullptr);
+      mDrmClient ? &mDrmClient.value() : nullptr, GetSwapchainDepth(displayId));
   if (!displayInfo.swapchain) {
     ALOGE("%s: display:%" PRIu64 " failed to allocate swapchain", __FUNCTION__, displayId);
     return HWC3::Error::NoResources;
@@ -531,8 +532,9 @@ HWC3::Error HostFrameComposer::presentDisplay(
     hostCompositionV1 = false;
   }
 
-  auto compositionResult = displayInfo.swapchain->getNextImage();
-  compositionResult->wait();
+  // Only taken, and waited for, by the paths that write into it, so that
+  // posting the client target never blocks on an earlier frame.
+  DrmSwapchain::Image* compositionResult = nullptr;
 
   const std::vector<Layer*> layers = display->getOrderedLayers();
   if (hostCompositionV2 || hostCompositionV1) {
@@ -561,15 +563,16 @@ HWC3::Error HostFrameComposer::presentDisplay(
 
           *outDisplayFence = std::move(flushCompleteFence);
         } else {
-          rcEnc->rcSetDisplayColorBuffer(rcEnc, displayInfo.hostDisplayId,
-                  hostCon->grallocHelper()->getHostHandle(displayClientTarget.getBuffer()));
-          post(hostCon, rcEnc, displayClientTarget.getBuffer());
+          post(hostCon, rcEnc, displayInfo, displayClientTarget.getBuffer());
           *outDisplayFence = std::move(fence);
         }
       }
       return HWC3::Error::None;
     }
 
+    compositionResult = displayInfo.swapchain->getNextImage();
+    compositionResult->wait();
+
     std::unique_ptr<ComposeMsg> composeMsg;
     std::unique_ptr<ComposeMsg_v2> composeMsgV2;
 
@@ -665,6 +668,21 @@ HWC3::Error HostFrameComposer::presentDisplay(
     }
 
     ::android::base::unique_fd retire_fd;
+
+    // Send a retire fence and use it as the release fence for all layers,
+    // since media expects it
+    EGLint attribs[] = {EGL_SYNC_NATIVE_FENCE_ANDROID,
+                        EGL_NO_NATIVE_FENCE_FD_ANDROID};
+
+    uint64_t sync_handle, thread_handle;
+
+    // We don't use rc command to sync if we are using ANGLE on the guest with
+    // virtio-gpu.
+    bool useRcCommandToSync = !(mUseAngle && mIsMinigbm);
+
+    // The composition and its retire fence go out together, so that the
+    // fence is the only round trip of the frame. With async frame commands
+    // the composition itself does not wait for the host.
     hostCon->lock();
     if (rcEnc->hasAsyncFrameCommands()) {
       if (mIsMinigbm) {
@@ -679,26 +697,17 @@ HWC3::Error HostFrameComposer::presentDisplay(
         rcEnc->rcCompose(rcEnc, bufferSize, buffer);
       }
     }
-    hostCon->unlock();
-
-    // Send a retire fence and use it as the release fence for all layers,
-    // since media expects it
-    EGLint attribs[] = {EGL_SYNC_NATIVE_FENCE_ANDROID,
-                        EGL_NO_NATIVE_FENCE_FD_ANDROID};
-
-    uint64_t sync_handle, thread_handle;
-
-    // We don't use rc command to sync if we are using ANGLE on the guest with
-    // virtio-gpu.
-    bool useRcCommandToSync = !(mUseAngle && mIsMinigbm);
-
     if (useRcCommandToSync) {
-      hostCon->lock();
       rcEnc->rcCreateSyncKHR(
           rcEnc, EGL_SYNC_NATIVE_FENCE_ANDROID, attribs, 2 * sizeof(EGLint),
           true /* destroy when signaled */, &sync_handle, &thread_handle);
-      hostCon->unlock();
+    } else if (rcEnc->hasAsyncFrameCommands()) {
+      hostCon->flush();
     }
+    hostCon->unlock();
+
+    // Composing may show the composition result on the host display.
+    displayInfo.displayColorBuffer = 0;
 
     if (mIsMinigbm) {
       auto [_, fence] =
@@ -731,31 +740,49 @@ HWC3::Error HostFrameComposer::presentDisplay(
     ::android::base::unique_fd displayClientTargetFence =
         displayClientTarget.getFence();
     if (mIsMinigbm) {
+      compositionResult = displayInfo.swapchain->getNextImage();
+      compositionResult->wait();
       auto [_, flushFence] = mDrmClient->flushToDisplay(
           displayId, compositionResult->getDrmBuffer(), displayClientTargetFence);
       *outDisplayFence = std::move(flushFence);
     } else {
-          rcEnc->rcSetDisplayColorBuffer(rcEnc, displayInfo.hostDisplayId,
-                  hostCon->grallocHelper()->getHostHandle(displayClientTarget.getBuffer()));
-      post(hostCon, rcEnc, displayClientTarget.getBuffer());
+      post(hostCon, rcEnc, displayInfo, displayClientTarget.getBuffer());
       *outDisplayFence = std::move(displayClientTargetFence);
     }
     ALOGV("%s fallback to post, returns outRetireFence %d", __FUNCTION__,
           outDisplayFence->get());
   }
-  compositionResult->markAsInUse(outDisplayFence->ok()
-                                     ? ::android::base::unique_fd(dup(*outDisplayFence))
-                                     : ::android::base::unique_fd());
+  if (compositionResult != nullptr) {
+    compositionResult->markAsInUse(outDisplayFence->ok()
+                                       ? ::android::base::unique_fd(dup(*outDisplayFence))
+                                       : ::android::base::unique_fd());
+  }
   return HWC3::Error::None;
 }
 
 void HostFrameComposer::post(HostConnection* hostCon,
                              ExtendedRCEncoderContext* rcEnc,
+                             HostComposerDisplayInfo& displayInfo,
                              buffer_handle_t h) {
   assert(cb && "native_handle_t::from(h) failed");
 
+  const uint32_t hostHandle = hostCon->grallocHelper()->getHostHandle(h);
+
   hostCon->lock();
-  rcEnc->rcFBPost(rcEnc, hostCon->grallocHelper()->getHostHandle(h));
+  // Setting the display color buffer waits for the host unless it has the
+  // async command, so it is only done when the display is given a buffer it
+  // was not showing already.
+  if (displayInfo.displayColorBuffer != hostHandle) {
+    if (rcEnc->hasAsyncColorBufferCommands()) {
+      rcEnc->rcSetDisplayColorBufferAsync(rcEnc, displayInfo.hostDisplayId,
+                                          hostHandle);
+    } else {
+      rcEnc->rcSetDisplayColorBuffer(rcEnc, displayInfo.hostDisplayId,
+                                     hostHandle);
+    }
+    displayInfo.displayColorBuffer = hostHandle;
+  }
+  rcEnc->rcFBPost(rcEnc, hostHandle);
   hostCon->flush();
   hostCon->unlock();
 }
@@ -77,8 +77,10 @@ class HostFrameComposer : public FrameComposer {
   HWC3::Error createHostComposerDisplayInfo(Display* display,
                                             uint32_t hostDisplayId);
 
+  struct HostComposerDisplayInfo;
+
   void post(HostConnection* hostCon, ExtendedRCEncoderContext* rcEnc,
-            buffer_handle_t h);
+            HostComposerDisplayInfo& displayInfo, buffer_handle_t h);
 
   bool mIsMinigbm = false;
 
@@ -91,6 +93,8 @@ class HostFrameComposer : public FrameComposer {
     std::unique_ptr<DrmSwapchain> swapchain = {};
     // Drm info for the displays client target buffer.
     std::shared_ptr<DrmBuffer> clientTargetDrmBuffer;
+    // The color buffer last set for the host display, or 0.
+    uint32_t displayColorBuffer = 0;
   };
 
   std::unordered_map<int64_t, HostComposerDisplayInfo> mDisplayInfos;
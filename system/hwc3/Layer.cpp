@@ -19,6 +19,7 @@
 #include <android-base/unique_fd.h>
 #include <sync/sync.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 
@@ -27,6 +28,8 @@ namespace {
 
 std::atomic<int64_t> sNextId{1};
 
+constexpr size_t kMaxValidatedBuffers = 4;
+
 }  // namespace
 
 Layer::Layer() : mId(sNextId++) {}
@@ -59,6 +62,7 @@ HWC3::Error Layer::setBuffer(buffer_handle_t buffer,
   }
 
   mBuffer.set(buffer, fence);
+  ++mBufferGeneration;
   return HWC3::Error::None;
 }
 
@@ -84,9 +88,23 @@ buffer_handle_t Layer::waitAndGetBuffer() {
 }
 
 HWC3::Error Layer::setSurfaceDamage(
-    const std::vector<std::optional<common::Rect>>& /*damage*/) {
+    const std::vector<std::optional<common::Rect>>& damage) {
   DEBUG_LOG("%s: layer:%" PRId64, __FUNCTION__, mId);
 
+  mSurfaceDamage.clear();
+  mSurfaceDamage.reserve(damage.size());
+  for (const auto& rectOption : damage) {
+    // Anything odd means the damage cannot be trusted, so fall back to
+    // treating the whole buffer as changed.
+    if (!rectOption || rectOption->left < 0 || rectOption->top < 0 ||
+        rectOption->right <= rectOption->left ||
+        rectOption->bottom <= rectOption->top) {
+      mSurfaceDamage.clear();
+      break;
+    }
+    mSurfaceDamage.push_back(*rectOption);
+  }
+
   return HWC3::Error::None;
 }
 
@@ -95,6 +113,9 @@ HWC3::Error Layer::setBlendMode(common::BlendMode blendMode) {
   DEBUG_LOG("%s: layer:%" PRId64 " blend mode:%s", __FUNCTION__, mId,
             blendModeString.c_str());
 
+  if (mBlendMode != blendMode) {
+    onPropertyChanged();
+  }
   mBlendMode = blendMode;
   return HWC3::Error::None;
 }
@@ -113,6 +134,9 @@ HWC3::Error Layer::setColor(Color color) {
             " color-r:%f color-g:%f color-b:%f color-a:%f)",
             __FUNCTION__, mId, color.r, color.g, color.b, color.a);
 
+  if (mColor != color) {
+    onPropertyChanged();
+  }
   mColor = color;
   return HWC3::Error::None;
 }
@@ -131,6 +155,9 @@ HWC3::Error Layer::setCompositionType(Composition compositionType) {
   DEBUG_LOG("%s: layer:%" PRId64 " composition type:%s", __FUNCTION__, mId,
             compositionTypeString.c_str());
 
+  if (mCompositionType != compositionType) {
+    onPropertyChanged();
+  }
   mCompositionType = compositionType;
   return HWC3::Error::None;
 }
@@ -148,6 +175,9 @@ HWC3::Error Layer::setDataspace(common::Dataspace dataspace) {
   DEBUG_LOG("%s: layer:%" PRId64 " dataspace:%s", __FUNCTION__, mId,
             dataspaceString.c_str());
 
+  if (mDataspace != dataspace) {
+    onPropertyChanged();
+  }
   mDataspace = dataspace;
   return HWC3::Error::None;
 }
@@ -166,6 +196,9 @@ HWC3::Error Layer::setDisplayFrame(common::Rect frame) {
             __FUNCTION__, mId, frame.left, frame.top, frame.right,
             frame.bottom);
 
+  if (mDisplayFrame != frame) {
+    onPropertyChanged();
+  }
   mDisplayFrame = frame;
   return HWC3::Error::None;
 }
@@ -183,6 +216,9 @@ common::Rect Layer::getDisplayFrame() const {
 HWC3::Error Layer::setPlaneAlpha(float alpha) {
   DEBUG_LOG("%s: layer:%" PRId64 "alpha:%f", __FUNCTION__, mId, alpha);
 
+  if (mPlaneAlpha != alpha) {
+    onPropertyChanged();
+  }
   mPlaneAlpha = alpha;
   return HWC3::Error::None;
 }
@@ -197,6 +233,8 @@ float Layer::getPlaneAlpha() const {
 HWC3::Error Layer::setSidebandStream(buffer_handle_t /*stream*/) {
   DEBUG_LOG("%s: layer:%" PRId64, __FUNCTION__, mId);
 
+  onPropertyChanged();
+
   return HWC3::Error::None;
 }
 
@@ -205,6 +243,9 @@ HWC3::Error Layer::setSourceCrop(common::FRect crop) {
             "crop rect-left:%f rect-top:%f rect-right:%f rect-bot:%f",
             __FUNCTION__, mId, crop.left, crop.top, crop.right, crop.bottom);
 
+  if (mSourceCrop != crop) {
+    onPropertyChanged();
+  }
   mSourceCrop = crop;
   return HWC3::Error::None;
 }
@@ -236,6 +277,9 @@ HWC3::Error Layer::setTransform(common::Transform transform) {
   DEBUG_LOG("%s: layer:%" PRId64 " transform:%s", __FUNCTION__, mId,
             transformString.c_str());
 
+  if (mTransform != transform) {
+    onPropertyChanged();
+  }
   mTransform = transform;
   return HWC3::Error::None;
 }
@@ -252,13 +296,17 @@ HWC3::Error Layer::setVisibleRegion(
     const std::vector<std::optional<common::Rect>>& visible) {
   DEBUG_LOG("%s: layer:%" PRId64, __FUNCTION__, mId);
 
-  mVisibleRegion.clear();
-  mVisibleRegion.reserve(visible.size());
+  std::vector<common::Rect> visibleRegion;
+  visibleRegion.reserve(visible.size());
   for (const auto& rectOption : visible) {
     if (rectOption) {
-      mVisibleRegion.push_back(*rectOption);
+      visibleRegion.push_back(*rectOption);
     }
   }
+  if (mVisibleRegion != visibleRegion) {
+    onPropertyChanged();
+    mVisibleRegion = std::move(visibleRegion);
+  }
 
   return HWC3::Error::None;
 }
@@ -274,6 +322,9 @@ std::size_t Layer::getNumVisibleRegions() const {
 HWC3::Error Layer::setZOrder(int32_t z) {
   DEBUG_LOG("%s: layer:%" PRId64 " z:%d", __FUNCTION__, mId, z);
 
+  if (mZOrder != z) {
+    onPropertyChanged();
+  }
   mZOrder = z;
   return HWC3::Error::None;
 }
@@ -298,8 +349,12 @@ HWC3::Error Layer::setColorTransform(const std::vector<float>& colorTransform) {
     return HWC3::Error::BadParameter;
   }
 
-  mColorTransform.emplace();
-  std::copy_n(colorTransform.data(), 16, mColorTransform->data());
+  std::array<float, 16> transform;
+  std::copy_n(colorTransform.data(), 16, transform.data());
+  if (mColorTransform != transform) {
+    onPropertyChanged();
+    mColorTransform = transform;
+  }
   return HWC3::Error::None;
 }
 
@@ -318,6 +373,9 @@ HWC3::Error Layer::setBrightness(float brightness) {
     return HWC3::Error::BadParameter;
   }
 
+  if (mBrightness != brightness) {
+    onPropertyChanged();
+  }
   mBrightness = brightness;
   return HWC3::Error::None;
 }
@@ -336,4 +394,33 @@ HWC3::Error Layer::setPerFrameMetadataBlobs(
   return HWC3::Error::None;
 }
 
+bool Layer::isValidated() const {
+  if (mChangedSinceValidate) {
+    return false;
+  }
+  buffer_handle_t buffer = mBuffer.getBuffer();
+  return buffer == nullptr ||
+         std::find(mValidatedBuffers.begin(), mValidatedBuffers.end(),
+                   buffer) != mValidatedBuffers.end();
+}
+
+void Layer::onValidated() {
+  mChangedSinceValidate = false;
+  buffer_handle_t buffer = mBuffer.getBuffer();
+  if (buffer == nullptr ||
+      std::find(mValidatedBuffers.begin(), mValidatedBuffers.end(), buffer) !=
+          mValidatedBuffers.end()) {
+    return;
+  }
+  if (mValidatedBuffers.size() == kMaxValidatedBuffers) {
+    mValidatedBuffers.erase(mValidatedBuffers.begin());
+  }
+  mValidatedBuffers.push_back(buffer);
+}
+
+void Layer::onPropertyChanged() {
+  mChangedSinceValidate = true;
+  mValidatedBuffers.clear();
+}
+
 }  // namespace aidl::android::hardware::graphics::composer3::impl
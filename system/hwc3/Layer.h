@@ -43,9 +43,15 @@ class Layer {
                         const ndk::ScopedFileDescriptor& fence);
   FencedBuffer& getBuffer();
   buffer_handle_t waitAndGetBuffer();
+  // Bumped on every setBuffer(), including ones that pass the same handle.
+  uint64_t getBufferGeneration() const { return mBufferGeneration; }
 
   HWC3::Error setSurfaceDamage(
       const std::vector<std::optional<common::Rect>>& damage);
+  // In buffer coordinates. Empty if the whole buffer may have changed.
+  const std::vector<common::Rect>& getSurfaceDamage() const {
+    return mSurfaceDamage;
+  }
 
   HWC3::Error setBlendMode(common::BlendMode mode);
   common::BlendMode getBlendMode() const;
@@ -77,6 +83,9 @@ class Layer {
   HWC3::Error setVisibleRegion(
       const std::vector<std::optional<common::Rect>>& visible);
   std::size_t getNumVisibleRegions() const;
+  const std::vector<common::Rect>& getVisibleRegions() const {
+    return mVisibleRegion;
+  }
 
   HWC3::Error setZOrder(int32_t z);
   int32_t getZOrder() const;
@@ -93,10 +102,24 @@ class Layer {
   HWC3::Error setPerFrameMetadataBlobs(
       const std::vector<std::optional<PerFrameMetadataBlob>>& perFrameMetadata);
 
+  // Whether the last validate still holds for this layer: none of its
+  // properties have changed since, and it shows a buffer that was
+  // validated with them. New buffer contents do not matter.
+  bool isValidated() const;
+  // Called once validate's changes, if any, have been accepted.
+  void onValidated();
+  // For a buffer slot that now holds a newly imported buffer, whose handle
+  // may be that of a freed one.
+  void forgetValidatedBuffers() { mValidatedBuffers.clear(); }
+
  private:
+  void onPropertyChanged();
+
   const int64_t mId;
   common::Point mCursorPosition;
   FencedBuffer mBuffer;
+  uint64_t mBufferGeneration = 0;
+  std::vector<common::Rect> mSurfaceDamage;
   common::BlendMode mBlendMode = common::BlendMode::NONE;
   Color mColor = {0, 0, 0, 0};
   Composition mCompositionType = Composition::INVALID;
@@ -109,6 +132,10 @@ class Layer {
   int32_t mZOrder = 0;
   std::optional<std::array<float, 16>> mColorTransform;
   float mBrightness = 1.0f;
+
+  bool mChangedSinceValidate = true;
+  // The handles of a swapchain's worth of buffers.
+  std::vector<buffer_handle_t> mValidatedBuffers;
 };
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
@@ -32,7 +32,7 @@ class LruCache {
 
         // Move to front.
         auto elementsIt = tableIt->second;
-        m_elements.splice(elementsIt, m_elements, m_elements.begin());
+        m_elements.splice(m_elements.begin(), m_elements, elementsIt);
         return &elementsIt->value;
     }
 
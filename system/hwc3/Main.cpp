@@ -17,21 +17,18 @@
 #include <android-base/logging.h>
 #include <android/binder_manager.h>
 #include <android/binder_process.h>
-#include <sched.h>
 
 #include "Composer.h"
+#include "aemu/base/threads/AndroidThreadPolicy.h"
 
 using aidl::android::hardware::graphics::composer3::impl::Composer;
 
 int main(int /*argc*/, char** /*argv*/) {
   ALOGI("RanchuHWC (HWComposer3/HWC3) starting up...");
 
-  // same as SF main thread
-  struct sched_param param = {0};
-  param.sched_priority = 2;
-  if (sched_setscheduler(0, SCHED_FIFO | SCHED_RESET_ON_FORK, &param) != 0) {
-    ALOGE("%s: failed to set priority: %s", __FUNCTION__, strerror(errno));
-  }
+  // By default the same as the SF main thread.
+  ::android::base::guest::applyThreadPolicy(
+      ::android::base::guest::ThreadRole::Composer);
 
   auto composer = ndk::SharedRefBase::make<Composer>();
   CHECK(composer != nullptr);
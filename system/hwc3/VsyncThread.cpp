@@ -16,11 +16,14 @@
 
 #include "VsyncThread.h"
 
+#include <sync/sync.h>
 #include <utils/ThreadDefs.h>
 
+#include <algorithm>
 #include <thread>
 
 #include "Time.h"
+#include "aemu/base/threads/AndroidThreadPolicy.h"
 
 namespace aidl::android::hardware::graphics::composer3::impl {
 namespace {
@@ -39,6 +42,54 @@ TimePoint GetNextVsyncInPhase(Nanoseconds vsyncPeriod, TimePoint previousVsync,
   return previousVsync + (nextMultiple * vsyncPeriod);
 }
 
+// Time kept between the predicted end of a frame and its vsync, to absorb
+// scheduling jitter.
+constexpr const Nanoseconds kCompositionMargin = std::chrono::milliseconds(2);
+
+// Present fences are only checked once per vsync, so only a few frames can
+// be waiting on theirs at once.
+constexpr const std::size_t kMaxPendingPresents = 4;
+
+// Lets estimates come down by a sixteenth of the difference per frame.
+constexpr const int kEstimateDecayDivisor = 16;
+
+Nanoseconds UpdateEstimate(Nanoseconds estimate, Nanoseconds sample) {
+  if (sample >= estimate) {
+    return sample;
+  }
+  return estimate - (estimate - sample) / kEstimateDecayDivisor;
+}
+
+enum class FenceState {
+  kPending,
+  kSignaled,
+  kError,
+};
+
+FenceState GetFenceSignalTime(int fenceFd, TimePoint* outSignalTime) {
+  struct sync_file_info* info = sync_file_info(fenceFd);
+  if (info == nullptr) {
+    ALOGE("%s: failed to get present fence info", __FUNCTION__);
+    return FenceState::kError;
+  }
+
+  FenceState state = FenceState::kPending;
+  if (info->status == 1) {
+    state = FenceState::kSignaled;
+    uint64_t signalTimeNanos = 0;
+    struct sync_fence_info* fences = sync_get_fence_info(info);
+    for (uint32_t i = 0; i < info->num_fences; i++) {
+      signalTimeNanos = std::max(signalTimeNanos, fences[i].timestamp_ns);
+    }
+    *outSignalTime = asTimePoint(static_cast<int64_t>(signalTimeNanos));
+  } else if (info->status < 0) {
+    state = FenceState::kError;
+  }
+
+  sync_file_info_free(info);
+  return state;
+}
+
 }  // namespace
 
 VsyncThread::VsyncThread(int64_t displayId) : mDisplayId(displayId) {
@@ -63,15 +114,6 @@ HWC3::Error VsyncThread::start(int32_t vsyncPeriodNanos) {
           strerror(ret));
   }
 
-  struct sched_param param = {
-      .sched_priority = ANDROID_PRIORITY_DISPLAY,
-  };
-  ret = pthread_setschedparam(mThread.native_handle(), SCHED_FIFO, &param);
-  if (ret != 0) {
-    ALOGE("%s: failed to set Vsync thread priority: %s", __FUNCTION__,
-          strerror(ret));
-  }
-
   return HWC3::Error::None;
 }
 
@@ -126,6 +168,98 @@ HWC3::Error VsyncThread::scheduleVsyncUpdate(
   return HWC3::Error::None;
 }
 
+TimePoint VsyncThread::getCompositionStartTime(TimePoint expectedPresentTime) {
+  std::unique_lock<std::mutex> lock(mStateMutex);
+
+  const TimePoint now = std::chrono::steady_clock::now();
+  const TimePoint targetVsync = GetNextVsyncInPhase(
+      mVsyncPeriod, mPreviousVsync, expectedPresentTime - Nanoseconds(1));
+  const Nanoseconds lead =
+      std::max(mComposeTimeEstimate, mPresentLatencyEstimate) +
+      kCompositionMargin;
+
+  return std::min(targetVsync - lead, now + mVsyncPeriod);
+}
+
+void VsyncThread::onFramePresented(TimePoint composeStart, TimePoint composeEnd,
+                                   std::optional<TimePoint> expectedPresentTime,
+                                   ::android::base::unique_fd presentFence) {
+  std::unique_lock<std::mutex> lock(mStateMutex);
+
+  const Nanoseconds composeTime = composeEnd - composeStart;
+  mComposeTimeEstimate = UpdateEstimate(mComposeTimeEstimate, composeTime);
+  mTotalComposeTime += composeTime;
+  mMaxComposeTime = std::max(mMaxComposeTime, composeTime);
+  mFrames++;
+
+  const TimePoint targetVsync =
+      expectedPresentTime
+          ? GetNextVsyncInPhase(mVsyncPeriod, mPreviousVsync,
+                                *expectedPresentTime - Nanoseconds(1))
+          : GetNextVsyncInPhase(mVsyncPeriod, mPreviousVsync, composeStart);
+
+  if (!presentFence.ok()) {
+    if (composeEnd > targetVsync) {
+      mMissedFrames++;
+    }
+    return;
+  }
+
+  mPendingPresents.push_back(PendingPresent{
+      .composeStart = composeStart,
+      .targetVsync = targetVsync,
+      .fence = std::move(presentFence),
+  });
+  if (mPendingPresents.size() > kMaxPendingPresents) {
+    mPendingPresents.pop_front();
+  }
+}
+
+void VsyncThread::checkPresentFencesLocked() {
+  while (!mPendingPresents.empty()) {
+    PendingPresent& present = mPendingPresents.front();
+
+    TimePoint signalTime;
+    FenceState state = GetFenceSignalTime(present.fence.get(), &signalTime);
+    if (state == FenceState::kPending) {
+      break;
+    }
+
+    if (state == FenceState::kSignaled) {
+      const Nanoseconds latency = signalTime - present.composeStart;
+      mPresentLatencyEstimate =
+          UpdateEstimate(mPresentLatencyEstimate, latency);
+      mTotalPresentLatency += latency;
+      mFramesWithPresentFence++;
+
+      if (signalTime > present.targetVsync + mVsyncPeriod / 2) {
+        mMissedFrames++;
+      }
+    }
+
+    mPendingPresents.pop_front();
+  }
+}
+
+VsyncThread::FrameTimingStats VsyncThread::getFrameTimingStats() {
+  std::unique_lock<std::mutex> lock(mStateMutex);
+
+  checkPresentFencesLocked();
+
+  FrameTimingStats stats;
+  stats.frames = mFrames;
+  stats.missedFrames = mMissedFrames;
+  stats.maxComposeTime = mMaxComposeTime;
+  if (mFrames > 0) {
+    stats.averageComposeTime = mTotalComposeTime / static_cast<int64_t>(mFrames);
+  }
+  if (mFramesWithPresentFence > 0) {
+    stats.averagePresentLatency =
+        mTotalPresentLatency / static_cast<int64_t>(mFramesWithPresentFence);
+  }
+  return stats;
+}
+
 Nanoseconds VsyncThread::updateVsyncPeriodLocked(TimePoint now) {
   if (mPendingUpdate && now > mPendingUpdate->updateAfter) {
     mVsyncPeriod = mPendingUpdate->period;
@@ -138,6 +272,9 @@ Nanoseconds VsyncThread::updateVsyncPeriodLocked(TimePoint now) {
 void VsyncThread::threadLoop() {
   ALOGI("Vsync thread for display:%" PRId64 " starting", mDisplayId);
 
+  ::android::base::guest::applyThreadPolicy(
+      ::android::base::guest::ThreadRole::Vsync);
+
   Nanoseconds vsyncPeriod = mVsyncPeriod;
 
   int vsyncs = 0;
@@ -156,6 +293,8 @@ void VsyncThread::threadLoop() {
       // Display has finished refreshing at previous vsync period. Update the
       // vsync period if there was a pending update.
       vsyncPeriod = updateVsyncPeriodLocked(mPreviousVsync);
+
+      checkPresentFencesLocked();
     }
 
     if (mVsyncEnabled) {
@@ -172,6 +311,15 @@ void VsyncThread::threadLoop() {
       DEBUG_LOG("%s: for display:%" PRIu64 " send %" PRIu32
                 " in last %d seconds",
                 __FUNCTION__, mDisplayId, vsyncs, kLogIntervalSeconds);
+
+      const FrameTimingStats stats = getFrameTimingStats();
+      DEBUG_LOG("%s: for display:%" PRIu64 " frames:%" PRIu64
+                " missed:%" PRIu64 " compose avg:%" PRId64 "ns max:%" PRId64
+                "ns present latency avg:%" PRId64 "ns",
+                __FUNCTION__, mDisplayId, stats.frames, stats.missedFrames,
+                static_cast<int64_t>(stats.averageComposeTime.count()),
+                static_cast<int64_t>(stats.maxComposeTime.count()),
+                static_cast<int64_t>(stats.averagePresentLatency.count()));
       previousLog = now;
       vsyncs = 0;
     }
@@ -19,18 +19,22 @@
 
 #include <aidl/android/hardware/graphics/composer3/VsyncPeriodChangeConstraints.h>
 #include <aidl/android/hardware/graphics/composer3/VsyncPeriodChangeTimeline.h>
+#include <android-base/unique_fd.h>
 #include <android/hardware/graphics/common/1.0/types.h>
 
 #include <chrono>
+#include <deque>
 #include <mutex>
 #include <optional>
 #include <thread>
 
 #include "Common.h"
+#include "Time.h"
 
 namespace aidl::android::hardware::graphics::composer3::impl {
 
-// Generates Vsync signals in software.
+// Generates Vsync signals in software, and keeps track of how long frames
+// take from the start of composition to showing up on the display.
 class VsyncThread {
  public:
   VsyncThread(int64_t id);
@@ -53,6 +57,29 @@ class VsyncThread {
       const VsyncPeriodChangeConstraints& newVsyncPeriodChangeConstraints,
       VsyncPeriodChangeTimeline* timeline);
 
+  // Returns when composition should start for a frame that is to be shown at
+  // the first vsync at or after `expectedPresentTime`: as late as the measured
+  // frame times allow, but no later than one vsync period from now.
+  TimePoint getCompositionStartTime(TimePoint expectedPresentTime);
+
+  // Records a frame whose composition ran from `composeStart` to
+  // `composeEnd`. `presentFence`, if valid, signals once the frame is shown.
+  void onFramePresented(TimePoint composeStart, TimePoint composeEnd,
+                        std::optional<TimePoint> expectedPresentTime,
+                        ::android::base::unique_fd presentFence);
+
+  struct FrameTimingStats {
+    uint64_t frames = 0;
+    // Frames that were shown after the vsync they were meant for.
+    uint64_t missedFrames = 0;
+    Nanoseconds averageComposeTime{0};
+    Nanoseconds maxComposeTime{0};
+    // From the start of composition until the present fence signaled.
+    Nanoseconds averagePresentLatency{0};
+  };
+
+  FrameTimingStats getFrameTimingStats();
+
  private:
   HWC3::Error stop();
 
@@ -80,6 +107,29 @@ class VsyncThread {
     std::chrono::time_point<std::chrono::steady_clock> updateAfter;
   };
   std::optional<PendingUpdate> mPendingUpdate;
+
+  // Frames whose present fence has not been seen signaling yet, oldest first.
+  struct PendingPresent {
+    TimePoint composeStart;
+    TimePoint targetVsync;
+    ::android::base::unique_fd fence;
+  };
+  std::deque<PendingPresent> mPendingPresents;
+
+  // Collects the present fences that signaled since the last call.
+  void checkPresentFencesLocked();
+
+  // Estimates that go up with every longer frame and come down slowly, so a
+  // single fast frame does not make the next one start too late.
+  Nanoseconds mComposeTimeEstimate{0};
+  Nanoseconds mPresentLatencyEstimate{0};
+
+  uint64_t mFrames = 0;
+  uint64_t mMissedFrames = 0;
+  uint64_t mFramesWithPresentFence = 0;
+  Nanoseconds mTotalComposeTime{0};
+  Nanoseconds mMaxComposeTime{0};
+  Nanoseconds mTotalPresentLatency{0};
 };
 
 }  // namespace aidl::android::hardware::graphics::composer3::impl
@@ -0,0 +1,1244 @@
+/*
+ * Copyright 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VulkanFrameComposer.h"
+
+#include <android/hardware_buffer.h>
+#include <sync/sync.h>
+#include <ui/GraphicBufferMapper.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+
+namespace aidl::android::hardware::graphics::composer3::impl {
+namespace {
+
+constexpr uint64_t kFenceTimeoutNs = 3000ull * 1000 * 1000;
+constexpr int kSyncWaitTimeoutMs = 3000;
+
+const char* const kRequiredDeviceExtensions[] = {
+    VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME,
+    VK_EXT_QUEUE_FAMILY_FOREIGN_EXTENSION_NAME,
+};
+
+bool IsRectEmpty(const common::Rect& rect) {
+  return rect.right <= rect.left || rect.bottom <= rect.top;
+}
+
+bool RectsIntersect(const common::Rect& a, const common::Rect& b) {
+  return std::max(a.left, b.left) < std::min(a.right, b.right) &&
+         std::max(a.top, b.top) < std::min(a.bottom, b.bottom);
+}
+
+bool IsOpaquePixelFormat(::android::PixelFormat format) {
+  switch (format) {
+    case ::android::PIXEL_FORMAT_RGBX_8888:
+    case ::android::PIXEL_FORMAT_RGB_888:
+    case ::android::PIXEL_FORMAT_RGB_565:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::optional<uint32_t> GetBytesPerPixel(::android::PixelFormat format) {
+  switch (format) {
+    case ::android::PIXEL_FORMAT_RGBA_8888:
+    case ::android::PIXEL_FORMAT_RGBX_8888:
+    case ::android::PIXEL_FORMAT_BGRA_8888:
+    case ::android::PIXEL_FORMAT_RGBA_1010102:
+      return 4;
+    case ::android::PIXEL_FORMAT_RGB_888:
+      return 3;
+    case ::android::PIXEL_FORMAT_RGB_565:
+      return 2;
+    case ::android::PIXEL_FORMAT_RGBA_FP16:
+      return 8;
+    default:
+      return std::nullopt;
+  }
+}
+
+// Blits can only flip, not rotate by 90 degrees.
+bool IsBlittableTransform(common::Transform transform) {
+  return transform == common::Transform::NONE ||
+         transform == common::Transform::FLIP_H ||
+         transform == common::Transform::FLIP_V ||
+         transform == common::Transform::ROT_180;
+}
+
+// Maps `crop` of a buffer onto `frame` of the display, flipped as given, and
+// cuts off the parts of the frame outside of the display because blits may
+// not go out of bounds. Returns false if nothing is left to blit.
+bool GetBlitRegion(common::Rect crop, common::Rect frame,
+                   common::Transform transform, int32_t displayWidth,
+                   int32_t displayHeight, VkImageBlit* outRegion) {
+  if (IsRectEmpty(crop) || IsRectEmpty(frame)) {
+    return false;
+  }
+
+  const bool flipH = transform == common::Transform::FLIP_H ||
+                     transform == common::Transform::ROT_180;
+  const bool flipV = transform == common::Transform::FLIP_V ||
+                     transform == common::Transform::ROT_180;
+
+  const float scaleX = static_cast<float>(crop.right - crop.left) /
+                       static_cast<float>(frame.right - frame.left);
+  const float scaleY = static_cast<float>(crop.bottom - crop.top) /
+                       static_cast<float>(frame.bottom - frame.top);
+
+  const int32_t cutLeft = std::max(0, -frame.left);
+  const int32_t cutTop = std::max(0, -frame.top);
+  const int32_t cutRight = std::max(0, frame.right - displayWidth);
+  const int32_t cutBottom = std::max(0, frame.bottom - displayHeight);
+
+  common::Rect dst = {
+      .left = frame.left + cutLeft,
+      .top = frame.top + cutTop,
+      .right = frame.right - cutRight,
+      .bottom = frame.bottom - cutBottom,
+  };
+  if (IsRectEmpty(dst)) {
+    return false;
+  }
+
+  // With a flip, cutting one side of the frame cuts the other side of the
+  // crop.
+  common::Rect src = crop;
+  src.left += static_cast<int32_t>((flipH ? cutRight : cutLeft) * scaleX);
+  src.right -= static_cast<int32_t>((flipH ? cutLeft : cutRight) * scaleX);
+  src.top += static_cast<int32_t>((flipV ? cutBottom : cutTop) * scaleY);
+  src.bottom -= static_cast<int32_t>((flipV ? cutTop : cutBottom) * scaleY);
+  if (IsRectEmpty(src)) {
+    return false;
+  }
+
+  *outRegion = VkImageBlit{
+      .srcSubresource =
+          {
+              .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+              .mipLevel = 0,
+              .baseArrayLayer = 0,
+              .layerCount = 1,
+          },
+      .srcOffsets =
+          {
+              {flipH ? src.right : src.left, flipV ? src.bottom : src.top, 0},
+              {flipH ? src.left : src.right, flipV ? src.top : src.bottom, 1},
+          },
+      .dstSubresource =
+          {
+              .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+              .mipLevel = 0,
+              .baseArrayLayer = 0,
+              .layerCount = 1,
+          },
+      .dstOffsets =
+          {
+              {dst.left, dst.top, 0},
+              {dst.right, dst.bottom, 1},
+          },
+  };
+  return true;
+}
+
+VkImageMemoryBarrier MakeImageBarrier(VkImage image, VkAccessFlags srcAccess,
+                                      VkAccessFlags dstAccess,
+                                      VkImageLayout oldLayout,
+                                      VkImageLayout newLayout,
+                                      uint32_t srcQueueFamilyIndex,
+                                      uint32_t dstQueueFamilyIndex) {
+  return VkImageMemoryBarrier{
+      .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+      .srcAccessMask = srcAccess,
+      .dstAccessMask = dstAccess,
+      .oldLayout = oldLayout,
+      .newLayout = newLayout,
+      .srcQueueFamilyIndex = srcQueueFamilyIndex,
+      .dstQueueFamilyIndex = dstQueueFamilyIndex,
+      .image = image,
+      .subresourceRange =
+          {
+              .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+              .baseMipLevel = 0,
+              .levelCount = 1,
+              .baseArrayLayer = 0,
+              .layerCount = 1,
+          },
+  };
+}
+
+// Orders one transfer after the previous ones, as overlapping blits and
+// clears into the same image may otherwise run in any order.
+void CmdTransferBarrier(VkCommandBuffer commandBuffer) {
+  const VkMemoryBarrier barrier = {
+      .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+      .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+      .dstAccessMask =
+          VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+  };
+  vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                       nullptr, 0, nullptr);
+}
+
+}  // namespace
+
+VulkanFrameComposer::VulkanImage::~VulkanImage() {
+  if (image != VK_NULL_HANDLE) {
+    vkDestroyImage(device, image, nullptr);
+  }
+  if (memory != VK_NULL_HANDLE) {
+    vkFreeMemory(device, memory, nullptr);
+  }
+}
+
+VulkanFrameComposer::VulkanImage::VulkanImage(VulkanImage&& other)
+    : device(other.device),
+      graphicBuffer(std::move(other.graphicBuffer)),
+      image(other.image),
+      memory(other.memory),
+      width(other.width),
+      height(other.height),
+      opaque(other.opaque),
+      canFilterLinear(other.canFilterLinear) {
+  other.image = VK_NULL_HANDLE;
+  other.memory = VK_NULL_HANDLE;
+}
+
+VulkanFrameComposer::~VulkanFrameComposer() {
+  if (mDevice != VK_NULL_HANDLE) {
+    vkDeviceWaitIdle(mDevice);
+
+    mSourceImages.clear();
+    mDisplayInfos.clear();
+
+    if (mSolidColorImage != VK_NULL_HANDLE) {
+      vkDestroyImage(mDevice, mSolidColorImage, nullptr);
+    }
+    if (mSolidColorMemory != VK_NULL_HANDLE) {
+      vkFreeMemory(mDevice, mSolidColorMemory, nullptr);
+    }
+    if (mFence != VK_NULL_HANDLE) {
+      vkDestroyFence(mDevice, mFence, nullptr);
+    }
+    if (mCommandPool != VK_NULL_HANDLE) {
+      vkDestroyCommandPool(mDevice, mCommandPool, nullptr);
+    }
+    vkDestroyDevice(mDevice, nullptr);
+  }
+  if (mInstance != VK_NULL_HANDLE) {
+    vkDestroyInstance(mInstance, nullptr);
+  }
+}
+
+HWC3::Error VulkanFrameComposer::init() {
+  DEBUG_LOG("%s", __FUNCTION__);
+
+  HWC3::Error error = initVulkan();
+  if (error != HWC3::Error::None) {
+    ALOGE("%s: failed to initialize Vulkan", __FUNCTION__);
+    return error;
+  }
+
+  error = mDrmClient.init();
+  if (error != HWC3::Error::None) {
+    ALOGE("%s: failed to initialize DrmClient", __FUNCTION__);
+    return error;
+  }
+
+  return HWC3::Error::None;
+}
+
+HWC3::Error VulkanFrameComposer::initVulkan() {
+  const VkApplicationInfo appInfo = {
+      .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
+      .pApplicationName = "RanchuHwc",
+      .apiVersion = VK_API_VERSION_1_1,
+  };
+  const VkInstanceCreateInfo instanceCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+      .pApplicationInfo = &appInfo,
+  };
+  VkResult result = vkCreateInstance(&instanceCreateInfo, nullptr, &mInstance);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to create instance: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  uint32_t physicalDeviceCount = 1;
+  result = vkEnumeratePhysicalDevices(mInstance, &physicalDeviceCount,
+                                      &mPhysicalDevice);
+  if ((result != VK_SUCCESS && result != VK_INCOMPLETE) ||
+      physicalDeviceCount == 0) {
+    ALOGE("%s: no physical device: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  VkPhysicalDeviceProperties physicalDeviceProperties;
+  vkGetPhysicalDeviceProperties(mPhysicalDevice, &physicalDeviceProperties);
+  if (physicalDeviceProperties.apiVersion < VK_API_VERSION_1_1) {
+    ALOGE("%s: physical device only supports Vulkan %u.%u", __FUNCTION__,
+          VK_VERSION_MAJOR(physicalDeviceProperties.apiVersion),
+          VK_VERSION_MINOR(physicalDeviceProperties.apiVersion));
+    return HWC3::Error::Unsupported;
+  }
+
+  uint32_t extensionCount = 0;
+  vkEnumerateDeviceExtensionProperties(mPhysicalDevice, nullptr,
+                                       &extensionCount, nullptr);
+  std::vector<VkExtensionProperties> extensions(extensionCount);
+  vkEnumerateDeviceExtensionProperties(mPhysicalDevice, nullptr,
+                                       &extensionCount, extensions.data());
+  for (const char* required : kRequiredDeviceExtensions) {
+    const bool found =
+        std::any_of(extensions.begin(), extensions.end(),
+                    [&](const VkExtensionProperties& extension) {
+                      return std::strcmp(extension.extensionName, required) ==
+                             0;
+                    });
+    if (!found) {
+      ALOGE("%s: physical device does not support %s", __FUNCTION__,
+            required);
+      return HWC3::Error::Unsupported;
+    }
+  }
+
+  uint32_t queueFamilyCount = 0;
+  vkGetPhysicalDeviceQueueFamilyProperties(mPhysicalDevice, &queueFamilyCount,
+                                           nullptr);
+  std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+  vkGetPhysicalDeviceQueueFamilyProperties(mPhysicalDevice, &queueFamilyCount,
+                                           queueFamilies.data());
+  // Blits need a graphics queue.
+  auto queueFamilyIt =
+      std::find_if(queueFamilies.begin(), queueFamilies.end(),
+                   [](const VkQueueFamilyProperties& properties) {
+                     return properties.queueFlags & VK_QUEUE_GRAPHICS_BIT;
+                   });
+  if (queueFamilyIt == queueFamilies.end()) {
+    ALOGE("%s: physical device has no graphics queue", __FUNCTION__);
+    return HWC3::Error::Unsupported;
+  }
+  mQueueFamilyIndex =
+      static_cast<uint32_t>(queueFamilyIt - queueFamilies.begin());
+
+  const float queuePriority = 1.0f;
+  const VkDeviceQueueCreateInfo queueCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+      .queueFamilyIndex = mQueueFamilyIndex,
+      .queueCount = 1,
+      .pQueuePriorities = &queuePriority,
+  };
+  const VkDeviceCreateInfo deviceCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+      .queueCreateInfoCount = 1,
+      .pQueueCreateInfos = &queueCreateInfo,
+      .enabledExtensionCount =
+          static_cast<uint32_t>(std::size(kRequiredDeviceExtensions)),
+      .ppEnabledExtensionNames = kRequiredDeviceExtensions,
+  };
+  result = vkCreateDevice(mPhysicalDevice, &deviceCreateInfo, nullptr,
+                          &mDevice);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to create device: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  mGetAndroidHardwareBufferProperties =
+      reinterpret_cast<PFN_vkGetAndroidHardwareBufferPropertiesANDROID>(
+          vkGetDeviceProcAddr(mDevice,
+                              "vkGetAndroidHardwareBufferPropertiesANDROID"));
+  if (mGetAndroidHardwareBufferProperties == nullptr) {
+    ALOGE("%s: missing vkGetAndroidHardwareBufferPropertiesANDROID",
+          __FUNCTION__);
+    return HWC3::Error::Unsupported;
+  }
+
+  vkGetDeviceQueue(mDevice, mQueueFamilyIndex, 0, &mQueue);
+
+  const VkCommandPoolCreateInfo commandPoolCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+      .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+      .queueFamilyIndex = mQueueFamilyIndex,
+  };
+  result = vkCreateCommandPool(mDevice, &commandPoolCreateInfo, nullptr,
+                               &mCommandPool);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to create command pool: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  const VkCommandBufferAllocateInfo commandBufferAllocateInfo = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+      .commandPool = mCommandPool,
+      .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+      .commandBufferCount = 1,
+  };
+  result = vkAllocateCommandBuffers(mDevice, &commandBufferAllocateInfo,
+                                    &mCommandBuffer);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to allocate command buffer: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  const VkFenceCreateInfo fenceCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+  };
+  result = vkCreateFence(mDevice, &fenceCreateInfo, nullptr, &mFence);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to create fence: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  const VkImageCreateInfo solidColorImageCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+      .imageType = VK_IMAGE_TYPE_2D,
+      .format = VK_FORMAT_R8G8B8A8_UNORM,
+      .extent = {1, 1, 1},
+      .mipLevels = 1,
+      .arrayLayers = 1,
+      .samples = VK_SAMPLE_COUNT_1_BIT,
+      .tiling = VK_IMAGE_TILING_OPTIMAL,
+      .usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+      .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+      .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+  };
+  result = vkCreateImage(mDevice, &solidColorImageCreateInfo, nullptr,
+                         &mSolidColorImage);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to create solid color image: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  VkMemoryRequirements solidColorMemoryRequirements;
+  vkGetImageMemoryRequirements(mDevice, mSolidColorImage,
+                               &solidColorMemoryRequirements);
+  const VkMemoryAllocateInfo solidColorMemoryAllocateInfo = {
+      .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+      .allocationSize = solidColorMemoryRequirements.size,
+      .memoryTypeIndex = static_cast<uint32_t>(
+          __builtin_ctz(solidColorMemoryRequirements.memoryTypeBits)),
+  };
+  result = vkAllocateMemory(mDevice, &solidColorMemoryAllocateInfo, nullptr,
+                            &mSolidColorMemory);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to allocate solid color memory: %d", __FUNCTION__,
+          result);
+    return HWC3::Error::NoResources;
+  }
+  result = vkBindImageMemory(mDevice, mSolidColorImage, mSolidColorMemory, 0);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to bind solid color memory: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  return HWC3::Error::None;
+}
+
+HWC3::Error VulkanFrameComposer::registerOnHotplugCallback(
+    const HotplugCallback& cb) {
+  return mDrmClient.registerOnHotplugCallback(cb);
+}
+
+HWC3::Error VulkanFrameComposer::unregisterOnHotplugCallback() {
+  return mDrmClient.unregisterOnHotplugCallback();
+}
+
+HWC3::Error VulkanFrameComposer::onDisplayCreate(Display* display) {
+  int64_t displayId = display->getId();
+  int32_t displayConfigId;
+  int32_t displayWidth;
+  int32_t displayHeight;
+
+  HWC3::Error error = display->getActiveConfig(&displayConfigId);
+  if (error != HWC3::Error::None) {
+    ALOGE("%s: display:%" PRIu64 " has no active config", __FUNCTION__,
+          displayId);
+    return error;
+  }
+
+  error = display->getDisplayAttribute(displayConfigId, DisplayAttribute::WIDTH,
+                                       &displayWidth);
+  if (error != HWC3::Error::None) {
+    ALOGE("%s: display:%" PRIu64 " failed to get width", __FUNCTION__,
+          displayId);
+    return error;
+  }
+
+  error = display->getDisplayAttribute(
+      displayConfigId, DisplayAttribute::HEIGHT, &displayHeight);
+  if (error != HWC3::Error::None) {
+    ALOGE("%s: display:%" PRIu64 " failed to get height", __FUNCTION__,
+          displayId);
+    return error;
+  }
+
+  auto it = mDisplayInfos.find(displayId);
+  if (it != mDisplayInfos.end()) {
+    ALOGE("%s: display:%" PRIu64 " already created?", __FUNCTION__, displayId);
+  }
+
+  DisplayInfo& displayInfo = mDisplayInfos[displayId];
+
+  displayInfo.swapchain = DrmSwapchain::create(
+      displayWidth, displayHeight,
+      ::android::GraphicBuffer::USAGE_HW_COMPOSER |
+          ::android::GraphicBuffer::USAGE_HW_RENDER |
+          ::android::GraphicBuffer::USAGE_HW_TEXTURE,
+      &mDrmClient, GetSwapchainDepth(displayId));
+  if (!displayInfo.swapchain) {
+    ALOGE("%s: failed to create swapchain for display:%" PRIu64, __FUNCTION__,
+          displayId);
+    return HWC3::Error::NoResources;
+  }
+
+  DrmSwapchain::Image* firstImage = nullptr;
+  for (;;) {
+    DrmSwapchain::Image* image = displayInfo.swapchain->getNextImage();
+    if (image == firstImage) {
+      break;
+    }
+    if (firstImage == nullptr) {
+      firstImage = image;
+    }
+
+    VulkanImage vulkanImage;
+    error = importBuffer(image->getBuffer(), /*asDestination=*/true,
+                         &vulkanImage);
+    if (error != HWC3::Error::None) {
+      ALOGE("%s: failed to import swapchain image for display:%" PRIu64,
+            __FUNCTION__, displayId);
+      return error;
+    }
+    displayInfo.swapchainImages.emplace(image->getBuffer(),
+                                        std::move(vulkanImage));
+  }
+
+  if (displayId == 0) {
+    auto [flushError, flushSyncFd] = mDrmClient.flushToDisplay(
+        displayId, firstImage->getDrmBuffer(), -1);
+    if (flushError != HWC3::Error::None) {
+      ALOGW(
+          "%s: Initial display flush failed. HWComposer assuming that we are "
+          "running in QEMU without a display and disabling presenting.",
+          __FUNCTION__);
+      mPresentDisabled = true;
+    }
+  }
+
+  std::optional<std::vector<uint8_t>> edid = mDrmClient.getEdid(displayId);
+  if (edid) {
+    display->setEdid(*edid);
+  }
+
+  return HWC3::Error::None;
+}
+
+HWC3::Error VulkanFrameComposer::onDisplayDestroy(Display* display) {
+  auto displayId = display->getId();
+
+  auto it = mDisplayInfos.find(displayId);
+  if (it == mDisplayInfos.end()) {
+    ALOGE("%s: display:%" PRIu64 " missing display buffers?", __FUNCTION__,
+          displayId);
+    return HWC3::Error::BadDisplay;
+  }
+
+  vkQueueWaitIdle(mQueue);
+
+  mDisplayInfos.erase(it);
+
+  return HWC3::Error::None;
+}
+
+HWC3::Error VulkanFrameComposer::onDisplayClientTargetSet(Display* display) {
+  const auto displayId = display->getId();
+  DEBUG_LOG("%s display:%" PRIu64, __FUNCTION__, displayId);
+
+  auto it = mDisplayInfos.find(displayId);
+  if (it == mDisplayInfos.end()) {
+    ALOGE("%s: display:%" PRIu64 " missing display buffers?", __FUNCTION__,
+          displayId);
+    return HWC3::Error::BadDisplay;
+  }
+
+  DisplayInfo& displayInfo = it->second;
+
+  auto [drmBufferCreateError, drmBuffer] =
+      mDrmClient.create(display->getClientTarget().getBuffer());
+  if (drmBufferCreateError != HWC3::Error::None) {
+    ALOGE("%s: display:%" PRIu64 " failed to create client target drm buffer",
+          __FUNCTION__, displayId);
+    return HWC3::Error::NoResources;
+  }
+  displayInfo.clientTargetDrmBuffer = std::move(drmBuffer);
+
+  return HWC3::Error::None;
+}
+
+HWC3::Error VulkanFrameComposer::onActiveConfigChange(Display* /*display*/) {
+  return HWC3::Error::None;
+};
+
+HWC3::Error VulkanFrameComposer::importBuffer(buffer_handle_t buffer,
+                                              bool asDestination,
+                                              VulkanImage* outImage) {
+  ::android::GraphicBufferMapper& mapper = ::android::GraphicBufferMapper::get();
+
+  uint64_t width = 0;
+  uint64_t height = 0;
+  uint64_t layerCount = 0;
+  uint64_t usage = 0;
+  ::android::ui::PixelFormat pixelFormat;
+  if (mapper.getWidth(buffer, &width) != ::android::OK ||
+      mapper.getHeight(buffer, &height) != ::android::OK ||
+      mapper.getLayerCount(buffer, &layerCount) != ::android::OK ||
+      mapper.getUsage(buffer, &usage) != ::android::OK ||
+      mapper.getPixelFormatRequested(buffer, &pixelFormat) != ::android::OK) {
+    ALOGE("%s: failed to query buffer metadata", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+  const auto format = static_cast<::android::PixelFormat>(pixelFormat);
+
+  std::optional<uint32_t> bytesPerPixel = GetBytesPerPixel(format);
+  if (!bytesPerPixel) {
+    DEBUG_LOG("%s: unsupported pixel format %d", __FUNCTION__, format);
+    return HWC3::Error::Unsupported;
+  }
+
+  std::optional<GrallocBuffer> grallocBuffer = mGralloc.Import(buffer);
+  if (!grallocBuffer) {
+    ALOGE("%s: failed to import buffer", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+  std::optional<uint32_t> strideBytes = grallocBuffer->GetMonoPlanarStrideBytes();
+  if (!strideBytes) {
+    ALOGE("%s: failed to query buffer stride", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+
+  outImage->device = mDevice;
+  outImage->graphicBuffer = ::android::sp<::android::GraphicBuffer>::make(
+      buffer, ::android::GraphicBuffer::CLONE_HANDLE,
+      static_cast<uint32_t>(width), static_cast<uint32_t>(height), format,
+      static_cast<uint32_t>(layerCount), usage, *strideBytes / *bytesPerPixel);
+  if (outImage->graphicBuffer->initCheck() != ::android::OK) {
+    ALOGE("%s: failed to wrap buffer", __FUNCTION__);
+    return HWC3::Error::NoResources;
+  }
+  AHardwareBuffer* ahb = outImage->graphicBuffer->toAHardwareBuffer();
+
+  VkAndroidHardwareBufferFormatPropertiesANDROID formatProperties = {
+      .sType =
+          VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID,
+  };
+  VkAndroidHardwareBufferPropertiesANDROID properties = {
+      .sType = VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID,
+      .pNext = &formatProperties,
+  };
+  VkResult result =
+      mGetAndroidHardwareBufferProperties(mDevice, ahb, &properties);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to query buffer properties: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  // Buffers that only have an external format need a sampler to be read.
+  if (formatProperties.format == VK_FORMAT_UNDEFINED) {
+    DEBUG_LOG("%s: buffer has no Vulkan format", __FUNCTION__);
+    return HWC3::Error::Unsupported;
+  }
+  const VkFormatFeatureFlags neededFeatures =
+      asDestination
+          ? (VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT)
+          : VK_FORMAT_FEATURE_BLIT_SRC_BIT;
+  if ((formatProperties.formatFeatures & neededFeatures) != neededFeatures) {
+    DEBUG_LOG("%s: buffer format %d can not be blitted", __FUNCTION__,
+              formatProperties.format);
+    return HWC3::Error::Unsupported;
+  }
+
+  const VkExternalMemoryImageCreateInfo externalMemoryImageCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO,
+      .handleTypes =
+          VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID,
+  };
+  const VkImageCreateInfo imageCreateInfo = {
+      .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+      .pNext = &externalMemoryImageCreateInfo,
+      .imageType = VK_IMAGE_TYPE_2D,
+      .format = formatProperties.format,
+      .extent = {static_cast<uint32_t>(width), static_cast<uint32_t>(height),
+                 1},
+      .mipLevels = 1,
+      .arrayLayers = 1,
+      .samples = VK_SAMPLE_COUNT_1_BIT,
+      .tiling = VK_IMAGE_TILING_OPTIMAL,
+      .usage = asDestination ? VK_IMAGE_USAGE_TRANSFER_DST_BIT
+                             : VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+      .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+      .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+  };
+  result = vkCreateImage(mDevice, &imageCreateInfo, nullptr, &outImage->image);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to create image: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  const VkImportAndroidHardwareBufferInfoANDROID importInfo = {
+      .sType = VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID,
+      .buffer = ahb,
+  };
+  const VkMemoryDedicatedAllocateInfo dedicatedAllocateInfo = {
+      .sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO,
+      .pNext = &importInfo,
+      .image = outImage->image,
+  };
+  const VkMemoryAllocateInfo memoryAllocateInfo = {
+      .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+      .pNext = &dedicatedAllocateInfo,
+      .allocationSize = properties.allocationSize,
+      .memoryTypeIndex =
+          static_cast<uint32_t>(__builtin_ctz(properties.memoryTypeBits)),
+  };
+  result = vkAllocateMemory(mDevice, &memoryAllocateInfo, nullptr,
+                            &outImage->memory);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to import buffer memory: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  result = vkBindImageMemory(mDevice, outImage->image, outImage->memory, 0);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to bind buffer memory: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  outImage->width = static_cast<uint32_t>(width);
+  outImage->height = static_cast<uint32_t>(height);
+  outImage->opaque = IsOpaquePixelFormat(format);
+  outImage->canFilterLinear =
+      formatProperties.formatFeatures &
+      VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+
+  return HWC3::Error::None;
+}
+
+VulkanFrameComposer::VulkanImage* VulkanFrameComposer::getSourceImage(
+    buffer_handle_t buffer) {
+  if (buffer == nullptr) {
+    return nullptr;
+  }
+
+  uint64_t bufferId;
+  if (::android::GraphicBufferMapper::get().getBufferId(buffer, &bufferId) !=
+      ::android::OK) {
+    ALOGE("%s: failed to get buffer id", __FUNCTION__);
+    return nullptr;
+  }
+
+  VulkanImage* image = mSourceImages.get(bufferId);
+  if (image == nullptr) {
+    // Buffers that can not be imported are remembered as images without a
+    // VkImage so that they are not retried every frame.
+    VulkanImage imported;
+    if (importBuffer(buffer, /*asDestination=*/false, &imported) ==
+        HWC3::Error::None) {
+      mSourceImages.set(bufferId, std::move(imported));
+    } else {
+      mSourceImages.set(bufferId, VulkanImage());
+    }
+    image = mSourceImages.get(bufferId);
+  }
+
+  if (image == nullptr || image->image == VK_NULL_HANDLE) {
+    return nullptr;
+  }
+  return image;
+}
+
+bool VulkanFrameComposer::canComposeLayer(Layer* layer, bool composedBelow) {
+  const auto layerCompositionType = layer->getCompositionType();
+  const auto blendMode = layer->getBlendMode();
+
+  if (layer->getPlaneAlpha() < 1.0f) {
+    return false;
+  }
+
+  if (layerCompositionType == Composition::SOLID_COLOR) {
+    return blendMode == common::BlendMode::NONE || layer->getColor().a >= 1.0f;
+  }
+
+  if (layerCompositionType != Composition::DEVICE) {
+    return false;
+  }
+
+  if (!IsBlittableTransform(layer->getTransform())) {
+    return false;
+  }
+
+  VulkanImage* image = getSourceImage(layer->getBuffer().getBuffer());
+  if (image == nullptr) {
+    return false;
+  }
+
+  // A blit replaces what is below. That is the same as blending for opaque
+  // buffers, and for premultiplied ones over the cleared, black display.
+  return blendMode == common::BlendMode::NONE || image->opaque ||
+         (blendMode == common::BlendMode::PREMULTIPLIED && !composedBelow);
+}
+
+HWC3::Error VulkanFrameComposer::validateDisplay(Display* display,
+                                                 DisplayChanges* outChanges) {
+  const auto displayId = display->getId();
+  DEBUG_LOG("%s display:%" PRIu64, __FUNCTION__, displayId);
+
+  const std::vector<Layer*>& layers = display->getOrderedLayers();
+
+  // Blits can not apply a color transform.
+  bool fallbackToClientComposition = display->hasColorTransform() ||
+                                     layers.size() > kMaxComposedLayers;
+
+  // The client target ends up below everything else, covering the display.
+  const bool hasClientLayers =
+      std::any_of(layers.begin(), layers.end(), [](const Layer* layer) {
+        return layer->getCompositionType() == Composition::CLIENT;
+      });
+  std::vector<common::Rect> composedFrames;
+  for (Layer* layer : layers) {
+    if (fallbackToClientComposition) {
+      break;
+    }
+
+    const auto layerId = layer->getId();
+    const auto layerCompositionType = layer->getCompositionType();
+    const auto layerCompositionTypeString = toString(layerCompositionType);
+
+    if (layerCompositionType == Composition::INVALID) {
+      ALOGE("%s display:%" PRIu64 " layer:%" PRIu64 " has Invalid composition",
+            __FUNCTION__, displayId, layerId);
+      continue;
+    }
+
+    if (layerCompositionType == Composition::CLIENT) {
+      continue;
+    }
+
+    if (layerCompositionType == Composition::CURSOR ||
+        layerCompositionType == Composition::SIDEBAND) {
+      DEBUG_LOG("%s: display:%" PRIu64 " layer:%" PRIu64
+                " has composition type %s, falling back to client composition",
+                __FUNCTION__, displayId, layerId,
+                layerCompositionTypeString.c_str());
+      fallbackToClientComposition = true;
+      break;
+    }
+
+    if (layerCompositionType == Composition::DISPLAY_DECORATION) {
+      return HWC3::Error::Unsupported;
+    }
+
+    const common::Rect frame = layer->getDisplayFrame();
+    const bool composedBelow =
+        hasClientLayers ||
+        std::any_of(composedFrames.begin(), composedFrames.end(),
+                    [&](const common::Rect& below) {
+                      return RectsIntersect(below, frame);
+                    });
+    if (!canComposeLayer(layer, composedBelow)) {
+      DEBUG_LOG(
+          "%s: display:%" PRIu64 " layer:%" PRIu64
+          " composition not supported, falling back to client composition",
+          __FUNCTION__, displayId, layerId);
+      fallbackToClientComposition = true;
+      break;
+    }
+    composedFrames.push_back(frame);
+  }
+
+  if (!fallbackToClientComposition && hasClientLayers &&
+      getSourceImage(display->getClientTarget().getBuffer()) == nullptr) {
+    // The client target can only be blitted below the other layers once
+    // SurfaceFlinger has set one that Vulkan can read.
+    fallbackToClientComposition = true;
+  }
+
+  if (fallbackToClientComposition) {
+    for (Layer* layer : layers) {
+      const auto layerId = layer->getId();
+      const auto layerCompositionType = layer->getCompositionType();
+
+      if (layerCompositionType == Composition::INVALID) {
+        continue;
+      }
+
+      if (layerCompositionType != Composition::CLIENT) {
+        DEBUG_LOG("%s display:%" PRIu64 " layer:%" PRIu64
+                  "composition updated to Client",
+                  __FUNCTION__, displayId, layerId);
+
+        outChanges->addLayerCompositionChange(displayId, layerId,
+                                              Composition::CLIENT);
+      }
+    }
+  }
+
+  // We can not draw below a Client (SurfaceFlinger) composed layer. Change all
+  // layers below a Client composed layer to also be Client composed.
+  if (layers.size() > 1) {
+    for (std::size_t layerIndex = layers.size() - 1; layerIndex > 0;
+         layerIndex--) {
+      auto layer = layers[layerIndex];
+      auto layerCompositionType = layer->getCompositionType();
+
+      if (layerCompositionType == Composition::CLIENT) {
+        for (std::size_t lowerLayerIndex = 0; lowerLayerIndex < layerIndex;
+             lowerLayerIndex++) {
+          auto lowerLayer = layers[lowerLayerIndex];
+          auto lowerLayerId = lowerLayer->getId();
+          auto lowerLayerCompositionType = lowerLayer->getCompositionType();
+
+          if (lowerLayerCompositionType != Composition::CLIENT) {
+            DEBUG_LOG("%s: display:%" PRIu64 " changing layer:%" PRIu64
+                      " to Client because"
+                      "hwcomposer can not draw below the Client composed "
+                      "layer:%" PRIu64,
+                      __FUNCTION__, displayId, lowerLayerId, layer->getId());
+
+            outChanges->addLayerCompositionChange(displayId, lowerLayerId,
+                                                  Composition::CLIENT);
+          }
+        }
+      }
+    }
+  }
+
+  return HWC3::Error::None;
+}
+
+HWC3::Error VulkanFrameComposer::presentDisplay(
+    Display* display, ::android::base::unique_fd* outDisplayFence,
+    std::unordered_map<int64_t,
+                       ::android::base::unique_fd>* /*outLayerFences*/) {
+  const auto displayId = display->getId();
+  DEBUG_LOG("%s display:%" PRIu64, __FUNCTION__, displayId);
+
+  if (mPresentDisabled) {
+    return HWC3::Error::None;
+  }
+
+  auto it = mDisplayInfos.find(displayId);
+  if (it == mDisplayInfos.end()) {
+    ALOGE("%s: display:%" PRIu64 " not found", __FUNCTION__, displayId);
+    return HWC3::Error::NoResources;
+  }
+
+  DisplayInfo& displayInfo = it->second;
+
+  const std::vector<Layer*>& layers = display->getOrderedLayers();
+
+  const bool allLayersClientComposed =
+      !layers.empty() &&
+      std::all_of(layers.begin(),  //
+                  layers.end(),    //
+                  [](const Layer* layer) {
+                    return layer->getCompositionType() == Composition::CLIENT;
+                  });
+
+  // Nothing to compose, so the client target goes to the display as is.
+  if (allLayersClientComposed) {
+    if (!displayInfo.clientTargetDrmBuffer) {
+      ALOGW("%s: display:%" PRIu64 " no client target set, nothing to present.",
+            __FUNCTION__, displayId);
+      return HWC3::Error::None;
+    }
+
+    ::android::base::unique_fd fence = display->getClientTarget().getFence();
+
+    auto [flushError, flushCompleteFence] = mDrmClient.flushToDisplay(
+        displayId, displayInfo.clientTargetDrmBuffer, fence);
+    if (flushError != HWC3::Error::None) {
+      ALOGE("%s: display:%" PRIu64 " failed to flush drm buffer" PRIu64,
+            __FUNCTION__, displayId);
+    }
+
+    *outDisplayFence = std::move(flushCompleteFence);
+    return flushError;
+  }
+
+  DrmSwapchain::Image* swapchainImage = displayInfo.swapchain->getNextImage();
+  auto targetIt = displayInfo.swapchainImages.find(swapchainImage->getBuffer());
+  if (targetIt == displayInfo.swapchainImages.end()) {
+    ALOGE("%s: display:%" PRIu64 " swapchain image not imported", __FUNCTION__,
+          displayId);
+    return HWC3::Error::NoResources;
+  }
+
+  // The display may still be scanning out of the image.
+  if (swapchainImage->wait() != 0) {
+    ALOGE("%s: display:%" PRIu64 " failed waiting for swapchain image",
+          __FUNCTION__, displayId);
+  }
+
+  HWC3::Error error = composeLayers(display, &targetIt->second, layers);
+  if (error != HWC3::Error::None) {
+    ALOGE("%s: display:%" PRIu64 " failed to compose layers", __FUNCTION__,
+          displayId);
+    return error;
+  }
+
+  DEBUG_LOG("%s display:%" PRIu64 " flushing drm buffer", __FUNCTION__,
+            displayId);
+
+  auto [flushError, fence] = mDrmClient.flushToDisplay(
+      displayId, swapchainImage->getDrmBuffer(), -1);
+  if (flushError != HWC3::Error::None) {
+    ALOGE("%s: display:%" PRIu64 " failed to flush drm buffer" PRIu64,
+          __FUNCTION__, displayId);
+  }
+
+  if (fence.ok()) {
+    swapchainImage->markAsInUse(::android::base::unique_fd(dup(fence.get())));
+  }
+
+  *outDisplayFence = std::move(fence);
+  return flushError;
+}
+
+HWC3::Error VulkanFrameComposer::composeLayers(
+    Display* display, VulkanImage* target, const std::vector<Layer*>& layers) {
+  ATRACE_CALL();
+
+  const int32_t displayWidth = static_cast<int32_t>(target->width);
+  const int32_t displayHeight = static_cast<int32_t>(target->height);
+
+  struct Source {
+    VulkanImage* image;
+    ::android::base::unique_fd acquireFence;
+    common::Rect crop;
+    common::Rect frame;
+    common::Transform transform;
+    std::optional<Color> color;
+  };
+  std::vector<Source> sources;
+
+  const bool hasClientLayers =
+      std::any_of(layers.begin(), layers.end(), [](const Layer* layer) {
+        return layer->getCompositionType() == Composition::CLIENT;
+      });
+  if (hasClientLayers) {
+    FencedBuffer& clientTarget = display->getClientTarget();
+    VulkanImage* image = getSourceImage(clientTarget.getBuffer());
+    if (image == nullptr) {
+      ALOGE("%s: client target can not be blitted", __FUNCTION__);
+      return HWC3::Error::NoResources;
+    }
+    const common::Rect fullDisplay = {0, 0, displayWidth, displayHeight};
+    sources.push_back(Source{
+        .image = image,
+        .acquireFence = clientTarget.getFence(),
+        .crop = {0, 0, static_cast<int32_t>(image->width),
+                 static_cast<int32_t>(image->height)},
+        .frame = fullDisplay,
+        .transform = common::Transform::NONE,
+    });
+  }
+
+  for (Layer* layer : layers) {
+    const auto layerCompositionType = layer->getCompositionType();
+    if (layerCompositionType == Composition::SOLID_COLOR) {
+      sources.push_back(Source{
+          .image = nullptr,
+          .crop = {0, 0, 1, 1},
+          .frame = layer->getDisplayFrame(),
+          .transform = common::Transform::NONE,
+          .color = layer->getColor(),
+      });
+      continue;
+    }
+    if (layerCompositionType != Composition::DEVICE) {
+      continue;
+    }
+
+    FencedBuffer& layerBuffer = layer->getBuffer();
+    VulkanImage* image = getSourceImage(layerBuffer.getBuffer());
+    if (image == nullptr) {
+      ALOGE("%s: layer:%" PRIu64 " can not be blitted", __FUNCTION__,
+            layer->getId());
+      return HWC3::Error::NoResources;
+    }
+    sources.push_back(Source{
+        .image = image,
+        .acquireFence = layerBuffer.getFence(),
+        .crop = layer->getSourceCropInt(),
+        .frame = layer->getDisplayFrame(),
+        .transform = layer->getTransform(),
+    });
+  }
+
+  VkResult result = vkResetCommandBuffer(mCommandBuffer, 0);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to reset command buffer: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  const VkCommandBufferBeginInfo beginInfo = {
+      .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+      .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+  };
+  result = vkBeginCommandBuffer(mCommandBuffer, &beginInfo);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to begin command buffer: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  // Take every image over from the rest of the system for the frame. The
+  // target is cleared anyway, so its old contents do not need to survive.
+  std::vector<VkImageMemoryBarrier> acquireBarriers;
+  acquireBarriers.push_back(MakeImageBarrier(
+      target->image, 0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_QUEUE_FAMILY_IGNORED,
+      VK_QUEUE_FAMILY_IGNORED));
+  acquireBarriers.push_back(MakeImageBarrier(
+      mSolidColorImage, 0, VK_ACCESS_TRANSFER_WRITE_BIT,
+      VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL,
+      VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED));
+  for (const Source& source : sources) {
+    if (source.image == nullptr) {
+      continue;
+    }
+    acquireBarriers.push_back(MakeImageBarrier(
+        source.image->image, 0, VK_ACCESS_TRANSFER_READ_BIT,
+        VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        VK_QUEUE_FAMILY_FOREIGN_EXT, mQueueFamilyIndex));
+  }
+  vkCmdPipelineBarrier(mCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                       nullptr, static_cast<uint32_t>(acquireBarriers.size()),
+                       acquireBarriers.data());
+
+  const VkImageSubresourceRange colorRange = {
+      .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+      .baseMipLevel = 0,
+      .levelCount = 1,
+      .baseArrayLayer = 0,
+      .layerCount = 1,
+  };
+  const VkClearColorValue black = {.float32 = {0.0f, 0.0f, 0.0f, 1.0f}};
+  vkCmdClearColorImage(mCommandBuffer, target->image,
+                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &black, 1,
+                       &colorRange);
+
+  for (const Source& source : sources) {
+    VkImageBlit region;
+    if (!GetBlitRegion(source.crop, source.frame, source.transform,
+                       displayWidth, displayHeight, &region)) {
+      continue;
+    }
+
+    VkImage srcImage = mSolidColorImage;
+    VkImageLayout srcLayout = VK_IMAGE_LAYOUT_GENERAL;
+    VkFilter filter = VK_FILTER_NEAREST;
+    if (source.color) {
+      const VkClearColorValue color = {
+          .float32 = {source.color->r, source.color->g, source.color->b,
+                      source.color->a},
+      };
+      vkCmdClearColorImage(mCommandBuffer, mSolidColorImage,
+                           VK_IMAGE_LAYOUT_GENERAL, &color, 1, &colorRange);
+    } else {
+      srcImage = source.image->image;
+      srcLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+      if (source.image->canFilterLinear) {
+        filter = VK_FILTER_LINEAR;
+      }
+    }
+    CmdTransferBarrier(mCommandBuffer);
+
+    vkCmdBlitImage(mCommandBuffer, srcImage, srcLayout, target->image,
+                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region, filter);
+    CmdTransferBarrier(mCommandBuffer);
+  }
+
+  // Hand every image back, the target to the display and the sources to
+  // their producers.
+  std::vector<VkImageMemoryBarrier> releaseBarriers;
+  releaseBarriers.push_back(MakeImageBarrier(
+      target->image, VK_ACCESS_TRANSFER_WRITE_BIT, 0,
+      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL,
+      mQueueFamilyIndex, VK_QUEUE_FAMILY_FOREIGN_EXT));
+  for (const Source& source : sources) {
+    if (source.image == nullptr) {
+      continue;
+    }
+    releaseBarriers.push_back(MakeImageBarrier(
+        source.image->image, VK_ACCESS_TRANSFER_READ_BIT, 0,
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL,
+        mQueueFamilyIndex, VK_QUEUE_FAMILY_FOREIGN_EXT));
+  }
+  vkCmdPipelineBarrier(mCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0,
+                       nullptr, static_cast<uint32_t>(releaseBarriers.size()),
+                       releaseBarriers.data());
+
+  result = vkEndCommandBuffer(mCommandBuffer);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to end command buffer: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  // Producers may still be writing into the layer buffers.
+  for (const Source& source : sources) {
+    if (!source.acquireFence.ok()) {
+      continue;
+    }
+    if (sync_wait(source.acquireFence.get(), kSyncWaitTimeoutMs) < 0) {
+      ALOGE("%s: failed waiting for layer acquire fence: %s", __FUNCTION__,
+            strerror(errno));
+    }
+  }
+
+  const VkSubmitInfo submitInfo = {
+      .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+      .commandBufferCount = 1,
+      .pCommandBuffers = &mCommandBuffer,
+  };
+  result = vkQueueSubmit(mQueue, 1, &submitInfo, mFence);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed to submit: %d", __FUNCTION__, result);
+    return HWC3::Error::NoResources;
+  }
+
+  // The display takes the result without a fence, and the layer buffers are
+  // released without one, so the blits have to be done before returning.
+  result = vkWaitForFences(mDevice, 1, &mFence, VK_TRUE, kFenceTimeoutNs);
+  if (result != VK_SUCCESS) {
+    ALOGE("%s: failed waiting for composition: %d", __FUNCTION__, result);
+    // The fence may only be reset once it is no longer pending.
+    vkQueueWaitIdle(mQueue);
+  }
+  vkResetFences(mDevice, 1, &mFence);
+  if (result != VK_SUCCESS) {
+    return HWC3::Error::NoResources;
+  }
+
+  return HWC3::Error::None;
+}
+
+}  // namespace aidl::android::hardware::graphics::composer3::impl
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_HWC_VULKANFRAMECOMPOSER_H
+#define ANDROID_HWC_VULKANFRAMECOMPOSER_H
+
+#define VK_USE_PLATFORM_ANDROID_KHR
+#include <ui/GraphicBuffer.h>
+#include <vulkan/vulkan.h>
+
+#include <memory>
+
+#include "Common.h"
+#include "Display.h"
+#include "DrmClient.h"
+#include "DrmSwapchain.h"
+#include "FrameComposer.h"
+#include "Gralloc.h"
+#include "Layer.h"
+#include "LruCache.h"
+
+namespace aidl::android::hardware::graphics::composer3::impl {
+
+// A frame composer which composes layers with the guest Vulkan driver, into
+// images of a DrmSwapchain. Layers are copied with image blits, so only
+// layers that end up replacing what is below them are composed this way and
+// everything else falls back to client composition.
+class VulkanFrameComposer : public FrameComposer {
+ public:
+  VulkanFrameComposer() = default;
+  ~VulkanFrameComposer() override;
+
+  VulkanFrameComposer(const VulkanFrameComposer&) = delete;
+  VulkanFrameComposer& operator=(const VulkanFrameComposer&) = delete;
+
+  VulkanFrameComposer(VulkanFrameComposer&&) = delete;
+  VulkanFrameComposer& operator=(VulkanFrameComposer&&) = delete;
+
+  HWC3::Error init() override;
+
+  HWC3::Error registerOnHotplugCallback(const HotplugCallback& cb) override;
+
+  HWC3::Error unregisterOnHotplugCallback() override;
+
+  HWC3::Error onDisplayCreate(Display* display) override;
+
+  HWC3::Error onDisplayDestroy(Display* display) override;
+
+  HWC3::Error onDisplayClientTargetSet(Display* display) override;
+
+  HWC3::Error onActiveConfigChange(Display* display) override;
+
+  // Determines if this composer can compose the given layers on the given
+  // display and requests changes for layers that can't not be composed.
+  HWC3::Error validateDisplay(Display* display,
+                              DisplayChanges* outChanges) override;
+
+  // Performs the actual composition of layers and presents the composed result
+  // to the display.
+  HWC3::Error presentDisplay(
+      Display* display, ::android::base::unique_fd* outDisplayFence,
+      std::unordered_map<int64_t, ::android::base::unique_fd>* outLayerFences)
+      override;
+
+  const DrmClient* getDrmPresenter() const override {
+    return &mDrmClient;
+  }
+
+ private:
+  // A gralloc buffer bound to a Vulkan image. Keeps the buffer alive for as
+  // long as the image exists.
+  struct VulkanImage {
+    VulkanImage() = default;
+    ~VulkanImage();
+
+    VulkanImage(const VulkanImage&) = delete;
+    VulkanImage& operator=(const VulkanImage&) = delete;
+
+    VulkanImage(VulkanImage&& other);
+    VulkanImage& operator=(VulkanImage&& other) = delete;
+
+    VkDevice device = VK_NULL_HANDLE;
+    ::android::sp<::android::GraphicBuffer> graphicBuffer;
+    VkImage image = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    // Whether the buffer has no alpha channel.
+    bool opaque = false;
+    bool canFilterLinear = false;
+  };
+
+  HWC3::Error initVulkan();
+
+  HWC3::Error importBuffer(buffer_handle_t buffer, bool asDestination,
+                           VulkanImage* outImage);
+
+  // Returns the image for a layer or client target buffer, importing it on
+  // first use, or nullptr if the buffer can not be blitted from.
+  VulkanImage* getSourceImage(buffer_handle_t buffer);
+
+  // Returns true if the given layer can be composed by replacing whatever
+  // is below it, given whether anything was composed below it already.
+  bool canComposeLayer(Layer* layer, bool composedBelow);
+
+  HWC3::Error composeLayers(Display* display, VulkanImage* target,
+                            const std::vector<Layer*>& layers);
+
+  struct DisplayInfo {
+    std::unique_ptr<DrmSwapchain> swapchain;
+    // Swapchain images bound to Vulkan, keyed on their buffers.
+    std::unordered_map<const native_handle_t*, VulkanImage> swapchainImages;
+    std::shared_ptr<DrmBuffer> clientTargetDrmBuffer;
+  };
+
+  std::unordered_map<int64_t, DisplayInfo> mDisplayInfos;
+
+  Gralloc mGralloc;
+
+  DrmClient mDrmClient;
+
+  // Cuttlefish on QEMU does not have a display. Disable presenting to avoid
+  // spamming logcat with DRM commit failures.
+  bool mPresentDisabled = false;
+
+  VkInstance mInstance = VK_NULL_HANDLE;
+  VkPhysicalDevice mPhysicalDevice = VK_NULL_HANDLE;
+  VkDevice mDevice = VK_NULL_HANDLE;
+  uint32_t mQueueFamilyIndex = 0;
+  VkQueue mQueue = VK_NULL_HANDLE;
+  VkCommandPool mCommandPool = VK_NULL_HANDLE;
+  VkCommandBuffer mCommandBuffer = VK_NULL_HANDLE;
+  VkFence mFence = VK_NULL_HANDLE;
+  PFN_vkGetAndroidHardwareBufferPropertiesANDROID
+      mGetAndroidHardwareBufferProperties = nullptr;
+
+  // A single texel that solid color layers are cleared into and then blitted
+  // from.
+  VkImage mSolidColorImage = VK_NULL_HANDLE;
+  VkDeviceMemory mSolidColorMemory = VK_NULL_HANDLE;
+
+  // Layer and client target buffers bound to Vulkan, keyed on the gralloc
+  // buffer id so that reused handles do not pick up stale images. Every
+  // layer of a frame has to fit so that none is evicted while in use.
+  static constexpr std::size_t kMaxComposedLayers = 16;
+  static constexpr std::size_t kMaxSourceImages = 2 * kMaxComposedLayers;
+  LruCache<uint64_t, VulkanImage> mSourceImages{kMaxSourceImages};
+};
+
+}  // namespace aidl::android::hardware::graphics::composer3::impl
+
+#endif
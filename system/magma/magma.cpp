@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <assert.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <lib/magma/magma_common_defs.h>
 #include <stdarg.h>
@@ -23,6 +24,8 @@
 #include <virtgpu_drm.h>
 #include <xf86drm.h>
 
+#include <algorithm>
+#include <chrono>
 #include <limits>
 #include <mutex>
 #include <thread>
@@ -83,6 +86,10 @@ class MagmaClientContext : public magma_encoder_context_t {
         magma_connection_t connection;  // Owning connection.
         uint64_t size;                  // Actual size.
         magma_buffer_id_t id;           // Id.
+        // Made on the first export and kept until the buffer is released,
+        // so that exporting again only costs a dup.
+        VirtGpuBlobPtr blob;
+        int fd = -1;
     };
     std::unordered_map<magma_buffer_t, BufferInfo> buffer_info_;
 
@@ -114,6 +121,7 @@ MagmaClientContext::MagmaClientContext(AddressSpaceStream* stream)
     magma_device_query_enc_ = magma_client_context_t::magma_device_query;
     magma_poll_enc_ = magma_client_context_t::magma_poll;
     magma_connection_create_buffer_enc_ = magma_client_context_t::magma_connection_create_buffer;
+    magma_connection_release_buffer_enc_ = magma_client_context_t::magma_connection_release_buffer;
 
     magma_client_context_t::magma_device_import = &MagmaClientContext::magma_device_import;
     magma_client_context_t::magma_device_query = &MagmaClientContext::magma_device_query;
@@ -151,23 +159,35 @@ magma_status_t MagmaClientContext::get_fd_for_buffer(magma_buffer_t buffer, int*
     }
     auto& info = it->second;
 
-    // TODO(fxbug.dev/122604): Evaluate deferred guest resource creation.
-    auto blob = VirtGpuDevice::getInstance(VirtGpuCapset::kCapsetGfxStream)
-                    .createBlob({.size = info.size,
-                                 .flags = kBlobFlagMappable | kBlobFlagShareable,
-                                 .blobMem = kBlobMemHost3d,
-                                 .blobId = info.id});
-    if (!blob) {
-        return MAGMA_STATUS_INTERNAL_ERROR;
+    if (info.fd < 0) {
+        // TODO(fxbug.dev/122604): Evaluate deferred guest resource creation.
+        auto blob = VirtGpuDevice::getInstance(VirtGpuCapset::kCapsetGfxStream)
+                        .createBlob({.size = info.size,
+                                     .flags = kBlobFlagMappable | kBlobFlagShareable,
+                                     .blobMem = kBlobMemHost3d,
+                                     .blobId = info.id});
+        if (!blob) {
+            return MAGMA_STATUS_INTERNAL_ERROR;
+        }
+
+        VirtGpuExternalHandle handle{};
+        int result = blob->exportBlob(handle);
+        if (result != 0 || handle.osHandle < 0) {
+            return MAGMA_STATUS_INTERNAL_ERROR;
+        }
+
+        info.blob = blob;
+        info.fd = handle.osHandle;
     }
 
-    VirtGpuExternalHandle handle{};
-    int result = blob->exportBlob(handle);
-    if (result != 0 || handle.osHandle < 0) {
+    // The caller owns what it gets.
+    int fd = fcntl(info.fd, F_DUPFD_CLOEXEC, 0);
+    if (fd < 0) {
+        ALOGE("%s: dup failed: %s", __func__, strerror(errno));
         return MAGMA_STATUS_INTERNAL_ERROR;
     }
 
-    *fd_out = handle.osHandle;
+    *fd_out = fd;
 
     return MAGMA_STATUS_OK;
 }
@@ -227,8 +247,8 @@ magma_status_t MagmaClientContext::magma_buffer_export(void* self, magma_buffer_
 }
 
 // We can't pass a non-zero timeout to the server, as that would block the server from handling
-// requests from other threads. So we busy wait here, which isn't ideal; however if the server did
-// block, gfxstream would busy wait for the response anyway.
+// requests from other threads. So we poll here: back to back at first, for items that are about to
+// be signaled, then backing off so that a long wait does not keep the server busy answering.
 magma_status_t MagmaClientContext::magma_poll(void* self, magma_poll_item_t* items, uint32_t count,
                                               uint64_t timeout_ns) {
     auto context = reinterpret_cast<MagmaClientContext*>(self);
@@ -241,7 +261,14 @@ magma_status_t MagmaClientContext::magma_poll(void* self, magma_poll_item_t* ite
         abs_timeout_ns = std::numeric_limits<int64_t>::max();
     }
 
+    // Polls before backing off, and the longest sleep between polls.
+    constexpr uint32_t kSpinPolls = 64;
+    constexpr int64_t kMinSleepNs = 10000;
+    constexpr int64_t kMaxSleepNs = 1000000;
+
     bool warned_for_long_poll = false;
+    uint32_t polls = 0;
+    int64_t sleep_ns = kMinSleepNs;
 
     while (true) {
         magma_status_t status = context->magma_poll_enc_(self, items, count, 0);
@@ -251,12 +278,21 @@ magma_status_t MagmaClientContext::magma_poll(void* self, magma_poll_item_t* ite
         // Not ready, allow other threads to work in with us
         get_thread_local_context_lock()->unlock();
 
-        std::this_thread::yield();
-
         int64_t time_now = static_cast<int64_t>(get_ns_monotonic(false));
+        if (time_now >= abs_timeout_ns) break;
+
+        if (++polls < kSpinPolls) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(
+                std::chrono::nanoseconds(std::min(sleep_ns, abs_timeout_ns - time_now)));
+            sleep_ns = std::min(sleep_ns * 2, kMaxSleepNs);
+        }
+
+        time_now = static_cast<int64_t>(get_ns_monotonic(false));
 
-        // TODO(fxb/122604): Add back-off to the busy loop, ideally based on recent sleep
-        // patterns (e.g. start polling shortly before next expected burst).
+        // TODO(fxb/122604): Base the back-off on recent sleep patterns (e.g. start polling
+        // shortly before next expected burst).
         if (!warned_for_long_poll && time_now - time_start > 5000000000) {
             ALOGE("magma_poll: long poll detected (%lu us)", (time_now - time_start) / 1000);
             warned_for_long_poll = true;
@@ -312,6 +348,9 @@ void MagmaClientContext::magma_connection_release_buffer(void* self, magma_conne
             buffer, it->second.connection, connection);
         return;
     }
+    if (it->second.fd >= 0) {
+        close(it->second.fd);
+    }
     context->buffer_info_.erase(it);
 }
 
@@ -17,10 +17,34 @@
 #include <android-base/properties.h>
 #include <sys/prctl.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "perfetto.h"
 
 namespace {
 
+std::atomic<int64_t> sCounters[GOLDFISH_GPU_COUNTER_COUNT];
+
+struct CounterInfo {
+  const char* name;
+  const char* description;
+};
+
+const CounterInfo kCounterInfos[GOLDFISH_GPU_COUNTER_COUNT] = {
+  {"Encoded bytes", "Bytes of GL and Vulkan commands sent to the host"},
+  {"Frames", "Buffers swapped"},
+  {"Stream flushes", "Commits of encoded commands to the transport"},
+  {"Round trips", "Commands that waited for a host reply"},
+  {"Round trip time", "Nanoseconds spent waiting for host replies"},
+  {"Host queued bytes", "Bytes in transport rings not yet read by the host"},
+};
+
+constexpr uint64_t kDefaultCounterPeriodNs = 100 * 1000 * 1000;
+
 class GpuCounterDataSource : public perfetto::DataSource<GpuCounterDataSource> {
  public:
   void OnSetup(const SetupArgs& args) override {
@@ -28,24 +52,110 @@ class GpuCounterDataSource : public perfetto::DataSource<GpuCounterDataSource> {
     const std::string& config_raw = args.config->gpu_counter_config_raw();
     perfetto::protos::pbzero::GpuCounterConfig::Decoder config(config_raw);
     for(auto it = config.counter_ids(); it; ++it) {
-      counter_ids.push_back(it->as_uint32());
+      if (it->as_uint32() < GOLDFISH_GPU_COUNTER_COUNT) {
+        counter_ids.push_back(it->as_uint32());
+      }
+    }
+    if (counter_ids.empty()) {
+      for (uint32_t id = 0; id < GOLDFISH_GPU_COUNTER_COUNT; ++id) {
+        counter_ids.push_back(id);
+      }
+    }
+    if (config.has_counter_period_ns() && config.counter_period_ns() > 0) {
+      period_ns = config.counter_period_ns();
     }
     first = true;
   }
 
   void OnStart(const StartArgs&) override {
     PERFETTO_ILOG("GpuCounterDataSource OnStart called");
+    std::lock_guard<std::mutex> lock(sSamplerMutex);
+    if (sActiveInstances++ == 0) {
+      sSamplerPeriodNs = period_ns;
+      sSamplerRunning = true;
+      sSampler = std::thread(samplerLoop);
+    }
   }
 
   void OnStop(const StopArgs&) override {
     PERFETTO_ILOG("GpuCounterDataSource OnStop called");
+    std::thread sampler;
+    {
+      std::lock_guard<std::mutex> lock(sSamplerMutex);
+      if (--sActiveInstances == 0) {
+        sSamplerRunning = false;
+        sampler = std::move(sSampler);
+      }
+    }
+    sSamplerCv.notify_all();
+    if (sampler.joinable()) {
+      sampler.join();
+    }
   }
 
   bool first = true;
   uint64_t count = 0;
+  uint64_t period_ns = kDefaultCounterPeriodNs;
   std::vector<uint32_t> counter_ids;
+
+ private:
+  // One thread samples the counters for every tracing session.
+  static void samplerLoop() {
+    std::unique_lock<std::mutex> lock(sSamplerMutex);
+    while (sSamplerRunning) {
+      sSamplerCv.wait_for(lock, std::chrono::nanoseconds(sSamplerPeriodNs));
+      if (!sSamplerRunning) {
+        break;
+      }
+      lock.unlock();
+      emitCounters();
+      lock.lock();
+    }
+  }
+
+  static void emitCounters() {
+    Trace([](TraceContext ctx) {
+      auto ds = ctx.GetDataSourceLocked();
+      if (!ds) {
+        return;
+      }
+      auto packet = ctx.NewTracePacket();
+      packet->set_timestamp(perfetto::base::GetBootTimeNs().count());
+      auto* event = packet->set_gpu_counter_event();
+      if (ds->first) {
+        auto* descriptor = event->set_counter_descriptor();
+        for (uint32_t id : ds->counter_ids) {
+          auto* spec = descriptor->add_specs();
+          spec->set_counter_id(id);
+          spec->set_name(kCounterInfos[id].name);
+          spec->set_description(kCounterInfos[id].description);
+        }
+        ds->first = false;
+      }
+      for (uint32_t id : ds->counter_ids) {
+        auto* counter = event->add_counters();
+        counter->set_counter_id(id);
+        counter->set_int_value(sCounters[id].load(std::memory_order_relaxed));
+      }
+      ++ds->count;
+    });
+  }
+
+  static std::mutex sSamplerMutex;
+  static std::condition_variable sSamplerCv;
+  static std::thread sSampler;
+  static bool sSamplerRunning;
+  static uint64_t sSamplerPeriodNs;
+  static int sActiveInstances;
 };
 
+std::mutex GpuCounterDataSource::sSamplerMutex;
+std::condition_variable GpuCounterDataSource::sSamplerCv;
+std::thread GpuCounterDataSource::sSampler;
+bool GpuCounterDataSource::sSamplerRunning = false;
+uint64_t GpuCounterDataSource::sSamplerPeriodNs = kDefaultCounterPeriodNs;
+int GpuCounterDataSource::sActiveInstances = 0;
+
 class GpuRenderStageDataSource: public perfetto::DataSource<GpuRenderStageDataSource> {
  public:
   void OnSetup(const SetupArgs& args) override {
@@ -68,6 +178,14 @@ class GpuRenderStageDataSource: public perfetto::DataSource<GpuRenderStageDataSo
 
 }
 
+void goldfish_perfetto_counter_add(GoldfishGpuCounter counter, int64_t delta) {
+  sCounters[counter].fetch_add(delta, std::memory_order_relaxed);
+}
+
+void goldfish_perfetto_counter_set(GoldfishGpuCounter counter, int64_t value) {
+  sCounters[counter].store(value, std::memory_order_relaxed);
+}
+
 void try_register_goldfish_perfetto() {
   std::string enableString = android::base::GetProperty("debug.graphics.gpu.profiler.perfetto", "");
   if (enableString != "1" && enableString != "true") {
@@ -15,6 +15,25 @@
 #ifndef __PROFILER_H__
 #define __PROFILER_H__
 
+#include <stdint.h>
+
 extern void try_register_goldfish_perfetto();
 
+// Guest side counters of the graphics stack, sampled onto the gpu.counters
+// data source. The values are process wide.
+enum GoldfishGpuCounter : uint32_t {
+    GOLDFISH_GPU_COUNTER_ENCODED_BYTES = 0,
+    GOLDFISH_GPU_COUNTER_FRAMES,
+    GOLDFISH_GPU_COUNTER_FLUSHES,
+    GOLDFISH_GPU_COUNTER_ROUND_TRIPS,
+    GOLDFISH_GPU_COUNTER_ROUND_TRIP_NS,
+    GOLDFISH_GPU_COUNTER_HOST_QUEUED_BYTES,
+    GOLDFISH_GPU_COUNTER_COUNT,
+};
+
+// Adds |delta| to a counter that counts events or bytes.
+extern void goldfish_perfetto_counter_add(GoldfishGpuCounter counter, int64_t delta);
+// Sets a counter that reports a current level.
+extern void goldfish_perfetto_counter_set(GoldfishGpuCounter counter, int64_t value);
+
 #endif //__PROFILER_H__
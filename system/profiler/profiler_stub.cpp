@@ -17,3 +17,7 @@
 #include "profiler.h"
 
 void try_register_goldfish_perfetto() { }
+
+void goldfish_perfetto_counter_add(GoldfishGpuCounter, int64_t) { }
+
+void goldfish_perfetto_counter_set(GoldfishGpuCounter, int64_t) { }
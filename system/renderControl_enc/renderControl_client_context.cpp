@@ -80,6 +80,12 @@ int renderControl_client_context_t::initDispatchByName(void *(*getProc)(const ch
 	rcGetFBDisplayActiveConfig = (rcGetFBDisplayActiveConfig_client_proc_t) getProc("rcGetFBDisplayActiveConfig", userData);
 	rcSetProcessMetadata = (rcSetProcessMetadata_client_proc_t) getProc("rcSetProcessMetadata", userData);
 	rcGetHostExtensionsString = (rcGetHostExtensionsString_client_proc_t) getProc("rcGetHostExtensionsString", userData);
+	rcSelectStreamCompression = (rcSelectStreamCompression_client_proc_t) getProc("rcSelectStreamCompression", userData);
+	rcCreateColorBuffersDMA = (rcCreateColorBuffersDMA_client_proc_t) getProc("rcCreateColorBuffersDMA", userData);
+	rcSetDisplayColorBufferAsync = (rcSetDisplayColorBufferAsync_client_proc_t) getProc("rcSetDisplayColorBufferAsync", userData);
+	rcSetColorBufferVulkanModeAsync = (rcSetColorBufferVulkanModeAsync_client_proc_t) getProc("rcSetColorBufferVulkanModeAsync", userData);
+	rcCloseColorBuffers = (rcCloseColorBuffers_client_proc_t) getProc("rcCloseColorBuffers", userData);
+	rcReadColorBufferYUVDMA = (rcReadColorBufferYUVDMA_client_proc_t) getProc("rcReadColorBufferYUVDMA", userData);
 	return 0;
 }
 
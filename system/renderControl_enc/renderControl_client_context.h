@@ -80,6 +80,12 @@ struct renderControl_client_context_t {
 	rcGetFBDisplayActiveConfig_client_proc_t rcGetFBDisplayActiveConfig;
 	rcSetProcessMetadata_client_proc_t rcSetProcessMetadata;
 	rcGetHostExtensionsString_client_proc_t rcGetHostExtensionsString;
+	rcSelectStreamCompression_client_proc_t rcSelectStreamCompression;
+	rcCreateColorBuffersDMA_client_proc_t rcCreateColorBuffersDMA;
+	rcSetDisplayColorBufferAsync_client_proc_t rcSetDisplayColorBufferAsync;
+	rcSetColorBufferVulkanModeAsync_client_proc_t rcSetColorBufferVulkanModeAsync;
+	rcCloseColorBuffers_client_proc_t rcCloseColorBuffers;
+	rcReadColorBufferYUVDMA_client_proc_t rcReadColorBufferYUVDMA;
 	virtual ~renderControl_client_context_t() {}
 
 	typedef renderControl_client_context_t *CONTEXT_ACCESSOR_TYPE(void);
@@ -82,6 +82,12 @@ typedef int (renderControl_APIENTRY *rcGetFBDisplayConfigsParam_client_proc_t) (
 typedef int (renderControl_APIENTRY *rcGetFBDisplayActiveConfig_client_proc_t) (void * ctx);
 typedef void (renderControl_APIENTRY *rcSetProcessMetadata_client_proc_t) (void * ctx, char*, RenderControlByte*, uint32_t);
 typedef int (renderControl_APIENTRY *rcGetHostExtensionsString_client_proc_t) (void * ctx, uint32_t, void*);
+typedef void (renderControl_APIENTRY *rcSelectStreamCompression_client_proc_t) (void * ctx, uint32_t, uint32_t);
+typedef int (renderControl_APIENTRY *rcCreateColorBuffersDMA_client_proc_t) (void * ctx, uint32_t, uint32_t, GLenum, int, uint32_t, uint32_t*);
+typedef void (renderControl_APIENTRY *rcSetDisplayColorBufferAsync_client_proc_t) (void * ctx, uint32_t, uint32_t);
+typedef void (renderControl_APIENTRY *rcSetColorBufferVulkanModeAsync_client_proc_t) (void * ctx, uint32_t, uint32_t);
+typedef void (renderControl_APIENTRY *rcCloseColorBuffers_client_proc_t) (void * ctx, uint32_t, uint32_t*);
+typedef int (renderControl_APIENTRY *rcReadColorBufferYUVDMA_client_proc_t) (void * ctx, uint32_t, GLint, GLint, GLint, GLint, void*, uint32_t);
 
 
 #endif
@@ -75,6 +75,12 @@ extern "C" {
 	int rcGetFBDisplayActiveConfig();
 	void rcSetProcessMetadata(char* key, RenderControlByte* valuePtr, uint32_t valueSize);
 	int rcGetHostExtensionsString(uint32_t bufferSize, void* buffer);
+	void rcSelectStreamCompression(uint32_t codec, uint32_t reserved);
+	int rcCreateColorBuffersDMA(uint32_t width, uint32_t height, GLenum internalFormat, int frameworkFormat, uint32_t count, uint32_t* colorBuffers);
+	void rcSetDisplayColorBufferAsync(uint32_t displayId, uint32_t colorBuffer);
+	void rcSetColorBufferVulkanModeAsync(uint32_t colorBuffer, uint32_t mode);
+	void rcCloseColorBuffers(uint32_t count, uint32_t* colorBuffers);
+	int rcReadColorBufferYUVDMA(uint32_t colorbuffer, GLint x, GLint y, GLint width, GLint height, void* pixels, uint32_t pixels_size);
 };
 
 #ifndef GET_CONTEXT
@@ -503,3 +509,38 @@ int rcGetHostExtensionsString(uint32_t bufferSize, void* buffer)
 	return ctx->rcGetHostExtensionsString(ctx, bufferSize, buffer);
 }
 
+void rcSelectStreamCompression(uint32_t codec, uint32_t reserved)
+{
+	GET_CONTEXT;
+	ctx->rcSelectStreamCompression(ctx, codec, reserved);
+}
+
+int rcCreateColorBuffersDMA(uint32_t width, uint32_t height, GLenum internalFormat, int frameworkFormat, uint32_t count, uint32_t* colorBuffers)
+{
+	GET_CONTEXT;
+	return ctx->rcCreateColorBuffersDMA(ctx, width, height, internalFormat, frameworkFormat, count, colorBuffers);
+}
+
+void rcSetDisplayColorBufferAsync(uint32_t displayId, uint32_t colorBuffer)
+{
+	GET_CONTEXT;
+	ctx->rcSetDisplayColorBufferAsync(ctx, displayId, colorBuffer);
+}
+
+void rcSetColorBufferVulkanModeAsync(uint32_t colorBuffer, uint32_t mode)
+{
+	GET_CONTEXT;
+	ctx->rcSetColorBufferVulkanModeAsync(ctx, colorBuffer, mode);
+}
+
+void rcCloseColorBuffers(uint32_t count, uint32_t* colorBuffers)
+{
+	GET_CONTEXT;
+	ctx->rcCloseColorBuffers(ctx, count, colorBuffers);
+}
+
+int rcReadColorBufferYUVDMA(uint32_t colorbuffer, GLint x, GLint y, GLint width, GLint height, void* pixels, uint32_t pixels_size)
+{
+	GET_CONTEXT;
+	return ctx->rcReadColorBufferYUVDMA(ctx, colorbuffer, x, y, width, height, pixels, pixels_size);
+}
@@ -78,6 +78,12 @@ static const struct _renderControl_funcs_by_name {
 	{"rcGetFBDisplayActiveConfig", (void*)rcGetFBDisplayActiveConfig},
 	{"rcSetProcessMetadata", (void*)rcSetProcessMetadata},
 	{"rcGetHostExtensionsString", (void*)rcGetHostExtensionsString},
+	{"rcSelectStreamCompression", (void*)rcSelectStreamCompression},
+	{"rcCreateColorBuffersDMA", (void*)rcCreateColorBuffersDMA},
+	{"rcSetDisplayColorBufferAsync", (void*)rcSetDisplayColorBufferAsync},
+	{"rcSetColorBufferVulkanModeAsync", (void*)rcSetColorBufferVulkanModeAsync},
+	{"rcCloseColorBuffers", (void*)rcCloseColorBuffers},
+	{"rcReadColorBufferYUVDMA", (void*)rcReadColorBufferYUVDMA},
 };
 static const int renderControl_num_funcs = sizeof(renderControl_funcs_by_name) / sizeof(struct _renderControl_funcs_by_name);
 
@@ -73,7 +73,13 @@
 #define OP_rcGetFBDisplayActiveConfig 					10067
 #define OP_rcSetProcessMetadata 					10068
 #define OP_rcGetHostExtensionsString 					10069
-#define OP_last 					10070
+#define OP_rcSelectStreamCompression 					10070
+#define OP_rcCreateColorBuffersDMA 					10071
+#define OP_rcSetDisplayColorBufferAsync 					10072
+#define OP_rcSetColorBufferVulkanModeAsync 					10073
+#define OP_rcCloseColorBuffers 					10074
+#define OP_rcReadColorBufferYUVDMA 					10075
+#define OP_last 					10076
 
 
 #endif
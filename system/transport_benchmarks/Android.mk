@@ -0,0 +1,26 @@
+LOCAL_PATH:= $(call my-dir)
+include $(CLEAR_VARS)
+LOCAL_MODULE := TransportBenchmarks
+
+$(call emugl-import,libOpenglSystemCommon lib_renderControl_enc)
+
+LOCAL_C_INCLUDES += \
+    $(EMUGL_COMMON_INCLUDES) \
+    device/generic/goldfish-opengl/host/include/libOpenglRender \
+
+LOCAL_SRC_FILES:= \
+    transport_benchmark.cpp \
+    main.cpp \
+
+ifeq (true,$(GFXSTREAM))
+LOCAL_CFLAGS += -DVIRTIO_GPU
+LOCAL_C_INCLUDES += external/libdrm external/minigbm/cros_gralloc
+endif
+
+LOCAL_VENDOR_MODULE := true
+LOCAL_MODULE_TAGS := tests
+
+LOCAL_LICENSE_KINDS := SPDX-license-identifier-Apache-2.0
+LOCAL_LICENSE_CONDITIONS := notice
+LOCAL_NOTICE_FILE := $(LOCAL_PATH)/../../LICENSE
+include $(BUILD_NATIVE_BENCHMARK)
@@ -0,0 +1,116 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "HostConnection.h"
+#include "renderControl_enc.h"
+
+// Compares the transports behind HostConnection with real host round trips,
+// so it has to run in a guest. Transports the guest does not have are
+// skipped. NullHost has no host behind it, which leaves what the guest side
+// of each call costs. Run with --benchmark_format=json, or
+// --benchmark_out=<file>, for machine readable results.
+
+namespace {
+
+// Payloads ride on rcSetProcessMetadata under a key the host does not act
+// on, so that the host does as little as possible besides reading them.
+char kPayloadKey[] = "transport_benchmark";
+
+std::unique_ptr<HostConnection> connectOrSkip(benchmark::State& state,
+                                              HostConnectionType type, uint32_t capsetId) {
+    std::unique_ptr<HostConnection> con = HostConnection::createUniqueWithType(type, capsetId);
+    if (!con || !con->rcEncoder()) {
+        state.SkipWithError("transport not available");
+        return nullptr;
+    }
+    return con;
+}
+
+void sendPayload(ExtendedRCEncoderContext* rcEnc, std::vector<RenderControlByte>& payload) {
+    rcEnc->rcSetProcessMetadata(rcEnc, kPayloadKey, payload.data(), payload.size());
+}
+
+// Sustained writes of state.range(0) bytes, each flushed as large uploads
+// are. The transport backs up once the host falls behind, so over a run
+// the rate settles at what the host drains.
+void BM_WriteBandwidth(benchmark::State& state, HostConnectionType type, uint32_t capsetId) {
+    std::unique_ptr<HostConnection> con = connectOrSkip(state, type, capsetId);
+    if (!con) return;
+    ExtendedRCEncoderContext* rcEnc = con->rcEncoder();
+    std::vector<RenderControlByte> payload(state.range(0), 0x5a);
+
+    for (auto _ : state) {
+        sendPayload(rcEnc, payload);
+        con->flush();
+    }
+    rcEnc->rcGetRendererVersion(rcEnc);
+    state.SetBytesProcessed(int64_t(state.iterations()) * payload.size());
+}
+
+// Small commands left to batch up in the stream buffer, as most encoder
+// traffic is.
+void BM_MessageRate(benchmark::State& state, HostConnectionType type, uint32_t capsetId) {
+    std::unique_ptr<HostConnection> con = connectOrSkip(state, type, capsetId);
+    if (!con) return;
+    ExtendedRCEncoderContext* rcEnc = con->rcEncoder();
+    std::vector<RenderControlByte> payload(state.range(0), 0x5a);
+
+    for (auto _ : state) {
+        sendPayload(rcEnc, payload);
+    }
+    rcEnc->rcGetRendererVersion(rcEnc);
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(int64_t(state.iterations()) * payload.size());
+}
+
+// A payload followed by a call that waits for the host, so each iteration
+// is one round trip.
+void BM_RoundTrip(benchmark::State& state, HostConnectionType type, uint32_t capsetId) {
+    std::unique_ptr<HostConnection> con = connectOrSkip(state, type, capsetId);
+    if (!con) return;
+    ExtendedRCEncoderContext* rcEnc = con->rcEncoder();
+    std::vector<RenderControlByte> payload(state.range(0), 0x5a);
+
+    for (auto _ : state) {
+        sendPayload(rcEnc, payload);
+        benchmark::DoNotOptimize(rcEnc->rcGetRendererVersion(rcEnc));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(int64_t(state.iterations()) * payload.size());
+}
+
+#define TRANSPORT_BENCHMARKS(fn, minSize, maxSize)                                           \
+    BENCHMARK_CAPTURE(fn, AddressSpace, HOST_CONNECTION_ADDRESS_SPACE,                      \
+                      VIRTIO_GPU_CAPSET_NONE)                                               \
+        ->RangeMultiplier(16)->Range(minSize, maxSize)->UseRealTime();                       \
+    BENCHMARK_CAPTURE(fn, QemuPipe, HOST_CONNECTION_QEMU_PIPE, VIRTIO_GPU_CAPSET_NONE)       \
+        ->RangeMultiplier(16)->Range(minSize, maxSize)->UseRealTime();                       \
+    BENCHMARK_CAPTURE(fn, VirtioGpuPipe, HOST_CONNECTION_VIRTIO_GPU_PIPE,                   \
+                      VIRTIO_GPU_CAPSET_NONE)                                               \
+        ->RangeMultiplier(16)->Range(minSize, maxSize)->UseRealTime();                       \
+    BENCHMARK_CAPTURE(fn, VirtioGpuAddressSpace, HOST_CONNECTION_VIRTIO_GPU_ADDRESS_SPACE,  \
+                      VIRTIO_GPU_CAPSET_GFXSTREAM)                                          \
+        ->RangeMultiplier(16)->Range(minSize, maxSize)->UseRealTime();                       \
+    BENCHMARK_CAPTURE(fn, NullHost, HOST_CONNECTION_NULL, VIRTIO_GPU_CAPSET_NONE)            \
+        ->RangeMultiplier(16)->Range(minSize, maxSize)->UseRealTime();
+
+TRANSPORT_BENCHMARKS(BM_WriteBandwidth, 16, 16 << 20)
+TRANSPORT_BENCHMARKS(BM_MessageRate, 16, 4096)
+TRANSPORT_BENCHMARKS(BM_RoundTrip, 16, 16 << 20)
+
+}  // namespace
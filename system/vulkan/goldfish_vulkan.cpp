@@ -17,6 +17,9 @@
 
 #include <errno.h>
 #include <string.h>
+
+#include <atomic>
+#include <mutex>
 #ifdef VK_USE_PLATFORM_FUCHSIA
 #include <fidl/fuchsia.logger/cpp/wire.h>
 #include <lib/syslog/global.h>
@@ -33,6 +36,7 @@
 #include "ProcessPipe.h"
 #include "ResourceTracker.h"
 #include "VkEncoder.h"
+#include "aemu/base/FlightRecorder.h"
 #include "func_table.h"
 
 // Used when there is no Vulkan support on the host.
@@ -356,6 +360,30 @@ int CloseDevice(struct hw_device_t* /*device*/) {
 
 #endif
 
+// Whether the host has Vulkan: -1 until the first entry point to get a host
+// connection has set up ResourceTracker, which happens once per process.
+static std::atomic<int> sHostSupportsVulkan(-1);
+
+static void setupResourceTracker(ExtendedRCEncoderContext* rcEnc) {
+    static std::once_flag once;
+    std::call_once(once, [rcEnc] {
+        gfxstream::vk::ResourceTracker::ThreadingCallbacks threadingCallbacks = {
+            [] {
+              auto hostCon = HostConnection::get();
+              hostCon->rcEncoder();
+              return hostCon;
+            },
+            [](HostConnection* hostCon) { return hostCon->vkEncoder(); },
+        };
+        gfxstream::vk::ResourceTracker::get()->setThreadingCallbacks(threadingCallbacks);
+        gfxstream::vk::ResourceTracker::get()->setupFeatures(rcEnc->featureInfo_const());
+        gfxstream::vk::ResourceTracker::get()->setupCaps();
+        gfxstream::vk::ResourceTracker::get()->setSeqnoPtr(getSeqnoPtrForProcess());
+        sHostSupportsVulkan.store(gfxstream::vk::ResourceTracker::get()->hostSupportsVulkan(),
+                                  std::memory_order_release);
+    });
+}
+
 #define VK_HOST_CONNECTION(ret) \
     HostConnection *hostCon = HostConnection::getOrCreate(VIRTIO_GPU_CAPSET_GFXSTREAM); \
     if (!hostCon) { \
@@ -367,18 +395,7 @@ int CloseDevice(struct hw_device_t* /*device*/) {
         ALOGE("vulkan: Failed to get renderControl encoder context\n"); \
         return ret; \
     } \
-    gfxstream::vk::ResourceTracker::ThreadingCallbacks threadingCallbacks = { \
-        [] { \
-          auto hostCon = HostConnection::get(); \
-          hostCon->rcEncoder(); \
-          return hostCon; \
-        }, \
-        [](HostConnection* hostCon) { return hostCon->vkEncoder(); }, \
-    }; \
-    gfxstream::vk::ResourceTracker::get()->setThreadingCallbacks(threadingCallbacks); \
-    gfxstream::vk::ResourceTracker::get()->setupFeatures(rcEnc->featureInfo_const()); \
-    gfxstream::vk::ResourceTracker::get()->setupCaps();                                    \
-    gfxstream::vk::ResourceTracker::get()->setSeqnoPtr(getSeqnoPtrForProcess()); \
+    setupResourceTracker(rcEnc); \
     auto hostSupportsVulkan = gfxstream::vk::ResourceTracker::get()->hostSupportsVulkan(); \
     gfxstream::vk::VkEncoder *vkEnc = hostCon->vkEncoder(); \
     if (!vkEnc) { \
@@ -386,6 +403,27 @@ int CloseDevice(struct hw_device_t* /*device*/) {
         return ret; \
     } \
 
+// For the proc address lookups, which only need to know whether the host has
+// Vulkan: once that is known they answer without a host connection or a
+// Vulkan encoder for the calling thread. Returns -1 on failure.
+static int getHostSupportsVulkan() {
+    const int known = sHostSupportsVulkan.load(std::memory_order_acquire);
+    if (known >= 0) return known;
+
+    HostConnection *hostCon = HostConnection::getOrCreate(VIRTIO_GPU_CAPSET_GFXSTREAM);
+    if (!hostCon) {
+        ALOGE("vulkan: Failed to get host connection\n");
+        return -1;
+    }
+    ExtendedRCEncoderContext *rcEnc = hostCon->rcEncoder();
+    if (!rcEnc) {
+        ALOGE("vulkan: Failed to get renderControl encoder context\n");
+        return -1;
+    }
+    setupResourceTracker(rcEnc);
+    return sHostSupportsVulkan.load(std::memory_order_acquire);
+}
+
 VKAPI_ATTR
 VkResult EnumerateInstanceExtensionProperties(
     const char* layer_name,
@@ -412,6 +450,31 @@ VkResult EnumerateInstanceExtensionProperties(
     return res;
 }
 
+// The host's instance version does not change, so only the first call asks.
+VKAPI_ATTR
+VkResult EnumerateInstanceVersion(uint32_t* pApiVersion) {
+    AEMU_SCOPED_TRACE("goldfish_vulkan::EnumerateInstanceVersion");
+
+    static std::atomic<uint32_t> sApiVersion(0);
+    uint32_t apiVersion = sApiVersion.load(std::memory_order_relaxed);
+    if (!apiVersion) {
+        VK_HOST_CONNECTION(VK_ERROR_DEVICE_LOST)
+
+        if (!hostSupportsVulkan) {
+            return vkstubhal::EnumerateInstanceVersion(pApiVersion);
+        }
+
+        VkResult res = vkEnc->vkEnumerateInstanceVersion(&apiVersion, true /* do lock */);
+        if (res != VK_SUCCESS) {
+            return res;
+        }
+        sApiVersion.store(apiVersion, std::memory_order_relaxed);
+    }
+
+    *pApiVersion = apiVersion;
+    return VK_SUCCESS;
+}
+
 VKAPI_ATTR
 VkResult CreateInstance(const VkInstanceCreateInfo* create_info,
                         const VkAllocationCallbacks* allocator,
@@ -651,6 +714,7 @@ struct FrameTracingState {
         }
         tracingEnabled = current;
 #endif
+        android::base::flightRecordFrameEnd(frameNumber);
         ++frameNumber;
     }
 };
@@ -677,9 +741,7 @@ QueueSignalReleaseImageANDROID(
 static PFN_vkVoidFunction GetDeviceProcAddr(VkDevice device, const char* name) {
     AEMU_SCOPED_TRACE("goldfish_vulkan::GetDeviceProcAddr");
 
-    VK_HOST_CONNECTION(nullptr)
-
-    if (!hostSupportsVulkan) {
+    if (getHostSupportsVulkan() <= 0) {
         return nullptr;
     }
 
@@ -732,8 +794,10 @@ VKAPI_ATTR
 PFN_vkVoidFunction GetInstanceProcAddr(VkInstance instance, const char* name) {
     AEMU_SCOPED_TRACE("goldfish_vulkan::GetInstanceProcAddr");
 
-    VK_HOST_CONNECTION(nullptr)
-
+    const int hostSupportsVulkan = getHostSupportsVulkan();
+    if (hostSupportsVulkan < 0) {
+        return nullptr;
+    }
     if (!hostSupportsVulkan) {
         return vkstubhal::GetInstanceProcAddr(instance, name);
     }
@@ -741,6 +805,13 @@ PFN_vkVoidFunction GetInstanceProcAddr(VkInstance instance, const char* name) {
     if (!strcmp(name, "vkEnumerateInstanceExtensionProperties")) {
         return (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties;
     }
+    if (!strcmp(name, "vkEnumerateInstanceVersion")) {
+        // Only where the generated table has it.
+        if (!gfxstream::vk::goldfish_vulkan_get_instance_proc_address(instance, name)) {
+            return nullptr;
+        }
+        return (PFN_vkVoidFunction)EnumerateInstanceVersion;
+    }
     if (!strcmp(name, "vkCreateInstance")) {
         return (PFN_vkVoidFunction)CreateInstance;
     }
@@ -49,8 +49,11 @@ LOCAL_CFLAGS += \
 
 LOCAL_SRC_FILES := AndroidHardwareBuffer.cpp \
     CommandBufferStagingStream.cpp \
+    CommandBufferStateShadow.cpp \
     DescriptorSetVirtualization.cpp \
     HostVisibleMemoryVirtualization.cpp \
+    PipelineDedup.cpp \
+    QueueSubmitWorker.cpp \
     Resources.cpp \
     Validation.cpp \
     VulkanStreamGuest.cpp \
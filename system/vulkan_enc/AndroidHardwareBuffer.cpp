@@ -23,13 +23,91 @@
 
 #include "../OpenglSystemCommon/HostConnection.h"
 
+#include "aemu/base/synchronization/AndroidLock.h"
 #include "vk_format_info.h"
 #include "vk_util.h"
 #include <assert.h>
 
+using android::base::guest::AutoLock;
+using android::base::guest::Lock;
+
 namespace gfxstream {
 namespace vk {
 
+namespace {
+
+// Resolving the host handle and size of a buffer is a round trip through
+// the kernel per call with minigbm, and camera and video pipelines
+// import the same few buffers every frame, so remember the answers for
+// the most recently seen buffers. AHardwareBuffer ids are never reused
+// within a process, so an entry for a freed buffer is merely dead weight
+// until it ages out.
+class HostBufferInfoCache {
+   public:
+    struct Info {
+        uint32_t hostHandle = 0;
+        size_t allocatedSize = 0;
+    };
+
+    Info get(Gralloc* grallocHelper, const AHardwareBuffer* buffer) {
+        const uint64_t id = getId(buffer);
+        if (id) {
+            AutoLock<Lock> lock(mLock);
+            for (Entry& entry : mEntries) {
+                if (entry.id == id) {
+                    entry.lastUse = ++mUseCounter;
+                    return entry.info;
+                }
+            }
+        }
+
+        const native_handle_t* handle = AHardwareBuffer_getNativeHandle(buffer);
+        Info info;
+        info.hostHandle = grallocHelper->getHostHandle(handle);
+        if (!info.hostHandle) return info;
+        info.allocatedSize = grallocHelper->getAllocatedSize(handle);
+        if (!id) return info;
+
+        AutoLock<Lock> lock(mLock);
+        Entry* victim = &mEntries[0];
+        for (Entry& entry : mEntries) {
+            if (entry.id == id) return entry.info;
+            if (entry.lastUse < victim->lastUse) victim = &entry;
+        }
+        victim->id = id;
+        victim->info = info;
+        victim->lastUse = ++mUseCounter;
+        return info;
+    }
+
+   private:
+    static constexpr size_t kMaxEntries = 64;
+
+    struct Entry {
+        uint64_t id = 0;
+        uint64_t lastUse = 0;
+        Info info;
+    };
+
+    static uint64_t getId(const AHardwareBuffer* buffer) {
+        uint64_t id = 0;
+#if defined(PLATFORM_SDK_VERSION) && PLATFORM_SDK_VERSION >= 31
+        AHardwareBuffer_getId(buffer, &id);
+#else
+        (void)buffer;
+#endif
+        return id;
+    }
+
+    Lock mLock;
+    uint64_t mUseCounter = 0;
+    Entry mEntries[kMaxEntries];
+};
+
+HostBufferInfoCache sHostBufferInfoCache;
+
+}  // namespace
+
 // From Intel ANV implementation.
 /* Construct ahw usage mask from image usage bits, see
  * 'AHardwareBuffer Usage Equivalence' in Vulkan spec.
@@ -229,18 +307,23 @@ VkResult getAndroidHardwareBufferPropertiesANDROID(
         ahbFormatProps->suggestedYChromaOffset = VK_CHROMA_LOCATION_MIDPOINT;
     }
 
-    uint32_t colorBufferHandle =
-        grallocHelper->getHostHandle(handle);
-    if (!colorBufferHandle) {
+    const HostBufferInfoCache::Info hostInfo =
+        sHostBufferInfoCache.get(grallocHelper, buffer);
+    if (!hostInfo.hostHandle) {
         return VK_ERROR_INVALID_EXTERNAL_HANDLE;
     }
 
-    pProperties->allocationSize =
-        grallocHelper->getAllocatedSize(handle);
+    pProperties->allocationSize = hostInfo.allocatedSize;
 
     return VK_SUCCESS;
 }
 
+uint32_t getAndroidHardwareBufferHostHandle(
+    Gralloc* grallocHelper,
+    const AHardwareBuffer* buffer) {
+    return sHostBufferInfoCache.get(grallocHelper, buffer).hostHandle;
+}
+
 // Based on Intel ANV implementation.
 VkResult getMemoryAndroidHardwareBufferANDROID(struct AHardwareBuffer **pBuffer) {
 
@@ -272,8 +355,7 @@ VkResult importAndroidHardwareBuffer(
     }
 
     uint32_t colorBufferHandle =
-        grallocHelper->getHostHandle(
-            AHardwareBuffer_getNativeHandle(info->buffer));
+        getAndroidHardwareBufferHostHandle(grallocHelper, info->buffer);
     if (!colorBufferHandle) {
         return VK_ERROR_INVALID_EXTERNAL_HANDLE;
     }
@@ -39,6 +39,12 @@ VkResult getAndroidHardwareBufferPropertiesANDROID(
     const AHardwareBuffer* buffer,
     VkAndroidHardwareBufferPropertiesANDROID* pProperties);
 
+// Host color buffer (or buffer) handle backing |buffer|, or 0 if it has
+// none. Cached per buffer, so repeated imports skip the gralloc query.
+uint32_t getAndroidHardwareBufferHostHandle(
+    Gralloc* grallocHelper,
+    const AHardwareBuffer* buffer);
+
 VkResult getMemoryAndroidHardwareBufferANDROID(
     struct AHardwareBuffer **pBuffer);
 
@@ -30,24 +30,87 @@
 #include <atomic>
 #include <vector>
 
+#include "aemu/base/AlignedBuf.h"
+
 static const size_t kReadSize = 512 * 1024;
 static const size_t kWriteOffset = kReadSize;
 
 namespace gfxstream {
 namespace vk {
 
+using android::base::guest::AutoLock;
+using android::base::guest::GraphicsMemory;
+using android::base::guest::graphicsMemoryAdd;
+using android::base::guest::Lock;
+
+CommandBufferStagingArena::~CommandBufferStagingArena() { trim(); }
+
+CommandBufferStagingArena::Chunk* CommandBufferStagingArena::acquire(size_t minSize) {
+    {
+        AutoLock<Lock> lock(m_lock);
+        // every pooled chunk holds at least kChunkSize, so only oversized
+        // requests can miss here
+        if (m_free && m_free->size >= minSize) {
+            Chunk* chunk = m_free;
+            m_free = chunk->next;
+            chunk->next = nullptr;
+            chunk->used = 0;
+            return chunk;
+        }
+    }
+
+    const size_t size = minSize > kChunkSize ? minSize : kChunkSize;
+    // Chunks go back to the arena and are written again and again, so large
+    // ones are faulted in once here rather than on first touch.
+    Chunk* chunk =
+        static_cast<Chunk*>(android::large_buf_alloc(sizeof(Chunk) + size, true /* prefault */));
+    if (!chunk) {
+        ALOGE("%s: failed to allocate %zu byte chunk\n", __func__, size);
+        return nullptr;
+    }
+    chunk->next = nullptr;
+    chunk->size = size;
+    chunk->used = 0;
+    graphicsMemoryAdd(GraphicsMemory::kStagingStreams, sizeof(Chunk) + size);
+    return chunk;
+}
+
+void CommandBufferStagingArena::release(Chunk* head, Chunk* tail) {
+    if (!head) return;
+    AutoLock<Lock> lock(m_lock);
+    tail->next = m_free;
+    m_free = head;
+}
+
+void CommandBufferStagingArena::trim() {
+    Chunk* chunk;
+    {
+        AutoLock<Lock> lock(m_lock);
+        chunk = m_free;
+        m_free = nullptr;
+    }
+    while (chunk) {
+        Chunk* next = chunk->next;
+        graphicsMemoryAdd(GraphicsMemory::kStagingStreams, -int64_t(sizeof(Chunk) + chunk->size));
+        free(chunk);
+        chunk = next;
+    }
+}
+
 CommandBufferStagingStream::CommandBufferStagingStream()
     : IOStream(1048576), m_size(0), m_writePos(0) {
     // use default allocators
     m_alloc = [](size_t size) -> Memory {
         return {
             .deviceMemory = VK_NULL_HANDLE,  // no device memory for malloc
-            .ptr = malloc(size),
+            .ptr = android::large_buf_alloc(size, false /* prefault */),
         };
     };
     m_free = [](const Memory& mem) { free(mem.ptr); };
     m_realloc = [](const Memory& mem, size_t size) -> Memory {
-        return {.deviceMemory = VK_NULL_HANDLE, .ptr = realloc(mem.ptr, size)};
+        void* ptr = realloc(mem.ptr, size);
+        android::large_buf_advise(ptr, size, false /* prefault */);
+        return {.deviceMemory = VK_NULL_HANDLE, .ptr = ptr};
     };
 }
 
@@ -146,9 +209,30 @@ CommandBufferStagingStream::CommandBufferStagingStream(const Alloc& allocFn, con
 
 CommandBufferStagingStream::~CommandBufferStagingStream() {
     flush();
+    releaseChunks();
     if (m_mem.ptr) m_free(m_mem);
 }
 
+void CommandBufferStagingStream::setArena(CommandBufferStagingArena* arena) {
+    if (m_usingCustomAlloc) return;
+    releaseChunks();
+    m_arena = arena;
+    m_writePos = 0;
+    IOStream::rewind();
+}
+
+void CommandBufferStagingStream::accountMemory() {
+    // Custom allocations come out of device memory, which is accounted for
+    // where it gets mapped.
+    m_memory.set(m_usingCustomAlloc || !m_mem.ptr ? 0 : m_size);
+}
+
+void CommandBufferStagingStream::releaseChunks() {
+    if (m_arena) m_arena->release(m_head, m_tail);
+    m_head = nullptr;
+    m_tail = nullptr;
+}
+
 unsigned char* CommandBufferStagingStream::getDataPtr() {
     if (!m_mem.ptr) return nullptr;
     const size_t metadataSize = m_usingCustomAlloc ? kSyncDataSize : 0;
@@ -164,16 +248,40 @@ void CommandBufferStagingStream::markFlushing() {
 }
 
 size_t CommandBufferStagingStream::idealAllocSize(size_t len) {
+    if (m_arena) {
+        // hand IOStream whatever is left of the current chunk so that it
+        // fills it before a new one gets chained
+        if (m_tail && m_tail->size - m_tail->used >= len) {
+            return m_tail->size - m_tail->used;
+        }
+        return len > CommandBufferStagingArena::kChunkSize ? len
+                                                           : CommandBufferStagingArena::kChunkSize;
+    }
     if (len > 1048576) return len;
     return 1048576;
 }
 
 void* CommandBufferStagingStream::allocBuffer(size_t minSize) {
+    if (m_arena) {
+        if (!m_tail || m_tail->size - m_tail->used < minSize) {
+            CommandBufferStagingArena::Chunk* chunk = m_arena->acquire(minSize);
+            if (!chunk) return nullptr;
+            if (m_tail) {
+                m_tail->next = chunk;
+            } else {
+                m_head = chunk;
+            }
+            m_tail = chunk;
+        }
+        return m_tail->data() + m_tail->used;
+    }
+
     size_t allocSize = (1048576 < minSize ? minSize : 1048576);
     // Initial case: blank
     if (!m_mem.ptr) {
         m_mem = m_alloc(allocSize);
         m_size = allocSize;
+        accountMemory();
         return getDataPtr();
     }
 
@@ -185,6 +293,7 @@ void* CommandBufferStagingStream::allocBuffer(size_t minSize) {
         size_t newAllocSize = m_size * 2 + allocSize;
         m_mem = m_realloc(m_mem, newAllocSize);
         m_size = newAllocSize;
+        accountMemory();
 
         return (void*)(getDataPtr() + m_writePos);
     }
@@ -206,6 +315,7 @@ void* CommandBufferStagingStream::allocBuffer(size_t minSize) {
 
 int CommandBufferStagingStream::commitBuffer(size_t size)
 {
+    if (m_arena && m_tail) m_tail->used += size;
     m_writePos += size;
     return 0;
 }
@@ -242,11 +352,23 @@ const unsigned char *CommandBufferStagingStream::commitBufferAndReadFully(
 }
 
 void CommandBufferStagingStream::getWritten(unsigned char** bufOut, size_t* sizeOut) {
-    *bufOut = getDataPtr();
+    *bufOut = m_arena ? (m_head ? m_head->data() : nullptr) : getDataPtr();
     *sizeOut = m_writePos;
 }
 
+void CommandBufferStagingStream::forEachWritten(
+    const std::function<void(unsigned char*, size_t)>& fn) {
+    if (!m_arena) {
+        if (m_writePos) fn(getDataPtr(), m_writePos);
+        return;
+    }
+    for (auto chunk = m_head; chunk; chunk = chunk->next) {
+        if (chunk->used) fn(chunk->data(), chunk->used);
+    }
+}
+
 void CommandBufferStagingStream::reset() {
+    releaseChunks();
     m_writePos = 0;
     IOStream::rewind();
 }
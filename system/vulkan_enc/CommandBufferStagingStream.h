@@ -21,10 +21,44 @@
 #include <functional>
 
 #include "IOStream.h"
+#include "aemu/base/MemoryAccounting.h"
+#include "aemu/base/synchronization/AndroidLock.h"
 
 namespace gfxstream {
 namespace vk {
 
+// Staging memory shared by the command buffers of one VkCommandPool. Chunks
+// are handed out from a free list and a command buffer that outgrows its
+// chunk chains another one instead of reallocating. Returning a command
+// buffer's chunks is a single list splice.
+class CommandBufferStagingArena {
+public:
+ static constexpr size_t kChunkSize = 256 * 1024;
+
+ struct Chunk {
+     Chunk* next;
+     // bytes available after the header; kChunkSize unless a single
+     // allocation asked for more
+     size_t size;
+     size_t used;
+     unsigned char* data() { return reinterpret_cast<unsigned char*>(this + 1); }
+ };
+
+ CommandBufferStagingArena() = default;
+ ~CommandBufferStagingArena();
+
+ // returns an empty chunk holding at least |minSize| bytes
+ Chunk* acquire(size_t minSize);
+ // gives back the chain |head| ... |tail|
+ void release(Chunk* head, Chunk* tail);
+ // frees every chunk not currently held by a command buffer
+ void trim();
+
+private:
+ android::base::guest::Lock m_lock;
+ Chunk* m_free = nullptr;
+};
+
 class CommandBufferStagingStream : public IOStream {
 public:
  // host will write kSyncDataReadComplete to the sync bytes to indicate memory is no longer being
@@ -70,9 +104,18 @@ public:
  virtual int writeFully(const void* buf, size_t len);
  virtual const unsigned char* commitBufferAndReadFully(size_t size, void* buf, size_t len);
 
+ // With an arena, |bufOut| only covers the first chunk; use forEachWritten
+ // to visit everything.
  void getWritten(unsigned char** bufOut, size_t* sizeOut);
+ // calls |fn| for each contiguous run of written data, in order
+ void forEachWritten(const std::function<void(unsigned char*, size_t)>& fn);
  void reset();
 
+ // Records into chunks from |arena| until the next call. Any data still in
+ // the stream is dropped. Ignored with custom allocators, whose single
+ // buffer is read by the host in place.
+ void setArena(CommandBufferStagingArena* arena);
+
  // marks the command buffer stream as flushing. The owner of CommandBufferStagingStream
  // should call markFlushing after finishing writing to the stream.
  // This will mark the sync data to kSyncDataReadPending. This is only applicable when
@@ -108,6 +151,17 @@ private:
  // flag tracking use of custom allocation/free
  bool m_usingCustomAlloc = false;
 
+ // chunk chain used instead of m_mem while an arena is set
+ CommandBufferStagingArena* m_arena = nullptr;
+ CommandBufferStagingArena::Chunk* m_head = nullptr;
+ CommandBufferStagingArena::Chunk* m_tail = nullptr;
+ void releaseChunks();
+
+ // m_mem while it comes from malloc
+ android::base::guest::AccountedMemory m_memory{
+     android::base::guest::GraphicsMemory::kStagingStreams};
+ void accountMemory();
+
  // adjusted memory location to point to start of data after accounting for metadata
  // \return pointer to data start
  unsigned char* getDataPtr();
@@ -0,0 +1,159 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "CommandBufferStateShadow.h"
+
+#include <string.h>
+
+namespace gfxstream {
+namespace vk {
+
+namespace {
+
+// Pushes are rarely split into many ranges; past this, the oldest are
+// forgotten, which only means they are sent again.
+constexpr size_t kMaxPushes = 8;
+
+template <typename T, typename U>
+bool setRange(std::vector<T>* shadow, uint32_t first, uint32_t count, const U* values) {
+    bool changed = false;
+    if (shadow->size() < first + count) {
+        shadow->resize(first + count);
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        changed |= (*shadow)[first + i].set(values[i]);
+    }
+    return changed;
+}
+
+}  // namespace
+
+template <typename T>
+bool CommandBufferStateShadow::Value<T>::set(const T& v) {
+    // Bitwise, so that values are only dropped when the host would see
+    // exactly the same bytes.
+    if (known && !memcmp(&value, &v, sizeof(T))) {
+        return false;
+    }
+    known = true;
+    value = v;
+    return true;
+}
+
+void CommandBufferStateShadow::reset() {
+    onGraphicsPipelineBound();
+    mPushLayout = VK_NULL_HANDLE;
+    mPushes.clear();
+}
+
+void CommandBufferStateShadow::onGraphicsPipelineBound() {
+    mViewports.clear();
+    mScissors.clear();
+    mLineWidth.known = false;
+    mDepthBias.known = false;
+    mBlendConstants.known = false;
+    mDepthBounds.known = false;
+    for (int face = 0; face < 2; ++face) {
+        mStencilCompareMask[face].known = false;
+        mStencilWriteMask[face].known = false;
+        mStencilReference[face].known = false;
+    }
+}
+
+bool CommandBufferStateShadow::setViewports(uint32_t first, uint32_t count,
+                                            const VkViewport* viewports) {
+    return setRange(&mViewports, first, count, viewports);
+}
+
+bool CommandBufferStateShadow::setScissors(uint32_t first, uint32_t count,
+                                           const VkRect2D* scissors) {
+    return setRange(&mScissors, first, count, scissors);
+}
+
+bool CommandBufferStateShadow::setLineWidth(float lineWidth) {
+    return mLineWidth.set(lineWidth);
+}
+
+bool CommandBufferStateShadow::setDepthBias(float constantFactor, float clamp,
+                                            float slopeFactor) {
+    return mDepthBias.set({ constantFactor, clamp, slopeFactor });
+}
+
+bool CommandBufferStateShadow::setBlendConstants(const float blendConstants[4]) {
+    BlendConstants v;
+    memcpy(v.values, blendConstants, sizeof(v.values));
+    return mBlendConstants.set(v);
+}
+
+bool CommandBufferStateShadow::setDepthBounds(float minDepthBounds, float maxDepthBounds) {
+    return mDepthBounds.set({ minDepthBounds, maxDepthBounds });
+}
+
+bool CommandBufferStateShadow::setStencil(Value<uint32_t>* faces, VkStencilFaceFlags faceMask,
+                                          uint32_t value) {
+    bool changed = false;
+    if (faceMask & VK_STENCIL_FACE_FRONT_BIT) {
+        changed |= faces[0].set(value);
+    }
+    if (faceMask & VK_STENCIL_FACE_BACK_BIT) {
+        changed |= faces[1].set(value);
+    }
+    return changed;
+}
+
+bool CommandBufferStateShadow::setStencilCompareMask(VkStencilFaceFlags faceMask,
+                                                     uint32_t compareMask) {
+    return setStencil(mStencilCompareMask, faceMask, compareMask);
+}
+
+bool CommandBufferStateShadow::setStencilWriteMask(VkStencilFaceFlags faceMask,
+                                                   uint32_t writeMask) {
+    return setStencil(mStencilWriteMask, faceMask, writeMask);
+}
+
+bool CommandBufferStateShadow::setStencilReference(VkStencilFaceFlags faceMask,
+                                                   uint32_t reference) {
+    return setStencil(mStencilReference, faceMask, reference);
+}
+
+bool CommandBufferStateShadow::pushConstants(VkPipelineLayout layout,
+                                             VkShaderStageFlags stageFlags, uint32_t offset,
+                                             uint32_t size, const void* values) {
+    if (layout != mPushLayout) {
+        mPushLayout = layout;
+        mPushes.clear();
+    }
+
+    const uint8_t* bytes = (const uint8_t*)values;
+    for (const PushConstants& push : mPushes) {
+        if (push.stageFlags == stageFlags && push.offset == offset &&
+            push.values.size() == size && !memcmp(push.values.data(), bytes, size)) {
+            return false;
+        }
+    }
+
+    // Whatever this overwrites no longer holds what was pushed.
+    for (auto it = mPushes.begin(); it != mPushes.end();) {
+        const bool overlaps = (it->stageFlags & stageFlags) && it->offset < offset + size &&
+                              offset < it->offset + it->values.size();
+        it = overlaps ? mPushes.erase(it) : it + 1;
+    }
+    if (mPushes.size() == kMaxPushes) {
+        mPushes.erase(mPushes.begin());
+    }
+    mPushes.push_back({ stageFlags, offset, std::vector<uint8_t>(bytes, bytes + size) });
+    return true;
+}
+
+}  // namespace vk
+}  // namespace gfxstream
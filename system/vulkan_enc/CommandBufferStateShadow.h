@@ -0,0 +1,104 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <vector>
+
+namespace gfxstream {
+namespace vk {
+
+// The dynamic state and push constants that a command buffer has recorded
+// so far, so that setting them again to the values they already have can
+// be left out of the stream. Each setter returns whether the command still
+// has to be encoded. Command buffers are externally synchronized, so there
+// is no locking.
+class CommandBufferStateShadow {
+   public:
+    // Everything is unknown, as at the start of recording and after
+    // executing secondary command buffers.
+    void reset();
+    // Pipelines overwrite the state they do not declare dynamic.
+    void onGraphicsPipelineBound();
+    // For commands that change the viewport or scissor counts.
+    void invalidateViewports() { mViewports.clear(); }
+    void invalidateScissors() { mScissors.clear(); }
+
+    bool setViewports(uint32_t first, uint32_t count, const VkViewport* viewports);
+    bool setScissors(uint32_t first, uint32_t count, const VkRect2D* scissors);
+    bool setLineWidth(float lineWidth);
+    bool setDepthBias(float constantFactor, float clamp, float slopeFactor);
+    bool setBlendConstants(const float blendConstants[4]);
+    bool setDepthBounds(float minDepthBounds, float maxDepthBounds);
+    bool setStencilCompareMask(VkStencilFaceFlags faceMask, uint32_t compareMask);
+    bool setStencilWriteMask(VkStencilFaceFlags faceMask, uint32_t writeMask);
+    bool setStencilReference(VkStencilFaceFlags faceMask, uint32_t reference);
+
+    bool pushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset,
+                       uint32_t size, const void* values);
+
+   private:
+    template <typename T>
+    struct Value {
+        bool known = false;
+        T value;
+
+        // Returns true if |v| is new, and remembers it.
+        bool set(const T& v);
+    };
+
+    struct DepthBias {
+        float constantFactor;
+        float clamp;
+        float slopeFactor;
+    };
+
+    struct BlendConstants {
+        float values[4];
+    };
+
+    struct DepthBounds {
+        float min;
+        float max;
+    };
+
+    struct PushConstants {
+        VkShaderStageFlags stageFlags;
+        uint32_t offset;
+        std::vector<uint8_t> values;
+    };
+
+    bool setStencil(Value<uint32_t>* faces, VkStencilFaceFlags faceMask, uint32_t value);
+
+    // Indexed by viewport; entries that were never set are not known.
+    std::vector<Value<VkViewport>> mViewports;
+    std::vector<Value<VkRect2D>> mScissors;
+    Value<float> mLineWidth;
+    Value<DepthBias> mDepthBias;
+    Value<BlendConstants> mBlendConstants;
+    Value<DepthBounds> mDepthBounds;
+    // Front, then back.
+    Value<uint32_t> mStencilCompareMask[2];
+    Value<uint32_t> mStencilWriteMask[2];
+    Value<uint32_t> mStencilReference[2];
+
+    // The pushes since the layout last changed, none of which overlap in
+    // both bytes and stages, so each still holds what its range contains.
+    VkPipelineLayout mPushLayout = VK_NULL_HANDLE;
+    std::vector<PushConstants> mPushes;
+};
+
+}  // namespace vk
+}  // namespace gfxstream
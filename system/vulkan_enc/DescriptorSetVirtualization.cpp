@@ -24,6 +24,7 @@ void clearReifiedDescriptorSet(ReifiedDescriptorSet* set) {
     set->poolId = -1;
     set->allocationPending = false;
     set->allWrites.clear();
+    set->committedWrites.clear();
     set->pendingWriteArrayRanges.clear();
 }
 
@@ -62,6 +63,7 @@ static void initializeReifiedDescriptorSet(VkDescriptorPool pool, VkDescriptorSe
     const auto& layoutInfo = *(as_goldfish_VkDescriptorSetLayout(setLayout)->layoutInfo);
 
     initDescriptorWriteTable(layoutInfo.bindings, set->allWrites);
+    initDescriptorWriteTable(layoutInfo.bindings, set->committedWrites);
 
     for (size_t i = 0; i < layoutInfo.bindings.size(); ++i) {
         // Bindings can be sparsely defined
@@ -112,6 +114,56 @@ bool isDescriptorTypeAccelerationStructure(VkDescriptorType descType) {
     return descType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
 }
 
+static void getHostHandles(const DescriptorWrite& write, uint64_t hostHandles[2]) {
+    hostHandles[0] = 0;
+    hostHandles[1] = 0;
+    switch (write.type) {
+        case DescriptorWriteType::ImageInfo:
+            hostHandles[0] = get_host_u64_VkSampler(write.imageInfo.sampler);
+            hostHandles[1] = get_host_u64_VkImageView(write.imageInfo.imageView);
+            break;
+        case DescriptorWriteType::BufferInfo:
+            hostHandles[0] = get_host_u64_VkBuffer(write.bufferInfo.buffer);
+            break;
+        case DescriptorWriteType::BufferView:
+            hostHandles[0] = get_host_u64_VkBufferView(write.bufferView);
+            break;
+        default:
+            break;
+    }
+}
+
+bool descriptorWriteMatchesCommitted(const DescriptorWrite& pending, const DescriptorWrite& committed) {
+    if (pending.type != committed.type || pending.descriptorType != committed.descriptorType) {
+        return false;
+    }
+
+    uint64_t hostHandles[2];
+    getHostHandles(pending, hostHandles);
+    if (hostHandles[0] != committed.committedHostHandles[0] ||
+        hostHandles[1] != committed.committedHostHandles[1]) {
+        return false;
+    }
+
+    switch (pending.type) {
+        case DescriptorWriteType::ImageInfo:
+            return pending.imageInfo.imageLayout == committed.imageInfo.imageLayout;
+        case DescriptorWriteType::BufferInfo:
+            return pending.bufferInfo.offset == committed.bufferInfo.offset &&
+                   pending.bufferInfo.range == committed.bufferInfo.range;
+        case DescriptorWriteType::BufferView:
+            return true;
+        default:
+            // Inline uniform blocks and acceleration structures are always sent.
+            return false;
+    }
+}
+
+void recordCommittedDescriptorWrite(const DescriptorWrite& write, DescriptorWrite* committed) {
+    *committed = write;
+    getHostHandles(write, committed->committedHostHandles);
+}
+
 void doEmulatedDescriptorWrite(const VkWriteDescriptorSet* write, ReifiedDescriptorSet* toWrite) {
     VkDescriptorType descType = write->descriptorType;
     uint32_t dstBinding = write->dstBinding;
@@ -187,6 +239,7 @@ void doEmulatedDescriptorWrite(const VkWriteDescriptorSet* write, ReifiedDescrip
 
 void doEmulatedDescriptorCopy(const VkCopyDescriptorSet* copy, const ReifiedDescriptorSet* src, ReifiedDescriptorSet* dst) {
     const DescriptorWriteTable& srcTable = src->allWrites;
+    const DescriptorWriteTable& srcCommittedTable = src->committedWrites;
     DescriptorWriteTable& dstTable = dst->allWrites;
 
     // src/dst may be the same descriptor set, so we need to create a temporary array for that case.
@@ -200,7 +253,11 @@ void doEmulatedDescriptorCopy(const VkCopyDescriptorSet* copy, const ReifiedDesc
             ++currBinding;
             arrOffset = 0;
         }
-        toCopy.push_back(srcTable[currBinding][arrOffset]);
+        // Descriptors already sent to the host are no longer pending.
+        const DescriptorWrite& pending = srcTable[currBinding][arrOffset];
+        toCopy.push_back(pending.type == DescriptorWriteType::Empty
+                             ? srcCommittedTable[currBinding][arrOffset]
+                             : pending);
     }
 
     currBinding = copy->dstBinding;
@@ -457,7 +514,45 @@ void fillDescriptorSetInfoForPool(VkDescriptorPool pool, VkDescriptorSetLayout s
     initializeReifiedDescriptorSet(pool, setLayout, newReified);
 }
 
-VkResult validateAndApplyVirtualDescriptorSetAllocation(const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pSets) {
+static void allocateLinearDescriptorSets(const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pSets,
+                                         std::vector<VkDescriptorSetLayout>* replacedLayouts) {
+    VkDescriptorPool pool = pAllocateInfo->descriptorPool;
+    DescriptorPoolAllocationInfo* allocInfo = as_goldfish_VkDescriptorPool(pool)->allocInfo;
+
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
+        uint32_t index = allocInfo->linearSetsUsed++;
+
+        if (index < allocInfo->linearSets.size()) {
+            VkDescriptorSet set = allocInfo->linearSets[index];
+            ReifiedDescriptorSet* reified = as_goldfish_VkDescriptorSet(set)->reified;
+            replacedLayouts->push_back(reified->setLayout);
+
+            uint64_t poolId = reified->poolId;
+            clearReifiedDescriptorSet(reified);
+            reified->bindingIsImmutableSampler.clear();
+            reified->poolId = poolId;
+            initializeReifiedDescriptorSet(pool, pAllocateInfo->pSetLayouts[i], reified);
+
+            pSets[i] = set;
+            continue;
+        }
+
+        uint64_t id = allocInfo->freePoolIds.back();
+        allocInfo->freePoolIds.pop_back();
+
+        VkDescriptorSet newSet = new_from_host_VkDescriptorSet((VkDescriptorSet)id);
+        ReifiedDescriptorSet* newReified = new ReifiedDescriptorSet;
+        newReified->poolId = id;
+        as_goldfish_VkDescriptorSet(newSet)->reified = newReified;
+        initializeReifiedDescriptorSet(pool, pAllocateInfo->pSetLayouts[i], newReified);
+
+        allocInfo->linearSets.push_back(newSet);
+        pSets[i] = newSet;
+    }
+}
+
+VkResult validateAndApplyVirtualDescriptorSetAllocation(const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pSets,
+                                                        std::vector<VkDescriptorSetLayout>* replacedLayouts) {
     VkResult validateRes = validateDescriptorSetAllocation(pAllocateInfo);
 
     if (validateRes != VK_SUCCESS) return validateRes;
@@ -469,6 +564,11 @@ VkResult validateAndApplyVirtualDescriptorSetAllocation(const VkDescriptorSetAll
     VkDescriptorPool pool = pAllocateInfo->descriptorPool;
     DescriptorPoolAllocationInfo* allocInfo = as_goldfish_VkDescriptorPool(pool)->allocInfo;
 
+    if (isLinearDescriptorPool(pool)) {
+        allocateLinearDescriptorSets(pAllocateInfo, pSets, replacedLayouts);
+        return VK_SUCCESS;
+    }
+
     if (allocInfo->freePoolIds.size() < pAllocateInfo->descriptorSetCount) {
         ALOGE("%s: FATAL: Somehow out of descriptor pool IDs. Wanted %u IDs but only have %u free IDs remaining. The count for maxSets was %u and used was %u\n", __func__,
                 pAllocateInfo->descriptorSetCount,
@@ -516,9 +616,36 @@ bool removeDescriptorSetFromPool(VkDescriptorSet set, bool usePoolIds) {
     return true;
 }
 
+bool isLinearDescriptorPool(VkDescriptorPool pool) {
+    return !(as_goldfish_VkDescriptorPool(pool)->allocInfo->createFlags &
+             VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
+}
+
+void rewindLinearDescriptorPool(VkDescriptorPool pool) {
+    DescriptorPoolAllocationInfo* allocInfo = as_goldfish_VkDescriptorPool(pool)->allocInfo;
+
+    allocInfo->usedSets = 0;
+    allocInfo->linearSetsUsed = 0;
+    allocInfo->hostSetsSinceReset = false;
+    for (auto& countForPool : allocInfo->descriptorCountInfo) {
+        countForPool.used = 0;
+    }
+}
+
 std::vector<VkDescriptorSet> clearDescriptorPool(VkDescriptorPool pool, bool usePoolIds) {
+    DescriptorPoolAllocationInfo* allocInfo = as_goldfish_VkDescriptorPool(pool)->allocInfo;
+
+    // Sets of linear pools are never in |allocedSets|, and hang on to their
+    // pool IDs until the pool goes away.
+    if (usePoolIds && isLinearDescriptorPool(pool)) {
+        std::vector<VkDescriptorSet> toClear;
+        toClear.swap(allocInfo->linearSets);
+        rewindLinearDescriptorPool(pool);
+        return toClear;
+    }
+
     std::vector<VkDescriptorSet> toClear;
-    for (auto set : as_goldfish_VkDescriptorPool(pool)->allocInfo->allocedSets) {
+    for (auto set : allocInfo->allocedSets) {
         toClear.push_back(set);
     }
 
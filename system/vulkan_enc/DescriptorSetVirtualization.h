@@ -48,6 +48,11 @@ struct DescriptorWrite {
     };
 
     std::vector<uint8_t> inlineUniformBlockBuffer;
+
+    // Only used for committed writes: the host handles the write referred
+    // to when it was sent, in case the guest handles are destroyed and
+    // their addresses reused since.
+    uint64_t committedHostHandles[2];
 };
 
 using DescriptorWriteTable = std::vector<std::vector<DescriptorWrite>>;
@@ -68,6 +73,11 @@ struct ReifiedDescriptorSet {
     // Indexed first by binding number
     DescriptorWriteTable allWrites;
 
+    // Indexed first by binding number. What the host was last sent for each
+    // descriptor, so that rewriting a descriptor with the same contents does
+    // not go out again.
+    DescriptorWriteTable committedWrites;
+
     // Indexed first by binding number
     DescriptorWriteDstArrayRangeTable pendingWriteArrayRanges;
 
@@ -89,6 +99,16 @@ struct DescriptorPoolAllocationInfo {
     uint32_t maxSets;
     uint32_t usedSets;
 
+    // Pools that cannot free individual sets hand out their pool IDs in
+    // order and only get them back all at once. The set made for each ID
+    // is kept across resets and handed out again, so resetting such a pool
+    // just rewinds |linearSetsUsed|.
+    std::vector<VkDescriptorSet> linearSets;
+    uint32_t linearSetsUsed;
+    // Whether a set allocated since the last reset was realized on the
+    // host. If not, the host pool is already empty.
+    bool hostSetsSinceReset;
+
     // Fine-grained tracking of descriptor counts in individual pools
     struct DescriptorCountInfo {
         VkDescriptorType type;
@@ -113,6 +133,12 @@ bool isDescriptorTypeBufferView(VkDescriptorType descType);
 bool isDescriptorTypeInlineUniformBlock(VkDescriptorType descType);
 bool isDescriptorTypeAccelerationStructure(VkDescriptorType descType);
 
+// True if sending |pending| would leave the host descriptor as |committed|
+// left it.
+bool descriptorWriteMatchesCommitted(const DescriptorWrite& pending, const DescriptorWrite& committed);
+// Records |write| as what the host now has for the descriptor.
+void recordCommittedDescriptorWrite(const DescriptorWrite& write, DescriptorWrite* committed);
+
 void doEmulatedDescriptorWrite(const VkWriteDescriptorSet* write, ReifiedDescriptorSet* toWrite);
 void doEmulatedDescriptorCopy(const VkCopyDescriptorSet* copy, const ReifiedDescriptorSet* src, ReifiedDescriptorSet* dst);
 
@@ -147,7 +173,16 @@ void doEmulatedDescriptorInlineUniformBlockFromTemplate(VkDescriptorType descTyp
 
 void applyDescriptorSetAllocation(VkDescriptorPool pool, VkDescriptorSetLayout setLayout);
 void fillDescriptorSetInfoForPool(VkDescriptorPool pool, VkDescriptorSetLayout setLayout, VkDescriptorSet set);
-VkResult validateAndApplyVirtualDescriptorSetAllocation(const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pSets);
+// For pools without VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, sets
+// handed out again are returned in |pSets| too, and the layouts they held
+// until now are appended to |replacedLayouts|.
+VkResult validateAndApplyVirtualDescriptorSetAllocation(const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pSets,
+                                                        std::vector<VkDescriptorSetLayout>* replacedLayouts);
+
+bool isLinearDescriptorPool(VkDescriptorPool pool);
+// Makes every set of a linear pool available again without touching the
+// sets themselves.
+void rewindLinearDescriptorPool(VkDescriptorPool pool);
 
 // Returns false if set wasn't found in its pool.
 bool removeDescriptorSetFromPool(VkDescriptorSet set, bool usePoolIds);
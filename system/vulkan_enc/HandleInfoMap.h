@@ -0,0 +1,241 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gfxstream {
+namespace vk {
+
+// Drop-in for the std::unordered_map<Handle, Info> tables that hold
+// per-handle state. Lookups probe a flat array of {handle, record}
+// slots instead of walking bucket chains, and the records themselves are
+// carved out of chunks, so references to them stay valid until the entry
+// is erased, as they do with unordered_map.
+//
+// Erasing leaves a tombstone and never moves other slots, so erasing
+// while iterating is safe; tombstones are swept when the table grows.
+template <typename K, typename V>
+class HandleInfoMap {
+   public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+
+    template <bool kConst>
+    class Iterator {
+       public:
+        using Map = typename std::conditional<kConst, const HandleInfoMap, HandleInfoMap>::type;
+        using reference = typename std::conditional<kConst, const value_type&, value_type&>::type;
+        using pointer = typename std::conditional<kConst, const value_type*, value_type*>::type;
+
+        Iterator() = default;
+        Iterator(Map* map, size_t index) : mMap(map), mIndex(index) { skipDead(); }
+        // iterator -> const_iterator.
+        template <bool kOtherConst, typename = typename std::enable_if<kConst && !kOtherConst>::type>
+        Iterator(const Iterator<kOtherConst>& other) : mMap(other.mMap), mIndex(other.mIndex) {}
+
+        reference operator*() const { return *mMap->mSlots[mIndex].node; }
+        pointer operator->() const { return mMap->mSlots[mIndex].node; }
+
+        Iterator& operator++() {
+            ++mIndex;
+            skipDead();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return mIndex == other.mIndex; }
+        bool operator!=(const Iterator& other) const { return mIndex != other.mIndex; }
+
+       private:
+        friend class HandleInfoMap;
+        template <bool>
+        friend class Iterator;
+
+        void skipDead() {
+            while (mIndex < mMap->mSlots.size() && !isLive(mMap->mSlots[mIndex].node)) {
+                ++mIndex;
+            }
+        }
+
+        Map* mMap = nullptr;
+        size_t mIndex = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    HandleInfoMap() = default;
+    HandleInfoMap(const HandleInfoMap&) = delete;
+    HandleInfoMap& operator=(const HandleInfoMap&) = delete;
+    ~HandleInfoMap() { clear(); }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, mSlots.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, mSlots.size()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    size_t size() const { return mSize; }
+    bool empty() const { return mSize == 0; }
+
+    iterator find(K key) { return iterator(this, findIndex(key)); }
+    const_iterator find(K key) const { return const_iterator(this, findIndex(key)); }
+    size_t count(K key) const { return findIndex(key) != mSlots.size() ? 1 : 0; }
+
+    V& operator[](K key) {
+        size_t index = findIndex(key);
+        if (index != mSlots.size()) return mSlots[index].node->second;
+
+        if ((mSize + mTombstones + 1) * 4 > mSlots.size() * 3) {
+            rehash();
+        }
+        index = probeForInsert(key);
+        if (mSlots[index].node == tombstone()) --mTombstones;
+        value_type* node = new (allocateNode())
+            value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+        mSlots[index] = {key, node};
+        ++mSize;
+        return node->second;
+    }
+
+    iterator erase(const_iterator it) {
+        Slot& slot = mSlots[it.mIndex];
+        releaseNode(slot.node);
+        slot.node = tombstone();
+        --mSize;
+        ++mTombstones;
+        return iterator(this, it.mIndex + 1);
+    }
+    iterator erase(iterator it) { return erase(const_iterator(it)); }
+
+    size_t erase(K key) {
+        size_t index = findIndex(key);
+        if (index == mSlots.size()) return 0;
+        erase(const_iterator(this, index));
+        return 1;
+    }
+
+    void clear() {
+        for (Slot& slot : mSlots) {
+            if (isLive(slot.node)) releaseNode(slot.node);
+            slot.node = nullptr;
+        }
+        mSize = 0;
+        mTombstones = 0;
+    }
+
+   private:
+    struct Slot {
+        K key;
+        value_type* node;
+    };
+
+    // Records are handed out from chunks of this many.
+    static constexpr size_t kChunkSize = 32;
+    static constexpr size_t kMinCapacity = 16;
+
+    struct Chunk {
+        alignas(value_type) unsigned char storage[kChunkSize][sizeof(value_type)];
+    };
+
+    static value_type* tombstone() {
+        static char sTombstone;
+        return reinterpret_cast<value_type*>(&sTombstone);
+    }
+    static bool isLive(const value_type* node) { return node && node != tombstone(); }
+
+    size_t slotFor(K key) const {
+        // Handles are heap pointers, so the low bits carry little; take
+        // the high bits of a multiplicative hash.
+        const uint64_t h = (uint64_t)(uintptr_t)key * 0x9E3779B97F4A7C15ull;
+        return (size_t)(h >> mShift);
+    }
+
+    size_t findIndex(K key) const {
+        if (mSlots.empty()) return 0;
+        const size_t mask = mSlots.size() - 1;
+        for (size_t i = slotFor(key);; i = (i + 1) & mask) {
+            const Slot& slot = mSlots[i];
+            if (!slot.node) return mSlots.size();
+            if (slot.node != tombstone() && slot.key == key) return i;
+        }
+    }
+
+    // Only called once |key| is known to be absent and there is room.
+    size_t probeForInsert(K key) const {
+        const size_t mask = mSlots.size() - 1;
+        for (size_t i = slotFor(key);; i = (i + 1) & mask) {
+            if (!isLive(mSlots[i].node)) return i;
+        }
+    }
+
+    void rehash() {
+        size_t capacity = kMinCapacity;
+        while ((mSize + 1) * 2 > capacity) capacity *= 2;
+
+        std::vector<Slot> old(capacity, Slot{K(), nullptr});
+        old.swap(mSlots);
+        mShift = 64;
+        for (size_t c = capacity; c > 1; c >>= 1) --mShift;
+        mTombstones = 0;
+
+        for (const Slot& slot : old) {
+            if (!isLive(slot.node)) continue;
+            mSlots[probeForInsert(slot.key)] = slot;
+        }
+    }
+
+    void* allocateNode() {
+        if (mFreeNodes.empty()) {
+            mChunks.emplace_back(new Chunk);
+            Chunk& chunk = *mChunks.back();
+            for (size_t i = kChunkSize; i > 0; --i) {
+                mFreeNodes.push_back(chunk.storage[i - 1]);
+            }
+        }
+        void* node = mFreeNodes.back();
+        mFreeNodes.pop_back();
+        return node;
+    }
+
+    void releaseNode(value_type* node) {
+        node->~value_type();
+        mFreeNodes.push_back(node);
+    }
+
+    std::vector<Slot> mSlots;
+    size_t mShift = 64;
+    size_t mSize = 0;
+    size_t mTombstones = 0;
+    std::vector<std::unique_ptr<Chunk>> mChunks;
+    std::vector<void*> mFreeNodes;
+};
+
+}  // namespace vk
+}  // namespace gfxstream
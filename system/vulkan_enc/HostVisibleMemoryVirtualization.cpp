@@ -36,16 +36,20 @@ bool isHostVisible(const VkPhysicalDeviceMemoryProperties* memoryProps, uint32_t
 CoherentMemory::CoherentMemory(VirtGpuBlobMappingPtr blobMapping, uint64_t size, VkDevice device,
                                VkDeviceMemory memory)
     : mSize(size), mBlobMapping(blobMapping), mDevice(device), mMemory(memory) {
-    mAllocator =
-        std::make_unique<android::base::guest::SubAllocator>(blobMapping->asRawPtr(), mSize, 4096);
+    mAllocator = std::make_unique<SubAllocator>(blobMapping->asRawPtr(), mSize, 4096,
+                                                SubAllocator::Strategy::Tlsf);
+    mMappedMemory.set(mSize);
+    initSlabs(4096);
 }
 
 CoherentMemory::CoherentMemory(GoldfishAddressSpaceBlockPtr block, uint64_t gpuAddr, uint64_t size,
                                VkDevice device, VkDeviceMemory memory)
     : mSize(size), mBlock(block), mDevice(device), mMemory(memory) {
     void* address = block->mmap(gpuAddr);
-    mAllocator =
-        std::make_unique<android::base::guest::SubAllocator>(address, mSize, kLargestPageSize);
+    mAllocator = std::make_unique<SubAllocator>(address, mSize, kLargestPageSize,
+                                                SubAllocator::Strategy::Tlsf);
+    mMappedMemory.set(mSize);
+    initSlabs(kLargestPageSize);
 }
 
 CoherentMemory::~CoherentMemory() {
@@ -56,7 +60,10 @@ CoherentMemory::~CoherentMemory() {
 VkDeviceMemory CoherentMemory::getDeviceMemory() const { return mMemory; }
 
 bool CoherentMemory::subAllocate(uint64_t size, uint8_t** ptr, uint64_t& offset) {
-    auto address = mAllocator->alloc(size);
+    void* address = slabAllocate(size);
+    if (!address) {
+        address = mAllocator->alloc(size);
+    }
     if (!address) return false;
 
     *ptr = (uint8_t*)address;
@@ -65,9 +72,87 @@ bool CoherentMemory::subAllocate(uint64_t size, uint8_t** ptr, uint64_t& offset)
 }
 
 bool CoherentMemory::release(uint8_t* ptr) {
+    if (slabRelease(ptr)) return true;
     mAllocator->free(ptr);
     return true;
 }
 
+void CoherentMemory::initSlabs(uint64_t pageSize) {
+    mPageSize = pageSize;
+    // Slabs only pay off if they hold several slots of the largest class.
+    if (kMaxSlabAllocSize * 2 > kSlabSize || pageSize > kMaxSlabAllocSize || mSize < kSlabSize * 4) {
+        return;
+    }
+    mSlabsWithSpace.resize(kMaxSlabAllocSize / pageSize + 1);
+    mHasEmptySlab.resize(mSlabsWithSpace.size(), false);
+}
+
+uint8_t* CoherentMemory::slabAllocate(uint64_t size) {
+    if (mSlabsWithSpace.empty() || !size || size > kMaxSlabAllocSize) return nullptr;
+
+    const size_t sizeClass = (size + mPageSize - 1) / mPageSize;
+    auto& withSpace = mSlabsWithSpace[sizeClass];
+
+    if (withSpace.empty()) {
+        uint8_t* base = (uint8_t*)mAllocator->alloc(kSlabSize);
+        if (!base) return nullptr;
+
+        const uint64_t slotSize = sizeClass * mPageSize;
+        Slab& slab = mSlabs[base];
+        slab.base = base;
+        slab.sizeClass = sizeClass;
+        slab.usedSlots = 0;
+        // Hand out the lowest slots first.
+        for (uint64_t slot = kSlabSize / slotSize; slot > 0; --slot) {
+            slab.freeSlots.push_back(base + (slot - 1) * slotSize);
+        }
+        withSpace.push_back(&slab);
+        mHasEmptySlab[sizeClass] = true;
+    }
+
+    Slab* slab = withSpace.back();
+    if (slab->usedSlots == 0) {
+        mHasEmptySlab[sizeClass] = false;
+    }
+    uint8_t* ptr = slab->freeSlots.back();
+    slab->freeSlots.pop_back();
+    ++slab->usedSlots;
+    if (slab->freeSlots.empty()) {
+        withSpace.pop_back();
+    }
+    return ptr;
+}
+
+bool CoherentMemory::slabRelease(uint8_t* ptr) {
+    auto it = mSlabs.upper_bound(ptr);
+    if (it == mSlabs.begin()) return false;
+    --it;
+    Slab& slab = it->second;
+    if (ptr >= slab.base + kSlabSize) return false;
+
+    auto& withSpace = mSlabsWithSpace[slab.sizeClass];
+    if (slab.freeSlots.empty()) {
+        withSpace.push_back(&slab);
+    }
+    slab.freeSlots.push_back(ptr);
+    --slab.usedSlots;
+
+    if (slab.usedSlots == 0) {
+        if (!mHasEmptySlab[slab.sizeClass]) {
+            mHasEmptySlab[slab.sizeClass] = true;
+        } else {
+            for (size_t i = 0; i < withSpace.size(); ++i) {
+                if (withSpace[i] == &slab) {
+                    withSpace.erase(withSpace.begin() + i);
+                    break;
+                }
+            }
+            mAllocator->free(slab.base);
+            mSlabs.erase(it);
+        }
+    }
+    return true;
+}
+
 }  // namespace vk
 }  // namespace gfxstream
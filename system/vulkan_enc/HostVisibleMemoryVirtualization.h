@@ -16,8 +16,12 @@
 
 #include <vulkan/vulkan.h>
 
+#include <map>
+#include <vector>
+
 #include "VirtGpu.h"
 #include "aemu/base/AndroidSubAllocator.h"
+#include "aemu/base/MemoryAccounting.h"
 #include "goldfish_address_space.h"
 
 #define ALIGN(A, B) (((A) + (B)-1) & ~((B)-1))
@@ -58,12 +62,43 @@ class CoherentMemory {
     CoherentMemory(CoherentMemory const&);
     void operator=(CoherentMemory const&);
 
+    // Allocations up to kMaxSlabAllocSize are carved out of fixed size
+    // slots in kSlabSize slabs, one size class per multiple of the page
+    // size, so that buffers allocated and freed every frame neither
+    // fragment mAllocator nor walk its free list. Callers serialize on the
+    // ResourceTracker lock, so the slabs need none of their own.
+    static constexpr uint64_t kSlabSize = 256 * 1024;
+    static constexpr uint64_t kMaxSlabAllocSize = 64 * 1024;
+
+    struct Slab {
+        uint8_t* base;
+        size_t sizeClass;
+        uint32_t usedSlots;
+        std::vector<uint8_t*> freeSlots;
+    };
+
+    void initSlabs(uint64_t pageSize);
+    uint8_t* slabAllocate(uint64_t size);
+    bool slabRelease(uint8_t* ptr);
+
     uint64_t mSize;
     VirtGpuBlobMappingPtr mBlobMapping = nullptr;
     GoldfishAddressSpaceBlockPtr mBlock = nullptr;
     VkDevice mDevice;
     VkDeviceMemory mMemory;
     SubAllocatorPtr mAllocator;
+    android::base::guest::AccountedMemory mMappedMemory{
+        android::base::guest::GraphicsMemory::kCoherentMemory};
+
+    uint64_t mPageSize = 0;
+    // Keyed by base address.
+    std::map<uint8_t*, Slab> mSlabs;
+    // Indexed by size class: slabs with at least one free slot, and
+    // whether one of them is entirely free. One empty slab per class is
+    // kept so that a class going back and forth between zero and one
+    // allocation does not allocate and free a slab each time.
+    std::vector<std::vector<Slab*>> mSlabsWithSpace;
+    std::vector<bool> mHasEmptySlab;
 };
 
 using CoherentMemoryPtr = std::shared_ptr<CoherentMemory>;
@@ -0,0 +1,374 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "PipelineDedup.h"
+
+#include <string.h>
+
+using android::base::guest::AutoLock;
+using android::base::guest::Lock;
+
+namespace gfxstream {
+namespace vk {
+
+namespace {
+
+class KeyWriter {
+   public:
+    explicit KeyWriter(std::string* out) : mOut(out) {}
+
+    template <typename T>
+    void pod(const T& value) {
+        bytes(&value, sizeof(value));
+    }
+
+    // Writes the members in [first, end), for runs of 4-byte members that
+    // have no padding between them.
+    template <typename T, typename U>
+    void members(const T* first, const U* end) {
+        bytes(first, (const uint8_t*)end - (const uint8_t*)first);
+    }
+
+    template <typename T>
+    void array(const T* values, uint32_t count) {
+        pod(count);
+        if (values) bytes(values, sizeof(T) * count);
+    }
+
+    void str(const char* s) {
+        const uint32_t len = s ? strlen(s) : 0;
+        pod(len);
+        bytes(s, len);
+    }
+
+    void bytes(const void* data, size_t size) {
+        if (size) mOut->append((const char*)data, size);
+    }
+
+   private:
+    std::string* mOut;
+};
+
+bool isSupportedStage(VkShaderStageFlagBits stage) {
+    switch (stage) {
+        case VK_SHADER_STAGE_VERTEX_BIT:
+        case VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT:
+        case VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT:
+        case VK_SHADER_STAGE_GEOMETRY_BIT:
+        case VK_SHADER_STAGE_FRAGMENT_BIT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Dynamic states that leave every pointer in the create info valid.
+// Others, such as VK_DYNAMIC_STATE_VERTEX_INPUT_EXT, let the app pass
+// dangling pointers for the state they replace.
+bool isSupportedDynamicState(VkDynamicState state) {
+    if (state <= VK_DYNAMIC_STATE_STENCIL_REFERENCE) return true;
+    switch (state) {
+        case VK_DYNAMIC_STATE_CULL_MODE:
+        case VK_DYNAMIC_STATE_FRONT_FACE:
+        case VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY:
+        case VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT:
+        case VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT:
+        case VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE:
+        case VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE:
+        case VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE:
+        case VK_DYNAMIC_STATE_DEPTH_COMPARE_OP:
+        case VK_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE:
+        case VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE:
+        case VK_DYNAMIC_STATE_STENCIL_OP:
+        case VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE:
+        case VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE:
+        case VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+// Two independent 64-bit hashes, so that telling two shader modules apart
+// does not hang on a single one.
+void hashShaderCode(const uint32_t* code, size_t size, uint64_t hash[2]) {
+    uint64_t fnv = 14695981039346656037ULL;
+    uint64_t mix = 0x9e3779b97f4a7c15ULL ^ size;
+    const size_t words = size / sizeof(uint32_t);
+    for (size_t i = 0; i < words; ++i) {
+        const uint32_t w = code[i];
+        fnv = (fnv ^ w) * 1099511628211ULL;
+        mix ^= w + 0x9e3779b97f4a7c15ULL + (mix << 6) + (mix >> 2);
+    }
+    hash[0] = fnv;
+    hash[1] = mix;
+}
+
+void GraphicsPipelineDedup::onShaderModuleCreated(VkShaderModule module,
+                                                  const VkShaderModuleCreateInfo* pCreateInfo) {
+    if (!module || !pCreateInfo || !pCreateInfo->pCode) return;
+
+    ModuleId id;
+    id.size = pCreateInfo->codeSize;
+    hashShaderCode(pCreateInfo->pCode, pCreateInfo->codeSize, id.hash);
+
+    AutoLock<Lock> lock(mLock);
+    mModules[module] = id;
+}
+
+void GraphicsPipelineDedup::onShaderModuleDestroyed(VkShaderModule module) {
+    AutoLock<Lock> lock(mLock);
+    mModules.erase(module);
+}
+
+void GraphicsPipelineDedup::onPipelineLayoutDestroyed(VkPipelineLayout layout) {
+    if (!layout) return;
+    AutoLock<Lock> lock(mLock);
+    forgetMatching(layout, VK_NULL_HANDLE);
+}
+
+void GraphicsPipelineDedup::onRenderPassDestroyed(VkRenderPass renderPass) {
+    if (!renderPass) return;
+    AutoLock<Lock> lock(mLock);
+    forgetMatching(VK_NULL_HANDLE, renderPass);
+}
+
+void GraphicsPipelineDedup::forgetMatching(VkPipelineLayout layout, VkRenderPass renderPass) {
+    for (auto& it : mEntries) {
+        Entry& entry = it.second;
+        if (entry.key.empty()) continue;
+        if ((layout && entry.layout == layout) || (renderPass && entry.renderPass == renderPass)) {
+            mPipelinesByKey.erase(entry.key);
+            entry.key.clear();
+        }
+    }
+}
+
+bool GraphicsPipelineDedup::makeKey(VkDevice device, const VkGraphicsPipelineCreateInfo& info,
+                                    std::string* key) {
+    key->clear();
+    // Derivatives, libraries and the like are left alone.
+    if (info.flags) {
+        AutoLock<Lock> lock(mLock);
+        ++mStats.uncacheable;
+        return false;
+    }
+
+    const VkPipelineRenderingCreateInfo* renderingInfo = nullptr;
+    for (auto ext = (const VkBaseInStructure*)info.pNext; ext; ext = ext->pNext) {
+        if (ext->sType != VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO || renderingInfo) {
+            AutoLock<Lock> lock(mLock);
+            ++mStats.uncacheable;
+            return false;
+        }
+        renderingInfo = (const VkPipelineRenderingCreateInfo*)ext;
+    }
+
+    bool viewportsDynamic = false;
+    bool viewportCountDynamic = false;
+    bool scissorsDynamic = false;
+    bool scissorCountDynamic = false;
+    bool hasTessellation = false;
+    bool cacheable = true;
+
+    if (info.pDynamicState) {
+        cacheable &= !info.pDynamicState->pNext;
+        for (uint32_t i = 0; i < info.pDynamicState->dynamicStateCount; ++i) {
+            const VkDynamicState state = info.pDynamicState->pDynamicStates[i];
+            cacheable &= isSupportedDynamicState(state);
+            viewportsDynamic |= state == VK_DYNAMIC_STATE_VIEWPORT ||
+                                state == VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT;
+            viewportCountDynamic |= state == VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT;
+            scissorsDynamic |= state == VK_DYNAMIC_STATE_SCISSOR ||
+                               state == VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT;
+            scissorCountDynamic |= state == VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT;
+        }
+    }
+
+    for (uint32_t i = 0; cacheable && i < info.stageCount; ++i) {
+        const VkPipelineShaderStageCreateInfo& stage = info.pStages[i];
+        cacheable &= !stage.pNext && isSupportedStage(stage.stage);
+        hasTessellation |= stage.stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT ||
+                           stage.stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+    }
+
+    auto hasNoPNext = [](const auto* state) { return !state || !state->pNext; };
+    cacheable &= hasNoPNext(info.pVertexInputState) && hasNoPNext(info.pInputAssemblyState) &&
+                 hasNoPNext(info.pViewportState) && hasNoPNext(info.pRasterizationState) &&
+                 hasNoPNext(info.pMultisampleState) && hasNoPNext(info.pDepthStencilState) &&
+                 hasNoPNext(info.pColorBlendState);
+    if (hasTessellation) cacheable &= hasNoPNext(info.pTessellationState);
+
+    AutoLock<Lock> lock(mLock);
+    if (!cacheable) {
+        ++mStats.uncacheable;
+        return false;
+    }
+
+    KeyWriter w(key);
+    w.pod(device);
+    w.pod(info.layout);
+    w.pod(info.renderPass);
+    w.pod(info.subpass);
+
+    w.pod(info.stageCount);
+    for (uint32_t i = 0; i < info.stageCount; ++i) {
+        const VkPipelineShaderStageCreateInfo& stage = info.pStages[i];
+        auto moduleIt = mModules.find(stage.module);
+        if (moduleIt == mModules.end()) {
+            key->clear();
+            ++mStats.uncacheable;
+            return false;
+        }
+        w.pod(stage.flags);
+        w.pod(stage.stage);
+        w.pod(moduleIt->second);
+        w.str(stage.pName);
+        const VkSpecializationInfo* spec = stage.pSpecializationInfo;
+        w.pod(spec != nullptr);
+        if (spec) {
+            w.array(spec->pMapEntries, spec->mapEntryCount);
+            w.pod((uint64_t)spec->dataSize);
+            w.bytes(spec->pData, spec->pData ? spec->dataSize : 0);
+        }
+    }
+
+    const VkPipelineVertexInputStateCreateInfo* vertexInput = info.pVertexInputState;
+    w.pod(vertexInput != nullptr);
+    if (vertexInput) {
+        w.pod(vertexInput->flags);
+        w.array(vertexInput->pVertexBindingDescriptions,
+                vertexInput->vertexBindingDescriptionCount);
+        w.array(vertexInput->pVertexAttributeDescriptions,
+                vertexInput->vertexAttributeDescriptionCount);
+    }
+
+    const VkPipelineInputAssemblyStateCreateInfo* inputAssembly = info.pInputAssemblyState;
+    w.pod(inputAssembly != nullptr);
+    if (inputAssembly) {
+        w.members(&inputAssembly->flags, &inputAssembly->primitiveRestartEnable + 1);
+    }
+
+    const VkPipelineTessellationStateCreateInfo* tessellation =
+        hasTessellation ? info.pTessellationState : nullptr;
+    w.pod(tessellation != nullptr);
+    if (tessellation) {
+        w.members(&tessellation->flags, &tessellation->patchControlPoints + 1);
+    }
+
+    const VkPipelineViewportStateCreateInfo* viewport = info.pViewportState;
+    w.pod(viewport != nullptr);
+    if (viewport) {
+        w.pod(viewport->flags);
+        w.pod(viewportCountDynamic ? 0 : viewport->viewportCount);
+        if (!viewportsDynamic) w.array(viewport->pViewports, viewport->viewportCount);
+        w.pod(scissorCountDynamic ? 0 : viewport->scissorCount);
+        if (!scissorsDynamic) w.array(viewport->pScissors, viewport->scissorCount);
+    }
+
+    const VkPipelineRasterizationStateCreateInfo* rasterization = info.pRasterizationState;
+    w.pod(rasterization != nullptr);
+    if (rasterization) {
+        w.members(&rasterization->flags, &rasterization->lineWidth + 1);
+    }
+
+    const VkPipelineMultisampleStateCreateInfo* multisample = info.pMultisampleState;
+    w.pod(multisample != nullptr);
+    if (multisample) {
+        w.pod(multisample->flags);
+        w.pod(multisample->rasterizationSamples);
+        w.pod(multisample->sampleShadingEnable);
+        w.pod(multisample->minSampleShading);
+        w.array(multisample->pSampleMask, (multisample->rasterizationSamples + 31) / 32);
+        w.pod(multisample->pSampleMask != nullptr);
+        w.pod(multisample->alphaToCoverageEnable);
+        w.pod(multisample->alphaToOneEnable);
+    }
+
+    const VkPipelineDepthStencilStateCreateInfo* depthStencil = info.pDepthStencilState;
+    w.pod(depthStencil != nullptr);
+    if (depthStencil) {
+        w.members(&depthStencil->flags, &depthStencil->maxDepthBounds + 1);
+    }
+
+    const VkPipelineColorBlendStateCreateInfo* colorBlend = info.pColorBlendState;
+    w.pod(colorBlend != nullptr);
+    if (colorBlend) {
+        w.pod(colorBlend->flags);
+        w.pod(colorBlend->logicOpEnable);
+        w.pod(colorBlend->logicOp);
+        w.array(colorBlend->pAttachments, colorBlend->attachmentCount);
+        w.pod(colorBlend->blendConstants);
+    }
+
+    const VkPipelineDynamicStateCreateInfo* dynamicState = info.pDynamicState;
+    w.pod(dynamicState != nullptr);
+    if (dynamicState) {
+        w.pod(dynamicState->flags);
+        w.array(dynamicState->pDynamicStates, dynamicState->dynamicStateCount);
+    }
+
+    w.pod(renderingInfo != nullptr);
+    if (renderingInfo) {
+        w.pod(renderingInfo->viewMask);
+        w.array(renderingInfo->pColorAttachmentFormats, renderingInfo->colorAttachmentCount);
+        w.pod(renderingInfo->depthAttachmentFormat);
+        w.pod(renderingInfo->stencilAttachmentFormat);
+    }
+
+    return true;
+}
+
+VkPipeline GraphicsPipelineDedup::acquire(const std::string& key) {
+    AutoLock<Lock> lock(mLock);
+    auto it = mPipelinesByKey.find(key);
+    if (it == mPipelinesByKey.end()) {
+        ++mStats.misses;
+        return VK_NULL_HANDLE;
+    }
+    ++mEntries[it->second].refs;
+    ++mStats.hits;
+    return it->second;
+}
+
+void GraphicsPipelineDedup::insert(const std::string& key, VkPipeline pipeline,
+                                   VkPipelineLayout layout, VkRenderPass renderPass) {
+    AutoLock<Lock> lock(mLock);
+    // Another thread may have created the same pipeline meanwhile; keep
+    // theirs for matching, and let this one live and die on its own.
+    if (!mPipelinesByKey.emplace(key, pipeline).second) return;
+    mEntries[pipeline] = {key, 1, layout, renderPass};
+}
+
+bool GraphicsPipelineDedup::release(VkPipeline pipeline) {
+    AutoLock<Lock> lock(mLock);
+    auto it = mEntries.find(pipeline);
+    if (it == mEntries.end()) return true;
+
+    Entry& entry = it->second;
+    if (--entry.refs) return false;
+
+    if (!entry.key.empty()) mPipelinesByKey.erase(entry.key);
+    mEntries.erase(it);
+    return true;
+}
+
+GraphicsPipelineDedup::Stats GraphicsPipelineDedup::stats() const {
+    AutoLock<Lock> lock(mLock);
+    return mStats;
+}
+
+}  // namespace vk
+}  // namespace gfxstream
@@ -0,0 +1,89 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <string>
+#include <unordered_map>
+
+#include "aemu/base/synchronization/AndroidLock.h"
+
+namespace gfxstream {
+namespace vk {
+
+// 128-bit content hash of SPIR-V, as two independent 64-bit halves.
+void hashShaderCode(const uint32_t* code, size_t size, uint64_t hash[2]);
+
+// Hands out an existing graphics pipeline when the app asks for one that
+// is identical to a pipeline it already has, instead of another host
+// compile. Pipelines are keyed by a serialization of their create info in
+// which shader modules stand for their SPIR-V, and other handles stand for
+// themselves; pipelines whose create info holds anything that cannot be
+// compared this way are never shared. A shared pipeline is reference
+// counted and only destroyed on the host once every create that returned
+// it has been matched by a destroy.
+class GraphicsPipelineDedup {
+   public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t uncacheable = 0;
+    };
+
+    void onShaderModuleCreated(VkShaderModule module, const VkShaderModuleCreateInfo* pCreateInfo);
+    void onShaderModuleDestroyed(VkShaderModule module);
+    // A new object may reuse the handle of a destroyed one, so pipelines
+    // created against it can no longer be matched.
+    void onPipelineLayoutDestroyed(VkPipelineLayout layout);
+    void onRenderPassDestroyed(VkRenderPass renderPass);
+
+    // Fills |key| and returns true if |info| can be shared.
+    bool makeKey(VkDevice device, const VkGraphicsPipelineCreateInfo& info, std::string* key);
+
+    // Returns the pipeline created for |key|, with a new reference, or
+    // VK_NULL_HANDLE.
+    VkPipeline acquire(const std::string& key);
+    void insert(const std::string& key, VkPipeline pipeline, VkPipelineLayout layout,
+                VkRenderPass renderPass);
+    // Drops a reference and returns true if the pipeline should now be
+    // destroyed on the host.
+    bool release(VkPipeline pipeline);
+
+    Stats stats() const;
+
+   private:
+    struct ModuleId {
+        uint64_t hash[2];
+        uint64_t size;
+    };
+
+    struct Entry {
+        std::string key;
+        uint32_t refs;
+        VkPipelineLayout layout;
+        VkRenderPass renderPass;
+    };
+
+    void forgetMatching(VkPipelineLayout layout, VkRenderPass renderPass);
+
+    mutable android::base::guest::Lock mLock;
+    std::unordered_map<VkShaderModule, ModuleId> mModules;
+    std::unordered_map<std::string, VkPipeline> mPipelinesByKey;
+    std::unordered_map<VkPipeline, Entry> mEntries;
+    Stats mStats;
+};
+
+}  // namespace vk
+}  // namespace gfxstream
@@ -0,0 +1,72 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "QueueSubmitWorker.h"
+
+#include <utility>
+
+#include "aemu/base/threads/AndroidThreadPolicy.h"
+
+using android::base::guest::AutoLock;
+using android::base::guest::Lock;
+
+namespace gfxstream {
+namespace vk {
+
+QueueSubmitWorker::QueueSubmitWorker() : mThread([this] { threadMain(); }) {
+    mThread.start();
+}
+
+QueueSubmitWorker::~QueueSubmitWorker() {
+    AutoLock<Lock> lock(mLock);
+    mExiting = true;
+    mCv.broadcastAndUnlock(&lock);
+    mThread.wait();
+}
+
+void QueueSubmitWorker::enqueue(Task task) {
+    AutoLock<Lock> lock(mLock);
+    mTasks.push_back(std::move(task));
+    mCv.broadcastAndUnlock(&lock);
+}
+
+uint64_t QueueSubmitWorker::waitIdle() {
+    AutoLock<Lock> lock(mLock);
+    mCv.wait(&lock, [this] { return mTasks.empty() && !mRunning; });
+    return mCompleted;
+}
+
+void QueueSubmitWorker::threadMain() {
+    android::base::guest::applyThreadPolicy(android::base::guest::ThreadRole::VulkanSubmit);
+
+    AutoLock<Lock> lock(mLock);
+    while (true) {
+        mCv.wait(&lock, [this] { return !mTasks.empty() || mExiting; });
+        if (mTasks.empty()) return;
+
+        Task task = std::move(mTasks.front());
+        mTasks.pop_front();
+        mRunning = true;
+        lock.unlock();
+
+        task();
+
+        lock.lock();
+        ++mCompleted;
+        mRunning = false;
+        if (mTasks.empty()) mCv.broadcast();
+    }
+}
+
+}  // namespace vk
+}  // namespace gfxstream
@@ -0,0 +1,57 @@
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <deque>
+#include <functional>
+
+#include "aemu/base/synchronization/AndroidConditionVariable.h"
+#include "aemu/base/synchronization/AndroidLock.h"
+#include "aemu/base/threads/AndroidFunctorThread.h"
+
+namespace gfxstream {
+namespace vk {
+
+// A thread that runs the submits of one VkQueue, in the order they were
+// queued, so that encoding and flushing them happens off the thread that
+// called vkQueueSubmit. Tasks run on the worker's own thread, and so with
+// its own thread-local encoder.
+class QueueSubmitWorker {
+   public:
+    using Task = std::function<void()>;
+
+    QueueSubmitWorker();
+    // Runs whatever is still queued before returning.
+    ~QueueSubmitWorker();
+
+    void enqueue(Task task);
+
+    // Blocks until every task queued so far has run, and returns how many
+    // tasks have run since the worker started.
+    uint64_t waitIdle();
+
+   private:
+    void threadMain();
+
+    android::base::guest::Lock mLock;
+    android::base::guest::ConditionVariable mCv;
+    std::deque<Task> mTasks;
+    uint64_t mCompleted = 0;
+    bool mRunning = false;
+    bool mExiting = false;
+    android::base::guest::FunctorThread mThread;
+};
+
+}  // namespace vk
+}  // namespace gfxstream
@@ -18,10 +18,15 @@
 #include "../OpenglSystemCommon/EmulatorFeatureInfo.h"
 #include "../OpenglSystemCommon/HostConnection.h"
 #include "CommandBufferStagingStream.h"
+#include "CommandBufferStateShadow.h"
 #include "DescriptorSetVirtualization.h"
+#include "HandleInfoMap.h"
+#include "QueueSubmitWorker.h"
 #include "Resources.h"
+#include "aemu/base/MemoryAccounting.h"
 #include "aemu/base/Optional.h"
 #include "aemu/base/Tracing.h"
+#include "aemu/base/containers/SmallVector.h"
 #include "aemu/base/threads/AndroidWorkPool.h"
 #include "goldfish_vk_private_defs.h"
 #include "vulkan/vulkan_core.h"
@@ -86,6 +91,7 @@ void zx_event_create(int, zx_handle_t*) { }
 #include "virtgpu_gfxstream_protocol.h"
 
 #include "goldfish_address_space.h"
+#include "goldfish_vk_marshaling_guest.h"
 #include "goldfish_vk_private_defs.h"
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 #include "vk_format_info.h"
@@ -93,11 +99,16 @@ void zx_event_create(int, zx_handle_t*) { }
 #include "vk_struct_id.h"
 #include "vk_util.h"
 
+#include <algorithm>
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 
+#include <cutils/properties.h>
 #include <vndk/hardware_buffer.h>
 #include <log/log.h>
 #include <stdlib.h>
@@ -105,7 +116,9 @@ void zx_event_create(int, zx_handle_t*) { }
 
 #if defined(__ANDROID__) || defined(__linux__) || defined(__APPLE__)
 
+#include <poll.h>
 #include <sys/mman.h>
+#include <time.h>
 #include <unistd.h>
 #include <sys/syscall.h>
 
@@ -139,9 +152,11 @@ inline_memfd_create(const char *name, unsigned int flags) {
 #endif
 
 using android::base::Optional;
+using android::base::SmallFixedVector;
 using android::base::guest::AutoLock;
 using android::base::guest::RecursiveLock;
 using android::base::guest::Lock;
+using android::base::guest::LockStats;
 using android::base::guest::WorkPool;
 
 namespace gfxstream {
@@ -206,12 +221,20 @@ struct StagingInfo {
     /// \brief sets alloc and free callbacks for memory allocation for CommandBufferStagingStream(s)
     /// \param allocFn is the callback to allocate memory
     /// \param freeFn is the callback to free memory
+    ///
+    /// Only the first call has an effect: streams keep references to the
+    /// callbacks, and they only depend on host features that never change.
     void setAllocFree(CommandBufferStagingStream::Alloc&& allocFn,
                       CommandBufferStagingStream::Free&& freeFn) {
+        AutoLock<Lock> lock(mLock);
+        if (mAllocFreeSet) return;
         mAlloc = allocFn;
         mFree = freeFn;
+        __atomic_store_n(&mAllocFreeSet, true, __ATOMIC_RELEASE);
     }
 
+    bool allocFreeSet() const { return __atomic_load_n(&mAllocFreeSet, __ATOMIC_ACQUIRE); }
+
     ~StagingInfo() {
         for (auto stream : streams) {
             delete stream;
@@ -223,13 +246,20 @@ struct StagingInfo {
     }
 
     void pushStaging(CommandBufferStagingStream* stream, VkEncoder* encoder) {
-        AutoLock<Lock> lock(mLock);
         stream->reset();
+        // the stream is shared by every pool; hand its chunks back to the
+        // one it recorded for
+        stream->setArena(nullptr);
+        if (sThreadStaging.push(stream, encoder)) return;
+
+        AutoLock<Lock> lock(mLock);
         streams.push_back(stream);
         encoders.push_back(encoder);
     }
 
     void popStaging(CommandBufferStagingStream** streamOut, VkEncoder** encoderOut) {
+        if (sThreadStaging.pop(streamOut, encoderOut)) return;
+
         AutoLock<Lock> lock(mLock);
         CommandBufferStagingStream* stream;
         VkEncoder* encoder;
@@ -252,11 +282,166 @@ struct StagingInfo {
     }
 
    private:
+    // Streams and encoders recently released on this thread. Threads that
+    // record in parallel mostly reuse their own, so beginning and resetting
+    // command buffers does not contend on mLock.
+    struct ThreadStaging {
+        static constexpr size_t kMaxCached = 32;
+        std::vector<CommandBufferStagingStream*> streams;
+        std::vector<VkEncoder*> encoders;
+
+        bool push(CommandBufferStagingStream* stream, VkEncoder* encoder);
+        bool pop(CommandBufferStagingStream** streamOut, VkEncoder** encoderOut) {
+            if (streams.empty()) return false;
+            *streamOut = streams.back();
+            *encoderOut = encoders.back();
+            streams.pop_back();
+            encoders.pop_back();
+            return true;
+        }
+        // gives whatever is left to the shared pool when the thread exits
+        ~ThreadStaging();
+    };
+    static thread_local ThreadStaging sThreadStaging;
+
     CommandBufferStagingStream::Alloc mAlloc = nullptr;
     CommandBufferStagingStream::Free mFree = nullptr;
+    bool mAllocFreeSet = false;
 };
 
 static StagingInfo sStaging;
+thread_local StagingInfo::ThreadStaging StagingInfo::sThreadStaging;
+
+bool StagingInfo::ThreadStaging::push(CommandBufferStagingStream* stream, VkEncoder* encoder) {
+    if (streams.size() >= kMaxCached) return false;
+    streams.push_back(stream);
+    encoders.push_back(encoder);
+    return true;
+}
+
+StagingInfo::ThreadStaging::~ThreadStaging() {
+    AutoLock<Lock> lock(sStaging.mLock);
+    sStaging.streams.insert(sStaging.streams.end(), streams.begin(), streams.end());
+    sStaging.encoders.insert(sStaging.encoders.end(), encoders.begin(), encoders.end());
+}
+
+// Copy of the mapping of each VkDeviceMemory, for the range checks and the
+// host sync filtering done on every vkFlushMappedMemoryRanges /
+// vkInvalidateMappedMemoryRanges. It is split
+// into shards with their own locks so those do not contend with each other
+// or with the global lock held by everything else. Updated wherever
+// VkDeviceMemory_Info::ptr or allocationSize change, with mLock held.
+class MappedMemoryTable {
+public:
+    struct Mapping {
+        uint8_t* ptr = nullptr;
+        VkDeviceSize size = 0;
+        // Directly mapped host pages of a HOST_COHERENT memory type, which
+        // need no host flush or invalidate.
+        bool hostCoherent = false;
+    };
+
+    void set(VkDeviceMemory memory, uint8_t* ptr, VkDeviceSize size, bool hostCoherent) {
+        Shard& shard = shardFor(memory);
+        AutoLock<Lock> lock(shard.lock);
+        shard.mappings[memory] = {ptr, size, hostCoherent};
+    }
+
+    void erase(VkDeviceMemory memory) {
+        Shard& shard = shardFor(memory);
+        AutoLock<Lock> lock(shard.lock);
+        shard.mappings.erase(memory);
+    }
+
+    bool get(VkDeviceMemory memory, Mapping* out) {
+        Shard& shard = shardFor(memory);
+        AutoLock<Lock> lock(shard.lock);
+        auto it = shard.mappings.find(memory);
+        if (it == shard.mappings.end()) return false;
+        *out = it->second;
+        return true;
+    }
+
+private:
+    static constexpr size_t kShardCount = 16;
+
+    struct Shard {
+        Lock lock;
+        std::unordered_map<VkDeviceMemory, Mapping> mappings;
+    };
+
+    Shard& shardFor(VkDeviceMemory memory) {
+        // Handles are heap pointers; the low bits carry no information.
+        return mShards[((uint64_t)(uintptr_t)memory >> 4) % kShardCount];
+    }
+
+    Shard mShards[kShardCount];
+};
+
+static MappedMemoryTable sMappedMemory;
+
+// Engines written for desktop drivers record many barriers that do nothing,
+// and every one of them is encoded, decoded and replayed on the host. The
+// helpers below only drop or merge what is redundant within one
+// vkCmdPipelineBarrier: the execution dependency comes from the stage masks
+// of the command, not from its barriers, so a barrier that neither makes
+// memory available or visible, nor transitions a layout, nor transfers
+// ownership adds nothing to it. Barriers with a pNext chain are kept as they
+// are. Merged barriers cover exactly what the originals covered.
+
+static bool isNoOpMemoryBarrier(const VkMemoryBarrier& barrier) {
+    return !barrier.pNext && !barrier.srcAccessMask && !barrier.dstAccessMask;
+}
+
+static bool isNoOpBufferBarrier(const VkBufferMemoryBarrier& barrier) {
+    return !barrier.pNext && !barrier.srcAccessMask && !barrier.dstAccessMask &&
+           barrier.srcQueueFamilyIndex == barrier.dstQueueFamilyIndex;
+}
+
+static bool isNoOpImageBarrier(const VkImageMemoryBarrier& barrier) {
+    return !barrier.pNext && !barrier.srcAccessMask && !barrier.dstAccessMask &&
+           barrier.oldLayout == barrier.newLayout &&
+           barrier.srcQueueFamilyIndex == barrier.dstQueueFamilyIndex;
+}
+
+static bool sameImageBarrier(const VkImageMemoryBarrier& a, const VkImageMemoryBarrier& b) {
+    return !a.pNext && !b.pNext && a.image == b.image && a.srcAccessMask == b.srcAccessMask &&
+           a.dstAccessMask == b.dstAccessMask && a.oldLayout == b.oldLayout &&
+           a.newLayout == b.newLayout && a.srcQueueFamilyIndex == b.srcQueueFamilyIndex &&
+           a.dstQueueFamilyIndex == b.dstQueueFamilyIndex &&
+           a.subresourceRange.aspectMask == b.subresourceRange.aspectMask &&
+           a.subresourceRange.baseMipLevel == b.subresourceRange.baseMipLevel &&
+           a.subresourceRange.levelCount == b.subresourceRange.levelCount &&
+           a.subresourceRange.baseArrayLayer == b.subresourceRange.baseArrayLayer &&
+           a.subresourceRange.layerCount == b.subresourceRange.layerCount;
+}
+
+// Merges |b| into |a| if both are the same barrier on overlapping or
+// adjacent ranges of one buffer.
+static bool mergeBufferBarrier(VkBufferMemoryBarrier* a, const VkBufferMemoryBarrier& b) {
+    if (a->pNext || b.pNext || a->buffer != b.buffer || a->srcAccessMask != b.srcAccessMask ||
+        a->dstAccessMask != b.dstAccessMask || a->srcQueueFamilyIndex != b.srcQueueFamilyIndex ||
+        a->dstQueueFamilyIndex != b.dstQueueFamilyIndex) {
+        return false;
+    }
+    if (a->size == VK_WHOLE_SIZE || b.size == VK_WHOLE_SIZE) {
+        if ((a->size == VK_WHOLE_SIZE && b.offset < a->offset) ||
+            (b.size == VK_WHOLE_SIZE && a->offset < b.offset &&
+             a->offset + a->size < b.offset)) {
+            return false;
+        }
+        if (b.offset < a->offset) a->offset = b.offset;
+        a->size = VK_WHOLE_SIZE;
+        return true;
+    }
+    const VkDeviceSize aEnd = a->offset + a->size;
+    const VkDeviceSize bEnd = b.offset + b.size;
+    if (b.offset > aEnd || a->offset > bEnd) return false;
+    const VkDeviceSize offset = a->offset < b.offset ? a->offset : b.offset;
+    a->size = (aEnd > bEnd ? aEnd : bEnd) - offset;
+    a->offset = offset;
+    return true;
+}
 
 class ResourceTracker::Impl {
 public:
@@ -280,6 +465,25 @@ public:
         std::vector<VkPhysicalDevice> physicalDevices;
     };
 
+    // Host objects handed out again for create infos that are the same
+    // byte for byte, which the spec allows for non-dispatchable handles.
+    // Each creation is still destroyed once, so they are refcounted.
+    struct SharedHostObjects {
+        struct Entry {
+            uint64_t handle;
+            uint32_t refs;
+        };
+        std::map<std::vector<uint8_t>, Entry> byKey;
+        std::unordered_map<uint64_t, std::vector<uint8_t>> keyByHandle;
+    };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    struct ImageFormatSysmemConstraints {
+        VkResult result;
+        fuchsia_sysmem::wire::ImageFormatConstraints constraints;
+    };
+#endif
+
     struct VkDevice_Info {
         VkPhysicalDevice physdev;
         VkPhysicalDeviceProperties props;
@@ -287,6 +491,34 @@ public:
         uint32_t apiVersion;
         std::set<std::string> enabledExtensions;
         std::vector<std::pair<PFN_vkDeviceMemoryReportCallbackEXT, void *>> deviceMemoryReportCallbacks;
+        // {hash[0], hash[1], codeSize} of SPIR-V uploaded to the host's
+        // shader code cache.
+        std::set<std::tuple<uint64_t, uint64_t, uint64_t>> knownShaderCode;
+        // Host handles reserved with vkReserveHandlesGOOGLE and not yet
+        // given to an object.
+        std::vector<uint64_t> reservedHandles;
+        SharedHostObjects samplers;
+        SharedHostObjects ycbcrConversions;
+        // Shared host memory blocks whose suballocations have all been
+        // freed, with their memory type, oldest first. They are kept for
+        // the next allocations, as freeing one is a synchronous host call.
+        std::vector<std::pair<uint32_t, CoherentMemoryPtr>> parkedCoherentMemory;
+        // Base memory requirements from the host, for hosts without
+        // vkCreate*WithRequirementsGOOGLE, where every object would
+        // otherwise take a round trip to ask. Images created alike get the
+        // same requirements, and so do buffers of the same size and class:
+        // same flags, usage, sharing mode and external handle types. Sizes
+        // the host has not answered for are always asked, as the spec does
+        // not say how the size follows from the create size.
+        std::map<std::vector<uint64_t>, VkMemoryRequirements> imageRequirements;
+        std::map<std::vector<uint64_t>, std::map<VkDeviceSize, VkMemoryRequirements>>
+            bufferRequirements;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        // What each format candidate and tiling came to in
+        // addImageBufferCollectionConstraintsFUCHSIA, which takes several
+        // host round trips and is asked again for every swapchain.
+        std::map<std::vector<uint64_t>, ImageFormatSysmemConstraints> imageFormatSysmemConstraints;
+#endif
     };
 
     struct VkDeviceMemory_Info {
@@ -317,6 +549,10 @@ public:
 
     struct VkQueue_Info {
         VkDevice device;
+        // Submit thread tasks that had run when the host was last made to
+        // wait for them, and the encoder whose stream it held back.
+        uint64_t submitTasksSynced = 0;
+        VkEncoder* submitTasksSyncedFor = nullptr;
     };
 
     // custom guest-side structs for images/buffers because of AHardwareBuffer :((
@@ -330,6 +566,9 @@ public:
         VkDeviceSize currentBackingSize = 0;
         bool baseRequirementsKnown = false;
         VkMemoryRequirements baseRequirements;
+        // Key into VkDevice_Info::imageRequirements, or empty if nothing
+        // the requirements depend on was left out of it.
+        std::vector<uint64_t> requirementsKey;
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
         bool hasExternalFormat = false;
         unsigned androidFormat = 0;
@@ -350,6 +589,8 @@ public:
         VkDeviceSize currentBackingSize = 0;
         bool baseRequirementsKnown = false;
         VkMemoryRequirements baseRequirements;
+        // Key into VkDevice_Info::bufferRequirements, or empty.
+        std::vector<uint64_t> requirementsClass;
 #ifdef VK_USE_PLATFORM_FUCHSIA
         bool isSysmemBackedMemory = false;
 #endif
@@ -360,11 +601,32 @@ public:
         zx_handle_t eventHandle = ZX_HANDLE_INVALID;
         zx_koid_t eventKoid = ZX_KOID_INVALID;
         std::optional<int> syncFd = {};
+        // Timeline semaphores the guest alone signals. The counter is at
+        // least |knownValue|, and nothing queued so far can take it past
+        // |pendingValue|, so once the two meet it is known exactly.
+        bool trackedTimeline = false;
+        uint64_t knownValue = 0;
+        uint64_t pendingValue = 0;
+    };
+
+    // One template entry, worked out at creation so that an update only
+    // copies the user data into the staging arrays below.
+    struct DescriptorUpdateTemplateGather {
+        VkDescriptorType descriptorType;
+        uint32_t dstBinding;
+        uint32_t dstArrayElement;
+        uint32_t descriptorCount;
+        size_t srcOffset;
+        size_t srcStride;
+        // Copies of |copySize| bytes; one for an inline uniform block,
+        // whose descriptorCount is its size in bytes.
+        uint32_t copyCount;
+        uint32_t copySize;
+        uint8_t* dst;
     };
 
     struct VkDescriptorUpdateTemplate_Info {
-        uint32_t templateEntryCount = 0;
-        VkDescriptorUpdateTemplateEntry* templateEntries;
+        std::vector<DescriptorUpdateTemplateGather> gathers;
 
         uint32_t imageInfoCount = 0;
         uint32_t bufferInfoCount = 0;
@@ -377,7 +639,6 @@ public:
         VkDescriptorBufferInfo* bufferInfos;
         VkBufferView* bufferViews;
         std::vector<uint8_t> inlineUniformBlockBuffer;
-        std::vector<uint32_t> inlineUniformBlockBytesPerBlocks;  // bytes per uniform block
     };
 
     struct VkFence_Info {
@@ -387,6 +648,12 @@ public:
 #if defined(VK_USE_PLATFORM_ANDROID_KHR) || defined(__linux__)
         int syncFd = -1;
 #endif
+        // A fence only goes back to unsignaled when the app resets or
+        // reimports it, so once the host has reported it signaled, status
+        // queries can be answered here until then. |resetCount| lets a
+        // result from the host be dropped if a reset raced with it.
+        bool knownSignaled = false;
+        uint32_t resetCount = 0;
     };
 
     struct VkDescriptorPool_Info {
@@ -423,7 +690,7 @@ public:
     };
 
 #define HANDLE_REGISTER_IMPL_IMPL(type) \
-    std::unordered_map<type, type##_Info> info_##type; \
+    HandleInfoMap<type, type##_Info> info_##type; \
     void register_##type(type obj) { \
         AutoLock<RecursiveLock> lock(mLock); \
         info_##type[obj] = type##_Info(); \
@@ -463,6 +730,13 @@ public:
 
         clearCommandPool(pool);
 
+        // every command buffer has been reset above, so no chunks are out
+        struct goldfish_VkCommandPool* p = as_goldfish_VkCommandPool(pool);
+        if (p && p->userPtr) {
+            delete (CommandBufferStagingArena*)p->userPtr;
+            p->userPtr = nullptr;
+        }
+
         AutoLock<RecursiveLock> lock(mLock);
         info_VkCommandPool.erase(pool);
     }
@@ -491,6 +765,7 @@ public:
             CommandBufferPendingDescriptorSets* pendingSets = (CommandBufferPendingDescriptorSets*)cb->userPtr;
             delete pendingSets;
         }
+        delete cb->stateShadow;
 
         AutoLock<RecursiveLock> lock(mLock);
         info_VkCommandBuffer.erase(commandBuffer);
@@ -501,7 +776,15 @@ public:
         if (!q) return;
         if (q->lastUsedEncoder) { q->lastUsedEncoder->decRef(); }
 
+        // Joined once the lock is dropped.
+        std::shared_ptr<QueueSubmitWorker> worker;
+
         AutoLock<RecursiveLock> lock(mLock);
+        auto workerIt = mQueueSubmitWorkers.find(queue);
+        if (workerIt != mQueueSubmitWorkers.end()) {
+            worker = std::move(workerIt->second);
+            mQueueSubmitWorkers.erase(workerIt);
+        }
         info_VkQueue.erase(queue);
     }
 
@@ -524,6 +807,7 @@ public:
         }
 
         info_VkDeviceMemory.erase(mem);
+        sMappedMemory.erase(mem);
     }
 
     void unregister_VkImage(VkImage img) {
@@ -575,7 +859,6 @@ public:
             return;
 
         auto& info = it->second;
-        if (info.templateEntryCount) delete [] info.templateEntries;
         if (info.imageInfoCount) {
             delete [] info.imageInfoIndices;
             delete [] info.imageInfos;
@@ -645,7 +928,9 @@ public:
 
         if (mFeatureInfo->hasVulkanBatchedDescriptorSetUpdate) {
             // Using the pool ID's we collected earlier from the host
-            VkResult poolAllocResult = validateAndApplyVirtualDescriptorSetAllocation(ci, sets);
+            std::vector<VkDescriptorSetLayout> replacedLayouts;
+            VkResult poolAllocResult =
+                validateAndApplyVirtualDescriptorSetAllocation(ci, sets, &replacedLayouts);
 
             if (poolAllocResult != VK_SUCCESS) return poolAllocResult;
 
@@ -659,6 +944,12 @@ public:
                 struct goldfish_VkDescriptorSetLayout* dsl = as_goldfish_VkDescriptorSetLayout(setLayout);
                 ++dsl->layoutInfo->refcount;
             }
+
+            // Sets handed out again by a linear pool drop what they held
+            // before the pool was last reset.
+            for (auto setLayout : replacedLayouts) {
+                decDescriptorSetLayoutRef(context, device, setLayout, nullptr);
+            }
         } else {
             // Pass through and use host allocation
             VkEncoder* enc = (VkEncoder*)context;
@@ -864,6 +1155,7 @@ public:
 #endif
         info.imported = imported;
         info.vmoHandle = vmoHandle;
+        updateMappedMemoryLocked(memory, info);
     }
 
     void setImageInfo(VkImage image,
@@ -876,6 +1168,21 @@ public:
         info.createInfo = *pCreateInfo;
     }
 
+    void updateMappedMemoryLocked(VkDeviceMemory memory, const VkDeviceMemory_Info& info) {
+        sMappedMemory.set(memory, info.ptr, info.allocationSize, isHostCoherentLocked(info));
+    }
+
+    // Whether |info| maps the host's pages of a HOST_COHERENT memory type.
+    bool isHostCoherentLocked(const VkDeviceMemory_Info& info) const {
+        if (!info.coherentMemory) return false;
+        auto it = info_VkDevice.find(info.device);
+        if (it == info_VkDevice.end()) return false;
+        const VkPhysicalDeviceMemoryProperties& memProps = it->second.memProps;
+        if (info.memoryTypeIndex >= memProps.memoryTypeCount) return false;
+        return memProps.memoryTypes[info.memoryTypeIndex].propertyFlags &
+               VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    }
+
     uint8_t* getMappedPointer(VkDeviceMemory memory) {
         AutoLock<RecursiveLock> lock(mLock);
         const auto it = info_VkDeviceMemory.find(memory);
@@ -895,21 +1202,23 @@ public:
     }
 
     bool isValidMemoryRange(const VkMappedMemoryRange& range) const {
-        AutoLock<RecursiveLock> lock(mLock);
-        const auto it = info_VkDeviceMemory.find(range.memory);
-        if (it == info_VkDeviceMemory.end()) return false;
-        const auto& info = it->second;
+        MappedMemoryTable::Mapping mapping;
+        if (!sMappedMemory.get(range.memory, &mapping)) return false;
+        return isValidMemoryRange(range, mapping);
+    }
 
-        if (!info.ptr) return false;
+    static bool isValidMemoryRange(const VkMappedMemoryRange& range,
+                                   const MappedMemoryTable::Mapping& mapping) {
+        if (!mapping.ptr) return false;
 
         VkDeviceSize offset = range.offset;
         VkDeviceSize size = range.size;
 
         if (size == VK_WHOLE_SIZE) {
-            return offset <= info.allocationSize;
+            return offset <= mapping.size;
         }
 
-        return offset + size <= info.allocationSize;
+        return offset + size <= mapping.size;
     }
 
     void setupCaps(void) {
@@ -977,6 +1286,21 @@ public:
         if (mFeatureInfo->hasVulkanQueueSubmitWithCommands) {
             ResourceTracker::streamFeatureBits |= VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
         }
+
+        char inlineProp[PROPERTY_VALUE_MAX];
+        if (property_get("qemu.vk.inline_secondaries", inlineProp, nullptr) > 0) {
+            mInlineSecondaryCommandBuffers = atoi(inlineProp) > 0;
+        }
+
+        // Submits can only be handed to another thread's encoder when they
+        // carry their command buffers and need no reply.
+        if (mFeatureInfo->hasVulkanQueueSubmitWithCommands &&
+            mFeatureInfo->hasVulkanAsyncQueueSubmit) {
+            char submitThreadProp[PROPERTY_VALUE_MAX];
+            if (property_get("qemu.vk.queue_submit_thread", submitThreadProp, nullptr) > 0) {
+                mQueueSubmitThreads = atoi(submitThreadProp) > 0;
+            }
+        }
     }
 
     void setThreadingCallbacks(const ResourceTracker::ThreadingCallbacks& callbacks) {
@@ -1566,12 +1890,132 @@ public:
         *out = getPhysicalDeviceMemoryProperties(context, VK_NULL_HANDLE, physicalDevice);
     }
 
-    void on_vkGetPhysicalDeviceMemoryProperties2(
-        void*,
+    void on_vkGetPhysicalDeviceMemoryProperties2_common(
+        bool isKhr,
+        void* context,
         VkPhysicalDevice physdev,
         VkPhysicalDeviceMemoryProperties2* out) {
+        // Extension structs such as the memory budget change as memory is
+        // used, so only the core properties come from the cache.
+        if (out->pNext) {
+            VkEncoder* enc = (VkEncoder*)context;
+            if (isKhr) {
+                enc->vkGetPhysicalDeviceMemoryProperties2KHR(physdev, out, true /* do lock */);
+            } else {
+                enc->vkGetPhysicalDeviceMemoryProperties2(physdev, out, true /* do lock */);
+            }
+            return;
+        }
+        on_vkGetPhysicalDeviceMemoryProperties(context, physdev, &out->memoryProperties);
+    }
+
+    void getPhysicalDeviceProperties(
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceProperties* out) {
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            const auto& cache = mPhysicalDeviceInfoCaches[physicalDevice];
+            if (cache.properties) {
+                *out = *cache.properties;
+                return;
+            }
+        }
+
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkGetPhysicalDeviceProperties(physicalDevice, out, true /* do lock */);
+
+        AutoLock<RecursiveLock> lock(mLock);
+        mPhysicalDeviceInfoCaches[physicalDevice].properties = *out;
+    }
+
+    void getPhysicalDeviceProperties2(
+        bool isKhr,
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceProperties2* out) {
+        // Extension structs are rare enough in these queries that they
+        // always go to the host rather than being copied into the cache.
+        if (out->pNext) {
+            VkEncoder* enc = (VkEncoder*)context;
+            if (isKhr) {
+                enc->vkGetPhysicalDeviceProperties2KHR(physicalDevice, out, true /* do lock */);
+            } else {
+                enc->vkGetPhysicalDeviceProperties2(physicalDevice, out, true /* do lock */);
+            }
+            return;
+        }
+        getPhysicalDeviceProperties(context, physicalDevice, &out->properties);
+    }
+
+    void getPhysicalDeviceFeatures(
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceFeatures* out) {
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            const auto& cache = mPhysicalDeviceInfoCaches[physicalDevice];
+            if (cache.features) {
+                *out = *cache.features;
+                return;
+            }
+        }
+
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkGetPhysicalDeviceFeatures(physicalDevice, out, true /* do lock */);
+
+        AutoLock<RecursiveLock> lock(mLock);
+        mPhysicalDeviceInfoCaches[physicalDevice].features = *out;
+    }
+
+    void getPhysicalDeviceFeatures2(
+        bool isKhr,
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceFeatures2* out) {
+        if (out->pNext) {
+            VkEncoder* enc = (VkEncoder*)context;
+            if (isKhr) {
+                enc->vkGetPhysicalDeviceFeatures2KHR(physicalDevice, out, true /* do lock */);
+            } else {
+                enc->vkGetPhysicalDeviceFeatures2(physicalDevice, out, true /* do lock */);
+            }
+            return;
+        }
+        getPhysicalDeviceFeatures(context, physicalDevice, &out->features);
+    }
+
+    VkResult getPhysicalDeviceImageFormatProperties(
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkFormat format,
+        VkImageType type,
+        VkImageTiling tiling,
+        VkImageUsageFlags usage,
+        VkImageCreateFlags flags,
+        VkImageFormatProperties* out) {
+        const ImageFormatQuery query = { format, type, tiling, usage, flags };
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            const auto& imageFormats = mPhysicalDeviceInfoCaches[physicalDevice].imageFormats;
+            auto it = imageFormats.find(query);
+            if (it != imageFormats.end()) {
+                *out = it->second.properties;
+                return it->second.result;
+            }
+        }
+
+        VkEncoder* enc = (VkEncoder*)context;
+        VkResult res = enc->vkGetPhysicalDeviceImageFormatProperties(
+            physicalDevice, format, type, tiling, usage, flags, out, true /* do lock */);
 
-        on_vkGetPhysicalDeviceMemoryProperties(nullptr, physdev, &out->memoryProperties);
+        // Running out of memory or losing the device says nothing about
+        // the format, so only the answers that do are kept.
+        if (res == VK_SUCCESS || res == VK_ERROR_FORMAT_NOT_SUPPORTED) {
+            AutoLock<RecursiveLock> lock(mLock);
+            mPhysicalDeviceInfoCaches[physicalDevice].imageFormats[query] = { res, *out };
+        }
+        return res;
     }
 
     void on_vkGetDeviceQueue(void*,
@@ -1645,7 +2089,8 @@ public:
         VkDevice device,
         const VkAllocationCallbacks*) {
 
-        (void)context;
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
         AutoLock<RecursiveLock> lock(mLock);
 
         auto it = info_VkDevice.find(device);
@@ -1654,11 +2099,19 @@ public:
         for (auto itr = info_VkDeviceMemory.cbegin() ; itr != info_VkDeviceMemory.cend(); ) {
             auto& memInfo = itr->second;
             if (memInfo.device == device) {
+                sMappedMemory.erase(itr->first);
                 itr = info_VkDeviceMemory.erase(itr);
             } else {
                 itr++;
             }
         }
+
+        // Freed with the encoder, so outside the lock, before the device
+        // goes.
+        auto parked = std::move(it->second.parkedCoherentMemory);
+        it->second.parkedCoherentMemory.clear();
+        lock.unlock();
+        parked.clear();
     }
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
@@ -2308,6 +2761,10 @@ public:
             enc, device, collection, &imageConstraints);
     }
 
+    // Swapchains are recreated with the same few format candidates, so the
+    // outcome for each is kept per device. Host support does not change.
+    static constexpr size_t kMaxImageFormatSysmemConstraints = 64;
+
     VkResult addImageBufferCollectionConstraintsFUCHSIA(
         VkEncoder* enc,
         VkDevice device,
@@ -2316,6 +2773,71 @@ public:
             formatConstraints,  // always non-zero
         VkImageTiling tiling,
         fuchsia_sysmem::wire::BufferCollectionConstraints* constraints) {
+        // Everything getImageFormatSysmemConstraintsFUCHSIA reads.
+        const VkImageCreateInfo* createInfo = &formatConstraints->imageCreateInfo;
+        std::vector<uint64_t> key = {
+            tiling,
+            createInfo->flags,
+            createInfo->imageType,
+            createInfo->format,
+            createInfo->extent.width,
+            createInfo->extent.height,
+            createInfo->extent.depth,
+            createInfo->mipLevels,
+            createInfo->arrayLayers,
+            createInfo->samples,
+            createInfo->usage,
+            formatConstraints->requiredFormatFeatures,
+            formatConstraints->sysmemPixelFormat,
+        };
+        for (uint32_t i = 0; i < formatConstraints->colorSpaceCount; i++) {
+            key.push_back(formatConstraints->pColorSpaces[i].colorSpace);
+        }
+
+        ImageFormatSysmemConstraints entry;
+        bool known = false;
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            auto deviceIt = info_VkDevice.find(device);
+            if (deviceIt != info_VkDevice.end()) {
+                auto it = deviceIt->second.imageFormatSysmemConstraints.find(key);
+                if (it != deviceIt->second.imageFormatSysmemConstraints.end()) {
+                    entry = it->second;
+                    known = true;
+                }
+            }
+        }
+
+        if (!known) {
+            entry.result = getImageFormatSysmemConstraintsFUCHSIA(
+                enc, device, physicalDevice, formatConstraints, tiling,
+                &entry.constraints);
+            AutoLock<RecursiveLock> lock(mLock);
+            auto deviceIt = info_VkDevice.find(device);
+            if (deviceIt != info_VkDevice.end()) {
+                auto& cache = deviceIt->second.imageFormatSysmemConstraints;
+                if (cache.size() >= kMaxImageFormatSysmemConstraints) {
+                    cache.clear();
+                }
+                cache[std::move(key)] = entry;
+            }
+        }
+
+        if (entry.result != VK_SUCCESS) {
+            return entry.result;
+        }
+        constraints->image_format_constraints
+            [constraints->image_format_constraints_count++] = entry.constraints;
+        return VK_SUCCESS;
+    }
+
+    VkResult getImageFormatSysmemConstraintsFUCHSIA(
+        VkEncoder* enc,
+        VkDevice device,
+        VkPhysicalDevice physicalDevice,
+        const VkImageFormatConstraintsInfoFUCHSIA* formatConstraints,
+        VkImageTiling tiling,
+        fuchsia_sysmem::wire::ImageFormatConstraints* out) {
         // First check if the format, tiling and usage is supported on host.
         VkImageFormatProperties imageFormatProperties;
         auto createInfo = &formatConstraints->imageCreateInfo;
@@ -2432,8 +2954,7 @@ public:
                 ? fuchsia_sysmem::wire::kFormatModifierLinear
                 : fuchsia_sysmem::wire::kFormatModifierGoogleGoldfishOptimal;
 
-        constraints->image_format_constraints
-            [constraints->image_format_constraints_count++] = imageConstraints;
+        *out = imageConstraints;
         return VK_SUCCESS;
     }
 
@@ -3105,8 +3626,8 @@ public:
 
         VkDeviceMemory mem = VK_NULL_HANDLE;
         VkResult host_res =
-        enc->vkAllocateMemory(device, &hostAllocationInfo, nullptr,
-                              &mem, true /* do lock */);
+        enc->encodeAllocateMemory(device, &hostAllocationInfo, nullptr,
+                                  &mem, true /* do lock */);
         if(host_res != VK_SUCCESS) {
             return host_res;
         }
@@ -3124,7 +3645,10 @@ public:
             auto coherentMemory = std::make_shared<CoherentMemory>(
                 mapping, hostAllocationInfo.allocationSize, device, mem);
 
-            coherentMemory->subAllocate(pAllocateInfo->allocationSize, &ptr, offset);
+            // Dropping |coherentMemory| frees |mem|.
+            if (!coherentMemory->subAllocate(pAllocateInfo->allocationSize, &ptr, offset)) {
+                return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+            }
             info.coherentMemoryOffset = offset;
             info.coherentMemory = coherentMemory;
             info.ptr = ptr;
@@ -3139,6 +3663,7 @@ public:
             // information. set it before use.
             AutoLock<RecursiveLock> lock(mLock);
             info_VkDeviceMemory[mem] = info;
+            updateMappedMemoryLocked(mem, info);
         }
 
         if (mCaps.gfxstreamCapset.deferredMapping || mCaps.params[kParamCreateGuestHandle]) {
@@ -3149,18 +3674,28 @@ public:
         auto coherentMemory = createCoherentMemory(device, mem, hostAllocationInfo, enc, host_res);
         if(coherentMemory) {
             AutoLock<RecursiveLock> lock(mLock);
-            coherentMemory->subAllocate(pAllocateInfo->allocationSize, &ptr, offset);
+            if (!coherentMemory->subAllocate(pAllocateInfo->allocationSize, &ptr, offset)) {
+                info_VkDeviceMemory.erase(mem);
+                sMappedMemory.erase(mem);
+                // Dropping |coherentMemory| frees |mem|, which calls into
+                // VkEncoder and so has to happen without the lock.
+                lock.unlock();
+                coherentMemory = nullptr;
+                return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+            }
             info.allocationSize = pAllocateInfo->allocationSize;
             info.coherentMemoryOffset = offset;
             info.coherentMemory = coherentMemory;
             info.ptr = ptr;
             info_VkDeviceMemory[mem] = info;
+            updateMappedMemoryLocked(mem, info);
             *pMemory = mem;
         }
         else {
             enc->vkFreeMemory(device, mem, nullptr, true);
             AutoLock<RecursiveLock> lock(mLock);
             info_VkDeviceMemory.erase(mem);
+            sMappedMemory.erase(mem);
         }
         return host_res;
     }
@@ -3202,6 +3737,18 @@ public:
                 coherentMemory = info.coherentMemory;
                 break;
             }
+            auto deviceIt = info_VkDevice.find(device);
+            if (!coherentMemory && !dedicated && deviceIt != info_VkDevice.end()) {
+                auto& parked = deviceIt->second.parkedCoherentMemory;
+                for (auto it = parked.begin(); it != parked.end(); ++it) {
+                    if (it->first != pAllocateInfo->memoryTypeIndex) continue;
+                    if (!it->second->subAllocate(pAllocateInfo->allocationSize, &ptr, offset))
+                        continue;
+                    coherentMemory = std::move(it->second);
+                    parked.erase(it);
+                    break;
+                }
+            }
             if (coherentMemory) {
                 struct VkDeviceMemory_Info info;
                 info.coherentMemoryOffset = offset;
@@ -3216,6 +3763,7 @@ public:
                 // CoherentMemory
                 auto mem = new_from_host_VkDeviceMemory(VK_NULL_HANDLE);
                 info_VkDeviceMemory[mem] = info;
+                updateMappedMemoryLocked(mem, info);
                 *pMemory = mem;
                 return VK_SUCCESS;
             }
@@ -3482,9 +4030,9 @@ public:
 
         if (ahw) {
             D("%s: Import AHardwareBuffer", __func__);
-            const uint32_t hostHandle =
-                ResourceTracker::threadingCallbacks.hostConnectionGetFunc()->grallocHelper()
-                    ->getHostHandle(AHardwareBuffer_getNativeHandle(ahw));
+            const uint32_t hostHandle = getAndroidHardwareBufferHostHandle(
+                ResourceTracker::threadingCallbacks.hostConnectionGetFunc()->grallocHelper(),
+                ahw);
 
             AHardwareBuffer_Desc ahbDesc = {};
             AHardwareBuffer_describe(ahw, &ahbDesc);
@@ -3822,7 +4370,7 @@ public:
 
         if (ahw || !requestedMemoryIsHostVisible) {
             input_result =
-                enc->vkAllocateMemory(
+                enc->encodeAllocateMemory(
                     device, &finalAllocInfo, pAllocator, pMemory, true /* do lock */);
 
             if (input_result != VK_SUCCESS) {
@@ -3843,7 +4391,7 @@ public:
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
         if (vmo_handle != ZX_HANDLE_INVALID) {
-            input_result = enc->vkAllocateMemory(device, &finalAllocInfo, pAllocator, pMemory, true /* do lock */);
+            input_result = enc->encodeAllocateMemory(device, &finalAllocInfo, pAllocator, pMemory, true /* do lock */);
 
             // Get VMO handle rights, and only use allowed rights to map the
             // host memory.
@@ -3885,8 +4433,11 @@ public:
         _RETURN_SCUCCESS_WITH_DEVICE_MEMORY_REPORT;
     }
 
+    // Empty shared blocks kept per device; the rest are freed.
+    static constexpr size_t kMaxParkedCoherentMemory = 2;
+
     CoherentMemoryPtr freeCoherentMemoryLocked(VkDeviceMemory memory, VkDeviceMemory_Info& info) {
-        if (info.coherentMemory && info.ptr) {
+        if (info.coherentMemory) {
             if (info.coherentMemory->getDeviceMemory() != memory) {
                 delete_goldfish_VkDeviceMemory(memory);
             }
@@ -3894,6 +4445,7 @@ public:
             if (info.ptr) {
                 info.coherentMemory->release(info.ptr);
                 info.ptr = nullptr;
+                updateMappedMemoryLocked(memory, info);
             }
 
             return std::move(info.coherentMemory);
@@ -3934,6 +4486,7 @@ public:
                 ALOGE("%s: Cannot unmap ptr: status %d", status);
             }
             info.ptr = nullptr;
+            updateMappedMemoryLocked(memory, info);
         }
 #endif
 
@@ -3944,8 +4497,24 @@ public:
             return;
         }
 
+        const bool shared = !info.dedicated;
+        const uint32_t memoryTypeIndex = info.memoryTypeIndex;
         auto coherentMemory = freeCoherentMemoryLocked(memory, info);
 
+        // A shared block that just became empty is parked rather than
+        // freed, so that freeing and allocating a lot, as between levels,
+        // does not go to the host for every block.
+        auto deviceIt = info_VkDevice.find(device);
+        if (shared && coherentMemory && coherentMemory.use_count() == 1 &&
+            deviceIt != info_VkDevice.end()) {
+            auto& parked = deviceIt->second.parkedCoherentMemory;
+            parked.emplace_back(memoryTypeIndex, std::move(coherentMemory));
+            if (parked.size() > kMaxParkedCoherentMemory) {
+                coherentMemory = std::move(parked.front().second);
+                parked.erase(parked.begin());
+            }
+        }
+
         // We have to release the lock before we could possibly free a
         // CoherentMemory, because that will call into VkEncoder, which
         // shouldn't be called when the lock is held.
@@ -4001,11 +4570,18 @@ public:
             auto coherentMemory =
                 std::make_shared<CoherentMemory>(mapping, createBlob.size, device, memory);
 
-            coherentMemory->subAllocate(info.allocationSize, &ptr, offset);
+            if (!coherentMemory->subAllocate(info.allocationSize, &ptr, offset)) {
+                ALOGE("%s: could not place the allocation in its mapping\n", __func__);
+                // |coherentMemory| owns |memory| from now on, and frees it
+                // in on_vkFreeMemory.
+                info.coherentMemory = coherentMemory;
+                return VK_ERROR_MEMORY_MAP_FAILED;
+            }
 
             info.coherentMemoryOffset = offset;
             info.coherentMemory = coherentMemory;
             info.ptr = ptr;
+            updateMappedMemoryLocked(memory, info);
         }
 
         if (!info.ptr) {
@@ -4035,6 +4611,101 @@ public:
         // no-op
     }
 
+    // Merges ranges of the same memory that overlap or touch. Apps that
+    // flush a ring buffer piece by piece then cost one host flush per
+    // allocation, and the union of valid ranges is still valid.
+    static void coalesceMappedMemoryRanges(std::vector<VkMappedMemoryRange>* ranges) {
+        for (const VkMappedMemoryRange& range : *ranges) {
+            if (range.pNext) return;
+        }
+        std::sort(ranges->begin(), ranges->end(),
+                  [](const VkMappedMemoryRange& a, const VkMappedMemoryRange& b) {
+                      if (a.memory != b.memory) {
+                          return (uint64_t)(uintptr_t)a.memory < (uint64_t)(uintptr_t)b.memory;
+                      }
+                      return a.offset < b.offset;
+                  });
+        size_t last = 0;
+        for (size_t i = 1; i < ranges->size(); ++i) {
+            VkMappedMemoryRange& merged = (*ranges)[last];
+            const VkMappedMemoryRange& range = (*ranges)[i];
+            if (range.memory != merged.memory ||
+                (merged.size != VK_WHOLE_SIZE && range.offset > merged.offset + merged.size)) {
+                (*ranges)[++last] = range;
+                continue;
+            }
+            if (merged.size == VK_WHOLE_SIZE) continue;
+            if (range.size == VK_WHOLE_SIZE) {
+                merged.size = VK_WHOLE_SIZE;
+            } else {
+                merged.size =
+                    std::max(merged.offset + merged.size, range.offset + range.size) - merged.offset;
+            }
+        }
+        ranges->resize(last + 1);
+    }
+
+    // Checks the ranges as Validation does and picks out the ones the host
+    // has to flush or invalidate, merged where possible. Ranges of directly
+    // mapped HOST_COHERENT memory need neither: the guest is writing the
+    // host's pages. Points |pHostRanges| at the ranges left, either
+    // |pMemoryRanges| itself or the contents of |ranges|, and sets
+    // |pHostRangeCount| to how many there are. Only the per-memory mapping
+    // table is read, so flushes do not take mLock.
+    VkResult getHostSyncRanges(uint32_t memoryRangeCount,
+                               const VkMappedMemoryRange* pMemoryRanges,
+                               std::vector<VkMappedMemoryRange>* ranges,
+                               const VkMappedMemoryRange** pHostRanges,
+                               uint32_t* pHostRangeCount) const {
+        for (uint32_t i = 0; i < memoryRangeCount; ++i) {
+            MappedMemoryTable::Mapping mapping;
+            if (!sMappedMemory.get(pMemoryRanges[i].memory, &mapping) ||
+                !isValidMemoryRange(pMemoryRanges[i], mapping)) {
+                return VK_ERROR_OUT_OF_HOST_MEMORY;
+            }
+            if (!mapping.hostCoherent) {
+                ranges->push_back(pMemoryRanges[i]);
+            }
+        }
+        if (ranges->size() > 1) coalesceMappedMemoryRanges(ranges);
+
+        if (ranges->size() == memoryRangeCount) {
+            *pHostRanges = pMemoryRanges;
+            *pHostRangeCount = memoryRangeCount;
+        } else {
+            *pHostRanges = ranges->data();
+            *pHostRangeCount = (uint32_t)ranges->size();
+        }
+        return VK_SUCCESS;
+    }
+
+    VkResult on_vkFlushMappedMemoryRanges(void* context, VkResult, VkDevice device,
+                                          uint32_t memoryRangeCount,
+                                          const VkMappedMemoryRange* pMemoryRanges) {
+        VkEncoder* enc = (VkEncoder*)context;
+        std::vector<VkMappedMemoryRange> ranges;
+        const VkMappedMemoryRange* hostRanges;
+        uint32_t count;
+        VkResult res =
+            getHostSyncRanges(memoryRangeCount, pMemoryRanges, &ranges, &hostRanges, &count);
+        if (res != VK_SUCCESS || !count) return res;
+        return enc->vkFlushMappedMemoryRanges(device, count, hostRanges, true /* do lock */);
+    }
+
+    VkResult on_vkInvalidateMappedMemoryRanges(void* context, VkResult, VkDevice device,
+                                               uint32_t memoryRangeCount,
+                                               const VkMappedMemoryRange* pMemoryRanges) {
+        VkEncoder* enc = (VkEncoder*)context;
+        std::vector<VkMappedMemoryRange> ranges;
+        const VkMappedMemoryRange* hostRanges;
+        uint32_t count;
+        VkResult res =
+            getHostSyncRanges(memoryRangeCount, pMemoryRanges, &ranges, &hostRanges, &count);
+        if (res != VK_SUCCESS || !count) return res;
+        return enc->vkInvalidateMappedMemoryRanges(device, count, hostRanges,
+                                                   true /* do lock */);
+    }
+
     void transformExternalResourceMemoryDedicatedRequirementsForGuest(
         VkMemoryDedicatedRequirements* dedicatedReqs) {
         dedicatedReqs->prefersDedicatedAllocation = VK_TRUE;
@@ -4076,6 +4747,25 @@ public:
             dedicatedReqs);
     }
 
+    // Queries without extension structs, on objects that are not external,
+    // get nothing the base requirements do not have, so they can take the
+    // memoized path.
+    bool isImageRequirementsQueryPlain(const VkImageMemoryRequirementsInfo2* pInfo,
+                                       const VkMemoryRequirements2* reqs2) {
+        if (pInfo->pNext || reqs2->pNext) return false;
+        AutoLock<RecursiveLock> lock(mLock);
+        auto it = info_VkImage.find(pInfo->image);
+        return it != info_VkImage.end() && !it->second.external;
+    }
+
+    bool isBufferRequirementsQueryPlain(const VkBufferMemoryRequirementsInfo2* pInfo,
+                                        const VkMemoryRequirements2* reqs2) {
+        if (pInfo->pNext || reqs2->pNext) return false;
+        AutoLock<RecursiveLock> lock(mLock);
+        auto it = info_VkBuffer.find(pInfo->buffer);
+        return it != info_VkBuffer.end() && !it->second.external;
+    }
+
     void transformBufferMemoryRequirements2ForGuest(
         VkBuffer buffer,
         VkMemoryRequirements2* reqs2) {
@@ -4265,7 +4955,7 @@ public:
         if (supportsCreateResourcesWithRequirements()) {
             res = enc->vkCreateImageWithRequirementsGOOGLE(device, &localCreateInfo, pAllocator, pImage, &memReqs, true /* do lock */);
         } else {
-            res = enc->vkCreateImage(device, &localCreateInfo, pAllocator, pImage, true /* do lock */);
+            res = enc->encodeCreateImage(device, &localCreateInfo, pAllocator, pImage, true /* do lock */);
         }
 
         if (res != VK_SUCCESS) return res;
@@ -4297,6 +4987,40 @@ public:
             info.externalCreateInfo = *extImgCiPtr;
         }
 
+        bool memoizable = !supportsCreateResourcesWithRequirements() &&
+                          !(localCreateInfo.flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) &&
+                          localCreateInfo.tiling != VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT;
+        // Extension structs other than the external memory one, such as a
+        // format list or separate stencil usage, can change the requirements
+        // and are not part of the key.
+        for (const VkBaseInStructure* ext = (const VkBaseInStructure*)pCreateInfo->pNext;
+             ext && memoizable; ext = ext->pNext) {
+            memoizable = ext->sType == VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+        }
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        memoizable = memoizable && !anbInfoPtr && !info.hasExternalFormat;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        memoizable = memoizable && !isSysmemBackedMemory;
+#endif
+        if (memoizable) {
+            info.requirementsKey = {
+                localCreateInfo.flags,
+                (uint64_t)localCreateInfo.imageType,
+                (uint64_t)localCreateInfo.format,
+                localCreateInfo.extent.width,
+                localCreateInfo.extent.height,
+                localCreateInfo.extent.depth,
+                localCreateInfo.mipLevels,
+                localCreateInfo.arrayLayers,
+                (uint64_t)localCreateInfo.samples,
+                (uint64_t)localCreateInfo.tiling,
+                localCreateInfo.usage,
+                (uint64_t)localCreateInfo.sharingMode,
+                extImgCiPtr ? extImgCiPtr->handleTypes : 0u,
+            };
+        }
+
 #ifdef VK_USE_PLATFORM_FUCHSIA
         if (isSysmemBackedMemory) {
             info.isSysmemBackedMemory = true;
@@ -4324,6 +5048,92 @@ public:
         return res;
     }
 
+    // Returns in |handle| an object created before from |key|, with a
+    // reference added for the caller.
+    bool acquireSharedHostObject(VkDevice device, SharedHostObjects VkDevice_Info::*objects,
+                                 const std::vector<uint8_t>& key, uint64_t* handle) {
+        if (key.empty()) return false;
+
+        AutoLock<RecursiveLock> lock(mLock);
+        auto deviceIt = info_VkDevice.find(device);
+        if (deviceIt == info_VkDevice.end()) return false;
+        SharedHostObjects& shared = deviceIt->second.*objects;
+        auto it = shared.byKey.find(key);
+        if (it == shared.byKey.end()) return false;
+        ++it->second.refs;
+        *handle = it->second.handle;
+        return true;
+    }
+
+    void addSharedHostObject(VkDevice device, SharedHostObjects VkDevice_Info::*objects,
+                             std::vector<uint8_t> key, uint64_t handle) {
+        if (key.empty() || !handle) return;
+
+        AutoLock<RecursiveLock> lock(mLock);
+        auto deviceIt = info_VkDevice.find(device);
+        if (deviceIt == info_VkDevice.end()) return;
+        SharedHostObjects& shared = deviceIt->second.*objects;
+        // Another thread may have created the same one meanwhile; this
+        // one then stays unshared.
+        if (shared.byKey.count(key)) return;
+        shared.keyByHandle[handle] = key;
+        shared.byKey[std::move(key)] = { handle, 1 };
+    }
+
+    // Drops a reference, and returns whether the host object has to be
+    // destroyed.
+    bool releaseSharedHostObject(VkDevice device, SharedHostObjects VkDevice_Info::*objects,
+                                 uint64_t handle) {
+        AutoLock<RecursiveLock> lock(mLock);
+        auto deviceIt = info_VkDevice.find(device);
+        if (deviceIt == info_VkDevice.end()) return true;
+        SharedHostObjects& shared = deviceIt->second.*objects;
+        auto keyIt = shared.keyByHandle.find(handle);
+        if (keyIt == shared.keyByHandle.end()) return true;
+        auto it = shared.byKey.find(keyIt->second);
+        if (--it->second.refs) return false;
+        shared.byKey.erase(it);
+        shared.keyByHandle.erase(keyIt);
+        return true;
+    }
+
+    static std::vector<uint8_t> ycbcrConversionKey(const VkSamplerYcbcrConversionCreateInfo& info) {
+        const uint8_t* begin = (const uint8_t*)&info.format;
+        const uint8_t* end =
+            (const uint8_t*)&info.forceExplicitReconstruction + sizeof(VkBool32);
+        return std::vector<uint8_t>(begin, end);
+    }
+
+    // Empty if |info| chains anything that is not part of the key.
+    static std::vector<uint8_t> samplerKey(const VkSamplerCreateInfo& info) {
+        const uint8_t* begin = (const uint8_t*)&info.flags;
+        const uint8_t* end = (const uint8_t*)&info.unnormalizedCoordinates + sizeof(VkBool32);
+        std::vector<uint8_t> key(begin, end);
+        auto append = [&key](const void* data, size_t size) {
+            key.insert(key.end(), (const uint8_t*)data, (const uint8_t*)data + size);
+        };
+        for (const VkBaseInStructure* ext = (const VkBaseInStructure*)info.pNext; ext;
+             ext = ext->pNext) {
+            append(&ext->sType, sizeof(ext->sType));
+            switch (ext->sType) {
+                case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO: {
+                    const auto* conversion = (const VkSamplerYcbcrConversionInfo*)ext;
+                    append(&conversion->conversion, sizeof(conversion->conversion));
+                    break;
+                }
+                case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT: {
+                    const auto* border = (const VkSamplerCustomBorderColorCreateInfoEXT*)ext;
+                    append(&border->customBorderColor, sizeof(border->customBorderColor));
+                    append(&border->format, sizeof(border->format));
+                    break;
+                }
+                default:
+                    return std::vector<uint8_t>();
+            }
+        }
+        return key;
+    }
+
     VkResult on_vkCreateSamplerYcbcrConversion(
         void* context, VkResult,
         VkDevice device,
@@ -4352,6 +5162,13 @@ public:
         }
 #endif
 
+        const std::vector<uint8_t> key = ycbcrConversionKey(localCreateInfo);
+        uint64_t shared;
+        if (acquireSharedHostObject(device, &VkDevice_Info::ycbcrConversions, key, &shared)) {
+            *pYcbcrConversion = (VkSamplerYcbcrConversion)shared;
+            return VK_SUCCESS;
+        }
+
         VkEncoder* enc = (VkEncoder*)context;
         VkResult res = enc->vkCreateSamplerYcbcrConversion(
             device, &localCreateInfo, pAllocator, pYcbcrConversion, true /* do lock */);
@@ -4360,6 +5177,10 @@ public:
             ALOGE("FATAL: vkCreateSamplerYcbcrConversion returned a reserved value (VK_YCBCR_CONVERSION_DO_NOTHING)");
             abort();
         }
+        if (res == VK_SUCCESS) {
+            addSharedHostObject(device, &VkDevice_Info::ycbcrConversions, key,
+                                (uint64_t)*pYcbcrConversion);
+        }
         return res;
     }
 
@@ -4369,7 +5190,9 @@ public:
         VkSamplerYcbcrConversion ycbcrConversion,
         const VkAllocationCallbacks* pAllocator) {
         VkEncoder* enc = (VkEncoder*)context;
-        if (ycbcrConversion != VK_YCBCR_CONVERSION_DO_NOTHING) {
+        if (ycbcrConversion != VK_YCBCR_CONVERSION_DO_NOTHING &&
+            releaseSharedHostObject(device, &VkDevice_Info::ycbcrConversions,
+                                    (uint64_t)ycbcrConversion)) {
             enc->vkDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator, true /* do lock */);
         }
     }
@@ -4402,6 +5225,13 @@ public:
         }
 #endif
 
+        const std::vector<uint8_t> key = ycbcrConversionKey(localCreateInfo);
+        uint64_t shared;
+        if (acquireSharedHostObject(device, &VkDevice_Info::ycbcrConversions, key, &shared)) {
+            *pYcbcrConversion = (VkSamplerYcbcrConversion)shared;
+            return VK_SUCCESS;
+        }
+
         VkEncoder* enc = (VkEncoder*)context;
         VkResult res = enc->vkCreateSamplerYcbcrConversionKHR(
             device, &localCreateInfo, pAllocator, pYcbcrConversion, true /* do lock */);
@@ -4410,6 +5240,10 @@ public:
             ALOGE("FATAL: vkCreateSamplerYcbcrConversionKHR returned a reserved value (VK_YCBCR_CONVERSION_DO_NOTHING)");
             abort();
         }
+        if (res == VK_SUCCESS) {
+            addSharedHostObject(device, &VkDevice_Info::ycbcrConversions, key,
+                                (uint64_t)*pYcbcrConversion);
+        }
         return res;
     }
 
@@ -4419,7 +5253,9 @@ public:
         VkSamplerYcbcrConversion ycbcrConversion,
         const VkAllocationCallbacks* pAllocator) {
         VkEncoder* enc = (VkEncoder*)context;
-        if (ycbcrConversion != VK_YCBCR_CONVERSION_DO_NOTHING) {
+        if (ycbcrConversion != VK_YCBCR_CONVERSION_DO_NOTHING &&
+            releaseSharedHostObject(device, &VkDevice_Info::ycbcrConversions,
+                                    (uint64_t)ycbcrConversion)) {
             enc->vkDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator, true /* do lock */);
         }
     }
@@ -4455,8 +5291,40 @@ public:
         }
 #endif
 
+        const std::vector<uint8_t> key = samplerKey(localCreateInfo);
+        uint64_t shared;
+        if (acquireSharedHostObject(device, &VkDevice_Info::samplers, key, &shared)) {
+            *pSampler = (VkSampler)shared;
+            return VK_SUCCESS;
+        }
+
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!localCreateInfo.pNext) {
+            if (uint64_t handle = takeReservedHandle(enc, device)) {
+                enc->vkCreateSamplerAsyncGOOGLE(device, &localCreateInfo, handle, pSampler,
+                                                true /* do lock */);
+                enc->flush();
+                addSharedHostObject(device, &VkDevice_Info::samplers, key, (uint64_t)*pSampler);
+                return VK_SUCCESS;
+            }
+        }
+        VkResult res =
+            enc->encodeCreateSampler(device, &localCreateInfo, pAllocator, pSampler, true /* do lock */);
+        if (res == VK_SUCCESS) {
+            addSharedHostObject(device, &VkDevice_Info::samplers, key, (uint64_t)*pSampler);
+        }
+        return res;
+    }
+
+    void on_vkDestroySampler(
+        void* context,
+        VkDevice device,
+        VkSampler sampler,
+        const VkAllocationCallbacks* pAllocator) {
         VkEncoder* enc = (VkEncoder*)context;
-        return enc->vkCreateSampler(device, &localCreateInfo, pAllocator, pSampler, true /* do lock */);
+        if (releaseSharedHostObject(device, &VkDevice_Info::samplers, (uint64_t)sampler)) {
+            enc->vkDestroySampler(device, sampler, pAllocator, true /* do lock */);
+        }
     }
 
     void on_vkGetPhysicalDeviceExternalBufferProperties(
@@ -4551,6 +5419,14 @@ public:
 
         if (input_result != VK_SUCCESS) return input_result;
 
+        if (pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT) {
+            AutoLock<RecursiveLock> lock(mLock);
+            auto it = info_VkFence.find(*pFence);
+            if (it != info_VkFence.end()) {
+                it->second.knownSignaled = true;
+            }
+        }
+
 #if defined(VK_USE_PLATFORM_ANDROID_KHR) || defined(__linux__)
         if (exportSyncFd) {
             if (!mFeatureInfo->hasVirtioGpuNativeSync) {
@@ -4608,7 +5484,9 @@ public:
         for (uint32_t i = 0; i < fenceCount; ++i) {
             VkFence fence = pFences[i];
             auto it = info_VkFence.find(fence);
+            if (it == info_VkFence.end()) continue;
             auto& info = it->second;
+            forgetFenceSignaledLocked(info);
             if (!info.external) continue;
 
 #if defined(VK_USE_PLATFORM_ANDROID_KHR) || defined(__linux__)
@@ -4661,6 +5539,7 @@ public:
         }
 
         auto& info = it->second;
+        forgetFenceSignaledLocked(info);
 
         if (info.syncFd >= 0) {
             ALOGV("%s: previous sync fd exists, close it\n", __func__);
@@ -4719,6 +5598,8 @@ public:
 
         VkEncoder* enc = (VkEncoder*)context;
 
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
         bool hasFence = pGetFdInfo->fence != VK_NULL_HANDLE;
 
         if (!hasFence) {
@@ -4788,6 +5669,8 @@ public:
 
             // relinquish ownership
             info.syncFd = -1;
+            // Exporting a sync fd unsignals the fence.
+            forgetFenceSignaledLocked(info);
             ALOGV("%s: got fd: %d\n", __func__, *pFd);
             return VK_SUCCESS;
         }
@@ -4808,6 +5691,161 @@ public:
 
         VkEncoder* enc = (VkEncoder*)context;
 
+        std::vector<uint32_t> resetCounts;
+        if (fencesKnownSignaled(fenceCount, pFences, waitAll, &resetCounts)) {
+            return VK_SUCCESS;
+        }
+
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
+        VkResult result = waitForFences(enc, device, fenceCount, pFences, waitAll, timeout);
+
+        // After waitAny the host does not tell which fence signaled.
+        if (result == VK_SUCCESS && (waitAll || fenceCount == 1)) {
+            markFencesSignaled(fenceCount, pFences, resetCounts);
+        }
+        return result;
+    }
+
+    VkResult on_vkGetFenceStatus(
+        void* context,
+        VkResult,
+        VkDevice device,
+        VkFence fence) {
+
+        VkEncoder* enc = (VkEncoder*)context;
+
+        std::vector<uint32_t> resetCounts;
+        if (fencesKnownSignaled(1, &fence, VK_TRUE, &resetCounts)) {
+            return VK_SUCCESS;
+        }
+
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
+        VkResult result = VK_SUCCESS;
+        bool answered = false;
+#if defined(VK_USE_PLATFORM_ANDROID_KHR) || defined(__linux__)
+        {
+            // The sync fd of an external fence is what vkWaitForFences
+            // waits on too, so poll it without going to the host.
+            AutoLock<RecursiveLock> lock(mLock);
+            auto it = info_VkFence.find(fence);
+            if (it != info_VkFence.end() && it->second.syncFd >= 0) {
+                result = sync_wait(it->second.syncFd, 0) == 0 ? VK_SUCCESS : VK_NOT_READY;
+                answered = true;
+            }
+        }
+#endif
+        if (!answered) {
+            result = enc->vkGetFenceStatus(device, fence, true /* do lock */);
+        }
+
+        if (result == VK_SUCCESS) {
+            markFencesSignaled(1, &fence, resetCounts);
+        }
+        return result;
+    }
+
+    void forgetFenceSignaledLocked(VkFence_Info& info) {
+        info.knownSignaled = false;
+        ++info.resetCount;
+    }
+
+    // Returns true if the wait is already satisfied by fences known to be
+    // signaled. Otherwise fills |resetCounts| to pass to markFencesSignaled
+    // once the host has answered.
+    bool fencesKnownSignaled(uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
+                             std::vector<uint32_t>* resetCounts) {
+        AutoLock<RecursiveLock> lock(mLock);
+        resetCounts->resize(fenceCount);
+        uint32_t signaledCount = 0;
+        for (uint32_t i = 0; i < fenceCount; ++i) {
+            auto it = info_VkFence.find(pFences[i]);
+            if (it == info_VkFence.end()) {
+                (*resetCounts)[i] = 0;
+                continue;
+            }
+            (*resetCounts)[i] = it->second.resetCount;
+            if (it->second.knownSignaled) ++signaledCount;
+        }
+        return fenceCount && (waitAll ? signaledCount == fenceCount : signaledCount > 0);
+    }
+
+    void markFencesSignaled(uint32_t fenceCount, const VkFence* pFences,
+                            const std::vector<uint32_t>& resetCounts) {
+        AutoLock<RecursiveLock> lock(mLock);
+        for (uint32_t i = 0; i < fenceCount; ++i) {
+            auto it = info_VkFence.find(pFences[i]);
+            if (it == info_VkFence.end()) continue;
+            if (it->second.resetCount != resetCounts[i]) continue;
+            it->second.knownSignaled = true;
+
+            // Whatever was submitted before the fence is done too.
+            for (auto q = mQueuesInFlight.begin(); q != mQueuesInFlight.end();) {
+                if (q->second == pFences[i]) {
+                    q = mQueuesInFlight.erase(q);
+                } else {
+                    ++q;
+                }
+            }
+        }
+    }
+
+#if defined(VK_USE_PLATFORM_ANDROID_KHR) || defined(__linux__)
+    // Waits for all or any of |fds| with a single poll() at a time.
+    static VkResult waitForSyncFds(std::vector<int> fds, VkBool32 waitAll, uint64_t timeoutNs) {
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        const uint64_t startNs = uint64_t(start.tv_sec) * 1000000000ULL + start.tv_nsec;
+
+        std::vector<struct pollfd> pollFds;
+        while (!fds.empty()) {
+            int timeoutMs = -1;
+            if (timeoutNs != UINT64_MAX) {
+                struct timespec now;
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                const uint64_t elapsedNs =
+                    uint64_t(now.tv_sec) * 1000000000ULL + now.tv_nsec - startNs;
+                const uint64_t leftNs = elapsedNs < timeoutNs ? timeoutNs - elapsedNs : 0;
+                timeoutMs = int(std::min<uint64_t>((leftNs + 999999) / 1000000, INT32_MAX));
+            }
+
+            pollFds.clear();
+            for (int fd : fds) {
+                pollFds.push_back({ fd, POLLIN, 0 });
+            }
+            int ret = poll(pollFds.data(), pollFds.size(), timeoutMs);
+            if (ret < 0) {
+                if (errno == EINTR || errno == EAGAIN) continue;
+                ALOGE("%s: poll failed: %s\n", __func__, strerror(errno));
+                return VK_ERROR_DEVICE_LOST;
+            }
+            if (ret == 0) {
+                return VK_TIMEOUT;
+            }
+            if (!waitAll) {
+                return VK_SUCCESS;
+            }
+
+            // Errors count as signaled, as sync_wait() did.
+            size_t kept = 0;
+            for (size_t i = 0; i < pollFds.size(); ++i) {
+                if (!pollFds[i].revents) fds[kept++] = fds[i];
+            }
+            fds.resize(kept);
+        }
+        return VK_SUCCESS;
+    }
+#endif
+
+    VkResult waitForFences(
+        VkEncoder* enc,
+        VkDevice device,
+        uint32_t fenceCount,
+        const VkFence* pFences,
+        VkBool32 waitAll,
+        uint64_t timeout) {
+
 #if defined(VK_USE_PLATFORM_ANDROID_KHR) || defined(__linux__)
         std::vector<VkFence> fencesExternal;
         std::vector<int> fencesExternalWaitFds;
@@ -4833,6 +5871,9 @@ public:
             // No need for work pool, just wait with host driver.
             return enc->vkWaitForFences(
                 device, fenceCount, pFences, waitAll, timeout, true /* do lock */);
+        } else if (fencesNonExternal.empty()) {
+            // Everything is a sync fd, so the host stream stays free.
+            return waitForSyncFds(fencesExternalWaitFds, waitAll, timeout);
         } else {
             // Depending on wait any or wait all,
             // schedule a wait group with waitAny/waitAll
@@ -4840,13 +5881,14 @@ public:
 
             ALOGV("%s: scheduling ext waits\n", __func__);
 
-            for (auto fd : fencesExternalWaitFds) {
-                ALOGV("%s: wait on %d\n", __func__, fd);
-                tasks.push_back([fd] {
-                    sync_wait(fd, 3000);
-                    ALOGV("done waiting on fd %d\n", fd);
-                });
-            }
+            // Capped like the sync_wait()s this used to be, so that the
+            // task ends even if the host fences answer a waitAny first.
+            const uint64_t kMaxSyncFdWaitNs = 3000000000ULL;
+            tasks.push_back([fencesExternalWaitFds /* copy of vector */, waitAll,
+                             timeout = std::min(timeout, kMaxSyncFdWaitNs)] {
+                waitForSyncFds(fencesExternalWaitFds, waitAll, timeout);
+                ALOGV("done waiting on %zu fds\n", fencesExternalWaitFds.size());
+            });
 
             if (!fencesNonExternal.empty()) {
                 tasks.push_back([this,
@@ -4906,6 +5948,8 @@ public:
         dp->allocInfo->createFlags = pCreateInfo->flags;
         dp->allocInfo->maxSets = pCreateInfo->maxSets;
         dp->allocInfo->usedSets = 0;
+        dp->allocInfo->linearSetsUsed = 0;
+        dp->allocInfo->hostSetsSinceReset = false;
 
         for (uint32_t i = 0; i < pCreateInfo->poolSizeCount; ++i) {
             dp->allocInfo->descriptorCountInfo.push_back({
@@ -4954,6 +5998,16 @@ public:
 
         VkEncoder* enc = (VkEncoder*)context;
 
+        // Sets of a linear pool stay around to be handed out again, so only
+        // the host pool needs resetting, and only if it got any sets.
+        if (mFeatureInfo->hasVulkanBatchedDescriptorSetUpdate &&
+            isLinearDescriptorPool(descriptorPool)) {
+            bool hostSets = as_goldfish_VkDescriptorPool(descriptorPool)->allocInfo->hostSetsSinceReset;
+            rewindLinearDescriptorPool(descriptorPool);
+            if (!hostSets) return VK_SUCCESS;
+            return enc->vkResetDescriptorPool(device, descriptorPool, flags, true /* do lock */);
+        }
+
         VkResult res = enc->vkResetDescriptorPool(device, descriptorPool, flags, true /* do lock */);
 
         if (res != VK_SUCCESS) return res;
@@ -5085,8 +6139,10 @@ public:
 
         VkEncoder* enc = (VkEncoder*)context;
 
-        std::vector<VkDescriptorImageInfo> transformedImageInfos;
-        std::vector<VkWriteDescriptorSet> transformedWrites(descriptorWriteCount);
+        // Sized for the common case so that per draw updates stay on the stack.
+        SmallFixedVector<VkDescriptorImageInfo, 32> transformedImageInfos;
+        SmallFixedVector<VkWriteDescriptorSet, 16> transformedWrites;
+        transformedWrites.resize_noinit(descriptorWriteCount);
 
         memcpy(transformedWrites.data(), pDescriptorWrites, sizeof(VkWriteDescriptorSet) * descriptorWriteCount);
 
@@ -5098,7 +6154,7 @@ public:
             imageInfosNeeded += transformedWrites[i].descriptorCount;
         }
 
-        transformedImageInfos.resize(imageInfosNeeded);
+        transformedImageInfos.resize_noinit(imageInfosNeeded);
 
         size_t imageInfoIndex = 0;
         for (uint32_t i = 0; i < descriptorWriteCount; ++i) {
@@ -5223,6 +6279,13 @@ public:
             return;
         }
 
+        const std::vector<uint64_t> key = info.requirementsKey;
+        if (!key.empty() && findImageRequirementsLocked(device, key, pMemoryRequirements)) {
+            info.baseRequirementsKnown = true;
+            info.baseRequirements = *pMemoryRequirements;
+            return;
+        }
+
         lock.unlock();
 
         VkEncoder* enc = (VkEncoder*)context;
@@ -5232,16 +6295,31 @@ public:
 
         lock.lock();
 
+        if (!key.empty()) {
+            auto deviceIt = info_VkDevice.find(device);
+            if (deviceIt != info_VkDevice.end()) {
+                deviceIt->second.imageRequirements[key] = *pMemoryRequirements;
+            }
+        }
+
+        it = info_VkImage.find(image);
+        if (it == info_VkImage.end()) return;
+
         transformImageMemoryRequirementsForGuestLocked(
             image, pMemoryRequirements);
 
-        info.baseRequirementsKnown = true;
-        info.baseRequirements = *pMemoryRequirements;
+        it->second.baseRequirementsKnown = true;
+        it->second.baseRequirements = *pMemoryRequirements;
     }
 
     void on_vkGetImageMemoryRequirements2(
         void *context, VkDevice device, const VkImageMemoryRequirementsInfo2 *pInfo,
         VkMemoryRequirements2 *pMemoryRequirements) {
+        if (isImageRequirementsQueryPlain(pInfo, pMemoryRequirements)) {
+            on_vkGetImageMemoryRequirements(context, device, pInfo->image,
+                                            &pMemoryRequirements->memoryRequirements);
+            return;
+        }
         VkEncoder* enc = (VkEncoder*)context;
         enc->vkGetImageMemoryRequirements2(
             device, pInfo, pMemoryRequirements, true /* do lock */);
@@ -5252,6 +6330,11 @@ public:
     void on_vkGetImageMemoryRequirements2KHR(
         void *context, VkDevice device, const VkImageMemoryRequirementsInfo2 *pInfo,
         VkMemoryRequirements2 *pMemoryRequirements) {
+        if (isImageRequirementsQueryPlain(pInfo, pMemoryRequirements)) {
+            on_vkGetImageMemoryRequirements(context, device, pInfo->image,
+                                            &pMemoryRequirements->memoryRequirements);
+            return;
+        }
         VkEncoder* enc = (VkEncoder*)context;
         enc->vkGetImageMemoryRequirements2KHR(
             device, pInfo, pMemoryRequirements, true /* do lock */);
@@ -5401,8 +6484,8 @@ public:
                 device, &localCreateInfo, pAllocator, pBuffer, &memReqs,
                 true /* do lock */);
         } else {
-            res = enc->vkCreateBuffer(device, &localCreateInfo, pAllocator,
-                                      pBuffer, true /* do lock */);
+            res = enc->encodeCreateBuffer(device, &localCreateInfo, pAllocator,
+                                         pBuffer, true /* do lock */);
         }
 
         if (res != VK_SUCCESS) return res;
@@ -5441,6 +6524,25 @@ public:
             info.externalCreateInfo = *extBufCiPtr;
         }
 
+        bool memoizable = !supportsCreateResourcesWithRequirements() && !pCapAddrCi &&
+                          !pDevAddrCi &&
+                          !(localCreateInfo.flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT);
+        for (const VkBaseInStructure* ext = (const VkBaseInStructure*)pCreateInfo->pNext;
+             ext && memoizable; ext = ext->pNext) {
+            memoizable = ext->sType == VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+        }
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        memoizable = memoizable && !isSysmemBackedMemory;
+#endif
+        if (memoizable) {
+            info.requirementsClass = {
+                localCreateInfo.flags,
+                localCreateInfo.usage,
+                (uint64_t)localCreateInfo.sharingMode,
+                extBufCiPtr ? extBufCiPtr->handleTypes : 0u,
+            };
+        }
+
 #ifdef VK_USE_PLATFORM_FUCHSIA
         if (isSysmemBackedMemory) {
             info.isSysmemBackedMemory = true;
@@ -5472,6 +6574,15 @@ public:
             return;
         }
 
+        const std::vector<uint64_t> requirementsClass = info.requirementsClass;
+        const VkDeviceSize size = info.createInfo.size;
+        if (!requirementsClass.empty() &&
+            findBufferRequirementsLocked(device, requirementsClass, size, pMemoryRequirements)) {
+            info.baseRequirementsKnown = true;
+            info.baseRequirements = *pMemoryRequirements;
+            return;
+        }
+
         lock.unlock();
 
         VkEncoder* enc = (VkEncoder*)context;
@@ -5480,13 +6591,62 @@ public:
 
         lock.lock();
 
-        info.baseRequirementsKnown = true;
-        info.baseRequirements = *pMemoryRequirements;
+        if (!requirementsClass.empty()) {
+            addBufferRequirementsLocked(device, requirementsClass, size, *pMemoryRequirements);
+        }
+
+        it = info_VkBuffer.find(buffer);
+        if (it == info_VkBuffer.end()) return;
+
+        it->second.baseRequirementsKnown = true;
+        it->second.baseRequirements = *pMemoryRequirements;
+    }
+
+    bool findImageRequirementsLocked(VkDevice device, const std::vector<uint64_t>& key,
+                                     VkMemoryRequirements* reqs) {
+        auto deviceIt = info_VkDevice.find(device);
+        if (deviceIt == info_VkDevice.end()) return false;
+        auto it = deviceIt->second.imageRequirements.find(key);
+        if (it == deviceIt->second.imageRequirements.end()) return false;
+        *reqs = it->second;
+        return true;
+    }
+
+    // Answers kept per buffer class, for allocators whose sizes repeat.
+    static constexpr size_t kMaxBufferRequirementsSizes = 256;
+
+    bool findBufferRequirementsLocked(VkDevice device, const std::vector<uint64_t>& requirementsClass,
+                                      VkDeviceSize size, VkMemoryRequirements* reqs) {
+        auto deviceIt = info_VkDevice.find(device);
+        if (deviceIt == info_VkDevice.end()) return false;
+        auto classIt = deviceIt->second.bufferRequirements.find(requirementsClass);
+        if (classIt == deviceIt->second.bufferRequirements.end()) return false;
+        auto sizeIt = classIt->second.find(size);
+        if (sizeIt == classIt->second.end()) return false;
+        *reqs = sizeIt->second;
+        return true;
+    }
+
+    void addBufferRequirementsLocked(VkDevice device, const std::vector<uint64_t>& requirementsClass,
+                                     VkDeviceSize size, const VkMemoryRequirements& reqs) {
+        auto deviceIt = info_VkDevice.find(device);
+        if (deviceIt == info_VkDevice.end()) return;
+        auto& bySize = deviceIt->second.bufferRequirements[requirementsClass];
+
+        if (bySize.size() >= kMaxBufferRequirementsSizes) {
+            bySize.clear();
+        }
+        bySize[size] = reqs;
     }
 
     void on_vkGetBufferMemoryRequirements2(
         void* context, VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo,
         VkMemoryRequirements2* pMemoryRequirements) {
+        if (isBufferRequirementsQueryPlain(pInfo, pMemoryRequirements)) {
+            on_vkGetBufferMemoryRequirements(context, device, pInfo->buffer,
+                                             &pMemoryRequirements->memoryRequirements);
+            return;
+        }
         VkEncoder* enc = (VkEncoder*)context;
         enc->vkGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements, true /* do lock */);
         transformBufferMemoryRequirements2ForGuest(
@@ -5496,6 +6656,11 @@ public:
     void on_vkGetBufferMemoryRequirements2KHR(
         void* context, VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo,
         VkMemoryRequirements2* pMemoryRequirements) {
+        if (isBufferRequirementsQueryPlain(pInfo, pMemoryRequirements)) {
+            on_vkGetBufferMemoryRequirements(context, device, pInfo->buffer,
+                                             &pMemoryRequirements->memoryRequirements);
+            return;
+        }
         VkEncoder* enc = (VkEncoder*)context;
         enc->vkGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements, true /* do lock */);
         transformBufferMemoryRequirements2ForGuest(
@@ -5600,6 +6765,15 @@ public:
 
         info.device = device;
         info.eventHandle = event_handle;
+
+        const VkSemaphoreTypeCreateInfo* semaphoreTypeCi =
+            vk_find_struct<VkSemaphoreTypeCreateInfo>(pCreateInfo);
+        if (semaphoreTypeCi && semaphoreTypeCi->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE &&
+            !exportSemaphoreInfoPtr) {
+            info.trackedTimeline = true;
+            info.knownValue = semaphoreTypeCi->initialValue;
+            info.pendingValue = semaphoreTypeCi->initialValue;
+        }
 #ifdef VK_USE_PLATFORM_FUCHSIA
         info.eventKoid = getEventKoid(info.eventHandle);
 #endif
@@ -5642,6 +6816,181 @@ public:
         enc->vkDestroySemaphore(device, semaphore, pAllocator, true /* do lock */);
     }
 
+    void stopTrackingTimeline(VkSemaphore semaphore) {
+        AutoLock<RecursiveLock> lock(mLock);
+        auto it = info_VkSemaphore.find(semaphore);
+        if (it != info_VkSemaphore.end()) it->second.trackedTimeline = false;
+    }
+
+    // Caller holds mLock.
+    void noteTimelineValueLocked(VkSemaphore semaphore, uint64_t value, bool reached) {
+        auto it = info_VkSemaphore.find(semaphore);
+        if (it == info_VkSemaphore.end() || !it->second.trackedTimeline) return;
+
+        auto& info = it->second;
+        info.pendingValue = std::max(info.pendingValue, value);
+        if (reached) info.knownValue = std::max(info.knownValue, value);
+    }
+
+    // Binary semaphores come through here too; their values are ignored
+    // as they are never tracked.
+    void noteTimelineSignalsLocked(uint32_t semaphoreCount, const VkSemaphore* pSemaphores,
+                                   const VkTimelineSemaphoreSubmitInfo* timelineInfo) {
+        if (!timelineInfo || !timelineInfo->pSignalSemaphoreValues) return;
+        const uint32_t count = std::min(semaphoreCount, timelineInfo->signalSemaphoreValueCount);
+        for (uint32_t i = 0; i < count; ++i) {
+            noteTimelineValueLocked(pSemaphores[i], timelineInfo->pSignalSemaphoreValues[i],
+                                    false /* not reached yet */);
+        }
+    }
+
+    void noteTimelineSignals(uint32_t submitCount, const VkSubmitInfo* pSubmits) {
+        AutoLock<RecursiveLock> lock(mLock);
+        for (uint32_t i = 0; i < submitCount; ++i) {
+            noteTimelineSignalsLocked(pSubmits[i].signalSemaphoreCount,
+                                      pSubmits[i].pSignalSemaphores,
+                                      vk_find_struct<VkTimelineSemaphoreSubmitInfo>(&pSubmits[i]));
+        }
+    }
+
+    void noteTimelineSignals(uint32_t submitCount, const VkSubmitInfo2* pSubmits) {
+        AutoLock<RecursiveLock> lock(mLock);
+        for (uint32_t i = 0; i < submitCount; ++i) {
+            for (uint32_t j = 0; j < pSubmits[i].signalSemaphoreInfoCount; ++j) {
+                const VkSemaphoreSubmitInfo& signal = pSubmits[i].pSignalSemaphoreInfos[j];
+                noteTimelineValueLocked(signal.semaphore, signal.value, false /* not reached yet */);
+            }
+        }
+    }
+
+    void noteTimelineSignals(uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo) {
+        AutoLock<RecursiveLock> lock(mLock);
+        for (uint32_t i = 0; i < bindInfoCount; ++i) {
+            noteTimelineSignalsLocked(pBindInfo[i].signalSemaphoreCount,
+                                      pBindInfo[i].pSignalSemaphores,
+                                      vk_find_struct<VkTimelineSemaphoreSubmitInfo>(&pBindInfo[i]));
+        }
+    }
+
+    void on_vkQueueBindSparse_pre(void* context, VkQueue queue, uint32_t bindInfoCount,
+                                  const VkBindSparseInfo* pBindInfo, VkFence fence) {
+        noteTimelineSignals(bindInfoCount, pBindInfo);
+        noteQueueWork(queue, fence);
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+    }
+
+    void on_vkQueueSubmit2KHR_pre(void* context, VkQueue queue, uint32_t submitCount,
+                                  const VkSubmitInfo2* pSubmits, VkFence fence) {
+        noteTimelineSignals(submitCount, pSubmits);
+        noteQueueWork(queue, fence);
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+    }
+
+    VkResult on_vkGetSemaphoreCounterValue(void* context, VkResult, VkDevice device,
+                                           VkSemaphore semaphore, uint64_t* pValue) {
+        return getSemaphoreCounterValue(context, device, semaphore, pValue, false /* khr */);
+    }
+
+    VkResult on_vkGetSemaphoreCounterValueKHR(void* context, VkResult, VkDevice device,
+                                              VkSemaphore semaphore, uint64_t* pValue) {
+        return getSemaphoreCounterValue(context, device, semaphore, pValue, true /* khr */);
+    }
+
+    VkResult getSemaphoreCounterValue(void* context, VkDevice device, VkSemaphore semaphore,
+                                      uint64_t* pValue, bool khr) {
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            auto it = info_VkSemaphore.find(semaphore);
+            if (it != info_VkSemaphore.end() && it->second.trackedTimeline &&
+                it->second.knownValue == it->second.pendingValue) {
+                *pValue = it->second.knownValue;
+                return VK_SUCCESS;
+            }
+        }
+
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
+        VkEncoder* enc = (VkEncoder*)context;
+        VkResult result =
+            khr ? enc->vkGetSemaphoreCounterValueKHR(device, semaphore, pValue, true /* do lock */)
+                : enc->vkGetSemaphoreCounterValue(device, semaphore, pValue, true /* do lock */);
+        if (result == VK_SUCCESS) {
+            AutoLock<RecursiveLock> lock(mLock);
+            noteTimelineValueLocked(semaphore, *pValue, true /* reached */);
+        }
+        return result;
+    }
+
+    VkResult on_vkWaitSemaphores(void* context, VkResult, VkDevice device,
+                                 const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+        return waitSemaphores(context, device, pWaitInfo, timeout, false /* khr */);
+    }
+
+    VkResult on_vkWaitSemaphoresKHR(void* context, VkResult, VkDevice device,
+                                    const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+        return waitSemaphores(context, device, pWaitInfo, timeout, true /* khr */);
+    }
+
+    VkResult waitSemaphores(void* context, VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo,
+                            uint64_t timeout, bool khr) {
+        const bool waitAny = pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT;
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            uint32_t reached = 0;
+            for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; ++i) {
+                auto it = info_VkSemaphore.find(pWaitInfo->pSemaphores[i]);
+                if (it != info_VkSemaphore.end() && it->second.trackedTimeline &&
+                    it->second.knownValue >= pWaitInfo->pValues[i]) {
+                    ++reached;
+                }
+            }
+            if (waitAny ? reached > 0 : reached == pWaitInfo->semaphoreCount) {
+                return VK_SUCCESS;
+            }
+        }
+
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
+        VkEncoder* enc = (VkEncoder*)context;
+        VkResult result = khr ? enc->vkWaitSemaphoresKHR(device, pWaitInfo, timeout,
+                                                         true /* do lock */)
+                              : enc->vkWaitSemaphores(device, pWaitInfo, timeout,
+                                                      true /* do lock */);
+
+        // After waitAny the host does not tell which semaphore got there.
+        if (result == VK_SUCCESS && (!waitAny || pWaitInfo->semaphoreCount == 1)) {
+            AutoLock<RecursiveLock> lock(mLock);
+            for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; ++i) {
+                noteTimelineValueLocked(pWaitInfo->pSemaphores[i], pWaitInfo->pValues[i],
+                                        true /* reached */);
+            }
+        }
+        return result;
+    }
+
+    VkResult on_vkSignalSemaphore(void* context, VkResult, VkDevice device,
+                                  const VkSemaphoreSignalInfo* pSignalInfo) {
+        return signalSemaphore(context, device, pSignalInfo, false /* khr */);
+    }
+
+    VkResult on_vkSignalSemaphoreKHR(void* context, VkResult, VkDevice device,
+                                     const VkSemaphoreSignalInfo* pSignalInfo) {
+        return signalSemaphore(context, device, pSignalInfo, true /* khr */);
+    }
+
+    VkResult signalSemaphore(void* context, VkDevice device,
+                             const VkSemaphoreSignalInfo* pSignalInfo, bool khr) {
+        VkEncoder* enc = (VkEncoder*)context;
+        VkResult result = khr ? enc->vkSignalSemaphoreKHR(device, pSignalInfo, true /* do lock */)
+                              : enc->vkSignalSemaphore(device, pSignalInfo, true /* do lock */);
+        if (result == VK_SUCCESS) {
+            AutoLock<RecursiveLock> lock(mLock);
+            noteTimelineValueLocked(pSignalInfo->semaphore, pSignalInfo->value,
+                                    true /* reached */);
+        }
+        return result;
+    }
+
     // https://www.khronos.org/registry/vulkan/specs/1.0-extensions/html/vkspec.html#vkGetSemaphoreFdKHR
     // Each call to vkGetSemaphoreFdKHR must create a new file descriptor and transfer ownership
     // of it to the application. To avoid leaking resources, the application must release ownership
@@ -5652,6 +7001,8 @@ public:
         int* pFd) {
 #if defined(VK_USE_PLATFORM_ANDROID_KHR) || defined(__linux__)
         VkEncoder* enc = (VkEncoder*)context;
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
         bool getSyncFd =
             pGetFdInfo->handleType & VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT;
 
@@ -5693,6 +7044,8 @@ public:
             return input_result;
         }
 
+        stopTrackingTimeline(pImportSemaphoreFdInfo->semaphore);
+
         if (pImportSemaphoreFdInfo->handleType &
             VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT) {
             VkImportSemaphoreFdInfoKHR tmpInfo = *pImportSemaphoreFdInfo;
@@ -5779,6 +7132,21 @@ public:
         std::vector<uint32_t> writeStartingIndices;
         std::vector<VkWriteDescriptorSet> writesForHost;
 
+        // A run of consecutive array elements of one binding that changed
+        // since the last commit.
+        struct PendingHostWrite {
+            VkDescriptorSet set;
+            uint32_t binding;
+            DescriptorWriteArrayRange range;
+            DescriptorWriteType type;
+            VkDescriptorType descriptorType;
+            size_t infoIndex;
+        };
+        std::vector<PendingHostWrite> pendingHostWrites;
+        std::vector<VkDescriptorImageInfo> imageInfos;
+        std::vector<VkDescriptorBufferInfo> bufferInfos;
+        std::vector<VkBufferView> bufferViews;
+
         uint32_t poolIndex = 0;
         uint32_t currentWriteIndex = 0;
         for (auto set : sets) {
@@ -5803,68 +7171,97 @@ public:
             writeStartingIndices.push_back(currentWriteIndex);
 
             auto& writes = reified->allWrites;
+            auto& committed = reified->committedWrites;
 
             for (size_t i = 0; i < writes.size(); ++i) {
                 uint32_t binding = i;
 
-                for (size_t j = 0; j < writes[i].size(); ++j) {
+                size_t j = 0;
+                while (j < writes[i].size()) {
                     auto& write = writes[i][j];
 
-                    if (write.type == DescriptorWriteType::Empty) continue;
+                    if (write.type == DescriptorWriteType::Empty) {
+                        ++j;
+                        continue;
+                    }
 
-                    uint32_t dstArrayElement = 0;
+                    if (write.type == DescriptorWriteType::InlineUniformBlock ||
+                        write.type == DescriptorWriteType::AccelerationStructure) {
+                        // TODO
+                        ALOGE("Encountered pending inline uniform block or acceleration structure desc write, abort (NYI)\n");
+                        abort();
+                    }
 
-                    VkDescriptorImageInfo* imageInfo = nullptr;
-                    VkDescriptorBufferInfo* bufferInfo = nullptr;
-                    VkBufferView* bufferView = nullptr;
+                    // The host already has this descriptor.
+                    if (descriptorWriteMatchesCommitted(write, committed[i][j])) {
+                        write.type = DescriptorWriteType::Empty;
+                        ++j;
+                        continue;
+                    }
 
+                    // Send the run of changed descriptors starting here as a
+                    // single write.
+                    PendingHostWrite run = {
+                        set, binding, {(uint32_t)j, 0}, write.type, write.descriptorType, 0,
+                    };
                     switch (write.type) {
-                        case DescriptorWriteType::Empty:
-                            break;
                         case DescriptorWriteType::ImageInfo:
-                            dstArrayElement = j;
-                            imageInfo = &write.imageInfo;
+                            run.infoIndex = imageInfos.size();
                             break;
                         case DescriptorWriteType::BufferInfo:
-                            dstArrayElement = j;
-                            bufferInfo = &write.bufferInfo;
-                            break;
-                        case DescriptorWriteType::BufferView:
-                            dstArrayElement = j;
-                            bufferView = &write.bufferView;
+                            run.infoIndex = bufferInfos.size();
                             break;
-                        case DescriptorWriteType::InlineUniformBlock:
-                        case DescriptorWriteType::AccelerationStructure:
-                            // TODO
-                            ALOGE("Encountered pending inline uniform block or acceleration structure desc write, abort (NYI)\n");
-                            abort();
                         default:
+                            run.infoIndex = bufferViews.size();
                             break;
-
                     }
 
-                    // TODO: Combine multiple writes into one VkWriteDescriptorSet.
-                    VkWriteDescriptorSet forHost = {
-                        VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, 0 /* TODO: inline uniform block */,
-                        set,
-                        binding,
-                        dstArrayElement,
-                        1,
-                        write.descriptorType,
-                        imageInfo,
-                        bufferInfo,
-                        bufferView,
-                    };
-
-                    writesForHost.push_back(forHost);
-                    ++currentWriteIndex;
-
-                    // Set it back to empty.
-                    write.type = DescriptorWriteType::Empty;
+                    while (j < writes[i].size()) {
+                        auto& next = writes[i][j];
+                        if (next.type != run.type || next.descriptorType != run.descriptorType ||
+                            descriptorWriteMatchesCommitted(next, committed[i][j])) {
+                            break;
+                        }
+                        switch (next.type) {
+                            case DescriptorWriteType::ImageInfo:
+                                imageInfos.push_back(next.imageInfo);
+                                break;
+                            case DescriptorWriteType::BufferInfo:
+                                bufferInfos.push_back(next.bufferInfo);
+                                break;
+                            default:
+                                bufferViews.push_back(next.bufferView);
+                                break;
+                        }
+                        recordCommittedDescriptorWrite(next, &committed[i][j]);
+                        // Set it back to empty.
+                        next.type = DescriptorWriteType::Empty;
+                        ++run.range.count;
+                        ++j;
+                    }
+
+                    pendingHostWrites.push_back(run);
+                    ++currentWriteIndex;
                 }
             }
         }
 
+        // The info arrays are complete, so pointers into them are stable now.
+        for (const auto& run : pendingHostWrites) {
+            VkWriteDescriptorSet forHost = {
+                VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, 0 /* TODO: inline uniform block */,
+                run.set,
+                run.binding,
+                run.range.begin,
+                run.range.count,
+                run.descriptorType,
+                run.type == DescriptorWriteType::ImageInfo ? &imageInfos[run.infoIndex] : nullptr,
+                run.type == DescriptorWriteType::BufferInfo ? &bufferInfos[run.infoIndex] : nullptr,
+                run.type == DescriptorWriteType::BufferView ? &bufferViews[run.infoIndex] : nullptr,
+            };
+            writesForHost.push_back(forHost);
+        }
+
         // Skip out if there's nothing to VkWriteDescriptorSet home about.
         if (writesForHost.empty()) {
             return;
@@ -5888,6 +7285,9 @@ public:
             ReifiedDescriptorSet* reified = as_goldfish_VkDescriptorSet(set)->reified;
             reified->allocationPending = false;
         }
+        for (auto pool : pools) {
+            as_goldfish_VkDescriptorPool(pool)->allocInfo->hostSetsSinceReset = true;
+        }
     }
 
     void flushCommandBufferPendingCommandsBottomUp(void* context, VkQueue queue, const std::vector<VkCommandBuffer>& workingSet) {
@@ -5936,8 +7336,13 @@ public:
                 enc->vkQueueFlushCommandsFromAuxMemoryGOOGLE(queue, cmdbuf, deviceMemory,
                                                              dataOffset, written, true /*do lock*/);
             } else {
-                enc->vkQueueFlushCommandsGOOGLE(queue, cmdbuf, written, (const void*)writtenPtr,
-                                                true /* do lock */);
+                // Commands never straddle arena chunks, so each chunk can go
+                // to the host as its own batch.
+                cmdBufStream->forEachWritten([enc, queue, cmdbuf](unsigned char* data,
+                                                                  size_t size) {
+                    enc->vkQueueFlushCommandsGOOGLE(queue, cmdbuf, size, (const void*)data,
+                                                    true /* do lock */);
+                });
             }
             // Reset this stream.
             // flushing happens on vkQueueSubmit
@@ -6024,17 +7429,28 @@ public:
     template <class VkSubmitInfoType>
     void flushStagingStreams(void* context, VkQueue queue, uint32_t submitCount,
                              const VkSubmitInfoType* pSubmits) {
-        std::vector<VkCommandBuffer> toFlush;
+        // Kept per thread so that its capacity carries over between submits.
+        thread_local std::vector<VkCommandBuffer> toFlush;
+        toFlush.clear();
         for (uint32_t i = 0; i < submitCount; ++i) {
             for (uint32_t j = 0; j < getCommandBufferCount(pSubmits[i]); ++j) {
                 toFlush.push_back(getCommandBuffer(pSubmits[i], j));
             }
         }
 
+        commitPendingDescriptorSets(context, queue, toFlush);
+        flushCommandBufferStreams(context, queue, toFlush);
+    }
+
+    void commitPendingDescriptorSets(void* context, VkQueue queue,
+                                     const std::vector<VkCommandBuffer>& toFlush) {
         std::unordered_set<VkDescriptorSet> pendingSets;
         collectAllPendingDescriptorSetsBottomUp(toFlush, pendingSets);
         commitDescriptorSetUpdates(context, queue, pendingSets);
+    }
 
+    void flushCommandBufferStreams(void* context, VkQueue queue,
+                                   const std::vector<VkCommandBuffer>& toFlush) {
         flushCommandBufferPendingCommandsBottomUp(context, queue, toFlush);
 
         for (auto cb : toFlush) {
@@ -6042,17 +7458,216 @@ public:
         }
     }
 
+    // Copy of the arguments of a vkQueueSubmit or vkQueueSubmit2, so that
+    // they can be submitted from the queue's submit thread once the call
+    // has returned.
+    template <typename VkSubmitInfoType>
+    struct QueuedSubmit {
+        std::vector<VkSubmitInfoType> submits;
+        // Every submitted command buffer, in order.
+        std::vector<VkCommandBuffer> commandBuffers;
+        VkFence fence = VK_NULL_HANDLE;
+
+        // What |submits| points into. Reserved up front and only appended
+        // to, so the pointers stay put.
+        std::vector<VkTimelineSemaphoreSubmitInfo> timelineInfos;
+        std::vector<VkSemaphore> semaphores;
+        std::vector<VkPipelineStageFlags> waitStages;
+        std::vector<uint64_t> values;
+        std::vector<VkSemaphoreSubmitInfo> semaphoreInfos;
+        std::vector<VkCommandBufferSubmitInfo> commandBufferInfos;
+    };
+
+    template <typename T>
+    static const T* appendArray(std::vector<T>* storage, const T* items, uint32_t count) {
+        if (!items || !count) return nullptr;
+        const T* copy = storage->data() + storage->size();
+        storage->insert(storage->end(), items, items + count);
+        return copy;
+    }
+
+    template <typename T>
+    static bool anyExtended(const T* items, uint32_t count) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (items[i].pNext) return true;
+        }
+        return false;
+    }
+
+    // Only plain submits, or ones chaining timeline semaphore values, are
+    // copied; the rest are submitted from the calling thread.
+    static bool captureSubmits(uint32_t submitCount, const VkSubmitInfo* pSubmits,
+                               QueuedSubmit<VkSubmitInfo>* out) {
+        size_t semaphoreCount = 0;
+        size_t waitStageCount = 0;
+        size_t commandBufferCount = 0;
+        size_t timelineCount = 0;
+        size_t valueCount = 0;
+        for (uint32_t i = 0; i < submitCount; ++i) {
+            const VkSubmitInfo& submit = pSubmits[i];
+            if (submit.pNext) {
+                const auto* timeline =
+                    static_cast<const VkTimelineSemaphoreSubmitInfo*>(submit.pNext);
+                if (timeline->sType != VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO ||
+                    timeline->pNext) {
+                    return false;
+                }
+                ++timelineCount;
+                valueCount +=
+                    timeline->waitSemaphoreValueCount + timeline->signalSemaphoreValueCount;
+            }
+            semaphoreCount += submit.waitSemaphoreCount + submit.signalSemaphoreCount;
+            waitStageCount += submit.waitSemaphoreCount;
+            commandBufferCount += submit.commandBufferCount;
+        }
+
+        out->submits.reserve(submitCount);
+        out->commandBuffers.reserve(commandBufferCount);
+        out->timelineInfos.reserve(timelineCount);
+        out->semaphores.reserve(semaphoreCount);
+        out->waitStages.reserve(waitStageCount);
+        out->values.reserve(valueCount);
+
+        for (uint32_t i = 0; i < submitCount; ++i) {
+            VkSubmitInfo submit = pSubmits[i];
+            submit.pWaitSemaphores =
+                appendArray(&out->semaphores, submit.pWaitSemaphores, submit.waitSemaphoreCount);
+            submit.pWaitDstStageMask =
+                appendArray(&out->waitStages, submit.pWaitDstStageMask, submit.waitSemaphoreCount);
+            submit.pCommandBuffers =
+                appendArray(&out->commandBuffers, submit.pCommandBuffers, submit.commandBufferCount);
+            submit.pSignalSemaphores = appendArray(&out->semaphores, submit.pSignalSemaphores,
+                                                   submit.signalSemaphoreCount);
+            if (submit.pNext) {
+                VkTimelineSemaphoreSubmitInfo timeline =
+                    *static_cast<const VkTimelineSemaphoreSubmitInfo*>(submit.pNext);
+                timeline.pWaitSemaphoreValues = appendArray(
+                    &out->values, timeline.pWaitSemaphoreValues, timeline.waitSemaphoreValueCount);
+                timeline.pSignalSemaphoreValues =
+                    appendArray(&out->values, timeline.pSignalSemaphoreValues,
+                                timeline.signalSemaphoreValueCount);
+                out->timelineInfos.push_back(timeline);
+                submit.pNext = &out->timelineInfos.back();
+            }
+            out->submits.push_back(submit);
+        }
+        return true;
+    }
+
+    static bool captureSubmits(uint32_t submitCount, const VkSubmitInfo2* pSubmits,
+                               QueuedSubmit<VkSubmitInfo2>* out) {
+        size_t semaphoreCount = 0;
+        size_t commandBufferCount = 0;
+        for (uint32_t i = 0; i < submitCount; ++i) {
+            const VkSubmitInfo2& submit = pSubmits[i];
+            if (submit.pNext ||
+                anyExtended(submit.pWaitSemaphoreInfos, submit.waitSemaphoreInfoCount) ||
+                anyExtended(submit.pCommandBufferInfos, submit.commandBufferInfoCount) ||
+                anyExtended(submit.pSignalSemaphoreInfos, submit.signalSemaphoreInfoCount)) {
+                return false;
+            }
+            semaphoreCount += submit.waitSemaphoreInfoCount + submit.signalSemaphoreInfoCount;
+            commandBufferCount += submit.commandBufferInfoCount;
+        }
+
+        out->submits.reserve(submitCount);
+        out->commandBuffers.reserve(commandBufferCount);
+        out->semaphoreInfos.reserve(semaphoreCount);
+        out->commandBufferInfos.reserve(commandBufferCount);
+
+        for (uint32_t i = 0; i < submitCount; ++i) {
+            VkSubmitInfo2 submit = pSubmits[i];
+            submit.pWaitSemaphoreInfos = appendArray(
+                &out->semaphoreInfos, submit.pWaitSemaphoreInfos, submit.waitSemaphoreInfoCount);
+            submit.pCommandBufferInfos =
+                appendArray(&out->commandBufferInfos, submit.pCommandBufferInfos,
+                            submit.commandBufferInfoCount);
+            submit.pSignalSemaphoreInfos =
+                appendArray(&out->semaphoreInfos, submit.pSignalSemaphoreInfos,
+                            submit.signalSemaphoreInfoCount);
+            for (uint32_t j = 0; j < submit.commandBufferInfoCount; ++j) {
+                out->commandBuffers.push_back(submit.pCommandBufferInfos[j].commandBuffer);
+            }
+            out->submits.push_back(submit);
+        }
+        return true;
+    }
+
+    // A command buffer that may be pending more than once would have its
+    // staging stream flushed from two threads.
+    bool anySimultaneousUse(const std::vector<VkCommandBuffer>& commandBuffers) {
+        if (commandBuffers.empty()) return false;
+
+        std::vector<VkCommandBuffer> nextLevel;
+        for (auto commandBuffer : commandBuffers) {
+            struct goldfish_VkCommandBuffer* cb = as_goldfish_VkCommandBuffer(commandBuffer);
+            if (cb->flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT) return true;
+            forAllObjects(cb->subObjects, [&nextLevel](void* secondary) {
+                nextLevel.push_back((VkCommandBuffer)secondary);
+            });
+        }
+        return anySimultaneousUse(nextLevel);
+    }
+
+    std::shared_ptr<QueueSubmitWorker> getQueueSubmitWorker(VkQueue queue) {
+        if (!mQueueSubmitThreads) return nullptr;
+
+        AutoLock<RecursiveLock> lock(mLock);
+        auto& worker = mQueueSubmitWorkers[queue];
+        if (!worker) worker = std::make_shared<QueueSubmitWorker>();
+        return worker;
+    }
+
+    // Waits for the submit thread of |queue|, or of every queue other than
+    // |except| if |queue| is null, to run what it holds. Each submit thread
+    // encodes on its own stream, so |context| then also has the host hold
+    // back what it encodes next until the host has taken those submits.
+    // Queues whose thread ran nothing since it last held back |context| are
+    // skipped.
+    void waitForQueueSubmitThreads(void* context, VkQueue queue,
+                                   VkQueue except = VK_NULL_HANDLE) {
+        if (!mQueueSubmitThreads) return;
+
+        std::vector<std::pair<VkQueue, std::shared_ptr<QueueSubmitWorker>>> workers;
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            for (const auto& it : mQueueSubmitWorkers) {
+                if (queue != VK_NULL_HANDLE ? it.first != queue : it.first == except) continue;
+                workers.push_back(it);
+            }
+        }
+
+        VkEncoder* enc = (VkEncoder*)context;
+        for (auto& [workerQueue, worker] : workers) {
+            const uint64_t completed = worker->waitIdle();
+
+            AutoLock<RecursiveLock> lock(mLock);
+            auto infoIt = info_VkQueue.find(workerQueue);
+            if (infoIt == info_VkQueue.end()) continue;
+            VkQueue_Info& info = infoIt->second;
+            if (!completed ||
+                (info.submitTasksSynced == completed && info.submitTasksSyncedFor == enc)) {
+                continue;
+            }
+            info.submitTasksSynced = completed;
+            info.submitTasksSyncedFor = enc;
+            struct goldfish_VkQueue* q = as_goldfish_VkQueue(workerQueue);
+            enc->vkQueueHostSyncGOOGLE(workerQueue, true, ++q->sequenceNumber,
+                                       true /* do lock */);
+        }
+    }
+
     VkResult on_vkQueueSubmit(
         void* context, VkResult input_result,
         VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
-        AEMU_SCOPED_TRACE("on_vkQueueSubmit");
+        AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_VULKAN, "on_vkQueueSubmit");
         return on_vkQueueSubmitTemplate<VkSubmitInfo>(context, input_result, queue, submitCount,
                                                       pSubmits, fence);
     }
 
     VkResult on_vkQueueSubmit2(void* context, VkResult input_result, VkQueue queue,
                                uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
-        AEMU_SCOPED_TRACE("on_vkQueueSubmit2");
+        AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_VULKAN, "on_vkQueueSubmit2");
         return on_vkQueueSubmitTemplate<VkSubmitInfo2>(context, input_result, queue, submitCount,
                                                        pSubmits, fence);
     }
@@ -6077,12 +7692,75 @@ public:
         }
     }
 
+    // With qemu.vk.queue_submit_thread set, submits are copied and handed
+    // to a thread per queue, which flushes the command buffers and encodes
+    // the submit on its own stream; vkQueueSubmit returns once the hand-off
+    // is queued. Host sync points pair the caller's stream with the submit
+    // thread's, so the host takes the submit after everything the caller
+    // encoded before it, and calls that depend on submits having reached
+    // the host wait for the submit threads first.
     template <typename VkSubmitInfoType>
     VkResult on_vkQueueSubmitTemplate(void* context, VkResult input_result, VkQueue queue,
                                       uint32_t submitCount, const VkSubmitInfoType* pSubmits,
                                       VkFence fence) {
-        flushStagingStreams(context, queue, submitCount, pSubmits);
+        noteTimelineSignals(submitCount, pSubmits);
+        noteQueueWork(queue, fence);
+
+        std::shared_ptr<QueueSubmitWorker> worker = getQueueSubmitWorker(queue);
+        if (!worker) {
+            flushStagingStreams(context, queue, submitCount, pSubmits);
+            return submitToQueue(context, input_result, queue, submitCount, pSubmits, fence);
+        }
+
+        // What this waits on may be a submit still held by another queue's
+        // thread.
+        for (uint32_t i = 0; i < submitCount; ++i) {
+            if (getWaitSemaphoreCount(pSubmits[i])) {
+                waitForQueueSubmitThreads(context, VK_NULL_HANDLE, queue /* except */);
+                break;
+            }
+        }
+
+        auto submit = std::make_shared<QueuedSubmit<VkSubmitInfoType>>();
+        if (!captureSubmits(submitCount, pSubmits, submit.get()) ||
+            anySimultaneousUse(submit->commandBuffers)) {
+            waitForQueueSubmitThreads(context, queue);
+            flushStagingStreams(context, queue, submitCount, pSubmits);
+            return submitToQueue(context, input_result, queue, submitCount, pSubmits, fence);
+        }
+        submit->fence = fence;
+
+        // The app may update descriptor sets again as soon as this returns,
+        // so their pending writes go out from this thread.
+        commitPendingDescriptorSets(context, queue, submit->commandBuffers);
+
+        VkEncoder* enc = (VkEncoder*)context;
+        uint32_t sequenceNumber;
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            struct goldfish_VkQueue* q = as_goldfish_VkQueue(queue);
+            sequenceNumber = q->sequenceNumber;
+            q->sequenceNumber += 2;
+            enc->vkQueueHostSyncGOOGLE(queue, true, sequenceNumber + 1, true /* do lock */);
+        }
+        enc->flush();
+
+        worker->enqueue([this, queue, submit, sequenceNumber] {
+            VkEncoder* workerEnc = ResourceTracker::getThreadLocalEncoder();
+            workerEnc->vkQueueHostSyncGOOGLE(queue, true, sequenceNumber + 2, true /* do lock */);
+            flushCommandBufferStreams(workerEnc, queue, submit->commandBuffers);
+            submitToQueue(workerEnc, VK_SUCCESS, queue,
+                          static_cast<uint32_t>(submit->submits.size()), submit->submits.data(),
+                          submit->fence);
+            workerEnc->flush();
+        });
+        return VK_SUCCESS;
+    }
 
+    template <typename VkSubmitInfoType>
+    VkResult submitToQueue(void* context, VkResult input_result, VkQueue queue,
+                           uint32_t submitCount, const VkSubmitInfoType* pSubmits,
+                           VkFence fence) {
         std::vector<VkSemaphore> pre_signal_semaphores;
         std::vector<zx_handle_t> pre_signal_events;
         std::vector<int> pre_signal_sync_fds;
@@ -6220,7 +7898,8 @@ public:
                 auto vkEncoder = ResourceTracker::threadingCallbacks.vkEncoderGetFunc(hostConn);
                 auto waitIdleRes = vkEncoder->vkQueueWaitIdle(queue, true /* do lock */);
 #ifdef VK_USE_PLATFORM_FUCHSIA
-                AEMU_SCOPED_TRACE("on_vkQueueSubmit::SignalSemaphores");
+                AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_VULKAN,
+                                           "on_vkQueueSubmit::SignalSemaphores");
                 (void)externalFenceFdToSignal;
                 for (auto& [event, koid] : post_wait_events) {
 #ifndef FUCHSIA_NO_TRACE
@@ -6256,17 +7935,14 @@ public:
 
         VkEncoder* enc = (VkEncoder*)context;
 
+        waitForQueueSubmitThreads(context, queue);
+
         AutoLock<RecursiveLock> lock(mLock);
         std::vector<WorkPool::WaitGroupHandle> toWait =
             mQueueSensitiveWorkPoolItems[queue];
         mQueueSensitiveWorkPoolItems[queue].clear();
         lock.unlock();
 
-        if (toWait.empty()) {
-            ALOGV("%s: No queue-specific work pool items\n", __func__);
-            return enc->vkQueueWaitIdle(queue, true /* do lock */);
-        }
-
         for (auto handle : toWait) {
             ALOGV("%s: waiting on work group item: %llu\n", __func__,
                   (unsigned long long)handle);
@@ -6274,7 +7950,129 @@ public:
         }
 
         // now done waiting, get the host's opinion
-        return enc->vkQueueWaitIdle(queue, true /* do lock */);
+        uint64_t generation = currentQueueWorkGeneration();
+        VkResult result = enc->vkQueueWaitIdle(queue, true /* do lock */);
+        if (result == VK_SUCCESS) {
+            noteQueuesIdle(generation, [queue](VkQueue q) { return q == queue; });
+        }
+        return result;
+    }
+
+    VkResult on_vkDeviceWaitIdle(void* context, VkResult, VkDevice device) {
+        VkEncoder* enc = (VkEncoder*)context;
+
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
+        uint64_t generation = currentQueueWorkGeneration();
+        VkResult result = enc->vkDeviceWaitIdle(device, true /* do lock */);
+        if (result == VK_SUCCESS) {
+            noteQueuesIdle(generation, [this, device](VkQueue q) {
+                auto it = info_VkQueue.find(q);
+                return it == info_VkQueue.end() || it->second.device == device;
+            });
+        }
+        return result;
+    }
+
+    void noteQueueWork(VkQueue queue, VkFence fence) {
+        AutoLock<RecursiveLock> lock(mLock);
+        mQueuesInFlight[queue] = fence;
+        ++mQueueWorkGeneration;
+        mQueryPoolResultCaches.clear();
+    }
+
+    uint64_t currentQueueWorkGeneration() {
+        AutoLock<RecursiveLock> lock(mLock);
+        return mQueueWorkGeneration;
+    }
+
+    // Forgets the queues matching |isIdle|, unless more work was submitted
+    // since |generation| was read, as the wait may not have covered it.
+    template <typename Pred>
+    void noteQueuesIdle(uint64_t generation, Pred isIdle) {
+        AutoLock<RecursiveLock> lock(mLock);
+        if (generation != mQueueWorkGeneration) return;
+        for (auto it = mQueuesInFlight.begin(); it != mQueuesInFlight.end();) {
+            if (isIdle(it->first)) {
+                it = mQueuesInFlight.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Once every query of a read is available and no queue is busy,
+    // nothing but a new submission or a host reset can change the results,
+    // so reading the same range again is answered locally.
+    VkResult on_vkGetQueryPoolResults(void* context, VkResult, VkDevice device,
+                                      VkQueryPool queryPool, uint32_t firstQuery,
+                                      uint32_t queryCount, size_t dataSize, void* pData,
+                                      VkDeviceSize stride, VkQueryResultFlags flags) {
+        VkEncoder* enc = (VkEncoder*)context;
+
+        uint64_t generation;
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            auto it = mQueryPoolResultCaches.find(queryPool);
+            if (it != mQueryPoolResultCaches.end() && mQueuesInFlight.empty()) {
+                const QueryPoolResultCache& cache = it->second;
+                if (cache.firstQuery == firstQuery && cache.queryCount == queryCount &&
+                    cache.dataSize == dataSize && cache.stride == stride &&
+                    cache.flags == flags) {
+                    memcpy(pData, cache.data.data(), dataSize);
+                    return VK_SUCCESS;
+                }
+            }
+            generation = mQueueWorkGeneration;
+        }
+
+        waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+
+        VkResult result = enc->vkGetQueryPoolResults(device, queryPool, firstQuery, queryCount,
+                                                     dataSize, pData, stride, flags,
+                                                     true /* do lock */);
+        if (result != VK_SUCCESS) return result;
+
+        AutoLock<RecursiveLock> lock(mLock);
+        if (generation == mQueueWorkGeneration && mQueuesInFlight.empty()) {
+            QueryPoolResultCache& cache = mQueryPoolResultCaches[queryPool];
+            cache.firstQuery = firstQuery;
+            cache.queryCount = queryCount;
+            cache.dataSize = dataSize;
+            cache.stride = stride;
+            cache.flags = flags;
+            cache.data.assign((const uint8_t*)pData, (const uint8_t*)pData + dataSize);
+        }
+        return result;
+    }
+
+    void on_vkResetQueryPool(void* context, VkDevice device, VkQueryPool queryPool,
+                             uint32_t firstQuery, uint32_t queryCount) {
+        forgetQueryPoolResults(queryPool);
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkResetQueryPool(device, queryPool, firstQuery, queryCount, true /* do lock */);
+    }
+
+    void on_vkResetQueryPoolEXT(void* context, VkDevice device, VkQueryPool queryPool,
+                                uint32_t firstQuery, uint32_t queryCount) {
+        forgetQueryPoolResults(queryPool);
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkResetQueryPoolEXT(device, queryPool, firstQuery, queryCount, true /* do lock */);
+    }
+
+    void on_vkDestroyQueryPool(void* context, VkDevice device, VkQueryPool queryPool,
+                               const VkAllocationCallbacks* pAllocator) {
+        forgetQueryPoolResults(queryPool);
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkDestroyQueryPool(device, queryPool, pAllocator, true /* do lock */);
+    }
+
+    // Also bumps the generation so that a read racing with the reset does
+    // not store what it got.
+    void forgetQueryPoolResults(VkQueryPool queryPool) {
+        AutoLock<RecursiveLock> lock(mLock);
+        ++mQueueWorkGeneration;
+        mQueryPoolResultCaches.erase(queryPool);
     }
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
@@ -6313,7 +8111,7 @@ public:
 
     void unwrap_vkAcquireImageANDROID_nativeFenceFd(int fd, int*) {
         if (fd != -1) {
-            AEMU_SCOPED_TRACE("waitNativeFenceInAcquire");
+            AEMU_SCOPED_TRACE_CATEGORY(AEMU_TRACE_CATEGORY_VULKAN, "waitNativeFenceInAcquire");
             // Implicit Synchronization
             sync_wait(fd, 3000);
             // From libvulkan's swapchain.cpp:
@@ -6450,7 +8248,6 @@ public:
             const auto& entry = pCreateInfo->pDescriptorUpdateEntries[i];
             uint32_t descCount = entry.descriptorCount;
             VkDescriptorType descType = entry.descriptorType;
-            ++info.templateEntryCount;
             if (isDescriptorTypeInlineUniformBlock(descType)) {
                 inlineUniformBlockBufferSize += descCount;
                 ++info.inlineUniformBlockCount;
@@ -6470,8 +8267,7 @@ public:
             }
         }
 
-        if (info.templateEntryCount)
-            info.templateEntries = new VkDescriptorUpdateTemplateEntry[info.templateEntryCount];
+        info.gathers.resize(pCreateInfo->descriptorUpdateEntryCount);
 
         if (info.imageInfoCount) {
             info.imageInfoIndices = new uint32_t[info.imageInfoCount];
@@ -6490,25 +8286,44 @@ public:
 
         if (info.inlineUniformBlockCount) {
             info.inlineUniformBlockBuffer.resize(inlineUniformBlockBufferSize);
-            info.inlineUniformBlockBytesPerBlocks.resize(info.inlineUniformBlockCount);
         }
 
         uint32_t imageInfoIndex = 0;
         uint32_t bufferInfoIndex = 0;
         uint32_t bufferViewIndex = 0;
-        uint32_t inlineUniformBlockIndex = 0;
+        uint32_t inlineUniformBlockOffset = 0;
 
         for (uint32_t i = 0; i < pCreateInfo->descriptorUpdateEntryCount; ++i) {
             const auto& entry = pCreateInfo->pDescriptorUpdateEntries[i];
             uint32_t descCount = entry.descriptorCount;
             VkDescriptorType descType = entry.descriptorType;
 
-            info.templateEntries[i] = entry;
+            auto& gather = info.gathers[i];
+            gather.descriptorType = descType;
+            gather.dstBinding = entry.dstBinding;
+            gather.dstArrayElement = entry.dstArrayElement;
+            gather.descriptorCount = descCount;
+            gather.srcOffset = entry.offset;
+            gather.srcStride = entry.stride;
+            gather.copyCount = descCount;
+            if (isDescriptorTypeImageInfo(descType)) {
+                gather.copySize = sizeof(VkDescriptorImageInfo);
+                gather.dst = (uint8_t*)(info.imageInfos + imageInfoIndex);
+            } else if (isDescriptorTypeBufferInfo(descType)) {
+                gather.copySize = sizeof(VkDescriptorBufferInfo);
+                gather.dst = (uint8_t*)(info.bufferInfos + bufferInfoIndex);
+            } else if (isDescriptorTypeBufferView(descType)) {
+                gather.copySize = sizeof(VkBufferView);
+                gather.dst = (uint8_t*)(info.bufferViews + bufferViewIndex);
+            } else if (isDescriptorTypeInlineUniformBlock(descType)) {
+                gather.copyCount = 1;
+                gather.copySize = descCount;
+                gather.dst = info.inlineUniformBlockBuffer.data() + inlineUniformBlockOffset;
+                inlineUniformBlockOffset += descCount;
+            }
+            if (!gather.srcStride) gather.srcStride = gather.copySize;
 
-            if (isDescriptorTypeInlineUniformBlock(descType)) {
-                info.inlineUniformBlockBytesPerBlocks[inlineUniformBlockIndex] = descCount;
-                ++inlineUniformBlockIndex;
-            } else {
+            if (!isDescriptorTypeInlineUniformBlock(descType)) {
                 for (uint32_t j = 0; j < descCount; ++j) {
                     if (isDescriptorTypeImageInfo(descType)) {
                         info.imageInfoIndices[imageInfoIndex] = i;
@@ -6584,13 +8399,12 @@ public:
 
         auto& info = it->second;
 
-        uint32_t templateEntryCount = info.templateEntryCount;
-        VkDescriptorUpdateTemplateEntry* templateEntries = info.templateEntries;
+        const DescriptorUpdateTemplateGather* gathers = info.gathers.data();
+        const size_t gatherCount = info.gathers.size();
 
         uint32_t imageInfoCount = info.imageInfoCount;
         uint32_t bufferInfoCount = info.bufferInfoCount;
         uint32_t bufferViewCount = info.bufferViewCount;
-        uint32_t inlineUniformBlockCount = info.inlineUniformBlockCount;
         uint32_t* imageInfoIndices = info.imageInfoIndices;
         uint32_t* bufferInfoIndices = info.bufferInfoIndices;
         uint32_t* bufferViewIndices = info.bufferViewIndices;
@@ -6598,122 +8412,49 @@ public:
         VkDescriptorBufferInfo* bufferInfos = info.bufferInfos;
         VkBufferView* bufferViews = info.bufferViews;
         uint8_t* inlineUniformBlockBuffer = info.inlineUniformBlockBuffer.data();
-        uint32_t* inlineUniformBlockBytesPerBlocks = info.inlineUniformBlockBytesPerBlocks.data();
 
         lock.unlock();
 
-        size_t currImageInfoOffset = 0;
-        size_t currBufferInfoOffset = 0;
-        size_t currBufferViewOffset = 0;
-        size_t inlineUniformBlockOffset = 0;
-        size_t inlineUniformBlockIdx = 0;
-
         struct goldfish_VkDescriptorSet* ds = as_goldfish_VkDescriptorSet(descriptorSet);
         ReifiedDescriptorSet* reified = ds->reified;
 
         bool batched = mFeatureInfo->hasVulkanBatchedDescriptorSetUpdate;
 
-        for (uint32_t i = 0; i < templateEntryCount; ++i) {
-            const auto& entry = templateEntries[i];
-            VkDescriptorType descType = entry.descriptorType;
-            uint32_t dstBinding = entry.dstBinding;
+        for (size_t i = 0; i < gatherCount; ++i) {
+            const auto& gather = gathers[i];
+            const uint8_t* src = userBuffer + gather.srcOffset;
 
-            auto offset = entry.offset;
-            auto stride = entry.stride;
-            auto dstArrayElement = entry.dstArrayElement;
+            // Tightly packed entries, the common layout, are one copy.
+            if (gather.srcStride == gather.copySize) {
+                memcpy(gather.dst, src, size_t(gather.copyCount) * gather.copySize);
+            } else {
+                uint8_t* dst = gather.dst;
+                for (uint32_t j = 0; j < gather.copyCount; ++j) {
+                    memcpy(dst, src, gather.copySize);
+                    dst += gather.copySize;
+                    src += gather.srcStride;
+                }
+            }
 
-            uint32_t descCount = entry.descriptorCount;
+            if (!batched) continue;
 
+            VkDescriptorType descType = gather.descriptorType;
             if (isDescriptorTypeImageInfo(descType)) {
-
-                if (!stride) stride = sizeof(VkDescriptorImageInfo);
-
-                const VkDescriptorImageInfo* currImageInfoBegin =
-                    (const VkDescriptorImageInfo*)((uint8_t*)imageInfos + currImageInfoOffset);
-
-                for (uint32_t j = 0; j < descCount; ++j) {
-                    const VkDescriptorImageInfo* user =
-                        (const VkDescriptorImageInfo*)(userBuffer + offset + j * stride);
-
-                    memcpy(((uint8_t*)imageInfos) + currImageInfoOffset,
-                           user, sizeof(VkDescriptorImageInfo));
-                    currImageInfoOffset += sizeof(VkDescriptorImageInfo);
-                }
-
-                if (batched) {
-                  doEmulatedDescriptorImageInfoWriteFromTemplate(
-                        descType,
-                        dstBinding,
-                        dstArrayElement,
-                        descCount,
-                        currImageInfoBegin,
-                        reified);
-                }
+                doEmulatedDescriptorImageInfoWriteFromTemplate(
+                    descType, gather.dstBinding, gather.dstArrayElement, gather.descriptorCount,
+                    (const VkDescriptorImageInfo*)gather.dst, reified);
             } else if (isDescriptorTypeBufferInfo(descType)) {
-
-
-                if (!stride) stride = sizeof(VkDescriptorBufferInfo);
-
-                const VkDescriptorBufferInfo* currBufferInfoBegin =
-                    (const VkDescriptorBufferInfo*)((uint8_t*)bufferInfos + currBufferInfoOffset);
-
-                for (uint32_t j = 0; j < descCount; ++j) {
-                    const VkDescriptorBufferInfo* user =
-                        (const VkDescriptorBufferInfo*)(userBuffer + offset + j * stride);
-
-                    memcpy(((uint8_t*)bufferInfos) + currBufferInfoOffset,
-                           user, sizeof(VkDescriptorBufferInfo));
-                    currBufferInfoOffset += sizeof(VkDescriptorBufferInfo);
-                }
-
-                if (batched) {
-                  doEmulatedDescriptorBufferInfoWriteFromTemplate(
-                        descType,
-                        dstBinding,
-                        dstArrayElement,
-                        descCount,
-                        currBufferInfoBegin,
-                        reified);
-                }
-
+                doEmulatedDescriptorBufferInfoWriteFromTemplate(
+                    descType, gather.dstBinding, gather.dstArrayElement, gather.descriptorCount,
+                    (const VkDescriptorBufferInfo*)gather.dst, reified);
             } else if (isDescriptorTypeBufferView(descType)) {
-                if (!stride) stride = sizeof(VkBufferView);
-
-                const VkBufferView* currBufferViewBegin =
-                    (const VkBufferView*)((uint8_t*)bufferViews + currBufferViewOffset);
-
-                for (uint32_t j = 0; j < descCount; ++j) {
-                  const VkBufferView* user =
-                      (const VkBufferView*)(userBuffer + offset + j * stride);
-
-                  memcpy(((uint8_t*)bufferViews) + currBufferViewOffset, user,
-                         sizeof(VkBufferView));
-                  currBufferViewOffset += sizeof(VkBufferView);
-                }
-
-                if (batched) {
-                  doEmulatedDescriptorBufferViewWriteFromTemplate(descType, dstBinding,
-                                                                  dstArrayElement, descCount,
-                                                                  currBufferViewBegin, reified);
-                }
+                doEmulatedDescriptorBufferViewWriteFromTemplate(
+                    descType, gather.dstBinding, gather.dstArrayElement, gather.descriptorCount,
+                    (const VkBufferView*)gather.dst, reified);
             } else if (isDescriptorTypeInlineUniformBlock(descType)) {
-                uint32_t inlineUniformBlockBytesPerBlock =
-                    inlineUniformBlockBytesPerBlocks[inlineUniformBlockIdx];
-                uint8_t* currInlineUniformBlockBufferBegin =
-                    inlineUniformBlockBuffer + inlineUniformBlockOffset;
-                memcpy(currInlineUniformBlockBufferBegin, userBuffer + offset,
-                       inlineUniformBlockBytesPerBlock);
-                inlineUniformBlockIdx++;
-                inlineUniformBlockOffset += inlineUniformBlockBytesPerBlock;
-
-                if (batched) {
-                  doEmulatedDescriptorInlineUniformBlockFromTemplate(
-                      descType, dstBinding, dstArrayElement, descCount,
-                      currInlineUniformBlockBufferBegin, reified);
-                }
-            } else {
-                ALOGE("%s: FATAL: Unknown descriptor type %d\n", __func__, descType);
-                abort();
+                doEmulatedDescriptorInlineUniformBlockFromTemplate(
+                    descType, gather.dstBinding, gather.dstArrayElement, gather.descriptorCount,
+                    gather.dst, reified);
             }
         }
 
@@ -6797,7 +8538,12 @@ public:
         }
         VkResult hostRes;
 
-        if (isKhr) {
+        if (!pImageFormatInfo->pNext && !pImageFormatProperties->pNext) {
+            hostRes = getPhysicalDeviceImageFormatProperties(
+                context, physicalDevice, pImageFormatInfo->format, pImageFormatInfo->type,
+                pImageFormatInfo->tiling, pImageFormatInfo->usage, pImageFormatInfo->flags,
+                &pImageFormatProperties->imageFormatProperties);
+        } else if (isKhr) {
             hostRes = enc->vkGetPhysicalDeviceImageFormatProperties2KHR(
                 physicalDevice, pImageFormatInfo,
                 pImageFormatProperties, true /* do lock */);
@@ -7062,6 +8808,9 @@ public:
 
         struct goldfish_VkCommandBuffer* cb = as_goldfish_VkCommandBuffer(commandBuffer);
         cb->flags = pBeginInfo->flags;
+        if (cb->stateShadow) {
+            cb->stateShadow->reset();
+        }
 
         VkCommandBufferBeginInfo modifiedBeginInfo;
 
@@ -7147,7 +8896,99 @@ public:
         }
 #endif
 
-        return enc->vkCreateImageView(device, &localCreateInfo, pAllocator, pView, true /* do lock */);
+        if (!localCreateInfo.pNext) {
+            if (uint64_t handle = takeReservedHandle(enc, device)) {
+                enc->vkCreateImageViewAsyncGOOGLE(device, &localCreateInfo, handle, pView,
+                                                  true /* do lock */);
+                enc->flush();
+                return VK_SUCCESS;
+            }
+        }
+        return enc->encodeCreateImageView(device, &localCreateInfo, pAllocator, pView, true /* do lock */);
+    }
+
+    VkResult on_vkCreateFramebuffer(
+        void* context, VkResult,
+        VkDevice device,
+        const VkFramebufferCreateInfo* pCreateInfo,
+        const VkAllocationCallbacks* pAllocator,
+        VkFramebuffer* pFramebuffer) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!pCreateInfo->pNext) {
+            if (uint64_t handle = takeReservedHandle(enc, device)) {
+                enc->vkCreateFramebufferAsyncGOOGLE(device, pCreateInfo, handle, pFramebuffer,
+                                                    true /* do lock */);
+                enc->flush();
+                return VK_SUCCESS;
+            }
+        }
+        return enc->vkCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer,
+                                        true /* do lock */);
+    }
+
+    // Finds the commands |secondary| recorded between its begin and end,
+    // as runs of whole packets in its staging stream. Returns false if the
+    // stream does not hold exactly one complete recording small enough to
+    // be worth copying, or if the secondary may run inside a render pass:
+    // a subpass begun for secondary command buffers takes no inline
+    // commands.
+    bool getInlinableCommands(struct goldfish_VkCommandBuffer* secondary,
+                              std::vector<std::pair<const uint8_t*, size_t>>* runs) {
+        static constexpr size_t kMaxInlinedSize = 64 * 1024;
+
+        if (!secondary->isSecondary || !secondary->privateStream ||
+            (secondary->flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
+            return false;
+        }
+
+        bool ok = true;
+        bool begun = false;
+        bool ended = false;
+        size_t total = 0;
+        CommandBufferStagingStream* stream =
+            static_cast<CommandBufferStagingStream*>(secondary->privateStream);
+        stream->forEachWritten([&](unsigned char* data, size_t size) {
+            size_t pos = 0;
+            size_t runStart = 0;
+            while (ok && pos < size) {
+                uint32_t opcode;
+                uint32_t packetSize;
+                if (ended || size - pos < 2 * sizeof(uint32_t)) {
+                    ok = false;
+                    break;
+                }
+                memcpy(&opcode, data + pos, sizeof(uint32_t));
+                memcpy(&packetSize, data + pos + sizeof(uint32_t), sizeof(uint32_t));
+                if (packetSize < 2 * sizeof(uint32_t) || packetSize > size - pos) {
+                    ok = false;
+                    break;
+                }
+                switch (opcode) {
+                    case OP_vkBeginCommandBufferAsyncGOOGLE:
+                        ok = !begun;
+                        begun = true;
+                        runStart = pos + packetSize;
+                        break;
+                    case OP_vkEndCommandBufferAsyncGOOGLE:
+                        if (pos > runStart) runs->emplace_back(data + runStart, pos - runStart);
+                        ended = true;
+                        break;
+                    case OP_vkResetCommandBufferAsyncGOOGLE:
+                    case OP_vkCommandBufferHostSyncGOOGLE:
+                        ok = false;
+                        break;
+                    default:
+                        ok = begun;
+                        total += packetSize;
+                        break;
+                }
+                pos += packetSize;
+            }
+            if (ok && !ended && pos > runStart) {
+                runs->emplace_back(data + runStart, pos - runStart);
+            }
+        });
+        return ok && ended && total <= kMaxInlinedSize;
     }
 
     void on_vkCmdExecuteCommands(
@@ -7158,19 +8999,66 @@ public:
 
         VkEncoder* enc = (VkEncoder*)context;
 
+        // Secondaries leave the primary's dynamic state undefined.
+        getStateShadow(commandBuffer)->reset();
+
         if (!mFeatureInfo->hasVulkanQueueSubmitWithCommands) {
             enc->vkCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, true /* do lock */);
             return;
         }
 
         struct goldfish_VkCommandBuffer* primary = as_goldfish_VkCommandBuffer(commandBuffer);
+        if (!mInlineSecondaryCommandBuffers) {
+            for (uint32_t i = 0; i < commandBufferCount; ++i) {
+                struct goldfish_VkCommandBuffer* secondary = as_goldfish_VkCommandBuffer(pCommandBuffers[i]);
+                appendObject(&secondary->superObjects, primary);
+                appendObject(&primary->subObjects, secondary);
+            }
+
+            enc->vkCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, true /* do lock */);
+            return;
+        }
+
+        // Inlined secondaries are copied as they are now, so they are not
+        // linked to the primary: recording them again invalidates the
+        // primary anyway. Their commands stay in their own stream in case
+        // another primary executes them by reference.
+        std::vector<VkCommandBuffer> referenced;
+        std::vector<std::pair<const uint8_t*, size_t>> runs;
+        auto executeReferenced = [&]() {
+            if (referenced.empty()) return;
+            for (VkCommandBuffer cmdbuf : referenced) {
+                struct goldfish_VkCommandBuffer* secondary = as_goldfish_VkCommandBuffer(cmdbuf);
+                appendObject(&secondary->superObjects, primary);
+                appendObject(&primary->subObjects, secondary);
+            }
+            enc->vkCmdExecuteCommands(commandBuffer, (uint32_t)referenced.size(),
+                                      referenced.data(), true /* do lock */);
+            referenced.clear();
+        };
+
         for (uint32_t i = 0; i < commandBufferCount; ++i) {
             struct goldfish_VkCommandBuffer* secondary = as_goldfish_VkCommandBuffer(pCommandBuffers[i]);
-            appendObject(&secondary->superObjects, primary);
-            appendObject(&primary->subObjects, secondary);
-        }
+            runs.clear();
+            if (!getInlinableCommands(secondary, &runs)) {
+                referenced.push_back(pCommandBuffers[i]);
+                continue;
+            }
 
-        enc->vkCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, true /* do lock */);
+            executeReferenced();
+            for (const auto& run : runs) {
+                enc->appendEncodedCommands(run.first, run.second, true /* do lock */);
+            }
+            // The primary gets a copy of the pending descriptor sets. The
+            // secondary keeps its own for primaries that execute it by
+            // reference.
+            const auto* pendingSets = (CommandBufferPendingDescriptorSets*)secondary->userPtr;
+            if (pendingSets && !pendingSets->sets.empty()) {
+                std::vector<VkDescriptorSet> sets(pendingSets->sets.begin(), pendingSets->sets.end());
+                addPendingDescriptorSets(commandBuffer, (uint32_t)sets.size(), sets.data());
+            }
+        }
+        executeReferenced();
     }
 
     void addPendingDescriptorSets(VkCommandBuffer commandBuffer, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) {
@@ -7206,7 +9094,7 @@ public:
         if (mFeatureInfo->hasVulkanBatchedDescriptorSetUpdate)
             addPendingDescriptorSets(commandBuffer, descriptorSetCount, pDescriptorSets);
 
-        enc->vkCmdBindDescriptorSets(
+        enc->encodeCmdBindDescriptorSets(
             commandBuffer,
             pipelineBindPoint,
             layout,
@@ -7218,6 +9106,253 @@ public:
             true /* do lock */);
     }
 
+    CommandBufferStateShadow* getStateShadow(VkCommandBuffer commandBuffer) {
+        struct goldfish_VkCommandBuffer* cb = as_goldfish_VkCommandBuffer(commandBuffer);
+        if (!cb->stateShadow) {
+            cb->stateShadow = new CommandBufferStateShadow;
+        }
+        return cb->stateShadow;
+    }
+
+    void on_vkCmdBindPipeline(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkPipelineBindPoint pipelineBindPoint,
+        VkPipeline pipeline) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            getStateShadow(commandBuffer)->onGraphicsPipelineBound();
+        }
+        enc->vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, true /* do lock */);
+    }
+
+    void on_vkCmdSetViewport(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t firstViewport,
+        uint32_t viewportCount,
+        const VkViewport* pViewports) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setViewports(firstViewport, viewportCount, pViewports)) {
+            return;
+        }
+        enc->vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports,
+                              true /* do lock */);
+    }
+
+    void on_vkCmdSetScissor(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t firstScissor,
+        uint32_t scissorCount,
+        const VkRect2D* pScissors) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setScissors(firstScissor, scissorCount, pScissors)) {
+            return;
+        }
+        enc->vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors,
+                             true /* do lock */);
+    }
+
+    void on_vkCmdSetViewportWithCount(
+        void* context,
+        bool isExt,
+        VkCommandBuffer commandBuffer,
+        uint32_t viewportCount,
+        const VkViewport* pViewports) {
+        VkEncoder* enc = (VkEncoder*)context;
+        getStateShadow(commandBuffer)->invalidateViewports();
+        if (isExt) {
+            enc->vkCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports,
+                                              true /* do lock */);
+        } else {
+            enc->vkCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports,
+                                           true /* do lock */);
+        }
+    }
+
+    void on_vkCmdSetScissorWithCount(
+        void* context,
+        bool isExt,
+        VkCommandBuffer commandBuffer,
+        uint32_t scissorCount,
+        const VkRect2D* pScissors) {
+        VkEncoder* enc = (VkEncoder*)context;
+        getStateShadow(commandBuffer)->invalidateScissors();
+        if (isExt) {
+            enc->vkCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors,
+                                             true /* do lock */);
+        } else {
+            enc->vkCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors,
+                                          true /* do lock */);
+        }
+    }
+
+    void on_vkCmdSetLineWidth(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        float lineWidth) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setLineWidth(lineWidth)) {
+            return;
+        }
+        enc->vkCmdSetLineWidth(commandBuffer, lineWidth, true /* do lock */);
+    }
+
+    void on_vkCmdSetDepthBias(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        float depthBiasConstantFactor,
+        float depthBiasClamp,
+        float depthBiasSlopeFactor) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setDepthBias(
+                depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor)) {
+            return;
+        }
+        enc->vkCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp,
+                               depthBiasSlopeFactor, true /* do lock */);
+    }
+
+    void on_vkCmdSetBlendConstants(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        const float blendConstants[4]) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setBlendConstants(blendConstants)) {
+            return;
+        }
+        enc->vkCmdSetBlendConstants(commandBuffer, blendConstants, true /* do lock */);
+    }
+
+    void on_vkCmdSetDepthBounds(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        float minDepthBounds,
+        float maxDepthBounds) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setDepthBounds(minDepthBounds, maxDepthBounds)) {
+            return;
+        }
+        enc->vkCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds,
+                                 true /* do lock */);
+    }
+
+    void on_vkCmdSetStencilCompareMask(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkStencilFaceFlags faceMask,
+        uint32_t compareMask) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setStencilCompareMask(faceMask, compareMask)) {
+            return;
+        }
+        enc->vkCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask,
+                                        true /* do lock */);
+    }
+
+    void on_vkCmdSetStencilWriteMask(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkStencilFaceFlags faceMask,
+        uint32_t writeMask) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setStencilWriteMask(faceMask, writeMask)) {
+            return;
+        }
+        enc->vkCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask, true /* do lock */);
+    }
+
+    void on_vkCmdSetStencilReference(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkStencilFaceFlags faceMask,
+        uint32_t reference) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->setStencilReference(faceMask, reference)) {
+            return;
+        }
+        enc->vkCmdSetStencilReference(commandBuffer, faceMask, reference, true /* do lock */);
+    }
+
+    void on_vkCmdPushConstants(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkPipelineLayout layout,
+        VkShaderStageFlags stageFlags,
+        uint32_t offset,
+        uint32_t size,
+        const void* pValues) {
+        VkEncoder* enc = (VkEncoder*)context;
+        if (!getStateShadow(commandBuffer)->pushConstants(layout, stageFlags, offset, size,
+                                                          pValues)) {
+            return;
+        }
+        enc->encodeCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues,
+                                    true /* do lock */);
+    }
+
+    void on_vkCmdDraw(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t vertexCount,
+        uint32_t instanceCount,
+        uint32_t firstVertex,
+        uint32_t firstInstance) {
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->encodeCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance,
+                           true /* do lock */);
+    }
+
+    void on_vkCmdDrawIndexed(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t indexCount,
+        uint32_t instanceCount,
+        uint32_t firstIndex,
+        int32_t vertexOffset,
+        uint32_t firstInstance) {
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->encodeCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex,
+                                  vertexOffset, firstInstance, true /* do lock */);
+    }
+
+    void on_vkCmdDrawIndirect(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkBuffer buffer,
+        VkDeviceSize offset,
+        uint32_t drawCount,
+        uint32_t stride) {
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->encodeCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride,
+                                   true /* do lock */);
+    }
+
+    void on_vkCmdDrawIndexedIndirect(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkBuffer buffer,
+        VkDeviceSize offset,
+        uint32_t drawCount,
+        uint32_t stride) {
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->encodeCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride,
+                                          true /* do lock */);
+    }
+
+    void on_vkCmdCopyBuffer(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkBuffer srcBuffer,
+        VkBuffer dstBuffer,
+        uint32_t regionCount,
+        const VkBufferCopy* pRegions) {
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->encodeCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions,
+                                 true /* do lock */);
+    }
+
     void on_vkCmdPipelineBarrier(
         void* context,
         VkCommandBuffer commandBuffer,
@@ -7260,18 +9395,62 @@ public:
             }
 #endif
 
-            updatedImageMemoryBarriers.push_back(barrier);
+            if (isNoOpImageBarrier(barrier)) continue;
+            bool duplicate = false;
+            for (const VkImageMemoryBarrier& kept : updatedImageMemoryBarriers) {
+                if (sameImageBarrier(kept, barrier)) {
+                    duplicate = true;
+                    break;
+                }
+            }
+            if (!duplicate) updatedImageMemoryBarriers.push_back(barrier);
+        }
+
+        // Global memory barriers all apply to the same memory, so one with
+        // the union of their access masks does what all of them did.
+        std::vector<VkMemoryBarrier> updatedMemoryBarriers;
+        for (uint32_t i = 0; i < memoryBarrierCount; i++) {
+            const VkMemoryBarrier& barrier = pMemoryBarriers[i];
+            if (isNoOpMemoryBarrier(barrier)) continue;
+            if (!barrier.pNext && !updatedMemoryBarriers.empty() &&
+                !updatedMemoryBarriers[0].pNext) {
+                updatedMemoryBarriers[0].srcAccessMask |= barrier.srcAccessMask;
+                updatedMemoryBarriers[0].dstAccessMask |= barrier.dstAccessMask;
+                continue;
+            }
+            updatedMemoryBarriers.push_back(barrier);
+        }
+
+        std::vector<VkBufferMemoryBarrier> updatedBufferMemoryBarriers;
+        updatedBufferMemoryBarriers.reserve(bufferMemoryBarrierCount);
+        for (uint32_t i = 0; i < bufferMemoryBarrierCount; i++) {
+            const VkBufferMemoryBarrier& barrier = pBufferMemoryBarriers[i];
+            if (isNoOpBufferBarrier(barrier)) continue;
+            if (!updatedBufferMemoryBarriers.empty() &&
+                mergeBufferBarrier(&updatedBufferMemoryBarriers.back(), barrier)) {
+                continue;
+            }
+            updatedBufferMemoryBarriers.push_back(barrier);
         }
 
-        enc->vkCmdPipelineBarrier(
+        // Without barriers, a dependency on nothing having run yet, or of
+        // nothing that runs later, does not order anything.
+        if (updatedMemoryBarriers.empty() && updatedBufferMemoryBarriers.empty() &&
+            updatedImageMemoryBarriers.empty() &&
+            (srcStageMask == VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT ||
+             dstStageMask == VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT)) {
+            return;
+        }
+
+        enc->encodeCmdPipelineBarrier(
             commandBuffer,
             srcStageMask,
             dstStageMask,
             dependencyFlags,
-            memoryBarrierCount,
-            pMemoryBarriers,
-            bufferMemoryBarrierCount,
-            pBufferMemoryBarriers,
+            updatedMemoryBarriers.size(),
+            updatedMemoryBarriers.data(),
+            updatedBufferMemoryBarriers.size(),
+            updatedBufferMemoryBarriers.data(),
             updatedImageMemoryBarriers.size(),
             updatedImageMemoryBarriers.data(),
             true /* do lock */);
@@ -7318,13 +9497,17 @@ public:
             struct goldfish_VkCommandBuffer* cb = as_goldfish_VkCommandBuffer(pCommandBuffers[i]);
             cb->isSecondary = pAllocateInfo->level == VK_COMMAND_BUFFER_LEVEL_SECONDARY;
             cb->device = device;
+            cb->stateShadow = nullptr;
         }
 
         return res;
     }
 
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-    VkResult exportSyncFdForQSRILocked(VkImage image, int *fd) {
+    // Creates the fence that signals once the host is done with the release
+    // of |image|. Takes no lock: the ioctl can wait on the host, and every
+    // other Vulkan call of the process would wait with it.
+    VkResult exportSyncFdForQSRI(VkImage image, int *fd) {
 
         ALOGV("%s: call for image %p hos timage handle 0x%llx\n", __func__, (void*)image,
               (unsigned long long)get_host_u64_VkImage(image));
@@ -7348,7 +9531,10 @@ public:
 
             *fd = exec.handle.osHandle;
         } else {
-            ensureSyncDeviceFd();
+            {
+                AutoLock<RecursiveLock> lock(mLock);
+                ensureSyncDeviceFd();
+            }
             goldfish_sync_queue_work(
                     mSyncDeviceFd,
                     get_host_u64_VkImage(image) /* the handle */,
@@ -7357,38 +9543,37 @@ public:
         }
 
         ALOGV("%s: got fd: %d\n", __func__, *fd);
-        auto imageInfoIt = info_VkImage.find(image);
-        if (imageInfoIt != info_VkImage.end()) {
-            auto& imageInfo = imageInfoIt->second;
-
-            // Remove any pending QSRI sync fds that are already signaled.
-            auto syncFdIt = imageInfo.pendingQsriSyncFds.begin();
-            while (syncFdIt != imageInfo.pendingQsriSyncFds.end()) {
-                int syncFd = *syncFdIt;
-                int syncWaitRet = sync_wait(syncFd, /*timeout msecs*/0);
-                if (syncWaitRet == 0) {
-                    // Sync fd is signaled.
-                    syncFdIt = imageInfo.pendingQsriSyncFds.erase(syncFdIt);
-                    close(syncFd);
-                } else {
-                    if (errno != ETIME) {
-                        ALOGE("%s: Failed to wait for pending QSRI sync: sterror: %s errno: %d",
-                              __func__, strerror(errno), errno);
-                    }
-                    break;
-                }
-            }
+        return VK_SUCCESS;
+    }
 
-            int syncFdDup = dup(*fd);
-            if (syncFdDup < 0) {
-                ALOGE("%s: Failed to dup() QSRI sync fd : sterror: %s errno: %d",
-                      __func__, strerror(errno), errno);
+    // Keeps |syncFd|, a QSRI fence of |image|, for vkDestroyImage to wait on.
+    void trackQsriSyncFdLocked(VkImage image, int syncFd) {
+        auto imageInfoIt = info_VkImage.find(image);
+        if (imageInfoIt == info_VkImage.end()) {
+            close(syncFd);
+            return;
+        }
+        auto& imageInfo = imageInfoIt->second;
+
+        // Remove any pending QSRI sync fds that are already signaled.
+        auto syncFdIt = imageInfo.pendingQsriSyncFds.begin();
+        while (syncFdIt != imageInfo.pendingQsriSyncFds.end()) {
+            int pendingFd = *syncFdIt;
+            int syncWaitRet = sync_wait(pendingFd, /*timeout msecs*/0);
+            if (syncWaitRet == 0) {
+                // Sync fd is signaled.
+                syncFdIt = imageInfo.pendingQsriSyncFds.erase(syncFdIt);
+                close(pendingFd);
             } else {
-                imageInfo.pendingQsriSyncFds.push_back(syncFdDup);
+                if (errno != ETIME) {
+                    ALOGE("%s: Failed to wait for pending QSRI sync: sterror: %s errno: %d",
+                          __func__, strerror(errno), errno);
+                }
+                break;
             }
         }
 
-        return VK_SUCCESS;
+        imageInfo.pendingQsriSyncFds.push_back(syncFd);
     }
 
     VkResult on_vkQueueSignalReleaseImageANDROID(
@@ -7404,6 +9589,18 @@ public:
 
         VkEncoder* enc = (VkEncoder*)context;
 
+        // Once per presented image, like eglSwapBuffers does for GLES.
+        android::base::guest::reportGraphicsMemory();
+
+        // As for vkQueueSubmit: the release follows the submits of its own
+        // queue, and the other queues' only if it waits on semaphores one
+        // of them may signal.
+        if (waitSemaphoreCount) {
+            waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+        } else {
+            waitForQueueSubmitThreads(context, queue);
+        }
+
         if (!mFeatureInfo->hasVulkanAsyncQsri) {
             return enc->vkQueueSignalReleaseImageANDROID(queue, waitSemaphoreCount, pWaitSemaphores, image, pNativeFenceFd, true /* lock */);
         }
@@ -7419,20 +9616,28 @@ public:
 
         enc->vkQueueSignalReleaseImageANDROIDAsyncGOOGLE(queue, waitSemaphoreCount, pWaitSemaphores, image, true /* lock */);
 
-        AutoLock<RecursiveLock> lock(mLock);
-        VkResult result;
-        if (pNativeFenceFd) {
-            result =
-                exportSyncFdForQSRILocked(image, pNativeFenceFd);
-        } else {
-            int syncFd;
-            result = exportSyncFdForQSRILocked(image, &syncFd);
+        int syncFd = -1;
+        VkResult result = exportSyncFdForQSRI(image, &syncFd);
+        if (result != VK_SUCCESS || syncFd < 0) {
+            if (pNativeFenceFd) *pNativeFenceFd = -1;
+            return result;
+        }
 
-            if (syncFd >= 0)
-                close(syncFd);
+        // Without a caller to hand it to, the fence is only kept.
+        int trackedFd = syncFd;
+        if (pNativeFenceFd) {
+            *pNativeFenceFd = syncFd;
+            trackedFd = dup(syncFd);
+            if (trackedFd < 0) {
+                ALOGE("%s: Failed to dup() QSRI sync fd : sterror: %s errno: %d",
+                      __func__, strerror(errno), errno);
+                return VK_SUCCESS;
+            }
         }
 
-        return result;
+        AutoLock<RecursiveLock> lock(mLock);
+        trackQsriSyncFdLocked(image, trackedFd);
+        return VK_SUCCESS;
     }
 #endif
 
@@ -7504,8 +9709,220 @@ public:
                 }
             }
         }
-        return enc->vkCreateGraphicsPipelines(device, pipelineCache, localCreateInfos.size(),
-                localCreateInfos.data(), pAllocator, pPipelines, true /* do lock */);
+
+        // basePipelineIndex refers to positions in the array, which must
+        // not move.
+        bool dedup = true;
+        for (const auto& info : localCreateInfos) {
+            dedup &= !(info.flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT);
+        }
+        if (!dedup) {
+            return enc->encodeCreateGraphicsPipelines(device, pipelineCache,
+                    localCreateInfos.size(), localCreateInfos.data(), pAllocator, pPipelines,
+                    true /* do lock */);
+        }
+
+        // Only the create infos that match no existing pipeline go to the host.
+        std::vector<std::string> keys(createInfoCount);
+        std::vector<bool> shared(createInfoCount, false);
+        std::vector<VkGraphicsPipelineCreateInfo> missInfos;
+        std::vector<uint32_t> missIndices;
+        for (uint32_t i = 0; i < createInfoCount; ++i) {
+            pPipelines[i] = VK_NULL_HANDLE;
+            if (mPipelineDedup.makeKey(device, localCreateInfos[i], &keys[i])) {
+                pPipelines[i] = mPipelineDedup.acquire(keys[i]);
+                shared[i] = pPipelines[i] != VK_NULL_HANDLE;
+            }
+            if (!shared[i]) {
+                missInfos.push_back(localCreateInfos[i]);
+                missIndices.push_back(i);
+            }
+        }
+        if (missInfos.empty()) return VK_SUCCESS;
+
+        std::vector<VkPipeline> created(missInfos.size(), VK_NULL_HANDLE);
+        VkResult res = enc->encodeCreateGraphicsPipelines(device, pipelineCache,
+                missInfos.size(), missInfos.data(), pAllocator, created.data(),
+                true /* do lock */);
+
+        for (size_t j = 0; j < missIndices.size(); ++j) {
+            const uint32_t i = missIndices[j];
+            pPipelines[i] = created[j];
+            if (created[j] && !keys[i].empty()) {
+                mPipelineDedup.insert(keys[i], created[j], localCreateInfos[i].layout,
+                                      localCreateInfos[i].renderPass);
+            }
+        }
+
+        // Apps generally assume nothing was created on failure; give back
+        // the shared pipelines rather than leak references to them.
+        if (res < 0) {
+            for (uint32_t i = 0; i < createInfoCount; ++i) {
+                if (!shared[i]) continue;
+                if (mPipelineDedup.release(pPipelines[i])) {
+                    enc->vkDestroyPipeline(device, pPipelines[i], pAllocator, true /* do lock */);
+                }
+                pPipelines[i] = VK_NULL_HANDLE;
+            }
+        }
+        return res;
+    }
+
+    VkResult on_vkCreateComputePipelines(
+        void* context,
+        VkResult input_result,
+        VkDevice device,
+        VkPipelineCache pipelineCache,
+        uint32_t createInfoCount,
+        const VkComputePipelineCreateInfo* pCreateInfos,
+        const VkAllocationCallbacks* pAllocator,
+        VkPipeline* pPipelines) {
+        (void)input_result;
+        VkEncoder* enc = (VkEncoder*)context;
+        return enc->encodeCreateComputePipelines(device, pipelineCache, createInfoCount,
+                pCreateInfos, pAllocator, pPipelines, true /* do lock */);
+    }
+
+    void on_vkDestroyPipeline(
+        void* context,
+        VkDevice device,
+        VkPipeline pipeline,
+        const VkAllocationCallbacks* pAllocator) {
+        if (pipeline && !mPipelineDedup.release(pipeline)) return;
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkDestroyPipeline(device, pipeline, pAllocator, true /* do lock */);
+    }
+
+    VkResult on_vkCreateShaderModule(
+        void* context,
+        VkResult,
+        VkDevice device,
+        const VkShaderModuleCreateInfo* pCreateInfo,
+        const VkAllocationCallbacks* pAllocator,
+        VkShaderModule* pShaderModule) {
+        VkEncoder* enc = (VkEncoder*)context;
+        VkResult res = VK_INCOMPLETE;
+        if (mFeatureInfo->hasVulkanShaderModuleCache && pCreateInfo && !pCreateInfo->pNext &&
+            pCreateInfo->pCode) {
+            res = createShaderModuleFromCache(enc, device, pCreateInfo, pShaderModule);
+        }
+        if (res == VK_INCOMPLETE) {
+            res = enc->vkCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule,
+                                            true /* do lock */);
+        }
+        if (res == VK_SUCCESS) {
+            mPipelineDedup.onShaderModuleCreated(*pShaderModule, pCreateInfo);
+        }
+        return res;
+    }
+
+    // Sends the SPIR-V the first time this device sees it and only its
+    // hash after that. Returns VK_INCOMPLETE if the host has dropped the
+    // code, in which case the caller falls back to vkCreateShaderModule.
+    VkResult createShaderModuleFromCache(VkEncoder* enc, VkDevice device,
+                                         const VkShaderModuleCreateInfo* pCreateInfo,
+                                         VkShaderModule* pShaderModule) {
+        uint64_t hash[2];
+        hashShaderCode(pCreateInfo->pCode, pCreateInfo->codeSize, hash);
+        const auto key = std::make_tuple(hash[0], hash[1], (uint64_t)pCreateInfo->codeSize);
+
+        bool known;
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            auto it = info_VkDevice.find(device);
+            if (it == info_VkDevice.end()) return VK_INCOMPLETE;
+            known = !it->second.knownShaderCode.insert(key).second;
+        }
+
+        if (!known) {
+            enc->vkUploadShaderCodeGOOGLE(device, hash, pCreateInfo->codeSize, pCreateInfo->pCode,
+                                          true /* do lock */);
+        }
+        VkResult res = enc->vkCreateShaderModuleFromHashGOOGLE(
+            device, pCreateInfo->flags, hash, pCreateInfo->codeSize, pShaderModule,
+            true /* do lock */);
+        if (res == VK_INCOMPLETE) {
+            AutoLock<RecursiveLock> lock(mLock);
+            auto it = info_VkDevice.find(device);
+            if (it != info_VkDevice.end()) it->second.knownShaderCode.erase(key);
+        }
+        return res;
+    }
+
+    // Returns a host handle for an object to be created without waiting
+    // for the host, or 0 if it has to be created the usual way. Creates
+    // and uses are only sure to reach the host in order across encoders
+    // when queue submits carry their commands, as the streams are then
+    // ordered by sequence number.
+    uint64_t takeReservedHandle(VkEncoder* enc, VkDevice device) {
+        static constexpr uint32_t kReservedHandleBatch = 64;
+
+        if (!mFeatureInfo->hasVulkanGuestHandles ||
+            !mFeatureInfo->hasVulkanQueueSubmitWithCommands) {
+            return 0;
+        }
+
+        {
+            AutoLock<RecursiveLock> lock(mLock);
+            auto it = info_VkDevice.find(device);
+            if (it == info_VkDevice.end()) return 0;
+            auto& reserved = it->second.reservedHandles;
+            if (!reserved.empty()) {
+                uint64_t handle = reserved.back();
+                reserved.pop_back();
+                return handle;
+            }
+        }
+
+        uint64_t handles[kReservedHandleBatch];
+        enc->vkReserveHandlesGOOGLE(device, kReservedHandleBatch, handles, true /* do lock */);
+
+        AutoLock<RecursiveLock> lock(mLock);
+        auto it = info_VkDevice.find(device);
+        if (it == info_VkDevice.end()) return 0;
+        auto& reserved = it->second.reservedHandles;
+        // The host hands out 0 for handles it could not reserve.
+        for (uint32_t i = 0; i < kReservedHandleBatch; ++i) {
+            if (handles[i]) reserved.push_back(handles[i]);
+        }
+        if (reserved.empty()) return 0;
+        uint64_t handle = reserved.back();
+        reserved.pop_back();
+        return handle;
+    }
+
+    void on_vkDestroyShaderModule(
+        void* context,
+        VkDevice device,
+        VkShaderModule shaderModule,
+        const VkAllocationCallbacks* pAllocator) {
+        mPipelineDedup.onShaderModuleDestroyed(shaderModule);
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkDestroyShaderModule(device, shaderModule, pAllocator, true /* do lock */);
+    }
+
+    void on_vkDestroyPipelineLayout(
+        void* context,
+        VkDevice device,
+        VkPipelineLayout pipelineLayout,
+        const VkAllocationCallbacks* pAllocator) {
+        mPipelineDedup.onPipelineLayoutDestroyed(pipelineLayout);
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkDestroyPipelineLayout(device, pipelineLayout, pAllocator, true /* do lock */);
+    }
+
+    void on_vkDestroyRenderPass(
+        void* context,
+        VkDevice device,
+        VkRenderPass renderPass,
+        const VkAllocationCallbacks* pAllocator) {
+        mPipelineDedup.onRenderPassDestroyed(renderPass);
+        VkEncoder* enc = (VkEncoder*)context;
+        enc->vkDestroyRenderPass(device, renderPass, pAllocator, true /* do lock */);
+    }
+
+    GraphicsPipelineDedup::Stats getGraphicsPipelineDedupStats() const {
+        return mPipelineDedup.stats();
     }
 
     uint32_t getApiVersionFromInstance(VkInstance instance) const {
@@ -7631,9 +10048,38 @@ public:
         eraseObjects(&p->subObjects);
     }
 
+    void setLockStats(LockStats* stats) { mLock.setStats(stats); }
+
 private:
     mutable RecursiveLock mLock;
 
+    GraphicsPipelineDedup mPipelineDedup;
+
+    // Opt in with qemu.vk.inline_secondaries, see on_vkCmdExecuteCommands.
+    bool mInlineSecondaryCommandBuffers = false;
+
+    // Opt in with qemu.vk.queue_submit_thread, see on_vkQueueSubmitTemplate.
+    bool mQueueSubmitThreads = false;
+    std::unordered_map<VkQueue, std::shared_ptr<QueueSubmitWorker>> mQueueSubmitWorkers;
+
+    // Queues that may still be executing work, each with the fence its
+    // latest submission signals, if it had one. Bumping the generation on
+    // every submission lets readers tell whether one slipped in meanwhile.
+    std::unordered_map<VkQueue, VkFence> mQueuesInFlight;
+    uint64_t mQueueWorkGeneration = 0;
+
+    // The last vkGetQueryPoolResults answer for each pool, valid as long
+    // as no queue work or host reset could have changed it.
+    struct QueryPoolResultCache {
+        uint32_t firstQuery;
+        uint32_t queryCount;
+        size_t dataSize;
+        VkDeviceSize stride;
+        VkQueryResultFlags flags;
+        std::vector<uint8_t> data;
+    };
+    std::unordered_map<VkQueryPool, QueryPoolResultCache> mQueryPoolResultCaches;
+
     const VkPhysicalDeviceMemoryProperties& getPhysicalDeviceMemoryProperties(
             void* context,
             VkDevice device = VK_NULL_HANDLE,
@@ -7662,6 +10108,33 @@ private:
     }
 
     std::optional<const VkPhysicalDeviceMemoryProperties> mCachedPhysicalDeviceMemoryProps;
+
+    struct ImageFormatQuery {
+        VkFormat format;
+        VkImageType type;
+        VkImageTiling tiling;
+        VkImageUsageFlags usage;
+        VkImageCreateFlags flags;
+
+        bool operator<(const ImageFormatQuery& other) const {
+            return std::tie(format, type, tiling, usage, flags) <
+                   std::tie(other.format, other.type, other.tiling, other.usage, other.flags);
+        }
+    };
+
+    struct ImageFormatAnswer {
+        VkResult result;
+        VkImageFormatProperties properties;
+    };
+
+    // What the host said about each physical device, which cannot change
+    // for as long as the handle is valid.
+    struct PhysicalDeviceInfoCache {
+        std::optional<VkPhysicalDeviceProperties> properties;
+        std::optional<VkPhysicalDeviceFeatures> features;
+        std::map<ImageFormatQuery, ImageFormatAnswer> imageFormats;
+    };
+    std::unordered_map<VkPhysicalDevice, PhysicalDeviceInfoCache> mPhysicalDeviceInfoCaches;
     std::unique_ptr<EmulatorFeatureInfo> mFeatureInfo;
     std::unique_ptr<GoldfishAddressSpaceBlockProvider> mGoldfishAddressSpaceBlockProvider;
 
@@ -7742,6 +10215,8 @@ void ResourceTracker::setupFeatures(const EmulatorFeatureInfo* features) {
 
 void ResourceTracker::setupCaps(void) { mImpl->setupCaps(); }
 
+void ResourceTracker::setLockStats(LockStats* stats) { mImpl->setLockStats(stats); }
+
 void ResourceTracker::setThreadingCallbacks(const ResourceTracker::ThreadingCallbacks& callbacks) {
     mImpl->setThreadingCallbacks(callbacks);
 }
@@ -7784,6 +10259,18 @@ void ResourceTracker::resetCommandPoolStagingInfo(VkCommandPool commandPool) {
 }
 
 
+// Staging chunks are shared by the command buffers of a pool, which the
+// application already synchronizes; the arena is created on first use.
+static CommandBufferStagingArena* getCommandPoolArena(struct goldfish_VkCommandBuffer* cb) {
+    CommandBufferStagingArena* arena = nullptr;
+    forAllObjects(cb->poolObjects, [&arena](void* commandPool) {
+        struct goldfish_VkCommandPool* p = as_goldfish_VkCommandPool((VkCommandPool)commandPool);
+        if (!p->userPtr) p->userPtr = new CommandBufferStagingArena;
+        arena = (CommandBufferStagingArena*)p->userPtr;
+    });
+    return arena;
+}
+
 // static
 ALWAYS_INLINE VkEncoder* ResourceTracker::getCommandBufferEncoder(VkCommandBuffer commandBuffer) {
     if (!(ResourceTracker::streamFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT)) {
@@ -7794,12 +10281,13 @@ ALWAYS_INLINE VkEncoder* ResourceTracker::getCommandBufferEncoder(VkCommandBuffe
 
     struct goldfish_VkCommandBuffer* cb = as_goldfish_VkCommandBuffer(commandBuffer);
     if (!cb->privateEncoder) {
-        sStaging.setAllocFree(ResourceTracker::get()->getAlloc(),
-                              ResourceTracker::get()->getFree());
+        if (!sStaging.allocFreeSet()) {
+            sStaging.setAllocFree(ResourceTracker::get()->getAlloc(),
+                                  ResourceTracker::get()->getFree());
+        }
         sStaging.popStaging((CommandBufferStagingStream**)&cb->privateStream, &cb->privateEncoder);
+        ((CommandBufferStagingStream*)cb->privateStream)->setArena(getCommandPoolArena(cb));
     }
-    uint8_t* writtenPtr; size_t written;
-    ((CommandBufferStagingStream*)cb->privateStream)->getWritten(&writtenPtr, &written);
     return cb->privateEncoder;
 }
 
@@ -7918,16 +10406,59 @@ void ResourceTracker::on_vkGetPhysicalDeviceMemoryProperties2(
     void* context,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceMemoryProperties2* pMemoryProperties) {
-    mImpl->on_vkGetPhysicalDeviceMemoryProperties2(
-        context, physicalDevice, pMemoryProperties);
+    mImpl->on_vkGetPhysicalDeviceMemoryProperties2_common(
+        false /* not KHR */, context, physicalDevice, pMemoryProperties);
 }
 
 void ResourceTracker::on_vkGetPhysicalDeviceMemoryProperties2KHR(
     void* context,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceMemoryProperties2* pMemoryProperties) {
-    mImpl->on_vkGetPhysicalDeviceMemoryProperties2(
-        context, physicalDevice, pMemoryProperties);
+    mImpl->on_vkGetPhysicalDeviceMemoryProperties2_common(
+        true /* is KHR */, context, physicalDevice, pMemoryProperties);
+}
+
+void ResourceTracker::getPhysicalDeviceProperties(
+    void* context,
+    VkPhysicalDevice physicalDevice,
+    VkPhysicalDeviceProperties* pProperties) {
+    mImpl->getPhysicalDeviceProperties(context, physicalDevice, pProperties);
+}
+
+void ResourceTracker::getPhysicalDeviceProperties2(
+    bool isKhr,
+    void* context,
+    VkPhysicalDevice physicalDevice,
+    VkPhysicalDeviceProperties2* pProperties) {
+    mImpl->getPhysicalDeviceProperties2(isKhr, context, physicalDevice, pProperties);
+}
+
+void ResourceTracker::getPhysicalDeviceFeatures(
+    void* context,
+    VkPhysicalDevice physicalDevice,
+    VkPhysicalDeviceFeatures* pFeatures) {
+    mImpl->getPhysicalDeviceFeatures(context, physicalDevice, pFeatures);
+}
+
+void ResourceTracker::getPhysicalDeviceFeatures2(
+    bool isKhr,
+    void* context,
+    VkPhysicalDevice physicalDevice,
+    VkPhysicalDeviceFeatures2* pFeatures) {
+    mImpl->getPhysicalDeviceFeatures2(isKhr, context, physicalDevice, pFeatures);
+}
+
+VkResult ResourceTracker::getPhysicalDeviceImageFormatProperties(
+    void* context,
+    VkPhysicalDevice physicalDevice,
+    VkFormat format,
+    VkImageType type,
+    VkImageTiling tiling,
+    VkImageUsageFlags usage,
+    VkImageCreateFlags flags,
+    VkImageFormatProperties* pImageFormatProperties) {
+    return mImpl->getPhysicalDeviceImageFormatProperties(
+        context, physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
 }
 
 void ResourceTracker::on_vkGetDeviceQueue(void* context,
@@ -8014,6 +10545,26 @@ void ResourceTracker::on_vkUnmapMemory(
     mImpl->on_vkUnmapMemory(context, device, memory);
 }
 
+VkResult ResourceTracker::on_vkFlushMappedMemoryRanges(
+    void* context,
+    VkResult input_result,
+    VkDevice device,
+    uint32_t memoryRangeCount,
+    const VkMappedMemoryRange* pMemoryRanges) {
+    return mImpl->on_vkFlushMappedMemoryRanges(
+        context, input_result, device, memoryRangeCount, pMemoryRanges);
+}
+
+VkResult ResourceTracker::on_vkInvalidateMappedMemoryRanges(
+    void* context,
+    VkResult input_result,
+    VkDevice device,
+    uint32_t memoryRangeCount,
+    const VkMappedMemoryRange* pMemoryRanges) {
+    return mImpl->on_vkInvalidateMappedMemoryRanges(
+        context, input_result, device, memoryRangeCount, pMemoryRanges);
+}
+
 VkResult ResourceTracker::on_vkCreateImage(
     void* context, VkResult input_result,
     VkDevice device, const VkImageCreateInfo *pCreateInfo,
@@ -8168,6 +10719,38 @@ VkResult ResourceTracker::on_vkQueueWaitIdle(
     return mImpl->on_vkQueueWaitIdle(context, input_result, queue);
 }
 
+VkResult ResourceTracker::on_vkDeviceWaitIdle(
+    void* context, VkResult input_result,
+    VkDevice device) {
+    return mImpl->on_vkDeviceWaitIdle(context, input_result, device);
+}
+
+VkResult ResourceTracker::on_vkGetQueryPoolResults(
+    void* context, VkResult input_result,
+    VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
+    size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
+    return mImpl->on_vkGetQueryPoolResults(context, input_result, device, queryPool, firstQuery,
+                                           queryCount, dataSize, pData, stride, flags);
+}
+
+void ResourceTracker::on_vkResetQueryPool(
+    void* context,
+    VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    mImpl->on_vkResetQueryPool(context, device, queryPool, firstQuery, queryCount);
+}
+
+void ResourceTracker::on_vkResetQueryPoolEXT(
+    void* context,
+    VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    mImpl->on_vkResetQueryPoolEXT(context, device, queryPool, firstQuery, queryCount);
+}
+
+void ResourceTracker::on_vkDestroyQueryPool(
+    void* context,
+    VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {
+    mImpl->on_vkDestroyQueryPool(context, device, queryPool, pAllocator);
+}
+
 VkResult ResourceTracker::on_vkGetSemaphoreFdKHR(
     void* context, VkResult input_result,
     VkDevice device,
@@ -8183,6 +10766,54 @@ VkResult ResourceTracker::on_vkImportSemaphoreFdKHR(
     return mImpl->on_vkImportSemaphoreFdKHR(context, input_result, device, pImportSemaphoreFdInfo);
 }
 
+VkResult ResourceTracker::on_vkGetSemaphoreCounterValue(
+    void* context, VkResult input_result,
+    VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
+    return mImpl->on_vkGetSemaphoreCounterValue(context, input_result, device, semaphore, pValue);
+}
+
+VkResult ResourceTracker::on_vkGetSemaphoreCounterValueKHR(
+    void* context, VkResult input_result,
+    VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
+    return mImpl->on_vkGetSemaphoreCounterValueKHR(context, input_result, device, semaphore, pValue);
+}
+
+VkResult ResourceTracker::on_vkWaitSemaphores(
+    void* context, VkResult input_result,
+    VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+    return mImpl->on_vkWaitSemaphores(context, input_result, device, pWaitInfo, timeout);
+}
+
+VkResult ResourceTracker::on_vkWaitSemaphoresKHR(
+    void* context, VkResult input_result,
+    VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+    return mImpl->on_vkWaitSemaphoresKHR(context, input_result, device, pWaitInfo, timeout);
+}
+
+VkResult ResourceTracker::on_vkSignalSemaphore(
+    void* context, VkResult input_result,
+    VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
+    return mImpl->on_vkSignalSemaphore(context, input_result, device, pSignalInfo);
+}
+
+VkResult ResourceTracker::on_vkSignalSemaphoreKHR(
+    void* context, VkResult input_result,
+    VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
+    return mImpl->on_vkSignalSemaphoreKHR(context, input_result, device, pSignalInfo);
+}
+
+void ResourceTracker::on_vkQueueBindSparse_pre(
+    void* context, VkQueue queue,
+    uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) {
+    mImpl->on_vkQueueBindSparse_pre(context, queue, bindInfoCount, pBindInfo, fence);
+}
+
+void ResourceTracker::on_vkQueueSubmit2KHR_pre(
+    void* context, VkQueue queue,
+    uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+    mImpl->on_vkQueueSubmit2KHR_pre(context, queue, submitCount, pSubmits, fence);
+}
+
 void ResourceTracker::unwrap_vkCreateImage_pCreateInfo(
     const VkImageCreateInfo* pCreateInfo,
     VkImageCreateInfo* local_pCreateInfo) {
@@ -8363,6 +10994,24 @@ VkResult ResourceTracker::on_vkCreateSampler(
         context, input_result, device, pCreateInfo, pAllocator, pSampler);
 }
 
+void ResourceTracker::on_vkDestroySampler(
+    void* context,
+    VkDevice device,
+    VkSampler sampler,
+    const VkAllocationCallbacks* pAllocator) {
+    mImpl->on_vkDestroySampler(context, device, sampler, pAllocator);
+}
+
+VkResult ResourceTracker::on_vkCreateFramebuffer(
+    void* context, VkResult input_result,
+    VkDevice device,
+    const VkFramebufferCreateInfo* pCreateInfo,
+    const VkAllocationCallbacks* pAllocator,
+    VkFramebuffer* pFramebuffer) {
+    return mImpl->on_vkCreateFramebuffer(
+        context, input_result, device, pCreateInfo, pAllocator, pFramebuffer);
+}
+
 void ResourceTracker::on_vkGetPhysicalDeviceExternalBufferProperties(
     void* context,
     VkPhysicalDevice physicalDevice,
@@ -8450,6 +11099,14 @@ VkResult ResourceTracker::on_vkWaitForFences(
         context, input_result, device, fenceCount, pFences, waitAll, timeout);
 }
 
+VkResult ResourceTracker::on_vkGetFenceStatus(
+    void* context,
+    VkResult input_result,
+    VkDevice device,
+    VkFence fence) {
+    return mImpl->on_vkGetFenceStatus(context, input_result, device, fence);
+}
+
 VkResult ResourceTracker::on_vkCreateDescriptorPool(
     void* context,
     VkResult input_result,
@@ -8635,6 +11292,10 @@ uint32_t ResourceTracker::syncEncodersForQueue(VkQueue queue, VkEncoder* current
     return mImpl->syncEncodersForQueue(queue, current);
 }
 
+void ResourceTracker::waitForQueueSubmitThreads(void* context) {
+    mImpl->waitForQueueSubmitThreads(context, VK_NULL_HANDLE);
+}
+
 CommandBufferStagingStream::Alloc ResourceTracker::getAlloc() { return mImpl->getAlloc(); }
 
 CommandBufferStagingStream::Free ResourceTracker::getFree() { return mImpl->getFree(); }
@@ -8703,6 +11364,187 @@ void ResourceTracker::on_vkCmdBindDescriptorSets(
         pDynamicOffsets);
 }
 
+void ResourceTracker::on_vkCmdBindPipeline(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    VkPipelineBindPoint pipelineBindPoint,
+    VkPipeline pipeline) {
+    mImpl->on_vkCmdBindPipeline(context, commandBuffer, pipelineBindPoint, pipeline);
+}
+
+void ResourceTracker::on_vkCmdSetViewport(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    uint32_t firstViewport,
+    uint32_t viewportCount,
+    const VkViewport* pViewports) {
+    mImpl->on_vkCmdSetViewport(context, commandBuffer, firstViewport, viewportCount, pViewports);
+}
+
+void ResourceTracker::on_vkCmdSetScissor(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    uint32_t firstScissor,
+    uint32_t scissorCount,
+    const VkRect2D* pScissors) {
+    mImpl->on_vkCmdSetScissor(context, commandBuffer, firstScissor, scissorCount, pScissors);
+}
+
+void ResourceTracker::on_vkCmdSetViewportWithCount(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    uint32_t viewportCount,
+    const VkViewport* pViewports) {
+    mImpl->on_vkCmdSetViewportWithCount(
+        context, false /* not EXT */, commandBuffer, viewportCount, pViewports);
+}
+
+void ResourceTracker::on_vkCmdSetViewportWithCountEXT(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    uint32_t viewportCount,
+    const VkViewport* pViewports) {
+    mImpl->on_vkCmdSetViewportWithCount(
+        context, true /* is EXT */, commandBuffer, viewportCount, pViewports);
+}
+
+void ResourceTracker::on_vkCmdSetScissorWithCount(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    uint32_t scissorCount,
+    const VkRect2D* pScissors) {
+    mImpl->on_vkCmdSetScissorWithCount(
+        context, false /* not EXT */, commandBuffer, scissorCount, pScissors);
+}
+
+void ResourceTracker::on_vkCmdSetScissorWithCountEXT(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    uint32_t scissorCount,
+    const VkRect2D* pScissors) {
+    mImpl->on_vkCmdSetScissorWithCount(
+        context, true /* is EXT */, commandBuffer, scissorCount, pScissors);
+}
+
+void ResourceTracker::on_vkCmdSetLineWidth(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    float lineWidth) {
+    mImpl->on_vkCmdSetLineWidth(context, commandBuffer, lineWidth);
+}
+
+void ResourceTracker::on_vkCmdSetDepthBias(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    float depthBiasConstantFactor,
+    float depthBiasClamp,
+    float depthBiasSlopeFactor) {
+    mImpl->on_vkCmdSetDepthBias(
+        context, commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+
+void ResourceTracker::on_vkCmdSetBlendConstants(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    const float blendConstants[4]) {
+    mImpl->on_vkCmdSetBlendConstants(context, commandBuffer, blendConstants);
+}
+
+void ResourceTracker::on_vkCmdSetDepthBounds(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    float minDepthBounds,
+    float maxDepthBounds) {
+    mImpl->on_vkCmdSetDepthBounds(context, commandBuffer, minDepthBounds, maxDepthBounds);
+}
+
+void ResourceTracker::on_vkCmdSetStencilCompareMask(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    VkStencilFaceFlags faceMask,
+    uint32_t compareMask) {
+    mImpl->on_vkCmdSetStencilCompareMask(context, commandBuffer, faceMask, compareMask);
+}
+
+void ResourceTracker::on_vkCmdSetStencilWriteMask(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    VkStencilFaceFlags faceMask,
+    uint32_t writeMask) {
+    mImpl->on_vkCmdSetStencilWriteMask(context, commandBuffer, faceMask, writeMask);
+}
+
+void ResourceTracker::on_vkCmdSetStencilReference(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    VkStencilFaceFlags faceMask,
+    uint32_t reference) {
+    mImpl->on_vkCmdSetStencilReference(context, commandBuffer, faceMask, reference);
+}
+
+void ResourceTracker::on_vkCmdPushConstants(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    VkPipelineLayout layout,
+    VkShaderStageFlags stageFlags,
+    uint32_t offset,
+    uint32_t size,
+    const void* pValues) {
+    mImpl->on_vkCmdPushConstants(context, commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+
+void ResourceTracker::on_vkCmdDraw(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    uint32_t vertexCount,
+    uint32_t instanceCount,
+    uint32_t firstVertex,
+    uint32_t firstInstance) {
+    mImpl->on_vkCmdDraw(context, commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void ResourceTracker::on_vkCmdDrawIndexed(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    uint32_t indexCount,
+    uint32_t instanceCount,
+    uint32_t firstIndex,
+    int32_t vertexOffset,
+    uint32_t firstInstance) {
+    mImpl->on_vkCmdDrawIndexed(context, commandBuffer, indexCount, instanceCount, firstIndex,
+                               vertexOffset, firstInstance);
+}
+
+void ResourceTracker::on_vkCmdDrawIndirect(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    VkBuffer buffer,
+    VkDeviceSize offset,
+    uint32_t drawCount,
+    uint32_t stride) {
+    mImpl->on_vkCmdDrawIndirect(context, commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void ResourceTracker::on_vkCmdDrawIndexedIndirect(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    VkBuffer buffer,
+    VkDeviceSize offset,
+    uint32_t drawCount,
+    uint32_t stride) {
+    mImpl->on_vkCmdDrawIndexedIndirect(context, commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void ResourceTracker::on_vkCmdCopyBuffer(
+    void* context,
+    VkCommandBuffer commandBuffer,
+    VkBuffer srcBuffer,
+    VkBuffer dstBuffer,
+    uint32_t regionCount,
+    const VkBufferCopy* pRegions) {
+    mImpl->on_vkCmdCopyBuffer(context, commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+
 void ResourceTracker::on_vkCmdPipelineBarrier(
     void* context,
     VkCommandBuffer commandBuffer,
@@ -8771,6 +11613,65 @@ VkResult ResourceTracker::on_vkCreateGraphicsPipelines(
     return mImpl->on_vkCreateGraphicsPipelines(context, input_result, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 }
 
+VkResult ResourceTracker::on_vkCreateComputePipelines(
+    void* context,
+    VkResult input_result,
+    VkDevice device,
+    VkPipelineCache pipelineCache,
+    uint32_t createInfoCount,
+    const VkComputePipelineCreateInfo* pCreateInfos,
+    const VkAllocationCallbacks* pAllocator,
+    VkPipeline* pPipelines) {
+    return mImpl->on_vkCreateComputePipelines(context, input_result, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+void ResourceTracker::on_vkDestroyPipeline(
+    void* context,
+    VkDevice device,
+    VkPipeline pipeline,
+    const VkAllocationCallbacks* pAllocator) {
+    mImpl->on_vkDestroyPipeline(context, device, pipeline, pAllocator);
+}
+
+VkResult ResourceTracker::on_vkCreateShaderModule(
+    void* context,
+    VkResult input_result,
+    VkDevice device,
+    const VkShaderModuleCreateInfo* pCreateInfo,
+    const VkAllocationCallbacks* pAllocator,
+    VkShaderModule* pShaderModule) {
+    return mImpl->on_vkCreateShaderModule(context, input_result, device, pCreateInfo, pAllocator,
+                                          pShaderModule);
+}
+
+void ResourceTracker::on_vkDestroyShaderModule(
+    void* context,
+    VkDevice device,
+    VkShaderModule shaderModule,
+    const VkAllocationCallbacks* pAllocator) {
+    mImpl->on_vkDestroyShaderModule(context, device, shaderModule, pAllocator);
+}
+
+void ResourceTracker::on_vkDestroyPipelineLayout(
+    void* context,
+    VkDevice device,
+    VkPipelineLayout pipelineLayout,
+    const VkAllocationCallbacks* pAllocator) {
+    mImpl->on_vkDestroyPipelineLayout(context, device, pipelineLayout, pAllocator);
+}
+
+void ResourceTracker::on_vkDestroyRenderPass(
+    void* context,
+    VkDevice device,
+    VkRenderPass renderPass,
+    const VkAllocationCallbacks* pAllocator) {
+    mImpl->on_vkDestroyRenderPass(context, device, renderPass, pAllocator);
+}
+
+GraphicsPipelineDedup::Stats ResourceTracker::getGraphicsPipelineDedupStats() const {
+    return mImpl->getGraphicsPipelineDedupStats();
+}
+
 void ResourceTracker::deviceMemoryTransform_tohost(
     VkDeviceMemory* memory, uint32_t memoryCount,
     VkDeviceSize* offset, uint32_t offsetCount,
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "CommandBufferStagingStream.h"
+#include "PipelineDedup.h"
 #include "VulkanHandleMapping.h"
 #include "VulkanHandles.h"
 #include "aemu/base/Tracing.h"
@@ -45,6 +46,10 @@ public:
     VulkanHandleMapping* destroyMapping();
     VulkanHandleMapping* defaultMapping();
 
+    // Counts the acquisitions and hold times of the tracker's lock into
+    // |stats|, or stops with nullptr. For benchmarks.
+    void setLockStats(android::base::guest::LockStats* stats);
+
     using HostConnectionGetFunc = HostConnection* (*)();
     using VkEncoderGetFunc = VkEncoder* (*)(HostConnection*);
     using CleanupCallback = std::function<void()>;
@@ -116,6 +121,37 @@ public:
         void* context,
         VkPhysicalDevice physicalDevice,
         VkPhysicalDeviceMemoryProperties2* pMemoryProperties);
+
+    // The answers to these are cached per physical device, as they cannot
+    // change. Queries with extension structs still go to the host.
+    void getPhysicalDeviceProperties(
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceProperties* pProperties);
+    void getPhysicalDeviceProperties2(
+        bool isKhr,
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceProperties2* pProperties);
+    void getPhysicalDeviceFeatures(
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceFeatures* pFeatures);
+    void getPhysicalDeviceFeatures2(
+        bool isKhr,
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceFeatures2* pFeatures);
+    VkResult getPhysicalDeviceImageFormatProperties(
+        void* context,
+        VkPhysicalDevice physicalDevice,
+        VkFormat format,
+        VkImageType type,
+        VkImageTiling tiling,
+        VkImageUsageFlags usage,
+        VkImageCreateFlags flags,
+        VkImageFormatProperties* pImageFormatProperties);
+
     void on_vkGetDeviceQueue(void* context,
                              VkDevice device,
                              uint32_t queueFamilyIndex,
@@ -172,6 +208,20 @@ public:
         VkDevice device,
         VkDeviceMemory memory);
 
+    VkResult on_vkFlushMappedMemoryRanges(
+        void* context,
+        VkResult input_result,
+        VkDevice device,
+        uint32_t memoryRangeCount,
+        const VkMappedMemoryRange* pMemoryRanges);
+
+    VkResult on_vkInvalidateMappedMemoryRanges(
+        void* context,
+        VkResult input_result,
+        VkDevice device,
+        uint32_t memoryRangeCount,
+        const VkMappedMemoryRange* pMemoryRanges);
+
     VkResult on_vkCreateImage(
         void* context, VkResult input_result,
         VkDevice device, const VkImageCreateInfo *pCreateInfo,
@@ -248,6 +298,33 @@ public:
         VkDevice device,
         const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo);
 
+    VkResult on_vkGetSemaphoreCounterValue(
+        void* context, VkResult,
+        VkDevice device, VkSemaphore semaphore, uint64_t* pValue);
+    VkResult on_vkGetSemaphoreCounterValueKHR(
+        void* context, VkResult,
+        VkDevice device, VkSemaphore semaphore, uint64_t* pValue);
+    VkResult on_vkWaitSemaphores(
+        void* context, VkResult,
+        VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout);
+    VkResult on_vkWaitSemaphoresKHR(
+        void* context, VkResult,
+        VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout);
+    VkResult on_vkSignalSemaphore(
+        void* context, VkResult,
+        VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo);
+    VkResult on_vkSignalSemaphoreKHR(
+        void* context, VkResult,
+        VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo);
+
+    // Bookkeeping for queue operations that are otherwise encoded as is.
+    void on_vkQueueBindSparse_pre(
+        void* context, VkQueue queue,
+        uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence);
+    void on_vkQueueSubmit2KHR_pre(
+        void* context, VkQueue queue,
+        uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence);
+
     VkResult on_vkQueueSubmit(
         void* context, VkResult input_result,
         VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence);
@@ -258,6 +335,23 @@ public:
     VkResult on_vkQueueWaitIdle(
         void* context, VkResult input_result,
         VkQueue queue);
+    VkResult on_vkDeviceWaitIdle(
+        void* context, VkResult input_result,
+        VkDevice device);
+
+    VkResult on_vkGetQueryPoolResults(
+        void* context, VkResult input_result,
+        VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
+        size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags);
+    void on_vkResetQueryPool(
+        void* context,
+        VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount);
+    void on_vkResetQueryPoolEXT(
+        void* context,
+        VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount);
+    void on_vkDestroyQueryPool(
+        void* context,
+        VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator);
 
     void unwrap_vkCreateImage_pCreateInfo(
         const VkImageCreateInfo* pCreateInfo,
@@ -366,6 +460,18 @@ public:
         const VkSamplerCreateInfo* pCreateInfo,
         const VkAllocationCallbacks* pAllocator,
         VkSampler* pSampler);
+    void on_vkDestroySampler(
+        void* context,
+        VkDevice device,
+        VkSampler sampler,
+        const VkAllocationCallbacks* pAllocator);
+
+    VkResult on_vkCreateFramebuffer(
+        void* context, VkResult input_result,
+        VkDevice device,
+        const VkFramebufferCreateInfo* pCreateInfo,
+        const VkAllocationCallbacks* pAllocator,
+        VkFramebuffer* pFramebuffer);
 
     void on_vkGetPhysicalDeviceExternalBufferProperties(
         void* context,
@@ -427,6 +533,12 @@ public:
         VkBool32 waitAll,
         uint64_t timeout);
 
+    VkResult on_vkGetFenceStatus(
+        void* context,
+        VkResult input_result,
+        VkDevice device,
+        VkFence fence);
+
     VkResult on_vkCreateDescriptorPool(
         void* context,
         VkResult input_result,
@@ -544,6 +656,10 @@ public:
     uint32_t syncEncodersForCommandBuffer(VkCommandBuffer commandBuffer, VkEncoder* current);
     uint32_t syncEncodersForQueue(VkQueue queue, VkEncoder* current);
 
+    // Lets every queue submit thread run what it holds before |context|
+    // encodes a call that depends on earlier submits.
+    void waitForQueueSubmitThreads(void* context);
+
     CommandBufferStagingStream::Alloc getAlloc();
     CommandBufferStagingStream::Free getFree();
 
@@ -583,6 +699,141 @@ public:
         uint32_t dynamicOffsetCount,
         const uint32_t* pDynamicOffsets);
 
+    void on_vkCmdBindPipeline(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkPipelineBindPoint pipelineBindPoint,
+        VkPipeline pipeline);
+
+    void on_vkCmdSetViewport(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t firstViewport,
+        uint32_t viewportCount,
+        const VkViewport* pViewports);
+
+    void on_vkCmdSetScissor(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t firstScissor,
+        uint32_t scissorCount,
+        const VkRect2D* pScissors);
+
+    void on_vkCmdSetViewportWithCount(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t viewportCount,
+        const VkViewport* pViewports);
+
+    void on_vkCmdSetViewportWithCountEXT(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t viewportCount,
+        const VkViewport* pViewports);
+
+    void on_vkCmdSetScissorWithCount(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t scissorCount,
+        const VkRect2D* pScissors);
+
+    void on_vkCmdSetScissorWithCountEXT(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t scissorCount,
+        const VkRect2D* pScissors);
+
+    void on_vkCmdSetLineWidth(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        float lineWidth);
+
+    void on_vkCmdSetDepthBias(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        float depthBiasConstantFactor,
+        float depthBiasClamp,
+        float depthBiasSlopeFactor);
+
+    void on_vkCmdSetBlendConstants(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        const float blendConstants[4]);
+
+    void on_vkCmdSetDepthBounds(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        float minDepthBounds,
+        float maxDepthBounds);
+
+    void on_vkCmdSetStencilCompareMask(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkStencilFaceFlags faceMask,
+        uint32_t compareMask);
+
+    void on_vkCmdSetStencilWriteMask(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkStencilFaceFlags faceMask,
+        uint32_t writeMask);
+
+    void on_vkCmdSetStencilReference(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkStencilFaceFlags faceMask,
+        uint32_t reference);
+
+    void on_vkCmdPushConstants(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkPipelineLayout layout,
+        VkShaderStageFlags stageFlags,
+        uint32_t offset,
+        uint32_t size,
+        const void* pValues);
+
+    void on_vkCmdDraw(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t vertexCount,
+        uint32_t instanceCount,
+        uint32_t firstVertex,
+        uint32_t firstInstance);
+
+    void on_vkCmdDrawIndexed(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        uint32_t indexCount,
+        uint32_t instanceCount,
+        uint32_t firstIndex,
+        int32_t vertexOffset,
+        uint32_t firstInstance);
+
+    void on_vkCmdDrawIndirect(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkBuffer buffer,
+        VkDeviceSize offset,
+        uint32_t drawCount,
+        uint32_t stride);
+
+    void on_vkCmdDrawIndexedIndirect(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkBuffer buffer,
+        VkDeviceSize offset,
+        uint32_t drawCount,
+        uint32_t stride);
+
+    void on_vkCmdCopyBuffer(
+        void* context,
+        VkCommandBuffer commandBuffer,
+        VkBuffer srcBuffer,
+        VkBuffer dstBuffer,
+        uint32_t regionCount,
+        const VkBufferCopy* pRegions);
+
     void on_vkCmdPipelineBarrier(
         void* context,
         VkCommandBuffer commandBuffer,
@@ -628,6 +879,52 @@ public:
         const VkAllocationCallbacks* pAllocator,
         VkPipeline* pPipelines);
 
+    VkResult on_vkCreateComputePipelines(
+        void* context,
+        VkResult input_result,
+        VkDevice device,
+        VkPipelineCache pipelineCache,
+        uint32_t createInfoCount,
+        const VkComputePipelineCreateInfo* pCreateInfos,
+        const VkAllocationCallbacks* pAllocator,
+        VkPipeline* pPipelines);
+
+    void on_vkDestroyPipeline(
+        void* context,
+        VkDevice device,
+        VkPipeline pipeline,
+        const VkAllocationCallbacks* pAllocator);
+
+    VkResult on_vkCreateShaderModule(
+        void* context,
+        VkResult input_result,
+        VkDevice device,
+        const VkShaderModuleCreateInfo* pCreateInfo,
+        const VkAllocationCallbacks* pAllocator,
+        VkShaderModule* pShaderModule);
+
+    void on_vkDestroyShaderModule(
+        void* context,
+        VkDevice device,
+        VkShaderModule shaderModule,
+        const VkAllocationCallbacks* pAllocator);
+
+    void on_vkDestroyPipelineLayout(
+        void* context,
+        VkDevice device,
+        VkPipelineLayout pipelineLayout,
+        const VkAllocationCallbacks* pAllocator);
+
+    void on_vkDestroyRenderPass(
+        void* context,
+        VkDevice device,
+        VkRenderPass renderPass,
+        const VkAllocationCallbacks* pAllocator);
+
+    // Identical vkCreateGraphicsPipelines requests served without a host
+    // round trip.
+    GraphicsPipelineDedup::Stats getGraphicsPipelineDedupStats() const;
+
     uint8_t* getMappedPointer(VkDeviceMemory memory);
     VkDeviceSize getMappedSize(VkDeviceMemory memory);
     VkDeviceSize getNonCoherentExtendedSize(VkDevice device, VkDeviceSize basicSize) const;
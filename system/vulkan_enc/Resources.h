@@ -25,6 +25,7 @@
 namespace gfxstream {
 namespace vk {
 class VkEncoder;
+class CommandBufferStateShadow;
 struct DescriptorPoolAllocationInfo;
 struct ReifiedDescriptorSet;
 struct DescriptorSetLayoutInfo;
@@ -132,6 +133,7 @@ struct goldfish_VkCommandBuffer {
     void* userPtr;
     bool isSecondary;
     VkDevice device;
+    gfxstream::vk::CommandBufferStateShadow* stateShadow;
 };
 
 } // extern "C"
@@ -88,3 +88,746 @@ std::string VkEncoder::getPacketContents(const uint8_t* ptr, size_t len) {
   }
   return result;
 }
+
+// Fast paths for the hottest vkCmd* calls. They write exactly the packets the
+// generated encoders do, but size them up front, copy POD arrays in one go
+// and skip the deepcopy, the pNext walk and the watchdog bookkeeping. With a
+// health monitor or encoder debug logging, the generated encoders run.
+
+namespace {
+
+template <typename T>
+inline void putRaw(uint8_t** ptr, const T& value) {
+    memcpy(*ptr, &value, sizeof(T));
+    *ptr += sizeof(T);
+}
+
+template <typename T>
+inline void putArray(uint8_t** ptr, const T* values, uint32_t count) {
+    static_assert(std::is_trivially_copyable<T>::value, "bulk copy needs a POD type");
+    if (!count) return;
+    memcpy(*ptr, values, count * sizeof(T));
+    *ptr += count * sizeof(T);
+}
+
+template <typename... Args>
+constexpr uint32_t sizeOfAll() {
+    return (0 + ... + (uint32_t)sizeof(Args));
+}
+
+template <typename T>
+inline bool noneHavePNext(const T* structs, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        if (structs[i].pNext) return false;
+    }
+    return true;
+}
+
+// Wire sizes of the barriers with an empty pNext chain: sType, then a zero
+// extension size, then the fields with handles widened to 64 bits.
+constexpr uint32_t kMemoryBarrierWireSize = 4 + 4 + 2 * 4;
+constexpr uint32_t kBufferMemoryBarrierWireSize = 4 + 4 + 4 * 4 + 8 + 2 * 8;
+constexpr uint32_t kImageMemoryBarrierWireSize =
+    4 + 4 + 6 * 4 + 8 + sizeof(VkImageSubresourceRange);
+
+// Marshaled field by field, these match their in-memory layout.
+static_assert(sizeof(VkBufferCopy) == 3 * sizeof(VkDeviceSize), "VkBufferCopy has padding");
+static_assert(sizeof(VkImageSubresourceRange) == 5 * sizeof(uint32_t),
+              "VkImageSubresourceRange has padding");
+
+}  // namespace
+
+bool VkEncoder::useFastPath() const {
+#if defined(ENABLE_ENCODER_DEBUG_LOGGING_FOR_ALL_APPS) || \
+    defined(ENABLE_ENCODER_DEBUG_LOGGING_FOR_APP)
+    return false;
+#else
+    return !mHealthMonitor;
+#endif
+}
+
+uint8_t* VkEncoder::beginCmd(uint32_t opcode, VkCommandBuffer commandBuffer, uint32_t doLock,
+                             uint32_t payloadSize) {
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    uint32_t packetSize = 4 + 4 + (queueSubmitWithCommandsEnabled ? 0 : 8) + payloadSize;
+    uint8_t* ptr = mImpl->stream()->reserve(packetSize);
+    putRaw(&ptr, opcode);
+    putRaw(&ptr, packetSize);
+    if (!queueSubmitWithCommandsEnabled) {
+        putRaw(&ptr, get_host_u64_VkCommandBuffer(commandBuffer));
+    }
+    return ptr;
+}
+
+void VkEncoder::endCmd(uint32_t doLock) {
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+}
+
+template <typename... Args>
+void VkEncoder::encodeCmdFixed(uint32_t opcode, VkCommandBuffer commandBuffer, uint32_t doLock,
+                               const Args&... args) {
+    uint8_t* ptr = beginCmd(opcode, commandBuffer, doLock, sizeOfAll<Args...>());
+    (putRaw(&ptr, args), ...);
+    endCmd(doLock);
+}
+
+void VkEncoder::encodeCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount,
+                              uint32_t instanceCount, uint32_t firstVertex,
+                              uint32_t firstInstance, uint32_t doLock) {
+    if (!useFastPath()) {
+        vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, doLock);
+        return;
+    }
+    encodeCmdFixed(OP_vkCmdDraw, commandBuffer, doLock, vertexCount, instanceCount, firstVertex,
+                   firstInstance);
+}
+
+void VkEncoder::encodeCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount,
+                                     uint32_t instanceCount, uint32_t firstIndex,
+                                     int32_t vertexOffset, uint32_t firstInstance,
+                                     uint32_t doLock) {
+    if (!useFastPath()) {
+        vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
+                         firstInstance, doLock);
+        return;
+    }
+    encodeCmdFixed(OP_vkCmdDrawIndexed, commandBuffer, doLock, indexCount, instanceCount,
+                   firstIndex, vertexOffset, firstInstance);
+}
+
+void VkEncoder::encodeCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                      VkDeviceSize offset, uint32_t drawCount, uint32_t stride,
+                                      uint32_t doLock) {
+    if (!useFastPath()) {
+        vkCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, doLock);
+        return;
+    }
+    encodeCmdFixed(OP_vkCmdDrawIndirect, commandBuffer, doLock, get_host_u64_VkBuffer(buffer),
+                   offset, drawCount, stride);
+}
+
+void VkEncoder::encodeCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                             VkDeviceSize offset, uint32_t drawCount,
+                                             uint32_t stride, uint32_t doLock) {
+    if (!useFastPath()) {
+        vkCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, doLock);
+        return;
+    }
+    encodeCmdFixed(OP_vkCmdDrawIndexedIndirect, commandBuffer, doLock,
+                   get_host_u64_VkBuffer(buffer), offset, drawCount, stride);
+}
+
+void VkEncoder::encodeCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
+                                       VkShaderStageFlags stageFlags, uint32_t offset,
+                                       uint32_t size, const void* pValues, uint32_t doLock) {
+    if (!useFastPath()) {
+        vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues, doLock);
+        return;
+    }
+    uint8_t* ptr = beginCmd(OP_vkCmdPushConstants, commandBuffer, doLock,
+                            8 + sizeof(VkShaderStageFlags) + 4 + 4 + size);
+    putRaw(&ptr, get_host_u64_VkPipelineLayout(layout));
+    putRaw(&ptr, stageFlags);
+    putRaw(&ptr, offset);
+    putRaw(&ptr, size);
+    putArray(&ptr, (const uint8_t*)pValues, size);
+    endCmd(doLock);
+}
+
+void VkEncoder::encodeCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer,
+                                    VkBuffer dstBuffer, uint32_t regionCount,
+                                    const VkBufferCopy* pRegions, uint32_t doLock) {
+    if (!useFastPath()) {
+        vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, doLock);
+        return;
+    }
+    uint8_t* ptr = beginCmd(OP_vkCmdCopyBuffer, commandBuffer, doLock,
+                            8 + 8 + 4 + regionCount * sizeof(VkBufferCopy));
+    putRaw(&ptr, get_host_u64_VkBuffer(srcBuffer));
+    putRaw(&ptr, get_host_u64_VkBuffer(dstBuffer));
+    putRaw(&ptr, regionCount);
+    putArray(&ptr, pRegions, regionCount);
+    endCmd(doLock);
+}
+
+void VkEncoder::encodeCmdBindDescriptorSets(VkCommandBuffer commandBuffer,
+                                            VkPipelineBindPoint pipelineBindPoint,
+                                            VkPipelineLayout layout, uint32_t firstSet,
+                                            uint32_t descriptorSetCount,
+                                            const VkDescriptorSet* pDescriptorSets,
+                                            uint32_t dynamicOffsetCount,
+                                            const uint32_t* pDynamicOffsets, uint32_t doLock) {
+    if (!useFastPath()) {
+        vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet,
+                                descriptorSetCount, pDescriptorSets, dynamicOffsetCount,
+                                pDynamicOffsets, doLock);
+        return;
+    }
+    uint8_t* ptr = beginCmd(OP_vkCmdBindDescriptorSets, commandBuffer, doLock,
+                            sizeof(VkPipelineBindPoint) + 8 + 4 + 4 + descriptorSetCount * 8 +
+                                4 + dynamicOffsetCount * 4);
+    putRaw(&ptr, pipelineBindPoint);
+    putRaw(&ptr, get_host_u64_VkPipelineLayout(layout));
+    putRaw(&ptr, firstSet);
+    putRaw(&ptr, descriptorSetCount);
+    for (uint32_t i = 0; i < descriptorSetCount; ++i) {
+        putRaw(&ptr, get_host_u64_VkDescriptorSet(pDescriptorSets[i]));
+    }
+    putRaw(&ptr, dynamicOffsetCount);
+    putArray(&ptr, pDynamicOffsets, dynamicOffsetCount);
+    endCmd(doLock);
+}
+
+void VkEncoder::encodeCmdPipelineBarrier(
+    VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+    VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+    uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+    uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+    uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers,
+    uint32_t doLock) {
+    // The generated encoder walks pNext chains.
+    if (!useFastPath() || !noneHavePNext(pMemoryBarriers, memoryBarrierCount) ||
+        !noneHavePNext(pBufferMemoryBarriers, bufferMemoryBarrierCount) ||
+        !noneHavePNext(pImageMemoryBarriers, imageMemoryBarrierCount)) {
+        vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags,
+                             memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount,
+                             pBufferMemoryBarriers, imageMemoryBarrierCount,
+                             pImageMemoryBarriers, doLock);
+        return;
+    }
+
+    const uint32_t emptyExtension = 0;
+    uint8_t* ptr = beginCmd(OP_vkCmdPipelineBarrier, commandBuffer, doLock,
+                            sizeof(VkPipelineStageFlags) * 2 + sizeof(VkDependencyFlags) +
+                                4 + memoryBarrierCount * kMemoryBarrierWireSize +
+                                4 + bufferMemoryBarrierCount * kBufferMemoryBarrierWireSize +
+                                4 + imageMemoryBarrierCount * kImageMemoryBarrierWireSize);
+    putRaw(&ptr, srcStageMask);
+    putRaw(&ptr, dstStageMask);
+    putRaw(&ptr, dependencyFlags);
+
+    putRaw(&ptr, memoryBarrierCount);
+    for (uint32_t i = 0; i < memoryBarrierCount; ++i) {
+        const VkMemoryBarrier& b = pMemoryBarriers[i];
+        putRaw(&ptr, b.sType);
+        putRaw(&ptr, emptyExtension);
+        putRaw(&ptr, b.srcAccessMask);
+        putRaw(&ptr, b.dstAccessMask);
+    }
+
+    putRaw(&ptr, bufferMemoryBarrierCount);
+    for (uint32_t i = 0; i < bufferMemoryBarrierCount; ++i) {
+        const VkBufferMemoryBarrier& b = pBufferMemoryBarriers[i];
+        putRaw(&ptr, b.sType);
+        putRaw(&ptr, emptyExtension);
+        putRaw(&ptr, b.srcAccessMask);
+        putRaw(&ptr, b.dstAccessMask);
+        putRaw(&ptr, b.srcQueueFamilyIndex);
+        putRaw(&ptr, b.dstQueueFamilyIndex);
+        putRaw(&ptr, get_host_u64_VkBuffer(b.buffer));
+        putRaw(&ptr, b.offset);
+        putRaw(&ptr, b.size);
+    }
+
+    putRaw(&ptr, imageMemoryBarrierCount);
+    for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i) {
+        const VkImageMemoryBarrier& b = pImageMemoryBarriers[i];
+        putRaw(&ptr, b.sType);
+        putRaw(&ptr, emptyExtension);
+        putRaw(&ptr, b.srcAccessMask);
+        putRaw(&ptr, b.dstAccessMask);
+        putRaw(&ptr, b.oldLayout);
+        putRaw(&ptr, b.newLayout);
+        putRaw(&ptr, b.srcQueueFamilyIndex);
+        putRaw(&ptr, b.dstQueueFamilyIndex);
+        putRaw(&ptr, get_host_u64_VkImage(b.image));
+        putRaw(&ptr, b.subresourceRange);
+    }
+    endCmd(doLock);
+}
+
+// Create infos are deep copied so that transform_tohost can rewrite them, but
+// the transforms only touch a few top-level fields and some extension
+// structs. When every struct in a pNext chain is of a type whose transform is
+// a no-op, the chain is left in the caller's memory: single create infos get
+// a copy of the top-level struct only, and pipeline create infos, whose
+// top-level transforms are no-ops too, are marshaled straight from the
+// caller's structs, skipping the transform walk as well.
+namespace {
+
+inline bool pNextNeedsNoTransform(const void* pNext) {
+    for (auto ext = (const VkBaseInStructure*)pNext; ext; ext = ext->pNext) {
+        switch (ext->sType) {
+            case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
+            case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+            case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO:
+            case VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+inline bool noTransform(const T* info) {
+    return !info || pNextNeedsNoTransform(info->pNext);
+}
+
+inline bool noTransform(const VkPipelineShaderStageCreateInfo& stage) {
+    return pNextNeedsNoTransform(stage.pNext);
+}
+
+inline bool pipelineCreateInfosNeedNoTransform(const VkGraphicsPipelineCreateInfo* infos,
+                                               uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const VkGraphicsPipelineCreateInfo& info = infos[i];
+        if (!pNextNeedsNoTransform(info.pNext)) return false;
+        if (info.pStages) {
+            for (uint32_t j = 0; j < info.stageCount; ++j) {
+                if (!noTransform(info.pStages[j])) return false;
+            }
+        }
+        if (!noTransform(info.pVertexInputState) || !noTransform(info.pInputAssemblyState) ||
+            !noTransform(info.pTessellationState) || !noTransform(info.pViewportState) ||
+            !noTransform(info.pRasterizationState) || !noTransform(info.pMultisampleState) ||
+            !noTransform(info.pDepthStencilState) || !noTransform(info.pColorBlendState) ||
+            !noTransform(info.pDynamicState)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool pipelineCreateInfosNeedNoTransform(const VkComputePipelineCreateInfo* infos,
+                                               uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!pNextNeedsNoTransform(infos[i].pNext) || !noTransform(infos[i].stage)) return false;
+    }
+    return true;
+}
+
+// The packet of vkCreate*Pipelines, as the generated encoders write it after
+// the deep copy. The allocator is never sent.
+template <typename CreateInfo>
+VkResult encodeCreatePipelinesInPlace(
+    VulkanStreamGuest* stream, uint32_t opcode, VkDevice device, VkPipelineCache pipelineCache,
+    uint32_t createInfoCount, const CreateInfo* pCreateInfos,
+    void (*countCreateInfo)(uint32_t, VkStructureType, const CreateInfo*, size_t*),
+    void (*marshalCreateInfo)(VulkanStreamGuest*, VkStructureType, const CreateInfo*, uint8_t**),
+    VkPipeline* pPipelines) {
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    size_t count = 8 + 8 + 4;
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        countCreateInfo(sFeatureBits, VK_STRUCTURE_TYPE_MAX_ENUM, pCreateInfos + i, &count);
+    }
+    count += 8 + createInfoCount * 8;
+    const uint32_t packetSize = 4 + 4 + (queueSubmitWithCommandsEnabled ? 4 : 0) + (uint32_t)count;
+    uint8_t* ptr = stream->reserve(packetSize);
+    putRaw(&ptr, opcode);
+    putRaw(&ptr, packetSize);
+    if (queueSubmitWithCommandsEnabled) putRaw(&ptr, ResourceTracker::nextSeqno());
+    putRaw(&ptr, get_host_u64_VkDevice(device));
+    putRaw(&ptr, get_host_u64_VkPipelineCache(pipelineCache));
+    putRaw(&ptr, createInfoCount);
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        marshalCreateInfo(stream, VK_STRUCTURE_TYPE_MAX_ENUM, pCreateInfos + i, &ptr);
+    }
+    putRaw(&ptr, (uint64_t)0);
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        putRaw(&ptr, (uint64_t)(pPipelines[i]));
+    }
+    stream->setHandleMapping(sResourceTracker->createMapping());
+    if (createInfoCount) {
+        uint64_t* handles;
+        stream->alloc((void**)&handles, createInfoCount * 8);
+        stream->read(handles, createInfoCount * 8);
+        stream->handleMapping()->mapHandles_u64_VkPipeline(handles, pPipelines, createInfoCount);
+    }
+    stream->unsetHandleMapping();
+    VkResult result = (VkResult)0;
+    stream->read(&result, sizeof(VkResult));
+    return result;
+}
+
+// The packet of a create that takes one create info and returns one handle.
+// Only the top-level struct is copied, for the transform to rewrite.
+template <typename CreateInfo, typename Handle>
+VkResult encodeCreateShallow(
+    VulkanStreamGuest* stream, uint32_t opcode, VkDevice device, const CreateInfo* pCreateInfo,
+    void (*transformCreateInfo)(ResourceTracker*, CreateInfo*),
+    void (*countCreateInfo)(uint32_t, VkStructureType, const CreateInfo*, size_t*),
+    void (*marshalCreateInfo)(VulkanStreamGuest*, VkStructureType, const CreateInfo*, uint8_t**),
+    void (VulkanHandleMapping::*mapHandles)(const uint64_t*, Handle*, size_t), Handle* pHandle) {
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    CreateInfo localCreateInfo = *pCreateInfo;
+    transformCreateInfo(sResourceTracker, &localCreateInfo);
+    size_t count = 8;
+    countCreateInfo(sFeatureBits, VK_STRUCTURE_TYPE_MAX_ENUM, &localCreateInfo, &count);
+    count += 8 + 8;
+    const uint32_t packetSize = 4 + 4 + (queueSubmitWithCommandsEnabled ? 4 : 0) + (uint32_t)count;
+    uint8_t* ptr = stream->reserve(packetSize);
+    putRaw(&ptr, opcode);
+    putRaw(&ptr, packetSize);
+    if (queueSubmitWithCommandsEnabled) putRaw(&ptr, ResourceTracker::nextSeqno());
+    putRaw(&ptr, get_host_u64_VkDevice(device));
+    marshalCreateInfo(stream, VK_STRUCTURE_TYPE_MAX_ENUM, &localCreateInfo, &ptr);
+    putRaw(&ptr, (uint64_t)0);
+    putRaw(&ptr, (uint64_t)(*pHandle));
+    stream->setHandleMapping(sResourceTracker->createMapping());
+    uint64_t handle;
+    stream->read(&handle, 8);
+    (stream->handleMapping()->*mapHandles)(&handle, pHandle, 1);
+    stream->unsetHandleMapping();
+    VkResult result = (VkResult)0;
+    stream->read(&result, sizeof(VkResult));
+    return result;
+}
+
+}  // namespace
+
+VkResult VkEncoder::encodeCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                  uint32_t createInfoCount,
+                                                  const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                                  const VkAllocationCallbacks* pAllocator,
+                                                  VkPipeline* pPipelines, uint32_t doLock) {
+    if (!useFastPath() || !pCreateInfos ||
+        !pipelineCreateInfosNeedNoTransform(pCreateInfos, createInfoCount)) {
+        return vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos,
+                                         pAllocator, pPipelines, doLock);
+    }
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    VkResult result = encodeCreatePipelinesInPlace(
+        mImpl->stream(), OP_vkCreateGraphicsPipelines, device, pipelineCache, createInfoCount,
+        pCreateInfos, count_VkGraphicsPipelineCreateInfo,
+        reservedmarshal_VkGraphicsPipelineCreateInfo, pPipelines);
+    endCreate();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+    return result;
+}
+
+VkResult VkEncoder::encodeCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                 uint32_t createInfoCount,
+                                                 const VkComputePipelineCreateInfo* pCreateInfos,
+                                                 const VkAllocationCallbacks* pAllocator,
+                                                 VkPipeline* pPipelines, uint32_t doLock) {
+    if (!useFastPath() || !pCreateInfos ||
+        !pipelineCreateInfosNeedNoTransform(pCreateInfos, createInfoCount)) {
+        return vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos,
+                                        pAllocator, pPipelines, doLock);
+    }
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    VkResult result = encodeCreatePipelinesInPlace(
+        mImpl->stream(), OP_vkCreateComputePipelines, device, pipelineCache, createInfoCount,
+        pCreateInfos, count_VkComputePipelineCreateInfo,
+        reservedmarshal_VkComputePipelineCreateInfo, pPipelines);
+    endCreate();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+    return result;
+}
+
+// Same pool upkeep as the generated encoders.
+void VkEncoder::endCreate() {
+    ++encodeCount;
+    if (0 == encodeCount % POOL_CLEAR_INTERVAL) {
+        mImpl->pool()->freeAll();
+        mImpl->stream()->clearPool();
+    }
+}
+
+VkResult VkEncoder::encodeAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                         const VkAllocationCallbacks* pAllocator,
+                                         VkDeviceMemory* pMemory, uint32_t doLock) {
+    if (!useFastPath() || !pAllocateInfo || !pNextNeedsNoTransform(pAllocateInfo->pNext)) {
+        return vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, doLock);
+    }
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    VkResult result = encodeCreateShallow(
+        mImpl->stream(), OP_vkAllocateMemory, device, pAllocateInfo,
+        transform_tohost_VkMemoryAllocateInfo, count_VkMemoryAllocateInfo,
+        reservedmarshal_VkMemoryAllocateInfo, &VulkanHandleMapping::mapHandles_u64_VkDeviceMemory,
+        pMemory);
+    endCreate();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+    return result;
+}
+
+VkResult VkEncoder::encodeCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
+                                       const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer,
+                                       uint32_t doLock) {
+    if (!useFastPath() || !pCreateInfo || !pNextNeedsNoTransform(pCreateInfo->pNext)) {
+        return vkCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, doLock);
+    }
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    VkResult result = encodeCreateShallow(
+        mImpl->stream(), OP_vkCreateBuffer, device, pCreateInfo,
+        transform_tohost_VkBufferCreateInfo, count_VkBufferCreateInfo,
+        reservedmarshal_VkBufferCreateInfo, &VulkanHandleMapping::mapHandles_u64_VkBuffer, pBuffer);
+    endCreate();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+    return result;
+}
+
+VkResult VkEncoder::encodeCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                                      const VkAllocationCallbacks* pAllocator, VkImage* pImage,
+                                      uint32_t doLock) {
+    if (!useFastPath() || !pCreateInfo || !pNextNeedsNoTransform(pCreateInfo->pNext)) {
+        return vkCreateImage(device, pCreateInfo, pAllocator, pImage, doLock);
+    }
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    VkResult result = encodeCreateShallow(
+        mImpl->stream(), OP_vkCreateImage, device, pCreateInfo, transform_tohost_VkImageCreateInfo,
+        count_VkImageCreateInfo, reservedmarshal_VkImageCreateInfo,
+        &VulkanHandleMapping::mapHandles_u64_VkImage, pImage);
+    endCreate();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+    return result;
+}
+
+VkResult VkEncoder::encodeCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
+                                          const VkAllocationCallbacks* pAllocator,
+                                          VkImageView* pView, uint32_t doLock) {
+    if (!useFastPath() || !pCreateInfo || !pNextNeedsNoTransform(pCreateInfo->pNext)) {
+        return vkCreateImageView(device, pCreateInfo, pAllocator, pView, doLock);
+    }
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    VkResult result = encodeCreateShallow(
+        mImpl->stream(), OP_vkCreateImageView, device, pCreateInfo,
+        transform_tohost_VkImageViewCreateInfo, count_VkImageViewCreateInfo,
+        reservedmarshal_VkImageViewCreateInfo, &VulkanHandleMapping::mapHandles_u64_VkImageView,
+        pView);
+    endCreate();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+    return result;
+}
+
+VkResult VkEncoder::encodeCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
+                                        const VkAllocationCallbacks* pAllocator,
+                                        VkSampler* pSampler, uint32_t doLock) {
+    if (!useFastPath() || !pCreateInfo || !pNextNeedsNoTransform(pCreateInfo->pNext)) {
+        return vkCreateSampler(device, pCreateInfo, pAllocator, pSampler, doLock);
+    }
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    VkResult result = encodeCreateShallow(
+        mImpl->stream(), OP_vkCreateSampler, device, pCreateInfo,
+        transform_tohost_VkSamplerCreateInfo, count_VkSamplerCreateInfo,
+        reservedmarshal_VkSamplerCreateInfo, &VulkanHandleMapping::mapHandles_u64_VkSampler,
+        pSampler);
+    endCreate();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+    return result;
+}
+
+void VkEncoder::vkUploadShaderCodeGOOGLE(VkDevice device, const uint64_t* pHash,
+                                         uint64_t codeSize, const uint32_t* pCode,
+                                         uint32_t doLock) {
+    ENCODER_DEBUG_LOG("vkUploadShaderCodeGOOGLE(device:%p, codeSize:%llu, pCode:%p)", device,
+                      (unsigned long long)codeSize, pCode);
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    auto stream = mImpl->stream();
+    const uint32_t opcode = OP_vkUploadShaderCodeGOOGLE;
+    const uint32_t packetSize =
+        4 + 4 + (queueSubmitWithCommandsEnabled ? 4 : 0) + 8 + 2 * 8 + 8 + (uint32_t)codeSize;
+    uint8_t* ptr = stream->reserve(packetSize);
+    putRaw(&ptr, opcode);
+    putRaw(&ptr, packetSize);
+    if (queueSubmitWithCommandsEnabled) putRaw(&ptr, ResourceTracker::nextSeqno());
+    putRaw(&ptr, get_host_u64_VkDevice(device));
+    putRaw(&ptr, pHash[0]);
+    putRaw(&ptr, pHash[1]);
+    putRaw(&ptr, codeSize);
+    memcpy(ptr, pCode, codeSize);
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+}
+
+VkResult VkEncoder::vkCreateShaderModuleFromHashGOOGLE(VkDevice device,
+                                                      VkShaderModuleCreateFlags flags,
+                                                      const uint64_t* pHash, uint64_t codeSize,
+                                                      VkShaderModule* pShaderModule,
+                                                      uint32_t doLock) {
+    ENCODER_DEBUG_LOG(
+        "vkCreateShaderModuleFromHashGOOGLE(device:%p, flags:%d, codeSize:%llu, "
+        "pShaderModule:%p)",
+        device, flags, (unsigned long long)codeSize, pShaderModule);
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    auto stream = mImpl->stream();
+    const uint32_t opcode = OP_vkCreateShaderModuleFromHashGOOGLE;
+    const uint32_t packetSize =
+        4 + 4 + (queueSubmitWithCommandsEnabled ? 4 : 0) + 8 + 4 + 2 * 8 + 8;
+    uint8_t* ptr = stream->reserve(packetSize);
+    putRaw(&ptr, opcode);
+    putRaw(&ptr, packetSize);
+    if (queueSubmitWithCommandsEnabled) putRaw(&ptr, ResourceTracker::nextSeqno());
+    putRaw(&ptr, get_host_u64_VkDevice(device));
+    putRaw(&ptr, (uint32_t)flags);
+    putRaw(&ptr, pHash[0]);
+    putRaw(&ptr, pHash[1]);
+    putRaw(&ptr, codeSize);
+
+    uint64_t hostModule = 0;
+    stream->read(&hostModule, 8);
+    VkResult result = (VkResult)0;
+    stream->read(&result, sizeof(VkResult));
+    // The host answers VK_INCOMPLETE, without a module, if it no longer
+    // has code for the hash.
+    if (result == VK_SUCCESS) {
+        stream->setHandleMapping(sResourceTracker->createMapping());
+        stream->handleMapping()->mapHandles_u64_VkShaderModule(&hostModule, pShaderModule, 1);
+        stream->unsetHandleMapping();
+    }
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+    return result;
+}
+
+void VkEncoder::appendEncodedCommands(const uint8_t* data, size_t size, uint32_t doLock) {
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    uint8_t* ptr = mImpl->stream()->reserve(size);
+    memcpy(ptr, data, size);
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+}
+
+void VkEncoder::vkReserveHandlesGOOGLE(VkDevice device, uint32_t count, uint64_t* pHandles,
+                                       uint32_t doLock) {
+    ENCODER_DEBUG_LOG("vkReserveHandlesGOOGLE(device:%p, count:%u, pHandles:%p)", device, count,
+                      pHandles);
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    auto stream = mImpl->stream();
+    const uint32_t opcode = OP_vkReserveHandlesGOOGLE;
+    const uint32_t packetSize = 4 + 4 + (queueSubmitWithCommandsEnabled ? 4 : 0) + 8 + 4;
+    uint8_t* ptr = stream->reserve(packetSize);
+    putRaw(&ptr, opcode);
+    putRaw(&ptr, packetSize);
+    if (queueSubmitWithCommandsEnabled) putRaw(&ptr, ResourceTracker::nextSeqno());
+    putRaw(&ptr, get_host_u64_VkDevice(device));
+    putRaw(&ptr, count);
+    stream->read(pHandles, count * sizeof(uint64_t));
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+}
+
+namespace {
+
+// The packet of a create under a reserved handle: the device, the create
+// info and the handle. There is no reply; the host reports a failed create
+// as it would a lost device.
+template <typename CreateInfo>
+void encodeCreateAsync(VulkanStreamGuest* stream, uint32_t opcode, VkDevice device,
+                       const CreateInfo* pCreateInfo,
+                       void (*countCreateInfo)(uint32_t, VkStructureType, const CreateInfo*,
+                                               size_t*),
+                       void (*marshalCreateInfo)(VulkanStreamGuest*, VkStructureType,
+                                                 const CreateInfo*, uint8_t**),
+                       uint64_t handle) {
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    size_t createInfoSize = 0;
+    countCreateInfo(sFeatureBits, VK_STRUCTURE_TYPE_MAX_ENUM, pCreateInfo, &createInfoSize);
+    const uint32_t packetSize =
+        4 + 4 + (queueSubmitWithCommandsEnabled ? 4 : 0) + 8 + (uint32_t)createInfoSize + 8;
+    uint8_t* ptr = stream->reserve(packetSize);
+    putRaw(&ptr, opcode);
+    putRaw(&ptr, packetSize);
+    if (queueSubmitWithCommandsEnabled) putRaw(&ptr, ResourceTracker::nextSeqno());
+    putRaw(&ptr, get_host_u64_VkDevice(device));
+    marshalCreateInfo(stream, VK_STRUCTURE_TYPE_MAX_ENUM, pCreateInfo, &ptr);
+    putRaw(&ptr, handle);
+}
+
+}  // namespace
+
+void VkEncoder::vkCreateImageViewAsyncGOOGLE(VkDevice device,
+                                             const VkImageViewCreateInfo* pCreateInfo,
+                                             uint64_t handle, VkImageView* pView,
+                                             uint32_t doLock) {
+    ENCODER_DEBUG_LOG("vkCreateImageViewAsyncGOOGLE(device:%p, pCreateInfo:%p, pView:%p)",
+                      device, pCreateInfo, pView);
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    auto stream = mImpl->stream();
+    encodeCreateAsync(stream, OP_vkCreateImageViewAsyncGOOGLE, device, pCreateInfo,
+                      count_VkImageViewCreateInfo, reservedmarshal_VkImageViewCreateInfo, handle);
+    stream->setHandleMapping(sResourceTracker->createMapping());
+    stream->handleMapping()->mapHandles_u64_VkImageView(&handle, pView, 1);
+    stream->unsetHandleMapping();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+}
+
+void VkEncoder::vkCreateSamplerAsyncGOOGLE(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
+                                           uint64_t handle, VkSampler* pSampler, uint32_t doLock) {
+    ENCODER_DEBUG_LOG("vkCreateSamplerAsyncGOOGLE(device:%p, pCreateInfo:%p, pSampler:%p)",
+                      device, pCreateInfo, pSampler);
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    auto stream = mImpl->stream();
+    encodeCreateAsync(stream, OP_vkCreateSamplerAsyncGOOGLE, device, pCreateInfo,
+                      count_VkSamplerCreateInfo, reservedmarshal_VkSamplerCreateInfo, handle);
+    stream->setHandleMapping(sResourceTracker->createMapping());
+    stream->handleMapping()->mapHandles_u64_VkSampler(&handle, pSampler, 1);
+    stream->unsetHandleMapping();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+}
+
+void VkEncoder::vkCreateFramebufferAsyncGOOGLE(VkDevice device,
+                                               const VkFramebufferCreateInfo* pCreateInfo,
+                                               uint64_t handle, VkFramebuffer* pFramebuffer,
+                                               uint32_t doLock) {
+    ENCODER_DEBUG_LOG("vkCreateFramebufferAsyncGOOGLE(device:%p, pCreateInfo:%p, pFramebuffer:%p)",
+                      device, pCreateInfo, pFramebuffer);
+    const bool queueSubmitWithCommandsEnabled =
+        sFeatureBits & VULKAN_STREAM_FEATURE_QUEUE_SUBMIT_WITH_COMMANDS_BIT;
+    if (!queueSubmitWithCommandsEnabled && doLock) this->lock();
+    auto stream = mImpl->stream();
+    encodeCreateAsync(stream, OP_vkCreateFramebufferAsyncGOOGLE, device, pCreateInfo,
+                      count_VkFramebufferCreateInfo, reservedmarshal_VkFramebufferCreateInfo,
+                      handle);
+    stream->setHandleMapping(sResourceTracker->createMapping());
+    stream->handleMapping()->mapHandles_u64_VkFramebuffer(&handle, pFramebuffer, 1);
+    stream->unsetHandleMapping();
+    if (!queueSubmitWithCommandsEnabled && doLock) this->unlock();
+}
@@ -8,3 +8,108 @@
     #define POOL_CLEAR_INTERVAL 10
     uint32_t encodeCount = 0;
     uint32_t featureBits = 0;
+
+   public:
+    // Hand-written encoders for the hottest vkCmd* calls, used by the
+    // ResourceTracker hooks in place of the generated ones; see
+    // VkEncoder.cpp.inl. They use the generated ones where those must run.
+    void encodeCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount,
+                       uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance,
+                       uint32_t doLock);
+    void encodeCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount,
+                              uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset,
+                              uint32_t firstInstance, uint32_t doLock);
+    void encodeCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                               VkDeviceSize offset, uint32_t drawCount, uint32_t stride,
+                               uint32_t doLock);
+    void encodeCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                      VkDeviceSize offset, uint32_t drawCount, uint32_t stride,
+                                      uint32_t doLock);
+    void encodeCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
+                                VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size,
+                                const void* pValues, uint32_t doLock);
+    void encodeCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer,
+                             VkBuffer dstBuffer, uint32_t regionCount,
+                             const VkBufferCopy* pRegions, uint32_t doLock);
+    void encodeCmdBindDescriptorSets(VkCommandBuffer commandBuffer,
+                                     VkPipelineBindPoint pipelineBindPoint,
+                                     VkPipelineLayout layout, uint32_t firstSet,
+                                     uint32_t descriptorSetCount,
+                                     const VkDescriptorSet* pDescriptorSets,
+                                     uint32_t dynamicOffsetCount,
+                                     const uint32_t* pDynamicOffsets, uint32_t doLock);
+    void encodeCmdPipelineBarrier(VkCommandBuffer commandBuffer,
+                                  VkPipelineStageFlags srcStageMask,
+                                  VkPipelineStageFlags dstStageMask,
+                                  VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount,
+                                  const VkMemoryBarrier* pMemoryBarriers,
+                                  uint32_t bufferMemoryBarrierCount,
+                                  const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                  uint32_t imageMemoryBarrierCount,
+                                  const VkImageMemoryBarrier* pImageMemoryBarriers,
+                                  uint32_t doLock);
+
+    // Marshal straight from the caller's create infos when their pNext
+    // chains need no transform.
+    VkResult encodeCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                           uint32_t createInfoCount,
+                                           const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                           const VkAllocationCallbacks* pAllocator,
+                                           VkPipeline* pPipelines, uint32_t doLock);
+    VkResult encodeCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                          uint32_t createInfoCount,
+                                          const VkComputePipelineCreateInfo* pCreateInfos,
+                                          const VkAllocationCallbacks* pAllocator,
+                                          VkPipeline* pPipelines, uint32_t doLock);
+    // Copy only the top-level create info when its pNext chain needs no
+    // transform.
+    VkResult encodeAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                  const VkAllocationCallbacks* pAllocator,
+                                  VkDeviceMemory* pMemory, uint32_t doLock);
+    VkResult encodeCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
+                                const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer,
+                                uint32_t doLock);
+    VkResult encodeCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                               const VkAllocationCallbacks* pAllocator, VkImage* pImage,
+                               uint32_t doLock);
+    VkResult encodeCreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
+                                   const VkAllocationCallbacks* pAllocator, VkImageView* pView,
+                                   uint32_t doLock);
+    VkResult encodeCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
+                                 const VkAllocationCallbacks* pAllocator, VkSampler* pSampler,
+                                 uint32_t doLock);
+
+   private:
+    bool useFastPath() const;
+    template <typename... Args>
+    void encodeCmdFixed(uint32_t opcode, VkCommandBuffer commandBuffer, uint32_t doLock,
+                        const Args&... args);
+    uint8_t* beginCmd(uint32_t opcode, VkCommandBuffer commandBuffer, uint32_t doLock,
+                      uint32_t payloadSize);
+    void endCmd(uint32_t doLock);
+    void endCreate();
+
+   public:
+    // Shader code cache, see ResourceTracker::on_vkCreateShaderModule.
+    // pHash points at the two halves of the 128-bit hash of pCode.
+    void vkUploadShaderCodeGOOGLE(VkDevice device, const uint64_t* pHash, uint64_t codeSize,
+                                  const uint32_t* pCode, uint32_t doLock);
+    VkResult vkCreateShaderModuleFromHashGOOGLE(VkDevice device, VkShaderModuleCreateFlags flags,
+                                                const uint64_t* pHash, uint64_t codeSize,
+                                                VkShaderModule* pShaderModule, uint32_t doLock);
+    // Guest chosen handles, see ResourceTracker::takeReservedHandle. The
+    // creates use a handle from vkReserveHandlesGOOGLE and do not wait
+    // for the host; their create infos must have no pNext chain.
+    void vkReserveHandlesGOOGLE(VkDevice device, uint32_t count, uint64_t* pHandles,
+                                uint32_t doLock);
+    void vkCreateImageViewAsyncGOOGLE(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
+                                      uint64_t handle, VkImageView* pView, uint32_t doLock);
+    void vkCreateSamplerAsyncGOOGLE(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
+                                    uint64_t handle, VkSampler* pSampler, uint32_t doLock);
+    void vkCreateFramebufferAsyncGOOGLE(VkDevice device,
+                                        const VkFramebufferCreateInfo* pCreateInfo,
+                                        uint64_t handle, VkFramebuffer* pFramebuffer,
+                                        uint32_t doLock);
+    // Copies already encoded commands, such as those of an inlined
+    // secondary command buffer, into this encoder's stream.
+    void appendEncodedCommands(const uint8_t* data, size_t size, uint32_t doLock);
@@ -34,6 +34,7 @@ void VulkanStreamGuest::alloc(void** ptrAddr, size_t bytes) {
     }
 
     *ptrAddr = mPool.alloc(bytes);
+    mPoolMemory.set(mPool.bytesHeld());
 }
 
 void VulkanStreamGuest::loadStringInPlace(char** forOutput) {
@@ -41,7 +42,7 @@ void VulkanStreamGuest::loadStringInPlace(char** forOutput) {
 
     alloc((void**)forOutput, len + 1);
 
-    memset(*forOutput, 0x0, len + 1);
+    (*forOutput)[len] = 0;
 
     if (len > 0) read(*forOutput, len);
 }
@@ -100,6 +101,12 @@ void VulkanStreamGuest::loadStringArrayInPlaceWithStreamPtr(char*** forOutput, u
 
 
 ssize_t VulkanStreamGuest::read(void *buffer, size_t size) {
+    // Past the first read of a response, fields usually come straight out
+    // of what the transport already buffered.
+    if (const unsigned char* view = mStream->readbackView(size)) {
+        memcpy(buffer, view, size);
+        return size;
+    }
     if (!mStream->readback(buffer, size)) {
         ALOGE("FATAL: Could not read back %zu bytes", size);
         abort();
@@ -114,11 +121,13 @@ ssize_t VulkanStreamGuest::write(const void *buffer, size_t size) {
 }
 
 void VulkanStreamGuest::writeLarge(const void* buffer, size_t size) {
+    IOStream::profileWrite(size);
     mStream->writeFullyAsync(buffer, size);
 }
 
 void VulkanStreamGuest::clearPool() {
     mPool.freeAll();
+    mPoolMemory.set(mPool.bytesHeld());
 }
 
 void VulkanStreamGuest::setHandleMapping(VulkanHandleMapping* mapping) {
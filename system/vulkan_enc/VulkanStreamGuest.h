@@ -24,6 +24,7 @@
 #include "ResourceTracker.h"
 
 #include "aemu/base/BumpPool.h"
+#include "aemu/base/MemoryAccounting.h"
 #include "aemu/base/Tracing.h"
 
 #include <vector>
@@ -79,6 +80,8 @@ public:
     uint8_t* reserve(size_t size);
 private:
     android::base::BumpPool mPool;
+    android::base::guest::AccountedMemory mPoolMemory{
+        android::base::guest::GraphicsMemory::kVulkanStreamPools};
     std::vector<uint8_t> mWriteBuffer;
     IOStream* mStream = nullptr;
     DefaultHandleMapping mDefaultHandleMapping;
@@ -87,7 +87,8 @@ static void entry_vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice,
                                               VkPhysicalDeviceFeatures* pFeatures) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceFeatures");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceFeatures(physicalDevice, pFeatures, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->getPhysicalDeviceFeatures(vkEnc, physicalDevice, pFeatures);
 }
 static void entry_vkGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice,
                                                       VkFormat format,
@@ -104,17 +105,19 @@ static VkResult entry_vkGetPhysicalDeviceImageFormatProperties(
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceImageFormatProperties");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkGetPhysicalDeviceImageFormatProperties_VkResult_return = (VkResult)0;
+    auto resources = ResourceTracker::get();
     vkGetPhysicalDeviceImageFormatProperties_VkResult_return =
-        vkEnc->vkGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage,
-                                                        flags, pImageFormatProperties,
-                                                        true /* do lock */);
+        resources->getPhysicalDeviceImageFormatProperties(vkEnc, physicalDevice, format, type,
+                                                          tiling, usage, flags,
+                                                          pImageFormatProperties);
     return vkGetPhysicalDeviceImageFormatProperties_VkResult_return;
 }
 static void entry_vkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
                                                 VkPhysicalDeviceProperties* pProperties) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceProperties");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceProperties(physicalDevice, pProperties, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->getPhysicalDeviceProperties(vkEnc, physicalDevice, pProperties);
 }
 static void entry_vkGetPhysicalDeviceQueueFamilyProperties(
     VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount,
@@ -128,8 +131,8 @@ static void entry_vkGetPhysicalDeviceMemoryProperties(
     VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceMemoryProperties");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties,
-                                               true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkGetPhysicalDeviceMemoryProperties(vkEnc, physicalDevice, pMemoryProperties);
 }
 static PFN_vkVoidFunction entry_vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
     AEMU_SCOPED_TRACE("vkGetInstanceProcAddr");
@@ -234,7 +237,8 @@ static VkResult entry_vkDeviceWaitIdle(VkDevice device) {
     AEMU_SCOPED_TRACE("vkDeviceWaitIdle");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkDeviceWaitIdle_VkResult_return = (VkResult)0;
-    vkDeviceWaitIdle_VkResult_return = vkEnc->vkDeviceWaitIdle(device, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    vkDeviceWaitIdle_VkResult_return = resources->on_vkDeviceWaitIdle(vkEnc, VK_SUCCESS, device);
     return vkDeviceWaitIdle_VkResult_return;
 }
 static VkResult entry_vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
@@ -274,8 +278,9 @@ static VkResult entry_vkFlushMappedMemoryRanges(VkDevice device, uint32_t memory
     AEMU_SCOPED_TRACE("vkFlushMappedMemoryRanges");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkFlushMappedMemoryRanges_VkResult_return = (VkResult)0;
-    vkFlushMappedMemoryRanges_VkResult_return = vkEnc->vkFlushMappedMemoryRanges(
-        device, memoryRangeCount, pMemoryRanges, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    vkFlushMappedMemoryRanges_VkResult_return = resources->on_vkFlushMappedMemoryRanges(
+        vkEnc, VK_SUCCESS, device, memoryRangeCount, pMemoryRanges);
     return vkFlushMappedMemoryRanges_VkResult_return;
 }
 static VkResult entry_vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
@@ -283,8 +288,9 @@ static VkResult entry_vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t m
     AEMU_SCOPED_TRACE("vkInvalidateMappedMemoryRanges");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkInvalidateMappedMemoryRanges_VkResult_return = (VkResult)0;
-    vkInvalidateMappedMemoryRanges_VkResult_return = vkEnc->vkInvalidateMappedMemoryRanges(
-        device, memoryRangeCount, pMemoryRanges, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    vkInvalidateMappedMemoryRanges_VkResult_return = resources->on_vkInvalidateMappedMemoryRanges(
+        vkEnc, VK_SUCCESS, device, memoryRangeCount, pMemoryRanges);
     return vkInvalidateMappedMemoryRanges_VkResult_return;
 }
 static void entry_vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory,
@@ -349,6 +355,7 @@ static VkResult entry_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount,
                                         const VkBindSparseInfo* pBindInfo, VkFence fence) {
     AEMU_SCOPED_TRACE("vkQueueBindSparse");
     auto vkEnc = ResourceTracker::getQueueEncoder(queue);
+    ResourceTracker::get()->on_vkQueueBindSparse_pre(vkEnc, queue, bindInfoCount, pBindInfo, fence);
     VkResult vkQueueBindSparse_VkResult_return = (VkResult)0;
     vkQueueBindSparse_VkResult_return =
         vkEnc->vkQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, true /* do lock */);
@@ -383,7 +390,9 @@ static VkResult entry_vkGetFenceStatus(VkDevice device, VkFence fence) {
     AEMU_SCOPED_TRACE("vkGetFenceStatus");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkGetFenceStatus_VkResult_return = (VkResult)0;
-    vkGetFenceStatus_VkResult_return = vkEnc->vkGetFenceStatus(device, fence, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    vkGetFenceStatus_VkResult_return =
+        resources->on_vkGetFenceStatus(vkEnc, VK_SUCCESS, device, fence);
     return vkGetFenceStatus_VkResult_return;
 }
 static VkResult entry_vkWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences,
@@ -432,6 +441,7 @@ static void entry_vkDestroyEvent(VkDevice device, VkEvent event,
 static VkResult entry_vkGetEventStatus(VkDevice device, VkEvent event) {
     AEMU_SCOPED_TRACE("vkGetEventStatus");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
+    ResourceTracker::get()->waitForQueueSubmitThreads(vkEnc);
     VkResult vkGetEventStatus_VkResult_return = (VkResult)0;
     vkGetEventStatus_VkResult_return = vkEnc->vkGetEventStatus(device, event, true /* do lock */);
     return vkGetEventStatus_VkResult_return;
@@ -464,7 +474,8 @@ static void entry_vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool,
                                      const VkAllocationCallbacks* pAllocator) {
     AEMU_SCOPED_TRACE("vkDestroyQueryPool");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkDestroyQueryPool(device, queryPool, pAllocator, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkDestroyQueryPool(vkEnc, device, queryPool, pAllocator);
 }
 static VkResult entry_vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool,
                                             uint32_t firstQuery, uint32_t queryCount,
@@ -473,9 +484,10 @@ static VkResult entry_vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPo
     AEMU_SCOPED_TRACE("vkGetQueryPoolResults");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkGetQueryPoolResults_VkResult_return = (VkResult)0;
+    auto resources = ResourceTracker::get();
     vkGetQueryPoolResults_VkResult_return =
-        vkEnc->vkGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData,
-                                     stride, flags, true /* do lock */);
+        resources->on_vkGetQueryPoolResults(vkEnc, VK_SUCCESS, device, queryPool, firstQuery,
+                                            queryCount, dataSize, pData, stride, flags);
     return vkGetQueryPoolResults_VkResult_return;
 }
 static VkResult entry_vkCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
@@ -559,15 +571,17 @@ static VkResult entry_vkCreateShaderModule(VkDevice device,
     AEMU_SCOPED_TRACE("vkCreateShaderModule");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkCreateShaderModule_VkResult_return = (VkResult)0;
-    vkCreateShaderModule_VkResult_return = vkEnc->vkCreateShaderModule(
-        device, pCreateInfo, pAllocator, pShaderModule, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    vkCreateShaderModule_VkResult_return = resources->on_vkCreateShaderModule(
+        vkEnc, VK_SUCCESS, device, pCreateInfo, pAllocator, pShaderModule);
     return vkCreateShaderModule_VkResult_return;
 }
 static void entry_vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
                                         const VkAllocationCallbacks* pAllocator) {
     AEMU_SCOPED_TRACE("vkDestroyShaderModule");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkDestroyShaderModule(device, shaderModule, pAllocator, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkDestroyShaderModule(vkEnc, device, shaderModule, pAllocator);
 }
 static VkResult entry_vkCreatePipelineCache(VkDevice device,
                                             const VkPipelineCacheCreateInfo* pCreateInfo,
@@ -627,16 +641,18 @@ static VkResult entry_vkCreateComputePipelines(VkDevice device, VkPipelineCache
     AEMU_SCOPED_TRACE("vkCreateComputePipelines");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkCreateComputePipelines_VkResult_return = (VkResult)0;
-    vkCreateComputePipelines_VkResult_return =
-        vkEnc->vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos,
-                                        pAllocator, pPipelines, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    vkCreateComputePipelines_VkResult_return = resources->on_vkCreateComputePipelines(
+        vkEnc, VK_SUCCESS, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+        pPipelines);
     return vkCreateComputePipelines_VkResult_return;
 }
 static void entry_vkDestroyPipeline(VkDevice device, VkPipeline pipeline,
                                     const VkAllocationCallbacks* pAllocator) {
     AEMU_SCOPED_TRACE("vkDestroyPipeline");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkDestroyPipeline(device, pipeline, pAllocator, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkDestroyPipeline(vkEnc, device, pipeline, pAllocator);
 }
 static VkResult entry_vkCreatePipelineLayout(VkDevice device,
                                              const VkPipelineLayoutCreateInfo* pCreateInfo,
@@ -653,7 +669,8 @@ static void entry_vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipe
                                           const VkAllocationCallbacks* pAllocator) {
     AEMU_SCOPED_TRACE("vkDestroyPipelineLayout");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkDestroyPipelineLayout(device, pipelineLayout, pAllocator, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkDestroyPipelineLayout(vkEnc, device, pipelineLayout, pAllocator);
 }
 static VkResult entry_vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
                                       const VkAllocationCallbacks* pAllocator,
@@ -670,7 +687,8 @@ static void entry_vkDestroySampler(VkDevice device, VkSampler sampler,
                                    const VkAllocationCallbacks* pAllocator) {
     AEMU_SCOPED_TRACE("vkDestroySampler");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkDestroySampler(device, sampler, pAllocator, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkDestroySampler(vkEnc, device, sampler, pAllocator);
 }
 static VkResult entry_vkCreateDescriptorSetLayout(
     VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
@@ -759,8 +777,9 @@ static VkResult entry_vkCreateFramebuffer(VkDevice device,
     AEMU_SCOPED_TRACE("vkCreateFramebuffer");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkCreateFramebuffer_VkResult_return = (VkResult)0;
-    vkCreateFramebuffer_VkResult_return = vkEnc->vkCreateFramebuffer(
-        device, pCreateInfo, pAllocator, pFramebuffer, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    vkCreateFramebuffer_VkResult_return = resources->on_vkCreateFramebuffer(
+        vkEnc, VK_SUCCESS, device, pCreateInfo, pAllocator, pFramebuffer);
     return vkCreateFramebuffer_VkResult_return;
 }
 static void entry_vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer,
@@ -783,7 +802,8 @@ static void entry_vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass,
                                       const VkAllocationCallbacks* pAllocator) {
     AEMU_SCOPED_TRACE("vkDestroyRenderPass");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkDestroyRenderPass(device, renderPass, pAllocator, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkDestroyRenderPass(vkEnc, device, renderPass, pAllocator);
 }
 static void entry_vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass,
                                              VkExtent2D* pGranularity) {
@@ -876,63 +896,71 @@ static void entry_vkCmdBindPipeline(VkCommandBuffer commandBuffer,
                                     VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
     AEMU_SCOPED_TRACE("vkCmdBindPipeline");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdBindPipeline(vkEnc, commandBuffer, pipelineBindPoint, pipeline);
 }
 static void entry_vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport,
                                    uint32_t viewportCount, const VkViewport* pViewports) {
     AEMU_SCOPED_TRACE("vkCmdSetViewport");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports,
-                            true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetViewport(vkEnc, commandBuffer, firstViewport, viewportCount, pViewports);
 }
 static void entry_vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor,
                                   uint32_t scissorCount, const VkRect2D* pScissors) {
     AEMU_SCOPED_TRACE("vkCmdSetScissor");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors,
-                           true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetScissor(vkEnc, commandBuffer, firstScissor, scissorCount, pScissors);
 }
 static void entry_vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     AEMU_SCOPED_TRACE("vkCmdSetLineWidth");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetLineWidth(commandBuffer, lineWidth, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetLineWidth(vkEnc, commandBuffer, lineWidth);
 }
 static void entry_vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor,
                                     float depthBiasClamp, float depthBiasSlopeFactor) {
     AEMU_SCOPED_TRACE("vkCmdSetDepthBias");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp,
-                             depthBiasSlopeFactor, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetDepthBias(vkEnc, commandBuffer, depthBiasConstantFactor, depthBiasClamp,
+                                    depthBiasSlopeFactor);
 }
 static void entry_vkCmdSetBlendConstants(VkCommandBuffer commandBuffer,
                                          const float blendConstants[4]) {
     AEMU_SCOPED_TRACE("vkCmdSetBlendConstants");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetBlendConstants(commandBuffer, blendConstants, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetBlendConstants(vkEnc, commandBuffer, blendConstants);
 }
 static void entry_vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds,
                                       float maxDepthBounds) {
     AEMU_SCOPED_TRACE("vkCmdSetDepthBounds");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetDepthBounds(vkEnc, commandBuffer, minDepthBounds, maxDepthBounds);
 }
 static void entry_vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer,
                                              VkStencilFaceFlags faceMask, uint32_t compareMask) {
     AEMU_SCOPED_TRACE("vkCmdSetStencilCompareMask");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetStencilCompareMask(vkEnc, commandBuffer, faceMask, compareMask);
 }
 static void entry_vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
                                            VkStencilFaceFlags faceMask, uint32_t writeMask) {
     AEMU_SCOPED_TRACE("vkCmdSetStencilWriteMask");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetStencilWriteMask(vkEnc, commandBuffer, faceMask, writeMask);
 }
 static void entry_vkCmdSetStencilReference(VkCommandBuffer commandBuffer,
                                            VkStencilFaceFlags faceMask, uint32_t reference) {
     AEMU_SCOPED_TRACE("vkCmdSetStencilReference");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetStencilReference(commandBuffer, faceMask, reference, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetStencilReference(vkEnc, commandBuffer, faceMask, reference);
 }
 static void entry_vkCmdBindDescriptorSets(
     VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout,
@@ -963,30 +991,34 @@ static void entry_vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount,
                             uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
     AEMU_SCOPED_TRACE("vkCmdDraw");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance,
-                     true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdDraw(vkEnc, commandBuffer, vertexCount, instanceCount, firstVertex,
+                            firstInstance);
 }
 static void entry_vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount,
                                    uint32_t instanceCount, uint32_t firstIndex,
                                    int32_t vertexOffset, uint32_t firstInstance) {
     AEMU_SCOPED_TRACE("vkCmdDrawIndexed");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
-                            firstInstance, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdDrawIndexed(vkEnc, commandBuffer, indexCount, instanceCount, firstIndex,
+                                   vertexOffset, firstInstance);
 }
 static void entry_vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                     VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
     AEMU_SCOPED_TRACE("vkCmdDrawIndirect");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdDrawIndirect(vkEnc, commandBuffer, buffer, offset, drawCount, stride);
 }
 static void entry_vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                            VkDeviceSize offset, uint32_t drawCount,
                                            uint32_t stride) {
     AEMU_SCOPED_TRACE("vkCmdDrawIndexedIndirect");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride,
-                                    true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdDrawIndexedIndirect(vkEnc, commandBuffer, buffer, offset, drawCount,
+                                           stride);
 }
 static void entry_vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX,
                                 uint32_t groupCountY, uint32_t groupCountZ) {
@@ -1005,8 +1037,9 @@ static void entry_vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuf
                                   const VkBufferCopy* pRegions) {
     AEMU_SCOPED_TRACE("vkCmdCopyBuffer");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions,
-                           true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdCopyBuffer(vkEnc, commandBuffer, srcBuffer, dstBuffer, regionCount,
+                                  pRegions);
 }
 static void entry_vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage,
                                  VkImageLayout srcImageLayout, VkImage dstImage,
@@ -1173,8 +1206,9 @@ static void entry_vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLa
                                      const void* pValues) {
     AEMU_SCOPED_TRACE("vkCmdPushConstants");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues,
-                              true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdPushConstants(vkEnc, commandBuffer, layout, stageFlags, offset, size,
+                                     pValues);
 }
 static void entry_vkCmdBeginRenderPass(VkCommandBuffer commandBuffer,
                                        const VkRenderPassBeginInfo* pRenderPassBegin,
@@ -1365,13 +1399,15 @@ static void entry_vkGetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice,
                                                VkPhysicalDeviceFeatures2* pFeatures) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceFeatures2");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceFeatures2(physicalDevice, pFeatures, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->getPhysicalDeviceFeatures2(false /* not KHR */, vkEnc, physicalDevice, pFeatures);
 }
 static void entry_vkGetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice,
                                                  VkPhysicalDeviceProperties2* pProperties) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceProperties2");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceProperties2(physicalDevice, pProperties, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->getPhysicalDeviceProperties2(false /* not KHR */, vkEnc, physicalDevice, pProperties);
 }
 static void entry_vkGetPhysicalDeviceFormatProperties2(VkPhysicalDevice physicalDevice,
                                                        VkFormat format,
@@ -1405,8 +1441,8 @@ static void entry_vkGetPhysicalDeviceMemoryProperties2(
     VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceMemoryProperties2");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties,
-                                                true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkGetPhysicalDeviceMemoryProperties2(vkEnc, physicalDevice, pMemoryProperties);
 }
 static void entry_vkGetPhysicalDeviceSparseImageFormatProperties2(
     VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo,
@@ -1676,7 +1712,8 @@ static void entry_vkResetQueryPool(VkDevice device, VkQueryPool queryPool, uint3
                                    uint32_t queryCount) {
     AEMU_SCOPED_TRACE("vkResetQueryPool");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkResetQueryPool(device, queryPool, firstQuery, queryCount, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkResetQueryPool(vkEnc, device, queryPool, firstQuery, queryCount);
 }
 static void dynCheck_entry_vkResetQueryPool(VkDevice device, VkQueryPool queryPool,
                                             uint32_t firstQuery, uint32_t queryCount) {
@@ -1686,15 +1723,16 @@ static void dynCheck_entry_vkResetQueryPool(VkDevice device, VkQueryPool queryPo
     }
     AEMU_SCOPED_TRACE("vkResetQueryPool");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkResetQueryPool(device, queryPool, firstQuery, queryCount, true /* do lock */);
+    resources->on_vkResetQueryPool(vkEnc, device, queryPool, firstQuery, queryCount);
 }
 static VkResult entry_vkGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore,
                                                  uint64_t* pValue) {
     AEMU_SCOPED_TRACE("vkGetSemaphoreCounterValue");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkGetSemaphoreCounterValue_VkResult_return = (VkResult)0;
+    auto resources = ResourceTracker::get();
     vkGetSemaphoreCounterValue_VkResult_return =
-        vkEnc->vkGetSemaphoreCounterValue(device, semaphore, pValue, true /* do lock */);
+        resources->on_vkGetSemaphoreCounterValue(vkEnc, VK_SUCCESS, device, semaphore, pValue);
     return vkGetSemaphoreCounterValue_VkResult_return;
 }
 static VkResult dynCheck_entry_vkGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore,
@@ -1707,7 +1745,7 @@ static VkResult dynCheck_entry_vkGetSemaphoreCounterValue(VkDevice device, VkSem
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkGetSemaphoreCounterValue_VkResult_return = (VkResult)0;
     vkGetSemaphoreCounterValue_VkResult_return =
-        vkEnc->vkGetSemaphoreCounterValue(device, semaphore, pValue, true /* do lock */);
+        resources->on_vkGetSemaphoreCounterValue(vkEnc, VK_SUCCESS, device, semaphore, pValue);
     return vkGetSemaphoreCounterValue_VkResult_return;
 }
 static VkResult entry_vkWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo,
@@ -1715,8 +1753,9 @@ static VkResult entry_vkWaitSemaphores(VkDevice device, const VkSemaphoreWaitInf
     AEMU_SCOPED_TRACE("vkWaitSemaphores");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkWaitSemaphores_VkResult_return = (VkResult)0;
+    auto resources = ResourceTracker::get();
     vkWaitSemaphores_VkResult_return =
-        vkEnc->vkWaitSemaphores(device, pWaitInfo, timeout, true /* do lock */);
+        resources->on_vkWaitSemaphores(vkEnc, VK_SUCCESS, device, pWaitInfo, timeout);
     return vkWaitSemaphores_VkResult_return;
 }
 static VkResult dynCheck_entry_vkWaitSemaphores(VkDevice device,
@@ -1730,15 +1769,16 @@ static VkResult dynCheck_entry_vkWaitSemaphores(VkDevice device,
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkWaitSemaphores_VkResult_return = (VkResult)0;
     vkWaitSemaphores_VkResult_return =
-        vkEnc->vkWaitSemaphores(device, pWaitInfo, timeout, true /* do lock */);
+        resources->on_vkWaitSemaphores(vkEnc, VK_SUCCESS, device, pWaitInfo, timeout);
     return vkWaitSemaphores_VkResult_return;
 }
 static VkResult entry_vkSignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
     AEMU_SCOPED_TRACE("vkSignalSemaphore");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkSignalSemaphore_VkResult_return = (VkResult)0;
+    auto resources = ResourceTracker::get();
     vkSignalSemaphore_VkResult_return =
-        vkEnc->vkSignalSemaphore(device, pSignalInfo, true /* do lock */);
+        resources->on_vkSignalSemaphore(vkEnc, VK_SUCCESS, device, pSignalInfo);
     return vkSignalSemaphore_VkResult_return;
 }
 static VkResult dynCheck_entry_vkSignalSemaphore(VkDevice device,
@@ -1751,7 +1791,7 @@ static VkResult dynCheck_entry_vkSignalSemaphore(VkDevice device,
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkSignalSemaphore_VkResult_return = (VkResult)0;
     vkSignalSemaphore_VkResult_return =
-        vkEnc->vkSignalSemaphore(device, pSignalInfo, true /* do lock */);
+        resources->on_vkSignalSemaphore(vkEnc, VK_SUCCESS, device, pSignalInfo);
     return vkSignalSemaphore_VkResult_return;
 }
 static VkDeviceAddress entry_vkGetBufferDeviceAddress(VkDevice device,
@@ -2026,13 +2066,15 @@ static void entry_vkCmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint3
                                             const VkViewport* pViewports) {
     AEMU_SCOPED_TRACE("vkCmdSetViewportWithCount");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetViewportWithCount(vkEnc, commandBuffer, viewportCount, pViewports);
 }
 static void entry_vkCmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount,
                                            const VkRect2D* pScissors) {
     AEMU_SCOPED_TRACE("vkCmdSetScissorWithCount");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetScissorWithCount(vkEnc, commandBuffer, scissorCount, pScissors);
 }
 static void entry_vkCmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding,
                                           uint32_t bindingCount, const VkBuffer* pBuffers,
@@ -2312,6 +2354,7 @@ static VkResult dynCheck_entry_vkAcquireNextImageKHR(VkDevice device, VkSwapchai
 static VkResult entry_vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
     AEMU_SCOPED_TRACE("vkQueuePresentKHR");
     auto vkEnc = ResourceTracker::getQueueEncoder(queue);
+    ResourceTracker::get()->waitForQueueSubmitThreads(vkEnc);
     VkResult vkQueuePresentKHR_VkResult_return = (VkResult)0;
     vkQueuePresentKHR_VkResult_return =
         vkEnc->vkQueuePresentKHR(queue, pPresentInfo, true /* do lock */);
@@ -2926,13 +2969,15 @@ static void entry_vkGetPhysicalDeviceFeatures2KHR(VkPhysicalDevice physicalDevic
                                                   VkPhysicalDeviceFeatures2* pFeatures) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceFeatures2KHR");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->getPhysicalDeviceFeatures2(true /* is KHR */, vkEnc, physicalDevice, pFeatures);
 }
 static void entry_vkGetPhysicalDeviceProperties2KHR(VkPhysicalDevice physicalDevice,
                                                     VkPhysicalDeviceProperties2* pProperties) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceProperties2KHR");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->getPhysicalDeviceProperties2(true /* is KHR */, vkEnc, physicalDevice, pProperties);
 }
 static void entry_vkGetPhysicalDeviceFormatProperties2KHR(VkPhysicalDevice physicalDevice,
                                                           VkFormat format,
@@ -2966,8 +3011,9 @@ static void entry_vkGetPhysicalDeviceMemoryProperties2KHR(
     VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties) {
     AEMU_SCOPED_TRACE("vkGetPhysicalDeviceMemoryProperties2KHR");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties,
-                                                   true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkGetPhysicalDeviceMemoryProperties2KHR(vkEnc, physicalDevice,
+                                                          pMemoryProperties);
 }
 static void entry_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
     VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo,
@@ -4055,8 +4101,9 @@ static VkResult entry_vkGetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore
     AEMU_SCOPED_TRACE("vkGetSemaphoreCounterValueKHR");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkGetSemaphoreCounterValueKHR_VkResult_return = (VkResult)0;
+    auto resources = ResourceTracker::get();
     vkGetSemaphoreCounterValueKHR_VkResult_return =
-        vkEnc->vkGetSemaphoreCounterValueKHR(device, semaphore, pValue, true /* do lock */);
+        resources->on_vkGetSemaphoreCounterValueKHR(vkEnc, VK_SUCCESS, device, semaphore, pValue);
     return vkGetSemaphoreCounterValueKHR_VkResult_return;
 }
 static VkResult dynCheck_entry_vkGetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore,
@@ -4070,7 +4117,7 @@ static VkResult dynCheck_entry_vkGetSemaphoreCounterValueKHR(VkDevice device, Vk
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkGetSemaphoreCounterValueKHR_VkResult_return = (VkResult)0;
     vkGetSemaphoreCounterValueKHR_VkResult_return =
-        vkEnc->vkGetSemaphoreCounterValueKHR(device, semaphore, pValue, true /* do lock */);
+        resources->on_vkGetSemaphoreCounterValueKHR(vkEnc, VK_SUCCESS, device, semaphore, pValue);
     return vkGetSemaphoreCounterValueKHR_VkResult_return;
 }
 static VkResult entry_vkWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo,
@@ -4078,8 +4125,9 @@ static VkResult entry_vkWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWait
     AEMU_SCOPED_TRACE("vkWaitSemaphoresKHR");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkWaitSemaphoresKHR_VkResult_return = (VkResult)0;
+    auto resources = ResourceTracker::get();
     vkWaitSemaphoresKHR_VkResult_return =
-        vkEnc->vkWaitSemaphoresKHR(device, pWaitInfo, timeout, true /* do lock */);
+        resources->on_vkWaitSemaphoresKHR(vkEnc, VK_SUCCESS, device, pWaitInfo, timeout);
     return vkWaitSemaphoresKHR_VkResult_return;
 }
 static VkResult dynCheck_entry_vkWaitSemaphoresKHR(VkDevice device,
@@ -4093,7 +4141,7 @@ static VkResult dynCheck_entry_vkWaitSemaphoresKHR(VkDevice device,
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkWaitSemaphoresKHR_VkResult_return = (VkResult)0;
     vkWaitSemaphoresKHR_VkResult_return =
-        vkEnc->vkWaitSemaphoresKHR(device, pWaitInfo, timeout, true /* do lock */);
+        resources->on_vkWaitSemaphoresKHR(vkEnc, VK_SUCCESS, device, pWaitInfo, timeout);
     return vkWaitSemaphoresKHR_VkResult_return;
 }
 static VkResult entry_vkSignalSemaphoreKHR(VkDevice device,
@@ -4101,8 +4149,9 @@ static VkResult entry_vkSignalSemaphoreKHR(VkDevice device,
     AEMU_SCOPED_TRACE("vkSignalSemaphoreKHR");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkSignalSemaphoreKHR_VkResult_return = (VkResult)0;
+    auto resources = ResourceTracker::get();
     vkSignalSemaphoreKHR_VkResult_return =
-        vkEnc->vkSignalSemaphoreKHR(device, pSignalInfo, true /* do lock */);
+        resources->on_vkSignalSemaphoreKHR(vkEnc, VK_SUCCESS, device, pSignalInfo);
     return vkSignalSemaphoreKHR_VkResult_return;
 }
 static VkResult dynCheck_entry_vkSignalSemaphoreKHR(VkDevice device,
@@ -4115,7 +4164,7 @@ static VkResult dynCheck_entry_vkSignalSemaphoreKHR(VkDevice device,
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
     VkResult vkSignalSemaphoreKHR_VkResult_return = (VkResult)0;
     vkSignalSemaphoreKHR_VkResult_return =
-        vkEnc->vkSignalSemaphoreKHR(device, pSignalInfo, true /* do lock */);
+        resources->on_vkSignalSemaphoreKHR(vkEnc, VK_SUCCESS, device, pSignalInfo);
     return vkSignalSemaphoreKHR_VkResult_return;
 }
 #endif
@@ -4639,6 +4688,8 @@ static VkResult entry_vkQueueSubmit2KHR(VkQueue queue, uint32_t submitCount,
                                         const VkSubmitInfo2* pSubmits, VkFence fence) {
     AEMU_SCOPED_TRACE("vkQueueSubmit2KHR");
     auto vkEnc = ResourceTracker::getQueueEncoder(queue);
+    ResourceTracker::get()->on_vkQueueSubmit2KHR_pre(vkEnc, queue, submitCount, pSubmits,
+                                                     fence);
     VkResult vkQueueSubmit2KHR_VkResult_return = (VkResult)0;
     vkQueueSubmit2KHR_VkResult_return =
         vkEnc->vkQueueSubmit2KHR(queue, submitCount, pSubmits, fence, true /* do lock */);
@@ -7485,7 +7536,8 @@ static void entry_vkResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, ui
                                       uint32_t queryCount) {
     AEMU_SCOPED_TRACE("vkResetQueryPoolEXT");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkResetQueryPoolEXT(device, queryPool, firstQuery, queryCount, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkResetQueryPoolEXT(vkEnc, device, queryPool, firstQuery, queryCount);
 }
 static void dynCheck_entry_vkResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool,
                                                uint32_t firstQuery, uint32_t queryCount) {
@@ -7495,7 +7547,7 @@ static void dynCheck_entry_vkResetQueryPoolEXT(VkDevice device, VkQueryPool quer
     }
     AEMU_SCOPED_TRACE("vkResetQueryPoolEXT");
     auto vkEnc = ResourceTracker::getThreadLocalEncoder();
-    vkEnc->vkResetQueryPoolEXT(device, queryPool, firstQuery, queryCount, true /* do lock */);
+    resources->on_vkResetQueryPoolEXT(vkEnc, device, queryPool, firstQuery, queryCount);
 }
 #endif
 #ifdef VK_EXT_index_type_uint8
@@ -7559,8 +7611,8 @@ static void entry_vkCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer,
                                                const VkViewport* pViewports) {
     AEMU_SCOPED_TRACE("vkCmdSetViewportWithCountEXT");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports,
-                                        true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetViewportWithCountEXT(vkEnc, commandBuffer, viewportCount, pViewports);
 }
 static void dynCheck_entry_vkCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer,
                                                         uint32_t viewportCount,
@@ -7574,14 +7626,14 @@ static void dynCheck_entry_vkCmdSetViewportWithCountEXT(VkCommandBuffer commandB
     }
     AEMU_SCOPED_TRACE("vkCmdSetViewportWithCountEXT");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports,
-                                        true /* do lock */);
+    resources->on_vkCmdSetViewportWithCountEXT(vkEnc, commandBuffer, viewportCount, pViewports);
 }
 static void entry_vkCmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount,
                                               const VkRect2D* pScissors) {
     AEMU_SCOPED_TRACE("vkCmdSetScissorWithCountEXT");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors, true /* do lock */);
+    auto resources = ResourceTracker::get();
+    resources->on_vkCmdSetScissorWithCountEXT(vkEnc, commandBuffer, scissorCount, pScissors);
 }
 static void dynCheck_entry_vkCmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer,
                                                        uint32_t scissorCount,
@@ -7595,7 +7647,7 @@ static void dynCheck_entry_vkCmdSetScissorWithCountEXT(VkCommandBuffer commandBu
     }
     AEMU_SCOPED_TRACE("vkCmdSetScissorWithCountEXT");
     auto vkEnc = ResourceTracker::getCommandBufferEncoder(commandBuffer);
-    vkEnc->vkCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors, true /* do lock */);
+    resources->on_vkCmdSetScissorWithCountEXT(vkEnc, commandBuffer, scissorCount, pScissors);
 }
 static void entry_vkCmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding,
                                              uint32_t bindingCount, const VkBuffer* pBuffers,
@@ -11567,7767 +11619,8039 @@ static void dynCheck_entry_vkCmdDrawMeshTasksIndirectCountEXT(
                                               true /* do lock */);
 }
 #endif
+// Entry point names, sorted for goldfish_vulkan_proc_index, and their
+// indices in the same order.
+enum ProcIndex {
+    PROC_vkAcquireDrmDisplayEXT,
+    PROC_vkAcquireFullScreenExclusiveModeEXT,
+    PROC_vkAcquireImageANDROID,
+    PROC_vkAcquireNextImage2KHR,
+    PROC_vkAcquireNextImageKHR,
+    PROC_vkAcquirePerformanceConfigurationINTEL,
+    PROC_vkAcquireProfilingLockKHR,
+    PROC_vkAcquireWinrtDisplayNV,
+    PROC_vkAcquireXlibDisplayEXT,
+    PROC_vkAllocateCommandBuffers,
+    PROC_vkAllocateDescriptorSets,
+    PROC_vkAllocateMemory,
+    PROC_vkBeginCommandBuffer,
+    PROC_vkBeginCommandBufferAsyncGOOGLE,
+    PROC_vkBindAccelerationStructureMemoryNV,
+    PROC_vkBindBufferMemory,
+    PROC_vkBindBufferMemory2,
+    PROC_vkBindBufferMemory2KHR,
+    PROC_vkBindImageMemory,
+    PROC_vkBindImageMemory2,
+    PROC_vkBindImageMemory2KHR,
+    PROC_vkBindOpticalFlowSessionImageNV,
+    PROC_vkBindVideoSessionMemoryKHR,
+    PROC_vkBuildAccelerationStructuresKHR,
+    PROC_vkBuildMicromapsEXT,
+    PROC_vkCmdBeginConditionalRenderingEXT,
+    PROC_vkCmdBeginDebugUtilsLabelEXT,
+    PROC_vkCmdBeginQuery,
+    PROC_vkCmdBeginQueryIndexedEXT,
+    PROC_vkCmdBeginRenderPass,
+    PROC_vkCmdBeginRenderPass2,
+    PROC_vkCmdBeginRenderPass2KHR,
+    PROC_vkCmdBeginRendering,
+    PROC_vkCmdBeginRenderingKHR,
+    PROC_vkCmdBeginTransformFeedbackEXT,
+    PROC_vkCmdBeginVideoCodingKHR,
+    PROC_vkCmdBindDescriptorBufferEmbeddedSamplersEXT,
+    PROC_vkCmdBindDescriptorBuffersEXT,
+    PROC_vkCmdBindDescriptorSets,
+    PROC_vkCmdBindIndexBuffer,
+    PROC_vkCmdBindInvocationMaskHUAWEI,
+    PROC_vkCmdBindPipeline,
+    PROC_vkCmdBindPipelineShaderGroupNV,
+    PROC_vkCmdBindShadersEXT,
+    PROC_vkCmdBindShadingRateImageNV,
+    PROC_vkCmdBindTransformFeedbackBuffersEXT,
+    PROC_vkCmdBindVertexBuffers,
+    PROC_vkCmdBindVertexBuffers2,
+    PROC_vkCmdBindVertexBuffers2EXT,
+    PROC_vkCmdBlitImage,
+    PROC_vkCmdBlitImage2,
+    PROC_vkCmdBlitImage2KHR,
+    PROC_vkCmdBuildAccelerationStructureNV,
+    PROC_vkCmdBuildAccelerationStructuresIndirectKHR,
+    PROC_vkCmdBuildAccelerationStructuresKHR,
+    PROC_vkCmdBuildMicromapsEXT,
+    PROC_vkCmdClearAttachments,
+    PROC_vkCmdClearColorImage,
+    PROC_vkCmdClearDepthStencilImage,
+    PROC_vkCmdControlVideoCodingKHR,
+    PROC_vkCmdCopyAccelerationStructureKHR,
+    PROC_vkCmdCopyAccelerationStructureNV,
+    PROC_vkCmdCopyAccelerationStructureToMemoryKHR,
+    PROC_vkCmdCopyBuffer,
+    PROC_vkCmdCopyBuffer2,
+    PROC_vkCmdCopyBuffer2KHR,
+    PROC_vkCmdCopyBufferToImage,
+    PROC_vkCmdCopyBufferToImage2,
+    PROC_vkCmdCopyBufferToImage2KHR,
+    PROC_vkCmdCopyImage,
+    PROC_vkCmdCopyImage2,
+    PROC_vkCmdCopyImage2KHR,
+    PROC_vkCmdCopyImageToBuffer,
+    PROC_vkCmdCopyImageToBuffer2,
+    PROC_vkCmdCopyImageToBuffer2KHR,
+    PROC_vkCmdCopyMemoryIndirectNV,
+    PROC_vkCmdCopyMemoryToAccelerationStructureKHR,
+    PROC_vkCmdCopyMemoryToImageIndirectNV,
+    PROC_vkCmdCopyMemoryToMicromapEXT,
+    PROC_vkCmdCopyMicromapEXT,
+    PROC_vkCmdCopyMicromapToMemoryEXT,
+    PROC_vkCmdCopyQueryPoolResults,
+    PROC_vkCmdCuLaunchKernelNVX,
+    PROC_vkCmdDebugMarkerBeginEXT,
+    PROC_vkCmdDebugMarkerEndEXT,
+    PROC_vkCmdDebugMarkerInsertEXT,
+    PROC_vkCmdDecodeVideoKHR,
+    PROC_vkCmdDecompressMemoryIndirectCountNV,
+    PROC_vkCmdDecompressMemoryNV,
+    PROC_vkCmdDispatch,
+    PROC_vkCmdDispatchBase,
+    PROC_vkCmdDispatchBaseKHR,
+    PROC_vkCmdDispatchIndirect,
+    PROC_vkCmdDraw,
+    PROC_vkCmdDrawClusterHUAWEI,
+    PROC_vkCmdDrawClusterIndirectHUAWEI,
+    PROC_vkCmdDrawIndexed,
+    PROC_vkCmdDrawIndexedIndirect,
+    PROC_vkCmdDrawIndexedIndirectCount,
+    PROC_vkCmdDrawIndexedIndirectCountAMD,
+    PROC_vkCmdDrawIndexedIndirectCountKHR,
+    PROC_vkCmdDrawIndirect,
+    PROC_vkCmdDrawIndirectByteCountEXT,
+    PROC_vkCmdDrawIndirectCount,
+    PROC_vkCmdDrawIndirectCountAMD,
+    PROC_vkCmdDrawIndirectCountKHR,
+    PROC_vkCmdDrawMeshTasksEXT,
+    PROC_vkCmdDrawMeshTasksIndirectCountEXT,
+    PROC_vkCmdDrawMeshTasksIndirectCountNV,
+    PROC_vkCmdDrawMeshTasksIndirectEXT,
+    PROC_vkCmdDrawMeshTasksIndirectNV,
+    PROC_vkCmdDrawMeshTasksNV,
+    PROC_vkCmdDrawMultiEXT,
+    PROC_vkCmdDrawMultiIndexedEXT,
+    PROC_vkCmdEncodeVideoKHR,
+    PROC_vkCmdEndConditionalRenderingEXT,
+    PROC_vkCmdEndDebugUtilsLabelEXT,
+    PROC_vkCmdEndQuery,
+    PROC_vkCmdEndQueryIndexedEXT,
+    PROC_vkCmdEndRenderPass,
+    PROC_vkCmdEndRenderPass2,
+    PROC_vkCmdEndRenderPass2KHR,
+    PROC_vkCmdEndRendering,
+    PROC_vkCmdEndRenderingKHR,
+    PROC_vkCmdEndTransformFeedbackEXT,
+    PROC_vkCmdEndVideoCodingKHR,
+    PROC_vkCmdExecuteCommands,
+    PROC_vkCmdExecuteGeneratedCommandsNV,
+    PROC_vkCmdFillBuffer,
+    PROC_vkCmdInsertDebugUtilsLabelEXT,
+    PROC_vkCmdNextSubpass,
+    PROC_vkCmdNextSubpass2,
+    PROC_vkCmdNextSubpass2KHR,
+    PROC_vkCmdOpticalFlowExecuteNV,
+    PROC_vkCmdPipelineBarrier,
+    PROC_vkCmdPipelineBarrier2,
+    PROC_vkCmdPipelineBarrier2KHR,
+    PROC_vkCmdPreprocessGeneratedCommandsNV,
+    PROC_vkCmdPushConstants,
+    PROC_vkCmdPushDescriptorSetKHR,
+    PROC_vkCmdPushDescriptorSetWithTemplateKHR,
+    PROC_vkCmdResetEvent,
+    PROC_vkCmdResetEvent2,
+    PROC_vkCmdResetEvent2KHR,
+    PROC_vkCmdResetQueryPool,
+    PROC_vkCmdResolveImage,
+    PROC_vkCmdResolveImage2,
+    PROC_vkCmdResolveImage2KHR,
+    PROC_vkCmdSetAlphaToCoverageEnableEXT,
+    PROC_vkCmdSetAlphaToOneEnableEXT,
+    PROC_vkCmdSetAttachmentFeedbackLoopEnableEXT,
+    PROC_vkCmdSetBlendConstants,
+    PROC_vkCmdSetCheckpointNV,
+    PROC_vkCmdSetCoarseSampleOrderNV,
+    PROC_vkCmdSetColorBlendAdvancedEXT,
+    PROC_vkCmdSetColorBlendEnableEXT,
+    PROC_vkCmdSetColorBlendEquationEXT,
+    PROC_vkCmdSetColorWriteEnableEXT,
+    PROC_vkCmdSetColorWriteMaskEXT,
+    PROC_vkCmdSetConservativeRasterizationModeEXT,
+    PROC_vkCmdSetCoverageModulationModeNV,
+    PROC_vkCmdSetCoverageModulationTableEnableNV,
+    PROC_vkCmdSetCoverageModulationTableNV,
+    PROC_vkCmdSetCoverageReductionModeNV,
+    PROC_vkCmdSetCoverageToColorEnableNV,
+    PROC_vkCmdSetCoverageToColorLocationNV,
+    PROC_vkCmdSetCullMode,
+    PROC_vkCmdSetCullModeEXT,
+    PROC_vkCmdSetDepthBias,
+    PROC_vkCmdSetDepthBiasEnable,
+    PROC_vkCmdSetDepthBiasEnableEXT,
+    PROC_vkCmdSetDepthBounds,
+    PROC_vkCmdSetDepthBoundsTestEnable,
+    PROC_vkCmdSetDepthBoundsTestEnableEXT,
+    PROC_vkCmdSetDepthClampEnableEXT,
+    PROC_vkCmdSetDepthClipEnableEXT,
+    PROC_vkCmdSetDepthClipNegativeOneToOneEXT,
+    PROC_vkCmdSetDepthCompareOp,
+    PROC_vkCmdSetDepthCompareOpEXT,
+    PROC_vkCmdSetDepthTestEnable,
+    PROC_vkCmdSetDepthTestEnableEXT,
+    PROC_vkCmdSetDepthWriteEnable,
+    PROC_vkCmdSetDepthWriteEnableEXT,
+    PROC_vkCmdSetDescriptorBufferOffsetsEXT,
+    PROC_vkCmdSetDeviceMask,
+    PROC_vkCmdSetDeviceMaskKHR,
+    PROC_vkCmdSetDiscardRectangleEXT,
+    PROC_vkCmdSetDiscardRectangleEnableEXT,
+    PROC_vkCmdSetDiscardRectangleModeEXT,
+    PROC_vkCmdSetEvent,
+    PROC_vkCmdSetEvent2,
+    PROC_vkCmdSetEvent2KHR,
+    PROC_vkCmdSetExclusiveScissorEnableNV,
+    PROC_vkCmdSetExclusiveScissorNV,
+    PROC_vkCmdSetExtraPrimitiveOverestimationSizeEXT,
+    PROC_vkCmdSetFragmentShadingRateEnumNV,
+    PROC_vkCmdSetFragmentShadingRateKHR,
+    PROC_vkCmdSetFrontFace,
+    PROC_vkCmdSetFrontFaceEXT,
+    PROC_vkCmdSetLineRasterizationModeEXT,
+    PROC_vkCmdSetLineStippleEXT,
+    PROC_vkCmdSetLineStippleEnableEXT,
+    PROC_vkCmdSetLineWidth,
+    PROC_vkCmdSetLogicOpEXT,
+    PROC_vkCmdSetLogicOpEnableEXT,
+    PROC_vkCmdSetPatchControlPointsEXT,
+    PROC_vkCmdSetPerformanceMarkerINTEL,
+    PROC_vkCmdSetPerformanceOverrideINTEL,
+    PROC_vkCmdSetPerformanceStreamMarkerINTEL,
+    PROC_vkCmdSetPolygonModeEXT,
+    PROC_vkCmdSetPrimitiveRestartEnable,
+    PROC_vkCmdSetPrimitiveRestartEnableEXT,
+    PROC_vkCmdSetPrimitiveTopology,
+    PROC_vkCmdSetPrimitiveTopologyEXT,
+    PROC_vkCmdSetProvokingVertexModeEXT,
+    PROC_vkCmdSetRasterizationSamplesEXT,
+    PROC_vkCmdSetRasterizationStreamEXT,
+    PROC_vkCmdSetRasterizerDiscardEnable,
+    PROC_vkCmdSetRasterizerDiscardEnableEXT,
+    PROC_vkCmdSetRayTracingPipelineStackSizeKHR,
+    PROC_vkCmdSetRepresentativeFragmentTestEnableNV,
+    PROC_vkCmdSetSampleLocationsEXT,
+    PROC_vkCmdSetSampleLocationsEnableEXT,
+    PROC_vkCmdSetSampleMaskEXT,
+    PROC_vkCmdSetScissor,
+    PROC_vkCmdSetScissorWithCount,
+    PROC_vkCmdSetScissorWithCountEXT,
+    PROC_vkCmdSetShadingRateImageEnableNV,
+    PROC_vkCmdSetStencilCompareMask,
+    PROC_vkCmdSetStencilOp,
+    PROC_vkCmdSetStencilOpEXT,
+    PROC_vkCmdSetStencilReference,
+    PROC_vkCmdSetStencilTestEnable,
+    PROC_vkCmdSetStencilTestEnableEXT,
+    PROC_vkCmdSetStencilWriteMask,
+    PROC_vkCmdSetTessellationDomainOriginEXT,
+    PROC_vkCmdSetVertexInputEXT,
+    PROC_vkCmdSetViewport,
+    PROC_vkCmdSetViewportShadingRatePaletteNV,
+    PROC_vkCmdSetViewportSwizzleNV,
+    PROC_vkCmdSetViewportWScalingEnableNV,
+    PROC_vkCmdSetViewportWScalingNV,
+    PROC_vkCmdSetViewportWithCount,
+    PROC_vkCmdSetViewportWithCountEXT,
+    PROC_vkCmdSubpassShadingHUAWEI,
+    PROC_vkCmdTraceRaysIndirect2KHR,
+    PROC_vkCmdTraceRaysIndirectKHR,
+    PROC_vkCmdTraceRaysKHR,
+    PROC_vkCmdTraceRaysNV,
+    PROC_vkCmdUpdateBuffer,
+    PROC_vkCmdWaitEvents,
+    PROC_vkCmdWaitEvents2,
+    PROC_vkCmdWaitEvents2KHR,
+    PROC_vkCmdWriteAccelerationStructuresPropertiesKHR,
+    PROC_vkCmdWriteAccelerationStructuresPropertiesNV,
+    PROC_vkCmdWriteBufferMarker2AMD,
+    PROC_vkCmdWriteBufferMarkerAMD,
+    PROC_vkCmdWriteMicromapsPropertiesEXT,
+    PROC_vkCmdWriteTimestamp,
+    PROC_vkCmdWriteTimestamp2,
+    PROC_vkCmdWriteTimestamp2KHR,
+    PROC_vkCollectDescriptorPoolIdsGOOGLE,
+    PROC_vkCommandBufferHostSyncGOOGLE,
+    PROC_vkCompileDeferredNV,
+    PROC_vkCopyAccelerationStructureKHR,
+    PROC_vkCopyAccelerationStructureToMemoryKHR,
+    PROC_vkCopyMemoryToAccelerationStructureKHR,
+    PROC_vkCopyMemoryToMicromapEXT,
+    PROC_vkCopyMicromapEXT,
+    PROC_vkCopyMicromapToMemoryEXT,
+    PROC_vkCreateAccelerationStructureKHR,
+    PROC_vkCreateAccelerationStructureNV,
+    PROC_vkCreateAndroidSurfaceKHR,
+    PROC_vkCreateBuffer,
+    PROC_vkCreateBufferCollectionFUCHSIA,
+    PROC_vkCreateBufferView,
+    PROC_vkCreateBufferWithRequirementsGOOGLE,
+    PROC_vkCreateCommandPool,
+    PROC_vkCreateComputePipelines,
+    PROC_vkCreateCuFunctionNVX,
+    PROC_vkCreateCuModuleNVX,
+    PROC_vkCreateDebugReportCallbackEXT,
+    PROC_vkCreateDebugUtilsMessengerEXT,
+    PROC_vkCreateDeferredOperationKHR,
+    PROC_vkCreateDescriptorPool,
+    PROC_vkCreateDescriptorSetLayout,
+    PROC_vkCreateDescriptorUpdateTemplate,
+    PROC_vkCreateDescriptorUpdateTemplateKHR,
+    PROC_vkCreateDevice,
+    PROC_vkCreateDirectFBSurfaceEXT,
+    PROC_vkCreateDisplayModeKHR,
+    PROC_vkCreateDisplayPlaneSurfaceKHR,
+    PROC_vkCreateEvent,
+    PROC_vkCreateFence,
+    PROC_vkCreateFramebuffer,
+    PROC_vkCreateGraphicsPipelines,
+    PROC_vkCreateHeadlessSurfaceEXT,
+    PROC_vkCreateIOSSurfaceMVK,
+    PROC_vkCreateImage,
+    PROC_vkCreateImagePipeSurfaceFUCHSIA,
+    PROC_vkCreateImageView,
+    PROC_vkCreateImageWithRequirementsGOOGLE,
+    PROC_vkCreateIndirectCommandsLayoutNV,
+    PROC_vkCreateInstance,
+    PROC_vkCreateMacOSSurfaceMVK,
+    PROC_vkCreateMetalSurfaceEXT,
+    PROC_vkCreateMicromapEXT,
+    PROC_vkCreateOpticalFlowSessionNV,
+    PROC_vkCreatePipelineCache,
+    PROC_vkCreatePipelineLayout,
+    PROC_vkCreatePrivateDataSlot,
+    PROC_vkCreatePrivateDataSlotEXT,
+    PROC_vkCreateQueryPool,
+    PROC_vkCreateRayTracingPipelinesKHR,
+    PROC_vkCreateRayTracingPipelinesNV,
+    PROC_vkCreateRenderPass,
+    PROC_vkCreateRenderPass2,
+    PROC_vkCreateRenderPass2KHR,
+    PROC_vkCreateSampler,
+    PROC_vkCreateSamplerYcbcrConversion,
+    PROC_vkCreateSamplerYcbcrConversionKHR,
+    PROC_vkCreateScreenSurfaceQNX,
+    PROC_vkCreateSemaphore,
+    PROC_vkCreateShaderModule,
+    PROC_vkCreateShadersEXT,
+    PROC_vkCreateSharedSwapchainsKHR,
+    PROC_vkCreateStreamDescriptorSurfaceGGP,
+    PROC_vkCreateSwapchainKHR,
+    PROC_vkCreateValidationCacheEXT,
+    PROC_vkCreateViSurfaceNN,
+    PROC_vkCreateVideoSessionKHR,
+    PROC_vkCreateVideoSessionParametersKHR,
+    PROC_vkCreateWaylandSurfaceKHR,
+    PROC_vkCreateWin32SurfaceKHR,
+    PROC_vkCreateXcbSurfaceKHR,
+    PROC_vkCreateXlibSurfaceKHR,
+    PROC_vkDebugMarkerSetObjectNameEXT,
+    PROC_vkDebugMarkerSetObjectTagEXT,
+    PROC_vkDebugReportMessageEXT,
+    PROC_vkDeferredOperationJoinKHR,
+    PROC_vkDestroyAccelerationStructureKHR,
+    PROC_vkDestroyAccelerationStructureNV,
+    PROC_vkDestroyBuffer,
+    PROC_vkDestroyBufferCollectionFUCHSIA,
+    PROC_vkDestroyBufferView,
+    PROC_vkDestroyCommandPool,
+    PROC_vkDestroyCuFunctionNVX,
+    PROC_vkDestroyCuModuleNVX,
+    PROC_vkDestroyDebugReportCallbackEXT,
+    PROC_vkDestroyDebugUtilsMessengerEXT,
+    PROC_vkDestroyDeferredOperationKHR,
+    PROC_vkDestroyDescriptorPool,
+    PROC_vkDestroyDescriptorSetLayout,
+    PROC_vkDestroyDescriptorUpdateTemplate,
+    PROC_vkDestroyDescriptorUpdateTemplateKHR,
+    PROC_vkDestroyDevice,
+    PROC_vkDestroyEvent,
+    PROC_vkDestroyFence,
+    PROC_vkDestroyFramebuffer,
+    PROC_vkDestroyImage,
+    PROC_vkDestroyImageView,
+    PROC_vkDestroyIndirectCommandsLayoutNV,
+    PROC_vkDestroyInstance,
+    PROC_vkDestroyMicromapEXT,
+    PROC_vkDestroyOpticalFlowSessionNV,
+    PROC_vkDestroyPipeline,
+    PROC_vkDestroyPipelineCache,
+    PROC_vkDestroyPipelineLayout,
+    PROC_vkDestroyPrivateDataSlot,
+    PROC_vkDestroyPrivateDataSlotEXT,
+    PROC_vkDestroyQueryPool,
+    PROC_vkDestroyRenderPass,
+    PROC_vkDestroySampler,
+    PROC_vkDestroySamplerYcbcrConversion,
+    PROC_vkDestroySamplerYcbcrConversionKHR,
+    PROC_vkDestroySemaphore,
+    PROC_vkDestroyShaderEXT,
+    PROC_vkDestroyShaderModule,
+    PROC_vkDestroySurfaceKHR,
+    PROC_vkDestroySwapchainKHR,
+    PROC_vkDestroyValidationCacheEXT,
+    PROC_vkDestroyVideoSessionKHR,
+    PROC_vkDestroyVideoSessionParametersKHR,
+    PROC_vkDeviceWaitIdle,
+    PROC_vkDisplayPowerControlEXT,
+    PROC_vkEndCommandBuffer,
+    PROC_vkEndCommandBufferAsyncGOOGLE,
+    PROC_vkEnumerateDeviceExtensionProperties,
+    PROC_vkEnumerateDeviceLayerProperties,
+    PROC_vkEnumerateInstanceExtensionProperties,
+    PROC_vkEnumerateInstanceLayerProperties,
+    PROC_vkEnumerateInstanceVersion,
+    PROC_vkEnumeratePhysicalDeviceGroups,
+    PROC_vkEnumeratePhysicalDeviceGroupsKHR,
+    PROC_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR,
+    PROC_vkEnumeratePhysicalDevices,
+    PROC_vkExportMetalObjectsEXT,
+    PROC_vkFlushMappedMemoryRanges,
+    PROC_vkFreeCommandBuffers,
+    PROC_vkFreeDescriptorSets,
+    PROC_vkFreeMemory,
+    PROC_vkFreeMemorySyncGOOGLE,
+    PROC_vkGetAccelerationStructureBuildSizesKHR,
+    PROC_vkGetAccelerationStructureDeviceAddressKHR,
+    PROC_vkGetAccelerationStructureHandleNV,
+    PROC_vkGetAccelerationStructureMemoryRequirementsNV,
+    PROC_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT,
+    PROC_vkGetAndroidHardwareBufferPropertiesANDROID,
+    PROC_vkGetBlobGOOGLE,
+    PROC_vkGetBufferCollectionPropertiesFUCHSIA,
+    PROC_vkGetBufferDeviceAddress,
+    PROC_vkGetBufferDeviceAddressEXT,
+    PROC_vkGetBufferDeviceAddressKHR,
+    PROC_vkGetBufferMemoryRequirements,
+    PROC_vkGetBufferMemoryRequirements2,
+    PROC_vkGetBufferMemoryRequirements2KHR,
+    PROC_vkGetBufferOpaqueCaptureAddress,
+    PROC_vkGetBufferOpaqueCaptureAddressKHR,
+    PROC_vkGetBufferOpaqueCaptureDescriptorDataEXT,
+    PROC_vkGetCalibratedTimestampsEXT,
+    PROC_vkGetDeferredOperationMaxConcurrencyKHR,
+    PROC_vkGetDeferredOperationResultKHR,
+    PROC_vkGetDescriptorEXT,
+    PROC_vkGetDescriptorSetHostMappingVALVE,
+    PROC_vkGetDescriptorSetLayoutBindingOffsetEXT,
+    PROC_vkGetDescriptorSetLayoutHostMappingInfoVALVE,
+    PROC_vkGetDescriptorSetLayoutSizeEXT,
+    PROC_vkGetDescriptorSetLayoutSupport,
+    PROC_vkGetDescriptorSetLayoutSupportKHR,
+    PROC_vkGetDeviceAccelerationStructureCompatibilityKHR,
+    PROC_vkGetDeviceBufferMemoryRequirements,
+    PROC_vkGetDeviceBufferMemoryRequirementsKHR,
+    PROC_vkGetDeviceFaultInfoEXT,
+    PROC_vkGetDeviceGroupPeerMemoryFeatures,
+    PROC_vkGetDeviceGroupPeerMemoryFeaturesKHR,
+    PROC_vkGetDeviceGroupPresentCapabilitiesKHR,
+    PROC_vkGetDeviceGroupSurfacePresentModes2EXT,
+    PROC_vkGetDeviceGroupSurfacePresentModesKHR,
+    PROC_vkGetDeviceImageMemoryRequirements,
+    PROC_vkGetDeviceImageMemoryRequirementsKHR,
+    PROC_vkGetDeviceImageSparseMemoryRequirements,
+    PROC_vkGetDeviceImageSparseMemoryRequirementsKHR,
+    PROC_vkGetDeviceMemoryCommitment,
+    PROC_vkGetDeviceMemoryOpaqueCaptureAddress,
+    PROC_vkGetDeviceMemoryOpaqueCaptureAddressKHR,
+    PROC_vkGetDeviceMicromapCompatibilityEXT,
+    PROC_vkGetDeviceProcAddr,
+    PROC_vkGetDeviceQueue,
+    PROC_vkGetDeviceQueue2,
+    PROC_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI,
+    PROC_vkGetDisplayModeProperties2KHR,
+    PROC_vkGetDisplayModePropertiesKHR,
+    PROC_vkGetDisplayPlaneCapabilities2KHR,
+    PROC_vkGetDisplayPlaneCapabilitiesKHR,
+    PROC_vkGetDisplayPlaneSupportedDisplaysKHR,
+    PROC_vkGetDrmDisplayEXT,
+    PROC_vkGetDynamicRenderingTilePropertiesQCOM,
+    PROC_vkGetEventStatus,
+    PROC_vkGetFenceFdKHR,
+    PROC_vkGetFenceStatus,
+    PROC_vkGetFenceWin32HandleKHR,
+    PROC_vkGetFramebufferTilePropertiesQCOM,
+    PROC_vkGetGeneratedCommandsMemoryRequirementsNV,
+    PROC_vkGetImageDrmFormatModifierPropertiesEXT,
+    PROC_vkGetImageMemoryRequirements,
+    PROC_vkGetImageMemoryRequirements2,
+    PROC_vkGetImageMemoryRequirements2KHR,
+    PROC_vkGetImageOpaqueCaptureDescriptorDataEXT,
+    PROC_vkGetImageSparseMemoryRequirements,
+    PROC_vkGetImageSparseMemoryRequirements2,
+    PROC_vkGetImageSparseMemoryRequirements2KHR,
+    PROC_vkGetImageSubresourceLayout,
+    PROC_vkGetImageSubresourceLayout2EXT,
+    PROC_vkGetImageViewAddressNVX,
+    PROC_vkGetImageViewHandleNVX,
+    PROC_vkGetImageViewOpaqueCaptureDescriptorDataEXT,
+    PROC_vkGetInstanceProcAddr,
+    PROC_vkGetLinearImageLayout2GOOGLE,
+    PROC_vkGetLinearImageLayoutGOOGLE,
+    PROC_vkGetMemoryAndroidHardwareBufferANDROID,
+    PROC_vkGetMemoryFdKHR,
+    PROC_vkGetMemoryFdPropertiesKHR,
+    PROC_vkGetMemoryHostAddressInfoGOOGLE,
+    PROC_vkGetMemoryHostPointerPropertiesEXT,
+    PROC_vkGetMemoryRemoteAddressNV,
+    PROC_vkGetMemoryWin32HandleKHR,
+    PROC_vkGetMemoryWin32HandleNV,
+    PROC_vkGetMemoryWin32HandlePropertiesKHR,
+    PROC_vkGetMemoryZirconHandleFUCHSIA,
+    PROC_vkGetMemoryZirconHandlePropertiesFUCHSIA,
+    PROC_vkGetMicromapBuildSizesEXT,
+    PROC_vkGetPastPresentationTimingGOOGLE,
+    PROC_vkGetPerformanceParameterINTEL,
+    PROC_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    PROC_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    PROC_vkGetPhysicalDeviceDirectFBPresentationSupportEXT,
+    PROC_vkGetPhysicalDeviceDisplayPlaneProperties2KHR,
+    PROC_vkGetPhysicalDeviceDisplayPlanePropertiesKHR,
+    PROC_vkGetPhysicalDeviceDisplayProperties2KHR,
+    PROC_vkGetPhysicalDeviceDisplayPropertiesKHR,
+    PROC_vkGetPhysicalDeviceExternalBufferProperties,
+    PROC_vkGetPhysicalDeviceExternalBufferPropertiesKHR,
+    PROC_vkGetPhysicalDeviceExternalFenceProperties,
+    PROC_vkGetPhysicalDeviceExternalFencePropertiesKHR,
+    PROC_vkGetPhysicalDeviceExternalImageFormatPropertiesNV,
+    PROC_vkGetPhysicalDeviceExternalSemaphoreProperties,
+    PROC_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR,
+    PROC_vkGetPhysicalDeviceFeatures,
+    PROC_vkGetPhysicalDeviceFeatures2,
+    PROC_vkGetPhysicalDeviceFeatures2KHR,
+    PROC_vkGetPhysicalDeviceFormatProperties,
+    PROC_vkGetPhysicalDeviceFormatProperties2,
+    PROC_vkGetPhysicalDeviceFormatProperties2KHR,
+    PROC_vkGetPhysicalDeviceFragmentShadingRatesKHR,
+    PROC_vkGetPhysicalDeviceImageFormatProperties,
+    PROC_vkGetPhysicalDeviceImageFormatProperties2,
+    PROC_vkGetPhysicalDeviceImageFormatProperties2KHR,
+    PROC_vkGetPhysicalDeviceMemoryProperties,
+    PROC_vkGetPhysicalDeviceMemoryProperties2,
+    PROC_vkGetPhysicalDeviceMemoryProperties2KHR,
+    PROC_vkGetPhysicalDeviceMultisamplePropertiesEXT,
+    PROC_vkGetPhysicalDeviceOpticalFlowImageFormatsNV,
+    PROC_vkGetPhysicalDevicePresentRectanglesKHR,
+    PROC_vkGetPhysicalDeviceProperties,
+    PROC_vkGetPhysicalDeviceProperties2,
+    PROC_vkGetPhysicalDeviceProperties2KHR,
+    PROC_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR,
+    PROC_vkGetPhysicalDeviceQueueFamilyProperties,
+    PROC_vkGetPhysicalDeviceQueueFamilyProperties2,
+    PROC_vkGetPhysicalDeviceQueueFamilyProperties2KHR,
+    PROC_vkGetPhysicalDeviceScreenPresentationSupportQNX,
+    PROC_vkGetPhysicalDeviceSparseImageFormatProperties,
+    PROC_vkGetPhysicalDeviceSparseImageFormatProperties2,
+    PROC_vkGetPhysicalDeviceSparseImageFormatProperties2KHR,
+    PROC_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+    PROC_vkGetPhysicalDeviceSurfaceCapabilities2EXT,
+    PROC_vkGetPhysicalDeviceSurfaceCapabilities2KHR,
+    PROC_vkGetPhysicalDeviceSurfaceCapabilitiesKHR,
+    PROC_vkGetPhysicalDeviceSurfaceFormats2KHR,
+    PROC_vkGetPhysicalDeviceSurfaceFormatsKHR,
+    PROC_vkGetPhysicalDeviceSurfacePresentModes2EXT,
+    PROC_vkGetPhysicalDeviceSurfacePresentModesKHR,
+    PROC_vkGetPhysicalDeviceSurfaceSupportKHR,
+    PROC_vkGetPhysicalDeviceToolProperties,
+    PROC_vkGetPhysicalDeviceToolPropertiesEXT,
+    PROC_vkGetPhysicalDeviceVideoCapabilitiesKHR,
+    PROC_vkGetPhysicalDeviceVideoFormatPropertiesKHR,
+    PROC_vkGetPhysicalDeviceWaylandPresentationSupportKHR,
+    PROC_vkGetPhysicalDeviceWin32PresentationSupportKHR,
+    PROC_vkGetPhysicalDeviceXcbPresentationSupportKHR,
+    PROC_vkGetPhysicalDeviceXlibPresentationSupportKHR,
+    PROC_vkGetPipelineCacheData,
+    PROC_vkGetPipelineExecutableInternalRepresentationsKHR,
+    PROC_vkGetPipelineExecutablePropertiesKHR,
+    PROC_vkGetPipelineExecutableStatisticsKHR,
+    PROC_vkGetPipelinePropertiesEXT,
+    PROC_vkGetPrivateData,
+    PROC_vkGetPrivateDataEXT,
+    PROC_vkGetQueryPoolResults,
+    PROC_vkGetQueueCheckpointData2NV,
+    PROC_vkGetQueueCheckpointDataNV,
+    PROC_vkGetRandROutputDisplayEXT,
+    PROC_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+    PROC_vkGetRayTracingShaderGroupHandlesKHR,
+    PROC_vkGetRayTracingShaderGroupHandlesNV,
+    PROC_vkGetRayTracingShaderGroupStackSizeKHR,
+    PROC_vkGetRefreshCycleDurationGOOGLE,
+    PROC_vkGetRenderAreaGranularity,
+    PROC_vkGetSamplerOpaqueCaptureDescriptorDataEXT,
+    PROC_vkGetSemaphoreCounterValue,
+    PROC_vkGetSemaphoreCounterValueKHR,
+    PROC_vkGetSemaphoreFdKHR,
+    PROC_vkGetSemaphoreWin32HandleKHR,
+    PROC_vkGetSemaphoreZirconHandleFUCHSIA,
+    PROC_vkGetShaderBinaryDataEXT,
+    PROC_vkGetShaderInfoAMD,
+    PROC_vkGetShaderModuleCreateInfoIdentifierEXT,
+    PROC_vkGetShaderModuleIdentifierEXT,
+    PROC_vkGetSwapchainCounterEXT,
+    PROC_vkGetSwapchainGrallocUsage2ANDROID,
+    PROC_vkGetSwapchainGrallocUsageANDROID,
+    PROC_vkGetSwapchainImagesKHR,
+    PROC_vkGetSwapchainStatusKHR,
+    PROC_vkGetValidationCacheDataEXT,
+    PROC_vkGetVideoSessionMemoryRequirementsKHR,
+    PROC_vkGetWinrtDisplayNV,
+    PROC_vkImportFenceFdKHR,
+    PROC_vkImportFenceWin32HandleKHR,
+    PROC_vkImportSemaphoreFdKHR,
+    PROC_vkImportSemaphoreWin32HandleKHR,
+    PROC_vkImportSemaphoreZirconHandleFUCHSIA,
+    PROC_vkInitializePerformanceApiINTEL,
+    PROC_vkInvalidateMappedMemoryRanges,
+    PROC_vkMapMemory,
+    PROC_vkMapMemory2KHR,
+    PROC_vkMapMemoryIntoAddressSpaceGOOGLE,
+    PROC_vkMergePipelineCaches,
+    PROC_vkMergeValidationCachesEXT,
+    PROC_vkQueueBeginDebugUtilsLabelEXT,
+    PROC_vkQueueBindSparse,
+    PROC_vkQueueBindSparseAsyncGOOGLE,
+    PROC_vkQueueCommitDescriptorSetUpdatesGOOGLE,
+    PROC_vkQueueEndDebugUtilsLabelEXT,
+    PROC_vkQueueFlushCommandsFromAuxMemoryGOOGLE,
+    PROC_vkQueueFlushCommandsGOOGLE,
+    PROC_vkQueueHostSyncGOOGLE,
+    PROC_vkQueueInsertDebugUtilsLabelEXT,
+    PROC_vkQueuePresentKHR,
+    PROC_vkQueueSetPerformanceConfigurationINTEL,
+    PROC_vkQueueSignalReleaseImageANDROID,
+    PROC_vkQueueSignalReleaseImageANDROIDAsyncGOOGLE,
+    PROC_vkQueueSubmit,
+    PROC_vkQueueSubmit2,
+    PROC_vkQueueSubmit2KHR,
+    PROC_vkQueueSubmitAsync2GOOGLE,
+    PROC_vkQueueSubmitAsyncGOOGLE,
+    PROC_vkQueueWaitIdle,
+    PROC_vkQueueWaitIdleAsyncGOOGLE,
+    PROC_vkRegisterDeviceEventEXT,
+    PROC_vkRegisterDisplayEventEXT,
+    PROC_vkReleaseDisplayEXT,
+    PROC_vkReleaseFullScreenExclusiveModeEXT,
+    PROC_vkReleasePerformanceConfigurationINTEL,
+    PROC_vkReleaseProfilingLockKHR,
+    PROC_vkReleaseSwapchainImagesEXT,
+    PROC_vkResetCommandBuffer,
+    PROC_vkResetCommandBufferAsyncGOOGLE,
+    PROC_vkResetCommandPool,
+    PROC_vkResetDescriptorPool,
+    PROC_vkResetEvent,
+    PROC_vkResetFences,
+    PROC_vkResetQueryPool,
+    PROC_vkResetQueryPoolEXT,
+    PROC_vkSetBufferCollectionBufferConstraintsFUCHSIA,
+    PROC_vkSetBufferCollectionImageConstraintsFUCHSIA,
+    PROC_vkSetDebugUtilsObjectNameEXT,
+    PROC_vkSetDebugUtilsObjectTagEXT,
+    PROC_vkSetDeviceMemoryPriorityEXT,
+    PROC_vkSetEvent,
+    PROC_vkSetHdrMetadataEXT,
+    PROC_vkSetLocalDimmingAMD,
+    PROC_vkSetPrivateData,
+    PROC_vkSetPrivateDataEXT,
+    PROC_vkSignalSemaphore,
+    PROC_vkSignalSemaphoreKHR,
+    PROC_vkSubmitDebugUtilsMessageEXT,
+    PROC_vkTrimCommandPool,
+    PROC_vkTrimCommandPoolKHR,
+    PROC_vkUninitializePerformanceApiINTEL,
+    PROC_vkUnmapMemory,
+    PROC_vkUnmapMemory2KHR,
+    PROC_vkUpdateDescriptorSetWithTemplate,
+    PROC_vkUpdateDescriptorSetWithTemplateKHR,
+    PROC_vkUpdateDescriptorSetWithTemplateSized2GOOGLE,
+    PROC_vkUpdateDescriptorSetWithTemplateSizedGOOGLE,
+    PROC_vkUpdateDescriptorSets,
+    PROC_vkUpdateVideoSessionParametersKHR,
+    PROC_vkWaitForFences,
+    PROC_vkWaitForPresentKHR,
+    PROC_vkWaitSemaphores,
+    PROC_vkWaitSemaphoresKHR,
+    PROC_vkWriteAccelerationStructuresPropertiesKHR,
+    PROC_vkWriteMicromapsPropertiesEXT,
+};
+
+static const char* const kProcNames[] = {
+    "vkAcquireDrmDisplayEXT",
+    "vkAcquireFullScreenExclusiveModeEXT",
+    "vkAcquireImageANDROID",
+    "vkAcquireNextImage2KHR",
+    "vkAcquireNextImageKHR",
+    "vkAcquirePerformanceConfigurationINTEL",
+    "vkAcquireProfilingLockKHR",
+    "vkAcquireWinrtDisplayNV",
+    "vkAcquireXlibDisplayEXT",
+    "vkAllocateCommandBuffers",
+    "vkAllocateDescriptorSets",
+    "vkAllocateMemory",
+    "vkBeginCommandBuffer",
+    "vkBeginCommandBufferAsyncGOOGLE",
+    "vkBindAccelerationStructureMemoryNV",
+    "vkBindBufferMemory",
+    "vkBindBufferMemory2",
+    "vkBindBufferMemory2KHR",
+    "vkBindImageMemory",
+    "vkBindImageMemory2",
+    "vkBindImageMemory2KHR",
+    "vkBindOpticalFlowSessionImageNV",
+    "vkBindVideoSessionMemoryKHR",
+    "vkBuildAccelerationStructuresKHR",
+    "vkBuildMicromapsEXT",
+    "vkCmdBeginConditionalRenderingEXT",
+    "vkCmdBeginDebugUtilsLabelEXT",
+    "vkCmdBeginQuery",
+    "vkCmdBeginQueryIndexedEXT",
+    "vkCmdBeginRenderPass",
+    "vkCmdBeginRenderPass2",
+    "vkCmdBeginRenderPass2KHR",
+    "vkCmdBeginRendering",
+    "vkCmdBeginRenderingKHR",
+    "vkCmdBeginTransformFeedbackEXT",
+    "vkCmdBeginVideoCodingKHR",
+    "vkCmdBindDescriptorBufferEmbeddedSamplersEXT",
+    "vkCmdBindDescriptorBuffersEXT",
+    "vkCmdBindDescriptorSets",
+    "vkCmdBindIndexBuffer",
+    "vkCmdBindInvocationMaskHUAWEI",
+    "vkCmdBindPipeline",
+    "vkCmdBindPipelineShaderGroupNV",
+    "vkCmdBindShadersEXT",
+    "vkCmdBindShadingRateImageNV",
+    "vkCmdBindTransformFeedbackBuffersEXT",
+    "vkCmdBindVertexBuffers",
+    "vkCmdBindVertexBuffers2",
+    "vkCmdBindVertexBuffers2EXT",
+    "vkCmdBlitImage",
+    "vkCmdBlitImage2",
+    "vkCmdBlitImage2KHR",
+    "vkCmdBuildAccelerationStructureNV",
+    "vkCmdBuildAccelerationStructuresIndirectKHR",
+    "vkCmdBuildAccelerationStructuresKHR",
+    "vkCmdBuildMicromapsEXT",
+    "vkCmdClearAttachments",
+    "vkCmdClearColorImage",
+    "vkCmdClearDepthStencilImage",
+    "vkCmdControlVideoCodingKHR",
+    "vkCmdCopyAccelerationStructureKHR",
+    "vkCmdCopyAccelerationStructureNV",
+    "vkCmdCopyAccelerationStructureToMemoryKHR",
+    "vkCmdCopyBuffer",
+    "vkCmdCopyBuffer2",
+    "vkCmdCopyBuffer2KHR",
+    "vkCmdCopyBufferToImage",
+    "vkCmdCopyBufferToImage2",
+    "vkCmdCopyBufferToImage2KHR",
+    "vkCmdCopyImage",
+    "vkCmdCopyImage2",
+    "vkCmdCopyImage2KHR",
+    "vkCmdCopyImageToBuffer",
+    "vkCmdCopyImageToBuffer2",
+    "vkCmdCopyImageToBuffer2KHR",
+    "vkCmdCopyMemoryIndirectNV",
+    "vkCmdCopyMemoryToAccelerationStructureKHR",
+    "vkCmdCopyMemoryToImageIndirectNV",
+    "vkCmdCopyMemoryToMicromapEXT",
+    "vkCmdCopyMicromapEXT",
+    "vkCmdCopyMicromapToMemoryEXT",
+    "vkCmdCopyQueryPoolResults",
+    "vkCmdCuLaunchKernelNVX",
+    "vkCmdDebugMarkerBeginEXT",
+    "vkCmdDebugMarkerEndEXT",
+    "vkCmdDebugMarkerInsertEXT",
+    "vkCmdDecodeVideoKHR",
+    "vkCmdDecompressMemoryIndirectCountNV",
+    "vkCmdDecompressMemoryNV",
+    "vkCmdDispatch",
+    "vkCmdDispatchBase",
+    "vkCmdDispatchBaseKHR",
+    "vkCmdDispatchIndirect",
+    "vkCmdDraw",
+    "vkCmdDrawClusterHUAWEI",
+    "vkCmdDrawClusterIndirectHUAWEI",
+    "vkCmdDrawIndexed",
+    "vkCmdDrawIndexedIndirect",
+    "vkCmdDrawIndexedIndirectCount",
+    "vkCmdDrawIndexedIndirectCountAMD",
+    "vkCmdDrawIndexedIndirectCountKHR",
+    "vkCmdDrawIndirect",
+    "vkCmdDrawIndirectByteCountEXT",
+    "vkCmdDrawIndirectCount",
+    "vkCmdDrawIndirectCountAMD",
+    "vkCmdDrawIndirectCountKHR",
+    "vkCmdDrawMeshTasksEXT",
+    "vkCmdDrawMeshTasksIndirectCountEXT",
+    "vkCmdDrawMeshTasksIndirectCountNV",
+    "vkCmdDrawMeshTasksIndirectEXT",
+    "vkCmdDrawMeshTasksIndirectNV",
+    "vkCmdDrawMeshTasksNV",
+    "vkCmdDrawMultiEXT",
+    "vkCmdDrawMultiIndexedEXT",
+    "vkCmdEncodeVideoKHR",
+    "vkCmdEndConditionalRenderingEXT",
+    "vkCmdEndDebugUtilsLabelEXT",
+    "vkCmdEndQuery",
+    "vkCmdEndQueryIndexedEXT",
+    "vkCmdEndRenderPass",
+    "vkCmdEndRenderPass2",
+    "vkCmdEndRenderPass2KHR",
+    "vkCmdEndRendering",
+    "vkCmdEndRenderingKHR",
+    "vkCmdEndTransformFeedbackEXT",
+    "vkCmdEndVideoCodingKHR",
+    "vkCmdExecuteCommands",
+    "vkCmdExecuteGeneratedCommandsNV",
+    "vkCmdFillBuffer",
+    "vkCmdInsertDebugUtilsLabelEXT",
+    "vkCmdNextSubpass",
+    "vkCmdNextSubpass2",
+    "vkCmdNextSubpass2KHR",
+    "vkCmdOpticalFlowExecuteNV",
+    "vkCmdPipelineBarrier",
+    "vkCmdPipelineBarrier2",
+    "vkCmdPipelineBarrier2KHR",
+    "vkCmdPreprocessGeneratedCommandsNV",
+    "vkCmdPushConstants",
+    "vkCmdPushDescriptorSetKHR",
+    "vkCmdPushDescriptorSetWithTemplateKHR",
+    "vkCmdResetEvent",
+    "vkCmdResetEvent2",
+    "vkCmdResetEvent2KHR",
+    "vkCmdResetQueryPool",
+    "vkCmdResolveImage",
+    "vkCmdResolveImage2",
+    "vkCmdResolveImage2KHR",
+    "vkCmdSetAlphaToCoverageEnableEXT",
+    "vkCmdSetAlphaToOneEnableEXT",
+    "vkCmdSetAttachmentFeedbackLoopEnableEXT",
+    "vkCmdSetBlendConstants",
+    "vkCmdSetCheckpointNV",
+    "vkCmdSetCoarseSampleOrderNV",
+    "vkCmdSetColorBlendAdvancedEXT",
+    "vkCmdSetColorBlendEnableEXT",
+    "vkCmdSetColorBlendEquationEXT",
+    "vkCmdSetColorWriteEnableEXT",
+    "vkCmdSetColorWriteMaskEXT",
+    "vkCmdSetConservativeRasterizationModeEXT",
+    "vkCmdSetCoverageModulationModeNV",
+    "vkCmdSetCoverageModulationTableEnableNV",
+    "vkCmdSetCoverageModulationTableNV",
+    "vkCmdSetCoverageReductionModeNV",
+    "vkCmdSetCoverageToColorEnableNV",
+    "vkCmdSetCoverageToColorLocationNV",
+    "vkCmdSetCullMode",
+    "vkCmdSetCullModeEXT",
+    "vkCmdSetDepthBias",
+    "vkCmdSetDepthBiasEnable",
+    "vkCmdSetDepthBiasEnableEXT",
+    "vkCmdSetDepthBounds",
+    "vkCmdSetDepthBoundsTestEnable",
+    "vkCmdSetDepthBoundsTestEnableEXT",
+    "vkCmdSetDepthClampEnableEXT",
+    "vkCmdSetDepthClipEnableEXT",
+    "vkCmdSetDepthClipNegativeOneToOneEXT",
+    "vkCmdSetDepthCompareOp",
+    "vkCmdSetDepthCompareOpEXT",
+    "vkCmdSetDepthTestEnable",
+    "vkCmdSetDepthTestEnableEXT",
+    "vkCmdSetDepthWriteEnable",
+    "vkCmdSetDepthWriteEnableEXT",
+    "vkCmdSetDescriptorBufferOffsetsEXT",
+    "vkCmdSetDeviceMask",
+    "vkCmdSetDeviceMaskKHR",
+    "vkCmdSetDiscardRectangleEXT",
+    "vkCmdSetDiscardRectangleEnableEXT",
+    "vkCmdSetDiscardRectangleModeEXT",
+    "vkCmdSetEvent",
+    "vkCmdSetEvent2",
+    "vkCmdSetEvent2KHR",
+    "vkCmdSetExclusiveScissorEnableNV",
+    "vkCmdSetExclusiveScissorNV",
+    "vkCmdSetExtraPrimitiveOverestimationSizeEXT",
+    "vkCmdSetFragmentShadingRateEnumNV",
+    "vkCmdSetFragmentShadingRateKHR",
+    "vkCmdSetFrontFace",
+    "vkCmdSetFrontFaceEXT",
+    "vkCmdSetLineRasterizationModeEXT",
+    "vkCmdSetLineStippleEXT",
+    "vkCmdSetLineStippleEnableEXT",
+    "vkCmdSetLineWidth",
+    "vkCmdSetLogicOpEXT",
+    "vkCmdSetLogicOpEnableEXT",
+    "vkCmdSetPatchControlPointsEXT",
+    "vkCmdSetPerformanceMarkerINTEL",
+    "vkCmdSetPerformanceOverrideINTEL",
+    "vkCmdSetPerformanceStreamMarkerINTEL",
+    "vkCmdSetPolygonModeEXT",
+    "vkCmdSetPrimitiveRestartEnable",
+    "vkCmdSetPrimitiveRestartEnableEXT",
+    "vkCmdSetPrimitiveTopology",
+    "vkCmdSetPrimitiveTopologyEXT",
+    "vkCmdSetProvokingVertexModeEXT",
+    "vkCmdSetRasterizationSamplesEXT",
+    "vkCmdSetRasterizationStreamEXT",
+    "vkCmdSetRasterizerDiscardEnable",
+    "vkCmdSetRasterizerDiscardEnableEXT",
+    "vkCmdSetRayTracingPipelineStackSizeKHR",
+    "vkCmdSetRepresentativeFragmentTestEnableNV",
+    "vkCmdSetSampleLocationsEXT",
+    "vkCmdSetSampleLocationsEnableEXT",
+    "vkCmdSetSampleMaskEXT",
+    "vkCmdSetScissor",
+    "vkCmdSetScissorWithCount",
+    "vkCmdSetScissorWithCountEXT",
+    "vkCmdSetShadingRateImageEnableNV",
+    "vkCmdSetStencilCompareMask",
+    "vkCmdSetStencilOp",
+    "vkCmdSetStencilOpEXT",
+    "vkCmdSetStencilReference",
+    "vkCmdSetStencilTestEnable",
+    "vkCmdSetStencilTestEnableEXT",
+    "vkCmdSetStencilWriteMask",
+    "vkCmdSetTessellationDomainOriginEXT",
+    "vkCmdSetVertexInputEXT",
+    "vkCmdSetViewport",
+    "vkCmdSetViewportShadingRatePaletteNV",
+    "vkCmdSetViewportSwizzleNV",
+    "vkCmdSetViewportWScalingEnableNV",
+    "vkCmdSetViewportWScalingNV",
+    "vkCmdSetViewportWithCount",
+    "vkCmdSetViewportWithCountEXT",
+    "vkCmdSubpassShadingHUAWEI",
+    "vkCmdTraceRaysIndirect2KHR",
+    "vkCmdTraceRaysIndirectKHR",
+    "vkCmdTraceRaysKHR",
+    "vkCmdTraceRaysNV",
+    "vkCmdUpdateBuffer",
+    "vkCmdWaitEvents",
+    "vkCmdWaitEvents2",
+    "vkCmdWaitEvents2KHR",
+    "vkCmdWriteAccelerationStructuresPropertiesKHR",
+    "vkCmdWriteAccelerationStructuresPropertiesNV",
+    "vkCmdWriteBufferMarker2AMD",
+    "vkCmdWriteBufferMarkerAMD",
+    "vkCmdWriteMicromapsPropertiesEXT",
+    "vkCmdWriteTimestamp",
+    "vkCmdWriteTimestamp2",
+    "vkCmdWriteTimestamp2KHR",
+    "vkCollectDescriptorPoolIdsGOOGLE",
+    "vkCommandBufferHostSyncGOOGLE",
+    "vkCompileDeferredNV",
+    "vkCopyAccelerationStructureKHR",
+    "vkCopyAccelerationStructureToMemoryKHR",
+    "vkCopyMemoryToAccelerationStructureKHR",
+    "vkCopyMemoryToMicromapEXT",
+    "vkCopyMicromapEXT",
+    "vkCopyMicromapToMemoryEXT",
+    "vkCreateAccelerationStructureKHR",
+    "vkCreateAccelerationStructureNV",
+    "vkCreateAndroidSurfaceKHR",
+    "vkCreateBuffer",
+    "vkCreateBufferCollectionFUCHSIA",
+    "vkCreateBufferView",
+    "vkCreateBufferWithRequirementsGOOGLE",
+    "vkCreateCommandPool",
+    "vkCreateComputePipelines",
+    "vkCreateCuFunctionNVX",
+    "vkCreateCuModuleNVX",
+    "vkCreateDebugReportCallbackEXT",
+    "vkCreateDebugUtilsMessengerEXT",
+    "vkCreateDeferredOperationKHR",
+    "vkCreateDescriptorPool",
+    "vkCreateDescriptorSetLayout",
+    "vkCreateDescriptorUpdateTemplate",
+    "vkCreateDescriptorUpdateTemplateKHR",
+    "vkCreateDevice",
+    "vkCreateDirectFBSurfaceEXT",
+    "vkCreateDisplayModeKHR",
+    "vkCreateDisplayPlaneSurfaceKHR",
+    "vkCreateEvent",
+    "vkCreateFence",
+    "vkCreateFramebuffer",
+    "vkCreateGraphicsPipelines",
+    "vkCreateHeadlessSurfaceEXT",
+    "vkCreateIOSSurfaceMVK",
+    "vkCreateImage",
+    "vkCreateImagePipeSurfaceFUCHSIA",
+    "vkCreateImageView",
+    "vkCreateImageWithRequirementsGOOGLE",
+    "vkCreateIndirectCommandsLayoutNV",
+    "vkCreateInstance",
+    "vkCreateMacOSSurfaceMVK",
+    "vkCreateMetalSurfaceEXT",
+    "vkCreateMicromapEXT",
+    "vkCreateOpticalFlowSessionNV",
+    "vkCreatePipelineCache",
+    "vkCreatePipelineLayout",
+    "vkCreatePrivateDataSlot",
+    "vkCreatePrivateDataSlotEXT",
+    "vkCreateQueryPool",
+    "vkCreateRayTracingPipelinesKHR",
+    "vkCreateRayTracingPipelinesNV",
+    "vkCreateRenderPass",
+    "vkCreateRenderPass2",
+    "vkCreateRenderPass2KHR",
+    "vkCreateSampler",
+    "vkCreateSamplerYcbcrConversion",
+    "vkCreateSamplerYcbcrConversionKHR",
+    "vkCreateScreenSurfaceQNX",
+    "vkCreateSemaphore",
+    "vkCreateShaderModule",
+    "vkCreateShadersEXT",
+    "vkCreateSharedSwapchainsKHR",
+    "vkCreateStreamDescriptorSurfaceGGP",
+    "vkCreateSwapchainKHR",
+    "vkCreateValidationCacheEXT",
+    "vkCreateViSurfaceNN",
+    "vkCreateVideoSessionKHR",
+    "vkCreateVideoSessionParametersKHR",
+    "vkCreateWaylandSurfaceKHR",
+    "vkCreateWin32SurfaceKHR",
+    "vkCreateXcbSurfaceKHR",
+    "vkCreateXlibSurfaceKHR",
+    "vkDebugMarkerSetObjectNameEXT",
+    "vkDebugMarkerSetObjectTagEXT",
+    "vkDebugReportMessageEXT",
+    "vkDeferredOperationJoinKHR",
+    "vkDestroyAccelerationStructureKHR",
+    "vkDestroyAccelerationStructureNV",
+    "vkDestroyBuffer",
+    "vkDestroyBufferCollectionFUCHSIA",
+    "vkDestroyBufferView",
+    "vkDestroyCommandPool",
+    "vkDestroyCuFunctionNVX",
+    "vkDestroyCuModuleNVX",
+    "vkDestroyDebugReportCallbackEXT",
+    "vkDestroyDebugUtilsMessengerEXT",
+    "vkDestroyDeferredOperationKHR",
+    "vkDestroyDescriptorPool",
+    "vkDestroyDescriptorSetLayout",
+    "vkDestroyDescriptorUpdateTemplate",
+    "vkDestroyDescriptorUpdateTemplateKHR",
+    "vkDestroyDevice",
+    "vkDestroyEvent",
+    "vkDestroyFence",
+    "vkDestroyFramebuffer",
+    "vkDestroyImage",
+    "vkDestroyImageView",
+    "vkDestroyIndirectCommandsLayoutNV",
+    "vkDestroyInstance",
+    "vkDestroyMicromapEXT",
+    "vkDestroyOpticalFlowSessionNV",
+    "vkDestroyPipeline",
+    "vkDestroyPipelineCache",
+    "vkDestroyPipelineLayout",
+    "vkDestroyPrivateDataSlot",
+    "vkDestroyPrivateDataSlotEXT",
+    "vkDestroyQueryPool",
+    "vkDestroyRenderPass",
+    "vkDestroySampler",
+    "vkDestroySamplerYcbcrConversion",
+    "vkDestroySamplerYcbcrConversionKHR",
+    "vkDestroySemaphore",
+    "vkDestroyShaderEXT",
+    "vkDestroyShaderModule",
+    "vkDestroySurfaceKHR",
+    "vkDestroySwapchainKHR",
+    "vkDestroyValidationCacheEXT",
+    "vkDestroyVideoSessionKHR",
+    "vkDestroyVideoSessionParametersKHR",
+    "vkDeviceWaitIdle",
+    "vkDisplayPowerControlEXT",
+    "vkEndCommandBuffer",
+    "vkEndCommandBufferAsyncGOOGLE",
+    "vkEnumerateDeviceExtensionProperties",
+    "vkEnumerateDeviceLayerProperties",
+    "vkEnumerateInstanceExtensionProperties",
+    "vkEnumerateInstanceLayerProperties",
+    "vkEnumerateInstanceVersion",
+    "vkEnumeratePhysicalDeviceGroups",
+    "vkEnumeratePhysicalDeviceGroupsKHR",
+    "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+    "vkEnumeratePhysicalDevices",
+    "vkExportMetalObjectsEXT",
+    "vkFlushMappedMemoryRanges",
+    "vkFreeCommandBuffers",
+    "vkFreeDescriptorSets",
+    "vkFreeMemory",
+    "vkFreeMemorySyncGOOGLE",
+    "vkGetAccelerationStructureBuildSizesKHR",
+    "vkGetAccelerationStructureDeviceAddressKHR",
+    "vkGetAccelerationStructureHandleNV",
+    "vkGetAccelerationStructureMemoryRequirementsNV",
+    "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT",
+    "vkGetAndroidHardwareBufferPropertiesANDROID",
+    "vkGetBlobGOOGLE",
+    "vkGetBufferCollectionPropertiesFUCHSIA",
+    "vkGetBufferDeviceAddress",
+    "vkGetBufferDeviceAddressEXT",
+    "vkGetBufferDeviceAddressKHR",
+    "vkGetBufferMemoryRequirements",
+    "vkGetBufferMemoryRequirements2",
+    "vkGetBufferMemoryRequirements2KHR",
+    "vkGetBufferOpaqueCaptureAddress",
+    "vkGetBufferOpaqueCaptureAddressKHR",
+    "vkGetBufferOpaqueCaptureDescriptorDataEXT",
+    "vkGetCalibratedTimestampsEXT",
+    "vkGetDeferredOperationMaxConcurrencyKHR",
+    "vkGetDeferredOperationResultKHR",
+    "vkGetDescriptorEXT",
+    "vkGetDescriptorSetHostMappingVALVE",
+    "vkGetDescriptorSetLayoutBindingOffsetEXT",
+    "vkGetDescriptorSetLayoutHostMappingInfoVALVE",
+    "vkGetDescriptorSetLayoutSizeEXT",
+    "vkGetDescriptorSetLayoutSupport",
+    "vkGetDescriptorSetLayoutSupportKHR",
+    "vkGetDeviceAccelerationStructureCompatibilityKHR",
+    "vkGetDeviceBufferMemoryRequirements",
+    "vkGetDeviceBufferMemoryRequirementsKHR",
+    "vkGetDeviceFaultInfoEXT",
+    "vkGetDeviceGroupPeerMemoryFeatures",
+    "vkGetDeviceGroupPeerMemoryFeaturesKHR",
+    "vkGetDeviceGroupPresentCapabilitiesKHR",
+    "vkGetDeviceGroupSurfacePresentModes2EXT",
+    "vkGetDeviceGroupSurfacePresentModesKHR",
+    "vkGetDeviceImageMemoryRequirements",
+    "vkGetDeviceImageMemoryRequirementsKHR",
+    "vkGetDeviceImageSparseMemoryRequirements",
+    "vkGetDeviceImageSparseMemoryRequirementsKHR",
+    "vkGetDeviceMemoryCommitment",
+    "vkGetDeviceMemoryOpaqueCaptureAddress",
+    "vkGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "vkGetDeviceMicromapCompatibilityEXT",
+    "vkGetDeviceProcAddr",
+    "vkGetDeviceQueue",
+    "vkGetDeviceQueue2",
+    "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+    "vkGetDisplayModeProperties2KHR",
+    "vkGetDisplayModePropertiesKHR",
+    "vkGetDisplayPlaneCapabilities2KHR",
+    "vkGetDisplayPlaneCapabilitiesKHR",
+    "vkGetDisplayPlaneSupportedDisplaysKHR",
+    "vkGetDrmDisplayEXT",
+    "vkGetDynamicRenderingTilePropertiesQCOM",
+    "vkGetEventStatus",
+    "vkGetFenceFdKHR",
+    "vkGetFenceStatus",
+    "vkGetFenceWin32HandleKHR",
+    "vkGetFramebufferTilePropertiesQCOM",
+    "vkGetGeneratedCommandsMemoryRequirementsNV",
+    "vkGetImageDrmFormatModifierPropertiesEXT",
+    "vkGetImageMemoryRequirements",
+    "vkGetImageMemoryRequirements2",
+    "vkGetImageMemoryRequirements2KHR",
+    "vkGetImageOpaqueCaptureDescriptorDataEXT",
+    "vkGetImageSparseMemoryRequirements",
+    "vkGetImageSparseMemoryRequirements2",
+    "vkGetImageSparseMemoryRequirements2KHR",
+    "vkGetImageSubresourceLayout",
+    "vkGetImageSubresourceLayout2EXT",
+    "vkGetImageViewAddressNVX",
+    "vkGetImageViewHandleNVX",
+    "vkGetImageViewOpaqueCaptureDescriptorDataEXT",
+    "vkGetInstanceProcAddr",
+    "vkGetLinearImageLayout2GOOGLE",
+    "vkGetLinearImageLayoutGOOGLE",
+    "vkGetMemoryAndroidHardwareBufferANDROID",
+    "vkGetMemoryFdKHR",
+    "vkGetMemoryFdPropertiesKHR",
+    "vkGetMemoryHostAddressInfoGOOGLE",
+    "vkGetMemoryHostPointerPropertiesEXT",
+    "vkGetMemoryRemoteAddressNV",
+    "vkGetMemoryWin32HandleKHR",
+    "vkGetMemoryWin32HandleNV",
+    "vkGetMemoryWin32HandlePropertiesKHR",
+    "vkGetMemoryZirconHandleFUCHSIA",
+    "vkGetMemoryZirconHandlePropertiesFUCHSIA",
+    "vkGetMicromapBuildSizesEXT",
+    "vkGetPastPresentationTimingGOOGLE",
+    "vkGetPerformanceParameterINTEL",
+    "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",
+    "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV",
+    "vkGetPhysicalDeviceDirectFBPresentationSupportEXT",
+    "vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+    "vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+    "vkGetPhysicalDeviceDisplayProperties2KHR",
+    "vkGetPhysicalDeviceDisplayPropertiesKHR",
+    "vkGetPhysicalDeviceExternalBufferProperties",
+    "vkGetPhysicalDeviceExternalBufferPropertiesKHR",
+    "vkGetPhysicalDeviceExternalFenceProperties",
+    "vkGetPhysicalDeviceExternalFencePropertiesKHR",
+    "vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+    "vkGetPhysicalDeviceExternalSemaphoreProperties",
+    "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",
+    "vkGetPhysicalDeviceFeatures",
+    "vkGetPhysicalDeviceFeatures2",
+    "vkGetPhysicalDeviceFeatures2KHR",
+    "vkGetPhysicalDeviceFormatProperties",
+    "vkGetPhysicalDeviceFormatProperties2",
+    "vkGetPhysicalDeviceFormatProperties2KHR",
+    "vkGetPhysicalDeviceFragmentShadingRatesKHR",
+    "vkGetPhysicalDeviceImageFormatProperties",
+    "vkGetPhysicalDeviceImageFormatProperties2",
+    "vkGetPhysicalDeviceImageFormatProperties2KHR",
+    "vkGetPhysicalDeviceMemoryProperties",
+    "vkGetPhysicalDeviceMemoryProperties2",
+    "vkGetPhysicalDeviceMemoryProperties2KHR",
+    "vkGetPhysicalDeviceMultisamplePropertiesEXT",
+    "vkGetPhysicalDeviceOpticalFlowImageFormatsNV",
+    "vkGetPhysicalDevicePresentRectanglesKHR",
+    "vkGetPhysicalDeviceProperties",
+    "vkGetPhysicalDeviceProperties2",
+    "vkGetPhysicalDeviceProperties2KHR",
+    "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+    "vkGetPhysicalDeviceQueueFamilyProperties",
+    "vkGetPhysicalDeviceQueueFamilyProperties2",
+    "vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+    "vkGetPhysicalDeviceScreenPresentationSupportQNX",
+    "vkGetPhysicalDeviceSparseImageFormatProperties",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+    "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+    "vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+    "vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+    "vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+    "vkGetPhysicalDeviceSurfaceFormats2KHR",
+    "vkGetPhysicalDeviceSurfaceFormatsKHR",
+    "vkGetPhysicalDeviceSurfacePresentModes2EXT",
+    "vkGetPhysicalDeviceSurfacePresentModesKHR",
+    "vkGetPhysicalDeviceSurfaceSupportKHR",
+    "vkGetPhysicalDeviceToolProperties",
+    "vkGetPhysicalDeviceToolPropertiesEXT",
+    "vkGetPhysicalDeviceVideoCapabilitiesKHR",
+    "vkGetPhysicalDeviceVideoFormatPropertiesKHR",
+    "vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+    "vkGetPhysicalDeviceWin32PresentationSupportKHR",
+    "vkGetPhysicalDeviceXcbPresentationSupportKHR",
+    "vkGetPhysicalDeviceXlibPresentationSupportKHR",
+    "vkGetPipelineCacheData",
+    "vkGetPipelineExecutableInternalRepresentationsKHR",
+    "vkGetPipelineExecutablePropertiesKHR",
+    "vkGetPipelineExecutableStatisticsKHR",
+    "vkGetPipelinePropertiesEXT",
+    "vkGetPrivateData",
+    "vkGetPrivateDataEXT",
+    "vkGetQueryPoolResults",
+    "vkGetQueueCheckpointData2NV",
+    "vkGetQueueCheckpointDataNV",
+    "vkGetRandROutputDisplayEXT",
+    "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "vkGetRayTracingShaderGroupHandlesKHR",
+    "vkGetRayTracingShaderGroupHandlesNV",
+    "vkGetRayTracingShaderGroupStackSizeKHR",
+    "vkGetRefreshCycleDurationGOOGLE",
+    "vkGetRenderAreaGranularity",
+    "vkGetSamplerOpaqueCaptureDescriptorDataEXT",
+    "vkGetSemaphoreCounterValue",
+    "vkGetSemaphoreCounterValueKHR",
+    "vkGetSemaphoreFdKHR",
+    "vkGetSemaphoreWin32HandleKHR",
+    "vkGetSemaphoreZirconHandleFUCHSIA",
+    "vkGetShaderBinaryDataEXT",
+    "vkGetShaderInfoAMD",
+    "vkGetShaderModuleCreateInfoIdentifierEXT",
+    "vkGetShaderModuleIdentifierEXT",
+    "vkGetSwapchainCounterEXT",
+    "vkGetSwapchainGrallocUsage2ANDROID",
+    "vkGetSwapchainGrallocUsageANDROID",
+    "vkGetSwapchainImagesKHR",
+    "vkGetSwapchainStatusKHR",
+    "vkGetValidationCacheDataEXT",
+    "vkGetVideoSessionMemoryRequirementsKHR",
+    "vkGetWinrtDisplayNV",
+    "vkImportFenceFdKHR",
+    "vkImportFenceWin32HandleKHR",
+    "vkImportSemaphoreFdKHR",
+    "vkImportSemaphoreWin32HandleKHR",
+    "vkImportSemaphoreZirconHandleFUCHSIA",
+    "vkInitializePerformanceApiINTEL",
+    "vkInvalidateMappedMemoryRanges",
+    "vkMapMemory",
+    "vkMapMemory2KHR",
+    "vkMapMemoryIntoAddressSpaceGOOGLE",
+    "vkMergePipelineCaches",
+    "vkMergeValidationCachesEXT",
+    "vkQueueBeginDebugUtilsLabelEXT",
+    "vkQueueBindSparse",
+    "vkQueueBindSparseAsyncGOOGLE",
+    "vkQueueCommitDescriptorSetUpdatesGOOGLE",
+    "vkQueueEndDebugUtilsLabelEXT",
+    "vkQueueFlushCommandsFromAuxMemoryGOOGLE",
+    "vkQueueFlushCommandsGOOGLE",
+    "vkQueueHostSyncGOOGLE",
+    "vkQueueInsertDebugUtilsLabelEXT",
+    "vkQueuePresentKHR",
+    "vkQueueSetPerformanceConfigurationINTEL",
+    "vkQueueSignalReleaseImageANDROID",
+    "vkQueueSignalReleaseImageANDROIDAsyncGOOGLE",
+    "vkQueueSubmit",
+    "vkQueueSubmit2",
+    "vkQueueSubmit2KHR",
+    "vkQueueSubmitAsync2GOOGLE",
+    "vkQueueSubmitAsyncGOOGLE",
+    "vkQueueWaitIdle",
+    "vkQueueWaitIdleAsyncGOOGLE",
+    "vkRegisterDeviceEventEXT",
+    "vkRegisterDisplayEventEXT",
+    "vkReleaseDisplayEXT",
+    "vkReleaseFullScreenExclusiveModeEXT",
+    "vkReleasePerformanceConfigurationINTEL",
+    "vkReleaseProfilingLockKHR",
+    "vkReleaseSwapchainImagesEXT",
+    "vkResetCommandBuffer",
+    "vkResetCommandBufferAsyncGOOGLE",
+    "vkResetCommandPool",
+    "vkResetDescriptorPool",
+    "vkResetEvent",
+    "vkResetFences",
+    "vkResetQueryPool",
+    "vkResetQueryPoolEXT",
+    "vkSetBufferCollectionBufferConstraintsFUCHSIA",
+    "vkSetBufferCollectionImageConstraintsFUCHSIA",
+    "vkSetDebugUtilsObjectNameEXT",
+    "vkSetDebugUtilsObjectTagEXT",
+    "vkSetDeviceMemoryPriorityEXT",
+    "vkSetEvent",
+    "vkSetHdrMetadataEXT",
+    "vkSetLocalDimmingAMD",
+    "vkSetPrivateData",
+    "vkSetPrivateDataEXT",
+    "vkSignalSemaphore",
+    "vkSignalSemaphoreKHR",
+    "vkSubmitDebugUtilsMessageEXT",
+    "vkTrimCommandPool",
+    "vkTrimCommandPoolKHR",
+    "vkUninitializePerformanceApiINTEL",
+    "vkUnmapMemory",
+    "vkUnmapMemory2KHR",
+    "vkUpdateDescriptorSetWithTemplate",
+    "vkUpdateDescriptorSetWithTemplateKHR",
+    "vkUpdateDescriptorSetWithTemplateSized2GOOGLE",
+    "vkUpdateDescriptorSetWithTemplateSizedGOOGLE",
+    "vkUpdateDescriptorSets",
+    "vkUpdateVideoSessionParametersKHR",
+    "vkWaitForFences",
+    "vkWaitForPresentKHR",
+    "vkWaitSemaphores",
+    "vkWaitSemaphoresKHR",
+    "vkWriteAccelerationStructuresPropertiesKHR",
+    "vkWriteMicromapsPropertiesEXT",
+};
+
+// Binary search, so that a lookup costs about ten string compares instead of
+// one for each entry point before the one asked for. -1 if not found.
+static int goldfish_vulkan_proc_index(const char* name) {
+    int lo = 0;
+    int hi = (int)(sizeof(kProcNames) / sizeof(kProcNames[0])) - 1;
+    while (lo <= hi) {
+        const int mid = lo + (hi - lo) / 2;
+        const int cmp = strcmp(name, kProcNames[mid]);
+        if (!cmp) return mid;
+        if (cmp < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return -1;
+}
+
 void* goldfish_vulkan_get_proc_address(const char* name) {
+    switch (goldfish_vulkan_proc_index(name)) {
 #ifdef VK_VERSION_1_0
-    if (!strcmp(name, "vkCreateInstance")) {
-        return (void*)entry_vkCreateInstance;
-    }
-    if (!strcmp(name, "vkDestroyInstance")) {
-        return (void*)entry_vkDestroyInstance;
-    }
-    if (!strcmp(name, "vkEnumeratePhysicalDevices")) {
-        return (void*)entry_vkEnumeratePhysicalDevices;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures")) {
-        return (void*)entry_vkGetPhysicalDeviceFeatures;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceFormatProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceImageFormatProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceMemoryProperties;
-    }
-    if (!strcmp(name, "vkGetInstanceProcAddr")) {
-        return (void*)entry_vkGetInstanceProcAddr;
-    }
-    if (!strcmp(name, "vkGetDeviceProcAddr")) {
-        return (void*)entry_vkGetDeviceProcAddr;
-    }
-    if (!strcmp(name, "vkCreateDevice")) {
-        return (void*)entry_vkCreateDevice;
-    }
-    if (!strcmp(name, "vkDestroyDevice")) {
-        return (void*)entry_vkDestroyDevice;
-    }
-    if (!strcmp(name, "vkEnumerateInstanceExtensionProperties")) {
-        return (void*)entry_vkEnumerateInstanceExtensionProperties;
-    }
-    if (!strcmp(name, "vkEnumerateDeviceExtensionProperties")) {
-        return (void*)entry_vkEnumerateDeviceExtensionProperties;
-    }
-    if (!strcmp(name, "vkEnumerateInstanceLayerProperties")) {
-        return (void*)entry_vkEnumerateInstanceLayerProperties;
-    }
-    if (!strcmp(name, "vkEnumerateDeviceLayerProperties")) {
-        return (void*)entry_vkEnumerateDeviceLayerProperties;
-    }
-    if (!strcmp(name, "vkGetDeviceQueue")) {
-        return (void*)entry_vkGetDeviceQueue;
-    }
-    if (!strcmp(name, "vkQueueSubmit")) {
-        return (void*)entry_vkQueueSubmit;
-    }
-    if (!strcmp(name, "vkQueueWaitIdle")) {
-        return (void*)entry_vkQueueWaitIdle;
-    }
-    if (!strcmp(name, "vkDeviceWaitIdle")) {
-        return (void*)entry_vkDeviceWaitIdle;
-    }
-    if (!strcmp(name, "vkAllocateMemory")) {
-        return (void*)entry_vkAllocateMemory;
-    }
-    if (!strcmp(name, "vkFreeMemory")) {
-        return (void*)entry_vkFreeMemory;
-    }
-    if (!strcmp(name, "vkMapMemory")) {
-        return (void*)entry_vkMapMemory;
-    }
-    if (!strcmp(name, "vkUnmapMemory")) {
-        return (void*)entry_vkUnmapMemory;
-    }
-    if (!strcmp(name, "vkFlushMappedMemoryRanges")) {
-        return (void*)entry_vkFlushMappedMemoryRanges;
-    }
-    if (!strcmp(name, "vkInvalidateMappedMemoryRanges")) {
-        return (void*)entry_vkInvalidateMappedMemoryRanges;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryCommitment")) {
-        return (void*)entry_vkGetDeviceMemoryCommitment;
-    }
-    if (!strcmp(name, "vkBindBufferMemory")) {
-        return (void*)entry_vkBindBufferMemory;
-    }
-    if (!strcmp(name, "vkBindImageMemory")) {
-        return (void*)entry_vkBindImageMemory;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements")) {
-        return (void*)entry_vkGetBufferMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetImageMemoryRequirements")) {
-        return (void*)entry_vkGetImageMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements")) {
-        return (void*)entry_vkGetImageSparseMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties;
-    }
-    if (!strcmp(name, "vkQueueBindSparse")) {
-        return (void*)entry_vkQueueBindSparse;
-    }
-    if (!strcmp(name, "vkCreateFence")) {
-        return (void*)entry_vkCreateFence;
-    }
-    if (!strcmp(name, "vkDestroyFence")) {
-        return (void*)entry_vkDestroyFence;
-    }
-    if (!strcmp(name, "vkResetFences")) {
-        return (void*)entry_vkResetFences;
-    }
-    if (!strcmp(name, "vkGetFenceStatus")) {
-        return (void*)entry_vkGetFenceStatus;
-    }
-    if (!strcmp(name, "vkWaitForFences")) {
-        return (void*)entry_vkWaitForFences;
-    }
-    if (!strcmp(name, "vkCreateSemaphore")) {
-        return (void*)entry_vkCreateSemaphore;
-    }
-    if (!strcmp(name, "vkDestroySemaphore")) {
-        return (void*)entry_vkDestroySemaphore;
-    }
-    if (!strcmp(name, "vkCreateEvent")) {
-        return (void*)entry_vkCreateEvent;
-    }
-    if (!strcmp(name, "vkDestroyEvent")) {
-        return (void*)entry_vkDestroyEvent;
-    }
-    if (!strcmp(name, "vkGetEventStatus")) {
-        return (void*)entry_vkGetEventStatus;
-    }
-    if (!strcmp(name, "vkSetEvent")) {
-        return (void*)entry_vkSetEvent;
-    }
-    if (!strcmp(name, "vkResetEvent")) {
-        return (void*)entry_vkResetEvent;
-    }
-    if (!strcmp(name, "vkCreateQueryPool")) {
-        return (void*)entry_vkCreateQueryPool;
-    }
-    if (!strcmp(name, "vkDestroyQueryPool")) {
-        return (void*)entry_vkDestroyQueryPool;
-    }
-    if (!strcmp(name, "vkGetQueryPoolResults")) {
-        return (void*)entry_vkGetQueryPoolResults;
-    }
-    if (!strcmp(name, "vkCreateBuffer")) {
-        return (void*)entry_vkCreateBuffer;
-    }
-    if (!strcmp(name, "vkDestroyBuffer")) {
-        return (void*)entry_vkDestroyBuffer;
-    }
-    if (!strcmp(name, "vkCreateBufferView")) {
-        return (void*)entry_vkCreateBufferView;
-    }
-    if (!strcmp(name, "vkDestroyBufferView")) {
-        return (void*)entry_vkDestroyBufferView;
-    }
-    if (!strcmp(name, "vkCreateImage")) {
-        return (void*)entry_vkCreateImage;
-    }
-    if (!strcmp(name, "vkDestroyImage")) {
-        return (void*)entry_vkDestroyImage;
-    }
-    if (!strcmp(name, "vkGetImageSubresourceLayout")) {
-        return (void*)entry_vkGetImageSubresourceLayout;
-    }
-    if (!strcmp(name, "vkCreateImageView")) {
-        return (void*)entry_vkCreateImageView;
-    }
-    if (!strcmp(name, "vkDestroyImageView")) {
-        return (void*)entry_vkDestroyImageView;
-    }
-    if (!strcmp(name, "vkCreateShaderModule")) {
-        return (void*)entry_vkCreateShaderModule;
-    }
-    if (!strcmp(name, "vkDestroyShaderModule")) {
-        return (void*)entry_vkDestroyShaderModule;
-    }
-    if (!strcmp(name, "vkCreatePipelineCache")) {
-        return (void*)entry_vkCreatePipelineCache;
-    }
-    if (!strcmp(name, "vkDestroyPipelineCache")) {
-        return (void*)entry_vkDestroyPipelineCache;
-    }
-    if (!strcmp(name, "vkGetPipelineCacheData")) {
-        return (void*)entry_vkGetPipelineCacheData;
-    }
-    if (!strcmp(name, "vkMergePipelineCaches")) {
-        return (void*)entry_vkMergePipelineCaches;
-    }
-    if (!strcmp(name, "vkCreateGraphicsPipelines")) {
-        return (void*)entry_vkCreateGraphicsPipelines;
-    }
-    if (!strcmp(name, "vkCreateComputePipelines")) {
-        return (void*)entry_vkCreateComputePipelines;
-    }
-    if (!strcmp(name, "vkDestroyPipeline")) {
-        return (void*)entry_vkDestroyPipeline;
-    }
-    if (!strcmp(name, "vkCreatePipelineLayout")) {
-        return (void*)entry_vkCreatePipelineLayout;
-    }
-    if (!strcmp(name, "vkDestroyPipelineLayout")) {
-        return (void*)entry_vkDestroyPipelineLayout;
-    }
-    if (!strcmp(name, "vkCreateSampler")) {
-        return (void*)entry_vkCreateSampler;
-    }
-    if (!strcmp(name, "vkDestroySampler")) {
-        return (void*)entry_vkDestroySampler;
-    }
-    if (!strcmp(name, "vkCreateDescriptorSetLayout")) {
-        return (void*)entry_vkCreateDescriptorSetLayout;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorSetLayout")) {
-        return (void*)entry_vkDestroyDescriptorSetLayout;
-    }
-    if (!strcmp(name, "vkCreateDescriptorPool")) {
-        return (void*)entry_vkCreateDescriptorPool;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorPool")) {
-        return (void*)entry_vkDestroyDescriptorPool;
-    }
-    if (!strcmp(name, "vkResetDescriptorPool")) {
-        return (void*)entry_vkResetDescriptorPool;
-    }
-    if (!strcmp(name, "vkAllocateDescriptorSets")) {
-        return (void*)entry_vkAllocateDescriptorSets;
-    }
-    if (!strcmp(name, "vkFreeDescriptorSets")) {
-        return (void*)entry_vkFreeDescriptorSets;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSets")) {
-        return (void*)entry_vkUpdateDescriptorSets;
-    }
-    if (!strcmp(name, "vkCreateFramebuffer")) {
-        return (void*)entry_vkCreateFramebuffer;
-    }
-    if (!strcmp(name, "vkDestroyFramebuffer")) {
-        return (void*)entry_vkDestroyFramebuffer;
-    }
-    if (!strcmp(name, "vkCreateRenderPass")) {
-        return (void*)entry_vkCreateRenderPass;
-    }
-    if (!strcmp(name, "vkDestroyRenderPass")) {
-        return (void*)entry_vkDestroyRenderPass;
-    }
-    if (!strcmp(name, "vkGetRenderAreaGranularity")) {
-        return (void*)entry_vkGetRenderAreaGranularity;
-    }
-    if (!strcmp(name, "vkCreateCommandPool")) {
-        return (void*)entry_vkCreateCommandPool;
-    }
-    if (!strcmp(name, "vkDestroyCommandPool")) {
-        return (void*)entry_vkDestroyCommandPool;
-    }
-    if (!strcmp(name, "vkResetCommandPool")) {
-        return (void*)entry_vkResetCommandPool;
-    }
-    if (!strcmp(name, "vkAllocateCommandBuffers")) {
-        return (void*)entry_vkAllocateCommandBuffers;
-    }
-    if (!strcmp(name, "vkFreeCommandBuffers")) {
-        return (void*)entry_vkFreeCommandBuffers;
-    }
-    if (!strcmp(name, "vkBeginCommandBuffer")) {
-        return (void*)entry_vkBeginCommandBuffer;
-    }
-    if (!strcmp(name, "vkEndCommandBuffer")) {
-        return (void*)entry_vkEndCommandBuffer;
-    }
-    if (!strcmp(name, "vkResetCommandBuffer")) {
-        return (void*)entry_vkResetCommandBuffer;
-    }
-    if (!strcmp(name, "vkCmdBindPipeline")) {
-        return (void*)entry_vkCmdBindPipeline;
-    }
-    if (!strcmp(name, "vkCmdSetViewport")) {
-        return (void*)entry_vkCmdSetViewport;
-    }
-    if (!strcmp(name, "vkCmdSetScissor")) {
-        return (void*)entry_vkCmdSetScissor;
-    }
-    if (!strcmp(name, "vkCmdSetLineWidth")) {
-        return (void*)entry_vkCmdSetLineWidth;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBias")) {
-        return (void*)entry_vkCmdSetDepthBias;
-    }
-    if (!strcmp(name, "vkCmdSetBlendConstants")) {
-        return (void*)entry_vkCmdSetBlendConstants;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBounds")) {
-        return (void*)entry_vkCmdSetDepthBounds;
-    }
-    if (!strcmp(name, "vkCmdSetStencilCompareMask")) {
-        return (void*)entry_vkCmdSetStencilCompareMask;
-    }
-    if (!strcmp(name, "vkCmdSetStencilWriteMask")) {
-        return (void*)entry_vkCmdSetStencilWriteMask;
-    }
-    if (!strcmp(name, "vkCmdSetStencilReference")) {
-        return (void*)entry_vkCmdSetStencilReference;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorSets")) {
-        return (void*)entry_vkCmdBindDescriptorSets;
-    }
-    if (!strcmp(name, "vkCmdBindIndexBuffer")) {
-        return (void*)entry_vkCmdBindIndexBuffer;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers")) {
-        return (void*)entry_vkCmdBindVertexBuffers;
-    }
-    if (!strcmp(name, "vkCmdDraw")) {
-        return (void*)entry_vkCmdDraw;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexed")) {
-        return (void*)entry_vkCmdDrawIndexed;
-    }
-    if (!strcmp(name, "vkCmdDrawIndirect")) {
-        return (void*)entry_vkCmdDrawIndirect;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirect")) {
-        return (void*)entry_vkCmdDrawIndexedIndirect;
-    }
-    if (!strcmp(name, "vkCmdDispatch")) {
-        return (void*)entry_vkCmdDispatch;
-    }
-    if (!strcmp(name, "vkCmdDispatchIndirect")) {
-        return (void*)entry_vkCmdDispatchIndirect;
-    }
-    if (!strcmp(name, "vkCmdCopyBuffer")) {
-        return (void*)entry_vkCmdCopyBuffer;
-    }
-    if (!strcmp(name, "vkCmdCopyImage")) {
-        return (void*)entry_vkCmdCopyImage;
-    }
-    if (!strcmp(name, "vkCmdBlitImage")) {
-        return (void*)entry_vkCmdBlitImage;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage")) {
-        return (void*)entry_vkCmdCopyBufferToImage;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer")) {
-        return (void*)entry_vkCmdCopyImageToBuffer;
-    }
-    if (!strcmp(name, "vkCmdUpdateBuffer")) {
-        return (void*)entry_vkCmdUpdateBuffer;
-    }
-    if (!strcmp(name, "vkCmdFillBuffer")) {
-        return (void*)entry_vkCmdFillBuffer;
-    }
-    if (!strcmp(name, "vkCmdClearColorImage")) {
-        return (void*)entry_vkCmdClearColorImage;
-    }
-    if (!strcmp(name, "vkCmdClearDepthStencilImage")) {
-        return (void*)entry_vkCmdClearDepthStencilImage;
-    }
-    if (!strcmp(name, "vkCmdClearAttachments")) {
-        return (void*)entry_vkCmdClearAttachments;
-    }
-    if (!strcmp(name, "vkCmdResolveImage")) {
-        return (void*)entry_vkCmdResolveImage;
-    }
-    if (!strcmp(name, "vkCmdSetEvent")) {
-        return (void*)entry_vkCmdSetEvent;
-    }
-    if (!strcmp(name, "vkCmdResetEvent")) {
-        return (void*)entry_vkCmdResetEvent;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents")) {
-        return (void*)entry_vkCmdWaitEvents;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier")) {
-        return (void*)entry_vkCmdPipelineBarrier;
-    }
-    if (!strcmp(name, "vkCmdBeginQuery")) {
-        return (void*)entry_vkCmdBeginQuery;
-    }
-    if (!strcmp(name, "vkCmdEndQuery")) {
-        return (void*)entry_vkCmdEndQuery;
-    }
-    if (!strcmp(name, "vkCmdResetQueryPool")) {
-        return (void*)entry_vkCmdResetQueryPool;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp")) {
-        return (void*)entry_vkCmdWriteTimestamp;
-    }
-    if (!strcmp(name, "vkCmdCopyQueryPoolResults")) {
-        return (void*)entry_vkCmdCopyQueryPoolResults;
-    }
-    if (!strcmp(name, "vkCmdPushConstants")) {
-        return (void*)entry_vkCmdPushConstants;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass")) {
-        return (void*)entry_vkCmdBeginRenderPass;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass")) {
-        return (void*)entry_vkCmdNextSubpass;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass")) {
-        return (void*)entry_vkCmdEndRenderPass;
-    }
-    if (!strcmp(name, "vkCmdExecuteCommands")) {
-        return (void*)entry_vkCmdExecuteCommands;
-    }
+        case PROC_vkCreateInstance:
+            return (void*)entry_vkCreateInstance;
+        case PROC_vkDestroyInstance:
+            return (void*)entry_vkDestroyInstance;
+        case PROC_vkEnumeratePhysicalDevices:
+            return (void*)entry_vkEnumeratePhysicalDevices;
+        case PROC_vkGetPhysicalDeviceFeatures:
+            return (void*)entry_vkGetPhysicalDeviceFeatures;
+        case PROC_vkGetPhysicalDeviceFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceFormatProperties;
+        case PROC_vkGetPhysicalDeviceImageFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceImageFormatProperties;
+        case PROC_vkGetPhysicalDeviceProperties:
+            return (void*)entry_vkGetPhysicalDeviceProperties;
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties:
+            return (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties;
+        case PROC_vkGetPhysicalDeviceMemoryProperties:
+            return (void*)entry_vkGetPhysicalDeviceMemoryProperties;
+        case PROC_vkGetInstanceProcAddr:
+            return (void*)entry_vkGetInstanceProcAddr;
+        case PROC_vkGetDeviceProcAddr:
+            return (void*)entry_vkGetDeviceProcAddr;
+        case PROC_vkCreateDevice:
+            return (void*)entry_vkCreateDevice;
+        case PROC_vkDestroyDevice:
+            return (void*)entry_vkDestroyDevice;
+        case PROC_vkEnumerateInstanceExtensionProperties:
+            return (void*)entry_vkEnumerateInstanceExtensionProperties;
+        case PROC_vkEnumerateDeviceExtensionProperties:
+            return (void*)entry_vkEnumerateDeviceExtensionProperties;
+        case PROC_vkEnumerateInstanceLayerProperties:
+            return (void*)entry_vkEnumerateInstanceLayerProperties;
+        case PROC_vkEnumerateDeviceLayerProperties:
+            return (void*)entry_vkEnumerateDeviceLayerProperties;
+        case PROC_vkGetDeviceQueue:
+            return (void*)entry_vkGetDeviceQueue;
+        case PROC_vkQueueSubmit:
+            return (void*)entry_vkQueueSubmit;
+        case PROC_vkQueueWaitIdle:
+            return (void*)entry_vkQueueWaitIdle;
+        case PROC_vkDeviceWaitIdle:
+            return (void*)entry_vkDeviceWaitIdle;
+        case PROC_vkAllocateMemory:
+            return (void*)entry_vkAllocateMemory;
+        case PROC_vkFreeMemory:
+            return (void*)entry_vkFreeMemory;
+        case PROC_vkMapMemory:
+            return (void*)entry_vkMapMemory;
+        case PROC_vkUnmapMemory:
+            return (void*)entry_vkUnmapMemory;
+        case PROC_vkFlushMappedMemoryRanges:
+            return (void*)entry_vkFlushMappedMemoryRanges;
+        case PROC_vkInvalidateMappedMemoryRanges:
+            return (void*)entry_vkInvalidateMappedMemoryRanges;
+        case PROC_vkGetDeviceMemoryCommitment:
+            return (void*)entry_vkGetDeviceMemoryCommitment;
+        case PROC_vkBindBufferMemory:
+            return (void*)entry_vkBindBufferMemory;
+        case PROC_vkBindImageMemory:
+            return (void*)entry_vkBindImageMemory;
+        case PROC_vkGetBufferMemoryRequirements:
+            return (void*)entry_vkGetBufferMemoryRequirements;
+        case PROC_vkGetImageMemoryRequirements:
+            return (void*)entry_vkGetImageMemoryRequirements;
+        case PROC_vkGetImageSparseMemoryRequirements:
+            return (void*)entry_vkGetImageSparseMemoryRequirements;
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties;
+        case PROC_vkQueueBindSparse:
+            return (void*)entry_vkQueueBindSparse;
+        case PROC_vkCreateFence:
+            return (void*)entry_vkCreateFence;
+        case PROC_vkDestroyFence:
+            return (void*)entry_vkDestroyFence;
+        case PROC_vkResetFences:
+            return (void*)entry_vkResetFences;
+        case PROC_vkGetFenceStatus:
+            return (void*)entry_vkGetFenceStatus;
+        case PROC_vkWaitForFences:
+            return (void*)entry_vkWaitForFences;
+        case PROC_vkCreateSemaphore:
+            return (void*)entry_vkCreateSemaphore;
+        case PROC_vkDestroySemaphore:
+            return (void*)entry_vkDestroySemaphore;
+        case PROC_vkCreateEvent:
+            return (void*)entry_vkCreateEvent;
+        case PROC_vkDestroyEvent:
+            return (void*)entry_vkDestroyEvent;
+        case PROC_vkGetEventStatus:
+            return (void*)entry_vkGetEventStatus;
+        case PROC_vkSetEvent:
+            return (void*)entry_vkSetEvent;
+        case PROC_vkResetEvent:
+            return (void*)entry_vkResetEvent;
+        case PROC_vkCreateQueryPool:
+            return (void*)entry_vkCreateQueryPool;
+        case PROC_vkDestroyQueryPool:
+            return (void*)entry_vkDestroyQueryPool;
+        case PROC_vkGetQueryPoolResults:
+            return (void*)entry_vkGetQueryPoolResults;
+        case PROC_vkCreateBuffer:
+            return (void*)entry_vkCreateBuffer;
+        case PROC_vkDestroyBuffer:
+            return (void*)entry_vkDestroyBuffer;
+        case PROC_vkCreateBufferView:
+            return (void*)entry_vkCreateBufferView;
+        case PROC_vkDestroyBufferView:
+            return (void*)entry_vkDestroyBufferView;
+        case PROC_vkCreateImage:
+            return (void*)entry_vkCreateImage;
+        case PROC_vkDestroyImage:
+            return (void*)entry_vkDestroyImage;
+        case PROC_vkGetImageSubresourceLayout:
+            return (void*)entry_vkGetImageSubresourceLayout;
+        case PROC_vkCreateImageView:
+            return (void*)entry_vkCreateImageView;
+        case PROC_vkDestroyImageView:
+            return (void*)entry_vkDestroyImageView;
+        case PROC_vkCreateShaderModule:
+            return (void*)entry_vkCreateShaderModule;
+        case PROC_vkDestroyShaderModule:
+            return (void*)entry_vkDestroyShaderModule;
+        case PROC_vkCreatePipelineCache:
+            return (void*)entry_vkCreatePipelineCache;
+        case PROC_vkDestroyPipelineCache:
+            return (void*)entry_vkDestroyPipelineCache;
+        case PROC_vkGetPipelineCacheData:
+            return (void*)entry_vkGetPipelineCacheData;
+        case PROC_vkMergePipelineCaches:
+            return (void*)entry_vkMergePipelineCaches;
+        case PROC_vkCreateGraphicsPipelines:
+            return (void*)entry_vkCreateGraphicsPipelines;
+        case PROC_vkCreateComputePipelines:
+            return (void*)entry_vkCreateComputePipelines;
+        case PROC_vkDestroyPipeline:
+            return (void*)entry_vkDestroyPipeline;
+        case PROC_vkCreatePipelineLayout:
+            return (void*)entry_vkCreatePipelineLayout;
+        case PROC_vkDestroyPipelineLayout:
+            return (void*)entry_vkDestroyPipelineLayout;
+        case PROC_vkCreateSampler:
+            return (void*)entry_vkCreateSampler;
+        case PROC_vkDestroySampler:
+            return (void*)entry_vkDestroySampler;
+        case PROC_vkCreateDescriptorSetLayout:
+            return (void*)entry_vkCreateDescriptorSetLayout;
+        case PROC_vkDestroyDescriptorSetLayout:
+            return (void*)entry_vkDestroyDescriptorSetLayout;
+        case PROC_vkCreateDescriptorPool:
+            return (void*)entry_vkCreateDescriptorPool;
+        case PROC_vkDestroyDescriptorPool:
+            return (void*)entry_vkDestroyDescriptorPool;
+        case PROC_vkResetDescriptorPool:
+            return (void*)entry_vkResetDescriptorPool;
+        case PROC_vkAllocateDescriptorSets:
+            return (void*)entry_vkAllocateDescriptorSets;
+        case PROC_vkFreeDescriptorSets:
+            return (void*)entry_vkFreeDescriptorSets;
+        case PROC_vkUpdateDescriptorSets:
+            return (void*)entry_vkUpdateDescriptorSets;
+        case PROC_vkCreateFramebuffer:
+            return (void*)entry_vkCreateFramebuffer;
+        case PROC_vkDestroyFramebuffer:
+            return (void*)entry_vkDestroyFramebuffer;
+        case PROC_vkCreateRenderPass:
+            return (void*)entry_vkCreateRenderPass;
+        case PROC_vkDestroyRenderPass:
+            return (void*)entry_vkDestroyRenderPass;
+        case PROC_vkGetRenderAreaGranularity:
+            return (void*)entry_vkGetRenderAreaGranularity;
+        case PROC_vkCreateCommandPool:
+            return (void*)entry_vkCreateCommandPool;
+        case PROC_vkDestroyCommandPool:
+            return (void*)entry_vkDestroyCommandPool;
+        case PROC_vkResetCommandPool:
+            return (void*)entry_vkResetCommandPool;
+        case PROC_vkAllocateCommandBuffers:
+            return (void*)entry_vkAllocateCommandBuffers;
+        case PROC_vkFreeCommandBuffers:
+            return (void*)entry_vkFreeCommandBuffers;
+        case PROC_vkBeginCommandBuffer:
+            return (void*)entry_vkBeginCommandBuffer;
+        case PROC_vkEndCommandBuffer:
+            return (void*)entry_vkEndCommandBuffer;
+        case PROC_vkResetCommandBuffer:
+            return (void*)entry_vkResetCommandBuffer;
+        case PROC_vkCmdBindPipeline:
+            return (void*)entry_vkCmdBindPipeline;
+        case PROC_vkCmdSetViewport:
+            return (void*)entry_vkCmdSetViewport;
+        case PROC_vkCmdSetScissor:
+            return (void*)entry_vkCmdSetScissor;
+        case PROC_vkCmdSetLineWidth:
+            return (void*)entry_vkCmdSetLineWidth;
+        case PROC_vkCmdSetDepthBias:
+            return (void*)entry_vkCmdSetDepthBias;
+        case PROC_vkCmdSetBlendConstants:
+            return (void*)entry_vkCmdSetBlendConstants;
+        case PROC_vkCmdSetDepthBounds:
+            return (void*)entry_vkCmdSetDepthBounds;
+        case PROC_vkCmdSetStencilCompareMask:
+            return (void*)entry_vkCmdSetStencilCompareMask;
+        case PROC_vkCmdSetStencilWriteMask:
+            return (void*)entry_vkCmdSetStencilWriteMask;
+        case PROC_vkCmdSetStencilReference:
+            return (void*)entry_vkCmdSetStencilReference;
+        case PROC_vkCmdBindDescriptorSets:
+            return (void*)entry_vkCmdBindDescriptorSets;
+        case PROC_vkCmdBindIndexBuffer:
+            return (void*)entry_vkCmdBindIndexBuffer;
+        case PROC_vkCmdBindVertexBuffers:
+            return (void*)entry_vkCmdBindVertexBuffers;
+        case PROC_vkCmdDraw:
+            return (void*)entry_vkCmdDraw;
+        case PROC_vkCmdDrawIndexed:
+            return (void*)entry_vkCmdDrawIndexed;
+        case PROC_vkCmdDrawIndirect:
+            return (void*)entry_vkCmdDrawIndirect;
+        case PROC_vkCmdDrawIndexedIndirect:
+            return (void*)entry_vkCmdDrawIndexedIndirect;
+        case PROC_vkCmdDispatch:
+            return (void*)entry_vkCmdDispatch;
+        case PROC_vkCmdDispatchIndirect:
+            return (void*)entry_vkCmdDispatchIndirect;
+        case PROC_vkCmdCopyBuffer:
+            return (void*)entry_vkCmdCopyBuffer;
+        case PROC_vkCmdCopyImage:
+            return (void*)entry_vkCmdCopyImage;
+        case PROC_vkCmdBlitImage:
+            return (void*)entry_vkCmdBlitImage;
+        case PROC_vkCmdCopyBufferToImage:
+            return (void*)entry_vkCmdCopyBufferToImage;
+        case PROC_vkCmdCopyImageToBuffer:
+            return (void*)entry_vkCmdCopyImageToBuffer;
+        case PROC_vkCmdUpdateBuffer:
+            return (void*)entry_vkCmdUpdateBuffer;
+        case PROC_vkCmdFillBuffer:
+            return (void*)entry_vkCmdFillBuffer;
+        case PROC_vkCmdClearColorImage:
+            return (void*)entry_vkCmdClearColorImage;
+        case PROC_vkCmdClearDepthStencilImage:
+            return (void*)entry_vkCmdClearDepthStencilImage;
+        case PROC_vkCmdClearAttachments:
+            return (void*)entry_vkCmdClearAttachments;
+        case PROC_vkCmdResolveImage:
+            return (void*)entry_vkCmdResolveImage;
+        case PROC_vkCmdSetEvent:
+            return (void*)entry_vkCmdSetEvent;
+        case PROC_vkCmdResetEvent:
+            return (void*)entry_vkCmdResetEvent;
+        case PROC_vkCmdWaitEvents:
+            return (void*)entry_vkCmdWaitEvents;
+        case PROC_vkCmdPipelineBarrier:
+            return (void*)entry_vkCmdPipelineBarrier;
+        case PROC_vkCmdBeginQuery:
+            return (void*)entry_vkCmdBeginQuery;
+        case PROC_vkCmdEndQuery:
+            return (void*)entry_vkCmdEndQuery;
+        case PROC_vkCmdResetQueryPool:
+            return (void*)entry_vkCmdResetQueryPool;
+        case PROC_vkCmdWriteTimestamp:
+            return (void*)entry_vkCmdWriteTimestamp;
+        case PROC_vkCmdCopyQueryPoolResults:
+            return (void*)entry_vkCmdCopyQueryPoolResults;
+        case PROC_vkCmdPushConstants:
+            return (void*)entry_vkCmdPushConstants;
+        case PROC_vkCmdBeginRenderPass:
+            return (void*)entry_vkCmdBeginRenderPass;
+        case PROC_vkCmdNextSubpass:
+            return (void*)entry_vkCmdNextSubpass;
+        case PROC_vkCmdEndRenderPass:
+            return (void*)entry_vkCmdEndRenderPass;
+        case PROC_vkCmdExecuteCommands:
+            return (void*)entry_vkCmdExecuteCommands;
 #endif
 #ifdef VK_VERSION_1_1
-    if (!strcmp(name, "vkEnumerateInstanceVersion")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBindBufferMemory2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBindImageMemory2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupPeerMemoryFeatures")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDeviceMask")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDispatchBase")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceGroups")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetImageMemoryRequirements2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkTrimCommandPool")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceQueue2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateSamplerYcbcrConversion")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroySamplerYcbcrConversion")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateDescriptorUpdateTemplate")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorUpdateTemplate")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplate")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalBufferProperties")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalFenceProperties")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalSemaphoreProperties")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSupport")) {
-        return nullptr;
-    }
+        case PROC_vkEnumerateInstanceVersion:
+            return nullptr;
+        case PROC_vkBindBufferMemory2:
+            return nullptr;
+        case PROC_vkBindImageMemory2:
+            return nullptr;
+        case PROC_vkGetDeviceGroupPeerMemoryFeatures:
+            return nullptr;
+        case PROC_vkCmdSetDeviceMask:
+            return nullptr;
+        case PROC_vkCmdDispatchBase:
+            return nullptr;
+        case PROC_vkEnumeratePhysicalDeviceGroups:
+            return nullptr;
+        case PROC_vkGetImageMemoryRequirements2:
+            return nullptr;
+        case PROC_vkGetBufferMemoryRequirements2:
+            return nullptr;
+        case PROC_vkGetImageSparseMemoryRequirements2:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceFeatures2:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceProperties2:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceFormatProperties2:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceImageFormatProperties2:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties2:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceMemoryProperties2:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties2:
+            return nullptr;
+        case PROC_vkTrimCommandPool:
+            return nullptr;
+        case PROC_vkGetDeviceQueue2:
+            return nullptr;
+        case PROC_vkCreateSamplerYcbcrConversion:
+            return nullptr;
+        case PROC_vkDestroySamplerYcbcrConversion:
+            return nullptr;
+        case PROC_vkCreateDescriptorUpdateTemplate:
+            return nullptr;
+        case PROC_vkDestroyDescriptorUpdateTemplate:
+            return nullptr;
+        case PROC_vkUpdateDescriptorSetWithTemplate:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceExternalBufferProperties:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceExternalFenceProperties:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceExternalSemaphoreProperties:
+            return nullptr;
+        case PROC_vkGetDescriptorSetLayoutSupport:
+            return nullptr;
 #endif
 #ifdef VK_VERSION_1_2
-    if (!strcmp(name, "vkCmdDrawIndirectCount")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCount")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateRenderPass2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkResetQueryPool")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetSemaphoreCounterValue")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkWaitSemaphores")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkSignalSemaphore")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferDeviceAddress")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureAddress")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryOpaqueCaptureAddress")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDrawIndirectCount:
+            return nullptr;
+        case PROC_vkCmdDrawIndexedIndirectCount:
+            return nullptr;
+        case PROC_vkCreateRenderPass2:
+            return nullptr;
+        case PROC_vkCmdBeginRenderPass2:
+            return nullptr;
+        case PROC_vkCmdNextSubpass2:
+            return nullptr;
+        case PROC_vkCmdEndRenderPass2:
+            return nullptr;
+        case PROC_vkResetQueryPool:
+            return nullptr;
+        case PROC_vkGetSemaphoreCounterValue:
+            return nullptr;
+        case PROC_vkWaitSemaphores:
+            return nullptr;
+        case PROC_vkSignalSemaphore:
+            return nullptr;
+        case PROC_vkGetBufferDeviceAddress:
+            return nullptr;
+        case PROC_vkGetBufferOpaqueCaptureAddress:
+            return nullptr;
+        case PROC_vkGetDeviceMemoryOpaqueCaptureAddress:
+            return nullptr;
 #endif
 #ifdef VK_VERSION_1_3
-    if (!strcmp(name, "vkGetPhysicalDeviceToolProperties")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreatePrivateDataSlot")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyPrivateDataSlot")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkSetPrivateData")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPrivateData")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetEvent2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdResetEvent2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmit2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyBuffer2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImage2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBlitImage2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdResolveImage2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginRendering")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRendering")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCullMode")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetFrontFace")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveTopology")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWithCount")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetScissorWithCount")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers2")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthTestEnable")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthWriteEnable")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthCompareOp")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBoundsTestEnable")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilTestEnable")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilOp")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizerDiscardEnable")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBiasEnable")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveRestartEnable")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceBufferMemoryRequirements")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceImageMemoryRequirements")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceImageSparseMemoryRequirements")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceToolProperties:
+            return nullptr;
+        case PROC_vkCreatePrivateDataSlot:
+            return nullptr;
+        case PROC_vkDestroyPrivateDataSlot:
+            return nullptr;
+        case PROC_vkSetPrivateData:
+            return nullptr;
+        case PROC_vkGetPrivateData:
+            return nullptr;
+        case PROC_vkCmdSetEvent2:
+            return nullptr;
+        case PROC_vkCmdResetEvent2:
+            return nullptr;
+        case PROC_vkCmdWaitEvents2:
+            return nullptr;
+        case PROC_vkCmdPipelineBarrier2:
+            return nullptr;
+        case PROC_vkCmdWriteTimestamp2:
+            return nullptr;
+        case PROC_vkQueueSubmit2:
+            return nullptr;
+        case PROC_vkCmdCopyBuffer2:
+            return nullptr;
+        case PROC_vkCmdCopyImage2:
+            return nullptr;
+        case PROC_vkCmdCopyBufferToImage2:
+            return nullptr;
+        case PROC_vkCmdCopyImageToBuffer2:
+            return nullptr;
+        case PROC_vkCmdBlitImage2:
+            return nullptr;
+        case PROC_vkCmdResolveImage2:
+            return nullptr;
+        case PROC_vkCmdBeginRendering:
+            return nullptr;
+        case PROC_vkCmdEndRendering:
+            return nullptr;
+        case PROC_vkCmdSetCullMode:
+            return nullptr;
+        case PROC_vkCmdSetFrontFace:
+            return nullptr;
+        case PROC_vkCmdSetPrimitiveTopology:
+            return nullptr;
+        case PROC_vkCmdSetViewportWithCount:
+            return nullptr;
+        case PROC_vkCmdSetScissorWithCount:
+            return nullptr;
+        case PROC_vkCmdBindVertexBuffers2:
+            return nullptr;
+        case PROC_vkCmdSetDepthTestEnable:
+            return nullptr;
+        case PROC_vkCmdSetDepthWriteEnable:
+            return nullptr;
+        case PROC_vkCmdSetDepthCompareOp:
+            return nullptr;
+        case PROC_vkCmdSetDepthBoundsTestEnable:
+            return nullptr;
+        case PROC_vkCmdSetStencilTestEnable:
+            return nullptr;
+        case PROC_vkCmdSetStencilOp:
+            return nullptr;
+        case PROC_vkCmdSetRasterizerDiscardEnable:
+            return nullptr;
+        case PROC_vkCmdSetDepthBiasEnable:
+            return nullptr;
+        case PROC_vkCmdSetPrimitiveRestartEnable:
+            return nullptr;
+        case PROC_vkGetDeviceBufferMemoryRequirements:
+            return nullptr;
+        case PROC_vkGetDeviceImageMemoryRequirements:
+            return nullptr;
+        case PROC_vkGetDeviceImageSparseMemoryRequirements:
+            return nullptr;
 #endif
 #ifdef VK_KHR_surface
-    if (!strcmp(name, "vkDestroySurfaceKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceSupportKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceFormatsKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfacePresentModesKHR")) {
-        return nullptr;
-    }
+        case PROC_vkDestroySurfaceKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceSurfaceSupportKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilitiesKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceSurfaceFormatsKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceSurfacePresentModesKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_swapchain
-    if (!strcmp(name, "vkCreateSwapchainKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroySwapchainKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetSwapchainImagesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkAcquireNextImageKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueuePresentKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupPresentCapabilitiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupSurfacePresentModesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDevicePresentRectanglesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkAcquireNextImage2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateSwapchainKHR:
+            return nullptr;
+        case PROC_vkDestroySwapchainKHR:
+            return nullptr;
+        case PROC_vkGetSwapchainImagesKHR:
+            return nullptr;
+        case PROC_vkAcquireNextImageKHR:
+            return nullptr;
+        case PROC_vkQueuePresentKHR:
+            return nullptr;
+        case PROC_vkGetDeviceGroupPresentCapabilitiesKHR:
+            return nullptr;
+        case PROC_vkGetDeviceGroupSurfacePresentModesKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDevicePresentRectanglesKHR:
+            return nullptr;
+        case PROC_vkAcquireNextImage2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_display
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPropertiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneSupportedDisplaysKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayModePropertiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateDisplayModeKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneCapabilitiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateDisplayPlaneSurfaceKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceDisplayPropertiesKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceDisplayPlanePropertiesKHR:
+            return nullptr;
+        case PROC_vkGetDisplayPlaneSupportedDisplaysKHR:
+            return nullptr;
+        case PROC_vkGetDisplayModePropertiesKHR:
+            return nullptr;
+        case PROC_vkCreateDisplayModeKHR:
+            return nullptr;
+        case PROC_vkGetDisplayPlaneCapabilitiesKHR:
+            return nullptr;
+        case PROC_vkCreateDisplayPlaneSurfaceKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_display_swapchain
-    if (!strcmp(name, "vkCreateSharedSwapchainsKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateSharedSwapchainsKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_xlib_surface
-    if (!strcmp(name, "vkCreateXlibSurfaceKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceXlibPresentationSupportKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateXlibSurfaceKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceXlibPresentationSupportKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_xcb_surface
-    if (!strcmp(name, "vkCreateXcbSurfaceKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceXcbPresentationSupportKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateXcbSurfaceKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceXcbPresentationSupportKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_wayland_surface
-    if (!strcmp(name, "vkCreateWaylandSurfaceKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceWaylandPresentationSupportKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateWaylandSurfaceKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceWaylandPresentationSupportKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_android_surface
-    if (!strcmp(name, "vkCreateAndroidSurfaceKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateAndroidSurfaceKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_win32_surface
-    if (!strcmp(name, "vkCreateWin32SurfaceKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceWin32PresentationSupportKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateWin32SurfaceKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceWin32PresentationSupportKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_video_queue
-    if (!strcmp(name, "vkGetPhysicalDeviceVideoCapabilitiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceVideoFormatPropertiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateVideoSessionKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyVideoSessionKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetVideoSessionMemoryRequirementsKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBindVideoSessionMemoryKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateVideoSessionParametersKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkUpdateVideoSessionParametersKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyVideoSessionParametersKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginVideoCodingKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndVideoCodingKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdControlVideoCodingKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceVideoCapabilitiesKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceVideoFormatPropertiesKHR:
+            return nullptr;
+        case PROC_vkCreateVideoSessionKHR:
+            return nullptr;
+        case PROC_vkDestroyVideoSessionKHR:
+            return nullptr;
+        case PROC_vkGetVideoSessionMemoryRequirementsKHR:
+            return nullptr;
+        case PROC_vkBindVideoSessionMemoryKHR:
+            return nullptr;
+        case PROC_vkCreateVideoSessionParametersKHR:
+            return nullptr;
+        case PROC_vkUpdateVideoSessionParametersKHR:
+            return nullptr;
+        case PROC_vkDestroyVideoSessionParametersKHR:
+            return nullptr;
+        case PROC_vkCmdBeginVideoCodingKHR:
+            return nullptr;
+        case PROC_vkCmdEndVideoCodingKHR:
+            return nullptr;
+        case PROC_vkCmdControlVideoCodingKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_video_decode_queue
-    if (!strcmp(name, "vkCmdDecodeVideoKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDecodeVideoKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_dynamic_rendering
-    if (!strcmp(name, "vkCmdBeginRenderingKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRenderingKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCmdBeginRenderingKHR:
+            return nullptr;
+        case PROC_vkCmdEndRenderingKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_get_physical_device_properties2
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceFeatures2KHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceProperties2KHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceFormatProperties2KHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceImageFormatProperties2KHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceMemoryProperties2KHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_device_group
-    if (!strcmp(name, "vkGetDeviceGroupPeerMemoryFeaturesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDeviceMaskKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDispatchBaseKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetDeviceGroupPeerMemoryFeaturesKHR:
+            return nullptr;
+        case PROC_vkCmdSetDeviceMaskKHR:
+            return nullptr;
+        case PROC_vkCmdDispatchBaseKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_maintenance1
-    if (!strcmp(name, "vkTrimCommandPoolKHR")) {
-        return nullptr;
-    }
+        case PROC_vkTrimCommandPoolKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_device_group_creation
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceGroupsKHR")) {
-        return nullptr;
-    }
+        case PROC_vkEnumeratePhysicalDeviceGroupsKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_memory_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalBufferPropertiesKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalBufferPropertiesKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_memory_win32
-    if (!strcmp(name, "vkGetMemoryWin32HandleKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryWin32HandlePropertiesKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetMemoryWin32HandleKHR:
+            return nullptr;
+        case PROC_vkGetMemoryWin32HandlePropertiesKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_memory_fd
-    if (!strcmp(name, "vkGetMemoryFdKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryFdPropertiesKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetMemoryFdKHR:
+            return nullptr;
+        case PROC_vkGetMemoryFdPropertiesKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_semaphore_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_semaphore_win32
-    if (!strcmp(name, "vkImportSemaphoreWin32HandleKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetSemaphoreWin32HandleKHR")) {
-        return nullptr;
-    }
+        case PROC_vkImportSemaphoreWin32HandleKHR:
+            return nullptr;
+        case PROC_vkGetSemaphoreWin32HandleKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_semaphore_fd
-    if (!strcmp(name, "vkImportSemaphoreFdKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetSemaphoreFdKHR")) {
-        return nullptr;
-    }
+        case PROC_vkImportSemaphoreFdKHR:
+            return nullptr;
+        case PROC_vkGetSemaphoreFdKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_push_descriptor
-    if (!strcmp(name, "vkCmdPushDescriptorSetKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdPushDescriptorSetWithTemplateKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCmdPushDescriptorSetKHR:
+            return nullptr;
+        case PROC_vkCmdPushDescriptorSetWithTemplateKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_descriptor_update_template
-    if (!strcmp(name, "vkCreateDescriptorUpdateTemplateKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorUpdateTemplateKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateDescriptorUpdateTemplateKHR:
+            return nullptr;
+        case PROC_vkDestroyDescriptorUpdateTemplateKHR:
+            return nullptr;
+        case PROC_vkUpdateDescriptorSetWithTemplateKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_create_renderpass2
-    if (!strcmp(name, "vkCreateRenderPass2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateRenderPass2KHR:
+            return nullptr;
+        case PROC_vkCmdBeginRenderPass2KHR:
+            return nullptr;
+        case PROC_vkCmdNextSubpass2KHR:
+            return nullptr;
+        case PROC_vkCmdEndRenderPass2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_shared_presentable_image
-    if (!strcmp(name, "vkGetSwapchainStatusKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetSwapchainStatusKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_fence_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalFencePropertiesKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalFencePropertiesKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_fence_win32
-    if (!strcmp(name, "vkImportFenceWin32HandleKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetFenceWin32HandleKHR")) {
-        return nullptr;
-    }
+        case PROC_vkImportFenceWin32HandleKHR:
+            return nullptr;
+        case PROC_vkGetFenceWin32HandleKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_external_fence_fd
-    if (!strcmp(name, "vkImportFenceFdKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetFenceFdKHR")) {
-        return nullptr;
-    }
+        case PROC_vkImportFenceFdKHR:
+            return nullptr;
+        case PROC_vkGetFenceFdKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_performance_query
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkAcquireProfilingLockKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkReleaseProfilingLockKHR")) {
-        return nullptr;
-    }
+        case PROC_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR:
+            return nullptr;
+        case PROC_vkAcquireProfilingLockKHR:
+            return nullptr;
+        case PROC_vkReleaseProfilingLockKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_get_surface_capabilities2
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilities2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceFormats2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilities2KHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceSurfaceFormats2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_get_display_properties2
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayProperties2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayModeProperties2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneCapabilities2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceDisplayProperties2KHR:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceDisplayPlaneProperties2KHR:
+            return nullptr;
+        case PROC_vkGetDisplayModeProperties2KHR:
+            return nullptr;
+        case PROC_vkGetDisplayPlaneCapabilities2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_get_memory_requirements2
-    if (!strcmp(name, "vkGetImageMemoryRequirements2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetImageMemoryRequirements2KHR:
+            return nullptr;
+        case PROC_vkGetBufferMemoryRequirements2KHR:
+            return nullptr;
+        case PROC_vkGetImageSparseMemoryRequirements2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_sampler_ycbcr_conversion
-    if (!strcmp(name, "vkCreateSamplerYcbcrConversionKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroySamplerYcbcrConversionKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateSamplerYcbcrConversionKHR:
+            return nullptr;
+        case PROC_vkDestroySamplerYcbcrConversionKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_bind_memory2
-    if (!strcmp(name, "vkBindBufferMemory2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBindImageMemory2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkBindBufferMemory2KHR:
+            return nullptr;
+        case PROC_vkBindImageMemory2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_maintenance3
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSupportKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetDescriptorSetLayoutSupportKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_draw_indirect_count
-    if (!strcmp(name, "vkCmdDrawIndirectCountKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCountKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDrawIndirectCountKHR:
+            return nullptr;
+        case PROC_vkCmdDrawIndexedIndirectCountKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_timeline_semaphore
-    if (!strcmp(name, "vkGetSemaphoreCounterValueKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkWaitSemaphoresKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkSignalSemaphoreKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetSemaphoreCounterValueKHR:
+            return nullptr;
+        case PROC_vkWaitSemaphoresKHR:
+            return nullptr;
+        case PROC_vkSignalSemaphoreKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_fragment_shading_rate
-    if (!strcmp(name, "vkGetPhysicalDeviceFragmentShadingRatesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetFragmentShadingRateKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceFragmentShadingRatesKHR:
+            return nullptr;
+        case PROC_vkCmdSetFragmentShadingRateKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_present_wait
-    if (!strcmp(name, "vkWaitForPresentKHR")) {
-        return nullptr;
-    }
+        case PROC_vkWaitForPresentKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_buffer_device_address
-    if (!strcmp(name, "vkGetBufferDeviceAddressKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureAddressKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryOpaqueCaptureAddressKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetBufferDeviceAddressKHR:
+            return nullptr;
+        case PROC_vkGetBufferOpaqueCaptureAddressKHR:
+            return nullptr;
+        case PROC_vkGetDeviceMemoryOpaqueCaptureAddressKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_deferred_host_operations
-    if (!strcmp(name, "vkCreateDeferredOperationKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDeferredOperationKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeferredOperationMaxConcurrencyKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeferredOperationResultKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDeferredOperationJoinKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateDeferredOperationKHR:
+            return nullptr;
+        case PROC_vkDestroyDeferredOperationKHR:
+            return nullptr;
+        case PROC_vkGetDeferredOperationMaxConcurrencyKHR:
+            return nullptr;
+        case PROC_vkGetDeferredOperationResultKHR:
+            return nullptr;
+        case PROC_vkDeferredOperationJoinKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_pipeline_executable_properties
-    if (!strcmp(name, "vkGetPipelineExecutablePropertiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPipelineExecutableStatisticsKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPipelineExecutableInternalRepresentationsKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetPipelineExecutablePropertiesKHR:
+            return nullptr;
+        case PROC_vkGetPipelineExecutableStatisticsKHR:
+            return nullptr;
+        case PROC_vkGetPipelineExecutableInternalRepresentationsKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_map_memory2
-    if (!strcmp(name, "vkMapMemory2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkUnmapMemory2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkMapMemory2KHR:
+            return nullptr;
+        case PROC_vkUnmapMemory2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_video_encode_queue
-    if (!strcmp(name, "vkCmdEncodeVideoKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCmdEncodeVideoKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_synchronization2
-    if (!strcmp(name, "vkCmdSetEvent2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdResetEvent2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmit2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteBufferMarker2AMD")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetQueueCheckpointData2NV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetEvent2KHR:
+            return nullptr;
+        case PROC_vkCmdResetEvent2KHR:
+            return nullptr;
+        case PROC_vkCmdWaitEvents2KHR:
+            return nullptr;
+        case PROC_vkCmdPipelineBarrier2KHR:
+            return nullptr;
+        case PROC_vkCmdWriteTimestamp2KHR:
+            return nullptr;
+        case PROC_vkQueueSubmit2KHR:
+            return nullptr;
+        case PROC_vkCmdWriteBufferMarker2AMD:
+            return nullptr;
+        case PROC_vkGetQueueCheckpointData2NV:
+            return nullptr;
 #endif
 #ifdef VK_KHR_copy_commands2
-    if (!strcmp(name, "vkCmdCopyBuffer2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImage2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBlitImage2KHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdResolveImage2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkCmdCopyBuffer2KHR:
+            return nullptr;
+        case PROC_vkCmdCopyImage2KHR:
+            return nullptr;
+        case PROC_vkCmdCopyBufferToImage2KHR:
+            return nullptr;
+        case PROC_vkCmdCopyImageToBuffer2KHR:
+            return nullptr;
+        case PROC_vkCmdBlitImage2KHR:
+            return nullptr;
+        case PROC_vkCmdResolveImage2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_ray_tracing_maintenance1
-    if (!strcmp(name, "vkCmdTraceRaysIndirect2KHR")) {
-        return nullptr;
-    }
+        case PROC_vkCmdTraceRaysIndirect2KHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_maintenance4
-    if (!strcmp(name, "vkGetDeviceBufferMemoryRequirementsKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceImageMemoryRequirementsKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceImageSparseMemoryRequirementsKHR")) {
-        return nullptr;
-    }
+        case PROC_vkGetDeviceBufferMemoryRequirementsKHR:
+            return nullptr;
+        case PROC_vkGetDeviceImageMemoryRequirementsKHR:
+            return nullptr;
+        case PROC_vkGetDeviceImageSparseMemoryRequirementsKHR:
+            return nullptr;
 #endif
 #ifdef VK_ANDROID_native_buffer
-    if (!strcmp(name, "vkGetSwapchainGrallocUsageANDROID")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkAcquireImageANDROID")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueSignalReleaseImageANDROID")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetSwapchainGrallocUsage2ANDROID")) {
-        return nullptr;
-    }
+        case PROC_vkGetSwapchainGrallocUsageANDROID:
+            return nullptr;
+        case PROC_vkAcquireImageANDROID:
+            return nullptr;
+        case PROC_vkQueueSignalReleaseImageANDROID:
+            return nullptr;
+        case PROC_vkGetSwapchainGrallocUsage2ANDROID:
+            return nullptr;
 #endif
 #ifdef VK_EXT_debug_report
-    if (!strcmp(name, "vkCreateDebugReportCallbackEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDebugReportCallbackEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDebugReportMessageEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCreateDebugReportCallbackEXT:
+            return nullptr;
+        case PROC_vkDestroyDebugReportCallbackEXT:
+            return nullptr;
+        case PROC_vkDebugReportMessageEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_debug_marker
-    if (!strcmp(name, "vkDebugMarkerSetObjectTagEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDebugMarkerSetObjectNameEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerBeginEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerEndEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerInsertEXT")) {
-        return nullptr;
-    }
+        case PROC_vkDebugMarkerSetObjectTagEXT:
+            return nullptr;
+        case PROC_vkDebugMarkerSetObjectNameEXT:
+            return nullptr;
+        case PROC_vkCmdDebugMarkerBeginEXT:
+            return nullptr;
+        case PROC_vkCmdDebugMarkerEndEXT:
+            return nullptr;
+        case PROC_vkCmdDebugMarkerInsertEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_transform_feedback
-    if (!strcmp(name, "vkCmdBindTransformFeedbackBuffersEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginTransformFeedbackEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndTransformFeedbackEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginQueryIndexedEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndQueryIndexedEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndirectByteCountEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdBindTransformFeedbackBuffersEXT:
+            return nullptr;
+        case PROC_vkCmdBeginTransformFeedbackEXT:
+            return nullptr;
+        case PROC_vkCmdEndTransformFeedbackEXT:
+            return nullptr;
+        case PROC_vkCmdBeginQueryIndexedEXT:
+            return nullptr;
+        case PROC_vkCmdEndQueryIndexedEXT:
+            return nullptr;
+        case PROC_vkCmdDrawIndirectByteCountEXT:
+            return nullptr;
 #endif
 #ifdef VK_NVX_binary_import
-    if (!strcmp(name, "vkCreateCuModuleNVX")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateCuFunctionNVX")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyCuModuleNVX")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyCuFunctionNVX")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCuLaunchKernelNVX")) {
-        return nullptr;
-    }
+        case PROC_vkCreateCuModuleNVX:
+            return nullptr;
+        case PROC_vkCreateCuFunctionNVX:
+            return nullptr;
+        case PROC_vkDestroyCuModuleNVX:
+            return nullptr;
+        case PROC_vkDestroyCuFunctionNVX:
+            return nullptr;
+        case PROC_vkCmdCuLaunchKernelNVX:
+            return nullptr;
 #endif
 #ifdef VK_NVX_image_view_handle
-    if (!strcmp(name, "vkGetImageViewHandleNVX")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetImageViewAddressNVX")) {
-        return nullptr;
-    }
+        case PROC_vkGetImageViewHandleNVX:
+            return nullptr;
+        case PROC_vkGetImageViewAddressNVX:
+            return nullptr;
 #endif
 #ifdef VK_AMD_draw_indirect_count
-    if (!strcmp(name, "vkCmdDrawIndirectCountAMD")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCountAMD")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDrawIndirectCountAMD:
+            return nullptr;
+        case PROC_vkCmdDrawIndexedIndirectCountAMD:
+            return nullptr;
 #endif
 #ifdef VK_AMD_shader_info
-    if (!strcmp(name, "vkGetShaderInfoAMD")) {
-        return nullptr;
-    }
+        case PROC_vkGetShaderInfoAMD:
+            return nullptr;
 #endif
 #ifdef VK_GGP_stream_descriptor_surface
-    if (!strcmp(name, "vkCreateStreamDescriptorSurfaceGGP")) {
-        return nullptr;
-    }
+        case PROC_vkCreateStreamDescriptorSurfaceGGP:
+            return nullptr;
 #endif
 #ifdef VK_NV_external_memory_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalImageFormatPropertiesNV:
+            return nullptr;
 #endif
 #ifdef VK_NV_external_memory_win32
-    if (!strcmp(name, "vkGetMemoryWin32HandleNV")) {
-        return nullptr;
-    }
+        case PROC_vkGetMemoryWin32HandleNV:
+            return nullptr;
 #endif
 #ifdef VK_NN_vi_surface
-    if (!strcmp(name, "vkCreateViSurfaceNN")) {
-        return nullptr;
-    }
+        case PROC_vkCreateViSurfaceNN:
+            return nullptr;
 #endif
 #ifdef VK_EXT_conditional_rendering
-    if (!strcmp(name, "vkCmdBeginConditionalRenderingEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndConditionalRenderingEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdBeginConditionalRenderingEXT:
+            return nullptr;
+        case PROC_vkCmdEndConditionalRenderingEXT:
+            return nullptr;
 #endif
 #ifdef VK_NV_clip_space_w_scaling
-    if (!strcmp(name, "vkCmdSetViewportWScalingNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetViewportWScalingNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_direct_mode_display
-    if (!strcmp(name, "vkReleaseDisplayEXT")) {
-        return nullptr;
-    }
+        case PROC_vkReleaseDisplayEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_acquire_xlib_display
-    if (!strcmp(name, "vkAcquireXlibDisplayEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetRandROutputDisplayEXT")) {
-        return nullptr;
-    }
+        case PROC_vkAcquireXlibDisplayEXT:
+            return nullptr;
+        case PROC_vkGetRandROutputDisplayEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_display_surface_counter
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilities2EXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilities2EXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_display_control
-    if (!strcmp(name, "vkDisplayPowerControlEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkRegisterDeviceEventEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkRegisterDisplayEventEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetSwapchainCounterEXT")) {
-        return nullptr;
-    }
+        case PROC_vkDisplayPowerControlEXT:
+            return nullptr;
+        case PROC_vkRegisterDeviceEventEXT:
+            return nullptr;
+        case PROC_vkRegisterDisplayEventEXT:
+            return nullptr;
+        case PROC_vkGetSwapchainCounterEXT:
+            return nullptr;
 #endif
 #ifdef VK_GOOGLE_display_timing
-    if (!strcmp(name, "vkGetRefreshCycleDurationGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPastPresentationTimingGOOGLE")) {
-        return nullptr;
-    }
+        case PROC_vkGetRefreshCycleDurationGOOGLE:
+            return nullptr;
+        case PROC_vkGetPastPresentationTimingGOOGLE:
+            return nullptr;
 #endif
 #ifdef VK_EXT_discard_rectangles
-    if (!strcmp(name, "vkCmdSetDiscardRectangleEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDiscardRectangleEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDiscardRectangleModeEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetDiscardRectangleEXT:
+            return nullptr;
+        case PROC_vkCmdSetDiscardRectangleEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetDiscardRectangleModeEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_hdr_metadata
-    if (!strcmp(name, "vkSetHdrMetadataEXT")) {
-        return nullptr;
-    }
+        case PROC_vkSetHdrMetadataEXT:
+            return nullptr;
 #endif
 #ifdef VK_MVK_ios_surface
-    if (!strcmp(name, "vkCreateIOSSurfaceMVK")) {
-        return nullptr;
-    }
+        case PROC_vkCreateIOSSurfaceMVK:
+            return nullptr;
 #endif
 #ifdef VK_MVK_macos_surface
-    if (!strcmp(name, "vkCreateMacOSSurfaceMVK")) {
-        return nullptr;
-    }
+        case PROC_vkCreateMacOSSurfaceMVK:
+            return nullptr;
 #endif
 #ifdef VK_EXT_debug_utils
-    if (!strcmp(name, "vkSetDebugUtilsObjectNameEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkSetDebugUtilsObjectTagEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueBeginDebugUtilsLabelEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueEndDebugUtilsLabelEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueInsertDebugUtilsLabelEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginDebugUtilsLabelEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndDebugUtilsLabelEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdInsertDebugUtilsLabelEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateDebugUtilsMessengerEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDebugUtilsMessengerEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkSubmitDebugUtilsMessageEXT")) {
-        return nullptr;
-    }
+        case PROC_vkSetDebugUtilsObjectNameEXT:
+            return nullptr;
+        case PROC_vkSetDebugUtilsObjectTagEXT:
+            return nullptr;
+        case PROC_vkQueueBeginDebugUtilsLabelEXT:
+            return nullptr;
+        case PROC_vkQueueEndDebugUtilsLabelEXT:
+            return nullptr;
+        case PROC_vkQueueInsertDebugUtilsLabelEXT:
+            return nullptr;
+        case PROC_vkCmdBeginDebugUtilsLabelEXT:
+            return nullptr;
+        case PROC_vkCmdEndDebugUtilsLabelEXT:
+            return nullptr;
+        case PROC_vkCmdInsertDebugUtilsLabelEXT:
+            return nullptr;
+        case PROC_vkCreateDebugUtilsMessengerEXT:
+            return nullptr;
+        case PROC_vkDestroyDebugUtilsMessengerEXT:
+            return nullptr;
+        case PROC_vkSubmitDebugUtilsMessageEXT:
+            return nullptr;
 #endif
 #ifdef VK_ANDROID_external_memory_android_hardware_buffer
-    if (!strcmp(name, "vkGetAndroidHardwareBufferPropertiesANDROID")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryAndroidHardwareBufferANDROID")) {
-        return nullptr;
-    }
+        case PROC_vkGetAndroidHardwareBufferPropertiesANDROID:
+            return nullptr;
+        case PROC_vkGetMemoryAndroidHardwareBufferANDROID:
+            return nullptr;
 #endif
 #ifdef VK_EXT_sample_locations
-    if (!strcmp(name, "vkCmdSetSampleLocationsEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMultisamplePropertiesEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetSampleLocationsEXT:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceMultisamplePropertiesEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_image_drm_format_modifier
-    if (!strcmp(name, "vkGetImageDrmFormatModifierPropertiesEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetImageDrmFormatModifierPropertiesEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_validation_cache
-    if (!strcmp(name, "vkCreateValidationCacheEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyValidationCacheEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkMergeValidationCachesEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetValidationCacheDataEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCreateValidationCacheEXT:
+            return nullptr;
+        case PROC_vkDestroyValidationCacheEXT:
+            return nullptr;
+        case PROC_vkMergeValidationCachesEXT:
+            return nullptr;
+        case PROC_vkGetValidationCacheDataEXT:
+            return nullptr;
 #endif
 #ifdef VK_NV_shading_rate_image
-    if (!strcmp(name, "vkCmdBindShadingRateImageNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportShadingRatePaletteNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoarseSampleOrderNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdBindShadingRateImageNV:
+            return nullptr;
+        case PROC_vkCmdSetViewportShadingRatePaletteNV:
+            return nullptr;
+        case PROC_vkCmdSetCoarseSampleOrderNV:
+            return nullptr;
 #endif
 #ifdef VK_NV_ray_tracing
-    if (!strcmp(name, "vkCreateAccelerationStructureNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyAccelerationStructureNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureMemoryRequirementsNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBindAccelerationStructureMemoryNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructureNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdTraceRaysNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateRayTracingPipelinesNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupHandlesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupHandlesNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureHandleNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteAccelerationStructuresPropertiesNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCompileDeferredNV")) {
-        return nullptr;
-    }
+        case PROC_vkCreateAccelerationStructureNV:
+            return nullptr;
+        case PROC_vkDestroyAccelerationStructureNV:
+            return nullptr;
+        case PROC_vkGetAccelerationStructureMemoryRequirementsNV:
+            return nullptr;
+        case PROC_vkBindAccelerationStructureMemoryNV:
+            return nullptr;
+        case PROC_vkCmdBuildAccelerationStructureNV:
+            return nullptr;
+        case PROC_vkCmdCopyAccelerationStructureNV:
+            return nullptr;
+        case PROC_vkCmdTraceRaysNV:
+            return nullptr;
+        case PROC_vkCreateRayTracingPipelinesNV:
+            return nullptr;
+        case PROC_vkGetRayTracingShaderGroupHandlesKHR:
+            return nullptr;
+        case PROC_vkGetRayTracingShaderGroupHandlesNV:
+            return nullptr;
+        case PROC_vkGetAccelerationStructureHandleNV:
+            return nullptr;
+        case PROC_vkCmdWriteAccelerationStructuresPropertiesNV:
+            return nullptr;
+        case PROC_vkCompileDeferredNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_external_memory_host
-    if (!strcmp(name, "vkGetMemoryHostPointerPropertiesEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetMemoryHostPointerPropertiesEXT:
+            return nullptr;
 #endif
 #ifdef VK_AMD_buffer_marker
-    if (!strcmp(name, "vkCmdWriteBufferMarkerAMD")) {
-        return nullptr;
-    }
+        case PROC_vkCmdWriteBufferMarkerAMD:
+            return nullptr;
 #endif
 #ifdef VK_EXT_calibrated_timestamps
-    if (!strcmp(name, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetCalibratedTimestampsEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT:
+            return nullptr;
+        case PROC_vkGetCalibratedTimestampsEXT:
+            return nullptr;
 #endif
 #ifdef VK_NV_mesh_shader
-    if (!strcmp(name, "vkCmdDrawMeshTasksNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectCountNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDrawMeshTasksNV:
+            return nullptr;
+        case PROC_vkCmdDrawMeshTasksIndirectNV:
+            return nullptr;
+        case PROC_vkCmdDrawMeshTasksIndirectCountNV:
+            return nullptr;
 #endif
 #ifdef VK_NV_scissor_exclusive
-    if (!strcmp(name, "vkCmdSetExclusiveScissorEnableNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetExclusiveScissorNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetExclusiveScissorEnableNV:
+            return nullptr;
+        case PROC_vkCmdSetExclusiveScissorNV:
+            return nullptr;
 #endif
 #ifdef VK_NV_device_diagnostic_checkpoints
-    if (!strcmp(name, "vkCmdSetCheckpointNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetQueueCheckpointDataNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetCheckpointNV:
+            return nullptr;
+        case PROC_vkGetQueueCheckpointDataNV:
+            return nullptr;
 #endif
 #ifdef VK_INTEL_performance_query
-    if (!strcmp(name, "vkInitializePerformanceApiINTEL")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkUninitializePerformanceApiINTEL")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceMarkerINTEL")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceStreamMarkerINTEL")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceOverrideINTEL")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkAcquirePerformanceConfigurationINTEL")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkReleasePerformanceConfigurationINTEL")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueSetPerformanceConfigurationINTEL")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPerformanceParameterINTEL")) {
-        return nullptr;
-    }
+        case PROC_vkInitializePerformanceApiINTEL:
+            return nullptr;
+        case PROC_vkUninitializePerformanceApiINTEL:
+            return nullptr;
+        case PROC_vkCmdSetPerformanceMarkerINTEL:
+            return nullptr;
+        case PROC_vkCmdSetPerformanceStreamMarkerINTEL:
+            return nullptr;
+        case PROC_vkCmdSetPerformanceOverrideINTEL:
+            return nullptr;
+        case PROC_vkAcquirePerformanceConfigurationINTEL:
+            return nullptr;
+        case PROC_vkReleasePerformanceConfigurationINTEL:
+            return nullptr;
+        case PROC_vkQueueSetPerformanceConfigurationINTEL:
+            return nullptr;
+        case PROC_vkGetPerformanceParameterINTEL:
+            return nullptr;
 #endif
 #ifdef VK_AMD_display_native_hdr
-    if (!strcmp(name, "vkSetLocalDimmingAMD")) {
-        return nullptr;
-    }
+        case PROC_vkSetLocalDimmingAMD:
+            return nullptr;
 #endif
 #ifdef VK_FUCHSIA_imagepipe_surface
-    if (!strcmp(name, "vkCreateImagePipeSurfaceFUCHSIA")) {
-        return nullptr;
-    }
+        case PROC_vkCreateImagePipeSurfaceFUCHSIA:
+            return nullptr;
 #endif
 #ifdef VK_EXT_metal_surface
-    if (!strcmp(name, "vkCreateMetalSurfaceEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCreateMetalSurfaceEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_buffer_device_address
-    if (!strcmp(name, "vkGetBufferDeviceAddressEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetBufferDeviceAddressEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_tooling_info
-    if (!strcmp(name, "vkGetPhysicalDeviceToolPropertiesEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceToolPropertiesEXT:
+            return nullptr;
 #endif
 #ifdef VK_NV_cooperative_matrix
-    if (!strcmp(name, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV:
+            return nullptr;
 #endif
 #ifdef VK_NV_coverage_reduction_mode
-    if (!strcmp(name, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_full_screen_exclusive
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfacePresentModes2EXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkAcquireFullScreenExclusiveModeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkReleaseFullScreenExclusiveModeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupSurfacePresentModes2EXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSurfacePresentModes2EXT:
+            return nullptr;
+        case PROC_vkAcquireFullScreenExclusiveModeEXT:
+            return nullptr;
+        case PROC_vkReleaseFullScreenExclusiveModeEXT:
+            return nullptr;
+        case PROC_vkGetDeviceGroupSurfacePresentModes2EXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_headless_surface
-    if (!strcmp(name, "vkCreateHeadlessSurfaceEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCreateHeadlessSurfaceEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_line_rasterization
-    if (!strcmp(name, "vkCmdSetLineStippleEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetLineStippleEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_host_query_reset
-    if (!strcmp(name, "vkResetQueryPoolEXT")) {
-        return nullptr;
-    }
+        case PROC_vkResetQueryPoolEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_extended_dynamic_state
-    if (!strcmp(name, "vkCmdSetCullModeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetFrontFaceEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveTopologyEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWithCountEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetScissorWithCountEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers2EXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthTestEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthWriteEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthCompareOpEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBoundsTestEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilTestEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilOpEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetCullModeEXT:
+            return nullptr;
+        case PROC_vkCmdSetFrontFaceEXT:
+            return nullptr;
+        case PROC_vkCmdSetPrimitiveTopologyEXT:
+            return nullptr;
+        case PROC_vkCmdSetViewportWithCountEXT:
+            return nullptr;
+        case PROC_vkCmdSetScissorWithCountEXT:
+            return nullptr;
+        case PROC_vkCmdBindVertexBuffers2EXT:
+            return nullptr;
+        case PROC_vkCmdSetDepthTestEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetDepthWriteEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetDepthCompareOpEXT:
+            return nullptr;
+        case PROC_vkCmdSetDepthBoundsTestEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetStencilTestEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetStencilOpEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_swapchain_maintenance1
-    if (!strcmp(name, "vkReleaseSwapchainImagesEXT")) {
-        return nullptr;
-    }
+        case PROC_vkReleaseSwapchainImagesEXT:
+            return nullptr;
 #endif
 #ifdef VK_NV_device_generated_commands
-    if (!strcmp(name, "vkGetGeneratedCommandsMemoryRequirementsNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdPreprocessGeneratedCommandsNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdExecuteGeneratedCommandsNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindPipelineShaderGroupNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateIndirectCommandsLayoutNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyIndirectCommandsLayoutNV")) {
-        return nullptr;
-    }
+        case PROC_vkGetGeneratedCommandsMemoryRequirementsNV:
+            return nullptr;
+        case PROC_vkCmdPreprocessGeneratedCommandsNV:
+            return nullptr;
+        case PROC_vkCmdExecuteGeneratedCommandsNV:
+            return nullptr;
+        case PROC_vkCmdBindPipelineShaderGroupNV:
+            return nullptr;
+        case PROC_vkCreateIndirectCommandsLayoutNV:
+            return nullptr;
+        case PROC_vkDestroyIndirectCommandsLayoutNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_acquire_drm_display
-    if (!strcmp(name, "vkAcquireDrmDisplayEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDrmDisplayEXT")) {
-        return nullptr;
-    }
+        case PROC_vkAcquireDrmDisplayEXT:
+            return nullptr;
+        case PROC_vkGetDrmDisplayEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_private_data
-    if (!strcmp(name, "vkCreatePrivateDataSlotEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyPrivateDataSlotEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkSetPrivateDataEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPrivateDataEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCreatePrivateDataSlotEXT:
+            return nullptr;
+        case PROC_vkDestroyPrivateDataSlotEXT:
+            return nullptr;
+        case PROC_vkSetPrivateDataEXT:
+            return nullptr;
+        case PROC_vkGetPrivateDataEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_metal_objects
-    if (!strcmp(name, "vkExportMetalObjectsEXT")) {
-        return nullptr;
-    }
+        case PROC_vkExportMetalObjectsEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_descriptor_buffer
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSizeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetLayoutBindingOffsetEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorBuffersEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDescriptorBufferOffsetsEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureDescriptorDataEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetImageOpaqueCaptureDescriptorDataEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetImageViewOpaqueCaptureDescriptorDataEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetSamplerOpaqueCaptureDescriptorDataEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetDescriptorSetLayoutSizeEXT:
+            return nullptr;
+        case PROC_vkGetDescriptorSetLayoutBindingOffsetEXT:
+            return nullptr;
+        case PROC_vkGetDescriptorEXT:
+            return nullptr;
+        case PROC_vkCmdBindDescriptorBuffersEXT:
+            return nullptr;
+        case PROC_vkCmdSetDescriptorBufferOffsetsEXT:
+            return nullptr;
+        case PROC_vkCmdBindDescriptorBufferEmbeddedSamplersEXT:
+            return nullptr;
+        case PROC_vkGetBufferOpaqueCaptureDescriptorDataEXT:
+            return nullptr;
+        case PROC_vkGetImageOpaqueCaptureDescriptorDataEXT:
+            return nullptr;
+        case PROC_vkGetImageViewOpaqueCaptureDescriptorDataEXT:
+            return nullptr;
+        case PROC_vkGetSamplerOpaqueCaptureDescriptorDataEXT:
+            return nullptr;
+        case PROC_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT:
+            return nullptr;
 #endif
 #ifdef VK_NV_fragment_shading_rate_enums
-    if (!strcmp(name, "vkCmdSetFragmentShadingRateEnumNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetFragmentShadingRateEnumNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_image_compression_control
-    if (!strcmp(name, "vkGetImageSubresourceLayout2EXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetImageSubresourceLayout2EXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_device_fault
-    if (!strcmp(name, "vkGetDeviceFaultInfoEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetDeviceFaultInfoEXT:
+            return nullptr;
 #endif
 #ifdef VK_NV_acquire_winrt_display
-    if (!strcmp(name, "vkAcquireWinrtDisplayNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetWinrtDisplayNV")) {
-        return nullptr;
-    }
+        case PROC_vkAcquireWinrtDisplayNV:
+            return nullptr;
+        case PROC_vkGetWinrtDisplayNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_directfb_surface
-    if (!strcmp(name, "vkCreateDirectFBSurfaceEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCreateDirectFBSurfaceEXT:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceDirectFBPresentationSupportEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_vertex_input_dynamic_state
-    if (!strcmp(name, "vkCmdSetVertexInputEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetVertexInputEXT:
+            return nullptr;
 #endif
 #ifdef VK_FUCHSIA_external_memory
-    if (!strcmp(name, "vkGetMemoryZirconHandleFUCHSIA")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryZirconHandlePropertiesFUCHSIA")) {
-        return nullptr;
-    }
+        case PROC_vkGetMemoryZirconHandleFUCHSIA:
+            return nullptr;
+        case PROC_vkGetMemoryZirconHandlePropertiesFUCHSIA:
+            return nullptr;
 #endif
 #ifdef VK_FUCHSIA_external_semaphore
-    if (!strcmp(name, "vkImportSemaphoreZirconHandleFUCHSIA")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetSemaphoreZirconHandleFUCHSIA")) {
-        return nullptr;
-    }
+        case PROC_vkImportSemaphoreZirconHandleFUCHSIA:
+            return nullptr;
+        case PROC_vkGetSemaphoreZirconHandleFUCHSIA:
+            return nullptr;
 #endif
 #ifdef VK_FUCHSIA_buffer_collection
-    if (!strcmp(name, "vkCreateBufferCollectionFUCHSIA")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkSetBufferCollectionImageConstraintsFUCHSIA")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkSetBufferCollectionBufferConstraintsFUCHSIA")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyBufferCollectionFUCHSIA")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferCollectionPropertiesFUCHSIA")) {
-        return nullptr;
-    }
+        case PROC_vkCreateBufferCollectionFUCHSIA:
+            return nullptr;
+        case PROC_vkSetBufferCollectionImageConstraintsFUCHSIA:
+            return nullptr;
+        case PROC_vkSetBufferCollectionBufferConstraintsFUCHSIA:
+            return nullptr;
+        case PROC_vkDestroyBufferCollectionFUCHSIA:
+            return nullptr;
+        case PROC_vkGetBufferCollectionPropertiesFUCHSIA:
+            return nullptr;
 #endif
 #ifdef VK_HUAWEI_subpass_shading
-    if (!strcmp(name, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSubpassShadingHUAWEI")) {
-        return nullptr;
-    }
+        case PROC_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI:
+            return nullptr;
+        case PROC_vkCmdSubpassShadingHUAWEI:
+            return nullptr;
 #endif
 #ifdef VK_HUAWEI_invocation_mask
-    if (!strcmp(name, "vkCmdBindInvocationMaskHUAWEI")) {
-        return nullptr;
-    }
+        case PROC_vkCmdBindInvocationMaskHUAWEI:
+            return nullptr;
 #endif
 #ifdef VK_NV_external_memory_rdma
-    if (!strcmp(name, "vkGetMemoryRemoteAddressNV")) {
-        return nullptr;
-    }
+        case PROC_vkGetMemoryRemoteAddressNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_pipeline_properties
-    if (!strcmp(name, "vkGetPipelinePropertiesEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetPipelinePropertiesEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_extended_dynamic_state2
-    if (!strcmp(name, "vkCmdSetPatchControlPointsEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizerDiscardEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBiasEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetLogicOpEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveRestartEnableEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetPatchControlPointsEXT:
+            return nullptr;
+        case PROC_vkCmdSetRasterizerDiscardEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetDepthBiasEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetLogicOpEXT:
+            return nullptr;
+        case PROC_vkCmdSetPrimitiveRestartEnableEXT:
+            return nullptr;
 #endif
 #ifdef VK_QNX_screen_surface
-    if (!strcmp(name, "vkCreateScreenSurfaceQNX")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceScreenPresentationSupportQNX")) {
-        return nullptr;
-    }
+        case PROC_vkCreateScreenSurfaceQNX:
+            return nullptr;
+        case PROC_vkGetPhysicalDeviceScreenPresentationSupportQNX:
+            return nullptr;
 #endif
 #ifdef VK_EXT_color_write_enable
-    if (!strcmp(name, "vkCmdSetColorWriteEnableEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetColorWriteEnableEXT:
+            return nullptr;
 #endif
 #ifdef VK_GOOGLE_gfxstream
-    if (!strcmp(name, "vkMapMemoryIntoAddressSpaceGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateSizedGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBeginCommandBufferAsyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkEndCommandBufferAsyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkResetCommandBufferAsyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCommandBufferHostSyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateImageWithRequirementsGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateBufferWithRequirementsGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryHostAddressInfoGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkFreeMemorySyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueHostSyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmitAsyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueWaitIdleAsyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueBindSparseAsyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetLinearImageLayoutGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetLinearImageLayout2GOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueFlushCommandsGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueCommitDescriptorSetUpdatesGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCollectDescriptorPoolIdsGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueSignalReleaseImageANDROIDAsyncGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueFlushCommandsFromAuxMemoryGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetBlobGOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateSized2GOOGLE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmitAsync2GOOGLE")) {
-        return nullptr;
-    }
+        case PROC_vkMapMemoryIntoAddressSpaceGOOGLE:
+            return nullptr;
+        case PROC_vkUpdateDescriptorSetWithTemplateSizedGOOGLE:
+            return nullptr;
+        case PROC_vkBeginCommandBufferAsyncGOOGLE:
+            return nullptr;
+        case PROC_vkEndCommandBufferAsyncGOOGLE:
+            return nullptr;
+        case PROC_vkResetCommandBufferAsyncGOOGLE:
+            return nullptr;
+        case PROC_vkCommandBufferHostSyncGOOGLE:
+            return nullptr;
+        case PROC_vkCreateImageWithRequirementsGOOGLE:
+            return nullptr;
+        case PROC_vkCreateBufferWithRequirementsGOOGLE:
+            return nullptr;
+        case PROC_vkGetMemoryHostAddressInfoGOOGLE:
+            return nullptr;
+        case PROC_vkFreeMemorySyncGOOGLE:
+            return nullptr;
+        case PROC_vkQueueHostSyncGOOGLE:
+            return nullptr;
+        case PROC_vkQueueSubmitAsyncGOOGLE:
+            return nullptr;
+        case PROC_vkQueueWaitIdleAsyncGOOGLE:
+            return nullptr;
+        case PROC_vkQueueBindSparseAsyncGOOGLE:
+            return nullptr;
+        case PROC_vkGetLinearImageLayoutGOOGLE:
+            return nullptr;
+        case PROC_vkGetLinearImageLayout2GOOGLE:
+            return nullptr;
+        case PROC_vkQueueFlushCommandsGOOGLE:
+            return nullptr;
+        case PROC_vkQueueCommitDescriptorSetUpdatesGOOGLE:
+            return nullptr;
+        case PROC_vkCollectDescriptorPoolIdsGOOGLE:
+            return nullptr;
+        case PROC_vkQueueSignalReleaseImageANDROIDAsyncGOOGLE:
+            return nullptr;
+        case PROC_vkQueueFlushCommandsFromAuxMemoryGOOGLE:
+            return nullptr;
+        case PROC_vkGetBlobGOOGLE:
+            return nullptr;
+        case PROC_vkUpdateDescriptorSetWithTemplateSized2GOOGLE:
+            return nullptr;
+        case PROC_vkQueueSubmitAsync2GOOGLE:
+            return nullptr;
 #endif
 #ifdef VK_EXT_multi_draw
-    if (!strcmp(name, "vkCmdDrawMultiEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMultiIndexedEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDrawMultiEXT:
+            return nullptr;
+        case PROC_vkCmdDrawMultiIndexedEXT:
+            return nullptr;
 #endif
 #ifdef VK_EXT_opacity_micromap
-    if (!strcmp(name, "vkCreateMicromapEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyMicromapEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBuildMicromapsEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBuildMicromapsEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCopyMicromapEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCopyMicromapToMemoryEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCopyMemoryToMicromapEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkWriteMicromapsPropertiesEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMicromapEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMicromapToMemoryEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToMicromapEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteMicromapsPropertiesEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceMicromapCompatibilityEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetMicromapBuildSizesEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCreateMicromapEXT:
+            return nullptr;
+        case PROC_vkDestroyMicromapEXT:
+            return nullptr;
+        case PROC_vkCmdBuildMicromapsEXT:
+            return nullptr;
+        case PROC_vkBuildMicromapsEXT:
+            return nullptr;
+        case PROC_vkCopyMicromapEXT:
+            return nullptr;
+        case PROC_vkCopyMicromapToMemoryEXT:
+            return nullptr;
+        case PROC_vkCopyMemoryToMicromapEXT:
+            return nullptr;
+        case PROC_vkWriteMicromapsPropertiesEXT:
+            return nullptr;
+        case PROC_vkCmdCopyMicromapEXT:
+            return nullptr;
+        case PROC_vkCmdCopyMicromapToMemoryEXT:
+            return nullptr;
+        case PROC_vkCmdCopyMemoryToMicromapEXT:
+            return nullptr;
+        case PROC_vkCmdWriteMicromapsPropertiesEXT:
+            return nullptr;
+        case PROC_vkGetDeviceMicromapCompatibilityEXT:
+            return nullptr;
+        case PROC_vkGetMicromapBuildSizesEXT:
+            return nullptr;
 #endif
 #ifdef VK_HUAWEI_cluster_culling_shader
-    if (!strcmp(name, "vkCmdDrawClusterHUAWEI")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawClusterIndirectHUAWEI")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDrawClusterHUAWEI:
+            return nullptr;
+        case PROC_vkCmdDrawClusterIndirectHUAWEI:
+            return nullptr;
 #endif
 #ifdef VK_EXT_pageable_device_local_memory
-    if (!strcmp(name, "vkSetDeviceMemoryPriorityEXT")) {
-        return nullptr;
-    }
+        case PROC_vkSetDeviceMemoryPriorityEXT:
+            return nullptr;
 #endif
 #ifdef VK_VALVE_descriptor_set_host_mapping
-    if (!strcmp(name, "vkGetDescriptorSetLayoutHostMappingInfoVALVE")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetHostMappingVALVE")) {
-        return nullptr;
-    }
+        case PROC_vkGetDescriptorSetLayoutHostMappingInfoVALVE:
+            return nullptr;
+        case PROC_vkGetDescriptorSetHostMappingVALVE:
+            return nullptr;
 #endif
 #ifdef VK_NV_copy_memory_indirect
-    if (!strcmp(name, "vkCmdCopyMemoryIndirectNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToImageIndirectNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdCopyMemoryIndirectNV:
+            return nullptr;
+        case PROC_vkCmdCopyMemoryToImageIndirectNV:
+            return nullptr;
 #endif
 #ifdef VK_NV_memory_decompression
-    if (!strcmp(name, "vkCmdDecompressMemoryNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDecompressMemoryIndirectCountNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDecompressMemoryNV:
+            return nullptr;
+        case PROC_vkCmdDecompressMemoryIndirectCountNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_extended_dynamic_state3
-    if (!strcmp(name, "vkCmdSetTessellationDomainOriginEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClampEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPolygonModeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizationSamplesEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetSampleMaskEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetAlphaToCoverageEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetAlphaToOneEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetLogicOpEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendEquationEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetColorWriteMaskEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizationStreamEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetConservativeRasterizationModeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetExtraPrimitiveOverestimationSizeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClipEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetSampleLocationsEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendAdvancedEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetProvokingVertexModeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetLineRasterizationModeEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetLineStippleEnableEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClipNegativeOneToOneEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWScalingEnableNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportSwizzleNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageToColorEnableNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageToColorLocationNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationModeNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationTableEnableNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationTableNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetShadingRateImageEnableNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRepresentativeFragmentTestEnableNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageReductionModeNV")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetTessellationDomainOriginEXT:
+            return nullptr;
+        case PROC_vkCmdSetDepthClampEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetPolygonModeEXT:
+            return nullptr;
+        case PROC_vkCmdSetRasterizationSamplesEXT:
+            return nullptr;
+        case PROC_vkCmdSetSampleMaskEXT:
+            return nullptr;
+        case PROC_vkCmdSetAlphaToCoverageEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetAlphaToOneEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetLogicOpEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetColorBlendEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetColorBlendEquationEXT:
+            return nullptr;
+        case PROC_vkCmdSetColorWriteMaskEXT:
+            return nullptr;
+        case PROC_vkCmdSetRasterizationStreamEXT:
+            return nullptr;
+        case PROC_vkCmdSetConservativeRasterizationModeEXT:
+            return nullptr;
+        case PROC_vkCmdSetExtraPrimitiveOverestimationSizeEXT:
+            return nullptr;
+        case PROC_vkCmdSetDepthClipEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetSampleLocationsEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetColorBlendAdvancedEXT:
+            return nullptr;
+        case PROC_vkCmdSetProvokingVertexModeEXT:
+            return nullptr;
+        case PROC_vkCmdSetLineRasterizationModeEXT:
+            return nullptr;
+        case PROC_vkCmdSetLineStippleEnableEXT:
+            return nullptr;
+        case PROC_vkCmdSetDepthClipNegativeOneToOneEXT:
+            return nullptr;
+        case PROC_vkCmdSetViewportWScalingEnableNV:
+            return nullptr;
+        case PROC_vkCmdSetViewportSwizzleNV:
+            return nullptr;
+        case PROC_vkCmdSetCoverageToColorEnableNV:
+            return nullptr;
+        case PROC_vkCmdSetCoverageToColorLocationNV:
+            return nullptr;
+        case PROC_vkCmdSetCoverageModulationModeNV:
+            return nullptr;
+        case PROC_vkCmdSetCoverageModulationTableEnableNV:
+            return nullptr;
+        case PROC_vkCmdSetCoverageModulationTableNV:
+            return nullptr;
+        case PROC_vkCmdSetShadingRateImageEnableNV:
+            return nullptr;
+        case PROC_vkCmdSetRepresentativeFragmentTestEnableNV:
+            return nullptr;
+        case PROC_vkCmdSetCoverageReductionModeNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_shader_module_identifier
-    if (!strcmp(name, "vkGetShaderModuleIdentifierEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetShaderModuleCreateInfoIdentifierEXT")) {
-        return nullptr;
-    }
+        case PROC_vkGetShaderModuleIdentifierEXT:
+            return nullptr;
+        case PROC_vkGetShaderModuleCreateInfoIdentifierEXT:
+            return nullptr;
 #endif
 #ifdef VK_NV_optical_flow
-    if (!strcmp(name, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateOpticalFlowSessionNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyOpticalFlowSessionNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBindOpticalFlowSessionImageNV")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdOpticalFlowExecuteNV")) {
-        return nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceOpticalFlowImageFormatsNV:
+            return nullptr;
+        case PROC_vkCreateOpticalFlowSessionNV:
+            return nullptr;
+        case PROC_vkDestroyOpticalFlowSessionNV:
+            return nullptr;
+        case PROC_vkBindOpticalFlowSessionImageNV:
+            return nullptr;
+        case PROC_vkCmdOpticalFlowExecuteNV:
+            return nullptr;
 #endif
 #ifdef VK_EXT_shader_object
-    if (!strcmp(name, "vkCreateShadersEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyShaderEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetShaderBinaryDataEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindShadersEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCreateShadersEXT:
+            return nullptr;
+        case PROC_vkDestroyShaderEXT:
+            return nullptr;
+        case PROC_vkGetShaderBinaryDataEXT:
+            return nullptr;
+        case PROC_vkCmdBindShadersEXT:
+            return nullptr;
 #endif
 #ifdef VK_QCOM_tile_properties
-    if (!strcmp(name, "vkGetFramebufferTilePropertiesQCOM")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDynamicRenderingTilePropertiesQCOM")) {
-        return nullptr;
-    }
+        case PROC_vkGetFramebufferTilePropertiesQCOM:
+            return nullptr;
+        case PROC_vkGetDynamicRenderingTilePropertiesQCOM:
+            return nullptr;
 #endif
 #ifdef VK_EXT_attachment_feedback_loop_dynamic_state
-    if (!strcmp(name, "vkCmdSetAttachmentFeedbackLoopEnableEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdSetAttachmentFeedbackLoopEnableEXT:
+            return nullptr;
 #endif
 #ifdef VK_KHR_acceleration_structure
-    if (!strcmp(name, "vkCreateAccelerationStructureKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkDestroyAccelerationStructureKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructuresKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructuresIndirectKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkBuildAccelerationStructuresKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCopyAccelerationStructureKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCopyAccelerationStructureToMemoryKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCopyMemoryToAccelerationStructureKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkWriteAccelerationStructuresPropertiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureToMemoryKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToAccelerationStructureKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureDeviceAddressKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteAccelerationStructuresPropertiesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceAccelerationStructureCompatibilityKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureBuildSizesKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCreateAccelerationStructureKHR:
+            return nullptr;
+        case PROC_vkDestroyAccelerationStructureKHR:
+            return nullptr;
+        case PROC_vkCmdBuildAccelerationStructuresKHR:
+            return nullptr;
+        case PROC_vkCmdBuildAccelerationStructuresIndirectKHR:
+            return nullptr;
+        case PROC_vkBuildAccelerationStructuresKHR:
+            return nullptr;
+        case PROC_vkCopyAccelerationStructureKHR:
+            return nullptr;
+        case PROC_vkCopyAccelerationStructureToMemoryKHR:
+            return nullptr;
+        case PROC_vkCopyMemoryToAccelerationStructureKHR:
+            return nullptr;
+        case PROC_vkWriteAccelerationStructuresPropertiesKHR:
+            return nullptr;
+        case PROC_vkCmdCopyAccelerationStructureKHR:
+            return nullptr;
+        case PROC_vkCmdCopyAccelerationStructureToMemoryKHR:
+            return nullptr;
+        case PROC_vkCmdCopyMemoryToAccelerationStructureKHR:
+            return nullptr;
+        case PROC_vkGetAccelerationStructureDeviceAddressKHR:
+            return nullptr;
+        case PROC_vkCmdWriteAccelerationStructuresPropertiesKHR:
+            return nullptr;
+        case PROC_vkGetDeviceAccelerationStructureCompatibilityKHR:
+            return nullptr;
+        case PROC_vkGetAccelerationStructureBuildSizesKHR:
+            return nullptr;
 #endif
 #ifdef VK_KHR_ray_tracing_pipeline
-    if (!strcmp(name, "vkCmdTraceRaysKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCreateRayTracingPipelinesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdTraceRaysIndirectKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupStackSizeKHR")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRayTracingPipelineStackSizeKHR")) {
-        return nullptr;
-    }
+        case PROC_vkCmdTraceRaysKHR:
+            return nullptr;
+        case PROC_vkCreateRayTracingPipelinesKHR:
+            return nullptr;
+        case PROC_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR:
+            return nullptr;
+        case PROC_vkCmdTraceRaysIndirectKHR:
+            return nullptr;
+        case PROC_vkGetRayTracingShaderGroupStackSizeKHR:
+            return nullptr;
+        case PROC_vkCmdSetRayTracingPipelineStackSizeKHR:
+            return nullptr;
 #endif
 #ifdef VK_EXT_mesh_shader
-    if (!strcmp(name, "vkCmdDrawMeshTasksEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectEXT")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectCountEXT")) {
-        return nullptr;
-    }
+        case PROC_vkCmdDrawMeshTasksEXT:
+            return nullptr;
+        case PROC_vkCmdDrawMeshTasksIndirectEXT:
+            return nullptr;
+        case PROC_vkCmdDrawMeshTasksIndirectCountEXT:
+            return nullptr;
 #endif
-    return nullptr;
+        default:
+            return nullptr;
+    }
 }
 void* goldfish_vulkan_get_instance_proc_address(VkInstance instance, const char* name) {
     auto resources = ResourceTracker::get();
     bool has1_1OrHigher = resources->getApiVersionFromInstance(instance) >= VK_API_VERSION_1_1;
     bool has1_2OrHigher = resources->getApiVersionFromInstance(instance) >= VK_API_VERSION_1_2;
     bool has1_3OrHigher = resources->getApiVersionFromInstance(instance) >= VK_API_VERSION_1_3;
+    switch (goldfish_vulkan_proc_index(name)) {
 #ifdef VK_VERSION_1_0
-    if (!strcmp(name, "vkCreateInstance")) {
-        return (void*)entry_vkCreateInstance;
-    }
-    if (!strcmp(name, "vkDestroyInstance")) {
-        return (void*)entry_vkDestroyInstance;
-    }
-    if (!strcmp(name, "vkEnumeratePhysicalDevices")) {
-        return (void*)entry_vkEnumeratePhysicalDevices;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures")) {
-        return (void*)entry_vkGetPhysicalDeviceFeatures;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceFormatProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceImageFormatProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceMemoryProperties;
-    }
-    if (!strcmp(name, "vkGetInstanceProcAddr")) {
-        return (void*)entry_vkGetInstanceProcAddr;
-    }
-    if (!strcmp(name, "vkGetDeviceProcAddr")) {
-        return (void*)entry_vkGetDeviceProcAddr;
-    }
-    if (!strcmp(name, "vkCreateDevice")) {
-        return (void*)entry_vkCreateDevice;
-    }
-    if (!strcmp(name, "vkDestroyDevice")) {
-        return (void*)entry_vkDestroyDevice;
-    }
-    if (!strcmp(name, "vkEnumerateInstanceExtensionProperties")) {
-        return (void*)entry_vkEnumerateInstanceExtensionProperties;
-    }
-    if (!strcmp(name, "vkEnumerateDeviceExtensionProperties")) {
-        return (void*)entry_vkEnumerateDeviceExtensionProperties;
-    }
-    if (!strcmp(name, "vkEnumerateInstanceLayerProperties")) {
-        return (void*)entry_vkEnumerateInstanceLayerProperties;
-    }
-    if (!strcmp(name, "vkEnumerateDeviceLayerProperties")) {
-        return (void*)entry_vkEnumerateDeviceLayerProperties;
-    }
-    if (!strcmp(name, "vkGetDeviceQueue")) {
-        return (void*)entry_vkGetDeviceQueue;
-    }
-    if (!strcmp(name, "vkQueueSubmit")) {
-        return (void*)entry_vkQueueSubmit;
-    }
-    if (!strcmp(name, "vkQueueWaitIdle")) {
-        return (void*)entry_vkQueueWaitIdle;
-    }
-    if (!strcmp(name, "vkDeviceWaitIdle")) {
-        return (void*)entry_vkDeviceWaitIdle;
-    }
-    if (!strcmp(name, "vkAllocateMemory")) {
-        return (void*)entry_vkAllocateMemory;
-    }
-    if (!strcmp(name, "vkFreeMemory")) {
-        return (void*)entry_vkFreeMemory;
-    }
-    if (!strcmp(name, "vkMapMemory")) {
-        return (void*)entry_vkMapMemory;
-    }
-    if (!strcmp(name, "vkUnmapMemory")) {
-        return (void*)entry_vkUnmapMemory;
-    }
-    if (!strcmp(name, "vkFlushMappedMemoryRanges")) {
-        return (void*)entry_vkFlushMappedMemoryRanges;
-    }
-    if (!strcmp(name, "vkInvalidateMappedMemoryRanges")) {
-        return (void*)entry_vkInvalidateMappedMemoryRanges;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryCommitment")) {
-        return (void*)entry_vkGetDeviceMemoryCommitment;
-    }
-    if (!strcmp(name, "vkBindBufferMemory")) {
-        return (void*)entry_vkBindBufferMemory;
-    }
-    if (!strcmp(name, "vkBindImageMemory")) {
-        return (void*)entry_vkBindImageMemory;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements")) {
-        return (void*)entry_vkGetBufferMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetImageMemoryRequirements")) {
-        return (void*)entry_vkGetImageMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements")) {
-        return (void*)entry_vkGetImageSparseMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties;
-    }
-    if (!strcmp(name, "vkQueueBindSparse")) {
-        return (void*)entry_vkQueueBindSparse;
-    }
-    if (!strcmp(name, "vkCreateFence")) {
-        return (void*)entry_vkCreateFence;
-    }
-    if (!strcmp(name, "vkDestroyFence")) {
-        return (void*)entry_vkDestroyFence;
-    }
-    if (!strcmp(name, "vkResetFences")) {
-        return (void*)entry_vkResetFences;
-    }
-    if (!strcmp(name, "vkGetFenceStatus")) {
-        return (void*)entry_vkGetFenceStatus;
-    }
-    if (!strcmp(name, "vkWaitForFences")) {
-        return (void*)entry_vkWaitForFences;
-    }
-    if (!strcmp(name, "vkCreateSemaphore")) {
-        return (void*)entry_vkCreateSemaphore;
-    }
-    if (!strcmp(name, "vkDestroySemaphore")) {
-        return (void*)entry_vkDestroySemaphore;
-    }
-    if (!strcmp(name, "vkCreateEvent")) {
-        return (void*)entry_vkCreateEvent;
-    }
-    if (!strcmp(name, "vkDestroyEvent")) {
-        return (void*)entry_vkDestroyEvent;
-    }
-    if (!strcmp(name, "vkGetEventStatus")) {
-        return (void*)entry_vkGetEventStatus;
-    }
-    if (!strcmp(name, "vkSetEvent")) {
-        return (void*)entry_vkSetEvent;
-    }
-    if (!strcmp(name, "vkResetEvent")) {
-        return (void*)entry_vkResetEvent;
-    }
-    if (!strcmp(name, "vkCreateQueryPool")) {
-        return (void*)entry_vkCreateQueryPool;
-    }
-    if (!strcmp(name, "vkDestroyQueryPool")) {
-        return (void*)entry_vkDestroyQueryPool;
-    }
-    if (!strcmp(name, "vkGetQueryPoolResults")) {
-        return (void*)entry_vkGetQueryPoolResults;
-    }
-    if (!strcmp(name, "vkCreateBuffer")) {
-        return (void*)entry_vkCreateBuffer;
-    }
-    if (!strcmp(name, "vkDestroyBuffer")) {
-        return (void*)entry_vkDestroyBuffer;
-    }
-    if (!strcmp(name, "vkCreateBufferView")) {
-        return (void*)entry_vkCreateBufferView;
-    }
-    if (!strcmp(name, "vkDestroyBufferView")) {
-        return (void*)entry_vkDestroyBufferView;
-    }
-    if (!strcmp(name, "vkCreateImage")) {
-        return (void*)entry_vkCreateImage;
-    }
-    if (!strcmp(name, "vkDestroyImage")) {
-        return (void*)entry_vkDestroyImage;
-    }
-    if (!strcmp(name, "vkGetImageSubresourceLayout")) {
-        return (void*)entry_vkGetImageSubresourceLayout;
-    }
-    if (!strcmp(name, "vkCreateImageView")) {
-        return (void*)entry_vkCreateImageView;
-    }
-    if (!strcmp(name, "vkDestroyImageView")) {
-        return (void*)entry_vkDestroyImageView;
-    }
-    if (!strcmp(name, "vkCreateShaderModule")) {
-        return (void*)entry_vkCreateShaderModule;
-    }
-    if (!strcmp(name, "vkDestroyShaderModule")) {
-        return (void*)entry_vkDestroyShaderModule;
-    }
-    if (!strcmp(name, "vkCreatePipelineCache")) {
-        return (void*)entry_vkCreatePipelineCache;
-    }
-    if (!strcmp(name, "vkDestroyPipelineCache")) {
-        return (void*)entry_vkDestroyPipelineCache;
-    }
-    if (!strcmp(name, "vkGetPipelineCacheData")) {
-        return (void*)entry_vkGetPipelineCacheData;
-    }
-    if (!strcmp(name, "vkMergePipelineCaches")) {
-        return (void*)entry_vkMergePipelineCaches;
-    }
-    if (!strcmp(name, "vkCreateGraphicsPipelines")) {
-        return (void*)entry_vkCreateGraphicsPipelines;
-    }
-    if (!strcmp(name, "vkCreateComputePipelines")) {
-        return (void*)entry_vkCreateComputePipelines;
-    }
-    if (!strcmp(name, "vkDestroyPipeline")) {
-        return (void*)entry_vkDestroyPipeline;
-    }
-    if (!strcmp(name, "vkCreatePipelineLayout")) {
-        return (void*)entry_vkCreatePipelineLayout;
-    }
-    if (!strcmp(name, "vkDestroyPipelineLayout")) {
-        return (void*)entry_vkDestroyPipelineLayout;
-    }
-    if (!strcmp(name, "vkCreateSampler")) {
-        return (void*)entry_vkCreateSampler;
-    }
-    if (!strcmp(name, "vkDestroySampler")) {
-        return (void*)entry_vkDestroySampler;
-    }
-    if (!strcmp(name, "vkCreateDescriptorSetLayout")) {
-        return (void*)entry_vkCreateDescriptorSetLayout;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorSetLayout")) {
-        return (void*)entry_vkDestroyDescriptorSetLayout;
-    }
-    if (!strcmp(name, "vkCreateDescriptorPool")) {
-        return (void*)entry_vkCreateDescriptorPool;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorPool")) {
-        return (void*)entry_vkDestroyDescriptorPool;
-    }
-    if (!strcmp(name, "vkResetDescriptorPool")) {
-        return (void*)entry_vkResetDescriptorPool;
-    }
-    if (!strcmp(name, "vkAllocateDescriptorSets")) {
-        return (void*)entry_vkAllocateDescriptorSets;
-    }
-    if (!strcmp(name, "vkFreeDescriptorSets")) {
-        return (void*)entry_vkFreeDescriptorSets;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSets")) {
-        return (void*)entry_vkUpdateDescriptorSets;
-    }
-    if (!strcmp(name, "vkCreateFramebuffer")) {
-        return (void*)entry_vkCreateFramebuffer;
-    }
-    if (!strcmp(name, "vkDestroyFramebuffer")) {
-        return (void*)entry_vkDestroyFramebuffer;
-    }
-    if (!strcmp(name, "vkCreateRenderPass")) {
-        return (void*)entry_vkCreateRenderPass;
-    }
-    if (!strcmp(name, "vkDestroyRenderPass")) {
-        return (void*)entry_vkDestroyRenderPass;
-    }
-    if (!strcmp(name, "vkGetRenderAreaGranularity")) {
-        return (void*)entry_vkGetRenderAreaGranularity;
-    }
-    if (!strcmp(name, "vkCreateCommandPool")) {
-        return (void*)entry_vkCreateCommandPool;
-    }
-    if (!strcmp(name, "vkDestroyCommandPool")) {
-        return (void*)entry_vkDestroyCommandPool;
-    }
-    if (!strcmp(name, "vkResetCommandPool")) {
-        return (void*)entry_vkResetCommandPool;
-    }
-    if (!strcmp(name, "vkAllocateCommandBuffers")) {
-        return (void*)entry_vkAllocateCommandBuffers;
-    }
-    if (!strcmp(name, "vkFreeCommandBuffers")) {
-        return (void*)entry_vkFreeCommandBuffers;
-    }
-    if (!strcmp(name, "vkBeginCommandBuffer")) {
-        return (void*)entry_vkBeginCommandBuffer;
-    }
-    if (!strcmp(name, "vkEndCommandBuffer")) {
-        return (void*)entry_vkEndCommandBuffer;
-    }
-    if (!strcmp(name, "vkResetCommandBuffer")) {
-        return (void*)entry_vkResetCommandBuffer;
-    }
-    if (!strcmp(name, "vkCmdBindPipeline")) {
-        return (void*)entry_vkCmdBindPipeline;
-    }
-    if (!strcmp(name, "vkCmdSetViewport")) {
-        return (void*)entry_vkCmdSetViewport;
-    }
-    if (!strcmp(name, "vkCmdSetScissor")) {
-        return (void*)entry_vkCmdSetScissor;
-    }
-    if (!strcmp(name, "vkCmdSetLineWidth")) {
-        return (void*)entry_vkCmdSetLineWidth;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBias")) {
-        return (void*)entry_vkCmdSetDepthBias;
-    }
-    if (!strcmp(name, "vkCmdSetBlendConstants")) {
-        return (void*)entry_vkCmdSetBlendConstants;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBounds")) {
-        return (void*)entry_vkCmdSetDepthBounds;
-    }
-    if (!strcmp(name, "vkCmdSetStencilCompareMask")) {
-        return (void*)entry_vkCmdSetStencilCompareMask;
-    }
-    if (!strcmp(name, "vkCmdSetStencilWriteMask")) {
-        return (void*)entry_vkCmdSetStencilWriteMask;
-    }
-    if (!strcmp(name, "vkCmdSetStencilReference")) {
-        return (void*)entry_vkCmdSetStencilReference;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorSets")) {
-        return (void*)entry_vkCmdBindDescriptorSets;
-    }
-    if (!strcmp(name, "vkCmdBindIndexBuffer")) {
-        return (void*)entry_vkCmdBindIndexBuffer;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers")) {
-        return (void*)entry_vkCmdBindVertexBuffers;
-    }
-    if (!strcmp(name, "vkCmdDraw")) {
-        return (void*)entry_vkCmdDraw;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexed")) {
-        return (void*)entry_vkCmdDrawIndexed;
-    }
-    if (!strcmp(name, "vkCmdDrawIndirect")) {
-        return (void*)entry_vkCmdDrawIndirect;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirect")) {
-        return (void*)entry_vkCmdDrawIndexedIndirect;
-    }
-    if (!strcmp(name, "vkCmdDispatch")) {
-        return (void*)entry_vkCmdDispatch;
-    }
-    if (!strcmp(name, "vkCmdDispatchIndirect")) {
-        return (void*)entry_vkCmdDispatchIndirect;
-    }
-    if (!strcmp(name, "vkCmdCopyBuffer")) {
-        return (void*)entry_vkCmdCopyBuffer;
-    }
-    if (!strcmp(name, "vkCmdCopyImage")) {
-        return (void*)entry_vkCmdCopyImage;
-    }
-    if (!strcmp(name, "vkCmdBlitImage")) {
-        return (void*)entry_vkCmdBlitImage;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage")) {
-        return (void*)entry_vkCmdCopyBufferToImage;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer")) {
-        return (void*)entry_vkCmdCopyImageToBuffer;
-    }
-    if (!strcmp(name, "vkCmdUpdateBuffer")) {
-        return (void*)entry_vkCmdUpdateBuffer;
-    }
-    if (!strcmp(name, "vkCmdFillBuffer")) {
-        return (void*)entry_vkCmdFillBuffer;
-    }
-    if (!strcmp(name, "vkCmdClearColorImage")) {
-        return (void*)entry_vkCmdClearColorImage;
-    }
-    if (!strcmp(name, "vkCmdClearDepthStencilImage")) {
-        return (void*)entry_vkCmdClearDepthStencilImage;
-    }
-    if (!strcmp(name, "vkCmdClearAttachments")) {
-        return (void*)entry_vkCmdClearAttachments;
-    }
-    if (!strcmp(name, "vkCmdResolveImage")) {
-        return (void*)entry_vkCmdResolveImage;
-    }
-    if (!strcmp(name, "vkCmdSetEvent")) {
-        return (void*)entry_vkCmdSetEvent;
-    }
-    if (!strcmp(name, "vkCmdResetEvent")) {
-        return (void*)entry_vkCmdResetEvent;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents")) {
-        return (void*)entry_vkCmdWaitEvents;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier")) {
-        return (void*)entry_vkCmdPipelineBarrier;
-    }
-    if (!strcmp(name, "vkCmdBeginQuery")) {
-        return (void*)entry_vkCmdBeginQuery;
-    }
-    if (!strcmp(name, "vkCmdEndQuery")) {
-        return (void*)entry_vkCmdEndQuery;
-    }
-    if (!strcmp(name, "vkCmdResetQueryPool")) {
-        return (void*)entry_vkCmdResetQueryPool;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp")) {
-        return (void*)entry_vkCmdWriteTimestamp;
-    }
-    if (!strcmp(name, "vkCmdCopyQueryPoolResults")) {
-        return (void*)entry_vkCmdCopyQueryPoolResults;
-    }
-    if (!strcmp(name, "vkCmdPushConstants")) {
-        return (void*)entry_vkCmdPushConstants;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass")) {
-        return (void*)entry_vkCmdBeginRenderPass;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass")) {
-        return (void*)entry_vkCmdNextSubpass;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass")) {
-        return (void*)entry_vkCmdEndRenderPass;
-    }
-    if (!strcmp(name, "vkCmdExecuteCommands")) {
-        return (void*)entry_vkCmdExecuteCommands;
-    }
+        case PROC_vkCreateInstance:
+            return (void*)entry_vkCreateInstance;
+        case PROC_vkDestroyInstance:
+            return (void*)entry_vkDestroyInstance;
+        case PROC_vkEnumeratePhysicalDevices:
+            return (void*)entry_vkEnumeratePhysicalDevices;
+        case PROC_vkGetPhysicalDeviceFeatures:
+            return (void*)entry_vkGetPhysicalDeviceFeatures;
+        case PROC_vkGetPhysicalDeviceFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceFormatProperties;
+        case PROC_vkGetPhysicalDeviceImageFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceImageFormatProperties;
+        case PROC_vkGetPhysicalDeviceProperties:
+            return (void*)entry_vkGetPhysicalDeviceProperties;
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties:
+            return (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties;
+        case PROC_vkGetPhysicalDeviceMemoryProperties:
+            return (void*)entry_vkGetPhysicalDeviceMemoryProperties;
+        case PROC_vkGetInstanceProcAddr:
+            return (void*)entry_vkGetInstanceProcAddr;
+        case PROC_vkGetDeviceProcAddr:
+            return (void*)entry_vkGetDeviceProcAddr;
+        case PROC_vkCreateDevice:
+            return (void*)entry_vkCreateDevice;
+        case PROC_vkDestroyDevice:
+            return (void*)entry_vkDestroyDevice;
+        case PROC_vkEnumerateInstanceExtensionProperties:
+            return (void*)entry_vkEnumerateInstanceExtensionProperties;
+        case PROC_vkEnumerateDeviceExtensionProperties:
+            return (void*)entry_vkEnumerateDeviceExtensionProperties;
+        case PROC_vkEnumerateInstanceLayerProperties:
+            return (void*)entry_vkEnumerateInstanceLayerProperties;
+        case PROC_vkEnumerateDeviceLayerProperties:
+            return (void*)entry_vkEnumerateDeviceLayerProperties;
+        case PROC_vkGetDeviceQueue:
+            return (void*)entry_vkGetDeviceQueue;
+        case PROC_vkQueueSubmit:
+            return (void*)entry_vkQueueSubmit;
+        case PROC_vkQueueWaitIdle:
+            return (void*)entry_vkQueueWaitIdle;
+        case PROC_vkDeviceWaitIdle:
+            return (void*)entry_vkDeviceWaitIdle;
+        case PROC_vkAllocateMemory:
+            return (void*)entry_vkAllocateMemory;
+        case PROC_vkFreeMemory:
+            return (void*)entry_vkFreeMemory;
+        case PROC_vkMapMemory:
+            return (void*)entry_vkMapMemory;
+        case PROC_vkUnmapMemory:
+            return (void*)entry_vkUnmapMemory;
+        case PROC_vkFlushMappedMemoryRanges:
+            return (void*)entry_vkFlushMappedMemoryRanges;
+        case PROC_vkInvalidateMappedMemoryRanges:
+            return (void*)entry_vkInvalidateMappedMemoryRanges;
+        case PROC_vkGetDeviceMemoryCommitment:
+            return (void*)entry_vkGetDeviceMemoryCommitment;
+        case PROC_vkBindBufferMemory:
+            return (void*)entry_vkBindBufferMemory;
+        case PROC_vkBindImageMemory:
+            return (void*)entry_vkBindImageMemory;
+        case PROC_vkGetBufferMemoryRequirements:
+            return (void*)entry_vkGetBufferMemoryRequirements;
+        case PROC_vkGetImageMemoryRequirements:
+            return (void*)entry_vkGetImageMemoryRequirements;
+        case PROC_vkGetImageSparseMemoryRequirements:
+            return (void*)entry_vkGetImageSparseMemoryRequirements;
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties;
+        case PROC_vkQueueBindSparse:
+            return (void*)entry_vkQueueBindSparse;
+        case PROC_vkCreateFence:
+            return (void*)entry_vkCreateFence;
+        case PROC_vkDestroyFence:
+            return (void*)entry_vkDestroyFence;
+        case PROC_vkResetFences:
+            return (void*)entry_vkResetFences;
+        case PROC_vkGetFenceStatus:
+            return (void*)entry_vkGetFenceStatus;
+        case PROC_vkWaitForFences:
+            return (void*)entry_vkWaitForFences;
+        case PROC_vkCreateSemaphore:
+            return (void*)entry_vkCreateSemaphore;
+        case PROC_vkDestroySemaphore:
+            return (void*)entry_vkDestroySemaphore;
+        case PROC_vkCreateEvent:
+            return (void*)entry_vkCreateEvent;
+        case PROC_vkDestroyEvent:
+            return (void*)entry_vkDestroyEvent;
+        case PROC_vkGetEventStatus:
+            return (void*)entry_vkGetEventStatus;
+        case PROC_vkSetEvent:
+            return (void*)entry_vkSetEvent;
+        case PROC_vkResetEvent:
+            return (void*)entry_vkResetEvent;
+        case PROC_vkCreateQueryPool:
+            return (void*)entry_vkCreateQueryPool;
+        case PROC_vkDestroyQueryPool:
+            return (void*)entry_vkDestroyQueryPool;
+        case PROC_vkGetQueryPoolResults:
+            return (void*)entry_vkGetQueryPoolResults;
+        case PROC_vkCreateBuffer:
+            return (void*)entry_vkCreateBuffer;
+        case PROC_vkDestroyBuffer:
+            return (void*)entry_vkDestroyBuffer;
+        case PROC_vkCreateBufferView:
+            return (void*)entry_vkCreateBufferView;
+        case PROC_vkDestroyBufferView:
+            return (void*)entry_vkDestroyBufferView;
+        case PROC_vkCreateImage:
+            return (void*)entry_vkCreateImage;
+        case PROC_vkDestroyImage:
+            return (void*)entry_vkDestroyImage;
+        case PROC_vkGetImageSubresourceLayout:
+            return (void*)entry_vkGetImageSubresourceLayout;
+        case PROC_vkCreateImageView:
+            return (void*)entry_vkCreateImageView;
+        case PROC_vkDestroyImageView:
+            return (void*)entry_vkDestroyImageView;
+        case PROC_vkCreateShaderModule:
+            return (void*)entry_vkCreateShaderModule;
+        case PROC_vkDestroyShaderModule:
+            return (void*)entry_vkDestroyShaderModule;
+        case PROC_vkCreatePipelineCache:
+            return (void*)entry_vkCreatePipelineCache;
+        case PROC_vkDestroyPipelineCache:
+            return (void*)entry_vkDestroyPipelineCache;
+        case PROC_vkGetPipelineCacheData:
+            return (void*)entry_vkGetPipelineCacheData;
+        case PROC_vkMergePipelineCaches:
+            return (void*)entry_vkMergePipelineCaches;
+        case PROC_vkCreateGraphicsPipelines:
+            return (void*)entry_vkCreateGraphicsPipelines;
+        case PROC_vkCreateComputePipelines:
+            return (void*)entry_vkCreateComputePipelines;
+        case PROC_vkDestroyPipeline:
+            return (void*)entry_vkDestroyPipeline;
+        case PROC_vkCreatePipelineLayout:
+            return (void*)entry_vkCreatePipelineLayout;
+        case PROC_vkDestroyPipelineLayout:
+            return (void*)entry_vkDestroyPipelineLayout;
+        case PROC_vkCreateSampler:
+            return (void*)entry_vkCreateSampler;
+        case PROC_vkDestroySampler:
+            return (void*)entry_vkDestroySampler;
+        case PROC_vkCreateDescriptorSetLayout:
+            return (void*)entry_vkCreateDescriptorSetLayout;
+        case PROC_vkDestroyDescriptorSetLayout:
+            return (void*)entry_vkDestroyDescriptorSetLayout;
+        case PROC_vkCreateDescriptorPool:
+            return (void*)entry_vkCreateDescriptorPool;
+        case PROC_vkDestroyDescriptorPool:
+            return (void*)entry_vkDestroyDescriptorPool;
+        case PROC_vkResetDescriptorPool:
+            return (void*)entry_vkResetDescriptorPool;
+        case PROC_vkAllocateDescriptorSets:
+            return (void*)entry_vkAllocateDescriptorSets;
+        case PROC_vkFreeDescriptorSets:
+            return (void*)entry_vkFreeDescriptorSets;
+        case PROC_vkUpdateDescriptorSets:
+            return (void*)entry_vkUpdateDescriptorSets;
+        case PROC_vkCreateFramebuffer:
+            return (void*)entry_vkCreateFramebuffer;
+        case PROC_vkDestroyFramebuffer:
+            return (void*)entry_vkDestroyFramebuffer;
+        case PROC_vkCreateRenderPass:
+            return (void*)entry_vkCreateRenderPass;
+        case PROC_vkDestroyRenderPass:
+            return (void*)entry_vkDestroyRenderPass;
+        case PROC_vkGetRenderAreaGranularity:
+            return (void*)entry_vkGetRenderAreaGranularity;
+        case PROC_vkCreateCommandPool:
+            return (void*)entry_vkCreateCommandPool;
+        case PROC_vkDestroyCommandPool:
+            return (void*)entry_vkDestroyCommandPool;
+        case PROC_vkResetCommandPool:
+            return (void*)entry_vkResetCommandPool;
+        case PROC_vkAllocateCommandBuffers:
+            return (void*)entry_vkAllocateCommandBuffers;
+        case PROC_vkFreeCommandBuffers:
+            return (void*)entry_vkFreeCommandBuffers;
+        case PROC_vkBeginCommandBuffer:
+            return (void*)entry_vkBeginCommandBuffer;
+        case PROC_vkEndCommandBuffer:
+            return (void*)entry_vkEndCommandBuffer;
+        case PROC_vkResetCommandBuffer:
+            return (void*)entry_vkResetCommandBuffer;
+        case PROC_vkCmdBindPipeline:
+            return (void*)entry_vkCmdBindPipeline;
+        case PROC_vkCmdSetViewport:
+            return (void*)entry_vkCmdSetViewport;
+        case PROC_vkCmdSetScissor:
+            return (void*)entry_vkCmdSetScissor;
+        case PROC_vkCmdSetLineWidth:
+            return (void*)entry_vkCmdSetLineWidth;
+        case PROC_vkCmdSetDepthBias:
+            return (void*)entry_vkCmdSetDepthBias;
+        case PROC_vkCmdSetBlendConstants:
+            return (void*)entry_vkCmdSetBlendConstants;
+        case PROC_vkCmdSetDepthBounds:
+            return (void*)entry_vkCmdSetDepthBounds;
+        case PROC_vkCmdSetStencilCompareMask:
+            return (void*)entry_vkCmdSetStencilCompareMask;
+        case PROC_vkCmdSetStencilWriteMask:
+            return (void*)entry_vkCmdSetStencilWriteMask;
+        case PROC_vkCmdSetStencilReference:
+            return (void*)entry_vkCmdSetStencilReference;
+        case PROC_vkCmdBindDescriptorSets:
+            return (void*)entry_vkCmdBindDescriptorSets;
+        case PROC_vkCmdBindIndexBuffer:
+            return (void*)entry_vkCmdBindIndexBuffer;
+        case PROC_vkCmdBindVertexBuffers:
+            return (void*)entry_vkCmdBindVertexBuffers;
+        case PROC_vkCmdDraw:
+            return (void*)entry_vkCmdDraw;
+        case PROC_vkCmdDrawIndexed:
+            return (void*)entry_vkCmdDrawIndexed;
+        case PROC_vkCmdDrawIndirect:
+            return (void*)entry_vkCmdDrawIndirect;
+        case PROC_vkCmdDrawIndexedIndirect:
+            return (void*)entry_vkCmdDrawIndexedIndirect;
+        case PROC_vkCmdDispatch:
+            return (void*)entry_vkCmdDispatch;
+        case PROC_vkCmdDispatchIndirect:
+            return (void*)entry_vkCmdDispatchIndirect;
+        case PROC_vkCmdCopyBuffer:
+            return (void*)entry_vkCmdCopyBuffer;
+        case PROC_vkCmdCopyImage:
+            return (void*)entry_vkCmdCopyImage;
+        case PROC_vkCmdBlitImage:
+            return (void*)entry_vkCmdBlitImage;
+        case PROC_vkCmdCopyBufferToImage:
+            return (void*)entry_vkCmdCopyBufferToImage;
+        case PROC_vkCmdCopyImageToBuffer:
+            return (void*)entry_vkCmdCopyImageToBuffer;
+        case PROC_vkCmdUpdateBuffer:
+            return (void*)entry_vkCmdUpdateBuffer;
+        case PROC_vkCmdFillBuffer:
+            return (void*)entry_vkCmdFillBuffer;
+        case PROC_vkCmdClearColorImage:
+            return (void*)entry_vkCmdClearColorImage;
+        case PROC_vkCmdClearDepthStencilImage:
+            return (void*)entry_vkCmdClearDepthStencilImage;
+        case PROC_vkCmdClearAttachments:
+            return (void*)entry_vkCmdClearAttachments;
+        case PROC_vkCmdResolveImage:
+            return (void*)entry_vkCmdResolveImage;
+        case PROC_vkCmdSetEvent:
+            return (void*)entry_vkCmdSetEvent;
+        case PROC_vkCmdResetEvent:
+            return (void*)entry_vkCmdResetEvent;
+        case PROC_vkCmdWaitEvents:
+            return (void*)entry_vkCmdWaitEvents;
+        case PROC_vkCmdPipelineBarrier:
+            return (void*)entry_vkCmdPipelineBarrier;
+        case PROC_vkCmdBeginQuery:
+            return (void*)entry_vkCmdBeginQuery;
+        case PROC_vkCmdEndQuery:
+            return (void*)entry_vkCmdEndQuery;
+        case PROC_vkCmdResetQueryPool:
+            return (void*)entry_vkCmdResetQueryPool;
+        case PROC_vkCmdWriteTimestamp:
+            return (void*)entry_vkCmdWriteTimestamp;
+        case PROC_vkCmdCopyQueryPoolResults:
+            return (void*)entry_vkCmdCopyQueryPoolResults;
+        case PROC_vkCmdPushConstants:
+            return (void*)entry_vkCmdPushConstants;
+        case PROC_vkCmdBeginRenderPass:
+            return (void*)entry_vkCmdBeginRenderPass;
+        case PROC_vkCmdNextSubpass:
+            return (void*)entry_vkCmdNextSubpass;
+        case PROC_vkCmdEndRenderPass:
+            return (void*)entry_vkCmdEndRenderPass;
+        case PROC_vkCmdExecuteCommands:
+            return (void*)entry_vkCmdExecuteCommands;
 #endif
 #ifdef VK_VERSION_1_1
-    if (!strcmp(name, "vkEnumerateInstanceVersion")) {
-        return has1_1OrHigher ? (void*)entry_vkEnumerateInstanceVersion : nullptr;
-    }
-    if (!strcmp(name, "vkBindBufferMemory2")) {
-        return (void*)dynCheck_entry_vkBindBufferMemory2;
-    }
-    if (!strcmp(name, "vkBindImageMemory2")) {
-        return (void*)dynCheck_entry_vkBindImageMemory2;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupPeerMemoryFeatures")) {
-        return (void*)dynCheck_entry_vkGetDeviceGroupPeerMemoryFeatures;
-    }
-    if (!strcmp(name, "vkCmdSetDeviceMask")) {
-        return has1_1OrHigher ? (void*)entry_vkCmdSetDeviceMask : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDispatchBase")) {
-        return has1_1OrHigher ? (void*)entry_vkCmdDispatchBase : nullptr;
-    }
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceGroups")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetImageMemoryRequirements2")) {
-        return (void*)dynCheck_entry_vkGetImageMemoryRequirements2;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements2")) {
-        return (void*)dynCheck_entry_vkGetBufferMemoryRequirements2;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements2")) {
-        return (void*)dynCheck_entry_vkGetImageSparseMemoryRequirements2;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceFeatures2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceFormatProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceImageFormatProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceMemoryProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties2
-                              : nullptr;
-    }
-    if (!strcmp(name, "vkTrimCommandPool")) {
-        return (void*)dynCheck_entry_vkTrimCommandPool;
-    }
-    if (!strcmp(name, "vkGetDeviceQueue2")) {
-        return (void*)dynCheck_entry_vkGetDeviceQueue2;
-    }
-    if (!strcmp(name, "vkCreateSamplerYcbcrConversion")) {
-        return (void*)dynCheck_entry_vkCreateSamplerYcbcrConversion;
-    }
-    if (!strcmp(name, "vkDestroySamplerYcbcrConversion")) {
-        return (void*)dynCheck_entry_vkDestroySamplerYcbcrConversion;
-    }
-    if (!strcmp(name, "vkCreateDescriptorUpdateTemplate")) {
-        return (void*)dynCheck_entry_vkCreateDescriptorUpdateTemplate;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorUpdateTemplate")) {
-        return (void*)dynCheck_entry_vkDestroyDescriptorUpdateTemplate;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplate")) {
-        return (void*)dynCheck_entry_vkUpdateDescriptorSetWithTemplate;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalBufferProperties")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalBufferProperties : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalFenceProperties")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalFenceProperties : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalSemaphoreProperties")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalSemaphoreProperties
-                              : nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSupport")) {
-        return (void*)dynCheck_entry_vkGetDescriptorSetLayoutSupport;
-    }
+        case PROC_vkEnumerateInstanceVersion:
+            return has1_1OrHigher ? (void*)entry_vkEnumerateInstanceVersion : nullptr;
+        case PROC_vkBindBufferMemory2:
+            return (void*)dynCheck_entry_vkBindBufferMemory2;
+        case PROC_vkBindImageMemory2:
+            return (void*)dynCheck_entry_vkBindImageMemory2;
+        case PROC_vkGetDeviceGroupPeerMemoryFeatures:
+            return (void*)dynCheck_entry_vkGetDeviceGroupPeerMemoryFeatures;
+        case PROC_vkCmdSetDeviceMask:
+            return has1_1OrHigher ? (void*)entry_vkCmdSetDeviceMask : nullptr;
+        case PROC_vkCmdDispatchBase:
+            return has1_1OrHigher ? (void*)entry_vkCmdDispatchBase : nullptr;
+        case PROC_vkEnumeratePhysicalDeviceGroups:
+            return nullptr;
+        case PROC_vkGetImageMemoryRequirements2:
+            return (void*)dynCheck_entry_vkGetImageMemoryRequirements2;
+        case PROC_vkGetBufferMemoryRequirements2:
+            return (void*)dynCheck_entry_vkGetBufferMemoryRequirements2;
+        case PROC_vkGetImageSparseMemoryRequirements2:
+            return (void*)dynCheck_entry_vkGetImageSparseMemoryRequirements2;
+        case PROC_vkGetPhysicalDeviceFeatures2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceFeatures2 : nullptr;
+        case PROC_vkGetPhysicalDeviceProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceFormatProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceFormatProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceImageFormatProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceImageFormatProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceMemoryProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceMemoryProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties2: {
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties2
+                                  : nullptr;
+        }
+        case PROC_vkTrimCommandPool:
+            return (void*)dynCheck_entry_vkTrimCommandPool;
+        case PROC_vkGetDeviceQueue2:
+            return (void*)dynCheck_entry_vkGetDeviceQueue2;
+        case PROC_vkCreateSamplerYcbcrConversion:
+            return (void*)dynCheck_entry_vkCreateSamplerYcbcrConversion;
+        case PROC_vkDestroySamplerYcbcrConversion:
+            return (void*)dynCheck_entry_vkDestroySamplerYcbcrConversion;
+        case PROC_vkCreateDescriptorUpdateTemplate:
+            return (void*)dynCheck_entry_vkCreateDescriptorUpdateTemplate;
+        case PROC_vkDestroyDescriptorUpdateTemplate:
+            return (void*)dynCheck_entry_vkDestroyDescriptorUpdateTemplate;
+        case PROC_vkUpdateDescriptorSetWithTemplate:
+            return (void*)dynCheck_entry_vkUpdateDescriptorSetWithTemplate;
+        case PROC_vkGetPhysicalDeviceExternalBufferProperties:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalBufferProperties : nullptr;
+        case PROC_vkGetPhysicalDeviceExternalFenceProperties:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalFenceProperties : nullptr;
+        case PROC_vkGetPhysicalDeviceExternalSemaphoreProperties: {
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalSemaphoreProperties
+                                  : nullptr;
+        }
+        case PROC_vkGetDescriptorSetLayoutSupport:
+            return (void*)dynCheck_entry_vkGetDescriptorSetLayoutSupport;
 #endif
 #ifdef VK_VERSION_1_2
-    if (!strcmp(name, "vkCmdDrawIndirectCount")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdDrawIndirectCount : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCount")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdDrawIndexedIndirectCount : nullptr;
-    }
-    if (!strcmp(name, "vkCreateRenderPass2")) {
-        return (void*)dynCheck_entry_vkCreateRenderPass2;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass2")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdBeginRenderPass2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass2")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdNextSubpass2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass2")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdEndRenderPass2 : nullptr;
-    }
-    if (!strcmp(name, "vkResetQueryPool")) {
-        return (void*)dynCheck_entry_vkResetQueryPool;
-    }
-    if (!strcmp(name, "vkGetSemaphoreCounterValue")) {
-        return (void*)dynCheck_entry_vkGetSemaphoreCounterValue;
-    }
-    if (!strcmp(name, "vkWaitSemaphores")) {
-        return (void*)dynCheck_entry_vkWaitSemaphores;
-    }
-    if (!strcmp(name, "vkSignalSemaphore")) {
-        return (void*)dynCheck_entry_vkSignalSemaphore;
-    }
-    if (!strcmp(name, "vkGetBufferDeviceAddress")) {
-        return (void*)dynCheck_entry_vkGetBufferDeviceAddress;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureAddress")) {
-        return (void*)dynCheck_entry_vkGetBufferOpaqueCaptureAddress;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryOpaqueCaptureAddress")) {
-        return (void*)dynCheck_entry_vkGetDeviceMemoryOpaqueCaptureAddress;
-    }
+        case PROC_vkCmdDrawIndirectCount:
+            return has1_2OrHigher ? (void*)entry_vkCmdDrawIndirectCount : nullptr;
+        case PROC_vkCmdDrawIndexedIndirectCount:
+            return has1_2OrHigher ? (void*)entry_vkCmdDrawIndexedIndirectCount : nullptr;
+        case PROC_vkCreateRenderPass2:
+            return (void*)dynCheck_entry_vkCreateRenderPass2;
+        case PROC_vkCmdBeginRenderPass2:
+            return has1_2OrHigher ? (void*)entry_vkCmdBeginRenderPass2 : nullptr;
+        case PROC_vkCmdNextSubpass2:
+            return has1_2OrHigher ? (void*)entry_vkCmdNextSubpass2 : nullptr;
+        case PROC_vkCmdEndRenderPass2:
+            return has1_2OrHigher ? (void*)entry_vkCmdEndRenderPass2 : nullptr;
+        case PROC_vkResetQueryPool:
+            return (void*)dynCheck_entry_vkResetQueryPool;
+        case PROC_vkGetSemaphoreCounterValue:
+            return (void*)dynCheck_entry_vkGetSemaphoreCounterValue;
+        case PROC_vkWaitSemaphores:
+            return (void*)dynCheck_entry_vkWaitSemaphores;
+        case PROC_vkSignalSemaphore:
+            return (void*)dynCheck_entry_vkSignalSemaphore;
+        case PROC_vkGetBufferDeviceAddress:
+            return (void*)dynCheck_entry_vkGetBufferDeviceAddress;
+        case PROC_vkGetBufferOpaqueCaptureAddress:
+            return (void*)dynCheck_entry_vkGetBufferOpaqueCaptureAddress;
+        case PROC_vkGetDeviceMemoryOpaqueCaptureAddress:
+            return (void*)dynCheck_entry_vkGetDeviceMemoryOpaqueCaptureAddress;
 #endif
 #ifdef VK_VERSION_1_3
-    if (!strcmp(name, "vkGetPhysicalDeviceToolProperties")) {
-        return has1_3OrHigher ? (void*)entry_vkGetPhysicalDeviceToolProperties : nullptr;
-    }
-    if (!strcmp(name, "vkCreatePrivateDataSlot")) {
-        return (void*)dynCheck_entry_vkCreatePrivateDataSlot;
-    }
-    if (!strcmp(name, "vkDestroyPrivateDataSlot")) {
-        return (void*)dynCheck_entry_vkDestroyPrivateDataSlot;
-    }
-    if (!strcmp(name, "vkSetPrivateData")) {
-        return (void*)dynCheck_entry_vkSetPrivateData;
-    }
-    if (!strcmp(name, "vkGetPrivateData")) {
-        return (void*)dynCheck_entry_vkGetPrivateData;
-    }
-    if (!strcmp(name, "vkCmdSetEvent2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetEvent2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdResetEvent2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdResetEvent2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdWaitEvents2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdPipelineBarrier2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdWriteTimestamp2 : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmit2")) {
-        return has1_3OrHigher ? (void*)entry_vkQueueSubmit2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyBuffer2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdCopyBuffer2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImage2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdCopyImage2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdCopyBufferToImage2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdCopyImageToBuffer2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBlitImage2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdBlitImage2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdResolveImage2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdResolveImage2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginRendering")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdBeginRendering : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRendering")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdEndRendering : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCullMode")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetCullMode : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetFrontFace")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetFrontFace : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveTopology")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetPrimitiveTopology : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWithCount")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetViewportWithCount : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetScissorWithCount")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetScissorWithCount : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdBindVertexBuffers2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthTestEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthTestEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthWriteEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthWriteEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthCompareOp")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthCompareOp : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBoundsTestEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthBoundsTestEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilTestEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetStencilTestEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilOp")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetStencilOp : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizerDiscardEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetRasterizerDiscardEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBiasEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthBiasEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveRestartEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetPrimitiveRestartEnable : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceBufferMemoryRequirements")) {
-        return (void*)dynCheck_entry_vkGetDeviceBufferMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetDeviceImageMemoryRequirements")) {
-        return (void*)dynCheck_entry_vkGetDeviceImageMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetDeviceImageSparseMemoryRequirements")) {
-        return (void*)dynCheck_entry_vkGetDeviceImageSparseMemoryRequirements;
-    }
+        case PROC_vkGetPhysicalDeviceToolProperties:
+            return has1_3OrHigher ? (void*)entry_vkGetPhysicalDeviceToolProperties : nullptr;
+        case PROC_vkCreatePrivateDataSlot:
+            return (void*)dynCheck_entry_vkCreatePrivateDataSlot;
+        case PROC_vkDestroyPrivateDataSlot:
+            return (void*)dynCheck_entry_vkDestroyPrivateDataSlot;
+        case PROC_vkSetPrivateData:
+            return (void*)dynCheck_entry_vkSetPrivateData;
+        case PROC_vkGetPrivateData:
+            return (void*)dynCheck_entry_vkGetPrivateData;
+        case PROC_vkCmdSetEvent2:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetEvent2 : nullptr;
+        case PROC_vkCmdResetEvent2:
+            return has1_3OrHigher ? (void*)entry_vkCmdResetEvent2 : nullptr;
+        case PROC_vkCmdWaitEvents2:
+            return has1_3OrHigher ? (void*)entry_vkCmdWaitEvents2 : nullptr;
+        case PROC_vkCmdPipelineBarrier2:
+            return has1_3OrHigher ? (void*)entry_vkCmdPipelineBarrier2 : nullptr;
+        case PROC_vkCmdWriteTimestamp2:
+            return has1_3OrHigher ? (void*)entry_vkCmdWriteTimestamp2 : nullptr;
+        case PROC_vkQueueSubmit2:
+            return has1_3OrHigher ? (void*)entry_vkQueueSubmit2 : nullptr;
+        case PROC_vkCmdCopyBuffer2:
+            return has1_3OrHigher ? (void*)entry_vkCmdCopyBuffer2 : nullptr;
+        case PROC_vkCmdCopyImage2:
+            return has1_3OrHigher ? (void*)entry_vkCmdCopyImage2 : nullptr;
+        case PROC_vkCmdCopyBufferToImage2:
+            return has1_3OrHigher ? (void*)entry_vkCmdCopyBufferToImage2 : nullptr;
+        case PROC_vkCmdCopyImageToBuffer2:
+            return has1_3OrHigher ? (void*)entry_vkCmdCopyImageToBuffer2 : nullptr;
+        case PROC_vkCmdBlitImage2:
+            return has1_3OrHigher ? (void*)entry_vkCmdBlitImage2 : nullptr;
+        case PROC_vkCmdResolveImage2:
+            return has1_3OrHigher ? (void*)entry_vkCmdResolveImage2 : nullptr;
+        case PROC_vkCmdBeginRendering:
+            return has1_3OrHigher ? (void*)entry_vkCmdBeginRendering : nullptr;
+        case PROC_vkCmdEndRendering:
+            return has1_3OrHigher ? (void*)entry_vkCmdEndRendering : nullptr;
+        case PROC_vkCmdSetCullMode:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetCullMode : nullptr;
+        case PROC_vkCmdSetFrontFace:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetFrontFace : nullptr;
+        case PROC_vkCmdSetPrimitiveTopology:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetPrimitiveTopology : nullptr;
+        case PROC_vkCmdSetViewportWithCount:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetViewportWithCount : nullptr;
+        case PROC_vkCmdSetScissorWithCount:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetScissorWithCount : nullptr;
+        case PROC_vkCmdBindVertexBuffers2:
+            return has1_3OrHigher ? (void*)entry_vkCmdBindVertexBuffers2 : nullptr;
+        case PROC_vkCmdSetDepthTestEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthTestEnable : nullptr;
+        case PROC_vkCmdSetDepthWriteEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthWriteEnable : nullptr;
+        case PROC_vkCmdSetDepthCompareOp:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthCompareOp : nullptr;
+        case PROC_vkCmdSetDepthBoundsTestEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthBoundsTestEnable : nullptr;
+        case PROC_vkCmdSetStencilTestEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetStencilTestEnable : nullptr;
+        case PROC_vkCmdSetStencilOp:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetStencilOp : nullptr;
+        case PROC_vkCmdSetRasterizerDiscardEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetRasterizerDiscardEnable : nullptr;
+        case PROC_vkCmdSetDepthBiasEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthBiasEnable : nullptr;
+        case PROC_vkCmdSetPrimitiveRestartEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetPrimitiveRestartEnable : nullptr;
+        case PROC_vkGetDeviceBufferMemoryRequirements:
+            return (void*)dynCheck_entry_vkGetDeviceBufferMemoryRequirements;
+        case PROC_vkGetDeviceImageMemoryRequirements:
+            return (void*)dynCheck_entry_vkGetDeviceImageMemoryRequirements;
+        case PROC_vkGetDeviceImageSparseMemoryRequirements:
+            return (void*)dynCheck_entry_vkGetDeviceImageSparseMemoryRequirements;
 #endif
 #ifdef VK_KHR_surface
-    if (!strcmp(name, "vkDestroySurfaceKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkDestroySurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceSupportKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceSupportKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilitiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceFormatsKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceFormatsKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfacePresentModesKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfacePresentModesKHR : nullptr;
-    }
+        case PROC_vkDestroySurfaceKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkDestroySurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfaceSupportKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceSupportKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilitiesKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilitiesKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfaceFormatsKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceFormatsKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfacePresentModesKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfacePresentModesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_swapchain
-    if (!strcmp(name, "vkCreateSwapchainKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateSwapchainKHR;
-    }
-    if (!strcmp(name, "vkDestroySwapchainKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroySwapchainKHR;
-    }
-    if (!strcmp(name, "vkGetSwapchainImagesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSwapchainImagesKHR;
-    }
-    if (!strcmp(name, "vkAcquireNextImageKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkAcquireNextImageKHR;
-    }
-    if (!strcmp(name, "vkQueuePresentKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkQueuePresentKHR;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupPresentCapabilitiesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceGroupPresentCapabilitiesKHR;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupSurfacePresentModesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceGroupSurfacePresentModesKHR;
-    }
-    if (!strcmp(name, "vkGetPhysicalDevicePresentRectanglesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDevicePresentRectanglesKHR;
-    }
-    if (!strcmp(name, "vkAcquireNextImage2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkAcquireNextImage2KHR;
-    }
+        case PROC_vkCreateSwapchainKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateSwapchainKHR;
+        }
+        case PROC_vkDestroySwapchainKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroySwapchainKHR;
+        }
+        case PROC_vkGetSwapchainImagesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSwapchainImagesKHR;
+        }
+        case PROC_vkAcquireNextImageKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkAcquireNextImageKHR;
+        }
+        case PROC_vkQueuePresentKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkQueuePresentKHR;
+        }
+        case PROC_vkGetDeviceGroupPresentCapabilitiesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceGroupPresentCapabilitiesKHR;
+        }
+        case PROC_vkGetDeviceGroupSurfacePresentModesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceGroupSurfacePresentModesKHR;
+        }
+        case PROC_vkGetPhysicalDevicePresentRectanglesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDevicePresentRectanglesKHR;
+        }
+        case PROC_vkAcquireNextImage2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkAcquireNextImage2KHR;
+        }
 #endif
 #ifdef VK_KHR_display
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPropertiesKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPlanePropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneSupportedDisplaysKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetDisplayPlaneSupportedDisplaysKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayModePropertiesKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetDisplayModePropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCreateDisplayModeKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkCreateDisplayModeKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneCapabilitiesKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetDisplayPlaneCapabilitiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCreateDisplayPlaneSurfaceKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkCreateDisplayPlaneSurfaceKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceDisplayPropertiesKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPropertiesKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceDisplayPlanePropertiesKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPlanePropertiesKHR : nullptr;
+        }
+        case PROC_vkGetDisplayPlaneSupportedDisplaysKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetDisplayPlaneSupportedDisplaysKHR : nullptr;
+        }
+        case PROC_vkGetDisplayModePropertiesKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetDisplayModePropertiesKHR : nullptr;
+        }
+        case PROC_vkCreateDisplayModeKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkCreateDisplayModeKHR : nullptr;
+        }
+        case PROC_vkGetDisplayPlaneCapabilitiesKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetDisplayPlaneCapabilitiesKHR : nullptr;
+        }
+        case PROC_vkCreateDisplayPlaneSurfaceKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkCreateDisplayPlaneSurfaceKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_display_swapchain
-    if (!strcmp(name, "vkCreateSharedSwapchainsKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateSharedSwapchainsKHR;
-    }
+        case PROC_vkCreateSharedSwapchainsKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateSharedSwapchainsKHR;
+        }
 #endif
 #ifdef VK_KHR_xlib_surface
-    if (!strcmp(name, "vkCreateXlibSurfaceKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_xlib_surface");
-        return hasExt ? (void*)entry_vkCreateXlibSurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceXlibPresentationSupportKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_xlib_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceXlibPresentationSupportKHR : nullptr;
-    }
+        case PROC_vkCreateXlibSurfaceKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_xlib_surface");
+            return hasExt ? (void*)entry_vkCreateXlibSurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceXlibPresentationSupportKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_xlib_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceXlibPresentationSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_xcb_surface
-    if (!strcmp(name, "vkCreateXcbSurfaceKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_xcb_surface");
-        return hasExt ? (void*)entry_vkCreateXcbSurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceXcbPresentationSupportKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_xcb_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceXcbPresentationSupportKHR : nullptr;
-    }
+        case PROC_vkCreateXcbSurfaceKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_xcb_surface");
+            return hasExt ? (void*)entry_vkCreateXcbSurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceXcbPresentationSupportKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_xcb_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceXcbPresentationSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_wayland_surface
-    if (!strcmp(name, "vkCreateWaylandSurfaceKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_wayland_surface");
-        return hasExt ? (void*)entry_vkCreateWaylandSurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceWaylandPresentationSupportKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_wayland_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceWaylandPresentationSupportKHR : nullptr;
-    }
+        case PROC_vkCreateWaylandSurfaceKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_wayland_surface");
+            return hasExt ? (void*)entry_vkCreateWaylandSurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceWaylandPresentationSupportKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_wayland_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceWaylandPresentationSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_android_surface
-    if (!strcmp(name, "vkCreateAndroidSurfaceKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_android_surface");
-        return hasExt ? (void*)entry_vkCreateAndroidSurfaceKHR : nullptr;
-    }
+        case PROC_vkCreateAndroidSurfaceKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_android_surface");
+            return hasExt ? (void*)entry_vkCreateAndroidSurfaceKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_win32_surface
-    if (!strcmp(name, "vkCreateWin32SurfaceKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_win32_surface");
-        return hasExt ? (void*)entry_vkCreateWin32SurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceWin32PresentationSupportKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_win32_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceWin32PresentationSupportKHR : nullptr;
-    }
+        case PROC_vkCreateWin32SurfaceKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_win32_surface");
+            return hasExt ? (void*)entry_vkCreateWin32SurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceWin32PresentationSupportKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_win32_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceWin32PresentationSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_video_queue
-    if (!strcmp(name, "vkGetPhysicalDeviceVideoCapabilitiesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceVideoCapabilitiesKHR;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceVideoFormatPropertiesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceVideoFormatPropertiesKHR;
-    }
-    if (!strcmp(name, "vkCreateVideoSessionKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateVideoSessionKHR;
-    }
-    if (!strcmp(name, "vkDestroyVideoSessionKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyVideoSessionKHR;
-    }
-    if (!strcmp(name, "vkGetVideoSessionMemoryRequirementsKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetVideoSessionMemoryRequirementsKHR;
-    }
-    if (!strcmp(name, "vkBindVideoSessionMemoryKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkBindVideoSessionMemoryKHR;
-    }
-    if (!strcmp(name, "vkCreateVideoSessionParametersKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateVideoSessionParametersKHR;
-    }
-    if (!strcmp(name, "vkUpdateVideoSessionParametersKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkUpdateVideoSessionParametersKHR;
-    }
-    if (!strcmp(name, "vkDestroyVideoSessionParametersKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyVideoSessionParametersKHR;
-    }
-    if (!strcmp(name, "vkCmdBeginVideoCodingKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBeginVideoCodingKHR;
-    }
-    if (!strcmp(name, "vkCmdEndVideoCodingKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdEndVideoCodingKHR;
-    }
-    if (!strcmp(name, "vkCmdControlVideoCodingKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdControlVideoCodingKHR;
-    }
+        case PROC_vkGetPhysicalDeviceVideoCapabilitiesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceVideoCapabilitiesKHR;
+        }
+        case PROC_vkGetPhysicalDeviceVideoFormatPropertiesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceVideoFormatPropertiesKHR;
+        }
+        case PROC_vkCreateVideoSessionKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateVideoSessionKHR;
+        }
+        case PROC_vkDestroyVideoSessionKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyVideoSessionKHR;
+        }
+        case PROC_vkGetVideoSessionMemoryRequirementsKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetVideoSessionMemoryRequirementsKHR;
+        }
+        case PROC_vkBindVideoSessionMemoryKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkBindVideoSessionMemoryKHR;
+        }
+        case PROC_vkCreateVideoSessionParametersKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateVideoSessionParametersKHR;
+        }
+        case PROC_vkUpdateVideoSessionParametersKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkUpdateVideoSessionParametersKHR;
+        }
+        case PROC_vkDestroyVideoSessionParametersKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyVideoSessionParametersKHR;
+        }
+        case PROC_vkCmdBeginVideoCodingKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBeginVideoCodingKHR;
+        }
+        case PROC_vkCmdEndVideoCodingKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdEndVideoCodingKHR;
+        }
+        case PROC_vkCmdControlVideoCodingKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdControlVideoCodingKHR;
+        }
 #endif
 #ifdef VK_KHR_video_decode_queue
-    if (!strcmp(name, "vkCmdDecodeVideoKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDecodeVideoKHR;
-    }
+        case PROC_vkCmdDecodeVideoKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDecodeVideoKHR;
+        }
 #endif
 #ifdef VK_KHR_dynamic_rendering
-    if (!strcmp(name, "vkCmdBeginRenderingKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBeginRenderingKHR;
-    }
-    if (!strcmp(name, "vkCmdEndRenderingKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdEndRenderingKHR;
-    }
+        case PROC_vkCmdBeginRenderingKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBeginRenderingKHR;
+        }
+        case PROC_vkCmdEndRenderingKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdEndRenderingKHR;
+        }
 #endif
 #ifdef VK_KHR_get_physical_device_properties2
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures2KHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceFeatures2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties2KHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties2KHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceFormatProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties2KHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceImageFormatProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties2KHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties2KHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceMemoryProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties2KHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceFeatures2KHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceFeatures2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceProperties2KHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceFormatProperties2KHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceFormatProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceImageFormatProperties2KHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceImageFormatProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties2KHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceMemoryProperties2KHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceMemoryProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties2KHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_device_group
-    if (!strcmp(name, "vkGetDeviceGroupPeerMemoryFeaturesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceGroupPeerMemoryFeaturesKHR;
-    }
-    if (!strcmp(name, "vkCmdSetDeviceMaskKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDeviceMaskKHR;
-    }
-    if (!strcmp(name, "vkCmdDispatchBaseKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDispatchBaseKHR;
-    }
+        case PROC_vkGetDeviceGroupPeerMemoryFeaturesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceGroupPeerMemoryFeaturesKHR;
+        }
+        case PROC_vkCmdSetDeviceMaskKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDeviceMaskKHR;
+        }
+        case PROC_vkCmdDispatchBaseKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDispatchBaseKHR;
+        }
 #endif
 #ifdef VK_KHR_maintenance1
-    if (!strcmp(name, "vkTrimCommandPoolKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkTrimCommandPoolKHR;
-    }
+        case PROC_vkTrimCommandPoolKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkTrimCommandPoolKHR;
+        }
 #endif
 #ifdef VK_KHR_device_group_creation
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceGroupsKHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_device_group_creation");
-        return hasExt ? (void*)entry_vkEnumeratePhysicalDeviceGroupsKHR : nullptr;
-    }
+        case PROC_vkEnumeratePhysicalDeviceGroupsKHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_device_group_creation");
+            return hasExt ? (void*)entry_vkEnumeratePhysicalDeviceGroupsKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_memory_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalBufferPropertiesKHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_external_memory_capabilities");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalBufferPropertiesKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalBufferPropertiesKHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_external_memory_capabilities");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalBufferPropertiesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_memory_win32
-    if (!strcmp(name, "vkGetMemoryWin32HandleKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryWin32HandleKHR;
-    }
-    if (!strcmp(name, "vkGetMemoryWin32HandlePropertiesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryWin32HandlePropertiesKHR;
-    }
+        case PROC_vkGetMemoryWin32HandleKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryWin32HandleKHR;
+        }
+        case PROC_vkGetMemoryWin32HandlePropertiesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryWin32HandlePropertiesKHR;
+        }
 #endif
 #ifdef VK_KHR_external_memory_fd
-    if (!strcmp(name, "vkGetMemoryFdKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryFdKHR;
-    }
-    if (!strcmp(name, "vkGetMemoryFdPropertiesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryFdPropertiesKHR;
-    }
+        case PROC_vkGetMemoryFdKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryFdKHR;
+        }
+        case PROC_vkGetMemoryFdPropertiesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryFdPropertiesKHR;
+        }
 #endif
 #ifdef VK_KHR_external_semaphore_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_external_semaphore_capabilities");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_external_semaphore_capabilities");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_semaphore_win32
-    if (!strcmp(name, "vkImportSemaphoreWin32HandleKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkImportSemaphoreWin32HandleKHR;
-    }
-    if (!strcmp(name, "vkGetSemaphoreWin32HandleKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSemaphoreWin32HandleKHR;
-    }
+        case PROC_vkImportSemaphoreWin32HandleKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkImportSemaphoreWin32HandleKHR;
+        }
+        case PROC_vkGetSemaphoreWin32HandleKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSemaphoreWin32HandleKHR;
+        }
 #endif
 #ifdef VK_KHR_external_semaphore_fd
-    if (!strcmp(name, "vkImportSemaphoreFdKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkImportSemaphoreFdKHR;
-    }
-    if (!strcmp(name, "vkGetSemaphoreFdKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSemaphoreFdKHR;
-    }
+        case PROC_vkImportSemaphoreFdKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkImportSemaphoreFdKHR;
+        }
+        case PROC_vkGetSemaphoreFdKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSemaphoreFdKHR;
+        }
 #endif
 #ifdef VK_KHR_push_descriptor
-    if (!strcmp(name, "vkCmdPushDescriptorSetKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdPushDescriptorSetKHR;
-    }
-    if (!strcmp(name, "vkCmdPushDescriptorSetWithTemplateKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdPushDescriptorSetWithTemplateKHR;
-    }
+        case PROC_vkCmdPushDescriptorSetKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdPushDescriptorSetKHR;
+        }
+        case PROC_vkCmdPushDescriptorSetWithTemplateKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdPushDescriptorSetWithTemplateKHR;
+        }
 #endif
 #ifdef VK_KHR_descriptor_update_template
-    if (!strcmp(name, "vkCreateDescriptorUpdateTemplateKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateDescriptorUpdateTemplateKHR;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorUpdateTemplateKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyDescriptorUpdateTemplateKHR;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkUpdateDescriptorSetWithTemplateKHR;
-    }
+        case PROC_vkCreateDescriptorUpdateTemplateKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateDescriptorUpdateTemplateKHR;
+        }
+        case PROC_vkDestroyDescriptorUpdateTemplateKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyDescriptorUpdateTemplateKHR;
+        }
+        case PROC_vkUpdateDescriptorSetWithTemplateKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkUpdateDescriptorSetWithTemplateKHR;
+        }
 #endif
 #ifdef VK_KHR_create_renderpass2
-    if (!strcmp(name, "vkCreateRenderPass2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateRenderPass2KHR;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBeginRenderPass2KHR;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdNextSubpass2KHR;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdEndRenderPass2KHR;
-    }
+        case PROC_vkCreateRenderPass2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateRenderPass2KHR;
+        }
+        case PROC_vkCmdBeginRenderPass2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBeginRenderPass2KHR;
+        }
+        case PROC_vkCmdNextSubpass2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdNextSubpass2KHR;
+        }
+        case PROC_vkCmdEndRenderPass2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdEndRenderPass2KHR;
+        }
 #endif
 #ifdef VK_KHR_shared_presentable_image
-    if (!strcmp(name, "vkGetSwapchainStatusKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSwapchainStatusKHR;
-    }
+        case PROC_vkGetSwapchainStatusKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSwapchainStatusKHR;
+        }
 #endif
 #ifdef VK_KHR_external_fence_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalFencePropertiesKHR")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_KHR_external_fence_capabilities");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalFencePropertiesKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalFencePropertiesKHR: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_KHR_external_fence_capabilities");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalFencePropertiesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_fence_win32
-    if (!strcmp(name, "vkImportFenceWin32HandleKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkImportFenceWin32HandleKHR;
-    }
-    if (!strcmp(name, "vkGetFenceWin32HandleKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetFenceWin32HandleKHR;
-    }
+        case PROC_vkImportFenceWin32HandleKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkImportFenceWin32HandleKHR;
+        }
+        case PROC_vkGetFenceWin32HandleKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetFenceWin32HandleKHR;
+        }
 #endif
 #ifdef VK_KHR_external_fence_fd
-    if (!strcmp(name, "vkImportFenceFdKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkImportFenceFdKHR;
-    }
-    if (!strcmp(name, "vkGetFenceFdKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetFenceFdKHR;
-    }
+        case PROC_vkImportFenceFdKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkImportFenceFdKHR;
+        }
+        case PROC_vkGetFenceFdKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetFenceFdKHR;
+        }
 #endif
 #ifdef VK_KHR_performance_query
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
-    }
-    if (!strcmp(name, "vkAcquireProfilingLockKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkAcquireProfilingLockKHR;
-    }
-    if (!strcmp(name, "vkReleaseProfilingLockKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkReleaseProfilingLockKHR;
-    }
+        case PROC_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+        }
+        case PROC_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+        }
+        case PROC_vkAcquireProfilingLockKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkAcquireProfilingLockKHR;
+        }
+        case PROC_vkReleaseProfilingLockKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkReleaseProfilingLockKHR;
+        }
 #endif
 #ifdef VK_KHR_get_surface_capabilities2
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilities2KHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_surface_capabilities2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilities2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceFormats2KHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_surface_capabilities2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceFormats2KHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilities2KHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_surface_capabilities2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilities2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfaceFormats2KHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_surface_capabilities2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceFormats2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_get_display_properties2
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayProperties2KHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_display_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_display_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPlaneProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayModeProperties2KHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_display_properties2");
-        return hasExt ? (void*)entry_vkGetDisplayModeProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneCapabilities2KHR")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_display_properties2");
-        return hasExt ? (void*)entry_vkGetDisplayPlaneCapabilities2KHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceDisplayProperties2KHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_display_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceDisplayPlaneProperties2KHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_display_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPlaneProperties2KHR : nullptr;
+        }
+        case PROC_vkGetDisplayModeProperties2KHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_display_properties2");
+            return hasExt ? (void*)entry_vkGetDisplayModeProperties2KHR : nullptr;
+        }
+        case PROC_vkGetDisplayPlaneCapabilities2KHR: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_KHR_get_display_properties2");
+            return hasExt ? (void*)entry_vkGetDisplayPlaneCapabilities2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_get_memory_requirements2
-    if (!strcmp(name, "vkGetImageMemoryRequirements2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetImageMemoryRequirements2KHR;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetBufferMemoryRequirements2KHR;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetImageSparseMemoryRequirements2KHR;
-    }
+        case PROC_vkGetImageMemoryRequirements2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetImageMemoryRequirements2KHR;
+        }
+        case PROC_vkGetBufferMemoryRequirements2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetBufferMemoryRequirements2KHR;
+        }
+        case PROC_vkGetImageSparseMemoryRequirements2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetImageSparseMemoryRequirements2KHR;
+        }
 #endif
 #ifdef VK_KHR_sampler_ycbcr_conversion
-    if (!strcmp(name, "vkCreateSamplerYcbcrConversionKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateSamplerYcbcrConversionKHR;
-    }
-    if (!strcmp(name, "vkDestroySamplerYcbcrConversionKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroySamplerYcbcrConversionKHR;
-    }
+        case PROC_vkCreateSamplerYcbcrConversionKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateSamplerYcbcrConversionKHR;
+        }
+        case PROC_vkDestroySamplerYcbcrConversionKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroySamplerYcbcrConversionKHR;
+        }
 #endif
 #ifdef VK_KHR_bind_memory2
-    if (!strcmp(name, "vkBindBufferMemory2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkBindBufferMemory2KHR;
-    }
-    if (!strcmp(name, "vkBindImageMemory2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkBindImageMemory2KHR;
-    }
+        case PROC_vkBindBufferMemory2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkBindBufferMemory2KHR;
+        }
+        case PROC_vkBindImageMemory2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkBindImageMemory2KHR;
+        }
 #endif
 #ifdef VK_KHR_maintenance3
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSupportKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDescriptorSetLayoutSupportKHR;
-    }
+        case PROC_vkGetDescriptorSetLayoutSupportKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDescriptorSetLayoutSupportKHR;
+        }
 #endif
 #ifdef VK_KHR_draw_indirect_count
-    if (!strcmp(name, "vkCmdDrawIndirectCountKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawIndirectCountKHR;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCountKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawIndexedIndirectCountKHR;
-    }
+        case PROC_vkCmdDrawIndirectCountKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawIndirectCountKHR;
+        }
+        case PROC_vkCmdDrawIndexedIndirectCountKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawIndexedIndirectCountKHR;
+        }
 #endif
 #ifdef VK_KHR_timeline_semaphore
-    if (!strcmp(name, "vkGetSemaphoreCounterValueKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSemaphoreCounterValueKHR;
-    }
-    if (!strcmp(name, "vkWaitSemaphoresKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkWaitSemaphoresKHR;
-    }
-    if (!strcmp(name, "vkSignalSemaphoreKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkSignalSemaphoreKHR;
-    }
+        case PROC_vkGetSemaphoreCounterValueKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSemaphoreCounterValueKHR;
+        }
+        case PROC_vkWaitSemaphoresKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkWaitSemaphoresKHR;
+        }
+        case PROC_vkSignalSemaphoreKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkSignalSemaphoreKHR;
+        }
 #endif
 #ifdef VK_KHR_fragment_shading_rate
-    if (!strcmp(name, "vkGetPhysicalDeviceFragmentShadingRatesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceFragmentShadingRatesKHR;
-    }
-    if (!strcmp(name, "vkCmdSetFragmentShadingRateKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetFragmentShadingRateKHR;
-    }
+        case PROC_vkGetPhysicalDeviceFragmentShadingRatesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceFragmentShadingRatesKHR;
+        }
+        case PROC_vkCmdSetFragmentShadingRateKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetFragmentShadingRateKHR;
+        }
 #endif
 #ifdef VK_KHR_present_wait
-    if (!strcmp(name, "vkWaitForPresentKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkWaitForPresentKHR;
-    }
+        case PROC_vkWaitForPresentKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkWaitForPresentKHR;
+        }
 #endif
 #ifdef VK_KHR_buffer_device_address
-    if (!strcmp(name, "vkGetBufferDeviceAddressKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetBufferDeviceAddressKHR;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureAddressKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetBufferOpaqueCaptureAddressKHR;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryOpaqueCaptureAddressKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceMemoryOpaqueCaptureAddressKHR;
-    }
+        case PROC_vkGetBufferDeviceAddressKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetBufferDeviceAddressKHR;
+        }
+        case PROC_vkGetBufferOpaqueCaptureAddressKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetBufferOpaqueCaptureAddressKHR;
+        }
+        case PROC_vkGetDeviceMemoryOpaqueCaptureAddressKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+        }
 #endif
 #ifdef VK_KHR_deferred_host_operations
-    if (!strcmp(name, "vkCreateDeferredOperationKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateDeferredOperationKHR;
-    }
-    if (!strcmp(name, "vkDestroyDeferredOperationKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyDeferredOperationKHR;
-    }
-    if (!strcmp(name, "vkGetDeferredOperationMaxConcurrencyKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeferredOperationMaxConcurrencyKHR;
-    }
-    if (!strcmp(name, "vkGetDeferredOperationResultKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeferredOperationResultKHR;
-    }
-    if (!strcmp(name, "vkDeferredOperationJoinKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDeferredOperationJoinKHR;
-    }
+        case PROC_vkCreateDeferredOperationKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateDeferredOperationKHR;
+        }
+        case PROC_vkDestroyDeferredOperationKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyDeferredOperationKHR;
+        }
+        case PROC_vkGetDeferredOperationMaxConcurrencyKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeferredOperationMaxConcurrencyKHR;
+        }
+        case PROC_vkGetDeferredOperationResultKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeferredOperationResultKHR;
+        }
+        case PROC_vkDeferredOperationJoinKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDeferredOperationJoinKHR;
+        }
 #endif
 #ifdef VK_KHR_pipeline_executable_properties
-    if (!strcmp(name, "vkGetPipelineExecutablePropertiesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetPipelineExecutablePropertiesKHR;
-    }
-    if (!strcmp(name, "vkGetPipelineExecutableStatisticsKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetPipelineExecutableStatisticsKHR;
-    }
-    if (!strcmp(name, "vkGetPipelineExecutableInternalRepresentationsKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetPipelineExecutableInternalRepresentationsKHR;
-    }
+        case PROC_vkGetPipelineExecutablePropertiesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetPipelineExecutablePropertiesKHR;
+        }
+        case PROC_vkGetPipelineExecutableStatisticsKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetPipelineExecutableStatisticsKHR;
+        }
+        case PROC_vkGetPipelineExecutableInternalRepresentationsKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetPipelineExecutableInternalRepresentationsKHR;
+        }
 #endif
 #ifdef VK_KHR_map_memory2
-    if (!strcmp(name, "vkMapMemory2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkMapMemory2KHR;
-    }
-    if (!strcmp(name, "vkUnmapMemory2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkUnmapMemory2KHR;
-    }
+        case PROC_vkMapMemory2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkMapMemory2KHR;
+        }
+        case PROC_vkUnmapMemory2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkUnmapMemory2KHR;
+        }
 #endif
 #ifdef VK_KHR_video_encode_queue
-    if (!strcmp(name, "vkCmdEncodeVideoKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdEncodeVideoKHR;
-    }
+        case PROC_vkCmdEncodeVideoKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdEncodeVideoKHR;
+        }
 #endif
 #ifdef VK_KHR_synchronization2
-    if (!strcmp(name, "vkCmdSetEvent2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetEvent2KHR;
-    }
-    if (!strcmp(name, "vkCmdResetEvent2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdResetEvent2KHR;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdWaitEvents2KHR;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdPipelineBarrier2KHR;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdWriteTimestamp2KHR;
-    }
-    if (!strcmp(name, "vkQueueSubmit2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkQueueSubmit2KHR;
-    }
-    if (!strcmp(name, "vkCmdWriteBufferMarker2AMD")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdWriteBufferMarker2AMD;
-    }
-    if (!strcmp(name, "vkGetQueueCheckpointData2NV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetQueueCheckpointData2NV;
-    }
+        case PROC_vkCmdSetEvent2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetEvent2KHR;
+        }
+        case PROC_vkCmdResetEvent2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdResetEvent2KHR;
+        }
+        case PROC_vkCmdWaitEvents2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdWaitEvents2KHR;
+        }
+        case PROC_vkCmdPipelineBarrier2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdPipelineBarrier2KHR;
+        }
+        case PROC_vkCmdWriteTimestamp2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdWriteTimestamp2KHR;
+        }
+        case PROC_vkQueueSubmit2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkQueueSubmit2KHR;
+        }
+        case PROC_vkCmdWriteBufferMarker2AMD: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdWriteBufferMarker2AMD;
+        }
+        case PROC_vkGetQueueCheckpointData2NV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetQueueCheckpointData2NV;
+        }
 #endif
 #ifdef VK_KHR_copy_commands2
-    if (!strcmp(name, "vkCmdCopyBuffer2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyBuffer2KHR;
-    }
-    if (!strcmp(name, "vkCmdCopyImage2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyImage2KHR;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyBufferToImage2KHR;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyImageToBuffer2KHR;
-    }
-    if (!strcmp(name, "vkCmdBlitImage2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBlitImage2KHR;
-    }
-    if (!strcmp(name, "vkCmdResolveImage2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdResolveImage2KHR;
-    }
+        case PROC_vkCmdCopyBuffer2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyBuffer2KHR;
+        }
+        case PROC_vkCmdCopyImage2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyImage2KHR;
+        }
+        case PROC_vkCmdCopyBufferToImage2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyBufferToImage2KHR;
+        }
+        case PROC_vkCmdCopyImageToBuffer2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyImageToBuffer2KHR;
+        }
+        case PROC_vkCmdBlitImage2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBlitImage2KHR;
+        }
+        case PROC_vkCmdResolveImage2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdResolveImage2KHR;
+        }
 #endif
 #ifdef VK_KHR_ray_tracing_maintenance1
-    if (!strcmp(name, "vkCmdTraceRaysIndirect2KHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdTraceRaysIndirect2KHR;
-    }
+        case PROC_vkCmdTraceRaysIndirect2KHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdTraceRaysIndirect2KHR;
+        }
 #endif
 #ifdef VK_KHR_maintenance4
-    if (!strcmp(name, "vkGetDeviceBufferMemoryRequirementsKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceBufferMemoryRequirementsKHR;
-    }
-    if (!strcmp(name, "vkGetDeviceImageMemoryRequirementsKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceImageMemoryRequirementsKHR;
-    }
-    if (!strcmp(name, "vkGetDeviceImageSparseMemoryRequirementsKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceImageSparseMemoryRequirementsKHR;
-    }
+        case PROC_vkGetDeviceBufferMemoryRequirementsKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceBufferMemoryRequirementsKHR;
+        }
+        case PROC_vkGetDeviceImageMemoryRequirementsKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceImageMemoryRequirementsKHR;
+        }
+        case PROC_vkGetDeviceImageSparseMemoryRequirementsKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceImageSparseMemoryRequirementsKHR;
+        }
 #endif
 #ifdef VK_ANDROID_native_buffer
-    if (!strcmp(name, "vkGetSwapchainGrallocUsageANDROID")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSwapchainGrallocUsageANDROID;
-    }
-    if (!strcmp(name, "vkAcquireImageANDROID")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkAcquireImageANDROID;
-    }
-    if (!strcmp(name, "vkQueueSignalReleaseImageANDROID")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkQueueSignalReleaseImageANDROID;
-    }
-    if (!strcmp(name, "vkGetSwapchainGrallocUsage2ANDROID")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSwapchainGrallocUsage2ANDROID;
-    }
+        case PROC_vkGetSwapchainGrallocUsageANDROID: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSwapchainGrallocUsageANDROID;
+        }
+        case PROC_vkAcquireImageANDROID: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkAcquireImageANDROID;
+        }
+        case PROC_vkQueueSignalReleaseImageANDROID: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkQueueSignalReleaseImageANDROID;
+        }
+        case PROC_vkGetSwapchainGrallocUsage2ANDROID: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSwapchainGrallocUsage2ANDROID;
+        }
 #endif
 #ifdef VK_EXT_debug_report
-    if (!strcmp(name, "vkCreateDebugReportCallbackEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_report");
-        return hasExt ? (void*)entry_vkCreateDebugReportCallbackEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDebugReportCallbackEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_report");
-        return hasExt ? (void*)entry_vkDestroyDebugReportCallbackEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDebugReportMessageEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_report");
-        return hasExt ? (void*)entry_vkDebugReportMessageEXT : nullptr;
-    }
+        case PROC_vkCreateDebugReportCallbackEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_report");
+            return hasExt ? (void*)entry_vkCreateDebugReportCallbackEXT : nullptr;
+        }
+        case PROC_vkDestroyDebugReportCallbackEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_report");
+            return hasExt ? (void*)entry_vkDestroyDebugReportCallbackEXT : nullptr;
+        }
+        case PROC_vkDebugReportMessageEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_report");
+            return hasExt ? (void*)entry_vkDebugReportMessageEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_debug_marker
-    if (!strcmp(name, "vkDebugMarkerSetObjectTagEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDebugMarkerSetObjectTagEXT;
-    }
-    if (!strcmp(name, "vkDebugMarkerSetObjectNameEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDebugMarkerSetObjectNameEXT;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerBeginEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDebugMarkerBeginEXT;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerEndEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDebugMarkerEndEXT;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerInsertEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDebugMarkerInsertEXT;
-    }
+        case PROC_vkDebugMarkerSetObjectTagEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDebugMarkerSetObjectTagEXT;
+        }
+        case PROC_vkDebugMarkerSetObjectNameEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDebugMarkerSetObjectNameEXT;
+        }
+        case PROC_vkCmdDebugMarkerBeginEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDebugMarkerBeginEXT;
+        }
+        case PROC_vkCmdDebugMarkerEndEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDebugMarkerEndEXT;
+        }
+        case PROC_vkCmdDebugMarkerInsertEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDebugMarkerInsertEXT;
+        }
 #endif
 #ifdef VK_EXT_transform_feedback
-    if (!strcmp(name, "vkCmdBindTransformFeedbackBuffersEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBindTransformFeedbackBuffersEXT;
-    }
-    if (!strcmp(name, "vkCmdBeginTransformFeedbackEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBeginTransformFeedbackEXT;
-    }
-    if (!strcmp(name, "vkCmdEndTransformFeedbackEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdEndTransformFeedbackEXT;
-    }
-    if (!strcmp(name, "vkCmdBeginQueryIndexedEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBeginQueryIndexedEXT;
-    }
-    if (!strcmp(name, "vkCmdEndQueryIndexedEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdEndQueryIndexedEXT;
-    }
-    if (!strcmp(name, "vkCmdDrawIndirectByteCountEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawIndirectByteCountEXT;
-    }
+        case PROC_vkCmdBindTransformFeedbackBuffersEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBindTransformFeedbackBuffersEXT;
+        }
+        case PROC_vkCmdBeginTransformFeedbackEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBeginTransformFeedbackEXT;
+        }
+        case PROC_vkCmdEndTransformFeedbackEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdEndTransformFeedbackEXT;
+        }
+        case PROC_vkCmdBeginQueryIndexedEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBeginQueryIndexedEXT;
+        }
+        case PROC_vkCmdEndQueryIndexedEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdEndQueryIndexedEXT;
+        }
+        case PROC_vkCmdDrawIndirectByteCountEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawIndirectByteCountEXT;
+        }
 #endif
 #ifdef VK_NVX_binary_import
-    if (!strcmp(name, "vkCreateCuModuleNVX")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateCuModuleNVX;
-    }
-    if (!strcmp(name, "vkCreateCuFunctionNVX")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateCuFunctionNVX;
-    }
-    if (!strcmp(name, "vkDestroyCuModuleNVX")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyCuModuleNVX;
-    }
-    if (!strcmp(name, "vkDestroyCuFunctionNVX")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyCuFunctionNVX;
-    }
-    if (!strcmp(name, "vkCmdCuLaunchKernelNVX")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCuLaunchKernelNVX;
-    }
+        case PROC_vkCreateCuModuleNVX: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateCuModuleNVX;
+        }
+        case PROC_vkCreateCuFunctionNVX: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateCuFunctionNVX;
+        }
+        case PROC_vkDestroyCuModuleNVX: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyCuModuleNVX;
+        }
+        case PROC_vkDestroyCuFunctionNVX: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyCuFunctionNVX;
+        }
+        case PROC_vkCmdCuLaunchKernelNVX: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCuLaunchKernelNVX;
+        }
 #endif
 #ifdef VK_NVX_image_view_handle
-    if (!strcmp(name, "vkGetImageViewHandleNVX")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetImageViewHandleNVX;
-    }
-    if (!strcmp(name, "vkGetImageViewAddressNVX")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetImageViewAddressNVX;
-    }
+        case PROC_vkGetImageViewHandleNVX: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetImageViewHandleNVX;
+        }
+        case PROC_vkGetImageViewAddressNVX: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetImageViewAddressNVX;
+        }
 #endif
 #ifdef VK_AMD_draw_indirect_count
-    if (!strcmp(name, "vkCmdDrawIndirectCountAMD")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawIndirectCountAMD;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCountAMD")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawIndexedIndirectCountAMD;
-    }
+        case PROC_vkCmdDrawIndirectCountAMD: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawIndirectCountAMD;
+        }
+        case PROC_vkCmdDrawIndexedIndirectCountAMD: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawIndexedIndirectCountAMD;
+        }
 #endif
 #ifdef VK_AMD_shader_info
-    if (!strcmp(name, "vkGetShaderInfoAMD")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetShaderInfoAMD;
-    }
+        case PROC_vkGetShaderInfoAMD: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetShaderInfoAMD;
+        }
 #endif
 #ifdef VK_GGP_stream_descriptor_surface
-    if (!strcmp(name, "vkCreateStreamDescriptorSurfaceGGP")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GGP_stream_descriptor_surface");
-        return hasExt ? (void*)entry_vkCreateStreamDescriptorSurfaceGGP : nullptr;
-    }
+        case PROC_vkCreateStreamDescriptorSurfaceGGP: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GGP_stream_descriptor_surface");
+            return hasExt ? (void*)entry_vkCreateStreamDescriptorSurfaceGGP : nullptr;
+        }
 #endif
 #ifdef VK_NV_external_memory_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV")) {
-        bool hasExt =
-            resources->hasInstanceExtension(instance, "VK_NV_external_memory_capabilities");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalImageFormatPropertiesNV : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalImageFormatPropertiesNV: {
+            bool hasExt =
+                resources->hasInstanceExtension(instance, "VK_NV_external_memory_capabilities");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalImageFormatPropertiesNV : nullptr;
+        }
 #endif
 #ifdef VK_NV_external_memory_win32
-    if (!strcmp(name, "vkGetMemoryWin32HandleNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryWin32HandleNV;
-    }
+        case PROC_vkGetMemoryWin32HandleNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryWin32HandleNV;
+        }
 #endif
 #ifdef VK_NN_vi_surface
-    if (!strcmp(name, "vkCreateViSurfaceNN")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_NN_vi_surface");
-        return hasExt ? (void*)entry_vkCreateViSurfaceNN : nullptr;
-    }
+        case PROC_vkCreateViSurfaceNN: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_NN_vi_surface");
+            return hasExt ? (void*)entry_vkCreateViSurfaceNN : nullptr;
+        }
 #endif
 #ifdef VK_EXT_conditional_rendering
-    if (!strcmp(name, "vkCmdBeginConditionalRenderingEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBeginConditionalRenderingEXT;
-    }
-    if (!strcmp(name, "vkCmdEndConditionalRenderingEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdEndConditionalRenderingEXT;
-    }
+        case PROC_vkCmdBeginConditionalRenderingEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBeginConditionalRenderingEXT;
+        }
+        case PROC_vkCmdEndConditionalRenderingEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdEndConditionalRenderingEXT;
+        }
 #endif
 #ifdef VK_NV_clip_space_w_scaling
-    if (!strcmp(name, "vkCmdSetViewportWScalingNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetViewportWScalingNV;
-    }
+        case PROC_vkCmdSetViewportWScalingNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetViewportWScalingNV;
+        }
 #endif
 #ifdef VK_EXT_direct_mode_display
-    if (!strcmp(name, "vkReleaseDisplayEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_direct_mode_display");
-        return hasExt ? (void*)entry_vkReleaseDisplayEXT : nullptr;
-    }
+        case PROC_vkReleaseDisplayEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_direct_mode_display");
+            return hasExt ? (void*)entry_vkReleaseDisplayEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_acquire_xlib_display
-    if (!strcmp(name, "vkAcquireXlibDisplayEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_acquire_xlib_display");
-        return hasExt ? (void*)entry_vkAcquireXlibDisplayEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetRandROutputDisplayEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_acquire_xlib_display");
-        return hasExt ? (void*)entry_vkGetRandROutputDisplayEXT : nullptr;
-    }
+        case PROC_vkAcquireXlibDisplayEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_acquire_xlib_display");
+            return hasExt ? (void*)entry_vkAcquireXlibDisplayEXT : nullptr;
+        }
+        case PROC_vkGetRandROutputDisplayEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_acquire_xlib_display");
+            return hasExt ? (void*)entry_vkGetRandROutputDisplayEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_display_surface_counter
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilities2EXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_display_surface_counter");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilities2EXT : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilities2EXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_display_surface_counter");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilities2EXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_display_control
-    if (!strcmp(name, "vkDisplayPowerControlEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDisplayPowerControlEXT;
-    }
-    if (!strcmp(name, "vkRegisterDeviceEventEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkRegisterDeviceEventEXT;
-    }
-    if (!strcmp(name, "vkRegisterDisplayEventEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkRegisterDisplayEventEXT;
-    }
-    if (!strcmp(name, "vkGetSwapchainCounterEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSwapchainCounterEXT;
-    }
+        case PROC_vkDisplayPowerControlEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDisplayPowerControlEXT;
+        }
+        case PROC_vkRegisterDeviceEventEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkRegisterDeviceEventEXT;
+        }
+        case PROC_vkRegisterDisplayEventEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkRegisterDisplayEventEXT;
+        }
+        case PROC_vkGetSwapchainCounterEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSwapchainCounterEXT;
+        }
 #endif
 #ifdef VK_GOOGLE_display_timing
-    if (!strcmp(name, "vkGetRefreshCycleDurationGOOGLE")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetRefreshCycleDurationGOOGLE;
-    }
-    if (!strcmp(name, "vkGetPastPresentationTimingGOOGLE")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetPastPresentationTimingGOOGLE;
-    }
+        case PROC_vkGetRefreshCycleDurationGOOGLE: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetRefreshCycleDurationGOOGLE;
+        }
+        case PROC_vkGetPastPresentationTimingGOOGLE: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetPastPresentationTimingGOOGLE;
+        }
 #endif
 #ifdef VK_EXT_discard_rectangles
-    if (!strcmp(name, "vkCmdSetDiscardRectangleEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDiscardRectangleEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDiscardRectangleEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDiscardRectangleEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDiscardRectangleModeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDiscardRectangleModeEXT;
-    }
+        case PROC_vkCmdSetDiscardRectangleEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDiscardRectangleEXT;
+        }
+        case PROC_vkCmdSetDiscardRectangleEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDiscardRectangleEnableEXT;
+        }
+        case PROC_vkCmdSetDiscardRectangleModeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDiscardRectangleModeEXT;
+        }
 #endif
 #ifdef VK_EXT_hdr_metadata
-    if (!strcmp(name, "vkSetHdrMetadataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkSetHdrMetadataEXT;
-    }
+        case PROC_vkSetHdrMetadataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkSetHdrMetadataEXT;
+        }
 #endif
 #ifdef VK_MVK_ios_surface
-    if (!strcmp(name, "vkCreateIOSSurfaceMVK")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_MVK_ios_surface");
-        return hasExt ? (void*)entry_vkCreateIOSSurfaceMVK : nullptr;
-    }
+        case PROC_vkCreateIOSSurfaceMVK: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_MVK_ios_surface");
+            return hasExt ? (void*)entry_vkCreateIOSSurfaceMVK : nullptr;
+        }
 #endif
 #ifdef VK_MVK_macos_surface
-    if (!strcmp(name, "vkCreateMacOSSurfaceMVK")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_MVK_macos_surface");
-        return hasExt ? (void*)entry_vkCreateMacOSSurfaceMVK : nullptr;
-    }
+        case PROC_vkCreateMacOSSurfaceMVK: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_MVK_macos_surface");
+            return hasExt ? (void*)entry_vkCreateMacOSSurfaceMVK : nullptr;
+        }
 #endif
 #ifdef VK_EXT_debug_utils
-    if (!strcmp(name, "vkSetDebugUtilsObjectNameEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)dynCheck_entry_vkSetDebugUtilsObjectNameEXT : nullptr;
-    }
-    if (!strcmp(name, "vkSetDebugUtilsObjectTagEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)dynCheck_entry_vkSetDebugUtilsObjectTagEXT : nullptr;
-    }
-    if (!strcmp(name, "vkQueueBeginDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkQueueBeginDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkQueueEndDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkQueueEndDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkQueueInsertDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkQueueInsertDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkCmdBeginDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkCmdEndDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdInsertDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkCmdInsertDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCreateDebugUtilsMessengerEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkCreateDebugUtilsMessengerEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDebugUtilsMessengerEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkDestroyDebugUtilsMessengerEXT : nullptr;
-    }
-    if (!strcmp(name, "vkSubmitDebugUtilsMessageEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkSubmitDebugUtilsMessageEXT : nullptr;
-    }
+        case PROC_vkSetDebugUtilsObjectNameEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)dynCheck_entry_vkSetDebugUtilsObjectNameEXT : nullptr;
+        }
+        case PROC_vkSetDebugUtilsObjectTagEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)dynCheck_entry_vkSetDebugUtilsObjectTagEXT : nullptr;
+        }
+        case PROC_vkQueueBeginDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkQueueBeginDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkQueueEndDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkQueueEndDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkQueueInsertDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkQueueInsertDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkCmdBeginDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkCmdBeginDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkCmdEndDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkCmdEndDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkCmdInsertDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkCmdInsertDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkCreateDebugUtilsMessengerEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkCreateDebugUtilsMessengerEXT : nullptr;
+        }
+        case PROC_vkDestroyDebugUtilsMessengerEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkDestroyDebugUtilsMessengerEXT : nullptr;
+        }
+        case PROC_vkSubmitDebugUtilsMessageEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkSubmitDebugUtilsMessageEXT : nullptr;
+        }
 #endif
 #ifdef VK_ANDROID_external_memory_android_hardware_buffer
-    if (!strcmp(name, "vkGetAndroidHardwareBufferPropertiesANDROID")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetAndroidHardwareBufferPropertiesANDROID;
-    }
-    if (!strcmp(name, "vkGetMemoryAndroidHardwareBufferANDROID")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryAndroidHardwareBufferANDROID;
-    }
+        case PROC_vkGetAndroidHardwareBufferPropertiesANDROID: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetAndroidHardwareBufferPropertiesANDROID;
+        }
+        case PROC_vkGetMemoryAndroidHardwareBufferANDROID: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryAndroidHardwareBufferANDROID;
+        }
 #endif
 #ifdef VK_EXT_sample_locations
-    if (!strcmp(name, "vkCmdSetSampleLocationsEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetSampleLocationsEXT;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMultisamplePropertiesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceMultisamplePropertiesEXT;
-    }
+        case PROC_vkCmdSetSampleLocationsEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetSampleLocationsEXT;
+        }
+        case PROC_vkGetPhysicalDeviceMultisamplePropertiesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceMultisamplePropertiesEXT;
+        }
 #endif
 #ifdef VK_EXT_image_drm_format_modifier
-    if (!strcmp(name, "vkGetImageDrmFormatModifierPropertiesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetImageDrmFormatModifierPropertiesEXT;
-    }
+        case PROC_vkGetImageDrmFormatModifierPropertiesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetImageDrmFormatModifierPropertiesEXT;
+        }
 #endif
 #ifdef VK_EXT_validation_cache
-    if (!strcmp(name, "vkCreateValidationCacheEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateValidationCacheEXT;
-    }
-    if (!strcmp(name, "vkDestroyValidationCacheEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyValidationCacheEXT;
-    }
-    if (!strcmp(name, "vkMergeValidationCachesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkMergeValidationCachesEXT;
-    }
-    if (!strcmp(name, "vkGetValidationCacheDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetValidationCacheDataEXT;
-    }
+        case PROC_vkCreateValidationCacheEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateValidationCacheEXT;
+        }
+        case PROC_vkDestroyValidationCacheEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyValidationCacheEXT;
+        }
+        case PROC_vkMergeValidationCachesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkMergeValidationCachesEXT;
+        }
+        case PROC_vkGetValidationCacheDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetValidationCacheDataEXT;
+        }
 #endif
 #ifdef VK_NV_shading_rate_image
-    if (!strcmp(name, "vkCmdBindShadingRateImageNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBindShadingRateImageNV;
-    }
-    if (!strcmp(name, "vkCmdSetViewportShadingRatePaletteNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetViewportShadingRatePaletteNV;
-    }
-    if (!strcmp(name, "vkCmdSetCoarseSampleOrderNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCoarseSampleOrderNV;
-    }
+        case PROC_vkCmdBindShadingRateImageNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBindShadingRateImageNV;
+        }
+        case PROC_vkCmdSetViewportShadingRatePaletteNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetViewportShadingRatePaletteNV;
+        }
+        case PROC_vkCmdSetCoarseSampleOrderNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCoarseSampleOrderNV;
+        }
 #endif
 #ifdef VK_NV_ray_tracing
-    if (!strcmp(name, "vkCreateAccelerationStructureNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateAccelerationStructureNV;
-    }
-    if (!strcmp(name, "vkDestroyAccelerationStructureNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyAccelerationStructureNV;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureMemoryRequirementsNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetAccelerationStructureMemoryRequirementsNV;
-    }
-    if (!strcmp(name, "vkBindAccelerationStructureMemoryNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkBindAccelerationStructureMemoryNV;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructureNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBuildAccelerationStructureNV;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyAccelerationStructureNV;
-    }
-    if (!strcmp(name, "vkCmdTraceRaysNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdTraceRaysNV;
-    }
-    if (!strcmp(name, "vkCreateRayTracingPipelinesNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateRayTracingPipelinesNV;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupHandlesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetRayTracingShaderGroupHandlesKHR;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupHandlesNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetRayTracingShaderGroupHandlesNV;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureHandleNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetAccelerationStructureHandleNV;
-    }
-    if (!strcmp(name, "vkCmdWriteAccelerationStructuresPropertiesNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdWriteAccelerationStructuresPropertiesNV;
-    }
-    if (!strcmp(name, "vkCompileDeferredNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCompileDeferredNV;
-    }
+        case PROC_vkCreateAccelerationStructureNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateAccelerationStructureNV;
+        }
+        case PROC_vkDestroyAccelerationStructureNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyAccelerationStructureNV;
+        }
+        case PROC_vkGetAccelerationStructureMemoryRequirementsNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetAccelerationStructureMemoryRequirementsNV;
+        }
+        case PROC_vkBindAccelerationStructureMemoryNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkBindAccelerationStructureMemoryNV;
+        }
+        case PROC_vkCmdBuildAccelerationStructureNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBuildAccelerationStructureNV;
+        }
+        case PROC_vkCmdCopyAccelerationStructureNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyAccelerationStructureNV;
+        }
+        case PROC_vkCmdTraceRaysNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdTraceRaysNV;
+        }
+        case PROC_vkCreateRayTracingPipelinesNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateRayTracingPipelinesNV;
+        }
+        case PROC_vkGetRayTracingShaderGroupHandlesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetRayTracingShaderGroupHandlesKHR;
+        }
+        case PROC_vkGetRayTracingShaderGroupHandlesNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetRayTracingShaderGroupHandlesNV;
+        }
+        case PROC_vkGetAccelerationStructureHandleNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetAccelerationStructureHandleNV;
+        }
+        case PROC_vkCmdWriteAccelerationStructuresPropertiesNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdWriteAccelerationStructuresPropertiesNV;
+        }
+        case PROC_vkCompileDeferredNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCompileDeferredNV;
+        }
 #endif
 #ifdef VK_EXT_external_memory_host
-    if (!strcmp(name, "vkGetMemoryHostPointerPropertiesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryHostPointerPropertiesEXT;
-    }
+        case PROC_vkGetMemoryHostPointerPropertiesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryHostPointerPropertiesEXT;
+        }
 #endif
 #ifdef VK_AMD_buffer_marker
-    if (!strcmp(name, "vkCmdWriteBufferMarkerAMD")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdWriteBufferMarkerAMD;
-    }
+        case PROC_vkCmdWriteBufferMarkerAMD: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdWriteBufferMarkerAMD;
+        }
 #endif
 #ifdef VK_EXT_calibrated_timestamps
-    if (!strcmp(name, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
-    }
-    if (!strcmp(name, "vkGetCalibratedTimestampsEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetCalibratedTimestampsEXT;
-    }
+        case PROC_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+        }
+        case PROC_vkGetCalibratedTimestampsEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetCalibratedTimestampsEXT;
+        }
 #endif
 #ifdef VK_NV_mesh_shader
-    if (!strcmp(name, "vkCmdDrawMeshTasksNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawMeshTasksNV;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawMeshTasksIndirectNV;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectCountNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawMeshTasksIndirectCountNV;
-    }
+        case PROC_vkCmdDrawMeshTasksNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawMeshTasksNV;
+        }
+        case PROC_vkCmdDrawMeshTasksIndirectNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawMeshTasksIndirectNV;
+        }
+        case PROC_vkCmdDrawMeshTasksIndirectCountNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawMeshTasksIndirectCountNV;
+        }
 #endif
 #ifdef VK_NV_scissor_exclusive
-    if (!strcmp(name, "vkCmdSetExclusiveScissorEnableNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetExclusiveScissorEnableNV;
-    }
-    if (!strcmp(name, "vkCmdSetExclusiveScissorNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetExclusiveScissorNV;
-    }
+        case PROC_vkCmdSetExclusiveScissorEnableNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetExclusiveScissorEnableNV;
+        }
+        case PROC_vkCmdSetExclusiveScissorNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetExclusiveScissorNV;
+        }
 #endif
 #ifdef VK_NV_device_diagnostic_checkpoints
-    if (!strcmp(name, "vkCmdSetCheckpointNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCheckpointNV;
-    }
-    if (!strcmp(name, "vkGetQueueCheckpointDataNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetQueueCheckpointDataNV;
-    }
+        case PROC_vkCmdSetCheckpointNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCheckpointNV;
+        }
+        case PROC_vkGetQueueCheckpointDataNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetQueueCheckpointDataNV;
+        }
 #endif
 #ifdef VK_INTEL_performance_query
-    if (!strcmp(name, "vkInitializePerformanceApiINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkInitializePerformanceApiINTEL;
-    }
-    if (!strcmp(name, "vkUninitializePerformanceApiINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkUninitializePerformanceApiINTEL;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceMarkerINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetPerformanceMarkerINTEL;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceStreamMarkerINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetPerformanceStreamMarkerINTEL;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceOverrideINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetPerformanceOverrideINTEL;
-    }
-    if (!strcmp(name, "vkAcquirePerformanceConfigurationINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkAcquirePerformanceConfigurationINTEL;
-    }
-    if (!strcmp(name, "vkReleasePerformanceConfigurationINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkReleasePerformanceConfigurationINTEL;
-    }
-    if (!strcmp(name, "vkQueueSetPerformanceConfigurationINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkQueueSetPerformanceConfigurationINTEL;
-    }
-    if (!strcmp(name, "vkGetPerformanceParameterINTEL")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetPerformanceParameterINTEL;
-    }
+        case PROC_vkInitializePerformanceApiINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkInitializePerformanceApiINTEL;
+        }
+        case PROC_vkUninitializePerformanceApiINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkUninitializePerformanceApiINTEL;
+        }
+        case PROC_vkCmdSetPerformanceMarkerINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetPerformanceMarkerINTEL;
+        }
+        case PROC_vkCmdSetPerformanceStreamMarkerINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetPerformanceStreamMarkerINTEL;
+        }
+        case PROC_vkCmdSetPerformanceOverrideINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetPerformanceOverrideINTEL;
+        }
+        case PROC_vkAcquirePerformanceConfigurationINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkAcquirePerformanceConfigurationINTEL;
+        }
+        case PROC_vkReleasePerformanceConfigurationINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkReleasePerformanceConfigurationINTEL;
+        }
+        case PROC_vkQueueSetPerformanceConfigurationINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkQueueSetPerformanceConfigurationINTEL;
+        }
+        case PROC_vkGetPerformanceParameterINTEL: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetPerformanceParameterINTEL;
+        }
 #endif
 #ifdef VK_AMD_display_native_hdr
-    if (!strcmp(name, "vkSetLocalDimmingAMD")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkSetLocalDimmingAMD;
-    }
+        case PROC_vkSetLocalDimmingAMD: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkSetLocalDimmingAMD;
+        }
 #endif
 #ifdef VK_FUCHSIA_imagepipe_surface
-    if (!strcmp(name, "vkCreateImagePipeSurfaceFUCHSIA")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_FUCHSIA_imagepipe_surface");
-        return hasExt ? (void*)entry_vkCreateImagePipeSurfaceFUCHSIA : nullptr;
-    }
+        case PROC_vkCreateImagePipeSurfaceFUCHSIA: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_FUCHSIA_imagepipe_surface");
+            return hasExt ? (void*)entry_vkCreateImagePipeSurfaceFUCHSIA : nullptr;
+        }
 #endif
 #ifdef VK_EXT_metal_surface
-    if (!strcmp(name, "vkCreateMetalSurfaceEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_metal_surface");
-        return hasExt ? (void*)entry_vkCreateMetalSurfaceEXT : nullptr;
-    }
+        case PROC_vkCreateMetalSurfaceEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_metal_surface");
+            return hasExt ? (void*)entry_vkCreateMetalSurfaceEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_buffer_device_address
-    if (!strcmp(name, "vkGetBufferDeviceAddressEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetBufferDeviceAddressEXT;
-    }
+        case PROC_vkGetBufferDeviceAddressEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetBufferDeviceAddressEXT;
+        }
 #endif
 #ifdef VK_EXT_tooling_info
-    if (!strcmp(name, "vkGetPhysicalDeviceToolPropertiesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceToolPropertiesEXT;
-    }
+        case PROC_vkGetPhysicalDeviceToolPropertiesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceToolPropertiesEXT;
+        }
 #endif
 #ifdef VK_NV_cooperative_matrix
-    if (!strcmp(name, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV;
-    }
+        case PROC_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV;
+        }
 #endif
 #ifdef VK_NV_coverage_reduction_mode
-    if (!strcmp(name, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
-    }
+        case PROC_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+        }
 #endif
 #ifdef VK_EXT_full_screen_exclusive
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfacePresentModes2EXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceSurfacePresentModes2EXT;
-    }
-    if (!strcmp(name, "vkAcquireFullScreenExclusiveModeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkAcquireFullScreenExclusiveModeEXT;
-    }
-    if (!strcmp(name, "vkReleaseFullScreenExclusiveModeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkReleaseFullScreenExclusiveModeEXT;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupSurfacePresentModes2EXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceGroupSurfacePresentModes2EXT;
-    }
+        case PROC_vkGetPhysicalDeviceSurfacePresentModes2EXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceSurfacePresentModes2EXT;
+        }
+        case PROC_vkAcquireFullScreenExclusiveModeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkAcquireFullScreenExclusiveModeEXT;
+        }
+        case PROC_vkReleaseFullScreenExclusiveModeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkReleaseFullScreenExclusiveModeEXT;
+        }
+        case PROC_vkGetDeviceGroupSurfacePresentModes2EXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceGroupSurfacePresentModes2EXT;
+        }
 #endif
 #ifdef VK_EXT_headless_surface
-    if (!strcmp(name, "vkCreateHeadlessSurfaceEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_headless_surface");
-        return hasExt ? (void*)entry_vkCreateHeadlessSurfaceEXT : nullptr;
-    }
+        case PROC_vkCreateHeadlessSurfaceEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_headless_surface");
+            return hasExt ? (void*)entry_vkCreateHeadlessSurfaceEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_line_rasterization
-    if (!strcmp(name, "vkCmdSetLineStippleEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetLineStippleEXT;
-    }
+        case PROC_vkCmdSetLineStippleEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetLineStippleEXT;
+        }
 #endif
 #ifdef VK_EXT_host_query_reset
-    if (!strcmp(name, "vkResetQueryPoolEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkResetQueryPoolEXT;
-    }
+        case PROC_vkResetQueryPoolEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkResetQueryPoolEXT;
+        }
 #endif
 #ifdef VK_EXT_extended_dynamic_state
-    if (!strcmp(name, "vkCmdSetCullModeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCullModeEXT;
-    }
-    if (!strcmp(name, "vkCmdSetFrontFaceEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetFrontFaceEXT;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveTopologyEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetPrimitiveTopologyEXT;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWithCountEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetViewportWithCountEXT;
-    }
-    if (!strcmp(name, "vkCmdSetScissorWithCountEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetScissorWithCountEXT;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers2EXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBindVertexBuffers2EXT;
-    }
-    if (!strcmp(name, "vkCmdSetDepthTestEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDepthTestEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDepthWriteEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDepthWriteEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDepthCompareOpEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDepthCompareOpEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBoundsTestEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDepthBoundsTestEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetStencilTestEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetStencilTestEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetStencilOpEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetStencilOpEXT;
-    }
+        case PROC_vkCmdSetCullModeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCullModeEXT;
+        }
+        case PROC_vkCmdSetFrontFaceEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetFrontFaceEXT;
+        }
+        case PROC_vkCmdSetPrimitiveTopologyEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetPrimitiveTopologyEXT;
+        }
+        case PROC_vkCmdSetViewportWithCountEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetViewportWithCountEXT;
+        }
+        case PROC_vkCmdSetScissorWithCountEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetScissorWithCountEXT;
+        }
+        case PROC_vkCmdBindVertexBuffers2EXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBindVertexBuffers2EXT;
+        }
+        case PROC_vkCmdSetDepthTestEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDepthTestEnableEXT;
+        }
+        case PROC_vkCmdSetDepthWriteEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDepthWriteEnableEXT;
+        }
+        case PROC_vkCmdSetDepthCompareOpEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDepthCompareOpEXT;
+        }
+        case PROC_vkCmdSetDepthBoundsTestEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDepthBoundsTestEnableEXT;
+        }
+        case PROC_vkCmdSetStencilTestEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetStencilTestEnableEXT;
+        }
+        case PROC_vkCmdSetStencilOpEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetStencilOpEXT;
+        }
 #endif
 #ifdef VK_EXT_swapchain_maintenance1
-    if (!strcmp(name, "vkReleaseSwapchainImagesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkReleaseSwapchainImagesEXT;
-    }
+        case PROC_vkReleaseSwapchainImagesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkReleaseSwapchainImagesEXT;
+        }
 #endif
 #ifdef VK_NV_device_generated_commands
-    if (!strcmp(name, "vkGetGeneratedCommandsMemoryRequirementsNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetGeneratedCommandsMemoryRequirementsNV;
-    }
-    if (!strcmp(name, "vkCmdPreprocessGeneratedCommandsNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdPreprocessGeneratedCommandsNV;
-    }
-    if (!strcmp(name, "vkCmdExecuteGeneratedCommandsNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdExecuteGeneratedCommandsNV;
-    }
-    if (!strcmp(name, "vkCmdBindPipelineShaderGroupNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBindPipelineShaderGroupNV;
-    }
-    if (!strcmp(name, "vkCreateIndirectCommandsLayoutNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateIndirectCommandsLayoutNV;
-    }
-    if (!strcmp(name, "vkDestroyIndirectCommandsLayoutNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyIndirectCommandsLayoutNV;
-    }
+        case PROC_vkGetGeneratedCommandsMemoryRequirementsNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetGeneratedCommandsMemoryRequirementsNV;
+        }
+        case PROC_vkCmdPreprocessGeneratedCommandsNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdPreprocessGeneratedCommandsNV;
+        }
+        case PROC_vkCmdExecuteGeneratedCommandsNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdExecuteGeneratedCommandsNV;
+        }
+        case PROC_vkCmdBindPipelineShaderGroupNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBindPipelineShaderGroupNV;
+        }
+        case PROC_vkCreateIndirectCommandsLayoutNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateIndirectCommandsLayoutNV;
+        }
+        case PROC_vkDestroyIndirectCommandsLayoutNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyIndirectCommandsLayoutNV;
+        }
 #endif
 #ifdef VK_EXT_acquire_drm_display
-    if (!strcmp(name, "vkAcquireDrmDisplayEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_acquire_drm_display");
-        return hasExt ? (void*)entry_vkAcquireDrmDisplayEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetDrmDisplayEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_acquire_drm_display");
-        return hasExt ? (void*)entry_vkGetDrmDisplayEXT : nullptr;
-    }
+        case PROC_vkAcquireDrmDisplayEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_acquire_drm_display");
+            return hasExt ? (void*)entry_vkAcquireDrmDisplayEXT : nullptr;
+        }
+        case PROC_vkGetDrmDisplayEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_acquire_drm_display");
+            return hasExt ? (void*)entry_vkGetDrmDisplayEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_private_data
-    if (!strcmp(name, "vkCreatePrivateDataSlotEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreatePrivateDataSlotEXT;
-    }
-    if (!strcmp(name, "vkDestroyPrivateDataSlotEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyPrivateDataSlotEXT;
-    }
-    if (!strcmp(name, "vkSetPrivateDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkSetPrivateDataEXT;
-    }
-    if (!strcmp(name, "vkGetPrivateDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetPrivateDataEXT;
-    }
+        case PROC_vkCreatePrivateDataSlotEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreatePrivateDataSlotEXT;
+        }
+        case PROC_vkDestroyPrivateDataSlotEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyPrivateDataSlotEXT;
+        }
+        case PROC_vkSetPrivateDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkSetPrivateDataEXT;
+        }
+        case PROC_vkGetPrivateDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetPrivateDataEXT;
+        }
 #endif
 #ifdef VK_EXT_metal_objects
-    if (!strcmp(name, "vkExportMetalObjectsEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkExportMetalObjectsEXT;
-    }
+        case PROC_vkExportMetalObjectsEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkExportMetalObjectsEXT;
+        }
 #endif
 #ifdef VK_EXT_descriptor_buffer
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSizeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDescriptorSetLayoutSizeEXT;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetLayoutBindingOffsetEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDescriptorSetLayoutBindingOffsetEXT;
-    }
-    if (!strcmp(name, "vkGetDescriptorEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDescriptorEXT;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorBuffersEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBindDescriptorBuffersEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDescriptorBufferOffsetsEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDescriptorBufferOffsetsEXT;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBindDescriptorBufferEmbeddedSamplersEXT;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureDescriptorDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetBufferOpaqueCaptureDescriptorDataEXT;
-    }
-    if (!strcmp(name, "vkGetImageOpaqueCaptureDescriptorDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetImageOpaqueCaptureDescriptorDataEXT;
-    }
-    if (!strcmp(name, "vkGetImageViewOpaqueCaptureDescriptorDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetImageViewOpaqueCaptureDescriptorDataEXT;
-    }
-    if (!strcmp(name, "vkGetSamplerOpaqueCaptureDescriptorDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSamplerOpaqueCaptureDescriptorDataEXT;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
-    }
+        case PROC_vkGetDescriptorSetLayoutSizeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDescriptorSetLayoutSizeEXT;
+        }
+        case PROC_vkGetDescriptorSetLayoutBindingOffsetEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDescriptorSetLayoutBindingOffsetEXT;
+        }
+        case PROC_vkGetDescriptorEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDescriptorEXT;
+        }
+        case PROC_vkCmdBindDescriptorBuffersEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBindDescriptorBuffersEXT;
+        }
+        case PROC_vkCmdSetDescriptorBufferOffsetsEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDescriptorBufferOffsetsEXT;
+        }
+        case PROC_vkCmdBindDescriptorBufferEmbeddedSamplersEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBindDescriptorBufferEmbeddedSamplersEXT;
+        }
+        case PROC_vkGetBufferOpaqueCaptureDescriptorDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetBufferOpaqueCaptureDescriptorDataEXT;
+        }
+        case PROC_vkGetImageOpaqueCaptureDescriptorDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetImageOpaqueCaptureDescriptorDataEXT;
+        }
+        case PROC_vkGetImageViewOpaqueCaptureDescriptorDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetImageViewOpaqueCaptureDescriptorDataEXT;
+        }
+        case PROC_vkGetSamplerOpaqueCaptureDescriptorDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSamplerOpaqueCaptureDescriptorDataEXT;
+        }
+        case PROC_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
+        }
 #endif
 #ifdef VK_NV_fragment_shading_rate_enums
-    if (!strcmp(name, "vkCmdSetFragmentShadingRateEnumNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetFragmentShadingRateEnumNV;
-    }
+        case PROC_vkCmdSetFragmentShadingRateEnumNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetFragmentShadingRateEnumNV;
+        }
 #endif
 #ifdef VK_EXT_image_compression_control
-    if (!strcmp(name, "vkGetImageSubresourceLayout2EXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetImageSubresourceLayout2EXT;
-    }
+        case PROC_vkGetImageSubresourceLayout2EXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetImageSubresourceLayout2EXT;
+        }
 #endif
 #ifdef VK_EXT_device_fault
-    if (!strcmp(name, "vkGetDeviceFaultInfoEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceFaultInfoEXT;
-    }
+        case PROC_vkGetDeviceFaultInfoEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceFaultInfoEXT;
+        }
 #endif
 #ifdef VK_NV_acquire_winrt_display
-    if (!strcmp(name, "vkAcquireWinrtDisplayNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkAcquireWinrtDisplayNV;
-    }
-    if (!strcmp(name, "vkGetWinrtDisplayNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetWinrtDisplayNV;
-    }
+        case PROC_vkAcquireWinrtDisplayNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkAcquireWinrtDisplayNV;
+        }
+        case PROC_vkGetWinrtDisplayNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetWinrtDisplayNV;
+        }
 #endif
 #ifdef VK_EXT_directfb_surface
-    if (!strcmp(name, "vkCreateDirectFBSurfaceEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_directfb_surface");
-        return hasExt ? (void*)entry_vkCreateDirectFBSurfaceEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_directfb_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDirectFBPresentationSupportEXT : nullptr;
-    }
+        case PROC_vkCreateDirectFBSurfaceEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_directfb_surface");
+            return hasExt ? (void*)entry_vkCreateDirectFBSurfaceEXT : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceDirectFBPresentationSupportEXT: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_EXT_directfb_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDirectFBPresentationSupportEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_vertex_input_dynamic_state
-    if (!strcmp(name, "vkCmdSetVertexInputEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetVertexInputEXT;
-    }
+        case PROC_vkCmdSetVertexInputEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetVertexInputEXT;
+        }
 #endif
 #ifdef VK_FUCHSIA_external_memory
-    if (!strcmp(name, "vkGetMemoryZirconHandleFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryZirconHandleFUCHSIA;
-    }
-    if (!strcmp(name, "vkGetMemoryZirconHandlePropertiesFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryZirconHandlePropertiesFUCHSIA;
-    }
+        case PROC_vkGetMemoryZirconHandleFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryZirconHandleFUCHSIA;
+        }
+        case PROC_vkGetMemoryZirconHandlePropertiesFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryZirconHandlePropertiesFUCHSIA;
+        }
 #endif
 #ifdef VK_FUCHSIA_external_semaphore
-    if (!strcmp(name, "vkImportSemaphoreZirconHandleFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkImportSemaphoreZirconHandleFUCHSIA;
-    }
-    if (!strcmp(name, "vkGetSemaphoreZirconHandleFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetSemaphoreZirconHandleFUCHSIA;
-    }
+        case PROC_vkImportSemaphoreZirconHandleFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkImportSemaphoreZirconHandleFUCHSIA;
+        }
+        case PROC_vkGetSemaphoreZirconHandleFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetSemaphoreZirconHandleFUCHSIA;
+        }
 #endif
 #ifdef VK_FUCHSIA_buffer_collection
-    if (!strcmp(name, "vkCreateBufferCollectionFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateBufferCollectionFUCHSIA;
-    }
-    if (!strcmp(name, "vkSetBufferCollectionImageConstraintsFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkSetBufferCollectionImageConstraintsFUCHSIA;
-    }
-    if (!strcmp(name, "vkSetBufferCollectionBufferConstraintsFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkSetBufferCollectionBufferConstraintsFUCHSIA;
-    }
-    if (!strcmp(name, "vkDestroyBufferCollectionFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyBufferCollectionFUCHSIA;
-    }
-    if (!strcmp(name, "vkGetBufferCollectionPropertiesFUCHSIA")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetBufferCollectionPropertiesFUCHSIA;
-    }
+        case PROC_vkCreateBufferCollectionFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateBufferCollectionFUCHSIA;
+        }
+        case PROC_vkSetBufferCollectionImageConstraintsFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkSetBufferCollectionImageConstraintsFUCHSIA;
+        }
+        case PROC_vkSetBufferCollectionBufferConstraintsFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkSetBufferCollectionBufferConstraintsFUCHSIA;
+        }
+        case PROC_vkDestroyBufferCollectionFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyBufferCollectionFUCHSIA;
+        }
+        case PROC_vkGetBufferCollectionPropertiesFUCHSIA: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetBufferCollectionPropertiesFUCHSIA;
+        }
 #endif
 #ifdef VK_HUAWEI_subpass_shading
-    if (!strcmp(name, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
-    }
-    if (!strcmp(name, "vkCmdSubpassShadingHUAWEI")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSubpassShadingHUAWEI;
-    }
+        case PROC_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+        }
+        case PROC_vkCmdSubpassShadingHUAWEI: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSubpassShadingHUAWEI;
+        }
 #endif
 #ifdef VK_HUAWEI_invocation_mask
-    if (!strcmp(name, "vkCmdBindInvocationMaskHUAWEI")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBindInvocationMaskHUAWEI;
-    }
+        case PROC_vkCmdBindInvocationMaskHUAWEI: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBindInvocationMaskHUAWEI;
+        }
 #endif
 #ifdef VK_NV_external_memory_rdma
-    if (!strcmp(name, "vkGetMemoryRemoteAddressNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMemoryRemoteAddressNV;
-    }
+        case PROC_vkGetMemoryRemoteAddressNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMemoryRemoteAddressNV;
+        }
 #endif
 #ifdef VK_EXT_pipeline_properties
-    if (!strcmp(name, "vkGetPipelinePropertiesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetPipelinePropertiesEXT;
-    }
+        case PROC_vkGetPipelinePropertiesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetPipelinePropertiesEXT;
+        }
 #endif
 #ifdef VK_EXT_extended_dynamic_state2
-    if (!strcmp(name, "vkCmdSetPatchControlPointsEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetPatchControlPointsEXT;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizerDiscardEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetRasterizerDiscardEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBiasEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDepthBiasEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetLogicOpEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetLogicOpEXT;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveRestartEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetPrimitiveRestartEnableEXT;
-    }
+        case PROC_vkCmdSetPatchControlPointsEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetPatchControlPointsEXT;
+        }
+        case PROC_vkCmdSetRasterizerDiscardEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetRasterizerDiscardEnableEXT;
+        }
+        case PROC_vkCmdSetDepthBiasEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDepthBiasEnableEXT;
+        }
+        case PROC_vkCmdSetLogicOpEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetLogicOpEXT;
+        }
+        case PROC_vkCmdSetPrimitiveRestartEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetPrimitiveRestartEnableEXT;
+        }
 #endif
 #ifdef VK_QNX_screen_surface
-    if (!strcmp(name, "vkCreateScreenSurfaceQNX")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_QNX_screen_surface");
-        return hasExt ? (void*)entry_vkCreateScreenSurfaceQNX : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceScreenPresentationSupportQNX")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_QNX_screen_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceScreenPresentationSupportQNX : nullptr;
-    }
+        case PROC_vkCreateScreenSurfaceQNX: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_QNX_screen_surface");
+            return hasExt ? (void*)entry_vkCreateScreenSurfaceQNX : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceScreenPresentationSupportQNX: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_QNX_screen_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceScreenPresentationSupportQNX : nullptr;
+        }
 #endif
 #ifdef VK_EXT_color_write_enable
-    if (!strcmp(name, "vkCmdSetColorWriteEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetColorWriteEnableEXT;
-    }
+        case PROC_vkCmdSetColorWriteEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetColorWriteEnableEXT;
+        }
 #endif
 #ifdef VK_GOOGLE_gfxstream
-    if (!strcmp(name, "vkMapMemoryIntoAddressSpaceGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkMapMemoryIntoAddressSpaceGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateSizedGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkUpdateDescriptorSetWithTemplateSizedGOOGLE
-                      : nullptr;
-    }
-    if (!strcmp(name, "vkBeginCommandBufferAsyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkBeginCommandBufferAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkEndCommandBufferAsyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkEndCommandBufferAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkResetCommandBufferAsyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkResetCommandBufferAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkCommandBufferHostSyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkCommandBufferHostSyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkCreateImageWithRequirementsGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkCreateImageWithRequirementsGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkCreateBufferWithRequirementsGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkCreateBufferWithRequirementsGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryHostAddressInfoGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkGetMemoryHostAddressInfoGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkFreeMemorySyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkFreeMemorySyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueHostSyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueHostSyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmitAsyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueSubmitAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueWaitIdleAsyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueWaitIdleAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueBindSparseAsyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueBindSparseAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetLinearImageLayoutGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkGetLinearImageLayoutGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetLinearImageLayout2GOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkGetLinearImageLayout2GOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueFlushCommandsGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueFlushCommandsGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueCommitDescriptorSetUpdatesGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueCommitDescriptorSetUpdatesGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkCollectDescriptorPoolIdsGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkCollectDescriptorPoolIdsGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSignalReleaseImageANDROIDAsyncGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueSignalReleaseImageANDROIDAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueFlushCommandsFromAuxMemoryGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueFlushCommandsFromAuxMemoryGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetBlobGOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkGetBlobGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateSized2GOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)dynCheck_entry_vkUpdateDescriptorSetWithTemplateSized2GOOGLE
-                      : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmitAsync2GOOGLE")) {
-        bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueSubmitAsync2GOOGLE : nullptr;
-    }
+        case PROC_vkMapMemoryIntoAddressSpaceGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkMapMemoryIntoAddressSpaceGOOGLE : nullptr;
+        }
+        case PROC_vkUpdateDescriptorSetWithTemplateSizedGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkUpdateDescriptorSetWithTemplateSizedGOOGLE
+                          : nullptr;
+        }
+        case PROC_vkBeginCommandBufferAsyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkBeginCommandBufferAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkEndCommandBufferAsyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkEndCommandBufferAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkResetCommandBufferAsyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkResetCommandBufferAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkCommandBufferHostSyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkCommandBufferHostSyncGOOGLE : nullptr;
+        }
+        case PROC_vkCreateImageWithRequirementsGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkCreateImageWithRequirementsGOOGLE : nullptr;
+        }
+        case PROC_vkCreateBufferWithRequirementsGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkCreateBufferWithRequirementsGOOGLE : nullptr;
+        }
+        case PROC_vkGetMemoryHostAddressInfoGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkGetMemoryHostAddressInfoGOOGLE : nullptr;
+        }
+        case PROC_vkFreeMemorySyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkFreeMemorySyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueHostSyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueHostSyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueSubmitAsyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueSubmitAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueWaitIdleAsyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueWaitIdleAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueBindSparseAsyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueBindSparseAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkGetLinearImageLayoutGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkGetLinearImageLayoutGOOGLE : nullptr;
+        }
+        case PROC_vkGetLinearImageLayout2GOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkGetLinearImageLayout2GOOGLE : nullptr;
+        }
+        case PROC_vkQueueFlushCommandsGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueFlushCommandsGOOGLE : nullptr;
+        }
+        case PROC_vkQueueCommitDescriptorSetUpdatesGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueCommitDescriptorSetUpdatesGOOGLE : nullptr;
+        }
+        case PROC_vkCollectDescriptorPoolIdsGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkCollectDescriptorPoolIdsGOOGLE : nullptr;
+        }
+        case PROC_vkQueueSignalReleaseImageANDROIDAsyncGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueSignalReleaseImageANDROIDAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueFlushCommandsFromAuxMemoryGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueFlushCommandsFromAuxMemoryGOOGLE : nullptr;
+        }
+        case PROC_vkGetBlobGOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkGetBlobGOOGLE : nullptr;
+        }
+        case PROC_vkUpdateDescriptorSetWithTemplateSized2GOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)dynCheck_entry_vkUpdateDescriptorSetWithTemplateSized2GOOGLE
+                          : nullptr;
+        }
+        case PROC_vkQueueSubmitAsync2GOOGLE: {
+            bool hasExt = resources->hasInstanceExtension(instance, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueSubmitAsync2GOOGLE : nullptr;
+        }
 #endif
 #ifdef VK_EXT_multi_draw
-    if (!strcmp(name, "vkCmdDrawMultiEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawMultiEXT;
-    }
-    if (!strcmp(name, "vkCmdDrawMultiIndexedEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawMultiIndexedEXT;
-    }
+        case PROC_vkCmdDrawMultiEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawMultiEXT;
+        }
+        case PROC_vkCmdDrawMultiIndexedEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawMultiIndexedEXT;
+        }
 #endif
 #ifdef VK_EXT_opacity_micromap
-    if (!strcmp(name, "vkCreateMicromapEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateMicromapEXT;
-    }
-    if (!strcmp(name, "vkDestroyMicromapEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyMicromapEXT;
-    }
-    if (!strcmp(name, "vkCmdBuildMicromapsEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBuildMicromapsEXT;
-    }
-    if (!strcmp(name, "vkBuildMicromapsEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkBuildMicromapsEXT;
-    }
-    if (!strcmp(name, "vkCopyMicromapEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCopyMicromapEXT;
-    }
-    if (!strcmp(name, "vkCopyMicromapToMemoryEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCopyMicromapToMemoryEXT;
-    }
-    if (!strcmp(name, "vkCopyMemoryToMicromapEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCopyMemoryToMicromapEXT;
-    }
-    if (!strcmp(name, "vkWriteMicromapsPropertiesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkWriteMicromapsPropertiesEXT;
-    }
-    if (!strcmp(name, "vkCmdCopyMicromapEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyMicromapEXT;
-    }
-    if (!strcmp(name, "vkCmdCopyMicromapToMemoryEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyMicromapToMemoryEXT;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToMicromapEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyMemoryToMicromapEXT;
-    }
-    if (!strcmp(name, "vkCmdWriteMicromapsPropertiesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdWriteMicromapsPropertiesEXT;
-    }
-    if (!strcmp(name, "vkGetDeviceMicromapCompatibilityEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceMicromapCompatibilityEXT;
-    }
-    if (!strcmp(name, "vkGetMicromapBuildSizesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetMicromapBuildSizesEXT;
-    }
+        case PROC_vkCreateMicromapEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateMicromapEXT;
+        }
+        case PROC_vkDestroyMicromapEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyMicromapEXT;
+        }
+        case PROC_vkCmdBuildMicromapsEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBuildMicromapsEXT;
+        }
+        case PROC_vkBuildMicromapsEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkBuildMicromapsEXT;
+        }
+        case PROC_vkCopyMicromapEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCopyMicromapEXT;
+        }
+        case PROC_vkCopyMicromapToMemoryEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCopyMicromapToMemoryEXT;
+        }
+        case PROC_vkCopyMemoryToMicromapEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCopyMemoryToMicromapEXT;
+        }
+        case PROC_vkWriteMicromapsPropertiesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkWriteMicromapsPropertiesEXT;
+        }
+        case PROC_vkCmdCopyMicromapEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyMicromapEXT;
+        }
+        case PROC_vkCmdCopyMicromapToMemoryEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyMicromapToMemoryEXT;
+        }
+        case PROC_vkCmdCopyMemoryToMicromapEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyMemoryToMicromapEXT;
+        }
+        case PROC_vkCmdWriteMicromapsPropertiesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdWriteMicromapsPropertiesEXT;
+        }
+        case PROC_vkGetDeviceMicromapCompatibilityEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceMicromapCompatibilityEXT;
+        }
+        case PROC_vkGetMicromapBuildSizesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetMicromapBuildSizesEXT;
+        }
 #endif
 #ifdef VK_HUAWEI_cluster_culling_shader
-    if (!strcmp(name, "vkCmdDrawClusterHUAWEI")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawClusterHUAWEI;
-    }
-    if (!strcmp(name, "vkCmdDrawClusterIndirectHUAWEI")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawClusterIndirectHUAWEI;
-    }
+        case PROC_vkCmdDrawClusterHUAWEI: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawClusterHUAWEI;
+        }
+        case PROC_vkCmdDrawClusterIndirectHUAWEI: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawClusterIndirectHUAWEI;
+        }
 #endif
 #ifdef VK_EXT_pageable_device_local_memory
-    if (!strcmp(name, "vkSetDeviceMemoryPriorityEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkSetDeviceMemoryPriorityEXT;
-    }
+        case PROC_vkSetDeviceMemoryPriorityEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkSetDeviceMemoryPriorityEXT;
+        }
 #endif
 #ifdef VK_VALVE_descriptor_set_host_mapping
-    if (!strcmp(name, "vkGetDescriptorSetLayoutHostMappingInfoVALVE")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDescriptorSetLayoutHostMappingInfoVALVE;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetHostMappingVALVE")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDescriptorSetHostMappingVALVE;
-    }
+        case PROC_vkGetDescriptorSetLayoutHostMappingInfoVALVE: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDescriptorSetLayoutHostMappingInfoVALVE;
+        }
+        case PROC_vkGetDescriptorSetHostMappingVALVE: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDescriptorSetHostMappingVALVE;
+        }
 #endif
 #ifdef VK_NV_copy_memory_indirect
-    if (!strcmp(name, "vkCmdCopyMemoryIndirectNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyMemoryIndirectNV;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToImageIndirectNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyMemoryToImageIndirectNV;
-    }
+        case PROC_vkCmdCopyMemoryIndirectNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyMemoryIndirectNV;
+        }
+        case PROC_vkCmdCopyMemoryToImageIndirectNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyMemoryToImageIndirectNV;
+        }
 #endif
 #ifdef VK_NV_memory_decompression
-    if (!strcmp(name, "vkCmdDecompressMemoryNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDecompressMemoryNV;
-    }
-    if (!strcmp(name, "vkCmdDecompressMemoryIndirectCountNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDecompressMemoryIndirectCountNV;
-    }
+        case PROC_vkCmdDecompressMemoryNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDecompressMemoryNV;
+        }
+        case PROC_vkCmdDecompressMemoryIndirectCountNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDecompressMemoryIndirectCountNV;
+        }
 #endif
 #ifdef VK_EXT_extended_dynamic_state3
-    if (!strcmp(name, "vkCmdSetTessellationDomainOriginEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetTessellationDomainOriginEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClampEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDepthClampEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetPolygonModeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetPolygonModeEXT;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizationSamplesEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetRasterizationSamplesEXT;
-    }
-    if (!strcmp(name, "vkCmdSetSampleMaskEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetSampleMaskEXT;
-    }
-    if (!strcmp(name, "vkCmdSetAlphaToCoverageEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetAlphaToCoverageEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetAlphaToOneEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetAlphaToOneEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetLogicOpEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetLogicOpEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetColorBlendEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendEquationEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetColorBlendEquationEXT;
-    }
-    if (!strcmp(name, "vkCmdSetColorWriteMaskEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetColorWriteMaskEXT;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizationStreamEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetRasterizationStreamEXT;
-    }
-    if (!strcmp(name, "vkCmdSetConservativeRasterizationModeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetConservativeRasterizationModeEXT;
-    }
-    if (!strcmp(name, "vkCmdSetExtraPrimitiveOverestimationSizeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetExtraPrimitiveOverestimationSizeEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClipEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDepthClipEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetSampleLocationsEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetSampleLocationsEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendAdvancedEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetColorBlendAdvancedEXT;
-    }
-    if (!strcmp(name, "vkCmdSetProvokingVertexModeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetProvokingVertexModeEXT;
-    }
-    if (!strcmp(name, "vkCmdSetLineRasterizationModeEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetLineRasterizationModeEXT;
-    }
-    if (!strcmp(name, "vkCmdSetLineStippleEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetLineStippleEnableEXT;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClipNegativeOneToOneEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetDepthClipNegativeOneToOneEXT;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWScalingEnableNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetViewportWScalingEnableNV;
-    }
-    if (!strcmp(name, "vkCmdSetViewportSwizzleNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetViewportSwizzleNV;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageToColorEnableNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCoverageToColorEnableNV;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageToColorLocationNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCoverageToColorLocationNV;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationModeNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCoverageModulationModeNV;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationTableEnableNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCoverageModulationTableEnableNV;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationTableNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCoverageModulationTableNV;
-    }
-    if (!strcmp(name, "vkCmdSetShadingRateImageEnableNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetShadingRateImageEnableNV;
-    }
-    if (!strcmp(name, "vkCmdSetRepresentativeFragmentTestEnableNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetRepresentativeFragmentTestEnableNV;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageReductionModeNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetCoverageReductionModeNV;
-    }
+        case PROC_vkCmdSetTessellationDomainOriginEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetTessellationDomainOriginEXT;
+        }
+        case PROC_vkCmdSetDepthClampEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDepthClampEnableEXT;
+        }
+        case PROC_vkCmdSetPolygonModeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetPolygonModeEXT;
+        }
+        case PROC_vkCmdSetRasterizationSamplesEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetRasterizationSamplesEXT;
+        }
+        case PROC_vkCmdSetSampleMaskEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetSampleMaskEXT;
+        }
+        case PROC_vkCmdSetAlphaToCoverageEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetAlphaToCoverageEnableEXT;
+        }
+        case PROC_vkCmdSetAlphaToOneEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetAlphaToOneEnableEXT;
+        }
+        case PROC_vkCmdSetLogicOpEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetLogicOpEnableEXT;
+        }
+        case PROC_vkCmdSetColorBlendEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetColorBlendEnableEXT;
+        }
+        case PROC_vkCmdSetColorBlendEquationEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetColorBlendEquationEXT;
+        }
+        case PROC_vkCmdSetColorWriteMaskEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetColorWriteMaskEXT;
+        }
+        case PROC_vkCmdSetRasterizationStreamEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetRasterizationStreamEXT;
+        }
+        case PROC_vkCmdSetConservativeRasterizationModeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetConservativeRasterizationModeEXT;
+        }
+        case PROC_vkCmdSetExtraPrimitiveOverestimationSizeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetExtraPrimitiveOverestimationSizeEXT;
+        }
+        case PROC_vkCmdSetDepthClipEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDepthClipEnableEXT;
+        }
+        case PROC_vkCmdSetSampleLocationsEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetSampleLocationsEnableEXT;
+        }
+        case PROC_vkCmdSetColorBlendAdvancedEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetColorBlendAdvancedEXT;
+        }
+        case PROC_vkCmdSetProvokingVertexModeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetProvokingVertexModeEXT;
+        }
+        case PROC_vkCmdSetLineRasterizationModeEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetLineRasterizationModeEXT;
+        }
+        case PROC_vkCmdSetLineStippleEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetLineStippleEnableEXT;
+        }
+        case PROC_vkCmdSetDepthClipNegativeOneToOneEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetDepthClipNegativeOneToOneEXT;
+        }
+        case PROC_vkCmdSetViewportWScalingEnableNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetViewportWScalingEnableNV;
+        }
+        case PROC_vkCmdSetViewportSwizzleNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetViewportSwizzleNV;
+        }
+        case PROC_vkCmdSetCoverageToColorEnableNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCoverageToColorEnableNV;
+        }
+        case PROC_vkCmdSetCoverageToColorLocationNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCoverageToColorLocationNV;
+        }
+        case PROC_vkCmdSetCoverageModulationModeNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCoverageModulationModeNV;
+        }
+        case PROC_vkCmdSetCoverageModulationTableEnableNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCoverageModulationTableEnableNV;
+        }
+        case PROC_vkCmdSetCoverageModulationTableNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCoverageModulationTableNV;
+        }
+        case PROC_vkCmdSetShadingRateImageEnableNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetShadingRateImageEnableNV;
+        }
+        case PROC_vkCmdSetRepresentativeFragmentTestEnableNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetRepresentativeFragmentTestEnableNV;
+        }
+        case PROC_vkCmdSetCoverageReductionModeNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetCoverageReductionModeNV;
+        }
 #endif
 #ifdef VK_EXT_shader_module_identifier
-    if (!strcmp(name, "vkGetShaderModuleIdentifierEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetShaderModuleIdentifierEXT;
-    }
-    if (!strcmp(name, "vkGetShaderModuleCreateInfoIdentifierEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetShaderModuleCreateInfoIdentifierEXT;
-    }
+        case PROC_vkGetShaderModuleIdentifierEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetShaderModuleIdentifierEXT;
+        }
+        case PROC_vkGetShaderModuleCreateInfoIdentifierEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetShaderModuleCreateInfoIdentifierEXT;
+        }
 #endif
 #ifdef VK_NV_optical_flow
-    if (!strcmp(name, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)entry_vkGetPhysicalDeviceOpticalFlowImageFormatsNV;
-    }
-    if (!strcmp(name, "vkCreateOpticalFlowSessionNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateOpticalFlowSessionNV;
-    }
-    if (!strcmp(name, "vkDestroyOpticalFlowSessionNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyOpticalFlowSessionNV;
-    }
-    if (!strcmp(name, "vkBindOpticalFlowSessionImageNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkBindOpticalFlowSessionImageNV;
-    }
-    if (!strcmp(name, "vkCmdOpticalFlowExecuteNV")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdOpticalFlowExecuteNV;
-    }
-#endif
-#ifdef VK_EXT_shader_object
-    if (!strcmp(name, "vkCreateShadersEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateShadersEXT;
-    }
-    if (!strcmp(name, "vkDestroyShaderEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyShaderEXT;
-    }
-    if (!strcmp(name, "vkGetShaderBinaryDataEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetShaderBinaryDataEXT;
-    }
-    if (!strcmp(name, "vkCmdBindShadersEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBindShadersEXT;
-    }
-#endif
-#ifdef VK_QCOM_tile_properties
-    if (!strcmp(name, "vkGetFramebufferTilePropertiesQCOM")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetFramebufferTilePropertiesQCOM;
-    }
-    if (!strcmp(name, "vkGetDynamicRenderingTilePropertiesQCOM")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDynamicRenderingTilePropertiesQCOM;
-    }
-#endif
-#ifdef VK_EXT_attachment_feedback_loop_dynamic_state
-    if (!strcmp(name, "vkCmdSetAttachmentFeedbackLoopEnableEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetAttachmentFeedbackLoopEnableEXT;
-    }
-#endif
-#ifdef VK_KHR_acceleration_structure
-    if (!strcmp(name, "vkCreateAccelerationStructureKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateAccelerationStructureKHR;
-    }
-    if (!strcmp(name, "vkDestroyAccelerationStructureKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkDestroyAccelerationStructureKHR;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructuresKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBuildAccelerationStructuresKHR;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructuresIndirectKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdBuildAccelerationStructuresIndirectKHR;
-    }
-    if (!strcmp(name, "vkBuildAccelerationStructuresKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkBuildAccelerationStructuresKHR;
-    }
-    if (!strcmp(name, "vkCopyAccelerationStructureKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCopyAccelerationStructureKHR;
-    }
-    if (!strcmp(name, "vkCopyAccelerationStructureToMemoryKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCopyAccelerationStructureToMemoryKHR;
-    }
-    if (!strcmp(name, "vkCopyMemoryToAccelerationStructureKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCopyMemoryToAccelerationStructureKHR;
-    }
-    if (!strcmp(name, "vkWriteAccelerationStructuresPropertiesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkWriteAccelerationStructuresPropertiesKHR;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyAccelerationStructureKHR;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureToMemoryKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyAccelerationStructureToMemoryKHR;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToAccelerationStructureKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdCopyMemoryToAccelerationStructureKHR;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureDeviceAddressKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetAccelerationStructureDeviceAddressKHR;
-    }
-    if (!strcmp(name, "vkCmdWriteAccelerationStructuresPropertiesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdWriteAccelerationStructuresPropertiesKHR;
-    }
-    if (!strcmp(name, "vkGetDeviceAccelerationStructureCompatibilityKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetDeviceAccelerationStructureCompatibilityKHR;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureBuildSizesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetAccelerationStructureBuildSizesKHR;
-    }
-#endif
-#ifdef VK_KHR_ray_tracing_pipeline
-    if (!strcmp(name, "vkCmdTraceRaysKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdTraceRaysKHR;
-    }
-    if (!strcmp(name, "vkCreateRayTracingPipelinesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCreateRayTracingPipelinesKHR;
-    }
-    if (!strcmp(name, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
-    }
-    if (!strcmp(name, "vkCmdTraceRaysIndirectKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdTraceRaysIndirectKHR;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupStackSizeKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkGetRayTracingShaderGroupStackSizeKHR;
-    }
-    if (!strcmp(name, "vkCmdSetRayTracingPipelineStackSizeKHR")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdSetRayTracingPipelineStackSizeKHR;
-    }
-#endif
-#ifdef VK_EXT_mesh_shader
-    if (!strcmp(name, "vkCmdDrawMeshTasksEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawMeshTasksEXT;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawMeshTasksIndirectEXT;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectCountEXT")) {
-        // TODO(b/236246382): Check support for device extension;
-        return (void*)dynCheck_entry_vkCmdDrawMeshTasksIndirectCountEXT;
-    }
-#endif
-    return nullptr;
-}
-void* goldfish_vulkan_get_device_proc_address(VkDevice device, const char* name) {
-    auto resources = ResourceTracker::get();
-    bool has1_1OrHigher = resources->getApiVersionFromDevice(device) >= VK_API_VERSION_1_1;
-    bool has1_2OrHigher = resources->getApiVersionFromDevice(device) >= VK_API_VERSION_1_2;
-    bool has1_3OrHigher = resources->getApiVersionFromDevice(device) >= VK_API_VERSION_1_3;
-#ifdef VK_VERSION_1_0
-    if (!strcmp(name, "vkCreateInstance")) {
-        return (void*)entry_vkCreateInstance;
-    }
-    if (!strcmp(name, "vkDestroyInstance")) {
-        return (void*)entry_vkDestroyInstance;
-    }
-    if (!strcmp(name, "vkEnumeratePhysicalDevices")) {
-        return (void*)entry_vkEnumeratePhysicalDevices;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures")) {
-        return (void*)entry_vkGetPhysicalDeviceFeatures;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceFormatProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceImageFormatProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceMemoryProperties;
-    }
-    if (!strcmp(name, "vkGetInstanceProcAddr")) {
-        return (void*)entry_vkGetInstanceProcAddr;
-    }
-    if (!strcmp(name, "vkGetDeviceProcAddr")) {
-        return (void*)entry_vkGetDeviceProcAddr;
-    }
-    if (!strcmp(name, "vkCreateDevice")) {
-        return (void*)entry_vkCreateDevice;
-    }
-    if (!strcmp(name, "vkDestroyDevice")) {
-        return (void*)entry_vkDestroyDevice;
-    }
-    if (!strcmp(name, "vkEnumerateInstanceExtensionProperties")) {
-        return (void*)entry_vkEnumerateInstanceExtensionProperties;
-    }
-    if (!strcmp(name, "vkEnumerateDeviceExtensionProperties")) {
-        return (void*)entry_vkEnumerateDeviceExtensionProperties;
-    }
-    if (!strcmp(name, "vkEnumerateInstanceLayerProperties")) {
-        return (void*)entry_vkEnumerateInstanceLayerProperties;
-    }
-    if (!strcmp(name, "vkEnumerateDeviceLayerProperties")) {
-        return (void*)entry_vkEnumerateDeviceLayerProperties;
-    }
-    if (!strcmp(name, "vkGetDeviceQueue")) {
-        return (void*)entry_vkGetDeviceQueue;
-    }
-    if (!strcmp(name, "vkQueueSubmit")) {
-        return (void*)entry_vkQueueSubmit;
-    }
-    if (!strcmp(name, "vkQueueWaitIdle")) {
-        return (void*)entry_vkQueueWaitIdle;
-    }
-    if (!strcmp(name, "vkDeviceWaitIdle")) {
-        return (void*)entry_vkDeviceWaitIdle;
-    }
-    if (!strcmp(name, "vkAllocateMemory")) {
-        return (void*)entry_vkAllocateMemory;
-    }
-    if (!strcmp(name, "vkFreeMemory")) {
-        return (void*)entry_vkFreeMemory;
-    }
-    if (!strcmp(name, "vkMapMemory")) {
-        return (void*)entry_vkMapMemory;
-    }
-    if (!strcmp(name, "vkUnmapMemory")) {
-        return (void*)entry_vkUnmapMemory;
-    }
-    if (!strcmp(name, "vkFlushMappedMemoryRanges")) {
-        return (void*)entry_vkFlushMappedMemoryRanges;
-    }
-    if (!strcmp(name, "vkInvalidateMappedMemoryRanges")) {
-        return (void*)entry_vkInvalidateMappedMemoryRanges;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryCommitment")) {
-        return (void*)entry_vkGetDeviceMemoryCommitment;
-    }
-    if (!strcmp(name, "vkBindBufferMemory")) {
-        return (void*)entry_vkBindBufferMemory;
-    }
-    if (!strcmp(name, "vkBindImageMemory")) {
-        return (void*)entry_vkBindImageMemory;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements")) {
-        return (void*)entry_vkGetBufferMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetImageMemoryRequirements")) {
-        return (void*)entry_vkGetImageMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements")) {
-        return (void*)entry_vkGetImageSparseMemoryRequirements;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties")) {
-        return (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties;
-    }
-    if (!strcmp(name, "vkQueueBindSparse")) {
-        return (void*)entry_vkQueueBindSparse;
-    }
-    if (!strcmp(name, "vkCreateFence")) {
-        return (void*)entry_vkCreateFence;
-    }
-    if (!strcmp(name, "vkDestroyFence")) {
-        return (void*)entry_vkDestroyFence;
-    }
-    if (!strcmp(name, "vkResetFences")) {
-        return (void*)entry_vkResetFences;
-    }
-    if (!strcmp(name, "vkGetFenceStatus")) {
-        return (void*)entry_vkGetFenceStatus;
-    }
-    if (!strcmp(name, "vkWaitForFences")) {
-        return (void*)entry_vkWaitForFences;
-    }
-    if (!strcmp(name, "vkCreateSemaphore")) {
-        return (void*)entry_vkCreateSemaphore;
-    }
-    if (!strcmp(name, "vkDestroySemaphore")) {
-        return (void*)entry_vkDestroySemaphore;
-    }
-    if (!strcmp(name, "vkCreateEvent")) {
-        return (void*)entry_vkCreateEvent;
-    }
-    if (!strcmp(name, "vkDestroyEvent")) {
-        return (void*)entry_vkDestroyEvent;
-    }
-    if (!strcmp(name, "vkGetEventStatus")) {
-        return (void*)entry_vkGetEventStatus;
-    }
-    if (!strcmp(name, "vkSetEvent")) {
-        return (void*)entry_vkSetEvent;
-    }
-    if (!strcmp(name, "vkResetEvent")) {
-        return (void*)entry_vkResetEvent;
-    }
-    if (!strcmp(name, "vkCreateQueryPool")) {
-        return (void*)entry_vkCreateQueryPool;
-    }
-    if (!strcmp(name, "vkDestroyQueryPool")) {
-        return (void*)entry_vkDestroyQueryPool;
-    }
-    if (!strcmp(name, "vkGetQueryPoolResults")) {
-        return (void*)entry_vkGetQueryPoolResults;
-    }
-    if (!strcmp(name, "vkCreateBuffer")) {
-        return (void*)entry_vkCreateBuffer;
-    }
-    if (!strcmp(name, "vkDestroyBuffer")) {
-        return (void*)entry_vkDestroyBuffer;
-    }
-    if (!strcmp(name, "vkCreateBufferView")) {
-        return (void*)entry_vkCreateBufferView;
-    }
-    if (!strcmp(name, "vkDestroyBufferView")) {
-        return (void*)entry_vkDestroyBufferView;
-    }
-    if (!strcmp(name, "vkCreateImage")) {
-        return (void*)entry_vkCreateImage;
-    }
-    if (!strcmp(name, "vkDestroyImage")) {
-        return (void*)entry_vkDestroyImage;
-    }
-    if (!strcmp(name, "vkGetImageSubresourceLayout")) {
-        return (void*)entry_vkGetImageSubresourceLayout;
-    }
-    if (!strcmp(name, "vkCreateImageView")) {
-        return (void*)entry_vkCreateImageView;
-    }
-    if (!strcmp(name, "vkDestroyImageView")) {
-        return (void*)entry_vkDestroyImageView;
-    }
-    if (!strcmp(name, "vkCreateShaderModule")) {
-        return (void*)entry_vkCreateShaderModule;
-    }
-    if (!strcmp(name, "vkDestroyShaderModule")) {
-        return (void*)entry_vkDestroyShaderModule;
-    }
-    if (!strcmp(name, "vkCreatePipelineCache")) {
-        return (void*)entry_vkCreatePipelineCache;
-    }
-    if (!strcmp(name, "vkDestroyPipelineCache")) {
-        return (void*)entry_vkDestroyPipelineCache;
-    }
-    if (!strcmp(name, "vkGetPipelineCacheData")) {
-        return (void*)entry_vkGetPipelineCacheData;
-    }
-    if (!strcmp(name, "vkMergePipelineCaches")) {
-        return (void*)entry_vkMergePipelineCaches;
-    }
-    if (!strcmp(name, "vkCreateGraphicsPipelines")) {
-        return (void*)entry_vkCreateGraphicsPipelines;
-    }
-    if (!strcmp(name, "vkCreateComputePipelines")) {
-        return (void*)entry_vkCreateComputePipelines;
-    }
-    if (!strcmp(name, "vkDestroyPipeline")) {
-        return (void*)entry_vkDestroyPipeline;
-    }
-    if (!strcmp(name, "vkCreatePipelineLayout")) {
-        return (void*)entry_vkCreatePipelineLayout;
-    }
-    if (!strcmp(name, "vkDestroyPipelineLayout")) {
-        return (void*)entry_vkDestroyPipelineLayout;
-    }
-    if (!strcmp(name, "vkCreateSampler")) {
-        return (void*)entry_vkCreateSampler;
-    }
-    if (!strcmp(name, "vkDestroySampler")) {
-        return (void*)entry_vkDestroySampler;
-    }
-    if (!strcmp(name, "vkCreateDescriptorSetLayout")) {
-        return (void*)entry_vkCreateDescriptorSetLayout;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorSetLayout")) {
-        return (void*)entry_vkDestroyDescriptorSetLayout;
-    }
-    if (!strcmp(name, "vkCreateDescriptorPool")) {
-        return (void*)entry_vkCreateDescriptorPool;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorPool")) {
-        return (void*)entry_vkDestroyDescriptorPool;
-    }
-    if (!strcmp(name, "vkResetDescriptorPool")) {
-        return (void*)entry_vkResetDescriptorPool;
-    }
-    if (!strcmp(name, "vkAllocateDescriptorSets")) {
-        return (void*)entry_vkAllocateDescriptorSets;
-    }
-    if (!strcmp(name, "vkFreeDescriptorSets")) {
-        return (void*)entry_vkFreeDescriptorSets;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSets")) {
-        return (void*)entry_vkUpdateDescriptorSets;
-    }
-    if (!strcmp(name, "vkCreateFramebuffer")) {
-        return (void*)entry_vkCreateFramebuffer;
-    }
-    if (!strcmp(name, "vkDestroyFramebuffer")) {
-        return (void*)entry_vkDestroyFramebuffer;
-    }
-    if (!strcmp(name, "vkCreateRenderPass")) {
-        return (void*)entry_vkCreateRenderPass;
-    }
-    if (!strcmp(name, "vkDestroyRenderPass")) {
-        return (void*)entry_vkDestroyRenderPass;
-    }
-    if (!strcmp(name, "vkGetRenderAreaGranularity")) {
-        return (void*)entry_vkGetRenderAreaGranularity;
-    }
-    if (!strcmp(name, "vkCreateCommandPool")) {
-        return (void*)entry_vkCreateCommandPool;
-    }
-    if (!strcmp(name, "vkDestroyCommandPool")) {
-        return (void*)entry_vkDestroyCommandPool;
-    }
-    if (!strcmp(name, "vkResetCommandPool")) {
-        return (void*)entry_vkResetCommandPool;
-    }
-    if (!strcmp(name, "vkAllocateCommandBuffers")) {
-        return (void*)entry_vkAllocateCommandBuffers;
-    }
-    if (!strcmp(name, "vkFreeCommandBuffers")) {
-        return (void*)entry_vkFreeCommandBuffers;
-    }
-    if (!strcmp(name, "vkBeginCommandBuffer")) {
-        return (void*)entry_vkBeginCommandBuffer;
-    }
-    if (!strcmp(name, "vkEndCommandBuffer")) {
-        return (void*)entry_vkEndCommandBuffer;
-    }
-    if (!strcmp(name, "vkResetCommandBuffer")) {
-        return (void*)entry_vkResetCommandBuffer;
-    }
-    if (!strcmp(name, "vkCmdBindPipeline")) {
-        return (void*)entry_vkCmdBindPipeline;
-    }
-    if (!strcmp(name, "vkCmdSetViewport")) {
-        return (void*)entry_vkCmdSetViewport;
-    }
-    if (!strcmp(name, "vkCmdSetScissor")) {
-        return (void*)entry_vkCmdSetScissor;
-    }
-    if (!strcmp(name, "vkCmdSetLineWidth")) {
-        return (void*)entry_vkCmdSetLineWidth;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBias")) {
-        return (void*)entry_vkCmdSetDepthBias;
-    }
-    if (!strcmp(name, "vkCmdSetBlendConstants")) {
-        return (void*)entry_vkCmdSetBlendConstants;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBounds")) {
-        return (void*)entry_vkCmdSetDepthBounds;
-    }
-    if (!strcmp(name, "vkCmdSetStencilCompareMask")) {
-        return (void*)entry_vkCmdSetStencilCompareMask;
-    }
-    if (!strcmp(name, "vkCmdSetStencilWriteMask")) {
-        return (void*)entry_vkCmdSetStencilWriteMask;
-    }
-    if (!strcmp(name, "vkCmdSetStencilReference")) {
-        return (void*)entry_vkCmdSetStencilReference;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorSets")) {
-        return (void*)entry_vkCmdBindDescriptorSets;
-    }
-    if (!strcmp(name, "vkCmdBindIndexBuffer")) {
-        return (void*)entry_vkCmdBindIndexBuffer;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers")) {
-        return (void*)entry_vkCmdBindVertexBuffers;
-    }
-    if (!strcmp(name, "vkCmdDraw")) {
-        return (void*)entry_vkCmdDraw;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexed")) {
-        return (void*)entry_vkCmdDrawIndexed;
-    }
-    if (!strcmp(name, "vkCmdDrawIndirect")) {
-        return (void*)entry_vkCmdDrawIndirect;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirect")) {
-        return (void*)entry_vkCmdDrawIndexedIndirect;
-    }
-    if (!strcmp(name, "vkCmdDispatch")) {
-        return (void*)entry_vkCmdDispatch;
-    }
-    if (!strcmp(name, "vkCmdDispatchIndirect")) {
-        return (void*)entry_vkCmdDispatchIndirect;
-    }
-    if (!strcmp(name, "vkCmdCopyBuffer")) {
-        return (void*)entry_vkCmdCopyBuffer;
-    }
-    if (!strcmp(name, "vkCmdCopyImage")) {
-        return (void*)entry_vkCmdCopyImage;
-    }
-    if (!strcmp(name, "vkCmdBlitImage")) {
-        return (void*)entry_vkCmdBlitImage;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage")) {
-        return (void*)entry_vkCmdCopyBufferToImage;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer")) {
-        return (void*)entry_vkCmdCopyImageToBuffer;
-    }
-    if (!strcmp(name, "vkCmdUpdateBuffer")) {
-        return (void*)entry_vkCmdUpdateBuffer;
-    }
-    if (!strcmp(name, "vkCmdFillBuffer")) {
-        return (void*)entry_vkCmdFillBuffer;
-    }
-    if (!strcmp(name, "vkCmdClearColorImage")) {
-        return (void*)entry_vkCmdClearColorImage;
-    }
-    if (!strcmp(name, "vkCmdClearDepthStencilImage")) {
-        return (void*)entry_vkCmdClearDepthStencilImage;
-    }
-    if (!strcmp(name, "vkCmdClearAttachments")) {
-        return (void*)entry_vkCmdClearAttachments;
-    }
-    if (!strcmp(name, "vkCmdResolveImage")) {
-        return (void*)entry_vkCmdResolveImage;
-    }
-    if (!strcmp(name, "vkCmdSetEvent")) {
-        return (void*)entry_vkCmdSetEvent;
-    }
-    if (!strcmp(name, "vkCmdResetEvent")) {
-        return (void*)entry_vkCmdResetEvent;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents")) {
-        return (void*)entry_vkCmdWaitEvents;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier")) {
-        return (void*)entry_vkCmdPipelineBarrier;
-    }
-    if (!strcmp(name, "vkCmdBeginQuery")) {
-        return (void*)entry_vkCmdBeginQuery;
-    }
-    if (!strcmp(name, "vkCmdEndQuery")) {
-        return (void*)entry_vkCmdEndQuery;
-    }
-    if (!strcmp(name, "vkCmdResetQueryPool")) {
-        return (void*)entry_vkCmdResetQueryPool;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp")) {
-        return (void*)entry_vkCmdWriteTimestamp;
-    }
-    if (!strcmp(name, "vkCmdCopyQueryPoolResults")) {
-        return (void*)entry_vkCmdCopyQueryPoolResults;
-    }
-    if (!strcmp(name, "vkCmdPushConstants")) {
-        return (void*)entry_vkCmdPushConstants;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass")) {
-        return (void*)entry_vkCmdBeginRenderPass;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass")) {
-        return (void*)entry_vkCmdNextSubpass;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass")) {
-        return (void*)entry_vkCmdEndRenderPass;
-    }
-    if (!strcmp(name, "vkCmdExecuteCommands")) {
-        return (void*)entry_vkCmdExecuteCommands;
-    }
+        case PROC_vkGetPhysicalDeviceOpticalFlowImageFormatsNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)entry_vkGetPhysicalDeviceOpticalFlowImageFormatsNV;
+        }
+        case PROC_vkCreateOpticalFlowSessionNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateOpticalFlowSessionNV;
+        }
+        case PROC_vkDestroyOpticalFlowSessionNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyOpticalFlowSessionNV;
+        }
+        case PROC_vkBindOpticalFlowSessionImageNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkBindOpticalFlowSessionImageNV;
+        }
+        case PROC_vkCmdOpticalFlowExecuteNV: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdOpticalFlowExecuteNV;
+        }
 #endif
-#ifdef VK_VERSION_1_1
-    if (!strcmp(name, "vkEnumerateInstanceVersion")) {
-        return has1_1OrHigher ? (void*)entry_vkEnumerateInstanceVersion : nullptr;
-    }
-    if (!strcmp(name, "vkBindBufferMemory2")) {
-        return has1_1OrHigher ? (void*)entry_vkBindBufferMemory2 : nullptr;
-    }
-    if (!strcmp(name, "vkBindImageMemory2")) {
-        return has1_1OrHigher ? (void*)entry_vkBindImageMemory2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupPeerMemoryFeatures")) {
-        return has1_1OrHigher ? (void*)entry_vkGetDeviceGroupPeerMemoryFeatures : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDeviceMask")) {
-        return has1_1OrHigher ? (void*)entry_vkCmdSetDeviceMask : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDispatchBase")) {
-        return has1_1OrHigher ? (void*)entry_vkCmdDispatchBase : nullptr;
-    }
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceGroups")) {
-        return nullptr;
-    }
-    if (!strcmp(name, "vkGetImageMemoryRequirements2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetImageMemoryRequirements2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetBufferMemoryRequirements2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetImageSparseMemoryRequirements2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceFeatures2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceFormatProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceImageFormatProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceMemoryProperties2 : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties2
-                              : nullptr;
-    }
-    if (!strcmp(name, "vkTrimCommandPool")) {
-        return has1_1OrHigher ? (void*)entry_vkTrimCommandPool : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceQueue2")) {
-        return has1_1OrHigher ? (void*)entry_vkGetDeviceQueue2 : nullptr;
-    }
-    if (!strcmp(name, "vkCreateSamplerYcbcrConversion")) {
-        return has1_1OrHigher ? (void*)entry_vkCreateSamplerYcbcrConversion : nullptr;
-    }
-    if (!strcmp(name, "vkDestroySamplerYcbcrConversion")) {
-        return has1_1OrHigher ? (void*)entry_vkDestroySamplerYcbcrConversion : nullptr;
-    }
-    if (!strcmp(name, "vkCreateDescriptorUpdateTemplate")) {
-        return has1_1OrHigher ? (void*)entry_vkCreateDescriptorUpdateTemplate : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorUpdateTemplate")) {
-        return has1_1OrHigher ? (void*)entry_vkDestroyDescriptorUpdateTemplate : nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplate")) {
-        return has1_1OrHigher ? (void*)entry_vkUpdateDescriptorSetWithTemplate : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalBufferProperties")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalBufferProperties : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalFenceProperties")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalFenceProperties : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalSemaphoreProperties")) {
-        return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalSemaphoreProperties
-                              : nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSupport")) {
-        return has1_1OrHigher ? (void*)entry_vkGetDescriptorSetLayoutSupport : nullptr;
+#ifdef VK_EXT_shader_object
+        case PROC_vkCreateShadersEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateShadersEXT;
+        }
+        case PROC_vkDestroyShaderEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyShaderEXT;
+        }
+        case PROC_vkGetShaderBinaryDataEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetShaderBinaryDataEXT;
+        }
+        case PROC_vkCmdBindShadersEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBindShadersEXT;
+        }
+#endif
+#ifdef VK_QCOM_tile_properties
+        case PROC_vkGetFramebufferTilePropertiesQCOM: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetFramebufferTilePropertiesQCOM;
+        }
+        case PROC_vkGetDynamicRenderingTilePropertiesQCOM: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDynamicRenderingTilePropertiesQCOM;
+        }
+#endif
+#ifdef VK_EXT_attachment_feedback_loop_dynamic_state
+        case PROC_vkCmdSetAttachmentFeedbackLoopEnableEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetAttachmentFeedbackLoopEnableEXT;
+        }
+#endif
+#ifdef VK_KHR_acceleration_structure
+        case PROC_vkCreateAccelerationStructureKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateAccelerationStructureKHR;
+        }
+        case PROC_vkDestroyAccelerationStructureKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkDestroyAccelerationStructureKHR;
+        }
+        case PROC_vkCmdBuildAccelerationStructuresKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBuildAccelerationStructuresKHR;
+        }
+        case PROC_vkCmdBuildAccelerationStructuresIndirectKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdBuildAccelerationStructuresIndirectKHR;
+        }
+        case PROC_vkBuildAccelerationStructuresKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkBuildAccelerationStructuresKHR;
+        }
+        case PROC_vkCopyAccelerationStructureKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCopyAccelerationStructureKHR;
+        }
+        case PROC_vkCopyAccelerationStructureToMemoryKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCopyAccelerationStructureToMemoryKHR;
+        }
+        case PROC_vkCopyMemoryToAccelerationStructureKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCopyMemoryToAccelerationStructureKHR;
+        }
+        case PROC_vkWriteAccelerationStructuresPropertiesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkWriteAccelerationStructuresPropertiesKHR;
+        }
+        case PROC_vkCmdCopyAccelerationStructureKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyAccelerationStructureKHR;
+        }
+        case PROC_vkCmdCopyAccelerationStructureToMemoryKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyAccelerationStructureToMemoryKHR;
+        }
+        case PROC_vkCmdCopyMemoryToAccelerationStructureKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdCopyMemoryToAccelerationStructureKHR;
+        }
+        case PROC_vkGetAccelerationStructureDeviceAddressKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetAccelerationStructureDeviceAddressKHR;
+        }
+        case PROC_vkCmdWriteAccelerationStructuresPropertiesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdWriteAccelerationStructuresPropertiesKHR;
+        }
+        case PROC_vkGetDeviceAccelerationStructureCompatibilityKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetDeviceAccelerationStructureCompatibilityKHR;
+        }
+        case PROC_vkGetAccelerationStructureBuildSizesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetAccelerationStructureBuildSizesKHR;
+        }
+#endif
+#ifdef VK_KHR_ray_tracing_pipeline
+        case PROC_vkCmdTraceRaysKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdTraceRaysKHR;
+        }
+        case PROC_vkCreateRayTracingPipelinesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCreateRayTracingPipelinesKHR;
+        }
+        case PROC_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+        }
+        case PROC_vkCmdTraceRaysIndirectKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdTraceRaysIndirectKHR;
+        }
+        case PROC_vkGetRayTracingShaderGroupStackSizeKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkGetRayTracingShaderGroupStackSizeKHR;
+        }
+        case PROC_vkCmdSetRayTracingPipelineStackSizeKHR: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdSetRayTracingPipelineStackSizeKHR;
+        }
+#endif
+#ifdef VK_EXT_mesh_shader
+        case PROC_vkCmdDrawMeshTasksEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawMeshTasksEXT;
+        }
+        case PROC_vkCmdDrawMeshTasksIndirectEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawMeshTasksIndirectEXT;
+        }
+        case PROC_vkCmdDrawMeshTasksIndirectCountEXT: {
+            // TODO(b/236246382): Check support for device extension;
+            return (void*)dynCheck_entry_vkCmdDrawMeshTasksIndirectCountEXT;
+        }
+#endif
+        default:
+            return nullptr;
     }
+}
+void* goldfish_vulkan_get_device_proc_address(VkDevice device, const char* name) {
+    auto resources = ResourceTracker::get();
+    bool has1_1OrHigher = resources->getApiVersionFromDevice(device) >= VK_API_VERSION_1_1;
+    bool has1_2OrHigher = resources->getApiVersionFromDevice(device) >= VK_API_VERSION_1_2;
+    bool has1_3OrHigher = resources->getApiVersionFromDevice(device) >= VK_API_VERSION_1_3;
+    switch (goldfish_vulkan_proc_index(name)) {
+#ifdef VK_VERSION_1_0
+        case PROC_vkCreateInstance:
+            return (void*)entry_vkCreateInstance;
+        case PROC_vkDestroyInstance:
+            return (void*)entry_vkDestroyInstance;
+        case PROC_vkEnumeratePhysicalDevices:
+            return (void*)entry_vkEnumeratePhysicalDevices;
+        case PROC_vkGetPhysicalDeviceFeatures:
+            return (void*)entry_vkGetPhysicalDeviceFeatures;
+        case PROC_vkGetPhysicalDeviceFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceFormatProperties;
+        case PROC_vkGetPhysicalDeviceImageFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceImageFormatProperties;
+        case PROC_vkGetPhysicalDeviceProperties:
+            return (void*)entry_vkGetPhysicalDeviceProperties;
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties:
+            return (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties;
+        case PROC_vkGetPhysicalDeviceMemoryProperties:
+            return (void*)entry_vkGetPhysicalDeviceMemoryProperties;
+        case PROC_vkGetInstanceProcAddr:
+            return (void*)entry_vkGetInstanceProcAddr;
+        case PROC_vkGetDeviceProcAddr:
+            return (void*)entry_vkGetDeviceProcAddr;
+        case PROC_vkCreateDevice:
+            return (void*)entry_vkCreateDevice;
+        case PROC_vkDestroyDevice:
+            return (void*)entry_vkDestroyDevice;
+        case PROC_vkEnumerateInstanceExtensionProperties:
+            return (void*)entry_vkEnumerateInstanceExtensionProperties;
+        case PROC_vkEnumerateDeviceExtensionProperties:
+            return (void*)entry_vkEnumerateDeviceExtensionProperties;
+        case PROC_vkEnumerateInstanceLayerProperties:
+            return (void*)entry_vkEnumerateInstanceLayerProperties;
+        case PROC_vkEnumerateDeviceLayerProperties:
+            return (void*)entry_vkEnumerateDeviceLayerProperties;
+        case PROC_vkGetDeviceQueue:
+            return (void*)entry_vkGetDeviceQueue;
+        case PROC_vkQueueSubmit:
+            return (void*)entry_vkQueueSubmit;
+        case PROC_vkQueueWaitIdle:
+            return (void*)entry_vkQueueWaitIdle;
+        case PROC_vkDeviceWaitIdle:
+            return (void*)entry_vkDeviceWaitIdle;
+        case PROC_vkAllocateMemory:
+            return (void*)entry_vkAllocateMemory;
+        case PROC_vkFreeMemory:
+            return (void*)entry_vkFreeMemory;
+        case PROC_vkMapMemory:
+            return (void*)entry_vkMapMemory;
+        case PROC_vkUnmapMemory:
+            return (void*)entry_vkUnmapMemory;
+        case PROC_vkFlushMappedMemoryRanges:
+            return (void*)entry_vkFlushMappedMemoryRanges;
+        case PROC_vkInvalidateMappedMemoryRanges:
+            return (void*)entry_vkInvalidateMappedMemoryRanges;
+        case PROC_vkGetDeviceMemoryCommitment:
+            return (void*)entry_vkGetDeviceMemoryCommitment;
+        case PROC_vkBindBufferMemory:
+            return (void*)entry_vkBindBufferMemory;
+        case PROC_vkBindImageMemory:
+            return (void*)entry_vkBindImageMemory;
+        case PROC_vkGetBufferMemoryRequirements:
+            return (void*)entry_vkGetBufferMemoryRequirements;
+        case PROC_vkGetImageMemoryRequirements:
+            return (void*)entry_vkGetImageMemoryRequirements;
+        case PROC_vkGetImageSparseMemoryRequirements:
+            return (void*)entry_vkGetImageSparseMemoryRequirements;
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties:
+            return (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties;
+        case PROC_vkQueueBindSparse:
+            return (void*)entry_vkQueueBindSparse;
+        case PROC_vkCreateFence:
+            return (void*)entry_vkCreateFence;
+        case PROC_vkDestroyFence:
+            return (void*)entry_vkDestroyFence;
+        case PROC_vkResetFences:
+            return (void*)entry_vkResetFences;
+        case PROC_vkGetFenceStatus:
+            return (void*)entry_vkGetFenceStatus;
+        case PROC_vkWaitForFences:
+            return (void*)entry_vkWaitForFences;
+        case PROC_vkCreateSemaphore:
+            return (void*)entry_vkCreateSemaphore;
+        case PROC_vkDestroySemaphore:
+            return (void*)entry_vkDestroySemaphore;
+        case PROC_vkCreateEvent:
+            return (void*)entry_vkCreateEvent;
+        case PROC_vkDestroyEvent:
+            return (void*)entry_vkDestroyEvent;
+        case PROC_vkGetEventStatus:
+            return (void*)entry_vkGetEventStatus;
+        case PROC_vkSetEvent:
+            return (void*)entry_vkSetEvent;
+        case PROC_vkResetEvent:
+            return (void*)entry_vkResetEvent;
+        case PROC_vkCreateQueryPool:
+            return (void*)entry_vkCreateQueryPool;
+        case PROC_vkDestroyQueryPool:
+            return (void*)entry_vkDestroyQueryPool;
+        case PROC_vkGetQueryPoolResults:
+            return (void*)entry_vkGetQueryPoolResults;
+        case PROC_vkCreateBuffer:
+            return (void*)entry_vkCreateBuffer;
+        case PROC_vkDestroyBuffer:
+            return (void*)entry_vkDestroyBuffer;
+        case PROC_vkCreateBufferView:
+            return (void*)entry_vkCreateBufferView;
+        case PROC_vkDestroyBufferView:
+            return (void*)entry_vkDestroyBufferView;
+        case PROC_vkCreateImage:
+            return (void*)entry_vkCreateImage;
+        case PROC_vkDestroyImage:
+            return (void*)entry_vkDestroyImage;
+        case PROC_vkGetImageSubresourceLayout:
+            return (void*)entry_vkGetImageSubresourceLayout;
+        case PROC_vkCreateImageView:
+            return (void*)entry_vkCreateImageView;
+        case PROC_vkDestroyImageView:
+            return (void*)entry_vkDestroyImageView;
+        case PROC_vkCreateShaderModule:
+            return (void*)entry_vkCreateShaderModule;
+        case PROC_vkDestroyShaderModule:
+            return (void*)entry_vkDestroyShaderModule;
+        case PROC_vkCreatePipelineCache:
+            return (void*)entry_vkCreatePipelineCache;
+        case PROC_vkDestroyPipelineCache:
+            return (void*)entry_vkDestroyPipelineCache;
+        case PROC_vkGetPipelineCacheData:
+            return (void*)entry_vkGetPipelineCacheData;
+        case PROC_vkMergePipelineCaches:
+            return (void*)entry_vkMergePipelineCaches;
+        case PROC_vkCreateGraphicsPipelines:
+            return (void*)entry_vkCreateGraphicsPipelines;
+        case PROC_vkCreateComputePipelines:
+            return (void*)entry_vkCreateComputePipelines;
+        case PROC_vkDestroyPipeline:
+            return (void*)entry_vkDestroyPipeline;
+        case PROC_vkCreatePipelineLayout:
+            return (void*)entry_vkCreatePipelineLayout;
+        case PROC_vkDestroyPipelineLayout:
+            return (void*)entry_vkDestroyPipelineLayout;
+        case PROC_vkCreateSampler:
+            return (void*)entry_vkCreateSampler;
+        case PROC_vkDestroySampler:
+            return (void*)entry_vkDestroySampler;
+        case PROC_vkCreateDescriptorSetLayout:
+            return (void*)entry_vkCreateDescriptorSetLayout;
+        case PROC_vkDestroyDescriptorSetLayout:
+            return (void*)entry_vkDestroyDescriptorSetLayout;
+        case PROC_vkCreateDescriptorPool:
+            return (void*)entry_vkCreateDescriptorPool;
+        case PROC_vkDestroyDescriptorPool:
+            return (void*)entry_vkDestroyDescriptorPool;
+        case PROC_vkResetDescriptorPool:
+            return (void*)entry_vkResetDescriptorPool;
+        case PROC_vkAllocateDescriptorSets:
+            return (void*)entry_vkAllocateDescriptorSets;
+        case PROC_vkFreeDescriptorSets:
+            return (void*)entry_vkFreeDescriptorSets;
+        case PROC_vkUpdateDescriptorSets:
+            return (void*)entry_vkUpdateDescriptorSets;
+        case PROC_vkCreateFramebuffer:
+            return (void*)entry_vkCreateFramebuffer;
+        case PROC_vkDestroyFramebuffer:
+            return (void*)entry_vkDestroyFramebuffer;
+        case PROC_vkCreateRenderPass:
+            return (void*)entry_vkCreateRenderPass;
+        case PROC_vkDestroyRenderPass:
+            return (void*)entry_vkDestroyRenderPass;
+        case PROC_vkGetRenderAreaGranularity:
+            return (void*)entry_vkGetRenderAreaGranularity;
+        case PROC_vkCreateCommandPool:
+            return (void*)entry_vkCreateCommandPool;
+        case PROC_vkDestroyCommandPool:
+            return (void*)entry_vkDestroyCommandPool;
+        case PROC_vkResetCommandPool:
+            return (void*)entry_vkResetCommandPool;
+        case PROC_vkAllocateCommandBuffers:
+            return (void*)entry_vkAllocateCommandBuffers;
+        case PROC_vkFreeCommandBuffers:
+            return (void*)entry_vkFreeCommandBuffers;
+        case PROC_vkBeginCommandBuffer:
+            return (void*)entry_vkBeginCommandBuffer;
+        case PROC_vkEndCommandBuffer:
+            return (void*)entry_vkEndCommandBuffer;
+        case PROC_vkResetCommandBuffer:
+            return (void*)entry_vkResetCommandBuffer;
+        case PROC_vkCmdBindPipeline:
+            return (void*)entry_vkCmdBindPipeline;
+        case PROC_vkCmdSetViewport:
+            return (void*)entry_vkCmdSetViewport;
+        case PROC_vkCmdSetScissor:
+            return (void*)entry_vkCmdSetScissor;
+        case PROC_vkCmdSetLineWidth:
+            return (void*)entry_vkCmdSetLineWidth;
+        case PROC_vkCmdSetDepthBias:
+            return (void*)entry_vkCmdSetDepthBias;
+        case PROC_vkCmdSetBlendConstants:
+            return (void*)entry_vkCmdSetBlendConstants;
+        case PROC_vkCmdSetDepthBounds:
+            return (void*)entry_vkCmdSetDepthBounds;
+        case PROC_vkCmdSetStencilCompareMask:
+            return (void*)entry_vkCmdSetStencilCompareMask;
+        case PROC_vkCmdSetStencilWriteMask:
+            return (void*)entry_vkCmdSetStencilWriteMask;
+        case PROC_vkCmdSetStencilReference:
+            return (void*)entry_vkCmdSetStencilReference;
+        case PROC_vkCmdBindDescriptorSets:
+            return (void*)entry_vkCmdBindDescriptorSets;
+        case PROC_vkCmdBindIndexBuffer:
+            return (void*)entry_vkCmdBindIndexBuffer;
+        case PROC_vkCmdBindVertexBuffers:
+            return (void*)entry_vkCmdBindVertexBuffers;
+        case PROC_vkCmdDraw:
+            return (void*)entry_vkCmdDraw;
+        case PROC_vkCmdDrawIndexed:
+            return (void*)entry_vkCmdDrawIndexed;
+        case PROC_vkCmdDrawIndirect:
+            return (void*)entry_vkCmdDrawIndirect;
+        case PROC_vkCmdDrawIndexedIndirect:
+            return (void*)entry_vkCmdDrawIndexedIndirect;
+        case PROC_vkCmdDispatch:
+            return (void*)entry_vkCmdDispatch;
+        case PROC_vkCmdDispatchIndirect:
+            return (void*)entry_vkCmdDispatchIndirect;
+        case PROC_vkCmdCopyBuffer:
+            return (void*)entry_vkCmdCopyBuffer;
+        case PROC_vkCmdCopyImage:
+            return (void*)entry_vkCmdCopyImage;
+        case PROC_vkCmdBlitImage:
+            return (void*)entry_vkCmdBlitImage;
+        case PROC_vkCmdCopyBufferToImage:
+            return (void*)entry_vkCmdCopyBufferToImage;
+        case PROC_vkCmdCopyImageToBuffer:
+            return (void*)entry_vkCmdCopyImageToBuffer;
+        case PROC_vkCmdUpdateBuffer:
+            return (void*)entry_vkCmdUpdateBuffer;
+        case PROC_vkCmdFillBuffer:
+            return (void*)entry_vkCmdFillBuffer;
+        case PROC_vkCmdClearColorImage:
+            return (void*)entry_vkCmdClearColorImage;
+        case PROC_vkCmdClearDepthStencilImage:
+            return (void*)entry_vkCmdClearDepthStencilImage;
+        case PROC_vkCmdClearAttachments:
+            return (void*)entry_vkCmdClearAttachments;
+        case PROC_vkCmdResolveImage:
+            return (void*)entry_vkCmdResolveImage;
+        case PROC_vkCmdSetEvent:
+            return (void*)entry_vkCmdSetEvent;
+        case PROC_vkCmdResetEvent:
+            return (void*)entry_vkCmdResetEvent;
+        case PROC_vkCmdWaitEvents:
+            return (void*)entry_vkCmdWaitEvents;
+        case PROC_vkCmdPipelineBarrier:
+            return (void*)entry_vkCmdPipelineBarrier;
+        case PROC_vkCmdBeginQuery:
+            return (void*)entry_vkCmdBeginQuery;
+        case PROC_vkCmdEndQuery:
+            return (void*)entry_vkCmdEndQuery;
+        case PROC_vkCmdResetQueryPool:
+            return (void*)entry_vkCmdResetQueryPool;
+        case PROC_vkCmdWriteTimestamp:
+            return (void*)entry_vkCmdWriteTimestamp;
+        case PROC_vkCmdCopyQueryPoolResults:
+            return (void*)entry_vkCmdCopyQueryPoolResults;
+        case PROC_vkCmdPushConstants:
+            return (void*)entry_vkCmdPushConstants;
+        case PROC_vkCmdBeginRenderPass:
+            return (void*)entry_vkCmdBeginRenderPass;
+        case PROC_vkCmdNextSubpass:
+            return (void*)entry_vkCmdNextSubpass;
+        case PROC_vkCmdEndRenderPass:
+            return (void*)entry_vkCmdEndRenderPass;
+        case PROC_vkCmdExecuteCommands:
+            return (void*)entry_vkCmdExecuteCommands;
+#endif
+#ifdef VK_VERSION_1_1
+        case PROC_vkEnumerateInstanceVersion:
+            return has1_1OrHigher ? (void*)entry_vkEnumerateInstanceVersion : nullptr;
+        case PROC_vkBindBufferMemory2:
+            return has1_1OrHigher ? (void*)entry_vkBindBufferMemory2 : nullptr;
+        case PROC_vkBindImageMemory2:
+            return has1_1OrHigher ? (void*)entry_vkBindImageMemory2 : nullptr;
+        case PROC_vkGetDeviceGroupPeerMemoryFeatures:
+            return has1_1OrHigher ? (void*)entry_vkGetDeviceGroupPeerMemoryFeatures : nullptr;
+        case PROC_vkCmdSetDeviceMask:
+            return has1_1OrHigher ? (void*)entry_vkCmdSetDeviceMask : nullptr;
+        case PROC_vkCmdDispatchBase:
+            return has1_1OrHigher ? (void*)entry_vkCmdDispatchBase : nullptr;
+        case PROC_vkEnumeratePhysicalDeviceGroups:
+            return nullptr;
+        case PROC_vkGetImageMemoryRequirements2:
+            return has1_1OrHigher ? (void*)entry_vkGetImageMemoryRequirements2 : nullptr;
+        case PROC_vkGetBufferMemoryRequirements2:
+            return has1_1OrHigher ? (void*)entry_vkGetBufferMemoryRequirements2 : nullptr;
+        case PROC_vkGetImageSparseMemoryRequirements2:
+            return has1_1OrHigher ? (void*)entry_vkGetImageSparseMemoryRequirements2 : nullptr;
+        case PROC_vkGetPhysicalDeviceFeatures2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceFeatures2 : nullptr;
+        case PROC_vkGetPhysicalDeviceProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceFormatProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceFormatProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceImageFormatProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceImageFormatProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceMemoryProperties2:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceMemoryProperties2 : nullptr;
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties2: {
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties2
+                                  : nullptr;
+        }
+        case PROC_vkTrimCommandPool:
+            return has1_1OrHigher ? (void*)entry_vkTrimCommandPool : nullptr;
+        case PROC_vkGetDeviceQueue2:
+            return has1_1OrHigher ? (void*)entry_vkGetDeviceQueue2 : nullptr;
+        case PROC_vkCreateSamplerYcbcrConversion:
+            return has1_1OrHigher ? (void*)entry_vkCreateSamplerYcbcrConversion : nullptr;
+        case PROC_vkDestroySamplerYcbcrConversion:
+            return has1_1OrHigher ? (void*)entry_vkDestroySamplerYcbcrConversion : nullptr;
+        case PROC_vkCreateDescriptorUpdateTemplate:
+            return has1_1OrHigher ? (void*)entry_vkCreateDescriptorUpdateTemplate : nullptr;
+        case PROC_vkDestroyDescriptorUpdateTemplate:
+            return has1_1OrHigher ? (void*)entry_vkDestroyDescriptorUpdateTemplate : nullptr;
+        case PROC_vkUpdateDescriptorSetWithTemplate:
+            return has1_1OrHigher ? (void*)entry_vkUpdateDescriptorSetWithTemplate : nullptr;
+        case PROC_vkGetPhysicalDeviceExternalBufferProperties:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalBufferProperties : nullptr;
+        case PROC_vkGetPhysicalDeviceExternalFenceProperties:
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalFenceProperties : nullptr;
+        case PROC_vkGetPhysicalDeviceExternalSemaphoreProperties: {
+            return has1_1OrHigher ? (void*)entry_vkGetPhysicalDeviceExternalSemaphoreProperties
+                                  : nullptr;
+        }
+        case PROC_vkGetDescriptorSetLayoutSupport:
+            return has1_1OrHigher ? (void*)entry_vkGetDescriptorSetLayoutSupport : nullptr;
 #endif
 #ifdef VK_VERSION_1_2
-    if (!strcmp(name, "vkCmdDrawIndirectCount")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdDrawIndirectCount : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCount")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdDrawIndexedIndirectCount : nullptr;
-    }
-    if (!strcmp(name, "vkCreateRenderPass2")) {
-        return has1_2OrHigher ? (void*)entry_vkCreateRenderPass2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass2")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdBeginRenderPass2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass2")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdNextSubpass2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass2")) {
-        return has1_2OrHigher ? (void*)entry_vkCmdEndRenderPass2 : nullptr;
-    }
-    if (!strcmp(name, "vkResetQueryPool")) {
-        return has1_2OrHigher ? (void*)entry_vkResetQueryPool : nullptr;
-    }
-    if (!strcmp(name, "vkGetSemaphoreCounterValue")) {
-        return has1_2OrHigher ? (void*)entry_vkGetSemaphoreCounterValue : nullptr;
-    }
-    if (!strcmp(name, "vkWaitSemaphores")) {
-        return has1_2OrHigher ? (void*)entry_vkWaitSemaphores : nullptr;
-    }
-    if (!strcmp(name, "vkSignalSemaphore")) {
-        return has1_2OrHigher ? (void*)entry_vkSignalSemaphore : nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferDeviceAddress")) {
-        return has1_2OrHigher ? (void*)entry_vkGetBufferDeviceAddress : nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureAddress")) {
-        return has1_2OrHigher ? (void*)entry_vkGetBufferOpaqueCaptureAddress : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryOpaqueCaptureAddress")) {
-        return has1_2OrHigher ? (void*)entry_vkGetDeviceMemoryOpaqueCaptureAddress : nullptr;
-    }
+        case PROC_vkCmdDrawIndirectCount:
+            return has1_2OrHigher ? (void*)entry_vkCmdDrawIndirectCount : nullptr;
+        case PROC_vkCmdDrawIndexedIndirectCount:
+            return has1_2OrHigher ? (void*)entry_vkCmdDrawIndexedIndirectCount : nullptr;
+        case PROC_vkCreateRenderPass2:
+            return has1_2OrHigher ? (void*)entry_vkCreateRenderPass2 : nullptr;
+        case PROC_vkCmdBeginRenderPass2:
+            return has1_2OrHigher ? (void*)entry_vkCmdBeginRenderPass2 : nullptr;
+        case PROC_vkCmdNextSubpass2:
+            return has1_2OrHigher ? (void*)entry_vkCmdNextSubpass2 : nullptr;
+        case PROC_vkCmdEndRenderPass2:
+            return has1_2OrHigher ? (void*)entry_vkCmdEndRenderPass2 : nullptr;
+        case PROC_vkResetQueryPool:
+            return has1_2OrHigher ? (void*)entry_vkResetQueryPool : nullptr;
+        case PROC_vkGetSemaphoreCounterValue:
+            return has1_2OrHigher ? (void*)entry_vkGetSemaphoreCounterValue : nullptr;
+        case PROC_vkWaitSemaphores:
+            return has1_2OrHigher ? (void*)entry_vkWaitSemaphores : nullptr;
+        case PROC_vkSignalSemaphore:
+            return has1_2OrHigher ? (void*)entry_vkSignalSemaphore : nullptr;
+        case PROC_vkGetBufferDeviceAddress:
+            return has1_2OrHigher ? (void*)entry_vkGetBufferDeviceAddress : nullptr;
+        case PROC_vkGetBufferOpaqueCaptureAddress:
+            return has1_2OrHigher ? (void*)entry_vkGetBufferOpaqueCaptureAddress : nullptr;
+        case PROC_vkGetDeviceMemoryOpaqueCaptureAddress:
+            return has1_2OrHigher ? (void*)entry_vkGetDeviceMemoryOpaqueCaptureAddress : nullptr;
 #endif
 #ifdef VK_VERSION_1_3
-    if (!strcmp(name, "vkGetPhysicalDeviceToolProperties")) {
-        return has1_3OrHigher ? (void*)entry_vkGetPhysicalDeviceToolProperties : nullptr;
-    }
-    if (!strcmp(name, "vkCreatePrivateDataSlot")) {
-        return has1_3OrHigher ? (void*)entry_vkCreatePrivateDataSlot : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyPrivateDataSlot")) {
-        return has1_3OrHigher ? (void*)entry_vkDestroyPrivateDataSlot : nullptr;
-    }
-    if (!strcmp(name, "vkSetPrivateData")) {
-        return has1_3OrHigher ? (void*)entry_vkSetPrivateData : nullptr;
-    }
-    if (!strcmp(name, "vkGetPrivateData")) {
-        return has1_3OrHigher ? (void*)entry_vkGetPrivateData : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetEvent2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetEvent2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdResetEvent2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdResetEvent2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdWaitEvents2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdPipelineBarrier2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdWriteTimestamp2 : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmit2")) {
-        return has1_3OrHigher ? (void*)entry_vkQueueSubmit2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyBuffer2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdCopyBuffer2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImage2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdCopyImage2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdCopyBufferToImage2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdCopyImageToBuffer2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBlitImage2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdBlitImage2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdResolveImage2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdResolveImage2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginRendering")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdBeginRendering : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRendering")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdEndRendering : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCullMode")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetCullMode : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetFrontFace")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetFrontFace : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveTopology")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetPrimitiveTopology : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWithCount")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetViewportWithCount : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetScissorWithCount")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetScissorWithCount : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers2")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdBindVertexBuffers2 : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthTestEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthTestEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthWriteEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthWriteEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthCompareOp")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthCompareOp : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBoundsTestEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthBoundsTestEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilTestEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetStencilTestEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilOp")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetStencilOp : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizerDiscardEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetRasterizerDiscardEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBiasEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetDepthBiasEnable : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveRestartEnable")) {
-        return has1_3OrHigher ? (void*)entry_vkCmdSetPrimitiveRestartEnable : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceBufferMemoryRequirements")) {
-        return has1_3OrHigher ? (void*)entry_vkGetDeviceBufferMemoryRequirements : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceImageMemoryRequirements")) {
-        return has1_3OrHigher ? (void*)entry_vkGetDeviceImageMemoryRequirements : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceImageSparseMemoryRequirements")) {
-        return has1_3OrHigher ? (void*)entry_vkGetDeviceImageSparseMemoryRequirements : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceToolProperties:
+            return has1_3OrHigher ? (void*)entry_vkGetPhysicalDeviceToolProperties : nullptr;
+        case PROC_vkCreatePrivateDataSlot:
+            return has1_3OrHigher ? (void*)entry_vkCreatePrivateDataSlot : nullptr;
+        case PROC_vkDestroyPrivateDataSlot:
+            return has1_3OrHigher ? (void*)entry_vkDestroyPrivateDataSlot : nullptr;
+        case PROC_vkSetPrivateData:
+            return has1_3OrHigher ? (void*)entry_vkSetPrivateData : nullptr;
+        case PROC_vkGetPrivateData:
+            return has1_3OrHigher ? (void*)entry_vkGetPrivateData : nullptr;
+        case PROC_vkCmdSetEvent2:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetEvent2 : nullptr;
+        case PROC_vkCmdResetEvent2:
+            return has1_3OrHigher ? (void*)entry_vkCmdResetEvent2 : nullptr;
+        case PROC_vkCmdWaitEvents2:
+            return has1_3OrHigher ? (void*)entry_vkCmdWaitEvents2 : nullptr;
+        case PROC_vkCmdPipelineBarrier2:
+            return has1_3OrHigher ? (void*)entry_vkCmdPipelineBarrier2 : nullptr;
+        case PROC_vkCmdWriteTimestamp2:
+            return has1_3OrHigher ? (void*)entry_vkCmdWriteTimestamp2 : nullptr;
+        case PROC_vkQueueSubmit2:
+            return has1_3OrHigher ? (void*)entry_vkQueueSubmit2 : nullptr;
+        case PROC_vkCmdCopyBuffer2:
+            return has1_3OrHigher ? (void*)entry_vkCmdCopyBuffer2 : nullptr;
+        case PROC_vkCmdCopyImage2:
+            return has1_3OrHigher ? (void*)entry_vkCmdCopyImage2 : nullptr;
+        case PROC_vkCmdCopyBufferToImage2:
+            return has1_3OrHigher ? (void*)entry_vkCmdCopyBufferToImage2 : nullptr;
+        case PROC_vkCmdCopyImageToBuffer2:
+            return has1_3OrHigher ? (void*)entry_vkCmdCopyImageToBuffer2 : nullptr;
+        case PROC_vkCmdBlitImage2:
+            return has1_3OrHigher ? (void*)entry_vkCmdBlitImage2 : nullptr;
+        case PROC_vkCmdResolveImage2:
+            return has1_3OrHigher ? (void*)entry_vkCmdResolveImage2 : nullptr;
+        case PROC_vkCmdBeginRendering:
+            return has1_3OrHigher ? (void*)entry_vkCmdBeginRendering : nullptr;
+        case PROC_vkCmdEndRendering:
+            return has1_3OrHigher ? (void*)entry_vkCmdEndRendering : nullptr;
+        case PROC_vkCmdSetCullMode:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetCullMode : nullptr;
+        case PROC_vkCmdSetFrontFace:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetFrontFace : nullptr;
+        case PROC_vkCmdSetPrimitiveTopology:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetPrimitiveTopology : nullptr;
+        case PROC_vkCmdSetViewportWithCount:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetViewportWithCount : nullptr;
+        case PROC_vkCmdSetScissorWithCount:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetScissorWithCount : nullptr;
+        case PROC_vkCmdBindVertexBuffers2:
+            return has1_3OrHigher ? (void*)entry_vkCmdBindVertexBuffers2 : nullptr;
+        case PROC_vkCmdSetDepthTestEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthTestEnable : nullptr;
+        case PROC_vkCmdSetDepthWriteEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthWriteEnable : nullptr;
+        case PROC_vkCmdSetDepthCompareOp:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthCompareOp : nullptr;
+        case PROC_vkCmdSetDepthBoundsTestEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthBoundsTestEnable : nullptr;
+        case PROC_vkCmdSetStencilTestEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetStencilTestEnable : nullptr;
+        case PROC_vkCmdSetStencilOp:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetStencilOp : nullptr;
+        case PROC_vkCmdSetRasterizerDiscardEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetRasterizerDiscardEnable : nullptr;
+        case PROC_vkCmdSetDepthBiasEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetDepthBiasEnable : nullptr;
+        case PROC_vkCmdSetPrimitiveRestartEnable:
+            return has1_3OrHigher ? (void*)entry_vkCmdSetPrimitiveRestartEnable : nullptr;
+        case PROC_vkGetDeviceBufferMemoryRequirements:
+            return has1_3OrHigher ? (void*)entry_vkGetDeviceBufferMemoryRequirements : nullptr;
+        case PROC_vkGetDeviceImageMemoryRequirements:
+            return has1_3OrHigher ? (void*)entry_vkGetDeviceImageMemoryRequirements : nullptr;
+        case PROC_vkGetDeviceImageSparseMemoryRequirements:
+            return has1_3OrHigher ? (void*)entry_vkGetDeviceImageSparseMemoryRequirements : nullptr;
 #endif
 #ifdef VK_KHR_surface
-    if (!strcmp(name, "vkDestroySurfaceKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkDestroySurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceSupportKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceSupportKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilitiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceFormatsKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceFormatsKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfacePresentModesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfacePresentModesKHR : nullptr;
-    }
+        case PROC_vkDestroySurfaceKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkDestroySurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfaceSupportKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceSupportKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilitiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilitiesKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfaceFormatsKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceFormatsKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfacePresentModesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfacePresentModesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_swapchain
-    if (!strcmp(name, "vkCreateSwapchainKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkCreateSwapchainKHR : nullptr;
-    }
-    if (!strcmp(name, "vkDestroySwapchainKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkDestroySwapchainKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetSwapchainImagesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkGetSwapchainImagesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkAcquireNextImageKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkAcquireNextImageKHR : nullptr;
-    }
-    if (!strcmp(name, "vkQueuePresentKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkQueuePresentKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupPresentCapabilitiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkGetDeviceGroupPresentCapabilitiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupSurfacePresentModesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkGetDeviceGroupSurfacePresentModesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDevicePresentRectanglesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkGetPhysicalDevicePresentRectanglesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkAcquireNextImage2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
-        return hasExt ? (void*)entry_vkAcquireNextImage2KHR : nullptr;
-    }
+        case PROC_vkCreateSwapchainKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkCreateSwapchainKHR : nullptr;
+        }
+        case PROC_vkDestroySwapchainKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkDestroySwapchainKHR : nullptr;
+        }
+        case PROC_vkGetSwapchainImagesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkGetSwapchainImagesKHR : nullptr;
+        }
+        case PROC_vkAcquireNextImageKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkAcquireNextImageKHR : nullptr;
+        }
+        case PROC_vkQueuePresentKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkQueuePresentKHR : nullptr;
+        }
+        case PROC_vkGetDeviceGroupPresentCapabilitiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkGetDeviceGroupPresentCapabilitiesKHR : nullptr;
+        }
+        case PROC_vkGetDeviceGroupSurfacePresentModesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkGetDeviceGroupSurfacePresentModesKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDevicePresentRectanglesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkGetPhysicalDevicePresentRectanglesKHR : nullptr;
+        }
+        case PROC_vkAcquireNextImage2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_swapchain");
+            return hasExt ? (void*)entry_vkAcquireNextImage2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_display
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPlanePropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneSupportedDisplaysKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetDisplayPlaneSupportedDisplaysKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayModePropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetDisplayModePropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCreateDisplayModeKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkCreateDisplayModeKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneCapabilitiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkGetDisplayPlaneCapabilitiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCreateDisplayPlaneSurfaceKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
-        return hasExt ? (void*)entry_vkCreateDisplayPlaneSurfaceKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceDisplayPropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPropertiesKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceDisplayPlanePropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPlanePropertiesKHR : nullptr;
+        }
+        case PROC_vkGetDisplayPlaneSupportedDisplaysKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetDisplayPlaneSupportedDisplaysKHR : nullptr;
+        }
+        case PROC_vkGetDisplayModePropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetDisplayModePropertiesKHR : nullptr;
+        }
+        case PROC_vkCreateDisplayModeKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkCreateDisplayModeKHR : nullptr;
+        }
+        case PROC_vkGetDisplayPlaneCapabilitiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkGetDisplayPlaneCapabilitiesKHR : nullptr;
+        }
+        case PROC_vkCreateDisplayPlaneSurfaceKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display");
+            return hasExt ? (void*)entry_vkCreateDisplayPlaneSurfaceKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_display_swapchain
-    if (!strcmp(name, "vkCreateSharedSwapchainsKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display_swapchain");
-        return hasExt ? (void*)entry_vkCreateSharedSwapchainsKHR : nullptr;
-    }
+        case PROC_vkCreateSharedSwapchainsKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_display_swapchain");
+            return hasExt ? (void*)entry_vkCreateSharedSwapchainsKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_xlib_surface
-    if (!strcmp(name, "vkCreateXlibSurfaceKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_xlib_surface");
-        return hasExt ? (void*)entry_vkCreateXlibSurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceXlibPresentationSupportKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_xlib_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceXlibPresentationSupportKHR : nullptr;
-    }
+        case PROC_vkCreateXlibSurfaceKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_xlib_surface");
+            return hasExt ? (void*)entry_vkCreateXlibSurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceXlibPresentationSupportKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_xlib_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceXlibPresentationSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_xcb_surface
-    if (!strcmp(name, "vkCreateXcbSurfaceKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_xcb_surface");
-        return hasExt ? (void*)entry_vkCreateXcbSurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceXcbPresentationSupportKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_xcb_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceXcbPresentationSupportKHR : nullptr;
-    }
+        case PROC_vkCreateXcbSurfaceKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_xcb_surface");
+            return hasExt ? (void*)entry_vkCreateXcbSurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceXcbPresentationSupportKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_xcb_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceXcbPresentationSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_wayland_surface
-    if (!strcmp(name, "vkCreateWaylandSurfaceKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_wayland_surface");
-        return hasExt ? (void*)entry_vkCreateWaylandSurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceWaylandPresentationSupportKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_wayland_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceWaylandPresentationSupportKHR : nullptr;
-    }
+        case PROC_vkCreateWaylandSurfaceKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_wayland_surface");
+            return hasExt ? (void*)entry_vkCreateWaylandSurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceWaylandPresentationSupportKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_wayland_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceWaylandPresentationSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_android_surface
-    if (!strcmp(name, "vkCreateAndroidSurfaceKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_android_surface");
-        return hasExt ? (void*)entry_vkCreateAndroidSurfaceKHR : nullptr;
-    }
+        case PROC_vkCreateAndroidSurfaceKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_android_surface");
+            return hasExt ? (void*)entry_vkCreateAndroidSurfaceKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_win32_surface
-    if (!strcmp(name, "vkCreateWin32SurfaceKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_win32_surface");
-        return hasExt ? (void*)entry_vkCreateWin32SurfaceKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceWin32PresentationSupportKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_win32_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceWin32PresentationSupportKHR : nullptr;
-    }
+        case PROC_vkCreateWin32SurfaceKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_win32_surface");
+            return hasExt ? (void*)entry_vkCreateWin32SurfaceKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceWin32PresentationSupportKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_win32_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceWin32PresentationSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_video_queue
-    if (!strcmp(name, "vkGetPhysicalDeviceVideoCapabilitiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceVideoCapabilitiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceVideoFormatPropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceVideoFormatPropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCreateVideoSessionKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkCreateVideoSessionKHR : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyVideoSessionKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkDestroyVideoSessionKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetVideoSessionMemoryRequirementsKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkGetVideoSessionMemoryRequirementsKHR : nullptr;
-    }
-    if (!strcmp(name, "vkBindVideoSessionMemoryKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkBindVideoSessionMemoryKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCreateVideoSessionParametersKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkCreateVideoSessionParametersKHR : nullptr;
-    }
-    if (!strcmp(name, "vkUpdateVideoSessionParametersKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkUpdateVideoSessionParametersKHR : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyVideoSessionParametersKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkDestroyVideoSessionParametersKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginVideoCodingKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkCmdBeginVideoCodingKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndVideoCodingKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkCmdEndVideoCodingKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdControlVideoCodingKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
-        return hasExt ? (void*)entry_vkCmdControlVideoCodingKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceVideoCapabilitiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceVideoCapabilitiesKHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceVideoFormatPropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceVideoFormatPropertiesKHR : nullptr;
+        }
+        case PROC_vkCreateVideoSessionKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkCreateVideoSessionKHR : nullptr;
+        }
+        case PROC_vkDestroyVideoSessionKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkDestroyVideoSessionKHR : nullptr;
+        }
+        case PROC_vkGetVideoSessionMemoryRequirementsKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkGetVideoSessionMemoryRequirementsKHR : nullptr;
+        }
+        case PROC_vkBindVideoSessionMemoryKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkBindVideoSessionMemoryKHR : nullptr;
+        }
+        case PROC_vkCreateVideoSessionParametersKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkCreateVideoSessionParametersKHR : nullptr;
+        }
+        case PROC_vkUpdateVideoSessionParametersKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkUpdateVideoSessionParametersKHR : nullptr;
+        }
+        case PROC_vkDestroyVideoSessionParametersKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkDestroyVideoSessionParametersKHR : nullptr;
+        }
+        case PROC_vkCmdBeginVideoCodingKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkCmdBeginVideoCodingKHR : nullptr;
+        }
+        case PROC_vkCmdEndVideoCodingKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkCmdEndVideoCodingKHR : nullptr;
+        }
+        case PROC_vkCmdControlVideoCodingKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_queue");
+            return hasExt ? (void*)entry_vkCmdControlVideoCodingKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_video_decode_queue
-    if (!strcmp(name, "vkCmdDecodeVideoKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_decode_queue");
-        return hasExt ? (void*)entry_vkCmdDecodeVideoKHR : nullptr;
-    }
+        case PROC_vkCmdDecodeVideoKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_decode_queue");
+            return hasExt ? (void*)entry_vkCmdDecodeVideoKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_dynamic_rendering
-    if (!strcmp(name, "vkCmdBeginRenderingKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_dynamic_rendering");
-        return hasExt ? (void*)entry_vkCmdBeginRenderingKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRenderingKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_dynamic_rendering");
-        return hasExt ? (void*)entry_vkCmdEndRenderingKHR : nullptr;
-    }
+        case PROC_vkCmdBeginRenderingKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_dynamic_rendering");
+            return hasExt ? (void*)entry_vkCmdBeginRenderingKHR : nullptr;
+        }
+        case PROC_vkCmdEndRenderingKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_dynamic_rendering");
+            return hasExt ? (void*)entry_vkCmdEndRenderingKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_get_physical_device_properties2
-    if (!strcmp(name, "vkGetPhysicalDeviceFeatures2KHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceFeatures2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceProperties2KHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceFormatProperties2KHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceFormatProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceImageFormatProperties2KHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceImageFormatProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyProperties2KHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMemoryProperties2KHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceMemoryProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties2KHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceFeatures2KHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceFeatures2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceProperties2KHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceFormatProperties2KHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceFormatProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceImageFormatProperties2KHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceImageFormatProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceQueueFamilyProperties2KHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceQueueFamilyProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceMemoryProperties2KHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceMemoryProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSparseImageFormatProperties2KHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_get_physical_device_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSparseImageFormatProperties2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_device_group
-    if (!strcmp(name, "vkGetDeviceGroupPeerMemoryFeaturesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_device_group");
-        return hasExt ? (void*)entry_vkGetDeviceGroupPeerMemoryFeaturesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDeviceMaskKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_device_group");
-        return hasExt ? (void*)entry_vkCmdSetDeviceMaskKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDispatchBaseKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_device_group");
-        return hasExt ? (void*)entry_vkCmdDispatchBaseKHR : nullptr;
-    }
+        case PROC_vkGetDeviceGroupPeerMemoryFeaturesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_device_group");
+            return hasExt ? (void*)entry_vkGetDeviceGroupPeerMemoryFeaturesKHR : nullptr;
+        }
+        case PROC_vkCmdSetDeviceMaskKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_device_group");
+            return hasExt ? (void*)entry_vkCmdSetDeviceMaskKHR : nullptr;
+        }
+        case PROC_vkCmdDispatchBaseKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_device_group");
+            return hasExt ? (void*)entry_vkCmdDispatchBaseKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_maintenance1
-    if (!strcmp(name, "vkTrimCommandPoolKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance1");
-        return hasExt ? (void*)entry_vkTrimCommandPoolKHR : nullptr;
-    }
+        case PROC_vkTrimCommandPoolKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance1");
+            return hasExt ? (void*)entry_vkTrimCommandPoolKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_device_group_creation
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceGroupsKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_device_group_creation");
-        return hasExt ? (void*)entry_vkEnumeratePhysicalDeviceGroupsKHR : nullptr;
-    }
+        case PROC_vkEnumeratePhysicalDeviceGroupsKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_device_group_creation");
+            return hasExt ? (void*)entry_vkEnumeratePhysicalDeviceGroupsKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_memory_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalBufferPropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_capabilities");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalBufferPropertiesKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalBufferPropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_capabilities");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalBufferPropertiesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_memory_win32
-    if (!strcmp(name, "vkGetMemoryWin32HandleKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_win32");
-        return hasExt ? (void*)entry_vkGetMemoryWin32HandleKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryWin32HandlePropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_win32");
-        return hasExt ? (void*)entry_vkGetMemoryWin32HandlePropertiesKHR : nullptr;
-    }
+        case PROC_vkGetMemoryWin32HandleKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_win32");
+            return hasExt ? (void*)entry_vkGetMemoryWin32HandleKHR : nullptr;
+        }
+        case PROC_vkGetMemoryWin32HandlePropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_win32");
+            return hasExt ? (void*)entry_vkGetMemoryWin32HandlePropertiesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_memory_fd
-    if (!strcmp(name, "vkGetMemoryFdKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_fd");
-        return hasExt ? (void*)entry_vkGetMemoryFdKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryFdPropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_fd");
-        return hasExt ? (void*)entry_vkGetMemoryFdPropertiesKHR : nullptr;
-    }
+        case PROC_vkGetMemoryFdKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_fd");
+            return hasExt ? (void*)entry_vkGetMemoryFdKHR : nullptr;
+        }
+        case PROC_vkGetMemoryFdPropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_memory_fd");
+            return hasExt ? (void*)entry_vkGetMemoryFdPropertiesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_semaphore_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_capabilities");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_capabilities");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_semaphore_win32
-    if (!strcmp(name, "vkImportSemaphoreWin32HandleKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_win32");
-        return hasExt ? (void*)entry_vkImportSemaphoreWin32HandleKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetSemaphoreWin32HandleKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_win32");
-        return hasExt ? (void*)entry_vkGetSemaphoreWin32HandleKHR : nullptr;
-    }
+        case PROC_vkImportSemaphoreWin32HandleKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_win32");
+            return hasExt ? (void*)entry_vkImportSemaphoreWin32HandleKHR : nullptr;
+        }
+        case PROC_vkGetSemaphoreWin32HandleKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_win32");
+            return hasExt ? (void*)entry_vkGetSemaphoreWin32HandleKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_semaphore_fd
-    if (!strcmp(name, "vkImportSemaphoreFdKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_fd");
-        return hasExt ? (void*)entry_vkImportSemaphoreFdKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetSemaphoreFdKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_fd");
-        return hasExt ? (void*)entry_vkGetSemaphoreFdKHR : nullptr;
-    }
+        case PROC_vkImportSemaphoreFdKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_fd");
+            return hasExt ? (void*)entry_vkImportSemaphoreFdKHR : nullptr;
+        }
+        case PROC_vkGetSemaphoreFdKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_semaphore_fd");
+            return hasExt ? (void*)entry_vkGetSemaphoreFdKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_push_descriptor
-    if (!strcmp(name, "vkCmdPushDescriptorSetKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_push_descriptor");
-        return hasExt ? (void*)entry_vkCmdPushDescriptorSetKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdPushDescriptorSetWithTemplateKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_push_descriptor");
-        return hasExt ? (void*)entry_vkCmdPushDescriptorSetWithTemplateKHR : nullptr;
-    }
+        case PROC_vkCmdPushDescriptorSetKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_push_descriptor");
+            return hasExt ? (void*)entry_vkCmdPushDescriptorSetKHR : nullptr;
+        }
+        case PROC_vkCmdPushDescriptorSetWithTemplateKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_push_descriptor");
+            return hasExt ? (void*)entry_vkCmdPushDescriptorSetWithTemplateKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_descriptor_update_template
-    if (!strcmp(name, "vkCreateDescriptorUpdateTemplateKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_descriptor_update_template");
-        return hasExt ? (void*)entry_vkCreateDescriptorUpdateTemplateKHR : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDescriptorUpdateTemplateKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_descriptor_update_template");
-        return hasExt ? (void*)entry_vkDestroyDescriptorUpdateTemplateKHR : nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_descriptor_update_template");
-        return hasExt ? (void*)entry_vkUpdateDescriptorSetWithTemplateKHR : nullptr;
-    }
+        case PROC_vkCreateDescriptorUpdateTemplateKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_descriptor_update_template");
+            return hasExt ? (void*)entry_vkCreateDescriptorUpdateTemplateKHR : nullptr;
+        }
+        case PROC_vkDestroyDescriptorUpdateTemplateKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_descriptor_update_template");
+            return hasExt ? (void*)entry_vkDestroyDescriptorUpdateTemplateKHR : nullptr;
+        }
+        case PROC_vkUpdateDescriptorSetWithTemplateKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_descriptor_update_template");
+            return hasExt ? (void*)entry_vkUpdateDescriptorSetWithTemplateKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_create_renderpass2
-    if (!strcmp(name, "vkCreateRenderPass2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_create_renderpass2");
-        return hasExt ? (void*)entry_vkCreateRenderPass2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginRenderPass2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_create_renderpass2");
-        return hasExt ? (void*)entry_vkCmdBeginRenderPass2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdNextSubpass2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_create_renderpass2");
-        return hasExt ? (void*)entry_vkCmdNextSubpass2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndRenderPass2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_create_renderpass2");
-        return hasExt ? (void*)entry_vkCmdEndRenderPass2KHR : nullptr;
-    }
+        case PROC_vkCreateRenderPass2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_create_renderpass2");
+            return hasExt ? (void*)entry_vkCreateRenderPass2KHR : nullptr;
+        }
+        case PROC_vkCmdBeginRenderPass2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_create_renderpass2");
+            return hasExt ? (void*)entry_vkCmdBeginRenderPass2KHR : nullptr;
+        }
+        case PROC_vkCmdNextSubpass2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_create_renderpass2");
+            return hasExt ? (void*)entry_vkCmdNextSubpass2KHR : nullptr;
+        }
+        case PROC_vkCmdEndRenderPass2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_create_renderpass2");
+            return hasExt ? (void*)entry_vkCmdEndRenderPass2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_shared_presentable_image
-    if (!strcmp(name, "vkGetSwapchainStatusKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_shared_presentable_image");
-        return hasExt ? (void*)entry_vkGetSwapchainStatusKHR : nullptr;
-    }
+        case PROC_vkGetSwapchainStatusKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_shared_presentable_image");
+            return hasExt ? (void*)entry_vkGetSwapchainStatusKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_fence_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalFencePropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_capabilities");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalFencePropertiesKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalFencePropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_capabilities");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalFencePropertiesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_fence_win32
-    if (!strcmp(name, "vkImportFenceWin32HandleKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_win32");
-        return hasExt ? (void*)entry_vkImportFenceWin32HandleKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetFenceWin32HandleKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_win32");
-        return hasExt ? (void*)entry_vkGetFenceWin32HandleKHR : nullptr;
-    }
+        case PROC_vkImportFenceWin32HandleKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_win32");
+            return hasExt ? (void*)entry_vkImportFenceWin32HandleKHR : nullptr;
+        }
+        case PROC_vkGetFenceWin32HandleKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_win32");
+            return hasExt ? (void*)entry_vkGetFenceWin32HandleKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_external_fence_fd
-    if (!strcmp(name, "vkImportFenceFdKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_fd");
-        return hasExt ? (void*)entry_vkImportFenceFdKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetFenceFdKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_fd");
-        return hasExt ? (void*)entry_vkGetFenceFdKHR : nullptr;
-    }
+        case PROC_vkImportFenceFdKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_fd");
+            return hasExt ? (void*)entry_vkImportFenceFdKHR : nullptr;
+        }
+        case PROC_vkGetFenceFdKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_external_fence_fd");
+            return hasExt ? (void*)entry_vkGetFenceFdKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_performance_query
-    if (!strcmp(name, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_performance_query");
-        return hasExt ? (void*)entry_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR
-                      : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_performance_query");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
-                      : nullptr;
-    }
-    if (!strcmp(name, "vkAcquireProfilingLockKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_performance_query");
-        return hasExt ? (void*)entry_vkAcquireProfilingLockKHR : nullptr;
-    }
-    if (!strcmp(name, "vkReleaseProfilingLockKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_performance_query");
-        return hasExt ? (void*)entry_vkReleaseProfilingLockKHR : nullptr;
-    }
+        case PROC_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_performance_query");
+            return hasExt ? (void*)entry_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR
+                          : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_performance_query");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
+                          : nullptr;
+        }
+        case PROC_vkAcquireProfilingLockKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_performance_query");
+            return hasExt ? (void*)entry_vkAcquireProfilingLockKHR : nullptr;
+        }
+        case PROC_vkReleaseProfilingLockKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_performance_query");
+            return hasExt ? (void*)entry_vkReleaseProfilingLockKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_get_surface_capabilities2
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilities2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_surface_capabilities2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilities2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceFormats2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_surface_capabilities2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceFormats2KHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilities2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_surface_capabilities2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilities2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceSurfaceFormats2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_surface_capabilities2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceFormats2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_get_display_properties2
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayProperties2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_display_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_display_properties2");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPlaneProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayModeProperties2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_display_properties2");
-        return hasExt ? (void*)entry_vkGetDisplayModeProperties2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDisplayPlaneCapabilities2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_display_properties2");
-        return hasExt ? (void*)entry_vkGetDisplayPlaneCapabilities2KHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceDisplayProperties2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_display_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayProperties2KHR : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceDisplayPlaneProperties2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_display_properties2");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDisplayPlaneProperties2KHR : nullptr;
+        }
+        case PROC_vkGetDisplayModeProperties2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_display_properties2");
+            return hasExt ? (void*)entry_vkGetDisplayModeProperties2KHR : nullptr;
+        }
+        case PROC_vkGetDisplayPlaneCapabilities2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_display_properties2");
+            return hasExt ? (void*)entry_vkGetDisplayPlaneCapabilities2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_get_memory_requirements2
-    if (!strcmp(name, "vkGetImageMemoryRequirements2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_memory_requirements2");
-        return hasExt ? (void*)entry_vkGetImageMemoryRequirements2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferMemoryRequirements2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_memory_requirements2");
-        return hasExt ? (void*)entry_vkGetBufferMemoryRequirements2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetImageSparseMemoryRequirements2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_memory_requirements2");
-        return hasExt ? (void*)entry_vkGetImageSparseMemoryRequirements2KHR : nullptr;
-    }
+        case PROC_vkGetImageMemoryRequirements2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_memory_requirements2");
+            return hasExt ? (void*)entry_vkGetImageMemoryRequirements2KHR : nullptr;
+        }
+        case PROC_vkGetBufferMemoryRequirements2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_memory_requirements2");
+            return hasExt ? (void*)entry_vkGetBufferMemoryRequirements2KHR : nullptr;
+        }
+        case PROC_vkGetImageSparseMemoryRequirements2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_get_memory_requirements2");
+            return hasExt ? (void*)entry_vkGetImageSparseMemoryRequirements2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_sampler_ycbcr_conversion
-    if (!strcmp(name, "vkCreateSamplerYcbcrConversionKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_sampler_ycbcr_conversion");
-        return hasExt ? (void*)entry_vkCreateSamplerYcbcrConversionKHR : nullptr;
-    }
-    if (!strcmp(name, "vkDestroySamplerYcbcrConversionKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_sampler_ycbcr_conversion");
-        return hasExt ? (void*)entry_vkDestroySamplerYcbcrConversionKHR : nullptr;
-    }
+        case PROC_vkCreateSamplerYcbcrConversionKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_sampler_ycbcr_conversion");
+            return hasExt ? (void*)entry_vkCreateSamplerYcbcrConversionKHR : nullptr;
+        }
+        case PROC_vkDestroySamplerYcbcrConversionKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_sampler_ycbcr_conversion");
+            return hasExt ? (void*)entry_vkDestroySamplerYcbcrConversionKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_bind_memory2
-    if (!strcmp(name, "vkBindBufferMemory2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_bind_memory2");
-        return hasExt ? (void*)entry_vkBindBufferMemory2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkBindImageMemory2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_bind_memory2");
-        return hasExt ? (void*)entry_vkBindImageMemory2KHR : nullptr;
-    }
+        case PROC_vkBindBufferMemory2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_bind_memory2");
+            return hasExt ? (void*)entry_vkBindBufferMemory2KHR : nullptr;
+        }
+        case PROC_vkBindImageMemory2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_bind_memory2");
+            return hasExt ? (void*)entry_vkBindImageMemory2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_maintenance3
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSupportKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance3");
-        return hasExt ? (void*)entry_vkGetDescriptorSetLayoutSupportKHR : nullptr;
-    }
+        case PROC_vkGetDescriptorSetLayoutSupportKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance3");
+            return hasExt ? (void*)entry_vkGetDescriptorSetLayoutSupportKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_draw_indirect_count
-    if (!strcmp(name, "vkCmdDrawIndirectCountKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_draw_indirect_count");
-        return hasExt ? (void*)entry_vkCmdDrawIndirectCountKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCountKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_draw_indirect_count");
-        return hasExt ? (void*)entry_vkCmdDrawIndexedIndirectCountKHR : nullptr;
-    }
+        case PROC_vkCmdDrawIndirectCountKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_draw_indirect_count");
+            return hasExt ? (void*)entry_vkCmdDrawIndirectCountKHR : nullptr;
+        }
+        case PROC_vkCmdDrawIndexedIndirectCountKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_draw_indirect_count");
+            return hasExt ? (void*)entry_vkCmdDrawIndexedIndirectCountKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_timeline_semaphore
-    if (!strcmp(name, "vkGetSemaphoreCounterValueKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_timeline_semaphore");
-        return hasExt ? (void*)entry_vkGetSemaphoreCounterValueKHR : nullptr;
-    }
-    if (!strcmp(name, "vkWaitSemaphoresKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_timeline_semaphore");
-        return hasExt ? (void*)entry_vkWaitSemaphoresKHR : nullptr;
-    }
-    if (!strcmp(name, "vkSignalSemaphoreKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_timeline_semaphore");
-        return hasExt ? (void*)entry_vkSignalSemaphoreKHR : nullptr;
-    }
+        case PROC_vkGetSemaphoreCounterValueKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_timeline_semaphore");
+            return hasExt ? (void*)entry_vkGetSemaphoreCounterValueKHR : nullptr;
+        }
+        case PROC_vkWaitSemaphoresKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_timeline_semaphore");
+            return hasExt ? (void*)entry_vkWaitSemaphoresKHR : nullptr;
+        }
+        case PROC_vkSignalSemaphoreKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_timeline_semaphore");
+            return hasExt ? (void*)entry_vkSignalSemaphoreKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_fragment_shading_rate
-    if (!strcmp(name, "vkGetPhysicalDeviceFragmentShadingRatesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_fragment_shading_rate");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceFragmentShadingRatesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetFragmentShadingRateKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_fragment_shading_rate");
-        return hasExt ? (void*)entry_vkCmdSetFragmentShadingRateKHR : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceFragmentShadingRatesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_fragment_shading_rate");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceFragmentShadingRatesKHR : nullptr;
+        }
+        case PROC_vkCmdSetFragmentShadingRateKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_fragment_shading_rate");
+            return hasExt ? (void*)entry_vkCmdSetFragmentShadingRateKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_present_wait
-    if (!strcmp(name, "vkWaitForPresentKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_present_wait");
-        return hasExt ? (void*)entry_vkWaitForPresentKHR : nullptr;
-    }
+        case PROC_vkWaitForPresentKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_present_wait");
+            return hasExt ? (void*)entry_vkWaitForPresentKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_buffer_device_address
-    if (!strcmp(name, "vkGetBufferDeviceAddressKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_buffer_device_address");
-        return hasExt ? (void*)entry_vkGetBufferDeviceAddressKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureAddressKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_buffer_device_address");
-        return hasExt ? (void*)entry_vkGetBufferOpaqueCaptureAddressKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceMemoryOpaqueCaptureAddressKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_buffer_device_address");
-        return hasExt ? (void*)entry_vkGetDeviceMemoryOpaqueCaptureAddressKHR : nullptr;
-    }
+        case PROC_vkGetBufferDeviceAddressKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_buffer_device_address");
+            return hasExt ? (void*)entry_vkGetBufferDeviceAddressKHR : nullptr;
+        }
+        case PROC_vkGetBufferOpaqueCaptureAddressKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_buffer_device_address");
+            return hasExt ? (void*)entry_vkGetBufferOpaqueCaptureAddressKHR : nullptr;
+        }
+        case PROC_vkGetDeviceMemoryOpaqueCaptureAddressKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_buffer_device_address");
+            return hasExt ? (void*)entry_vkGetDeviceMemoryOpaqueCaptureAddressKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_deferred_host_operations
-    if (!strcmp(name, "vkCreateDeferredOperationKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
-        return hasExt ? (void*)entry_vkCreateDeferredOperationKHR : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDeferredOperationKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
-        return hasExt ? (void*)entry_vkDestroyDeferredOperationKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeferredOperationMaxConcurrencyKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
-        return hasExt ? (void*)entry_vkGetDeferredOperationMaxConcurrencyKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeferredOperationResultKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
-        return hasExt ? (void*)entry_vkGetDeferredOperationResultKHR : nullptr;
-    }
-    if (!strcmp(name, "vkDeferredOperationJoinKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
-        return hasExt ? (void*)entry_vkDeferredOperationJoinKHR : nullptr;
-    }
+        case PROC_vkCreateDeferredOperationKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
+            return hasExt ? (void*)entry_vkCreateDeferredOperationKHR : nullptr;
+        }
+        case PROC_vkDestroyDeferredOperationKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
+            return hasExt ? (void*)entry_vkDestroyDeferredOperationKHR : nullptr;
+        }
+        case PROC_vkGetDeferredOperationMaxConcurrencyKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
+            return hasExt ? (void*)entry_vkGetDeferredOperationMaxConcurrencyKHR : nullptr;
+        }
+        case PROC_vkGetDeferredOperationResultKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
+            return hasExt ? (void*)entry_vkGetDeferredOperationResultKHR : nullptr;
+        }
+        case PROC_vkDeferredOperationJoinKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_deferred_host_operations");
+            return hasExt ? (void*)entry_vkDeferredOperationJoinKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_pipeline_executable_properties
-    if (!strcmp(name, "vkGetPipelineExecutablePropertiesKHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_pipeline_executable_properties");
-        return hasExt ? (void*)entry_vkGetPipelineExecutablePropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPipelineExecutableStatisticsKHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_pipeline_executable_properties");
-        return hasExt ? (void*)entry_vkGetPipelineExecutableStatisticsKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetPipelineExecutableInternalRepresentationsKHR")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_KHR_pipeline_executable_properties");
-        return hasExt ? (void*)entry_vkGetPipelineExecutableInternalRepresentationsKHR : nullptr;
-    }
+        case PROC_vkGetPipelineExecutablePropertiesKHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_pipeline_executable_properties");
+            return hasExt ? (void*)entry_vkGetPipelineExecutablePropertiesKHR : nullptr;
+        }
+        case PROC_vkGetPipelineExecutableStatisticsKHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_pipeline_executable_properties");
+            return hasExt ? (void*)entry_vkGetPipelineExecutableStatisticsKHR : nullptr;
+        }
+        case PROC_vkGetPipelineExecutableInternalRepresentationsKHR: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_KHR_pipeline_executable_properties");
+            return hasExt ? (void*)entry_vkGetPipelineExecutableInternalRepresentationsKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_map_memory2
-    if (!strcmp(name, "vkMapMemory2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_map_memory2");
-        return hasExt ? (void*)entry_vkMapMemory2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkUnmapMemory2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_map_memory2");
-        return hasExt ? (void*)entry_vkUnmapMemory2KHR : nullptr;
-    }
+        case PROC_vkMapMemory2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_map_memory2");
+            return hasExt ? (void*)entry_vkMapMemory2KHR : nullptr;
+        }
+        case PROC_vkUnmapMemory2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_map_memory2");
+            return hasExt ? (void*)entry_vkUnmapMemory2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_video_encode_queue
-    if (!strcmp(name, "vkCmdEncodeVideoKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_encode_queue");
-        return hasExt ? (void*)entry_vkCmdEncodeVideoKHR : nullptr;
-    }
+        case PROC_vkCmdEncodeVideoKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_video_encode_queue");
+            return hasExt ? (void*)entry_vkCmdEncodeVideoKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_synchronization2
-    if (!strcmp(name, "vkCmdSetEvent2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
-        return hasExt ? (void*)entry_vkCmdSetEvent2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdResetEvent2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
-        return hasExt ? (void*)entry_vkCmdResetEvent2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWaitEvents2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
-        return hasExt ? (void*)entry_vkCmdWaitEvents2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdPipelineBarrier2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
-        return hasExt ? (void*)entry_vkCmdPipelineBarrier2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteTimestamp2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
-        return hasExt ? (void*)entry_vkCmdWriteTimestamp2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmit2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
-        return hasExt ? (void*)entry_vkQueueSubmit2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteBufferMarker2AMD")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
-        return hasExt ? (void*)entry_vkCmdWriteBufferMarker2AMD : nullptr;
-    }
-    if (!strcmp(name, "vkGetQueueCheckpointData2NV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
-        return hasExt ? (void*)entry_vkGetQueueCheckpointData2NV : nullptr;
-    }
+        case PROC_vkCmdSetEvent2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
+            return hasExt ? (void*)entry_vkCmdSetEvent2KHR : nullptr;
+        }
+        case PROC_vkCmdResetEvent2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
+            return hasExt ? (void*)entry_vkCmdResetEvent2KHR : nullptr;
+        }
+        case PROC_vkCmdWaitEvents2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
+            return hasExt ? (void*)entry_vkCmdWaitEvents2KHR : nullptr;
+        }
+        case PROC_vkCmdPipelineBarrier2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
+            return hasExt ? (void*)entry_vkCmdPipelineBarrier2KHR : nullptr;
+        }
+        case PROC_vkCmdWriteTimestamp2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
+            return hasExt ? (void*)entry_vkCmdWriteTimestamp2KHR : nullptr;
+        }
+        case PROC_vkQueueSubmit2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
+            return hasExt ? (void*)entry_vkQueueSubmit2KHR : nullptr;
+        }
+        case PROC_vkCmdWriteBufferMarker2AMD: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
+            return hasExt ? (void*)entry_vkCmdWriteBufferMarker2AMD : nullptr;
+        }
+        case PROC_vkGetQueueCheckpointData2NV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_synchronization2");
+            return hasExt ? (void*)entry_vkGetQueueCheckpointData2NV : nullptr;
+        }
 #endif
 #ifdef VK_KHR_copy_commands2
-    if (!strcmp(name, "vkCmdCopyBuffer2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
-        return hasExt ? (void*)entry_vkCmdCopyBuffer2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImage2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
-        return hasExt ? (void*)entry_vkCmdCopyImage2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyBufferToImage2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
-        return hasExt ? (void*)entry_vkCmdCopyBufferToImage2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyImageToBuffer2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
-        return hasExt ? (void*)entry_vkCmdCopyImageToBuffer2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBlitImage2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
-        return hasExt ? (void*)entry_vkCmdBlitImage2KHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdResolveImage2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
-        return hasExt ? (void*)entry_vkCmdResolveImage2KHR : nullptr;
-    }
+        case PROC_vkCmdCopyBuffer2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
+            return hasExt ? (void*)entry_vkCmdCopyBuffer2KHR : nullptr;
+        }
+        case PROC_vkCmdCopyImage2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
+            return hasExt ? (void*)entry_vkCmdCopyImage2KHR : nullptr;
+        }
+        case PROC_vkCmdCopyBufferToImage2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
+            return hasExt ? (void*)entry_vkCmdCopyBufferToImage2KHR : nullptr;
+        }
+        case PROC_vkCmdCopyImageToBuffer2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
+            return hasExt ? (void*)entry_vkCmdCopyImageToBuffer2KHR : nullptr;
+        }
+        case PROC_vkCmdBlitImage2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
+            return hasExt ? (void*)entry_vkCmdBlitImage2KHR : nullptr;
+        }
+        case PROC_vkCmdResolveImage2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_copy_commands2");
+            return hasExt ? (void*)entry_vkCmdResolveImage2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_ray_tracing_maintenance1
-    if (!strcmp(name, "vkCmdTraceRaysIndirect2KHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_maintenance1");
-        return hasExt ? (void*)entry_vkCmdTraceRaysIndirect2KHR : nullptr;
-    }
+        case PROC_vkCmdTraceRaysIndirect2KHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_maintenance1");
+            return hasExt ? (void*)entry_vkCmdTraceRaysIndirect2KHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_maintenance4
-    if (!strcmp(name, "vkGetDeviceBufferMemoryRequirementsKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance4");
-        return hasExt ? (void*)entry_vkGetDeviceBufferMemoryRequirementsKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceImageMemoryRequirementsKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance4");
-        return hasExt ? (void*)entry_vkGetDeviceImageMemoryRequirementsKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceImageSparseMemoryRequirementsKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance4");
-        return hasExt ? (void*)entry_vkGetDeviceImageSparseMemoryRequirementsKHR : nullptr;
-    }
+        case PROC_vkGetDeviceBufferMemoryRequirementsKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance4");
+            return hasExt ? (void*)entry_vkGetDeviceBufferMemoryRequirementsKHR : nullptr;
+        }
+        case PROC_vkGetDeviceImageMemoryRequirementsKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance4");
+            return hasExt ? (void*)entry_vkGetDeviceImageMemoryRequirementsKHR : nullptr;
+        }
+        case PROC_vkGetDeviceImageSparseMemoryRequirementsKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_maintenance4");
+            return hasExt ? (void*)entry_vkGetDeviceImageSparseMemoryRequirementsKHR : nullptr;
+        }
 #endif
 #ifdef VK_ANDROID_native_buffer
-    if (!strcmp(name, "vkGetSwapchainGrallocUsageANDROID")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_ANDROID_native_buffer");
-        return hasExt ? (void*)entry_vkGetSwapchainGrallocUsageANDROID : nullptr;
-    }
-    if (!strcmp(name, "vkAcquireImageANDROID")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_ANDROID_native_buffer");
-        return hasExt ? (void*)entry_vkAcquireImageANDROID : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSignalReleaseImageANDROID")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_ANDROID_native_buffer");
-        return hasExt ? (void*)entry_vkQueueSignalReleaseImageANDROID : nullptr;
-    }
-    if (!strcmp(name, "vkGetSwapchainGrallocUsage2ANDROID")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_ANDROID_native_buffer");
-        return hasExt ? (void*)entry_vkGetSwapchainGrallocUsage2ANDROID : nullptr;
-    }
+        case PROC_vkGetSwapchainGrallocUsageANDROID: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_ANDROID_native_buffer");
+            return hasExt ? (void*)entry_vkGetSwapchainGrallocUsageANDROID : nullptr;
+        }
+        case PROC_vkAcquireImageANDROID: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_ANDROID_native_buffer");
+            return hasExt ? (void*)entry_vkAcquireImageANDROID : nullptr;
+        }
+        case PROC_vkQueueSignalReleaseImageANDROID: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_ANDROID_native_buffer");
+            return hasExt ? (void*)entry_vkQueueSignalReleaseImageANDROID : nullptr;
+        }
+        case PROC_vkGetSwapchainGrallocUsage2ANDROID: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_ANDROID_native_buffer");
+            return hasExt ? (void*)entry_vkGetSwapchainGrallocUsage2ANDROID : nullptr;
+        }
 #endif
 #ifdef VK_EXT_debug_report
-    if (!strcmp(name, "vkCreateDebugReportCallbackEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_report");
-        return hasExt ? (void*)entry_vkCreateDebugReportCallbackEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDebugReportCallbackEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_report");
-        return hasExt ? (void*)entry_vkDestroyDebugReportCallbackEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDebugReportMessageEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_report");
-        return hasExt ? (void*)entry_vkDebugReportMessageEXT : nullptr;
-    }
+        case PROC_vkCreateDebugReportCallbackEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_report");
+            return hasExt ? (void*)entry_vkCreateDebugReportCallbackEXT : nullptr;
+        }
+        case PROC_vkDestroyDebugReportCallbackEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_report");
+            return hasExt ? (void*)entry_vkDestroyDebugReportCallbackEXT : nullptr;
+        }
+        case PROC_vkDebugReportMessageEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_report");
+            return hasExt ? (void*)entry_vkDebugReportMessageEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_debug_marker
-    if (!strcmp(name, "vkDebugMarkerSetObjectTagEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
-        return hasExt ? (void*)entry_vkDebugMarkerSetObjectTagEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDebugMarkerSetObjectNameEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
-        return hasExt ? (void*)entry_vkDebugMarkerSetObjectNameEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerBeginEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
-        return hasExt ? (void*)entry_vkCmdDebugMarkerBeginEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerEndEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
-        return hasExt ? (void*)entry_vkCmdDebugMarkerEndEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDebugMarkerInsertEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
-        return hasExt ? (void*)entry_vkCmdDebugMarkerInsertEXT : nullptr;
-    }
+        case PROC_vkDebugMarkerSetObjectTagEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
+            return hasExt ? (void*)entry_vkDebugMarkerSetObjectTagEXT : nullptr;
+        }
+        case PROC_vkDebugMarkerSetObjectNameEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
+            return hasExt ? (void*)entry_vkDebugMarkerSetObjectNameEXT : nullptr;
+        }
+        case PROC_vkCmdDebugMarkerBeginEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
+            return hasExt ? (void*)entry_vkCmdDebugMarkerBeginEXT : nullptr;
+        }
+        case PROC_vkCmdDebugMarkerEndEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
+            return hasExt ? (void*)entry_vkCmdDebugMarkerEndEXT : nullptr;
+        }
+        case PROC_vkCmdDebugMarkerInsertEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_marker");
+            return hasExt ? (void*)entry_vkCmdDebugMarkerInsertEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_transform_feedback
-    if (!strcmp(name, "vkCmdBindTransformFeedbackBuffersEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
-        return hasExt ? (void*)entry_vkCmdBindTransformFeedbackBuffersEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginTransformFeedbackEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
-        return hasExt ? (void*)entry_vkCmdBeginTransformFeedbackEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndTransformFeedbackEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
-        return hasExt ? (void*)entry_vkCmdEndTransformFeedbackEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginQueryIndexedEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
-        return hasExt ? (void*)entry_vkCmdBeginQueryIndexedEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndQueryIndexedEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
-        return hasExt ? (void*)entry_vkCmdEndQueryIndexedEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndirectByteCountEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
-        return hasExt ? (void*)entry_vkCmdDrawIndirectByteCountEXT : nullptr;
-    }
+        case PROC_vkCmdBindTransformFeedbackBuffersEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
+            return hasExt ? (void*)entry_vkCmdBindTransformFeedbackBuffersEXT : nullptr;
+        }
+        case PROC_vkCmdBeginTransformFeedbackEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
+            return hasExt ? (void*)entry_vkCmdBeginTransformFeedbackEXT : nullptr;
+        }
+        case PROC_vkCmdEndTransformFeedbackEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
+            return hasExt ? (void*)entry_vkCmdEndTransformFeedbackEXT : nullptr;
+        }
+        case PROC_vkCmdBeginQueryIndexedEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
+            return hasExt ? (void*)entry_vkCmdBeginQueryIndexedEXT : nullptr;
+        }
+        case PROC_vkCmdEndQueryIndexedEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
+            return hasExt ? (void*)entry_vkCmdEndQueryIndexedEXT : nullptr;
+        }
+        case PROC_vkCmdDrawIndirectByteCountEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_transform_feedback");
+            return hasExt ? (void*)entry_vkCmdDrawIndirectByteCountEXT : nullptr;
+        }
 #endif
 #ifdef VK_NVX_binary_import
-    if (!strcmp(name, "vkCreateCuModuleNVX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
-        return hasExt ? (void*)entry_vkCreateCuModuleNVX : nullptr;
-    }
-    if (!strcmp(name, "vkCreateCuFunctionNVX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
-        return hasExt ? (void*)entry_vkCreateCuFunctionNVX : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyCuModuleNVX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
-        return hasExt ? (void*)entry_vkDestroyCuModuleNVX : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyCuFunctionNVX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
-        return hasExt ? (void*)entry_vkDestroyCuFunctionNVX : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCuLaunchKernelNVX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
-        return hasExt ? (void*)entry_vkCmdCuLaunchKernelNVX : nullptr;
-    }
+        case PROC_vkCreateCuModuleNVX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
+            return hasExt ? (void*)entry_vkCreateCuModuleNVX : nullptr;
+        }
+        case PROC_vkCreateCuFunctionNVX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
+            return hasExt ? (void*)entry_vkCreateCuFunctionNVX : nullptr;
+        }
+        case PROC_vkDestroyCuModuleNVX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
+            return hasExt ? (void*)entry_vkDestroyCuModuleNVX : nullptr;
+        }
+        case PROC_vkDestroyCuFunctionNVX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
+            return hasExt ? (void*)entry_vkDestroyCuFunctionNVX : nullptr;
+        }
+        case PROC_vkCmdCuLaunchKernelNVX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_binary_import");
+            return hasExt ? (void*)entry_vkCmdCuLaunchKernelNVX : nullptr;
+        }
 #endif
 #ifdef VK_NVX_image_view_handle
-    if (!strcmp(name, "vkGetImageViewHandleNVX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_image_view_handle");
-        return hasExt ? (void*)entry_vkGetImageViewHandleNVX : nullptr;
-    }
-    if (!strcmp(name, "vkGetImageViewAddressNVX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_image_view_handle");
-        return hasExt ? (void*)entry_vkGetImageViewAddressNVX : nullptr;
-    }
+        case PROC_vkGetImageViewHandleNVX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_image_view_handle");
+            return hasExt ? (void*)entry_vkGetImageViewHandleNVX : nullptr;
+        }
+        case PROC_vkGetImageViewAddressNVX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NVX_image_view_handle");
+            return hasExt ? (void*)entry_vkGetImageViewAddressNVX : nullptr;
+        }
 #endif
 #ifdef VK_AMD_draw_indirect_count
-    if (!strcmp(name, "vkCmdDrawIndirectCountAMD")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_draw_indirect_count");
-        return hasExt ? (void*)entry_vkCmdDrawIndirectCountAMD : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawIndexedIndirectCountAMD")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_draw_indirect_count");
-        return hasExt ? (void*)entry_vkCmdDrawIndexedIndirectCountAMD : nullptr;
-    }
+        case PROC_vkCmdDrawIndirectCountAMD: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_draw_indirect_count");
+            return hasExt ? (void*)entry_vkCmdDrawIndirectCountAMD : nullptr;
+        }
+        case PROC_vkCmdDrawIndexedIndirectCountAMD: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_draw_indirect_count");
+            return hasExt ? (void*)entry_vkCmdDrawIndexedIndirectCountAMD : nullptr;
+        }
 #endif
 #ifdef VK_AMD_shader_info
-    if (!strcmp(name, "vkGetShaderInfoAMD")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_shader_info");
-        return hasExt ? (void*)entry_vkGetShaderInfoAMD : nullptr;
-    }
+        case PROC_vkGetShaderInfoAMD: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_shader_info");
+            return hasExt ? (void*)entry_vkGetShaderInfoAMD : nullptr;
+        }
 #endif
 #ifdef VK_GGP_stream_descriptor_surface
-    if (!strcmp(name, "vkCreateStreamDescriptorSurfaceGGP")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GGP_stream_descriptor_surface");
-        return hasExt ? (void*)entry_vkCreateStreamDescriptorSurfaceGGP : nullptr;
-    }
+        case PROC_vkCreateStreamDescriptorSurfaceGGP: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GGP_stream_descriptor_surface");
+            return hasExt ? (void*)entry_vkCreateStreamDescriptorSurfaceGGP : nullptr;
+        }
 #endif
 #ifdef VK_NV_external_memory_capabilities
-    if (!strcmp(name, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_external_memory_capabilities");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalImageFormatPropertiesNV : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceExternalImageFormatPropertiesNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_external_memory_capabilities");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceExternalImageFormatPropertiesNV : nullptr;
+        }
 #endif
 #ifdef VK_NV_external_memory_win32
-    if (!strcmp(name, "vkGetMemoryWin32HandleNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_external_memory_win32");
-        return hasExt ? (void*)entry_vkGetMemoryWin32HandleNV : nullptr;
-    }
+        case PROC_vkGetMemoryWin32HandleNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_external_memory_win32");
+            return hasExt ? (void*)entry_vkGetMemoryWin32HandleNV : nullptr;
+        }
 #endif
 #ifdef VK_NN_vi_surface
-    if (!strcmp(name, "vkCreateViSurfaceNN")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NN_vi_surface");
-        return hasExt ? (void*)entry_vkCreateViSurfaceNN : nullptr;
-    }
+        case PROC_vkCreateViSurfaceNN: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NN_vi_surface");
+            return hasExt ? (void*)entry_vkCreateViSurfaceNN : nullptr;
+        }
 #endif
 #ifdef VK_EXT_conditional_rendering
-    if (!strcmp(name, "vkCmdBeginConditionalRenderingEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_conditional_rendering");
-        return hasExt ? (void*)entry_vkCmdBeginConditionalRenderingEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndConditionalRenderingEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_conditional_rendering");
-        return hasExt ? (void*)entry_vkCmdEndConditionalRenderingEXT : nullptr;
-    }
+        case PROC_vkCmdBeginConditionalRenderingEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_conditional_rendering");
+            return hasExt ? (void*)entry_vkCmdBeginConditionalRenderingEXT : nullptr;
+        }
+        case PROC_vkCmdEndConditionalRenderingEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_conditional_rendering");
+            return hasExt ? (void*)entry_vkCmdEndConditionalRenderingEXT : nullptr;
+        }
 #endif
 #ifdef VK_NV_clip_space_w_scaling
-    if (!strcmp(name, "vkCmdSetViewportWScalingNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_clip_space_w_scaling");
-        return hasExt ? (void*)entry_vkCmdSetViewportWScalingNV : nullptr;
-    }
+        case PROC_vkCmdSetViewportWScalingNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_clip_space_w_scaling");
+            return hasExt ? (void*)entry_vkCmdSetViewportWScalingNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_direct_mode_display
-    if (!strcmp(name, "vkReleaseDisplayEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_direct_mode_display");
-        return hasExt ? (void*)entry_vkReleaseDisplayEXT : nullptr;
-    }
+        case PROC_vkReleaseDisplayEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_direct_mode_display");
+            return hasExt ? (void*)entry_vkReleaseDisplayEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_acquire_xlib_display
-    if (!strcmp(name, "vkAcquireXlibDisplayEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_acquire_xlib_display");
-        return hasExt ? (void*)entry_vkAcquireXlibDisplayEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetRandROutputDisplayEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_acquire_xlib_display");
-        return hasExt ? (void*)entry_vkGetRandROutputDisplayEXT : nullptr;
-    }
+        case PROC_vkAcquireXlibDisplayEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_acquire_xlib_display");
+            return hasExt ? (void*)entry_vkAcquireXlibDisplayEXT : nullptr;
+        }
+        case PROC_vkGetRandROutputDisplayEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_acquire_xlib_display");
+            return hasExt ? (void*)entry_vkGetRandROutputDisplayEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_display_surface_counter
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfaceCapabilities2EXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_surface_counter");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilities2EXT : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSurfaceCapabilities2EXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_surface_counter");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfaceCapabilities2EXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_display_control
-    if (!strcmp(name, "vkDisplayPowerControlEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_control");
-        return hasExt ? (void*)entry_vkDisplayPowerControlEXT : nullptr;
-    }
-    if (!strcmp(name, "vkRegisterDeviceEventEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_control");
-        return hasExt ? (void*)entry_vkRegisterDeviceEventEXT : nullptr;
-    }
-    if (!strcmp(name, "vkRegisterDisplayEventEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_control");
-        return hasExt ? (void*)entry_vkRegisterDisplayEventEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetSwapchainCounterEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_control");
-        return hasExt ? (void*)entry_vkGetSwapchainCounterEXT : nullptr;
-    }
+        case PROC_vkDisplayPowerControlEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_control");
+            return hasExt ? (void*)entry_vkDisplayPowerControlEXT : nullptr;
+        }
+        case PROC_vkRegisterDeviceEventEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_control");
+            return hasExt ? (void*)entry_vkRegisterDeviceEventEXT : nullptr;
+        }
+        case PROC_vkRegisterDisplayEventEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_control");
+            return hasExt ? (void*)entry_vkRegisterDisplayEventEXT : nullptr;
+        }
+        case PROC_vkGetSwapchainCounterEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_display_control");
+            return hasExt ? (void*)entry_vkGetSwapchainCounterEXT : nullptr;
+        }
 #endif
 #ifdef VK_GOOGLE_display_timing
-    if (!strcmp(name, "vkGetRefreshCycleDurationGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_display_timing");
-        return hasExt ? (void*)entry_vkGetRefreshCycleDurationGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetPastPresentationTimingGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_display_timing");
-        return hasExt ? (void*)entry_vkGetPastPresentationTimingGOOGLE : nullptr;
-    }
+        case PROC_vkGetRefreshCycleDurationGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_display_timing");
+            return hasExt ? (void*)entry_vkGetRefreshCycleDurationGOOGLE : nullptr;
+        }
+        case PROC_vkGetPastPresentationTimingGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_display_timing");
+            return hasExt ? (void*)entry_vkGetPastPresentationTimingGOOGLE : nullptr;
+        }
 #endif
 #ifdef VK_EXT_discard_rectangles
-    if (!strcmp(name, "vkCmdSetDiscardRectangleEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_discard_rectangles");
-        return hasExt ? (void*)entry_vkCmdSetDiscardRectangleEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDiscardRectangleEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_discard_rectangles");
-        return hasExt ? (void*)entry_vkCmdSetDiscardRectangleEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDiscardRectangleModeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_discard_rectangles");
-        return hasExt ? (void*)entry_vkCmdSetDiscardRectangleModeEXT : nullptr;
-    }
+        case PROC_vkCmdSetDiscardRectangleEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_discard_rectangles");
+            return hasExt ? (void*)entry_vkCmdSetDiscardRectangleEXT : nullptr;
+        }
+        case PROC_vkCmdSetDiscardRectangleEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_discard_rectangles");
+            return hasExt ? (void*)entry_vkCmdSetDiscardRectangleEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetDiscardRectangleModeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_discard_rectangles");
+            return hasExt ? (void*)entry_vkCmdSetDiscardRectangleModeEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_hdr_metadata
-    if (!strcmp(name, "vkSetHdrMetadataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_hdr_metadata");
-        return hasExt ? (void*)entry_vkSetHdrMetadataEXT : nullptr;
-    }
+        case PROC_vkSetHdrMetadataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_hdr_metadata");
+            return hasExt ? (void*)entry_vkSetHdrMetadataEXT : nullptr;
+        }
 #endif
 #ifdef VK_MVK_ios_surface
-    if (!strcmp(name, "vkCreateIOSSurfaceMVK")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_MVK_ios_surface");
-        return hasExt ? (void*)entry_vkCreateIOSSurfaceMVK : nullptr;
-    }
+        case PROC_vkCreateIOSSurfaceMVK: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_MVK_ios_surface");
+            return hasExt ? (void*)entry_vkCreateIOSSurfaceMVK : nullptr;
+        }
 #endif
 #ifdef VK_MVK_macos_surface
-    if (!strcmp(name, "vkCreateMacOSSurfaceMVK")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_MVK_macos_surface");
-        return hasExt ? (void*)entry_vkCreateMacOSSurfaceMVK : nullptr;
-    }
+        case PROC_vkCreateMacOSSurfaceMVK: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_MVK_macos_surface");
+            return hasExt ? (void*)entry_vkCreateMacOSSurfaceMVK : nullptr;
+        }
 #endif
 #ifdef VK_EXT_debug_utils
-    if (!strcmp(name, "vkSetDebugUtilsObjectNameEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkSetDebugUtilsObjectNameEXT : nullptr;
-    }
-    if (!strcmp(name, "vkSetDebugUtilsObjectTagEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkSetDebugUtilsObjectTagEXT : nullptr;
-    }
-    if (!strcmp(name, "vkQueueBeginDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkQueueBeginDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkQueueEndDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkQueueEndDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkQueueInsertDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkQueueInsertDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBeginDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkCmdBeginDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdEndDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkCmdEndDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdInsertDebugUtilsLabelEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkCmdInsertDebugUtilsLabelEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCreateDebugUtilsMessengerEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkCreateDebugUtilsMessengerEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyDebugUtilsMessengerEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkDestroyDebugUtilsMessengerEXT : nullptr;
-    }
-    if (!strcmp(name, "vkSubmitDebugUtilsMessageEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
-        return hasExt ? (void*)entry_vkSubmitDebugUtilsMessageEXT : nullptr;
-    }
+        case PROC_vkSetDebugUtilsObjectNameEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkSetDebugUtilsObjectNameEXT : nullptr;
+        }
+        case PROC_vkSetDebugUtilsObjectTagEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkSetDebugUtilsObjectTagEXT : nullptr;
+        }
+        case PROC_vkQueueBeginDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkQueueBeginDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkQueueEndDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkQueueEndDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkQueueInsertDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkQueueInsertDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkCmdBeginDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkCmdBeginDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkCmdEndDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkCmdEndDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkCmdInsertDebugUtilsLabelEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkCmdInsertDebugUtilsLabelEXT : nullptr;
+        }
+        case PROC_vkCreateDebugUtilsMessengerEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkCreateDebugUtilsMessengerEXT : nullptr;
+        }
+        case PROC_vkDestroyDebugUtilsMessengerEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkDestroyDebugUtilsMessengerEXT : nullptr;
+        }
+        case PROC_vkSubmitDebugUtilsMessageEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_debug_utils");
+            return hasExt ? (void*)entry_vkSubmitDebugUtilsMessageEXT : nullptr;
+        }
 #endif
 #ifdef VK_ANDROID_external_memory_android_hardware_buffer
-    if (!strcmp(name, "vkGetAndroidHardwareBufferPropertiesANDROID")) {
-        bool hasExt = resources->hasDeviceExtension(
-            device, "VK_ANDROID_external_memory_android_hardware_buffer");
-        return hasExt ? (void*)entry_vkGetAndroidHardwareBufferPropertiesANDROID : nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryAndroidHardwareBufferANDROID")) {
-        bool hasExt = resources->hasDeviceExtension(
-            device, "VK_ANDROID_external_memory_android_hardware_buffer");
-        return hasExt ? (void*)entry_vkGetMemoryAndroidHardwareBufferANDROID : nullptr;
-    }
+        case PROC_vkGetAndroidHardwareBufferPropertiesANDROID: {
+            bool hasExt = resources->hasDeviceExtension(
+                device, "VK_ANDROID_external_memory_android_hardware_buffer");
+            return hasExt ? (void*)entry_vkGetAndroidHardwareBufferPropertiesANDROID : nullptr;
+        }
+        case PROC_vkGetMemoryAndroidHardwareBufferANDROID: {
+            bool hasExt = resources->hasDeviceExtension(
+                device, "VK_ANDROID_external_memory_android_hardware_buffer");
+            return hasExt ? (void*)entry_vkGetMemoryAndroidHardwareBufferANDROID : nullptr;
+        }
 #endif
 #ifdef VK_EXT_sample_locations
-    if (!strcmp(name, "vkCmdSetSampleLocationsEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_sample_locations");
-        return hasExt ? (void*)entry_vkCmdSetSampleLocationsEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceMultisamplePropertiesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_sample_locations");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceMultisamplePropertiesEXT : nullptr;
-    }
+        case PROC_vkCmdSetSampleLocationsEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_sample_locations");
+            return hasExt ? (void*)entry_vkCmdSetSampleLocationsEXT : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceMultisamplePropertiesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_sample_locations");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceMultisamplePropertiesEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_image_drm_format_modifier
-    if (!strcmp(name, "vkGetImageDrmFormatModifierPropertiesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_image_drm_format_modifier");
-        return hasExt ? (void*)entry_vkGetImageDrmFormatModifierPropertiesEXT : nullptr;
-    }
+        case PROC_vkGetImageDrmFormatModifierPropertiesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_image_drm_format_modifier");
+            return hasExt ? (void*)entry_vkGetImageDrmFormatModifierPropertiesEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_validation_cache
-    if (!strcmp(name, "vkCreateValidationCacheEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_validation_cache");
-        return hasExt ? (void*)entry_vkCreateValidationCacheEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyValidationCacheEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_validation_cache");
-        return hasExt ? (void*)entry_vkDestroyValidationCacheEXT : nullptr;
-    }
-    if (!strcmp(name, "vkMergeValidationCachesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_validation_cache");
-        return hasExt ? (void*)entry_vkMergeValidationCachesEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetValidationCacheDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_validation_cache");
-        return hasExt ? (void*)entry_vkGetValidationCacheDataEXT : nullptr;
-    }
+        case PROC_vkCreateValidationCacheEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_validation_cache");
+            return hasExt ? (void*)entry_vkCreateValidationCacheEXT : nullptr;
+        }
+        case PROC_vkDestroyValidationCacheEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_validation_cache");
+            return hasExt ? (void*)entry_vkDestroyValidationCacheEXT : nullptr;
+        }
+        case PROC_vkMergeValidationCachesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_validation_cache");
+            return hasExt ? (void*)entry_vkMergeValidationCachesEXT : nullptr;
+        }
+        case PROC_vkGetValidationCacheDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_validation_cache");
+            return hasExt ? (void*)entry_vkGetValidationCacheDataEXT : nullptr;
+        }
 #endif
 #ifdef VK_NV_shading_rate_image
-    if (!strcmp(name, "vkCmdBindShadingRateImageNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_shading_rate_image");
-        return hasExt ? (void*)entry_vkCmdBindShadingRateImageNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportShadingRatePaletteNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_shading_rate_image");
-        return hasExt ? (void*)entry_vkCmdSetViewportShadingRatePaletteNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoarseSampleOrderNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_shading_rate_image");
-        return hasExt ? (void*)entry_vkCmdSetCoarseSampleOrderNV : nullptr;
-    }
+        case PROC_vkCmdBindShadingRateImageNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_shading_rate_image");
+            return hasExt ? (void*)entry_vkCmdBindShadingRateImageNV : nullptr;
+        }
+        case PROC_vkCmdSetViewportShadingRatePaletteNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_shading_rate_image");
+            return hasExt ? (void*)entry_vkCmdSetViewportShadingRatePaletteNV : nullptr;
+        }
+        case PROC_vkCmdSetCoarseSampleOrderNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_shading_rate_image");
+            return hasExt ? (void*)entry_vkCmdSetCoarseSampleOrderNV : nullptr;
+        }
 #endif
 #ifdef VK_NV_ray_tracing
-    if (!strcmp(name, "vkCreateAccelerationStructureNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkCreateAccelerationStructureNV : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyAccelerationStructureNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkDestroyAccelerationStructureNV : nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureMemoryRequirementsNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkGetAccelerationStructureMemoryRequirementsNV : nullptr;
-    }
-    if (!strcmp(name, "vkBindAccelerationStructureMemoryNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkBindAccelerationStructureMemoryNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructureNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkCmdBuildAccelerationStructureNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkCmdCopyAccelerationStructureNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdTraceRaysNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkCmdTraceRaysNV : nullptr;
-    }
-    if (!strcmp(name, "vkCreateRayTracingPipelinesNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkCreateRayTracingPipelinesNV : nullptr;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupHandlesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkGetRayTracingShaderGroupHandlesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupHandlesNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkGetRayTracingShaderGroupHandlesNV : nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureHandleNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkGetAccelerationStructureHandleNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteAccelerationStructuresPropertiesNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkCmdWriteAccelerationStructuresPropertiesNV : nullptr;
-    }
-    if (!strcmp(name, "vkCompileDeferredNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
-        return hasExt ? (void*)entry_vkCompileDeferredNV : nullptr;
-    }
+        case PROC_vkCreateAccelerationStructureNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkCreateAccelerationStructureNV : nullptr;
+        }
+        case PROC_vkDestroyAccelerationStructureNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkDestroyAccelerationStructureNV : nullptr;
+        }
+        case PROC_vkGetAccelerationStructureMemoryRequirementsNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkGetAccelerationStructureMemoryRequirementsNV : nullptr;
+        }
+        case PROC_vkBindAccelerationStructureMemoryNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkBindAccelerationStructureMemoryNV : nullptr;
+        }
+        case PROC_vkCmdBuildAccelerationStructureNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkCmdBuildAccelerationStructureNV : nullptr;
+        }
+        case PROC_vkCmdCopyAccelerationStructureNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkCmdCopyAccelerationStructureNV : nullptr;
+        }
+        case PROC_vkCmdTraceRaysNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkCmdTraceRaysNV : nullptr;
+        }
+        case PROC_vkCreateRayTracingPipelinesNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkCreateRayTracingPipelinesNV : nullptr;
+        }
+        case PROC_vkGetRayTracingShaderGroupHandlesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkGetRayTracingShaderGroupHandlesKHR : nullptr;
+        }
+        case PROC_vkGetRayTracingShaderGroupHandlesNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkGetRayTracingShaderGroupHandlesNV : nullptr;
+        }
+        case PROC_vkGetAccelerationStructureHandleNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkGetAccelerationStructureHandleNV : nullptr;
+        }
+        case PROC_vkCmdWriteAccelerationStructuresPropertiesNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkCmdWriteAccelerationStructuresPropertiesNV : nullptr;
+        }
+        case PROC_vkCompileDeferredNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_ray_tracing");
+            return hasExt ? (void*)entry_vkCompileDeferredNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_external_memory_host
-    if (!strcmp(name, "vkGetMemoryHostPointerPropertiesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_external_memory_host");
-        return hasExt ? (void*)entry_vkGetMemoryHostPointerPropertiesEXT : nullptr;
-    }
+        case PROC_vkGetMemoryHostPointerPropertiesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_external_memory_host");
+            return hasExt ? (void*)entry_vkGetMemoryHostPointerPropertiesEXT : nullptr;
+        }
 #endif
 #ifdef VK_AMD_buffer_marker
-    if (!strcmp(name, "vkCmdWriteBufferMarkerAMD")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_buffer_marker");
-        return hasExt ? (void*)entry_vkCmdWriteBufferMarkerAMD : nullptr;
-    }
+        case PROC_vkCmdWriteBufferMarkerAMD: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_buffer_marker");
+            return hasExt ? (void*)entry_vkCmdWriteBufferMarkerAMD : nullptr;
+        }
 #endif
 #ifdef VK_EXT_calibrated_timestamps
-    if (!strcmp(name, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_calibrated_timestamps");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetCalibratedTimestampsEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_calibrated_timestamps");
-        return hasExt ? (void*)entry_vkGetCalibratedTimestampsEXT : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_calibrated_timestamps");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT : nullptr;
+        }
+        case PROC_vkGetCalibratedTimestampsEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_calibrated_timestamps");
+            return hasExt ? (void*)entry_vkGetCalibratedTimestampsEXT : nullptr;
+        }
 #endif
 #ifdef VK_NV_mesh_shader
-    if (!strcmp(name, "vkCmdDrawMeshTasksNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_mesh_shader");
-        return hasExt ? (void*)entry_vkCmdDrawMeshTasksNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_mesh_shader");
-        return hasExt ? (void*)entry_vkCmdDrawMeshTasksIndirectNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectCountNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_mesh_shader");
-        return hasExt ? (void*)entry_vkCmdDrawMeshTasksIndirectCountNV : nullptr;
-    }
+        case PROC_vkCmdDrawMeshTasksNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_mesh_shader");
+            return hasExt ? (void*)entry_vkCmdDrawMeshTasksNV : nullptr;
+        }
+        case PROC_vkCmdDrawMeshTasksIndirectNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_mesh_shader");
+            return hasExt ? (void*)entry_vkCmdDrawMeshTasksIndirectNV : nullptr;
+        }
+        case PROC_vkCmdDrawMeshTasksIndirectCountNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_mesh_shader");
+            return hasExt ? (void*)entry_vkCmdDrawMeshTasksIndirectCountNV : nullptr;
+        }
 #endif
 #ifdef VK_NV_scissor_exclusive
-    if (!strcmp(name, "vkCmdSetExclusiveScissorEnableNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_scissor_exclusive");
-        return hasExt ? (void*)entry_vkCmdSetExclusiveScissorEnableNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetExclusiveScissorNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_scissor_exclusive");
-        return hasExt ? (void*)entry_vkCmdSetExclusiveScissorNV : nullptr;
-    }
+        case PROC_vkCmdSetExclusiveScissorEnableNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_scissor_exclusive");
+            return hasExt ? (void*)entry_vkCmdSetExclusiveScissorEnableNV : nullptr;
+        }
+        case PROC_vkCmdSetExclusiveScissorNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_scissor_exclusive");
+            return hasExt ? (void*)entry_vkCmdSetExclusiveScissorNV : nullptr;
+        }
 #endif
 #ifdef VK_NV_device_diagnostic_checkpoints
-    if (!strcmp(name, "vkCmdSetCheckpointNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_diagnostic_checkpoints");
-        return hasExt ? (void*)entry_vkCmdSetCheckpointNV : nullptr;
-    }
-    if (!strcmp(name, "vkGetQueueCheckpointDataNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_diagnostic_checkpoints");
-        return hasExt ? (void*)entry_vkGetQueueCheckpointDataNV : nullptr;
-    }
+        case PROC_vkCmdSetCheckpointNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_diagnostic_checkpoints");
+            return hasExt ? (void*)entry_vkCmdSetCheckpointNV : nullptr;
+        }
+        case PROC_vkGetQueueCheckpointDataNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_diagnostic_checkpoints");
+            return hasExt ? (void*)entry_vkGetQueueCheckpointDataNV : nullptr;
+        }
 #endif
 #ifdef VK_INTEL_performance_query
-    if (!strcmp(name, "vkInitializePerformanceApiINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkInitializePerformanceApiINTEL : nullptr;
-    }
-    if (!strcmp(name, "vkUninitializePerformanceApiINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkUninitializePerformanceApiINTEL : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceMarkerINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkCmdSetPerformanceMarkerINTEL : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceStreamMarkerINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkCmdSetPerformanceStreamMarkerINTEL : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPerformanceOverrideINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkCmdSetPerformanceOverrideINTEL : nullptr;
-    }
-    if (!strcmp(name, "vkAcquirePerformanceConfigurationINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkAcquirePerformanceConfigurationINTEL : nullptr;
-    }
-    if (!strcmp(name, "vkReleasePerformanceConfigurationINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkReleasePerformanceConfigurationINTEL : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSetPerformanceConfigurationINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkQueueSetPerformanceConfigurationINTEL : nullptr;
-    }
-    if (!strcmp(name, "vkGetPerformanceParameterINTEL")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
-        return hasExt ? (void*)entry_vkGetPerformanceParameterINTEL : nullptr;
-    }
+        case PROC_vkInitializePerformanceApiINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkInitializePerformanceApiINTEL : nullptr;
+        }
+        case PROC_vkUninitializePerformanceApiINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkUninitializePerformanceApiINTEL : nullptr;
+        }
+        case PROC_vkCmdSetPerformanceMarkerINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkCmdSetPerformanceMarkerINTEL : nullptr;
+        }
+        case PROC_vkCmdSetPerformanceStreamMarkerINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkCmdSetPerformanceStreamMarkerINTEL : nullptr;
+        }
+        case PROC_vkCmdSetPerformanceOverrideINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkCmdSetPerformanceOverrideINTEL : nullptr;
+        }
+        case PROC_vkAcquirePerformanceConfigurationINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkAcquirePerformanceConfigurationINTEL : nullptr;
+        }
+        case PROC_vkReleasePerformanceConfigurationINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkReleasePerformanceConfigurationINTEL : nullptr;
+        }
+        case PROC_vkQueueSetPerformanceConfigurationINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkQueueSetPerformanceConfigurationINTEL : nullptr;
+        }
+        case PROC_vkGetPerformanceParameterINTEL: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_INTEL_performance_query");
+            return hasExt ? (void*)entry_vkGetPerformanceParameterINTEL : nullptr;
+        }
 #endif
 #ifdef VK_AMD_display_native_hdr
-    if (!strcmp(name, "vkSetLocalDimmingAMD")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_display_native_hdr");
-        return hasExt ? (void*)entry_vkSetLocalDimmingAMD : nullptr;
-    }
+        case PROC_vkSetLocalDimmingAMD: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_AMD_display_native_hdr");
+            return hasExt ? (void*)entry_vkSetLocalDimmingAMD : nullptr;
+        }
 #endif
 #ifdef VK_FUCHSIA_imagepipe_surface
-    if (!strcmp(name, "vkCreateImagePipeSurfaceFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_imagepipe_surface");
-        return hasExt ? (void*)entry_vkCreateImagePipeSurfaceFUCHSIA : nullptr;
-    }
+        case PROC_vkCreateImagePipeSurfaceFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_imagepipe_surface");
+            return hasExt ? (void*)entry_vkCreateImagePipeSurfaceFUCHSIA : nullptr;
+        }
 #endif
 #ifdef VK_EXT_metal_surface
-    if (!strcmp(name, "vkCreateMetalSurfaceEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_metal_surface");
-        return hasExt ? (void*)entry_vkCreateMetalSurfaceEXT : nullptr;
-    }
+        case PROC_vkCreateMetalSurfaceEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_metal_surface");
+            return hasExt ? (void*)entry_vkCreateMetalSurfaceEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_buffer_device_address
-    if (!strcmp(name, "vkGetBufferDeviceAddressEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_buffer_device_address");
-        return hasExt ? (void*)entry_vkGetBufferDeviceAddressEXT : nullptr;
-    }
+        case PROC_vkGetBufferDeviceAddressEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_buffer_device_address");
+            return hasExt ? (void*)entry_vkGetBufferDeviceAddressEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_tooling_info
-    if (!strcmp(name, "vkGetPhysicalDeviceToolPropertiesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_tooling_info");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceToolPropertiesEXT : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceToolPropertiesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_tooling_info");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceToolPropertiesEXT : nullptr;
+        }
 #endif
 #ifdef VK_NV_cooperative_matrix
-    if (!strcmp(name, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_cooperative_matrix");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_cooperative_matrix");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV : nullptr;
+        }
 #endif
 #ifdef VK_NV_coverage_reduction_mode
-    if (!strcmp(name, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_coverage_reduction_mode");
-        return hasExt
-                   ? (void*)entry_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV
-                   : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_coverage_reduction_mode");
+            return hasExt
+                       ? (void*)entry_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV
+                       : nullptr;
+        }
 #endif
 #ifdef VK_EXT_full_screen_exclusive
-    if (!strcmp(name, "vkGetPhysicalDeviceSurfacePresentModes2EXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_full_screen_exclusive");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfacePresentModes2EXT : nullptr;
-    }
-    if (!strcmp(name, "vkAcquireFullScreenExclusiveModeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_full_screen_exclusive");
-        return hasExt ? (void*)entry_vkAcquireFullScreenExclusiveModeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkReleaseFullScreenExclusiveModeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_full_screen_exclusive");
-        return hasExt ? (void*)entry_vkReleaseFullScreenExclusiveModeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceGroupSurfacePresentModes2EXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_full_screen_exclusive");
-        return hasExt ? (void*)entry_vkGetDeviceGroupSurfacePresentModes2EXT : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceSurfacePresentModes2EXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_full_screen_exclusive");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceSurfacePresentModes2EXT : nullptr;
+        }
+        case PROC_vkAcquireFullScreenExclusiveModeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_full_screen_exclusive");
+            return hasExt ? (void*)entry_vkAcquireFullScreenExclusiveModeEXT : nullptr;
+        }
+        case PROC_vkReleaseFullScreenExclusiveModeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_full_screen_exclusive");
+            return hasExt ? (void*)entry_vkReleaseFullScreenExclusiveModeEXT : nullptr;
+        }
+        case PROC_vkGetDeviceGroupSurfacePresentModes2EXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_full_screen_exclusive");
+            return hasExt ? (void*)entry_vkGetDeviceGroupSurfacePresentModes2EXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_headless_surface
-    if (!strcmp(name, "vkCreateHeadlessSurfaceEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_headless_surface");
-        return hasExt ? (void*)entry_vkCreateHeadlessSurfaceEXT : nullptr;
-    }
+        case PROC_vkCreateHeadlessSurfaceEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_headless_surface");
+            return hasExt ? (void*)entry_vkCreateHeadlessSurfaceEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_line_rasterization
-    if (!strcmp(name, "vkCmdSetLineStippleEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_line_rasterization");
-        return hasExt ? (void*)entry_vkCmdSetLineStippleEXT : nullptr;
-    }
+        case PROC_vkCmdSetLineStippleEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_line_rasterization");
+            return hasExt ? (void*)entry_vkCmdSetLineStippleEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_host_query_reset
-    if (!strcmp(name, "vkResetQueryPoolEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_host_query_reset");
-        return hasExt ? (void*)entry_vkResetQueryPoolEXT : nullptr;
-    }
+        case PROC_vkResetQueryPoolEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_host_query_reset");
+            return hasExt ? (void*)entry_vkResetQueryPoolEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_extended_dynamic_state
-    if (!strcmp(name, "vkCmdSetCullModeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetCullModeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetFrontFaceEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetFrontFaceEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveTopologyEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetPrimitiveTopologyEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWithCountEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetViewportWithCountEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetScissorWithCountEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetScissorWithCountEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindVertexBuffers2EXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdBindVertexBuffers2EXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthTestEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetDepthTestEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthWriteEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetDepthWriteEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthCompareOpEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetDepthCompareOpEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBoundsTestEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetDepthBoundsTestEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilTestEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetStencilTestEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetStencilOpEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetStencilOpEXT : nullptr;
-    }
+        case PROC_vkCmdSetCullModeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetCullModeEXT : nullptr;
+        }
+        case PROC_vkCmdSetFrontFaceEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetFrontFaceEXT : nullptr;
+        }
+        case PROC_vkCmdSetPrimitiveTopologyEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetPrimitiveTopologyEXT : nullptr;
+        }
+        case PROC_vkCmdSetViewportWithCountEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetViewportWithCountEXT : nullptr;
+        }
+        case PROC_vkCmdSetScissorWithCountEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetScissorWithCountEXT : nullptr;
+        }
+        case PROC_vkCmdBindVertexBuffers2EXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdBindVertexBuffers2EXT : nullptr;
+        }
+        case PROC_vkCmdSetDepthTestEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetDepthTestEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetDepthWriteEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetDepthWriteEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetDepthCompareOpEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetDepthCompareOpEXT : nullptr;
+        }
+        case PROC_vkCmdSetDepthBoundsTestEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetDepthBoundsTestEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetStencilTestEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetStencilTestEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetStencilOpEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetStencilOpEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_swapchain_maintenance1
-    if (!strcmp(name, "vkReleaseSwapchainImagesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_swapchain_maintenance1");
-        return hasExt ? (void*)entry_vkReleaseSwapchainImagesEXT : nullptr;
-    }
+        case PROC_vkReleaseSwapchainImagesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_swapchain_maintenance1");
+            return hasExt ? (void*)entry_vkReleaseSwapchainImagesEXT : nullptr;
+        }
 #endif
 #ifdef VK_NV_device_generated_commands
-    if (!strcmp(name, "vkGetGeneratedCommandsMemoryRequirementsNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
-        return hasExt ? (void*)entry_vkGetGeneratedCommandsMemoryRequirementsNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdPreprocessGeneratedCommandsNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
-        return hasExt ? (void*)entry_vkCmdPreprocessGeneratedCommandsNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdExecuteGeneratedCommandsNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
-        return hasExt ? (void*)entry_vkCmdExecuteGeneratedCommandsNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindPipelineShaderGroupNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
-        return hasExt ? (void*)entry_vkCmdBindPipelineShaderGroupNV : nullptr;
-    }
-    if (!strcmp(name, "vkCreateIndirectCommandsLayoutNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
-        return hasExt ? (void*)entry_vkCreateIndirectCommandsLayoutNV : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyIndirectCommandsLayoutNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
-        return hasExt ? (void*)entry_vkDestroyIndirectCommandsLayoutNV : nullptr;
-    }
+        case PROC_vkGetGeneratedCommandsMemoryRequirementsNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
+            return hasExt ? (void*)entry_vkGetGeneratedCommandsMemoryRequirementsNV : nullptr;
+        }
+        case PROC_vkCmdPreprocessGeneratedCommandsNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
+            return hasExt ? (void*)entry_vkCmdPreprocessGeneratedCommandsNV : nullptr;
+        }
+        case PROC_vkCmdExecuteGeneratedCommandsNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
+            return hasExt ? (void*)entry_vkCmdExecuteGeneratedCommandsNV : nullptr;
+        }
+        case PROC_vkCmdBindPipelineShaderGroupNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
+            return hasExt ? (void*)entry_vkCmdBindPipelineShaderGroupNV : nullptr;
+        }
+        case PROC_vkCreateIndirectCommandsLayoutNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
+            return hasExt ? (void*)entry_vkCreateIndirectCommandsLayoutNV : nullptr;
+        }
+        case PROC_vkDestroyIndirectCommandsLayoutNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_device_generated_commands");
+            return hasExt ? (void*)entry_vkDestroyIndirectCommandsLayoutNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_acquire_drm_display
-    if (!strcmp(name, "vkAcquireDrmDisplayEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_acquire_drm_display");
-        return hasExt ? (void*)entry_vkAcquireDrmDisplayEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetDrmDisplayEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_acquire_drm_display");
-        return hasExt ? (void*)entry_vkGetDrmDisplayEXT : nullptr;
-    }
+        case PROC_vkAcquireDrmDisplayEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_acquire_drm_display");
+            return hasExt ? (void*)entry_vkAcquireDrmDisplayEXT : nullptr;
+        }
+        case PROC_vkGetDrmDisplayEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_acquire_drm_display");
+            return hasExt ? (void*)entry_vkGetDrmDisplayEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_private_data
-    if (!strcmp(name, "vkCreatePrivateDataSlotEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_private_data");
-        return hasExt ? (void*)entry_vkCreatePrivateDataSlotEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyPrivateDataSlotEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_private_data");
-        return hasExt ? (void*)entry_vkDestroyPrivateDataSlotEXT : nullptr;
-    }
-    if (!strcmp(name, "vkSetPrivateDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_private_data");
-        return hasExt ? (void*)entry_vkSetPrivateDataEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetPrivateDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_private_data");
-        return hasExt ? (void*)entry_vkGetPrivateDataEXT : nullptr;
-    }
+        case PROC_vkCreatePrivateDataSlotEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_private_data");
+            return hasExt ? (void*)entry_vkCreatePrivateDataSlotEXT : nullptr;
+        }
+        case PROC_vkDestroyPrivateDataSlotEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_private_data");
+            return hasExt ? (void*)entry_vkDestroyPrivateDataSlotEXT : nullptr;
+        }
+        case PROC_vkSetPrivateDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_private_data");
+            return hasExt ? (void*)entry_vkSetPrivateDataEXT : nullptr;
+        }
+        case PROC_vkGetPrivateDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_private_data");
+            return hasExt ? (void*)entry_vkGetPrivateDataEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_metal_objects
-    if (!strcmp(name, "vkExportMetalObjectsEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_metal_objects");
-        return hasExt ? (void*)entry_vkExportMetalObjectsEXT : nullptr;
-    }
+        case PROC_vkExportMetalObjectsEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_metal_objects");
+            return hasExt ? (void*)entry_vkExportMetalObjectsEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_descriptor_buffer
-    if (!strcmp(name, "vkGetDescriptorSetLayoutSizeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkGetDescriptorSetLayoutSizeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetLayoutBindingOffsetEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkGetDescriptorSetLayoutBindingOffsetEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkGetDescriptorEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorBuffersEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkCmdBindDescriptorBuffersEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDescriptorBufferOffsetsEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkCmdSetDescriptorBufferOffsetsEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkCmdBindDescriptorBufferEmbeddedSamplersEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferOpaqueCaptureDescriptorDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkGetBufferOpaqueCaptureDescriptorDataEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetImageOpaqueCaptureDescriptorDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkGetImageOpaqueCaptureDescriptorDataEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetImageViewOpaqueCaptureDescriptorDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkGetImageViewOpaqueCaptureDescriptorDataEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetSamplerOpaqueCaptureDescriptorDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkGetSamplerOpaqueCaptureDescriptorDataEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
-        return hasExt ? (void*)entry_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT
-                      : nullptr;
-    }
+        case PROC_vkGetDescriptorSetLayoutSizeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkGetDescriptorSetLayoutSizeEXT : nullptr;
+        }
+        case PROC_vkGetDescriptorSetLayoutBindingOffsetEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkGetDescriptorSetLayoutBindingOffsetEXT : nullptr;
+        }
+        case PROC_vkGetDescriptorEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkGetDescriptorEXT : nullptr;
+        }
+        case PROC_vkCmdBindDescriptorBuffersEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkCmdBindDescriptorBuffersEXT : nullptr;
+        }
+        case PROC_vkCmdSetDescriptorBufferOffsetsEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkCmdSetDescriptorBufferOffsetsEXT : nullptr;
+        }
+        case PROC_vkCmdBindDescriptorBufferEmbeddedSamplersEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkCmdBindDescriptorBufferEmbeddedSamplersEXT : nullptr;
+        }
+        case PROC_vkGetBufferOpaqueCaptureDescriptorDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkGetBufferOpaqueCaptureDescriptorDataEXT : nullptr;
+        }
+        case PROC_vkGetImageOpaqueCaptureDescriptorDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkGetImageOpaqueCaptureDescriptorDataEXT : nullptr;
+        }
+        case PROC_vkGetImageViewOpaqueCaptureDescriptorDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkGetImageViewOpaqueCaptureDescriptorDataEXT : nullptr;
+        }
+        case PROC_vkGetSamplerOpaqueCaptureDescriptorDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkGetSamplerOpaqueCaptureDescriptorDataEXT : nullptr;
+        }
+        case PROC_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_descriptor_buffer");
+            return hasExt ? (void*)entry_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT
+                          : nullptr;
+        }
 #endif
 #ifdef VK_NV_fragment_shading_rate_enums
-    if (!strcmp(name, "vkCmdSetFragmentShadingRateEnumNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_fragment_shading_rate_enums");
-        return hasExt ? (void*)entry_vkCmdSetFragmentShadingRateEnumNV : nullptr;
-    }
+        case PROC_vkCmdSetFragmentShadingRateEnumNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_fragment_shading_rate_enums");
+            return hasExt ? (void*)entry_vkCmdSetFragmentShadingRateEnumNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_image_compression_control
-    if (!strcmp(name, "vkGetImageSubresourceLayout2EXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_image_compression_control");
-        return hasExt ? (void*)entry_vkGetImageSubresourceLayout2EXT : nullptr;
-    }
+        case PROC_vkGetImageSubresourceLayout2EXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_image_compression_control");
+            return hasExt ? (void*)entry_vkGetImageSubresourceLayout2EXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_device_fault
-    if (!strcmp(name, "vkGetDeviceFaultInfoEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_device_fault");
-        return hasExt ? (void*)entry_vkGetDeviceFaultInfoEXT : nullptr;
-    }
+        case PROC_vkGetDeviceFaultInfoEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_device_fault");
+            return hasExt ? (void*)entry_vkGetDeviceFaultInfoEXT : nullptr;
+        }
 #endif
 #ifdef VK_NV_acquire_winrt_display
-    if (!strcmp(name, "vkAcquireWinrtDisplayNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_acquire_winrt_display");
-        return hasExt ? (void*)entry_vkAcquireWinrtDisplayNV : nullptr;
-    }
-    if (!strcmp(name, "vkGetWinrtDisplayNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_acquire_winrt_display");
-        return hasExt ? (void*)entry_vkGetWinrtDisplayNV : nullptr;
-    }
+        case PROC_vkAcquireWinrtDisplayNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_acquire_winrt_display");
+            return hasExt ? (void*)entry_vkAcquireWinrtDisplayNV : nullptr;
+        }
+        case PROC_vkGetWinrtDisplayNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_acquire_winrt_display");
+            return hasExt ? (void*)entry_vkGetWinrtDisplayNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_directfb_surface
-    if (!strcmp(name, "vkCreateDirectFBSurfaceEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_directfb_surface");
-        return hasExt ? (void*)entry_vkCreateDirectFBSurfaceEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_directfb_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceDirectFBPresentationSupportEXT : nullptr;
-    }
+        case PROC_vkCreateDirectFBSurfaceEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_directfb_surface");
+            return hasExt ? (void*)entry_vkCreateDirectFBSurfaceEXT : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceDirectFBPresentationSupportEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_directfb_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceDirectFBPresentationSupportEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_vertex_input_dynamic_state
-    if (!strcmp(name, "vkCmdSetVertexInputEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_vertex_input_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetVertexInputEXT : nullptr;
-    }
+        case PROC_vkCmdSetVertexInputEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_vertex_input_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetVertexInputEXT : nullptr;
+        }
 #endif
 #ifdef VK_FUCHSIA_external_memory
-    if (!strcmp(name, "vkGetMemoryZirconHandleFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_external_memory");
-        return hasExt ? (void*)entry_vkGetMemoryZirconHandleFUCHSIA : nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryZirconHandlePropertiesFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_external_memory");
-        return hasExt ? (void*)entry_vkGetMemoryZirconHandlePropertiesFUCHSIA : nullptr;
-    }
+        case PROC_vkGetMemoryZirconHandleFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_external_memory");
+            return hasExt ? (void*)entry_vkGetMemoryZirconHandleFUCHSIA : nullptr;
+        }
+        case PROC_vkGetMemoryZirconHandlePropertiesFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_external_memory");
+            return hasExt ? (void*)entry_vkGetMemoryZirconHandlePropertiesFUCHSIA : nullptr;
+        }
 #endif
 #ifdef VK_FUCHSIA_external_semaphore
-    if (!strcmp(name, "vkImportSemaphoreZirconHandleFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_external_semaphore");
-        return hasExt ? (void*)entry_vkImportSemaphoreZirconHandleFUCHSIA : nullptr;
-    }
-    if (!strcmp(name, "vkGetSemaphoreZirconHandleFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_external_semaphore");
-        return hasExt ? (void*)entry_vkGetSemaphoreZirconHandleFUCHSIA : nullptr;
-    }
+        case PROC_vkImportSemaphoreZirconHandleFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_external_semaphore");
+            return hasExt ? (void*)entry_vkImportSemaphoreZirconHandleFUCHSIA : nullptr;
+        }
+        case PROC_vkGetSemaphoreZirconHandleFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_external_semaphore");
+            return hasExt ? (void*)entry_vkGetSemaphoreZirconHandleFUCHSIA : nullptr;
+        }
 #endif
 #ifdef VK_FUCHSIA_buffer_collection
-    if (!strcmp(name, "vkCreateBufferCollectionFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
-        return hasExt ? (void*)entry_vkCreateBufferCollectionFUCHSIA : nullptr;
-    }
-    if (!strcmp(name, "vkSetBufferCollectionImageConstraintsFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
-        return hasExt ? (void*)entry_vkSetBufferCollectionImageConstraintsFUCHSIA : nullptr;
-    }
-    if (!strcmp(name, "vkSetBufferCollectionBufferConstraintsFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
-        return hasExt ? (void*)entry_vkSetBufferCollectionBufferConstraintsFUCHSIA : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyBufferCollectionFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
-        return hasExt ? (void*)entry_vkDestroyBufferCollectionFUCHSIA : nullptr;
-    }
-    if (!strcmp(name, "vkGetBufferCollectionPropertiesFUCHSIA")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
-        return hasExt ? (void*)entry_vkGetBufferCollectionPropertiesFUCHSIA : nullptr;
-    }
+        case PROC_vkCreateBufferCollectionFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
+            return hasExt ? (void*)entry_vkCreateBufferCollectionFUCHSIA : nullptr;
+        }
+        case PROC_vkSetBufferCollectionImageConstraintsFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
+            return hasExt ? (void*)entry_vkSetBufferCollectionImageConstraintsFUCHSIA : nullptr;
+        }
+        case PROC_vkSetBufferCollectionBufferConstraintsFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
+            return hasExt ? (void*)entry_vkSetBufferCollectionBufferConstraintsFUCHSIA : nullptr;
+        }
+        case PROC_vkDestroyBufferCollectionFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
+            return hasExt ? (void*)entry_vkDestroyBufferCollectionFUCHSIA : nullptr;
+        }
+        case PROC_vkGetBufferCollectionPropertiesFUCHSIA: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_FUCHSIA_buffer_collection");
+            return hasExt ? (void*)entry_vkGetBufferCollectionPropertiesFUCHSIA : nullptr;
+        }
 #endif
 #ifdef VK_HUAWEI_subpass_shading
-    if (!strcmp(name, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_subpass_shading");
-        return hasExt ? (void*)entry_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSubpassShadingHUAWEI")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_subpass_shading");
-        return hasExt ? (void*)entry_vkCmdSubpassShadingHUAWEI : nullptr;
-    }
+        case PROC_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_subpass_shading");
+            return hasExt ? (void*)entry_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI : nullptr;
+        }
+        case PROC_vkCmdSubpassShadingHUAWEI: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_subpass_shading");
+            return hasExt ? (void*)entry_vkCmdSubpassShadingHUAWEI : nullptr;
+        }
 #endif
 #ifdef VK_HUAWEI_invocation_mask
-    if (!strcmp(name, "vkCmdBindInvocationMaskHUAWEI")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_invocation_mask");
-        return hasExt ? (void*)entry_vkCmdBindInvocationMaskHUAWEI : nullptr;
-    }
+        case PROC_vkCmdBindInvocationMaskHUAWEI: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_invocation_mask");
+            return hasExt ? (void*)entry_vkCmdBindInvocationMaskHUAWEI : nullptr;
+        }
 #endif
 #ifdef VK_NV_external_memory_rdma
-    if (!strcmp(name, "vkGetMemoryRemoteAddressNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_external_memory_rdma");
-        return hasExt ? (void*)entry_vkGetMemoryRemoteAddressNV : nullptr;
-    }
+        case PROC_vkGetMemoryRemoteAddressNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_external_memory_rdma");
+            return hasExt ? (void*)entry_vkGetMemoryRemoteAddressNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_pipeline_properties
-    if (!strcmp(name, "vkGetPipelinePropertiesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_pipeline_properties");
-        return hasExt ? (void*)entry_vkGetPipelinePropertiesEXT : nullptr;
-    }
+        case PROC_vkGetPipelinePropertiesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_pipeline_properties");
+            return hasExt ? (void*)entry_vkGetPipelinePropertiesEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_extended_dynamic_state2
-    if (!strcmp(name, "vkCmdSetPatchControlPointsEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
-        return hasExt ? (void*)entry_vkCmdSetPatchControlPointsEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizerDiscardEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
-        return hasExt ? (void*)entry_vkCmdSetRasterizerDiscardEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthBiasEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
-        return hasExt ? (void*)entry_vkCmdSetDepthBiasEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetLogicOpEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
-        return hasExt ? (void*)entry_vkCmdSetLogicOpEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPrimitiveRestartEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
-        return hasExt ? (void*)entry_vkCmdSetPrimitiveRestartEnableEXT : nullptr;
-    }
+        case PROC_vkCmdSetPatchControlPointsEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
+            return hasExt ? (void*)entry_vkCmdSetPatchControlPointsEXT : nullptr;
+        }
+        case PROC_vkCmdSetRasterizerDiscardEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
+            return hasExt ? (void*)entry_vkCmdSetRasterizerDiscardEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetDepthBiasEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
+            return hasExt ? (void*)entry_vkCmdSetDepthBiasEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetLogicOpEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
+            return hasExt ? (void*)entry_vkCmdSetLogicOpEXT : nullptr;
+        }
+        case PROC_vkCmdSetPrimitiveRestartEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state2");
+            return hasExt ? (void*)entry_vkCmdSetPrimitiveRestartEnableEXT : nullptr;
+        }
 #endif
 #ifdef VK_QNX_screen_surface
-    if (!strcmp(name, "vkCreateScreenSurfaceQNX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_QNX_screen_surface");
-        return hasExt ? (void*)entry_vkCreateScreenSurfaceQNX : nullptr;
-    }
-    if (!strcmp(name, "vkGetPhysicalDeviceScreenPresentationSupportQNX")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_QNX_screen_surface");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceScreenPresentationSupportQNX : nullptr;
-    }
+        case PROC_vkCreateScreenSurfaceQNX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_QNX_screen_surface");
+            return hasExt ? (void*)entry_vkCreateScreenSurfaceQNX : nullptr;
+        }
+        case PROC_vkGetPhysicalDeviceScreenPresentationSupportQNX: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_QNX_screen_surface");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceScreenPresentationSupportQNX : nullptr;
+        }
 #endif
 #ifdef VK_EXT_color_write_enable
-    if (!strcmp(name, "vkCmdSetColorWriteEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_color_write_enable");
-        return hasExt ? (void*)entry_vkCmdSetColorWriteEnableEXT : nullptr;
-    }
+        case PROC_vkCmdSetColorWriteEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_color_write_enable");
+            return hasExt ? (void*)entry_vkCmdSetColorWriteEnableEXT : nullptr;
+        }
 #endif
 #ifdef VK_GOOGLE_gfxstream
-    if (!strcmp(name, "vkMapMemoryIntoAddressSpaceGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkMapMemoryIntoAddressSpaceGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateSizedGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkUpdateDescriptorSetWithTemplateSizedGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkBeginCommandBufferAsyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkBeginCommandBufferAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkEndCommandBufferAsyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkEndCommandBufferAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkResetCommandBufferAsyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkResetCommandBufferAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkCommandBufferHostSyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkCommandBufferHostSyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkCreateImageWithRequirementsGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkCreateImageWithRequirementsGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkCreateBufferWithRequirementsGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkCreateBufferWithRequirementsGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetMemoryHostAddressInfoGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkGetMemoryHostAddressInfoGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkFreeMemorySyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkFreeMemorySyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueHostSyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueHostSyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmitAsyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueSubmitAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueWaitIdleAsyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueWaitIdleAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueBindSparseAsyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueBindSparseAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetLinearImageLayoutGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkGetLinearImageLayoutGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetLinearImageLayout2GOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkGetLinearImageLayout2GOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueFlushCommandsGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueFlushCommandsGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueCommitDescriptorSetUpdatesGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueCommitDescriptorSetUpdatesGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkCollectDescriptorPoolIdsGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkCollectDescriptorPoolIdsGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSignalReleaseImageANDROIDAsyncGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueSignalReleaseImageANDROIDAsyncGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueFlushCommandsFromAuxMemoryGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueFlushCommandsFromAuxMemoryGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkGetBlobGOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkGetBlobGOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkUpdateDescriptorSetWithTemplateSized2GOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkUpdateDescriptorSetWithTemplateSized2GOOGLE : nullptr;
-    }
-    if (!strcmp(name, "vkQueueSubmitAsync2GOOGLE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
-        return hasExt ? (void*)entry_vkQueueSubmitAsync2GOOGLE : nullptr;
-    }
+        case PROC_vkMapMemoryIntoAddressSpaceGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkMapMemoryIntoAddressSpaceGOOGLE : nullptr;
+        }
+        case PROC_vkUpdateDescriptorSetWithTemplateSizedGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkUpdateDescriptorSetWithTemplateSizedGOOGLE : nullptr;
+        }
+        case PROC_vkBeginCommandBufferAsyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkBeginCommandBufferAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkEndCommandBufferAsyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkEndCommandBufferAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkResetCommandBufferAsyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkResetCommandBufferAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkCommandBufferHostSyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkCommandBufferHostSyncGOOGLE : nullptr;
+        }
+        case PROC_vkCreateImageWithRequirementsGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkCreateImageWithRequirementsGOOGLE : nullptr;
+        }
+        case PROC_vkCreateBufferWithRequirementsGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkCreateBufferWithRequirementsGOOGLE : nullptr;
+        }
+        case PROC_vkGetMemoryHostAddressInfoGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkGetMemoryHostAddressInfoGOOGLE : nullptr;
+        }
+        case PROC_vkFreeMemorySyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkFreeMemorySyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueHostSyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueHostSyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueSubmitAsyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueSubmitAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueWaitIdleAsyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueWaitIdleAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueBindSparseAsyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueBindSparseAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkGetLinearImageLayoutGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkGetLinearImageLayoutGOOGLE : nullptr;
+        }
+        case PROC_vkGetLinearImageLayout2GOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkGetLinearImageLayout2GOOGLE : nullptr;
+        }
+        case PROC_vkQueueFlushCommandsGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueFlushCommandsGOOGLE : nullptr;
+        }
+        case PROC_vkQueueCommitDescriptorSetUpdatesGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueCommitDescriptorSetUpdatesGOOGLE : nullptr;
+        }
+        case PROC_vkCollectDescriptorPoolIdsGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkCollectDescriptorPoolIdsGOOGLE : nullptr;
+        }
+        case PROC_vkQueueSignalReleaseImageANDROIDAsyncGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueSignalReleaseImageANDROIDAsyncGOOGLE : nullptr;
+        }
+        case PROC_vkQueueFlushCommandsFromAuxMemoryGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueFlushCommandsFromAuxMemoryGOOGLE : nullptr;
+        }
+        case PROC_vkGetBlobGOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkGetBlobGOOGLE : nullptr;
+        }
+        case PROC_vkUpdateDescriptorSetWithTemplateSized2GOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkUpdateDescriptorSetWithTemplateSized2GOOGLE : nullptr;
+        }
+        case PROC_vkQueueSubmitAsync2GOOGLE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_GOOGLE_gfxstream");
+            return hasExt ? (void*)entry_vkQueueSubmitAsync2GOOGLE : nullptr;
+        }
 #endif
 #ifdef VK_EXT_multi_draw
-    if (!strcmp(name, "vkCmdDrawMultiEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_multi_draw");
-        return hasExt ? (void*)entry_vkCmdDrawMultiEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMultiIndexedEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_multi_draw");
-        return hasExt ? (void*)entry_vkCmdDrawMultiIndexedEXT : nullptr;
-    }
+        case PROC_vkCmdDrawMultiEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_multi_draw");
+            return hasExt ? (void*)entry_vkCmdDrawMultiEXT : nullptr;
+        }
+        case PROC_vkCmdDrawMultiIndexedEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_multi_draw");
+            return hasExt ? (void*)entry_vkCmdDrawMultiIndexedEXT : nullptr;
+        }
 #endif
 #ifdef VK_EXT_opacity_micromap
-    if (!strcmp(name, "vkCreateMicromapEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCreateMicromapEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyMicromapEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkDestroyMicromapEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBuildMicromapsEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCmdBuildMicromapsEXT : nullptr;
-    }
-    if (!strcmp(name, "vkBuildMicromapsEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkBuildMicromapsEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCopyMicromapEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCopyMicromapEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCopyMicromapToMemoryEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCopyMicromapToMemoryEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCopyMemoryToMicromapEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCopyMemoryToMicromapEXT : nullptr;
-    }
-    if (!strcmp(name, "vkWriteMicromapsPropertiesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkWriteMicromapsPropertiesEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMicromapEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCmdCopyMicromapEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMicromapToMemoryEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCmdCopyMicromapToMemoryEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToMicromapEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCmdCopyMemoryToMicromapEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteMicromapsPropertiesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkCmdWriteMicromapsPropertiesEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceMicromapCompatibilityEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkGetDeviceMicromapCompatibilityEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetMicromapBuildSizesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
-        return hasExt ? (void*)entry_vkGetMicromapBuildSizesEXT : nullptr;
-    }
+        case PROC_vkCreateMicromapEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCreateMicromapEXT : nullptr;
+        }
+        case PROC_vkDestroyMicromapEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkDestroyMicromapEXT : nullptr;
+        }
+        case PROC_vkCmdBuildMicromapsEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCmdBuildMicromapsEXT : nullptr;
+        }
+        case PROC_vkBuildMicromapsEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkBuildMicromapsEXT : nullptr;
+        }
+        case PROC_vkCopyMicromapEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCopyMicromapEXT : nullptr;
+        }
+        case PROC_vkCopyMicromapToMemoryEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCopyMicromapToMemoryEXT : nullptr;
+        }
+        case PROC_vkCopyMemoryToMicromapEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCopyMemoryToMicromapEXT : nullptr;
+        }
+        case PROC_vkWriteMicromapsPropertiesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkWriteMicromapsPropertiesEXT : nullptr;
+        }
+        case PROC_vkCmdCopyMicromapEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCmdCopyMicromapEXT : nullptr;
+        }
+        case PROC_vkCmdCopyMicromapToMemoryEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCmdCopyMicromapToMemoryEXT : nullptr;
+        }
+        case PROC_vkCmdCopyMemoryToMicromapEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCmdCopyMemoryToMicromapEXT : nullptr;
+        }
+        case PROC_vkCmdWriteMicromapsPropertiesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkCmdWriteMicromapsPropertiesEXT : nullptr;
+        }
+        case PROC_vkGetDeviceMicromapCompatibilityEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkGetDeviceMicromapCompatibilityEXT : nullptr;
+        }
+        case PROC_vkGetMicromapBuildSizesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_opacity_micromap");
+            return hasExt ? (void*)entry_vkGetMicromapBuildSizesEXT : nullptr;
+        }
 #endif
 #ifdef VK_HUAWEI_cluster_culling_shader
-    if (!strcmp(name, "vkCmdDrawClusterHUAWEI")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_cluster_culling_shader");
-        return hasExt ? (void*)entry_vkCmdDrawClusterHUAWEI : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawClusterIndirectHUAWEI")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_cluster_culling_shader");
-        return hasExt ? (void*)entry_vkCmdDrawClusterIndirectHUAWEI : nullptr;
-    }
+        case PROC_vkCmdDrawClusterHUAWEI: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_cluster_culling_shader");
+            return hasExt ? (void*)entry_vkCmdDrawClusterHUAWEI : nullptr;
+        }
+        case PROC_vkCmdDrawClusterIndirectHUAWEI: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_HUAWEI_cluster_culling_shader");
+            return hasExt ? (void*)entry_vkCmdDrawClusterIndirectHUAWEI : nullptr;
+        }
 #endif
 #ifdef VK_EXT_pageable_device_local_memory
-    if (!strcmp(name, "vkSetDeviceMemoryPriorityEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_pageable_device_local_memory");
-        return hasExt ? (void*)entry_vkSetDeviceMemoryPriorityEXT : nullptr;
-    }
+        case PROC_vkSetDeviceMemoryPriorityEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_pageable_device_local_memory");
+            return hasExt ? (void*)entry_vkSetDeviceMemoryPriorityEXT : nullptr;
+        }
 #endif
 #ifdef VK_VALVE_descriptor_set_host_mapping
-    if (!strcmp(name, "vkGetDescriptorSetLayoutHostMappingInfoVALVE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_VALVE_descriptor_set_host_mapping");
-        return hasExt ? (void*)entry_vkGetDescriptorSetLayoutHostMappingInfoVALVE : nullptr;
-    }
-    if (!strcmp(name, "vkGetDescriptorSetHostMappingVALVE")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_VALVE_descriptor_set_host_mapping");
-        return hasExt ? (void*)entry_vkGetDescriptorSetHostMappingVALVE : nullptr;
-    }
+        case PROC_vkGetDescriptorSetLayoutHostMappingInfoVALVE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_VALVE_descriptor_set_host_mapping");
+            return hasExt ? (void*)entry_vkGetDescriptorSetLayoutHostMappingInfoVALVE : nullptr;
+        }
+        case PROC_vkGetDescriptorSetHostMappingVALVE: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_VALVE_descriptor_set_host_mapping");
+            return hasExt ? (void*)entry_vkGetDescriptorSetHostMappingVALVE : nullptr;
+        }
 #endif
 #ifdef VK_NV_copy_memory_indirect
-    if (!strcmp(name, "vkCmdCopyMemoryIndirectNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_copy_memory_indirect");
-        return hasExt ? (void*)entry_vkCmdCopyMemoryIndirectNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToImageIndirectNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_copy_memory_indirect");
-        return hasExt ? (void*)entry_vkCmdCopyMemoryToImageIndirectNV : nullptr;
-    }
+        case PROC_vkCmdCopyMemoryIndirectNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_copy_memory_indirect");
+            return hasExt ? (void*)entry_vkCmdCopyMemoryIndirectNV : nullptr;
+        }
+        case PROC_vkCmdCopyMemoryToImageIndirectNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_copy_memory_indirect");
+            return hasExt ? (void*)entry_vkCmdCopyMemoryToImageIndirectNV : nullptr;
+        }
 #endif
 #ifdef VK_NV_memory_decompression
-    if (!strcmp(name, "vkCmdDecompressMemoryNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_memory_decompression");
-        return hasExt ? (void*)entry_vkCmdDecompressMemoryNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDecompressMemoryIndirectCountNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_memory_decompression");
-        return hasExt ? (void*)entry_vkCmdDecompressMemoryIndirectCountNV : nullptr;
-    }
+        case PROC_vkCmdDecompressMemoryNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_memory_decompression");
+            return hasExt ? (void*)entry_vkCmdDecompressMemoryNV : nullptr;
+        }
+        case PROC_vkCmdDecompressMemoryIndirectCountNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_memory_decompression");
+            return hasExt ? (void*)entry_vkCmdDecompressMemoryIndirectCountNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_extended_dynamic_state3
-    if (!strcmp(name, "vkCmdSetTessellationDomainOriginEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetTessellationDomainOriginEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClampEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetDepthClampEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetPolygonModeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetPolygonModeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizationSamplesEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetRasterizationSamplesEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetSampleMaskEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetSampleMaskEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetAlphaToCoverageEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetAlphaToCoverageEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetAlphaToOneEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetAlphaToOneEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetLogicOpEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetLogicOpEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetColorBlendEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendEquationEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetColorBlendEquationEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetColorWriteMaskEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetColorWriteMaskEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRasterizationStreamEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetRasterizationStreamEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetConservativeRasterizationModeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetConservativeRasterizationModeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetExtraPrimitiveOverestimationSizeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetExtraPrimitiveOverestimationSizeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClipEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetDepthClipEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetSampleLocationsEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetSampleLocationsEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetColorBlendAdvancedEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetColorBlendAdvancedEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetProvokingVertexModeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetProvokingVertexModeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetLineRasterizationModeEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetLineRasterizationModeEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetLineStippleEnableEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetLineStippleEnableEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetDepthClipNegativeOneToOneEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetDepthClipNegativeOneToOneEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportWScalingEnableNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetViewportWScalingEnableNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetViewportSwizzleNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetViewportSwizzleNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageToColorEnableNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetCoverageToColorEnableNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageToColorLocationNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetCoverageToColorLocationNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationModeNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetCoverageModulationModeNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationTableEnableNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetCoverageModulationTableEnableNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageModulationTableNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetCoverageModulationTableNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetShadingRateImageEnableNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetShadingRateImageEnableNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRepresentativeFragmentTestEnableNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetRepresentativeFragmentTestEnableNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetCoverageReductionModeNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
-        return hasExt ? (void*)entry_vkCmdSetCoverageReductionModeNV : nullptr;
-    }
+        case PROC_vkCmdSetTessellationDomainOriginEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetTessellationDomainOriginEXT : nullptr;
+        }
+        case PROC_vkCmdSetDepthClampEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetDepthClampEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetPolygonModeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetPolygonModeEXT : nullptr;
+        }
+        case PROC_vkCmdSetRasterizationSamplesEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetRasterizationSamplesEXT : nullptr;
+        }
+        case PROC_vkCmdSetSampleMaskEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetSampleMaskEXT : nullptr;
+        }
+        case PROC_vkCmdSetAlphaToCoverageEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetAlphaToCoverageEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetAlphaToOneEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetAlphaToOneEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetLogicOpEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetLogicOpEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetColorBlendEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetColorBlendEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetColorBlendEquationEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetColorBlendEquationEXT : nullptr;
+        }
+        case PROC_vkCmdSetColorWriteMaskEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetColorWriteMaskEXT : nullptr;
+        }
+        case PROC_vkCmdSetRasterizationStreamEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetRasterizationStreamEXT : nullptr;
+        }
+        case PROC_vkCmdSetConservativeRasterizationModeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetConservativeRasterizationModeEXT : nullptr;
+        }
+        case PROC_vkCmdSetExtraPrimitiveOverestimationSizeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetExtraPrimitiveOverestimationSizeEXT : nullptr;
+        }
+        case PROC_vkCmdSetDepthClipEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetDepthClipEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetSampleLocationsEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetSampleLocationsEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetColorBlendAdvancedEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetColorBlendAdvancedEXT : nullptr;
+        }
+        case PROC_vkCmdSetProvokingVertexModeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetProvokingVertexModeEXT : nullptr;
+        }
+        case PROC_vkCmdSetLineRasterizationModeEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetLineRasterizationModeEXT : nullptr;
+        }
+        case PROC_vkCmdSetLineStippleEnableEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetLineStippleEnableEXT : nullptr;
+        }
+        case PROC_vkCmdSetDepthClipNegativeOneToOneEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetDepthClipNegativeOneToOneEXT : nullptr;
+        }
+        case PROC_vkCmdSetViewportWScalingEnableNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetViewportWScalingEnableNV : nullptr;
+        }
+        case PROC_vkCmdSetViewportSwizzleNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetViewportSwizzleNV : nullptr;
+        }
+        case PROC_vkCmdSetCoverageToColorEnableNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetCoverageToColorEnableNV : nullptr;
+        }
+        case PROC_vkCmdSetCoverageToColorLocationNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetCoverageToColorLocationNV : nullptr;
+        }
+        case PROC_vkCmdSetCoverageModulationModeNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetCoverageModulationModeNV : nullptr;
+        }
+        case PROC_vkCmdSetCoverageModulationTableEnableNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetCoverageModulationTableEnableNV : nullptr;
+        }
+        case PROC_vkCmdSetCoverageModulationTableNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetCoverageModulationTableNV : nullptr;
+        }
+        case PROC_vkCmdSetShadingRateImageEnableNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetShadingRateImageEnableNV : nullptr;
+        }
+        case PROC_vkCmdSetRepresentativeFragmentTestEnableNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetRepresentativeFragmentTestEnableNV : nullptr;
+        }
+        case PROC_vkCmdSetCoverageReductionModeNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_extended_dynamic_state3");
+            return hasExt ? (void*)entry_vkCmdSetCoverageReductionModeNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_shader_module_identifier
-    if (!strcmp(name, "vkGetShaderModuleIdentifierEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_module_identifier");
-        return hasExt ? (void*)entry_vkGetShaderModuleIdentifierEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetShaderModuleCreateInfoIdentifierEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_module_identifier");
-        return hasExt ? (void*)entry_vkGetShaderModuleCreateInfoIdentifierEXT : nullptr;
-    }
+        case PROC_vkGetShaderModuleIdentifierEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_module_identifier");
+            return hasExt ? (void*)entry_vkGetShaderModuleIdentifierEXT : nullptr;
+        }
+        case PROC_vkGetShaderModuleCreateInfoIdentifierEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_module_identifier");
+            return hasExt ? (void*)entry_vkGetShaderModuleCreateInfoIdentifierEXT : nullptr;
+        }
 #endif
 #ifdef VK_NV_optical_flow
-    if (!strcmp(name, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
-        return hasExt ? (void*)entry_vkGetPhysicalDeviceOpticalFlowImageFormatsNV : nullptr;
-    }
-    if (!strcmp(name, "vkCreateOpticalFlowSessionNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
-        return hasExt ? (void*)entry_vkCreateOpticalFlowSessionNV : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyOpticalFlowSessionNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
-        return hasExt ? (void*)entry_vkDestroyOpticalFlowSessionNV : nullptr;
-    }
-    if (!strcmp(name, "vkBindOpticalFlowSessionImageNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
-        return hasExt ? (void*)entry_vkBindOpticalFlowSessionImageNV : nullptr;
-    }
-    if (!strcmp(name, "vkCmdOpticalFlowExecuteNV")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
-        return hasExt ? (void*)entry_vkCmdOpticalFlowExecuteNV : nullptr;
-    }
+        case PROC_vkGetPhysicalDeviceOpticalFlowImageFormatsNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
+            return hasExt ? (void*)entry_vkGetPhysicalDeviceOpticalFlowImageFormatsNV : nullptr;
+        }
+        case PROC_vkCreateOpticalFlowSessionNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
+            return hasExt ? (void*)entry_vkCreateOpticalFlowSessionNV : nullptr;
+        }
+        case PROC_vkDestroyOpticalFlowSessionNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
+            return hasExt ? (void*)entry_vkDestroyOpticalFlowSessionNV : nullptr;
+        }
+        case PROC_vkBindOpticalFlowSessionImageNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
+            return hasExt ? (void*)entry_vkBindOpticalFlowSessionImageNV : nullptr;
+        }
+        case PROC_vkCmdOpticalFlowExecuteNV: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_NV_optical_flow");
+            return hasExt ? (void*)entry_vkCmdOpticalFlowExecuteNV : nullptr;
+        }
 #endif
 #ifdef VK_EXT_shader_object
-    if (!strcmp(name, "vkCreateShadersEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_object");
-        return hasExt ? (void*)entry_vkCreateShadersEXT : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyShaderEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_object");
-        return hasExt ? (void*)entry_vkDestroyShaderEXT : nullptr;
-    }
-    if (!strcmp(name, "vkGetShaderBinaryDataEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_object");
-        return hasExt ? (void*)entry_vkGetShaderBinaryDataEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBindShadersEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_object");
-        return hasExt ? (void*)entry_vkCmdBindShadersEXT : nullptr;
-    }
+        case PROC_vkCreateShadersEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_object");
+            return hasExt ? (void*)entry_vkCreateShadersEXT : nullptr;
+        }
+        case PROC_vkDestroyShaderEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_object");
+            return hasExt ? (void*)entry_vkDestroyShaderEXT : nullptr;
+        }
+        case PROC_vkGetShaderBinaryDataEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_object");
+            return hasExt ? (void*)entry_vkGetShaderBinaryDataEXT : nullptr;
+        }
+        case PROC_vkCmdBindShadersEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_shader_object");
+            return hasExt ? (void*)entry_vkCmdBindShadersEXT : nullptr;
+        }
 #endif
 #ifdef VK_QCOM_tile_properties
-    if (!strcmp(name, "vkGetFramebufferTilePropertiesQCOM")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_QCOM_tile_properties");
-        return hasExt ? (void*)entry_vkGetFramebufferTilePropertiesQCOM : nullptr;
-    }
-    if (!strcmp(name, "vkGetDynamicRenderingTilePropertiesQCOM")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_QCOM_tile_properties");
-        return hasExt ? (void*)entry_vkGetDynamicRenderingTilePropertiesQCOM : nullptr;
-    }
+        case PROC_vkGetFramebufferTilePropertiesQCOM: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_QCOM_tile_properties");
+            return hasExt ? (void*)entry_vkGetFramebufferTilePropertiesQCOM : nullptr;
+        }
+        case PROC_vkGetDynamicRenderingTilePropertiesQCOM: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_QCOM_tile_properties");
+            return hasExt ? (void*)entry_vkGetDynamicRenderingTilePropertiesQCOM : nullptr;
+        }
 #endif
 #ifdef VK_EXT_attachment_feedback_loop_dynamic_state
-    if (!strcmp(name, "vkCmdSetAttachmentFeedbackLoopEnableEXT")) {
-        bool hasExt =
-            resources->hasDeviceExtension(device, "VK_EXT_attachment_feedback_loop_dynamic_state");
-        return hasExt ? (void*)entry_vkCmdSetAttachmentFeedbackLoopEnableEXT : nullptr;
-    }
+        case PROC_vkCmdSetAttachmentFeedbackLoopEnableEXT: {
+            bool hasExt =
+                resources->hasDeviceExtension(device, "VK_EXT_attachment_feedback_loop_dynamic_state");
+            return hasExt ? (void*)entry_vkCmdSetAttachmentFeedbackLoopEnableEXT : nullptr;
+        }
 #endif
 #ifdef VK_KHR_acceleration_structure
-    if (!strcmp(name, "vkCreateAccelerationStructureKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCreateAccelerationStructureKHR : nullptr;
-    }
-    if (!strcmp(name, "vkDestroyAccelerationStructureKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkDestroyAccelerationStructureKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructuresKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCmdBuildAccelerationStructuresKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdBuildAccelerationStructuresIndirectKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCmdBuildAccelerationStructuresIndirectKHR : nullptr;
-    }
-    if (!strcmp(name, "vkBuildAccelerationStructuresKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkBuildAccelerationStructuresKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCopyAccelerationStructureKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCopyAccelerationStructureKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCopyAccelerationStructureToMemoryKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCopyAccelerationStructureToMemoryKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCopyMemoryToAccelerationStructureKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCopyMemoryToAccelerationStructureKHR : nullptr;
-    }
-    if (!strcmp(name, "vkWriteAccelerationStructuresPropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkWriteAccelerationStructuresPropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCmdCopyAccelerationStructureKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyAccelerationStructureToMemoryKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCmdCopyAccelerationStructureToMemoryKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdCopyMemoryToAccelerationStructureKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCmdCopyMemoryToAccelerationStructureKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureDeviceAddressKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkGetAccelerationStructureDeviceAddressKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdWriteAccelerationStructuresPropertiesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkCmdWriteAccelerationStructuresPropertiesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetDeviceAccelerationStructureCompatibilityKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkGetDeviceAccelerationStructureCompatibilityKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetAccelerationStructureBuildSizesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
-        return hasExt ? (void*)entry_vkGetAccelerationStructureBuildSizesKHR : nullptr;
-    }
+        case PROC_vkCreateAccelerationStructureKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCreateAccelerationStructureKHR : nullptr;
+        }
+        case PROC_vkDestroyAccelerationStructureKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkDestroyAccelerationStructureKHR : nullptr;
+        }
+        case PROC_vkCmdBuildAccelerationStructuresKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCmdBuildAccelerationStructuresKHR : nullptr;
+        }
+        case PROC_vkCmdBuildAccelerationStructuresIndirectKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCmdBuildAccelerationStructuresIndirectKHR : nullptr;
+        }
+        case PROC_vkBuildAccelerationStructuresKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkBuildAccelerationStructuresKHR : nullptr;
+        }
+        case PROC_vkCopyAccelerationStructureKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCopyAccelerationStructureKHR : nullptr;
+        }
+        case PROC_vkCopyAccelerationStructureToMemoryKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCopyAccelerationStructureToMemoryKHR : nullptr;
+        }
+        case PROC_vkCopyMemoryToAccelerationStructureKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCopyMemoryToAccelerationStructureKHR : nullptr;
+        }
+        case PROC_vkWriteAccelerationStructuresPropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkWriteAccelerationStructuresPropertiesKHR : nullptr;
+        }
+        case PROC_vkCmdCopyAccelerationStructureKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCmdCopyAccelerationStructureKHR : nullptr;
+        }
+        case PROC_vkCmdCopyAccelerationStructureToMemoryKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCmdCopyAccelerationStructureToMemoryKHR : nullptr;
+        }
+        case PROC_vkCmdCopyMemoryToAccelerationStructureKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCmdCopyMemoryToAccelerationStructureKHR : nullptr;
+        }
+        case PROC_vkGetAccelerationStructureDeviceAddressKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkGetAccelerationStructureDeviceAddressKHR : nullptr;
+        }
+        case PROC_vkCmdWriteAccelerationStructuresPropertiesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkCmdWriteAccelerationStructuresPropertiesKHR : nullptr;
+        }
+        case PROC_vkGetDeviceAccelerationStructureCompatibilityKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkGetDeviceAccelerationStructureCompatibilityKHR : nullptr;
+        }
+        case PROC_vkGetAccelerationStructureBuildSizesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_acceleration_structure");
+            return hasExt ? (void*)entry_vkGetAccelerationStructureBuildSizesKHR : nullptr;
+        }
 #endif
 #ifdef VK_KHR_ray_tracing_pipeline
-    if (!strcmp(name, "vkCmdTraceRaysKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
-        return hasExt ? (void*)entry_vkCmdTraceRaysKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCreateRayTracingPipelinesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
-        return hasExt ? (void*)entry_vkCreateRayTracingPipelinesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
-        return hasExt ? (void*)entry_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdTraceRaysIndirectKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
-        return hasExt ? (void*)entry_vkCmdTraceRaysIndirectKHR : nullptr;
-    }
-    if (!strcmp(name, "vkGetRayTracingShaderGroupStackSizeKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
-        return hasExt ? (void*)entry_vkGetRayTracingShaderGroupStackSizeKHR : nullptr;
-    }
-    if (!strcmp(name, "vkCmdSetRayTracingPipelineStackSizeKHR")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
-        return hasExt ? (void*)entry_vkCmdSetRayTracingPipelineStackSizeKHR : nullptr;
-    }
+        case PROC_vkCmdTraceRaysKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
+            return hasExt ? (void*)entry_vkCmdTraceRaysKHR : nullptr;
+        }
+        case PROC_vkCreateRayTracingPipelinesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
+            return hasExt ? (void*)entry_vkCreateRayTracingPipelinesKHR : nullptr;
+        }
+        case PROC_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
+            return hasExt ? (void*)entry_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR : nullptr;
+        }
+        case PROC_vkCmdTraceRaysIndirectKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
+            return hasExt ? (void*)entry_vkCmdTraceRaysIndirectKHR : nullptr;
+        }
+        case PROC_vkGetRayTracingShaderGroupStackSizeKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
+            return hasExt ? (void*)entry_vkGetRayTracingShaderGroupStackSizeKHR : nullptr;
+        }
+        case PROC_vkCmdSetRayTracingPipelineStackSizeKHR: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_KHR_ray_tracing_pipeline");
+            return hasExt ? (void*)entry_vkCmdSetRayTracingPipelineStackSizeKHR : nullptr;
+        }
 #endif
 #ifdef VK_EXT_mesh_shader
-    if (!strcmp(name, "vkCmdDrawMeshTasksEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_mesh_shader");
-        return hasExt ? (void*)entry_vkCmdDrawMeshTasksEXT : nullptr;
-    }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_mesh_shader");
-        return hasExt ? (void*)entry_vkCmdDrawMeshTasksIndirectEXT : nullptr;
+        case PROC_vkCmdDrawMeshTasksEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_mesh_shader");
+            return hasExt ? (void*)entry_vkCmdDrawMeshTasksEXT : nullptr;
+        }
+        case PROC_vkCmdDrawMeshTasksIndirectEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_mesh_shader");
+            return hasExt ? (void*)entry_vkCmdDrawMeshTasksIndirectEXT : nullptr;
+        }
+        case PROC_vkCmdDrawMeshTasksIndirectCountEXT: {
+            bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_mesh_shader");
+            return hasExt ? (void*)entry_vkCmdDrawMeshTasksIndirectCountEXT : nullptr;
+        }
+#endif
+        default:
+            return nullptr;
     }
-    if (!strcmp(name, "vkCmdDrawMeshTasksIndirectCountEXT")) {
-        bool hasExt = resources->hasDeviceExtension(device, "VK_EXT_mesh_shader");
-        return hasExt ? (void*)entry_vkCmdDrawMeshTasksIndirectCountEXT : nullptr;
-    }
-#endif
-    return nullptr;
 }
 
 }  // namespace vk
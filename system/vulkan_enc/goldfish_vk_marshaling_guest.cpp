@@ -40232,6 +40232,24 @@ const char* api_opcode_to_string(const uint32_t opcode) {
         case OP_vkGetBlobGOOGLE: {
             return "OP_vkGetBlobGOOGLE";
         }
+        case OP_vkUploadShaderCodeGOOGLE: {
+            return "OP_vkUploadShaderCodeGOOGLE";
+        }
+        case OP_vkCreateShaderModuleFromHashGOOGLE: {
+            return "OP_vkCreateShaderModuleFromHashGOOGLE";
+        }
+        case OP_vkReserveHandlesGOOGLE: {
+            return "OP_vkReserveHandlesGOOGLE";
+        }
+        case OP_vkCreateImageViewAsyncGOOGLE: {
+            return "OP_vkCreateImageViewAsyncGOOGLE";
+        }
+        case OP_vkCreateSamplerAsyncGOOGLE: {
+            return "OP_vkCreateSamplerAsyncGOOGLE";
+        }
+        case OP_vkCreateFramebufferAsyncGOOGLE: {
+            return "OP_vkCreateFramebufferAsyncGOOGLE";
+        }
 #endif
 #ifdef VK_EXT_extended_dynamic_state3
         case OP_vkCmdSetRasterizationSamplesEXT: {
@@ -7758,6 +7758,12 @@ void unmarshal_VkCreateBlobGOOGLE(VulkanStreamGuest* vkStream, VkStructureType r
 #define OP_vkGetBlobGOOGLE 20341
 #define OP_vkUpdateDescriptorSetWithTemplateSized2GOOGLE 244782974
 #define OP_vkQueueSubmitAsync2GOOGLE 292092830
+#define OP_vkUploadShaderCodeGOOGLE 237840765
+#define OP_vkCreateShaderModuleFromHashGOOGLE 264318609
+#define OP_vkReserveHandlesGOOGLE 215873642
+#define OP_vkCreateImageViewAsyncGOOGLE 246089517
+#define OP_vkCreateSamplerAsyncGOOGLE 271650388
+#define OP_vkCreateFramebufferAsyncGOOGLE 229413076
 #endif
 #ifdef VK_EXT_global_priority_query
 DEFINE_ALIAS_FUNCTION(marshal_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR,
@@ -14,11 +14,17 @@
 // limitations under the License.
 #include <gtest/gtest.h>
 
+#include "aemu/base/AndroidSubAllocator.h"
+#include "aemu/base/BumpPool.h"
+#include "aemu/base/containers/EntityManager.h"
 #include "aemu/base/synchronization/AndroidConditionVariable.h"
 #include "aemu/base/synchronization/AndroidLock.h"
+#include "aemu/base/synchronization/AndroidLockFreeMessageChannel.h"
 #include "aemu/base/threads/AndroidWorkPool.h"
+#include "aemu/base/threads/AndroidWorkStealingPool.h"
 
 #include <atomic>
+#include <thread>
 #include <vector>
 
 namespace android {
@@ -283,6 +289,286 @@ TEST(WorkPool, NestedWaitAll) {
     EXPECT_EQ(1, y);
 }
 
+// Tests that small captures stay in place and large ones still run.
+TEST(InlineTask, Captures) {
+    int x = 0;
+    InlineTask small([&x] { ++x; });
+    InlineTask moved(std::move(small));
+    EXPECT_FALSE(small);
+    moved();
+    EXPECT_EQ(1, x);
+
+    struct Big { char bytes[InlineTask::kInlineSize * 2]; };
+    Big big = {};
+    big.bytes[0] = 7;
+    InlineTask large([big, &x] { x = big.bytes[0]; });
+    InlineTask movedLarge;
+    movedLarge = std::move(large);
+    movedLarge();
+    EXPECT_EQ(7, x);
+}
+
+// Tests that every index is visited once, with and without threads.
+TEST(WorkStealingPool, ParallelFor) {
+    for (size_t numThreads : {0, 1, 4}) {
+        WorkStealingPool p(numThreads);
+        std::vector<int> visits(1000, 0);
+
+        p.parallelFor(visits.size(), 16, [&visits](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                ++visits[i];
+            }
+        });
+
+        for (int v : visits) {
+            EXPECT_EQ(1, v);
+        }
+    }
+}
+
+// Tests tasks that submit and wait on more tasks from inside the pool.
+TEST(WorkStealingPool, NestedWait) {
+    WorkStealingPool p(2);
+    std::atomic<int> x { 0 };
+
+    WorkStealingPool::TaskGroup outer;
+    for (int i = 0; i < 64; ++i) {
+        p.submit(&outer, [&p, &x] {
+            WorkStealingPool::TaskGroup inner;
+            for (int j = 0; j < 4; ++j) {
+                p.submit(&inner, [&x] { ++x; });
+            }
+            p.wait(&inner);
+        });
+    }
+    p.wait(&outer);
+
+    EXPECT_EQ(256, x);
+}
+
+// Tests that rewinding keeps earlier allocations and reuses the space after.
+TEST(BumpPool, ScopeRewinds) {
+    BumpPool pool(64);
+
+    uint64_t* kept = (uint64_t*)pool.alloc(sizeof(uint64_t));
+    *kept = 42;
+
+    void* scratch;
+    {
+        BumpPool::Scope scope(&pool);
+        scratch = pool.alloc(16);
+        // Past the initial storage, from an overflow chunk.
+        memset(pool.alloc(1024), 0xff, 1024);
+    }
+    EXPECT_EQ(scratch, pool.alloc(16));
+    EXPECT_EQ(42u, *kept);
+}
+
+// Tests that reset() keeps overflow chunks warm and trim() frees them.
+TEST(BumpPool, ResetKeepsChunks) {
+    BumpPool pool(64);
+
+    void* overflow = nullptr;
+    pool.alloc(32);
+    overflow = pool.alloc(1024);
+    const size_t held = pool.bytesHeld();
+
+    pool.reset();
+    EXPECT_EQ(held, pool.bytesHeld());
+    pool.alloc(32);
+    EXPECT_EQ(overflow, pool.alloc(1024));
+
+    pool.reset();
+    pool.trim();
+    EXPECT_EQ(64u, pool.bytesHeld());
+}
+
+// Tests that stale handles miss and freed slots are reused.
+TEST(SoaEntityManager, AddRemoveGet) {
+    SoaEntityManager<32, 16, 16, int> m;
+
+    auto a = m.add(1, 1);
+    auto b = m.add(2, 1);
+    EXPECT_EQ(2u, m.size());
+    EXPECT_EQ(1, *m.get(a));
+    EXPECT_EQ(2, *m.get(b));
+
+    m.remove(a);
+    EXPECT_EQ(nullptr, m.get(a));
+    EXPECT_FALSE(m.isLive(a));
+
+    auto c = m.add(3, 1);
+    EXPECT_EQ(decltype(m)::Handles::getHandleIndex(a),
+              decltype(m)::Handles::getHandleIndex(c));
+    EXPECT_NE(a, c);
+    EXPECT_EQ(3, *m.get(c));
+
+    int sum = 0;
+    m.forEachLiveEntry([&sum](uint64_t, int& item) { sum += item; });
+    EXPECT_EQ(5, sum);
+
+    m.clear();
+    EXPECT_EQ(0u, m.size());
+    EXPECT_EQ(nullptr, m.get(b));
+}
+
+// Tests that freed neighbors merge back into space a larger allocation fits.
+TEST(SubAllocator, TlsfAllocFree) {
+    constexpr uint64_t kPage = 4096;
+    std::vector<uint8_t> buffer(64 * kPage);
+    SubAllocator allocator(buffer.data(), buffer.size(), kPage, SubAllocator::Strategy::Tlsf);
+
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 16; ++i) {
+        void* ptr = allocator.alloc(4 * kPage - 1);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_EQ(0u, allocator.getOffset(ptr) % kPage);
+        ptrs.push_back(ptr);
+    }
+    EXPECT_EQ(nullptr, allocator.alloc(1));
+
+    // Free every other one: half the space is free, in 4 page pieces.
+    for (int i = 0; i < 16; i += 2) {
+        EXPECT_TRUE(allocator.free(ptrs[i]));
+    }
+    auto stats = allocator.getStats();
+    EXPECT_EQ(32 * kPage, stats.freeBytes);
+    EXPECT_EQ(4 * kPage, stats.largestFreeBlock);
+    EXPECT_EQ(8u, stats.freeBlockCount);
+    EXPECT_GT(stats.fragmentation(), 0.8);
+    EXPECT_EQ(nullptr, allocator.alloc(8 * kPage));
+
+    EXPECT_TRUE(allocator.free(ptrs[1]));
+    EXPECT_FALSE(allocator.free(ptrs[1]));
+    void* merged = allocator.alloc(12 * kPage);
+    EXPECT_EQ(ptrs[0], merged);
+
+    allocator.freeAll();
+    EXPECT_TRUE(allocator.empty());
+    EXPECT_EQ(0.0, allocator.getStats().fragmentation());
+    EXPECT_NE(nullptr, allocator.alloc(64 * kPage));
+}
+
+// Tests that compaction slides live allocations down into one free block.
+TEST(SubAllocator, TlsfDefragment) {
+    constexpr uint64_t kPage = 4096;
+    std::vector<uint8_t> buffer(16 * kPage);
+    SubAllocator allocator(buffer.data(), buffer.size(), kPage, SubAllocator::Strategy::Tlsf);
+
+    std::vector<uint8_t*> ptrs;
+    for (int i = 0; i < 8; ++i) {
+        ptrs.push_back((uint8_t*)allocator.alloc(2 * kPage));
+        ptrs.back()[0] = (uint8_t)i;
+    }
+    for (int i = 0; i < 8; i += 2) {
+        allocator.free(ptrs[i]);
+    }
+
+    const uint64_t moved = allocator.defragment(
+        [&buffer](uint64_t src, uint64_t dst, uint64_t size) {
+            memmove(buffer.data() + dst, buffer.data() + src, size);
+            return true;
+        });
+    EXPECT_EQ(8 * kPage, moved);
+
+    auto stats = allocator.getStats();
+    EXPECT_EQ(1u, stats.freeBlockCount);
+    EXPECT_EQ(8 * kPage, stats.largestFreeBlock);
+    EXPECT_EQ(0.0, stats.fragmentation());
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(2 * i + 1, buffer[i * 2 * kPage]);
+    }
+
+    // The moved allocations are freed at their new offsets.
+    EXPECT_TRUE(allocator.free(buffer.data()));
+    EXPECT_FALSE(allocator.free(ptrs[7]));
+}
+
+// Tests that a fresh heap hands out all of itself, whatever its size.
+TEST(SubAllocator, TlsfWholeBuffer) {
+    constexpr uint64_t kPage = 4096;
+    std::vector<uint8_t> buffer(1024 * kPage);
+    for (uint64_t pages = 1; pages <= 1024; ++pages) {
+        SubAllocator allocator(buffer.data(), pages * kPage, kPage,
+                               SubAllocator::Strategy::Tlsf);
+        EXPECT_EQ(buffer.data(), allocator.alloc(pages * kPage)) << pages << " pages";
+    }
+}
+
+// Tests the blocks of dedicated allocations, which are exactly as large as
+// the one allocation made from them, at both page sizes in use.
+TEST(SubAllocator, TlsfDedicatedSizes) {
+    const uint64_t kSizes[] = {
+        1, 4095, 4096, 4097, 65535, 65536, 65537, 100000, 256 * 1024 + 1,
+        1920 * 1080 * 4, 2048 * 2048 * 4, 3840 * 2160 * 4, 16 * 1048576 - 1,
+    };
+    for (uint64_t page : {uint64_t(4096), uint64_t(65536)}) {
+        for (uint64_t size : kSizes) {
+            const uint64_t blockSize = (size + page - 1) / page * page;
+            std::vector<uint8_t> buffer(blockSize);
+            SubAllocator allocator(buffer.data(), blockSize, page,
+                                   SubAllocator::Strategy::Tlsf);
+            EXPECT_EQ(buffer.data(), allocator.alloc(size)) << size << " at page " << page;
+        }
+    }
+}
+
+// Tests that batches fill and drain the channel in order.
+TEST(LockFreeMessageChannel, Batches) {
+    LockFreeMessageChannel<int, 8> channel;
+    const int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    EXPECT_EQ(8u, channel.trySend(values, 10));
+    EXPECT_FALSE(channel.trySend(8));
+    EXPECT_EQ(8u, channel.size());
+
+    int received[10] = {};
+    EXPECT_EQ(3u, channel.tryReceive(received, 3));
+    EXPECT_EQ(2u, channel.trySend(values + 8, 2));
+    EXPECT_EQ(7u, channel.tryReceive(received + 3, 10));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(i, received[i]);
+    }
+    EXPECT_FALSE(channel.tryReceive(received));
+}
+
+// Tests that every message sent by several blocking senders is received
+// exactly once by several blocking receivers.
+TEST(LockFreeMessageChannel, ManyToMany) {
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 20000;
+    LockFreeMessageChannel<int, 16> channel;
+    std::atomic<int64_t> sum = {0};
+    std::atomic<int> count = {0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&channel, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                EXPECT_TRUE(channel.send(t * kPerThread + i));
+            }
+        });
+        threads.emplace_back([&channel, &sum, &count] {
+            int batch[4];
+            while (size_t received = channel.receive(batch, 4)) {
+                for (size_t i = 0; i < received; ++i) sum += batch[i];
+                count += (int)received;
+            }
+        });
+    }
+    while (count.load() < kThreads * kPerThread) {
+        std::this_thread::yield();
+    }
+    channel.stop();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const int64_t total = int64_t(kThreads) * kPerThread;
+    EXPECT_EQ(total, count.load());
+    EXPECT_EQ(total * (total - 1) / 2, sum.load());
+}
+
 } // namespace android
 } // namespace base
 } // namespace guest